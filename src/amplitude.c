@@ -2,6 +2,7 @@
  * channel volumes on the master audio output. */
 
 #include <math.h>
+#include <stddef.h>
 
 #include "amplitude.h"
 
@@ -12,10 +13,32 @@ makeAmplitude(void) {
 
 /* Initialize an Amplitude struct with default channel volumes. */
 
-  Amplitude a = {1.0f, 0.1f, 1.0f};
+  Amplitude a = {0};
+  size_t c = 0;
+
+  a.Master = 0.1f;
+  for (; c < MAX_CHANNELS ; c++) {
+    a.Channels[c] = 1.0f;
+    a.Gains[c] = a.Master;
+  }
   return a;
 }
 
+void
+rampAmplitude(Amplitude *a, const size_t frames) {
+
+/* Works out the per-frame steps that bring every channel to its current
+ * volume over the next "frames" frames, so that volume and balance changes
+ * do not click. */
+
+  size_t c = 0;
+
+  for (; c < MAX_CHANNELS ; c++) {
+    a->Steps[c] = ((a->Master * a->Channels[c]) - a->Gains[c]) /
+      (float)frames;
+  }
+}
+
 void
 setBalance(Amplitude *a, const float f) {
 
@@ -24,8 +47,8 @@ setBalance(Amplitude *a, const float f) {
  * represents full amplitude to the right. */
 
   const float tf = truncateFloat(f, 1.0f);
-  a->L = truncateFloat(1.0f - (2.0f * (tf - 0.5f)), 1.0f);
-  a->R = truncateFloat(1.0f - (2.0f * (0.5f - tf)), 1.0f); 
+  a->Channels[0] = truncateFloat(1.0f - (2.0f * (tf - 0.5f)), 1.0f);
+  a->Channels[1] = truncateFloat(1.0f - (2.0f * (0.5f - tf)), 1.0f); 
 }
 
 void
@@ -1,14 +1,24 @@
 #pragma once
 
+#include <stddef.h>
+
+#include "constants/maximums.h"
+
 typedef struct Amplitude {
 
-/* Amplitudes for master output, as well as left/right channel balance. */
+/* Amplitudes for master output, as well as the volume of every output
+ * channel. The left/right balance is applied to the first two channels.
+ * Amplitude.Gains holds the gain each channel is actually output at, which
+ * moves by Amplitude.Steps every frame until it reaches the product of the
+ * master and channel volumes. */
 
-  float L;
   float Master;
-  float R;
+  float Channels[MAX_CHANNELS];
+  float Gains[MAX_CHANNELS];
+  float Steps[MAX_CHANNELS];
 } Amplitude;
 
 Amplitude makeAmplitude(void);
+void rampAmplitude(Amplitude *, const size_t);
 void setBalance(Amplitude *, const float);
 void setVolume(Amplitude *, const float);
@@ -13,11 +13,18 @@
 
 #include "amplitude.h"
 #include "audio-settings.h"
+#include "bench.h"
 #include "buffers.h"
+#include "clock.h"
 #include "constants/defaults.h"
 #include "constants/errors.h"
 #include "constants/maximums.h"
+#include "events.h"
+#include "patch.h"
+#include "resample.h"
+#include "sequencer.h"
 #include "voice.h"
+#include "wavetable.h"
 
 static void populateSettings(const AudioSettings *, struct sio_par *); 
 static void openOutput(struct sio_hdl **);
@@ -38,9 +45,11 @@ populateSettings(const AudioSettings *aos, struct sio_par *sp) {
 
   sio_initpar(sp);
   sp->bits = aos->Bits;
+  sp->sig = 1;
+  sp->le = SIO_LE_NATIVE;
   sp->appbufsz = aos->BufSizeFrames * aos->BufBlocks;
   sp->rate = aos->Rate;
-  sp->pchan = DEFAULT_CHAN;
+  sp->pchan = aos->Channels;
 }
 
 static void
@@ -96,12 +105,15 @@ roundBuffer(AudioSettings *aos, const struct sio_par *sp) {
 static void
 setSettings(AudioSettings *aos, const struct sio_par *sp) {
 
-/* Runs setSetting() on essential playback parameters. */
+/* Runs setSetting() on essential playback parameters. The render rate and
+ * block are derived again in case the hardware changed the rate. */
 
   setSetting(aos->Bits, sp->bits, &aos->Bits, "bits");
   setSetting(aos->BufSizeFrames, roundBuffer(aos, sp), &aos->BufSizeFrames, 
-      "block size");
+      "buffer size");
   setSetting(aos->Rate, sp->rate, &aos->Rate, "rate");
+  setSetting(aos->Channels, sp->pchan, &aos->Channels, "channels");
+  setRenderSettings(aos);
 }
 
 static void
@@ -122,8 +134,11 @@ checkSettings(struct sio_par *sp) {
   if (sp->bits != DEFAULT_BITS) {
     errx(ERROR_SIO, "Expected %d bit output.", DEFAULT_BITS);
   }
-  if (sp->pchan != DEFAULT_CHAN) {
-    errx(ERROR_SIO, "Expected %d channels.", DEFAULT_CHAN);
+  if (sp->bps != DEFAULT_BYTES || !sp->sig || sp->le != SIO_LE_NATIVE) {
+    errx(ERROR_SIO, "Expected signed native-endian samples.");
+  }
+  if (sp->pchan < 1 || sp->pchan > MAX_CHANNELS) {
+    errx(ERROR_SIO, "Expected between 1 and %d channels.", MAX_CHANNELS);
   }
 }
 
@@ -136,6 +151,10 @@ makeAudio(Audio *a, const int argc, char **argv) {
   struct sio_par sp = {0};
 
   makeAudioSettings(&a->Settings, argc, argv);
+  if (a->Settings.Bench) {
+    runBench(&a->Settings);
+    exit(0);
+  }
   /* First suggestion */
   populateSettings(&a->Settings, &sp);
   openOutput(&a->Output);
@@ -149,18 +168,43 @@ makeAudio(Audio *a, const int argc, char **argv) {
   setSettings(&a->Settings, &sp);
   checkSettings(&sp);
   /* Should this be BufSizeFrames * BufBlocks too? */
-  a->Buffer = makeBuffer(a->Settings.BufSizeFrames);
+  a->Buffer = makeBuffer(a->Settings.BufSizeFrames, a->Settings.BlockFrames,
+      a->Settings.Channels);
+  makeWavetables(a->Settings.Tables);
+  if (a->Settings.Compact) {
+    useCompactTables();
+  }
   makeVoices(&a->Voices, a->Buffer.Mix, &a->Settings);
+  makeBank(&a->Bank, a->Settings.Bank);
+  makeSequencer(&a->Sequencer, a->Settings.RenderRate);
+  if (a->Settings.RenderRate != a->Settings.Rate) {
+    warnx("Rendering at %u and resampling to %u", a->Settings.RenderRate,
+        a->Settings.Rate);
+    makeResampler(&a->Resampler, a->Settings.RenderRate, a->Settings.Rate,
+        a->Settings.Channels, a->Settings.BlockFrames);
+  }
   a->Amplitude = makeAmplitude();
+  makeClock(&a->Clock);
+  makeEvents(&a->Events);
+  makeLatest(&a->Latest);
+  sio_onmove(a->Output, onMove, &a->Clock);
   startAudio(a->Output);
 }
 
 void
 killAudio(Audio *a) {
 
-/* Stops sndio. Frees all memory allocated by Audio type. */
+/* Stops sndio and prints a summary of playback counters. Frees all memory
+ * allocated by Audio type. */
 
   sio_close(a->Output); 
+  printClock(&a->Clock, a->Settings.Rate);
   killBuffer(&a->Buffer);
+  if (a->Settings.RenderRate != a->Settings.Rate) {
+    killResampler(&a->Resampler);
+  }
   killVoices(&a->Voices);
+  killBank(&a->Bank);
+  killSequencer(&a->Sequencer);
+  killWavetables();
 }
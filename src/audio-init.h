@@ -3,6 +3,11 @@
 #include "amplitude.h"
 #include "audio-settings.h"
 #include "buffers.h"
+#include "clock.h"
+#include "events.h"
+#include "patch.h"
+#include "resample.h"
+#include "sequencer.h"
 #include "voice.h"
 
 
@@ -13,11 +18,23 @@ typedef struct Audio {
  * The samples in the MixingBuffer are multiplied against the master volume
  * specified by Audio.Amplitude, then broken down into individual bytes and
  * written to Audio.MainBuffer, which is finally converted to sound by
- * Audio.Output. */
+ * Audio.Output. Audio.Clock follows the hardware position of Audio.Output.
+ * When synthesis runs at a fixed internal rate that differs from the device
+ * rate, Audio.Resampler converts the mix between them. Audio.Events holds
+ * commands that are waiting for their frame on the render clock, and
+ * Audio.Sequencer adds the commands of its patterns to them. Audio.Latest holds
+ * parameter commands until the next block. Audio.Bank holds stored
+ * patches. */
 
   Amplitude               Amplitude;
+  Bank                    Bank;
   Buffer                  Buffer;
+  Clock                   Clock;
+  Events                  Events;
+  Latest                  Latest;
   struct sio_hdl        * Output;
+  Resampler               Resampler;
+  Sequencer               Sequencer;
   AudioSettings           Settings;
   Voices                  Voices;
 } Audio;
@@ -6,65 +6,153 @@
 #include <poll.h>
 #include <sndio.h>
 #include <stdint.h>
-#include <string.h>
+#include <stdlib.h>
 
 #include "audio-output.h"
 
 #include "amplitude.h"
 #include "audio-init.h"
 #include "buffers.h"
+#include "clock.h"
 #include "constants/defaults.h"
 #include "constants/errors.h"
+#include "dispatch.h"
+#include "events.h"
 #include "numerical.h"
+#include "parse.h"
+#include "patch.h"
+#include "resample.h"
+#include "sequencer.h"
 #include "voice.h"
 
-static void clearBuffer(Buffer *);
-static void fillBuffer(Audio *);
-static int16_t mixdownSample(const float, const float, const float);
-static void writeFrames(Audio *);
+static void renderFrames(Audio *, const size_t, const size_t);
+static Error fillBuffer(Audio *);
+static int16_t mixdownSample(const float, const float);
+static void convertFrames(Amplitude *, float *, float *, const size_t,
+    const size_t, int16_t *, const size_t);
+static void waitReady(Audio *);
+static void writeOutput(Audio *);
+static void writeFrames(Audio *, float *, float *, const size_t,
+    const size_t);
 
 static void
-clearBuffer(Buffer *b) {
+renderFrames(Audio *a, const size_t offset, const size_t frames) {
 
-/* Explicitly zeroes Audio.Buffer.Mix, since sample data is summed up inside
- * of it. This differs from Audio.Buffer.Output, which can simply be overwritten
- * during each cycle. */
+/* Calculates "frames" samples of all Voices and sums them up in
+ * Audio.Buffer.Mix, starting "offset" samples into the block. The master
+ * phase is the render clock, and is incremented by the number of frames
+ * rendered. */
 
-  memset(b->Mix, 0, sizeof(*b->Mix) * DEFAULT_BUFSIZE);
+  unsigned int n = 0;
+
+  if (frames == 0) {
+    return;
+  }
+  for (; n < a->Settings.Polyphony ; n++) {
+    pollVoice(&a->Voices, &a->Voices.All[n], offset, frames);
+  }
+  a->Voices.Phase += frames;
 }
 
-static void
+static Error
 fillBuffer(Audio *a) {
 
-/* Calculates all sample data from Audio.Voices and sums it up in
- * Audio.Buffer.Mix. The master phase is incremented by DEFAULT_BUFSIZE as a
- * rough phase-tracking heuristic for new notes. */ 
-
-  unsigned int n = 0;
-
-  for (; n < a->Settings.Polyphony ; n++) {
-    pollVoice(&a->Voices.All[n]);
+/* Calculates a block of sample data from Audio.Voices and sums it up in
+ * Audio.Buffer.Mix. Rendering stops at the frame of every due Event in
+ * Audio.Events, so that scheduled commands take effect on the exact sample
+ * they asked for. Events that are already late run at the start of the block.
+ * Held parameter commands and a recalled patch are applied before anything is
+ * rendered, and the sequencer queues the steps that fall inside the block.
+ * Returns ERROR_EXIT if a scheduled command asked to quit. */
+
+  size_t done = 0;
+  size_t offset = 0;
+  uint64_t due = 0;
+  const uint64_t start = a->Voices.Phase;
+  const size_t frames = a->Settings.BlockFrames;
+  Cmd c = {0};
+  Error e = ERROR_OK;
+
+  flushCmds(a);
+  applyPending(&a->Bank, &a->Voices, &a->Amplitude);
+  runSequencer(&a->Sequencer, &a->Events, start, frames);
+  while ((due = nextEvent(&a->Events)) < start + frames) {
+    offset = due > start ? (size_t)(due - start) : 0;
+    if (offset > done) {
+      renderFrames(a, done, offset - done);
+      done = offset;
+    }
+    popEvent(&a->Events, &c);
+    if (dispatchCmd(a, &c) == ERROR_EXIT) {
+      e = ERROR_EXIT;
+    }
   }
-  a->Voices.Phase += DEFAULT_BUFSIZE; /* Maybe something else */
+  renderFrames(a, done, frames - done);
+  return e;
 }
 
 static int16_t
-mixdownSample(const float s, const float masterAmp, const float chanAmp) {
+mixdownSample(const float s, const float amp) {
 
-/* Takes a float from Audio.MixingBuffer and returns an int16_t with simple
+/* Takes a float from Audio.Buffer.Mix and returns an int16_t with simple
  * dither noise added to it. This algorithm was adapted from Jonas Norberg's
- * post on KVR Audio. */
+ * post on KVR Audio. "amp" is the product of the master and channel
+ * amplitudes. */
 
   float r = (rand() / ((float)RAND_MAX * 0.5f)) - 1.0f;
 
   r /= (float)(USHRT_MAX + 1);
-  return (int16_t)(roundf(clip(s + r) * (float)SHRT_MAX) * masterAmp * chanAmp);
+  return (int16_t)(roundf(clip(s + r) * (float)SHRT_MAX) * amp);
+}
+
+static void
+convertFrames(Amplitude *amp, float *all, float *planar,
+    const size_t stride, const size_t chans, int16_t *out,
+    const size_t frames) {
+
+/* Converts "frames" samples of planar channel data straight into their final
+ * place in the device buffer. Channel c starts c * stride samples into
+ * "planar". If "all" is not NULL, it is a shared bus that is added to every
+ * channel. The channels are only interleaved here. Each sample is zeroed once
+ * it has been read, which saves a separate clearing pass over
+ * Audio.Buffer.Mix before the next block is summed into it. The gain of each
+ * channel follows the ramp set up by rampAmplitude(). */
+
+  size_t c = 0;
+  size_t n = 0;
+  float g = 0.0f;
+  float step = 0.0f;
+  float *bus = NULL;
+
+  for (; c < chans ; c++) {
+    g = amp->Gains[c];
+    step = amp->Steps[c];
+    bus = planar + (c * stride);
+    if (all == NULL) {
+      for (n = 0 ; n < frames ; n++) {
+        g += step;
+        out[(n * chans) + c] = mixdownSample(bus[n], g);
+        bus[n] = 0.0f;
+      }
+    } else {
+      for (n = 0 ; n < frames ; n++) {
+        g += step;
+        out[(n * chans) + c] = mixdownSample(all[n] + bus[n], g);
+        bus[n] = 0.0f;
+      }
+    }
+    amp->Gains[c] = g;
+  }
+  for (n = 0 ; all != NULL && n < frames ; n++) {
+    all[n] = 0.0f;
+  }
 }
 
 static void
 waitReady(Audio *a) {
 
-/* Allows non-blocking audio IO by waiting to write. 
+/* Allows non-blocking audio IO by waiting to write. sio_revents() also runs
+ * the sio_onmove() callback, so Audio.Clock is current once this returns.
  * Shamelessly pilfered from https://sndio.org/tips.html */
 
     int nfds = 0;
@@ -82,56 +170,85 @@ waitReady(Audio *a) {
 }
 
 static void
-writeFrames(Audio *a) {
-
-/* Writes DEFAULT_BUFSIZE worth of frames from Audio.Buffer.Mix to
- * Audio.Buffer.Output. These floats representing an internal monophonic
- * signal are dithered and output as 16 bit signed integers representing
- * the stereo signal. Since DEFAULT_BUFSIZE may not be a perfect multiple of
- * Audio.Buffer.SizeFrames, a call to sio_write may take place within the middle 
- * of this loop. */
-
-  int16_t sl = 0;
-  int16_t sr = 0;
-  float s = 0.0f;
+writeOutput(Audio *a) {
+
+/* Hands all of Audio.Buffer.Output to sndio. The handle is non-blocking, so
+ * sio_write may take fewer bytes than it was given. It is called again with
+ * the rest once the device is ready, and Audio.Clock only counts the frames
+ * that sndio has actually taken. */
+
+  const size_t frameBytes = a->Buffer.Channels * sizeof(int16_t);
+  const char *out = (const char *)a->Buffer.Output;
+  size_t done = 0;
   size_t n = 0;
-  size_t localFramesWritten = 0;
+
+  waitReady(a);
+  tickClock(&a->Clock);
+  while (done < a->Buffer.SizeBytes) {
+    n = sio_write(a->Output, out + done, a->Buffer.SizeBytes - done);
+    if (n == 0 && sio_eof(a->Output)) {
+      errx(ERROR_SIO, "Error writing to sndio");
+    }
+    advanceClock(&a->Clock, ((done + n) / frameBytes) - (done / frameBytes));
+    done += n;
+    if (done < a->Buffer.SizeBytes) {
+      waitReady(a);
+    }
+  }
+}
+
+static void
+writeFrames(Audio *a, float *all, float *planar, const size_t stride,
+    const size_t frames) {
+
+/* Writes a block worth of planar frames to Audio.Buffer.Output. These are
+ * either the mixing buses of Audio.Buffer.Mix, or the output of
+ * Audio.Resampler. The floats are dithered and output as interleaved 16 bit
+ * signed integers. They are converted directly into the region of the device
+ * buffer they will be played from, so there is no staging copy. When
+ * Audio.Buffer.SizeFrames is a multiple of the block size, this is a single
+ * pass. Otherwise a call to sio_write may take place within the middle of the
+ * block. Volume and balance changes are ramped across the whole block. */
+
+  size_t done = 0;
   size_t limit = 0;
   Buffer *b = &a->Buffer;
-  size_t tillWrite = b->SizeFrames - b->FramesWritten;
-  while (localFramesWritten < DEFAULT_BUFSIZE) {
-    limit = LESSER(tillWrite, DEFAULT_BUFSIZE);
-    for (n = 0 ; n < limit ; n++) {
-      /* Will eventually have channel independent amplitudes here. */
-      s = b->Mix[localFramesWritten + n];
-      sl = mixdownSample(s, a->Amplitude.Master, a->Amplitude.L);
-      sr = mixdownSample(s, a->Amplitude.Master, a->Amplitude.R);
-      b->Output[b->BytesWritten++] = (uint8_t)(sl & 255);
-      b->Output[b->BytesWritten++] = (uint8_t)(sl >> 8);
-      b->Output[b->BytesWritten++] = (uint8_t)(sr & 255);
-      b->Output[b->BytesWritten++] = (uint8_t)(sr >> 8);
-    }
-    localFramesWritten += limit;
+
+  rampAmplitude(&a->Amplitude, frames);
+  while (done < frames) {
+    limit = LESSER(b->SizeFrames - b->FramesWritten, frames - done);
+    convertFrames(&a->Amplitude, all == NULL ? NULL : all + done,
+        planar + done, stride, b->Channels,
+        b->Output + (b->FramesWritten * b->Channels), limit);
+    done += limit;
     b->FramesWritten += limit;
     if (b->FramesWritten == b->SizeFrames) {
-      waitReady(a);
-      sio_write(a->Output, b->Output, b->SizeBytes);
+      writeOutput(a);
       b->FramesWritten = 0;
-      b->BytesWritten = 0;
     }
-    tillWrite = DEFAULT_BUFSIZE - localFramesWritten;
   }
 }
 
-void
+Error
 play(Audio *a) {
 
-/* Calculates DEFAULT_BUFSIZE frames worth of synthesis data and writes them to
+/* Calculates a block of frames worth of synthesis data and writes them to
  * Audio.Buffer.Output. This output buffer will eventually be dumped to sndio, 
  * but this may not occur during every invocation of this function. It depends 
- * on the Audio.Buffer.SizeFrames returned by the hardware settings. */
+ * on the Audio.Buffer.SizeFrames returned by the hardware settings. If boar
+ * renders at a fixed internal rate, the block is resampled to the device rate
+ * first. Returns ERROR_EXIT if a scheduled command asked to quit. */
 
-  clearBuffer(&a->Buffer);
-  fillBuffer(a);
-  writeFrames(a);
+  Buffer *b = &a->Buffer;
+  Resampler *r = &a->Resampler;
+  Error e = ERROR_OK;
+
+  e = fillBuffer(a);
+  if (a->Settings.RenderRate != a->Settings.Rate) {
+    resample(r, b->Mix, b->MixFrames);
+    writeFrames(a, NULL, r->Out, r->OutStride, r->OutFrames);
+  } else {
+    writeFrames(a, b->Mix, b->Mix + b->MixFrames, b->MixFrames, b->MixFrames);
+  }
+  return e;
 }
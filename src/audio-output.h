@@ -1,5 +1,6 @@
 #pragma once
 
 #include "audio-init.h"
+#include "constants/errors.h"
 
-void play(Audio *);
+Error play(Audio *);
@@ -4,6 +4,7 @@
 
 #include <err.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -43,6 +44,32 @@ parseFlag(const char *flag, const char *val, const unsigned int min,
   }
 }
 
+void
+setRenderSettings(AudioSettings *aos) {
+
+/* Derives the render rate, which is the -internal rate if one was given, or
+ * the device rate otherwise. Then derives the internal render block size from
+ * the render rate, unless it was fixed with the -block flag. The block is
+ * rounded up to a whole number of DEFAULT_VECTOR_FRAMES so that synthesis
+ * loops never end on a partial vector. This has to be run again whenever the
+ * hardware overrides the rate. */
+
+  unsigned int frames = aos->BlockFrames;
+
+  aos->RenderRate = aos->InternalRate ? aos->InternalRate : aos->Rate;
+  if (aos->Resolution) {
+    frames = aos->RenderRate / aos->Resolution;
+  }
+  frames += DEFAULT_VECTOR_FRAMES - 1;
+  frames -= frames % DEFAULT_VECTOR_FRAMES;
+  if (frames < DEFAULT_VECTOR_FRAMES) {
+    frames = DEFAULT_VECTOR_FRAMES;
+  } else if (frames > MAX_BLOCK_FRAMES) {
+    frames = MAX_BLOCK_FRAMES;
+  }
+  aos->BlockFrames = frames;
+}
+
 void
 makeAudioSettings(AudioSettings *aos, const int argc, char **argv) {
 
@@ -51,21 +78,62 @@ makeAudioSettings(AudioSettings *aos, const int argc, char **argv) {
   int i = 1;
   char *arg = NULL;
 
+  aos->Bench = false;
+  aos->Binary = false;
   aos->Bits = DEFAULT_BITS;
+  aos->Cache = true;
   aos->BufBlocks = DEFAULT_BUF_BLOCKS;
-  aos->BufSizeFrames = DEFAULT_BUFSIZE;
+  aos->Channels = DEFAULT_CHAN;
+  aos->Commands = DEFAULT_COMMANDS;
+  aos->Compact = false;
+  aos->InternalRate = 0;
+  aos->Midi = NULL;
+  aos->Socket = NULL;
+  aos->Bank = NULL;
+  aos->Tables = NULL;
   aos->Rate = DEFAULT_RATE;
+  aos->Resolution = DEFAULT_RESOLUTION;
   aos->Polyphony = DEFAULT_POLYPHONY;
   for (; i < argc ; i++) {
     arg = argv[i];
     if (isFlag(arg, "-rate") && i+1 < argc) {
       parseFlag(arg, argv[++i], 1, MAX_RATE, &aos->Rate);
+    } else if (isFlag(arg, "-internal") && i+1 < argc) {
+      parseFlag(arg, argv[++i], 1, MAX_RATE, &aos->InternalRate);
     } else if (isFlag(arg, "-polyphony") && i+1 < argc) {
       parseFlag(arg, argv[++i], 1, MAX_POLYPHONY, &aos->Polyphony);
     } else if (isFlag(arg, "-blocks") && i+1 < argc) {
       parseFlag(arg, argv[++i], 1, MAX_BUF_BLOCKS, &aos->BufBlocks);
+    } else if (isFlag(arg, "-channels") && i+1 < argc) {
+      parseFlag(arg, argv[++i], 1, MAX_CHANNELS, &aos->Channels);
+    } else if (isFlag(arg, "-block") && i+1 < argc) {
+      parseFlag(arg, argv[++i], 1, MAX_BLOCK_FRAMES, &aos->BlockFrames);
+      aos->Resolution = 0;
+    } else if (isFlag(arg, "-resolution") && i+1 < argc) {
+      parseFlag(arg, argv[++i], 1, MAX_RESOLUTION, &aos->Resolution);
+    } else if (isFlag(arg, "-commands") && i+1 < argc) {
+      parseFlag(arg, argv[++i], 1, MAX_COMMANDS, &aos->Commands);
+    } else if (isFlag(arg, "-midi") && i+1 < argc) {
+      aos->Midi = argv[++i];
+    } else if (isFlag(arg, "-socket") && i+1 < argc) {
+      aos->Socket = argv[++i];
+    } else if (isFlag(arg, "-bank") && i+1 < argc) {
+      aos->Bank = argv[++i];
+    } else if (isFlag(arg, "-tables") && i+1 < argc) {
+      aos->Tables = argv[++i];
+    } else if (isFlag(arg, "-binary")) {
+      aos->Binary = true;
+    } else if (isFlag(arg, "-compact")) {
+      aos->Compact = true;
+    } else if (isFlag(arg, "-nocache")) {
+      aos->Cache = false;
+    } else if (isFlag(arg, "-bench")) {
+      aos->Bench = true;
     } else {
       errx(ERROR_ARG, "Malformed parameter: %s", arg);
     } 
   }
+  setRenderSettings(aos);
+  aos->BufSizeFrames = (unsigned int)(((uint64_t)aos->BlockFrames * aos->Rate) /
+      aos->RenderRate);
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdbool.h>
+
 #include "constants/errors.h"
 
 typedef struct AudioSettings {
@@ -8,13 +10,41 @@ typedef struct AudioSettings {
  * fields in this struct do not have to be referenced after initializing the
  * handle to the soundcard, but they are kept here in case future iterations
  * of this code need to make use of any of them. Other structs might contain
- * pointers to or local copies of these read-only values. */
+ * pointers to or local copies of these read-only values. BlockFrames is the
+ * number of frames synthesized between polls for user input. It is derived
+ * from RenderRate / Resolution, unless the user asked for an explicit size, in
+ * which case Resolution is zero. Rate is the rate of the sound device, while
+ * RenderRate is the rate synthesis takes place at. They are the same unless
+ * a fixed InternalRate was requested, in which case the output is resampled
+ * from one to the other. Binary is set when commands arrive on stdin as
+ * binary packets rather than text. Midi names the MIDI input, if any.
+ * Commands is the most commands that are run between two blocks. Socket is
+ * the path of the control socket, if any, Bank the path of the patch bank
+ * file, and Tables the path of the wavetable file. Compact is set when
+ * oscillators read 16 bit copies of the wavetables, Bench when boar
+ * should only time its synthesis and exit, and Cache when settled voices may
+ * be played back from a loop. */
 
   unsigned int  Bits;
+  unsigned int  BlockFrames;
   unsigned int  BufSizeFrames;
   unsigned int  BufBlocks;
+  unsigned int  Channels;
+  unsigned int  Commands;
+  unsigned int  InternalRate;
   unsigned int  Rate;
+  unsigned int  RenderRate;
+  unsigned int  Resolution;
   unsigned int  Polyphony;
+  bool          Bench;
+  bool          Binary;
+  bool          Cache;
+  bool          Compact;
+  const char  * Midi;
+  const char  * Socket;
+  const char  * Bank;
+  const char  * Tables;
 } AudioSettings;
 
+void setRenderSettings(AudioSettings *);
 void makeAudioSettings(AudioSettings *, const int, char **);
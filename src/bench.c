@@ -0,0 +1,253 @@
+/* A benchmark of synthesis, run instead of playback with the -bench flag.
+ * Consult "bench.h" for more info. */
+
+#include <err.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+#include "audio-settings.h"
+#include "buffers.h"
+#include "constants/defaults.h"
+#include "constants/errors.h"
+#include "constants/maximums.h"
+#include "synthesis.h"
+#include "voice.h"
+#include "wave.h"
+#include "wavetable.h"
+
+static const char * const QUALITIES[QUALITY_NUM] = {
+  "truncated", "linear", "cubic Hermite", "polyphase"
+};
+
+static double renderBench(const AudioSettings *, float *, const size_t,
+    const Quality);
+static double referenceSample(const double *, const double *, const double);
+static double measureQuality(const AudioSettings *, const Quality);
+
+static double
+renderBench(const AudioSettings *aos, float *out, const size_t frames,
+    const Quality q) {
+
+/* Plays a note on every voice, with a saw carrier and a square modulator so
+ * that the voices read from many levels of two waves, and renders "frames"
+ * frames of them with both operators interpolating at Quality "q". The sum of
+ * every bus is stored in "out". Returns the number of seconds that rendering
+ * took. */
+
+  unsigned int n = 0;
+  size_t i = 0;
+  size_t done = 0;
+  size_t bus = 0;
+  const size_t block = aos->BlockFrames;
+  struct timespec start = {0};
+  struct timespec end = {0};
+  Buffer b = makeBuffer(block, block, aos->Channels);
+  Voices vs = {0};
+
+  makeVoices(&vs, b.Mix, aos);
+  selectWave(&vs.Carrier.Wave, WAVE_TYPE_SAW);
+  selectWave(&vs.Modulator.Wave, WAVE_TYPE_SQUARE);
+  setModulation(&vs, 1.0f);
+  setQuality(&vs.Carrier.Quality, q);
+  setQuality(&vs.Modulator.Quality, q);
+  for (; n < vs.N ; n++) {
+    voiceOn(&vs, (uint16_t)((24 + ((n * 7) % 72)) | (MAX_MIDI_VALUE << 9)));
+  }
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (; done + block <= frames ; done += block) {
+    for (n = 0 ; n < vs.N ; n++) {
+      pollVoice(&vs, &vs.All[n], 0, block);
+    }
+    vs.Phase += block;
+    for (i = 0 ; i < block ; i++) {
+      out[done + i] = 0.0f;
+      for (bus = 0 ; bus <= aos->Channels ; bus++) {
+        out[done + i] += b.Mix[(bus * block) + i];
+      }
+    }
+    memset(b.Mix, 0, block * (aos->Channels + 1) * sizeof(*b.Mix));
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  killVoices(&vs);
+  killBuffer(&b);
+  return (double)(end.tv_sec - start.tv_sec) +
+    ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+}
+
+static double
+referenceSample(const double *re, const double *im, const double phase) {
+
+/* Returns what a band-limited table with the Fourier coefficients "re" and
+ * "im" holds at a fractional "phase", with no interpolation error. */
+
+  const double w = 2.0 * M_PI * phase / DEFAULT_WAVELEN;
+  const double stepRe = cos(w);
+  const double stepIm = sin(w);
+  double zRe = 1.0;
+  double zIm = 0.0;
+  double t = 0.0;
+  double s = re[0];
+  size_t k = 1;
+
+  for (; k < DEFAULT_WAVELEN / 2 ; k++) {
+    t = (zRe * stepRe) - (zIm * stepIm);
+    zIm = (zRe * stepIm) + (zIm * stepRe);
+    zRe = t;
+    s += (re[k] * zRe) + (im[k] * zIm);
+  }
+  return s;
+}
+
+static double
+measureQuality(const AudioSettings *aos, const Quality q) {
+
+/* Plays a saw at about 440 Hz on a single voice, with no modulation, and
+ * compares a second of it against the same level of the saw table read with
+ * no interpolation error. The pitch is rounded to an odd multiple of 1/4096,
+ * so that the phase of every sample is exact yet visits every fraction of a
+ * sample that a float can hold there. The harmonic distortion and aliasing
+ * are whatever is left over. Returns their level in dB. */
+
+  size_t i = 0;
+  size_t k = 0;
+  size_t done = 0;
+  size_t bus = 0;
+  const size_t block = aos->BlockFrames;
+  const size_t frames = aos->RenderRate + block;
+  const float *t = NULL;
+  double phase = 0.0;
+  double step = 0.0;
+  double y = 0.0;
+  double cross = 0.0;
+  double power = 0.0;
+  double error = 0.0;
+  double gain = 0.0;
+  double *re = calloc(DEFAULT_WAVELEN / 2, sizeof(*re));
+  double *im = calloc(DEFAULT_WAVELEN / 2, sizeof(*im));
+  double *ref = calloc(frames, sizeof(*ref));
+  float *out = calloc(frames, sizeof(*out));
+  Buffer b = makeBuffer(block, block, aos->Channels);
+  Voices vs = {0};
+  Osc *o = NULL;
+
+  if (re == NULL || im == NULL || ref == NULL || out == NULL) {
+    errx(ERROR_ALLOC, "Error allocating benchmark buffers");
+  }
+  makeVoices(&vs, b.Mix, aos);
+  selectWave(&vs.Carrier.Wave, WAVE_TYPE_SAW);
+  setModulation(&vs, 0.0f);
+  setQuality(&vs.Carrier.Quality, q);
+  voiceOn(&vs, (uint16_t)(69 | (MAX_MIDI_VALUE << 9)));
+  o = &vs.Active[69]->Carrier.Osc;
+  o->Target = ((2.0f * floorf(o->Target * 2048.0f)) + 1.0f) / 4096.0f;
+  o->Pitch = o->Target;
+  o->Phase = 0.0f;
+  limitBand(o);
+  t = o->Wave->Table[o->Level];
+  for (i = 0 ; i < DEFAULT_WAVELEN ; i++) {
+    for (k = 0 ; k < DEFAULT_WAVELEN / 2 ; k++) {
+      y = 2.0 * M_PI * (double)((i * k) % DEFAULT_WAVELEN) / DEFAULT_WAVELEN;
+      re[k] += t[i] * cos(y) * (k == 0 ? 1.0 : 2.0) / DEFAULT_WAVELEN;
+      im[k] += t[i] * sin(y) * 2.0 / DEFAULT_WAVELEN;
+    }
+  }
+  for (; done + block <= frames ; done += block) {
+    pollVoice(&vs, vs.Active[69], 0, block);
+    vs.Phase += block;
+    for (i = 0 ; i < block ; i++) {
+      for (bus = 0 ; bus <= aos->Channels ; bus++) {
+        out[done + i] += b.Mix[(bus * block) + i];
+      }
+    }
+    memset(b.Mix, 0, block * (aos->Channels + 1) * sizeof(*b.Mix));
+  }
+  step = (double)o->Target * o->Wave->Polarity;
+  for (i = 0 ; i < done ; i++) {
+    phase = fmod(phase + step + DEFAULT_WAVELEN, DEFAULT_WAVELEN);
+    ref[i] = referenceSample(re, im, phase);
+  }
+  for (i = block ; i < done ; i++) {
+    cross += out[i] * ref[i];
+    power += ref[i] * ref[i];
+  }
+  gain = cross / power;
+  for (i = block ; i < done ; i++) {
+    y = out[i] - (gain * ref[i]);
+    error += y * y;
+  }
+  killVoices(&vs);
+  killBuffer(&b);
+  free(re);
+  free(im);
+  free(ref);
+  free(out);
+  return 10.0 * log10(error / (gain * gain * power));
+}
+
+void
+runBench(const AudioSettings *aos) {
+
+/* Renders DEFAULT_BENCH_SECONDS of audio with every interpolation Quality,
+ * reporting the time each took and the distortion that measureQuality()
+ * finds in it. These renders leave the Voice caches off, so that every
+ * sample is synthesized. Then renders the linear audio again with the caches,
+ * unless -nocache was given, and from the 16 bit copies of the tables,
+ * reporting the time of each and the signal to noise ratio of the copies.
+ * Nothing is played. */
+
+  size_t i = 0;
+  unsigned int q = 0;
+  double signal = 0.0;
+  double noise = 0.0;
+  double seconds = 0.0;
+  const size_t frames = (size_t)aos->RenderRate * DEFAULT_BENCH_SECONDS;
+  float *full = calloc(frames, sizeof(*full));
+  float *compact = calloc(frames, sizeof(*compact));
+  AudioSettings plain = *aos;
+
+  plain.Cache = false;
+  if (full == NULL || compact == NULL) {
+    errx(ERROR_ALLOC, "Error allocating benchmark buffers");
+  }
+  makeWavetables(aos->Tables);
+  warnx("Rendering %d seconds of %u voices at %u Hz in blocks of %u",
+      DEFAULT_BENCH_SECONDS, aos->Polyphony, aos->RenderRate,
+      aos->BlockFrames);
+  for (; q < QUALITY_NUM ; q++) {
+    seconds = renderBench(&plain, q == QUALITY_LINEAR ? full : compact,
+        frames, (Quality)q);
+    warnx("%s: %.3f seconds, %.1fx realtime, %.1f ns per voice sample, "
+        "%.1f dB distortion", QUALITIES[q], seconds,
+        DEFAULT_BENCH_SECONDS / seconds,
+        seconds * 1e9 / ((double)frames * aos->Polyphony),
+        measureQuality(&plain, (Quality)q));
+  }
+  if (aos->Cache) {
+    seconds = renderBench(aos, compact, frames, QUALITY_LINEAR);
+    warnx("cycle cache: %.3f seconds, %.1fx realtime", seconds,
+        DEFAULT_BENCH_SECONDS / seconds);
+  }
+  useCompactTables();
+  seconds = renderBench(&plain, compact, frames, QUALITY_LINEAR);
+  warnx("16 bit tables: %.3f seconds, %.1fx realtime", seconds,
+      DEFAULT_BENCH_SECONDS / seconds);
+  for (; i < frames ; i++) {
+    signal += (double)full[i] * full[i];
+    noise += ((double)compact[i] - full[i]) * ((double)compact[i] - full[i]);
+  }
+  if (noise > 0.0) {
+    warnx("16 bit tables: %.1f dB signal to noise ratio",
+        10.0 * log10(signal / noise));
+  } else {
+    warnx("16 bit tables: no difference from float tables");
+  }
+  killWavetables();
+  free(full);
+  free(compact);
+}
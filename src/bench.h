@@ -0,0 +1,5 @@
+#pragma once
+
+#include "audio-settings.h"
+
+void runBench(const AudioSettings *);
@@ -3,21 +3,41 @@
 
 #include <err.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "buffers.h"
 
 #include "constants/defaults.h"
 #include "constants/errors.h"
 
+float *
+makeSamples(const size_t frames) {
+
+/* Allocates a zeroed array of float samples aligned to DEFAULT_ALIGNMENT
+ * bytes. All internal synthesis buffers are made this way, so that their
+ * sizes can follow the render block chosen at startup. */
+
+  void *p = NULL;
+
+  if (posix_memalign(&p, DEFAULT_ALIGNMENT, sizeof(float) * frames) != 0) {
+    errx(ERROR_ALLOC, "Error allocating sample buffer");
+  }
+  memset(p, 0, sizeof(float) * frames);
+  return p;
+}
+
 Buffer
-makeBuffer(const size_t size) {
+makeBuffer(const size_t size, const size_t mixFrames, const size_t chans) {
 
-/* Sets Buffer size constants, and allocates Output array. */
+/* Sets Buffer size constants, and allocates Mix and Output arrays. */
 
   Buffer b = {0};
+  b.Channels = chans;
   b.SizeFrames = size;
-  b.SizeBytes = size * DEFAULT_CHAN * DEFAULT_BYTES;
-  b.Output = malloc(sizeof(*b.Output) * b.SizeBytes);
+  b.SizeBytes = size * chans * DEFAULT_BYTES;
+  b.MixFrames = mixFrames;
+  b.Mix = makeSamples(mixFrames * (chans + 1));
+  b.Output = malloc(b.SizeBytes);
   if (b.Output == NULL) {
     errx(ERROR_ALLOC, "Error initializing audio buffer");
   }
@@ -27,7 +47,8 @@ makeBuffer(const size_t size) {
 void
 killBuffer(Buffer *b) {
 
-/* Free the Buffer's Output array allocation. */
+/* Free the Buffer's Mix and Output array allocations. */
 
+  free(b->Mix);
   free(b->Output);
 }
@@ -8,26 +8,32 @@
 
 typedef struct Buffer {
 
-/* Two buffers: Mix is always DEFAULT_BUFSIZE frames long, and holds floating 
- * point sample data. This is for mixing synthesis data generated by each of the 
- * voices. It is kept short to respond effectively to user input. Output is
- * also ideally DEFAULT_BUFSIZE frames in length, but may not be due to hardware
- * limitations. Output holds raw bytes to write to sndio. If Output is longer
- * than Mix, then Mix will be filled multiple times before Output writes its
- * data. The lengths of these buffers do not have to be perfect multiples of one
- * another. The internal synthesis data is fundamentally monophonic, but if 
- * multichannel output is specified, then one sample of Mix will be written
- * multiple times to Output, potentially at different final amplitudes. With
- * this in mind, the Output buffer needs to track various sizing variables, 
- * while Mix is only manipulated in terms of frames. */
+/* Two buffers: Mix is always AudioSettings.BlockFrames long, and holds
+ * floating point sample data. This is for mixing synthesis data generated by
+ * each of the voices. It is kept short to respond effectively to user input.
+ * Output is also ideally BlockFrames in length, but may not be due to hardware
+ * limitations. Output holds interleaved native-endian samples, and is the very
+ * buffer handed to sio_write(). If Output is longer than Mix, then Mix will be
+ * converted into successive regions of Output before it is written. The
+ * lengths of these buffers do not have to be perfect multiples of one another.
+ * Mix is planar: it holds Channels + 1 buses of MixFrames samples each, laid
+ * out one after another. The first bus is heard on every channel, and each
+ * of the rest on one channel only (see "route.h"). Channels are only
+ * interleaved when Mix is converted into Output. With this in mind, the
+ * Output buffer needs to track various sizing variables, while Mix is only
+ * manipulated in terms of frames. Mix is aligned to DEFAULT_ALIGNMENT bytes,
+ * and is zeroed as it is converted, so it is always ready to be summed into
+ * at the start of a block. */
 
-  size_t          BytesWritten;
+  size_t          Channels;
   size_t          FramesWritten;
+  size_t          MixFrames;
   size_t          SizeFrames;
   size_t          SizeBytes;
-  float           Mix[DEFAULT_BUFSIZE];
-  uint8_t       * Output;
+  float         * Mix;
+  int16_t       * Output;
 } Buffer;
 
-Buffer makeBuffer(const size_t);
+float * makeSamples(const size_t);
+Buffer makeBuffer(const size_t, const size_t, const size_t);
 void killBuffer(Buffer *);
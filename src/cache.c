@@ -0,0 +1,306 @@
+/* Plays settled Voices back from a recording of their period. Consult
+ * "cache.h" for more info. */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cache.h"
+
+#include "buffers.h"
+#include "constants/defaults.h"
+#include "constants/maximums.h"
+#include "envelope.h"
+#include "numerical.h"
+#include "synthesis.h"
+#include "wave.h"
+#include "wavetable.h"
+
+static bool isSettled(const Operator *);
+static void takeKey(CacheKey *, const Operator *);
+static bool keysChanged(const Cache *, const Operator *, const Operator *);
+static size_t findLoop(const float, const float);
+static float wrapCycle(const double);
+static void stopCache(Cache *, Operator *, Operator *);
+static void startCache(Cache *, const Operator *, const Operator *);
+static void checkCache(Cache *);
+static void captureCache(Cache *, Operator *, Operator *, const size_t,
+    const size_t);
+static void playCache(Cache *, const Operator *, const size_t);
+
+static bool
+isSettled(const Operator *o) {
+
+/* Returns whether an Operator sounds the same from one block to the next:
+ * its envelope holds its sustain, its pitch and amplitude have reached their
+ * targets, and it reads tables rather than noise. */
+
+  const Osc *s = &o->Osc;
+
+  return o->Env.Stage == ENV_SUSTAIN && s->Pitch == s->Target &&
+    s->Amplitude == *o->Level &&
+    (s->Wave->Type != WAVE_TYPE_NOISE || s->Morph->Frames >= 2);
+}
+
+static void
+takeKey(CacheKey *k, const Operator *o) {
+
+/* Fills a CacheKey from a settled Operator. The whole struct is zeroed first,
+ * so that two Keys can be compared byte for byte. */
+
+  const Osc *s = &o->Osc;
+
+  memset(k, 0, sizeof(*k));
+  if (s->Morph->Frames < 2) {
+    k->Table = s->Wave->Table[s->Level];
+    k->Compact = s->Wave->Compact == NULL ? NULL : s->Wave->Compact[s->Level];
+  }
+  k->Target = s->Target;
+  k->Level = *o->Level;
+  k->KeyMod = s->KeyMod;
+  k->Sustain = levelEnv(&o->Env);
+  k->Polarity = s->Wave->Polarity;
+  k->Band = s->Level;
+  k->Morph = *s->Morph;
+  k->Quality = *s->Quality;
+}
+
+static bool
+keysChanged(const Cache *c, const Operator *car, const Operator *mod) {
+
+/* Returns whether anything that the recording in a Cache depends on has
+ * changed since it was made, including the tables of any import slot. */
+
+  CacheKey keys[2] = {0};
+
+  takeKey(&keys[0], car);
+  takeKey(&keys[1], mod);
+  return c->Installs != countInstalls() ||
+    memcmp(keys, c->Keys, sizeof(keys)) != 0;
+}
+
+static size_t
+findLoop(const float carrier, const float modulator) {
+
+/* Returns the fewest samples after which oscillators stepping by the pitches
+ * "carrier" and "modulator" have both run within DEFAULT_CACHE_DRIFT samples
+ * of a whole number of cycles, or 0 if none up to MAX_CACHE_FRAMES do. The
+ * carrier is stepped without its modulation, which checkCache() accounts
+ * for. */
+
+  const double c = fabs((double)carrier);
+  const double m = fabs((double)modulator);
+  const double limitC = c * DEFAULT_CACHE_DRIFT;
+  const double limitM = m * DEFAULT_CACHE_DRIFT;
+  double phaseC = 0.0;
+  double phaseM = 0.0;
+  size_t n = 1;
+
+  for (; n + DEFAULT_CACHE_CHECK <= MAX_CACHE_FRAMES ; n++) {
+    phaseC += c;
+    phaseM += m;
+    if (phaseC >= DEFAULT_WAVELEN) {
+      phaseC -= DEFAULT_WAVELEN;
+    }
+    if (phaseM >= DEFAULT_WAVELEN) {
+      phaseM -= DEFAULT_WAVELEN;
+    }
+    if ((phaseC <= limitC || DEFAULT_WAVELEN - phaseC <= limitC) &&
+        (phaseM <= limitM || DEFAULT_WAVELEN - phaseM <= limitM)) {
+      return n;
+    }
+  }
+  return 0;
+}
+
+static float
+wrapCycle(const double phase) {
+
+/* Brings a phase back to between 0.0 and DEFAULT_WAVELEN. */
+
+  const double p = fmod(phase, DEFAULT_WAVELEN);
+
+  return (float)(p < 0.0 ? p + DEFAULT_WAVELEN : p);
+}
+
+static void
+stopCache(Cache *c, Operator *car, Operator *mod) {
+
+/* Returns a Voice to full synthesis when its envelopes, pitches or Keys move
+ * on from the recording. If it was playing back the loop, its oscillators are
+ * moved to the phases they had when the sample about to be played was
+ * recorded, so that synthesis carries on from the same point in the waveform.
+ * A newly struck note is handled by dropCache() instead. */
+
+  const double step = (double)c->Keys[0].Target * c->Keys[0].Polarity;
+  double phase = c->CarrierPhase;
+  size_t i = 0;
+
+  if (c->State == CACHE_PLAY) {
+    for (; i < c->Read ; i++) {
+      phase += step + c->Modulation[i];
+    }
+    car->Osc.Phase = wrapCycle(phase);
+    mod->Osc.Phase = wrapCycle(c->ModulatorPhase +
+        ((double)c->Keys[1].Target * (double)c->Read));
+  }
+  c->State = CACHE_IDLE;
+}
+
+static void
+startCache(Cache *c, const Operator *car, const Operator *mod) {
+
+/* Begins recording a Voice that has settled over the block just rendered,
+ * unless no loop of its pitches is short enough to record. */
+
+  takeKey(&c->Keys[0], car);
+  takeKey(&c->Keys[1], mod);
+  c->Installs = countInstalls();
+  c->Length = findLoop(car->Osc.Pitch, mod->Osc.Pitch);
+  c->Filled = 0;
+  c->Read = 0;
+  c->CarrierPhase = car->Osc.Phase;
+  c->ModulatorPhase = mod->Osc.Phase;
+  c->State = c->Length == 0 ? CACHE_FAILED : CACHE_CAPTURE;
+}
+
+static void
+checkCache(Cache *c) {
+
+/* Compares the samples recorded after the loop with the start of the loop
+ * that they should repeat. The loop is played back if the difference between
+ * them is no louder than DEFAULT_CACHE_ERROR of the samples themselves. A
+ * little drift leaves a difference far below that, while a carrier that the
+ * modulation pulls further out of phase on every loop leaves one as loud as
+ * the Voice. */
+
+  size_t i = c->Length;
+  double power = 0.0;
+  double error = 0.0;
+  double d = 0.0;
+
+  for (; i < c->Filled ; i++) {
+    d = (double)c->Loop[i] - c->Loop[i - c->Length];
+    error += d * d;
+    power += (double)c->Loop[i - c->Length] * c->Loop[i - c->Length];
+  }
+  if (error <= power * DEFAULT_CACHE_ERROR * DEFAULT_CACHE_ERROR) {
+    c->State = CACHE_PLAY;
+    c->Read = c->Filled % c->Length;
+  } else {
+    c->State = CACHE_FAILED;
+  }
+}
+
+static void
+captureCache(Cache *c, Operator *car, Operator *mod, const size_t frames,
+    const size_t left) {
+
+/* Renders a block of a Voice into the loop, along with the modulator samples
+ * that shaped it, and sums it into the Voice's bus as usual. "left" is passed
+ * on to fillCarrierBuffer(). */
+
+  size_t i = 0;
+  float *out = car->Osc.Buffer;
+  float *loop = c->Loop + c->Filled;
+
+  memset(loop, 0, frames * sizeof(*loop));
+  car->Osc.Buffer = loop;
+  fillCarrierBuffer(car, mod, frames, left);
+  car->Osc.Buffer = out;
+  memcpy(c->Modulation + c->Filled, mod->Osc.Buffer, frames * sizeof(*loop));
+  for (; i < frames ; i++) {
+    out[i] += loop[i];
+  }
+  c->Filled += frames;
+  if (c->Filled >= c->Length + DEFAULT_CACHE_CHECK) {
+    checkCache(c);
+  }
+}
+
+static void
+playCache(Cache *c, const Operator *car, const size_t frames) {
+
+/* Sums "frames" samples of the loop into the Voice's bus, wrapping around
+ * its end as often as needed. */
+
+  size_t i = 0;
+  size_t j = 0;
+  size_t n = 0;
+  float *out = car->Osc.Buffer;
+  const float *loop = NULL;
+
+  while (i < frames) {
+    n = LESSER(frames - i, c->Length - c->Read);
+    loop = c->Loop + c->Read;
+    for (j = 0 ; j < n ; j++) {
+      out[i + j] += loop[j];
+    }
+    i += n;
+    c->Read += n;
+    if (c->Read == c->Length) {
+      c->Read = 0;
+    }
+  }
+}
+
+void
+fillCachedBuffer(Cache *c, Operator *car, Operator *mod, const size_t frames,
+    const size_t left) {
+
+/* Sums "frames" samples of a Voice into its carrier's buffer like
+ * fillCarrierBuffer(), from the loop in its Cache where it can. The block
+ * has "left" frames to go from the first of them. */
+
+  const bool settled = c->Loop != NULL && isSettled(car) && isSettled(mod);
+
+  if (c->State != CACHE_IDLE && (!settled || keysChanged(c, car, mod))) {
+    stopCache(c, car, mod);
+  }
+  switch ((unsigned int)c->State) {
+    case CACHE_CAPTURE:
+      captureCache(c, car, mod, frames, left);
+      break;
+    case CACHE_PLAY:
+      playCache(c, car, frames);
+      break;
+    default:
+      fillCarrierBuffer(car, mod, frames, left);
+      if (settled && c->State == CACHE_IDLE) {
+        startCache(c, car, mod);
+      }
+  }
+}
+
+void
+dropCache(Cache *c) {
+
+/* Returns a Voice to full synthesis without touching its oscillators. A note
+ * struck on the Voice has just set their phases from the render clock, which
+ * the recording of the old note must not overwrite. */
+
+  c->State = CACHE_IDLE;
+}
+
+void
+makeCache(Cache *c, const size_t frames) {
+
+/* Allocates a Cache for renders of up to "frames" samples. The loop can be
+ * overrun by the last block of a recording. */
+
+  memset(c, 0, sizeof(*c));
+  c->Loop = makeSamples(MAX_CACHE_FRAMES + frames);
+  c->Modulation = makeSamples(MAX_CACHE_FRAMES + frames);
+}
+
+void
+killCache(Cache *c) {
+
+/* Frees memory allocated by makeCache(). */
+
+  free(c->Loop);
+  free(c->Modulation);
+  c->Loop = NULL;
+  c->Modulation = NULL;
+}
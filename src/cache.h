@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "synthesis.h"
+
+typedef enum CacheState {
+
+/* Where a Cache is in its cycle. CACHE_IDLE waits for its Voice to settle,
+ * CACHE_CAPTURE records the Voice as it plays, CACHE_PLAY plays the recorded
+ * loop back in its place, and CACHE_FAILED plays the Voice as usual because
+ * its output does not repeat closely enough to loop. */
+
+  CACHE_IDLE = 0,
+  CACHE_CAPTURE,
+  CACHE_PLAY,
+  CACHE_FAILED
+} CacheState;
+
+typedef struct CacheKey {
+
+/* Everything that decides what one Operator of a settled Voice sounds like.
+ * A Cache is only valid for as long as its Keys stay the same. */
+
+  const float   * Table;
+  const int16_t * Compact;
+  float           Target;
+  float           Level;
+  float           KeyMod;
+  float           Sustain;
+  float           Polarity;
+  int             Band;
+  Morph           Morph;
+  Quality         Quality;
+} CacheKey;
+
+typedef struct Cache {
+
+/* Once both envelopes of a Voice hold their sustain, its pitches and
+ * amplitudes have finished ramping, and neither operator plays noise, its
+ * output repeats every cycle of its carrier, or over the common period of its
+ * carrier and modulator when one pitch is a whole multiple of the other. The
+ * Cache finds the shortest number of samples, up to MAX_CACHE_FRAMES, after
+ * which both phases return to within DEFAULT_CACHE_DRIFT samples of where
+ * they started, records that many samples into Cache.Loop as the Voice plays
+ * them, and checks that the next DEFAULT_CACHE_CHECK samples repeat them.
+ * From then on the Voice is played by adding Cache.Loop into its bus, until a
+ * change to any of its Keys, its envelopes or its pitches sends it back to
+ * full synthesis. Cache.Length is the length of the loop, Cache.Filled the
+ * samples recorded so far, and Cache.Read the next sample to play back.
+ * Cache.Modulation keeps the modulator samples of the recording, and
+ * Cache.CarrierPhase and Cache.ModulatorPhase the phases it began at, so that
+ * the oscillators can be put back where they would have been when playback
+ * stops. Cache.Installs is countInstalls() when the Keys were taken. A Cache
+ * with a NULL Cache.Loop is disabled. */
+
+  CacheState      State;
+  size_t          Length;
+  size_t          Filled;
+  size_t          Read;
+  unsigned int    Installs;
+  float           CarrierPhase;
+  float           ModulatorPhase;
+  float         * Loop;
+  float         * Modulation;
+  CacheKey        Keys[2];
+} Cache;
+
+void fillCachedBuffer(Cache *, Operator *, Operator *, const size_t,
+    const size_t);
+void dropCache(Cache *);
+void makeCache(Cache *, const size_t);
+void killCache(Cache *);
@@ -0,0 +1,81 @@
+/* Functions for the Clock type, which counts written and played frames to
+ * measure output latency and detect missed deadlines. Consult "clock.h" for
+ * more info. */
+
+#include <err.h>
+#include <stdint.h>
+
+#include "clock.h"
+
+void
+makeClock(Clock *c) {
+
+/* Initializes a Clock with no frames written or played. */
+
+  c->Written = 0;
+  c->Played = 0;
+  c->Xruns = 0;
+  c->Latency = 0;
+  c->MinLatency = INT64_MAX;
+  c->MaxLatency = 0;
+}
+
+void
+onMove(void *arg, int delta) {
+
+/* Registered with sio_onmove(). sndio invokes this from within sio_revents()
+ * and sio_write() whenever the hardware position advances by "delta"
+ * frames. */
+
+  Clock *c = arg;
+
+  c->Played += (uint64_t)delta;
+}
+
+void
+tickClock(Clock *c) {
+
+/* Samples the latency just before a buffer is written. Once playback has
+ * started, an empty device buffer at this point means that the device ran out
+ * of frames before boar could supply more, which is counted as an xrun. */
+
+  c->Latency = (int64_t)(c->Written - c->Played);
+  if (c->Played == 0) {
+    return;
+  }
+  if (c->Latency <= 0) {
+    c->Xruns++;
+  }
+  if (c->Latency < c->MinLatency) {
+    c->MinLatency = c->Latency;
+  }
+  if (c->Latency > c->MaxLatency) {
+    c->MaxLatency = c->Latency;
+  }
+}
+
+void
+advanceClock(Clock *c, const uint64_t frames) {
+
+/* Records that "frames" frames were handed to sndio. */
+
+  c->Written += frames;
+}
+
+void
+printClock(const Clock *c, const unsigned int rate) {
+
+/* Prints playback counters to stderr. Latencies are given in frames and
+ * milliseconds at the playback rate. */
+
+  const int64_t min = c->MinLatency == INT64_MAX ? 0 : c->MinLatency;
+
+  warnx("%llu frames written, %llu played, %llu xruns",
+      (unsigned long long)c->Written, (unsigned long long)c->Played,
+      (unsigned long long)c->Xruns);
+  warnx("latency %lld frames (%.2f ms), min %lld (%.2f ms), "
+      "max %lld (%.2f ms)",
+      (long long)c->Latency, (double)c->Latency * 1000.0 / rate,
+      (long long)min, (double)min * 1000.0 / rate,
+      (long long)c->MaxLatency, (double)c->MaxLatency * 1000.0 / rate);
+}
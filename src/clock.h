@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef struct Clock {
+
+/* Tracks the hardware position of the sndio stream. Clock.Written counts the
+ * frames handed to sio_write(), while Clock.Played counts the frames sndio
+ * reports as played through its sio_onmove() callback. Their difference is
+ * the true output latency at any moment. If the device has played everything
+ * written by the time a new buffer is ready, the deadline was missed and
+ * Clock.Xruns is incremented. Latency extremes are kept so that the -blocks
+ * flag can be tuned from real measurements. */
+
+  uint64_t      Written;
+  uint64_t      Played;
+  uint64_t      Xruns;
+  int64_t       Latency;
+  int64_t       MinLatency;
+  int64_t       MaxLatency;
+} Clock;
+
+void makeClock(Clock *);
+void onMove(void *, int);
+void tickClock(Clock *);
+void advanceClock(Clock *, const uint64_t);
+void printClock(const Clock *, const unsigned int);
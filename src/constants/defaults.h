@@ -16,20 +16,31 @@
 /* Sample rate */
 #define DEFAULT_RATE 48000
 
-/* Number of times to poll for user input per second */
+/* Number of times to poll for user input per second. Unless a block size is
+ * given explicitly with the -block flag, the internal render block is the
+ * sample rate divided by this value, so that it follows the -rate flag. */
 #define DEFAULT_RESOLUTION 375
 
-/* Ideal audio output buffer size (in frames, not bytes). Even if audio output
- * does not respect this size, it will be used for the timing of user input,
- * ensuring a resolution of DEFAULT_RESOLUTION  */
-#define DEFAULT_BUFSIZE (DEFAULT_RATE / DEFAULT_RESOLUTION)
+/* Render blocks are rounded up to a multiple of this many frames, so that the
+ * inner synthesis loops always run over whole vectors. */
+#define DEFAULT_VECTOR_FRAMES 8
+
+/* Byte alignment of all float sample buffers. One cache line, which also
+ * satisfies every vector instruction set boar is likely to be built for. */
+#define DEFAULT_ALIGNMENT 64
 
 /* An ideally-sized audio buffer would be responsive but performance intensive.
  * The sndio `appbufsz` parameter will be the minimal audio buffer size
  * multiplied by this constant (or overridden by command line flag). */
 #define DEFAULT_BUF_BLOCKS 1
 
-/* Number of channels. Hardcoded to stereo for now. */
+/* Number of coefficients in each resampling kernel. Must be even. */
+#define DEFAULT_RESAMPLE_TAPS 16
+
+/* Number of fractional positions the resampling kernels are tabulated for */
+#define DEFAULT_RESAMPLE_PHASES 256
+
+/* Number of output channels, unless specified with the -channels flag */
 #define DEFAULT_CHAN 2
 
 /* Number of simultaneous voices */
@@ -44,6 +55,14 @@
 /* Number of octaves, used to segregate band-limited wavetables */
 #define DEFAULT_OCTAVES 12
 
+/* Number of band-limited levels per octave of each wave. 2 cuts harmonics
+ * every half octave, and 12 would cut them every semitone, at the cost of as
+ * many times the table memory */
+#define DEFAULT_LEVELS_PER_OCTAVE 2
+
+/* Number of band-limited levels of each wave */
+#define DEFAULT_LEVELS (DEFAULT_OCTAVES * DEFAULT_LEVELS_PER_OCTAVE)
+
 /* Scaling factor to create a unique mapping of octave pitch to wavetable
  * index */
 #define DEFAULT_OCTAVE_SCALING 4.5f
@@ -75,3 +94,74 @@
 
 /* Maximum user line input */
 #define DEFAULT_LINESIZE 4096
+
+/* Sequencer tempo in beats per minute, until set with the g command */
+#define DEFAULT_TEMPO 120.0f
+
+/* Sequencer steps in a beat, until set with the G command */
+#define DEFAULT_STEPS_PER_BEAT 4
+
+/* Version of the -bank file format. Bump when the Patch type changes */
+#define DEFAULT_BANK_VERSION 4
+
+/* Version of the -tables file format. Bump when the generated tables
+ * change */
+#define DEFAULT_TABLES_VERSION 6
+
+/* The number of samples copied from the other end of the cycle onto each
+ * side of a wavetable, so that interpolation never has to wrap around. Cubic
+ * interpolation reads two samples ahead of a phase that may have rounded up
+ * to DEFAULT_WAVELEN */
+#define DEFAULT_GUARD 3
+
+/* The distance between the starts of two levels of a wave, in samples */
+#define DEFAULT_LEVEL_STRIDE (DEFAULT_WAVELEN + (2 * DEFAULT_GUARD))
+
+/* The number of fractional positions between two wavetable samples that the
+ * polyphase interpolation kernel is tabulated at */
+#define DEFAULT_POLYPHASE_PHASES 1024
+
+/* How far, in samples, the phases of a Voice may be from where they started
+ * at the end of a loop that its Cache records */
+#define DEFAULT_CACHE_DRIFT 0.01
+
+/* The number of samples recorded past the end of a loop, to check that they
+ * repeat its start */
+#define DEFAULT_CACHE_CHECK 64
+
+/* How loud the difference between a recorded loop and its repeat may be, as
+ * a fraction of the loop's own level, for it to be played back */
+#define DEFAULT_CACHE_ERROR 0.05
+
+/* How far apart, in wavetable samples, the phases of two otherwise identical
+ * modulators may be for one to share the table reads of the other. Notes
+ * take their phase from the render clock, so identical modulators differ
+ * only by the rounding that builds up as they play, and a shift this small
+ * is inaudible */
+#define DEFAULT_SHARE_PHASE 4.0f
+
+/* The number of seconds of audio that -bench renders in each mode */
+#define DEFAULT_BENCH_SECONDS 10
+
+/* The alignment of each wave in a -tables file, in bytes. A page, so that
+ * every wave is mapped on pages of its own */
+#define DEFAULT_TABLES_ALIGN 4096
+
+/* Steepness of the exponential wave, and of the curve that expCurve() puts
+ * volumes and envelope times on */
+#define DEFAULT_EXP_CURVE 6.2831853
+
+/* Steepness of the logarithmic wave */
+#define DEFAULT_LOG_CURVE 10000.0
+
+/* Size of the ring buffer input is read into. Must hold at least one line */
+#define DEFAULT_RING_SIZE 16384
+
+/* Number of commands run between blocks, unless specified with -commands */
+#define DEFAULT_COMMANDS 256
+
+/* The number of MIDI bytes read at a time */
+#define DEFAULT_MIDI_READ 256
+
+/* The modulation level reached when the MIDI mod wheel (CC1) is at its top */
+#define DEFAULT_MIDI_MODULATION 8.0f
@@ -47,6 +47,36 @@
 /* (D:) sets modulator envelope loop */
 #define FUNC_MOD_ENV_LOOP FUNC_DEF('D', TYPE_COLON)
 
+/* (g) sets the sequencer tempo */
+#define FUNC_TEMPO FUNC_DEF('g', TYPE_NORMAL)
+
+/* (G) sets the number of sequencer steps in a beat */
+#define FUNC_STEPS_PER_BEAT FUNC_DEF('G', TYPE_NORMAL)
+
+/* (i) prints playback statistics */
+#define FUNC_INFO FUNC_DEF('i', TYPE_NORMAL)
+
+/* (I) imports waves from a WAV file */
+#define FUNC_IMPORT FUNC_DEF('I', TYPE_NORMAL)
+
+/* (e) selects note to route */
+#define FUNC_ROUTE_NOTE FUNC_DEF('e', TYPE_NORMAL)
+
+/* (e.) routes selected note to a channel */
+#define FUNC_ROUTE_CHANNEL FUNC_DEF('e', TYPE_PERIOD)
+
+/* (E) sets selected note's gain on the selected channel */
+#define FUNC_ROUTE_GAIN FUNC_DEF('E', TYPE_NORMAL)
+
+/* (E.) selects channel for gain changes */
+#define FUNC_ROUTE_GAIN_CHANNEL FUNC_DEF('E', TYPE_PERIOD)
+
+/* (f) stores the current patch in a bank slot */
+#define FUNC_STORE_PATCH FUNC_DEF('f', TYPE_NORMAL)
+
+/* (F) recalls a patch from a bank slot */
+#define FUNC_RECALL_PATCH FUNC_DEF('F', TYPE_NORMAL)
+
 /* (k) sets key follow */
 #define FUNC_KEY_FOLLOW FUNC_DEF('k', TYPE_NORMAL)
 
@@ -124,3 +154,12 @@
 
 /* (X) sets modulator to a fixed frequency */
 #define FUNC_MOD_FIXED FUNC_DEF('X', TYPE_NORMAL)
+
+/* (y) starts recording a sequencer pattern */
+#define FUNC_RECORD_PATTERN FUNC_DEF('y', TYPE_NORMAL)
+
+/* (Y) finishes recording a pattern with its length in steps */
+#define FUNC_FINISH_PATTERN FUNC_DEF('Y', TYPE_NORMAL)
+
+/* (y.) plays a pattern, or stops playback if negative */
+#define FUNC_PLAY_PATTERN FUNC_DEF('y', TYPE_PERIOD)
@@ -10,11 +10,70 @@
 /* The maximum polyphony allowed */
 #define MAX_POLYPHONY 128
 
+/* The maximum number of output channels */
+#define MAX_CHANNELS 32
+
 /* The maximum number of buffer blocks allowed */
 #define MAX_BUF_BLOCKS 128
 
-/* The maximum command line flag length (currently "polyphony") */
-#define MAX_FLAG_LEN 10
+/* The maximum internal render block size, in frames */
+#define MAX_BLOCK_FRAMES 8192
+
+/* The longest loop that a Voice can be played back from, in samples */
+#define MAX_CACHE_FRAMES 16384
+
+/* The most distinct modulators whose table reads are kept for other Voices
+ * to share during a piece of a block */
+#define MAX_SHARES 16
+
+/* The maximum number of user input polls per second */
+#define MAX_RESOLUTION 48000
+
+/* The maximum number of clients connected to the -socket at once */
+#define MAX_CLIENTS 8
+
+/* The maximum number of commands run between blocks */
+#define MAX_COMMANDS 65536
+
+/* The maximum number of scheduled commands waiting to run */
+#define MAX_EVENTS 1024
+
+/* The number of parameters whose commands are coalesced between blocks */
+#define MAX_LATEST 7
+
+/* The maximum number of arguments to a named command */
+#define MAX_ARGS 4
+
+/* The number of sequencer patterns */
+#define MAX_PATTERNS 16
+
+/* The fastest sequencer tempo, in beats per minute */
+#define MAX_TEMPO 1000.0f
+
+/* The most sequencer steps in a beat */
+#define MAX_STEPS_PER_BEAT 64
+
+/* The maximum number of commands in a sequencer pattern */
+#define MAX_PATTERN_STEPS 256
+
+/* The number of slots in the patch bank */
+#define MAX_PATCHES 128
+
+/* The most wave numbers a -tables file may index */
+#define MAX_WAVES 1024
+
+/* The number of wave numbers after the last wave of the tables that WAV files
+ * can be imported into */
+#define MAX_IMPORTS 64
+
+/* The longest WAV file that can be imported, in bytes */
+#define MAX_IMPORT_SIZE (64 * 1024 * 1024)
+
+/* The maximum number of descriptors a MIDI input may need to poll */
+#define MAX_MIDI_FDS 4
+
+/* The maximum command line flag length (currently "resolution") */
+#define MAX_FLAG_LEN 11
 
 /* The maximum amount of time, in seconds, an envelope stage runs for */
 #define MAX_ENV_TIME 10.0f
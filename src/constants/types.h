@@ -60,6 +60,10 @@
 /* A command with a ":" adornment */
 #define TYPE_COLON (unsigned int)(1 << 8)
 
+/* A command named by a whole word, such as (note). The lower bits hold its
+ * place in the table of named commands. */
+#define TYPE_VERB (unsigned int)(1 << 9)
+
 /* An array of expected argument types for commands with an unadorned
  * character such as (a), (d), etc */
 static const unsigned int TYPE_SIGNATURES_PURE[58] = {
@@ -67,11 +71,11 @@ static const unsigned int TYPE_SIGNATURES_PURE[58] = {
   TYPE_UNDEFINED, /* B */
   TYPE_UINT,      /* C */
   TYPE_UFLOAT,    /* D */
-  TYPE_UNDEFINED, /* E */
-  TYPE_UNDEFINED, /* F */
-  TYPE_UNDEFINED, /* G */
+  TYPE_UFLOAT,    /* E */
+  TYPE_UINT,      /* F */
+  TYPE_UINT,      /* G */
   TYPE_UNDEFINED, /* H */
-  TYPE_UNDEFINED, /* I */
+  TYPE_ANY,       /* I */
   TYPE_UNDEFINED, /* J */
   TYPE_INT,       /* K */
   TYPE_UFLOAT,    /* L */
@@ -87,7 +91,7 @@ static const unsigned int TYPE_SIGNATURES_PURE[58] = {
   TYPE_UNDEFINED, /* V */
   TYPE_INT,       /* W */
   TYPE_UFLOAT,    /* X */
-  TYPE_UNDEFINED, /* Y */
+  TYPE_UINT,      /* Y */
   TYPE_UNDEFINED, /* Z */
   TYPE_UNDEFINED, /* ignored */
   TYPE_UNDEFINED, /* ignored */
@@ -99,11 +103,11 @@ static const unsigned int TYPE_SIGNATURES_PURE[58] = {
   TYPE_UFLOAT,    /* b */
   TYPE_UINT,      /* c */
   TYPE_UFLOAT,    /* d */
-  TYPE_UNDEFINED, /* e */
-  TYPE_UNDEFINED, /* f */
-  TYPE_UNDEFINED, /* g */
+  TYPE_UINT,      /* e */
+  TYPE_UINT,      /* f */
+  TYPE_UFLOAT,    /* g */
   TYPE_UNDEFINED, /* h */
-  TYPE_UNDEFINED, /* i */
+  TYPE_NIL,       /* i */
   TYPE_UNDEFINED, /* j */
   TYPE_INT,       /* k */
   TYPE_UFLOAT,    /* l */
@@ -119,7 +123,7 @@ static const unsigned int TYPE_SIGNATURES_PURE[58] = {
   TYPE_UNDEFINED, /* v */
   TYPE_INT,       /* w */
   TYPE_UFLOAT,    /* x */
-  TYPE_UNDEFINED, /* y */
+  TYPE_UINT,      /* y */
   TYPE_UNDEFINED, /* z */
 };
 
@@ -130,7 +134,7 @@ static const unsigned int TYPE_SIGNATURES_PERIOD[58] = {
   TYPE_UNDEFINED, /* B. */
   TYPE_UNDEFINED, /* C. */
   TYPE_INT,       /* D. */
-  TYPE_UNDEFINED, /* E. */
+  TYPE_UINT,      /* E. */
   TYPE_UNDEFINED, /* F. */
   TYPE_UNDEFINED, /* G. */
   TYPE_UNDEFINED, /* H. */
@@ -162,7 +166,7 @@ static const unsigned int TYPE_SIGNATURES_PERIOD[58] = {
   TYPE_UNDEFINED, /* b. */
   TYPE_UNDEFINED, /* c. */
   TYPE_INT,       /* d. */
-  TYPE_UNDEFINED, /* e. */
+  TYPE_INT,       /* e. */
   TYPE_UNDEFINED, /* f. */
   TYPE_UNDEFINED, /* g. */
   TYPE_UNDEFINED, /* h. */
@@ -182,7 +186,7 @@ static const unsigned int TYPE_SIGNATURES_PERIOD[58] = {
   TYPE_UNDEFINED, /* v. */
   TYPE_UNDEFINED, /* w. */
   TYPE_UNDEFINED, /* x. */
-  TYPE_UNDEFINED, /* y. */
+  TYPE_INT,       /* y. */
   TYPE_UNDEFINED, /* z. */
 };
 
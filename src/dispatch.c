@@ -0,0 +1,267 @@
+/* Runs parsed commands against the Audio struct. Commands arrive here from
+ * the REPL, or from Audio.Events once their scheduled frame comes up. */
+
+#include <err.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dispatch.h"
+
+#include "amplitude.h"
+#include "audio-init.h"
+#include "clock.h"
+#include "constants/errors.h"
+#include "constants/funcs.h"
+#include "constants/types.h"
+#include "envelope.h"
+#include "events.h"
+#include "import.h"
+#include "key.h"
+#include "parse.h"
+#include "patch.h"
+#include "route.h"
+#include "sequencer.h"
+#include "verbs.h"
+#include "voice.h"
+#include "wave.h"
+
+Error
+dispatchCmd(Audio *a, const Cmd *c) {
+
+/* Runs a command against the Audio struct. Returns ERROR_EXIT if the command
+ * asks the program to quit, and ERROR_OK otherwise. A recalled patch that is
+ * still pending is applied first, so that commands following a recall are
+ * not undone by it. Named commands are run from the table in "verbs.c". */
+
+  const Arg *arg = &c->Arg;
+  Operators *carrier = &a->Voices.Carrier;
+  Operators *modulator = &a->Voices.Modulator;
+  Voices *voices = &a->Voices;
+
+  if (c->Func != FUNC_RECALL_PATCH) {
+    applyPending(&a->Bank, voices, &a->Amplitude);
+  }
+  if (c->Func & TYPE_VERB) {
+    runVerb(a, c);
+    return ERROR_OK;
+  }
+  switch(c->Func) {
+    case FUNC_NOTE_ON:
+      voiceOn(voices, (uint16_t)arg->I);
+      break;
+    case FUNC_NOTE_OFF:
+      voiceOff(voices, (uint16_t)arg->I);
+      break;
+    case FUNC_MOD_ATTACK:
+      setAttackLevel(&modulator->Env, arg->F);
+      break;
+    case FUNC_ATTACK:
+      setAttackLevel(&carrier->Env, arg->F);
+      break;
+    case FUNC_MOD_ATTACK_WAVE:
+      setAttackWave(&modulator->Env, arg->I);
+      break;
+    case FUNC_ATTACK_WAVE:
+      setAttackWave(&carrier->Env, arg->I);
+      break;
+    case FUNC_MOD_DECAY:
+      setDecayLevel(&modulator->Env, arg->F);
+      break;
+    case FUNC_DECAY:
+      setDecayLevel(&carrier->Env, arg->F);
+      break;
+    case FUNC_MOD_DECAY_WAVE:
+      setDecayWave(&modulator->Env, arg->I);
+      break;
+    case FUNC_DECAY_WAVE:
+      setDecayWave(&carrier->Env, arg->I);
+      break;
+    case FUNC_MOD_ENV_LOOP:
+      setLoop(&modulator->Env, (bool)arg->I);
+      break;
+    case FUNC_ENV_LOOP:
+      setLoop(&carrier->Env, (bool)arg->I);
+      break;
+    case FUNC_MOD_KEY_FOLLOW:
+      selectWave(&voices->Keyboard.Modulator.KeyFollowCurve, arg->I);
+      break;
+    case FUNC_KEY_FOLLOW:
+      selectWave(&voices->Keyboard.Carrier.KeyFollowCurve, arg->I);
+      break;
+    case FUNC_MOD_AMPLITUDE:
+      setModulation(voices, arg->F);
+      break;
+    case FUNC_AMPLITUDE:
+      setVolume(&a->Amplitude, arg->F);
+      break;
+    case FUNC_MOD_PITCH:
+      setPitchRatio(voices, false, arg->F);
+      break;
+    case FUNC_PITCH:
+      setPitchRatio(voices, true, arg->F);
+      break;
+    case FUNC_CHAN_BALANCE:
+      setBalance(&a->Amplitude, arg->F);
+      break;
+    case FUNC_ROUTE_NOTE:
+      selectRouteNote(voices, arg->I);
+      break;
+    case FUNC_ROUTE_CHANNEL:
+      routeNote(voices, arg->I);
+      break;
+    case FUNC_ROUTE_GAIN:
+      setNoteGain(voices, arg->F);
+      break;
+    case FUNC_ROUTE_GAIN_CHANNEL:
+      selectRouteChannel(&voices->Router, arg->I);
+      break;
+    case FUNC_STORE_PATCH:
+      storePatch(&a->Bank, arg->I, voices, &a->Amplitude);
+      break;
+    case FUNC_RECALL_PATCH:
+      recallPatch(&a->Bank, arg->I);
+      break;
+    case FUNC_RECORD_PATTERN:
+      recordPattern(&a->Sequencer, arg->I);
+      break;
+    case FUNC_FINISH_PATTERN:
+      finishPattern(&a->Sequencer, arg->I);
+      break;
+    case FUNC_PLAY_PATTERN:
+      playPattern(&a->Sequencer, arg->I);
+      break;
+    case FUNC_TEMPO:
+      setTempo(&a->Sequencer, arg->F);
+      break;
+    case FUNC_STEPS_PER_BEAT:
+      setStepsPerBeat(&a->Sequencer, arg->I);
+      break;
+    case FUNC_INFO:
+      printClock(&a->Clock, a->Settings.Rate);
+      warnx("Render clock: frame %llu, %zu events pending",
+          (unsigned long long)voices->Phase, a->Events.N);
+      break;
+    case FUNC_IMPORT:
+      importWaves(arg->S);
+      break;
+    case FUNC_QUIT:
+      return ERROR_EXIT;
+    case FUNC_MOD_RELEASE:
+      setReleaseLevel(&modulator->Env, arg->F);
+      break;
+    case FUNC_RELEASE:
+      setReleaseLevel(&carrier->Env, arg->F);
+      break;
+    case FUNC_MOD_RELEASE_WAVE:
+      setReleaseWave(&modulator->Env, arg->I);
+      break;
+    case FUNC_RELEASE_WAVE:
+      setReleaseWave(&carrier->Env, arg->I);
+      break;
+    case FUNC_MOD_SUSTAIN:
+      setSustainLevel(&modulator->Env, arg->F);
+      break;
+    case FUNC_SUSTAIN:
+      setSustainLevel(&carrier->Env, arg->F);
+      break;
+    case FUNC_MOD_ENV_DEPTH:
+      setDepth(&modulator->Env, arg->F);
+      break;
+    case FUNC_ENV_DEPTH:
+      setDepth(&carrier->Env, arg->F);
+      break;
+    case FUNC_MOD_TOUCH:
+      selectWave(&voices->Keyboard.Modulator.VelocityCurve, arg->I);
+      break;
+    case FUNC_TOUCH:
+      selectWave(&voices->Keyboard.Carrier.VelocityCurve, arg->I);
+      break;
+    case FUNC_TUNE_NOTE:
+      selectTuningKey(&voices->Keyboard, arg->I);
+      break;
+    case FUNC_TUNE:
+      tuneKey(&voices->Keyboard, arg->F);
+      break;
+    case FUNC_TUNE_TARGET:
+      selectTuningLayer(&voices->Keyboard, (TuningLayer)arg->I);
+      break;
+    case FUNC_MOD_WAVE:
+      selectWave(&modulator->Wave, arg->I);
+      break;
+    case FUNC_WAVE:
+      selectWave(&carrier->Wave, arg->I);
+      break;
+    case FUNC_MOD_WAVE_COMPLEXITY:
+      setWaveComplexity(voices, false, arg->I);
+      break;
+    case FUNC_WAVE_COMPLEXITY:
+      setWaveComplexity(voices, true, arg->I);
+      break;
+    case FUNC_MOD_FIXED:
+      setFixedRate(voices, false, arg->F);
+      break;
+    case FUNC_FIXED:
+      setFixedRate(voices, true, arg->F);
+      break;
+  }
+  return ERROR_OK;
+}
+
+void
+scheduleCmd(Audio *a, const Cmd *c) {
+
+/* Queues a command with a scheduling prefix in Audio.Events. Relative times
+ * count from the render clock, which is the start of the next block to be
+ * rendered. While a pattern is being recorded, the command is stored in the
+ * pattern instead. Commands with text arguments can not be scheduled, since
+ * their argument points into the REPL's line buffer. */
+
+  uint64_t frame = c->Frame;
+
+  if (c->Type & (TYPE_FLAG_TEXT | TYPE_ANY)) {
+    warnx("Only commands with numeric arguments can be scheduled");
+    return;
+  }
+  if (a->Sequencer.Recording >= 0) {
+    addStep(&a->Sequencer, c);
+    return;
+  }
+  if (c->Time == CMD_TIME_RELATIVE) {
+    frame += a->Voices.Phase;
+  }
+  if (!pushEvent(&a->Events, frame, c)) {
+    warnx("Event queue is full");
+  }
+}
+
+Error
+submitCmd(Audio *a, const Cmd *c) {
+
+/* Runs a command right away, or queues it if it has a scheduling prefix.
+ * Parameter commands are held in Audio.Latest instead, where a later value
+ * replaces an earlier one, so that only the last of them runs before the next
+ * block. Any other command runs the held ones first to keep their order.
+ * Returns ERROR_EXIT if the command asks the program to quit. */
+
+  if (c->Time != CMD_TIME_NOW) {
+    scheduleCmd(a, c);
+    return ERROR_OK;
+  }
+  if (holdCmd(&a->Latest, c)) {
+    return ERROR_OK;
+  }
+  flushCmds(a);
+  return dispatchCmd(a, c);
+}
+
+void
+flushCmds(Audio *a) {
+
+/* Runs the parameter commands held in Audio.Latest. */
+
+  Cmd c = {0};
+
+  while (takeCmd(&a->Latest, &c)) {
+    dispatchCmd(a, &c);
+  }
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "audio-init.h"
+#include "constants/errors.h"
+#include "parse.h"
+
+Error dispatchCmd(Audio *, const Cmd *);
+void scheduleCmd(Audio *, const Cmd *);
+Error submitCmd(Audio *, const Cmd *);
+void flushCmds(Audio *);
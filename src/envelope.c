@@ -36,11 +36,7 @@ envSpeed(const unsigned int rate, float f) {
 static void
 setEnvLevel(const unsigned int rate, EnvStep *est, const float f) {
 
-/* Sets the speed of a specific envelope stage in terms of argument f. f must
- * be less than 1.0 or else it will reference an out of bounds index of
- * WAVE_EXPONENTIAL in expCurve(). f is capped at 1.0 at the REPL level with
- * truncateFloat(). Make sure that this is the case for all user-facing 
- * procedures that call setEnvParameter(). */
+/* Sets the speed of a specific envelope stage in terms of argument f. */
 
   est->Level = envSpeed(rate, f);
 }
@@ -107,12 +103,21 @@ incrementEnv(Env *e) {
 float
 applyEnv(Env *e) {
 
+/* Advances the envelope by one sample and returns its level. */
+
+  incrementEnv(e);
+  return levelEnv(e);
+}
+
+float
+levelEnv(const Env *e) {
+
 /* Returns a sample from the envelope's stage's wavetable based upon the
- * envelope's phase. Weights it according to Env.Depth. */
+ * envelope's phase, without advancing it. Weights it according to
+ * Env.Depth. */
 
   float level = 0.0f;
 
-  incrementEnv(e);
   switch((unsigned int)e->Stage){
     case ENV_ATTACK:
       level = interpolateCycle(&e->Attack->Wave, e->Phase);
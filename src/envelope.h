@@ -87,6 +87,7 @@ typedef struct Envs {
 } Envs;
 
 float applyEnv(Env *);
+float levelEnv(const Env *);
 void resetEnv(Env *);
 void retriggerEnv(Env *);
 void setLoop(Envs *, const bool);
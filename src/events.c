@@ -0,0 +1,178 @@
+/* Functions for the Events type, a queue of commands waiting for their frame
+ * on the render clock, and the Latest type, which holds parameter commands
+ * until the next block. Consult "events.h" for more info. */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "events.h"
+
+#include "constants/funcs.h"
+#include "constants/maximums.h"
+#include "parse.h"
+
+static bool isEarlier(const Event *, const Event *);
+static void swapEvents(Event *, Event *);
+static int latestSlot(const unsigned int);
+
+static bool
+isEarlier(const Event *e1, const Event *e2) {
+
+/* Returns true if e1 should run before e2. */
+
+  if (e1->Frame != e2->Frame) {
+    return e1->Frame < e2->Frame;
+  }
+  return e1->Order < e2->Order;
+}
+
+static void
+swapEvents(Event *e1, Event *e2) {
+
+/* Swaps the contents of two Events in place. */
+
+  Event e = *e1;
+
+  *e1 = *e2;
+  *e2 = e;
+}
+
+static int
+latestSlot(const unsigned int func) {
+
+/* Returns the slot of Latest.Cmds that holds commands of "func", or -1 if
+ * they must run in order. */
+
+  switch (func) {
+    case FUNC_AMPLITUDE:
+      return 0;
+    case FUNC_MOD_AMPLITUDE:
+      return 1;
+    case FUNC_PITCH:
+      return 2;
+    case FUNC_MOD_PITCH:
+      return 3;
+    case FUNC_FIXED:
+      return 4;
+    case FUNC_MOD_FIXED:
+      return 5;
+    case FUNC_CHAN_BALANCE:
+      return 6;
+    default:
+      return -1;
+  }
+}
+
+bool
+pushEvent(Events *es, const uint64_t frame, const Cmd *c) {
+
+/* Schedules Cmd c to run at "frame". Returns false if the queue is full. */
+
+  size_t i = es->N;
+  size_t parent = 0;
+
+  if (es->N == MAX_EVENTS) {
+    return false;
+  }
+  es->All[i].Frame = frame;
+  es->All[i].Order = es->Order++;
+  es->All[i].Cmd = *c;
+  es->N++;
+  while (i > 0) {
+    parent = (i - 1) / 2;
+    if (!isEarlier(&es->All[i], &es->All[parent])) {
+      break;
+    }
+    swapEvents(&es->All[i], &es->All[parent]);
+    i = parent;
+  }
+  return true;
+}
+
+uint64_t
+nextEvent(const Events *es) {
+
+/* Returns the frame of the earliest pending Event, or UINT64_MAX if there are
+ * none. */
+
+  if (es->N == 0) {
+    return UINT64_MAX;
+  }
+  return es->All[0].Frame;
+}
+
+void
+popEvent(Events *es, Cmd *c) {
+
+/* Removes the earliest Event from the queue and copies its command into c.
+ * The queue must not be empty. */
+
+  size_t i = 0;
+  size_t child = 0;
+
+  *c = es->All[0].Cmd;
+  es->All[0] = es->All[--es->N];
+  while ((child = (2 * i) + 1) < es->N) {
+    if (child + 1 < es->N && isEarlier(&es->All[child + 1], &es->All[child])) {
+      child++;
+    }
+    if (!isEarlier(&es->All[child], &es->All[i])) {
+      break;
+    }
+    swapEvents(&es->All[i], &es->All[child]);
+    i = child;
+  }
+}
+
+void
+makeEvents(Events *es) {
+
+/* Initializes an empty Events queue. */
+
+  es->N = 0;
+  es->Order = 0;
+}
+
+bool
+holdCmd(Latest *l, const Cmd *c) {
+
+/* Keeps Cmd c in place of any earlier command for the same parameter. Returns
+ * false if c is not a parameter command, and has to run right away. */
+
+  const int slot = latestSlot(c->Func);
+
+  if (slot < 0) {
+    return false;
+  }
+  l->Cmds[slot] = *c;
+  l->Held |= 1u << slot;
+  return true;
+}
+
+bool
+takeCmd(Latest *l, Cmd *c) {
+
+/* Moves one held command into c. Returns false once none are left. The
+ * parameters are independent of one another, so the order does not matter. */
+
+  unsigned int slot = 0;
+
+  if (l->Held == 0) {
+    return false;
+  }
+  for (; !(l->Held & (1u << slot)) ; slot++) {
+    ;
+  }
+  *c = l->Cmds[slot];
+  l->Held &= ~(1u << slot);
+  return true;
+}
+
+void
+makeLatest(Latest *l) {
+
+/* Initializes an empty Latest. */
+
+  l->Held = 0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "constants/maximums.h"
+#include "parse.h"
+
+typedef struct Event {
+
+/* A command scheduled to run at a specific frame of the render clock
+ * (Voices.Phase). Event.Order records when the Event was scheduled, so that
+ * Events sharing a frame run in the order they arrived. */
+
+  uint64_t      Frame;
+  uint64_t      Order;
+  Cmd           Cmd;
+} Event;
+
+typedef struct Events {
+
+/* A queue of pending Events, kept as a binary min-heap on Event.Frame so that
+ * the earliest Event is always at Events.All[0]. The audio path asks for the
+ * next due frame once per block, and splits rendering of the block at every
+ * Event that falls inside it. */
+
+  size_t        N;
+  uint64_t      Order;
+  Event         All[MAX_EVENTS];
+} Events;
+
+typedef struct Latest {
+
+/* The last value of each continuous parameter that arrived since the previous
+ * block. A sweep of l, L, p, P, x, X or b commands only needs its final value
+ * applied, since each of them loops over every voice. Latest.Held has a bit
+ * set for each filled slot of Latest.Cmds. */
+
+  unsigned int  Held;
+  Cmd           Cmds[MAX_LATEST];
+} Latest;
+
+bool pushEvent(Events *, const uint64_t, const Cmd *);
+uint64_t nextEvent(const Events *);
+void popEvent(Events *, Cmd *);
+void makeEvents(Events *);
+bool holdCmd(Latest *, const Cmd *);
+bool takeCmd(Latest *, Cmd *);
+void makeLatest(Latest *);
@@ -0,0 +1,305 @@
+/* Imports waves from WAV files on a background thread. Consult "import.h"
+ * for more info. */
+
+#include <ctype.h>
+#include <err.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "import.h"
+
+#include "constants/defaults.h"
+#include "constants/maximums.h"
+#include "numerical.h"
+#include "wavetable.h"
+
+typedef struct Import {
+
+/* A single import, from the command that starts it to its installation.
+ * Import.First is the wave number of the slot its first cycle goes into, and
+ * Import.Frames the number of cycles read, which is 0 if it failed.
+ * Import.Levels and Import.Compact hold the tables of each cycle, as made by
+ * levelCycle() and compactCycle(). Import.Next links the finished Imports
+ * that are waiting to be installed, newest first. */
+
+  char            Path[PATH_MAX];
+  unsigned int    First;
+  unsigned int    Frames;
+  float        ** Levels;
+  int16_t      ** Compact;
+  struct Import * Next;
+} Import;
+
+/* The finished Imports, handed from their threads to the audio thread. */
+static _Atomic(Import *) FINISHED = NULL;
+
+static uint32_t readUint(const unsigned char *, const unsigned int);
+static float readSample(const unsigned char *, const unsigned int,
+    const unsigned int);
+static float * readWav(const char *, size_t *);
+static void * runImport(void *);
+
+static uint32_t
+readUint(const unsigned char *b, const unsigned int bytes) {
+
+/* Reads a little endian unsigned integer of up to 4 bytes regardless of host
+ * byte order. */
+
+  uint32_t n = 0;
+  unsigned int i = 0;
+
+  for (; i < bytes ; i++) {
+    n |= (uint32_t)b[i] << (8 * i);
+  }
+  return n;
+}
+
+static float
+readSample(const unsigned char *b, const unsigned int format,
+    const unsigned int bits) {
+
+/* Converts one sample of a WAV file to a float between -1.0 and 1.0. Format
+ * 1 is integer PCM, where 8 bit samples alone are unsigned, and format 3 is
+ * IEEE 754 floats. */
+
+  const uint32_t n = readUint(b, bits > 32 ? 4 : bits / 8);
+  uint64_t d = 0;
+  float f = 0.0f;
+  double g = 0.0;
+
+  if (format == 3 && bits == 32) {
+    memcpy(&f, &n, sizeof(f));
+    return f;
+  }
+  if (format == 3) {
+    d = (uint64_t)n | ((uint64_t)readUint(b + 4, 4) << 32);
+    memcpy(&g, &d, sizeof(g));
+    return (float)g;
+  }
+  if (bits == 8) {
+    return ((float)n - 128.0f) / 128.0f;
+  }
+  /* Sign extends the sample from the top of a 32 bit integer. */
+  return (float)((double)(int32_t)(n << (32 - bits)) / 2147483648.0);
+}
+
+static float *
+readWav(const char *path, size_t *count) {
+
+/* Reads the first channel of a WAV file into floats, and stores the number of
+ * samples in "count". Chunks other than "fmt " and "data" are skipped.
+ * Returns NULL, with a warning, if the file can not be read or is not a WAV
+ * file that boar understands. */
+
+  FILE *f = fopen(path, "rb");
+  long size = 0;
+  size_t pos = 12;
+  size_t len = 0;
+  size_t i = 0;
+  size_t frameBytes = 0;
+  size_t dataPos = 0;
+  size_t dataLen = 0;
+  unsigned int format = 0;
+  unsigned int channels = 0;
+  unsigned int bits = 0;
+  unsigned char *data = NULL;
+  float *samples = NULL;
+
+  if (f == NULL) {
+    warn("Error opening %s", path);
+    return NULL;
+  }
+  if (fseek(f, 0, SEEK_END) == 0) {
+    size = ftell(f);
+  }
+  if (size <= 12 || size > MAX_IMPORT_SIZE) {
+    warnx("%s is empty or too large to import", path);
+    fclose(f);
+    return NULL;
+  }
+  data = malloc((size_t)size);
+  rewind(f);
+  if (data == NULL || fread(data, 1, (size_t)size, f) != (size_t)size) {
+    warnx("Error reading %s", path);
+    fclose(f);
+    free(data);
+    return NULL;
+  }
+  fclose(f);
+  if (memcmp(data, "RIFF", 4) != 0 || memcmp(data + 8, "WAVE", 4) != 0) {
+    warnx("%s is not a WAV file", path);
+    free(data);
+    return NULL;
+  }
+  for (; pos + 8 <= (size_t)size ; pos += 8 + len + (len & 1)) {
+    len = LESSER(readUint(data + pos + 4, 4), (size_t)size - pos - 8);
+    if (memcmp(data + pos, "fmt ", 4) == 0 && len >= 16) {
+      format = readUint(data + pos + 8, 2);
+      channels = readUint(data + pos + 10, 2);
+      bits = readUint(data + pos + 22, 2);
+      if (format == 0xFFFE && len >= 26) {
+        /* WAVE_FORMAT_EXTENSIBLE keeps the real format in its subformat. */
+        format = readUint(data + pos + 32, 2);
+      }
+    } else if (memcmp(data + pos, "data", 4) == 0) {
+      dataPos = pos + 8;
+      dataLen = len;
+    }
+  }
+  if (channels == 0 || dataPos == 0 ||
+      !((format == 1 && (bits == 8 || bits == 16 || bits == 24 ||
+          bits == 32)) || (format == 3 && (bits == 32 || bits == 64)))) {
+    warnx("%s is not 8, 16, 24 or 32 bit PCM, or float, audio", path);
+    free(data);
+    return NULL;
+  }
+  frameBytes = (size_t)channels * (bits / 8);
+  *count = dataLen / frameBytes;
+  if (*count < 2) {
+    warnx("%s holds too few samples to make a wave", path);
+    free(data);
+    return NULL;
+  }
+  samples = malloc(*count * sizeof(*samples));
+  for (; samples != NULL && i < *count ; i++) {
+    samples[i] = readSample(data + dataPos + (i * frameBytes), format, bits);
+  }
+  if (samples == NULL) {
+    warnx("Error allocating samples of %s", path);
+  }
+  free(data);
+  return samples;
+}
+
+static void *
+runImport(void *arg) {
+
+/* The body of an import thread. Reads the file of an Import, splits it into
+ * cycles, and builds the levels of each one. Hands the Import to the audio
+ * thread when it is done, whether or not it succeeded. */
+
+  Import *im = arg;
+  size_t count = 0;
+  size_t length = 0;
+  unsigned int i = 0;
+  float *samples = readWav(im->Path, &count);
+
+  if (samples != NULL) {
+    length = count % DEFAULT_WAVELEN == 0 ? DEFAULT_WAVELEN : count;
+    im->Frames = (unsigned int)LESSER(count / length, (size_t)MAX_IMPORTS);
+    if (im->First + im->Frames > countWaves()) {
+      warnx("%s holds %u cycles, but only %u slots follow wave %u",
+          im->Path, im->Frames, countWaves() - im->First, im->First);
+      im->Frames = 0;
+    }
+  }
+  im->Levels = calloc(im->Frames + 1, sizeof(*im->Levels));
+  im->Compact = calloc(im->Frames + 1, sizeof(*im->Compact));
+  for (; im->Levels != NULL && im->Compact != NULL && i < im->Frames ; i++) {
+    im->Levels[i] = levelCycle(samples + (i * length), length);
+    if (im->Levels[i] == NULL) {
+      warnx("Error allocating the tables of %s", im->Path);
+      break;
+    }
+    im->Compact[i] = compactCycle(im->Levels[i]);
+  }
+  if (im->Levels == NULL || im->Compact == NULL) {
+    warnx("Error allocating the tables of %s", im->Path);
+    im->Frames = 0;
+  } else if (i < im->Frames) {
+    im->Frames = i;
+  }
+  free(samples);
+  im->Next = atomic_load(&FINISHED);
+  while (!atomic_compare_exchange_weak(&FINISHED, &im->Next, im)) {
+    ;
+  }
+  return NULL;
+}
+
+void
+importWaves(const char *arg) {
+
+/* Starts importing a WAV file, given as a wave number followed by a path,
+ * into the import slots from that wave number on. Several imports may run at
+ * once, and whichever finishes last fills any slot they share. */
+
+  char *end = NULL;
+  const char *path = NULL;
+  const unsigned long first = strtoul(arg, &end, 10);
+  size_t i = 0;
+  pthread_t thread;
+  Import *im = NULL;
+
+  for (path = end ; isblank((int)*path) ; path++) {
+    ;
+  }
+  if (end == arg || path == end || *path == '\0') {
+    warnx("Give a wave number and a path, such as I %u cycle.wav",
+        firstImport());
+    return;
+  }
+  if (first < firstImport() || first >= countWaves()) {
+    warnx("Import into a wave between %u and %u", firstImport(),
+        countWaves() - 1);
+    return;
+  }
+  im = calloc(1, sizeof(*im));
+  if (im == NULL || strlen(path) >= sizeof(im->Path)) {
+    warnx("Path is too long: %s", path);
+    free(im);
+    return;
+  }
+  strcpy(im->Path, path);
+  for (i = strlen(im->Path) ; i > 0 && isblank((int)im->Path[i - 1]) ; i--) {
+    im->Path[i - 1] = '\0';
+  }
+  im->First = (unsigned int)first;
+  if (pthread_create(&thread, NULL, runImport, im) != 0) {
+    warnx("Error starting import of %s", path);
+    free(im);
+    return;
+  }
+  pthread_detach(thread);
+}
+
+void
+installImports(void) {
+
+/* Installs the tables of every finished import into its slots, in the order
+ * they finished, and reports the wave numbers each took. Claiming them is a
+ * single atomic exchange, so the audio thread never waits for an import
+ * thread. */
+
+  unsigned int i = 0;
+  Import *im = atomic_exchange(&FINISHED, NULL);
+  Import *next = NULL;
+  Import *oldest = NULL;
+
+  for (; im != NULL ; im = next) {
+    next = im->Next;
+    im->Next = oldest;
+    oldest = im;
+  }
+  for (im = oldest ; im != NULL ; im = next) {
+    for (i = 0 ; i < im->Frames ; i++) {
+      installWave(im->First + i, im->Levels[i], im->Compact[i]);
+    }
+    if (im->Frames == 1) {
+      warnx("Imported %s as wave %u", im->Path, im->First);
+    } else if (im->Frames > 1) {
+      warnx("Imported %s as waves %u to %u", im->Path, im->First,
+          im->First + im->Frames - 1);
+    }
+    next = im->Next;
+    free(im->Levels);
+    free(im->Compact);
+    free(im);
+  }
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+/* Waves are imported from WAV files into the import slots of "wavetable.h".
+ * A file holding a multiple of DEFAULT_WAVELEN samples is read as that many
+ * cycles, one to a slot, and any other file as a single cycle of whatever
+ * length it has. Only the first channel is read. Reading the file and
+ * building its levels take place on a thread of their own, so that the
+ * audio never waits on them. The finished import is handed back through a
+ * single pointer, and installed between blocks by installImports(). */
+
+void importWaves(const char *);
+void installImports(void);
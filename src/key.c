@@ -3,6 +3,7 @@
  * assigned to Osc.KeyMod, which is applied during the synthesis process. */
 
 #include <err.h>
+#include <math.h>
 #include <stdint.h>
 
 #include "key.h"
@@ -14,7 +15,7 @@
 
 static float applyKeyFollowCurve(const Wave *, const unsigned int);
 static void applyKeyboardLayer(const KeyboardLayer *, const KeyboardSettings *,
-    Operator *, const uint16_t);
+    Operator *, const uint16_t, const bool);
 static void makeKeyboardLayer(KeyboardLayer *);
 
 unsigned int
@@ -76,18 +77,27 @@ tuneKey(Keyboard *k, const float tuning) {
 
 static void
 applyKeyboardLayer(const KeyboardLayer *kl, const KeyboardSettings *ks, 
-    Operator *o, const uint16_t n) {
+    Operator *o, const uint16_t n, const bool strike) {
 
-/* Modifies Osc.Pitch and Osc.KeyMod based upon the tuning, velocity, and key
- * follow settings of the KeyboardLayer. */
+/* Modifies Osc.Target and Osc.KeyMod based upon the tuning, velocity, and key
+ * follow settings of the KeyboardLayer. A struck key jumps straight to its
+ * pitch, and to the phase the render clock gives it, wrapped in double
+ * precision so that it stays small however long boar has run. A playing key
+ * glides to its new pitch. */
 
   const unsigned int note = getNote(n);
 
   setPitch(o, note, ks->Rate);
-  o->Osc.Pitch *= kl->Tunings[note];
-  o->Osc.Phase = (float)*ks->Phase * o->Osc.Pitch;
+  o->Osc.Target *= kl->Tunings[note];
+  limitBand(&o->Osc);
   o->Osc.KeyMod = applyVelocityCurve(&kl->VelocityCurve, n) *
     applyKeyFollowCurve(&kl->KeyFollowCurve, note);
+  if (strike) {
+    o->Osc.Pitch = o->Osc.Target;
+    o->Osc.Phase = (float)fmod((double)*ks->Phase * o->Osc.Pitch,
+        DEFAULT_WAVELEN);
+    o->Osc.Offset = 0.0f;
+  }
 }
 
 void
@@ -96,8 +106,18 @@ applyKey(const Keyboard *k, Operator *c, Operator *m, const uint16_t note) {
 /* Modifies an Operator's carrier and modulator in terms of their respective
  * KeyboardLayer settings. */
 
-  applyKeyboardLayer(&k->Carrier, &k->Settings, c, note);
-  applyKeyboardLayer(&k->Modulator, &k->Settings, m, note);
+  applyKeyboardLayer(&k->Carrier, &k->Settings, c, note, true);
+  applyKeyboardLayer(&k->Modulator, &k->Settings, m, note, true);
+}
+
+void
+retuneKey(const Keyboard *k, Operator *c, Operator *m, const uint16_t note) {
+
+/* Like applyKey(), but for a note that is already sounding. Its phase is left
+ * alone, and its pitch glides to the new value over the next block. */
+
+  applyKeyboardLayer(&k->Carrier, &k->Settings, c, note, false);
+  applyKeyboardLayer(&k->Modulator, &k->Settings, m, note, false);
 }
 
 static void
@@ -57,4 +57,5 @@ void selectTuningLayer(Keyboard *, const TuningLayer);
 void selectTuningKey(Keyboard *, const unsigned int);
 void tuneKey(Keyboard *, const float);
 void applyKey(const Keyboard *, Operator *, Operator *, const uint16_t); 
+void retuneKey(const Keyboard *, Operator *, Operator *, const uint16_t);
 void makeKeyboard(Keyboard *, const unsigned int, uint64_t *);
@@ -0,0 +1,265 @@
+/* Functions for reading MIDI input from sndio, or from any readable file.
+ * MIDI messages are mapped straight onto the commands that text input would
+ * produce, so there is no formatting or parsing on the way. */
+
+#include <err.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sndio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "midi.h"
+
+#include "audio-init.h"
+#include "constants/defaults.h"
+#include "constants/errors.h"
+#include "constants/funcs.h"
+#include "constants/maximums.h"
+#include "dispatch.h"
+#include "parse.h"
+#include "voice.h"
+
+static unsigned int countDataBytes(const unsigned char);
+static void runNote(Audio *, const unsigned int, const uint16_t);
+static void runLevel(Audio *, const unsigned int, const float);
+static void runController(Audio *, const unsigned char, const unsigned char);
+static void runMessage(Midi *, Audio *);
+static void readByte(Midi *, Audio *, const unsigned char);
+
+static unsigned int
+countDataBytes(const unsigned char status) {
+
+/* Returns the number of data bytes that follow a status byte. */
+
+  switch (status & 0xF0) {
+    case 0xC0:
+    case 0xD0:
+      return 1;
+    case 0xF0:
+      break;
+    default:
+      return 2;
+  }
+  switch (status) {
+    case 0xF1:
+    case 0xF3:
+      return 1;
+    case 0xF2:
+      return 2;
+    default:
+      return 0;
+  }
+}
+
+static void
+runNote(Audio *a, const unsigned int func, const uint16_t note) {
+
+/* Submits a note command, as if it had been typed. */
+
+  Cmd c = {0};
+
+  c.Func = func;
+  c.Arg.I = note;
+  submitCmd(a, &c);
+}
+
+static void
+runLevel(Audio *a, const unsigned int func, const float f) {
+
+/* Submits a parameter command, so that a controller sweep is coalesced like
+ * any other stream of parameter commands. */
+
+  Cmd c = {0};
+
+  c.Func = func;
+  c.Arg.F = f;
+  submitCmd(a, &c);
+}
+
+static void
+runController(Audio *a, const unsigned char cc, const unsigned char v) {
+
+/* Maps MIDI control changes onto boar's parameters. CC1 (mod wheel) sets the
+ * modulation level, CC7 the master volume, and CC10 the stereo balance. CC120
+ * and CC123 release every note. Other controllers are ignored. */
+
+  const float f = (float)v / (float)MAX_MIDI_VALUE;
+  unsigned int n = 0;
+
+  switch (cc) {
+    case 1:
+      runLevel(a, FUNC_MOD_AMPLITUDE, f * DEFAULT_MIDI_MODULATION);
+      break;
+    case 7:
+      runLevel(a, FUNC_AMPLITUDE, f);
+      break;
+    case 10:
+      runLevel(a, FUNC_CHAN_BALANCE, f);
+      break;
+    case 120:
+    case 123:
+      flushCmds(a);
+      for (; n < DEFAULT_KEYS_NUM ; n++) {
+        voiceOff(&a->Voices, (uint16_t)n);
+      }
+      break;
+  }
+}
+
+static void
+runMessage(Midi *m, Audio *a) {
+
+/* Runs a complete channel message. boar listens on all channels. Velocity is
+ * packed into the upper bits of the note, as described in "velocity.c". A
+ * note on with a velocity of 0 is a note off. */
+
+  const uint16_t note = m->Data[0];
+
+  switch (m->Status & 0xF0) {
+    case 0x80:
+      runNote(a, FUNC_NOTE_OFF, note);
+      break;
+    case 0x90:
+      if (m->Data[1] == 0) {
+        runNote(a, FUNC_NOTE_OFF, note);
+      } else {
+        runNote(a, FUNC_NOTE_ON, (uint16_t)(note | (m->Data[1] << 9)));
+      }
+      break;
+    case 0xB0:
+      runController(a, m->Data[0], m->Data[1]);
+      break;
+  }
+}
+
+static void
+readByte(Midi *m, Audio *a, const unsigned char b) {
+
+/* Feeds a single byte of the MIDI stream into the message in progress.
+ * Realtime bytes may arrive in the middle of other messages and are skipped.
+ * System exclusive data is skipped until its terminating byte. Channel
+ * messages leave a running status behind, so that following messages may
+ * omit their status byte. System common messages clear it. */
+
+  if (b >= 0xF8) {
+    return;
+  }
+  if (b == 0xF0 || b == 0xF7) {
+    m->SysEx = (b == 0xF0);
+    m->Status = 0;
+    return;
+  }
+  if (b & 0x80) {
+    m->SysEx = false;
+    m->Count = 0;
+    m->Status = countDataBytes(b) ? b : 0;
+    return;
+  }
+  if (m->SysEx || m->Status == 0) {
+    return;
+  }
+  m->Data[m->Count++] = b;
+  if (m->Count < countDataBytes(m->Status)) {
+    return;
+  }
+  m->Count = 0;
+  if (m->Status >= 0xF0) {
+    m->Status = 0;
+    return;
+  }
+  runMessage(m, a);
+}
+
+unsigned int
+pollMidi(Midi *m, struct pollfd *pfds) {
+
+/* Fills pfds with the descriptors to poll for MIDI input, and returns how
+ * many there are. Returns 0 if there is no MIDI input. */
+
+  if (m->Input != NULL) {
+    return (unsigned int)mio_pollfd(m->Input, pfds, POLLIN);
+  }
+  if (m->Fd < 0) {
+    return 0;
+  }
+  pfds[0].fd = m->Fd;
+  pfds[0].events = POLLIN;
+  return 1;
+}
+
+void
+readMidi(Midi *m, Audio *a, struct pollfd *pfds) {
+
+/* Reads whatever MIDI bytes are waiting after a poll() and runs any complete
+ * messages among them. Partial messages carry over to the next read. */
+
+  size_t i = 0;
+  size_t n = 0;
+  ssize_t r = 0;
+
+  if (m->Input != NULL) {
+    if (!(mio_revents(m->Input, pfds) & POLLIN)) {
+      return;
+    }
+    n = mio_read(m->Input, m->Buffer, DEFAULT_MIDI_READ);
+  } else {
+    if (!(pfds[0].revents & POLLIN)) {
+      return;
+    }
+    r = read(m->Fd, m->Buffer, DEFAULT_MIDI_READ);
+    n = r > 0 ? (size_t)r : 0;
+  }
+  for (; i < n ; i++) {
+    readByte(m, a, m->Buffer[i]);
+  }
+}
+
+void
+makeMidi(Midi *m, const char *dev) {
+
+/* Opens MIDI input. Names that begin with "/" or "." are treated as files,
+ * which allows a FIFO or a raw MIDI device node to be used. Anything else is
+ * a sndio MIDI port, such as "midi/0" or "default". */
+
+  m->Input = NULL;
+  m->Fd = -1;
+  m->Status = 0;
+  m->Count = 0;
+  m->SysEx = false;
+  if (dev == NULL) {
+    return;
+  }
+  if (dev[0] == '/' || dev[0] == '.') {
+    m->Fd = open(dev, O_RDONLY | O_NONBLOCK);
+    if (m->Fd < 0) {
+      err(ERROR_SIO, "Error opening MIDI file %s", dev);
+    }
+    m->Nfds = 1;
+    return;
+  }
+  m->Input = mio_open(dev, MIO_IN, true);
+  if (m->Input == NULL) {
+    errx(ERROR_SIO, "Error opening MIDI port %s", dev);
+  }
+  m->Nfds = (unsigned int)mio_nfds(m->Input);
+  if (m->Nfds > MAX_MIDI_FDS) {
+    errx(ERROR_SIO, "MIDI port %s needs too many descriptors", dev);
+  }
+}
+
+void
+killMidi(Midi *m) {
+
+/* Closes MIDI input, if any was opened. */
+
+  if (m->Input != NULL) {
+    mio_close(m->Input);
+    m->Input = NULL;
+  }
+  if (m->Fd >= 0) {
+    close(m->Fd);
+    m->Fd = -1;
+  }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <poll.h>
+#include <sndio.h>
+#include <stdbool.h>
+
+#include "audio-init.h"
+#include "constants/defaults.h"
+
+typedef struct Midi {
+
+/* A raw MIDI byte stream that drives Voices and Amplitude directly, without
+ * going through text commands. Midi.Input is a sndio MIDI port. If the user
+ * named a file such as a FIFO instead, Midi.Input is NULL and the file is read
+ * from Midi.Fd. Midi.Status holds the running status, and Midi.Data collects
+ * the data bytes of the message in progress. */
+
+  struct mio_hdl  * Input;
+  int               Fd;
+  unsigned int      Nfds;
+  unsigned char     Status;
+  unsigned char     Data[2];
+  unsigned int      Count;
+  bool              SysEx;
+  unsigned char     Buffer[DEFAULT_MIDI_READ];
+} Midi;
+
+unsigned int pollMidi(Midi *, struct pollfd *);
+void readMidi(Midi *, Audio *, struct pollfd *);
+void makeMidi(Midi *, const char *);
+void killMidi(Midi *);
@@ -3,13 +3,14 @@
  * referentially transparent, since they are decoupled from the  types, enums, 
  * etc. in other files that give functions proper context. */
 
+#include <math.h>
 #include <stdbool.h>
 #include <stdlib.h>
 
 #include "numerical.h"
 
+#include "constants/defaults.h"
 #include "constants/maximums.h"
-#include "wavetables/exponential.h"
 
 float
 truncateFloat(const float f, const float max) {
@@ -51,14 +52,14 @@ float
 expCurve(const float f) {
 
 /* Takes a float value between 0.0 and 1.0 and returns another value between
- * -1.0 and 1.0 from a wavetable representing an exponential function. This
+ * -1.0 and 1.0 along the same exponential curve as the exponential wave. This
  * value must be made unipolar again before it is of any use to envelopes.
  * The curve is applied to diminish the presence of extreme values rarely used
- * as arguments to envelopes. Interpolation is foresaken for basic truncation, 
- * since the wavetable itself already provides a far superior resolution to
- * traditional synthesis parameters, which are usually between 0 and 127. */
+ * as arguments to envelopes. */
 
-  return WAVE_EXPONENTIALS[0][(unsigned int)(f * (DEFAULT_WAVELEN - 1))];
+  const float k = (float)DEFAULT_EXP_CURVE;
+
+  return (2.0f * (expf(k * f) - 1.0f) / (expf(k) - 1.0f)) - 1.0f;
 }
 
 float
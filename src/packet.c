@@ -0,0 +1,130 @@
+/* Decodes fixed size binary packets into proper boar commands. This is an
+ * alternative to "parse.c" for programs that generate their commands, and do
+ * not need to read or write them as text. The expected argument type of every
+ * command still comes from "types.h". Consult "packet.h" for the layout. */
+
+#include <err.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "packet.h"
+
+#include "constants/defaults.h"
+#include "constants/errors.h"
+#include "constants/types.h"
+#include "parse.h"
+
+static uint32_t readUint32(const unsigned char *);
+static uint64_t readUint64(const unsigned char *);
+static Error decodeFunc(Cmd *, const unsigned char *);
+static Error decodeArg(Cmd *, const unsigned char *);
+
+static uint32_t
+readUint32(const unsigned char *b) {
+
+/* Reads a little endian uint32 regardless of host byte order. */
+
+  return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) |
+      ((uint32_t)b[3] << 24);
+}
+
+static uint64_t
+readUint64(const unsigned char *b) {
+
+/* Reads a little endian uint64 regardless of host byte order. */
+
+  return (uint64_t)readUint32(b) | ((uint64_t)readUint32(b + 4) << 32);
+}
+
+static Error
+decodeFunc(Cmd *c, const unsigned char *p) {
+
+/* Populates Cmd.Func and Cmd.Type from the command character and adornment of
+ * a packet, using the same tables as the text parser. */
+
+  unsigned int type = TYPE_UNDEFINED;
+  unsigned int typeIndex = p[0] - DEFAULT_ASCII_A;
+
+  if (p[0] < DEFAULT_ASCII_A || typeIndex > 57) {
+    return ERROR_FUNCTION;
+  }
+  switch (p[1]) {
+    case '.':
+      type = TYPE_SIGNATURES_PERIOD[typeIndex];
+      c->Func = typeIndex | TYPE_PERIOD;
+      break;
+    case ':':
+      type = TYPE_SIGNATURES_COLON[typeIndex];
+      c->Func = typeIndex | TYPE_COLON;
+      break;
+    default:
+      type = TYPE_SIGNATURES_PURE[typeIndex];
+      c->Func = typeIndex;
+  }
+  if (type == TYPE_UNDEFINED || (type & (TYPE_FLAG_TEXT | TYPE_ANY))) {
+    /* Text arguments do not fit in a packet. */
+    return ERROR_FUNCTION;
+  }
+  c->Type = type;
+  return ERROR_OK;
+}
+
+static Error
+decodeArg(Cmd *c, const unsigned char *p) {
+
+/* Reads the argument of a packet as the type the command expects. Unipolar
+ * commands reject negative values, as they do in the text parser. */
+
+  const uint32_t bits = readUint32(p);
+
+  if (c->Type == TYPE_NIL) {
+    c->Arg.I = 0;
+    return ERROR_OK;
+  }
+  if (c->Type & TYPE_FLAG_FLOATING) {
+    memcpy(&c->Arg.F, &bits, sizeof(c->Arg.F));
+    if (!isfinite(c->Arg.F) ||
+        (c->Type == TYPE_UFLOAT && c->Arg.F < 0.0f)) {
+      return ERROR_TYPE;
+    }
+    return ERROR_OK;
+  }
+  memcpy(&c->Arg.I, &bits, sizeof(c->Arg.I));
+  if (c->Type == TYPE_UINT && c->Arg.I < 0) {
+    return ERROR_TYPE;
+  }
+  return ERROR_OK;
+}
+
+Error
+decodeCmd(Cmd *c, const unsigned char *p) {
+
+/* Decodes a single PACKET_SIZE packet into a Cmd struct. Any error is stored
+ * in Cmd.Error and returned, and a warning names the offending packet. */
+
+  c->Time = CMD_TIME_NOW;
+  c->Frame = 0;
+  c->Error = decodeFunc(c, p);
+  if (c->Error == ERROR_OK) {
+    c->Error = decodeArg(c, p + 4);
+  }
+  if (c->Error == ERROR_OK) {
+    switch (p[2]) {
+      case CMD_TIME_NOW:
+        break;
+      case CMD_TIME_ABSOLUTE:
+      case CMD_TIME_RELATIVE:
+        c->Time = p[2];
+        c->Frame = readUint64(p + 8);
+        break;
+      default:
+        c->Error = ERROR_INPUT;
+    }
+  }
+  if (c->Error != ERROR_OK) {
+    warnx("Invalid packet: command %u, adornment %u, timing %u", p[0], p[1],
+        p[2]);
+  }
+  return c->Error;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "constants/errors.h"
+#include "parse.h"
+
+/* The size in bytes of one binary command packet. The layout is:
+ *
+ *  byte 0      command character, such as 'n'
+ *  byte 1      adornment: '.', ':', or anything else for none
+ *  byte 2      timing: 0 now, 1 absolute frame, 2 relative frame
+ *  byte 3      reserved, should be 0
+ *  bytes 4-7   argument, a little endian int32 or IEEE 754 float depending
+ *              on the signature of the command
+ *  bytes 8-15  little endian uint64 frame, for timed packets */
+#define PACKET_SIZE 16
+
+Error decodeCmd(Cmd *, const unsigned char *);
@@ -8,6 +8,7 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "parse.h"
@@ -15,17 +16,53 @@
 #include "constants/defaults.h"
 #include "constants/errors.h"
 #include "constants/types.h"
+#include "verbs.h"
 
+static int parseTime(Cmd *, char *);
 static int readArg(unsigned int *, char *);
 static bool isValidArg(const unsigned int, const unsigned int);
 static int parseFunc(Cmd *, char *);
 static void parseArg(Cmd *, const unsigned int, char *);
 static char * printArg(unsigned int);
 static int flushCmd(char *);
+static bool isVerb(const char *);
 
 #define ACTIVATE_FLAG(n, x) (n | x)
 #define IS_FLAG_ACTIVE(n, x) ((bool)(n & x))
-#define IS_DELIMETER(c) (c == ';' || c == '\n' || c == '\0')
+
+static int
+parseTime(Cmd *c, char *line) {
+
+/* Reads an optional scheduling prefix into Cmd.Time and Cmd.Frame. "@n" asks
+ * for frame n of the render clock, and "+n" for n frames from now. Returns the
+ * length of the prefix and any whitespace around it, or 0 if there is no
+ * prefix. */
+
+  int span = 0;
+  char *end = NULL;
+
+  for (; isblank((int)line[span]); span++) {
+    ;
+  }
+  if (line[span] == '@') {
+    c->Time = CMD_TIME_ABSOLUTE;
+  } else if (line[span] == '+') {
+    c->Time = CMD_TIME_RELATIVE;
+  } else {
+    return 0;
+  }
+  span++;
+  if (!isdigit((int)line[span])) {
+    c->Error = ERROR_INPUT;
+    return span;
+  }
+  c->Frame = strtoull(line + span, &end, 10);
+  span = end - line;
+  for (; isblank((int)line[span]); span++) {
+    ;
+  }
+  return span;
+}
 
 static int
 readArg(unsigned int *t, char *line) {
@@ -118,10 +155,11 @@ parseFunc(Cmd *c, char *line) {
  * operation is checked with Cmd.Error. */
 
   int span = 1;
+  int leading = 0;
   unsigned int type = TYPE_UNDEFINED;
   unsigned int typeIndex = 26; /* defaults to always undefined index */
 
-  for (; isblank((int)*line); line++, span++) {
+  for (; isblank((int)*line); line++, span++, leading++) {
     /* chew up any leading whitespace before command */
     ;
   }
@@ -155,7 +193,9 @@ parseFunc(Cmd *c, char *line) {
     return -1;
   }
   c->Type = type;
-  for (line += 2; isblank((int)*line); line++, span++) {
+  /* The leading blanks are already behind "line", so step over the command
+   * and its adornment only. */
+  for (line += span - leading; isblank((int)*line); line++, span++) {
     /* chew up any trailing whitespace after command */
     ;
   }
@@ -212,23 +252,50 @@ flushCmd(char *line) {
   return ++span;
 }
 
+static bool
+isVerb(const char *line) {
+
+/* Returns true if the command is a whole word, rather than a single letter
+ * with an optional adornment. */
+
+  for (; isblank((int)*line); line++) {
+    ;
+  }
+  return isalpha((int)line[0]) && isalpha((int)line[1]);
+}
+
 int
 parseCmd(Cmd *c, char *line) {
 
 /* Reads a single command worth of user input into a Cmd struct, along with any
- * errors it encounters. Returns the number of bytes read, including the
- * delimeter, to aid in the parsing of other commands issued on the same 
- * line. */
+ * errors it encounters. The command may be preceded by a scheduling prefix,
+ * and may be a named command with several arguments (see "verbs.c").
+ * Returns the number of bytes read, including the delimeter, to aid in the
+ * parsing of other commands issued on the same line. */
 
   int span = 0;
+  int timeSpan = 0;
   unsigned int t = TYPE_UNDEFINED;
 
-
   c->Error = ERROR_OK;
+  c->Time = CMD_TIME_NOW;
+  c->Frame = 0;
+  timeSpan = parseTime(c, line);
+  if (c->Error != ERROR_OK) {
+    return flushCmd(line);
+  }
+  line += timeSpan;
+  if (isVerb(line)) {
+    span = parseVerb(c, line);
+    if (c->Error != ERROR_OK) {
+      span = flushCmd(line);
+    }
+    return timeSpan + span;
+  }
   span = parseFunc(c, line);
   if (c->Error != ERROR_OK) {
     span = flushCmd(line);
-    return span;
+    return timeSpan + span;
   }
   line += span;
   span += readArg(&t, line);
@@ -236,10 +303,10 @@ parseCmd(Cmd *c, char *line) {
     warnx("Invalid argument %s. Expected %s, got %s", line,
         printArg(c->Type), printArg(t));
     c->Error = ERROR_ARG;
-    return span;
+    return timeSpan + span;
   }
   parseArg(c, t, line);
-  return span;
+  return timeSpan + span;
 }
 
 static char *
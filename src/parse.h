@@ -3,6 +3,7 @@
 #include <stdint.h>
 
 #include "constants/errors.h"
+#include "constants/maximums.h"
 
 typedef union Arg {
 
@@ -14,18 +15,38 @@ typedef union Arg {
   char        * S;
 } Arg;
 
+typedef enum CmdTime {
+
+/* When a command should run. Commands without a prefix run immediately.
+ * Commands prefixed with @n run at frame n of the render clock, and commands
+ * prefixed with +n run n frames after the start of the next block. */
+
+  CMD_TIME_NOW = 0,
+  CMD_TIME_ABSOLUTE,
+  CMD_TIME_RELATIVE
+} CmdTime;
+
 typedef struct Cmd {
 
 /* The representation of a single boar command. Cmd.Func is a character that
  * corresponds with one of boar's functions, Cmd.Type is the signature of the
  * expected argument, and Cmd.Arg is the solitary argument to this function.
  * Errors parsing commands are stored in Cmd.Error, since the return type of
- * many parsing functions is the number of bytes read. */
+ * many parsing functions is the number of bytes read. Cmd.Time and Cmd.Frame
+ * hold the optional scheduling prefix. Named commands take several arguments
+ * in Cmd.Args instead, and Cmd.Given has a bit set for each one the user
+ * actually gave. */
 
   unsigned int  Func;
   unsigned int  Type;
   Error         Error;        
+  CmdTime       Time;
+  uint64_t      Frame;
   Arg           Arg;
+  unsigned int  Given;
+  Arg           Args[MAX_ARGS];
 } Cmd;
 
+#define IS_DELIMETER(c) (c == ';' || c == '\n' || c == '\0')
+
 int parseCmd(Cmd *, char *);
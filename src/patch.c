@@ -0,0 +1,369 @@
+/* Functions for saving and recalling complete patches. Consult "patch.h" for
+ * more info. A -bank file begins with a BankHeader, followed by MAX_PATCHES
+ * Patch structs in host byte order. */
+
+#include <err.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "patch.h"
+
+#include "amplitude.h"
+#include "constants/defaults.h"
+#include "constants/errors.h"
+#include "constants/maximums.h"
+#include "envelope.h"
+#include "key.h"
+#include "numerical.h"
+#include "route.h"
+#include "synthesis.h"
+#include "voice.h"
+#include "wave.h"
+
+typedef struct BankHeader {
+
+/* Identifies a bank file, and guards against loading one written by a build
+ * with a different Patch layout. */
+
+  char          Magic[4];
+  uint32_t      Version;
+  uint32_t      PatchSize;
+  uint32_t      Slots;
+} BankHeader;
+
+static int32_t waveNumber(const Wave *);
+static float envSeconds(const Envs *, const EnvStep *);
+static void saveOperator(OperatorPatch *, const Operators *,
+    const KeyboardLayer *);
+static void loadOperator(const OperatorPatch *, Operators *,
+    KeyboardLayer *);
+static void saveRoute(RoutePatch *, const Route *);
+static void loadRoute(const RoutePatch *, const Router *, Route *);
+static void makeHeader(BankHeader *);
+static void readBank(Bank *);
+static bool takeDirty(Bank *, Patch *, unsigned int *);
+static void * runWriter(void *);
+
+static int32_t
+waveNumber(const Wave *w) {
+
+/* Returns the number that selects Wave w, as given to selectWave(). */
+
+  return w->Polarity < 0.0f ? -(int32_t)w->Type : (int32_t)w->Type;
+}
+
+static float
+envSeconds(const Envs *es, const EnvStep *est) {
+
+/* Converts the speed of an envelope stage back into seconds. */
+
+  return 1.0f / ((float)es->Rate * est->Level);
+}
+
+static void
+saveOperator(OperatorPatch *op, const Operators *os,
+    const KeyboardLayer *kl) {
+
+/* Copies the settings of an Operators and its KeyboardLayer into op. */
+
+  op->Wave = waveNumber(&os->Wave);
+  op->Complexity = os->Complexity;
+  op->MorphFrom = (int32_t)os->Morph.From;
+  op->MorphFrames = (int32_t)os->Morph.Frames;
+  op->MorphPosition = os->Morph.Position;
+  op->MorphSweep = os->Morph.Sweep;
+  op->Quality = (int32_t)os->Quality;
+  op->FixedRate = os->FixedRate;
+  op->Ratio = os->Ratio;
+  op->Env.Loop = os->Env.Loop;
+  op->Env.Depth = os->Env.Depth;
+  op->Env.Attack = envSeconds(&os->Env, &os->Env.Attack);
+  op->Env.Decay = envSeconds(&os->Env, &os->Env.Decay);
+  op->Env.Sustain = os->Env.Sustain;
+  op->Env.Release = envSeconds(&os->Env, &os->Env.Release);
+  op->Env.AttackWave = waveNumber(&os->Env.Attack.Wave);
+  op->Env.DecayWave = waveNumber(&os->Env.Decay.Wave);
+  op->Env.ReleaseWave = waveNumber(&os->Env.Release.Wave);
+  op->VelocityCurve = waveNumber(&kl->VelocityCurve);
+  op->KeyFollowCurve = waveNumber(&kl->KeyFollowCurve);
+  memcpy(op->Tunings, kl->Tunings, sizeof(op->Tunings));
+}
+
+static void
+loadOperator(const OperatorPatch *op, Operators *os, KeyboardLayer *kl) {
+
+/* Applies the settings in op to an Operators and its KeyboardLayer. */
+
+  selectWave(&os->Wave, op->Wave);
+  os->Complexity = op->Complexity;
+  setMorphFrames(&os->Morph, (unsigned int)op->MorphFrom,
+      (unsigned int)op->MorphFrames);
+  os->Morph.Position = op->MorphPosition;
+  os->Morph.Sweep = op->MorphSweep;
+  setQuality(&os->Quality, (unsigned int)op->Quality);
+  os->FixedRate = op->FixedRate;
+  os->Ratio = op->Ratio;
+  setLoop(&os->Env, (bool)op->Env.Loop);
+  setDepth(&os->Env, op->Env.Depth);
+  setAttackLevel(&os->Env, op->Env.Attack);
+  setDecayLevel(&os->Env, op->Env.Decay);
+  setSustainLevel(&os->Env, op->Env.Sustain);
+  setReleaseLevel(&os->Env, op->Env.Release);
+  setAttackWave(&os->Env, op->Env.AttackWave);
+  setDecayWave(&os->Env, op->Env.DecayWave);
+  setReleaseWave(&os->Env, op->Env.ReleaseWave);
+  selectWave(&kl->VelocityCurve, op->VelocityCurve);
+  selectWave(&kl->KeyFollowCurve, op->KeyFollowCurve);
+  memcpy(kl->Tunings, op->Tunings, sizeof(kl->Tunings));
+}
+
+static void
+saveRoute(RoutePatch *rp, const Route *r) {
+
+/* Copies a Route into rp. */
+
+  rp->Mode = (int32_t)r->Mode;
+  rp->Channel = r->Channel;
+  memcpy(rp->Gains, r->Gains, sizeof(rp->Gains));
+}
+
+static void
+loadRoute(const RoutePatch *rp, const Router *rt, Route *r) {
+
+/* Applies rp to a Route. A patch stored with more output channels than boar
+ * now has sends notes routed to a missing channel to every channel instead,
+ * and gains are kept between 0.0 and 1.0. */
+
+  size_t c = 0;
+
+  if ((rp->Mode != ROUTE_SOLO && rp->Mode != ROUTE_MATRIX) ||
+      (rp->Mode == ROUTE_SOLO && rp->Channel >= rt->Channels)) {
+    makeRoute(r);
+    return;
+  }
+  r->Mode = (RouteMode)rp->Mode;
+  r->Channel = rp->Channel;
+  for (; c < MAX_CHANNELS ; c++) {
+    r->Gains[c] = truncateFloat(liftFloat(rp->Gains[c], 0.0f), 1.0f);
+  }
+}
+
+static void
+makeHeader(BankHeader *h) {
+
+/* Fills in the header of a bank file. */
+
+  memcpy(h->Magic, "BOAR", sizeof(h->Magic));
+  h->Version = DEFAULT_BANK_VERSION;
+  h->PatchSize = sizeof(Patch);
+  h->Slots = MAX_PATCHES;
+}
+
+static void
+readBank(Bank *b) {
+
+/* Loads the Patches of an existing bank file, or writes a header to an empty
+ * one. A file that is not a bank written by this version of boar is fatal,
+ * rather than being overwritten. */
+
+  BankHeader h = {{0}};
+  BankHeader expected = {{0}};
+  ssize_t n = read(b->Fd, &h, sizeof(h));
+
+  makeHeader(&expected);
+  if (n == 0) {
+    if (write(b->Fd, &expected, sizeof(expected)) != sizeof(expected)) {
+      err(ERROR_ARG, "Error writing bank file");
+    }
+    return;
+  }
+  if (n != sizeof(h) || memcmp(&h, &expected, sizeof(h)) != 0) {
+    errx(ERROR_ARG, "Not a bank file for this version of boar");
+  }
+  n = read(b->Fd, b->All, sizeof(*b->All) * MAX_PATCHES);
+  if (n < 0) {
+    err(ERROR_ARG, "Error reading bank file");
+  }
+}
+
+static bool
+takeDirty(Bank *b, Patch *p, unsigned int *slot) {
+
+/* Waits until a slot is marked in Bank.Dirty, then copies it into p, stores
+ * its number in "slot", and clears its mark. Returns false once Bank.Stop is
+ * set and every stored slot has been handed out. */
+
+  unsigned int i = 0;
+
+  pthread_mutex_lock(&b->Lock);
+  for (;;) {
+    for (i = 0 ; i < MAX_PATCHES && !b->Dirty[i] ; i++) {
+      ;
+    }
+    if (i < MAX_PATCHES || b->Stop) {
+      break;
+    }
+    pthread_cond_wait(&b->Wake, &b->Lock);
+  }
+  if (i < MAX_PATCHES) {
+    memcpy(p, &b->All[i], sizeof(*p));
+    b->Dirty[i] = false;
+    *slot = i;
+  }
+  pthread_mutex_unlock(&b->Lock);
+  return i < MAX_PATCHES;
+}
+
+static void *
+runWriter(void *arg) {
+
+/* The body of the bank writer thread. Writes each stored slot to the bank
+ * file. A slot stored again before it is written is only written once, with
+ * its newest settings. */
+
+  Bank *b = arg;
+  Patch *p = malloc(sizeof(*p));
+  unsigned int slot = 0;
+  off_t offset = 0;
+
+  if (p == NULL) {
+    warnx("Error allocating the bank writer");
+    return NULL;
+  }
+  while (takeDirty(b, p, &slot)) {
+    offset = sizeof(BankHeader) + ((off_t)sizeof(*p) * slot);
+    if (pwrite(b->Fd, p, sizeof(*p), offset) != sizeof(*p)) {
+      warn("Error writing patch %u to bank file", slot);
+    }
+  }
+  free(p);
+  return NULL;
+}
+
+void
+storePatch(Bank *b, const unsigned int slot, const Voices *vs,
+    const Amplitude *a) {
+
+/* Saves the current settings to a slot of the bank. If there is a bank file,
+ * the slot is handed to the writer thread, which rewrites only that slot. The
+ * lock is only held while the slot is filled in, and the writer never holds
+ * it while writing, so storing never waits on the disk. */
+
+  Patch *p = NULL;
+  unsigned int i = 0;
+
+  if (slot >= MAX_PATCHES) {
+    warnx("Patch must be between 0 and %d", MAX_PATCHES - 1);
+    return;
+  }
+  pthread_mutex_lock(&b->Lock);
+  p = &b->All[slot];
+  p->Used = 1;
+  p->Modulation = vs->Modulation;
+  p->Master = a->Master;
+  memcpy(p->Channels, a->Channels, sizeof(p->Channels));
+  saveOperator(&p->Carrier, &vs->Carrier, &vs->Keyboard.Carrier);
+  saveOperator(&p->Modulator, &vs->Modulator, &vs->Keyboard.Modulator);
+  for (; i < DEFAULT_KEYS_NUM ; i++) {
+    saveRoute(&p->Routes[i], &vs->Routes[i]);
+  }
+  b->Dirty[slot] = b->Fd >= 0;
+  pthread_cond_signal(&b->Wake);
+  pthread_mutex_unlock(&b->Lock);
+}
+
+void
+recallPatch(Bank *b, const unsigned int slot) {
+
+/* Marks a slot of the bank to be applied before the next block. */
+
+  if (slot >= MAX_PATCHES) {
+    warnx("Patch must be between 0 and %d", MAX_PATCHES - 1);
+    return;
+  }
+  if (!b->All[slot].Used) {
+    warnx("Patch %u is empty", slot);
+    return;
+  }
+  b->Pending = &b->All[slot];
+}
+
+void
+applyPending(Bank *b, Voices *vs, Amplitude *a) {
+
+/* Applies a recalled Patch, if there is one, in a single step. Playing notes
+ * are retuned to the new settings rather than cut off. */
+
+  const Patch *p = b->Pending;
+  unsigned int i = 0;
+
+  if (p == NULL) {
+    return;
+  }
+  b->Pending = NULL;
+  loadOperator(&p->Carrier, &vs->Carrier, &vs->Keyboard.Carrier);
+  loadOperator(&p->Modulator, &vs->Modulator, &vs->Keyboard.Modulator);
+  setModulation(vs, p->Modulation);
+  a->Master = p->Master;
+  memcpy(a->Channels, p->Channels, sizeof(a->Channels));
+  for (; i < DEFAULT_KEYS_NUM ; i++) {
+    loadRoute(&p->Routes[i], &vs->Router, &vs->Routes[i]);
+  }
+  retuneVoices(vs);
+}
+
+void
+makeBank(Bank *b, const char *path) {
+
+/* Allocates the bank, and loads it from "path" if one was given. The file is
+ * created if it does not exist, and a writer thread is started for it.
+ * Errors are fatal. */
+
+  b->Fd = -1;
+  b->Pending = NULL;
+  b->Stop = false;
+  memset(b->Dirty, 0, sizeof(b->Dirty));
+  b->All = calloc(MAX_PATCHES, sizeof(*b->All));
+  if (b->All == NULL) {
+    errx(ERROR_ALLOC, "Error allocating patch bank");
+  }
+  if (pthread_mutex_init(&b->Lock, NULL) != 0 ||
+      pthread_cond_init(&b->Wake, NULL) != 0) {
+    errx(ERROR_ALLOC, "Error initializing patch bank");
+  }
+  if (path == NULL) {
+    return;
+  }
+  b->Fd = open(path, O_RDWR | O_CREAT, 0644);
+  if (b->Fd < 0) {
+    err(ERROR_ARG, "Error opening bank file %s", path);
+  }
+  readBank(b);
+  if (pthread_create(&b->Writer, NULL, runWriter, b) != 0) {
+    errx(ERROR_ALLOC, "Error starting bank writer");
+  }
+}
+
+void
+killBank(Bank *b) {
+
+/* Waits for the writer to save every stored slot, closes the bank file, if
+ * any, and frees the bank. */
+
+  if (b->Fd >= 0) {
+    pthread_mutex_lock(&b->Lock);
+    b->Stop = true;
+    pthread_cond_signal(&b->Wake);
+    pthread_mutex_unlock(&b->Lock);
+    pthread_join(b->Writer, NULL);
+    close(b->Fd);
+  }
+  pthread_mutex_destroy(&b->Lock);
+  pthread_cond_destroy(&b->Wake);
+  free(b->All);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "amplitude.h"
+#include "constants/defaults.h"
+#include "constants/maximums.h"
+#include "voice.h"
+
+typedef struct EnvPatch {
+
+/* The user-facing settings of an Envs. Stage times are stored in seconds and
+ * waves by their number, so that a patch does not depend on the sample rate
+ * or on the address of any wavetable. */
+
+  int32_t       Loop;
+  float         Depth;
+  float         Attack;
+  float         Decay;
+  float         Sustain;
+  float         Release;
+  int32_t       AttackWave;
+  int32_t       DecayWave;
+  int32_t       ReleaseWave;
+} EnvPatch;
+
+typedef struct OperatorPatch {
+
+/* The settings of a carrier or modulator, along with its KeyboardLayer. */
+
+  int32_t       Wave;
+  int32_t       Complexity;
+  int32_t       MorphFrom;
+  int32_t       MorphFrames;
+  float         MorphPosition;
+  float         MorphSweep;
+  int32_t       Quality;
+  float         FixedRate;
+  float         Ratio;
+  EnvPatch      Env;
+  int32_t       VelocityCurve;
+  int32_t       KeyFollowCurve;
+  float         Tunings[DEFAULT_KEYS_NUM];
+} OperatorPatch;
+
+typedef struct RoutePatch {
+
+/* The Route of a note, with its RouteMode stored as a fixed size integer. */
+
+  int32_t       Mode;
+  uint32_t      Channel;
+  float         Gains[MAX_CHANNELS];
+} RoutePatch;
+
+typedef struct Patch {
+
+/* A snapshot of every setting that makes up a sound: both operators, the
+ * modulation level, the master volume, the volume of every output channel,
+ * and the Route of every note. Patch.Used is nonzero once a patch has been
+ * stored. A Patch is plain data, so it is saved to and loaded from disk as
+ * is. */
+
+  uint32_t      Used;
+  float         Modulation;
+  float         Master;
+  float         Channels[MAX_CHANNELS];
+  OperatorPatch Carrier;
+  OperatorPatch Modulator;
+  RoutePatch    Routes[DEFAULT_KEYS_NUM];
+} Patch;
+
+typedef struct Bank {
+
+/* MAX_PATCHES slots of Patches, optionally backed by a -bank file at Bank.Fd.
+ * Recalling a slot only points Bank.Pending at it. The Patch is applied as a
+ * whole before the next block is rendered, or before the next command runs,
+ * so no intermediate mixture of two patches is ever heard. Storing a slot
+ * marks it in Bank.Dirty, and the thread at Bank.Writer writes it to the
+ * file, so that the audio thread never waits on the disk. Bank.Lock guards
+ * Bank.Dirty, Bank.Stop and the stored slots while the writer copies them,
+ * and Bank.Wake tells the writer that there is work to do. */
+
+  int               Fd;
+  Patch           * All;
+  const Patch     * Pending;
+  pthread_t         Writer;
+  pthread_mutex_t   Lock;
+  pthread_cond_t    Wake;
+  bool              Dirty[MAX_PATCHES];
+  bool              Stop;
+} Bank;
+
+void storePatch(Bank *, const unsigned int, const Voices *,
+    const Amplitude *);
+void recallPatch(Bank *, const unsigned int);
+void applyPending(Bank *, Voices *, Amplitude *);
+void makeBank(Bank *, const char *);
+void killBank(Bank *);
@@ -0,0 +1,167 @@
+/* Functions for the Reader type, which buffers input from a file descriptor
+ * and hands it out one command at a time. Consult "reader.h" for more info. */
+
+#include <err.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "reader.h"
+
+#include "constants/defaults.h"
+#include "constants/errors.h"
+#include "packet.h"
+#include "parse.h"
+
+static void printParseErr(const Error, const char *);
+static bool fillLine(Reader *);
+static bool fillPacket(Reader *);
+
+static void
+printParseErr(const Error err, const char *buffer) {
+
+/* Explains why a command could not be parsed. */
+
+  switch((unsigned int)err) {
+    case ERROR_NOTHING:
+      break;
+    case ERROR_INPUT:
+      warnx("Invalid input");
+      break;
+    case ERROR_FUNCTION:
+      warnx("Procedure not found: %.*s", (int)strcspn(buffer, " \t;"),
+          buffer);
+      break;
+    case ERROR_TYPE:
+      warnx("Incorrect argument type for %c", buffer[0]);
+      break;
+  }
+}
+
+static bool
+fillLine(Reader *r) {
+
+/* Moves bytes from Reader.Ring into Reader.Line until a newline arrives.
+ * Returns true once Reader.Line holds a complete, null-terminated line that is
+ * worth parsing. Returns false if the line is still partial. Empty lines and
+ * comments are dropped here. */
+
+  char c = '\0';
+
+  while (r->Tail != r->Head) {
+    c = r->Ring[r->Tail++ % DEFAULT_RING_SIZE];
+    if (c != '\n') {
+      if (r->Length == DEFAULT_LINESIZE - 1) {
+        if (!r->Overflow) {
+          warnx("Line longer than %d bytes discarded", DEFAULT_LINESIZE - 1);
+        }
+        r->Overflow = true;
+        r->Length = 0;
+      }
+      if (!r->Overflow) {
+        r->Line[r->Length++] = c;
+      }
+      continue;
+    }
+    if (r->Overflow || r->Length == 0 || r->Line[0] == '#') {
+      r->Overflow = false;
+      r->Length = 0;
+      continue;
+    }
+    r->Line[r->Length] = '\0';
+    r->Pos = 0;
+    r->Ready = true;
+    return true;
+  }
+  return false;
+}
+
+static bool
+fillPacket(Reader *r) {
+
+/* Moves bytes from Reader.Ring into Reader.Line until a whole binary packet
+ * has arrived. Returns true when it has. */
+
+  while (r->Tail != r->Head && r->Length < PACKET_SIZE) {
+    r->Line[r->Length++] = r->Ring[r->Tail++ % DEFAULT_RING_SIZE];
+  }
+  return r->Length == PACKET_SIZE;
+}
+
+void
+fillReader(Reader *r) {
+
+/* Reads whatever is waiting on Reader.Fd into the free space of Reader.Ring.
+ * Only the contiguous free space is filled, so a wrapped ring may take two
+ * calls to fill completely. That is fine, since unread input keeps the
+ * descriptor ready for the next poll(). Sets Reader.Eof once the other end
+ * has closed. */
+
+  const size_t used = r->Head - r->Tail;
+  const size_t start = r->Head % DEFAULT_RING_SIZE;
+  size_t space = DEFAULT_RING_SIZE - used;
+  ssize_t n = 0;
+
+  if (space == 0) {
+    return;
+  }
+  if (start + space > DEFAULT_RING_SIZE) {
+    space = DEFAULT_RING_SIZE - start;
+  }
+  n = read(r->Fd, r->Ring + start, space);
+  if (n == 0) {
+    r->Eof = true;
+  } else if (n > 0) {
+    r->Head += (size_t)n;
+  }
+}
+
+bool
+readCmd(Reader *r, Cmd *c) {
+
+/* Parses the next buffered command into c. Returns false if no complete
+ * command is waiting. A command that fails to parse still returns true, with
+ * the reason in Cmd.Error, so that it counts against the command budget. */
+
+  int span = 0;
+
+  if (r->Binary) {
+    if (!fillPacket(r)) {
+      return false;
+    }
+    r->Length = 0;
+    decodeCmd(c, (unsigned char *)r->Line);
+    return true;
+  }
+  if (!r->Ready && !fillLine(r)) {
+    return false;
+  }
+  span = parseCmd(c, r->Line + r->Pos);
+  if (c->Error != ERROR_OK) {
+    printParseErr(c->Error, r->Line + r->Pos);
+  }
+  r->Pos += (size_t)span;
+  if (r->Pos >= r->Length) {
+    r->Ready = false;
+    r->Length = 0;
+  }
+  return true;
+}
+
+void
+makeReader(Reader *r, const int fd, const bool binary) {
+
+/* Initializes an empty Reader on descriptor fd. If "binary" is true, it reads
+ * binary packets rather than lines of text. */
+
+  r->Fd = fd;
+  r->Binary = binary;
+  r->Eof = false;
+  r->Ready = false;
+  r->Overflow = false;
+  r->Head = 0;
+  r->Tail = 0;
+  r->Length = 0;
+  r->Pos = 0;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "constants/defaults.h"
+#include "parse.h"
+
+typedef struct Reader {
+
+/* Turns a stream of bytes from a file descriptor into Cmds. Each read() lands
+ * in Reader.Ring, a ring buffer indexed by the ever increasing Reader.Head and
+ * Reader.Tail counters, so a read may end anywhere, even partway through a
+ * command. Bytes are moved from the ring into Reader.Line until a whole line
+ * (or binary packet) has arrived, and only then is it parsed. Reader.Pos
+ * is the parsing position within a complete line, which allows the commands
+ * of a single line to be spread over several blocks when the per-block
+ * command budget runs out. Lines longer than DEFAULT_LINESIZE are discarded
+ * up to the next newline, as flagged by Reader.Overflow. */
+
+  int           Fd;
+  bool          Binary;
+  bool          Eof;
+  bool          Ready;
+  bool          Overflow;
+  size_t        Head;
+  size_t        Tail;
+  size_t        Length;
+  size_t        Pos;
+  char          Line[DEFAULT_LINESIZE];
+  char          Ring[DEFAULT_RING_SIZE];
+} Reader;
+
+void fillReader(Reader *);
+bool readCmd(Reader *, Cmd *);
+void makeReader(Reader *, const int, const bool);
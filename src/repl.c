@@ -3,234 +3,123 @@
 
 #include <err.h>
 #include <poll.h>
-#include <stdbool.h>
-#include <stdint.h>
-#include <stdio.h>
 #include <unistd.h>
 
 #include "repl.h"
 
-#include "amplitude.h"
 #include "audio-init.h"
 #include "audio-output.h"
-#include "constants/defaults.h"
 #include "constants/errors.h"
 #include "constants/funcs.h"
-#include "key.h"
+#include "constants/maximums.h"
+#include "dispatch.h"
+#include "import.h"
+#include "midi.h"
 #include "parse.h"
-#include "numerical.h"
-#include "voice.h"
-#include "wave.h"
+#include "reader.h"
+#include "server.h"
 
-static void dispatchCmd(Repl *);
-static void printParseErr(const Error, const char *);
-static void readLine(Repl *);
+static Error runCmds(Repl *, Reader *, unsigned int *);
+static Error runClients(Repl *, unsigned int *);
 
-static void
-dispatchCmd(Repl *r) {
+static Error
+runCmds(Repl *r, Reader *rd, unsigned int *budget) {
 
-/* Runs a command against the Audio struct. */
+/* Runs the commands waiting in a Reader until none are left, or until the
+ * per-block budget runs out. Commands left over stay buffered for the next
+ * block, so a burst of input can not stall audio playback. Returns
+ * ERROR_EXIT if a command on stdin asks the program to quit. The same command
+ * from a socket client, scheduled or not, only ends that client's session. */
 
-  Arg *arg = &r->Cmd.Arg;
-  Operators *carrier = &r->Audio->Voices.Carrier;
-  Operators *modulator = &r->Audio->Voices.Modulator;
-  Voices *voices = &r->Audio->Voices;
-
-  switch(r->Cmd.Func) {
-    case FUNC_NOTE_ON:
-      voiceOn(voices, (uint16_t)arg->I);
-      break;
-    case FUNC_NOTE_OFF:
-      voiceOff(voices, (uint16_t)arg->I);
-      break;
-    case FUNC_MOD_ATTACK:
-      setAttackLevel(&modulator->Env, arg->F);
-      break;
-    case FUNC_ATTACK:
-      setAttackLevel(&carrier->Env, arg->F);
-      break;
-    case FUNC_MOD_ATTACK_WAVE:
-      setAttackWave(&modulator->Env, arg->I);
-      break;
-    case FUNC_ATTACK_WAVE:
-      setAttackWave(&carrier->Env, arg->I);
-      break;
-    case FUNC_MOD_DECAY:
-      setDecayLevel(&modulator->Env, arg->F);
-      break;
-    case FUNC_DECAY:
-      setDecayLevel(&carrier->Env, arg->F);
-      break;
-    case FUNC_MOD_DECAY_WAVE:
-      setDecayWave(&modulator->Env, arg->I);
-      break;
-    case FUNC_DECAY_WAVE:
-      setDecayWave(&carrier->Env, arg->I);
-      break;
-    case FUNC_MOD_ENV_LOOP:
-      setLoop(&modulator->Env, (bool)arg->I);
-      break;
-    case FUNC_ENV_LOOP:
-      setLoop(&carrier->Env, (bool)arg->I);
-      break;
-    case FUNC_MOD_KEY_FOLLOW:
-      selectWave(&voices->Keyboard.Modulator.KeyFollowCurve, arg->I);
-      break;
-    case FUNC_KEY_FOLLOW:
-      selectWave(&voices->Keyboard.Carrier.KeyFollowCurve, arg->I);
-      break;
-    case FUNC_MOD_AMPLITUDE:
-      setModulation(voices, arg->F);
-      break;
-    case FUNC_AMPLITUDE:
-      setVolume(&r->Audio->Amplitude, arg->F);
-      break;
-    case FUNC_MOD_PITCH:
-      setPitchRatio(voices, false, arg->F);
-      break;
-    case FUNC_PITCH:
-      setPitchRatio(voices, true, arg->F);
-      break;
-    case FUNC_CHAN_BALANCE:
-      setBalance(&r->Audio->Amplitude, arg->F);
-      break;
-    case FUNC_QUIT:
-      r->Cmd.Error = ERROR_EXIT;
-      return;
-    case FUNC_MOD_RELEASE:
-      setReleaseLevel(&modulator->Env, arg->F);
-      break;
-    case FUNC_RELEASE:
-      setReleaseLevel(&carrier->Env, arg->F);
-      break;
-    case FUNC_MOD_RELEASE_WAVE:
-      setReleaseWave(&modulator->Env, arg->I);
-      break;
-    case FUNC_RELEASE_WAVE:
-      setReleaseWave(&carrier->Env, arg->I);
-      break;
-    case FUNC_MOD_SUSTAIN:
-      setSustainLevel(&modulator->Env, arg->F);
-      break;
-    case FUNC_SUSTAIN:
-      setSustainLevel(&carrier->Env, arg->F);
-      break;
-    case FUNC_MOD_ENV_DEPTH:
-      setDepth(&modulator->Env, arg->F);
-      break;
-    case FUNC_ENV_DEPTH:
-      setDepth(&carrier->Env, arg->F);
-      break;
-    case FUNC_MOD_TOUCH:
-      selectWave(&voices->Keyboard.Modulator.VelocityCurve, arg->I);
-      break;
-    case FUNC_TOUCH:
-      selectWave(&voices->Keyboard.Carrier.VelocityCurve, arg->I);
-      break;
-    case FUNC_TUNE_NOTE:
-      selectTuningKey(&voices->Keyboard, arg->I);
-      break;
-    case FUNC_TUNE:
-      tuneKey(&voices->Keyboard, arg->F);
-      break;
-    case FUNC_TUNE_TARGET:
-      selectTuningLayer(&voices->Keyboard, (TuningLayer)arg->I);
-      break;
-    case FUNC_MOD_WAVE:
-      selectWave(&modulator->Wave, arg->I);
-      break;
-    case FUNC_WAVE:
-      selectWave(&carrier->Wave, arg->I);
-      break;
-    case FUNC_MOD_WAVE_COMPLEXITY:
-      setWaveComplexity(voices, false, arg->I);
-      break;
-    case FUNC_WAVE_COMPLEXITY:
-      setWaveComplexity(voices, true, arg->I);
-      break;
-    case FUNC_MOD_FIXED:
-      setFixedRate(voices, false, arg->F);
-      break;
-    case FUNC_FIXED:
-      setFixedRate(voices, true, arg->F);
-      break;
-  }
-  r->Cmd.Error = ERROR_OK;
-}
-
-static void
-printParseErr(const Error err, const char *buffer) {
-  switch((unsigned int)err) {
-    case ERROR_NOTHING:
-      break;
-    case ERROR_INPUT:
-      warnx("Invalid input");
-      break;
-    case ERROR_FUNCTION:
-      warnx("Procedure not found: %c%c", buffer[0], buffer[1]);
-      break;
-    case ERROR_TYPE:
-      warnx("Incorrect argument type for %c", buffer[0]);
-      break;
+  while (*budget > 0 && readCmd(rd, &r->Cmd)) {
+    (*budget)--;
+    if (r->Cmd.Error != ERROR_OK) {
+      continue;
+    }
+    if (r->Cmd.Func == FUNC_QUIT && rd != &r->Input) {
+      quitClient(rd);
+      return ERROR_OK;
+    }
+    if (submitCmd(r->Audio, &r->Cmd) == ERROR_EXIT) {
+      return ERROR_EXIT;
+    }
   }
+  return ERROR_OK;
 }
 
-static void
-readLine(Repl *r) {
+static Error
+runClients(Repl *r, unsigned int *budget) {
 
-/* Reads a full line of user input, which can be a single command terminated
- * by a newline, or multiple commands delimited by semicolons, but also ending
- * in a newline. Dispatches a command immediately after it is parsed. Has to use
- * read() in order to leave audio playback unblocked. This is more troublesome
- * than fgets(). */  
+/* Runs the commands waiting from every socket client out of the shared
+ * budget. A different client goes first in each block. */
 
-  int bytesParsed = 0;
-  int totalBytesParsed = 0;
-  int bytesRead = 0;
-  char *line = NULL;
+  unsigned int i = 0;
+  Server *s = &r->Server;
+  Reader *rd = NULL;
 
-  bytesRead = read(STDIN_FILENO, r->Buffer, DEFAULT_LINESIZE);
-  if (bytesRead < 1 || r->Buffer[0] == '\n' || r->Buffer[0] == '#') {
-    r->Cmd.Error = ERROR_NOTHING;
-    return;
-  }
-  /* Since all input is newline buffered, should terminate string one char
-   * early to avoid persisting the \n. */
-  r->Buffer[--bytesRead] = '\0';
-  line = r->Buffer;
-  while (totalBytesParsed < bytesRead) {
-    bytesParsed = parseCmd(&r->Cmd, line);
-    totalBytesParsed += bytesParsed;
-    if (r->Cmd.Error != ERROR_OK) {
-      printParseErr(r->Cmd.Error, line);
-    } else {
-      if (r->Cmd.Error == ERROR_EXIT) {
-        return;
-      }
-      dispatchCmd(r);
+  for (; i < MAX_CLIENTS ; i++) {
+    rd = &s->Clients[(s->Next + i) % MAX_CLIENTS];
+    if (rd->Fd >= 0 && runCmds(r, rd, budget) == ERROR_EXIT) {
+      return ERROR_EXIT;
     }
-    line += bytesParsed;
   }
+  s->Next = (s->Next + 1) % MAX_CLIENTS;
+  return ERROR_OK;
 }
 
 void
 repl(Repl *r) {
 
 /* The main user-facing loop. Reads lines of user input, parses them, and sends
- * them to the Audio struct for processing. */
-
-  struct pollfd pfds[1] = {{0}};
-
+ * them to the Audio struct for processing. Commands from socket clients are
+ * handled the same way. At most -commands commands are run between blocks.
+ * MIDI input, if any, is read in the same loop and acts on the Audio struct
+ * directly. Waves imported in the background are installed before each
+ * block. */
+
+  unsigned int nfds = 1;
+  unsigned int nserver = 0;
+  unsigned int budget = 0;
+  struct pollfd pfds[2 + MAX_CLIENTS + MAX_MIDI_FDS] = {{0}};
+  const AudioSettings *aos = &r->Audio->Settings;
+
+  makeReader(&r->Input, STDIN_FILENO, aos->Binary);
+  makeMidi(&r->Midi, aos->Midi);
+  makeServer(&r->Server, aos->Socket, aos->Binary);
   pfds[0].fd = STDIN_FILENO;
   pfds[0].events = POLLIN;
   warnx("Welcome. You can exit at any time by pressing q + enter.");
-  while(poll(pfds, 1, 0) != -1) {
-    if (pfds[0].revents & POLLIN) {
-      readLine(r);
-      if (r->Cmd.Error == ERROR_EXIT) {
-        return;
+  for (;;) {
+    nserver = pollServer(&r->Server, pfds + 1);
+    /* sndio expects its descriptors to be refreshed before every poll. */
+    nfds = 1 + nserver + pollMidi(&r->Midi, pfds + 1 + nserver);
+    if (poll(pfds, nfds, 0) == -1) {
+      break;
+    }
+    if (nfds > 1 + nserver) {
+      readMidi(&r->Midi, r->Audio, pfds + 1 + nserver);
+    }
+    if (pfds[0].revents & (POLLIN | POLLHUP)) {
+      fillReader(&r->Input);
+      if (r->Input.Eof) {
+        /* poll() ignores negative descriptors. */
+        pfds[0].fd = -1;
       }
     }
-    play(r->Audio);
+    if (nserver > 0) {
+      readServer(&r->Server, pfds + 1);
+    }
+    budget = aos->Commands;
+    if (runCmds(r, &r->Input, &budget) == ERROR_EXIT ||
+        runClients(r, &budget) == ERROR_EXIT) {
+      break;
+    }
+    dropClients(&r->Server);
+    installImports();
+    if (play(r->Audio) == ERROR_EXIT) {
+      break;
+    }
   }
+  killServer(&r->Server);
+  killMidi(&r->Midi);
 }
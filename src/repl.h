@@ -1,20 +1,24 @@
 #pragma once
 
-#include <stdint.h>
-
 #include "audio-init.h"
-#include "constants/defaults.h"
+#include "midi.h"
 #include "parse.h"
+#include "reader.h"
+#include "server.h"
 
 typedef struct Repl {
 
 /* A struct containing everything needed for a user-facing loop. During every
- * cycle of the REPL, user input is read with read() into Repl.Buffer. This
- * string is then parsed, and used to populate the fields of Repl.Cmd. An audio
- * function is then performed using Repl.Cmd as its argument. */
+ * cycle of the REPL, user input is read from stdin into Repl.Input. Complete
+ * commands are then parsed, and used to populate the fields of Repl.Cmd. An
+ * audio function is then performed using Repl.Cmd as its argument. Repl.Midi
+ * is polled alongside stdin when the -midi flag is given, as is Repl.Server
+ * when the -socket flag is. */
 
   Cmd           Cmd;
-  char          Buffer[DEFAULT_LINESIZE];
+  Reader        Input;
+  Midi          Midi;
+  Server        Server;
   Audio       * Audio;
 } Repl;
 
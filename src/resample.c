@@ -0,0 +1,184 @@
+/* A polyphase windowed-sinc resampler, which lets boar synthesize at a fixed
+ * internal rate regardless of the rate the sound device settles on. Consult
+ * "resample.h" for more info. */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "resample.h"
+
+#include "buffers.h"
+#include "constants/defaults.h"
+
+static float kernel(const double, const double);
+static void makeFilter(Resampler *, const double);
+static void fillWork(Resampler *, float *);
+static float convolve(const float *, const float *, const float *,
+    const float);
+
+static float
+kernel(const double d, const double cutoff) {
+
+/* Returns the windowed-sinc coefficient for a sample "d" input samples away
+ * from the output position. "cutoff" is the passband as a fraction of the
+ * input Nyquist frequency. A Blackman window keeps stopband leakage low with
+ * only DEFAULT_RESAMPLE_TAPS taps. */
+
+  const double half = DEFAULT_RESAMPLE_TAPS / 2.0;
+  const double x = M_PI * cutoff * d;
+  double w = 0.0;
+
+  if (fabs(d) >= half) {
+    return 0.0f;
+  }
+  w = 0.42 + (0.5 * cos(M_PI * d / half)) + (0.08 * cos(2.0 * M_PI * d / half));
+  if (x == 0.0) {
+    return (float)(cutoff * w);
+  }
+  return (float)(cutoff * (sin(x) / x) * w);
+}
+
+static void
+makeFilter(Resampler *r, const double cutoff) {
+
+/* Tabulates the kernel for every phase, normalizing each one to unity gain so
+ * that the interpolation between phases does not ripple. */
+
+  size_t p = 0;
+  size_t k = 0;
+  double sum = 0.0;
+  double frac = 0.0;
+  float *row = NULL;
+
+  for (; p <= DEFAULT_RESAMPLE_PHASES ; p++) {
+    row = r->Filter + (p * DEFAULT_RESAMPLE_TAPS);
+    frac = (double)p / DEFAULT_RESAMPLE_PHASES;
+    sum = 0.0;
+    for (k = 0 ; k < DEFAULT_RESAMPLE_TAPS ; k++) {
+      row[k] = kernel((double)k - ((DEFAULT_RESAMPLE_TAPS / 2) - 1) - frac,
+          cutoff);
+      sum += row[k];
+    }
+    for (k = 0 ; k < DEFAULT_RESAMPLE_TAPS ; k++) {
+      row[k] = (float)(row[k] / sum);
+    }
+  }
+}
+
+static void
+fillWork(Resampler *r, float *buses) {
+
+/* Appends a block of every channel to Resampler.Work, after the history kept
+ * from the last block. A channel is the sum of the shared bus and its own
+ * bus. The buses are zeroed as they are read, just as they would be by the
+ * final conversion when no resampling takes place. */
+
+  size_t c = 0;
+  size_t n = 0;
+  float *all = buses;
+  float *bus = NULL;
+  float *work = NULL;
+
+  for (; c < r->Channels ; c++) {
+    bus = buses + ((c + 1) * r->Frames);
+    work = r->Work + (c * r->Stride) + DEFAULT_RESAMPLE_TAPS;
+    for (n = 0 ; n < r->Frames ; n++) {
+      work[n] = all[n] + bus[n];
+      bus[n] = 0.0f;
+    }
+  }
+  memset(all, 0, sizeof(*all) * r->Frames);
+}
+
+static float
+convolve(const float *x, const float *h0, const float *h1, const float a) {
+
+/* Applies the kernels of the two phases surrounding an output position to
+ * the same input samples and interpolates between the results. Both sums run
+ * over a fixed number of contiguous taps, so the compiler is free to unroll
+ * and vectorize them. */
+
+  size_t k = 0;
+  float s0 = 0.0f;
+  float s1 = 0.0f;
+
+  for (; k < DEFAULT_RESAMPLE_TAPS ; k++) {
+    s0 += x[k] * h0[k];
+    s1 += x[k] * h1[k];
+  }
+  return s0 + (a * (s1 - s0));
+}
+
+void
+resample(Resampler *r, float *buses, const size_t frames) {
+
+/* Resamples one block of the planar mixing buses into Resampler.Out. The
+ * number of output frames varies from block to block, and is left in
+ * Resampler.OutFrames. Afterwards, the tail of each channel is moved to the
+ * front of Resampler.Work to serve as history for the next block. */
+
+  size_t c = 0;
+  size_t n = 0;
+  size_t i = 0;
+  size_t p = 0;
+  double pos = 0.0;
+  double phase = 0.0;
+  float *work = NULL;
+  const size_t end = DEFAULT_RESAMPLE_TAPS + frames - 
+    (DEFAULT_RESAMPLE_TAPS / 2);
+
+  fillWork(r, buses);
+  for (; c < r->Channels ; c++) {
+    work = r->Work + (c * r->Stride);
+    pos = r->Position;
+    for (n = 0 ; (size_t)pos < end && n < r->OutStride ; n++) {
+      i = (size_t)pos;
+      phase = (pos - (double)i) * DEFAULT_RESAMPLE_PHASES;
+      p = (size_t)phase;
+      r->Out[(c * r->OutStride) + n] = convolve(
+          work + i - ((DEFAULT_RESAMPLE_TAPS / 2) - 1),
+          r->Filter + (p * DEFAULT_RESAMPLE_TAPS),
+          r->Filter + ((p + 1) * DEFAULT_RESAMPLE_TAPS),
+          (float)(phase - (double)p));
+      pos += r->Step;
+    }
+    memmove(work, work + frames, sizeof(*work) * DEFAULT_RESAMPLE_TAPS);
+  }
+  r->OutFrames = n;
+  r->Position = pos - (double)frames;
+}
+
+void
+makeResampler(Resampler *r, const unsigned int in, const unsigned int out,
+    const size_t chans, const size_t frames) {
+
+/* Initializes a Resampler from rate "in" to rate "out" for "chans" channels
+ * of "frames" frames each. When downsampling, the passband is narrowed to the
+ * output Nyquist frequency to prevent aliasing. */
+
+  const double ratio = (double)out / (double)in;
+
+  r->Channels = chans;
+  r->Frames = frames;
+  r->Stride = DEFAULT_RESAMPLE_TAPS + frames;
+  r->OutStride = (size_t)ceil((double)frames * ratio) + 2;
+  r->OutFrames = 0;
+  r->Step = (double)in / (double)out;
+  r->Position = DEFAULT_RESAMPLE_TAPS / 2;
+  r->Filter = makeSamples((DEFAULT_RESAMPLE_PHASES + 1) *
+      DEFAULT_RESAMPLE_TAPS);
+  r->Work = makeSamples(chans * r->Stride);
+  r->Out = makeSamples(chans * r->OutStride);
+  makeFilter(r, ratio < 1.0 ? ratio : 1.0);
+}
+
+void
+killResampler(Resampler *r) {
+
+/* Frees all memory allocated by a Resampler. */
+
+  free(r->Filter);
+  free(r->Work);
+  free(r->Out);
+}
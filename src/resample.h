@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef struct Resampler {
+
+/* Converts planar audio from the internal render rate to the device rate.
+ * Resampler.Filter is a bank of DEFAULT_RESAMPLE_PHASES + 1 windowed-sinc
+ * kernels of DEFAULT_RESAMPLE_TAPS coefficients each, one for every
+ * fractional position between two input samples. The kernel for an output
+ * sample is interpolated from the two nearest phases. Resampler.Work holds,
+ * for every channel, the last DEFAULT_RESAMPLE_TAPS input samples of the
+ * previous block followed by the current block. Resampler.Position is the
+ * read position within Work, in input samples, and advances by
+ * Resampler.Step for every output sample. Resampler.Out holds the planar
+ * output of one block, and Resampler.OutFrames says how many frames of it
+ * are valid. */
+
+  size_t          Channels;
+  size_t          Frames;
+  size_t          Stride;
+  size_t          OutStride;
+  size_t          OutFrames;
+  double          Step;
+  double          Position;
+  float         * Filter;
+  float         * Work;
+  float         * Out;
+} Resampler;
+
+void resample(Resampler *, float *, const size_t);
+void makeResampler(Resampler *, const unsigned int, const unsigned int,
+    const size_t, const size_t);
+void killResampler(Resampler *);
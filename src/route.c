@@ -0,0 +1,160 @@
+/* Functions that route Voices to output channels. Consult "route.h" for more
+ * info. */
+
+#include <err.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "route.h"
+
+#include "buffers.h"
+#include "constants/maximums.h"
+#include "numerical.h"
+
+float *
+routeBuffer(const Router *rt, const Route *r) {
+
+/* Returns the buffer a Voice should sum its carrier into for this block. */
+
+  switch ((unsigned int)r->Mode) {
+    case ROUTE_SOLO:
+      return rt->Buses + ((r->Channel + 1) * rt->Frames);
+    case ROUTE_MATRIX:
+      return rt->Scratch;
+    default:
+      return rt->Buses;
+  }
+}
+
+void
+mixRoute(const Router *rt, const Route *r, const size_t offset,
+    const size_t frames) {
+
+/* Distributes "frames" samples of Router.Scratch, starting "offset" samples
+ * into the block, into the channel buses of a ROUTE_MATRIX Voice, then zeroes
+ * them for the next Voice. Other modes render in place, so there is nothing to
+ * do for them. */
+
+  size_t c = 0;
+  size_t n = 0;
+  float g = 0.0f;
+  float *bus = NULL;
+
+  if (r->Mode != ROUTE_MATRIX) {
+    return;
+  }
+  for (; c < rt->Channels ; c++) {
+    g = r->Gains[c];
+    if (g == 0.0f) {
+      continue;
+    }
+    bus = rt->Buses + ((c + 1) * rt->Frames);
+    for (n = offset ; n < offset + frames ; n++) {
+      bus[n] += rt->Scratch[n] * g;
+    }
+  }
+  memset(rt->Scratch + offset, 0, sizeof(*rt->Scratch) * frames);
+}
+
+void
+soloRoute(Router *rt, Route *r, const int chan) {
+
+/* Sends a Voice to channel "chan" only, and selects that channel for
+ * subsequent gain changes. A negative channel restores the default of
+ * sending the Voice to every channel. */
+
+  if (chan < 0) {
+    makeRoute(r);
+    return;
+  }
+  if ((size_t)chan >= rt->Channels) {
+    warnx("Channel must be between 0 and %zu", rt->Channels - 1);
+    return;
+  }
+  memset(r->Gains, 0, sizeof(r->Gains));
+  r->Gains[chan] = 1.0f;
+  r->Channel = chan;
+  r->Mode = ROUTE_SOLO;
+  rt->Channel = chan;
+}
+
+void
+selectRouteChannel(Router *rt, const unsigned int chan) {
+
+/* Selects the channel that setRouteGain() acts upon, without changing the
+ * routing of any Voice. */
+
+  if (chan >= rt->Channels) {
+    warnx("Channel must be between 0 and %zu", rt->Channels - 1);
+    return;
+  }
+  rt->Channel = chan;
+}
+
+void
+setRouteGain(const Router *rt, Route *r, const float g) {
+
+/* Sets the gain of a Voice on the channel selected with soloRoute() or
+ * selectRouteChannel(), up to full gain. Any Voice with a gain changed this
+ * way becomes a ROUTE_MATRIX Voice, keeping whatever channels it was already
+ * sent to. */
+
+  size_t c = 0;
+
+  if (r->Mode == ROUTE_ALL) {
+    for (; c < rt->Channels ; c++) {
+      r->Gains[c] = 1.0f;
+    }
+  }
+  r->Gains[rt->Channel] = truncateFloat(g, 1.0f);
+  r->Mode = ROUTE_MATRIX;
+}
+
+void
+panRoute(const Router *rt, Route *r, const float pan) {
+
+/* Places a Voice between the first two channels, where 0.0 is fully left,
+ * 0.5 is centered at full gain on both, and 1.0 is fully right. This follows
+ * the balance command. Other channels do not receive the Voice. */
+
+  const float p = truncateFloat(pan, 1.0f);
+
+  if (rt->Channels < 2) {
+    return;
+  }
+  memset(r->Gains, 0, sizeof(r->Gains));
+  r->Gains[0] = truncateFloat(1.0f - (2.0f * (p - 0.5f)), 1.0f);
+  r->Gains[1] = truncateFloat(1.0f - (2.0f * (0.5f - p)), 1.0f);
+  r->Mode = ROUTE_MATRIX;
+}
+
+void
+makeRoute(Route *r) {
+
+/* Initializes a Route that sends a Voice to every channel. */
+
+  r->Mode = ROUTE_ALL;
+  r->Channel = 0;
+  memset(r->Gains, 0, sizeof(r->Gains));
+}
+
+void
+makeRouter(Router *rt, float *buses, const size_t chans, const size_t frames) {
+
+/* Initializes a Router over the planar buses of the main mixing buffer. */
+
+  rt->Channels = chans;
+  rt->Frames = frames;
+  rt->Buses = buses;
+  rt->Scratch = makeSamples(frames);
+  rt->Note = 0;
+  rt->Channel = 0;
+}
+
+void
+killRouter(Router *rt) {
+
+/* Frees the Router's scratch buffer. The buses belong to Audio.Buffer. */
+
+  free(rt->Scratch);
+}
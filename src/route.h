@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "constants/maximums.h"
+
+typedef enum RouteMode {
+
+/* How a Voice reaches the output channels. ROUTE_ALL is the default, and
+ * sends the Voice to every channel at once. ROUTE_SOLO sends it to a single
+ * channel at full gain. ROUTE_MATRIX sends it to any number of channels at
+ * individual gains. */
+
+  ROUTE_ALL = 0,
+  ROUTE_SOLO,
+  ROUTE_MATRIX
+} RouteMode;
+
+typedef struct Route {
+
+/* The routing of a single note. Route.Channel is only meaningful for
+ * ROUTE_SOLO, and Route.Gains only for ROUTE_MATRIX. */
+
+  RouteMode     Mode;
+  unsigned int  Channel;
+  float         Gains[MAX_CHANNELS];
+} Route;
+
+typedef struct Router {
+
+/* Owns the planar mixing buses that Voices are rendered into. Router.Buses
+ * holds Router.Channels + 1 buses of Router.Frames samples each. The first
+ * bus is shared by every channel, and the rest belong to one channel each, so
+ * a channel's final signal is the sum of the shared bus and its own bus. This
+ * lets Voices routed to every channel, or to a single channel, render
+ * straight into a bus. Only ROUTE_MATRIX Voices are rendered into
+ * Router.Scratch first and then distributed. Router.Note and Router.Channel
+ * are the targets of the e/e./E/E. commands. */
+
+  size_t          Channels;
+  size_t          Frames;
+  float         * Buses;
+  float         * Scratch;
+  unsigned int    Note;
+  unsigned int    Channel;
+} Router;
+
+float * routeBuffer(const Router *, const Route *);
+void mixRoute(const Router *, const Route *, const size_t, const size_t);
+void soloRoute(Router *, Route *, const int);
+void selectRouteChannel(Router *, const unsigned int);
+void setRouteGain(const Router *, Route *, const float);
+void panRoute(const Router *, Route *, const float);
+void makeRoute(Route *);
+void makeRouter(Router *, float *, const size_t, const size_t);
+void killRouter(Router *);
@@ -0,0 +1,254 @@
+/* Functions for the Sequencer type, a step sequencer that runs on the render
+ * clock. Consult "sequencer.h" for more info. */
+
+#include <err.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "sequencer.h"
+
+#include "constants/defaults.h"
+#include "constants/errors.h"
+#include "constants/maximums.h"
+#include "events.h"
+#include "parse.h"
+
+static uint64_t stepFrame(const Sequencer *, const double);
+static void retime(Sequencer *, const uint64_t);
+static bool fitsStep(const Sequencer *, const float, const unsigned int);
+
+static uint64_t
+stepFrame(const Sequencer *s, const double step) {
+
+/* Returns the frame of the render clock that a step falls on. */
+
+  return s->Anchor + (uint64_t)llround((step - s->AnchorStep) *
+      s->FramesPerStep);
+}
+
+static void
+retime(Sequencer *s, const uint64_t frame) {
+
+/* Moves the anchor to "frame" and applies the current tempo from there on.
+ * Steps already played keep their timing. */
+
+  s->AnchorStep += (double)(frame - s->Anchor) / s->FramesPerStep;
+  s->Anchor = frame;
+  s->FramesPerStep = ((double)s->Rate * 60.0) /
+    ((double)s->Tempo * (double)s->StepsPerBeat);
+  s->Retime = false;
+}
+
+static bool
+fitsStep(const Sequencer *s, const float bpm, const unsigned int steps) {
+
+/* Returns whether a step at "bpm" beats per minute and "steps" steps a beat
+ * lasts at least one frame, warning if it does not. Shorter steps would pile
+ * more of them into every block than the Event queue holds. */
+
+  if (((double)s->Rate * 60.0) / ((double)bpm * (double)steps) < 1.0) {
+    warnx("Steps this short would fall less than a frame apart");
+    return false;
+  }
+  return true;
+}
+
+void
+recordPattern(Sequencer *s, const unsigned int n) {
+
+/* Clears Pattern n and starts recording commands with a + prefix into it. */
+
+  if (n >= MAX_PATTERNS) {
+    warnx("Pattern must be between 0 and %d", MAX_PATTERNS - 1);
+    return;
+  }
+  if ((int)n == s->Playing || (int)n == s->Next) {
+    warnx("Pattern %u is playing", n);
+    return;
+  }
+  s->All[n].N = 0;
+  s->All[n].Length = 0;
+  s->Recording = (int)n;
+}
+
+void
+finishPattern(Sequencer *s, const unsigned int length) {
+
+/* Stops recording, and sets the loop length of the recorded Pattern in
+ * steps. */
+
+  if (s->Recording < 0) {
+    warnx("No pattern is being recorded");
+    return;
+  }
+  if (length == 0) {
+    warnx("Pattern length must be at least 1 step");
+    return;
+  }
+  s->All[s->Recording].Length = length;
+  s->Recording = -1;
+}
+
+void
+addStep(Sequencer *s, const Cmd *c) {
+
+/* Stores a command in the Pattern being recorded. Cmd.Frame is read as a
+ * step number rather than a frame. */
+
+  size_t i = 0;
+  Pattern *p = NULL;
+
+  if (c->Time != CMD_TIME_RELATIVE) {
+    warnx("Use +step to place commands in a pattern");
+    return;
+  }
+  if (c->Frame > UINT32_MAX) {
+    warnx("Step out of range");
+    return;
+  }
+  p = &s->All[s->Recording];
+  if (p->N == MAX_PATTERN_STEPS) {
+    warnx("Pattern is full");
+    return;
+  }
+  for (i = p->N ; i > 0 && p->Steps[i - 1].Step > c->Frame ; i--) {
+    p->Steps[i] = p->Steps[i - 1];
+  }
+  p->Steps[i].Step = (uint32_t)c->Frame;
+  p->Steps[i].Cmd = *c;
+  p->Steps[i].Cmd.Time = CMD_TIME_NOW;
+  p->N++;
+}
+
+void
+playPattern(Sequencer *s, const int n) {
+
+/* Plays Pattern n in a loop. If another Pattern is playing, n takes over when
+ * its current loop ends. A negative n stops playback at the next block. */
+
+  if (n < 0) {
+    s->Playing = -1;
+    s->Next = -1;
+    return;
+  }
+  if (n >= MAX_PATTERNS || s->All[n].Length == 0) {
+    warnx("Pattern %d has not been recorded", n);
+    return;
+  }
+  if (s->Playing < 0) {
+    s->Playing = n;
+    s->Restart = true;
+  }
+  s->Next = n;
+}
+
+void
+setTempo(Sequencer *s, const float bpm) {
+
+/* Sets the tempo in beats per minute, up to MAX_TEMPO. It takes effect at
+ * the next block. */
+
+  if (bpm <= 0.0f || bpm > MAX_TEMPO) {
+    warnx("Tempo must be above 0 and at most %.0f", MAX_TEMPO);
+    return;
+  }
+  if (!fitsStep(s, bpm, s->StepsPerBeat)) {
+    return;
+  }
+  s->Tempo = bpm;
+  s->Retime = true;
+}
+
+void
+setStepsPerBeat(Sequencer *s, const unsigned int n) {
+
+/* Sets the number of steps in a beat, up to MAX_STEPS_PER_BEAT. It takes
+ * effect at the next block. */
+
+  if (n == 0 || n > MAX_STEPS_PER_BEAT) {
+    warnx("A beat needs between 1 and %d steps", MAX_STEPS_PER_BEAT);
+    return;
+  }
+  if (!fitsStep(s, s->Tempo, n)) {
+    return;
+  }
+  s->StepsPerBeat = n;
+  s->Retime = true;
+}
+
+void
+runSequencer(Sequencer *s, Events *es, const uint64_t start,
+    const size_t frames) {
+
+/* Queues every step of the playing Pattern that falls within the block of
+ * "frames" frames beginning at "start". Tempo changes and new Patterns take
+ * effect from the start of the block. */
+
+  const uint64_t end = start + frames;
+  uint64_t frame = 0;
+  Pattern *p = NULL;
+
+  if (s->Retime) {
+    retime(s, start);
+  }
+  if (s->Restart) {
+    retime(s, start);
+    s->AnchorStep = 0.0;
+    s->LoopStart = 0.0;
+    s->Cursor = 0;
+    s->Restart = false;
+  }
+  while (s->Playing >= 0) {
+    p = &s->All[s->Playing];
+    for (; s->Cursor < p->N && p->Steps[s->Cursor].Step < p->Length ;
+        s->Cursor++) {
+      frame = stepFrame(s, s->LoopStart + p->Steps[s->Cursor].Step);
+      if (frame >= end) {
+        return;
+      }
+      if (!pushEvent(es, frame, &p->Steps[s->Cursor].Cmd)) {
+        warnx("Event queue is full");
+      }
+    }
+    if (stepFrame(s, s->LoopStart + p->Length) >= end) {
+      return;
+    }
+    s->LoopStart += p->Length;
+    s->Cursor = 0;
+    s->Playing = s->Next;
+  }
+}
+
+void
+makeSequencer(Sequencer *s, const unsigned int rate) {
+
+/* Initializes a stopped Sequencer at the default tempo. Errors are fatal. */
+
+  s->Recording = -1;
+  s->Playing = -1;
+  s->Next = -1;
+  s->Restart = false;
+  s->Tempo = DEFAULT_TEMPO;
+  s->StepsPerBeat = DEFAULT_STEPS_PER_BEAT;
+  s->Rate = rate;
+  s->Anchor = 0;
+  s->AnchorStep = 0.0;
+  s->FramesPerStep = 1.0;
+  retime(s, 0);
+  s->LoopStart = 0.0;
+  s->Cursor = 0;
+  s->All = calloc(MAX_PATTERNS, sizeof(*s->All));
+  if (s->All == NULL) {
+    errx(ERROR_ALLOC, "Error allocating patterns");
+  }
+}
+
+void
+killSequencer(Sequencer *s) {
+
+/* Frees the Patterns. */
+
+  free(s->All);
+}
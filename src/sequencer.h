@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "constants/maximums.h"
+#include "events.h"
+#include "parse.h"
+
+typedef struct Step {
+
+/* A command that a Pattern runs at a given step. */
+
+  uint32_t      Step;
+  Cmd           Cmd;
+} Step;
+
+typedef struct Pattern {
+
+/* A loop of Pattern.Length steps. Pattern.Steps is kept sorted by step, in
+ * the order the commands were recorded. */
+
+  size_t        N;
+  uint32_t      Length;
+  Step          Steps[MAX_PATTERN_STEPS];
+} Pattern;
+
+typedef struct Sequencer {
+
+/* Plays Patterns on the render clock by feeding their commands into
+ * Audio.Events a block at a time. Sequencer.Anchor is a frame of the render
+ * clock, and Sequencer.AnchorStep is the number of steps played by that frame.
+ * Every step is found relative to this pair, so that timing never drifts, and
+ * a change of tempo only has to move the anchor. Sequencer.LoopStart is the
+ * step the current pass through the Pattern began on, and Sequencer.Cursor is
+ * the next of its Steps to be queued. Sequencer.Next is the Pattern that takes
+ * over when the current loop ends. Sequencer.Recording is the Pattern that
+ * commands with a + prefix are stored in, or -1. */
+
+  int           Recording;
+  int           Playing;
+  int           Next;
+  bool          Restart;
+  bool          Retime;
+  float         Tempo;
+  unsigned int  StepsPerBeat;
+  unsigned int  Rate;
+  double        FramesPerStep;
+  uint64_t      Anchor;
+  double        AnchorStep;
+  double        LoopStart;
+  size_t        Cursor;
+  Pattern     * All;
+} Sequencer;
+
+void recordPattern(Sequencer *, const unsigned int);
+void finishPattern(Sequencer *, const unsigned int);
+void addStep(Sequencer *, const Cmd *);
+void playPattern(Sequencer *, const int);
+void setTempo(Sequencer *, const float);
+void setStepsPerBeat(Sequencer *, const unsigned int);
+void runSequencer(Sequencer *, Events *, const uint64_t, const size_t);
+void makeSequencer(Sequencer *, const unsigned int);
+void killSequencer(Sequencer *);
@@ -0,0 +1,189 @@
+/* Functions for the Server type, which accepts commands over a UNIX domain
+ * socket. poll() is used rather than epoll or kqueue, since it is available
+ * everywhere sndio is, and the number of clients is small. Consult "server.h"
+ * for more info. */
+
+#include <err.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "server.h"
+
+#include "constants/errors.h"
+#include "constants/maximums.h"
+#include "reader.h"
+
+static void acceptClient(Server *);
+static void closeClient(Reader *);
+
+static void
+acceptClient(Server *s) {
+
+/* Accepts a pending connection into the first free client slot. Connections
+ * beyond MAX_CLIENTS are refused. */
+
+  unsigned int i = 0;
+  int fd = accept(s->Listener, NULL, NULL);
+
+  if (fd < 0) {
+    return;
+  }
+  for (; i < MAX_CLIENTS ; i++) {
+    if (s->Clients[i].Fd < 0) {
+      fcntl(fd, F_SETFL, O_NONBLOCK);
+      makeReader(&s->Clients[i], fd, s->Binary);
+      return;
+    }
+  }
+  warnx("Refused client: already serving %d", MAX_CLIENTS);
+  close(fd);
+}
+
+static void
+closeClient(Reader *r) {
+
+/* Closes a client's connection and frees its slot. */
+
+  close(r->Fd);
+  r->Fd = -1;
+}
+
+unsigned int
+pollServer(Server *s, struct pollfd *pfds) {
+
+/* Fills pfds with the listening socket followed by one entry per client
+ * slot, and returns how many entries there are. Empty slots, and clients that
+ * have hung up, are given a descriptor of -1, which poll() ignores. Returns 0
+ * if there is no server. */
+
+  unsigned int i = 0;
+
+  if (s->Listener < 0) {
+    return 0;
+  }
+  pfds[0].fd = s->Listener;
+  pfds[0].events = POLLIN;
+  for (; i < MAX_CLIENTS ; i++) {
+    pfds[i + 1].fd = s->Clients[i].Eof ? -1 : s->Clients[i].Fd;
+    pfds[i + 1].events = POLLIN;
+  }
+  return MAX_CLIENTS + 1;
+}
+
+void
+readServer(Server *s, const struct pollfd *pfds) {
+
+/* Reads from every client that poll() found ready, and accepts any new
+ * connection. The commands are run later, once per block. */
+
+  unsigned int i = 0;
+
+  for (; i < MAX_CLIENTS ; i++) {
+    if (pfds[i + 1].fd >= 0 && (pfds[i + 1].revents & (POLLIN | POLLHUP))) {
+      fillReader(&s->Clients[i]);
+    }
+  }
+  if (pfds[0].revents & POLLIN) {
+    acceptClient(s);
+  }
+}
+
+void
+quitClient(Reader *r) {
+
+/* Ends a client's session in place of the quit command, which only stdin may
+ * use to stop boar. Anything else it sent is discarded, and its connection is
+ * closed by dropClients(). */
+
+  r->Eof = true;
+  r->Ready = false;
+  r->Tail = r->Head;
+}
+
+void
+dropClients(Server *s) {
+
+/* Closes clients that have hung up once every complete command they sent
+ * has been run. Any partial line they left behind is discarded. */
+
+  unsigned int i = 0;
+  Reader *r = NULL;
+
+  for (; i < MAX_CLIENTS ; i++) {
+    r = &s->Clients[i];
+    if (r->Fd >= 0 && r->Eof && !r->Ready && r->Tail == r->Head) {
+      closeClient(r);
+    }
+  }
+}
+
+void
+makeServer(Server *s, const char *path, const bool binary) {
+
+/* Listens for clients on a UNIX domain socket at "path", if one was given.
+ * A socket left behind by a previous run is replaced, but any other kind of
+ * file is left alone. Errors are fatal. */
+
+  unsigned int i = 0;
+  struct sockaddr_un addr = {0};
+  struct stat st = {0};
+
+  s->Listener = -1;
+  s->Path = path;
+  s->Next = 0;
+  s->Binary = binary;
+  for (; i < MAX_CLIENTS ; i++) {
+    s->Clients[i].Fd = -1;
+    s->Clients[i].Eof = false;
+  }
+  if (path == NULL) {
+    return;
+  }
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    errx(ERROR_ARG, "Socket path too long: %s", path);
+  }
+  if (lstat(path, &st) == 0) {
+    if (!S_ISSOCK(st.st_mode)) {
+      errx(ERROR_ARG, "%s exists and is not a socket", path);
+    }
+    unlink(path);
+  }
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+  s->Listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (s->Listener < 0) {
+    err(ERROR_ARG, "Error creating socket");
+  }
+  if (bind(s->Listener, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+      listen(s->Listener, MAX_CLIENTS) < 0) {
+    err(ERROR_ARG, "Error listening on %s", path);
+  }
+  fcntl(s->Listener, F_SETFL, O_NONBLOCK);
+}
+
+void
+killServer(Server *s) {
+
+/* Closes every client and the listening socket, and removes the socket
+ * file. */
+
+  unsigned int i = 0;
+
+  if (s->Listener < 0) {
+    return;
+  }
+  for (; i < MAX_CLIENTS ; i++) {
+    if (s->Clients[i].Fd >= 0) {
+      closeClient(&s->Clients[i]);
+    }
+  }
+  close(s->Listener);
+  unlink(s->Path);
+  s->Listener = -1;
+}
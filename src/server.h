@@ -0,0 +1,30 @@
+#pragma once
+
+#include <poll.h>
+#include <stdbool.h>
+
+#include "constants/maximums.h"
+#include "reader.h"
+
+typedef struct Server {
+
+/* A UNIX domain socket that several programs can send commands to at once.
+ * Every connected client gets its own Reader in Server.Clients, so partial
+ * lines from one client never mix with those of another. Unused slots have a
+ * Reader.Fd of -1. Server.Next rotates the client served first in each block,
+ * so that one busy client can not starve the others of the command budget.
+ * A client that sends q only closes its own connection. */
+
+  int             Listener;
+  const char    * Path;
+  unsigned int    Next;
+  bool            Binary;
+  Reader          Clients[MAX_CLIENTS];
+} Server;
+
+unsigned int pollServer(Server *, struct pollfd *);
+void readServer(Server *, const struct pollfd *);
+void quitClient(Reader *);
+void dropClients(Server *);
+void makeServer(Server *, const char *, const bool);
+void killServer(Server *);
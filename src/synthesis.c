@@ -1,22 +1,61 @@
 /* These functions contain the actual mathematics that create sound. */
 
+#include <err.h>
 #include <limits.h>
 #include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "synthesis.h"
 
+#include "buffers.h"
 #include "constants/defaults.h"
+#include "constants/maximums.h"
 #include "envelope.h"
 #include "noise.h"
 #include "numerical.h"
 #include "wave.h"
+#include "wavetable.h"
+
+typedef struct Frames {
+
+/* The tables an Osc reads during one block, looked up at its start. Without a
+ * morph, Frames.To is NULL. With one, each sample is blended from Frames.From
+ * towards Frames.To by Frames.Mix, which moves by Frames.Step every sample.
+ * Frames.CompactFrom and Frames.CompactTo take their place in -compact
+ * mode. Frames.Quality is how the Osc interpolates them. */
+
+  const float   * From;
+  const float   * To;
+  const int16_t * CompactFrom;
+  const int16_t * CompactTo;
+  float           Mix;
+  float           Step;
+  Quality         Quality;
+} Frames;
+
+static float POLYPHASE[DEFAULT_POLYPHASE_PHASES + 1][4];
 
 static float hzToPitch(const float, const unsigned int);
 static float pitch(const unsigned int, const unsigned int);
 static int wavetableIndex(const int, const float);
-static void fillModulatorBuffer(Operator *);
-static float modulate(Osc *, Osc *, const unsigned int);
+static float wrapPhase(const float);
+static double clockPhase(const Osc *, const size_t);
+static void lockPhase(Osc *);
+static bool readsTable(const Osc *);
+static float morphTarget(const Osc *, const Env *);
+static void resolveFrames(Frames *, Osc *, const Env *, const size_t);
+static float readTable(const float *, const float, const Quality);
+static float readCompact(const int16_t *, const float, const Quality);
+static float readWave(const Frames *, const float);
+static void takeShareKey(ShareKey *, const Frames *, const Osc *);
+static bool sameShare(const ShareKey *, const ShareKey *);
+static int findShare(Shares *, const ShareKey *);
+static float * claimShare(Shares *, const ShareKey *);
+static void fillModulatorBuffer(Operator *, const size_t, const size_t);
+static float modulate(Osc *, Osc *, const Frames *, const unsigned int);
 
 static float
 hzToPitch(const float hz, const unsigned int rate) {
@@ -41,92 +80,523 @@ pitch(const unsigned int note, const unsigned int rate) {
 void
 setPitch(Operator *o, const unsigned int note, const unsigned int rate) {
 
-/* Sets the pitch of an Osc derived from a note, or its fixed frequency. */
+/* Sets the target pitch of an Osc derived from a note, or its fixed
+ * frequency. */
 
   if (*o->FixedRate) {
-    o->Osc.Pitch = hzToPitch(*o->FixedRate, rate);
+    o->Osc.Target = hzToPitch(*o->FixedRate, rate);
     return;
   }
-  o->Osc.Pitch = *o->Ratio * pitch(note, rate);
+  o->Osc.Target = *o->Ratio * pitch(note, rate);
 }
 
 static int
 wavetableIndex(const int complexity, const float pitch) {
 
 /* Return the index of proper wavetable to sample, based upon pitch and offset
- * from Osc.Complexity. This avoids reflected harmonics, unless the user is 
+ * from Osc.Complexity, which counts in octaves. This is the brightest level
+ * whose highest harmonic stays below 2 / DEFAULT_OCTAVE_SCALING of the
+ * sample rate, which avoids reflected harmonics, unless the user is
  * specifically trying to create them. */
 
-  int tn = complexity + 1 + (int)ilogb(DEFAULT_OCTAVE_SCALING * pitch);
+  const float p = fabsf(pitch) * DEFAULT_OCTAVE_SCALING;
+  int tn = 0;
+
+  if (p <= 0.0f) {
+    return 0;
+  }
+  tn = (int)ceilf((float)DEFAULT_LEVELS_PER_OCTAVE *
+      ((float)complexity + log2f(p)));
   if (tn < 0) {
     return 0;
-  } else if (tn >= DEFAULT_OCTAVES) {
-    return DEFAULT_OCTAVES - 1;
+  } else if (tn >= DEFAULT_LEVELS) {
+    return DEFAULT_LEVELS - 1;
   }
   return tn;
 }
 
+void
+limitBand(Osc *o) {
+
+/* Chooses the level of the wavetable that the Osc reads from its Target
+ * pitch, once per note rather than for every sample. Must be called whenever
+ * Osc.Target or Osc.Complexity changes. */
+
+  o->Level = wavetableIndex(*o->Complexity, o->Target);
+}
+
+static float
+wrapPhase(const float phase) {
+
+/* Brings a phase that may have run past either end of the wavetable back to
+ * between 0.0 and DEFAULT_WAVELEN. The result may equal DEFAULT_WAVELEN when
+ * rounding, which the guard samples allow for. Phases too far out for their
+ * cycles to fit in an int fall back to fmodf(). */
+
+  const float cycles = phase * (1.0f / (float)DEFAULT_WAVELEN);
+  float wrapped = 0.0f;
+  int whole = 0;
+
+  if (!(fabsf(cycles) < 2147483648.0f)) {
+    wrapped = fmodf(phase, (float)DEFAULT_WAVELEN);
+    return wrapped < 0.0f ? wrapped + (float)DEFAULT_WAVELEN : wrapped;
+  }
+  whole = (int)cycles;
+  whole -= (cycles < (float)whole);
+  return phase - ((float)whole * (float)DEFAULT_WAVELEN);
+}
+
+static double
+clockPhase(const Osc *o, const size_t frames) {
+
+/* Returns the phase that the render clock, "frames" samples into the current
+ * piece, gives an Osc at its pitch. This is where a note struck then at that
+ * pitch begins, and is worked out in double precision like it. */
+
+  return fmod((double)(*o->Shares->Clock + frames) * o->Pitch,
+      DEFAULT_WAVELEN);
+}
+
 static void
-fillModulatorBuffer(Operator *m) {
+lockPhase(Osc *o) {
+
+/* Puts a modulator whose pitch is holding steady back on the phase that the
+ * render clock gives it, Osc.Offset along from where a note struck at the
+ * same pitch would be. Adding the pitch to the phase sample by sample picks
+ * up a little float rounding every block, which over a held note would carry
+ * it too far from newly struck notes to share their reads. The correction is
+ * far below a sample per block. */
+
+  if (o->Pitch != o->Target || o->Shares->Reads == NULL) {
+    return;
+  }
+  o->Phase = wrapPhase((float)(clockPhase(o, 0) + o->Offset));
+}
+
+static bool
+readsTable(const Osc *o) {
+
+/* Returns whether an Osc reads wavetables, rather than generating noise. A
+ * morph takes the place of the Osc's own wave. */
+
+  return o->Wave->Type != WAVE_TYPE_NOISE || o->Morph->Frames >= 2;
+}
+
+static float
+morphTarget(const Osc *o, const Env *e) {
+
+/* Returns where along its Morph an Osc should be for the current level of
+ * its envelope, counted in frames. */
+
+  const Morph *m = o->Morph;
+  const float target = m->Position + (m->Sweep * levelEnv(e));
+
+  return truncateFloat(liftFloat(target, 0.0f), 1.0f) *
+    (float)(m->Frames - 1);
+}
+
+void
+startMorph(Osc *o, const Env *e) {
+
+/* Places a struck note at its own starting point along the Morph, so that
+ * its first block does not blend from wherever the Voice's last note left
+ * off. Its envelope must already be reset. */
+
+  o->Position = o->Morph->Frames < 2 ? 0.0f : morphTarget(o, e);
+}
+
+static void
+resolveFrames(Frames *f, Osc *o, const Env *e, const size_t frames) {
+
+/* Looks up the tables an Osc reads over the next "frames" samples. A morph
+ * reads the two frames either side of its position, which is worked out
+ * from the envelope once per block. The blend between them moves in a
+ * straight line from where the last block left off, so that the envelope
+ * does not step the timbre. */
+
+  const Morph *m = o->Morph;
+  float target = 0.0f;
+  unsigned int n = 0;
+  const float **from = NULL;
+  const float **to = NULL;
+  const int16_t **compactFrom = NULL;
+  const int16_t **compactTo = NULL;
+
+  f->To = NULL;
+  f->CompactTo = NULL;
+  f->Quality = *o->Quality;
+  f->Mix = 0.0f;
+  f->Step = 0.0f;
+  if (m->Frames < 2) {
+    f->From = o->Wave->Table[o->Level];
+    f->CompactFrom = o->Wave->Compact == NULL ? NULL :
+      o->Wave->Compact[o->Level];
+    return;
+  }
+  target = morphTarget(o, e);
+  n = (unsigned int)target;
+  if (n + 1 >= m->Frames) {
+    n = m->Frames - 2;
+  }
+  from = getWavetable(m->From + n);
+  to = getWavetable(m->From + n + 1);
+  compactFrom = getCompactWavetable(m->From + n);
+  compactTo = getCompactWavetable(m->From + n + 1);
+  f->From = from[o->Level];
+  f->To = to[o->Level];
+  f->CompactFrom = compactFrom == NULL ? NULL : compactFrom[o->Level];
+  f->CompactTo = compactTo == NULL ? NULL : compactTo[o->Level];
+  f->Mix = truncateFloat(liftFloat(o->Position - (float)n, 0.0f), 1.0f);
+  f->Step = ((target - (float)n) - f->Mix) / (float)frames;
+  o->Position = target;
+}
+
+static float
+readTable(const float *t, const float r, const Quality q) {
+
+/* Interpolates a table at a fraction "r" of the way from the sample that "t"
+ * points to towards the next, reading as many samples either side as the
+ * Quality needs. The guard samples always cover them. */
+
+  const float *k = NULL;
+  float c1 = 0.0f;
+  float c2 = 0.0f;
+  float c3 = 0.0f;
+
+  switch ((unsigned int)q) {
+    case QUALITY_TRUNCATE:
+      return t[0];
+    case QUALITY_HERMITE:
+      c1 = 0.5f * (t[1] - t[-1]);
+      c2 = t[-1] - (2.5f * t[0]) + (2.0f * t[1]) - (0.5f * t[2]);
+      c3 = (0.5f * (t[2] - t[-1])) + (1.5f * (t[0] - t[1]));
+      return (((((c3 * r) + c2) * r) + c1) * r) + t[0];
+    case QUALITY_POLYPHASE:
+      k = POLYPHASE[(int)((r * (float)DEFAULT_POLYPHASE_PHASES) + 0.5f)];
+      return (k[0] * t[-1]) + (k[1] * t[0]) + (k[2] * t[1]) + (k[3] * t[2]);
+    default:
+      return t[0] + (r * (t[1] - t[0]));
+  }
+}
+
+static float
+readCompact(const int16_t *c, const float r, const Quality q) {
+
+/* Interpolates a 16 bit table like readTable(), without scaling it back down
+ * to floats. */
+
+  const float t[4] = {(float)c[-1], (float)c[0], (float)c[1], (float)c[2]};
+
+  return readTable(t + 1, r, q);
+}
+
+static float
+readWave(const Frames *f, const float phase) {
+
+/* Interpolates the tables of a block, from their 16 bit copies if there are
+ * any, at a phase from wrapPhase(). The guard samples either end of each
+ * table repeat the other end, so the samples around the phase can always be
+ * read without wrapping. A morph blends the two frames by Frames.Mix. */
+
+  const int i = (int)phase;
+  const float r = phase - (float)i;
+  float s = 0.0f;
+
+  if (f->CompactFrom != NULL) {
+    s = readCompact(f->CompactFrom + i, r, f->Quality);
+    if (f->CompactTo != NULL) {
+      s += f->Mix * (readCompact(f->CompactTo + i, r, f->Quality) - s);
+    }
+    return s * (1.0f / (float)SHRT_MAX);
+  }
+  s = readTable(f->From + i, r, f->Quality);
+  if (f->To != NULL) {
+    s += f->Mix * (readTable(f->To + i, r, f->Quality) - s);
+  }
+  return s;
+}
+
+static void
+takeShareKey(ShareKey *k, const Frames *f, const Osc *o) {
+
+/* Fills a ShareKey from the tables of a block and the Osc reading them. */
+
+  k->From = f->From;
+  k->To = f->To;
+  k->CompactFrom = f->CompactFrom;
+  k->CompactTo = f->CompactTo;
+  k->Mix = f->Mix;
+  k->Step = f->Step;
+  k->Pitch = o->Pitch;
+  k->Target = o->Target;
+  k->Phase = o->Phase;
+  k->Quality = f->Quality;
+}
+
+static bool
+sameShare(const ShareKey *a, const ShareKey *b) {
+
+/* Returns whether two ShareKeys read the same samples. Their phases only
+ * have to be within DEFAULT_SHARE_PHASE of each other, either way around the
+ * table. */
+
+  const float d = fabsf(a->Phase - b->Phase);
+
+  return a->From == b->From && a->To == b->To &&
+    a->CompactFrom == b->CompactFrom && a->CompactTo == b->CompactTo &&
+    a->Mix == b->Mix && a->Step == b->Step && a->Pitch == b->Pitch &&
+    a->Target == b->Target && a->Quality == b->Quality &&
+    (d <= DEFAULT_SHARE_PHASE ||
+     (float)DEFAULT_WAVELEN - d <= DEFAULT_SHARE_PHASE);
+}
+
+static int
+findShare(Shares *s, const ShareKey *k) {
+
+/* Returns which of the reads in the Shares has the ShareKey "k", or -1 if
+ * none does. Forgets every read first if a new piece has begun. */
+
+  size_t i = 0;
+
+  if (s->Reads == NULL) {
+    return -1;
+  }
+  if (*s->Clock != s->Last) {
+    s->Last = *s->Clock;
+    s->N = 0;
+  }
+  for (; i < s->N ; i++) {
+    if (sameShare(&s->Keys[i], k)) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+static float *
+claimShare(Shares *s, const ShareKey *k) {
+
+/* Returns a buffer for the reads of a modulator with the ShareKey "k" to be
+ * recorded in, or NULL if the Shares are full or off. */
+
+  if (s->Reads == NULL || s->N >= MAX_SHARES) {
+    return NULL;
+  }
+  s->Keys[s->N] = *k;
+  return s->Reads + (s->N++ * s->Frames);
+}
+
+static void
+fillModulatorBuffer(Operator *m, const size_t frames, const size_t left) {
 
 /* Assigns an interpolated float sample to every index of the Osc buffer, 
  * derived from Osc.Pitch. This buffer is later used to modulate the carrier 
- * signal. */
+ * signal, so the modulator pitch of each sample is folded into it. The pitch
+ * and amplitude ramps, and the tables to read, are worked out once for the
+ * whole call. The ramps end with the block, which has "left" frames to go
+ * from the start of this piece, so splitting a block into pieces at
+ * scheduled commands does not shorten them. If another Voice has already
+ * read the same samples during this piece of the block, its reads are scaled
+ * instead, and the Osc takes up the phase that they ended at. Otherwise the
+ * reads are recorded in the Shares, if there is room. */
 
   unsigned int i = 0;
+  int n = -1;
   Osc *o = &m->Osc;
-  int tableNo = wavetableIndex(*o->Complexity, o->Pitch);
+  const float pitchStep = (o->Target - o->Pitch) / (float)left;
+  const float ampStep = (*m->Level - o->Amplitude) / (float)left;
+  const float *shared = NULL;
+  float *reads = NULL;
+  float s = 0.0f;
+  Frames f = {0};
+  ShareKey k = {0};
 
-  if (o->Wave->Type == WAVE_TYPE_NOISE) {
-    for (; i < DEFAULT_BUFSIZE ; i++) {
+  if (!readsTable(o)) {
+    for (; i < frames ; i++) {
+      o->Pitch += pitchStep;
+      o->Amplitude += ampStep;
       o->Buffer[i] = readNoise(&o->Wave->Noise, o->Pitch) *
-        o->Amplitude * applyEnv(&m->Env) * o->KeyMod;
+        o->Amplitude * applyEnv(&m->Env) * o->KeyMod * o->Pitch;
     }
   } else {
-    for (; i < DEFAULT_BUFSIZE ; i++) {
-      o->Phase = fmodf(o->Phase + o->Pitch, (float)DEFAULT_WAVELEN);
-      o->Buffer[i] = interpolate(o->Wave->Table[tableNo],
-          DEFAULT_WAVELEN, o->Phase) * o->Amplitude *
-        applyEnv(&m->Env) * o->KeyMod;
+    lockPhase(o);
+    resolveFrames(&f, o, &m->Env, frames);
+    takeShareKey(&k, &f, o);
+    n = findShare(o->Shares, &k);
+  }
+  if (n >= 0) {
+    shared = o->Shares->Reads + ((size_t)n * o->Shares->Frames);
+    for (; i < frames ; i++) {
+      o->Pitch += pitchStep;
+      o->Amplitude += ampStep;
+      o->Buffer[i] = shared[i] * o->Amplitude * applyEnv(&m->Env) *
+        o->KeyMod * o->Pitch;
+    }
+    o->Phase = o->Shares->Ends[n];
+  } else if (readsTable(o)) {
+    reads = claimShare(o->Shares, &k);
+    for (; i < frames ; i++) {
+      o->Pitch += pitchStep;
+      o->Amplitude += ampStep;
+      f.Mix += f.Step;
+      o->Phase = wrapPhase(o->Phase + o->Pitch);
+      s = readWave(&f, o->Phase);
+      if (reads != NULL) {
+        reads[i] = s;
+      }
+      o->Buffer[i] = s * o->Amplitude * applyEnv(&m->Env) * o->KeyMod *
+        o->Pitch;
+    }
+    if (reads != NULL) {
+      o->Shares->Ends[o->Shares->N - 1] = o->Phase;
+    }
+  }
+  if (frames >= left) {
+    o->Pitch = o->Target;
+    o->Amplitude = *m->Level;
+    if (pitchStep != 0.0f && o->Shares->Reads != NULL) {
+      o->Offset = wrapPhase((float)((double)o->Phase -
+            clockPhase(o, frames)));
     }
   }
 }
 
 static float
-modulate(Osc *c, Osc *m, unsigned int i) {
+modulate(Osc *c, Osc *m, const Frames *f, unsigned int i) {
 
 /* A similar algorithm to the cannonical frequency modulation (FM) formula,
  * but operates on the phase of waves. The carrier wave has its phase increased
  * by the carrier pitch, then it has this phase further altered by adding
  * (or subtracting) the modulation pitch multiplied by its amplitude at the
- * discrete point in time i. This distorted carrier phase is then interpolated
- * against the carrier Osc's wavetable. */
+ * discrete point in time i, which fillModulatorBuffer() has already done.
+ * This distorted carrier phase is then interpolated against the carrier Osc's
+ * tables for the block in "f". */
 
-  const float pitch = (c->Pitch * c->Wave->Polarity) + 
-    (m->Pitch * m->Buffer[i]);
-  int tableNo = wavetableIndex(*c->Complexity, pitch);
+  const float pitch = (c->Pitch * c->Wave->Polarity) + m->Buffer[i];
 
-  if (c->Wave->Type == WAVE_TYPE_NOISE) {
+  if (!readsTable(c)) {
     return readNoise(&c->Wave->Noise, pitch);
   } else {
-    c->Phase = fmodf(c->Phase + pitch, (float)DEFAULT_WAVELEN);
-    return interpolate(c->Wave->Table[tableNo], DEFAULT_WAVELEN, c->Phase);
+    c->Phase = wrapPhase(c->Phase + pitch);
+    return readWave(f, c->Phase);
   }
 }
 
 void
-fillCarrierBuffer(Operator *c, Operator *m) {
+fillCarrierBuffer(Operator *c, Operator *m, const size_t frames,
+    const size_t left) {
 
 /* Calculates the cycle of the modulating wave, then modulates the cycle of
  * the carrier wave against it. Sums its final values up in the carrier wave's
- * buffer. */
+ * buffer. Both buffers must hold at least "frames" samples. The carrier pitch
+ * and amplitude are ramped like those of the modulator, towards the end of
+ * the block "left" frames away. */
 
   unsigned int i = 0;
+  Osc *o = &c->Osc;
+  const float pitchStep = (o->Target - o->Pitch) / (float)left;
+  const float ampStep = (*c->Level - o->Amplitude) / (float)left;
+  Frames f = {0};
 
-  fillModulatorBuffer(m);
-  for (; i < DEFAULT_BUFSIZE ; i++) {
-    c->Osc.Buffer[i] += modulate(&c->Osc, &m->Osc, i) *
-      c->Osc.Amplitude * applyEnv(&c->Env) * c->Osc.KeyMod;
+  fillModulatorBuffer(m, frames, left);
+  if (readsTable(o)) {
+    resolveFrames(&f, o, &c->Env, frames);
   }
+  for (; i < frames ; i++) {
+    o->Pitch += pitchStep;
+    o->Amplitude += ampStep;
+    f.Mix += f.Step;
+    o->Buffer[i] += modulate(o, &m->Osc, &f, i) * o->Amplitude *
+      applyEnv(&c->Env) * o->KeyMod;
+  }
+  if (frames >= left) {
+    o->Pitch = o->Target;
+    o->Amplitude = *c->Level;
+  }
+}
+
+void
+setMorphFrames(Morph *m, const unsigned int from, const unsigned int frames) {
+
+/* Sets the waves a Morph blends across. Every wave in the sequence must have
+ * a table, so noise can not be a frame. Fewer than 2 frames turns morphing
+ * off. */
+
+  unsigned int i = 0;
+
+  if (frames >= 2) {
+    for (; i < frames ; i++) {
+      if (from + i >= countWaves() || getWavetable(from + i) == NULL) {
+        warnx("Waves %u to %u can not all be morphed", from,
+            from + frames - 1);
+        return;
+      }
+    }
+  }
+  m->From = from;
+  m->Frames = frames;
+}
+
+void
+setQuality(Quality *q, const unsigned int n) {
+
+/* Sets how an operator interpolates its wavetables. */
+
+  if (n >= QUALITY_NUM) {
+    warnx("Interpolation quality must be between 0 and %d", QUALITY_NUM - 1);
+    return;
+  }
+  *q = (Quality)n;
 }
 
+void
+makeShares(Shares *s, const uint64_t *clock, const size_t frames) {
+
+/* Turns on sharing for the modulators of an Operators, whose blocks are at
+ * most "frames" long. Errors are fatal. */
+
+  s->Clock = clock;
+  s->Last = *clock;
+  s->N = 0;
+  s->Frames = frames;
+  s->Reads = makeSamples(MAX_SHARES * frames);
+}
+
+void
+killShares(Shares *s) {
+
+/* Frees memory allocated by makeShares(), and turns sharing off. */
+
+  free(s->Reads);
+  s->Reads = NULL;
+  s->N = 0;
+}
+
+void
+makePolyphase(void) {
+
+/* Tabulates the cubic Lagrange kernel that QUALITY_POLYPHASE weighs the four
+ * samples around a phase by, one row for each fractional position. A windowed
+ * sinc of only four taps is flat too far short of the band that the
+ * wavetables fill, so the wider passband of the Lagrange kernel is the better
+ * fit for them. */
+
+  unsigned int p = 0;
+  unsigned int j = 0;
+  unsigned int k = 0;
+  double r = 0.0;
+  double w = 0.0;
+
+  for (; p <= DEFAULT_POLYPHASE_PHASES ; p++) {
+    r = (double)p / DEFAULT_POLYPHASE_PHASES;
+    for (j = 0 ; j < 4 ; j++) {
+      w = 1.0;
+      for (k = 0 ; k < 4 ; k++) {
+        if (k != j) {
+          w *= (r - ((double)k - 1.0)) / ((double)j - (double)k);
+        }
+      }
+      POLYPHASE[p][j] = (float)w;
+    }
+  }
+}
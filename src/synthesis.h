@@ -1,10 +1,83 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
+#include "constants/maximums.h"
 #include "envelope.h"
 #include "wave.h"
 
+typedef enum Quality {
+
+/* How an Osc interpolates between the samples of a wavetable. -bench reports
+ * what each costs and how clean it is. QUALITY_TRUNCATE reads the sample
+ * before the phase, QUALITY_LINEAR draws a line to the next one,
+ * QUALITY_HERMITE fits a Catmull-Rom spline through the four around it, and
+ * QUALITY_POLYPHASE weighs the same four by a cubic Lagrange kernel tabulated
+ * at DEFAULT_POLYPHASE_PHASES fractional positions. */
+
+  QUALITY_TRUNCATE = 0,
+  QUALITY_LINEAR,
+  QUALITY_HERMITE,
+  QUALITY_POLYPHASE,
+  QUALITY_NUM
+} Quality;
+
+typedef struct Morph {
+
+/* A sequence of Morph.Frames waves, starting at wave number Morph.From, that
+ * an operator blends across instead of reading its own wave. Morph.Position,
+ * between 0.0 and 1.0, is a point along the sequence, and Morph.Sweep is how
+ * far the operator's envelope moves it, from -1.0 to 1.0. Morphing is off
+ * while Morph.Frames is below 2. */
+
+  unsigned int  From;
+  unsigned int  Frames;
+  float         Position;
+  float         Sweep;
+} Morph;
+
+typedef struct ShareKey {
+
+/* Everything that decides which samples a modulator reads from its tables
+ * during one block: the tables and their blend, the interpolation Quality,
+ * the pitch it starts the block at and ramps to, and the phase it starts
+ * from. */
+
+  const float   * From;
+  const float   * To;
+  const int16_t * CompactFrom;
+  const int16_t * CompactTo;
+  float           Mix;
+  float           Step;
+  float           Pitch;
+  float           Target;
+  float           Phase;
+  Quality         Quality;
+} ShareKey;
+
+typedef struct Shares {
+
+/* The table reads of the modulators rendered so far in the current piece of
+ * a block, so that a modulator with the same ShareKey in another Voice, such
+ * as a fixed rate modulator under a chord, reuses them instead of reading
+ * the tables again. Only the reads are shared; each Voice still applies its
+ * own amplitude, envelope and key modifiers. Shares.Keys holds the ShareKey
+ * of each of the Shares.N reads so far, Shares.Ends the phase each one ended
+ * at, and Shares.Reads MAX_SHARES buffers of Shares.Frames samples. The reads
+ * are forgotten whenever Shares.Clock, which points to Voices.Phase, differs
+ * from Shares.Last. Sharing is off while Shares.Reads is NULL. */
+
+  const uint64_t  * Clock;
+  uint64_t          Last;
+  size_t            N;
+  size_t            Frames;
+  ShareKey          Keys[MAX_SHARES];
+  float             Ends[MAX_SHARES];
+  float           * Reads;
+} Shares;
+
 typedef struct Osc {
 
 /* The primitive sound generating type. For every sound sample value generated,
@@ -15,24 +88,44 @@ typedef struct Osc {
  * the struck key that engaged the Osc. Osc.Complexity adjusts the harmonic
  * richness of the signal offsetting +/- which band-limited wavetable to read.
  * At step i of every buffer-filling cycle, 
- * Osc.Phase * Osc.Amplitude * Osc.KeyMod is written to Osc.Buffer[i]. */
-
-  float   KeyMod;
-  float   Amplitude;
-  float   Phase;
-  float   Pitch;
-  int   * Complexity;
-  float * Buffer;
-  Wave  * Wave;
+ * Osc.Phase * Osc.Amplitude * Osc.KeyMod is written to Osc.Buffer[i].
+ * Osc.Pitch moves in a straight line to Osc.Target by the end of each
+ * rendered block, however many pieces it is rendered in, and Osc.Amplitude
+ * does the same towards Operator.Level, so that changes to either do not
+ * click. Osc.Level is the band-limited level of Osc.Wave that
+ * is read, chosen by limitBand() from Osc.Target when a note is struck or
+ * retuned. Osc.Position is where the Osc had reached along Osc.Morph at the
+ * end of the last block, counted in frames. Osc.Offset is how far a
+ * modulator's phase is from the one the render clock gives a note struck at
+ * its pitch, which is 0.0 until a glide ends. Osc.Quality is how it
+ * interpolates its tables, and Osc.Shares holds the reads of other Voices'
+ * Oscs that it may reuse. */
+
+  float     KeyMod;
+  float     Amplitude;
+  float     Phase;
+  float     Pitch;
+  float     Target;
+  float     Offset;
+  float     Position;
+  int       Level;
+  int     * Complexity;
+  float   * Buffer;
+  Wave    * Wave;
+  Morph   * Morph;
+  Quality * Quality;
+  Shares  * Shares;
 } Osc;
 
 typedef struct Operator {
 
 /* Couples an Osc with an Env for organization's sake. Contains pointers to
  * values in a parent Operators struct, which govern the fixed rate and pitch
- * ratio values of the Operator. */
+ * ratio values of the Operator. Operator.Level points to the amplitude that
+ * Osc.Amplitude follows. */
 
   float       * FixedRate;
+  float       * Level;
   float       * Ratio;
   Osc           Osc;
   Env           Env;
@@ -40,17 +133,29 @@ typedef struct Operator {
 
 typedef struct Operators {
 
-/* A master Operator that contains the wave and envelope settings that
- * individual child Operators point to. No oscillator information is contained
- * here, as that is decided on a Voice by Voice basis. */
+/* A master Operator that contains the wave, morph, interpolation and
+ * envelope settings that individual child Operators point to, and the
+ * Shares that they render through. No oscillator
+ * information is contained here, as that is decided on a Voice by Voice
+ * basis. */
 
-  int   Complexity;
-  float FixedRate;    
-  float Ratio;
-  Wave  Wave;
-  Envs  Env;
+  int     Complexity;
+  float   FixedRate;    
+  float   Ratio;
+  Wave    Wave;
+  Morph   Morph;
+  Quality Quality;
+  Shares  Shares;
+  Envs    Env;
 
 } Operators;
 
 void setPitch(Operator *, const unsigned int, const unsigned int);
-void fillCarrierBuffer(Operator *, Operator *m);
+void limitBand(Osc *);
+void setMorphFrames(Morph *, const unsigned int, const unsigned int);
+void startMorph(Osc *, const Env *);
+void setQuality(Quality *, const unsigned int);
+void makePolyphase(void);
+void makeShares(Shares *, const uint64_t *, const size_t);
+void killShares(Shares *);
+void fillCarrierBuffer(Operator *, Operator *, const size_t, const size_t);
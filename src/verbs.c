@@ -0,0 +1,374 @@
+/* Named commands that take several arguments at once, and the table that
+ * both parses and dispatches them. Consult "verbs.h" for more info. */
+
+#include <ctype.h>
+#include <err.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "verbs.h"
+
+#include "amplitude.h"
+#include "audio-init.h"
+#include "constants/errors.h"
+#include "constants/maximums.h"
+#include "constants/types.h"
+#include "envelope.h"
+#include "numerical.h"
+#include "parse.h"
+#include "route.h"
+#include "synthesis.h"
+#include "voice.h"
+
+#define IS_GIVEN(c, i) ((bool)((c)->Given & (1u << (i))))
+
+static void runNote(Audio *, const Cmd *);
+static void runOff(Audio *, const Cmd *);
+static void setEnv(Envs *, const Cmd *);
+static void runEnv(Audio *, const Cmd *);
+static void runModEnv(Audio *, const Cmd *);
+static void runRatio(Audio *, const Cmd *);
+static void runFixed(Audio *, const Cmd *);
+static void runLevel(Audio *, const Cmd *);
+static void setMorph(Morph *, const Cmd *);
+static void runMorph(Audio *, const Cmd *);
+static void runModMorph(Audio *, const Cmd *);
+static void runQuality(Audio *, const Cmd *);
+static const Verb * findVerb(const char *, const size_t);
+static unsigned int findParam(const Verb *, const char *, const size_t);
+static int readParam(Cmd *, const Verb *, const char *, unsigned int *);
+
+static const Verb VERBS[] = {
+  {"note",      {{"key", TYPE_UINT, true},
+                 {"vel", TYPE_UINT, false},
+                 {"pan", TYPE_UFLOAT, false}}, runNote},
+  {"off",       {{"key", TYPE_UINT, true}}, runOff},
+  {"env",       {{"attack", TYPE_UFLOAT, false},
+                 {"decay", TYPE_UFLOAT, false},
+                 {"sustain", TYPE_UFLOAT, false},
+                 {"release", TYPE_UFLOAT, false}}, runEnv},
+  {"modenv",    {{"attack", TYPE_UFLOAT, false},
+                 {"decay", TYPE_UFLOAT, false},
+                 {"sustain", TYPE_UFLOAT, false},
+                 {"release", TYPE_UFLOAT, false}}, runModEnv},
+  {"ratio",     {{"carrier", TYPE_UFLOAT, false},
+                 {"modulator", TYPE_UFLOAT, false}}, runRatio},
+  {"fixed",     {{"carrier", TYPE_UFLOAT, false},
+                 {"modulator", TYPE_UFLOAT, false}}, runFixed},
+  {"level",     {{"carrier", TYPE_UFLOAT, false},
+                 {"modulator", TYPE_UFLOAT, false}}, runLevel},
+  {"morph",     {{"from", TYPE_UINT, false},
+                 {"frames", TYPE_UINT, false},
+                 {"position", TYPE_UFLOAT, false},
+                 {"sweep", TYPE_FLOAT, false}}, runMorph},
+  {"modmorph",  {{"from", TYPE_UINT, false},
+                 {"frames", TYPE_UINT, false},
+                 {"position", TYPE_UFLOAT, false},
+                 {"sweep", TYPE_FLOAT, false}}, runModMorph},
+  {"quality",   {{"carrier", TYPE_UINT, false},
+                 {"modulator", TYPE_UINT, false}}, runQuality},
+};
+
+#define VERBS_NUM (sizeof(VERBS) / sizeof(*VERBS))
+
+static void
+runNote(Audio *a, const Cmd *c) {
+
+/* Plays a note at a velocity, 127 unless given, and optionally pans the note
+ * between the first two channels. */
+
+  const unsigned int key = (unsigned int)c->Args[0].I;
+  const unsigned int vel = IS_GIVEN(c, 1) ? (unsigned int)c->Args[1].I :
+    MAX_MIDI_VALUE;
+  Voices *vs = &a->Voices;
+
+  if (key > MAX_MIDI_VALUE || vel > MAX_MIDI_VALUE) {
+    warnx("Key and velocity must be between 0 and %d", MAX_MIDI_VALUE);
+    return;
+  }
+  if (IS_GIVEN(c, 2)) {
+    panRoute(&vs->Router, &vs->Routes[key], c->Args[2].F);
+  }
+  voiceOn(vs, (uint16_t)(key | (vel << 9)));
+}
+
+static void
+runOff(Audio *a, const Cmd *c) {
+
+/* Turns a note off. */
+
+  if ((unsigned int)c->Args[0].I > MAX_MIDI_VALUE) {
+    warnx("Key must be between 0 and %d", MAX_MIDI_VALUE);
+    return;
+  }
+  voiceOff(&a->Voices, (uint16_t)c->Args[0].I);
+}
+
+static void
+setEnv(Envs *e, const Cmd *c) {
+
+/* Sets whichever stages of an envelope were given. */
+
+  if (IS_GIVEN(c, 0)) {
+    setAttackLevel(e, c->Args[0].F);
+  }
+  if (IS_GIVEN(c, 1)) {
+    setDecayLevel(e, c->Args[1].F);
+  }
+  if (IS_GIVEN(c, 2)) {
+    setSustainLevel(e, c->Args[2].F);
+  }
+  if (IS_GIVEN(c, 3)) {
+    setReleaseLevel(e, c->Args[3].F);
+  }
+}
+
+static void
+runEnv(Audio *a, const Cmd *c) {
+
+/* Sets the carrier envelope, like the a, d, s and r commands. */
+
+  setEnv(&a->Voices.Carrier.Env, c);
+}
+
+static void
+runModEnv(Audio *a, const Cmd *c) {
+
+/* Sets the modulator envelope, like the A, D, S and R commands. */
+
+  setEnv(&a->Voices.Modulator.Env, c);
+}
+
+static void
+runRatio(Audio *a, const Cmd *c) {
+
+/* Sets the pitch ratios, like the p and P commands. */
+
+  if (IS_GIVEN(c, 0)) {
+    setPitchRatio(&a->Voices, true, c->Args[0].F);
+  }
+  if (IS_GIVEN(c, 1)) {
+    setPitchRatio(&a->Voices, false, c->Args[1].F);
+  }
+}
+
+static void
+runFixed(Audio *a, const Cmd *c) {
+
+/* Sets the fixed frequencies, like the x and X commands. */
+
+  if (IS_GIVEN(c, 0)) {
+    setFixedRate(&a->Voices, true, c->Args[0].F);
+  }
+  if (IS_GIVEN(c, 1)) {
+    setFixedRate(&a->Voices, false, c->Args[1].F);
+  }
+}
+
+static void
+runLevel(Audio *a, const Cmd *c) {
+
+/* Sets the carrier and modulator levels, like the l and L commands. */
+
+  if (IS_GIVEN(c, 0)) {
+    setVolume(&a->Amplitude, c->Args[0].F);
+  }
+  if (IS_GIVEN(c, 1)) {
+    setModulation(&a->Voices, c->Args[1].F);
+  }
+}
+
+static void
+setMorph(Morph *m, const Cmd *c) {
+
+/* Sets whichever parts of a morph were given. The position is kept between
+ * 0.0 and 1.0, and the sweep between -1.0 and 1.0. */
+
+  if (IS_GIVEN(c, 0) || IS_GIVEN(c, 1)) {
+    setMorphFrames(m, IS_GIVEN(c, 0) ? (unsigned int)c->Args[0].I : m->From,
+        IS_GIVEN(c, 1) ? (unsigned int)c->Args[1].I : m->Frames);
+  }
+  if (IS_GIVEN(c, 2)) {
+    m->Position = truncateFloat(c->Args[2].F, 1.0f);
+  }
+  if (IS_GIVEN(c, 3)) {
+    m->Sweep = liftFloat(truncateFloat(c->Args[3].F, 1.0f), -1.0f);
+  }
+}
+
+static void
+runMorph(Audio *a, const Cmd *c) {
+
+/* Sets the morph of the carrier. */
+
+  setMorph(&a->Voices.Carrier.Morph, c);
+}
+
+static void
+runModMorph(Audio *a, const Cmd *c) {
+
+/* Sets the morph of the modulator. */
+
+  setMorph(&a->Voices.Modulator.Morph, c);
+}
+
+static void
+runQuality(Audio *a, const Cmd *c) {
+
+/* Sets how the carrier and modulator interpolate their wavetables. */
+
+  if (IS_GIVEN(c, 0)) {
+    setQuality(&a->Voices.Carrier.Quality, (unsigned int)c->Args[0].I);
+  }
+  if (IS_GIVEN(c, 1)) {
+    setQuality(&a->Voices.Modulator.Quality, (unsigned int)c->Args[1].I);
+  }
+}
+
+static const Verb *
+findVerb(const char *name, const size_t len) {
+
+/* Returns the Verb called "name", or NULL if there is none. */
+
+  size_t i = 0;
+
+  for (; i < VERBS_NUM ; i++) {
+    if (strlen(VERBS[i].Name) == len &&
+        strncmp(VERBS[i].Name, name, len) == 0) {
+      return &VERBS[i];
+    }
+  }
+  return NULL;
+}
+
+static unsigned int
+findParam(const Verb *v, const char *name, const size_t len) {
+
+/* Returns the index of the Param called "name", or MAX_ARGS if the Verb has
+ * no such Param. */
+
+  unsigned int i = 0;
+
+  for (; i < MAX_ARGS && v->Params[i].Name != NULL ; i++) {
+    if (strlen(v->Params[i].Name) == len &&
+        strncmp(v->Params[i].Name, name, len) == 0) {
+      return i;
+    }
+  }
+  return MAX_ARGS;
+}
+
+static int
+readParam(Cmd *c, const Verb *v, const char *token, unsigned int *next) {
+
+/* Reads a single argument, either a bare value that fills the next Param in
+ * order, or a name=value pair. Floats are floored for integer Params, as with
+ * single letter commands. Returns the length of the argument. */
+
+  int len = 0;
+  int nameLen = -1;
+  unsigned int i = MAX_ARGS;
+  const char *value = token;
+  char *end = NULL;
+  float f = 0.0f;
+
+  for (; !isblank((int)token[len]) && !IS_DELIMETER(token[len]) ; len++) {
+    if (token[len] == '=' && nameLen < 0) {
+      nameLen = len;
+    }
+  }
+  if (nameLen >= 0) {
+    i = findParam(v, token, (size_t)nameLen);
+    value = token + nameLen + 1;
+  } else {
+    i = (*next)++;
+  }
+  if (i >= MAX_ARGS || v->Params[i].Name == NULL) {
+    warnx("%s has no argument for %.*s", v->Name, len, token);
+    c->Error = ERROR_ARG;
+    return len;
+  }
+  f = strtof(value, &end);
+  if (end == value || end != token + len || !isfinite(f)) {
+    warnx("Invalid argument %.*s to %s", len, token, v->Name);
+    c->Error = ERROR_ARG;
+    return len;
+  }
+  if (f < 0.0f && !(v->Params[i].Type & TYPE_FLAG_SIGNED)) {
+    warnx("The %s of %s can not be negative", v->Params[i].Name, v->Name);
+    c->Error = ERROR_ARG;
+    return len;
+  }
+  if (v->Params[i].Type & TYPE_FLAG_FLOATING) {
+    c->Args[i].F = f;
+  } else {
+    c->Args[i].I = (int32_t)floorf(f);
+  }
+  c->Given |= 1u << i;
+  return len;
+}
+
+int
+parseVerb(Cmd *c, char *line) {
+
+/* Reads a named command and its arguments into a Cmd struct. Returns the
+ * number of bytes read, including the delimeter. Errors are stored in
+ * Cmd.Error, and the caller skips the rest of the command. */
+
+  int span = 0;
+  size_t len = 0;
+  unsigned int i = 0;
+  unsigned int next = 0;
+  const Verb *v = NULL;
+
+  for (; isblank((int)line[span]) ; span++) {
+    ;
+  }
+  for (; isalpha((int)line[span + len]) ; len++) {
+    ;
+  }
+  v = findVerb(line + span, len);
+  if (v == NULL) {
+    c->Error = ERROR_FUNCTION;
+    return span;
+  }
+  c->Func = TYPE_VERB | (unsigned int)(v - VERBS);
+  c->Type = TYPE_NIL;
+  c->Given = 0;
+  span += (int)len;
+  while (c->Error == ERROR_OK) {
+    for (; isblank((int)line[span]) ; span++) {
+      ;
+    }
+    if (IS_DELIMETER(line[span])) {
+      break;
+    }
+    span += readParam(c, v, line + span, &next);
+  }
+  for (; c->Error == ERROR_OK && i < MAX_ARGS && v->Params[i].Name != NULL ;
+      i++) {
+    if (v->Params[i].Required && !IS_GIVEN(c, i)) {
+      warnx("%s needs a %s", v->Name, v->Params[i].Name);
+      c->Error = ERROR_ARG;
+    }
+  }
+  if (line[span] != '\0') {
+    span++;
+  }
+  return span;
+}
+
+void
+runVerb(Audio *a, const Cmd *c) {
+
+/* Runs a named command through the table it was parsed with. */
+
+  const unsigned int i = c->Func & ~TYPE_VERB;
+
+  if (i < VERBS_NUM) {
+    VERBS[i].Run(a, c);
+  }
+}
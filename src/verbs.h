@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "audio-init.h"
+#include "constants/maximums.h"
+#include "parse.h"
+
+typedef struct Param {
+
+/* A single argument of a named command. Param.Type is one of the numerical
+ * TYPE_* signatures. Arguments that are not Param.Required may be left out,
+ * in which case the command decides what to do without them. */
+
+  const char  * Name;
+  unsigned int  Type;
+  bool          Required;
+} Param;
+
+typedef struct Verb {
+
+/* A command named by a whole word, such as (note). Its arguments may be
+ * given in the order of Verb.Params, by name as name=value, or a mix of the
+ * two. Verb.Run carries out the command against the Audio struct. */
+
+  const char  * Name;
+  Param         Params[MAX_ARGS];
+  void       (* Run)(Audio *, const Cmd *);
+} Verb;
+
+int parseVerb(Cmd *, char *);
+void runVerb(Audio *, const Cmd *);
@@ -11,11 +11,14 @@
 #include "voice.h"
 
 #include "audio-settings.h"
+#include "buffers.h"
+#include "cache.h"
 #include "constants/defaults.h"
 #include "constants/errors.h"
 #include "envelope.h"
 #include "key.h"
 #include "noise.h"
+#include "route.h"
 #include "synthesis.h"
 #include "wave.h"
 
@@ -23,8 +26,9 @@ static Voice * findFreeVoice(Voices *);
 static void resetVoice(const Voices *, Voice *, const uint16_t, const bool);
 static void setVoicesSettings(Voices *, const AudioSettings *);
 static void allocateVoices(Voices *);
-static void makeOperator(Operators *, Operator *, float *);
-static void makeVoice(Voices *, Voice *, float *, float *);
+static void makeOperator(Operators *, Operator *, float *, float *);
+static void makeVoice(Voices *, Voice *, float *, float *,
+    const AudioSettings *);
 static void makeOperators(Operators *, const unsigned int);
 
 static Voice *
@@ -55,15 +59,20 @@ resetVoice(const Voices *vs, Voice *v, const uint16_t note, const bool soft) {
 
 /* Retriggers keyboard settings and envelopes in a Voice. Notes that are
  * turned off then on again without engaging another voice also trigger this
- * branch (with `soft` engaged). */
+ * branch (with `soft` engaged). A new note also starts at its own place
+ * along any morph, and drops any recording of the note it replaces. */
 
   if (soft) {
     retriggerEnv(&v->Carrier.Env);
     retriggerEnv(&v->Modulator.Env);
   } else {
     applyKey(&vs->Keyboard, &v->Carrier, &v->Modulator, note);
+    v->Modulator.Osc.Amplitude = vs->Modulation;
     resetEnv(&v->Carrier.Env);
     resetEnv(&v->Modulator.Env);
+    startMorph(&v->Carrier.Osc, &v->Carrier.Env);
+    startMorph(&v->Modulator.Osc, &v->Modulator.Env);
+    dropCache(&v->Cache);
   }
 }
 
@@ -121,12 +130,39 @@ voiceOff(Voices *vs, const uint16_t n) {
 }
 
 void
-pollVoice(Voice *v) {
+pollVoice(const Voices *vs, Voice *v, const size_t offset,
+    const size_t frames) {
 
-/* Generates a cycle of sample data for a voice, if it is active. */
+/* Generates "frames" samples for a voice, if it is active, and sums them into
+ * the output buses named by the Route of its note, starting "offset" samples into the
+ * block. A block is rendered in several pieces when scheduled commands fall
+ * inside it, and ramps run on to the end of the block across them. Settled
+ * voices are played from their Cache. */
+
+  const Route *r = NULL;
 
   if (v->Carrier.Env.Stage != ENV_FINISHED) {
-    fillCarrierBuffer(&v->Carrier, &v->Modulator);
+    r = &vs->Routes[v->Note];
+    v->Carrier.Osc.Buffer = routeBuffer(&vs->Router, r) + offset;
+    fillCachedBuffer(&v->Cache, &v->Carrier, &v->Modulator, frames,
+        vs->Router.Frames - offset);
+    mixRoute(&vs->Router, r, offset, frames);
+  }
+}
+
+void
+retuneVoices(Voices *vs) {
+
+/* Recalculates the pitch and key modifiers of every Voice from the current
+ * ratios, fixed rates, and Keyboard settings. Playing notes glide to their new
+ * pitch over the next block. */
+
+  unsigned int i = 0;
+  Voice *v = NULL;
+
+  for (; i < vs->N; i++) {
+    v = &vs->All[i];
+    retuneKey(&vs->Keyboard, &v->Carrier, &v->Modulator, v->Note);
   }
 }
 
@@ -138,18 +174,12 @@ setPitchRatio(Voices *vs, const bool isCarrier, const float r) {
  * function must also loop through each voice and reset its pitch manually to
  * change any notes that are currently playing. */
 
-  unsigned int i = 0;
-  Voice *v = NULL;
-
   if (isCarrier) {
     vs->Carrier.Ratio = r;
   } else {
     vs->Modulator.Ratio = r;
   }
-  for (; i < vs->N; i++) {
-    v = &vs->All[i];
-    applyKey(&vs->Keyboard, &v->Carrier, &v->Modulator, v->Note);
-  }
+  retuneVoices(vs);
 }
 
 void
@@ -158,45 +188,65 @@ setFixedRate(Voices *vs, const bool isCarrier, const float r) {
 /* Changes the Operator.FixedRate setting in a manner similar to that of
  * setPitchRatio(), operating in O(n) time upon all children. */
 
-  unsigned int i = 0;
-  Voice *v = NULL;
-
   if (isCarrier) {
     vs->Carrier.FixedRate = r;
   } else {
     vs->Modulator.FixedRate = r;
   }
-  for (; i < vs->N; i++) {
-    v = &vs->All[i];
-    applyKey(&vs->Keyboard, &v->Carrier, &v->Modulator, v->Note);
-  }
+  retuneVoices(vs);
 }
 
 void
 setWaveComplexity(Voices *vs, const bool isCarrier, const int n) {
 
-/* Set the harmonic complexity offset of the carrier or modulator signal. */  
+/* Set the harmonic complexity offset of the carrier or modulator signal.
+ * Playing notes choose their band limit again. */  
 
   if (isCarrier) {
     vs->Carrier.Complexity = n;
   } else {
     vs->Modulator.Complexity = n;
   }
+  retuneVoices(vs);
 }
 
 void
 setModulation(Voices *vs, const float m) {
 
-/* Sets modulation index on all voices. Since this variable makes use of
- * Osc.Amplitude, which is a local variable for carriers, it must be updated in
- *  a O(n) loop rather than simple change to a pointer value. Audible
- *  distortion should not be too much of a problem. */
+/* Sets modulation index on all voices. Every modulator's Osc.Amplitude
+ * ramps towards Voices.Modulation as it renders its next block, so there is
+ * no need to visit the voices here. */
 
-  unsigned int i = 0;
+  vs->Modulation = m;
+}
 
-  for (; i < vs->N; i++) {
-    vs->All[i].Modulator.Osc.Amplitude = m;
+void
+selectRouteNote(Voices *vs, const unsigned int n) {
+
+/* Selects the note that the routing commands e. and E act upon. */
+
+  if (n >= DEFAULT_KEYS_NUM) {
+    warnx("Note must be between 0 and %u", DEFAULT_KEYS_NUM - 1);
+    return;
   }
+  vs->Router.Note = n;
+}
+
+void
+routeNote(Voices *vs, const int chan) {
+
+/* Sends the selected note to a single output channel, or to all of them if
+ * "chan" is negative. */
+
+  soloRoute(&vs->Router, &vs->Routes[vs->Router.Note], chan);
+}
+
+void
+setNoteGain(Voices *vs, const float g) {
+
+/* Sets the gain of the selected note on the selected output channel. */
+
+  setRouteGain(&vs->Router, &vs->Routes[vs->Router.Note], g);
 }
 
 static void
@@ -205,11 +255,12 @@ setVoicesSettings(Voices *vs, const AudioSettings *aos) {
 /* Populates numerical fields of Voices struct with proper playback values. */
 
   vs->N = aos->Polyphony;
-  vs->Rate = aos->Rate;
+  vs->Rate = aos->RenderRate;
   vs->Carrier.Ratio = 1.0f;
   vs->Modulator.Ratio = 1.0f;
   vs->Phase = 0;
   vs->Amplitude = 1.0f / (float)vs->N;
+  vs->Modulation = 0.0f;
 }
 
 static void
@@ -224,28 +275,38 @@ allocateVoices(Voices *vs) {
 }
 
 static void
-makeOperator(Operators *os, Operator *op, float *b) {
+makeOperator(Operators *os, Operator *op, float *b, float *level) {
 
-/* Initializes an Operator type within a voice. */
+/* Initializes an Operator type within a voice, whose amplitude follows
+ * "level". */
 
   op->FixedRate = &os->FixedRate;
+  op->Level = level;
   op->Ratio = &os->Ratio;
   op->Osc.Buffer = b;
   op->Osc.Complexity = &os->Complexity;
   op->Osc.Wave = &os->Wave;
+  op->Osc.Morph = &os->Morph;
+  op->Osc.Quality = &os->Quality;
+  op->Osc.Shares = &os->Shares;
   makeNoise(&op->Osc.Wave->Noise);
   makeEnv(&os->Env, &op->Env);
 }
 
 static void
-makeVoice(Voices *vs, Voice *v, float *cB, float *mB) {
+makeVoice(Voices *vs, Voice *v, float *cB, float *mB,
+    const AudioSettings *aos) {
 
-/* Initializes a Voice type within Voices.All. */
+/* Initializes a Voice type within Voices.All. Its Cache is left disabled
+ * with the -nocache flag. */
 
+  if (aos->Cache) {
+    makeCache(&v->Cache, aos->BlockFrames);
+  }
   v->Note = DEFAULT_NO_KEY;
   v->Carrier.Osc.Amplitude = vs->Amplitude;
-  makeOperator(&vs->Carrier, &v->Carrier, cB);
-  makeOperator(&vs->Modulator, &v->Modulator, mB);
+  makeOperator(&vs->Carrier, &v->Carrier, cB, &vs->Amplitude);
+  makeOperator(&vs->Modulator, &v->Modulator, mB, &vs->Modulation);
 }
 
 static void
@@ -254,28 +315,43 @@ makeOperators(Operators *os, const unsigned int rate) {
 /* Initializes a Voices.Operators type. */    
 
   os->Complexity = 0;
+  os->Morph.From = 0;
+  os->Morph.Frames = 0;
+  os->Morph.Position = 0.0f;
+  os->Morph.Sweep = 0.0f;
+  os->Quality = QUALITY_LINEAR;
+  os->Shares.Reads = NULL;
+  os->Shares.N = 0;
   makeEnvs(&os->Env, rate);
   selectWave(&os->Wave, WAVE_TYPE_SINE);
 }
 
 void
-makeVoices(Voices *vs, float *carrierBuffer, const AudioSettings *aos) {
+makeVoices(Voices *vs, float *buses, const AudioSettings *aos) {
 
 /* Initializes a Voices type. Errors are fatal. All voices share the same
- * carrier and modulator buffers. The modulator buffer exists internally to
- * the struct, while the carrier buffer is a pointer to the main mixing buffer
- * used in audio output. */
+ * modulator buffer, which exists internally to the struct, and the table
+ * reads of identical modulators through their Shares. Carriers are
+ * summed into the planar buses of the main mixing buffer used in audio
+ * output, according to the Routes of their notes. */
 
   unsigned int i = 0;
   Voice *v = NULL;
 
   setVoicesSettings(vs, aos);
   allocateVoices(vs);
-  makeOperators(&vs->Carrier, aos->Rate);
-  makeOperators(&vs->Modulator, aos->Rate);
+  vs->ModulatorBuffer = makeSamples(aos->BlockFrames);
+  makeRouter(&vs->Router, buses, aos->Channels, aos->BlockFrames);
+  makePolyphase();
+  makeOperators(&vs->Carrier, aos->RenderRate);
+  makeOperators(&vs->Modulator, aos->RenderRate);
+  makeShares(&vs->Modulator.Shares, &vs->Phase, aos->BlockFrames);
   for (; i < vs->N ; i++) {
     v = &vs->All[i];
-    makeVoice(vs, v, carrierBuffer, vs->ModulatorBuffer);
+    makeVoice(vs, v, buses, vs->ModulatorBuffer, aos);
+  }
+  for (i = 0 ; i < DEFAULT_KEYS_NUM ; i++) {
+    makeRoute(&vs->Routes[i]);
   }
   makeKeyboard(&vs->Keyboard, vs->Rate, &vs->Phase);
 }
@@ -285,5 +361,13 @@ killVoices(Voices *vs) {
 
 /* Frees memory allocated during initialization of Voices struct. */
 
+  unsigned int i = 0;
+
+  for (; i < vs->N ; i++) {
+    killCache(&vs->All[i].Cache);
+  }
   free(vs->All);
+  free(vs->ModulatorBuffer);
+  killShares(&vs->Modulator.Shares);
+  killRouter(&vs->Router);
 }
@@ -4,8 +4,10 @@
 #include <stdint.h>
 
 #include "audio-settings.h"
+#include "cache.h"
 #include "constants/defaults.h"
 #include "key.h"
+#include "route.h"
 #include "synthesis.h"
 #include "wave.h"
 
@@ -15,11 +17,14 @@ typedef struct Voice {
  * this, it manages a carrier:modulator pair of Operators whose respective 
  * Pitch value are governed by Voice.Ratio. During every cycle of audio output,
  * the values in Voice.Carrier's buffer are modulated against the values in
- * Voice.Modulator's buffer. */
+ * Voice.Modulator's buffer. The Route of its note decides which output
+ * channels the carrier is summed into. Voice.Cache plays the Voice back from a
+ * loop once it has settled. */
 
   unsigned int  Note;
   Operator      Carrier;
   Operator      Modulator;
+  Cache         Cache;
 } Voice;
 
 typedef struct Voices {
@@ -27,17 +32,23 @@ typedef struct Voices {
 /* Voices is a master struct with an array of all available Voices, plus
  * additional playback information, most of which is self-explanatory.
  * Voices.Amplitude is 1.0 / Voices.N, so that simultaenous playback of all
- * Voices does not clip. Voices.Phase is incremented by the size of
- * DEFAULT_BUFSIZE every time data is written to the soundcard.
+ * Voices does not clip. Voices.Modulation is the modulator level that every
+ * Voice ramps towards. Voices.Phase is incremented by the render block size
+ * every time data is written to the soundcard.
  * It serves as a rough measure of global phase, so that new notes do not start 
  * with a phase of zero. Voices.Keys contains pointers to active Voices in
  * terms of MIDI notes, allowing for easy access when turning a note on/off.
  * Voices.Current cycles through Voices.All looking for free voices to assign
- * new notes to. */
+ * new notes to. Voices.ModulatorBuffer is one render block long, and is
+ * shared by every Voice in turn. Voices.Router holds the output buses that
+ * carriers are summed into, and Voices.Routes the routing of every note.
+ * Routes follow notes rather than Voices, because the Voice a note lands on
+ * cannot be known in advance. */
 
   unsigned int    Current;
   unsigned int    Rate;
   float           Amplitude;
+  float           Modulation;
   size_t          N;
   uint64_t        Phase;
   Operators       Carrier;
@@ -45,15 +56,21 @@ typedef struct Voices {
   Voice         * All;
   Voice         * Active[DEFAULT_KEYS_NUM];
   Keyboard        Keyboard;
-  float           ModulatorBuffer[DEFAULT_BUFSIZE];
+  Router          Router;
+  Route           Routes[DEFAULT_KEYS_NUM];
+  float         * ModulatorBuffer;
 } Voices;
 
 void voiceOn(Voices *, const uint16_t);
 void voiceOff(Voices *, const uint16_t);
-void pollVoice(Voice *);
+void pollVoice(const Voices *, Voice *, const size_t, const size_t);
+void retuneVoices(Voices *);
 void setPitchRatio(Voices *, const bool, const float);
 void setFixedRate(Voices *, const bool, const float);
 void setWaveComplexity(Voices *, const bool, const int);
 void setModulation(Voices *, const float);
+void selectRouteNote(Voices *, const unsigned int);
+void routeNote(Voices *, const int);
+void setNoteGain(Voices *, const float);
 void makeVoices(Voices *, float *, const AudioSettings *);
 void killVoices(Voices *);
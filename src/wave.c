@@ -10,49 +10,27 @@
 #include "constants/maximums.h"
 #include "noise.h"
 #include "numerical.h"
-#include "wavetables/exponential.h"
-#include "wavetables/flat.h"
-#include "wavetables/logarithmic.h"
-#include "wavetables/saw.h"
-#include "wavetables/sine.h"
-#include "wavetables/square.h"
-#include "wavetables/triangle.h"
+#include "wavetable.h"
 
 void
 selectWave(Wave *w, const int wt) {
 
-/* Assigns a WaveType and pointer to wavetable to a Wave. Sets Wave.Polarity
- * according to the sign of "wt". */
+/* Assigns a WaveType and pointers to its wavetables to a Wave. Sets
+ * Wave.Polarity according to the sign of "wt". */
 
   unsigned int uwt = abs(wt);
 
-  switch(uwt) {
-    case WAVE_TYPE_FLAT:
-      w->Table = WAVE_FLATS;
-      break;
-    case WAVE_TYPE_SINE:
-      w->Table = WAVE_SINES;
-      break;
-    case WAVE_TYPE_SQUARE:
-      w->Table = WAVE_SQUARES;
-      break;
-    case WAVE_TYPE_TRIANGLE:
-      w->Table = WAVE_TRIANGLES;
-      break;
-    case WAVE_TYPE_SAW:
-      w->Table = WAVE_SAWS;
-      break;
-    case WAVE_TYPE_EXPONENTIAL:
-      w->Table = WAVE_EXPONENTIALS;
-      break;
-    case WAVE_TYPE_LOGARITHMIC:
-      w->Table = WAVE_LOGARITHMICS;
-      break;
-    case WAVE_TYPE_NOISE:
-      break;
-    default:
-      warnx("Choose a wave between 0 and %d", WAVE_TYPE_NOISE);
-      return;
+  if (uwt >= countWaves()) {
+    warnx("Choose a wave between 0 and %u", countWaves() - 1);
+    return;
+  }
+  if (uwt != WAVE_TYPE_NOISE && getWavetable(uwt) == NULL) {
+    warnx("Nothing has been imported into wave %u yet", uwt);
+    return;
+  }
+  if (uwt != WAVE_TYPE_NOISE) {
+    w->Table = getWavetable(uwt);
+    w->Compact = getCompactWavetable(uwt);
   }
   w->Type = uwt;
   if (wt < 0) {
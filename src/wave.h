@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 #include "noise.h"
 
 typedef enum WaveType {
@@ -19,11 +21,15 @@ typedef enum WaveType {
 typedef struct Wave {
 
 /* A wrapper around the actual wavetable with type information. Wave. Polarity
- * marks the direction a wavetable should be read in. */
+ * marks the direction a wavetable should be read in. Wave.Type may be past
+ * WAVE_TYPE_NOISE, for a wave that was loaded from a -tables file.
+ * Wave.Compact holds 16 bit copies of the same levels in -compact mode, and is
+ * NULL otherwise. */
 
   float            Polarity;
   WaveType         Type;
   const float   ** Table;
+  const int16_t ** Compact;
   Noise            Noise;
 } Wave;
 
@@ -0,0 +1,707 @@
+/* Generates the band-limited wavetables that every Wave reads from, or maps
+ * them from a -tables file. Consult "wavetable.h" for more info. A tables
+ * file begins with a TablesHeader and an index of one TableEntry per wave
+ * number. The tables follow, starting on a TablesHeader.Align boundary, as
+ * floats in host byte order, each wave followed by its 16 bit copies. Every
+ * level of a wave follows the one before it. The file is mapped read-only and
+ * shared, so that every boar process using the same file shares one copy of
+ * the tables in memory, including the copies read with -compact. */
+
+#include <err.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "wavetable.h"
+
+#include "constants/defaults.h"
+#include "constants/errors.h"
+#include "constants/maximums.h"
+#include "numerical.h"
+#include "wave.h"
+
+#define LEVELS_SIZE \
+  ((size_t)DEFAULT_LEVELS * DEFAULT_LEVEL_STRIDE * sizeof(float))
+#define COMPACT_LEVELS_SIZE \
+  ((size_t)DEFAULT_LEVELS * DEFAULT_LEVEL_STRIDE * sizeof(int16_t))
+#define ALIGN_TABLES(n) \
+  ((((n) + DEFAULT_TABLES_ALIGN - 1) / DEFAULT_TABLES_ALIGN) * \
+   DEFAULT_TABLES_ALIGN)
+#define WAVE_SIZE ALIGN_TABLES(LEVELS_SIZE)
+#define COMPACT_SIZE ALIGN_TABLES(COMPACT_LEVELS_SIZE)
+
+typedef struct TablesHeader {
+
+/* Identifies a tables file, and guards against loading one written by a
+ * build with a different table layout. TablesHeader.Waves is the number of
+ * entries in the index. */
+
+  char          Magic[4];
+  uint32_t      Version;
+  uint32_t      Length;
+  uint32_t      Guard;
+  uint32_t      Stride;
+  uint32_t      Levels;
+  uint32_t      Waves;
+  uint32_t      Align;
+} TablesHeader;
+
+typedef struct TableEntry {
+
+/* The places of a wave's first level and of its 16 bit copy in the file, in
+ * bytes from its start. Only the entry for WAVE_TYPE_NOISE, which has no
+ * table, is zero. */
+
+  uint64_t      Offset;
+  uint64_t      CompactOffset;
+} TableEntry;
+
+typedef struct Tables {
+
+/* The image of a tables file, either mapped from disk or generated, along
+ * with a pointer to each level of each wave in it, and to its 16 bit copy in
+ * Tables.CompactLevels. Tables.Compact is set once useCompactTables() has
+ * been called, and only then are the copies handed out. The MAX_IMPORTS
+ * wave numbers after the last wave of the image are slots for imported
+ * waves, whose levels are kept in Tables.Imports and Tables.CompactImports.
+ * Their entries in Tables.Levels are NULL until a wave is installed.
+ * Tables.Installs counts the waves installed so far. */
+
+  void            * Image;
+  size_t            Size;
+  bool              Mapped;
+  unsigned int      Waves;
+  bool              Compact;
+  const float    ** Levels;
+  const int16_t  ** CompactLevels;
+  float           * Imports[MAX_IMPORTS];
+  int16_t         * CompactImports[MAX_IMPORTS];
+  unsigned int      Installs;
+} Tables;
+
+static Tables TABLES = {NULL, 0, false, 0, false, NULL, NULL, {NULL},
+  {NULL}, 0};
+
+static void fft(double *, double *, const size_t, const double);
+static double shape(const WaveType, const double);
+static void bandLimit(float *, const double *, const double *, double *,
+    double *);
+static void makeLevels(float *, const WaveType, double *, double *,
+    double *, double *);
+static void compactLevel(int16_t *, const float *);
+static void compactLevels(int16_t *, const float *);
+static bool isInside(const Tables *, const uint64_t, const size_t,
+    const size_t);
+static size_t dataOffset(const unsigned int);
+static void makeHeader(TablesHeader *, const unsigned int);
+static void * generateTables(size_t *);
+static int indexTables(Tables *);
+static int mapTables(Tables *, const char *);
+static void writeTables(const char *, const void *, const size_t);
+
+static void
+fft(double *re, double *im, const size_t n, const double sign) {
+
+/* An in-place radix-2 fast Fourier transform of n points, where n is a power
+ * of two. A "sign" of -1.0 transforms forward and 1.0 backward. Neither
+ * direction is scaled. */
+
+  size_t i = 0;
+  size_t j = 0;
+  size_t k = 0;
+  size_t len = 2;
+  double t = 0.0;
+  double wr = 0.0;
+  double wi = 0.0;
+  double ur = 0.0;
+  double ui = 0.0;
+  double xr = 0.0;
+  double xi = 0.0;
+
+  for (i = 1 ; i < n ; i++) {
+    for (k = n >> 1 ; j & k ; k >>= 1) {
+      j ^= k;
+    }
+    j |= k;
+    if (i < j) {
+      t = re[i], re[i] = re[j], re[j] = t;
+      t = im[i], im[i] = im[j], im[j] = t;
+    }
+  }
+  for (; len <= n ; len <<= 1) {
+    wr = cos(2.0 * M_PI / (double)len);
+    wi = sign * sin(2.0 * M_PI / (double)len);
+    for (i = 0 ; i < n ; i += len) {
+      ur = 1.0;
+      ui = 0.0;
+      for (k = 0 ; k < len / 2 ; k++) {
+        j = i + k + (len / 2);
+        xr = (re[j] * ur) - (im[j] * ui);
+        xi = (re[j] * ui) + (im[j] * ur);
+        re[j] = re[i + k] - xr;
+        im[j] = im[i + k] - xi;
+        re[i + k] += xr;
+        im[i + k] += xi;
+        t = (ur * wr) - (ui * wi);
+        ui = (ur * wi) + (ui * wr);
+        ur = t;
+      }
+    }
+  }
+}
+
+static double
+shape(const WaveType wt, const double x) {
+
+/* Returns one cycle of each wave, before band-limiting, at a phase "x"
+ * between 0.0 and 1.0. Jumps are given their midpoint, so that they band-limit
+ * symmetrically. */
+
+  switch(wt) {
+    case WAVE_TYPE_FLAT:
+      return 1.0;
+    case WAVE_TYPE_SINE:
+      return sin(2.0 * M_PI * x);
+    case WAVE_TYPE_SQUARE:
+      if (x == 0.0 || x == 0.5) {
+        return 0.0;
+      }
+      return x < 0.5 ? 1.0 : -1.0;
+    case WAVE_TYPE_TRIANGLE:
+      if (x < 0.25) {
+        return 4.0 * x;
+      }
+      return x < 0.75 ? 2.0 - (4.0 * x) : (4.0 * x) - 4.0;
+    case WAVE_TYPE_SAW:
+      return x == 0.0 ? 0.0 : (2.0 * x) - 1.0;
+    case WAVE_TYPE_EXPONENTIAL:
+      return exp(DEFAULT_EXP_CURVE * x);
+    case WAVE_TYPE_LOGARITHMIC:
+      return log(1.0 + (DEFAULT_LOG_CURVE * x));
+    default:
+      return 0.0;
+  }
+}
+
+static void
+bandLimit(float *out, const double *spectrumRe, const double *spectrumIm,
+    double *re, double *im) {
+
+/* Writes DEFAULT_LEVELS tables of the cycle whose unscaled DEFAULT_WAVELEN
+ * point spectrum is "spectrumRe" and "spectrumIm" to "out", which points to
+ * the first sample of the first level. Level L keeps the harmonics up to
+ * 2 * DEFAULT_WAVELEN / 2^(L / DEFAULT_LEVELS_PER_OCTAVE), so each octave of
+ * levels has half the harmonics of the one below it, and can be played an
+ * octave higher without aliasing. Every level is scaled to fill -1.0 to 1.0,
+ * except for a flat one, which has nothing to scale. Each level is then
+ * wrapped in its guard samples. */
+
+  size_t i = 0;
+  size_t g = 1;
+  size_t h = 0;
+  unsigned int level = 0;
+  double lo = 0.0;
+  double hi = 0.0;
+  const size_t n = DEFAULT_WAVELEN;
+
+  for (; level < DEFAULT_LEVELS ; level++, out += DEFAULT_LEVEL_STRIDE) {
+    h = (size_t)((double)(2 * n) / pow(2.0, (double)level /
+          DEFAULT_LEVELS_PER_OCTAVE));
+    if (h > (n / 2) - 1) {
+      h = (n / 2) - 1;
+    }
+    for (i = 0 ; i < n ; i++) {
+      if (i > h && i < n - h) {
+        re[i] = im[i] = 0.0;
+      } else {
+        re[i] = spectrumRe[i];
+        im[i] = spectrumIm[i];
+      }
+    }
+    fft(re, im, n, 1.0);
+    lo = hi = re[0];
+    for (i = 1 ; i < n ; i++) {
+      lo = fmin(lo, re[i]);
+      hi = fmax(hi, re[i]);
+    }
+    for (i = 0 ; i < n ; i++) {
+      out[i] = hi - lo > 1e-9 ?
+        (float)((2.0 * (re[i] - lo) / (hi - lo)) - 1.0) :
+        (float)(re[i] / (double)n);
+    }
+    for (g = 1 ; g <= DEFAULT_GUARD ; g++) {
+      out[-(ptrdiff_t)g] = out[n - g];
+      out[n + g - 1] = out[g - 1];
+    }
+  }
+}
+
+static void
+makeLevels(float *out, const WaveType wt, double *spectrumRe,
+    double *spectrumIm, double *re, double *im) {
+
+/* Writes the levels of a built in wave to "out", like bandLimit(). */
+
+  size_t i = 0;
+  const size_t n = DEFAULT_WAVELEN;
+
+  for (; i < n ; i++) {
+    spectrumRe[i] = shape(wt, (double)i / (double)n);
+    spectrumIm[i] = 0.0;
+  }
+  fft(spectrumRe, spectrumIm, n, -1.0);
+  bandLimit(out, spectrumRe, spectrumIm, re, im);
+}
+
+static void
+compactLevel(int16_t *out, const float *level) {
+
+/* Converts a level and its guard samples to 16 bits. Both point to the first
+ * sample past the guard. */
+
+  ptrdiff_t n = -DEFAULT_GUARD;
+
+  for (; n < DEFAULT_WAVELEN + DEFAULT_GUARD ; n++) {
+    out[n] = (int16_t)lrintf(level[n] * (float)SHRT_MAX);
+  }
+}
+
+static void
+compactLevels(int16_t *out, const float *levels) {
+
+/* Converts every level of a wave to 16 bits, like compactLevel(). Both point
+ * to the first sample past the guard of the first level. */
+
+  unsigned int level = 0;
+
+  for (; level < DEFAULT_LEVELS ; level++) {
+    compactLevel(out + (level * DEFAULT_LEVEL_STRIDE),
+        levels + (level * DEFAULT_LEVEL_STRIDE));
+  }
+}
+
+static bool
+isInside(const Tables *t, const uint64_t offset, const size_t size,
+    const size_t start) {
+
+/* Returns whether "size" bytes at "offset" lie past "start", on an alignment
+ * boundary, and within the image in Tables.Image. */
+
+  return offset >= start && offset % DEFAULT_TABLES_ALIGN == 0 &&
+    t->Size >= size && offset <= t->Size - size;
+}
+
+static size_t
+dataOffset(const unsigned int waves) {
+
+/* Returns where the tables begin in a file with "waves" index entries. */
+
+  return ALIGN_TABLES(sizeof(TablesHeader) + (waves * sizeof(TableEntry)));
+}
+
+static void
+makeHeader(TablesHeader *h, const unsigned int waves) {
+
+/* Fills in the header of a tables file. */
+
+  memcpy(h->Magic, "BTAB", sizeof(h->Magic));
+  h->Version = DEFAULT_TABLES_VERSION;
+  h->Length = DEFAULT_WAVELEN;
+  h->Guard = DEFAULT_GUARD;
+  h->Stride = DEFAULT_LEVEL_STRIDE;
+  h->Levels = DEFAULT_LEVELS;
+  h->Waves = waves;
+  h->Align = DEFAULT_TABLES_ALIGN;
+}
+
+static void *
+generateTables(size_t *size) {
+
+/* Returns the image of a tables file holding every level of every built in
+ * wave and its 16 bit copy, and stores its length in "size". */
+
+  WaveType wt = WAVE_TYPE_FLAT;
+  const unsigned int waves = WAVE_TYPE_NOISE + 1;
+  const size_t start = dataOffset(waves);
+  unsigned char *image = NULL;
+  TableEntry *index = NULL;
+  float *levels = NULL;
+  double *scratch = calloc(4 * DEFAULT_WAVELEN, sizeof(*scratch));
+
+  *size = start + (WAVE_TYPE_NOISE * (WAVE_SIZE + COMPACT_SIZE));
+  if (scratch == NULL ||
+      posix_memalign((void **)&image, DEFAULT_TABLES_ALIGN, *size) != 0) {
+    errx(ERROR_ALLOC, "Error allocating wavetables");
+  }
+  memset(image, 0, *size);
+  makeHeader((TablesHeader *)image, waves);
+  index = (TableEntry *)(image + sizeof(TablesHeader));
+  for (; wt < WAVE_TYPE_NOISE ; wt++) {
+    index[wt].Offset = start + (wt * (WAVE_SIZE + COMPACT_SIZE));
+    index[wt].CompactOffset = index[wt].Offset + WAVE_SIZE;
+    levels = (float *)(image + index[wt].Offset) + DEFAULT_GUARD;
+    makeLevels(levels, wt, scratch, scratch + DEFAULT_WAVELEN,
+        scratch + (2 * DEFAULT_WAVELEN), scratch + (3 * DEFAULT_WAVELEN));
+    compactLevels((int16_t *)(image + index[wt].CompactOffset) +
+        DEFAULT_GUARD, levels);
+  }
+  free(scratch);
+  return image;
+}
+
+static int
+indexTables(Tables *t) {
+
+/* Checks the image in Tables.Image and points Tables.Levels and
+ * Tables.CompactLevels at the levels of each wave in it. Returns 0 on
+ * success, or -1 if the image is not a tables file for this version of boar,
+ * or any entry of its index is out of bounds. */
+
+  const unsigned char *image = t->Image;
+  const TableEntry *index = NULL;
+  TablesHeader h = {{0}};
+  TablesHeader expected = {{0}};
+  unsigned int i = 0;
+  unsigned int level = 0;
+  size_t n = 0;
+
+  if (t->Size < sizeof(h)) {
+    return -1;
+  }
+  memcpy(&h, image, sizeof(h));
+  makeHeader(&expected, h.Waves);
+  if (memcmp(&h, &expected, sizeof(h)) != 0 || h.Waves <= WAVE_TYPE_NOISE ||
+      h.Waves > MAX_WAVES || t->Size < dataOffset(h.Waves)) {
+    return -1;
+  }
+  index = (const TableEntry *)(image + sizeof(h));
+  for (; i < h.Waves ; i++) {
+    if (i != WAVE_TYPE_NOISE &&
+        (!isInside(t, index[i].Offset, LEVELS_SIZE, dataOffset(h.Waves)) ||
+         !isInside(t, index[i].CompactOffset, COMPACT_LEVELS_SIZE,
+           dataOffset(h.Waves)))) {
+      return -1;
+    }
+  }
+  t->Waves = h.Waves;
+  t->Levels = calloc((size_t)(h.Waves + MAX_IMPORTS) * DEFAULT_LEVELS,
+      sizeof(*t->Levels));
+  t->CompactLevels = calloc((size_t)(h.Waves + MAX_IMPORTS) * DEFAULT_LEVELS,
+      sizeof(*t->CompactLevels));
+  if (t->Levels == NULL || t->CompactLevels == NULL) {
+    errx(ERROR_ALLOC, "Error allocating wavetable index");
+  }
+  for (i = 0 ; i < h.Waves ; i++) {
+    for (level = 0 ; i != WAVE_TYPE_NOISE && level < DEFAULT_LEVELS ;
+        level++) {
+      n = (level * DEFAULT_LEVEL_STRIDE) + DEFAULT_GUARD;
+      t->Levels[(i * DEFAULT_LEVELS) + level] = (const float *)(image +
+          index[i].Offset) + n;
+      t->CompactLevels[(i * DEFAULT_LEVELS) + level] =
+        (const int16_t *)(image + index[i].CompactOffset) + n;
+    }
+  }
+  return 0;
+}
+
+static int
+mapTables(Tables *t, const char *path) {
+
+/* Maps a tables file into memory and indexes it. Returns 0 on success, or -1
+ * if the file is missing or not a tables file for this version of boar. */
+
+  struct stat st;
+  int fd = open(path, O_RDONLY);
+
+  if (fd < 0) {
+    return -1;
+  }
+  if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+    close(fd);
+    return -1;
+  }
+  t->Size = (size_t)st.st_size;
+  t->Image = mmap(NULL, t->Size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (t->Image == MAP_FAILED) {
+    t->Image = NULL;
+    return -1;
+  }
+  if (indexTables(t) < 0) {
+    munmap(t->Image, t->Size);
+    t->Image = NULL;
+    return -1;
+  }
+  t->Mapped = true;
+  return 0;
+}
+
+static void
+writeTables(const char *path, const void *image, const size_t size) {
+
+/* Saves an image to a tables file. It is written beside "path" and renamed
+ * into place, so that another boar starting at the same time never maps a
+ * partial file. Failing to write it only costs the next run the time to
+ * generate the tables again, so errors are not fatal. */
+
+  char tmp[PATH_MAX] = {0};
+  int fd = -1;
+
+  if (snprintf(tmp, sizeof(tmp), "%s.%ld", path, (long)getpid()) >=
+      (int)sizeof(tmp)) {
+    warnx("Tables file path is too long: %s", path);
+    return;
+  }
+  fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    warn("Error opening tables file %s", tmp);
+    return;
+  }
+  if (write(fd, image, size) != (ssize_t)size) {
+    warn("Error writing tables file %s", tmp);
+    close(fd);
+    unlink(tmp);
+    return;
+  }
+  close(fd);
+  if (rename(tmp, path) < 0) {
+    warn("Error replacing tables file %s", path);
+    unlink(tmp);
+  }
+}
+
+const float **
+getWavetable(const unsigned int wt) {
+
+/* Returns the DEFAULT_LEVELS levels of a wave, lowest level first, or NULL
+ * if the wave has no table. That includes import slots that are still
+ * empty. */
+
+  if (TABLES.Levels == NULL || wt >= countWaves() || wt == WAVE_TYPE_NOISE ||
+      TABLES.Levels[(size_t)wt * DEFAULT_LEVELS] == NULL) {
+    return NULL;
+  }
+  return TABLES.Levels + ((size_t)wt * DEFAULT_LEVELS);
+}
+
+const int16_t **
+getCompactWavetable(const unsigned int wt) {
+
+/* Returns the 16 bit copies of the levels of a wave in -compact mode, or
+ * NULL otherwise, or if there are none. */
+
+  if (!TABLES.Compact || getWavetable(wt) == NULL) {
+    return NULL;
+  }
+  return TABLES.CompactLevels + ((size_t)wt * DEFAULT_LEVELS);
+}
+
+unsigned int
+countWaves(void) {
+
+/* Returns the number of wave numbers, including noise and the import
+ * slots. */
+
+  return TABLES.Waves + MAX_IMPORTS;
+}
+
+unsigned int
+firstImport(void) {
+
+/* Returns the wave number of the first import slot. */
+
+  return TABLES.Waves;
+}
+
+void
+makeWavetables(const char *path) {
+
+/* Maps the wavetables from "path" if it holds tables written by this version
+ * of boar. Otherwise the built in waves are generated. If there is no file
+ * at "path", they are saved to it for the next run and for other boar
+ * processes. An existing file is never overwritten, since it may hold waves
+ * that boar can not generate. Must be called before any Wave is selected. */
+
+  void *image = NULL;
+  size_t size = 0;
+
+  if (path != NULL && mapTables(&TABLES, path) == 0) {
+    return;
+  }
+  image = generateTables(&size);
+  if (path != NULL && access(path, F_OK) == 0) {
+    warnx("Not a tables file for this version of boar: %s", path);
+  } else if (path != NULL) {
+    writeTables(path, image, size);
+    if (mapTables(&TABLES, path) == 0) {
+      free(image);
+      return;
+    }
+  }
+  TABLES.Image = image;
+  TABLES.Size = size;
+  if (indexTables(&TABLES) < 0) {
+    errx(ERROR_ALLOC, "Error indexing wavetables");
+  }
+}
+
+void
+useCompactTables(void) {
+
+/* Has Waves selected from now on read the 16 bit copies of their levels, at
+ * half the size of the float tables, so that more of the tables that are
+ * playing fit in the processor's caches. The copies are part of the tables
+ * image, so a mapped -tables file shares them between processes too. */
+
+  TABLES.Compact = true;
+}
+
+float *
+levelCycle(const float *cycle, const size_t length) {
+
+/* Returns the DEFAULT_LEVELS levels of one cycle of "length" samples, laid
+ * out like the levels of a wave in a tables file, including guard samples.
+ * The cycle is resampled to DEFAULT_WAVELEN through its spectrum, which
+ * drops any harmonics that do not fit. Uses no global state, so that it can
+ * run on any thread. Returns NULL if memory runs out. */
+
+  size_t i = 0;
+  size_t k = 0;
+  const size_t n = DEFAULT_WAVELEN;
+  const size_t harmonics = LESSER((length + 1) / 2, n / 2);
+  const double scale = (double)n / (double)length;
+  float *levels = calloc(DEFAULT_LEVELS * DEFAULT_LEVEL_STRIDE,
+      sizeof(*levels));
+  double *scratch = calloc((4 * n) + (2 * length), sizeof(*scratch));
+  double *spectrumRe = scratch;
+  double *spectrumIm = scratch + n;
+  double *cosines = scratch + (4 * n);
+  double *sines = cosines + length;
+
+  if (levels == NULL || scratch == NULL) {
+    free(levels);
+    free(scratch);
+    return NULL;
+  }
+  if (length == n) {
+    for (i = 0 ; i < n ; i++) {
+      spectrumRe[i] = cycle[i];
+    }
+    fft(spectrumRe, spectrumIm, n, -1.0);
+  } else {
+    for (i = 0 ; i < length ; i++) {
+      cosines[i] = cos(2.0 * M_PI * (double)i / (double)length);
+      sines[i] = sin(2.0 * M_PI * (double)i / (double)length);
+    }
+    for (k = 0 ; k < harmonics ; k++) {
+      for (i = 0 ; i < length ; i++) {
+        spectrumRe[k] += cycle[i] * cosines[(i * k) % length] * scale;
+        spectrumIm[k] -= cycle[i] * sines[(i * k) % length] * scale;
+      }
+      if (k > 0) {
+        spectrumRe[n - k] = spectrumRe[k];
+        spectrumIm[n - k] = -spectrumIm[k];
+      }
+    }
+  }
+  bandLimit(levels + DEFAULT_GUARD, spectrumRe, spectrumIm, scratch + (2 * n),
+      scratch + (3 * n));
+  free(scratch);
+  return levels;
+}
+
+int16_t *
+compactCycle(const float *levels) {
+
+/* Returns 16 bit copies of levels from levelCycle() in -compact mode, or NULL
+ * otherwise, or if memory runs out. */
+
+  int16_t *out = NULL;
+
+  if (!TABLES.Compact) {
+    return NULL;
+  }
+  out = malloc(DEFAULT_LEVELS * DEFAULT_LEVEL_STRIDE * sizeof(*out));
+  if (out != NULL) {
+    compactLevels(out + DEFAULT_GUARD, levels + DEFAULT_GUARD);
+  }
+  return out;
+}
+
+void
+installWave(const unsigned int wt, float *levels, int16_t *compact) {
+
+/* Makes levels from levelCycle(), and their copies from compactCycle(), the
+ * tables of import slot "wt", and frees the ones it had before. Waves that
+ * already read the slot read the new tables from their next block on, since
+ * they point at the slot's entries in Tables.Levels. Must run on the audio
+ * thread between blocks. */
+
+  const unsigned int slot = wt - TABLES.Waves;
+  const size_t base = (size_t)wt * DEFAULT_LEVELS;
+  unsigned int level = 0;
+
+  if (wt < TABLES.Waves || slot >= MAX_IMPORTS) {
+    free(levels);
+    free(compact);
+    return;
+  }
+  for (; level < DEFAULT_LEVELS ; level++) {
+    TABLES.Levels[base + level] = levels + (level * DEFAULT_LEVEL_STRIDE) +
+      DEFAULT_GUARD;
+    if (TABLES.CompactLevels != NULL) {
+      TABLES.CompactLevels[base + level] = compact == NULL ? NULL :
+        compact + (level * DEFAULT_LEVEL_STRIDE) + DEFAULT_GUARD;
+    }
+  }
+  free(TABLES.Imports[slot]);
+  free(TABLES.CompactImports[slot]);
+  TABLES.Imports[slot] = levels;
+  TABLES.CompactImports[slot] = compact;
+  TABLES.Installs++;
+}
+
+unsigned int
+countInstalls(void) {
+
+/* Returns the number of waves installed into import slots so far, so that
+ * anything made from the tables can tell when one of them has changed. */
+
+  return TABLES.Installs;
+}
+
+void
+killWavetables(void) {
+
+/* Unmaps or frees the wavetables, including imported ones. */
+
+  unsigned int i = 0;
+
+  for (; i < MAX_IMPORTS ; i++) {
+    free(TABLES.Imports[i]);
+    free(TABLES.CompactImports[i]);
+    TABLES.Imports[i] = NULL;
+    TABLES.CompactImports[i] = NULL;
+  }
+  if (TABLES.Mapped) {
+    munmap(TABLES.Image, TABLES.Size);
+  } else {
+    free(TABLES.Image);
+  }
+  free(TABLES.Levels);
+  free(TABLES.CompactLevels);
+  TABLES.Image = NULL;
+  TABLES.Levels = NULL;
+  TABLES.Compact = false;
+  TABLES.CompactLevels = NULL;
+  TABLES.Waves = 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wave.h"
+
+const float ** getWavetable(const unsigned int);
+const int16_t ** getCompactWavetable(const unsigned int);
+unsigned int countWaves(void);
+unsigned int firstImport(void);
+void makeWavetables(const char *);
+void useCompactTables(void);
+float * levelCycle(const float *, const size_t);
+int16_t * compactCycle(const float *);
+void installWave(const unsigned int, float *, int16_t *);
+unsigned int countInstalls(void);
+void killWavetables(void);
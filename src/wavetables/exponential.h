@@ -1,4152 +0,0 @@
-/* A wave of e^x ∈ [-π,π]. Intended for envelope use, but can be played. */
-
-#pragma once
-
-#include "../constants/defaults.h"
-
-static const float WAVE_EXPONENTIAL_000[DEFAULT_WAVELEN] = {
-    -1, -0.977701, -0.955501, -0.94916, -0.945262, -0.936113,
-    -0.952166, -0.933655, -0.951164, -0.937045, -0.946275, -0.942402,
-    -0.941204, -0.946429, -0.938571, -0.947394, -0.939116, -0.94553,
-    -0.94177, -0.942507, -0.944562, -0.940284, -0.945831, -0.940001,
-    -0.945082, -0.941488, -0.943072, -0.943566, -0.941184, -0.944881,
-    -0.940531, -0.94472, -0.941339, -0.943351, -0.942919, -0.941746,
-    -0.944192, -0.940908, -0.944387, -0.941264, -0.943478, -0.942456,
-    -0.942125, -0.943643, -0.941202, -0.944066, -0.941236, -0.943509,
-    -0.942107, -0.942389, -0.943182, -0.941443, -0.943749, -0.941241,
-    -0.94347, -0.94184, -0.942568, -0.942785, -0.941644, -0.943435,
-    -0.941271, -0.943379, -0.941635, -0.942681, -0.942439, -0.94181,
-    -0.943126, -0.941318, -0.943246, -0.94148, -0.942737, -0.942137,
-    -0.941945, -0.942824, -0.941375, -0.94308, -0.941365, -0.942746,
-    -0.941875, -0.942048, -0.942532, -0.941438, -0.942889, -0.941285,
-    -0.942711, -0.941649, -0.942121, -0.942252, -0.9415, -0.942677,
-    -0.941231, -0.942638, -0.941456, -0.942162, -0.941988, -0.941557,
-    -0.942452, -0.9412, -0.942532, -0.941294, -0.942172, -0.941741,
-    -0.941604, -0.942219, -0.941185, -0.942397, -0.941161, -0.942152,
-    -0.941514, -0.941638, -0.941982, -0.94118, -0.942237, -0.941053,
-    -0.942101, -0.941307, -0.941656, -0.941746, -0.941182, -0.942056,
-    -0.940967, -0.942022, -0.941122, -0.941655, -0.941514, -0.941184,
-    -0.94186, -0.940899, -0.941916, -0.940958, -0.941632, -0.941292,
-    -0.941184, -0.941653, -0.940846, -0.941785, -0.940815, -0.941587,
-    -0.94108, -0.941176, -0.941439, -0.940804, -0.941633, -0.940691,
-    -0.941519, -0.940881, -0.941157, -0.941221, -0.940768, -0.941462,
-    -0.940584, -0.941427, -0.940698, -0.941124, -0.941004, -0.940735,
-    -0.941276, -0.940493, -0.941314, -0.940529, -0.941076, -0.940791,
-    -0.940701, -0.941078, -0.940414, -0.941179, -0.940377, -0.941009,
-    -0.940585, -0.940662, -0.940872, -0.940345, -0.941026, -0.94024,
-    -0.940924, -0.940388, -0.940615, -0.940662, -0.940281, -0.940855,
-    -0.940117, -0.940819, -0.940201, -0.940557, -0.940449, -0.940221,
-    -0.94067, -0.940007, -0.940695, -0.940027, -0.940486, -0.940238,
-    -0.94016, -0.940473, -0.939907, -0.940552, -0.939865, -0.9404,
-    -0.940032, -0.940095, -0.940268, -0.939815, -0.940391, -0.939715,
-    -0.940297, -0.939831, -0.940024, -0.940057, -0.939728, -0.940216,
-    -0.939576, -0.940177, -0.939639, -0.939943, -0.939844, -0.939644,
-    -0.940026, -0.939448, -0.94004, -0.939456, -0.939851, -0.93963,
-    -0.939559, -0.939826, -0.939329, -0.939886, -0.939283, -0.939746,
-    -0.939419, -0.939471, -0.939616, -0.939217, -0.939716, -0.939119,
-    -0.939625, -0.939212, -0.939378, -0.939401, -0.939109, -0.939532,
-    -0.938966, -0.93949, -0.939011, -0.939276, -0.939182, -0.939002,
-    -0.939334, -0.93882, -0.939338, -0.938817, -0.939163, -0.938961,
-    -0.938896, -0.939126, -0.938682, -0.939171, -0.938631, -0.939038,
-    -0.938742, -0.938786, -0.938909, -0.93855, -0.938989, -0.938453,
-    -0.9389, -0.938526, -0.93867, -0.938685, -0.938421, -0.938793,
-    -0.938283, -0.938748, -0.938314, -0.938547, -0.938457, -0.938293,
-    -0.938585, -0.93812, -0.93858, -0.938107, -0.938414, -0.938227,
-    -0.938165, -0.938366, -0.937963, -0.938398, -0.937907, -0.93827,
-    -0.937997, -0.938033, -0.938138, -0.93781, -0.938202, -0.937713,
-    -0.938113, -0.937769, -0.937896, -0.937903, -0.937661, -0.937992,
-    -0.937526, -0.937942, -0.937543, -0.937752, -0.937664, -0.937511,
-    -0.937771, -0.937344, -0.937758, -0.937322, -0.937598, -0.937421,
-    -0.937361, -0.937538, -0.937167, -0.937559, -0.937106, -0.937433,
-    -0.937178, -0.937207, -0.937297, -0.936994, -0.937346, -0.936894,
-    -0.937256, -0.936935, -0.937048, -0.937048, -0.936822, -0.937121,
-    -0.936688, -0.937065, -0.936694, -0.936881, -0.936794, -0.936651,
-    -0.936883, -0.936487, -0.936862, -0.936456, -0.936705, -0.936537,
-    -0.936478, -0.936635, -0.936289, -0.936644, -0.936222, -0.936519,
-    -0.936278, -0.936301, -0.936377, -0.936094, -0.936413, -0.935992,
-    -0.93632, -0.936018, -0.936119, -0.936113, -0.9359, -0.936169,
-    -0.935765, -0.936109, -0.935759, -0.935929, -0.935842, -0.935705,
-    -0.935914, -0.935542, -0.935884, -0.935503, -0.935729, -0.935567,
-    -0.935508, -0.935647, -0.935322, -0.935646, -0.935249, -0.935519,
-    -0.93529, -0.935307, -0.935372, -0.935104, -0.935395, -0.934997,
-    -0.935298, -0.935011, -0.9351, -0.935088, -0.934885, -0.93513,
-    -0.934749, -0.935064, -0.934732, -0.934885, -0.934798, -0.934666,
-    -0.934854, -0.934503, -0.934816, -0.934454, -0.934661, -0.934503,
-    -0.934444, -0.934567, -0.934259, -0.934555, -0.934178, -0.934426,
-    -0.934205, -0.934217, -0.934271, -0.934015, -0.934281, -0.933904,
-    -0.93418, -0.933905, -0.933984, -0.933966, -0.933771, -0.933994,
-    -0.933631, -0.933921, -0.933604, -0.933742, -0.933654, -0.933525,
-    -0.933695, -0.93336, -0.933648, -0.933302, -0.933492, -0.933336,
-    -0.933276, -0.933385, -0.93309, -0.933363, -0.933002, -0.93323,
-    -0.933015, -0.933021, -0.933065, -0.932819, -0.933063, -0.932702,
-    -0.932957, -0.932691, -0.93276, -0.932736, -0.932547, -0.932751,
-    -0.932403, -0.93267, -0.932364, -0.93249, -0.932399, -0.932273,
-    -0.932427, -0.932104, -0.932371, -0.932037, -0.932211, -0.932057,
-    -0.931994, -0.932091, -0.931806, -0.932057, -0.93171, -0.93192,
-    -0.931709, -0.93171, -0.931744, -0.931506, -0.931731, -0.931382,
-    -0.931617, -0.931358, -0.931418, -0.931388, -0.931204, -0.93139,
-    -0.931054, -0.931301, -0.931004, -0.931118, -0.931024, -0.930899,
-    -0.931038, -0.930726, -0.930972, -0.930648, -0.930807, -0.930654,
-    -0.930589, -0.930673, -0.930396, -0.930628, -0.930291, -0.930485,
-    -0.930277, -0.930272, -0.930297, -0.930065, -0.930271, -0.929933,
-    -0.93015, -0.929896, -0.929948, -0.929911, -0.92973, -0.9299,
-    -0.929573, -0.929802, -0.929512, -0.929614, -0.929517, -0.929391,
-    -0.929516, -0.929212, -0.92944, -0.929124, -0.929269, -0.929115,
-    -0.929047, -0.92912, -0.928849, -0.929063, -0.928734, -0.928913,
-    -0.928707, -0.928695, -0.928711, -0.928483, -0.928673, -0.928342,
-    -0.928543, -0.928293, -0.928335, -0.928293, -0.928113, -0.928268,
-    -0.927948, -0.92816, -0.927874, -0.927965, -0.927865, -0.927738,
-    -0.927849, -0.927551, -0.927762, -0.927452, -0.927584, -0.927428,
-    -0.927356, -0.927418, -0.927151, -0.927349, -0.927026, -0.92719,
-    -0.926984, -0.926967, -0.926974, -0.926747, -0.926922, -0.926597,
-    -0.926782, -0.926534, -0.926568, -0.926518, -0.926339, -0.926479,
-    -0.926165, -0.92636, -0.926078, -0.926158, -0.926053, -0.925924,
-    -0.926023, -0.925729, -0.925923, -0.925617, -0.925737, -0.925578,
-    -0.925502, -0.925552, -0.925288, -0.925471, -0.925152, -0.925302,
-    -0.925095, -0.925071, -0.925069, -0.924844, -0.925003, -0.924682,
-    -0.924853, -0.924605, -0.92463, -0.924573, -0.924393, -0.924519,
-    -0.924208, -0.924389, -0.924108, -0.924178, -0.924067, -0.923935,
-    -0.924021, -0.923729, -0.923909, -0.923605, -0.923712, -0.92355,
-    -0.923468, -0.923508, -0.923245, -0.923413, -0.923096, -0.923233,
-    -0.923024, -0.922993, -0.922981, -0.922755, -0.9229, -0.922582,
-    -0.922738, -0.922489, -0.922505, -0.922441, -0.922258, -0.922372,
-    -0.922062, -0.922228, -0.921947, -0.922006, -0.921889, -0.921753,
-    -0.921827, -0.921536, -0.921701, -0.921397, -0.921493, -0.921326,
-    -0.921239, -0.921267, -0.921004, -0.921157, -0.920841, -0.920965,
-    -0.920752, -0.920714, -0.920693, -0.920465, -0.920596, -0.920278,
-    -0.920421, -0.920169, -0.920176, -0.920104, -0.919918, -0.920018,
-    -0.919708, -0.91986, -0.919577, -0.919625, -0.919502, -0.919361,
-    -0.919423, -0.919131, -0.919281, -0.918976, -0.91906, -0.918888,
-    -0.918794, -0.918811, -0.918546, -0.918685, -0.918368, -0.918478,
-    -0.918262, -0.918215, -0.918184, -0.917953, -0.91807, -0.917751,
-    -0.91788, -0.917625, -0.917623, -0.917541, -0.917351, -0.917438,
-    -0.917126, -0.917264, -0.916978, -0.917016, -0.916884, -0.916738,
-    -0.916787, -0.916493, -0.916629, -0.916321, -0.916393, -0.916214,
-    -0.916113, -0.916119, -0.915851, -0.915975, -0.915655, -0.915753,
-    -0.915531, -0.915475, -0.915434, -0.915199, -0.915302, -0.91498,
-    -0.915095, -0.914835, -0.914823, -0.914732, -0.914536, -0.914609,
-    -0.914295, -0.914418, -0.914128, -0.914154, -0.914015, -0.913861,
-    -0.913898, -0.9136, -0.913721, -0.91341, -0.913469, -0.913283,
-    -0.913173, -0.913167, -0.912894, -0.913004, -0.912681, -0.912765,
-    -0.912536, -0.912471, -0.912419, -0.912178, -0.912267, -0.911941,
-    -0.912042, -0.911776, -0.911753, -0.911652, -0.911449, -0.911509,
-    -0.91119, -0.911299, -0.911003, -0.911018, -0.910868, -0.910707,
-    -0.91073, -0.910427, -0.910534, -0.910217, -0.910264, -0.910068,
-    -0.90995, -0.909932, -0.909653, -0.909748, -0.909419, -0.90949,
-    -0.909253, -0.909177, -0.909113, -0.908866, -0.90894, -0.908608,
-    -0.908696, -0.908422, -0.908387, -0.908275, -0.908064, -0.90811,
-    -0.907785, -0.907879, -0.907576, -0.907579, -0.907419, -0.907248,
-    -0.907258, -0.906948, -0.907041, -0.906716, -0.90675, -0.906544,
-    -0.906416, -0.906384, -0.906098, -0.906179, -0.905842, -0.905899,
-    -0.905653, -0.905566, -0.905489, -0.905233, -0.905293, -0.904954,
-    -0.905027, -0.904744, -0.904697, -0.904573, -0.904353, -0.904384,
-    -0.904051, -0.904131, -0.903819, -0.903808, -0.903637, -0.903456,
-    -0.903452, -0.903133, -0.90321, -0.902877, -0.902897, -0.902681,
-    -0.902541, -0.902495, -0.9022, -0.902265, -0.90192, -0.901963,
-    -0.901705, -0.901607, -0.901516, -0.901251, -0.901295, -0.900947,
-    -0.901005, -0.900711, -0.900652, -0.900514, -0.900284, -0.9003,
-    -0.899957, -0.900021, -0.899699, -0.899674, -0.89949, -0.899298,
-    -0.899278, -0.89895, -0.899012, -0.898668, -0.898673, -0.898444,
-    -0.898293, -0.898232, -0.897926, -0.897975, -0.89762, -0.897647,
-    -0.897377, -0.897266, -0.897161, -0.896884, -0.896912, -0.896553,
-    -0.896595, -0.896289, -0.896216, -0.896064, -0.895822, -0.895821,
-    -0.895468, -0.895516, -0.895181, -0.895142, -0.894944, -0.894739,
-    -0.894703, -0.894364, -0.894408, -0.894053, -0.894042, -0.8938,
-    -0.893634, -0.893558, -0.89324, -0.893272, -0.892904, -0.892915,
-    -0.892632, -0.892506, -0.892385, -0.892095, -0.892107, -0.891735,
-    -0.89176, -0.891441, -0.891353, -0.891185, -0.890929, -0.890912,
-    -0.890545, -0.890576, -0.890228, -0.890173, -0.889959, -0.88974,
-    -0.889687, -0.889334, -0.889362, -0.888992, -0.888965, -0.888707,
-    -0.888527, -0.888433, -0.888101, -0.888116, -0.887734, -0.887728,
-    -0.887429, -0.887287, -0.887149, -0.886845, -0.886839, -0.886452,
-    -0.88646, -0.886126, -0.88602, -0.885836, -0.885565, -0.88553,
-    -0.885148, -0.885161, -0.884797, -0.884725, -0.884494, -0.884259,
-    -0.884188, -0.88382, -0.883829, -0.883443, -0.883399, -0.883123,
-    -0.882927, -0.882815, -0.882467, -0.882463, -0.882064, -0.882041,
-    -0.881724, -0.881565, -0.881409, -0.881088, -0.881063, -0.88066,
-    -0.880649, -0.880297, -0.880174, -0.879971, -0.879683, -0.879628,
-    -0.87923, -0.879224, -0.878842, -0.878752, -0.878502, -0.87825,
-    -0.878159, -0.877773, -0.877762, -0.877359, -0.877296, -0.877001,
-    -0.876786, -0.876655, -0.876289, -0.876265, -0.875848, -0.875805,
-    -0.87547, -0.875292, -0.875115, -0.874777, -0.874731, -0.874309,
-    -0.874278, -0.873907, -0.873765, -0.873541, -0.873234, -0.873159,
-    -0.872741, -0.872714, -0.872313, -0.872203, -0.871933, -0.871661,
-    -0.871549, -0.871144, -0.871112, -0.870689, -0.870604, -0.870289,
-    -0.870054, -0.869901, -0.869516, -0.86947, -0.869033, -0.868968,
-    -0.868612, -0.868414, -0.868215, -0.867856, -0.867788, -0.867346,
-    -0.867293, -0.8669, -0.866737, -0.866491, -0.866163, -0.866065,
-    -0.865627, -0.865578, -0.865155, -0.865022, -0.86473, -0.864436,
-    -0.864302, -0.863875, -0.86382, -0.863375, -0.863268, -0.86293,
-    -0.862673, -0.862497, -0.862089, -0.86202, -0.86156, -0.861473,
-    -0.861093, -0.860872, -0.86065, -0.860268, -0.860176, -0.859711,
-    -0.859635, -0.859218, -0.859032, -0.858762, -0.858411, -0.858289,
-    -0.857826, -0.857753, -0.857306, -0.85715, -0.856832, -0.856515,
-    -0.856356, -0.855905, -0.855826, -0.855355, -0.855225, -0.854861,
-    -0.85458, -0.854378, -0.853946, -0.853852, -0.853367, -0.853255,
-    -0.852849, -0.852604, -0.852356, -0.851948, -0.851831, -0.85134,
-    -0.851239, -0.850795, -0.850584, -0.850287, -0.84991, -0.849762,
-    -0.849273, -0.849175, -0.8487, -0.848518, -0.848174, -0.84783,
-    -0.847644, -0.847166, -0.847061, -0.846563, -0.846406, -0.846015,
-    -0.845707, -0.845478, -0.845018, -0.844897, -0.844383, -0.844245,
-    -0.84381, -0.843538, -0.843262, -0.842826, -0.842682, -0.842161,
-    -0.842033, -0.84156, -0.841321, -0.840996, -0.84059, -0.840414,
-    -0.839895, -0.839769, -0.839264, -0.839055, -0.83868, -0.838308,
-    -0.838093, -0.837585, -0.837451, -0.836922, -0.836737, -0.836315,
-    -0.835978, -0.835719, -0.835228, -0.835079, -0.834534, -0.834366,
-    -0.8339, -0.833598, -0.833291, -0.832825, -0.83265, -0.832098,
-    -0.83194, -0.831435, -0.831166, -0.830809, -0.830372, -0.830165,
-    -0.829613, -0.829457, -0.828919, -0.828679, -0.828272, -0.827868,
-    -0.827621, -0.82708, -0.826916, -0.826352, -0.826136, -0.82568,
-    -0.825311, -0.82502, -0.824495, -0.824314, -0.823734, -0.823535,
-    -0.823034, -0.8227, -0.822359, -0.821859, -0.821652, -0.821064,
-    -0.820874, -0.820333, -0.820031, -0.819639, -0.819168, -0.818927,
-    -0.81834, -0.818151, -0.817576, -0.817303, -0.81686, -0.816421,
-    -0.81614, -0.815562, -0.815364, -0.814763, -0.814514, -0.814021,
-    -0.813616, -0.813289, -0.812727, -0.812512, -0.811893, -0.811661,
-    -0.811121, -0.810751, -0.810373, -0.809835, -0.809593, -0.808966,
-    -0.808742, -0.808161, -0.807823, -0.807393, -0.806884, -0.806607,
-    -0.805979, -0.805755, -0.80514, -0.804831, -0.804348, -0.803871,
-    -0.803552, -0.802933, -0.802699, -0.802056, -0.80177, -0.801236,
-    -0.800794, -0.800427, -0.799825, -0.799572, -0.798911, -0.798641,
-    -0.798059, -0.79765, -0.797232, -0.796653, -0.796372, -0.795701,
-    -0.795439, -0.794815, -0.794439, -0.793966, -0.793415, -0.793099,
-    -0.792427, -0.792164, -0.791504, -0.791155, -0.790629, -0.79011,
-    -0.78975, -0.789087, -0.788813, -0.788125, -0.787799, -0.78722,
-    -0.786735, -0.786326, -0.785678, -0.785385, -0.784677, -0.784366,
-    -0.783738, -0.783287, -0.782824, -0.782199, -0.781877, -0.781158,
-    -0.780855, -0.780183, -0.779763, -0.779245, -0.778648, -0.778288,
-    -0.777568, -0.777263, -0.776554, -0.776162, -0.775588, -0.775023,
-    -0.774618, -0.773905, -0.773589, -0.77285, -0.77248, -0.771852,
-    -0.77132, -0.770865, -0.770167, -0.76983, -0.76907, -0.768715,
-    -0.768036, -0.767538, -0.767027, -0.766352, -0.765984, -0.765213,
-    -0.764864, -0.76414, -0.763673, -0.763105, -0.762458, -0.76205,
-    -0.761277, -0.760926, -0.760162, -0.759723, -0.759097, -0.758481,
-    -0.758027, -0.75726, -0.756897, -0.756102, -0.755685, -0.755003,
-    -0.75442, -0.753913, -0.753161, -0.752775, -0.751959, -0.751555,
-    -0.750821, -0.750271, -0.749708, -0.748977, -0.748559, -0.74773,
-    -0.747333, -0.74655, -0.746032, -0.745409, -0.744706, -0.744247,
-    -0.743415, -0.743013, -0.74219, -0.741699, -0.741016, -0.740345,
-    -0.739837, -0.739011, -0.738595, -0.73774, -0.73727, -0.736529,
-    -0.73589, -0.735328, -0.734516, -0.734077, -0.733198, -0.732742,
-    -0.731945, -0.73134, -0.730718, -0.729927, -0.729455, -0.728562,
-    -0.72811, -0.727265, -0.72669, -0.726007, -0.725243, -0.724727,
-    -0.72383, -0.723374, -0.722486, -0.721938, -0.721192, -0.720459,
-    -0.719893, -0.719001, -0.71853, -0.717607, -0.71708, -0.716274,
-    -0.715574, -0.714951, -0.714072, -0.713575, -0.712628, -0.712114,
-    -0.71125, -0.710583, -0.709898, -0.70904, -0.708508, -0.707545,
-    -0.707035, -0.70612, -0.705484, -0.704734, -0.703903, -0.703326,
-    -0.702358, -0.701842, -0.700881, -0.700272, -0.699457, -0.698657,
-    -0.698027, -0.697063, -0.69653, -0.695534, -0.694944, -0.694066,
-    -0.693299, -0.692609, -0.691658, -0.691098, -0.690075, -0.689498,
-    -0.68856, -0.687825, -0.687071, -0.68614, -0.685543, -0.684502,
-    -0.683929, -0.682936, -0.682233, -0.681411, -0.680506, -0.679862,
-    -0.678815, -0.678234, -0.677194, -0.676517, -0.675627, -0.674753,
-    -0.674053, -0.673009, -0.67241, -0.671332, -0.670674, -0.669718,
-    -0.668877, -0.668114, -0.667082, -0.666454, -0.665347, -0.664701,
-    -0.663682, -0.662874, -0.662043, -0.661032, -0.660363, -0.659238,
-    -0.658594, -0.657518, -0.65674, -0.655839, -0.654853, -0.654135,
-    -0.653002, -0.65235, -0.651223, -0.650471, -0.649499, -0.648544,
-    -0.647767, -0.646636, -0.645964, -0.644797, -0.644064, -0.643022,
-    -0.6421, -0.641257, -0.640137, -0.639434, -0.638236, -0.637514,
-    -0.636405, -0.635516, -0.634602, -0.633502, -0.632756, -0.631538,
-    -0.630818, -0.629648, -0.62879, -0.627801, -0.626727, -0.625929,
-    -0.624701, -0.62397, -0.622748, -0.621915, -0.620852, -0.619808,
-    -0.618948, -0.617721, -0.616969, -0.615703, -0.614889, -0.613752,
-    -0.612741, -0.611811, -0.610595, -0.609809, -0.60851, -0.607707,
-    -0.606499, -0.605522, -0.604516, -0.603319, -0.602488, -0.601167,
-    -0.600363, -0.599092, -0.598145, -0.597061, -0.59589, -0.595003,
-    -0.59367, -0.592855, -0.591528, -0.590606, -0.589443, -0.588302,
-    -0.58735, -0.586017, -0.585178, -0.583804, -0.582901, -0.58166,
-    -0.580552, -0.579526, -0.578204, -0.577329, -0.575919, -0.575025,
-    -0.57371, -0.572635, -0.57153, -0.570226, -0.569302, -0.567868,
-    -0.566973, -0.56559, -0.564546, -0.563357, -0.562079, -0.561096,
-    -0.559648, -0.558741, -0.557297, -0.556279, -0.555006, -0.553759,
-    -0.552706, -0.551257, -0.550324, -0.54883, -0.54783, -0.546474,
-    -0.54526, -0.544129, -0.542689, -0.541717, -0.540185, -0.539193,
-    -0.537759, -0.536578, -0.535363, -0.533941, -0.532917, -0.531358,
-    -0.530364, -0.528858, -0.527707, -0.526404, -0.525008, -0.52392,
-    -0.522346, -0.521338, -0.519767, -0.518642, -0.51725, -0.515885,
-    -0.514723, -0.513146, -0.512109, -0.510484, -0.509378, -0.507897,
-    -0.506565, -0.50532, -0.503751, -0.502673, -0.501006, -0.499907,
-    -0.498342, -0.497045, -0.49571, -0.494159, -0.493025, -0.491328,
-    -0.490226, -0.488584, -0.487318, -0.485889, -0.484363, -0.483161,
-    -0.481448, -0.480329, -0.478618, -0.477378, -0.475853, -0.474359,
-    -0.473077, -0.471359, -0.47021, -0.468441, -0.467218, -0.465599,
-    -0.46414, -0.46277, -0.461059, -0.459864, -0.458049, -0.456834,
-    -0.455125, -0.453701, -0.452234, -0.450541, -0.449287, -0.447439,
-    -0.446219, -0.444427, -0.443034, -0.441467, -0.4398, -0.438473,
-    -0.436605, -0.435367, -0.433501, -0.432135, -0.430465, -0.42883,
-    -0.427418, -0.425544, -0.424273, -0.422343, -0.420995, -0.419224,
-    -0.417625, -0.416117, -0.41425, -0.41293, -0.41095, -0.409609,
-    -0.407742, -0.406178, -0.404567, -0.402717, -0.401333, -0.399317,
-    -0.39797, -0.396013, -0.394482, -0.392763, -0.39094, -0.389477,
-    -0.387439, -0.386072, -0.384034, -0.38253, -0.380702, -0.378911,
-    -0.377357, -0.375311, -0.373907, -0.371801, -0.370316, -0.368378,
-    -0.366625, -0.364967, -0.362928, -0.361471, -0.35931, -0.357832,
-    -0.355789, -0.354073, -0.352305, -0.350283, -0.348756, -0.346556,
-    -0.34507, -0.34293, -0.341249, -0.339364, -0.337369, -0.335758,
-    -0.333532, -0.332024, -0.329797, -0.328144, -0.32614, -0.32418,
-    -0.32247, -0.320235, -0.318687, -0.316386, -0.314752, -0.31263,
-    -0.310708, -0.308887, -0.306657, -0.305052, -0.30269, -0.301063,
-    -0.298828, -0.296945, -0.295004, -0.292792, -0.291112, -0.288706,
-    -0.287071, -0.28473, -0.282884, -0.280817, -0.278633, -0.276861,
-    -0.274427, -0.272768, -0.270331, -0.268516, -0.266319, -0.264172,
-    -0.262292, -0.259848, -0.258145, -0.255627, -0.253832, -0.251506,
-    -0.2494, -0.247401, -0.24496, -0.243195, -0.240611, -0.238823,
-    -0.236374, -0.23431, -0.23218, -0.229758, -0.227912, -0.225278,
-    -0.223482, -0.220917, -0.218893, -0.216625, -0.214233, -0.212287,
-    -0.209623, -0.2078, -0.20513, -0.203139, -0.20073, -0.198378,
-    -0.196315, -0.193637, -0.191768, -0.189008, -0.18704, -0.18449,
-    -0.182182, -0.179988, -0.177314, -0.175377, -0.172544, -0.170585,
-    -0.167899, -0.165637, -0.1633, -0.160646, -0.158621, -0.155733,
-    -0.153765, -0.150951, -0.148734, -0.146245, -0.143624, -0.14149,
-    -0.138568, -0.136571, -0.133642, -0.131461, -0.128818, -0.12624,
-    -0.123978, -0.12104, -0.118994, -0.115965, -0.11381, -0.111011,
-    -0.108483, -0.106077, -0.103144, -0.101024, -0.097913, -0.0957696,
-    -0.0928198, -0.0903434, -0.0877803, -0.0848684, -0.0826525, -0.0794803,
-    -0.0773294, -0.0742376, -0.0718111, -0.0690809, -0.0662057, -0.0638706,
-    -0.0606592, -0.058479, -0.0552584, -0.0528748, -0.0499721, -0.0471458,
-    -0.0446702, -0.0414417, -0.0392081, -0.0358756, -0.0335234, -0.0304476,
-    -0.027678, -0.025043, -0.0218191, -0.0195066, -0.0160823, -0.0137454,
-    -0.0105008, -0.00779135, -0.00498134, -0.00178227, 0.000635533, 0.00412872,
-    0.00647082, 0.00987495, 0.0125257, 0.0155223, 0.0186789, 0.0212279,
-    0.0247654, 0.0271367, 0.0306863, 0.0332852, 0.0364754, 0.039575,
-    0.0422798, 0.0458364, 0.0482637, 0.0519402, 0.0544994, 0.0578849,
-    0.0609176, 0.0638002, 0.0673508, 0.0698633, 0.073644, 0.0761811,
-    0.079758, 0.0827186, 0.0857979, 0.0893188, 0.0919464, 0.0958058,
-    0.0983431, 0.102102, 0.104991, 0.108281, 0.111751, 0.114524,
-    0.118434, 0.120998, 0.124924, 0.127747, 0.131258, 0.134659,
-    0.137606, 0.141537, 0.144159, 0.148231, 0.151002, 0.154736,
-    0.158055, 0.161203, 0.165126, 0.167839, 0.172031, 0.174768,
-    0.178724, 0.181953, 0.185325, 0.189211, 0.192049, 0.196334,
-    0.199061, 0.203228, 0.206366, 0.209981, 0.213803, 0.216803,
-    0.221146, 0.223894, 0.228258, 0.231309, 0.23518, 0.238915,
-    0.242112, 0.246479, 0.249283, 0.25382, 0.256796, 0.26093,
-    0.26456, 0.267988, 0.272342, 0.275241, 0.279922, 0.282844,
-    0.287241, 0.290753, 0.294442, 0.298747, 0.301783, 0.306575,
-    0.309469, 0.31412, 0.317508, 0.321483, 0.325705, 0.328923,
-    0.333785, 0.336686, 0.341575, 0.344841, 0.349124, 0.35323,
-    0.356675, 0.361565, 0.364512, 0.369616, 0.372769, 0.377372,
-    0.381336, 0.385051, 0.389922, 0.392964, 0.39825, 0.40131,
-    0.406239, 0.410037, 0.414065, 0.41887, 0.422058, 0.427487,
-    0.43048, 0.435732, 0.43935, 0.44373, 0.44842, 0.451812,
-    0.457334, 0.460299, 0.465862, 0.469291, 0.474058, 0.478584,
-    0.482241, 0.487802, 0.490786, 0.496636, 0.499877, 0.505061,
-    0.509377, 0.513363, 0.518899, 0.52196, 0.528065, 0.531129,
-    0.536751, 0.540812, 0.545194, 0.550637, 0.553841, 0.560155,
-    0.563064, 0.56914, 0.572904, 0.577751, 0.583023, 0.58645,
-    0.592917, 0.595703, 0.602239, 0.605668, 0.611054, 0.616069,
-    0.619809, 0.626357, 0.629066, 0.636062, 0.639118, 0.64512,
-    0.649781, 0.653944, 0.660482, 0.663175, 0.67062, 0.673268,
-    0.679973, 0.684165, 0.68888, 0.695298, 0.698054, 0.705929,
-    0.708127, 0.715643, 0.719219, 0.724655, 0.730803, 0.733727,
-    0.742006, 0.743699, 0.752169, 0.754927, 0.761317, 0.766987,
-    0.770225, 0.778875, 0.77997, 0.789619, 0.79124, 0.798953,
-    0.803812, 0.80759, 0.81657, 0.816886, 0.828132, 0.828019,
-    0.837743, 0.841159, 0.8459, 0.855164, 0.854264, 0.868077,
-    0.864806, 0.878228, 0.878594, 0.885388, 0.894888, 0.891289,
-    0.911067, 0.89923, 0.923425, 0.91309, 0.927945, 0.937611,
-    0.916379, 1
-};
-
-static const float WAVE_EXPONENTIAL_006[DEFAULT_WAVELEN] = {
-    0.0256342, -0.898414, -0.946979, -0.964184, -0.973063, -0.978549,
-    -0.982322, -0.985109, -0.987274, -0.989019, -0.990467, -0.991693,
-    -0.99275, -0.993672, -0.994485, -0.995206, -0.99585, -0.996426,
-    -0.996942, -0.997404, -0.997818, -0.998188, -0.998516, -0.998805,
-    -0.999059, -0.999278, -0.999465, -0.999622, -0.999749, -0.999849,
-    -0.999923, -0.999972, -0.999997, -1, -0.999982, -0.999944,
-    -0.999887, -0.999814, -0.999724, -0.999619, -0.999501, -0.99937,
-    -0.999229, -0.999078, -0.998918, -0.998751, -0.998578, -0.9984,
-    -0.998219, -0.998036, -0.997851, -0.997666, -0.997481, -0.997299,
-    -0.99712, -0.996944, -0.996774, -0.996608, -0.99645, -0.996298,
-    -0.996154, -0.996018, -0.995891, -0.995773, -0.995665, -0.995566,
-    -0.995478, -0.995401, -0.995333, -0.995277, -0.99523, -0.995194,
-    -0.995169, -0.995153, -0.995147, -0.995151, -0.995164, -0.995185,
-    -0.995214, -0.995251, -0.995296, -0.995347, -0.995403, -0.995466,
-    -0.995532, -0.995603, -0.995677, -0.995754, -0.995833, -0.995913,
-    -0.995994, -0.996074, -0.996154, -0.996232, -0.996309, -0.996383,
-    -0.996454, -0.996521, -0.996584, -0.996643, -0.996696, -0.996745,
-    -0.996787, -0.996823, -0.996854, -0.996877, -0.996894, -0.996905,
-    -0.996908, -0.996905, -0.996895, -0.996879, -0.996855, -0.996826,
-    -0.99679, -0.996748, -0.996701, -0.996648, -0.99659, -0.996527,
-    -0.996461, -0.99639, -0.996316, -0.996238, -0.996159, -0.996077,
-    -0.995994, -0.995909, -0.995824, -0.995739, -0.995654, -0.99557,
-    -0.995487, -0.995406, -0.995327, -0.995251, -0.995177, -0.995107,
-    -0.99504, -0.994977, -0.994917, -0.994863, -0.994812, -0.994767,
-    -0.994726, -0.99469, -0.994659, -0.994633, -0.994612, -0.994596,
-    -0.994584, -0.994578, -0.994575, -0.994578, -0.994584, -0.994594,
-    -0.994608, -0.994626, -0.994646, -0.994669, -0.994695, -0.994723,
-    -0.994753, -0.994784, -0.994816, -0.994849, -0.994882, -0.994915,
-    -0.994947, -0.994979, -0.995009, -0.995038, -0.995065, -0.99509,
-    -0.995113, -0.995133, -0.99515, -0.995164, -0.995174, -0.995181,
-    -0.995184, -0.995183, -0.995178, -0.995169, -0.995157, -0.99514,
-    -0.995119, -0.995094, -0.995065, -0.995032, -0.994996, -0.994956,
-    -0.994913, -0.994866, -0.994816, -0.994764, -0.994709, -0.994652,
-    -0.994593, -0.994532, -0.994469, -0.994406, -0.994341, -0.994277,
-    -0.994212, -0.994147, -0.994082, -0.994018, -0.993955, -0.993894,
-    -0.993833, -0.993775, -0.993719, -0.993665, -0.993613, -0.993564,
-    -0.993517, -0.993474, -0.993433, -0.993396, -0.993362, -0.993331,
-    -0.993303, -0.993279, -0.993258, -0.99324, -0.993225, -0.993214,
-    -0.993205, -0.993199, -0.993196, -0.993195, -0.993196, -0.9932,
-    -0.993206, -0.993213, -0.993221, -0.993231, -0.993242, -0.993253,
-    -0.993265, -0.993277, -0.993289, -0.993301, -0.993312, -0.993322,
-    -0.993331, -0.993339, -0.993345, -0.99335, -0.993352, -0.993352,
-    -0.99335, -0.993346, -0.993339, -0.993329, -0.993317, -0.993301,
-    -0.993283, -0.993262, -0.993238, -0.993211, -0.993181, -0.993148,
-    -0.993112, -0.993074, -0.993033, -0.992989, -0.992943, -0.992895,
-    -0.992845, -0.992793, -0.992739, -0.992684, -0.992627, -0.992569,
-    -0.992511, -0.992452, -0.992393, -0.992333, -0.992273, -0.992214,
-    -0.992156, -0.992098, -0.99204, -0.991985, -0.99193, -0.991877,
-    -0.991825, -0.991776, -0.991728, -0.991682, -0.991639, -0.991598,
-    -0.991559, -0.991522, -0.991488, -0.991456, -0.991427, -0.991401,
-    -0.991376, -0.991354, -0.991334, -0.991317, -0.991301, -0.991288,
-    -0.991276, -0.991266, -0.991258, -0.991251, -0.991245, -0.991241,
-    -0.991237, -0.991233, -0.991231, -0.991228, -0.991226, -0.991223,
-    -0.99122, -0.991216, -0.991212, -0.991207, -0.9912, -0.991193,
-    -0.991184, -0.991173, -0.991161, -0.991146, -0.99113, -0.991112,
-    -0.991091, -0.991068, -0.991043, -0.991016, -0.990986, -0.990954,
-    -0.990919, -0.990882, -0.990843, -0.990801, -0.990758, -0.990712,
-    -0.990664, -0.990615, -0.990563, -0.99051, -0.990456, -0.9904,
-    -0.990343, -0.990285, -0.990226, -0.990166, -0.990106, -0.990046,
-    -0.989986, -0.989925, -0.989865, -0.989806, -0.989746, -0.989688,
-    -0.989631, -0.989574, -0.989519, -0.989465, -0.989413, -0.989362,
-    -0.989313, -0.989266, -0.98922, -0.989177, -0.989135, -0.989095,
-    -0.989057, -0.989021, -0.988987, -0.988955, -0.988925, -0.988897,
-    -0.98887, -0.988845, -0.988822, -0.9888, -0.988779, -0.988759,
-    -0.988741, -0.988723, -0.988707, -0.98869, -0.988675, -0.988659,
-    -0.988644, -0.988628, -0.988613, -0.988597, -0.98858, -0.988563,
-    -0.988544, -0.988525, -0.988505, -0.988483, -0.98846, -0.988435,
-    -0.988409, -0.988381, -0.988351, -0.98832, -0.988286, -0.988251,
-    -0.988213, -0.988173, -0.988132, -0.988088, -0.988043, -0.987995,
-    -0.987945, -0.987894, -0.987841, -0.987786, -0.98773, -0.987672,
-    -0.987613, -0.987552, -0.987491, -0.987428, -0.987364, -0.9873,
-    -0.987236, -0.987171, -0.987105, -0.98704, -0.986974, -0.986909,
-    -0.986845, -0.98678, -0.986717, -0.986654, -0.986592, -0.986531,
-    -0.986472, -0.986413, -0.986356, -0.9863, -0.986246, -0.986193,
-    -0.986142, -0.986092, -0.986044, -0.985998, -0.985953, -0.98591,
-    -0.985868, -0.985828, -0.98579, -0.985753, -0.985717, -0.985682,
-    -0.985649, -0.985616, -0.985585, -0.985554, -0.985524, -0.985495,
-    -0.985465, -0.985437, -0.985408, -0.985379, -0.985351, -0.985322,
-    -0.985292, -0.985262, -0.985231, -0.985199, -0.985167, -0.985133,
-    -0.985098, -0.985062, -0.985024, -0.984985, -0.984944, -0.984902,
-    -0.984858, -0.984812, -0.984764, -0.984715, -0.984664, -0.984611,
-    -0.984556, -0.984499, -0.984441, -0.984381, -0.984319, -0.984256,
-    -0.984191, -0.984125, -0.984058, -0.983989, -0.983919, -0.983849,
-    -0.983777, -0.983705, -0.983632, -0.983559, -0.983485, -0.983411,
-    -0.983337, -0.983263, -0.98319, -0.983116, -0.983043, -0.982971,
-    -0.982899, -0.982828, -0.982758, -0.982689, -0.982621, -0.982554,
-    -0.982489, -0.982424, -0.982361, -0.9823, -0.982239, -0.98218,
-    -0.982123, -0.982067, -0.982012, -0.981958, -0.981906, -0.981855,
-    -0.981805, -0.981756, -0.981708, -0.981662, -0.981616, -0.98157,
-    -0.981526, -0.981481, -0.981438, -0.981394, -0.981351, -0.981307,
-    -0.981264, -0.98122, -0.981176, -0.981131, -0.981086, -0.98104,
-    -0.980993, -0.980945, -0.980896, -0.980846, -0.980795, -0.980742,
-    -0.980688, -0.980632, -0.980575, -0.980517, -0.980456, -0.980394,
-    -0.98033, -0.980265, -0.980198, -0.980129, -0.980059, -0.979987,
-    -0.979913, -0.979838, -0.979762, -0.979684, -0.979605, -0.979525,
-    -0.979444, -0.979361, -0.979278, -0.979194, -0.979109, -0.979024,
-    -0.978938, -0.978852, -0.978766, -0.97868, -0.978594, -0.978508,
-    -0.978422, -0.978337, -0.978252, -0.978167, -0.978084, -0.978001,
-    -0.977919, -0.977838, -0.977758, -0.977679, -0.977601, -0.977525,
-    -0.977449, -0.977375, -0.977301, -0.977229, -0.977159, -0.977089,
-    -0.97702, -0.976953, -0.976886, -0.976821, -0.976756, -0.976692,
-    -0.976629, -0.976567, -0.976505, -0.976444, -0.976383, -0.976322,
-    -0.976261, -0.9762, -0.976139, -0.976078, -0.976017, -0.975955,
-    -0.975893, -0.97583, -0.975766, -0.975701, -0.975635, -0.975568,
-    -0.9755, -0.975431, -0.97536, -0.975288, -0.975215, -0.97514,
-    -0.975063, -0.974985, -0.974906, -0.974824, -0.974741, -0.974657,
-    -0.974571, -0.974483, -0.974394, -0.974303, -0.974211, -0.974118,
-    -0.974023, -0.973928, -0.973831, -0.973733, -0.973634, -0.973534,
-    -0.973433, -0.973332, -0.97323, -0.973128, -0.973026, -0.972923,
-    -0.97282, -0.972718, -0.972615, -0.972513, -0.972411, -0.972309,
-    -0.972208, -0.972108, -0.972008, -0.971909, -0.97181, -0.971713,
-    -0.971617, -0.971521, -0.971427, -0.971333, -0.971241, -0.971149,
-    -0.971059, -0.97097, -0.970881, -0.970794, -0.970707, -0.970621,
-    -0.970536, -0.970452, -0.970368, -0.970285, -0.970203, -0.970121,
-    -0.970039, -0.969957, -0.969876, -0.969794, -0.969712, -0.96963,
-    -0.969548, -0.969465, -0.969382, -0.969298, -0.969214, -0.969128,
-    -0.969042, -0.968954, -0.968865, -0.968775, -0.968684, -0.968592,
-    -0.968498, -0.968402, -0.968306, -0.968207, -0.968107, -0.968006,
-    -0.967903, -0.967798, -0.967692, -0.967584, -0.967475, -0.967364,
-    -0.967252, -0.967138, -0.967023, -0.966907, -0.966789, -0.966671,
-    -0.966552, -0.966431, -0.96631, -0.966188, -0.966065, -0.965942,
-    -0.965819, -0.965695, -0.965571, -0.965446, -0.965322, -0.965198,
-    -0.965074, -0.96495, -0.964827, -0.964704, -0.964582, -0.96446,
-    -0.964339, -0.964218, -0.964099, -0.96398, -0.963862, -0.963744,
-    -0.963628, -0.963512, -0.963398, -0.963284, -0.963171, -0.963059,
-    -0.962948, -0.962837, -0.962727, -0.962618, -0.962509, -0.962401,
-    -0.962293, -0.962185, -0.962078, -0.961971, -0.961864, -0.961757,
-    -0.96165, -0.961542, -0.961434, -0.961326, -0.961217, -0.961107,
-    -0.960997, -0.960886, -0.960774, -0.96066, -0.960546, -0.960431,
-    -0.960314, -0.960196, -0.960076, -0.959955, -0.959833, -0.959709,
-    -0.959583, -0.959456, -0.959327, -0.959197, -0.959065, -0.958931,
-    -0.958796, -0.95866, -0.958522, -0.958382, -0.958241, -0.958099,
-    -0.957956, -0.957811, -0.957665, -0.957518, -0.957371, -0.957222,
-    -0.957073, -0.956923, -0.956772, -0.956621, -0.95647, -0.956318,
-    -0.956166, -0.956014, -0.955863, -0.955711, -0.955559, -0.955408,
-    -0.955257, -0.955106, -0.954956, -0.954807, -0.954658, -0.95451,
-    -0.954362, -0.954215, -0.954069, -0.953923, -0.953779, -0.953635,
-    -0.953491, -0.953349, -0.953207, -0.953065, -0.952925, -0.952784,
-    -0.952645, -0.952505, -0.952366, -0.952227, -0.952089, -0.95195,
-    -0.951811, -0.951673, -0.951534, -0.951394, -0.951255, -0.951115,
-    -0.950974, -0.950833, -0.95069, -0.950547, -0.950403, -0.950258,
-    -0.950112, -0.949964, -0.949815, -0.949665, -0.949513, -0.94936,
-    -0.949206, -0.949049, -0.948892, -0.948732, -0.948571, -0.948408,
-    -0.948244, -0.948078, -0.94791, -0.947741, -0.94757, -0.947398,
-    -0.947224, -0.947048, -0.946872, -0.946694, -0.946514, -0.946334,
-    -0.946153, -0.94597, -0.945787, -0.945603, -0.945418, -0.945233,
-    -0.945047, -0.94486, -0.944673, -0.944487, -0.944299, -0.944112,
-    -0.943925, -0.943738, -0.943551, -0.943364, -0.943178, -0.942992,
-    -0.942806, -0.942621, -0.942437, -0.942253, -0.942069, -0.941886,
-    -0.941704, -0.941522, -0.941341, -0.94116, -0.94098, -0.940801,
-    -0.940622, -0.940443, -0.940264, -0.940086, -0.939908, -0.939731,
-    -0.939553, -0.939375, -0.939197, -0.939019, -0.938841, -0.938663,
-    -0.938483, -0.938304, -0.938123, -0.937942, -0.93776, -0.937577,
-    -0.937393, -0.937208, -0.937022, -0.936834, -0.936645, -0.936455,
-    -0.936263, -0.936069, -0.935874, -0.935678, -0.935479, -0.935279,
-    -0.935077, -0.934873, -0.934668, -0.934461, -0.934252, -0.934041,
-    -0.933829, -0.933615, -0.9334, -0.933182, -0.932964, -0.932744,
-    -0.932522, -0.932299, -0.932075, -0.93185, -0.931624, -0.931397,
-    -0.931168, -0.930939, -0.93071, -0.930479, -0.930249, -0.930017,
-    -0.929786, -0.929554, -0.929322, -0.92909, -0.928858, -0.928626,
-    -0.928394, -0.928162, -0.927931, -0.927699, -0.927469, -0.927238,
-    -0.927008, -0.926778, -0.926549, -0.92632, -0.926091, -0.925863,
-    -0.925636, -0.925408, -0.925181, -0.924954, -0.924728, -0.924501,
-    -0.924275, -0.924049, -0.923822, -0.923596, -0.923369, -0.923142,
-    -0.922915, -0.922687, -0.922459, -0.92223, -0.922, -0.921769,
-    -0.921538, -0.921305, -0.921071, -0.920836, -0.920599, -0.920362,
-    -0.920122, -0.919881, -0.919639, -0.919395, -0.919149, -0.918901,
-    -0.918652, -0.9184, -0.918147, -0.917892, -0.917635, -0.917376,
-    -0.917115, -0.916853, -0.916588, -0.916322, -0.916053, -0.915783,
-    -0.915512, -0.915239, -0.914964, -0.914687, -0.914409, -0.91413,
-    -0.91385, -0.913568, -0.913285, -0.913002, -0.912717, -0.912431,
-    -0.912145, -0.911858, -0.911571, -0.911283, -0.910994, -0.910706,
-    -0.910417, -0.910128, -0.909839, -0.90955, -0.90926, -0.908971,
-    -0.908682, -0.908394, -0.908105, -0.907817, -0.907529, -0.907241,
-    -0.906953, -0.906666, -0.906378, -0.906091, -0.905804, -0.905517,
-    -0.905231, -0.904944, -0.904657, -0.90437, -0.904083, -0.903796,
-    -0.903508, -0.90322, -0.902931, -0.902642, -0.902352, -0.902061,
-    -0.901769, -0.901476, -0.901182, -0.900887, -0.900591, -0.900293,
-    -0.899994, -0.899693, -0.899391, -0.899087, -0.898781, -0.898473,
-    -0.898163, -0.897852, -0.897538, -0.897222, -0.896905, -0.896585,
-    -0.896263, -0.895939, -0.895613, -0.895284, -0.894954, -0.894622,
-    -0.894287, -0.893951, -0.893612, -0.893272, -0.89293, -0.892586,
-    -0.892241, -0.891894, -0.891545, -0.891195, -0.890844, -0.890491,
-    -0.890137, -0.889782, -0.889426, -0.889069, -0.888711, -0.888353,
-    -0.887993, -0.887634, -0.887274, -0.886913, -0.886552, -0.886191,
-    -0.885829, -0.885468, -0.885106, -0.884744, -0.884382, -0.884021,
-    -0.883659, -0.883297, -0.882935, -0.882573, -0.882212, -0.88185,
-    -0.881488, -0.881126, -0.880764, -0.880402, -0.880039, -0.879676,
-    -0.879313, -0.878949, -0.878585, -0.87822, -0.877855, -0.877488,
-    -0.877121, -0.876753, -0.876384, -0.876013, -0.875641, -0.875268,
-    -0.874893, -0.874517, -0.874139, -0.873759, -0.873378, -0.872994,
-    -0.872609, -0.872221, -0.871831, -0.871439, -0.871045, -0.870649,
-    -0.87025, -0.869849, -0.869445, -0.869039, -0.868631, -0.86822,
-    -0.867807, -0.867392, -0.866974, -0.866554, -0.866132, -0.865708,
-    -0.865281, -0.864852, -0.864422, -0.863989, -0.863555, -0.863119,
-    -0.862681, -0.862241, -0.8618, -0.861358, -0.860914, -0.860469,
-    -0.860023, -0.859576, -0.859128, -0.858679, -0.85823, -0.857779,
-    -0.857328, -0.856876, -0.856424, -0.855972, -0.855519, -0.855065,
-    -0.854612, -0.854158, -0.853704, -0.853249, -0.852795, -0.85234,
-    -0.851884, -0.851429, -0.850973, -0.850517, -0.850061, -0.849604,
-    -0.849147, -0.848689, -0.84823, -0.847771, -0.847311, -0.84685,
-    -0.846388, -0.845925, -0.845461, -0.844996, -0.84453, -0.844062,
-    -0.843592, -0.843121, -0.842648, -0.842173, -0.841696, -0.841217,
-    -0.840737, -0.840253, -0.839768, -0.83928, -0.83879, -0.838297,
-    -0.837802, -0.837304, -0.836803, -0.8363, -0.835794, -0.835285,
-    -0.834774, -0.83426, -0.833743, -0.833223, -0.832701, -0.832176,
-    -0.831648, -0.831118, -0.830585, -0.83005, -0.829512, -0.828972,
-    -0.82843, -0.827886, -0.82734, -0.826791, -0.826241, -0.825689,
-    -0.825135, -0.82458, -0.824023, -0.823464, -0.822905, -0.822344,
-    -0.821782, -0.821218, -0.820654, -0.820089, -0.819523, -0.818957,
-    -0.818389, -0.817821, -0.817252, -0.816683, -0.816113, -0.815542,
-    -0.814971, -0.814399, -0.813827, -0.813254, -0.812681, -0.812107,
-    -0.811532, -0.810957, -0.81038, -0.809803, -0.809225, -0.808646,
-    -0.808066, -0.807485, -0.806903, -0.806319, -0.805734, -0.805147,
-    -0.804558, -0.803968, -0.803376, -0.802782, -0.802186, -0.801587,
-    -0.800987, -0.800384, -0.799778, -0.79917, -0.798559, -0.797945,
-    -0.797329, -0.79671, -0.796087, -0.795462, -0.794833, -0.794202,
-    -0.793567, -0.792929, -0.792288, -0.791644, -0.790997, -0.790346,
-    -0.789692, -0.789035, -0.788375, -0.787712, -0.787046, -0.786377,
-    -0.785705, -0.78503, -0.784353, -0.783673, -0.78299, -0.782305,
-    -0.781617, -0.780928, -0.780236, -0.779541, -0.778845, -0.778147,
-    -0.777448, -0.776746, -0.776043, -0.775338, -0.774632, -0.773925,
-    -0.773216, -0.772506, -0.771795, -0.771083, -0.77037, -0.769655,
-    -0.76894, -0.768224, -0.767507, -0.766788, -0.766069, -0.765349,
-    -0.764628, -0.763906, -0.763183, -0.762459, -0.761734, -0.761008,
-    -0.76028, -0.759551, -0.75882, -0.758088, -0.757354, -0.756619,
-    -0.755881, -0.755142, -0.754401, -0.753657, -0.752911, -0.752163,
-    -0.751412, -0.750659, -0.749903, -0.749144, -0.748382, -0.747617,
-    -0.746849, -0.746077, -0.745302, -0.744524, -0.743742, -0.742957,
-    -0.742168, -0.741376, -0.74058, -0.73978, -0.738976, -0.738168,
-    -0.737357, -0.736542, -0.735723, -0.7349, -0.734074, -0.733244,
-    -0.732411, -0.731574, -0.730733, -0.729889, -0.729042, -0.728191,
-    -0.727337, -0.72648, -0.72562, -0.724757, -0.723892, -0.723024,
-    -0.722153, -0.721279, -0.720404, -0.719526, -0.718646, -0.717763,
-    -0.716879, -0.715993, -0.715105, -0.714216, -0.713324, -0.712431,
-    -0.711537, -0.710641, -0.709743, -0.708844, -0.707944, -0.707042,
-    -0.706139, -0.705234, -0.704328, -0.703421, -0.702512, -0.701601,
-    -0.700689, -0.699775, -0.698859, -0.697942, -0.697023, -0.696101,
-    -0.695178, -0.694252, -0.693324, -0.692393, -0.69146, -0.690524,
-    -0.689586, -0.688644, -0.687699, -0.686752, -0.6858, -0.684846,
-    -0.683888, -0.682926, -0.68196, -0.680991, -0.680017, -0.67904,
-    -0.678058, -0.677072, -0.676082, -0.675087, -0.674088, -0.673085,
-    -0.672077, -0.671064, -0.670047, -0.669026, -0.668, -0.666969,
-    -0.665934, -0.664895, -0.663851, -0.662803, -0.66175, -0.660694,
-    -0.659633, -0.658568, -0.6575, -0.656427, -0.655351, -0.654271,
-    -0.653187, -0.6521, -0.65101, -0.649917, -0.64882, -0.647721,
-    -0.646619, -0.645514, -0.644406, -0.643296, -0.642183, -0.641068,
-    -0.63995, -0.63883, -0.637708, -0.636584, -0.635458, -0.63433,
-    -0.6332, -0.632068, -0.630933, -0.629797, -0.628659, -0.627519,
-    -0.626376, -0.625232, -0.624085, -0.622936, -0.621785, -0.620631,
-    -0.619475, -0.618316, -0.617154, -0.61599, -0.614823, -0.613652,
-    -0.612479, -0.611302, -0.610121, -0.608937, -0.607749, -0.606557,
-    -0.605362, -0.604162, -0.602957, -0.601749, -0.600535, -0.599317,
-    -0.598095, -0.596867, -0.595634, -0.594397, -0.593154, -0.591905,
-    -0.590652, -0.589393, -0.588129, -0.586859, -0.585584, -0.584303,
-    -0.583017, -0.581726, -0.580429, -0.579126, -0.577819, -0.576506,
-    -0.575187, -0.573864, -0.572535, -0.571202, -0.569863, -0.56852,
-    -0.567172, -0.565819, -0.564462, -0.563101, -0.561735, -0.560366,
-    -0.558992, -0.557615, -0.556233, -0.554848, -0.55346, -0.552068,
-    -0.550673, -0.549275, -0.547873, -0.546469, -0.545062, -0.543651,
-    -0.542238, -0.540822, -0.539404, -0.537982, -0.536558, -0.535131,
-    -0.533702, -0.532269, -0.530834, -0.529396, -0.527955, -0.526511,
-    -0.525065, -0.523615, -0.522161, -0.520705, -0.519245, -0.517781,
-    -0.516314, -0.514842, -0.513367, -0.511888, -0.510404, -0.508916,
-    -0.507423, -0.505925, -0.504422, -0.502915, -0.501402, -0.499883,
-    -0.49836, -0.49683, -0.495295, -0.493753, -0.492206, -0.490652,
-    -0.489092, -0.487526, -0.485953, -0.484374, -0.482788, -0.481196,
-    -0.479597, -0.477991, -0.476378, -0.474759, -0.473133, -0.471501,
-    -0.469862, -0.468216, -0.466564, -0.464906, -0.463241, -0.46157,
-    -0.459893, -0.458209, -0.45652, -0.454825, -0.453125, -0.451419,
-    -0.449707, -0.447991, -0.446269, -0.444542, -0.442811, -0.441074,
-    -0.439334, -0.437588, -0.435839, -0.434085, -0.432327, -0.430565,
-    -0.428799, -0.42703, -0.425256, -0.423479, -0.421698, -0.419914,
-    -0.418126, -0.416334, -0.414539, -0.41274, -0.410938, -0.409132,
-    -0.407322, -0.405508, -0.403691, -0.401869, -0.400043, -0.398213,
-    -0.396378, -0.39454, -0.392696, -0.390847, -0.388994, -0.387135,
-    -0.385271, -0.383402, -0.381526, -0.379645, -0.377758, -0.375865,
-    -0.373965, -0.372058, -0.370145, -0.368225, -0.366297, -0.364363,
-    -0.36242, -0.360471, -0.358513, -0.356548, -0.354575, -0.352594,
-    -0.350605, -0.348607, -0.346602, -0.344588, -0.342566, -0.340536,
-    -0.338497, -0.33645, -0.334396, -0.332332, -0.330261, -0.328182,
-    -0.326095, -0.324, -0.321898, -0.319787, -0.31767, -0.315545,
-    -0.313413, -0.311274, -0.309128, -0.306975, -0.304816, -0.302651,
-    -0.300479, -0.298301, -0.296117, -0.293928, -0.291733, -0.289533,
-    -0.287327, -0.285116, -0.2829, -0.280679, -0.278453, -0.276222,
-    -0.273987, -0.271747, -0.269502, -0.267253, -0.264999, -0.26274,
-    -0.260476, -0.258208, -0.255935, -0.253658, -0.251375, -0.249087,
-    -0.246794, -0.244496, -0.242192, -0.239883, -0.237567, -0.235246,
-    -0.232919, -0.230585, -0.228245, -0.225897, -0.223543, -0.221182,
-    -0.218813, -0.216436, -0.214051, -0.211658, -0.209257, -0.206847,
-    -0.204429, -0.202001, -0.199565, -0.197119, -0.194663, -0.192198,
-    -0.189723, -0.187238, -0.184743, -0.182238, -0.179723, -0.177197,
-    -0.174662, -0.172115, -0.169559, -0.166992, -0.164415, -0.161828,
-    -0.15923, -0.156623, -0.154005, -0.151378, -0.148741, -0.146094,
-    -0.143438, -0.140772, -0.138098, -0.135414, -0.132722, -0.130021,
-    -0.127312, -0.124594, -0.121869, -0.119136, -0.116395, -0.113647,
-    -0.110892, -0.10813, -0.105361, -0.102586, -0.0998035, -0.0970151,
-    -0.0942204, -0.0914197, -0.0886129, -0.0858002, -0.0829816, -0.0801571,
-    -0.0773269, -0.0744908, -0.0716488, -0.068801, -0.0659473, -0.0630875,
-    -0.0602217, -0.0573495, -0.0544711, -0.051586, -0.0486943, -0.0457956,
-    -0.0428899, -0.0399768, -0.0370561, -0.0341276, -0.031191, -0.0282461,
-    -0.0252926, -0.0223301, -0.0193584, -0.0163773, -0.0133864, -0.0103854,
-    -0.00737409, -0.00435215, -0.00131931, 0.00172468, 0.0047801, 0.00784716,
-    0.0109261, 0.0140172, 0.0171205, 0.0202363, 0.0233647, 0.0265059,
-    0.02966, 0.0328271, 0.0360072, 0.0392005, 0.0424069, 0.0456264,
-    0.0488591, 0.0521048, 0.0553635, 0.0586352, 0.0619197, 0.0652169,
-    0.0685266, 0.0718487, 0.0751829, 0.0785292, 0.0818871, 0.0852566,
-    0.0886374, 0.0920292, 0.0954317, 0.0988447, 0.102268, 0.105701,
-    0.109144, 0.112596, 0.116058, 0.119528, 0.123007, 0.126494,
-    0.129989, 0.133492, 0.137003, 0.140522, 0.144048, 0.147581,
-    0.151122, 0.154669, 0.158224, 0.161785, 0.165353, 0.168929,
-    0.172511, 0.176101, 0.179697, 0.183301, 0.186913, 0.190532,
-    0.194159, 0.197794, 0.201438, 0.20509, 0.208751, 0.212422,
-    0.216102, 0.219792, 0.223493, 0.227204, 0.230926, 0.234661,
-    0.238407, 0.242165, 0.245936, 0.24972, 0.253518, 0.25733,
-    0.261157, 0.264998, 0.268854, 0.272726, 0.276613, 0.280516,
-    0.284436, 0.288372, 0.292325, 0.296295, 0.300282, 0.304286,
-    0.308308, 0.312346, 0.316403, 0.320476, 0.324567, 0.328675,
-    0.3328, 0.336942, 0.341101, 0.345276, 0.349467, 0.353675,
-    0.357898, 0.362137, 0.36639, 0.370658, 0.374941, 0.379237,
-    0.383546, 0.387869, 0.392204, 0.396551, 0.400909, 0.405279,
-    0.40966, 0.414051, 0.418452, 0.422863, 0.427282, 0.431711,
-    0.436148, 0.440593, 0.445046, 0.449507, 0.453975, 0.458451,
-    0.462933, 0.467423, 0.471921, 0.476425, 0.480936, 0.485455,
-    0.489981, 0.494514, 0.499056, 0.503606, 0.508164, 0.512731,
-    0.517307, 0.521893, 0.52649, 0.531097, 0.535715, 0.540346,
-    0.544989, 0.549645, 0.554315, 0.559, 0.5637, 0.568416,
-    0.573149, 0.5779, 0.582668, 0.587456, 0.592263, 0.597091,
-    0.60194, 0.60681, 0.611703, 0.616619, 0.621558, 0.626521,
-    0.631509, 0.636521, 0.641559, 0.646622, 0.651711, 0.656827,
-    0.661968, 0.667135, 0.672329, 0.677549, 0.682795, 0.688066,
-    0.693364, 0.698686, 0.704034, 0.709405, 0.714801, 0.72022,
-    0.725661, 0.731125, 0.736609, 0.742114, 0.747638, 0.75318,
-    0.75874, 0.764317, 0.769909, 0.775515, 0.781134, 0.786766,
-    0.792408, 0.79806, 0.80372, 0.809388, 0.815062, 0.82074,
-    0.826423, 0.832108, 0.837794, 0.84348, 0.849164, 0.854847,
-    0.860526, 0.8662, 0.871868, 0.877529, 0.883181, 0.888824,
-    0.894455, 0.900074, 0.905678, 0.911266, 0.916836, 0.922386,
-    0.927913, 0.933413, 0.938882, 0.944317, 0.94971, 0.955054,
-    0.960338, 0.96555, 0.97067, 0.975675, 0.980529, 0.98518,
-    0.989552, 0.993524, 0.996893, 0.999293, 1, 0.997332,
-    0.986355, 0.944023
-};
-
-static const float WAVE_EXPONENTIAL_018[DEFAULT_WAVELEN] = {
-    0.00202863, -1, -0.765619, -0.903805, -0.805949, -0.88141,
-    -0.820225, -0.871423, -0.827583, -0.865699, -0.832121, -0.861938,
-    -0.835237, -0.859243, -0.837533, -0.857191, -0.839313, -0.855561,
-    -0.840744, -0.854221, -0.841929, -0.853093, -0.84293, -0.852124,
-    -0.843792, -0.851279, -0.844542, -0.850534, -0.845202, -0.849871,
-    -0.845786, -0.849277, -0.846307, -0.848741, -0.846773, -0.848258,
-    -0.847189, -0.84782, -0.847562, -0.847424, -0.847895, -0.847065,
-    -0.848192, -0.84674, -0.848456, -0.846448, -0.848688, -0.846186,
-    -0.848891, -0.845951, -0.849066, -0.845743, -0.849216, -0.845561,
-    -0.84934, -0.845402, -0.849442, -0.845266, -0.84952, -0.845151,
-    -0.849578, -0.845057, -0.849615, -0.844982, -0.849633, -0.844926,
-    -0.849633, -0.844887, -0.849615, -0.844865, -0.849581, -0.844859,
-    -0.849532, -0.844867, -0.849468, -0.844888, -0.849391, -0.844923,
-    -0.849301, -0.844969, -0.8492, -0.845025, -0.849088, -0.845092,
-    -0.848967, -0.845167, -0.848837, -0.84525, -0.848699, -0.845339,
-    -0.848555, -0.845435, -0.848406, -0.845535, -0.848251, -0.84564,
-    -0.848093, -0.845747, -0.847932, -0.845857, -0.847769, -0.845967,
-    -0.847604, -0.846078, -0.84744, -0.846189, -0.847276, -0.846298,
-    -0.847114, -0.846405, -0.846953, -0.846509, -0.846796, -0.84661,
-    -0.846642, -0.846706, -0.846492, -0.846798, -0.846348, -0.846884,
-    -0.846208, -0.846964, -0.846074, -0.847038, -0.845947, -0.847105,
-    -0.845826, -0.847165, -0.845713, -0.847217, -0.845607, -0.847261,
-    -0.845508, -0.847297, -0.845418, -0.847325, -0.845335, -0.847344,
-    -0.84526, -0.847355, -0.845194, -0.847357, -0.845136, -0.847351,
-    -0.845085, -0.847336, -0.845043, -0.847314, -0.845009, -0.847283,
-    -0.844982, -0.847244, -0.844963, -0.847197, -0.844951, -0.847143,
-    -0.844945, -0.847082, -0.844946, -0.847014, -0.844954, -0.84694,
-    -0.844967, -0.846861, -0.844985, -0.846775, -0.845008, -0.846685,
-    -0.845036, -0.84659, -0.845067, -0.846491, -0.845102, -0.846389,
-    -0.845139, -0.846284, -0.845179, -0.846176, -0.84522, -0.846066,
-    -0.845263, -0.845955, -0.845306, -0.845844, -0.84535, -0.845732,
-    -0.845393, -0.84562, -0.845435, -0.845508, -0.845476, -0.845398,
-    -0.845515, -0.84529, -0.845552, -0.845183, -0.845586, -0.84508,
-    -0.845617, -0.844979, -0.845645, -0.844881, -0.845669, -0.844787,
-    -0.845688, -0.844696, -0.845703, -0.84461, -0.845713, -0.844529,
-    -0.845718, -0.844452, -0.845718, -0.844379, -0.845713, -0.844312,
-    -0.845702, -0.84425, -0.845686, -0.844193, -0.845664, -0.84414,
-    -0.845637, -0.844094, -0.845604, -0.844052, -0.845565, -0.844015,
-    -0.845521, -0.843983, -0.845472, -0.843956, -0.845417, -0.843933,
-    -0.845358, -0.843915, -0.845293, -0.843901, -0.845224, -0.843892,
-    -0.845151, -0.843885, -0.845074, -0.843882, -0.844993, -0.843883,
-    -0.844909, -0.843885, -0.844821, -0.843891, -0.844731, -0.843898,
-    -0.844638, -0.843907, -0.844544, -0.843917, -0.844448, -0.843929,
-    -0.84435, -0.84394, -0.844252, -0.843952, -0.844153, -0.843964,
-    -0.844054, -0.843975, -0.843955, -0.843985, -0.843857, -0.843994,
-    -0.84376, -0.844002, -0.843664, -0.844007, -0.843569, -0.84401,
-    -0.843477, -0.84401, -0.843386, -0.844008, -0.843298, -0.844002,
-    -0.843213, -0.843993, -0.843131, -0.843981, -0.843052, -0.843964,
-    -0.842976, -0.843944, -0.842903, -0.84392, -0.842834, -0.843891,
-    -0.842769, -0.843859, -0.842707, -0.843822, -0.842649, -0.84378,
-    -0.842595, -0.843735, -0.842544, -0.843685, -0.842498, -0.84363,
-    -0.842454, -0.843572, -0.842415, -0.843509, -0.842378, -0.843443,
-    -0.842345, -0.843373, -0.842315, -0.843299, -0.842288, -0.843221,
-    -0.842264, -0.843141, -0.842242, -0.843057, -0.842223, -0.842971,
-    -0.842205, -0.842882, -0.842189, -0.842791, -0.842175, -0.842698,
-    -0.842162, -0.842603, -0.84215, -0.842507, -0.842138, -0.842409,
-    -0.842127, -0.842311, -0.842115, -0.842213, -0.842103, -0.842114,
-    -0.842091, -0.842015, -0.842078, -0.841916, -0.842064, -0.841819,
-    -0.842048, -0.841722, -0.84203, -0.841626, -0.842011, -0.841531,
-    -0.841989, -0.841439, -0.841965, -0.841348, -0.841938, -0.841259,
-    -0.841908, -0.841172, -0.841876, -0.841087, -0.84184, -0.841006,
-    -0.841801, -0.840926, -0.841758, -0.84085, -0.841712, -0.840776,
-    -0.841663, -0.840705, -0.841609, -0.840637, -0.841553, -0.840572,
-    -0.841492, -0.84051, -0.841428, -0.840451, -0.84136, -0.840394,
-    -0.841289, -0.84034, -0.841214, -0.840289, -0.841136, -0.840241,
-    -0.841054, -0.840194, -0.84097, -0.84015, -0.840882, -0.840108,
-    -0.840792, -0.840068, -0.8407, -0.84003, -0.840604, -0.839993,
-    -0.840507, -0.839957, -0.840408, -0.839923, -0.840307, -0.839889,
-    -0.840204, -0.839855, -0.8401, -0.839822, -0.839995, -0.839789,
-    -0.83989, -0.839756, -0.839784, -0.839722, -0.839677, -0.839688,
-    -0.839571, -0.839653, -0.839465, -0.839616, -0.839359, -0.839578,
-    -0.839254, -0.839539, -0.839149, -0.839497, -0.839046, -0.839454,
-    -0.838944, -0.839408, -0.838844, -0.83936, -0.838745, -0.839309,
-    -0.838647, -0.839256, -0.838552, -0.8392, -0.838459, -0.83914,
-    -0.838368, -0.839078, -0.838278, -0.839012, -0.838192, -0.838944,
-    -0.838107, -0.838872, -0.838025, -0.838797, -0.837945, -0.838718,
-    -0.837867, -0.838636, -0.837792, -0.838551, -0.837719, -0.838463,
-    -0.837648, -0.838372, -0.837579, -0.838278, -0.837512, -0.83818,
-    -0.837447, -0.83808, -0.837384, -0.837978, -0.837322, -0.837873,
-    -0.837262, -0.837765, -0.837202, -0.837656, -0.837144, -0.837544,
-    -0.837087, -0.837431, -0.837031, -0.837316, -0.836974, -0.837199,
-    -0.836918, -0.837082, -0.836863, -0.836963, -0.836806, -0.836844,
-    -0.83675, -0.836724, -0.836693, -0.836604, -0.836635, -0.836483,
-    -0.836576, -0.836363, -0.836516, -0.836243, -0.836454, -0.836123,
-    -0.83639, -0.836004, -0.836325, -0.835886, -0.836258, -0.835769,
-    -0.836188, -0.835653, -0.836116, -0.835538, -0.836042, -0.835425,
-    -0.835965, -0.835313, -0.835885, -0.835202, -0.835803, -0.835094,
-    -0.835717, -0.834987, -0.835629, -0.834882, -0.835537, -0.834779,
-    -0.835443, -0.834678, -0.835345, -0.834578, -0.835245, -0.83448,
-    -0.835141, -0.834385, -0.835034, -0.834291, -0.834925, -0.834198,
-    -0.834812, -0.834107, -0.834697, -0.834018, -0.834579, -0.83393,
-    -0.834458, -0.833844, -0.834335, -0.833758, -0.834209, -0.833674,
-    -0.834081, -0.833591, -0.833952, -0.833508, -0.83382, -0.833425,
-    -0.833686, -0.833343, -0.833551, -0.833261, -0.833415, -0.833179,
-    -0.833277, -0.833097, -0.833138, -0.833015, -0.832999, -0.832931,
-    -0.832859, -0.832847, -0.832718, -0.832762, -0.832578, -0.832676,
-    -0.832437, -0.832588, -0.832296, -0.832498, -0.832155, -0.832407,
-    -0.832015, -0.832314, -0.831876, -0.832219, -0.831737, -0.832121,
-    -0.831599, -0.832022, -0.831462, -0.831919, -0.831327, -0.831814,
-    -0.831192, -0.831707, -0.831059, -0.831596, -0.830926, -0.831483,
-    -0.830796, -0.831367, -0.830667, -0.831248, -0.830539, -0.831126,
-    -0.830413, -0.831001, -0.830288, -0.830872, -0.830164, -0.830741,
-    -0.830042, -0.830607, -0.829922, -0.83047, -0.829803, -0.830331,
-    -0.829684, -0.830188, -0.829567, -0.830043, -0.829451, -0.829895,
-    -0.829336, -0.829745, -0.829222, -0.829592, -0.829108, -0.829438,
-    -0.828995, -0.829281, -0.828882, -0.829122, -0.828769, -0.828962,
-    -0.828657, -0.828799, -0.828544, -0.828636, -0.828431, -0.828471,
-    -0.828317, -0.828305, -0.828202, -0.828139, -0.828087, -0.827971,
-    -0.82797, -0.827803, -0.827853, -0.827635, -0.827733, -0.827466,
-    -0.827613, -0.827297, -0.82749, -0.827129, -0.827365, -0.82696,
-    -0.827239, -0.826792, -0.82711, -0.826624, -0.826979, -0.826457,
-    -0.826845, -0.826291, -0.826709, -0.826125, -0.82657, -0.82596,
-    -0.826428, -0.825797, -0.826284, -0.825634, -0.826136, -0.825472,
-    -0.825985, -0.825312, -0.825832, -0.825152, -0.825675, -0.824994,
-    -0.825516, -0.824836, -0.825353, -0.82468, -0.825188, -0.824525,
-    -0.825019, -0.82437, -0.824847, -0.824217, -0.824673, -0.824064,
-    -0.824496, -0.823912, -0.824316, -0.823761, -0.824134, -0.823611,
-    -0.823949, -0.82346, -0.823761, -0.82331, -0.823571, -0.82316,
-    -0.82338, -0.82301, -0.823186, -0.82286, -0.82299, -0.822709,
-    -0.822793, -0.822558, -0.822594, -0.822407, -0.822394, -0.822254,
-    -0.822192, -0.8221, -0.82199, -0.821946, -0.821786, -0.821789,
-    -0.821582, -0.821632, -0.821377, -0.821472, -0.821172, -0.821311,
-    -0.820967, -0.821148, -0.820761, -0.820982, -0.820555, -0.820814,
-    -0.820349, -0.820644, -0.820144, -0.820471, -0.819939, -0.820296,
-    -0.819734, -0.820117, -0.81953, -0.819936, -0.819326, -0.819752,
-    -0.819123, -0.819565, -0.81892, -0.819375, -0.818719, -0.819182,
-    -0.818518, -0.818985, -0.818317, -0.818785, -0.818118, -0.818583,
-    -0.817919, -0.818377, -0.81772, -0.818167, -0.817523, -0.817955,
-    -0.817326, -0.81774, -0.817129, -0.817522, -0.816933, -0.8173,
-    -0.816737, -0.817076, -0.816542, -0.81685, -0.816346, -0.81662,
-    -0.816151, -0.816388, -0.815955, -0.816154, -0.815759, -0.815917,
-    -0.815563, -0.815678, -0.815366, -0.815437, -0.815168, -0.815194,
-    -0.81497, -0.81495, -0.81477, -0.814704, -0.814569, -0.814456,
-    -0.814367, -0.814208, -0.814163, -0.813958, -0.813958, -0.813707,
-    -0.813751, -0.813455, -0.813541, -0.813202, -0.813329, -0.812949,
-    -0.813116, -0.812696, -0.812899, -0.812442, -0.81268, -0.812188,
-    -0.812458, -0.811933, -0.812234, -0.811679, -0.812006, -0.811425,
-    -0.811775, -0.811171, -0.811541, -0.810917, -0.811304, -0.810663,
-    -0.811064, -0.81041, -0.81082, -0.810157, -0.810573, -0.809904,
-    -0.810323, -0.809652, -0.810069, -0.8094, -0.809812, -0.809148,
-    -0.809551, -0.808896, -0.809287, -0.808645, -0.80902, -0.808394,
-    -0.808749, -0.808143, -0.808475, -0.807892, -0.808198, -0.80764,
-    -0.807918, -0.807389, -0.807634, -0.807137, -0.807348, -0.806885,
-    -0.80706, -0.806632, -0.806768, -0.806378, -0.806474, -0.806123,
-    -0.806178, -0.805868, -0.805879, -0.805611, -0.805578, -0.805353,
-    -0.805275, -0.805093, -0.80497, -0.804832, -0.804664, -0.804569,
-    -0.804355, -0.804304, -0.804046, -0.804037, -0.803735, -0.803767,
-    -0.803423, -0.803495, -0.80311, -0.803221, -0.802796, -0.802943,
-    -0.802481, -0.802663, -0.802165, -0.80238, -0.801849, -0.802093,
-    -0.801533, -0.801804, -0.801215, -0.801511, -0.800898, -0.801214,
-    -0.80058, -0.800914, -0.800262, -0.800611, -0.799944, -0.800303,
-    -0.799626, -0.799992, -0.799308, -0.799678, -0.798989, -0.799359,
-    -0.79867, -0.799037, -0.798352, -0.798711, -0.798033, -0.798381,
-    -0.797713, -0.798048, -0.797394, -0.797711, -0.797074, -0.79737,
-    -0.796753, -0.797026, -0.796433, -0.796678, -0.796111, -0.796326,
-    -0.795789, -0.795972, -0.795466, -0.795614, -0.795142, -0.795253,
-    -0.794816, -0.794888, -0.79449, -0.794521, -0.794162, -0.794152,
-    -0.793833, -0.793779, -0.793501, -0.793404, -0.793168, -0.793027,
-    -0.792833, -0.792647, -0.792496, -0.792265, -0.792156, -0.791881,
-    -0.791814, -0.791496, -0.791469, -0.791108, -0.791122, -0.790719,
-    -0.790771, -0.790329, -0.790417, -0.789937, -0.79006, -0.789544,
-    -0.7897, -0.78915, -0.789336, -0.788755, -0.788968, -0.788358,
-    -0.788597, -0.787961, -0.788221, -0.787563, -0.787842, -0.787164,
-    -0.787459, -0.786765, -0.787071, -0.786365, -0.78668, -0.785964,
-    -0.786284, -0.785562, -0.785884, -0.78516, -0.78548, -0.784757,
-    -0.785071, -0.784354, -0.784658, -0.783949, -0.784241, -0.783544,
-    -0.78382, -0.783138, -0.783395, -0.782731, -0.782965, -0.782323,
-    -0.782532, -0.781914, -0.782094, -0.781503, -0.781652, -0.781092,
-    -0.781207, -0.780678, -0.780758, -0.780264, -0.780305, -0.779847,
-    -0.779849, -0.779429, -0.779389, -0.779008, -0.778926, -0.778585,
-    -0.77846, -0.77816, -0.777991, -0.777733, -0.777518, -0.777302,
-    -0.777044, -0.776869, -0.776566, -0.776433, -0.776086, -0.775994,
-    -0.775604, -0.775551, -0.775119, -0.775105, -0.774632, -0.774655,
-    -0.774143, -0.774202, -0.773652, -0.773744, -0.77316, -0.773282,
-    -0.772666, -0.772817, -0.77217, -0.772346, -0.771672, -0.771872,
-    -0.771173, -0.771393, -0.770673, -0.770909, -0.770171, -0.77042,
-    -0.769668, -0.769927, -0.769163, -0.769429, -0.768657, -0.768926,
-    -0.76815, -0.768419, -0.767642, -0.767906, -0.767132, -0.767388,
-    -0.766621, -0.766866, -0.766108, -0.766338, -0.765594, -0.765806,
-    -0.765079, -0.765269, -0.764561, -0.764727, -0.764042, -0.76418,
-    -0.763521, -0.763629, -0.762998, -0.763073, -0.762473, -0.762513,
-    -0.761946, -0.761948, -0.761416, -0.761379, -0.760884, -0.760806,
-    -0.76035, -0.760229, -0.759812, -0.759647, -0.759271, -0.759062,
-    -0.758728, -0.758474, -0.758181, -0.757881, -0.75763, -0.757285,
-    -0.757076, -0.756686, -0.756518, -0.756084, -0.755956, -0.755479,
-    -0.755389, -0.75487, -0.754819, -0.754259, -0.754244, -0.753646,
-    -0.753664, -0.753029, -0.75308, -0.75241, -0.75249, -0.751789,
-    -0.751896, -0.751165, -0.751296, -0.750539, -0.750691, -0.74991,
-    -0.750081, -0.74928, -0.749465, -0.748647, -0.748844, -0.748013,
-    -0.748217, -0.747376, -0.747585, -0.746737, -0.746946, -0.746096,
-    -0.746302, -0.745452, -0.745653, -0.744807, -0.744997, -0.744159,
-    -0.744336, -0.74351, -0.743669, -0.742857, -0.742996, -0.742203,
-    -0.742317, -0.741546, -0.741633, -0.740886, -0.740943, -0.740223,
-    -0.740248, -0.739558, -0.739547, -0.73889, -0.738841, -0.738218,
-    -0.73813, -0.737543, -0.737414, -0.736865, -0.736692, -0.736183,
-    -0.735966, -0.735497, -0.735235, -0.734807, -0.734499, -0.734114,
-    -0.733759, -0.733415, -0.733014, -0.732713, -0.732265, -0.732005,
-    -0.731512, -0.731293, -0.730754, -0.730576, -0.729993, -0.729853,
-    -0.729228, -0.729126, -0.728459, -0.728392, -0.727687, -0.727653,
-    -0.726911, -0.726908, -0.726131, -0.726158, -0.725349, -0.725401,
-    -0.724563, -0.724637, -0.723773, -0.723868, -0.722981, -0.723092,
-    -0.722185, -0.722309, -0.721387, -0.72152, -0.720585, -0.720724,
-    -0.71978, -0.719921, -0.718973, -0.719112, -0.718162, -0.718295,
-    -0.717348, -0.717472, -0.71653, -0.716642, -0.71571, -0.715805,
-    -0.714886, -0.714961, -0.714059, -0.71411, -0.713228, -0.713253,
-    -0.712394, -0.712389, -0.711556, -0.711518, -0.710714, -0.71064,
-    -0.709868, -0.709756, -0.709018, -0.708866, -0.708164, -0.707969,
-    -0.707305, -0.707066, -0.706441, -0.706157, -0.705573, -0.705242,
-    -0.7047, -0.70432, -0.703822, -0.703394, -0.702938, -0.702461,
-    -0.702048, -0.701523, -0.701153, -0.700579, -0.700252, -0.699631,
-    -0.699345, -0.698677, -0.698432, -0.697718, -0.697512, -0.696754,
-    -0.696585, -0.695785, -0.695651, -0.694811, -0.694711, -0.693833,
-    -0.693763, -0.69285, -0.692808, -0.691863, -0.691845, -0.690871,
-    -0.690875, -0.689875, -0.689897, -0.688875, -0.688911, -0.68787,
-    -0.687918, -0.686861, -0.686916, -0.685848, -0.685906, -0.68483,
-    -0.684888, -0.683808, -0.683862, -0.682782, -0.682827, -0.681751,
-    -0.681785, -0.680716, -0.680734, -0.679677, -0.679674, -0.678632,
-    -0.678607, -0.677583, -0.677531, -0.67653, -0.676447, -0.675471,
-    -0.675355, -0.674407, -0.674254, -0.673338, -0.673146, -0.672264,
-    -0.67203, -0.671184, -0.670905, -0.670098, -0.669774, -0.669006,
-    -0.668634, -0.667909, -0.667487, -0.666805, -0.666332, -0.665694,
-    -0.665171, -0.664577, -0.664002, -0.663453, -0.662825, -0.662321,
-    -0.661642, -0.661183, -0.660453, -0.660036, -0.659256, -0.658882,
-    -0.658053, -0.657721, -0.656843, -0.656551, -0.655627, -0.655372,
-    -0.654405, -0.654185, -0.653176, -0.65299, -0.651942, -0.651785,
-    -0.650701, -0.650572, -0.649454, -0.649349, -0.648202, -0.648117,
-    -0.646944, -0.646875, -0.64568, -0.645624, -0.64441, -0.644363,
-    -0.643134, -0.643092, -0.641852, -0.641812, -0.640565, -0.640521,
-    -0.639272, -0.639221, -0.637973, -0.63791, -0.636668, -0.63659,
-    -0.635357, -0.635259, -0.63404, -0.633918, -0.632716, -0.632567,
-    -0.631386, -0.631206, -0.63005, -0.629835, -0.628707, -0.628454,
-    -0.627357, -0.627063, -0.626, -0.625663, -0.624637, -0.624252,
-    -0.623265, -0.622832, -0.621887, -0.621403, -0.6205, -0.619963,
-    -0.619106, -0.618515, -0.617703, -0.617057, -0.616292, -0.61559,
-    -0.614872, -0.614115, -0.613444, -0.61263, -0.612006, -0.611136,
-    -0.610559, -0.609634, -0.609103, -0.608124, -0.607637, -0.606605,
-    -0.60616, -0.605077, -0.604674, -0.603542, -0.603177, -0.601998,
-    -0.60167, -0.600447, -0.600151, -0.598887, -0.598622, -0.59732,
-    -0.597081, -0.595745, -0.595529, -0.594162, -0.593965, -0.592571,
-    -0.59239, -0.590973, -0.590803, -0.589367, -0.589204, -0.587754,
-    -0.587593, -0.586132, -0.58597, -0.584503, -0.584334, -0.582866,
-    -0.582686, -0.581222, -0.581026, -0.579569, -0.579354, -0.577908,
-    -0.577669, -0.576239, -0.575972, -0.574562, -0.574262, -0.572877,
-    -0.57254, -0.571182, -0.570805, -0.569479, -0.569059, -0.567767,
-    -0.5673, -0.566046, -0.565529, -0.564316, -0.563746, -0.562576,
-    -0.561951, -0.560826, -0.560144, -0.559067, -0.558325, -0.557296,
-    -0.556495, -0.555516, -0.554653, -0.553725, -0.5528, -0.551922,
-    -0.550935, -0.550108, -0.54906, -0.548283, -0.547173, -0.546446,
-    -0.545275, -0.544597, -0.543367, -0.542735, -0.541447, -0.540861,
-    -0.539518, -0.538974, -0.537577, -0.537074, -0.535627, -0.535161,
-    -0.533666, -0.533234, -0.531695, -0.531293, -0.529713, -0.529338,
-    -0.527722, -0.527369, -0.52572, -0.525386, -0.523709, -0.523388,
-    -0.521687, -0.521376, -0.519655, -0.519349, -0.517614, -0.517307,
-    -0.515562, -0.515249, -0.5135, -0.513177, -0.511428, -0.51109,
-    -0.509345, -0.508987, -0.507252, -0.506869, -0.505149, -0.504735,
-    -0.503034, -0.502587, -0.500909, -0.500423, -0.498773, -0.498243,
-    -0.496626, -0.496049, -0.494467, -0.493839, -0.492297, -0.491614,
-    -0.490114, -0.489374, -0.48792, -0.487119, -0.485713, -0.484849,
-    -0.483494, -0.482564, -0.481261, -0.480264, -0.479016, -0.47795,
-    -0.476757, -0.475621, -0.474484, -0.473278, -0.472197, -0.470921,
-    -0.469896, -0.46855, -0.46758, -0.466165, -0.465249, -0.463766,
-    -0.462903, -0.461353, -0.460541, -0.458927, -0.458163, -0.456487,
-    -0.455769, -0.454033, -0.453359, -0.451567, -0.450931, -0.449087,
-    -0.448487, -0.446594, -0.446026, -0.444088, -0.443547, -0.44157,
-    -0.441051, -0.439038, -0.438536, -0.436493, -0.436003, -0.433935,
-    -0.433453, -0.431364, -0.430883, -0.42878, -0.428295, -0.426182,
-    -0.425689, -0.423572, -0.423063, -0.420948, -0.420419, -0.418311,
-    -0.417756, -0.415661, -0.415073, -0.412997, -0.412372, -0.410318,
-    -0.409651, -0.407626, -0.406911, -0.40492, -0.404153, -0.402199,
-    -0.401375, -0.399463, -0.398578, -0.396712, -0.395762, -0.393946,
-    -0.392928, -0.391164, -0.390074, -0.388367, -0.387202, -0.385553,
-    -0.384312, -0.382723, -0.381402, -0.379875, -0.378475, -0.377011,
-    -0.375529, -0.374129, -0.372566, -0.371229, -0.369584, -0.368311,
-    -0.366585, -0.365374, -0.363568, -0.362418, -0.360533, -0.359443,
-    -0.357481, -0.356448, -0.354412, -0.353433, -0.351326, -0.350397,
-    -0.348222, -0.347341, -0.345102, -0.344264, -0.341965, -0.341165,
-    -0.338811, -0.338045, -0.33564, -0.334903, -0.332453, -0.331738,
-    -0.329249, -0.328551, -0.326028, -0.325341, -0.32279, -0.322109,
-    -0.319536, -0.318853, -0.316265, -0.315574, -0.312977, -0.312272,
-    -0.309673, -0.308946, -0.306351, -0.305596, -0.303012, -0.302222,
-    -0.299655, -0.298825, -0.296281, -0.295404, -0.292889, -0.291958,
-    -0.289479, -0.288489, -0.286051, -0.284996, -0.282604, -0.281479,
-    -0.279138, -0.277938, -0.275653, -0.274373, -0.272148, -0.270785,
-    -0.268623, -0.267173, -0.265079, -0.263538, -0.261513, -0.259879,
-    -0.257926, -0.256197, -0.254318, -0.252492, -0.250688, -0.248763,
-    -0.247036, -0.245012, -0.24336, -0.241239, -0.239662, -0.237443,
-    -0.23594, -0.233624, -0.232194, -0.229784, -0.228423, -0.225921,
-    -0.224627, -0.222037, -0.220806, -0.218131, -0.21696, -0.214203,
-    -0.213087, -0.210253, -0.209187, -0.206283, -0.20526, -0.20229,
-    -0.201306, -0.198277, -0.197325, -0.194242, -0.193315, -0.190186,
-    -0.189277, -0.186109, -0.18521, -0.182011, -0.181114, -0.177891,
-    -0.176989, -0.17375, -0.172835, -0.169588, -0.168651, -0.165404,
-    -0.164438, -0.161198, -0.160194, -0.15697, -0.155921, -0.15272,
-    -0.151617, -0.148448, -0.147283, -0.144153, -0.142919, -0.139835,
-    -0.138525, -0.135493, -0.134101, -0.131128, -0.129646, -0.126739,
-    -0.125161, -0.122326, -0.120646, -0.117888, -0.116101, -0.113424,
-    -0.111526, -0.108935, -0.106922, -0.10442, -0.102288, -0.0998775,
-    -0.0976243, -0.0953081, -0.0929316, -0.0907109, -0.0882098, -0.0860854,
-    -0.0834592, -0.0814311, -0.0786799, -0.0767473, -0.0738721, -0.0720336,
-    -0.0690361, -0.0672894, -0.064172, -0.0625141, -0.05928, -0.0577071,
-    -0.0543603, -0.052868, -0.0494132, -0.0479962, -0.0444386, -0.0430911,
-    -0.0394369, -0.0381523, -0.0344081, -0.0331792, -0.0293523, -0.0281713,
-    -0.0242697, -0.0231283, -0.0191603, -0.0180496, -0.0140241, -0.0129349,
-    -0.00886121, -0.00778374, -0.00367157, -0.00259578, 0.00154487, 0.0026293,
-    0.00678817, 0.00789182, 0.0120584, 0.013192, 0.0173558, 0.0185302,
-    0.0226805, 0.0239065, 0.0280327, 0.0293211, 0.0334127, 0.0347742,
-    0.0388207, 0.0402658, 0.0442571, 0.045796, 0.0497223, 0.0513649,
-    0.0552166, 0.0569724, 0.0607404, 0.0626186, 0.0662943, 0.0683032,
-    0.0718788, 0.0740264, 0.0774943, 0.0797879, 0.0831415, 0.0855875,
-    0.0888209, 0.0914251, 0.0945332, 0.0973006, 0.100279, 0.103214,
-    0.106059, 0.109164, 0.111874, 0.115151, 0.117725, 0.121175,
-    0.123611, 0.127236, 0.129535, 0.133333, 0.135497, 0.139466,
-    0.141497, 0.145634, 0.147537, 0.151838, 0.153617, 0.158076,
-    0.159737, 0.16435, 0.1659, 0.170658, 0.172104, 0.177,
-    0.178352, 0.183375, 0.184643, 0.189785, 0.190979, 0.196228,
-    0.19736, 0.202704, 0.203787, 0.209214, 0.210261, 0.215756,
-    0.216781, 0.222332, 0.223349, 0.22894, 0.229965, 0.235581,
-    0.23663, 0.242255, 0.243344, 0.248962, 0.250107, 0.255703,
-    0.25692, 0.262476, 0.263783, 0.269283, 0.270696, 0.276124,
-    0.27766, 0.283, 0.284675, 0.289909, 0.29174, 0.296854,
-    0.298857, 0.303834, 0.306024, 0.31085, 0.313242, 0.317903,
-    0.320511, 0.324993, 0.32783, 0.332122, 0.3352, 0.339288,
-    0.342621, 0.346495, 0.350091, 0.353742, 0.357611, 0.36103,
-    0.36518, 0.36836, 0.372797, 0.375734, 0.380464, 0.383151,
-    0.388178, 0.390615, 0.395939, 0.398124, 0.403748, 0.405681,
-    0.411603, 0.413287, 0.419503, 0.420943, 0.427449, 0.428649,
-    0.435439, 0.436408, 0.443473, 0.444221, 0.45155, 0.452088,
-    0.45967, 0.460012, 0.467831, 0.467993, 0.476034, 0.476032,
-    0.484277, 0.484131, 0.49256, 0.492292, 0.500882, 0.500515,
-    0.509243, 0.508802, 0.517642, 0.517154, 0.526078, 0.525572,
-    0.53455, 0.534058, 0.543058, 0.542612, 0.551602, 0.551237,
-    0.56018, 0.559934, 0.568792, 0.568703, 0.577437, 0.577546,
-    0.586115, 0.586465, 0.594825, 0.595461, 0.603566, 0.604535,
-    0.612337, 0.61369, 0.621136, 0.622926, 0.629964, 0.632247,
-    0.638819, 0.641653, 0.647698, 0.651147, 0.656601, 0.660733,
-    0.665524, 0.670414, 0.674464, 0.680193, 0.683419, 0.690076,
-    0.692383, 0.700068, 0.701349, 0.710179, 0.710311, 0.720417,
-    0.719256, 0.730796, 0.72817, 0.741334, 0.737033, 0.752056,
-    0.745815, 0.762998, 0.754475, 0.774213, 0.762949, 0.785779,
-    0.771135, 0.797828, 0.778867, 0.810582, 0.785841, 0.824465,
-    0.791454, 0.840374, 0.794309, 0.860612, 0.790304, 0.893329,
-    0.760285, 1
-};
-
-static const float WAVE_EXPONENTIAL_030[DEFAULT_WAVELEN] = {
-    0.00405878, -0.745554, -1, -0.861354, -0.765038, -0.846182,
-    -0.903607, -0.845133, -0.805416, -0.851652, -0.881162, -0.842581,
-    -0.819684, -0.852952, -0.871151, -0.841754, -0.827018, -0.853398,
-    -0.865413, -0.841401, -0.831526, -0.853556, -0.861641, -0.841236,
-    -0.834608, -0.853584, -0.858936, -0.841163, -0.83687, -0.853541,
-    -0.856875, -0.841145, -0.838614, -0.853453, -0.855234, -0.841164,
-    -0.84001, -0.853334, -0.853884, -0.841209, -0.841159, -0.853189,
-    -0.852744, -0.841275, -0.842126, -0.853025, -0.851762, -0.841358,
-    -0.842953, -0.852843, -0.850903, -0.841456, -0.843669, -0.852647,
-    -0.850141, -0.841568, -0.844296, -0.852437, -0.84946, -0.84169,
-    -0.84485, -0.852215, -0.848845, -0.841823, -0.84534, -0.851982,
-    -0.848287, -0.841966, -0.845776, -0.85174, -0.84778, -0.842116,
-    -0.846164, -0.851488, -0.847315, -0.842273, -0.84651, -0.851229,
-    -0.84689, -0.842437, -0.846818, -0.850963, -0.8465, -0.842606,
-    -0.84709, -0.850691, -0.846143, -0.842779, -0.84733, -0.850413,
-    -0.845815, -0.842956, -0.847541, -0.850132, -0.845516, -0.843135,
-    -0.847723, -0.849847, -0.845242, -0.843316, -0.847878, -0.849559,
-    -0.844993, -0.843498, -0.848009, -0.84927, -0.844766, -0.84368,
-    -0.848115, -0.848979, -0.844562, -0.843861, -0.848199, -0.848689,
-    -0.844379, -0.84404, -0.848262, -0.848399, -0.844215, -0.844217,
-    -0.848303, -0.848111, -0.84407, -0.84439, -0.848325, -0.847825,
-    -0.843943, -0.84456, -0.848328, -0.847543, -0.843833, -0.844724,
-    -0.848313, -0.847264, -0.84374, -0.844884, -0.848281, -0.846989,
-    -0.843661, -0.845036, -0.848232, -0.84672, -0.843598, -0.845183,
-    -0.848168, -0.846456, -0.843547, -0.845321, -0.848089, -0.846198,
-    -0.84351, -0.845452, -0.847996, -0.845947, -0.843485, -0.845574,
-    -0.84789, -0.845704, -0.84347, -0.845686, -0.847772, -0.845468,
-    -0.843467, -0.84579, -0.847642, -0.845241, -0.843472, -0.845883,
-    -0.847502, -0.845022, -0.843487, -0.845966, -0.847352, -0.844812,
-    -0.843509, -0.846038, -0.847193, -0.844612, -0.843538, -0.846099,
-    -0.847025, -0.844421, -0.843573, -0.846149, -0.84685, -0.844239,
-    -0.843613, -0.846187, -0.846669, -0.844067, -0.843658, -0.846214,
-    -0.846482, -0.843906, -0.843707, -0.846229, -0.84629, -0.843754,
-    -0.843758, -0.846233, -0.846094, -0.843612, -0.843811, -0.846225,
-    -0.845894, -0.84348, -0.843866, -0.846205, -0.845692, -0.843357,
-    -0.84392, -0.846174, -0.845489, -0.843245, -0.843975, -0.846131,
-    -0.845284, -0.843142, -0.844028, -0.846077, -0.845078, -0.843048,
-    -0.844079, -0.846012, -0.844873, -0.842963, -0.844128, -0.845937,
-    -0.844669, -0.842887, -0.844174, -0.845851, -0.844467, -0.842819,
-    -0.844216, -0.845754, -0.844267, -0.842759, -0.844253, -0.845649,
-    -0.844069, -0.842706, -0.844286, -0.845533, -0.843875, -0.842661,
-    -0.844313, -0.845409, -0.843684, -0.842622, -0.844333, -0.845277,
-    -0.843498, -0.842589, -0.844348, -0.845137, -0.843316, -0.842562,
-    -0.844355, -0.844989, -0.84314, -0.84254, -0.844356, -0.844834,
-    -0.842968, -0.842522, -0.844348, -0.844673, -0.842802, -0.842509,
-    -0.844333, -0.844506, -0.842642, -0.842498, -0.844309, -0.844334,
-    -0.842489, -0.842491, -0.844277, -0.844158, -0.842341, -0.842485,
-    -0.844237, -0.843977, -0.8422, -0.842481, -0.844188, -0.843793,
-    -0.842065, -0.842478, -0.84413, -0.843605, -0.841936, -0.842475,
-    -0.844064, -0.843416, -0.841814, -0.842472, -0.843988, -0.843224,
-    -0.841698, -0.842468, -0.843904, -0.843032, -0.841589, -0.842463,
-    -0.843812, -0.842838, -0.841486, -0.842456, -0.843711, -0.842645,
-    -0.841388, -0.842446, -0.843601, -0.842452, -0.841297, -0.842433,
-    -0.843483, -0.842259, -0.84121, -0.842416, -0.843358, -0.842068,
-    -0.84113, -0.842396, -0.843225, -0.841879, -0.841054, -0.842371,
-    -0.843084, -0.841691, -0.840982, -0.84234, -0.842936, -0.841506,
-    -0.840915, -0.842305, -0.842782, -0.841324, -0.840852, -0.842264,
-    -0.842621, -0.841146, -0.840792, -0.842217, -0.842455, -0.84097,
-    -0.840735, -0.842163, -0.842282, -0.840799, -0.840681, -0.842103,
-    -0.842105, -0.840631, -0.840628, -0.842036, -0.841923, -0.840467,
-    -0.840578, -0.841962, -0.841737, -0.840308, -0.840528, -0.84188,
-    -0.841546, -0.840153, -0.84048, -0.841792, -0.841353, -0.840003,
-    -0.840431, -0.841695, -0.841156, -0.839857, -0.840382, -0.841592,
-    -0.840957, -0.839715, -0.840332, -0.84148, -0.840756, -0.839578,
-    -0.840281, -0.841361, -0.840554, -0.839446, -0.840229, -0.841235,
-    -0.84035, -0.839318, -0.840174, -0.841101, -0.840146, -0.839194,
-    -0.840116, -0.84096, -0.839941, -0.839074, -0.840055, -0.840812,
-    -0.839736, -0.838957, -0.839991, -0.840656, -0.839532, -0.838845,
-    -0.839922, -0.840494, -0.839329, -0.838736, -0.83985, -0.840326,
-    -0.839127, -0.83863, -0.839772, -0.84015, -0.838926, -0.838526,
-    -0.83969, -0.839969, -0.838727, -0.838425, -0.839602, -0.839782,
-    -0.83853, -0.838327, -0.839508, -0.83959, -0.838335, -0.83823,
-    -0.839409, -0.839392, -0.838143, -0.838134, -0.839303, -0.83919,
-    -0.837954, -0.83804, -0.839191, -0.838983, -0.837767, -0.837946,
-    -0.839072, -0.838772, -0.837584, -0.837852, -0.838946, -0.838557,
-    -0.837403, -0.837758, -0.838814, -0.838339, -0.837226, -0.837663,
-    -0.838674, -0.838118, -0.837051, -0.837567, -0.838528, -0.837894,
-    -0.83688, -0.83747, -0.838374, -0.837668, -0.836712, -0.837371,
-    -0.838214, -0.83744, -0.836547, -0.83727, -0.838046, -0.837211,
-    -0.836385, -0.837165, -0.837871, -0.83698, -0.836226, -0.837058,
-    -0.83769, -0.836749, -0.836069, -0.836947, -0.837502, -0.836517,
-    -0.835915, -0.836832, -0.837307, -0.836285, -0.835763, -0.836713,
-    -0.837105, -0.836053, -0.835614, -0.83659, -0.836898, -0.835821,
-    -0.835466, -0.836461, -0.836684, -0.835591, -0.835319, -0.836327,
-    -0.836464, -0.835361, -0.835174, -0.836188, -0.836239, -0.835132,
-    -0.83503, -0.836042, -0.836008, -0.834905, -0.834886, -0.835891,
-    -0.835773, -0.834679, -0.834743, -0.835734, -0.835532, -0.834454,
-    -0.8346, -0.83557, -0.835287, -0.834232, -0.834456, -0.835399,
-    -0.835038, -0.834011, -0.834312, -0.835222, -0.834785, -0.833793,
-    -0.834166, -0.835038, -0.834528, -0.833576, -0.834019, -0.834847,
-    -0.834268, -0.833361, -0.83387, -0.834649, -0.834005, -0.833148,
-    -0.833718, -0.834444, -0.83374, -0.832937, -0.833564, -0.834232,
-    -0.833472, -0.832728, -0.833407, -0.834013, -0.833203, -0.832521,
-    -0.833246, -0.833787, -0.832932, -0.832315, -0.833081, -0.833554,
-    -0.832659, -0.832111, -0.832913, -0.833314, -0.832385, -0.831908,
-    -0.83274, -0.833068, -0.832111, -0.831706, -0.832562, -0.832815,
-    -0.831835, -0.831505, -0.832378, -0.832556, -0.83156, -0.831304,
-    -0.83219, -0.832291, -0.831284, -0.831104, -0.831996, -0.83202,
-    -0.831009, -0.830904, -0.831795, -0.831743, -0.830734, -0.830704,
-    -0.831589, -0.83146, -0.830459, -0.830503, -0.831376, -0.831172,
-    -0.830184, -0.830302, -0.831157, -0.830879, -0.829911, -0.830099,
-    -0.83093, -0.830582, -0.829638, -0.829895, -0.830697, -0.830279,
-    -0.829366, -0.829689, -0.830457, -0.829973, -0.829094, -0.82948,
-    -0.830209, -0.829663, -0.828824, -0.829269, -0.829955, -0.829348,
-    -0.828554, -0.829056, -0.829693, -0.829031, -0.828285, -0.828839,
-    -0.829423, -0.82871, -0.828017, -0.828618, -0.829147, -0.828387,
-    -0.82775, -0.828393, -0.828863, -0.828061, -0.827483, -0.828164,
-    -0.828572, -0.827733, -0.827216, -0.82793, -0.828273, -0.827402,
-    -0.82695, -0.827692, -0.827968, -0.82707, -0.826683, -0.827448,
-    -0.827655, -0.826736, -0.826417, -0.827198, -0.827336, -0.826401,
-    -0.82615, -0.826942, -0.82701, -0.826065, -0.825882, -0.82668,
-    -0.826677, -0.825727, -0.825614, -0.826412, -0.826338, -0.825389,
-    -0.825344, -0.826137, -0.825993, -0.82505, -0.825073, -0.825855,
-    -0.825642, -0.82471, -0.824801, -0.825567, -0.825285, -0.82437,
-    -0.824526, -0.82527, -0.824922, -0.82403, -0.824249, -0.824967,
-    -0.824554, -0.823689, -0.823969, -0.824655, -0.824181, -0.823347,
-    -0.823686, -0.824336, -0.823804, -0.823006, -0.823399, -0.824009,
-    -0.823421, -0.822664, -0.823109, -0.823675, -0.823034, -0.822321,
-    -0.822815, -0.823332, -0.822643, -0.821978, -0.822516, -0.822982,
-    -0.822249, -0.821635, -0.822212, -0.822623, -0.82185, -0.821291,
-    -0.821904, -0.822257, -0.821448, -0.820946, -0.82159, -0.821882,
-    -0.821043, -0.8206, -0.82127, -0.8215, -0.820635, -0.820253,
-    -0.820944, -0.82111, -0.820225, -0.819905, -0.820611, -0.820712,
-    -0.819811, -0.819555, -0.820272, -0.820307, -0.819396, -0.819203,
-    -0.819926, -0.819894, -0.818978, -0.81885, -0.819573, -0.819474,
-    -0.818558, -0.818494, -0.819212, -0.819047, -0.818135, -0.818135,
-    -0.818844, -0.818613, -0.817712, -0.817774, -0.818467, -0.818172,
-    -0.817286, -0.817409, -0.818083, -0.817725, -0.816858, -0.817041,
-    -0.81769, -0.817271, -0.816429, -0.816669, -0.817288, -0.816811,
-    -0.815998, -0.816293, -0.816879, -0.816345, -0.815566, -0.815913,
-    -0.81646, -0.815873, -0.815131, -0.815528, -0.816032, -0.815396,
-    -0.814695, -0.815137, -0.815596, -0.814913, -0.814257, -0.814741,
-    -0.815151, -0.814425, -0.813818, -0.814339, -0.814697, -0.813933,
-    -0.813376, -0.813931, -0.814234, -0.813435, -0.812932, -0.813516,
-    -0.813762, -0.812933, -0.812486, -0.813095, -0.81328, -0.812427,
-    -0.812037, -0.812666, -0.812791, -0.811917, -0.811586, -0.81223,
-    -0.812292, -0.811403, -0.811131, -0.811786, -0.811784, -0.810884,
-    -0.810674, -0.811333, -0.811268, -0.810363, -0.810213, -0.810873,
-    -0.810744, -0.809837, -0.809749, -0.810404, -0.810211, -0.809308,
-    -0.80928, -0.809926, -0.80967, -0.808776, -0.808807, -0.809438,
-    -0.80912, -0.80824, -0.80833, -0.808942, -0.808563, -0.807702,
-    -0.807848, -0.808436, -0.807998, -0.807159, -0.807361, -0.80792,
-    -0.807426, -0.806614, -0.806868, -0.807395, -0.806846, -0.806066,
-    -0.806369, -0.806859, -0.806258, -0.805514, -0.805864, -0.806314,
-    -0.805664, -0.804959, -0.805352, -0.805758, -0.805063, -0.8044,
-    -0.804834, -0.805192, -0.804455, -0.803838, -0.804308, -0.804615,
-    -0.803841, -0.803272, -0.803774, -0.804028, -0.803221, -0.802703,
-    -0.803233, -0.803431, -0.802594, -0.802129, -0.802683, -0.802824,
-    -0.801961, -0.801551, -0.802125, -0.802206, -0.801323, -0.800969,
-    -0.801557, -0.801577, -0.800679, -0.800383, -0.80098, -0.800939,
-    -0.800029, -0.799791, -0.800394, -0.80029, -0.799374, -0.799195,
-    -0.799798, -0.799631, -0.798713, -0.798593, -0.799191, -0.798962,
-    -0.798048, -0.797986, -0.798574, -0.798284, -0.797377, -0.797372,
-    -0.797947, -0.797595, -0.796701, -0.796753, -0.797308, -0.796897,
-    -0.79602, -0.796126, -0.796658, -0.796189, -0.795333, -0.795493,
-    -0.795997, -0.795472, -0.794642, -0.794852, -0.795324, -0.794745,
-    -0.793945, -0.794204, -0.79464, -0.79401, -0.793244, -0.793548,
-    -0.793944, -0.793265, -0.792537, -0.792883, -0.793236, -0.792512,
-    -0.791824, -0.792209, -0.792515, -0.79175, -0.791106, -0.791527,
-    -0.791783, -0.79098, -0.790383, -0.790835, -0.791038, -0.790202,
-    -0.789654, -0.790133, -0.790281, -0.789415, -0.788919, -0.78942,
-    -0.789512, -0.78862, -0.788177, -0.788698, -0.78873, -0.787818,
-    -0.787429, -0.787964, -0.787936, -0.787007, -0.786675, -0.787219,
-    -0.78713, -0.786189, -0.785914, -0.786462, -0.786311, -0.785363,
-    -0.785145, -0.785694, -0.78548, -0.78453, -0.784369, -0.784913,
-    -0.784638, -0.783689, -0.783585, -0.784119, -0.783782, -0.782841,
-    -0.782794, -0.783313, -0.782915, -0.781986, -0.781993, -0.782494,
-    -0.782037, -0.781123, -0.781184, -0.781661, -0.781146, -0.780253,
-    -0.780366, -0.780815, -0.780243, -0.779375, -0.779538, -0.779955,
-    -0.779329, -0.77849, -0.7787, -0.779081, -0.778404, -0.777597,
-    -0.777852, -0.778193, -0.777467, -0.776697, -0.776993, -0.77729,
-    -0.776519, -0.775788, -0.776123, -0.776373, -0.775561, -0.774872,
-    -0.775241, -0.775442, -0.774591, -0.773948, -0.774348, -0.774496,
-    -0.77361, -0.773016, -0.773442, -0.773535, -0.772618, -0.772075,
-    -0.772524, -0.772559, -0.771616, -0.771125, -0.771592, -0.771568,
-    -0.770604, -0.770167, -0.770647, -0.770563, -0.769581, -0.769199,
-    -0.769688, -0.769542, -0.768548, -0.768221, -0.768715, -0.768506,
-    -0.767504, -0.767234, -0.767728, -0.767456, -0.76645, -0.766237,
-    -0.766725, -0.766391, -0.765386, -0.765229, -0.765707, -0.76531,
-    -0.764312, -0.764211, -0.764674, -0.764215, -0.763227, -0.763181,
-    -0.763625, -0.763105, -0.762132, -0.762139, -0.762559, -0.761981,
-    -0.761028, -0.761086, -0.761477, -0.760842, -0.759912, -0.76002,
-    -0.760379, -0.759688, -0.758787, -0.758941, -0.759263, -0.75852,
-    -0.75765, -0.757849, -0.758131, -0.757338, -0.756503, -0.756744,
-    -0.756981, -0.756141, -0.755346, -0.755624, -0.755813, -0.75493,
-    -0.754177, -0.75449, -0.754628, -0.753705, -0.752997, -0.753341,
-    -0.753425, -0.752466, -0.751806, -0.752176, -0.752203, -0.751213,
-    -0.750603, -0.750995, -0.750964, -0.749946, -0.749389, -0.749798,
-    -0.749707, -0.748665, -0.748162, -0.748585, -0.748431, -0.747371,
-    -0.746923, -0.747354, -0.747137, -0.746063, -0.74567, -0.746106,
-    -0.745825, -0.744741, -0.744405, -0.744839, -0.744494, -0.743406,
-    -0.743126, -0.743555, -0.743144, -0.742057, -0.741834, -0.742251,
-    -0.741777, -0.740694, -0.740527, -0.740929, -0.74039, -0.739317,
-    -0.739205, -0.739587, -0.738986, -0.737927, -0.737868, -0.738225,
-    -0.737563, -0.736523, -0.736516, -0.736843, -0.736121, -0.735105,
-    -0.735147, -0.735441, -0.734662, -0.733672, -0.733762, -0.734017,
-    -0.733184, -0.732226, -0.73236, -0.732573, -0.731688, -0.730765,
-    -0.730941, -0.731108, -0.730173, -0.729289, -0.729503, -0.729621,
-    -0.728641, -0.727799, -0.728048, -0.728112, -0.72709, -0.726294,
-    -0.726573, -0.726581, -0.725521, -0.724773, -0.725079, -0.725028,
-    -0.723935, -0.723237, -0.723565, -0.723453, -0.72233, -0.721685,
-    -0.72203, -0.721856, -0.720708, -0.720116, -0.720475, -0.720235,
-    -0.719067, -0.718531, -0.718898, -0.718592, -0.717408, -0.716929,
-    -0.717299, -0.716927, -0.715732, -0.71531, -0.715678, -0.715238,
-    -0.714037, -0.713673, -0.714034, -0.713527, -0.712325, -0.712017,
-    -0.712367, -0.711792, -0.710594, -0.710343, -0.710676, -0.710035,
-    -0.708845, -0.70865, -0.708961, -0.708254, -0.707078, -0.706937,
-    -0.707222, -0.70645, -0.705292, -0.705204, -0.705458, -0.704623,
-    -0.703488, -0.703451, -0.703668, -0.702773, -0.701665, -0.701676,
-    -0.701853, -0.7009, -0.699823, -0.699879, -0.700012, -0.699004,
-    -0.697962, -0.69806, -0.698144, -0.697084, -0.696081, -0.696219,
-    -0.69625, -0.695141, -0.694181, -0.694354, -0.694329, -0.693175,
-    -0.692261, -0.692465, -0.692381, -0.691186, -0.69032, -0.690551,
-    -0.690405, -0.689174, -0.688359, -0.688612, -0.688402, -0.687138,
-    -0.686377, -0.686648, -0.686371, -0.685079, -0.684374, -0.684657,
-    -0.684311, -0.682997, -0.682348, -0.68264, -0.682224, -0.680892,
-    -0.680301, -0.680595, -0.680108, -0.678763, -0.678231, -0.678522,
-    -0.677963, -0.67661, -0.676137, -0.676421, -0.67579, -0.674434,
-    -0.67402, -0.67429, -0.673588, -0.672235, -0.671879, -0.672131,
-    -0.671356, -0.670011, -0.669712, -0.669941, -0.669096, -0.667763,
-    -0.667521, -0.667721, -0.666807, -0.665491, -0.665303, -0.665469,
-    -0.664488, -0.663195, -0.663059, -0.663187, -0.66214, -0.660874,
-    -0.660788, -0.660872, -0.659763, -0.658528, -0.658489, -0.658525,
-    -0.657356, -0.656157, -0.656162, -0.656145, -0.65492, -0.65376,
-    -0.653805, -0.653732, -0.652454, -0.651338, -0.651419, -0.651286,
-    -0.649958, -0.648889, -0.649002, -0.648806, -0.647433, -0.646414,
-    -0.646555, -0.646291, -0.644878, -0.643912, -0.644075, -0.643742,
-    -0.642293, -0.641382, -0.641563, -0.641158, -0.639678, -0.638824,
-    -0.639018, -0.638539, -0.637033, -0.636238, -0.63644, -0.635884,
-    -0.634357, -0.633623, -0.633827, -0.633194, -0.631651, -0.630978,
-    -0.631179, -0.630468, -0.628915, -0.628304, -0.628495, -0.627706,
-    -0.626148, -0.625598, -0.625775, -0.624908, -0.623351, -0.622862,
-    -0.623018, -0.622073, -0.620522, -0.620093, -0.620223, -0.619201,
-    -0.617662, -0.617292, -0.61739, -0.616293, -0.61477, -0.614457,
-    -0.614518, -0.613347, -0.611846, -0.611589, -0.611607, -0.610364,
-    -0.608891, -0.608685, -0.608656, -0.607344, -0.605902, -0.605747,
-    -0.605665, -0.604287, -0.602881, -0.602771, -0.602632, -0.601191,
-    -0.599827, -0.599759, -0.599558, -0.598058, -0.596739, -0.596709,
-    -0.596442, -0.594887, -0.593617, -0.593621, -0.593284, -0.591679,
-    -0.59046, -0.590493, -0.590083, -0.588431, -0.587268, -0.587325,
-    -0.586838, -0.585146, -0.584041, -0.584116, -0.58355, -0.581821,
-    -0.580777, -0.580865, -0.580217, -0.578459, -0.577477, -0.577572,
-    -0.57684, -0.575057, -0.574139, -0.574235, -0.573418, -0.571616,
-    -0.570762, -0.570854, -0.569951, -0.568135, -0.567348, -0.567429,
-    -0.566438, -0.564615, -0.563893, -0.563957, -0.56288, -0.561055,
-    -0.560398, -0.560439, -0.559275, -0.557455, -0.556862, -0.556874,
-    -0.555624, -0.553814, -0.553284, -0.553261, -0.551926, -0.550132,
-    -0.549664, -0.549599, -0.548181, -0.546409, -0.546, -0.545887,
-    -0.544389, -0.542644, -0.542292, -0.542125, -0.54055, -0.538837,
-    -0.538538, -0.538313, -0.536662, -0.534988, -0.534738, -0.534449,
-    -0.532727, -0.531095, -0.530891, -0.530533, -0.528744, -0.527159,
-    -0.526996, -0.526564, -0.524712, -0.523179, -0.523052, -0.522541,
-    -0.520631, -0.519154, -0.519058, -0.518465, -0.516501, -0.515084,
-    -0.515013, -0.514334, -0.512322, -0.510967, -0.510916, -0.510148,
-    -0.508094, -0.506804, -0.506766, -0.505906, -0.503816, -0.502593,
-    -0.502563, -0.501608, -0.499488, -0.498334, -0.498305, -0.497253,
-    -0.495109, -0.494026, -0.493991, -0.492842, -0.490679, -0.489668,
-    -0.48962, -0.488372, -0.486199, -0.485259, -0.485192, -0.483845,
-    -0.481667, -0.480799, -0.480705, -0.479259, -0.477083, -0.476286,
-    -0.476158, -0.474614, -0.472447, -0.471719, -0.471551, -0.469909,
-    -0.467758, -0.467098, -0.466882, -0.465145, -0.463016, -0.462421,
-    -0.462151, -0.460321, -0.45822, -0.457687, -0.457357, -0.455437,
-    -0.45337, -0.452896, -0.452498, -0.450491, -0.448464, -0.448046,
-    -0.447575, -0.445485, -0.443504, -0.443135, -0.442586, -0.440417,
-    -0.438487, -0.438164, -0.43753, -0.435287, -0.433413, -0.433131,
-    -0.432407, -0.430094, -0.428281, -0.428034, -0.427215, -0.424839,
-    -0.423091, -0.422873, -0.421955, -0.419521, -0.417842, -0.417646,
-    -0.416624, -0.41414, -0.412533, -0.412352, -0.411224, -0.408694,
-    -0.407162, -0.406989, -0.405752, -0.403184, -0.40173, -0.401558,
-    -0.400208, -0.39761, -0.396235, -0.396056, -0.394592, -0.39197,
-    -0.390676, -0.390482, -0.388903, -0.386265, -0.385052, -0.384835,
-    -0.38314, -0.380494, -0.379361, -0.379114, -0.377303, -0.374656,
-    -0.373604, -0.373318, -0.371391, -0.36875, -0.367778, -0.367445,
-    -0.365403, -0.362777, -0.361882, -0.361495, -0.359339, -0.356736,
-    -0.355915, -0.355465, -0.353199, -0.350625, -0.349877, -0.349356,
-    -0.346982, -0.344444, -0.343764, -0.343165, -0.340687, -0.338193,
-    -0.337577, -0.336893, -0.334314, -0.33187, -0.331314, -0.330536,
-    -0.327862, -0.325476, -0.324973, -0.324096, -0.321331, -0.319008,
-    -0.318553, -0.31757, -0.31472, -0.312466, -0.312053, -0.310958,
-    -0.308029, -0.30585, -0.305471, -0.304258, -0.301258, -0.299157,
-    -0.298805, -0.29747, -0.294405, -0.292388, -0.292055, -0.290592,
-    -0.28747, -0.28554, -0.285218, -0.283624, -0.280453, -0.278613,
-    -0.278294, -0.276565, -0.273353, -0.271606, -0.27128, -0.269413,
-    -0.266169, -0.264517, -0.264175, -0.262169, -0.258901, -0.257345,
-    -0.256978, -0.25483, -0.251548, -0.250089, -0.249687, -0.247397,
-    -0.24411, -0.242747, -0.2423, -0.239869, -0.236585, -0.235319,
-    -0.234816, -0.232244, -0.228973, -0.227801, -0.227234, -0.224522,
-    -0.221274, -0.220193, -0.219552, -0.216702, -0.213486, -0.212494,
-    -0.211769, -0.208784, -0.205609, -0.204701, -0.203882, -0.200766,
-    -0.197641, -0.196814, -0.195892, -0.192649, -0.189582, -0.188829,
-    -0.187795, -0.18443, -0.18143, -0.180747, -0.179591, -0.176111,
-    -0.173185, -0.172564, -0.171279, -0.167689, -0.164846, -0.164279,
-    -0.162857, -0.159165, -0.156411, -0.155891, -0.154323, -0.150536,
-    -0.147879, -0.147397, -0.145677, -0.141804, -0.139249, -0.138795,
-    -0.136917, -0.132967, -0.13052, -0.130084, -0.128041, -0.124024,
-    -0.12169, -0.121262, -0.119049, -0.114975, -0.112757, -0.112326,
-    -0.109939, -0.105818, -0.103721, -0.103275, -0.100711, -0.0965539,
-    -0.0945798, -0.0941076, -0.0913624, -0.0871808, -0.0853314, -0.0848207,
-    -0.0818926, -0.077698, -0.0759744, -0.0754128, -0.0723006, -0.0681048,
-    -0.066507, -0.0658818, -0.0625851, -0.0584003, -0.0569274, -0.0562257,
-    -0.0527452, -0.0485835, -0.0472338, -0.0464427, -0.0427798, -0.0386534,
-    -0.0374243, -0.0365307, -0.0326878, -0.0286091, -0.0274969, -0.0264878,
-    -0.0224683, -0.0184494, -0.0174495, -0.0163121, -0.0121203, -0.00817337,
-    -0.00728006, -0.00600148, -0.00164286, 0.00222027, 0.00301355, 0.00444584,
-    0.00896505, 0.0127327, 0.0134335, 0.0150318, 0.0197043, 0.0233652,
-    0.0239821, 0.0257583, 0.0305759, 0.0341191, 0.0346615, 0.0366272,
-    0.0415808, 0.0449957, 0.0454742, 0.0476404, 0.0527198, 0.0559966,
-    0.0564225, 0.0587997, 0.0639938, 0.0671231, 0.0675088, 0.0701068,
-    0.0754039, 0.078377, 0.0787356, 0.0815637, 0.0869509, 0.0897598,
-    0.0901054, 0.0931719, 0.0986357, 0.101273, 0.101621, 0.104933,
-    0.110459, 0.112919, 0.113284, 0.11685, 0.122423, 0.124699,
-    0.125098, 0.128923, 0.134527, 0.136616, 0.137065, 0.141154,
-    0.146772, 0.14867, 0.149189, 0.153544, 0.15916, 0.160865,
-    0.161471, 0.166097, 0.171692, 0.173202, 0.173914, 0.178812,
-    0.184369, 0.185683, 0.186521, 0.191692, 0.197191, 0.198312,
-    0.199295, 0.204738, 0.210161, 0.211089, 0.212239, 0.217951,
-    0.223278, 0.224018, 0.225355, 0.231334, 0.236544, 0.237102,
-    0.238646, 0.244887, 0.24996, 0.250341, 0.252115, 0.258612,
-    0.263528, 0.26374, 0.265765, 0.272511, 0.277249, 0.277301,
-    0.279599, 0.286584, 0.291124, 0.291026, 0.293619, 0.300834,
-    0.305153, 0.304918, 0.307829, 0.315261, 0.31934, 0.318981,
-    0.322231, 0.329868, 0.333684, 0.333217, 0.336829, 0.344655,
-    0.348187, 0.347628, 0.351626, 0.359625, 0.36285, 0.362219,
-    0.366624, 0.374777, 0.377675, 0.376991, 0.381828, 0.390115,
-    0.392662, 0.391949, 0.39724, 0.405639, 0.407814, 0.407094,
-    0.412864, 0.421351, 0.42313, 0.422431, 0.428704, 0.437252,
-    0.438612, 0.437963, 0.444763, 0.453343, 0.454261, 0.453692,
-    0.461046, 0.469627, 0.470076, 0.469622, 0.477557, 0.486105,
-    0.486059, 0.485757, 0.494301, 0.502778, 0.502209, 0.502099,
-    0.511284, 0.519649, 0.518525, 0.518653, 0.528512, 0.536718,
-    0.535005, 0.535421, 0.545991, 0.553987, 0.551647, 0.552407,
-    0.563731, 0.571458, 0.568447, 0.569614, 0.581741, 0.589132,
-    0.585398, 0.587047, 0.600034, 0.607011, 0.602493, 0.604709,
-    0.618626, 0.625096, 0.619718, 0.622604, 0.637537, 0.643389,
-    0.637055, 0.640737, 0.656795, 0.66189, 0.654478, 0.659113,
-    0.676438, 0.680599, 0.671947, 0.677738, 0.69652, 0.699514,
-    0.689399, 0.696621, 0.717126, 0.718632, 0.706737, 0.715772,
-    0.738387, 0.737943, 0.723794, 0.735214, 0.760531, 0.757424,
-    0.740269, 0.754985, 0.783984, 0.777022, 0.75556, 0.77518,
-    0.809648, 0.796585, 0.768268, 0.796083, 0.839837, 0.815562,
-    0.774281, 0.818927, 0.882729, 0.83068, 0.754388, 0.855566,
-    1, 0.751207
-};
-
-static const float WAVE_EXPONENTIAL_042[DEFAULT_WAVELEN] = {
-    0.00813208, -0.409349, -0.744551, -0.943682, -1, -0.951392,
-    -0.86041, -0.786628, -0.763985, -0.792441, -0.845874, -0.89041,
-    -0.903122, -0.882064, -0.84397, -0.812519, -0.804545, -0.821699,
-    -0.851377, -0.875336, -0.880488, -0.865716, -0.841336, -0.822203,
-    -0.818879, -0.831984, -0.852654, -0.868354, -0.870344, -0.858424,
-    -0.840455, -0.827274, -0.826244, -0.837212, -0.853058, -0.864244,
-    -0.864492, -0.854247, -0.840058, -0.830431, -0.830768, -0.840375,
-    -0.853163, -0.861469, -0.860615, -0.851506, -0.839855, -0.832615,
-    -0.833856, -0.842491, -0.85313, -0.859417, -0.857809, -0.849548,
-    -0.839747, -0.83424, -0.836116, -0.844, -0.853019, -0.8578,
-    -0.855651, -0.848066, -0.839697, -0.835514, -0.837853, -0.84512,
-    -0.852858, -0.856463, -0.853916, -0.846897, -0.839685, -0.836553,
-    -0.839236, -0.845976, -0.85266, -0.855318, -0.852473, -0.845947,
-    -0.839701, -0.837427, -0.840367, -0.846639, -0.852432, -0.854309,
-    -0.851241, -0.845159, -0.83974, -0.838179, -0.84131, -0.847158,
-    -0.85218, -0.8534, -0.850168, -0.844494, -0.839796, -0.838839,
-    -0.842108, -0.847563, -0.851906, -0.852567, -0.849219, -0.843926,
-    -0.839867, -0.839427, -0.842791, -0.847875, -0.851612, -0.851794,
-    -0.848369, -0.843436, -0.839951, -0.839957, -0.843379, -0.848111,
-    -0.851301, -0.851068, -0.847601, -0.843012, -0.840047, -0.840437,
-    -0.843887, -0.848281, -0.850975, -0.850382, -0.8469, -0.842643,
-    -0.840152, -0.840877, -0.844327, -0.848394, -0.850634, -0.849729,
-    -0.846258, -0.842321, -0.840265, -0.84128, -0.844707, -0.848457,
-    -0.85028, -0.849104, -0.845667, -0.842041, -0.840385, -0.841651,
-    -0.845033, -0.848476, -0.849913, -0.848505, -0.84512, -0.841797,
-    -0.84051, -0.841992, -0.845312, -0.848454, -0.849536, -0.847928,
-    -0.844614, -0.841586, -0.84064, -0.842305, -0.845545, -0.848396,
-    -0.849149, -0.847371, -0.844144, -0.841404, -0.840772, -0.842592,
-    -0.845738, -0.848304, -0.848754, -0.846833, -0.843707, -0.841247,
-    -0.840906, -0.842855, -0.845892, -0.848181, -0.848351, -0.846314,
-    -0.843301, -0.841114, -0.841041, -0.843093, -0.84601, -0.848029,
-    -0.847941, -0.845811, -0.842923, -0.841001, -0.841175, -0.843307,
-    -0.846094, -0.847851, -0.847527, -0.845326, -0.842572, -0.840908,
-    -0.841306, -0.843498, -0.846145, -0.847647, -0.847107, -0.844856,
-    -0.842246, -0.840831, -0.841435, -0.843666, -0.846165, -0.847421,
-    -0.846685, -0.844403, -0.841943, -0.840769, -0.841559, -0.843811,
-    -0.846155, -0.847174, -0.84626, -0.843965, -0.841662, -0.84072,
-    -0.841677, -0.843934, -0.846116, -0.846907, -0.845833, -0.843542,
-    -0.841402, -0.840682, -0.841789, -0.844033, -0.846049, -0.846622,
-    -0.845407, -0.843134, -0.841161, -0.840654, -0.841893, -0.844109,
-    -0.845956, -0.846319, -0.84498, -0.842742, -0.840938, -0.840634,
-    -0.841988, -0.844162, -0.845838, -0.846002, -0.844555, -0.842364,
-    -0.840733, -0.840621, -0.842072, -0.844193, -0.845694, -0.84567,
-    -0.844133, -0.842001, -0.840542, -0.840613, -0.842146, -0.8442,
-    -0.845527, -0.845325, -0.843713, -0.841652, -0.840367, -0.840609,
-    -0.842208, -0.844185, -0.845338, -0.844969, -0.843297, -0.841317,
-    -0.840205, -0.840606, -0.842257, -0.844146, -0.845127, -0.844603,
-    -0.842885, -0.840996, -0.840055, -0.840605, -0.842293, -0.844085,
-    -0.844894, -0.844227, -0.842478, -0.840688, -0.839916, -0.840603,
-    -0.842313, -0.844002, -0.844643, -0.843843, -0.842077, -0.840394,
-    -0.839787, -0.840598, -0.842318, -0.843896, -0.844372, -0.843453,
-    -0.841682, -0.840112, -0.839667, -0.840591, -0.842308, -0.843768,
-    -0.844083, -0.843056, -0.841294, -0.839842, -0.839554, -0.840579,
-    -0.84228, -0.843618, -0.843778, -0.842654, -0.840912, -0.839584,
-    -0.839447, -0.840561, -0.842235, -0.843447, -0.843457, -0.842249,
-    -0.840538, -0.839337, -0.839345, -0.840536, -0.842172, -0.843254,
-    -0.84312, -0.841841, -0.840172, -0.8391, -0.839247, -0.840502,
-    -0.84209, -0.843041, -0.84277, -0.84143, -0.839813, -0.838872,
-    -0.839151, -0.84046, -0.84199, -0.842807, -0.842407, -0.841018,
-    -0.839462, -0.838654, -0.839057, -0.840407, -0.841871, -0.842554,
-    -0.842032, -0.840606, -0.839119, -0.838443, -0.838963, -0.840342,
-    -0.841732, -0.842281, -0.841645, -0.840194, -0.838783, -0.83824,
-    -0.838867, -0.840266, -0.841574, -0.841989, -0.841249, -0.839783,
-    -0.838456, -0.838043, -0.838769, -0.840175, -0.841395, -0.84168,
-    -0.840843, -0.839373, -0.838135, -0.837851, -0.838668, -0.840071,
-    -0.841197, -0.841353, -0.840429, -0.838966, -0.837823, -0.837664,
-    -0.838561, -0.839952, -0.840979, -0.841009, -0.840008, -0.838561,
-    -0.837517, -0.83748, -0.838449, -0.839817, -0.840741, -0.840649,
-    -0.83958, -0.838158, -0.837217, -0.837299, -0.838329, -0.839665,
-    -0.840483, -0.840274, -0.839146, -0.837759, -0.836924, -0.837119,
-    -0.838201, -0.839497, -0.840206, -0.839884, -0.838708, -0.837363,
-    -0.836637, -0.83694, -0.838064, -0.839311, -0.839909, -0.839481,
-    -0.838265, -0.836971, -0.836354, -0.836759, -0.837916, -0.839107,
-    -0.839593, -0.839064, -0.837818, -0.836583, -0.836076, -0.836577,
-    -0.837757, -0.838884, -0.839258, -0.838635, -0.837369, -0.836198,
-    -0.835802, -0.836391, -0.837586, -0.838642, -0.838904, -0.838194,
-    -0.836917, -0.835817, -0.835531, -0.836202, -0.837401, -0.838381,
-    -0.838533, -0.837742, -0.836463, -0.83544, -0.835262, -0.836007,
-    -0.837201, -0.838101, -0.838143, -0.83728, -0.836008, -0.835066,
-    -0.834994, -0.835806, -0.836987, -0.837801, -0.837737, -0.836809,
-    -0.835552, -0.834696, -0.834727, -0.835597, -0.836757, -0.837482,
-    -0.837313, -0.836329, -0.835095, -0.834328, -0.834459, -0.83538,
-    -0.83651, -0.837142, -0.836873, -0.83584, -0.834638, -0.833963,
-    -0.83419, -0.835153, -0.836246, -0.836783, -0.836418, -0.835344,
-    -0.834181, -0.8336, -0.833918, -0.834916, -0.835963, -0.836404,
-    -0.835947, -0.834842, -0.833725, -0.833238, -0.833643, -0.834666,
-    -0.835663, -0.836006, -0.835462, -0.834333, -0.833268, -0.832877,
-    -0.833364, -0.834404, -0.835343, -0.835587, -0.834963, -0.833818,
-    -0.832811, -0.832517, -0.833079, -0.834129, -0.835004, -0.83515,
-    -0.834451, -0.833298, -0.832355, -0.832156, -0.832788, -0.833838,
-    -0.834645, -0.834693, -0.833925, -0.832774, -0.831899, -0.831794,
-    -0.832489, -0.833532, -0.834266, -0.834218, -0.833388, -0.832244,
-    -0.831442, -0.83143, -0.832181, -0.83321, -0.833866, -0.833724,
-    -0.832839, -0.831711, -0.830986, -0.831064, -0.831864, -0.83287,
-    -0.833445, -0.833212, -0.832278, -0.831174, -0.830528, -0.830694,
-    -0.831536, -0.832513, -0.833004, -0.832682, -0.831707, -0.830633,
-    -0.830069, -0.830319, -0.831195, -0.832136, -0.832541, -0.832134,
-    -0.831126, -0.830089, -0.829609, -0.829939, -0.830842, -0.83174,
-    -0.832058, -0.83157, -0.830536, -0.829541, -0.829147, -0.829552,
-    -0.830475, -0.831325, -0.831553, -0.830989, -0.829936, -0.82899,
-    -0.828682, -0.829158, -0.830094, -0.830888, -0.831028, -0.830392,
-    -0.829327, -0.828436, -0.828214, -0.828756, -0.829696, -0.83043,
-    -0.830481, -0.829779, -0.82871, -0.827878, -0.827742, -0.828343,
-    -0.829281, -0.829951, -0.829913, -0.829152, -0.828086, -0.827316,
-    -0.827265, -0.827921, -0.828848, -0.82945, -0.829325, -0.828509,
-    -0.827453, -0.826751, -0.826782, -0.827486, -0.828397, -0.828926,
-    -0.828716, -0.827852, -0.826813, -0.826181, -0.826293, -0.827039,
-    -0.827926, -0.82838, -0.828086, -0.82718, -0.826165, -0.825607,
-    -0.825797, -0.826578, -0.827435, -0.82781, -0.827437, -0.826496,
-    -0.82551, -0.825027, -0.825293, -0.826102, -0.826922, -0.827218,
-    -0.826767, -0.825798, -0.824848, -0.824443, -0.82478, -0.825609,
-    -0.826388, -0.826602, -0.826078, -0.825087, -0.824179, -0.823852,
-    -0.824256, -0.8251, -0.825831, -0.825962, -0.82537, -0.824364,
-    -0.823502, -0.823254, -0.823721, -0.824573, -0.82525, -0.825299,
-    -0.824642, -0.823628, -0.822818, -0.82265, -0.823174, -0.824027,
-    -0.824646, -0.824612, -0.823896, -0.822881, -0.822127, -0.822037,
-    -0.822614, -0.82346, -0.824018, -0.823901, -0.823131, -0.822122,
-    -0.821428, -0.821415, -0.822039, -0.822873, -0.823364, -0.823167,
-    -0.822349, -0.821351, -0.82072, -0.820783, -0.821449, -0.822263,
-    -0.822685, -0.822409, -0.821548, -0.820568, -0.820004, -0.820141,
-    -0.820842, -0.821631, -0.821981, -0.821627, -0.82073, -0.819774,
-    -0.819279, -0.819487, -0.820217, -0.820975, -0.82125, -0.820822,
-    -0.819895, -0.818969, -0.818545, -0.818821, -0.819574, -0.820294,
-    -0.820492, -0.819994, -0.819042, -0.818152, -0.817801, -0.818141,
-    -0.81891, -0.819587, -0.819708, -0.819142, -0.818173, -0.817323,
-    -0.817046, -0.817447, -0.818225, -0.818854, -0.818896, -0.818268,
-    -0.817287, -0.816483, -0.816279, -0.816736, -0.817518, -0.818094,
-    -0.818058, -0.81737, -0.816384, -0.815631, -0.815501, -0.816009,
-    -0.816788, -0.817307, -0.817192, -0.81645, -0.815465, -0.814766,
-    -0.814709, -0.815264, -0.816033, -0.816491, -0.816298, -0.815507,
-    -0.81453, -0.813889, -0.813903, -0.8145, -0.815253, -0.815646,
-    -0.815377, -0.814542, -0.813578, -0.812998, -0.813083, -0.813715,
-    -0.814447, -0.814771, -0.814427, -0.813555, -0.81261, -0.812094,
-    -0.812247, -0.812909, -0.813612, -0.813867, -0.81345, -0.812545,
-    -0.811626, -0.811175, -0.811394, -0.81208, -0.81275, -0.812931,
-    -0.812445, -0.811513, -0.810625, -0.810242, -0.810523, -0.811227,
-    -0.811858, -0.811965, -0.811412, -0.81046, -0.809607, -0.809293,
-    -0.809634, -0.810349, -0.810935, -0.810967, -0.810351, -0.809384,
-    -0.808572, -0.808328, -0.808724, -0.809444, -0.809982, -0.809937,
-    -0.809262, -0.808287, -0.80752, -0.807346, -0.807792, -0.808512,
-    -0.808996, -0.808876, -0.808146, -0.807167, -0.80645, -0.806346,
-    -0.806838, -0.807551, -0.807977, -0.807781, -0.807001, -0.806026,
-    -0.805362, -0.805327, -0.805861, -0.806561, -0.806925, -0.806654,
-    -0.805828, -0.804863, -0.804256, -0.804288, -0.804858, -0.805539,
-    -0.805838, -0.805493, -0.804627, -0.803678, -0.80313, -0.803228,
-    -0.803828, -0.804484, -0.804716, -0.804299, -0.803399, -0.80247,
-    -0.801984, -0.802146, -0.802771, -0.803396, -0.803558, -0.803072,
-    -0.802142, -0.801239, -0.800817, -0.801041, -0.801685, -0.802274,
-    -0.802364, -0.801811, -0.800857, -0.799986, -0.79963, -0.799911,
-    -0.800569, -0.801116, -0.801132, -0.800515, -0.799544, -0.79871,
-    -0.79842, -0.798755, -0.79942, -0.799921, -0.799863, -0.799186,
-    -0.798203, -0.797409, -0.797186, -0.797572, -0.798239, -0.798689,
-    -0.798555, -0.797822, -0.796833, -0.796085, -0.795929, -0.796361,
-    -0.797023, -0.797417, -0.797209, -0.796424, -0.795435, -0.794736,
-    -0.794647, -0.79512, -0.795771, -0.796106, -0.795824, -0.794991,
-    -0.794007, -0.793361, -0.793338, -0.793848, -0.794482, -0.794755,
-    -0.794398, -0.793523, -0.792551, -0.791961, -0.792002, -0.792544,
-    -0.793155, -0.793361, -0.792933, -0.79202, -0.791065, -0.790533,
-    -0.790637, -0.791205, -0.791787, -0.791925, -0.791427, -0.790482,
-    -0.789549, -0.789078, -0.789242, -0.78983, -0.790379, -0.790446,
-    -0.78988, -0.788908, -0.788003, -0.787594, -0.787815, -0.788419,
-    -0.788928, -0.788922, -0.788291, -0.787298, -0.786426, -0.786081,
-    -0.786356, -0.786969, -0.787433, -0.787354, -0.786661, -0.785653,
-    -0.784817, -0.784538, -0.784863, -0.785478, -0.785894, -0.78574,
-    -0.784988, -0.78397, -0.783176, -0.782962, -0.783334, -0.783946,
-    -0.784308, -0.784079, -0.783273, -0.782251, -0.781503, -0.781354,
-    -0.781768, -0.782371, -0.782675, -0.78237, -0.781515, -0.780494,
-    -0.779796, -0.779711, -0.780163, -0.780751, -0.780993, -0.780614,
-    -0.779713, -0.7787, -0.778055, -0.778033, -0.778517, -0.779084,
-    -0.779261, -0.778809, -0.777867, -0.776868, -0.776278, -0.776318,
-    -0.776829, -0.77737, -0.777479, -0.776955, -0.775977, -0.774997,
-    -0.774465, -0.774565, -0.775098, -0.775606, -0.775644, -0.775051,
-    -0.774043, -0.773086, -0.772615, -0.772772, -0.773321, -0.773791,
-    -0.773756, -0.773096, -0.772063, -0.771135, -0.770726, -0.770937,
-    -0.771496, -0.771923, -0.771814, -0.771089, -0.770037, -0.769143,
-    -0.768797, -0.769059, -0.769623, -0.770001, -0.769817, -0.769031,
-    -0.767965, -0.76711, -0.766827, -0.767136, -0.767699, -0.768024,
-    -0.767763, -0.76692, -0.765847, -0.765034, -0.764815, -0.765167,
-    -0.765722, -0.76599, -0.765653, -0.764756, -0.76368, -0.762914,
-    -0.762759, -0.763149, -0.76369, -0.763897, -0.763484, -0.762538,
-    -0.761466, -0.76075, -0.760657, -0.761081, -0.761602, -0.761744,
-    -0.761255, -0.760265, -0.759202, -0.75854, -0.758509, -0.758961,
-    -0.759457, -0.759529, -0.758967, -0.757937, -0.756889, -0.756283,
-    -0.756311, -0.756786, -0.757251, -0.757252, -0.756617, -0.755553,
-    -0.754525, -0.753977, -0.754063, -0.754556, -0.754983, -0.754911,
-    -0.754205, -0.753112, -0.75211, -0.751622, -0.751763, -0.752267,
-    -0.752651, -0.752503, -0.75173, -0.750613, -0.749642, -0.749216,
-    -0.749408, -0.749918, -0.750255, -0.750029, -0.749191, -0.748056,
-    -0.74712, -0.746757, -0.746997, -0.747507, -0.74779, -0.747487,
-    -0.746587, -0.74544, -0.744544, -0.744244, -0.744527, -0.745031,
-    -0.745257, -0.744874, -0.743917, -0.742764, -0.741911, -0.741674,
-    -0.741998, -0.742488, -0.742652, -0.742191, -0.74118, -0.740026,
-    -0.739221, -0.739047, -0.739405, -0.739877, -0.739975, -0.739435,
-    -0.738375, -0.737226, -0.736473, -0.73636, -0.736748, -0.737195,
-    -0.737223, -0.736605, -0.735501, -0.734363, -0.733664, -0.733611,
-    -0.734024, -0.73444, -0.734395, -0.7337, -0.732557, -0.731436,
-    -0.730794, -0.730799, -0.73123, -0.731609, -0.731488, -0.730719,
-    -0.729542, -0.728443, -0.72786, -0.72792, -0.728365, -0.728701,
-    -0.728502, -0.72766, -0.726455, -0.725383, -0.72486, -0.724974,
-    -0.725425, -0.725713, -0.725434, -0.724522, -0.723294, -0.722254,
-    -0.721794, -0.721956, -0.722409, -0.722643, -0.722282, -0.721304,
-    -0.720059, -0.719056, -0.718659, -0.718866, -0.719313, -0.719489,
-    -0.719045, -0.718004, -0.716748, -0.715786, -0.715452, -0.715701,
-    -0.716136, -0.716248, -0.715721, -0.714621, -0.71336, -0.712444,
-    -0.712173, -0.712457, -0.712874, -0.712918, -0.712308, -0.711154,
-    -0.709893, -0.709026, -0.708817, -0.709133, -0.709525, -0.709497,
-    -0.708804, -0.707601, -0.706346, -0.705532, -0.705384, -0.705726,
-    -0.706087, -0.705983, -0.705209, -0.70396, -0.702718, -0.70196,
-    -0.701871, -0.702233, -0.702557, -0.702374, -0.701519, -0.700231,
-    -0.699007, -0.698307, -0.698274, -0.698651, -0.698931, -0.698666,
-    -0.697733, -0.696411, -0.69521, -0.694571, -0.694592, -0.694977,
-    -0.695208, -0.694859, -0.69385, -0.692499, -0.691328, -0.69075,
-    -0.690822, -0.691209, -0.691385, -0.690949, -0.689868, -0.688494,
-    -0.687356, -0.686842, -0.686961, -0.687343, -0.687458, -0.686935,
-    -0.685784, -0.684393, -0.683295, -0.682844, -0.683006, -0.683377,
-    -0.683426, -0.682814, -0.681597, -0.680196, -0.679141, -0.678753,
-    -0.678954, -0.679307, -0.679285, -0.678583, -0.677305, -0.6759,
-    -0.674892, -0.674568, -0.674801, -0.67513, -0.675032, -0.674241,
-    -0.672906, -0.671503, -0.670546, -0.670284, -0.670546, -0.670843,
-    -0.670665, -0.669786, -0.668399, -0.667003, -0.666101, -0.6659,
-    -0.666183, -0.666442, -0.666181, -0.665214, -0.663781, -0.662398,
-    -0.661554, -0.661412, -0.661711, -0.661925, -0.661577, -0.660524,
-    -0.65905, -0.657687, -0.656903, -0.656817, -0.657125, -0.657288,
-    -0.656849, -0.655714, -0.654204, -0.652866, -0.652145, -0.652111,
-    -0.652423, -0.652528, -0.651997, -0.65078, -0.649241, -0.647934,
-    -0.647276, -0.647292, -0.6476, -0.647641, -0.647015, -0.645721,
-    -0.644158, -0.642888, -0.642294, -0.642355, -0.642652, -0.642624,
-    -0.641902, -0.640534, -0.638954, -0.637725, -0.637197, -0.637298,
-    -0.637577, -0.637474, -0.636655, -0.635217, -0.633626, -0.632443,
-    -0.631979, -0.632116, -0.63237, -0.632186, -0.63127, -0.629766,
-    -0.628172, -0.627038, -0.626639, -0.626806, -0.627028, -0.626758,
-    -0.625745, -0.62418, -0.622588, -0.621509, -0.621173, -0.621364,
-    -0.621546, -0.621186, -0.620076, -0.618456, -0.616873, -0.615851,
-    -0.615576, -0.615785, -0.61592, -0.615467, -0.614261, -0.612592,
-    -0.611024, -0.610062, -0.609846, -0.610066, -0.610147, -0.609596,
-    -0.608297, -0.606584, -0.605037, -0.604138, -0.603978, -0.604202,
-    -0.604222, -0.60357, -0.60218, -0.600429, -0.59891, -0.598075,
-    -0.597968, -0.598189, -0.598141, -0.597386, -0.595908, -0.594125,
-    -0.592639, -0.591871, -0.591812, -0.592023, -0.5919, -0.59104,
-    -0.589477, -0.587669, -0.586222, -0.585521, -0.585505, -0.585698,
-    -0.585495, -0.584527, -0.582884, -0.581058, -0.579654, -0.579021,
-    -0.579044, -0.579211, -0.578921, -0.577845, -0.576125, -0.574288,
-    -0.572934, -0.572368, -0.572424, -0.572557, -0.572174, -0.57099,
-    -0.569198, -0.567357, -0.566055, -0.565556, -0.565639, -0.56573,
-    -0.56525, -0.563957, -0.562099, -0.560261, -0.559016, -0.558582,
-    -0.558685, -0.558727, -0.558143, -0.556743, -0.554824, -0.552995,
-    -0.551812, -0.551441, -0.551557, -0.551541, -0.55085, -0.549344,
-    -0.54737, -0.545558, -0.544439, -0.544128, -0.54425, -0.544169,
-    -0.543366, -0.541755, -0.539733, -0.537945, -0.536893, -0.536638,
-    -0.536758, -0.536604, -0.535687, -0.533974, -0.53191, -0.530151,
-    -0.529169, -0.528966, -0.529077, -0.528842, -0.527807, -0.525995,
-    -0.523897, -0.522174, -0.521262, -0.521108, -0.5212, -0.520877,
-    -0.519721, -0.517815, -0.515689, -0.514008, -0.513168, -0.513056,
-    -0.513123, -0.512704, -0.511426, -0.509429, -0.507284, -0.50565,
-    -0.504881, -0.504807, -0.504838, -0.504317, -0.502916, -0.500833,
-    -0.498675, -0.497095, -0.496397, -0.496354, -0.496341, -0.495712,
-    -0.494187, -0.492023, -0.48986, -0.488338, -0.487711, -0.487691,
-    -0.487625, -0.486881, -0.485233, -0.482994, -0.480834, -0.479375,
-    -0.478816, -0.478813, -0.478685, -0.47782, -0.476049, -0.473742,
-    -0.471592, -0.4702, -0.469706, -0.469712, -0.469513, -0.468523,
-    -0.46663, -0.464261, -0.46213, -0.460807, -0.460377, -0.460383,
-    -0.460104, -0.458985, -0.456972, -0.454548, -0.452442, -0.451193,
-    -0.450821, -0.450819, -0.450451, -0.449198, -0.447068, -0.444597,
-    -0.442524, -0.44135, -0.441033, -0.441014, -0.440548, -0.439157,
-    -0.436914, -0.434403, -0.43237, -0.431273, -0.431006, -0.43096,
-    -0.430388, -0.428856, -0.426503, -0.423961, -0.421975, -0.420957,
-    -0.420733, -0.42065, -0.419964, -0.418289, -0.415832, -0.413266,
-    -0.411334, -0.410393, -0.410207, -0.410077, -0.409269, -0.40745,
-    -0.404893, -0.402313, -0.40044, -0.399578, -0.399421, -0.399234,
-    -0.398296, -0.396332, -0.393681, -0.391095, -0.389287, -0.388502,
-    -0.388367, -0.388114, -0.387039, -0.384929, -0.382191, -0.379607,
-    -0.37787, -0.37716, -0.377039, -0.376708, -0.375489, -0.373234,
-    -0.370415, -0.367844, -0.366182, -0.365544, -0.365427, -0.365008,
-    -0.363639, -0.361241, -0.358349, -0.355798, -0.354215, -0.353647,
-    -0.353525, -0.353007, -0.351483, -0.348943, -0.345986, -0.343464,
-    -0.341965, -0.341461, -0.341324, -0.340697, -0.339012, -0.336333,
-    -0.33332, -0.330835, -0.329422, -0.328979, -0.328816, -0.328069,
-    -0.326218, -0.323404, -0.320344, -0.317905, -0.31658, -0.316191,
-    -0.315991, -0.315114, -0.313094, -0.310149, -0.307051, -0.304666,
-    -0.303431, -0.30309, -0.302842, -0.301825, -0.299632, -0.29656,
-    -0.293434, -0.291112, -0.289968, -0.289666, -0.289358, -0.288191,
-    -0.285824, -0.282632, -0.279487, -0.277235, -0.276182, -0.275912,
-    -0.275531, -0.274205, -0.271661, -0.268355, -0.265202, -0.263027,
-    -0.262064, -0.261817, -0.261352, -0.259857, -0.257135, -0.253723,
-    -0.250572, -0.24848, -0.247606, -0.247373, -0.24681, -0.245138,
-    -0.242238, -0.238727, -0.235589, -0.233588, -0.2328, -0.232568,
-    -0.231895, -0.230038, -0.226961, -0.223359, -0.220246, -0.21834,
-    -0.217635, -0.217395, -0.216598, -0.214547, -0.211294, -0.207612,
-    -0.204534, -0.202729, -0.202102, -0.201841, -0.200907, -0.198656,
-    -0.19523, -0.191478, -0.188444, -0.186745, -0.186191, -0.185897,
-    -0.184813, -0.182355, -0.178759, -0.174946, -0.171969, -0.17038,
-    -0.169893, -0.169552, -0.168305, -0.165633, -0.161872, -0.15801,
-    -0.1551, -0.153623, -0.153196, -0.152795, -0.151371, -0.148481,
-    -0.144559, -0.14066, -0.137828, -0.136466, -0.13609, -0.135613,
-    -0.133999, -0.130887, -0.12681, -0.122886, -0.120143, -0.118897,
-    -0.118564, -0.117996, -0.11618, -0.11284, -0.108616, -0.10468,
-    -0.102035, -0.100907, -0.100606, -0.0999321, -0.0978997, -0.0943301,
-    -0.0899667, -0.0860325, -0.0834959, -0.0824853, -0.0822047, -0.0814081,
-    -0.0791471, -0.0753456, -0.0708515, -0.0669326, -0.0645146, -0.06362,
-    -0.0633482, -0.0624117, -0.0599098, -0.0558749, -0.05126, -0.0473709,
-    -0.0450807, -0.0443002, -0.044024, -0.04293, -0.0401749, -0.0359063,
-    -0.0311815, -0.027337, -0.0251838, -0.0245144, -0.0242193, -0.0229498,
-    -0.0199296, -0.0154277, -0.0106049, -0.00682031, -0.00481289, -0.00425044,
-    -0.00392115, -0.00245757, 0.000839388, 0.00557302, 0.010481, 0.0141899,
-    0.0160432, 0.0165038, 0.0168839, 0.0185607, 0.0221457, 0.0271086,
-    0.0320878, 0.0357047, 0.0373961, 0.0377608, 0.0382094, 0.0401193,
-    0.0440033, 0.049192, 0.0542273, 0.0577355, 0.0592573, 0.0595336,
-    0.0600696, 0.0622328, 0.0664264, 0.0718364, 0.0769117, 0.0802938,
-    0.0816388, 0.0818352, 0.0824788, 0.0849164, 0.0894299, 0.0950554,
-    0.100153, 0.103391, 0.104553, 0.104679, 0.105452, 0.108185,
-    0.113029, 0.118863, 0.123965, 0.12704, 0.128012, 0.128079,
-    0.129004, 0.132056, 0.137239, 0.143274, 0.148359, 0.151253,
-    0.152029, 0.152048, 0.15315, 0.156545, 0.162077, 0.168304,
-    0.17335, 0.176041, 0.176615, 0.176601, 0.177906, 0.181668,
-    0.187559, 0.193967, 0.198952, 0.201418, 0.201785, 0.201752,
-    0.203289, 0.207444, 0.213704, 0.22028, 0.225177, 0.227396,
-    0.22755, 0.227516, 0.229315, 0.233892, 0.240529, 0.247261,
-    0.252042, 0.253988, 0.253922, 0.253905, 0.256, 0.261029,
-    0.268055, 0.274926, 0.27956, 0.281205, 0.280915, 0.280935,
-    0.283364, 0.288877, 0.296302, 0.303295, 0.307747, 0.309061,
-    0.308538, 0.308619, 0.311422, 0.317458, 0.325293, 0.332388,
-    0.336618, 0.337567, 0.336804, 0.33697, 0.340194, 0.346793,
-    0.355052, 0.362227, 0.366191, 0.366732, 0.365719, 0.366,
-    0.369698, 0.376909, 0.385607, 0.392835, 0.39648, 0.396567,
-    0.395291, 0.39572, 0.399954, 0.407833, 0.41699, 0.42424,
-    0.427502, 0.427078, 0.425523, 0.426138, 0.430981, 0.439597,
-    0.449235, 0.456471, 0.459275, 0.458269, 0.456413, 0.457258,
-    0.462801, 0.472239, 0.482387, 0.489565, 0.491814, 0.490136,
-    0.48795, 0.48908, 0.495435, 0.505802, 0.516501, 0.523564,
-    0.525138, 0.522668, 0.520111, 0.521594, 0.528907, 0.540344,
-    0.551649, 0.558526, 0.55926, 0.555839, 0.552852, 0.554776,
-    0.563241, 0.575945, 0.587931, 0.594526, 0.594196, 0.589597,
-    0.586092, 0.588576, 0.598469, 0.612718, 0.6255, 0.631674,
-    0.629953, 0.62384, 0.619681, 0.622898, 0.634628, 0.650845,
-    0.664601, 0.670149, 0.666528, 0.658371, 0.653336, 0.657552,
-    0.671777, 0.690655, 0.705682, 0.710265, 0.703886, 0.692775,
-    0.68647, 0.692145, 0.71003, 0.732819, 0.74967, 0.75266,
-    0.741898, 0.726063, 0.717698, 0.725745, 0.749687, 0.779032,
-    0.798911, 0.798914, 0.780034, 0.755276, 0.742903, 0.755643,
-    0.792, 0.835241, 0.861654, 0.854345, 0.815045, 0.766547,
-    0.742773, 0.770086, 0.848857, 0.945376, 1, 0.949722,
-    0.755873, 0.424311
-};
-
-static const float WAVE_EXPONENTIAL_054[DEFAULT_WAVELEN] = {
-    0.0162882, -0.198557, -0.402791, -0.586159, -0.740363, -0.859787,
-    -0.941917, -0.987441, -1, -0.98564, -0.952041, -0.907612,
-    -0.860561, -0.818056, -0.785557, -0.766397, -0.761649, -0.77026,
-    -0.789435, -0.815206, -0.843083, -0.868729, -0.888537, -0.900076,
-    -0.902326, -0.895707, -0.881903, -0.863524, -0.84366, -0.825401,
-    -0.811385, -0.803443, -0.802389, -0.807955, -0.818903, -0.833265,
-    -0.848672, -0.86273, -0.873377, -0.879174, -0.879483, -0.874526,
-    -0.865308, -0.853431, -0.840823, -0.829434, -0.820946, -0.816525,
-    -0.816673, -0.821179, -0.829176, -0.839304, -0.84993, -0.859412,
-    -0.866338, -0.869743, -0.86923, -0.865014, -0.857867, -0.848981,
-    -0.839775, -0.831667, -0.825863, -0.823177, -0.823921, -0.827873,
-    -0.834328, -0.842218, -0.850288, -0.857291, -0.862182, -0.864267,
-    -0.863301, -0.859515, -0.853566, -0.846424, -0.839215, -0.833049,
-    -0.828845, -0.827198, -0.828295, -0.831898, -0.837389, -0.843875,
-    -0.850333, -0.855767, -0.859362, -0.860605, -0.859355, -0.85586,
-    -0.850706, -0.84472, -0.838842, -0.833973, -0.83084, -0.829887,
-    -0.831215, -0.834568, -0.839388, -0.844898, -0.850234, -0.854573,
-    -0.857264, -0.857921, -0.856481, -0.853201, -0.848623, -0.843473,
-    -0.838555, -0.834622, -0.832262, -0.831808, -0.833294, -0.836454,
-    -0.84077, -0.845552, -0.850052, -0.853577, -0.855597, -0.855823,
-    -0.854247, -0.851141, -0.847006, -0.842497, -0.838313, -0.835094,
-    -0.83332, -0.833241, -0.834839, -0.837841, -0.841758, -0.845968,
-    -0.849814, -0.852705, -0.854204, -0.854099, -0.852427, -0.849466,
-    -0.845691, -0.841694, -0.838095, -0.835443, -0.834132, -0.834344,
-    -0.836024, -0.838888, -0.842475, -0.846219, -0.849535, -0.851913,
-    -0.852995, -0.852629, -0.850887, -0.848054, -0.84458, -0.841009,
-    -0.837892, -0.835703, -0.834768, -0.835213, -0.836949, -0.83969,
-    -0.842997, -0.846347, -0.84922, -0.851174, -0.851914, -0.851337,
-    -0.849545, -0.846829, -0.843615, -0.840406, -0.837696, -0.835896,
-    -0.835272, -0.835905, -0.83768, -0.840308, -0.843368, -0.84638,
-    -0.848875, -0.850469, -0.850921, -0.850173, -0.848348, -0.84574,
-    -0.842757, -0.839863, -0.837503, -0.836034, -0.835673, -0.83646,
-    -0.83826, -0.840781, -0.843621, -0.846335, -0.848501, -0.849785,
-    -0.849994, -0.849103, -0.847259, -0.844753, -0.841978, -0.839363,
-    -0.83731, -0.836129, -0.835991, -0.836906, -0.838718, -0.841137,
-    -0.843777, -0.846225, -0.8481, -0.849113, -0.849112, -0.848104,
-    -0.846251, -0.843844, -0.841259, -0.838895, -0.837115, -0.836185,
-    -0.836241, -0.837261, -0.839076, -0.841394, -0.84385, -0.846057,
-    -0.847672, -0.848447, -0.848264, -0.847159, -0.845305, -0.842995,
-    -0.840586, -0.838451, -0.836915, -0.836209, -0.836431, -0.837538,
-    -0.839347, -0.841568, -0.843851, -0.845837, -0.847218, -0.84778,
-    -0.84744, -0.846253, -0.844408, -0.842192, -0.839949, -0.838024,
-    -0.83671, -0.836202, -0.83657, -0.837748, -0.839543, -0.841668,
-    -0.843788, -0.845571, -0.846738, -0.84711, -0.846631, -0.845378,
-    -0.843549, -0.841427, -0.83934, -0.837609, -0.836496, -0.836167,
-    -0.836663, -0.837898, -0.839672, -0.841702, -0.843667, -0.84526,
-    -0.846232, -0.846432, -0.845832, -0.844526, -0.842718, -0.840689,
-    -0.838751, -0.837201, -0.836273, -0.836104, -0.836712, -0.837992,
-    -0.839739, -0.841674, -0.843492, -0.844907, -0.845699, -0.845745,
-    -0.845038, -0.84369, -0.84191, -0.839973, -0.838177, -0.836796,
-    -0.836039, -0.836016, -0.83672, -0.838036, -0.83975, -0.84159,
-    -0.843266, -0.844515, -0.84514, -0.845046, -0.844246, -0.842865,
-    -0.841118, -0.839273, -0.837614, -0.836393, -0.835793, -0.835901,
-    -0.83669, -0.83803, -0.839707, -0.841452, -0.842992, -0.844083,
-    -0.844554, -0.844332, -0.843451, -0.842047, -0.840337, -0.838584,
-    -0.837057, -0.835987, -0.835533, -0.835759, -0.836622, -0.837979,
-    -0.839612, -0.841263, -0.842671, -0.843612, -0.843941, -0.843603,
-    -0.842651, -0.841232, -0.839564, -0.837903, -0.836503, -0.835575,
-    -0.835257, -0.835591, -0.836516, -0.837882, -0.839469, -0.841025,
-    -0.842304, -0.843104, -0.843299, -0.842857, -0.841844, -0.840417,
-    -0.838795, -0.837226, -0.835949, -0.835157, -0.834965, -0.835395,
-    -0.836373, -0.83774, -0.839276, -0.840738, -0.841893, -0.842558,
-    -0.842629, -0.842091, -0.841027, -0.8396, -0.838027, -0.83655,
-    -0.835393, -0.834728, -0.834653, -0.835171, -0.836193, -0.837554,
-    -0.839036, -0.840403, -0.841437, -0.841975, -0.84193, -0.841306,
-    -0.840199, -0.838777, -0.837257, -0.835872, -0.83483, -0.834288,
-    -0.834321, -0.834917, -0.835975, -0.837325, -0.838749, -0.84002,
-    -0.840937, -0.841353, -0.841201, -0.8405, -0.839357, -0.837946,
-    -0.836483, -0.835189, -0.83426, -0.833832, -0.833966, -0.834632,
-    -0.835719, -0.837051, -0.838414, -0.839591, -0.840394, -0.840694,
-    -0.840441, -0.839671, -0.8385, -0.837106, -0.835701, -0.834499,
-    -0.833678, -0.833361, -0.833587, -0.834315, -0.835423, -0.836732,
-    -0.838031, -0.839114, -0.839806, -0.839995, -0.839649, -0.838817,
-    -0.837625, -0.836254, -0.83491, -0.833798, -0.833084, -0.83287,
-    -0.833182, -0.833964, -0.835087, -0.836367, -0.837601, -0.838589,
-    -0.839173, -0.839258, -0.838825, -0.837939, -0.836732, -0.835387,
-    -0.834108, -0.833086, -0.832473, -0.832358, -0.832749, -0.833578,
-    -0.834708, -0.835956, -0.837121, -0.838015, -0.838495, -0.83848,
-    -0.837968, -0.837034, -0.835819, -0.834505, -0.833291, -0.832358,
-    -0.831845, -0.831822, -0.832286, -0.833155, -0.834287, -0.835498,
-    -0.836592, -0.837393, -0.837771, -0.837661, -0.837076, -0.836102,
-    -0.834883, -0.833604, -0.832457, -0.831614, -0.831196, -0.831261,
-    -0.831791, -0.832694, -0.833821, -0.83499, -0.836012, -0.836721,
-    -0.837, -0.836801, -0.836149, -0.835139, -0.833924, -0.832684,
-    -0.831606, -0.830849, -0.830524, -0.830672, -0.831261, -0.832191,
-    -0.833309, -0.834432, -0.83538, -0.835997, -0.836181, -0.835898,
-    -0.835185, -0.834147, -0.832938, -0.831741, -0.830733, -0.830063,
-    -0.829827, -0.830052, -0.830694, -0.831645, -0.832748, -0.833823,
-    -0.834695, -0.835222, -0.835314, -0.834951, -0.834183, -0.833121,
-    -0.831926, -0.830774, -0.829837, -0.829252, -0.829101, -0.829398,
-    -0.830088, -0.831054, -0.832137, -0.83316, -0.833956, -0.834393,
-    -0.834397, -0.833959, -0.833141, -0.832062, -0.830884, -0.82978,
-    -0.828915, -0.828414, -0.828345, -0.828709, -0.829441, -0.830416,
-    -0.831475, -0.832442, -0.833161, -0.83351, -0.833428, -0.83292,
-    -0.832058, -0.830968, -0.82981, -0.828758, -0.827965, -0.827546,
-    -0.827555, -0.827981, -0.828749, -0.829728, -0.830758, -0.831668,
-    -0.832308, -0.832571, -0.832407, -0.831834, -0.830933, -0.829835,
-    -0.828704, -0.827705, -0.826985, -0.826645, -0.826729, -0.827212,
-    -0.82801, -0.828988, -0.829984, -0.830834, -0.831396, -0.831574,
-    -0.831331, -0.830698, -0.829763, -0.828664, -0.827561, -0.826618,
-    -0.825971, -0.825709, -0.825864, -0.826399, -0.827222, -0.828194,
-    -0.829152, -0.829939, -0.830422, -0.830517, -0.830199, -0.82951,
-    -0.828547, -0.827451, -0.826381, -0.825496, -0.82492, -0.824735,
-    -0.824956, -0.825539, -0.826381, -0.827341, -0.828259, -0.828981,
-    -0.829385, -0.829399, -0.82901, -0.82827, -0.827283, -0.826194,
-    -0.825161, -0.824334, -0.823831, -0.823719, -0.824003, -0.824628,
-    -0.825485, -0.826429, -0.827302, -0.827957, -0.828283, -0.828218,
-    -0.827761, -0.826974, -0.825969, -0.824891, -0.823898, -0.823131,
-    -0.8227, -0.822659, -0.823002, -0.823664, -0.82453, -0.825453,
-    -0.826278, -0.826866, -0.827113, -0.826971, -0.82645, -0.825621,
-    -0.824603, -0.823541, -0.822589, -0.821884, -0.821524, -0.821551,
-    -0.821949, -0.822643, -0.823513, -0.824411, -0.825185, -0.825703,
-    -0.825873, -0.825656, -0.825075, -0.824209, -0.823181, -0.822139,
-    -0.821232, -0.82059, -0.820299, -0.820391, -0.82084, -0.821561,
-    -0.822431, -0.823299, -0.82402, -0.824467, -0.82456, -0.824272,
-    -0.823634, -0.822736, -0.821703, -0.820684, -0.819824, -0.819245,
-    -0.819022, -0.819177, -0.819672, -0.820416, -0.82128, -0.822115,
-    -0.822779, -0.823155, -0.823172, -0.822814, -0.822125, -0.821197,
-    -0.820164, -0.819172, -0.818362, -0.817846, -0.81769, -0.817904,
-    -0.818441, -0.819203, -0.820056, -0.820855, -0.82146, -0.821764,
-    -0.821706, -0.821282, -0.820543, -0.819592, -0.818563, -0.817601,
-    -0.816842, -0.816389, -0.816298, -0.816569, -0.817144, -0.817918,
-    -0.818757, -0.819514, -0.820058, -0.82029, -0.820159, -0.819671,
-    -0.818888, -0.817917, -0.816895, -0.815967, -0.81526, -0.814871,
-    -0.814844, -0.815167, -0.815775, -0.816557, -0.817377, -0.81809,
-    -0.818571, -0.81873, -0.818527, -0.817979, -0.817155, -0.816169,
-    -0.815159, -0.814266, -0.813614, -0.813288, -0.813322, -0.813694,
-    -0.814331, -0.815117, -0.815913, -0.816579, -0.816995, -0.817082,
-    -0.816808, -0.816202, -0.815342, -0.814345, -0.81335, -0.812496,
-    -0.811899, -0.811635, -0.811728, -0.812147, -0.812808, -0.813592,
-    -0.81436, -0.814976, -0.815326, -0.81534, -0.814998, -0.814338,
-    -0.813445, -0.812441, -0.811465, -0.810652, -0.810112, -0.809909,
-    -0.810059, -0.810519, -0.8112, -0.811978, -0.812715, -0.813277,
-    -0.81356, -0.813502, -0.813094, -0.812382, -0.81146, -0.810453,
-    -0.8095, -0.808731, -0.808247, -0.808105, -0.808308, -0.808806,
-    -0.809503, -0.810271, -0.810972, -0.811478, -0.811692, -0.811562,
-    -0.81109, -0.810331, -0.809384, -0.808378, -0.807451, -0.806727,
-    -0.8063, -0.806218, -0.806472, -0.807004, -0.807712, -0.808465,
-    -0.809126, -0.809574, -0.809719, -0.809518, -0.808985, -0.808181,
-    -0.807213, -0.806212, -0.805313, -0.804637, -0.804268, -0.804242,
-    -0.804545, -0.805107, -0.805821, -0.806555, -0.807173, -0.80756,
-    -0.807635, -0.807365, -0.806772, -0.805928, -0.804943, -0.80395,
-    -0.803083, -0.802455, -0.802143, -0.802174, -0.802521, -0.803109,
-    -0.803825, -0.804535, -0.805108, -0.805432, -0.805436, -0.805097,
-    -0.804448, -0.803566, -0.802568, -0.801588, -0.800755, -0.800177,
-    -0.799922, -0.800007, -0.800396, -0.801005, -0.801718, -0.802401,
-    -0.802924, -0.803183, -0.803116, -0.802711, -0.802007, -0.801092,
-    -0.800085, -0.79912, -0.798324, -0.797797, -0.797598, -0.797735,
-    -0.798162, -0.798789, -0.799495, -0.800145, -0.800616, -0.800809,
-    -0.800671, -0.8002, -0.799445, -0.7985, -0.797487, -0.796541,
-    -0.795784, -0.795309, -0.795166, -0.795353, -0.795814, -0.796454,
-    -0.797148, -0.797763, -0.798178, -0.798303, -0.798095, -0.79756,
-    -0.796757, -0.795785, -0.794771, -0.793847, -0.793131, -0.792708,
-    -0.79262, -0.792853, -0.793345, -0.793994, -0.794671, -0.795247,
-    -0.795603, -0.79566, -0.795381, -0.794784, -0.793936, -0.792942,
-    -0.791929, -0.79103, -0.790357, -0.789988, -0.789952, -0.79023,
-    -0.790749, -0.791402, -0.792059, -0.79259, -0.792886, -0.792873,
-    -0.792525, -0.791868, -0.790977, -0.789964, -0.788957, -0.788085,
-    -0.787457, -0.78714, -0.787157, -0.787476, -0.788018, -0.78867,
-    -0.789302, -0.789787, -0.79002, -0.789935, -0.789518, -0.788804,
-    -0.787874, -0.786845, -0.785847, -0.785006, -0.784424, -0.78416,
-    -0.784227, -0.784583, -0.785144, -0.785792, -0.786394, -0.786829,
-    -0.786996, -0.786841, -0.786355, -0.785586, -0.78462, -0.783579,
-    -0.782594, -0.781786, -0.78125, -0.781039, -0.781154, -0.781545,
-    -0.78212, -0.782758, -0.783328, -0.783708, -0.783809, -0.783581,
-    -0.783029, -0.782206, -0.781209, -0.780159, -0.779189, -0.778416,
-    -0.777929, -0.777769, -0.77793, -0.778353, -0.778938, -0.779562,
-    -0.780094, -0.780418, -0.780449, -0.780149, -0.779532, -0.778658,
-    -0.777632, -0.776578, -0.775626, -0.774891, -0.774452, -0.774343,
-    -0.774548, -0.774998, -0.775589, -0.776195, -0.776685, -0.776949,
-    -0.776909, -0.776537, -0.775855, -0.774934, -0.773882, -0.772827,
-    -0.771897, -0.7712, -0.770811, -0.770752, -0.770997, -0.771471,
-    -0.772064, -0.772647, -0.773091, -0.773292, -0.77318, -0.772736,
-    -0.771992, -0.771026, -0.769952, -0.768899, -0.767993, -0.767338,
-    -0.766997, -0.766987, -0.76727, -0.767764, -0.768354, -0.768909,
-    -0.769304, -0.769439, -0.769253, -0.768738, -0.767933, -0.766925,
-    -0.765832, -0.764784, -0.763905, -0.763293, -0.763002, -0.763038,
-    -0.763356, -0.763866, -0.764448, -0.764971, -0.765313, -0.765379,
-    -0.76512, -0.764533, -0.76367, -0.762623, -0.761514, -0.760475,
-    -0.759625, -0.759056, -0.758815, -0.758896, -0.759246, -0.759767,
-    -0.760336, -0.760823, -0.761107, -0.761104, -0.760769, -0.760112,
-    -0.759192, -0.758109, -0.756988, -0.755961, -0.755143, -0.754619,
-    -0.754426, -0.75455, -0.754928, -0.755456, -0.756008, -0.756454,
-    -0.756678, -0.756601, -0.75619, -0.755464, -0.754489, -0.753374,
-    -0.752244, -0.751232, -0.750448, -0.74997, -0.749824, -0.749989,
-    -0.750391, -0.750922, -0.751452, -0.751852, -0.752013, -0.751861,
-    -0.751374, -0.750579, -0.749552, -0.748407, -0.747272, -0.746278,
-    -0.74553, -0.745097, -0.744999, -0.745201, -0.745624, -0.746153,
-    -0.746656, -0.747007, -0.7471, -0.746871, -0.746307, -0.745445,
-    -0.74437, -0.743197, -0.742061, -0.741087, -0.740377, -0.739991,
-    -0.739937, -0.740174, -0.740614, -0.741136, -0.741608, -0.741905,
-    -0.741927, -0.741621, -0.74098, -0.740052, -0.738929, -0.737734,
-    -0.736599, -0.735648, -0.734977, -0.734637, -0.734628, -0.734897,
-    -0.735349, -0.735859, -0.736295, -0.736533, -0.736482, -0.736096,
-    -0.735378, -0.734386, -0.733219, -0.732003, -0.730873, -0.729949,
-    -0.729318, -0.729024, -0.729056, -0.729354, -0.729814, -0.730308,
-    -0.730702, -0.730878, -0.730751, -0.730283, -0.729489, -0.728435,
-    -0.727226, -0.725994, -0.724871, -0.723975, -0.723386, -0.723138,
-    -0.72321, -0.723532, -0.723996, -0.724468, -0.724817, -0.724926,
-    -0.72472, -0.724169, -0.723299, -0.722184, -0.720937, -0.719691,
-    -0.71858, -0.717714, -0.717167, -0.716964, -0.717073, -0.717417,
-    -0.717879, -0.718325, -0.718622, -0.718662, -0.718374, -0.71774,
-    -0.716794, -0.715621, -0.714338, -0.713082, -0.711984, -0.71115,
-    -0.710647, -0.710487, -0.710632, -0.710993, -0.711448, -0.711862,
-    -0.712104, -0.712069, -0.711697, -0.710979, -0.709959, -0.708729,
-    -0.707413, -0.70615, -0.705069, -0.704269, -0.703809, -0.703692,
-    -0.703869, -0.704243, -0.704687, -0.705064, -0.705245, -0.705132,
-    -0.704674, -0.70387, -0.702777, -0.701493, -0.700148, -0.698881,
-    -0.697818, -0.697055, -0.696638, -0.696563, -0.696768, -0.69715,
-    -0.697578, -0.697912, -0.698028, -0.697834, -0.697287, -0.696398,
-    -0.695232, -0.693896, -0.692525, -0.691257, -0.690216, -0.68949,
-    -0.689117, -0.68908, -0.689311, -0.689697, -0.690103, -0.690389,
-    -0.690435, -0.690156, -0.689518, -0.688543, -0.687306, -0.685921,
-    -0.684526, -0.683261, -0.682245, -0.681557, -0.681227, -0.681227,
-    -0.681479, -0.681864, -0.682243, -0.682476, -0.682447, -0.682079,
-    -0.681349, -0.680288, -0.678981, -0.67755, -0.676135, -0.674875,
-    -0.673885, -0.673237, -0.672949, -0.672984, -0.673254, -0.673633,
-    -0.673978, -0.674153, -0.674044, -0.673584, -0.67276, -0.671613,
-    -0.670238, -0.668763, -0.667331, -0.66608, -0.665118, -0.66451,
-    -0.664263, -0.66433, -0.664613, -0.664981, -0.665288, -0.665398,
-    -0.665205, -0.66465, -0.66373, -0.662498, -0.661057, -0.65954,
-    -0.658094, -0.656854, -0.655923, -0.655355, -0.655149, -0.655245,
-    -0.655537, -0.655887, -0.656149, -0.656189, -0.655908, -0.655255,
-    -0.654238, -0.652921, -0.651415, -0.64986, -0.648403, -0.647177,
-    -0.646279, -0.645752, -0.645584, -0.645705, -0.646001, -0.646329,
-    -0.64654, -0.646505, -0.64613, -0.645376, -0.64426, -0.642859,
-    -0.641291, -0.6397, -0.638236, -0.637027, -0.636162, -0.635676,
-    -0.635545, -0.635688, -0.635983, -0.636282, -0.636437, -0.63632,
-    -0.635847, -0.634989, -0.633774, -0.632289, -0.63066, -0.629037,
-    -0.627569, -0.626379, -0.625549, -0.625104, -0.625007, -0.625168,
-    -0.625457, -0.625721, -0.625813, -0.625609, -0.625034, -0.624069,
-    -0.622755, -0.621186, -0.619499, -0.617847, -0.616377, -0.615209,
-    -0.614416, -0.61401, -0.613945, -0.61412, -0.614397, -0.61462,
-    -0.614642, -0.614346, -0.613665, -0.61259, -0.611174, -0.609524,
-    -0.607781, -0.606103, -0.604635, -0.603491, -0.602735, -0.602368,
-    -0.602332, -0.602517, -0.602775, -0.602951, -0.602896, -0.602502,
-    -0.60171, -0.600523, -0.599007, -0.597276, -0.59548, -0.593778,
-    -0.592314, -0.591197, -0.590478, -0.59015, -0.59014, -0.590329,
-    -0.590563, -0.590684, -0.590547, -0.590049, -0.589142, -0.587841,
-    -0.586222, -0.584412, -0.582565, -0.580843, -0.579387, -0.578298,
-    -0.577618, -0.577325, -0.577338, -0.577526, -0.57773, -0.577789,
-    -0.577563, -0.576955, -0.575929, -0.574511, -0.57279, -0.570902,
-    -0.569007, -0.567268, -0.565823, -0.564764, -0.564122, -0.563865,
-    -0.563896, -0.564078, -0.564245, -0.564235, -0.563912, -0.563189,
-    -0.562039, -0.560502, -0.55868, -0.556715, -0.554775, -0.553022,
-    -0.551591, -0.550563, -0.54996, -0.549735, -0.549781, -0.54995,
-    -0.550073, -0.549987, -0.54956, -0.548716, -0.547438, -0.545781,
-    -0.543856, -0.541817, -0.539835, -0.538072, -0.536656, -0.535662,
-    -0.535097, -0.534901, -0.534958, -0.535108, -0.535179, -0.535009,
-    -0.534473, -0.533501, -0.532092, -0.530312, -0.528285, -0.526173,
-    -0.524151, -0.522381, -0.520984, -0.520024, -0.519497, -0.519329,
-    -0.519391, -0.519516, -0.519528, -0.519266, -0.518611, -0.517506,
-    -0.515962, -0.514058, -0.511929, -0.509746, -0.507688, -0.505914,
-    -0.504539, -0.503614, -0.503124, -0.50298, -0.503041, -0.503135,
-    -0.503079, -0.502717, -0.501937, -0.500693, -0.499009, -0.496979,
-    -0.494749, -0.492498, -0.490407, -0.488632, -0.48728, -0.486393,
-    -0.485937, -0.485814, -0.48587, -0.485924, -0.485793, -0.485322,
-    -0.48441, -0.48302, -0.481193, -0.479035, -0.476705, -0.474387,
-    -0.472266, -0.470494, -0.469168, -0.468318, -0.467897, -0.467791,
-    -0.467835, -0.467841, -0.467626, -0.467038, -0.465985, -0.464444,
-    -0.46247, -0.460183, -0.457753, -0.455371, -0.453224, -0.451457,
-    -0.45016, -0.449348, -0.448959, -0.448866, -0.448892, -0.448843,
-    -0.448534, -0.44782, -0.446618, -0.44492, -0.442794, -0.440377,
-    -0.437848, -0.435405, -0.433234, -0.431477, -0.430211, -0.429438,
-    -0.429079, -0.428994, -0.428995, -0.428882, -0.42847, -0.427621,
-    -0.426262, -0.424399, -0.422119, -0.419569, -0.416943, -0.414442,
-    -0.412252, -0.410507, -0.409274, -0.408539, -0.408209, -0.408126,
-    -0.408095, -0.407909, -0.407385, -0.40639, -0.404865, -0.402833,
-    -0.400393, -0.397711, -0.394987, -0.392431, -0.390225, -0.388497,
-    -0.3873, -0.386603, -0.386298, -0.386214, -0.386142, -0.385873,
-    -0.385226, -0.384075, -0.382376, -0.380167, -0.377565, -0.374748,
-    -0.37193, -0.369321, -0.367103, -0.365395, -0.364235, -0.363577,
-    -0.363295, -0.363202, -0.363082, -0.362721, -0.361939, -0.360623,
-    -0.35874, -0.356347, -0.353578, -0.350626, -0.347714, -0.345057,
-    -0.342831, -0.341146, -0.340026, -0.339407, -0.339144, -0.339037,
-    -0.33886, -0.338395, -0.337467, -0.335974, -0.333898, -0.331315,
-    -0.328375, -0.325287, -0.322283, -0.31958, -0.317352, -0.315694,
-    -0.314616, -0.314035, -0.313788, -0.313661, -0.313416, -0.312836,
-    -0.311751, -0.310069, -0.30779, -0.305008, -0.301893, -0.298669,
-    -0.295575, -0.292831, -0.290604, -0.288978, -0.287945, -0.287401,
-    -0.287166, -0.287011, -0.28669, -0.285982, -0.284726, -0.282843,
-    -0.280351, -0.277363, -0.274069, -0.270707, -0.267525, -0.264745,
-    -0.262524, -0.260935, -0.259948, -0.259442, -0.259216, -0.259025,
-    -0.258616, -0.257769, -0.256328, -0.254231, -0.251514, -0.248312,
-    -0.244835, -0.241334, -0.238067, -0.235255, -0.233046, -0.231498,
-    -0.230562, -0.230092, -0.22987, -0.229636, -0.229128, -0.228127,
-    -0.226487, -0.224161, -0.221208, -0.217783, -0.214118, -0.210478,
-    -0.207129, -0.20429, -0.2021, -0.200599, -0.199715, -0.199283,
-    -0.19906, -0.198774, -0.198154, -0.196984, -0.195129, -0.19256,
-    -0.189357, -0.185701, -0.181842, -0.178064, -0.174636, -0.171776,
-    -0.169612, -0.168163, -0.167337, -0.166941, -0.166714, -0.166366,
-    -0.165621, -0.164266, -0.162179, -0.159349, -0.155883, -0.151986,
-    -0.147929, -0.14401, -0.140508, -0.137634, -0.135504, -0.134115,
-    -0.133351, -0.132992, -0.132755, -0.132335, -0.131452, -0.129895,
-    -0.127556, -0.124448, -0.120703, -0.116553, -0.112293, -0.108234,
-    -0.104662, -0.101782, -0.0996947, -0.0983753, -0.0976778, -0.0973571,
-    -0.0971061, -0.096604, -0.0955655, -0.0937863, -0.0911752, -0.0877694,
-    -0.0837293, -0.0793145, -0.0748439, -0.0706463, -0.0670091, -0.0641329,
-    -0.0620997, -0.0608592, -0.0602358, -0.0599546, -0.0596845, -0.0590888,
-    -0.0578779, -0.0558554, -0.0529489, -0.0492224, -0.0448677, -0.0401748,
-    -0.0354878, -0.0311512, -0.0274562, -0.0245948, -0.0226289, -0.0214797,
-    -0.0209388, -0.0207, -0.020406, -0.0197043, -0.0183019, -0.0160119,
-    -0.0127835, -0.0087109, -0.00401991, 0.00096636, 0.00587725, 0.010352,
-    0.0140965, 0.0169294, 0.0188119, 0.0198547, 0.0203018, 0.0204942,
-    0.0208164, 0.0216376, 0.0232532, 0.0258381, 0.0294187, 0.0338669,
-    0.0389192, 0.0442165, 0.0493596, 0.0539711, 0.0577548, 0.0605424,
-    0.0623215, 0.0632387, 0.0635779, 0.0637175, 0.064072, 0.0650274,
-    0.0668807, 0.0697924, 0.0737606, 0.078619, 0.0840621, 0.0896912,
-    0.0950761, 0.0998221, 0.103632, 0.106353, 0.108004, 0.108771,
-    0.108983, 0.109061, 0.109451, 0.110557, 0.112676, 0.115952,
-    0.12035, 0.12566, 0.13153, 0.137515, 0.143154, 0.14803,
-    0.151849, 0.154477, 0.155967, 0.156552, 0.156613, 0.156615,
-    0.157043, 0.158318, 0.160737, 0.164423, 0.169302, 0.175114,
-    0.181453, 0.187826, 0.193731, 0.198734, 0.20254, 0.205038,
-    0.206325, 0.206687, 0.206562, 0.20647, 0.206934, 0.208399,
-    0.211159, 0.215311, 0.220735, 0.227114, 0.233978, 0.240777,
-    0.246965, 0.252086, 0.255849, 0.258171, 0.259197, 0.259278,
-    0.25892, 0.258705, 0.259204, 0.260884, 0.264036, 0.268725,
-    0.274777, 0.281806, 0.289267, 0.296541, 0.303033, 0.308262,
-    0.31194, 0.314019, 0.314706, 0.314426, 0.313768, 0.31339,
-    0.313916, 0.315841, 0.319451, 0.324771, 0.331563, 0.339354,
-    0.347509, 0.355327, 0.362151, 0.36747, 0.371003, 0.372746,
-    0.372979, 0.372224, 0.371169, 0.370563, 0.371101, 0.37331,
-    0.377468, 0.383552, 0.391239, 0.39995, 0.408937, 0.417394,
-    0.424588, 0.429971, 0.43327, 0.434537, 0.434146, 0.432741,
-    0.431139, 0.430208, 0.43073, 0.433275, 0.43811, 0.445151,
-    0.453965, 0.463833, 0.473858, 0.483099, 0.49072, 0.496123,
-    0.499046, 0.499615, 0.49833, 0.495996, 0.493606, 0.492188,
-    0.492641, 0.495598, 0.501314, 0.509617, 0.519926, 0.531333,
-    0.542731, 0.55299, 0.561128, 0.566475, 0.568782, 0.568275,
-    0.565631, 0.561887, 0.558287, 0.55609, 0.556376, 0.559869,
-    0.566812, 0.576912, 0.589372, 0.602998, 0.616372, 0.628073,
-    0.636891, 0.642036, 0.643268, 0.640959, 0.63606, 0.629967,
-    0.624322, 0.620765, 0.620674, 0.62494, 0.633801, 0.646784,
-    0.662742, 0.680009, 0.696635, 0.710682, 0.720527, 0.725137,
-    0.724255, 0.718486, 0.709245, 0.698578, 0.688877, 0.682526,
-    0.681519, 0.687133, 0.699675, 0.718375, 0.741432, 0.766227,
-    0.789672, 0.808658, 0.820539, 0.823581, 0.817307, 0.802683,
-    0.782096, 0.759127, 0.738112, 0.723567, 0.719514, 0.72882,
-    0.752626, 0.789945, 0.837518, 0.88993, 0.940022, 0.979545,
-    1, 0.993564, 0.954004, 0.877467, 0.763033, 0.612991,
-    0.432758, 0.2
-};
-
-static const float WAVE_EXPONENTIAL_066[DEFAULT_WAVELEN] = {
-    0.031157, -0.0773145, -0.184674, -0.289506, -0.390459, -0.486272,
-    -0.57581, -0.658082, -0.732267, -0.79773, -0.854032, -0.900935,
-    -0.938405, -0.966608, -0.985898, -0.996801, -1, -0.99631,
-    -0.986651, -0.972023, -0.953477, -0.93208, -0.908894, -0.884939,
-    -0.861177, -0.83848, -0.817615, -0.799228, -0.783828, -0.771787,
-    -0.763331, -0.758544, -0.757374, -0.759643, -0.765059, -0.773236,
-    -0.783707, -0.795949, -0.809403, -0.823494, -0.837652, -0.851337,
-    -0.864048, -0.875347, -0.884866, -0.892323, -0.897523, -0.900363,
-    -0.900833, -0.899012, -0.895063, -0.889218, -0.881776, -0.873082,
-    -0.863513, -0.853469, -0.843351, -0.83355, -0.824429, -0.816314,
-    -0.809484, -0.804158, -0.80049, -0.798568, -0.798411, -0.799971,
-    -0.803133, -0.807729, -0.813539, -0.820304, -0.827735, -0.835527,
-    -0.84337, -0.850961, -0.858012, -0.864268, -0.869506, -0.873552,
-    -0.87628, -0.877616, -0.877546, -0.876104, -0.87338, -0.869509,
-    -0.864667, -0.859064, -0.852932, -0.84652, -0.840081, -0.833864,
-    -0.828103, -0.823009, -0.818766, -0.815517, -0.813367, -0.812374,
-    -0.812554, -0.813873, -0.816258, -0.819594, -0.823733, -0.828499,
-    -0.833694, -0.83911, -0.844531, -0.849748, -0.854562, -0.858795,
-    -0.862292, -0.864931, -0.866625, -0.867325, -0.867022, -0.865743,
-    -0.863555, -0.860558, -0.85688, -0.852676, -0.848116, -0.843381,
-    -0.838659, -0.83413, -0.829966, -0.826323, -0.823331, -0.821097,
-    -0.819693, -0.819162, -0.819509, -0.820706, -0.822695, -0.825385,
-    -0.828661, -0.832387, -0.836412, -0.840573, -0.844708, -0.848657,
-    -0.852267, -0.855404, -0.857953, -0.859821, -0.860945, -0.861292,
-    -0.860858, -0.859669, -0.857783, -0.855279, -0.852264, -0.84886,
-    -0.845204, -0.84144, -0.837714, -0.834171, -0.830944, -0.828154,
-    -0.825903, -0.824271, -0.823314, -0.823058, -0.823505, -0.824629,
-    -0.826376, -0.828671, -0.831418, -0.834503, -0.837804, -0.841187,
-    -0.844521, -0.847677, -0.850532, -0.852979, -0.854928, -0.856306,
-    -0.857068, -0.857188, -0.85667, -0.855539, -0.853846, -0.851661,
-    -0.849075, -0.846191, -0.843123, -0.839993, -0.836921, -0.834026,
-    -0.831417, -0.829192, -0.827432, -0.826201, -0.82554, -0.825469,
-    -0.825983, -0.827055, -0.828639, -0.830666, -0.833053, -0.835702,
-    -0.838508, -0.84136, -0.844144, -0.846754, -0.849089, -0.85106,
-    -0.852593, -0.853631, -0.85414, -0.854102, -0.853525, -0.852433,
-    -0.850875, -0.848914, -0.846629, -0.844111, -0.841459, -0.838777,
-    -0.836168, -0.833733, -0.831563, -0.82974, -0.828332, -0.827387,
-    -0.826939, -0.826999, -0.82756, -0.828596, -0.83006, -0.831893,
-    -0.834017, -0.836349, -0.838795, -0.841257, -0.843639, -0.84585,
-    -0.847802, -0.849422, -0.850648, -0.851436, -0.851757, -0.851602,
-    -0.850979, -0.849917, -0.848458, -0.846662, -0.844601, -0.842355,
-    -0.840013, -0.837666, -0.835404, -0.833314, -0.831474, -0.829954,
-    -0.828809, -0.82808, -0.827792, -0.827951, -0.828547, -0.829554,
-    -0.830927, -0.832611, -0.834535, -0.836624, -0.838793, -0.840957,
-    -0.843031, -0.844933, -0.846591, -0.847941, -0.84893, -0.849524,
-    -0.8497, -0.849453, -0.848795, -0.847754, -0.846372, -0.844704,
-    -0.842816, -0.840782, -0.838681, -0.836594, -0.834602, -0.832781,
-    -0.831198, -0.829914, -0.828976, -0.828415, -0.828252, -0.828489,
-    -0.829113, -0.830096, -0.831396, -0.832961, -0.834727, -0.836622,
-    -0.838572, -0.840498, -0.842326, -0.843984, -0.845407, -0.84654,
-    -0.847341, -0.847779, -0.847838, -0.847517, -0.846831, -0.845807,
-    -0.844485, -0.842919, -0.84117, -0.839305, -0.837397, -0.835519,
-    -0.833744, -0.832139, -0.830764, -0.82967, -0.828897, -0.828473,
-    -0.82841, -0.828709, -0.829354, -0.830317, -0.831558, -0.833026,
-    -0.834662, -0.836399, -0.838169, -0.839901, -0.841528, -0.842984,
-    -0.844214, -0.84517, -0.845815, -0.846125, -0.846088, -0.845706,
-    -0.844995, -0.843984, -0.842712, -0.841229, -0.839593, -0.837867,
-    -0.836118, -0.834412, -0.832816, -0.831389, -0.830184, -0.829247,
-    -0.828612, -0.828299, -0.82832, -0.828669, -0.829331, -0.830278,
-    -0.831468, -0.832855, -0.834381, -0.835986, -0.837605, -0.839174,
-    -0.840631, -0.841919, -0.842987, -0.843794, -0.844308, -0.844509,
-    -0.84439, -0.843956, -0.843224, -0.842223, -0.840992, -0.839578,
-    -0.838037, -0.836428, -0.834812, -0.833251, -0.831804, -0.830527,
-    -0.829467, -0.828662, -0.828141, -0.827923, -0.828013, -0.828405,
-    -0.829081, -0.830012, -0.831159, -0.832476, -0.833908, -0.8354,
-    -0.83689, -0.838319, -0.839632, -0.840775, -0.841704, -0.842382,
-    -0.842783, -0.842891, -0.842702, -0.842223, -0.841472, -0.840479,
-    -0.839282, -0.837927, -0.836466, -0.834956, -0.833454, -0.832016,
-    -0.830698, -0.829549, -0.828611, -0.827919, -0.827498, -0.82736,
-    -0.827509, -0.827937, -0.828624, -0.829541, -0.83065, -0.831905,
-    -0.833256, -0.834649, -0.836026, -0.837334, -0.83852, -0.839538,
-    -0.840345, -0.840912, -0.841214, -0.841241, -0.840989, -0.84047,
-    -0.839702, -0.838715, -0.837547, -0.836242, -0.834851, -0.833427,
-    -0.832023, -0.830692, -0.829485, -0.828447, -0.827616, -0.827022,
-    -0.826685, -0.826617, -0.826817, -0.827276, -0.827972, -0.828876,
-    -0.82995, -0.831151, -0.83243, -0.833735, -0.835013, -0.836214,
-    -0.837288, -0.838194, -0.838894, -0.839361, -0.839576, -0.83953,
-    -0.839223, -0.838667, -0.837884, -0.836901, -0.835758, -0.834497,
-    -0.833167, -0.831817, -0.830499, -0.829262, -0.828153, -0.827212,
-    -0.826475, -0.825966, -0.825705, -0.825697, -0.825942, -0.826426,
-    -0.827129, -0.828021, -0.829065, -0.830217, -0.83143, -0.832656,
-    -0.833845, -0.834949, -0.835924, -0.836729, -0.837333, -0.837711,
-    -0.837847, -0.837735, -0.837378, -0.836789, -0.835991, -0.835012,
-    -0.83389, -0.832667, -0.83139, -0.830106, -0.828864, -0.827711,
-    -0.826688, -0.825833, -0.825178, -0.824746, -0.824551, -0.824597,
-    -0.82488, -0.825388, -0.826096, -0.826976, -0.827991, -0.829098,
-    -0.830252, -0.831407, -0.832515, -0.833531, -0.834414, -0.835129,
-    -0.835645, -0.835942, -0.836006, -0.835834, -0.835431, -0.834812,
-    -0.833999, -0.833022, -0.831919, -0.830729, -0.829499, -0.828274,
-    -0.8271, -0.826021, -0.825075, -0.824298, -0.823717, -0.823352,
-    -0.823216, -0.82331, -0.823628, -0.824155, -0.824868, -0.825736,
-    -0.826723, -0.827788, -0.828888, -0.829977, -0.83101, -0.831946,
-    -0.832746, -0.833377, -0.833813, -0.834035, -0.834033, -0.833805,
-    -0.83336, -0.832711, -0.831884, -0.830908, -0.829821, -0.828661,
-    -0.827473, -0.826301, -0.825188, -0.824175, -0.823299, -0.822591,
-    -0.822077, -0.821774, -0.82169, -0.821826, -0.822175, -0.822719,
-    -0.823435, -0.824291, -0.825253, -0.826279, -0.827328, -0.828355,
-    -0.829319, -0.830181, -0.830903, -0.831457, -0.831818, -0.83197,
-    -0.831906, -0.831627, -0.831141, -0.830465, -0.829624, -0.828648,
-    -0.827574, -0.826441, -0.825291, -0.824166, -0.823108, -0.822155,
-    -0.821342, -0.820697, -0.820244, -0.819995, -0.81996, -0.820134,
-    -0.82051, -0.821069, -0.821786, -0.822631, -0.823568, -0.824557,
-    -0.825557, -0.826527, -0.827427, -0.828218, -0.828868, -0.829348,
-    -0.829639, -0.829726, -0.829604, -0.829276, -0.828751, -0.828049,
-    -0.827194, -0.826217, -0.825155, -0.824045, -0.822929, -0.821847,
-    -0.820839, -0.819941, -0.819185, -0.818598, -0.818199, -0.818002,
-    -0.818009, -0.818218, -0.818618, -0.81919, -0.819907, -0.82074,
-    -0.821653, -0.822606, -0.823561, -0.824476, -0.825314, -0.826039,
-    -0.82662, -0.827032, -0.827256, -0.827281, -0.827104, -0.826729,
-    -0.826167, -0.825439, -0.82457, -0.823592, -0.822539, -0.82145,
-    -0.820364, -0.819321, -0.818359, -0.817511, -0.816808, -0.816273,
-    -0.815925, -0.815773, -0.81582, -0.816061, -0.816482, -0.817064,
-    -0.817781, -0.818602, -0.81949, -0.820409, -0.82132, -0.822183,
-    -0.822962, -0.823624, -0.824139, -0.824485, -0.824646, -0.824612,
-    -0.824381, -0.823961, -0.823364, -0.82261, -0.821727, -0.820745,
-    -0.8197, -0.818629, -0.817571, -0.816564, -0.815643, -0.814842,
-    -0.814187, -0.813701, -0.813399, -0.813289, -0.813372, -0.813641,
-    -0.814081, -0.814672, -0.815387, -0.816195, -0.81706, -0.817945,
-    -0.818813, -0.819625, -0.820348, -0.820948, -0.821401, -0.821684,
-    -0.821783, -0.821692, -0.82141, -0.820946, -0.820313, -0.819535,
-    -0.818637, -0.817651, -0.816612, -0.815557, -0.814524, -0.813549,
-    -0.812667, -0.811907, -0.811297, -0.810856, -0.810596, -0.810525,
-    -0.810641, -0.810935, -0.811392, -0.81199, -0.812702, -0.813496,
-    -0.814338, -0.81519, -0.816016, -0.816779, -0.817446, -0.817987,
-    -0.818378, -0.8186, -0.81864, -0.818493, -0.818161, -0.817653,
-    -0.816987, -0.816183, -0.815269, -0.814278, -0.813244, -0.812203,
-    -0.811192, -0.810247, -0.8094, -0.80868, -0.80811, -0.80771,
-    -0.80749, -0.807454, -0.8076, -0.807917, -0.808389, -0.808992,
-    -0.8097, -0.81048, -0.811298, -0.812117, -0.812901, -0.813616,
-    -0.814229, -0.814712, -0.815043, -0.815205, -0.815186, -0.814984,
-    -0.814603, -0.814053, -0.813352, -0.812522, -0.811593, -0.810595,
-    -0.809564, -0.808535, -0.807545, -0.806626, -0.805811, -0.805127,
-    -0.804596, -0.804234, -0.80405, -0.804046, -0.804219, -0.804557,
-    -0.805042, -0.805649, -0.806352, -0.807117, -0.80791, -0.808696,
-    -0.809439, -0.810105, -0.810665, -0.811091, -0.811363, -0.811465,
-    -0.811389, -0.811133, -0.810703, -0.810111, -0.809375, -0.808519,
-    -0.807573, -0.806567, -0.805538, -0.804519, -0.803546, -0.802652,
-    -0.801867, -0.801216, -0.80072, -0.800393, -0.800242, -0.800269,
-    -0.800467, -0.800823, -0.801318, -0.801928, -0.802624, -0.803373,
-    -0.804141, -0.804893, -0.805594, -0.806213, -0.80672, -0.807089,
-    -0.807302, -0.807346, -0.807213, -0.806903, -0.806424, -0.805789,
-    -0.805018, -0.804135, -0.803171, -0.802156, -0.801126, -0.800116,
-    -0.799159, -0.798287, -0.797529, -0.796909, -0.796445, -0.796151,
-    -0.796031, -0.796085, -0.796305, -0.796678, -0.797182, -0.797792,
-    -0.798479, -0.799211, -0.799953, -0.800671, -0.801331, -0.801901,
-    -0.802354, -0.802667, -0.802822, -0.802806, -0.802616, -0.802252,
-    -0.801724, -0.801046, -0.800239, -0.799329, -0.798345, -0.79732,
-    -0.796289, -0.795285, -0.794341, -0.793489, -0.792756, -0.792164,
-    -0.79173, -0.791466, -0.791374, -0.791453, -0.791694, -0.79208,
-    -0.792591, -0.7932, -0.793878, -0.794591, -0.795306, -0.795989,
-    -0.796606, -0.797128, -0.797527, -0.797783, -0.797878, -0.797804,
-    -0.797556, -0.797138, -0.79656, -0.795838, -0.794994, -0.794055,
-    -0.793051, -0.792014, -0.790979, -0.789979, -0.789047, -0.788213,
-    -0.787502, -0.786936, -0.786529, -0.786292, -0.786227, -0.786329,
-    -0.786588, -0.786986, -0.787502, -0.788108, -0.788774, -0.789468,
-    -0.790154, -0.7908, -0.791374, -0.791846, -0.792191, -0.792389,
-    -0.792424, -0.79229, -0.791983, -0.79151, -0.790881, -0.790114,
-    -0.789232, -0.788263, -0.787237, -0.786186, -0.785146, -0.784148,
-    -0.783226, -0.782407, -0.781716, -0.781174, -0.780793, -0.780581,
-    -0.780539, -0.780662, -0.780936, -0.781345, -0.781864, -0.782465,
-    -0.783118, -0.78379, -0.784446, -0.785055, -0.785584, -0.786005,
-    -0.786294, -0.786432, -0.786407, -0.786211, -0.785845, -0.785315,
-    -0.784634, -0.783821, -0.7829, -0.781898, -0.780848, -0.779782,
-    -0.778735, -0.777738, -0.776823, -0.776017, -0.775345, -0.774823,
-    -0.774465, -0.774276, -0.774256, -0.774397, -0.774685, -0.775101,
-    -0.775621, -0.776216, -0.776854, -0.777502, -0.778127, -0.778696,
-    -0.779178, -0.779547, -0.779778, -0.779856, -0.779768, -0.77951,
-    -0.779083, -0.778494, -0.77776, -0.776898, -0.775936, -0.774901,
-    -0.773825, -0.772742, -0.771685, -0.770686, -0.769776, -0.768982,
-    -0.768325, -0.767823, -0.767485, -0.767317, -0.767316, -0.767473,
-    -0.767773, -0.768195, -0.768713, -0.769299, -0.76992, -0.770542,
-    -0.771134, -0.771661, -0.772095, -0.772409, -0.772582, -0.772597,
-    -0.772445, -0.772121, -0.771631, -0.770982, -0.770192, -0.76928,
-    -0.768274, -0.767204, -0.7661, -0.764997, -0.763928, -0.762926,
-    -0.762019, -0.761234, -0.760591, -0.760105, -0.759786, -0.759636,
-    -0.759652, -0.759823, -0.760132, -0.760557, -0.761072, -0.761646,
-    -0.762248, -0.762843, -0.763398, -0.763882, -0.764265, -0.764522,
-    -0.764633, -0.764584, -0.764365, -0.763974, -0.763418, -0.762707,
-    -0.761858, -0.760894, -0.759843, -0.758734, -0.7576, -0.756475,
-    -0.755393, -0.754384, -0.753478, -0.752699, -0.752067, -0.751596,
-    -0.751293, -0.75116, -0.75119, -0.751372, -0.751688, -0.752114,
-    -0.752623, -0.753184, -0.753764, -0.754329, -0.754846, -0.755283,
-    -0.755613, -0.75581, -0.755857, -0.755739, -0.755451, -0.754991,
-    -0.754366, -0.753589, -0.752679, -0.75166, -0.75056, -0.74941,
-    -0.748244, -0.747094, -0.745995, -0.744978, -0.74407, -0.743295,
-    -0.742672, -0.742213, -0.741924, -0.741805, -0.741847, -0.742039,
-    -0.742359, -0.742784, -0.743284, -0.743829, -0.744384, -0.744916,
-    -0.745392, -0.74578, -0.746053, -0.746188, -0.746167, -0.745978,
-    -0.745617, -0.745084, -0.744387, -0.743542, -0.742568, -0.74149,
-    -0.740338, -0.739144, -0.737942, -0.736765, -0.735647, -0.734618,
-    -0.733706, -0.732933, -0.732316, -0.731867, -0.731589, -0.731481,
-    -0.731534, -0.731732, -0.732054, -0.732475, -0.732964, -0.73349,
-    -0.734018, -0.734514, -0.734944, -0.73528, -0.735493, -0.735562,
-    -0.735469, -0.735206, -0.734768, -0.734158, -0.733386, -0.732468,
-    -0.731426, -0.730286, -0.729079, -0.727838, -0.726597, -0.725389,
-    -0.724249, -0.723206, -0.722287, -0.721513, -0.7209, -0.720458,
-    -0.720189, -0.72009, -0.72015, -0.720352, -0.720674, -0.721088,
-    -0.721563, -0.722066, -0.722563, -0.72302, -0.723402, -0.723681,
-    -0.72383, -0.723829, -0.723661, -0.723319, -0.722799, -0.722108,
-    -0.721256, -0.720262, -0.719148, -0.717942, -0.716676, -0.715383,
-    -0.714099, -0.712858, -0.711692, -0.710632, -0.709702, -0.708925,
-    -0.708313, -0.707875, -0.707613, -0.70752, -0.707585, -0.707789,
-    -0.708107, -0.708511, -0.708969, -0.709447, -0.70991, -0.710323,
-    -0.710653, -0.710871, -0.710952, -0.710875, -0.710628, -0.710201,
-    -0.709596, -0.708819, -0.707882, -0.706806, -0.705615, -0.704338,
-    -0.703008, -0.70166, -0.70033, -0.69905, -0.697856, -0.696775,
-    -0.695832, -0.695048, -0.694434, -0.693999, -0.69374, -0.693651,
-    -0.693718, -0.69392, -0.694232, -0.694623, -0.695061, -0.695509,
-    -0.695934, -0.696299, -0.696573, -0.696725, -0.696733, -0.696576,
-    -0.696243, -0.695727, -0.69503, -0.694161, -0.693134, -0.69197,
-    -0.690697, -0.689344, -0.687946, -0.686538, -0.685156, -0.683835,
-    -0.682608, -0.681502, -0.680543, -0.679749, -0.679131, -0.678694,
-    -0.678437, -0.678349, -0.678415, -0.678612, -0.678914, -0.679289,
-    -0.679702, -0.680118, -0.6805, -0.680813, -0.681025, -0.681107,
-    -0.681036, -0.680793, -0.680368, -0.679756, -0.678962, -0.677994,
-    -0.67687, -0.675613, -0.674252, -0.672817, -0.671345, -0.669871,
-    -0.668433, -0.667066, -0.665801, -0.664668, -0.663688, -0.662881,
-    -0.662255, -0.661814, -0.661555, -0.661465, -0.661527, -0.661717,
-    -0.662006, -0.662361, -0.662746, -0.663125, -0.663459, -0.663715,
-    -0.66386, -0.663865, -0.663708, -0.663373, -0.662849, -0.662135,
-    -0.661235, -0.660162, -0.658934, -0.657577, -0.65612, -0.654597,
-    -0.653044, -0.6515, -0.65, -0.648581, -0.647275, -0.646109,
-    -0.645106, -0.644281, -0.643644, -0.643197, -0.642932, -0.642837,
-    -0.642892, -0.643071, -0.643344, -0.643675, -0.644028, -0.644364,
-    -0.644646, -0.644839, -0.64491, -0.644832, -0.644583, -0.644147,
-    -0.643517, -0.642693, -0.64168, -0.640493, -0.639153, -0.637687,
-    -0.636127, -0.634509, -0.632869, -0.631246, -0.629679, -0.628203,
-    -0.62685, -0.625647, -0.624616, -0.623771, -0.623119, -0.622661,
-    -0.622388, -0.622285, -0.62233, -0.622495, -0.622747, -0.62305,
-    -0.623366, -0.623655, -0.623879, -0.624002, -0.623993, -0.623824,
-    -0.623475, -0.622931, -0.622186, -0.621242, -0.620106, -0.618797,
-    -0.617336, -0.615753, -0.614082, -0.612359, -0.610624, -0.608916,
-    -0.607275, -0.605736, -0.60433, -0.603085, -0.602022, -0.601152,
-    -0.600482, -0.60001, -0.599726, -0.599612, -0.599643, -0.59979,
-    -0.600018, -0.600288, -0.600562, -0.600798, -0.600957, -0.601005,
-    -0.600907, -0.60064, -0.600181, -0.599519, -0.59865, -0.597575,
-    -0.596307, -0.594865, -0.593272, -0.591562, -0.589769, -0.587933,
-    -0.586095, -0.584294, -0.582571, -0.580962, -0.579498, -0.578206,
-    -0.577105, -0.576207, -0.575515, -0.575026, -0.574726, -0.574597,
-    -0.574611, -0.574737, -0.574936, -0.575169, -0.575395, -0.575572,
-    -0.575661, -0.575624, -0.57543, -0.575054, -0.574477, -0.573686,
-    -0.572681, -0.571465, -0.570053, -0.568465, -0.56673, -0.564881,
-    -0.562956, -0.560996, -0.559044, -0.557141, -0.555329, -0.553642,
-    -0.552113, -0.550768, -0.549625, -0.548693, -0.547976, -0.547466,
-    -0.547148, -0.547001, -0.546995, -0.547094, -0.547261, -0.547452,
-    -0.547625, -0.547736, -0.547746, -0.547616, -0.547317, -0.546822,
-    -0.546114, -0.545184, -0.54403, -0.54266, -0.54109, -0.539344,
-    -0.537452, -0.535452, -0.533382, -0.531287, -0.52921, -0.527196,
-    -0.525284, -0.523512, -0.521911, -0.520507, -0.519316, -0.518347,
-    -0.517599, -0.517065, -0.516726, -0.516557, -0.516527, -0.516597,
-    -0.516726, -0.51687, -0.516983, -0.517022, -0.516944, -0.516713,
-    -0.516297, -0.515672, -0.514821, -0.513737, -0.51242, -0.510881,
-    -0.509138, -0.507219, -0.505156, -0.502989, -0.500761, -0.498517,
-    -0.496304, -0.494166, -0.492145, -0.490279, -0.488598, -0.487128,
-    -0.485884, -0.484873, -0.484092, -0.483529, -0.483166, -0.482972,
-    -0.482915, -0.482952, -0.483039, -0.48313, -0.483178, -0.483136,
-    -0.482962, -0.482618, -0.482074, -0.481306, -0.480297, -0.479043,
-    -0.477548, -0.475823, -0.47389, -0.47178, -0.469529, -0.467179,
-    -0.464777, -0.462369, -0.460005, -0.457731, -0.455589, -0.453619,
-    -0.451851, -0.450308, -0.449005, -0.447947, -0.447128, -0.446535,
-    -0.446144, -0.445924, -0.445836, -0.445836, -0.445877, -0.44591,
-    -0.445885, -0.445754, -0.445474, -0.445007, -0.444321, -0.443394,
-    -0.442212, -0.440771, -0.439078, -0.437148, -0.435006, -0.432685,
-    -0.430226, -0.427674, -0.425078, -0.42249, -0.419959, -0.417535,
-    -0.415261, -0.413176, -0.411311, -0.409688, -0.408321, -0.407211,
-    -0.406352, -0.405725, -0.405305, -0.405055, -0.404934, -0.404895,
-    -0.404886, -0.404855, -0.40475, -0.404521, -0.404124, -0.40352,
-    -0.402678, -0.401576, -0.400202, -0.398554, -0.396641, -0.394483,
-    -0.392109, -0.389554, -0.386864, -0.384088, -0.381278, -0.378489,
-    -0.375774, -0.373184, -0.370763, -0.368552, -0.366581, -0.364871,
-    -0.363433, -0.362269, -0.361366, -0.360704, -0.360253, -0.359974,
-    -0.359819, -0.359737, -0.359675, -0.359575, -0.359383, -0.359047,
-    -0.358522, -0.357766, -0.356751, -0.355454, -0.353866, -0.351988,
-    -0.349831, -0.34742, -0.344786, -0.341971, -0.339023, -0.335997,
-    -0.332949, -0.329937, -0.327017, -0.324242, -0.321659, -0.319309,
-    -0.317221, -0.315417, -0.313904, -0.312681, -0.311734, -0.311037,
-    -0.310556, -0.310247, -0.310058, -0.309934, -0.309815, -0.309642,
-    -0.309356, -0.308904, -0.308236, -0.307314, -0.306106, -0.304593,
-    -0.302766, -0.30063, -0.298201, -0.295504, -0.292579, -0.289472,
-    -0.286235, -0.282929, -0.279614, -0.276352, -0.273203, -0.270223,
-    -0.267462, -0.264958, -0.262744, -0.260837, -0.259245, -0.257963,
-    -0.256972, -0.256242, -0.255734, -0.255399, -0.255179, -0.255013,
-    -0.254838, -0.254588, -0.254202, -0.253623, -0.2528, -0.251693,
-    -0.250271, -0.248515, -0.246421, -0.243995, -0.241257, -0.238239,
-    -0.234985, -0.231547, -0.227984, -0.224361, -0.220745, -0.217202,
-    -0.213797, -0.210588, -0.207628, -0.204956, -0.202604, -0.200589,
-    -0.198916, -0.197575, -0.196544, -0.195788, -0.19526, -0.194906,
-    -0.194661, -0.194459, -0.194229, -0.193902, -0.193411, -0.192695,
-    -0.191702, -0.19039, -0.188729, -0.186701, -0.184303, -0.181548,
-    -0.178459, -0.175076, -0.171446, -0.167631, -0.163696, -0.159712,
-    -0.155753, -0.151892, -0.148197, -0.144732, -0.141551, -0.138695,
-    -0.136195, -0.134068, -0.132314, -0.130919, -0.129857, -0.129086,
-    -0.128552, -0.128192, -0.127936, -0.127708, -0.127431, -0.127029,
-    -0.12643, -0.125568, -0.12439, -0.12285, -0.12092, -0.118583,
-    -0.11584, -0.112707, -0.109216, -0.10541, -0.101348, -0.0970968,
-    -0.0927316, -0.0883321, -0.0839796, -0.079754, -0.0757302, -0.0719758,
-    -0.0685478, -0.0654905, -0.062834, -0.0605923, -0.0587632, -0.0573281,
-    -0.0562522, -0.0554866, -0.0549693, -0.0546278, -0.0543823, -0.0541478,
-    -0.0538386, -0.0533704, -0.0526647, -0.0516511, -0.0502706, -0.0484778,
-    -0.0462428, -0.0435524, -0.040411, -0.0368402, -0.0328784, -0.0285793,
-    -0.0240098, -0.0192477, -0.0143786, -0.00949268, -0.00468102, -3.23793e-5,
-    0.00437055, 0.00845436, 0.0121578, 0.0154345, 0.0182545, 0.020606,
-    0.0224956, 0.0239485, 0.0250074, 0.0257312, 0.0261925, 0.0264754,
-    0.0266718, 0.0268782, 0.0271916, 0.0277063, 0.0285095, 0.0296784,
-    0.0312768, 0.0333525, 0.0359354, 0.0390361, 0.0426455, 0.0467346,
-    0.0512557, 0.0561444, 0.0613213, 0.0666956, 0.0721682, 0.0776355,
-    0.0829937, 0.0881424, 0.0929892, 0.0974526, 0.101466, 0.10498,
-    0.107965, 0.110412, 0.112332, 0.11376, 0.114748, 0.115368,
-    0.115706, 0.115862, 0.115943, 0.116061, 0.116328, 0.116851,
-    0.117729, 0.119048, 0.120879, 0.123272, 0.126259, 0.129846,
-    0.134018, 0.138737, 0.143943, 0.149557, 0.155483, 0.161614,
-    0.167831, 0.174015, 0.180043, 0.185799, 0.191178, 0.196088,
-    0.200454, 0.204222, 0.207363, 0.20987, 0.211764, 0.213087,
-    0.213909, 0.214315, 0.214414, 0.214323, 0.214172, 0.214094,
-    0.214221, 0.214678, 0.215582, 0.217031, 0.219104, 0.221859,
-    0.225325, 0.229508, 0.234382, 0.239897, 0.245977, 0.252523,
-    0.259416, 0.266524, 0.273705, 0.28081, 0.287696, 0.294224,
-    0.300267, 0.305718, 0.310491, 0.314526, 0.317791, 0.320286,
-    0.322039, 0.323109, 0.323583, 0.323575, 0.323217, 0.322657,
-    0.322057, 0.32158, 0.321388, 0.321635, 0.322461, 0.323985,
-    0.3263, 0.329472, 0.333534, 0.338485, 0.344289, 0.350877,
-    0.358149, 0.365976, 0.374206, 0.38267, 0.391186, 0.399568,
-    0.407633, 0.415208, 0.422135, 0.42828, 0.43354, 0.437841,
-    0.441149, 0.443469, 0.444842, 0.445351, 0.445113, 0.444278,
-    0.443021, 0.44154, 0.440043, 0.438745, 0.437858, 0.437582,
-    0.438098, 0.43956, 0.442087, 0.445762, 0.450622, 0.456663,
-    0.46383, 0.472027, 0.481115, 0.490916, 0.501223, 0.511803,
-    0.522408, 0.532785, 0.542683, 0.551864, 0.560115, 0.567253,
-    0.573134, 0.577664, 0.580795, 0.582537, 0.582953, 0.582162,
-    0.580333, 0.577679, 0.574455, 0.570945, 0.56745, 0.564283,
-    0.561751, 0.560149, 0.559741, 0.560756, 0.563372, 0.567712,
-    0.573837, 0.581738, 0.591339, 0.602494, 0.614992, 0.628563,
-    0.642888, 0.657603, 0.672321, 0.686638, 0.700153, 0.712479,
-    0.723264, 0.732199, 0.739038, 0.743607, 0.745811, 0.745646,
-    0.7432, 0.738655, 0.732282, 0.724437, 0.715553, 0.706123,
-    0.696689, 0.687821, 0.6801, 0.674094, 0.670338, 0.669313,
-    0.671427, 0.676989, 0.686199, 0.699134, 0.715729, 0.735782,
-    0.758941, 0.784714, 0.812467, 0.841445, 0.870777, 0.899504,
-    0.926595, 0.950977, 0.971561, 0.987269, 0.997069, 1,
-    0.995203, 0.981946, 0.959648, 0.927899, 0.886477, 0.835355,
-    0.774714, 0.704935, 0.626603, 0.540488, 0.447538, 0.348853,
-    0.245662, 0.139296 
-};
-
-static const float WAVE_EXPONENTIAL_078[DEFAULT_WAVELEN] = {
-    0.0603948, 0.00491931, -0.0505338, -0.105773, -0.160608, -0.214852,
-    -0.268321, -0.320838, -0.37223, -0.422331, -0.470986, -0.518045,
-    -0.56337, -0.606834, -0.648319, -0.68772, -0.724946, -0.759915,
-    -0.792561, -0.82283, -0.850684, -0.876094, -0.899049, -0.91955,
-    -0.93761, -0.953257, -0.966529, -0.97748, -0.986173, -0.992681,
-    -0.997091, -0.999496, -1, -0.998714, -0.995758, -0.991254,
-    -0.985334, -0.978131, -0.969783, -0.960429, -0.95021, -0.939267,
-    -0.927741, -0.915771, -0.903491, -0.891036, -0.878534, -0.866107,
-    -0.853874, -0.841944, -0.830422, -0.819404, -0.808976, -0.799219,
-    -0.790201, -0.781984, -0.77462, -0.768149, -0.762603, -0.758006,
-    -0.754371, -0.7517, -0.74999, -0.749225, -0.749384, -0.750437,
-    -0.752346, -0.755067, -0.758549, -0.762735, -0.767566, -0.772974,
-    -0.778892, -0.785246, -0.791964, -0.798968, -0.806184, -0.813534,
-    -0.820943, -0.828337, -0.835644, -0.842794, -0.84972, -0.85636,
-    -0.862655, -0.868552, -0.874001, -0.87896, -0.883391, -0.887262,
-    -0.890546, -0.893226, -0.895287, -0.896721, -0.897529, -0.897715,
-    -0.897291, -0.896272, -0.894681, -0.892544, -0.889894, -0.886766,
-    -0.8832, -0.879241, -0.874933, -0.870326, -0.865471, -0.860419,
-    -0.855225, -0.849941, -0.844621, -0.839318, -0.834084, -0.828968,
-    -0.82402, -0.819284, -0.814804, -0.810618, -0.806764, -0.803274,
-    -0.800175, -0.797491, -0.795243, -0.793446, -0.792108, -0.791237,
-    -0.790834, -0.790894, -0.79141, -0.79237, -0.793758, -0.795553,
-    -0.797731, -0.800264, -0.803123, -0.806275, -0.809684, -0.813312,
-    -0.81712, -0.821069, -0.825116, -0.829221, -0.833343, -0.837439,
-    -0.84147, -0.845397, -0.849183, -0.852791, -0.856189, -0.859345,
-    -0.862232, -0.864823, -0.867098, -0.869038, -0.870627, -0.871855,
-    -0.872713, -0.873198, -0.873309, -0.87305, -0.872427, -0.871451,
-    -0.870136, -0.868499, -0.866559, -0.864338, -0.861863, -0.859161,
-    -0.856259, -0.85319, -0.849985, -0.846678, -0.843301, -0.83989,
-    -0.836477, -0.833097, -0.829782, -0.826563, -0.823473, -0.820539,
-    -0.817788, -0.815247, -0.812936, -0.810877, -0.809088, -0.807581,
-    -0.806371, -0.805464, -0.804867, -0.804582, -0.804609, -0.804944,
-    -0.80558, -0.806508, -0.807716, -0.809189, -0.810909, -0.812856,
-    -0.81501, -0.817346, -0.81984, -0.822465, -0.825193, -0.827998,
-    -0.830849, -0.833718, -0.836577, -0.839397, -0.842151, -0.84481,
-    -0.847351, -0.849749, -0.85198, -0.854025, -0.855865, -0.857483,
-    -0.858864, -0.859998, -0.860875, -0.861487, -0.861833, -0.861909,
-    -0.861717, -0.861262, -0.86055, -0.85959, -0.858394, -0.856974,
-    -0.855347, -0.853531, -0.851544, -0.849407, -0.847144, -0.844776,
-    -0.842328, -0.839825, -0.837291, -0.834752, -0.832233, -0.829758,
-    -0.827351, -0.825035, -0.822833, -0.820764, -0.818848, -0.817102,
-    -0.815543, -0.814184, -0.813037, -0.812111, -0.811413, -0.810949,
-    -0.81072, -0.810728, -0.810971, -0.811443, -0.812138, -0.813048,
-    -0.814161, -0.815466, -0.816947, -0.818588, -0.820371, -0.822279,
-    -0.82429, -0.826384, -0.828539, -0.830733, -0.832945, -0.835151,
-    -0.83733, -0.839461, -0.841521, -0.843491, -0.845353, -0.847087,
-    -0.848678, -0.85011, -0.851371, -0.852447, -0.853331, -0.854014,
-    -0.85449, -0.854756, -0.854811, -0.854655, -0.85429, -0.853721,
-    -0.852956, -0.852003, -0.850871, -0.849574, -0.848124, -0.846538,
-    -0.84483, -0.843019, -0.841123, -0.839161, -0.837153, -0.835118,
-    -0.833077, -0.831049, -0.829054, -0.827112, -0.825241, -0.823459,
-    -0.821783, -0.820228, -0.81881, -0.81754, -0.81643, -0.815491,
-    -0.814729, -0.814152, -0.813764, -0.813567, -0.813561, -0.813746,
-    -0.814117, -0.814671, -0.815401, -0.816297, -0.81735, -0.818547,
-    -0.819877, -0.821325, -0.822876, -0.824513, -0.826219, -0.827978,
-    -0.82977, -0.831578, -0.833383, -0.835167, -0.836913, -0.838603,
-    -0.84022, -0.841749, -0.843174, -0.844481, -0.845659, -0.846695,
-    -0.84758, -0.848306, -0.848865, -0.849254, -0.849468, -0.849507,
-    -0.84937, -0.849059, -0.848579, -0.847933, -0.847131, -0.846179,
-    -0.845087, -0.843868, -0.842533, -0.841095, -0.83957, -0.837973,
-    -0.836318, -0.834624, -0.832906, -0.831181, -0.829465, -0.827777,
-    -0.826132, -0.824545, -0.823032, -0.821607, -0.820283, -0.819073,
-    -0.817988, -0.817038, -0.816231, -0.815574, -0.815073, -0.814731,
-    -0.814551, -0.814534, -0.814678, -0.814981, -0.81544, -0.816047,
-    -0.816797, -0.817681, -0.818689, -0.819811, -0.821034, -0.822345,
-    -0.823731, -0.825178, -0.826669, -0.828191, -0.829727, -0.831262,
-    -0.83278, -0.834266, -0.835706, -0.837083, -0.838386, -0.8396,
-    -0.840715, -0.841718, -0.842601, -0.843354, -0.84397, -0.844443,
-    -0.84477, -0.844946, -0.844971, -0.844845, -0.844568, -0.844145,
-    -0.843578, -0.842876, -0.842043, -0.84109, -0.840024, -0.838858,
-    -0.837603, -0.83627, -0.834874, -0.833428, -0.831946, -0.830442,
-    -0.828932, -0.827429, -0.825949, -0.824505, -0.823111, -0.82178,
-    -0.820526, -0.819359, -0.818291, -0.817331, -0.816489, -0.815771,
-    -0.815183, -0.814731, -0.814419, -0.814248, -0.814219, -0.814332,
-    -0.814584, -0.814972, -0.815492, -0.816136, -0.816899, -0.817771,
-    -0.818743, -0.819805, -0.820945, -0.822152, -0.823412, -0.824713,
-    -0.82604, -0.827382, -0.828723, -0.83005, -0.83135, -0.832608,
-    -0.833814, -0.834953, -0.836015, -0.83699, -0.837867, -0.838637,
-    -0.839293, -0.839828, -0.840238, -0.840517, -0.840663, -0.840675,
-    -0.840553, -0.840297, -0.839911, -0.839398, -0.838764, -0.838014,
-    -0.837156, -0.836198, -0.83515, -0.834021, -0.832824, -0.831569,
-    -0.830269, -0.828937, -0.827584, -0.826225, -0.824872, -0.823538,
-    -0.822235, -0.820977, -0.819775, -0.818641, -0.817584, -0.816615,
-    -0.815742, -0.814973, -0.814316, -0.813775, -0.813356, -0.813061,
-    -0.812893, -0.812852, -0.812938, -0.81315, -0.813483, -0.813935,
-    -0.814499, -0.81517, -0.815939, -0.816799, -0.817739, -0.818751,
-    -0.819822, -0.820943, -0.822101, -0.823283, -0.824478, -0.825674,
-    -0.826858, -0.828017, -0.82914, -0.830215, -0.831231, -0.832178,
-    -0.833046, -0.833826, -0.83451, -0.835092, -0.835564, -0.835922,
-    -0.836163, -0.836284, -0.836283, -0.83616, -0.835917, -0.835555,
-    -0.835077, -0.834489, -0.833797, -0.833005, -0.832123, -0.831158,
-    -0.83012, -0.829019, -0.827865, -0.82667, -0.825444, -0.8242,
-    -0.822948, -0.821702, -0.820473, -0.819272, -0.818111, -0.817,
-    -0.815951, -0.814971, -0.814071, -0.813259, -0.812542, -0.811925,
-    -0.811415, -0.811016, -0.81073, -0.81056, -0.810506, -0.810568,
-    -0.810745, -0.811034, -0.81143, -0.81193, -0.812528, -0.813216,
-    -0.813987, -0.814833, -0.815744, -0.81671, -0.817722, -0.818768,
-    -0.819838, -0.82092, -0.822002, -0.823074, -0.824123, -0.82514,
-    -0.826114, -0.827033, -0.827889, -0.828673, -0.829377, -0.829992,
-    -0.830513, -0.830934, -0.83125, -0.831457, -0.831554, -0.831539,
-    -0.831412, -0.831173, -0.830825, -0.83037, -0.829813, -0.829159,
-    -0.828414, -0.827584, -0.826678, -0.825704, -0.824671, -0.823588,
-    -0.822467, -0.821317, -0.82015, -0.818976, -0.817806, -0.816651,
-    -0.815522, -0.814429, -0.813383, -0.812392, -0.811467, -0.810615,
-    -0.809843, -0.80916, -0.80857, -0.808078, -0.807689, -0.807405,
-    -0.807228, -0.807159, -0.807198, -0.807344, -0.807593, -0.807943,
-    -0.808389, -0.808926, -0.809548, -0.810247, -0.811016, -0.811846,
-    -0.812728, -0.813652, -0.814609, -0.815587, -0.816578, -0.817569,
-    -0.818551, -0.819513, -0.820444, -0.821335, -0.822177, -0.822959,
-    -0.823674, -0.824314, -0.824872, -0.825342, -0.825718, -0.825997,
-    -0.826175, -0.826249, -0.826218, -0.826082, -0.825842, -0.825499,
-    -0.825056, -0.824518, -0.823888, -0.823172, -0.822377, -0.82151,
-    -0.820579, -0.819592, -0.818559, -0.817489, -0.816391, -0.815277,
-    -0.814156, -0.813038, -0.811934, -0.810854, -0.809808, -0.808805,
-    -0.807854, -0.806963, -0.806142, -0.805396, -0.804732, -0.804156,
-    -0.803672, -0.803284, -0.802996, -0.802808, -0.802722, -0.802737,
-    -0.802853, -0.803067, -0.803375, -0.803774, -0.80426, -0.804825,
-    -0.805463, -0.806167, -0.806929, -0.80774, -0.808592, -0.809475,
-    -0.810379, -0.811294, -0.81221, -0.813117, -0.814006, -0.814867,
-    -0.815689, -0.816465, -0.817185, -0.817842, -0.818428, -0.818936,
-    -0.819361, -0.819698, -0.819942, -0.820091, -0.820141, -0.820092,
-    -0.819944, -0.819696, -0.819351, -0.818911, -0.81838, -0.817762,
-    -0.817063, -0.816288, -0.815444, -0.814539, -0.813581, -0.812578,
-    -0.81154, -0.810476, -0.809395, -0.808307, -0.807222, -0.80615,
-    -0.8051, -0.804082, -0.803104, -0.802176, -0.801305, -0.800499,
-    -0.799765, -0.799109, -0.798536, -0.798051, -0.797658, -0.797358,
-    -0.797155, -0.797048, -0.797039, -0.797124, -0.797304, -0.797573,
-    -0.79793, -0.798368, -0.798883, -0.799468, -0.800116, -0.80082,
-    -0.801571, -0.802361, -0.80318, -0.80402, -0.804871, -0.805723,
-    -0.806567, -0.807394, -0.808193, -0.808957, -0.809676, -0.810342,
-    -0.810948, -0.811485, -0.811949, -0.812333, -0.812633, -0.812844,
-    -0.812963, -0.812988, -0.812918, -0.812752, -0.812491, -0.812137,
-    -0.811691, -0.811158, -0.810541, -0.809845, -0.809077, -0.808242,
-    -0.807349, -0.806404, -0.805416, -0.804393, -0.803345, -0.80228,
-    -0.801209, -0.80014, -0.799082, -0.798046, -0.79704, -0.796073,
-    -0.795152, -0.794287, -0.793484, -0.79275, -0.79209, -0.791511,
-    -0.791016, -0.790609, -0.790292, -0.790068, -0.789937, -0.7899,
-    -0.789954, -0.790099, -0.790331, -0.790647, -0.791041, -0.79151,
-    -0.792047, -0.792644, -0.793296, -0.793993, -0.794728, -0.795491,
-    -0.796275, -0.79707, -0.797866, -0.798655, -0.799426, -0.800172,
-    -0.800883, -0.801551, -0.802169, -0.802727, -0.803221, -0.803642,
-    -0.803987, -0.80425, -0.804427, -0.804515, -0.804512, -0.804417,
-    -0.804229, -0.803948, -0.803577, -0.803117, -0.802572, -0.801946,
-    -0.801243, -0.800469, -0.799631, -0.798734, -0.797788, -0.7968,
-    -0.795777, -0.79473, -0.793666, -0.792595, -0.791526, -0.790468,
-    -0.78943, -0.788421, -0.78745, -0.786524, -0.785651, -0.784838,
-    -0.784092, -0.783418, -0.782822, -0.782308, -0.78188, -0.781539,
-    -0.781289, -0.781129, -0.781059, -0.78108, -0.781188, -0.781382,
-    -0.781657, -0.782009, -0.782433, -0.782924, -0.783474, -0.784077,
-    -0.784725, -0.78541, -0.786123, -0.786855, -0.787599, -0.788344,
-    -0.789082, -0.789804, -0.7905, -0.791163, -0.791784, -0.792356,
-    -0.79287, -0.79332, -0.793701, -0.794006, -0.794231, -0.794373,
-    -0.794427, -0.794392, -0.794267, -0.79405, -0.793743, -0.793347,
-    -0.792864, -0.792298, -0.791651, -0.790929, -0.790138, -0.789282,
-    -0.78837, -0.787409, -0.786405, -0.785369, -0.784307, -0.783228,
-    -0.782142, -0.781058, -0.779985, -0.77893, -0.777904, -0.776914,
-    -0.775968, -0.775074, -0.774239, -0.77347, -0.772771, -0.772148,
-    -0.771606, -0.771147, -0.770775, -0.770491, -0.770296, -0.77019,
-    -0.770172, -0.770241, -0.770394, -0.770627, -0.770936, -0.771316,
-    -0.771761, -0.772265, -0.772821, -0.773422, -0.774059, -0.774724,
-    -0.775408, -0.776104, -0.776801, -0.777491, -0.778166, -0.778815,
-    -0.779432, -0.780007, -0.780534, -0.781004, -0.781412, -0.78175,
-    -0.782014, -0.782199, -0.782301, -0.782317, -0.782245, -0.782084,
-    -0.781832, -0.781491, -0.781061, -0.780546, -0.779947, -0.779269,
-    -0.778516, -0.777694, -0.776809, -0.775867, -0.774875, -0.773842,
-    -0.772776, -0.771684, -0.770575, -0.769459, -0.768344, -0.767239,
-    -0.766153, -0.765094, -0.764071, -0.763091, -0.762163, -0.761292,
-    -0.760486, -0.75975, -0.759089, -0.758508, -0.758009, -0.757597,
-    -0.757271, -0.757034, -0.756885, -0.756824, -0.756849, -0.756957,
-    -0.757144, -0.757407, -0.757741, -0.75814, -0.758598, -0.759107,
-    -0.75966, -0.76025, -0.760868, -0.761505, -0.762154, -0.762804,
-    -0.763448, -0.764075, -0.764679, -0.765249, -0.765779, -0.76626,
-    -0.766685, -0.767047, -0.767341, -0.767561, -0.767701, -0.76776,
-    -0.767732, -0.767616, -0.767411, -0.767116, -0.766731, -0.766258,
-    -0.765698, -0.765056, -0.764334, -0.763537, -0.762671, -0.761741,
-    -0.760754, -0.759718, -0.758639, -0.757526, -0.756388, -0.755233,
-    -0.75407, -0.752907, -0.751754, -0.75062, -0.749512, -0.74844,
-    -0.747411, -0.746432, -0.745512, -0.744655, -0.743869, -0.743157,
-    -0.742525, -0.741976, -0.741512, -0.741136, -0.740848, -0.740648,
-    -0.740536, -0.74051, -0.740568, -0.740705, -0.740918, -0.741203,
-    -0.741552, -0.74196, -0.742421, -0.742925, -0.743467, -0.744037,
-    -0.744626, -0.745227, -0.745829, -0.746425, -0.747005, -0.747561,
-    -0.748084, -0.748566, -0.748999, -0.749376, -0.749689, -0.749934,
-    -0.750104, -0.750195, -0.750202, -0.750123, -0.749956, -0.749698,
-    -0.749349, -0.74891, -0.748381, -0.747766, -0.747066, -0.746287,
-    -0.745431, -0.744505, -0.743514, -0.742466, -0.741367, -0.740225,
-    -0.739049, -0.737846, -0.736626, -0.735397, -0.734168, -0.732949,
-    -0.731748, -0.730573, -0.729434, -0.728338, -0.727293, -0.726306,
-    -0.725383, -0.724531, -0.723754, -0.723058, -0.722444, -0.721917,
-    -0.721479, -0.721129, -0.720869, -0.720697, -0.720613, -0.720612,
-    -0.720693, -0.72085, -0.721079, -0.721375, -0.72173, -0.722137,
-    -0.72259, -0.72308, -0.723599, -0.724138, -0.724688, -0.725241,
-    -0.725786, -0.726316, -0.726822, -0.727293, -0.727724, -0.728104,
-    -0.728428, -0.728688, -0.728877, -0.728991, -0.729024, -0.728973,
-    -0.728833, -0.728603, -0.728281, -0.727867, -0.727361, -0.726763,
-    -0.726077, -0.725305, -0.724451, -0.723519, -0.722516, -0.721446,
-    -0.720317, -0.719136, -0.717912, -0.716651, -0.715363, -0.714057,
-    -0.712741, -0.711425, -0.710119, -0.70883, -0.707568, -0.706341,
-    -0.705159, -0.704027, -0.702955, -0.701948, -0.701012, -0.700153,
-    -0.699375, -0.698683, -0.698078, -0.697563, -0.697139, -0.696806,
-    -0.696564, -0.69641, -0.696342, -0.696357, -0.69645, -0.696617,
-    -0.696851, -0.697147, -0.697496, -0.697892, -0.698326, -0.698789,
-    -0.699273, -0.699769, -0.700267, -0.700758, -0.701233, -0.701683,
-    -0.702099, -0.702472, -0.702794, -0.703058, -0.703257, -0.703383,
-    -0.703432, -0.703398, -0.703276, -0.703065, -0.70276, -0.702361,
-    -0.701867, -0.701278, -0.700595, -0.699821, -0.698958, -0.69801,
-    -0.696983, -0.69588, -0.69471, -0.693479, -0.692193, -0.690862,
-    -0.689493, -0.688096, -0.686679, -0.685252, -0.683825, -0.682406,
-    -0.681006, -0.679632, -0.678295, -0.677002, -0.675761, -0.674581,
-    -0.673468, -0.672428, -0.671466, -0.670588, -0.669798, -0.669098,
-    -0.66849, -0.667976, -0.667555, -0.667228, -0.666992, -0.666845,
-    -0.666783, -0.666802, -0.666897, -0.667062, -0.66729, -0.667573,
-    -0.667905, -0.668276, -0.668677, -0.6691, -0.669536, -0.669973,
-    -0.670404, -0.670818, -0.671206, -0.671558, -0.671867, -0.672123,
-    -0.672319, -0.672446, -0.672499, -0.672471, -0.672358, -0.672154,
-    -0.671856, -0.671461, -0.670969, -0.670377, -0.669687, -0.668899,
-    -0.668015, -0.66704, -0.665976, -0.664829, -0.663603, -0.662307,
-    -0.660946, -0.659529, -0.658063, -0.656558, -0.655023, -0.653467,
-    -0.6519, -0.650332, -0.648772, -0.647231, -0.645717, -0.64424,
-    -0.642809, -0.641432, -0.640118, -0.638872, -0.637703, -0.636615,
-    -0.635613, -0.634702, -0.633886, -0.633165, -0.632541, -0.632015,
-    -0.631587, -0.631253, -0.631011, -0.630859, -0.630791, -0.630802,
-    -0.630886, -0.631036, -0.631245, -0.631503, -0.631803, -0.632134,
-    -0.632488, -0.632855, -0.633225, -0.633587, -0.633932, -0.63425,
-    -0.634531, -0.634765, -0.634945, -0.635061, -0.635106, -0.635073,
-    -0.634955, -0.634747, -0.634445, -0.634043, -0.63354, -0.632934,
-    -0.632224, -0.63141, -0.630493, -0.629476, -0.628361, -0.627153,
-    -0.625857, -0.624479, -0.623025, -0.621504, -0.619922, -0.618289,
-    -0.616614, -0.614906, -0.613177, -0.611434, -0.60969, -0.607954,
-    -0.606237, -0.604548, -0.602898, -0.601295, -0.599749, -0.598267,
-    -0.596858, -0.595529, -0.594285, -0.593131, -0.592073, -0.591114,
-    -0.590256, -0.5895, -0.588846, -0.588295, -0.587844, -0.587491,
-    -0.587232, -0.587061, -0.586974, -0.586964, -0.587024, -0.587145,
-    -0.587319, -0.587537, -0.587789, -0.588065, -0.588354, -0.588646,
-    -0.588931, -0.589197, -0.589434, -0.589633, -0.589783, -0.589874,
-    -0.589898, -0.589847, -0.589712, -0.589488, -0.589168, -0.588747,
-    -0.588221, -0.587588, -0.586844, -0.58599, -0.585025, -0.58395,
-    -0.582768, -0.581482, -0.580097, -0.578617, -0.57705, -0.575401,
-    -0.57368, -0.571894, -0.570052, -0.568166, -0.566244, -0.564297,
-    -0.562337, -0.560374, -0.558419, -0.556483, -0.554576, -0.55271,
-    -0.550894, -0.549138, -0.54745, -0.545839, -0.544312, -0.542876,
-    -0.541536, -0.540298, -0.539165, -0.538139, -0.537222, -0.536415,
-    -0.535717, -0.535126, -0.534639, -0.534252, -0.533961, -0.533758,
-    -0.533638, -0.533593, -0.533614, -0.533691, -0.533816, -0.533977,
-    -0.534164, -0.534365, -0.534569, -0.534766, -0.534942, -0.535089,
-    -0.535193, -0.535245, -0.535234, -0.535151, -0.534987, -0.534733,
-    -0.534383, -0.53393, -0.533368, -0.532693, -0.531901, -0.530991,
-    -0.529962, -0.528812, -0.527545, -0.526161, -0.524665, -0.523061,
-    -0.521354, -0.519552, -0.517662, -0.515693, -0.513653, -0.511553,
-    -0.509403, -0.507214, -0.504998, -0.502766, -0.50053, -0.498302,
-    -0.496094, -0.493917, -0.491782, -0.489702, -0.487685, -0.485742,
-    -0.483881, -0.48211, -0.480438, -0.478869, -0.47741, -0.476064,
-    -0.474835, -0.473723, -0.47273, -0.471855, -0.471096, -0.470449,
-    -0.469912, -0.469478, -0.469141, -0.468893, -0.468727, -0.468632,
-    -0.4686, -0.468618, -0.468677, -0.468763, -0.468866, -0.468972,
-    -0.46907, -0.469146, -0.469189, -0.469187, -0.469128, -0.469,
-    -0.468793, -0.468498, -0.468106, -0.467607, -0.466996, -0.466266,
-    -0.465413, -0.464431, -0.46332, -0.462077, -0.460703, -0.459199,
-    -0.457567, -0.455812, -0.453937, -0.45195, -0.449858, -0.447668,
-    -0.44539, -0.443034, -0.44061, -0.438132, -0.435609, -0.433056,
-    -0.430484, -0.427908, -0.425338, -0.42279, -0.420276, -0.417807,
-    -0.415396, -0.413055, -0.410794, -0.408623, -0.406551, -0.404587,
-    -0.402736, -0.401005, -0.399399, -0.397921, -0.396573, -0.395355,
-    -0.394267, -0.393307, -0.392472, -0.391757, -0.391157, -0.390663,
-    -0.390269, -0.389965, -0.389741, -0.389585, -0.389487, -0.389433,
-    -0.38941, -0.389405, -0.389405, -0.389395, -0.389363, -0.389293,
-    -0.389173, -0.38899, -0.388731, -0.388385, -0.387941, -0.387388,
-    -0.386717, -0.385921, -0.384992, -0.383925, -0.382715, -0.381361,
-    -0.379859, -0.37821, -0.376416, -0.374479, -0.372403, -0.370193,
-    -0.367856, -0.365401, -0.362836, -0.360171, -0.357418, -0.354589,
-    -0.351697, -0.348755, -0.345777, -0.342777, -0.33977, -0.336771,
-    -0.333795, -0.330855, -0.327965, -0.32514, -0.322392, -0.319733,
-    -0.317174, -0.314726, -0.312398, -0.310198, -0.308133, -0.306207,
-    -0.304425, -0.302789, -0.3013, -0.299957, -0.298759, -0.297702,
-    -0.296781, -0.295989, -0.295318, -0.29476, -0.294304, -0.293939,
-    -0.293652, -0.29343, -0.293259, -0.293124, -0.29301, -0.292902,
-    -0.292783, -0.292639, -0.292454, -0.292211, -0.291898, -0.291499,
-    -0.291, -0.29039, -0.289657, -0.28879, -0.287779, -0.286618,
-    -0.285298, -0.283816, -0.282168, -0.280352, -0.278367, -0.276215,
-    -0.273899, -0.271424, -0.268794, -0.266018, -0.263106, -0.260066,
-    -0.256911, -0.253654, -0.250308, -0.246888, -0.24341, -0.239889,
-    -0.236342, -0.232785, -0.229236, -0.225711, -0.222227, -0.218801,
-    -0.215447, -0.212181, -0.209016, -0.205967, -0.203045, -0.200261,
-    -0.197624, -0.195141, -0.19282, -0.190665, -0.18868, -0.186864,
-    -0.185219, -0.183741, -0.182426, -0.18127, -0.180265, -0.179401,
-    -0.178669, -0.178057, -0.177551, -0.177137, -0.176799, -0.176522,
-    -0.176288, -0.17608, -0.175879, -0.175668, -0.175427, -0.175139,
-    -0.174786, -0.17435, -0.173814, -0.173163, -0.172382, -0.171456,
-    -0.170374, -0.169123, -0.167696, -0.166082, -0.164278, -0.162277,
-    -0.160078, -0.15768, -0.155084, -0.152294, -0.149313, -0.146151,
-    -0.142814, -0.139314, -0.135662, -0.131873, -0.127961, -0.123941,
-    -0.119833, -0.115653, -0.111421, -0.107156, -0.102878, -0.0986068,
-    -0.0943634, -0.0901671, -0.0860374, -0.0819931, -0.0780523, -0.0742321,
-    -0.0705483, -0.0670155, -0.0636469, -0.0604539, -0.0574462, -0.0546318,
-    -0.0520165, -0.0496044, -0.0473974, -0.0453951, -0.0435953, -0.0419936,
-    -0.0405834, -0.0393562, -0.0383016, -0.0374071, -0.0366589, -0.0360411,
-    -0.0355365, -0.0351267, -0.0347921, -0.0345119, -0.0342649, -0.0340291,
-    -0.0337823, -0.0335021, -0.0331662, -0.0327527, -0.03224, -0.0316075,
-    -0.0308356, -0.0299056, -0.0288003, -0.0275042, -0.0260032, -0.0242852,
-    -0.0223402, -0.0201601, -0.0177392, -0.0150738, -0.0121627, -0.00900718,
-    -0.00561061, -0.00197885, 0.00187995, 0.00595544, 0.0102351, 0.0147043,
-    0.0193466, 0.0241438, 0.0290759, 0.0341218, 0.0392589, 0.0444637,
-    0.0497119, 0.0549787, 0.0602391, 0.0654677, 0.0706397, 0.0757304,
-    0.0807161, 0.0855737, 0.0902815, 0.0948191, 0.0991678, 0.10331,
-    0.107232, 0.11092, 0.114364, 0.117555, 0.120489, 0.123161,
-    0.125572, 0.127724, 0.129622, 0.131273, 0.132689, 0.133881,
-    0.134865, 0.135659, 0.136282, 0.136756, 0.137104, 0.137351,
-    0.137524, 0.137649, 0.137756, 0.137872, 0.138027, 0.138249,
-    0.138568, 0.139012, 0.139607, 0.14038, 0.141355, 0.142556,
-    0.144003, 0.145715, 0.14771, 0.150001, 0.152599, 0.155513,
-    0.158749, 0.162308, 0.166191, 0.170394, 0.17491, 0.179728,
-    0.184837, 0.19022, 0.195859, 0.201733, 0.207817, 0.214086,
-    0.220511, 0.227064, 0.233712, 0.240423, 0.247165, 0.253902,
-    0.260602, 0.267229, 0.27375, 0.280133, 0.286345, 0.292355,
-    0.298137, 0.303662, 0.308906, 0.313848, 0.318469, 0.322753,
-    0.326688, 0.330264, 0.333476, 0.336321, 0.338802, 0.340924,
-    0.342697, 0.344132, 0.345247, 0.346062, 0.3466, 0.346888,
-    0.346955, 0.346833, 0.346558, 0.346164, 0.345692, 0.345181,
-    0.344672, 0.344206, 0.343826, 0.343573, 0.343489, 0.343613,
-    0.343984, 0.344641, 0.345617, 0.346946, 0.348656, 0.350774,
-    0.353323, 0.356323, 0.359787, 0.363727, 0.368149, 0.373055,
-    0.378443, 0.384304, 0.390626, 0.397393, 0.404584, 0.412172,
-    0.420127, 0.428416, 0.437, 0.445838, 0.454886, 0.464097,
-    0.473421, 0.482807, 0.492202, 0.501553, 0.510805, 0.519904,
-    0.528797, 0.537431, 0.545757, 0.553724, 0.561288, 0.568405,
-    0.575038, 0.58115, 0.586712, 0.591698, 0.596088, 0.599868,
-    0.603027, 0.605565, 0.607483, 0.608791, 0.609506, 0.609649,
-    0.609249, 0.60834, 0.606964, 0.605165, 0.602995, 0.600512,
-    0.597775, 0.594851, 0.591807, 0.588716, 0.585652, 0.58269,
-    0.579909, 0.577387, 0.575199, 0.573424, 0.572136, 0.571407,
-    0.571306, 0.571899, 0.573247, 0.575405, 0.578423, 0.582342,
-    0.5872, 0.593024, 0.599834, 0.607642, 0.616448, 0.626248,
-    0.637023, 0.648747, 0.661385, 0.67489, 0.689207, 0.704269,
-    0.720003, 0.736324, 0.75314, 0.770349, 0.787842, 0.805503,
-    0.823209, 0.840831, 0.858236, 0.875286, 0.891838, 0.907749,
-    0.922872, 0.937062, 0.950172, 0.962059, 0.972579, 0.981593,
-    0.988969, 0.994575, 0.998291, 1, 0.999595, 0.996979,
-    0.992063, 0.984768, 0.97503, 0.962793, 0.948014, 0.930665,
-    0.910729, 0.888204, 0.8631, 0.835442, 0.805269, 0.772633,
-    0.737598, 0.700245, 0.660666, 0.618963, 0.575254, 0.529665,
-    0.482336, 0.433413, 0.383053, 0.331421, 0.27869, 0.225036,
-    0.170644, 0.1157
-};
-
-static const float WAVE_EXPONENTIAL_090[DEFAULT_WAVELEN] = {
-    0.114019, 0.085264, 0.0564473, 0.027596, -0.00126311, -0.0301032,
-    -0.0588977, -0.08762, -0.116244, -0.144743, -0.173091, -0.201263,
-    -0.229234, -0.256978, -0.284471, -0.311689, -0.338607, -0.365204,
-    -0.391456, -0.417342, -0.44284, -0.467928, -0.492588, -0.516799,
-    -0.540544, -0.563803, -0.586561, -0.6088, -0.630504, -0.65166,
-    -0.672254, -0.692272, -0.711702, -0.730534, -0.748757, -0.766361,
-    -0.783338, -0.799682, -0.815384, -0.830441, -0.844847, -0.858598,
-    -0.871693, -0.884129, -0.895905, -0.907023, -0.917482, -0.927285,
-    -0.936436, -0.944937, -0.952794, -0.960012, -0.966599, -0.97256,
-    -0.977906, -0.982643, -0.986783, -0.990336, -0.993313, -0.995726,
-    -0.997587, -0.998911, -0.99971, -1, -0.999795, -0.999112,
-    -0.997965, -0.996373, -0.994351, -0.991917, -0.98909, -0.985886,
-    -0.982325, -0.978424, -0.974204, -0.969682, -0.964878, -0.959812,
-    -0.954503, -0.94897, -0.943232, -0.93731, -0.931222, -0.924988,
-    -0.918626, -0.912156, -0.905597, -0.898966, -0.892283, -0.885566,
-    -0.878831, -0.872097, -0.86538, -0.858696, -0.852063, -0.845495,
-    -0.839008, -0.832617, -0.826335, -0.820176, -0.814154, -0.808281,
-    -0.802569, -0.797029, -0.791672, -0.786507, -0.781546, -0.776795,
-    -0.772263, -0.767959, -0.763887, -0.760056, -0.756469, -0.753132,
-    -0.75005, -0.747224, -0.744659, -0.742355, -0.740316, -0.73854,
-    -0.737029, -0.735782, -0.734798, -0.734075, -0.73361, -0.733401,
-    -0.733444, -0.733736, -0.734271, -0.735044, -0.73605, -0.737283,
-    -0.738736, -0.740403, -0.742275, -0.744345, -0.746605, -0.749047,
-    -0.75166, -0.754438, -0.757369, -0.760445, -0.763655, -0.76699,
-    -0.770439, -0.773992, -0.777638, -0.781368, -0.785169, -0.789033,
-    -0.792947, -0.796902, -0.800886, -0.80489, -0.808902, -0.812912,
-    -0.816911, -0.820888, -0.824833, -0.828736, -0.832589, -0.836381,
-    -0.840105, -0.84375, -0.847309, -0.850774, -0.854137, -0.85739,
-    -0.860527, -0.863541, -0.866425, -0.869174, -0.871782, -0.874243,
-    -0.876555, -0.878711, -0.880708, -0.882544, -0.884214, -0.885717,
-    -0.88705, -0.888212, -0.889201, -0.890017, -0.89066, -0.891129,
-    -0.891425, -0.89155, -0.891504, -0.89129, -0.890909, -0.890365,
-    -0.889659, -0.888797, -0.88778, -0.886614, -0.885303, -0.883851,
-    -0.882263, -0.880545, -0.878703, -0.876742, -0.874668, -0.872487,
-    -0.870207, -0.867833, -0.865373, -0.862834, -0.860222, -0.857546,
-    -0.854812, -0.852027, -0.8492, -0.846338, -0.843448, -0.840538,
-    -0.837616, -0.834689, -0.831764, -0.828849, -0.825951, -0.823077,
-    -0.820234, -0.81743, -0.814671, -0.811963, -0.809314, -0.806728,
-    -0.804213, -0.801773, -0.799416, -0.797144, -0.794965, -0.792882,
-    -0.7909, -0.789024, -0.787256, -0.785601, -0.784061, -0.782641,
-    -0.781342, -0.780166, -0.779116, -0.778194, -0.7774, -0.776735,
-    -0.776201, -0.775797, -0.775524, -0.775381, -0.775367, -0.775481,
-    -0.775723, -0.77609, -0.77658, -0.777192, -0.777923, -0.778769,
-    -0.779729, -0.780798, -0.781973, -0.78325, -0.784625, -0.786094,
-    -0.787652, -0.789295, -0.791017, -0.792815, -0.794682, -0.796613,
-    -0.798604, -0.800647, -0.802738, -0.804871, -0.80704, -0.80924,
-    -0.811464, -0.813706, -0.815961, -0.818223, -0.820485, -0.822743,
-    -0.824989, -0.827219, -0.829427, -0.831607, -0.833753, -0.835862,
-    -0.837926, -0.839942, -0.841904, -0.843807, -0.845648, -0.847421,
-    -0.849123, -0.850749, -0.852296, -0.85376, -0.855138, -0.856427,
-    -0.857624, -0.858727, -0.859733, -0.86064, -0.861446, -0.86215,
-    -0.862751, -0.863248, -0.863639, -0.863925, -0.864105, -0.86418,
-    -0.864149, -0.864014, -0.863774, -0.863433, -0.86299, -0.862447,
-    -0.861807, -0.861071, -0.860242, -0.859322, -0.858314, -0.857222,
-    -0.856048, -0.854795, -0.853468, -0.852069, -0.850604, -0.849075,
-    -0.847488, -0.845846, -0.844153, -0.842415, -0.840636, -0.83882,
-    -0.836972, -0.835098, -0.833202, -0.831288, -0.829362, -0.827429,
-    -0.825494, -0.82356, -0.821634, -0.81972, -0.817823, -0.815947,
-    -0.814098, -0.812279, -0.810494, -0.808749, -0.807048, -0.805394,
-    -0.803791, -0.802243, -0.800754, -0.799327, -0.797965, -0.796672,
-    -0.79545, -0.794302, -0.79323, -0.792237, -0.791325, -0.790496,
-    -0.78975, -0.789091, -0.788518, -0.788033, -0.787636, -0.787328,
-    -0.78711, -0.786981, -0.786941, -0.78699, -0.787127, -0.787351,
-    -0.787661, -0.788056, -0.788535, -0.789095, -0.789735, -0.790453,
-    -0.791246, -0.792111, -0.793048, -0.794051, -0.79512, -0.796249,
-    -0.797437, -0.79868, -0.799973, -0.801315, -0.8027, -0.804125,
-    -0.805587, -0.807081, -0.808602, -0.810148, -0.811714, -0.813295,
-    -0.814888, -0.816487, -0.81809, -0.819692, -0.821289, -0.822875,
-    -0.824449, -0.826004, -0.827538, -0.829046, -0.830525, -0.83197,
-    -0.833379, -0.834747, -0.836071, -0.837348, -0.838575, -0.839748,
-    -0.840866, -0.841924, -0.84292, -0.843853, -0.844719, -0.845517,
-    -0.846245, -0.846901, -0.847484, -0.847993, -0.848425, -0.848781,
-    -0.84906, -0.84926, -0.849383, -0.849427, -0.849393, -0.849281,
-    -0.849092, -0.848825, -0.848483, -0.848066, -0.847575, -0.847012,
-    -0.846379, -0.845676, -0.844907, -0.844073, -0.843176, -0.842219,
-    -0.841204, -0.840135, -0.839014, -0.837843, -0.836626, -0.835367,
-    -0.834067, -0.832732, -0.831363, -0.829965, -0.828541, -0.827095,
-    -0.825631, -0.824151, -0.822661, -0.821162, -0.819661, -0.818159,
-    -0.816661, -0.81517, -0.813691, -0.812226, -0.810779, -0.809354,
-    -0.807955, -0.806584, -0.805245, -0.80394, -0.802675, -0.80145,
-    -0.800269, -0.799135, -0.79805, -0.797017, -0.796039, -0.795116,
-    -0.794252, -0.793448, -0.792707, -0.792029, -0.791416, -0.790869,
-    -0.790389, -0.789977, -0.789635, -0.789361, -0.789157, -0.789023,
-    -0.788959, -0.788965, -0.78904, -0.789183, -0.789395, -0.789674,
-    -0.790018, -0.790428, -0.790901, -0.791436, -0.792031, -0.792685,
-    -0.793394, -0.794159, -0.794975, -0.79584, -0.796753, -0.797711,
-    -0.79871, -0.799748, -0.800822, -0.801929, -0.803066, -0.80423,
-    -0.805417, -0.806625, -0.80785, -0.809089, -0.810338, -0.811595,
-    -0.812855, -0.814115, -0.815372, -0.816623, -0.817864, -0.819091,
-    -0.820303, -0.821495, -0.822665, -0.823809, -0.824924, -0.826007,
-    -0.827056, -0.828068, -0.82904, -0.829969, -0.830854, -0.831692,
-    -0.832481, -0.833218, -0.833902, -0.834531, -0.835104, -0.835618,
-    -0.836074, -0.836469, -0.836802, -0.837073, -0.837281, -0.837426,
-    -0.837507, -0.837523, -0.837476, -0.837364, -0.837189, -0.83695,
-    -0.836649, -0.836286, -0.835862, -0.835378, -0.834836, -0.834236,
-    -0.833581, -0.832871, -0.832109, -0.831297, -0.830436, -0.829529,
-    -0.828578, -0.827586, -0.826555, -0.825486, -0.824385, -0.823251,
-    -0.82209, -0.820903, -0.819693, -0.818464, -0.817219, -0.815959,
-    -0.81469, -0.813413, -0.812131, -0.810849, -0.809568, -0.808293,
-    -0.807026, -0.80577, -0.804528, -0.803303, -0.802098, -0.800916,
-    -0.79976, -0.798632, -0.797535, -0.796472, -0.795445, -0.794456,
-    -0.793508, -0.792603, -0.791742, -0.790928, -0.790163, -0.789448,
-    -0.788784, -0.788174, -0.787618, -0.787118, -0.786674, -0.786287,
-    -0.785958, -0.785688, -0.785476, -0.785323, -0.78523, -0.785195,
-    -0.78522, -0.785302, -0.785443, -0.785641, -0.785895, -0.786204,
-    -0.786568, -0.786985, -0.787453, -0.787971, -0.788539, -0.789152,
-    -0.789811, -0.790513, -0.791255, -0.792036, -0.792854, -0.793705,
-    -0.794588, -0.7955, -0.796438, -0.7974, -0.798384, -0.799385,
-    -0.800402, -0.801431, -0.80247, -0.803516, -0.804566, -0.805617,
-    -0.806667, -0.807711, -0.808748, -0.809774, -0.810787, -0.811784,
-    -0.812762, -0.813718, -0.814651, -0.815557, -0.816433, -0.817278,
-    -0.818089, -0.818864, -0.819601, -0.820297, -0.820951, -0.821561,
-    -0.822125, -0.822642, -0.82311, -0.823528, -0.823894, -0.824208,
-    -0.824469, -0.824675, -0.824827, -0.824923, -0.824963, -0.824948,
-    -0.824876, -0.824748, -0.824565, -0.824326, -0.824032, -0.823683,
-    -0.823281, -0.822826, -0.822319, -0.821761, -0.821154, -0.820499,
-    -0.819798, -0.819051, -0.818262, -0.817431, -0.816561, -0.815654,
-    -0.814711, -0.813736, -0.81273, -0.811695, -0.810635, -0.809551,
-    -0.808447, -0.807325, -0.806187, -0.805036, -0.803875, -0.802707,
-    -0.801533, -0.800359, -0.799184, -0.798014, -0.79685, -0.795694,
-    -0.794551, -0.793422, -0.792309, -0.791217, -0.790146, -0.789099,
-    -0.78808, -0.787089, -0.78613, -0.785204, -0.784314, -0.783461,
-    -0.782648, -0.781875, -0.781146, -0.78046, -0.77982, -0.779228,
-    -0.778683, -0.778187, -0.777741, -0.777347, -0.777003, -0.776712,
-    -0.776474, -0.776287, -0.776154, -0.776074, -0.776046, -0.77607,
-    -0.776147, -0.776274, -0.776453, -0.776681, -0.776958, -0.777283,
-    -0.777655, -0.778072, -0.778533, -0.779037, -0.779581, -0.780164,
-    -0.780784, -0.78144, -0.782129, -0.782849, -0.783598, -0.784373,
-    -0.785173, -0.785995, -0.786836, -0.787695, -0.788568, -0.789453,
-    -0.790347, -0.791248, -0.792153, -0.79306, -0.793965, -0.794867,
-    -0.795763, -0.796649, -0.797524, -0.798385, -0.799229, -0.800054,
-    -0.800858, -0.801638, -0.802392, -0.803117, -0.803812, -0.804474,
-    -0.805102, -0.805694, -0.806247, -0.80676, -0.807232, -0.80766,
-    -0.808045, -0.808383, -0.808675, -0.808919, -0.809114, -0.80926,
-    -0.809355, -0.8094, -0.809393, -0.809335, -0.809226, -0.809065,
-    -0.808852, -0.808588, -0.808274, -0.807909, -0.807494, -0.807031,
-    -0.806519, -0.805961, -0.805356, -0.804707, -0.804015, -0.80328,
-    -0.802506, -0.801693, -0.800842, -0.799957, -0.799039, -0.798089,
-    -0.797111, -0.796106, -0.795076, -0.794024, -0.792952, -0.791862,
-    -0.790757, -0.78964, -0.788512, -0.787376, -0.786236, -0.785093,
-    -0.78395, -0.782809, -0.781673, -0.780545, -0.779427, -0.778322,
-    -0.777231, -0.776158, -0.775104, -0.774073, -0.773065, -0.772084,
-    -0.771132, -0.77021, -0.76932, -0.768465, -0.767645, -0.766864,
-    -0.766121, -0.76542, -0.76476, -0.764144, -0.763572, -0.763046,
-    -0.762566, -0.762134, -0.761749, -0.761413, -0.761125, -0.760886,
-    -0.760697, -0.760557, -0.760466, -0.760424, -0.760431, -0.760486,
-    -0.760588, -0.760738, -0.760933, -0.761173, -0.761457, -0.761784,
-    -0.762152, -0.762561, -0.763007, -0.763491, -0.76401, -0.764563,
-    -0.765147, -0.765761, -0.766402, -0.767069, -0.767759, -0.76847,
-    -0.7692, -0.769947, -0.770707, -0.77148, -0.772261, -0.77305,
-    -0.773843, -0.774637, -0.775431, -0.776222, -0.777007, -0.777784,
-    -0.778551, -0.779304, -0.780043, -0.780763, -0.781464, -0.782142,
-    -0.782796, -0.783423, -0.784022, -0.784589, -0.785125, -0.785626,
-    -0.786091, -0.786518, -0.786905, -0.787252, -0.787557, -0.787818,
-    -0.788035, -0.788206, -0.788331, -0.788408, -0.788437, -0.788418,
-    -0.78835, -0.788233, -0.788066, -0.78785, -0.787584, -0.787269,
-    -0.786905, -0.786493, -0.786033, -0.785526, -0.784972, -0.784372,
-    -0.783729, -0.783042, -0.782312, -0.781543, -0.780734, -0.779887,
-    -0.779004, -0.778087, -0.777137, -0.776157, -0.775148, -0.774113,
-    -0.773053, -0.771972, -0.77087, -0.76975, -0.768615, -0.767467,
-    -0.766309, -0.765142, -0.763969, -0.762794, -0.761617, -0.760442,
-    -0.759271, -0.758106, -0.756951, -0.755806, -0.754675, -0.753561,
-    -0.752464, -0.751388, -0.750335, -0.749306, -0.748305, -0.747332,
-    -0.74639, -0.74548, -0.744605, -0.743765, -0.742963, -0.7422,
-    -0.741478, -0.740797, -0.740158, -0.739563, -0.739013, -0.738509,
-    -0.73805, -0.737638, -0.737274, -0.736957, -0.736687, -0.736465,
-    -0.736291, -0.736164, -0.736085, -0.736052, -0.736066, -0.736125,
-    -0.736229, -0.736377, -0.736567, -0.7368, -0.737073, -0.737385,
-    -0.737735, -0.738122, -0.738543, -0.738996, -0.739481, -0.739995,
-    -0.740537, -0.741103, -0.741693, -0.742303, -0.742932, -0.743578,
-    -0.744238, -0.74491, -0.745591, -0.746279, -0.746971, -0.747666,
-    -0.74836, -0.749052, -0.749738, -0.750417, -0.751086, -0.751742,
-    -0.752383, -0.753008, -0.753613, -0.754196, -0.754755, -0.755288,
-    -0.755794, -0.756269, -0.756712, -0.757122, -0.757495, -0.757832,
-    -0.75813, -0.758388, -0.758604, -0.758777, -0.758906, -0.758989,
-    -0.759027, -0.759018, -0.758961, -0.758856, -0.758702, -0.7585,
-    -0.758248, -0.757946, -0.757596, -0.757196, -0.756747, -0.75625,
-    -0.755705, -0.755112, -0.754473, -0.753788, -0.753058, -0.752285,
-    -0.751469, -0.750612, -0.749715, -0.748781, -0.747809, -0.746803,
-    -0.745764, -0.744693, -0.743593, -0.742466, -0.741314, -0.740139,
-    -0.738943, -0.737728, -0.736497, -0.735253, -0.733997, -0.732731,
-    -0.73146, -0.730184, -0.728906, -0.727629, -0.726355, -0.725087,
-    -0.723826, -0.722577, -0.72134, -0.720118, -0.718913, -0.717729,
-    -0.716566, -0.715427, -0.714315, -0.713231, -0.712176, -0.711154,
-    -0.710166, -0.709213, -0.708296, -0.707419, -0.706581, -0.705785,
-    -0.705031, -0.70432, -0.703654, -0.703034, -0.702459, -0.701931,
-    -0.70145, -0.701017, -0.700631, -0.700293, -0.700003, -0.699761,
-    -0.699566, -0.699418, -0.699317, -0.699262, -0.699252, -0.699286,
-    -0.699363, -0.699483, -0.699644, -0.699845, -0.700084, -0.700359,
-    -0.70067, -0.701015, -0.70139, -0.701796, -0.70223, -0.702689,
-    -0.703172, -0.703676, -0.7042, -0.70474, -0.705295, -0.705862,
-    -0.706439, -0.707024, -0.707613, -0.708205, -0.708796, -0.709385,
-    -0.709969, -0.710545, -0.711112, -0.711666, -0.712204, -0.712726,
-    -0.713228, -0.713708, -0.714163, -0.714593, -0.714993, -0.715364,
-    -0.715701, -0.716004, -0.716271, -0.716499, -0.716688, -0.716835,
-    -0.71694, -0.717001, -0.717016, -0.716985, -0.716906, -0.716779,
-    -0.716603, -0.716377, -0.716101, -0.715774, -0.715396, -0.714967,
-    -0.714487, -0.713956, -0.713374, -0.712742, -0.712059, -0.711328,
-    -0.710547, -0.709719, -0.708844, -0.707923, -0.706958, -0.70595,
-    -0.7049, -0.70381, -0.702681, -0.701515, -0.700314, -0.69908,
-    -0.697815, -0.696521, -0.6952, -0.693854, -0.692485, -0.691097,
-    -0.68969, -0.688268, -0.686834, -0.685389, -0.683936, -0.682477,
-    -0.681016, -0.679555, -0.678095, -0.676641, -0.675194, -0.673757,
-    -0.672332, -0.670921, -0.669528, -0.668155, -0.666803, -0.665476,
-    -0.664175, -0.662902, -0.66166, -0.66045, -0.659275, -0.658135,
-    -0.657034, -0.655972, -0.65495, -0.653972, -0.653036, -0.652146,
-    -0.651301, -0.650503, -0.649753, -0.649051, -0.648398, -0.647794,
-    -0.647239, -0.646734, -0.646279, -0.645874, -0.645518, -0.645211,
-    -0.644953, -0.644742, -0.644579, -0.644462, -0.644391, -0.644363,
-    -0.644379, -0.644437, -0.644534, -0.644671, -0.644844, -0.645053,
-    -0.645295, -0.645568, -0.645871, -0.646201, -0.646556, -0.646933,
-    -0.647331, -0.647748, -0.648179, -0.648624, -0.649079, -0.649542,
-    -0.650011, -0.650482, -0.650953, -0.651422, -0.651886, -0.652341,
-    -0.652786, -0.653219, -0.653635, -0.654033, -0.654411, -0.654765,
-    -0.655093, -0.655394, -0.655664, -0.655902, -0.656105, -0.656272,
-    -0.6564, -0.656487, -0.656531, -0.656532, -0.656487, -0.656395,
-    -0.656255, -0.656064, -0.655823, -0.65553, -0.655184, -0.654785,
-    -0.654332, -0.653824, -0.653261, -0.652643, -0.651969, -0.651241,
-    -0.650457, -0.649619, -0.648727, -0.647781, -0.646783, -0.645732,
-    -0.644631, -0.643479, -0.642279, -0.641032, -0.639739, -0.638402,
-    -0.637022, -0.635602, -0.634143, -0.632647, -0.631117, -0.629554,
-    -0.627961, -0.626341, -0.624695, -0.623026, -0.621336, -0.619629,
-    -0.617907, -0.616172, -0.614428, -0.612676, -0.61092, -0.609163,
-    -0.607407, -0.605654, -0.603909, -0.602173, -0.600449, -0.598739,
-    -0.597047, -0.595375, -0.593726, -0.592102, -0.590504, -0.588937,
-    -0.587402, -0.5859, -0.584435, -0.583008, -0.581622, -0.580277,
-    -0.578976, -0.577719, -0.57651, -0.575348, -0.574235, -0.573172,
-    -0.572161, -0.571201, -0.570294, -0.56944, -0.568639, -0.567892,
-    -0.567199, -0.566559, -0.565973, -0.56544, -0.56496, -0.564532,
-    -0.564155, -0.563829, -0.563552, -0.563323, -0.563142, -0.563006,
-    -0.562913, -0.562864, -0.562854, -0.562883, -0.562949, -0.56305,
-    -0.563182, -0.563345, -0.563535, -0.56375, -0.563988, -0.564246,
-    -0.564521, -0.56481, -0.565112, -0.565422, -0.565738, -0.566057,
-    -0.566377, -0.566694, -0.567005, -0.567308, -0.567599, -0.567876,
-    -0.568136, -0.568376, -0.568593, -0.568784, -0.568947, -0.569079,
-    -0.569177, -0.56924, -0.569264, -0.569247, -0.569187, -0.569082,
-    -0.568929, -0.568728, -0.568475, -0.56817, -0.56781, -0.567395,
-    -0.566923, -0.566392, -0.565803, -0.565153, -0.564442, -0.56367,
-    -0.562836, -0.56194, -0.560981, -0.55996, -0.558876, -0.557731,
-    -0.556524, -0.555256, -0.553929, -0.552542, -0.551096, -0.549594,
-    -0.548036, -0.546424, -0.54476, -0.543045, -0.54128, -0.539469,
-    -0.537613, -0.535714, -0.533775, -0.531798, -0.529785, -0.52774,
-    -0.525665, -0.523562, -0.521435, -0.519286, -0.517119, -0.514936,
-    -0.51274, -0.510535, -0.508324, -0.506109, -0.503893, -0.501681,
-    -0.499475, -0.497278, -0.495093, -0.492923, -0.490771, -0.488641,
-    -0.486535, -0.484455, -0.482405, -0.480388, -0.478405, -0.47646,
-    -0.474555, -0.472692, -0.470874, -0.469102, -0.467378, -0.465705,
-    -0.464084, -0.462516, -0.461004, -0.459547, -0.458148, -0.456808,
-    -0.455527, -0.454305, -0.453144, -0.452044, -0.451005, -0.450027,
-    -0.449109, -0.448253, -0.447456, -0.446718, -0.44604, -0.445419,
-    -0.444854, -0.444345, -0.443889, -0.443486, -0.443134, -0.44283,
-    -0.442573, -0.44236, -0.44219, -0.44206, -0.441967, -0.441909,
-    -0.441882, -0.441885, -0.441915, -0.441967, -0.44204, -0.44213,
-    -0.442234, -0.442349, -0.44247, -0.442596, -0.442722, -0.442846,
-    -0.442963, -0.443071, -0.443165, -0.443244, -0.443302, -0.443337,
-    -0.443346, -0.443325, -0.443271, -0.443181, -0.443052, -0.442881,
-    -0.442664, -0.442401, -0.442086, -0.441719, -0.441296, -0.440815,
-    -0.440275, -0.439672, -0.439005, -0.438272, -0.437472, -0.436603,
-    -0.435664, -0.434653, -0.43357, -0.432414, -0.431184, -0.429879,
-    -0.4285, -0.427047, -0.425519, -0.423917, -0.422241, -0.420491,
-    -0.418669, -0.416776, -0.414813, -0.41278, -0.41068, -0.408514,
-    -0.406285, -0.403993, -0.401641, -0.399232, -0.396768, -0.394251,
-    -0.391684, -0.38907, -0.386412, -0.383712, -0.380975, -0.378204,
-    -0.375401, -0.37257, -0.369715, -0.366839, -0.363946, -0.361039,
-    -0.358122, -0.3552, -0.352275, -0.349351, -0.346433, -0.343523,
-    -0.340626, -0.337746, -0.334885, -0.332048, -0.329238, -0.326458,
-    -0.323713, -0.321004, -0.318337, -0.315712, -0.313135, -0.310607,
-    -0.308131, -0.305709, -0.303346, -0.301042, -0.298799, -0.296621,
-    -0.294508, -0.292462, -0.290486, -0.288579, -0.286744, -0.284981,
-    -0.283291, -0.281674, -0.280132, -0.278663, -0.277268, -0.275947,
-    -0.274699, -0.273524, -0.27242, -0.271387, -0.270423, -0.269528,
-    -0.268699, -0.267934, -0.267231, -0.266589, -0.266005, -0.265476,
-    -0.265, -0.264574, -0.264194, -0.263858, -0.263562, -0.263303,
-    -0.263078, -0.262882, -0.262712, -0.262564, -0.262434, -0.262318,
-    -0.262212, -0.262112, -0.262013, -0.261912, -0.261804, -0.261685,
-    -0.26155, -0.261395, -0.261217, -0.26101, -0.260771, -0.260496,
-    -0.260179, -0.259819, -0.259409, -0.258948, -0.25843, -0.257852,
-    -0.257211, -0.256504, -0.255727, -0.254877, -0.253951, -0.252947,
-    -0.251861, -0.250692, -0.249438, -0.248095, -0.246663, -0.24514,
-    -0.243524, -0.241814, -0.24001, -0.23811, -0.236114, -0.234021,
-    -0.231832, -0.229547, -0.227166, -0.22469, -0.222119, -0.219455,
-    -0.2167, -0.213853, -0.210918, -0.207896, -0.20479, -0.201602,
-    -0.198334, -0.194989, -0.19157, -0.188082, -0.184526, -0.180906,
-    -0.177226, -0.173491, -0.169703, -0.165868, -0.161989, -0.158071,
-    -0.154118, -0.150135, -0.146127, -0.142098, -0.138053, -0.133997,
-    -0.129935, -0.125872, -0.121812, -0.117762, -0.113725, -0.109707,
-    -0.105712, -0.101745, -0.0978113, -0.0939154, -0.0900616, -0.0862547,
-    -0.0824989, -0.0787986, -0.0751577, -0.0715804, -0.0680705, -0.0646315,
-    -0.0612671, -0.0579804, -0.0547746, -0.0516526, -0.048617, -0.0456703,
-    -0.0428147, -0.0400522, -0.0373846, -0.0348133, -0.0323397, -0.0299646,
-    -0.0276888, -0.0255128, -0.0234366, -0.0214604, -0.0195836, -0.0178057,
-    -0.0161257, -0.0145424, -0.0130545, -0.0116602, -0.0103574, -0.00914397,
-    -0.00801737, -0.00697482, -0.0060133, -0.00512954, -0.00432003, -0.00358105,
-    -0.00290864, -0.00229863, -0.00174664, -0.00124811, -0.000798269, -0.000392199,
-    -2.48035e-5, 0.000309162, 0.000615083, 0.000898469, 0.00116495, 0.00142024,
-    0.00167016, 0.0019206, 0.00217749, 0.00244683, 0.00273463, 0.00304694,
-    0.00338977, 0.00376915, 0.00419106, 0.00466144, 0.00518618, 0.00577108,
-    0.00642184, 0.00714409, 0.00794329, 0.00882482, 0.00979386, 0.0108555,
-    0.0120145, 0.0132756, 0.0146432, 0.0161217, 0.0177149, 0.0194268,
-    0.0212608, 0.0232202, 0.025308, 0.027527, 0.0298794, 0.0323675,
-    0.0349931, 0.0377577, 0.0406625, 0.0437083, 0.0468956, 0.0502248,
-    0.0536956, 0.0573075, 0.0610598, 0.0649513, 0.0689806, 0.0731457,
-    0.0774445, 0.0818746, 0.086433, 0.0911167, 0.0959222, 0.100846,
-    0.105883, 0.11103, 0.116281, 0.121632, 0.127078, 0.132613,
-    0.138232, 0.143927, 0.149694, 0.155526, 0.161415, 0.167356,
-    0.173341, 0.179363, 0.185415, 0.19149, 0.19758, 0.203677,
-    0.209775, 0.215864, 0.221939, 0.22799, 0.23401, 0.239992,
-    0.245928, 0.25181, 0.257631, 0.263384, 0.269062, 0.274656,
-    0.280161, 0.28557, 0.290877, 0.296074, 0.301156, 0.306117,
-    0.310951, 0.315654, 0.320221, 0.324646, 0.328926, 0.333056,
-    0.337033, 0.340854, 0.344516, 0.348016, 0.351353, 0.354525,
-    0.35753, 0.360369, 0.36304, 0.365544, 0.367881, 0.370053,
-    0.372061, 0.373907, 0.375593, 0.377122, 0.378498, 0.379724,
-    0.380804, 0.381743, 0.382547, 0.38322, 0.383769, 0.384199,
-    0.384519, 0.384733, 0.384852, 0.384881, 0.38483, 0.384706,
-    0.384519, 0.384278, 0.383992, 0.383671, 0.383325, 0.382963,
-    0.382597, 0.382237, 0.381894, 0.381577, 0.381299, 0.38107,
-    0.380901, 0.380803, 0.380787, 0.380865, 0.381047, 0.381344,
-    0.381767, 0.382327, 0.383034, 0.383898, 0.38493, 0.38614,
-    0.387537, 0.389131, 0.39093, 0.392943, 0.395179, 0.397645,
-    0.40035, 0.403299, 0.406501, 0.40996, 0.413682, 0.417674,
-    0.421938, 0.426479, 0.431302, 0.436407, 0.441798, 0.447476,
-    0.453442, 0.459697, 0.466239, 0.473069, 0.480183, 0.487581,
-    0.495257, 0.50321, 0.511434, 0.519923, 0.528673, 0.537676,
-    0.546925, 0.556411, 0.566127, 0.576062, 0.586207, 0.59655,
-    0.607081, 0.617786, 0.628654, 0.63967, 0.650822, 0.662093,
-    0.67347, 0.684936, 0.696475, 0.708071, 0.719706, 0.731363,
-    0.743023, 0.754668, 0.76628, 0.777838, 0.789324, 0.800717,
-    0.811998, 0.823147, 0.834142, 0.844964, 0.855591, 0.866003,
-    0.876179, 0.886099, 0.89574, 0.905083, 0.914108, 0.922792,
-    0.931117, 0.939061, 0.946606, 0.953731, 0.960417, 0.966646,
-    0.972398, 0.977656, 0.982402, 0.986619, 0.99029, 0.9934,
-    0.995932, 0.997872, 0.999205, 0.999919, 1, 0.999436,
-    0.998217, 0.996331, 0.993769, 0.990521, 0.986581, 0.981941,
-    0.976594, 0.970535, 0.96376, 0.956265, 0.948048, 0.939107,
-    0.929442, 0.919053, 0.907941, 0.896108, 0.883558, 0.870296,
-    0.856325, 0.841654, 0.826288, 0.810236, 0.793507, 0.776111,
-    0.75806, 0.739364, 0.720038, 0.700094, 0.679548, 0.658414,
-    0.636709, 0.614451, 0.591656, 0.568345, 0.544535, 0.520247,
-    0.495502, 0.470321, 0.444727, 0.418742, 0.392388, 0.36569,
-    0.338672, 0.311358, 0.283774, 0.255944, 0.227894, 0.199651,
-    0.171239, 0.142687
-};
-
-static const float WAVE_EXPONENTIAL_102[DEFAULT_WAVELEN] = {
-    0.206113, 0.190942, 0.175728, 0.160476, 0.145189, 0.129872,
-    0.114528, 0.0991625, 0.0837783, 0.0683797, 0.0529709, 0.0375558,
-    0.0221385, 0.00672297, -0.00868673, -0.0240866, -0.0394727, -0.054841,
-    -0.0701875, -0.0855083, -0.100799, -0.116057, -0.131277, -0.146456,
-    -0.16159, -0.176674, -0.191706, -0.206682, -0.221597, -0.236448,
-    -0.251231, -0.265943, -0.28058, -0.295138, -0.309615, -0.324006,
-    -0.338308, -0.352517, -0.366631, -0.380646, -0.394558, -0.408365,
-    -0.422063, -0.435649, -0.449121, -0.462474, -0.475706, -0.488815,
-    -0.501797, -0.514649, -0.527369, -0.539954, -0.552401, -0.564709,
-    -0.576874, -0.588893, -0.600765, -0.612488, -0.624058, -0.635475,
-    -0.646734, -0.657836, -0.668777, -0.679556, -0.690171, -0.70062,
-    -0.710902, -0.721014, -0.730955, -0.740725, -0.75032, -0.759741,
-    -0.768985, -0.778052, -0.78694, -0.795649, -0.804176, -0.812523,
-    -0.820687, -0.828668, -0.836464, -0.844077, -0.851505, -0.858747,
-    -0.865803, -0.872673, -0.879357, -0.885854, -0.892165, -0.898289,
-    -0.904226, -0.909977, -0.915542, -0.920921, -0.926114, -0.931121,
-    -0.935944, -0.940583, -0.945038, -0.94931, -0.9534, -0.957309,
-    -0.961037, -0.964586, -0.967956, -0.971149, -0.974166, -0.977007,
-    -0.979675, -0.982171, -0.984495, -0.98665, -0.988637, -0.990457,
-    -0.992113, -0.993605, -0.994936, -0.996108, -0.997122, -0.997979,
-    -0.998683, -0.999235, -0.999637, -0.999891, -1, -0.999965,
-    -0.999789, -0.999474, -0.999022, -0.998436, -0.997718, -0.99687,
-    -0.995895, -0.994796, -0.993575, -0.992234, -0.990776, -0.989204,
-    -0.98752, -0.985727, -0.983828, -0.981825, -0.979721, -0.977519,
-    -0.975222, -0.972832, -0.970353, -0.967786, -0.965136, -0.962404,
-    -0.959594, -0.956708, -0.953749, -0.950721, -0.947626, -0.944467,
-    -0.941247, -0.937968, -0.934634, -0.931248, -0.927812, -0.924329,
-    -0.920803, -0.917235, -0.913629, -0.909988, -0.906315, -0.902612,
-    -0.898882, -0.895128, -0.891353, -0.887559, -0.883749, -0.879927,
-    -0.876093, -0.872253, -0.868407, -0.864558, -0.86071, -0.856864,
-    -0.853023, -0.849191, -0.845368, -0.841558, -0.837763, -0.833985,
-    -0.830227, -0.826491, -0.822779, -0.819094, -0.815438, -0.811812,
-    -0.808219, -0.804662, -0.801141, -0.797659, -0.794219, -0.790821,
-    -0.787468, -0.784161, -0.780903, -0.777695, -0.774538, -0.771435,
-    -0.768386, -0.765394, -0.762459, -0.759584, -0.75677, -0.754017,
-    -0.751328, -0.748703, -0.746143, -0.743651, -0.741226, -0.738869,
-    -0.736583, -0.734367, -0.732223, -0.730151, -0.728152, -0.726227,
-    -0.724377, -0.722601, -0.720901, -0.719277, -0.717729, -0.716258,
-    -0.714865, -0.713549, -0.71231, -0.71115, -0.710067, -0.709063,
-    -0.708136, -0.707288, -0.706518, -0.705825, -0.705211, -0.704674,
-    -0.704214, -0.703831, -0.703524, -0.703294, -0.70314, -0.70306,
-    -0.703056, -0.703125, -0.703268, -0.703484, -0.703772, -0.704131,
-    -0.704561, -0.70506, -0.705628, -0.706264, -0.706967, -0.707737,
-    -0.708571, -0.709469, -0.71043, -0.711452, -0.712536, -0.713678,
-    -0.714879, -0.716137, -0.71745, -0.718818, -0.720239, -0.721712,
-    -0.723235, -0.724807, -0.726427, -0.728093, -0.729803, -0.731557,
-    -0.733352, -0.735187, -0.737062, -0.738973, -0.74092, -0.742901,
-    -0.744914, -0.746958, -0.749031, -0.751132, -0.753259, -0.755411,
-    -0.757585, -0.75978, -0.761995, -0.764227, -0.766476, -0.768739,
-    -0.771016, -0.773303, -0.7756, -0.777906, -0.780217, -0.782534,
-    -0.784854, -0.787175, -0.789496, -0.791816, -0.794132, -0.796443,
-    -0.798749, -0.801046, -0.803334, -0.805611, -0.807876, -0.810127,
-    -0.812363, -0.814581, -0.816782, -0.818963, -0.821123, -0.823261,
-    -0.825375, -0.827464, -0.829527, -0.831562, -0.833569, -0.835545,
-    -0.83749, -0.839403, -0.841283, -0.843128, -0.844937, -0.846709,
-    -0.848444, -0.85014, -0.851796, -0.853412, -0.854986, -0.856518,
-    -0.858006, -0.859451, -0.860851, -0.862205, -0.863513, -0.864774,
-    -0.865988, -0.867154, -0.868271, -0.869339, -0.870357, -0.871325,
-    -0.872242, -0.873109, -0.873924, -0.874687, -0.875399, -0.876059,
-    -0.876666, -0.877221, -0.877723, -0.878172, -0.878568, -0.878912,
-    -0.879203, -0.879441, -0.879626, -0.879759, -0.879839, -0.879866,
-    -0.879842, -0.879766, -0.879638, -0.879459, -0.879228, -0.878948,
-    -0.878617, -0.878236, -0.877806, -0.877327, -0.8768, -0.876225,
-    -0.875603, -0.874935, -0.87422, -0.873461, -0.872656, -0.871808,
-    -0.870917, -0.869984, -0.869009, -0.867993, -0.866938, -0.865843,
-    -0.86471, -0.863541, -0.862334, -0.861093, -0.859817, -0.858508,
-    -0.857166, -0.855793, -0.85439, -0.852957, -0.851496, -0.850008,
-    -0.848494, -0.846955, -0.845392, -0.843806, -0.842199, -0.840571,
-    -0.838924, -0.837259, -0.835577, -0.833879, -0.832167, -0.830441,
-    -0.828703, -0.826954, -0.825196, -0.823428, -0.821653, -0.819872,
-    -0.818086, -0.816296, -0.814504, -0.812709, -0.810915, -0.809122,
-    -0.80733, -0.805542, -0.803759, -0.801981, -0.800209, -0.798446,
-    -0.796691, -0.794947, -0.793214, -0.791493, -0.789785, -0.788092,
-    -0.786415, -0.784754, -0.783111, -0.781486, -0.779881, -0.778296,
-    -0.776733, -0.775192, -0.773675, -0.772182, -0.770714, -0.769272,
-    -0.767858, -0.76647, -0.765112, -0.763782, -0.762483, -0.761215,
-    -0.759978, -0.758773, -0.757601, -0.756462, -0.755358, -0.754288,
-    -0.753253, -0.752255, -0.751292, -0.750367, -0.749478, -0.748627,
-    -0.747815, -0.747041, -0.746305, -0.745609, -0.744952, -0.744335,
-    -0.743758, -0.743221, -0.742725, -0.742269, -0.741853, -0.741479,
-    -0.741145, -0.740852, -0.7406, -0.740389, -0.740219, -0.74009,
-    -0.740001, -0.739953, -0.739946, -0.739979, -0.740052, -0.740165,
-    -0.740317, -0.740509, -0.74074, -0.74101, -0.741318, -0.741665,
-    -0.742049, -0.74247, -0.742928, -0.743422, -0.743953, -0.744518,
-    -0.745118, -0.745753, -0.746421, -0.747123, -0.747856, -0.748622,
-    -0.749419, -0.750246, -0.751103, -0.751989, -0.752904, -0.753846,
-    -0.754815, -0.75581, -0.75683, -0.757875, -0.758943, -0.760034,
-    -0.761147, -0.762282, -0.763436, -0.76461, -0.765802, -0.767012,
-    -0.768238, -0.76948, -0.770737, -0.772008, -0.773291, -0.774587,
-    -0.775893, -0.77721, -0.778535, -0.779869, -0.78121, -0.782557,
-    -0.783909, -0.785265, -0.786625, -0.787987, -0.78935, -0.790713,
-    -0.792076, -0.793437, -0.794796, -0.796151, -0.797501, -0.798846,
-    -0.800185, -0.801516, -0.802839, -0.804153, -0.805457, -0.80675,
-    -0.808031, -0.809299, -0.810553, -0.811793, -0.813018, -0.814226,
-    -0.815418, -0.816591, -0.817746, -0.818882, -0.819997, -0.821091,
-    -0.822164, -0.823214, -0.824242, -0.825245, -0.826224, -0.827178,
-    -0.828106, -0.829008, -0.829883, -0.83073, -0.831549, -0.83234,
-    -0.833101, -0.833833, -0.834534, -0.835205, -0.835846, -0.836454,
-    -0.837031, -0.837576, -0.838088, -0.838567, -0.839014, -0.839426,
-    -0.839805, -0.840151, -0.840462, -0.840739, -0.840981, -0.841189,
-    -0.841362, -0.8415, -0.841603, -0.841672, -0.841705, -0.841704,
-    -0.841668, -0.841596, -0.84149, -0.84135, -0.841174, -0.840965,
-    -0.840721, -0.840442, -0.84013, -0.839785, -0.839406, -0.838993,
-    -0.838548, -0.838071, -0.837561, -0.837019, -0.836446, -0.835842,
-    -0.835207, -0.834541, -0.833847, -0.833122, -0.832369, -0.831588,
-    -0.830779, -0.829943, -0.82908, -0.828191, -0.827276, -0.826337,
-    -0.825373, -0.824386, -0.823376, -0.822343, -0.821289, -0.820214,
-    -0.819119, -0.818004, -0.816871, -0.815719, -0.81455, -0.813365,
-    -0.812164, -0.810948, -0.809718, -0.808475, -0.807219, -0.805951,
-    -0.804673, -0.803384, -0.802086, -0.800779, -0.799465, -0.798144,
-    -0.796818, -0.795486, -0.79415, -0.79281, -0.791468, -0.790124,
-    -0.788779, -0.787434, -0.786091, -0.784748, -0.783408, -0.782072,
-    -0.78074, -0.779412, -0.778091, -0.776776, -0.775469, -0.774169,
-    -0.772879, -0.771599, -0.770329, -0.769071, -0.767824, -0.766591,
-    -0.765371, -0.764166, -0.762975, -0.761801, -0.760643, -0.759502,
-    -0.758379, -0.757274, -0.756188, -0.755123, -0.754077, -0.753053,
-    -0.75205, -0.751069, -0.750111, -0.749176, -0.748265, -0.747378,
-    -0.746516, -0.745679, -0.744868, -0.744083, -0.743324, -0.742592,
-    -0.741888, -0.741211, -0.740562, -0.739941, -0.739349, -0.738785,
-    -0.738251, -0.737746, -0.737271, -0.736826, -0.73641, -0.736025,
-    -0.735669, -0.735344, -0.73505, -0.734786, -0.734553, -0.73435,
-    -0.734178, -0.734036, -0.733925, -0.733845, -0.733795, -0.733775,
-    -0.733785, -0.733826, -0.733897, -0.733997, -0.734127, -0.734286,
-    -0.734475, -0.734692, -0.734938, -0.735213, -0.735515, -0.735845,
-    -0.736202, -0.736587, -0.736998, -0.737435, -0.737898, -0.738386,
-    -0.738899, -0.739437, -0.739998, -0.740583, -0.741191, -0.741821,
-    -0.742473, -0.743146, -0.74384, -0.744554, -0.745288, -0.746041,
-    -0.746812, -0.7476, -0.748406, -0.749227, -0.750065, -0.750918,
-    -0.751784, -0.752665, -0.753558, -0.754464, -0.755381, -0.756309,
-    -0.757247, -0.758194, -0.75915, -0.760113, -0.761083, -0.76206,
-    -0.763042, -0.764029, -0.76502, -0.766014, -0.767011, -0.768009,
-    -0.769008, -0.770007, -0.771005, -0.772002, -0.772997, -0.773989,
-    -0.774977, -0.77596, -0.776938, -0.77791, -0.778876, -0.779833,
-    -0.780783, -0.781723, -0.782654, -0.783574, -0.784483, -0.78538,
-    -0.786265, -0.787136, -0.787994, -0.788837, -0.789664, -0.790476,
-    -0.791271, -0.792048, -0.792808, -0.79355, -0.794272, -0.794975,
-    -0.795658, -0.796321, -0.796962, -0.797581, -0.798178, -0.798752,
-    -0.799303, -0.79983, -0.800334, -0.800812, -0.801266, -0.801695,
-    -0.802097, -0.802474, -0.802824, -0.803148, -0.803444, -0.803713,
-    -0.803955, -0.804168, -0.804354, -0.804511, -0.80464, -0.80474,
-    -0.804811, -0.804853, -0.804866, -0.80485, -0.804805, -0.80473,
-    -0.804626, -0.804493, -0.80433, -0.804138, -0.803916, -0.803666,
-    -0.803386, -0.803077, -0.802738, -0.802371, -0.801976, -0.801551,
-    -0.801099, -0.800618, -0.800109, -0.799573, -0.799009, -0.798418,
-    -0.797801, -0.797156, -0.796486, -0.79579, -0.795068, -0.794321,
-    -0.793549, -0.792754, -0.791934, -0.791091, -0.790225, -0.789336,
-    -0.788426, -0.787494, -0.786541, -0.785568, -0.784574, -0.783562,
-    -0.782531, -0.781481, -0.780414, -0.77933, -0.77823, -0.777114,
-    -0.775982, -0.774837, -0.773677, -0.772505, -0.771319, -0.770123,
-    -0.768914, -0.767696, -0.766468, -0.765231, -0.763985, -0.762732,
-    -0.761472, -0.760205, -0.758934, -0.757657, -0.756377, -0.755093,
-    -0.753807, -0.752519, -0.751229, -0.74994, -0.748651, -0.747363,
-    -0.746077, -0.744793, -0.743513, -0.742237, -0.740965, -0.739699,
-    -0.738439, -0.737186, -0.735941, -0.734704, -0.733476, -0.732257,
-    -0.731049, -0.729852, -0.728666, -0.727493, -0.726332, -0.725186,
-    -0.724053, -0.722935, -0.721833, -0.720746, -0.719676, -0.718623,
-    -0.717588, -0.716571, -0.715573, -0.714594, -0.713635, -0.712696,
-    -0.711777, -0.71088, -0.710005, -0.709151, -0.70832, -0.707512,
-    -0.706727, -0.705966, -0.705229, -0.704516, -0.703827, -0.703164,
-    -0.702525, -0.701912, -0.701325, -0.700763, -0.700228, -0.699719,
-    -0.699237, -0.698781, -0.698352, -0.697949, -0.697574, -0.697226,
-    -0.696905, -0.696611, -0.696344, -0.696105, -0.695892, -0.695707,
-    -0.695549, -0.695418, -0.695314, -0.695237, -0.695186, -0.695162,
-    -0.695164, -0.695193, -0.695247, -0.695328, -0.695434, -0.695565,
-    -0.695721, -0.695902, -0.696108, -0.696337, -0.696591, -0.696867,
-    -0.697167, -0.69749, -0.697835, -0.698201, -0.698589, -0.698998,
-    -0.699428, -0.699878, -0.700347, -0.700835, -0.701341, -0.701866,
-    -0.702408, -0.702967, -0.703542, -0.704133, -0.704739, -0.70536,
-    -0.705995, -0.706642, -0.707303, -0.707976, -0.70866, -0.709354,
-    -0.710059, -0.710773, -0.711496, -0.712227, -0.712965, -0.71371,
-    -0.71446, -0.715216, -0.715977, -0.716741, -0.717508, -0.718278,
-    -0.71905, -0.719822, -0.720594, -0.721366, -0.722137, -0.722905,
-    -0.723671, -0.724434, -0.725192, -0.725945, -0.726693, -0.727435,
-    -0.728169, -0.728896, -0.729614, -0.730323, -0.731022, -0.731711,
-    -0.732389, -0.733054, -0.733707, -0.734347, -0.734973, -0.735585,
-    -0.736181, -0.736762, -0.737326, -0.737874, -0.738403, -0.738915,
-    -0.739408, -0.739881, -0.740335, -0.740769, -0.741181, -0.741572,
-    -0.741942, -0.742289, -0.742613, -0.742914, -0.743191, -0.743444,
-    -0.743672, -0.743876, -0.744054, -0.744207, -0.744333, -0.744434,
-    -0.744507, -0.744554, -0.744574, -0.744566, -0.74453, -0.744466,
-    -0.744375, -0.744255, -0.744106, -0.743929, -0.743724, -0.743489,
-    -0.743226, -0.742933, -0.742611, -0.742261, -0.741881, -0.741472,
-    -0.741034, -0.740567, -0.740071, -0.739546, -0.738992, -0.738409,
-    -0.737798, -0.737159, -0.736491, -0.735795, -0.735071, -0.73432,
-    -0.733541, -0.732735, -0.731903, -0.731044, -0.730158, -0.729247,
-    -0.72831, -0.727348, -0.726361, -0.725349, -0.724314, -0.723255,
-    -0.722173, -0.721068, -0.719941, -0.718792, -0.717622, -0.716431,
-    -0.71522, -0.71399, -0.71274, -0.711472, -0.710186, -0.708882,
-    -0.707562, -0.706226, -0.704874, -0.703507, -0.702126, -0.700731,
-    -0.699323, -0.697903, -0.696472, -0.695029, -0.693577, -0.692114,
-    -0.690643, -0.689164, -0.687677, -0.686184, -0.684684, -0.68318,
-    -0.681671, -0.680157, -0.678641, -0.677123, -0.675603, -0.674082,
-    -0.672561, -0.67104, -0.669521, -0.668004, -0.666489, -0.664978,
-    -0.663472, -0.66197, -0.660474, -0.658984, -0.657502, -0.656027,
-    -0.654561, -0.653104, -0.651657, -0.65022, -0.648795, -0.647381,
-    -0.64598, -0.644593, -0.643219, -0.641859, -0.640515, -0.639186,
-    -0.637874, -0.636578, -0.6353, -0.63404, -0.632798, -0.631576,
-    -0.630373, -0.62919, -0.628027, -0.626886, -0.625766, -0.624668,
-    -0.623593, -0.62254, -0.621511, -0.620505, -0.619523, -0.618566,
-    -0.617633, -0.616725, -0.615842, -0.614985, -0.614154, -0.613348,
-    -0.612569, -0.611817, -0.611091, -0.610392, -0.60972, -0.609075,
-    -0.608457, -0.607867, -0.607304, -0.606769, -0.606261, -0.60578,
-    -0.605327, -0.604902, -0.604504, -0.604133, -0.60379, -0.603474,
-    -0.603185, -0.602922, -0.602687, -0.602478, -0.602296, -0.60214,
-    -0.602009, -0.601905, -0.601826, -0.601771, -0.601742, -0.601737,
-    -0.601757, -0.6018, -0.601866, -0.601956, -0.602068, -0.602202,
-    -0.602358, -0.602535, -0.602733, -0.602951, -0.603189, -0.603446,
-    -0.603722, -0.604016, -0.604327, -0.604655, -0.605, -0.60536,
-    -0.605736, -0.606126, -0.606529, -0.606946, -0.607376, -0.607817,
-    -0.60827, -0.608732, -0.609205, -0.609687, -0.610177, -0.610674,
-    -0.611178, -0.611689, -0.612204, -0.612725, -0.613249, -0.613776,
-    -0.614305, -0.614836, -0.615368, -0.615899, -0.61643, -0.616959,
-    -0.617485, -0.618008, -0.618528, -0.619042, -0.619551, -0.620054,
-    -0.620549, -0.621037, -0.621515, -0.621985, -0.622444, -0.622892,
-    -0.623328, -0.623751, -0.624162, -0.624558, -0.62494, -0.625306,
-    -0.625656, -0.625989, -0.626304, -0.626602, -0.62688, -0.627138,
-    -0.627376, -0.627593, -0.627789, -0.627962, -0.628113, -0.62824,
-    -0.628342, -0.628421, -0.628474, -0.628501, -0.628503, -0.628477,
-    -0.628424, -0.628344, -0.628235, -0.628098, -0.627931, -0.627736,
-    -0.62751, -0.627254, -0.626967, -0.626649, -0.626301, -0.62592,
-    -0.625508, -0.625063, -0.624586, -0.624077, -0.623535, -0.62296,
-    -0.622351, -0.62171, -0.621035, -0.620326, -0.619584, -0.618808,
-    -0.617999, -0.617155, -0.616278, -0.615368, -0.614424, -0.613446,
-    -0.612434, -0.61139, -0.610312, -0.609201, -0.608057, -0.60688,
-    -0.605671, -0.60443, -0.603156, -0.601851, -0.600514, -0.599146,
-    -0.597747, -0.596318, -0.594859, -0.59337, -0.591852, -0.590305,
-    -0.588729, -0.587126, -0.585495, -0.583837, -0.582153, -0.580443,
-    -0.578708, -0.576947, -0.575163, -0.573355, -0.571524, -0.569671,
-    -0.567796, -0.5659, -0.563984, -0.562048, -0.560093, -0.558119,
-    -0.556129, -0.554121, -0.552097, -0.550058, -0.548005, -0.545938,
-    -0.543858, -0.541765, -0.539662, -0.537547, -0.535423, -0.53329,
-    -0.531149, -0.529001, -0.526846, -0.524685, -0.52252, -0.520351,
-    -0.518179, -0.516004, -0.513829, -0.511652, -0.509477, -0.507302,
-    -0.505129, -0.50296, -0.500794, -0.498632, -0.496476, -0.494327,
-    -0.492184, -0.49005, -0.487924, -0.485807, -0.483702, -0.481607,
-    -0.479524, -0.477454, -0.475398, -0.473356, -0.471329, -0.469318,
-    -0.467324, -0.465347, -0.463387, -0.461447, -0.459526, -0.457625,
-    -0.455745, -0.453886, -0.452049, -0.450235, -0.448444, -0.446677,
-    -0.444934, -0.443216, -0.441524, -0.439857, -0.438217, -0.436604,
-    -0.435019, -0.433461, -0.431931, -0.43043, -0.428959, -0.427516,
-    -0.426103, -0.424721, -0.423368, -0.422047, -0.420756, -0.419496,
-    -0.418267, -0.41707, -0.415905, -0.414771, -0.413669, -0.412599,
-    -0.411561, -0.410555, -0.409582, -0.40864, -0.40773, -0.406853,
-    -0.406007, -0.405193, -0.404411, -0.40366, -0.402941, -0.402253,
-    -0.401596, -0.400969, -0.400373, -0.399807, -0.399271, -0.398765,
-    -0.398287, -0.397838, -0.397418, -0.397026, -0.396661, -0.396323,
-    -0.396011, -0.395726, -0.395466, -0.395231, -0.39502, -0.394833,
-    -0.394669, -0.394527, -0.394408, -0.394309, -0.394231, -0.394172,
-    -0.394133, -0.394112, -0.394108, -0.394121, -0.39415, -0.394194,
-    -0.394252, -0.394324, -0.394408, -0.394504, -0.394611, -0.394727,
-    -0.394853, -0.394987, -0.395128, -0.395275, -0.395428, -0.395585,
-    -0.395745, -0.395908, -0.396072, -0.396237, -0.396401, -0.396563,
-    -0.396723, -0.39688, -0.397032, -0.397178, -0.397318, -0.39745,
-    -0.397574, -0.397688, -0.397791, -0.397883, -0.397963, -0.398028,
-    -0.398079, -0.398115, -0.398133, -0.398134, -0.398117, -0.39808,
-    -0.398022, -0.397943, -0.397842, -0.397717, -0.397567, -0.397393,
-    -0.397192, -0.396964, -0.396709, -0.396424, -0.39611, -0.395765,
-    -0.395389, -0.394981, -0.39454, -0.394065, -0.393555, -0.39301,
-    -0.39243, -0.391812, -0.391157, -0.390464, -0.389733, -0.388961,
-    -0.38815, -0.387299, -0.386406, -0.385472, -0.384495, -0.383476,
-    -0.382413, -0.381307, -0.380157, -0.378963, -0.377724, -0.376439,
-    -0.375109, -0.373733, -0.372312, -0.370844, -0.369329, -0.367768,
-    -0.36616, -0.364505, -0.362802, -0.361053, -0.359256, -0.357413,
-    -0.355521, -0.353583, -0.351598, -0.349565, -0.347485, -0.345359,
-    -0.343186, -0.340967, -0.338701, -0.33639, -0.334033, -0.33163,
-    -0.329183, -0.326691, -0.324155, -0.321575, -0.318952, -0.316285,
-    -0.313577, -0.310827, -0.308035, -0.305203, -0.302331, -0.29942,
-    -0.29647, -0.293481, -0.290456, -0.287394, -0.284296, -0.281163,
-    -0.277996, -0.274795, -0.271563, -0.268298, -0.265003, -0.261677,
-    -0.258323, -0.254941, -0.251532, -0.248097, -0.244637, -0.241153,
-    -0.237647, -0.234118, -0.230569, -0.227, -0.223412, -0.219807,
-    -0.216186, -0.212549, -0.208899, -0.205235, -0.20156, -0.197874,
-    -0.194179, -0.190476, -0.186766, -0.18305, -0.17933, -0.175607,
-    -0.171881, -0.168154, -0.164428, -0.160704, -0.156982, -0.153264,
-    -0.149552, -0.145846, -0.142148, -0.138459, -0.13478, -0.131112,
-    -0.127457, -0.123816, -0.120189, -0.116579, -0.112986, -0.109412,
-    -0.105856, -0.102322, -0.0988097, -0.0953202, -0.0918547, -0.0884144,
-    -0.0850002, -0.0816132, -0.0782545, -0.074925, -0.0716258, -0.0683578,
-    -0.0651219, -0.0619192, -0.0587504, -0.0556166, -0.0525185, -0.049457,
-    -0.0464329, -0.043447, -0.0405001, -0.0375928, -0.034726, -0.0319002,
-    -0.0291162, -0.0263745, -0.0236757, -0.0210205, -0.0184093, -0.0158427,
-    -0.0133211, -0.010845, -0.00841476, -0.00603075, -0.00369332, -0.00140279,
-    0.000840574, 0.00303653, 0.00518488, 0.00728545, 0.00933811, 0.0113428,
-    0.0132993, 0.0152078, 0.0170682, 0.0188805, 0.0206449, 0.0223614,
-    0.0240303, 0.0256517, 0.0272258, 0.0287529, 0.0302333, 0.0316674,
-    0.0330556, 0.0343982, 0.0356957, 0.0369486, 0.0381575, 0.0393228,
-    0.0404453, 0.0415255, 0.0425641, 0.0435619, 0.0445195, 0.0454378,
-    0.0463176, 0.0471597, 0.047965, 0.0487345, 0.0494691, 0.0501697,
-    0.0508375, 0.0514735, 0.0520787, 0.0526542, 0.0532013, 0.0537212,
-    0.0542149, 0.0546838, 0.0551292, 0.0555522, 0.0559544, 0.0563369,
-    0.0567013, 0.0570488, 0.0573809, 0.0576992, 0.058005, 0.0582999,
-    0.0585853, 0.0588629, 0.0591341, 0.0594007, 0.0596641, 0.059926,
-    0.060188, 0.0604518, 0.060719, 0.0609913, 0.0612705, 0.0615582,
-    0.0618561, 0.062166, 0.0624896, 0.0628286, 0.0631848, 0.06356,
-    0.0639558, 0.0643742, 0.0648167, 0.0652853, 0.0657816, 0.0663075,
-    0.0668647, 0.067455, 0.0680801, 0.0687418, 0.0694418, 0.070182,
-    0.0709639, 0.0717894, 0.0726602, 0.0735779, 0.0745443, 0.0755611,
-    0.0766298, 0.0777522, 0.0789298, 0.0801644, 0.0814574, 0.0828105,
-    0.0842252, 0.085703, 0.0872454, 0.088854, 0.0905301, 0.0922752,
-    0.0940907, 0.095978, 0.0979384, 0.0999731, 0.102084, 0.104271,
-    0.106537, 0.108881, 0.111307, 0.113814, 0.116403, 0.119076,
-    0.121834, 0.124677, 0.127607, 0.130624, 0.13373, 0.136924,
-    0.140208, 0.143582, 0.147047, 0.150604, 0.154253, 0.157995,
-    0.161829, 0.165758, 0.169779, 0.173896, 0.178106, 0.182411,
-    0.186811, 0.191305, 0.195894, 0.200578, 0.205357, 0.21023,
-    0.215198, 0.22026, 0.225416, 0.230665, 0.236007, 0.241442,
-    0.24697, 0.252588, 0.258298, 0.264098, 0.269987, 0.275965,
-    0.282031, 0.288184, 0.294423, 0.300746, 0.307154, 0.313644,
-    0.320215, 0.326867, 0.333597, 0.340405, 0.347289, 0.354248,
-    0.36128, 0.368383, 0.375556, 0.382797, 0.390104, 0.397476,
-    0.404911, 0.412406, 0.41996, 0.427571, 0.435237, 0.442955,
-    0.450724, 0.458541, 0.466404, 0.47431, 0.482258, 0.490245,
-    0.498268, 0.506325, 0.514414, 0.522531, 0.530675, 0.538842,
-    0.547031, 0.555237, 0.563459, 0.571694, 0.579938, 0.58819,
-    0.596445, 0.604702, 0.612957, 0.621207, 0.62945, 0.637681,
-    0.645899, 0.654099, 0.66228, 0.670437, 0.678568, 0.68667,
-    0.694738, 0.702771, 0.710765, 0.718716, 0.726622, 0.734479,
-    0.742284, 0.750033, 0.757724, 0.765354, 0.772917, 0.780413,
-    0.787837, 0.795186, 0.802456, 0.809645, 0.81675, 0.823766,
-    0.830691, 0.837522, 0.844255, 0.850886, 0.857414, 0.863835,
-    0.870145, 0.876342, 0.882422, 0.888382, 0.894219, 0.899931,
-    0.905513, 0.910964, 0.91628, 0.921458, 0.926495, 0.931389,
-    0.936137, 0.940736, 0.945182, 0.949474, 0.953609, 0.957584,
-    0.961397, 0.965044, 0.968524, 0.971834, 0.974972, 0.977936,
-    0.980722, 0.983329, 0.985755, 0.987997, 0.990054, 0.991923,
-    0.993602, 0.99509, 0.996385, 0.997485, 0.998388, 0.999093,
-    0.999597, 0.9999, 1, 0.999896, 0.999585, 0.999068,
-    0.998343, 0.997408, 0.996263, 0.994907, 0.993338, 0.991556,
-    0.989561, 0.987351, 0.984926, 0.982285, 0.979428, 0.976354,
-    0.973064, 0.969556, 0.965832, 0.96189, 0.95773, 0.953353,
-    0.94876, 0.943949, 0.938922, 0.933678, 0.928219, 0.922544,
-    0.916655, 0.910551, 0.904235, 0.897706, 0.890966, 0.884015,
-    0.876855, 0.869487, 0.861911, 0.85413, 0.846145, 0.837956,
-    0.829567, 0.820977, 0.812189, 0.803205, 0.794026, 0.784655,
-    0.775093, 0.765342, 0.755404, 0.745282, 0.734978, 0.724493,
-    0.713831, 0.702994, 0.691984, 0.680804, 0.669456, 0.657944,
-    0.646269, 0.634435, 0.622445, 0.610301, 0.598006, 0.585563,
-    0.572976, 0.560248, 0.547381, 0.53438, 0.521246, 0.507984,
-    0.494597, 0.481089, 0.467462, 0.45372, 0.439867, 0.425907,
-    0.411842, 0.397678, 0.383416, 0.369061, 0.354618, 0.340088,
-    0.325477, 0.310788, 0.296026, 0.281193, 0.266293, 0.251332,
-    0.236312, 0.221238
-};
-
-static const float WAVE_EXPONENTIAL_114[DEFAULT_WAVELEN] = {
-    0.347641, 0.339545, 0.331426, 0.323283, 0.315117, 0.306929,
-    0.29872, 0.290489, 0.282239, 0.273969, 0.26568, 0.257373,
-    0.249048, 0.240706, 0.232349, 0.223975, 0.215587, 0.207185,
-    0.198769, 0.19034, 0.181899, 0.173447, 0.164984, 0.156511,
-    0.148028, 0.139536, 0.131037, 0.12253, 0.114016, 0.105496,
-    0.0969705, 0.0884405, 0.0799064, 0.0713689, 0.0628287, 0.0542865,
-    0.045743, 0.0371988, 0.0286546, 0.020111, 0.0115688, 0.00302859,
-    -0.00550895, -0.0140431, -0.0225733, -0.0310988, -0.039619, -0.0481331,
-    -0.0566406, -0.0651408, -0.073633, -0.0821166, -0.0905908, -0.0990552,
-    -0.107509, -0.115951, -0.124382, -0.1328, -0.141205, -0.149596,
-    -0.157973, -0.166334, -0.17468, -0.18301, -0.191322, -0.199617,
-    -0.207894, -0.216152, -0.22439, -0.232609, -0.240806, -0.248983,
-    -0.257137, -0.265269, -0.273379, -0.281464, -0.289525, -0.297561,
-    -0.305572, -0.313557, -0.321515, -0.329446, -0.33735, -0.345225,
-    -0.353071, -0.360888, -0.368675, -0.376431, -0.384157, -0.39185,
-    -0.399512, -0.407141, -0.414737, -0.422299, -0.429828, -0.437321,
-    -0.444779, -0.452201, -0.459588, -0.466937, -0.474249, -0.481524,
-    -0.48876, -0.495958, -0.503117, -0.510236, -0.517315, -0.524354,
-    -0.531352, -0.538308, -0.545223, -0.552095, -0.558925, -0.565711,
-    -0.572454, -0.579154, -0.585809, -0.592419, -0.598984, -0.605504,
-    -0.611977, -0.618405, -0.624786, -0.63112, -0.637407, -0.643646,
-    -0.649837, -0.655979, -0.662073, -0.668118, -0.674114, -0.68006,
-    -0.685955, -0.691801, -0.697596, -0.70334, -0.709033, -0.714675,
-    -0.720265, -0.725803, -0.731289, -0.736722, -0.742103, -0.74743,
-    -0.752705, -0.757926, -0.763093, -0.768206, -0.773266, -0.778271,
-    -0.783222, -0.788118, -0.792959, -0.797745, -0.802476, -0.807151,
-    -0.811771, -0.816336, -0.820844, -0.825297, -0.829694, -0.834034,
-    -0.838318, -0.842546, -0.846717, -0.850832, -0.85489, -0.858891,
-    -0.862835, -0.866722, -0.870552, -0.874326, -0.878042, -0.8817,
-    -0.885302, -0.888847, -0.892334, -0.895764, -0.899136, -0.902451,
-    -0.905709, -0.90891, -0.912053, -0.91514, -0.918168, -0.92114,
-    -0.924055, -0.926912, -0.929712, -0.932456, -0.935142, -0.937771,
-    -0.940344, -0.94286, -0.945319, -0.947722, -0.950068, -0.952358,
-    -0.954592, -0.95677, -0.958891, -0.960957, -0.962967, -0.964922,
-    -0.966821, -0.968665, -0.970453, -0.972187, -0.973866, -0.975491,
-    -0.977061, -0.978577, -0.980038, -0.981446, -0.982801, -0.984102,
-    -0.985349, -0.986544, -0.987686, -0.988776, -0.989813, -0.990799,
-    -0.991732, -0.992614, -0.993445, -0.994225, -0.994954, -0.995632,
-    -0.996261, -0.996839, -0.997368, -0.997848, -0.998278, -0.99866,
-    -0.998994, -0.999279, -0.999517, -0.999707, -0.99985, -0.999946,
-    -0.999996, -1, -0.999958, -0.99987, -0.999738, -0.999561,
-    -0.999339, -0.999073, -0.998764, -0.998412, -0.998016, -0.997578,
-    -0.997098, -0.996577, -0.996014, -0.995409, -0.994765, -0.99408,
-    -0.993356, -0.992592, -0.991789, -0.990948, -0.990068, -0.989151,
-    -0.988197, -0.987205, -0.986178, -0.985114, -0.984015, -0.98288,
-    -0.981711, -0.980508, -0.979271, -0.978001, -0.976697, -0.975361,
-    -0.973994, -0.972594, -0.971164, -0.969703, -0.968211, -0.96669,
-    -0.96514, -0.963561, -0.961954, -0.960318, -0.958656, -0.956966,
-    -0.95525, -0.953508, -0.951741, -0.949948, -0.948131, -0.94629,
-    -0.944425, -0.942537, -0.940627, -0.938694, -0.93674, -0.934765,
-    -0.932769, -0.930752, -0.928716, -0.926661, -0.924587, -0.922494,
-    -0.920384, -0.918257, -0.916113, -0.913952, -0.911775, -0.909584,
-    -0.907377, -0.905156, -0.902921, -0.900672, -0.898411, -0.896137,
-    -0.893851, -0.891554, -0.889246, -0.886927, -0.884598, -0.882259,
-    -0.879911, -0.877555, -0.875191, -0.872819, -0.870439, -0.868053,
-    -0.865661, -0.863263, -0.860859, -0.858451, -0.856038, -0.853621,
-    -0.851201, -0.848778, -0.846352, -0.843924, -0.841494, -0.839063,
-    -0.836632, -0.8342, -0.831768, -0.829337, -0.826906, -0.824477,
-    -0.82205, -0.819626, -0.817204, -0.814785, -0.81237, -0.809959,
-    -0.807552, -0.80515, -0.802753, -0.800362, -0.797977, -0.795599,
-    -0.793227, -0.790863, -0.788506, -0.786157, -0.783817, -0.781486,
-    -0.779163, -0.776851, -0.774548, -0.772256, -0.769974, -0.767704,
-    -0.765445, -0.763198, -0.760962, -0.75874, -0.75653, -0.754333,
-    -0.75215, -0.749981, -0.747826, -0.745685, -0.743559, -0.741449,
-    -0.739354, -0.737274, -0.735211, -0.733164, -0.731134, -0.729121,
-    -0.727125, -0.725146, -0.723186, -0.721244, -0.71932, -0.717414,
-    -0.715528, -0.71366, -0.711813, -0.709985, -0.708176, -0.706388,
-    -0.704621, -0.702874, -0.701148, -0.699443, -0.697759, -0.696097,
-    -0.694457, -0.692838, -0.691242, -0.689668, -0.688117, -0.686588,
-    -0.685083, -0.6836, -0.682141, -0.680705, -0.679293, -0.677904,
-    -0.676539, -0.675199, -0.673883, -0.67259, -0.671323, -0.67008,
-    -0.668862, -0.667668, -0.6665, -0.665357, -0.664238, -0.663145,
-    -0.662078, -0.661036, -0.660019, -0.659029, -0.658063, -0.657124,
-    -0.65621, -0.655323, -0.654461, -0.653626, -0.652816, -0.652033,
-    -0.651275, -0.650544, -0.649839, -0.649161, -0.648508, -0.647882,
-    -0.647283, -0.646709, -0.646162, -0.645641, -0.645146, -0.644678,
-    -0.644236, -0.64382, -0.64343, -0.643067, -0.642729, -0.642418,
-    -0.642133, -0.641873, -0.64164, -0.641433, -0.641251, -0.641095,
-    -0.640965, -0.64086, -0.640781, -0.640728, -0.640699, -0.640696,
-    -0.640719, -0.640766, -0.640838, -0.640935, -0.641057, -0.641203,
-    -0.641374, -0.641569, -0.641789, -0.642033, -0.6423, -0.642592,
-    -0.642907, -0.643245, -0.643607, -0.643993, -0.644401, -0.644832,
-    -0.645286, -0.645763, -0.646262, -0.646783, -0.647326, -0.647891,
-    -0.648478, -0.649086, -0.649716, -0.650367, -0.651038, -0.65173,
-    -0.652443, -0.653176, -0.653929, -0.654702, -0.655494, -0.656306,
-    -0.657137, -0.657987, -0.658855, -0.659743, -0.660648, -0.661571,
-    -0.662512, -0.663471, -0.664447, -0.66544, -0.66645, -0.667476,
-    -0.668519, -0.669577, -0.670652, -0.671742, -0.672847, -0.673967,
-    -0.675102, -0.676251, -0.677414, -0.678591, -0.679782, -0.680986,
-    -0.682204, -0.683434, -0.684676, -0.685931, -0.687198, -0.688476,
-    -0.689766, -0.691067, -0.692378, -0.6937, -0.695032, -0.696374,
-    -0.697726, -0.699087, -0.700457, -0.701836, -0.703223, -0.704619,
-    -0.706022, -0.707433, -0.708851, -0.710276, -0.711707, -0.713145,
-    -0.714589, -0.716038, -0.717493, -0.718953, -0.720418, -0.721888,
-    -0.723361, -0.724839, -0.72632, -0.727804, -0.729292, -0.730782,
-    -0.732274, -0.733769, -0.735265, -0.736763, -0.738262, -0.739761,
-    -0.741262, -0.742762, -0.744263, -0.745763, -0.747263, -0.748762,
-    -0.750259, -0.751755, -0.753249, -0.754741, -0.756231, -0.757718,
-    -0.759202, -0.760682, -0.762159, -0.763633, -0.765102, -0.766567,
-    -0.768027, -0.769482, -0.770931, -0.772375, -0.773814, -0.775246,
-    -0.776672, -0.778091, -0.779503, -0.780909, -0.782306, -0.783696,
-    -0.785078, -0.786452, -0.787817, -0.789174, -0.790521, -0.791859,
-    -0.793188, -0.794507, -0.795816, -0.797115, -0.798403, -0.79968,
-    -0.800947, -0.802202, -0.803446, -0.804678, -0.805898, -0.807106,
-    -0.808302, -0.809485, -0.810656, -0.811813, -0.812958, -0.814088,
-    -0.815206, -0.816309, -0.817398, -0.818474, -0.819534, -0.82058,
-    -0.821612, -0.822628, -0.823629, -0.824615, -0.825585, -0.82654,
-    -0.827479, -0.828402, -0.829308, -0.830198, -0.831072, -0.831929,
-    -0.832769, -0.833593, -0.834399, -0.835188, -0.835959, -0.836713,
-    -0.83745, -0.838168, -0.838869, -0.839551, -0.840216, -0.840862,
-    -0.84149, -0.842099, -0.84269, -0.843262, -0.843816, -0.84435,
-    -0.844866, -0.845362, -0.84584, -0.846298, -0.846736, -0.847156,
-    -0.847556, -0.847937, -0.848298, -0.848639, -0.848961, -0.849263,
-    -0.849545, -0.849808, -0.85005, -0.850273, -0.850476, -0.850659,
-    -0.850822, -0.850965, -0.851088, -0.85119, -0.851273, -0.851336,
-    -0.851379, -0.851402, -0.851404, -0.851387, -0.85135, -0.851292,
-    -0.851215, -0.851118, -0.851, -0.850863, -0.850706, -0.850529,
-    -0.850332, -0.850116, -0.84988, -0.849624, -0.849348, -0.849053,
-    -0.848738, -0.848404, -0.84805, -0.847678, -0.847286, -0.846874,
-    -0.846444, -0.845995, -0.845526, -0.845039, -0.844533, -0.844009,
-    -0.843466, -0.842904, -0.842324, -0.841726, -0.84111, -0.840476,
-    -0.839824, -0.839154, -0.838466, -0.837761, -0.837039, -0.836299,
-    -0.835542, -0.834768, -0.833978, -0.83317, -0.832346, -0.831506,
-    -0.830649, -0.829776, -0.828887, -0.827983, -0.827063, -0.826127,
-    -0.825176, -0.82421, -0.823229, -0.822233, -0.821223, -0.820198,
-    -0.819158, -0.818105, -0.817038, -0.815957, -0.814863, -0.813755,
-    -0.812634, -0.811501, -0.810354, -0.809195, -0.808024, -0.80684,
-    -0.805645, -0.804438, -0.803219, -0.801989, -0.800749, -0.799497,
-    -0.798234, -0.796961, -0.795678, -0.794385, -0.793082, -0.79177,
-    -0.790448, -0.789117, -0.787778, -0.78643, -0.785073, -0.783708,
-    -0.782335, -0.780955, -0.779567, -0.778171, -0.776769, -0.77536,
-    -0.773945, -0.772523, -0.771095, -0.769661, -0.768222, -0.766777,
-    -0.765328, -0.763873, -0.762414, -0.760951, -0.759483, -0.758012,
-    -0.756537, -0.755059, -0.753577, -0.752093, -0.750606, -0.749117,
-    -0.747625, -0.746132, -0.744637, -0.74314, -0.741643, -0.740144,
-    -0.738645, -0.737146, -0.735646, -0.734146, -0.732647, -0.731148,
-    -0.72965, -0.728154, -0.726658, -0.725164, -0.723672, -0.722182,
-    -0.720694, -0.719208, -0.717725, -0.716246, -0.714769, -0.713296,
-    -0.711827, -0.710362, -0.7089, -0.707443, -0.705991, -0.704544,
-    -0.703102, -0.701665, -0.700233, -0.698807, -0.697388, -0.695974,
-    -0.694567, -0.693167, -0.691773, -0.690387, -0.689008, -0.687636,
-    -0.686272, -0.684916, -0.683568, -0.682229, -0.680898, -0.679575,
-    -0.678262, -0.676958, -0.675663, -0.674378, -0.673103, -0.671837,
-    -0.670582, -0.669336, -0.668102, -0.666878, -0.665665, -0.664462,
-    -0.663272, -0.662092, -0.660924, -0.659768, -0.658623, -0.657491,
-    -0.656371, -0.655263, -0.654168, -0.653085, -0.652015, -0.650959,
-    -0.649915, -0.648884, -0.647867, -0.646864, -0.645874, -0.644898,
-    -0.643936, -0.642988, -0.642055, -0.641135, -0.64023, -0.63934,
-    -0.638464, -0.637603, -0.636757, -0.635926, -0.635109, -0.634309,
-    -0.633523, -0.632753, -0.631998, -0.631259, -0.630535, -0.629827,
-    -0.629135, -0.628459, -0.627799, -0.627154, -0.626526, -0.625914,
-    -0.625318, -0.624738, -0.624175, -0.623628, -0.623097, -0.622583,
-    -0.622086, -0.621604, -0.62114, -0.620692, -0.62026, -0.619845,
-    -0.619447, -0.619066, -0.618701, -0.618353, -0.618021, -0.617706,
-    -0.617408, -0.617127, -0.616862, -0.616614, -0.616383, -0.616169,
-    -0.615971, -0.615789, -0.615624, -0.615476, -0.615345, -0.61523,
-    -0.615131, -0.615049, -0.614983, -0.614933, -0.6149, -0.614883,
-    -0.614882, -0.614898, -0.614929, -0.614976, -0.61504, -0.615119,
-    -0.615214, -0.615325, -0.615451, -0.615593, -0.61575, -0.615923,
-    -0.616111, -0.616314, -0.616532, -0.616765, -0.617013, -0.617276,
-    -0.617553, -0.617845, -0.618152, -0.618473, -0.618808, -0.619157,
-    -0.61952, -0.619896, -0.620287, -0.620691, -0.621108, -0.621539,
-    -0.621983, -0.62244, -0.622909, -0.623392, -0.623887, -0.624394,
-    -0.624913, -0.625445, -0.625988, -0.626543, -0.62711, -0.627688,
-    -0.628278, -0.628878, -0.629489, -0.630111, -0.630744, -0.631387,
-    -0.63204, -0.632703, -0.633376, -0.634058, -0.63475, -0.635451,
-    -0.636161, -0.63688, -0.637607, -0.638343, -0.639087, -0.639839,
-    -0.640599, -0.641367, -0.642142, -0.642924, -0.643713, -0.644508,
-    -0.645311, -0.646119, -0.646934, -0.647755, -0.648581, -0.649413,
-    -0.650249, -0.651091, -0.651938, -0.652789, -0.653645, -0.654504,
-    -0.655368, -0.656235, -0.657105, -0.657979, -0.658855, -0.659735,
-    -0.660616, -0.6615, -0.662386, -0.663274, -0.664163, -0.665053,
-    -0.665945, -0.666837, -0.66773, -0.668623, -0.669517, -0.67041,
-    -0.671302, -0.672195, -0.673086, -0.673976, -0.674865, -0.675752,
-    -0.676637, -0.67752, -0.678401, -0.67928, -0.680155, -0.681028,
-    -0.681897, -0.682763, -0.683625, -0.684483, -0.685337, -0.686186,
-    -0.687031, -0.687871, -0.688705, -0.689534, -0.690358, -0.691176,
-    -0.691987, -0.692792, -0.693591, -0.694383, -0.695168, -0.695945,
-    -0.696715, -0.697478, -0.698232, -0.698979, -0.699717, -0.700446,
-    -0.701167, -0.701878, -0.702581, -0.703273, -0.703957, -0.70463,
-    -0.705293, -0.705946, -0.706588, -0.70722, -0.707841, -0.70845,
-    -0.709048, -0.709635, -0.71021, -0.710773, -0.711324, -0.711863,
-    -0.712389, -0.712902, -0.713403, -0.71389, -0.714364, -0.714825,
-    -0.715272, -0.715706, -0.716125, -0.716531, -0.716922, -0.717298,
-    -0.71766, -0.718007, -0.71834, -0.718657, -0.718958, -0.719245,
-    -0.719516, -0.719771, -0.72001, -0.720234, -0.720441, -0.720632,
-    -0.720806, -0.720964, -0.721105, -0.72123, -0.721337, -0.721428,
-    -0.721501, -0.721557, -0.721596, -0.721617, -0.721621, -0.721606,
-    -0.721575, -0.721525, -0.721457, -0.721371, -0.721267, -0.721144,
-    -0.721003, -0.720844, -0.720667, -0.72047, -0.720255, -0.720022,
-    -0.719769, -0.719498, -0.719207, -0.718898, -0.71857, -0.718223,
-    -0.717856, -0.717471, -0.717066, -0.716642, -0.716199, -0.715736,
-    -0.715254, -0.714753, -0.714232, -0.713692, -0.713133, -0.712554,
-    -0.711956, -0.711338, -0.710701, -0.710044, -0.709368, -0.708673,
-    -0.707958, -0.707224, -0.706471, -0.705698, -0.704906, -0.704094,
-    -0.703264, -0.702414, -0.701545, -0.700656, -0.699749, -0.698823,
-    -0.697877, -0.696913, -0.69593, -0.694928, -0.693907, -0.692867,
-    -0.691809, -0.690733, -0.689637, -0.688524, -0.687392, -0.686242,
-    -0.685074, -0.683887, -0.682683, -0.681461, -0.680221, -0.678964,
-    -0.677689, -0.676396, -0.675086, -0.673759, -0.672415, -0.671054,
-    -0.669676, -0.668281, -0.66687, -0.665442, -0.663998, -0.662538,
-    -0.661062, -0.659569, -0.658061, -0.656538, -0.654999, -0.653445,
-    -0.651875, -0.650291, -0.648691, -0.647078, -0.645449, -0.643806,
-    -0.64215, -0.640479, -0.638794, -0.637096, -0.635384, -0.633659,
-    -0.631921, -0.63017, -0.628407, -0.626631, -0.624842, -0.623042,
-    -0.621229, -0.619405, -0.61757, -0.615723, -0.613865, -0.611996,
-    -0.610116, -0.608226, -0.606326, -0.604416, -0.602496, -0.600566,
-    -0.598627, -0.596679, -0.594722, -0.592756, -0.590781, -0.588799,
-    -0.586808, -0.58481, -0.582804, -0.58079, -0.57877, -0.576743,
-    -0.574709, -0.572668, -0.570622, -0.568569, -0.566511, -0.564448,
-    -0.562379, -0.560306, -0.558228, -0.556145, -0.554058, -0.551967,
-    -0.549873, -0.547775, -0.545673, -0.543569, -0.541462, -0.539353,
-    -0.537241, -0.535127, -0.533012, -0.530895, -0.528777, -0.526658,
-    -0.524539, -0.522418, -0.520298, -0.518178, -0.516058, -0.513938,
-    -0.511819, -0.509702, -0.507585, -0.50547, -0.503357, -0.501246,
-    -0.499138, -0.497031, -0.494928, -0.492827, -0.49073, -0.488636,
-    -0.486547, -0.484461, -0.482379, -0.480302, -0.478229, -0.476162,
-    -0.474099, -0.472043, -0.469991, -0.467946, -0.465907, -0.463874,
-    -0.461848, -0.459829, -0.457817, -0.455812, -0.453814, -0.451825,
-    -0.449843, -0.447869, -0.445904, -0.443948, -0.442, -0.440062,
-    -0.438133, -0.436213, -0.434303, -0.432403, -0.430513, -0.428633,
-    -0.426764, -0.424905, -0.423057, -0.421221, -0.419396, -0.417582,
-    -0.41578, -0.41399, -0.412212, -0.410446, -0.408692, -0.406951,
-    -0.405223, -0.403508, -0.401806, -0.400117, -0.398441, -0.396779,
-    -0.395131, -0.393497, -0.391876, -0.39027, -0.388679, -0.387101,
-    -0.385539, -0.383991, -0.382458, -0.38094, -0.379437, -0.37795,
-    -0.376477, -0.375021, -0.37358, -0.372155, -0.370745, -0.369352,
-    -0.367975, -0.366613, -0.365269, -0.36394, -0.362628, -0.361332,
-    -0.360054, -0.358791, -0.357546, -0.356317, -0.355106, -0.353911,
-    -0.352733, -0.351573, -0.350429, -0.349303, -0.348194, -0.347102,
-    -0.346028, -0.344971, -0.343931, -0.342909, -0.341905, -0.340917,
-    -0.339948, -0.338996, -0.338061, -0.337144, -0.336244, -0.335362,
-    -0.334498, -0.333651, -0.332821, -0.33201, -0.331215, -0.330438,
-    -0.329678, -0.328936, -0.328211, -0.327504, -0.326813, -0.32614,
-    -0.325485, -0.324846, -0.324224, -0.323619, -0.323032, -0.322461,
-    -0.321907, -0.321369, -0.320849, -0.320345, -0.319857, -0.319385,
-    -0.31893, -0.318491, -0.318069, -0.317662, -0.317271, -0.316895,
-    -0.316536, -0.316191, -0.315862, -0.315549, -0.31525, -0.314967,
-    -0.314698, -0.314444, -0.314204, -0.313979, -0.313768, -0.313571,
-    -0.313388, -0.313218, -0.313062, -0.31292, -0.312791, -0.312674,
-    -0.312571, -0.31248, -0.312402, -0.312335, -0.312281, -0.312239,
-    -0.312208, -0.312189, -0.312181, -0.312184, -0.312198, -0.312223,
-    -0.312257, -0.312302, -0.312357, -0.312421, -0.312495, -0.312578,
-    -0.31267, -0.31277, -0.312879, -0.312996, -0.313121, -0.313254,
-    -0.313394, -0.313541, -0.313695, -0.313856, -0.314023, -0.314196,
-    -0.314375, -0.314559, -0.314748, -0.314943, -0.315142, -0.315345,
-    -0.315553, -0.315764, -0.315979, -0.316197, -0.316417, -0.316641,
-    -0.316866, -0.317094, -0.317323, -0.317553, -0.317785, -0.318017,
-    -0.31825, -0.318483, -0.318715, -0.318947, -0.319178, -0.319408,
-    -0.319636, -0.319862, -0.320087, -0.320308, -0.320527, -0.320743,
-    -0.320955, -0.321163, -0.321367, -0.321566, -0.321761, -0.32195,
-    -0.322134, -0.322312, -0.322484, -0.322649, -0.322807, -0.322958,
-    -0.323102, -0.323237, -0.323364, -0.323482, -0.323592, -0.323692,
-    -0.323782, -0.323863, -0.323933, -0.323992, -0.32404, -0.324077,
-    -0.324102, -0.324114, -0.324115, -0.324102, -0.324077, -0.324038,
-    -0.323985, -0.323918, -0.323836, -0.323739, -0.323627, -0.3235,
-    -0.323357, -0.323197, -0.323021, -0.322828, -0.322618, -0.32239,
-    -0.322144, -0.32188, -0.321597, -0.321295, -0.320974, -0.320633,
-    -0.320273, -0.319892, -0.319491, -0.319068, -0.318625, -0.31816,
-    -0.317673, -0.317164, -0.316632, -0.316078, -0.3155, -0.314899,
-    -0.314274, -0.313626, -0.312953, -0.312255, -0.311532, -0.310784,
-    -0.310011, -0.309212, -0.308386, -0.307535, -0.306656, -0.305751,
-    -0.304818, -0.303858, -0.30287, -0.301855, -0.30081, -0.299738,
-    -0.298636, -0.297506, -0.296346, -0.295156, -0.293937, -0.292688,
-    -0.291408, -0.290098, -0.288757, -0.287385, -0.285982, -0.284547,
-    -0.283081, -0.281583, -0.280053, -0.27849, -0.276895, -0.275267,
-    -0.273607, -0.271913, -0.270186, -0.268426, -0.266632, -0.264804,
-    -0.262943, -0.261047, -0.259117, -0.257152, -0.255153, -0.253119,
-    -0.25105, -0.248947, -0.246808, -0.244633, -0.242424, -0.240178,
-    -0.237897, -0.235581, -0.233228, -0.23084, -0.228415, -0.225954,
-    -0.223458, -0.220924, -0.218354, -0.215748, -0.213105, -0.210426,
-    -0.20771, -0.204957, -0.202168, -0.199341, -0.196478, -0.193578,
-    -0.190641, -0.187667, -0.184656, -0.181608, -0.178523, -0.175401,
-    -0.172242, -0.169046, -0.165813, -0.162544, -0.159237, -0.155894,
-    -0.152513, -0.149096, -0.145642, -0.142152, -0.138625, -0.135061,
-    -0.131461, -0.127824, -0.124151, -0.120441, -0.116696, -0.112914,
-    -0.109097, -0.105243, -0.101354, -0.0974293, -0.093469, -0.0894732,
-    -0.0854422, -0.0813761, -0.077275, -0.0731391, -0.0689685, -0.0647635,
-    -0.0605241, -0.0562505, -0.051943, -0.0476016, -0.0432267, -0.0388183,
-    -0.0343768, -0.0299022, -0.0253948, -0.0208549, -0.0162826, -0.0116781,
-    -0.00704181, -0.00237383, 0.00232557, 0.00705613, 0.0118176, 0.0166097,
-    0.0214322, 0.0262848, 0.0311673, 0.0360793, 0.0410206, 0.0459909,
-    0.0509898, 0.0560172, 0.0610726, 0.0661558, 0.0712664, 0.0764041,
-    0.0815687, 0.0867597, 0.0919769, 0.0972198, 0.102488, 0.107782,
-    0.1131, 0.118442, 0.123809, 0.129199, 0.134613, 0.140049,
-    0.145508, 0.150989, 0.156492, 0.162015, 0.16756, 0.173126,
-    0.178711, 0.184316, 0.189941, 0.195584, 0.201246, 0.206925,
-    0.212622, 0.218337, 0.224067, 0.229815, 0.235577, 0.241355,
-    0.247148, 0.252955, 0.258777, 0.264611, 0.270459, 0.276318,
-    0.28219, 0.288074, 0.293968, 0.299873, 0.305788, 0.311712,
-    0.317645, 0.323587, 0.329537, 0.335494, 0.341458, 0.347429,
-    0.353406, 0.359387, 0.365374, 0.371365, 0.37736, 0.383358,
-    0.389359, 0.395362, 0.401366, 0.407372, 0.413378, 0.419384,
-    0.42539, 0.431394, 0.437397, 0.443397, 0.449395, 0.455389,
-    0.461379, 0.467365, 0.473346, 0.479321, 0.48529, 0.491252,
-    0.497206, 0.503153, 0.509091, 0.51502, 0.52094, 0.526849,
-    0.532747, 0.538634, 0.544509, 0.550371, 0.55622, 0.562055,
-    0.567876, 0.573682, 0.579472, 0.585247, 0.591004, 0.596745,
-    0.602467, 0.608171, 0.613856, 0.619521, 0.625166, 0.63079,
-    0.636393, 0.641974, 0.647532, 0.653067, 0.658578, 0.664064,
-    0.669526, 0.674963, 0.680373, 0.685756, 0.691113, 0.696441,
-    0.701741, 0.707012, 0.712253, 0.717465, 0.722645, 0.727794,
-    0.732912, 0.737996, 0.743048, 0.748066, 0.75305, 0.758,
-    0.762914, 0.767792, 0.772634, 0.777439, 0.782206, 0.786936,
-    0.791627, 0.796278, 0.80089, 0.805462, 0.809993, 0.814483,
-    0.818931, 0.823336, 0.827699, 0.832018, 0.836294, 0.840525,
-    0.844711, 0.848851, 0.852946, 0.856994, 0.860995, 0.864949,
-    0.868855, 0.872712, 0.876521, 0.88028, 0.883989, 0.887648,
-    0.891256, 0.894812, 0.898317, 0.90177, 0.90517, 0.908518,
-    0.911811, 0.915051, 0.918236, 0.921366, 0.924441, 0.92746,
-    0.930424, 0.93333, 0.93618, 0.938973, 0.941707, 0.944384,
-    0.947002, 0.949561, 0.952061, 0.954502, 0.956882, 0.959202,
-    0.961462, 0.96366, 0.965797, 0.967872, 0.969885, 0.971836,
-    0.973723, 0.975548, 0.97731, 0.979008, 0.980642, 0.982211,
-    0.983717, 0.985157, 0.986532, 0.987842, 0.989086, 0.990265,
-    0.991377, 0.992423, 0.993402, 0.994315, 0.99516, 0.995938,
-    0.996649, 0.997292, 0.997867, 0.998374, 0.998812, 0.999182,
-    0.999484, 0.999716, 0.99988, 0.999975, 1, 0.999956,
-    0.999842, 0.999659, 0.999406, 0.999083, 0.998689, 0.998226,
-    0.997693, 0.997089, 0.996415, 0.99567, 0.994855, 0.993969,
-    0.993013, 0.991986, 0.990888, 0.989719, 0.98848, 0.98717,
-    0.985789, 0.984337, 0.982815, 0.981221, 0.979557, 0.977822,
-    0.976016, 0.97414, 0.972193, 0.970175, 0.968087, 0.965928,
-    0.963699, 0.9614, 0.95903, 0.956591, 0.954081, 0.951501,
-    0.948852, 0.946132, 0.943344, 0.940485, 0.937558, 0.934561,
-    0.931495, 0.928361, 0.925158, 0.921886, 0.918546, 0.915138,
-    0.911662, 0.908118, 0.904507, 0.900829, 0.897083, 0.893271,
-    0.889392, 0.885447, 0.881436, 0.877359, 0.873216, 0.869008,
-    0.864735, 0.860397, 0.855995, 0.851529, 0.846999, 0.842405,
-    0.837748, 0.833028, 0.828246, 0.823401, 0.818495, 0.813527,
-    0.808498, 0.803408, 0.798257, 0.793047, 0.787776, 0.782447,
-    0.777058, 0.771611, 0.766106, 0.760543, 0.754923, 0.749245,
-    0.743512, 0.737722, 0.731877, 0.725976, 0.720021, 0.714011,
-    0.707948, 0.701831, 0.695662, 0.689439, 0.683165, 0.67684,
-    0.670464, 0.664037, 0.65756, 0.651033, 0.644458, 0.637834,
-    0.631163, 0.624443, 0.617677, 0.610865, 0.604007, 0.597103,
-    0.590155, 0.583163, 0.576126, 0.569047, 0.561925, 0.554762,
-    0.547557, 0.540311, 0.533025, 0.525699, 0.518334, 0.51093,
-    0.503489, 0.49601, 0.488495, 0.480944, 0.473357, 0.465735,
-    0.458078, 0.450389, 0.442666, 0.43491, 0.427123, 0.419305,
-    0.411456, 0.403577, 0.395669, 0.387732, 0.379767, 0.371775,
-    0.363756, 0.355711
-};
-
-static const float WAVE_EXPONENTIAL_126[DEFAULT_WAVELEN] = {
-    0.52899, 0.524721, 0.52044, 0.516145, 0.511837, 0.507517,
-    0.503185, 0.49884, 0.494483, 0.490113, 0.485732, 0.481339,
-    0.476934, 0.472517, 0.468088, 0.463649, 0.459198, 0.454735,
-    0.450262, 0.445777, 0.441282, 0.436776, 0.43226, 0.427733,
-    0.423195, 0.418647, 0.41409, 0.409522, 0.404944, 0.400357,
-    0.39576, 0.391153, 0.386537, 0.381912, 0.377278, 0.372634,
-    0.367982, 0.363321, 0.358651, 0.353973, 0.349286, 0.344591,
-    0.339888, 0.335177, 0.330458, 0.325732, 0.320997, 0.316255,
-    0.311506, 0.30675, 0.301986, 0.297215, 0.292438, 0.287653,
-    0.282862, 0.278065, 0.273261, 0.268451, 0.263635, 0.258813,
-    0.253984, 0.249151, 0.244311, 0.239466, 0.234616, 0.22976,
-    0.2249, 0.220034, 0.215164, 0.210289, 0.205409, 0.200525,
-    0.195636, 0.190744, 0.185847, 0.180946, 0.176042, 0.171133,
-    0.166222, 0.161307, 0.156388, 0.151466, 0.146542, 0.141614,
-    0.136684, 0.131751, 0.126815, 0.121877, 0.116937, 0.111995,
-    0.10705, 0.102104, 0.0971562, 0.0922067, 0.0872556, 0.0823032,
-    0.0773495, 0.0723947, 0.067439, 0.0624824, 0.0575251, 0.0525673,
-    0.0476089, 0.0426502, 0.0376914, 0.0327324, 0.0277735, 0.0228148,
-    0.0178564, 0.0128984, 0.00794104, 0.00298434, -0.00197155, -0.00692648,
-    -0.0118803, -0.016833, -0.0217843, -0.0267342, -0.0316825, -0.0366291,
-    -0.0415738, -0.0465166, -0.0514573, -0.0563957, -0.0613319, -0.0662655,
-    -0.0711966, -0.0761249, -0.0810504, -0.085973, -0.0908924, -0.0958087,
-    -0.100722, -0.105631, -0.110537, -0.115439, -0.120337, -0.125232,
-    -0.130122, -0.135008, -0.139889, -0.144767, -0.149639, -0.154507,
-    -0.15937, -0.164229, -0.169082, -0.17393, -0.178772, -0.18361,
-    -0.188441, -0.193267, -0.198088, -0.202902, -0.20771, -0.212513,
-    -0.217309, -0.222098, -0.226881, -0.231658, -0.236427, -0.24119,
-    -0.245946, -0.250695, -0.255437, -0.260171, -0.264898, -0.269617,
-    -0.274329, -0.279033, -0.283729, -0.288417, -0.293097, -0.297769,
-    -0.302432, -0.307087, -0.311733, -0.316371, -0.321, -0.32562,
-    -0.330231, -0.334833, -0.339425, -0.344009, -0.348583, -0.353147,
-    -0.357702, -0.362247, -0.366782, -0.371307, -0.375822, -0.380326,
-    -0.384821, -0.389305, -0.393779, -0.398242, -0.402694, -0.407135,
-    -0.411566, -0.415985, -0.420394, -0.424791, -0.429177, -0.433551,
-    -0.437914, -0.442265, -0.446605, -0.450932, -0.455248, -0.459552,
-    -0.463843, -0.468123, -0.47239, -0.476645, -0.480887, -0.485116,
-    -0.489333, -0.493537, -0.497729, -0.501907, -0.506072, -0.510224,
-    -0.514363, -0.518488, -0.5226, -0.526699, -0.530784, -0.534855,
-    -0.538912, -0.542956, -0.546985, -0.551001, -0.555002, -0.55899,
-    -0.562962, -0.566921, -0.570865, -0.574794, -0.578709, -0.582609,
-    -0.586495, -0.590365, -0.594221, -0.598061, -0.601887, -0.605697,
-    -0.609492, -0.613271, -0.617035, -0.620784, -0.624517, -0.628234,
-    -0.631936, -0.635621, -0.639291, -0.642945, -0.646583, -0.650205,
-    -0.653811, -0.6574, -0.660973, -0.66453, -0.668071, -0.671594,
-    -0.675102, -0.678592, -0.682066, -0.685523, -0.688964, -0.692387,
-    -0.695793, -0.699183, -0.702555, -0.70591, -0.709248, -0.712569,
-    -0.715872, -0.719158, -0.722426, -0.725677, -0.728911, -0.732126,
-    -0.735324, -0.738505, -0.741667, -0.744812, -0.747939, -0.751048,
-    -0.754138, -0.757211, -0.760266, -0.763302, -0.766321, -0.769321,
-    -0.772303, -0.775266, -0.778211, -0.781138, -0.784046, -0.786936,
-    -0.789807, -0.792659, -0.795493, -0.798308, -0.801104, -0.803882,
-    -0.80664, -0.80938, -0.812101, -0.814803, -0.817486, -0.82015,
-    -0.822795, -0.825421, -0.828028, -0.830616, -0.833184, -0.835733,
-    -0.838263, -0.840774, -0.843266, -0.845738, -0.84819, -0.850624,
-    -0.853038, -0.855432, -0.857807, -0.860162, -0.862498, -0.864815,
-    -0.867112, -0.869389, -0.871647, -0.873885, -0.876103, -0.878302,
-    -0.880481, -0.88264, -0.884779, -0.886899, -0.888999, -0.891079,
-    -0.89314, -0.89518, -0.897201, -0.899202, -0.901183, -0.903144,
-    -0.905086, -0.907007, -0.908909, -0.91079, -0.912652, -0.914494,
-    -0.916316, -0.918118, -0.9199, -0.921662, -0.923404, -0.925126,
-    -0.926829, -0.928511, -0.930173, -0.931816, -0.933438, -0.935041,
-    -0.936623, -0.938186, -0.939729, -0.941251, -0.942754, -0.944237,
-    -0.9457, -0.947143, -0.948566, -0.949969, -0.951352, -0.952716,
-    -0.954059, -0.955383, -0.956687, -0.957971, -0.959235, -0.960479,
-    -0.961703, -0.962908, -0.964093, -0.965258, -0.966404, -0.967529,
-    -0.968635, -0.969721, -0.970788, -0.971835, -0.972862, -0.97387,
-    -0.974858, -0.975827, -0.976776, -0.977705, -0.978615, -0.979505,
-    -0.980377, -0.981228, -0.98206, -0.982873, -0.983667, -0.984441,
-    -0.985196, -0.985932, -0.986648, -0.987345, -0.988024, -0.988683,
-    -0.989323, -0.989943, -0.990545, -0.991128, -0.991692, -0.992237,
-    -0.992763, -0.99327, -0.993759, -0.994229, -0.99468, -0.995112,
-    -0.995526, -0.995921, -0.996297, -0.996655, -0.996995, -0.997316,
-    -0.997619, -0.997903, -0.998169, -0.998417, -0.998647, -0.998858,
-    -0.999051, -0.999227, -0.999384, -0.999523, -0.999645, -0.999748,
-    -0.999834, -0.999902, -0.999952, -0.999985, -1, -0.999997,
-    -0.999977, -0.99994, -0.999885, -0.999813, -0.999724, -0.999617,
-    -0.999493, -0.999352, -0.999195, -0.99902, -0.998828, -0.998619,
-    -0.998394, -0.998152, -0.997893, -0.997617, -0.997325, -0.997017,
-    -0.996692, -0.996351, -0.995993, -0.995619, -0.995229, -0.994823,
-    -0.994401, -0.993963, -0.993509, -0.99304, -0.992554, -0.992053,
-    -0.991536, -0.991004, -0.990456, -0.989893, -0.989314, -0.98872,
-    -0.988111, -0.987487, -0.986848, -0.986194, -0.985525, -0.984841,
-    -0.984143, -0.983429, -0.982702, -0.981959, -0.981203, -0.980431,
-    -0.979646, -0.978846, -0.978033, -0.977205, -0.976363, -0.975507,
-    -0.974638, -0.973755, -0.972858, -0.971947, -0.971023, -0.970086,
-    -0.969135, -0.968171, -0.967194, -0.966204, -0.965201, -0.964185,
-    -0.963156, -0.962114, -0.96106, -0.959993, -0.958914, -0.957822,
-    -0.956718, -0.955602, -0.954474, -0.953333, -0.952181, -0.951016,
-    -0.94984, -0.948653, -0.947453, -0.946242, -0.94502, -0.943786,
-    -0.942541, -0.941285, -0.940018, -0.93874, -0.937451, -0.936151,
-    -0.93484, -0.933519, -0.932187, -0.930845, -0.929492, -0.92813,
-    -0.926757, -0.925374, -0.923981, -0.922578, -0.921165, -0.919743,
-    -0.918311, -0.91687, -0.915419, -0.913959, -0.912489, -0.911011,
-    -0.909523, -0.908027, -0.906522, -0.905007, -0.903485, -0.901954,
-    -0.900414, -0.898866, -0.89731, -0.895745, -0.894173, -0.892592,
-    -0.891004, -0.889408, -0.887804, -0.886192, -0.884573, -0.882947,
-    -0.881314, -0.879673, -0.878025, -0.87637, -0.874708, -0.87304,
-    -0.871365, -0.869683, -0.867995, -0.8663, -0.864599, -0.862892,
-    -0.861178, -0.859459, -0.857734, -0.856003, -0.854266, -0.852523,
-    -0.850775, -0.849022, -0.847264, -0.8455, -0.843731, -0.841957,
-    -0.840178, -0.838394, -0.836606, -0.834813, -0.833015, -0.831213,
-    -0.829407, -0.827596, -0.825782, -0.823963, -0.82214, -0.820314,
-    -0.818484, -0.81665, -0.814813, -0.812972, -0.811128, -0.809281,
-    -0.80743, -0.805577, -0.803721, -0.801861, -0.799999, -0.798135,
-    -0.796268, -0.794398, -0.792526, -0.790652, -0.788776, -0.786898,
-    -0.785017, -0.783135, -0.781251, -0.779366, -0.777479, -0.77559,
-    -0.7737, -0.771809, -0.769916, -0.768023, -0.766129, -0.764233,
-    -0.762337, -0.76044, -0.758543, -0.756645, -0.754747, -0.752848,
-    -0.75095, -0.749051, -0.747152, -0.745253, -0.743354, -0.741456,
-    -0.739558, -0.73766, -0.735763, -0.733867, -0.731971, -0.730076,
-    -0.728182, -0.726289, -0.724397, -0.722507, -0.720617, -0.718729,
-    -0.716843, -0.714958, -0.713075, -0.711193, -0.709313, -0.707436,
-    -0.70556, -0.703686, -0.701815, -0.699946, -0.698079, -0.696214,
-    -0.694353, -0.692493, -0.690637, -0.688783, -0.686933, -0.685085,
-    -0.68324, -0.681399, -0.679561, -0.677726, -0.675894, -0.674066,
-    -0.672242, -0.670421, -0.668604, -0.666791, -0.664982, -0.663176,
-    -0.661375, -0.659578, -0.657785, -0.655997, -0.654213, -0.652433,
-    -0.650659, -0.648888, -0.647123, -0.645362, -0.643606, -0.641855,
-    -0.64011, -0.638369, -0.636633, -0.634903, -0.633178, -0.631459,
-    -0.629745, -0.628037, -0.626334, -0.624637, -0.622946, -0.621261,
-    -0.619582, -0.617908, -0.616241, -0.61458, -0.612926, -0.611277,
-    -0.609635, -0.608, -0.606371, -0.604748, -0.603133, -0.601524,
-    -0.599921, -0.598326, -0.596738, -0.595156, -0.593582, -0.592015,
-    -0.590455, -0.588902, -0.587357, -0.585819, -0.584288, -0.582765,
-    -0.58125, -0.579742, -0.578242, -0.576749, -0.575265, -0.573788,
-    -0.57232, -0.570859, -0.569406, -0.567962, -0.566526, -0.565098,
-    -0.563678, -0.562267, -0.560864, -0.559469, -0.558083, -0.556706,
-    -0.555337, -0.553977, -0.552625, -0.551283, -0.549949, -0.548624,
-    -0.547308, -0.546001, -0.544703, -0.543414, -0.542134, -0.540864,
-    -0.539602, -0.53835, -0.537108, -0.535874, -0.53465, -0.533436,
-    -0.53223, -0.531035, -0.529849, -0.528673, -0.527506, -0.526349,
-    -0.525202, -0.524064, -0.522937, -0.521819, -0.520711, -0.519613,
-    -0.518525, -0.517447, -0.516379, -0.515321, -0.514274, -0.513236,
-    -0.512209, -0.511191, -0.510184, -0.509188, -0.508201, -0.507225,
-    -0.50626, -0.505304, -0.50436, -0.503425, -0.502501, -0.501588,
-    -0.500685, -0.499793, -0.498911, -0.49804, -0.497179, -0.49633,
-    -0.49549, -0.494662, -0.493844, -0.493037, -0.492241, -0.491456,
-    -0.490681, -0.489917, -0.489164, -0.488422, -0.487691, -0.486971,
-    -0.486261, -0.485563, -0.484875, -0.484198, -0.483533, -0.482878,
-    -0.482234, -0.481602, -0.48098, -0.480369, -0.47977, -0.479181,
-    -0.478603, -0.478037, -0.477481, -0.476937, -0.476403, -0.475881,
-    -0.47537, -0.47487, -0.474381, -0.473903, -0.473436, -0.47298,
-    -0.472536, -0.472102, -0.471679, -0.471268, -0.470868, -0.470479,
-    -0.4701, -0.469733, -0.469377, -0.469032, -0.468699, -0.468376,
-    -0.468064, -0.467763, -0.467474, -0.467195, -0.466927, -0.466671,
-    -0.466425, -0.466191, -0.465967, -0.465754, -0.465553, -0.465362,
-    -0.465182, -0.465013, -0.464855, -0.464708, -0.464572, -0.464446,
-    -0.464332, -0.464228, -0.464135, -0.464053, -0.463981, -0.463921,
-    -0.463871, -0.463831, -0.463803, -0.463785, -0.463777, -0.463781,
-    -0.463794, -0.463819, -0.463854, -0.463899, -0.463955, -0.464021,
-    -0.464098, -0.464185, -0.464283, -0.46439, -0.464508, -0.464637,
-    -0.464775, -0.464924, -0.465083, -0.465252, -0.465432, -0.465621,
-    -0.46582, -0.46603, -0.466249, -0.466478, -0.466717, -0.466966,
-    -0.467225, -0.467494, -0.467772, -0.46806, -0.468358, -0.468665,
-    -0.468982, -0.469308, -0.469644, -0.469989, -0.470344, -0.470708,
-    -0.471081, -0.471464, -0.471856, -0.472257, -0.472667, -0.473087,
-    -0.473515, -0.473952, -0.474398, -0.474854, -0.475318, -0.47579,
-    -0.476272, -0.476762, -0.477261, -0.477768, -0.478284, -0.478809,
-    -0.479342, -0.479883, -0.480432, -0.48099, -0.481556, -0.48213,
-    -0.482712, -0.483303, -0.483901, -0.484507, -0.485121, -0.485743,
-    -0.486372, -0.48701, -0.487654, -0.488307, -0.488967, -0.489634,
-    -0.490309, -0.490991, -0.49168, -0.492377, -0.49308, -0.493791,
-    -0.494508, -0.495233, -0.495964, -0.496703, -0.497447, -0.498199,
-    -0.498957, -0.499722, -0.500493, -0.501271, -0.502054, -0.502845,
-    -0.503641, -0.504443, -0.505252, -0.506066, -0.506886, -0.507712,
-    -0.508544, -0.509382, -0.510225, -0.511074, -0.511928, -0.512787,
-    -0.513652, -0.514522, -0.515398, -0.516278, -0.517163, -0.518054,
-    -0.518949, -0.519849, -0.520753, -0.521663, -0.522576, -0.523495,
-    -0.524417, -0.525344, -0.526276, -0.527211, -0.528151, -0.529094,
-    -0.530041, -0.530993, -0.531948, -0.532906, -0.533869, -0.534834,
-    -0.535804, -0.536776, -0.537752, -0.538731, -0.539713, -0.540698,
-    -0.541686, -0.542677, -0.543671, -0.544667, -0.545666, -0.546667,
-    -0.547671, -0.548678, -0.549686, -0.550697, -0.55171, -0.552724,
-    -0.553741, -0.554759, -0.55578, -0.556802, -0.557825, -0.55885,
-    -0.559876, -0.560904, -0.561933, -0.562963, -0.563994, -0.565026,
-    -0.566059, -0.567092, -0.568126, -0.569161, -0.570197, -0.571233,
-    -0.572269, -0.573305, -0.574342, -0.575378, -0.576415, -0.577451,
-    -0.578488, -0.579524, -0.580559, -0.581594, -0.582629, -0.583663,
-    -0.584696, -0.585728, -0.586759, -0.587789, -0.588819, -0.589847,
-    -0.590873, -0.591899, -0.592922, -0.593945, -0.594965, -0.595984,
-    -0.597001, -0.598016, -0.599029, -0.60004, -0.601048, -0.602055,
-    -0.603059, -0.60406, -0.605059, -0.606055, -0.607048, -0.608039,
-    -0.609026, -0.610011, -0.610992, -0.611971, -0.612945, -0.613917,
-    -0.614885, -0.615849, -0.61681, -0.617767, -0.61872, -0.619669,
-    -0.620614, -0.621555, -0.622491, -0.623424, -0.624351, -0.625275,
-    -0.626193, -0.627107, -0.628017, -0.628921, -0.629821, -0.630715,
-    -0.631604, -0.632488, -0.633367, -0.63424, -0.635108, -0.63597,
-    -0.636826, -0.637677, -0.638521, -0.63936, -0.640193, -0.641019,
-    -0.64184, -0.642654, -0.643461, -0.644263, -0.645057, -0.645845,
-    -0.646626, -0.6474, -0.648167, -0.648928, -0.649681, -0.650427,
-    -0.651165, -0.651897, -0.65262, -0.653337, -0.654045, -0.654746,
-    -0.655439, -0.656124, -0.656801, -0.657471, -0.658131, -0.658784,
-    -0.659428, -0.660064, -0.660692, -0.661311, -0.661921, -0.662522,
-    -0.663115, -0.663699, -0.664273, -0.664839, -0.665396, -0.665943,
-    -0.666481, -0.667009, -0.667528, -0.668038, -0.668537, -0.669027,
-    -0.669508, -0.669978, -0.670438, -0.670889, -0.671329, -0.671759,
-    -0.672178, -0.672588, -0.672987, -0.673375, -0.673753, -0.67412,
-    -0.674476, -0.674822, -0.675156, -0.67548, -0.675792, -0.676094,
-    -0.676384, -0.676663, -0.676931, -0.677187, -0.677432, -0.677665,
-    -0.677886, -0.678096, -0.678294, -0.67848, -0.678655, -0.678817,
-    -0.678967, -0.679105, -0.679231, -0.679345, -0.679446, -0.679535,
-    -0.679611, -0.679675, -0.679727, -0.679765, -0.679791, -0.679804,
-    -0.679804, -0.679792, -0.679766, -0.679727, -0.679675, -0.67961,
-    -0.679532, -0.679441, -0.679336, -0.679217, -0.679086, -0.67894,
-    -0.678781, -0.678609, -0.678422, -0.678222, -0.678008, -0.67778,
-    -0.677538, -0.677283, -0.677013, -0.676729, -0.676431, -0.676118,
-    -0.675792, -0.675451, -0.675096, -0.674726, -0.674342, -0.673943,
-    -0.67353, -0.673102, -0.672659, -0.672202, -0.67173, -0.671243,
-    -0.670741, -0.670224, -0.669693, -0.669146, -0.668584, -0.668007,
-    -0.667415, -0.666808, -0.666186, -0.665548, -0.664895, -0.664227,
-    -0.663544, -0.662845, -0.66213, -0.6614, -0.660654, -0.659893,
-    -0.659117, -0.658324, -0.657516, -0.656692, -0.655853, -0.654997,
-    -0.654126, -0.653239, -0.652336, -0.651417, -0.650483, -0.649532,
-    -0.648565, -0.647582, -0.646583, -0.645568, -0.644537, -0.64349,
-    -0.642427, -0.641347, -0.640251, -0.639139, -0.638011, -0.636866,
-    -0.635705, -0.634528, -0.633334, -0.632124, -0.630897, -0.629655,
-    -0.628395, -0.62712, -0.625827, -0.624519, -0.623193, -0.621852,
-    -0.620493, -0.619118, -0.617727, -0.616319, -0.614894, -0.613453,
-    -0.611995, -0.610521, -0.60903, -0.607522, -0.605998, -0.604457,
-    -0.602899, -0.601325, -0.599734, -0.598126, -0.596502, -0.594861,
-    -0.593203, -0.591528, -0.589837, -0.588129, -0.586405, -0.584663,
-    -0.582905, -0.581131, -0.579339, -0.577531, -0.575707, -0.573865,
-    -0.572007, -0.570132, -0.568241, -0.566333, -0.564408, -0.562466,
-    -0.560508, -0.558534, -0.556542, -0.554534, -0.55251, -0.550469,
-    -0.548411, -0.546337, -0.544246, -0.542139, -0.540015, -0.537874,
-    -0.535717, -0.533544, -0.531354, -0.529148, -0.526926, -0.524687,
-    -0.522431, -0.520159, -0.517871, -0.515567, -0.513246, -0.51091,
-    -0.508556, -0.506187, -0.503802, -0.5014, -0.498982, -0.496548,
-    -0.494098, -0.491632, -0.48915, -0.486652, -0.484138, -0.481608,
-    -0.479062, -0.476501, -0.473923, -0.47133, -0.468721, -0.466096,
-    -0.463456, -0.4608, -0.458128, -0.455441, -0.452738, -0.45002,
-    -0.447286, -0.444537, -0.441772, -0.438993, -0.436198, -0.433387,
-    -0.430562, -0.427721, -0.424865, -0.421994, -0.419109, -0.416208,
-    -0.413292, -0.410361, -0.407416, -0.404456, -0.401481, -0.398491,
-    -0.395487, -0.392468, -0.389435, -0.386387, -0.383325, -0.380249,
-    -0.377158, -0.374053, -0.370934, -0.367801, -0.364653, -0.361492,
-    -0.358317, -0.355127, -0.351924, -0.348707, -0.345477, -0.342233,
-    -0.338975, -0.335704, -0.332419, -0.329121, -0.32581, -0.322485,
-    -0.319147, -0.315796, -0.312432, -0.309055, -0.305665, -0.302262,
-    -0.298846, -0.295418, -0.291977, -0.288524, -0.285057, -0.281579,
-    -0.278088, -0.274585, -0.27107, -0.267542, -0.264003, -0.260451,
-    -0.256888, -0.253313, -0.249726, -0.246127, -0.242517, -0.238895,
-    -0.235262, -0.231618, -0.227962, -0.224295, -0.220617, -0.216928,
-    -0.213228, -0.209517, -0.205795, -0.202063, -0.19832, -0.194566,
-    -0.190802, -0.187028, -0.183243, -0.179449, -0.175644, -0.171829,
-    -0.168004, -0.16417, -0.160325, -0.156471, -0.152608, -0.148735,
-    -0.144853, -0.140961, -0.13706, -0.13315, -0.129231, -0.125304,
-    -0.121367, -0.117422, -0.113468, -0.109505, -0.105535, -0.101555,
-    -0.0975679, -0.0935723, -0.0895687, -0.0855572, -0.0815378, -0.0775107,
-    -0.0734759, -0.0694336, -0.0653839, -0.0613268, -0.0572625, -0.053191,
-    -0.0491125, -0.0450271, -0.0409348, -0.0368358, -0.0327302, -0.0286181,
-    -0.0244995, -0.0203746, -0.0162436, -0.0121064, -0.00796323, -0.00381417,
-    0.000340668, 0.00450118, 0.00866726, 0.0128388, 0.0170157, 0.0211978,
-    0.0253851, 0.0295774, 0.0337747, 0.0379767, 0.0421834, 0.0463948,
-    0.0506106, 0.0548307, 0.0590552, 0.0632837, 0.0675163, 0.0717529,
-    0.0759932, 0.0802373, 0.0844849, 0.088736, 0.0929904, 0.0972481,
-    0.101509, 0.105773, 0.11004, 0.114309, 0.118581, 0.122856,
-    0.127133, 0.131413, 0.135695, 0.139979, 0.144264, 0.148552,
-    0.152842, 0.157133, 0.161425, 0.165719, 0.170014, 0.174311,
-    0.178608, 0.182907, 0.187206, 0.191506, 0.195806, 0.200107,
-    0.204408, 0.20871, 0.213011, 0.217313, 0.221614, 0.225915,
-    0.230216, 0.234516, 0.238816, 0.243115, 0.247413, 0.25171,
-    0.256006, 0.2603, 0.264594, 0.268886, 0.273176, 0.277464,
-    0.281751, 0.286036, 0.290318, 0.294599, 0.298877, 0.303153,
-    0.307426, 0.311696, 0.315964, 0.320229, 0.324491, 0.328749,
-    0.333004, 0.337256, 0.341504, 0.345749, 0.34999, 0.354227,
-    0.35846, 0.362688, 0.366913, 0.371133, 0.375348, 0.379559,
-    0.383766, 0.387967, 0.392163, 0.396354, 0.40054, 0.404721,
-    0.408896, 0.413065, 0.417229, 0.421387, 0.425538, 0.429684,
-    0.433824, 0.437957, 0.442083, 0.446204, 0.450317, 0.454424,
-    0.458523, 0.462616, 0.466701, 0.470779, 0.47485, 0.478913,
-    0.482968, 0.487015, 0.491055, 0.495087, 0.49911, 0.503125,
-    0.507132, 0.51113, 0.515119, 0.5191, 0.523072, 0.527035,
-    0.530989, 0.534933, 0.538868, 0.542794, 0.54671, 0.550617,
-    0.554513, 0.5584, 0.562276, 0.566143, 0.569999, 0.573844,
-    0.577679, 0.581504, 0.585318, 0.58912, 0.592912, 0.596693,
-    0.600462, 0.60422, 0.607967, 0.611702, 0.615425, 0.619137,
-    0.622836, 0.626524, 0.6302, 0.633863, 0.637513, 0.641152,
-    0.644778, 0.648391, 0.651991, 0.655578, 0.659152, 0.662713,
-    0.666261, 0.669795, 0.673316, 0.676824, 0.680317, 0.683797,
-    0.687263, 0.690715, 0.694152, 0.697576, 0.700985, 0.704379,
-    0.707759, 0.711125, 0.714475, 0.717811, 0.721132, 0.724437,
-    0.727728, 0.731003, 0.734263, 0.737507, 0.740735, 0.743948,
-    0.747145, 0.750326, 0.753492, 0.75664, 0.759773, 0.76289,
-    0.76599, 0.769073, 0.77214, 0.77519, 0.778223, 0.78124,
-    0.784239, 0.787221, 0.790187, 0.793134, 0.796065, 0.798978,
-    0.801873, 0.80475, 0.80761, 0.810452, 0.813276, 0.816082,
-    0.81887, 0.82164, 0.824391, 0.827124, 0.829838, 0.832534,
-    0.835211, 0.83787, 0.840509, 0.84313, 0.845731, 0.848314,
-    0.850877, 0.853421, 0.855945, 0.85845, 0.860936, 0.863402,
-    0.865848, 0.868275, 0.870681, 0.873068, 0.875435, 0.877781,
-    0.880108, 0.882414, 0.884699, 0.886965, 0.88921, 0.891434,
-    0.893638, 0.895821, 0.897983, 0.900124, 0.902244, 0.904344,
-    0.906422, 0.908479, 0.910515, 0.91253, 0.914523, 0.916495,
-    0.918445, 0.920374, 0.922281, 0.924166, 0.92603, 0.927872,
-    0.929692, 0.93149, 0.933266, 0.935019, 0.936751, 0.93846,
-    0.940148, 0.941813, 0.943455, 0.945075, 0.946673, 0.948247,
-    0.9498, 0.951329, 0.952836, 0.95432, 0.955782, 0.95722,
-    0.958636, 0.960028, 0.961397, 0.962744, 0.964067, 0.965366,
-    0.966643, 0.967896, 0.969126, 0.970333, 0.971516, 0.972676,
-    0.973812, 0.974924, 0.976013, 0.977078, 0.97812, 0.979138,
-    0.980132, 0.981102, 0.982048, 0.982971, 0.983869, 0.984743,
-    0.985594, 0.98642, 0.987222, 0.988001, 0.988754, 0.989484,
-    0.99019, 0.990871, 0.991528, 0.992161, 0.992769, 0.993353,
-    0.993913, 0.994448, 0.994958, 0.995444, 0.995906, 0.996343,
-    0.996756, 0.997144, 0.997507, 0.997846, 0.99816, 0.998449,
-    0.998714, 0.998954, 0.999169, 0.99936, 0.999526, 0.999667,
-    0.999783, 0.999875, 0.999941, 0.999983, 1, 0.999992,
-    0.999959, 0.999902, 0.999819, 0.999712, 0.99958, 0.999422,
-    0.99924, 0.999033, 0.998801, 0.998544, 0.998263, 0.997956,
-    0.997624, 0.997268, 0.996886, 0.99648, 0.996048, 0.995592,
-    0.995111, 0.994604, 0.994073, 0.993517, 0.992936, 0.992331,
-    0.9917, 0.991044, 0.990364, 0.989658, 0.988928, 0.988173,
-    0.987393, 0.986588, 0.985759, 0.984905, 0.984026, 0.983122,
-    0.982193, 0.98124, 0.980262, 0.979259, 0.978231, 0.977179,
-    0.976102, 0.975001, 0.973875, 0.972725, 0.971549, 0.97035,
-    0.969126, 0.967877, 0.966604, 0.965307, 0.963985, 0.962639,
-    0.961268, 0.959873, 0.958454, 0.957011, 0.955543, 0.954051,
-    0.952535, 0.950995, 0.949431, 0.947843, 0.946231, 0.944595,
-    0.942935, 0.941251, 0.939543, 0.937812, 0.936056, 0.934277,
-    0.932474, 0.930648, 0.928798, 0.926924, 0.925027, 0.923107,
-    0.921163, 0.919196, 0.917205, 0.915191, 0.913154, 0.911094,
-    0.90901, 0.906904, 0.904774, 0.902622, 0.900446, 0.898248,
-    0.896027, 0.893783, 0.891517, 0.889227, 0.886916, 0.884581,
-    0.882225, 0.879846, 0.877444, 0.87502, 0.872574, 0.870106,
-    0.867616, 0.865104, 0.862569, 0.860013, 0.857435, 0.854836,
-    0.852214, 0.849571, 0.846906, 0.84422, 0.841512, 0.838783,
-    0.836033, 0.833262, 0.830469, 0.827655, 0.824821, 0.821965,
-    0.819088, 0.816191, 0.813273, 0.810334, 0.807375, 0.804395,
-    0.801395, 0.798375, 0.795334, 0.792273, 0.789192, 0.786091,
-    0.782971, 0.77983, 0.77667, 0.773489, 0.77029, 0.76707,
-    0.763832, 0.760574, 0.757297, 0.754, 0.750685, 0.74735,
-    0.743997, 0.740625, 0.737234, 0.733824, 0.730396, 0.72695,
-    0.723485, 0.720001, 0.7165, 0.712981, 0.709443, 0.705888,
-    0.702315, 0.698724, 0.695115, 0.691489, 0.687846, 0.684185,
-    0.680507, 0.676812, 0.6731, 0.669371, 0.665625, 0.661863,
-    0.658083, 0.654288, 0.650475, 0.646647, 0.642802, 0.638941,
-    0.635064, 0.631172, 0.627263, 0.623339, 0.619399, 0.615443,
-    0.611472, 0.607486, 0.603485, 0.599469, 0.595437, 0.591391,
-    0.58733, 0.583255, 0.579165, 0.57506, 0.570941, 0.566808,
-    0.562661, 0.5585, 0.554325, 0.550136, 0.545934, 0.541718,
-    0.537489, 0.533246
-};
-
-static const float *WAVE_EXPONENTIALS[DEFAULT_OCTAVES] = {
-    WAVE_EXPONENTIAL_000, WAVE_EXPONENTIAL_006, WAVE_EXPONENTIAL_018,
-    WAVE_EXPONENTIAL_030, WAVE_EXPONENTIAL_042, WAVE_EXPONENTIAL_054,
-    WAVE_EXPONENTIAL_066, WAVE_EXPONENTIAL_078, WAVE_EXPONENTIAL_090,
-    WAVE_EXPONENTIAL_102, WAVE_EXPONENTIAL_114, WAVE_EXPONENTIAL_126
-};
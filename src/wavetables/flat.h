@@ -1,356 +0,0 @@
-/* A flat signal. Wasteful, but an easy envelope solution. */
-
-#pragma once
-
-#include "../constants/defaults.h"
-
-static const float WAVE_FLAT_000[DEFAULT_WAVELEN] = {
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 
-    1, 1
-};
-
-static const float *WAVE_FLATS[DEFAULT_OCTAVES] = {
-    WAVE_FLAT_000, WAVE_FLAT_000, WAVE_FLAT_000, WAVE_FLAT_000,
-    WAVE_FLAT_000, WAVE_FLAT_000, WAVE_FLAT_000, WAVE_FLAT_000,
-    WAVE_FLAT_000, WAVE_FLAT_000, WAVE_FLAT_000, WAVE_FLAT_000
-};
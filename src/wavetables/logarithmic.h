@@ -1,4152 +0,0 @@
-/* A wave of ln x ∈ [0,π]. Intended for envelope use, but can be played. */
-
-#pragma once
-
-#include "../constants/defaults.h"
-
-static const float WAVE_LOGARITHMIC_000[DEFAULT_WAVELEN] = {
-    -1, -0.551116, -0.453189, -0.368782, -0.290314, -0.24818,
-    -0.220709, -0.182361, -0.14899, -0.13118, -0.111258, -0.0852653,
-    -0.0677639, -0.0560404, -0.0382318, -0.0205217, -0.0104454, 0.000526058,
-    0.0160359, 0.0273538, 0.0347648, 0.0461445, 0.0583082, 0.0654676,
-    0.0728857, 0.0838769, 0.0923777, 0.0977939, 0.106025, 0.115334,
-    0.120973, 0.126493, 0.134953, 0.141839, 0.146119, 0.152479,
-    0.160037, 0.164749, 0.169096, 0.175929, 0.181765, 0.185321,
-    0.19044, 0.196806, 0.200898, 0.204455, 0.210148, 0.215243,
-    0.218303, 0.22254, 0.228036, 0.231686, 0.234679, 0.239526,
-    0.244067, 0.246772, 0.25035, 0.25518, 0.258499, 0.261074,
-    0.265265, 0.269374, 0.271816, 0.274885, 0.279183, 0.282246,
-    0.284502, 0.288169, 0.291928, 0.29417, 0.296835, 0.300697,
-    0.303556, 0.305565, 0.308801, 0.312269, 0.314356, 0.316696,
-    0.320191, 0.322882, 0.324695, 0.327573, 0.330793, 0.332758,
-    0.33483, 0.338011, 0.340562, 0.34222, 0.344793, 0.347797,
-    0.349665, 0.351515, 0.354423, 0.356853, 0.358386, 0.360698,
-    0.363511, 0.365301, 0.366966, 0.369633, 0.371958, 0.373391,
-    0.375476, 0.378118, 0.379844, 0.381354, 0.383805, 0.386036,
-    0.387389, 0.389277, 0.391763, 0.393436, 0.394815, 0.397073,
-    0.399219, 0.400507, 0.402222, 0.404565, 0.406193, 0.407462,
-    0.409545, 0.411612, 0.41285, 0.414411, 0.416621, 0.418212,
-    0.419388, 0.421312, 0.423305, 0.424502, 0.425929, 0.428015,
-    0.429573, 0.430671, 0.43245, 0.434373, 0.435538, 0.436846,
-    0.438816, 0.440344, 0.441376, 0.443023, 0.444879, 0.446019,
-    0.447222, 0.449081, 0.450583, 0.451561, 0.453085, 0.454877,
-    0.455997, 0.457107, 0.458863, 0.460339, 0.461273, 0.462684,
-    0.464414, 0.465519, 0.466548, 0.468204, 0.469657, 0.470554,
-    0.471862, 0.47353, 0.474624, 0.475581, 0.477143, 0.478572,
-    0.47944, 0.480654, 0.482261, 0.483347, 0.484242, 0.485714,
-    0.487119, 0.487965, 0.489091, 0.490638, 0.491718, 0.492559,
-    0.493945, 0.495326, 0.496155, 0.497201, 0.498689, 0.499765,
-    0.500559, 0.501863, 0.50322, 0.504036, 0.505009, 0.506439,
-    0.50751, 0.508265, 0.509491, 0.510823, 0.51163, 0.512537,
-    0.513909, 0.514977, 0.515698, 0.51685, 0.518155, 0.518957,
-    0.519804, 0.521118, 0.522183, 0.522876, 0.523958, 0.525236,
-    0.526036, 0.526828, 0.528086, 0.529147, 0.529817, 0.530833,
-    0.532082, 0.532881, 0.533625, 0.534826, 0.535883, 0.536536,
-    0.537489, 0.538707, 0.539509, 0.540209, 0.541355, 0.542407,
-    0.543046, 0.543939, 0.545127, 0.545931, 0.546593, 0.547685,
-    0.54873, 0.549359, 0.550197, 0.551353, 0.552161, 0.552789,
-    0.553827, 0.554865, 0.555488, 0.556274, 0.557396, 0.558209,
-    0.558808, 0.559794, 0.560823, 0.561442, 0.56218, 0.563268,
-    0.564085, 0.564659, 0.565594, 0.566613, 0.567231, 0.567925,
-    0.568977, 0.569798, 0.570352, 0.571238, 0.572245, 0.572864,
-    0.573517, 0.574533, 0.575358, 0.575895, 0.576733, 0.577726,
-    0.578348, 0.578964, 0.579944, 0.580772, 0.581295, 0.582088,
-    0.583066, 0.583692, 0.584274, 0.585216, 0.586048, 0.58656,
-    0.587309, 0.58827, 0.588902, 0.589453, 0.590358, 0.591191,
-    0.591696, 0.592403, 0.593346, 0.593984, 0.594509, 0.595376,
-    0.596209, 0.59671, 0.597377, 0.598299, 0.598945, 0.599446,
-    0.600276, 0.601108, 0.601606, 0.602235, 0.603136, 0.603789,
-    0.60427, 0.605063, 0.605892, 0.60639, 0.606985, 0.607863,
-    0.608523, 0.608986, 0.609742, 0.610567, 0.611068, 0.611629,
-    0.612483, 0.61315, 0.613599, 0.614319, 0.615139, 0.615643,
-    0.616173, 0.617002, 0.617676, 0.618113, 0.618798, 0.61961,
-    0.620119, 0.620622, 0.621425, 0.622105, 0.622533, 0.623183,
-    0.623987, 0.624502, 0.624979, 0.625755, 0.62644, 0.626861,
-    0.627478, 0.628271, 0.628793, 0.629248, 0.629996, 0.630685,
-    0.631103, 0.631687, 0.632469, 0.632998, 0.633432, 0.634152,
-    0.634845, 0.63526, 0.635814, 0.636582, 0.637119, 0.637535,
-    0.638227, 0.638921, 0.639337, 0.639861, 0.640614, 0.64116,
-    0.641561, 0.642224, 0.642918, 0.643336, 0.643832, 0.644569,
-    0.645123, 0.645511, 0.646145, 0.646839, 0.647259, 0.64773,
-    0.648449, 0.649011, 0.649388, 0.649994, 0.650686, 0.651111,
-    0.651558, 0.652258, 0.652827, 0.653196, 0.653774, 0.654462,
-    0.654892, 0.655317, 0.655997, 0.656574, 0.656936, 0.657487,
-    0.658169, 0.658607, 0.659011, 0.65967, 0.660253, 0.660611,
-    0.661135, 0.661811, 0.662256, 0.662642, 0.663279, 0.663868,
-    0.664223, 0.664721, 0.665389, 0.665841, 0.666211, 0.666827,
-    0.667419, 0.667774, 0.668247, 0.668905, 0.669366, 0.669722,
-    0.670314, 0.67091, 0.671266, 0.671716, 0.672362, 0.672832,
-    0.673175, 0.673745, 0.674343, 0.674701, 0.675128, 0.675762,
-    0.67624, 0.676573, 0.677119, 0.677718, 0.678081, 0.678486,
-    0.679107, 0.679593, 0.679917, 0.680441, 0.681039, 0.681406,
-    0.681792, 0.682398, 0.682891, 0.68321, 0.68371, 0.684307,
-    0.68468, 0.685047, 0.685637, 0.686138, 0.686452, 0.686929,
-    0.687523, 0.687903, 0.688253, 0.688826, 0.689334, 0.689644,
-    0.6901, 0.690689, 0.691076, 0.691411, 0.691967, 0.692481,
-    0.69279, 0.693224, 0.693807, 0.694202, 0.694524, 0.695061,
-    0.69558, 0.695889, 0.696302, 0.696878, 0.697281, 0.697591,
-    0.69811, 0.698632, 0.698943, 0.699336, 0.699903, 0.700315,
-    0.700615, 0.701114, 0.70164, 0.701954, 0.702327, 0.702885,
-    0.703304, 0.703596, 0.704076, 0.704603, 0.704921, 0.705277,
-    0.705823, 0.706251, 0.706536, 0.706997, 0.707524, 0.707847,
-    0.708186, 0.708721, 0.709156, 0.709436, 0.709877, 0.710404,
-    0.710733, 0.711056, 0.711578, 0.712021, 0.712297, 0.712718,
-    0.713244, 0.713579, 0.713888, 0.714396, 0.714845, 0.71512,
-    0.715522, 0.716044, 0.716387, 0.716683, 0.717176, 0.717632,
-    0.717905, 0.718289, 0.718807, 0.719157, 0.719442, 0.719919,
-    0.72038, 0.720654, 0.72102, 0.721533, 0.721891, 0.722166,
-    0.722627, 0.723092, 0.723368, 0.723717, 0.724222, 0.724589,
-    0.724855, 0.7253, 0.725768, 0.726047, 0.72638, 0.726877,
-    0.727251, 0.727511, 0.727938, 0.72841, 0.728693, 0.72901,
-    0.729498, 0.72988, 0.730134, 0.730545, 0.731017, 0.731305,
-    0.731607, 0.732085, 0.732475, 0.732725, 0.733119, 0.733591,
-    0.733885, 0.734174, 0.734641, 0.735038, 0.735285, 0.735662,
-    0.736133, 0.736434, 0.73671, 0.737165, 0.737569, 0.737814,
-    0.738175, 0.738644, 0.738952, 0.739217, 0.739659, 0.740069,
-    0.740314, 0.740658, 0.741124, 0.741439, 0.741694, 0.742123,
-    0.742538, 0.742784, 0.743113, 0.743574, 0.743897, 0.744143,
-    0.744558, 0.744978, 0.745226, 0.745539, 0.745995, 0.746325,
-    0.746564, 0.746965, 0.747388, 0.74764, 0.747938, 0.748388,
-    0.748726, 0.748959, 0.749345, 0.749771, 0.750026, 0.750311,
-    0.750752, 0.751098, 0.751326, 0.751697, 0.752125, 0.752385,
-    0.752658, 0.75309, 0.753443, 0.753668, 0.754024, 0.754452,
-    0.754718, 0.754979, 0.755402, 0.755762, 0.755984, 0.756326,
-    0.756753, 0.757026, 0.757275, 0.757688, 0.758054, 0.758276,
-    0.758602, 0.759029, 0.759307, 0.759547, 0.759949, 0.760321,
-    0.760543, 0.760855, 0.761278, 0.761564, 0.761795, 0.762185,
-    0.762563, 0.762785, 0.763083, 0.763504, 0.763797, 0.76402,
-    0.764397, 0.76478, 0.765005, 0.765289, 0.765705, 0.766005,
-    0.766222, 0.766587, 0.766973, 0.767201, 0.767472, 0.767882,
-    0.76819, 0.768402, 0.768753, 0.769142, 0.769374, 0.769634,
-    0.770037, 0.770352, 0.770559, 0.770898, 0.771288, 0.771526,
-    0.771773, 0.772169, 0.772491, 0.772695, 0.77302, 0.773412,
-    0.773655, 0.773892, 0.774279, 0.774608, 0.77481, 0.775122,
-    0.775514, 0.775762, 0.775989, 0.776367, 0.776703, 0.776905,
-    0.777203, 0.777594, 0.777849, 0.778067, 0.778435, 0.778776,
-    0.778978, 0.779264, 0.779653, 0.779914, 0.780125, 0.780482,
-    0.780829, 0.781032, 0.781305, 0.781691, 0.781959, 0.782163,
-    0.782509, 0.78286, 0.783066, 0.783327, 0.783708, 0.783984,
-    0.784182, 0.784517, 0.784872, 0.785081, 0.785329, 0.785706,
-    0.785989, 0.786182, 0.786506, 0.786863, 0.787076, 0.787314,
-    0.787685, 0.787975, 0.788164, 0.788475, 0.788835, 0.789053,
-    0.78928, 0.789644, 0.789941, 0.790128, 0.790427, 0.790788,
-    0.791011, 0.791228, 0.791585, 0.791888, 0.792074, 0.792361,
-    0.792722, 0.792951, 0.793159, 0.793508, 0.793817, 0.794002,
-    0.794277, 0.794638, 0.794873, 0.795073, 0.795413, 0.795728,
-    0.795914, 0.796176, 0.796536, 0.796777, 0.79697, 0.7973,
-    0.797621, 0.797808, 0.798059, 0.798415, 0.798664, 0.798851,
-    0.799171, 0.799495, 0.799685, 0.799925, 0.800278, 0.800533,
-    0.800715, 0.801024, 0.801353, 0.801546, 0.801775, 0.802124,
-    0.802386, 0.802563, 0.802862, 0.803194, 0.80339, 0.803609,
-    0.803953, 0.804221, 0.804396, 0.804684, 0.805017, 0.805218,
-    0.805428, 0.805765, 0.806041, 0.806213, 0.80649, 0.806825,
-    0.807031, 0.807231, 0.807562, 0.807844, 0.808015, 0.80828,
-    0.808616, 0.808828, 0.80902, 0.809343, 0.809631, 0.809802,
-    0.810056, 0.810392, 0.810609, 0.810794, 0.811109, 0.811402,
-    0.811574, 0.811817, 0.812151, 0.812375, 0.812554, 0.81286,
-    0.813158, 0.813331, 0.813564, 0.813896, 0.814126, 0.814299,
-    0.814597, 0.814899, 0.815074, 0.815297, 0.815626, 0.815863,
-    0.816031, 0.816319, 0.816625, 0.816803, 0.817016, 0.817341,
-    0.817584, 0.817749, 0.818026, 0.818336, 0.818518, 0.818721,
-    0.819041, 0.819291, 0.819453, 0.81972, 0.820032, 0.820219,
-    0.820413, 0.820728, 0.820984, 0.821144, 0.821401, 0.821714,
-    0.821906, 0.822091, 0.8224, 0.822663, 0.822821, 0.823068,
-    0.823382, 0.823579, 0.823757, 0.824059, 0.824328, 0.824486,
-    0.824723, 0.825036, 0.825239, 0.825411, 0.825705, 0.825979,
-    0.826138, 0.826365, 0.826677, 0.826886, 0.827052, 0.827338,
-    0.827616, 0.827777, 0.827994, 0.828304, 0.82852, 0.82868,
-    0.828958, 0.829241, 0.829404, 0.829611, 0.829919, 0.83014,
-    0.830296, 0.830565, 0.830852, 0.831018, 0.831216, 0.83152,
-    0.831748, 0.831901, 0.832161, 0.83245, 0.83262, 0.832809,
-    0.833109, 0.833343, 0.833494, 0.833744, 0.834036, 0.83421,
-    0.834391, 0.834686, 0.834926, 0.835075, 0.835315, 0.835609,
-    0.835788, 0.835961, 0.83625, 0.836497, 0.836644, 0.836875,
-    0.83717, 0.837354, 0.83752, 0.837803, 0.838055, 0.838202,
-    0.838424, 0.838718, 0.838908, 0.839068, 0.839344, 0.839601,
-    0.839749, 0.839961, 0.840255, 0.840451, 0.840605, 0.840873,
-    0.841135, 0.841285, 0.841488, 0.84178, 0.841982, 0.842131,
-    0.842392, 0.842658, 0.84281, 0.843004, 0.843293, 0.843501,
-    0.843647, 0.843899, 0.844169, 0.844324, 0.844509, 0.844796,
-    0.84501, 0.845152, 0.845396, 0.845668, 0.845827, 0.846004,
-    0.846287, 0.846507, 0.846647, 0.846882, 0.847157, 0.84732,
-    0.847489, 0.847767, 0.847993, 0.848131, 0.848357, 0.848634,
-    0.848802, 0.848964, 0.849236, 0.849468, 0.849606, 0.849823,
-    0.8501, 0.850273, 0.850429, 0.850695, 0.850933, 0.851071,
-    0.851278, 0.851556, 0.851734, 0.851884, 0.852144, 0.852386,
-    0.852525, 0.852724, 0.853001, 0.853185, 0.853329, 0.853582,
-    0.853829, 0.85397, 0.85416, 0.854436, 0.854626, 0.854765,
-    0.855011, 0.855262, 0.855405, 0.855587, 0.85586, 0.856056,
-    0.856192, 0.85643, 0.856685, 0.85683, 0.857004, 0.857275,
-    0.857476, 0.85761, 0.857839, 0.858097, 0.858246, 0.858412,
-    0.858679, 0.858887, 0.859018, 0.85924, 0.859499, 0.859653,
-    0.859812, 0.860074, 0.860288, 0.860417, 0.86063, 0.860892,
-    0.86105, 0.861202, 0.861459, 0.861678, 0.861808, 0.862012,
-    0.862275, 0.862437, 0.862583, 0.862835, 0.86306, 0.863189,
-    0.863385, 0.863648, 0.863816, 0.863956, 0.864202, 0.864432,
-    0.864562, 0.864749, 0.865012, 0.865185, 0.865321, 0.86556,
-    0.865794, 0.865926, 0.866105, 0.866366, 0.866545, 0.866677,
-    0.866909, 0.867147, 0.867281, 0.867452, 0.867711, 0.867896,
-    0.868024, 0.868249, 0.868491, 0.868628, 0.868791, 0.869048,
-    0.869239, 0.869364, 0.869581, 0.869825, 0.869966, 0.870122,
-    0.870375, 0.870572, 0.870695, 0.870904, 0.871151, 0.871296,
-    0.871445, 0.871694, 0.871896, 0.872018, 0.87222, 0.872468,
-    0.872617, 0.87276, 0.873004, 0.873212, 0.873334, 0.873527,
-    0.873776, 0.87393, 0.874067, 0.874306, 0.874519, 0.874641,
-    0.874826, 0.875076, 0.875235, 0.875367, 0.8756, 0.875818,
-    0.87594, 0.876118, 0.876367, 0.876531, 0.876658, 0.876886,
-    0.877108, 0.877232, 0.877401, 0.87765, 0.877819, 0.877943,
-    0.878163, 0.878389, 0.878516, 0.878678, 0.878924, 0.8791,
-    0.87922, 0.879433, 0.879663, 0.879792, 0.879947, 0.88019,
-    0.880372, 0.880489, 0.880696, 0.880928, 0.881061, 0.881208,
-    0.881449, 0.881636, 0.881752, 0.88195, 0.882185, 0.882322,
-    0.882463, 0.8827, 0.882892, 0.883007, 0.883198, 0.883434,
-    0.883575, 0.88371, 0.883943, 0.88414, 0.884254, 0.884438,
-    0.884675, 0.884821, 0.88495, 0.885178, 0.885381, 0.885495,
-    0.885671, 0.885909, 0.886059, 0.886184, 0.886406, 0.886613,
-    0.886729, 0.886897, 0.887135, 0.88729, 0.887411, 0.887627,
-    0.887838, 0.887956, 0.888116, 0.888353, 0.888514, 0.88863,
-    0.88884, 0.889056, 0.889175, 0.889329, 0.889564, 0.88973,
-    0.889844, 0.890047, 0.890266, 0.890388, 0.890534, 0.890767,
-    0.890939, 0.89105, 0.891246, 0.891468, 0.891594, 0.891734,
-    0.891963, 0.892141, 0.89225, 0.892439, 0.892663, 0.892793,
-    0.892926, 0.893152, 0.893336, 0.893444, 0.893626, 0.893851,
-    0.893985, 0.894113, 0.894335, 0.894523, 0.894631, 0.894805,
-    0.895032, 0.89517, 0.895293, 0.89551, 0.895703, 0.895812,
-    0.895979, 0.896206, 0.896349, 0.896467, 0.896679, 0.896877,
-    0.896986, 0.897146, 0.897373, 0.897521, 0.897634, 0.897841,
-    0.898043, 0.898154, 0.898306, 0.898532, 0.898686, 0.898796,
-    0.898996, 0.899202, 0.899315, 0.899461, 0.899686, 0.899845,
-    0.899952, 0.900145, 0.900355, 0.900471, 0.90061, 0.900832,
-    0.900996, 0.901101, 0.901288, 0.901501, 0.90162, 0.901752,
-    0.901972, 0.902142, 0.902245, 0.902425, 0.90264, 0.902763,
-    0.902889, 0.903105, 0.90328, 0.903383, 0.903556, 0.903772,
-    0.903899, 0.90402, 0.904232, 0.904413, 0.904514, 0.904681,
-    0.904898, 0.90503, 0.905145, 0.905353, 0.905538, 0.905641,
-    0.9058, 0.906018, 0.906154, 0.906265, 0.906468, 0.906658,
-    0.906761, 0.906913, 0.907131, 0.907272, 0.907379, 0.907577,
-    0.90777, 0.907875, 0.908021, 0.908237, 0.908384, 0.908488,
-    0.90868, 0.908877, 0.908984, 0.909123, 0.909338, 0.90949,
-    0.909591, 0.909777, 0.909977, 0.910087, 0.910219, 0.910433,
-    0.91059, 0.910689, 0.910868, 0.911072, 0.911185, 0.911311,
-    0.911521, 0.911684, 0.911781, 0.911954, 0.91216, 0.912276,
-    0.912397, 0.912604, 0.912772, 0.912868, 0.913034, 0.913241,
-    0.913362, 0.913477, 0.913681, 0.913853, 0.91395, 0.914109,
-    0.914317, 0.914443, 0.914553, 0.914752, 0.914929, 0.915026,
-    0.915178, 0.915387, 0.915518, 0.915623, 0.915818, 0.915999,
-    0.916097, 0.916243, 0.916452, 0.916587, 0.916688, 0.916878,
-    0.917064, 0.917163, 0.917302, 0.91751, 0.91765, 0.917749,
-    0.917932, 0.918122, 0.918224, 0.918356, 0.918563, 0.918708,
-    0.918804, 0.918982, 0.919175, 0.919279, 0.919405, 0.91961,
-    0.919761, 0.919854, 0.920026, 0.920222, 0.920329, 0.920449,
-    0.920652, 0.920808, 0.9209, 0.921065, 0.921263, 0.921374,
-    0.921489, 0.921688, 0.921849, 0.921941, 0.922099, 0.922299,
-    0.922414, 0.922523, 0.922719, 0.922885, 0.922976, 0.923128,
-    0.923329, 0.923449, 0.923553, 0.923745, 0.923915, 0.924007,
-    0.924152, 0.924354, 0.924478, 0.924578, 0.924765, 0.92494,
-    0.925033, 0.925172, 0.925373, 0.925503, 0.925599, 0.925781,
-    0.92596, 0.926054, 0.926187, 0.926387, 0.926522, 0.926615,
-    0.926791, 0.926974, 0.927071, 0.927197, 0.927396, 0.927536,
-    0.927626, 0.927797, 0.927983, 0.928082, 0.928202, 0.9284,
-    0.928544, 0.928633, 0.928798, 0.928987, 0.929089, 0.929203,
-    0.929399, 0.929548, 0.929636, 0.929794, 0.929985, 0.930091,
-    0.9302, 0.930392, 0.930547, 0.930634, 0.930786, 0.930978,
-    0.931089, 0.931192, 0.931381, 0.93154, 0.931627, 0.931773,
-    0.931967, 0.932081, 0.93218, 0.932365, 0.932529, 0.932616,
-    0.932756, 0.93295, 0.933069, 0.933164, 0.933344, 0.933513,
-    0.933601, 0.933734, 0.933928, 0.934052, 0.934144, 0.934319,
-    0.934491, 0.934581, 0.934708, 0.934901, 0.93503, 0.935119,
-    0.935289, 0.935465, 0.935557, 0.935677, 0.93587, 0.936004,
-    0.93609, 0.936254, 0.936433, 0.936528, 0.936643, 0.936834,
-    0.936973, 0.937057, 0.937215, 0.937397, 0.937495, 0.937604,
-    0.937793, 0.937937, 0.93802, 0.938172, 0.938356, 0.938458,
-    0.938562, 0.938747, 0.938896, 0.938978, 0.939125, 0.939311,
-    0.939416, 0.939515, 0.939697, 0.939851, 0.939933, 0.940073,
-    0.94026, 0.94037, 0.940464, 0.940642, 0.940801, 0.940883,
-    0.941017, 0.941205, 0.941319, 0.94141, 0.941583, 0.941746,
-    0.94183, 0.941957, 0.942145, 0.942264, 0.942351, 0.94252,
-    0.942687, 0.942772, 0.942894, 0.943081, 0.943205, 0.943289,
-    0.943453, 0.943623, 0.943711, 0.943826, 0.944012, 0.944141,
-    0.944223, 0.944381, 0.944554, 0.944645, 0.944754, 0.944939,
-    0.945073, 0.945153, 0.945305, 0.945481, 0.945575, 0.945679,
-    0.945861, 0.946, 0.946079, 0.946226, 0.946404, 0.946501,
-    0.9466, 0.946779, 0.946923, 0.947001, 0.947142, 0.947322,
-    0.947423, 0.947517, 0.947693, 0.947842, 0.94792, 0.948055,
-    0.948236, 0.948341, 0.948431, 0.948603, 0.948756, 0.948835,
-    0.948963, 0.949145, 0.949255, 0.949341, 0.949509, 0.949666,
-    0.949746, 0.949868, 0.95005, 0.950165, 0.950247, 0.950411,
-    0.950572, 0.950653, 0.95077, 0.950951, 0.95107, 0.95115,
-    0.951308, 0.951473, 0.951557, 0.951667, 0.951848, 0.951972,
-    0.95205, 0.952202, 0.95237, 0.952457, 0.952562, 0.95274,
-    0.952869, 0.952945, 0.953093, 0.953263, 0.953353, 0.953452,
-    0.953629, 0.953763, 0.953838, 0.953979, 0.954152, 0.954245,
-    0.95434, 0.954513, 0.954652, 0.954726, 0.954862, 0.955037,
-    0.955133, 0.955224, 0.955394, 0.955537, 0.955612, 0.955741,
-    0.955917, 0.956018, 0.956104, 0.956271, 0.956419, 0.956494,
-    0.956617, 0.956794, 0.956899, 0.956981, 0.957144, 0.957296,
-    0.957372, 0.95749, 0.957666, 0.957776, 0.957855, 0.958013,
-    0.958169, 0.958247, 0.958359, 0.958534, 0.958649, 0.958726,
-    0.958878, 0.959038, 0.959118, 0.959224, 0.959399, 0.959519,
-    0.959593, 0.959741, 0.959903, 0.959986, 0.960087, 0.96026,
-    0.960385, 0.960457, 0.960599, 0.960765, 0.96085, 0.960946,
-    0.961117, 0.961246, 0.961318, 0.961454, 0.961622, 0.961711,
-    0.961802, 0.96197, 0.962105, 0.962175, 0.962306, 0.962475,
-    0.962568, 0.962654, 0.96282, 0.962959, 0.963029, 0.963154,
-    0.963325, 0.963422, 0.963504, 0.963666, 0.963809, 0.96388,
-    0.964, 0.964171, 0.964273, 0.964351, 0.964508, 0.964656,
-    0.964728, 0.964842, 0.965013, 0.965119, 0.965194, 0.965347,
-    0.965499, 0.965573, 0.96568, 0.965851, 0.965962, 0.966035,
-    0.966183, 0.966338, 0.966414, 0.966516, 0.966686, 0.966802,
-    0.966872, 0.967015, 0.967173, 0.967252, 0.967349, 0.967517,
-    0.967638, 0.967707, 0.967844, 0.968005, 0.968087, 0.968179,
-    0.968345, 0.96847, 0.968538, 0.96867, 0.968833, 0.968919,
-    0.969005, 0.969169, 0.969299, 0.969366, 0.969493, 0.969658,
-    0.969747, 0.969829, 0.96999, 0.970125, 0.970192, 0.970312,
-    0.970479, 0.970572, 0.97065, 0.970807, 0.970946, 0.971014,
-    0.971129, 0.971296, 0.971394, 0.971468, 0.971621, 0.971765,
-    0.971834, 0.971943, 0.97211, 0.972212, 0.972283, 0.972432,
-    0.972579, 0.97265, 0.972753, 0.97292, 0.973027, 0.973096,
-    0.97324, 0.973391, 0.973463, 0.973561, 0.973727, 0.973839,
-    0.973905, 0.974044, 0.974198, 0.974274, 0.974366, 0.97453,
-    0.974647, 0.974712, 0.974846, 0.975002, 0.975081, 0.975168,
-    0.97533, 0.975452, 0.975516, 0.975644, 0.975803, 0.975885,
-    0.975968, 0.976127, 0.976254, 0.976317, 0.97644, 0.9766,
-    0.976686, 0.976765, 0.976921, 0.977052, 0.977116, 0.977232,
-    0.977394, 0.977484, 0.977559, 0.977712, 0.977847, 0.977911,
-    0.978022, 0.978185, 0.978279, 0.97835, 0.978499, 0.978639,
-    0.978704, 0.978809, 0.978972, 0.979071, 0.979139, 0.979283,
-    0.979427, 0.979494, 0.979594, 0.979756, 0.97986, 0.979925,
-    0.980065, 0.980212, 0.980281, 0.980376, 0.980537, 0.980646,
-    0.980709, 0.980843, 0.980994, 0.981066, 0.981155, 0.981315,
-    0.981428, 0.98149, 0.981619, 0.981772, 0.981847, 0.981931,
-    0.982089, 0.982207, 0.982268, 0.982392, 0.982547, 0.982626,
-    0.982705, 0.98286, 0.982983, 0.983044, 0.983162, 0.983319,
-    0.983402, 0.983477, 0.983629, 0.983756, 0.983817, 0.98393,
-    0.984088, 0.984175, 0.984246, 0.984394, 0.984526, 0.984587,
-    0.984695, 0.984853, 0.984944, 0.985012, 0.985157, 0.985293,
-    0.985355, 0.985457, 0.985616, 0.985711, 0.985776, 0.985917,
-    0.986057, 0.986121, 0.986217, 0.986375, 0.986476, 0.986538,
-    0.986673, 0.986817, 0.986883, 0.986974, 0.987131, 0.987237,
-    0.987297, 0.987428, 0.987574, 0.987643, 0.987729, 0.987885,
-    0.987995, 0.988053, 0.988179, 0.988328, 0.988401, 0.988481,
-    0.988635, 0.98875, 0.988808, 0.988928, 0.98908, 0.989155,
-    0.989231, 0.989383, 0.989502, 0.989559, 0.989674, 0.989828,
-    0.989907, 0.989979, 0.990127, 0.990252, 0.990309, 0.990418,
-    0.990573, 0.990656, 0.990724, 0.990869, 0.990998, 0.991056,
-    0.99116, 0.991315, 0.991403, 0.991467, 0.991608, 0.991741,
-    0.9918, 0.991899, 0.992054, 0.992147, 0.992208, 0.992345,
-    0.992482, 0.992543, 0.992635, 0.99279, 0.992888, 0.992946,
-    0.993079, 0.993219, 0.993282, 0.993369, 0.993523, 0.993626,
-    0.993682, 0.99381, 0.993953, 0.994019, 0.994101, 0.994254,
-    0.994361, 0.994416, 0.994539, 0.994685, 0.994754, 0.994831,
-    0.994982, 0.995094, 0.995148, 0.995265, 0.995413, 0.995486,
-    0.995559, 0.995707, 0.995823, 0.995877, 0.995989, 0.996139,
-    0.996215, 0.996284, 0.996429, 0.99655, 0.996605, 0.99671,
-    0.996862, 0.996942, 0.997007, 0.997149, 0.997274, 0.997329,
-    0.99743, 0.997582, 0.997667, 0.997728, 0.997866, 0.997996,
-    0.998052, 0.998147, 0.998299, 0.998389, 0.998447, 0.99858,
-    0.998714, 0.998772, 0.998861, 0.999013, 0.999108, 0.999164,
-    0.999292, 0.99943, 0.999491, 0.999574, 0.999724, 0.999825,
-    0.999879, 1
-};
-
-static const float WAVE_LOGARITHMIC_006[DEFAULT_WAVELEN] = {
-    -1, -0.6545, -0.489904, -0.404418, -0.34421, -0.293024,
-    -0.257625, -0.220193, -0.195928, -0.165941, -0.147981, -0.122683,
-    -0.108762, -0.086705, -0.0755758, -0.0559083, -0.0468089, -0.0289895,
-    -0.0214188, -0.00508299, 0.00130721, 0.0164156, 0.0218779, 0.0359449,
-    0.040669, 0.0538337, 0.057966, 0.0703345, 0.0739906, 0.0856458,
-    0.0889188, 0.0999262, 0.102892, 0.113305, 0.116027, 0.125887,
-    0.128418, 0.137763, 0.140147, 0.149006, 0.151282, 0.15968,
-    0.161879, 0.169839, 0.171989, 0.179531, 0.181655, 0.188796,
-    0.190915, 0.19767, 0.1998, 0.206185, 0.208341, 0.214369,
-    0.216563, 0.222247, 0.224489, 0.229841, 0.232138, 0.237171,
-    0.23953, 0.244255, 0.246681, 0.25111, 0.253605, 0.25775,
-    0.260317, 0.264189, 0.266828, 0.270438, 0.27315, 0.27651,
-    0.279293, 0.282415, 0.285265, 0.288161, 0.291077, 0.293758,
-    0.296736, 0.299214, 0.302249, 0.304536, 0.307623, 0.309731,
-    0.312864, 0.314806, 0.317979, 0.319766, 0.322973, 0.324617,
-    0.327851, 0.329363, 0.332618, 0.334011, 0.337279, 0.338563,
-    0.341837, 0.343025, 0.346297, 0.3474, 0.350663, 0.351691,
-    0.354939, 0.355903, 0.359127, 0.360038, 0.363231, 0.364099,
-    0.367254, 0.368088, 0.3712, 0.372009, 0.37507, 0.375864,
-    0.378868, 0.379655, 0.382597, 0.383384, 0.386258, 0.387054,
-    0.389855, 0.390665, 0.393389, 0.394221, 0.396862, 0.397721,
-    0.400277, 0.401169, 0.403636, 0.404565, 0.406941, 0.407911,
-    0.410194, 0.411208, 0.413395, 0.414457, 0.416548, 0.41766,
-    0.419654, 0.420818, 0.422714, 0.423931, 0.42573, 0.427001,
-    0.428703, 0.430029, 0.431636, 0.433015, 0.434528, 0.43596,
-    0.437382, 0.438866, 0.440199, 0.441733, 0.44298, 0.444561,
-    0.445726, 0.447352, 0.448438, 0.450107, 0.451118, 0.452826,
-    0.453765, 0.455509, 0.456383, 0.458158, 0.45897, 0.460773,
-    0.461528, 0.463355, 0.464058, 0.465904, 0.466561, 0.468421,
-    0.469037, 0.470907, 0.471487, 0.473363, 0.473912, 0.475788,
-    0.476312, 0.478184, 0.478689, 0.480552, 0.481041, 0.482891,
-    0.483371, 0.485202, 0.485678, 0.487487, 0.487963, 0.489745,
-    0.490226, 0.491978, 0.492468, 0.494185, 0.494689, 0.496368,
-    0.496889, 0.498527, 0.49907, 0.500663, 0.50123, 0.502775,
-    0.50337, 0.504866, 0.505491, 0.506935, 0.507593, 0.508983,
-    0.509676, 0.51101, 0.51174, 0.513018, 0.513785, 0.515006,
-    0.515812, 0.516975, 0.51782, 0.518926, 0.519811, 0.520858,
-    0.521783, 0.522774, 0.523738, 0.524672, 0.525675, 0.526554,
-    0.527595, 0.52842, 0.529497, 0.530271, 0.531382, 0.532106,
-    0.533251, 0.533926, 0.535102, 0.535732, 0.536936, 0.537524,
-    0.538754, 0.539303, 0.540556, 0.541068, 0.542341, 0.54282,
-    0.54411, 0.544559, 0.545864, 0.546286, 0.547601, 0.548001,
-    0.549323, 0.549704, 0.55103, 0.551395, 0.552722, 0.553075,
-    0.554398, 0.554743, 0.55606, 0.5564, 0.557708, 0.558047,
-    0.559341, 0.559682, 0.560961, 0.561307, 0.562566, 0.562922,
-    0.564159, 0.564525, 0.565738, 0.566119, 0.567304, 0.567702,
-    0.568857, 0.569275, 0.570398, 0.570838, 0.571926, 0.572391,
-    0.573443, 0.573933, 0.574949, 0.575466, 0.576442, 0.576989,
-    0.577925, 0.578501, 0.579397, 0.580004, 0.580859, 0.581497,
-    0.58231, 0.582979, 0.583752, 0.584452, 0.585183, 0.585915,
-    0.586606, 0.587368, 0.588019, 0.588811, 0.589423, 0.590244,
-    0.590818, 0.591667, 0.592205, 0.59308, 0.593583, 0.594484,
-    0.594954, 0.595877, 0.596316, 0.597261, 0.597671, 0.598635,
-    0.599019, 0.599999, 0.600359, 0.601354, 0.601692, 0.602699,
-    0.603018, 0.604034, 0.604337, 0.60536, 0.605649, 0.606677,
-    0.606955, 0.607984, 0.608254, 0.609282, 0.609547, 0.61057,
-    0.610833, 0.61185, 0.612113, 0.613121, 0.613387, 0.614383,
-    0.614654, 0.615637, 0.615916, 0.616882, 0.617171, 0.618118,
-    0.61842, 0.619347, 0.619663, 0.620567, 0.6209, 0.62178,
-    0.622131, 0.622984, 0.623356, 0.624182, 0.624574, 0.625371,
-    0.625787, 0.626554, 0.626993, 0.62773, 0.628193, 0.628898,
-    0.629387, 0.63006, 0.630575, 0.631216, 0.631757, 0.632365,
-    0.632932, 0.633508, 0.6341, 0.634645, 0.635263, 0.635776,
-    0.636419, 0.636901, 0.637568, 0.638021, 0.638711, 0.639136,
-    0.639848, 0.640245, 0.640978, 0.641349, 0.642101, 0.642449,
-    0.643218, 0.643543, 0.644328, 0.644633, 0.645432, 0.645718,
-    0.64653, 0.646798, 0.64762, 0.647874, 0.648705, 0.648946,
-    0.649782, 0.650014, 0.650854, 0.651077, 0.651919, 0.652136,
-    0.652977, 0.653192, 0.65403, 0.654243, 0.655076, 0.65529,
-    0.656116, 0.656333, 0.65715, 0.657372, 0.658178, 0.658407,
-    0.6592, 0.659439, 0.660216, 0.660466, 0.661226, 0.661489,
-    0.662231, 0.662509, 0.663231, 0.663524, 0.664225, 0.664535,
-    0.665213, 0.665542, 0.666197, 0.666546, 0.667176, 0.667544,
-    0.668149, 0.668539, 0.669118, 0.66953, 0.670082, 0.670516,
-    0.671042, 0.671498, 0.671998, 0.672476, 0.672949, 0.673449,
-    0.673896, 0.674417, 0.674839, 0.675381, 0.675778, 0.676341,
-    0.676713, 0.677296, 0.677645, 0.678247, 0.678573, 0.679192,
-    0.679497, 0.680133, 0.680419, 0.68107, 0.681337, 0.682001,
-    0.682251, 0.682928, 0.683163, 0.68385, 0.684072, 0.684768,
-    0.684977, 0.68568, 0.68588, 0.686588, 0.68678, 0.687491,
-    0.687677, 0.68839, 0.688571, 0.689283, 0.689462, 0.690173,
-    0.690351, 0.691057, 0.691237, 0.691937, 0.69212, 0.692812,
-    0.693001, 0.693684, 0.693879, 0.69455, 0.694754, 0.695413,
-    0.695626, 0.696271, 0.696496, 0.697125, 0.697363, 0.697975,
-    0.698227, 0.698821, 0.699088, 0.699663, 0.699947, 0.700501,
-    0.700802, 0.701335, 0.701655, 0.702166, 0.702504, 0.702994,
-    0.70335, 0.703818, 0.704194, 0.704639, 0.705034, 0.705456,
-    0.705871, 0.706271, 0.706704, 0.707082, 0.707535, 0.70789,
-    0.708362, 0.708696, 0.709185, 0.709499, 0.710005, 0.710299,
-    0.710822, 0.711097, 0.711635, 0.711892, 0.712445, 0.712685,
-    0.713251, 0.713476, 0.714053, 0.714264, 0.714852, 0.71505,
-    0.715647, 0.715834, 0.716439, 0.716616, 0.717226, 0.717395,
-    0.71801, 0.718173, 0.718791, 0.718949, 0.719568, 0.719722,
-    0.720341, 0.720494, 0.721111, 0.721264, 0.721877, 0.722032,
-    0.72264, 0.722798, 0.723399, 0.723562, 0.724154, 0.724324,
-    0.724907, 0.725084, 0.725656, 0.725843, 0.726401, 0.726599,
-    0.727144, 0.727353, 0.727883, 0.728105, 0.728619, 0.728855,
-    0.729352, 0.729603, 0.730083, 0.730349, 0.73081, 0.731092,
-    0.731535, 0.731833, 0.732257, 0.732572, 0.732976, 0.733309,
-    0.733693, 0.734043, 0.734407, 0.734775, 0.735119, 0.735504,
-    0.735829, 0.73623, 0.736537, 0.736954, 0.737242, 0.737676,
-    0.737945, 0.738394, 0.738647, 0.73911, 0.739346, 0.739823,
-    0.740044, 0.740534, 0.74074, 0.741241, 0.741434, 0.741946,
-    0.742127, 0.742648, 0.742817, 0.743346, 0.743507, 0.744042,
-    0.744195, 0.744735, 0.744881, 0.745425, 0.745566, 0.746113,
-    0.746249, 0.746797, 0.746931, 0.747478, 0.747611, 0.748157,
-    0.74829, 0.748832, 0.748968, 0.749505, 0.749644, 0.750175,
-    0.750319, 0.750842, 0.750993, 0.751507, 0.751665, 0.752169,
-    0.752335, 0.752828, 0.753004, 0.753484, 0.753672, 0.754138,
-    0.754337, 0.75479, 0.755002, 0.755439, 0.755664, 0.756086,
-    0.756325, 0.756731, 0.756985, 0.757373, 0.757642, 0.758014,
-    0.758298, 0.758652, 0.758952, 0.759288, 0.759603, 0.759923,
-    0.760253, 0.760555, 0.760901, 0.761186, 0.761547, 0.761815,
-    0.762191, 0.762442, 0.762833, 0.763068, 0.763472, 0.763692,
-    0.764109, 0.764315, 0.764744, 0.764937, 0.765377, 0.765557,
-    0.766008, 0.766175, 0.766636, 0.766793, 0.767261, 0.767409,
-    0.767885, 0.768024, 0.768506, 0.768638, 0.769124, 0.769251,
-    0.76974, 0.769863, 0.770354, 0.770474, 0.770965, 0.771083,
-    0.771574, 0.771692, 0.772181, 0.772299, 0.772785, 0.772906,
-    0.773387, 0.773511, 0.773987, 0.774115, 0.774584, 0.774719,
-    0.775179, 0.775321, 0.775772, 0.775922, 0.776362, 0.776522,
-    0.776951, 0.77712, 0.777537, 0.777718, 0.778122, 0.778314,
-    0.778704, 0.778909, 0.779285, 0.779502, 0.779864, 0.780094,
-    0.780441, 0.780685, 0.781016, 0.781275, 0.781589, 0.781862,
-    0.782161, 0.782449, 0.782732, 0.783033, 0.783301, 0.783616,
-    0.783868, 0.784198, 0.784434, 0.784777, 0.784999, 0.785355,
-    0.785563, 0.785931, 0.786125, 0.786505, 0.786687, 0.787078,
-    0.787247, 0.787648, 0.787806, 0.788217, 0.788364, 0.788783,
-    0.788921, 0.789348, 0.789478, 0.78991, 0.790033, 0.790471,
-    0.790587, 0.791029, 0.791141, 0.791586, 0.791694, 0.79214,
-    0.792246, 0.792693, 0.792797, 0.793243, 0.793347, 0.793791,
-    0.793897, 0.794338, 0.794446, 0.794882, 0.794994, 0.795425,
-    0.795541, 0.795965, 0.796087, 0.796504, 0.796633, 0.797041,
-    0.797177, 0.797576, 0.797721, 0.798109, 0.798264, 0.79864,
-    0.798806, 0.79917, 0.799346, 0.799698, 0.799886, 0.800225,
-    0.800425, 0.80075, 0.800962, 0.801274, 0.801499, 0.801796,
-    0.802034, 0.802316, 0.802568, 0.802836, 0.803101, 0.803354,
-    0.803632, 0.803871, 0.804162, 0.804387, 0.80469, 0.804901,
-    0.805217, 0.805415, 0.805743, 0.805928, 0.806267, 0.80644,
-    0.80679, 0.80695, 0.807311, 0.80746, 0.80783, 0.80797,
-    0.808347, 0.808478, 0.808863, 0.808986, 0.809378, 0.809492,
-    0.80989, 0.809999, 0.810401, 0.810504, 0.81091, 0.811009,
-    0.811417, 0.811513, 0.811923, 0.812017, 0.812427, 0.81252,
-    0.812929, 0.813023, 0.813429, 0.813524, 0.813928, 0.814026,
-    0.814425, 0.814526, 0.81492, 0.815026, 0.815414, 0.815525,
-    0.815906, 0.816024, 0.816396, 0.816522, 0.816885, 0.817019,
-    0.817373, 0.817515, 0.817858, 0.818011, 0.818343, 0.818506,
-    0.818826, 0.819, 0.819308, 0.819493, 0.819788, 0.819985,
-    0.820267, 0.820476, 0.820745, 0.820966, 0.821222, 0.821456,
-    0.821698, 0.821944, 0.822172, 0.822431, 0.822646, 0.822916,
-    0.823119, 0.823401, 0.823591, 0.823884, 0.824062, 0.824366,
-    0.824532, 0.824847, 0.825001, 0.825326, 0.82547, 0.825804,
-    0.825938, 0.826281, 0.826405, 0.826756, 0.826872, 0.827229,
-    0.827338, 0.827702, 0.827804, 0.828172, 0.828269, 0.828641,
-    0.828733, 0.829109, 0.829197, 0.829575, 0.829661, 0.83004,
-    0.830124, 0.830503, 0.830587, 0.830965, 0.831049, 0.831425,
-    0.831511, 0.831883, 0.831972, 0.83234, 0.832433, 0.832796,
-    0.832893, 0.83325, 0.833353, 0.833703, 0.833812, 0.834154,
-    0.83427, 0.834604, 0.834728, 0.835053, 0.835186, 0.835501,
-    0.835643, 0.835947, 0.836099, 0.836392, 0.836554, 0.836836,
-    0.837009, 0.837278, 0.837463, 0.83772, 0.837916, 0.838161,
-    0.838368, 0.8386, 0.838819, 0.839039, 0.839269, 0.839477,
-    0.839719, 0.839914, 0.840167, 0.840351, 0.840614, 0.840786,
-    0.841061, 0.841221, 0.841506, 0.841655, 0.84195, 0.842089,
-    0.842393, 0.842522, 0.842834, 0.842954, 0.843274, 0.843386,
-    0.843713, 0.843817, 0.844151, 0.844248, 0.844588, 0.844679,
-    0.845023, 0.845109, 0.845457, 0.845539, 0.845889, 0.845968,
-    0.84632, 0.846397, 0.84675, 0.846826, 0.847178, 0.847254,
-    0.847605, 0.847682, 0.848031, 0.848109, 0.848456, 0.848537,
-    0.848879, 0.848963, 0.8493, 0.84939, 0.849721, 0.849816,
-    0.85014, 0.850241, 0.850558, 0.850666, 0.850975, 0.851091,
-    0.851391, 0.851515, 0.851806, 0.851939, 0.852219, 0.852362,
-    0.852632, 0.852784, 0.853043, 0.853206, 0.853454, 0.853627,
-    0.853864, 0.854048, 0.854272, 0.854467, 0.85468, 0.854886,
-    0.855087, 0.855304, 0.855494, 0.855721, 0.8559, 0.856138,
-    0.856305, 0.856553, 0.856709, 0.856968, 0.857113, 0.857381,
-    0.857516, 0.857793, 0.857919, 0.858205, 0.858321, 0.858615,
-    0.858723, 0.859024, 0.859125, 0.859432, 0.859526, 0.859839,
-    0.859926, 0.860245, 0.860327, 0.86065, 0.860727, 0.861053,
-    0.861127, 0.861455, 0.861526, 0.861856, 0.861925, 0.862256,
-    0.862324, 0.862654, 0.862723, 0.863052, 0.863121, 0.863448,
-    0.863519, 0.863843, 0.863917, 0.864237, 0.864315, 0.864629,
-    0.864712, 0.865021, 0.865109, 0.865411, 0.865505, 0.865801,
-    0.865902, 0.866189, 0.866297, 0.866576, 0.866693, 0.866963,
-    0.867088, 0.867348, 0.867482, 0.867732, 0.867876, 0.868116,
-    0.868269, 0.868499, 0.868662, 0.86888, 0.869054, 0.869262,
-    0.869446, 0.869642, 0.869837, 0.870022, 0.870227, 0.870401,
-    0.870616, 0.870779, 0.871005, 0.871157, 0.871393, 0.871535,
-    0.87178, 0.871912, 0.872166, 0.872288, 0.872551, 0.872664,
-    0.872935, 0.87304, 0.873318, 0.873415, 0.8737, 0.87379,
-    0.874081, 0.874165, 0.874462, 0.87454, 0.874841, 0.874914,
-    0.875219, 0.875288, 0.875596, 0.875662, 0.875971, 0.876035,
-    0.876346, 0.876408, 0.87672, 0.876782, 0.877092, 0.877155,
-    0.877464, 0.877527, 0.877834, 0.8779, 0.878204, 0.878272,
-    0.878572, 0.878644, 0.878939, 0.879016, 0.879305, 0.879387,
-    0.879671, 0.879759, 0.880035, 0.88013, 0.880398, 0.8805,
-    0.880761, 0.880871, 0.881122, 0.88124, 0.881483, 0.88161,
-    0.881843, 0.881979, 0.882202, 0.882348, 0.88256, 0.882716,
-    0.882918, 0.883083, 0.883275, 0.88345, 0.883631, 0.883817,
-    0.883987, 0.884182, 0.884342, 0.884547, 0.884697, 0.884912,
-    0.885051, 0.885275, 0.885405, 0.885638, 0.885758, 0.886,
-    0.886112, 0.886361, 0.886464, 0.886721, 0.886817, 0.887081,
-    0.887169, 0.887439, 0.887521, 0.887797, 0.887872, 0.888154,
-    0.888224, 0.888509, 0.888575, 0.888864, 0.888926, 0.889218,
-    0.889277, 0.88957, 0.889628, 0.889922, 0.889978, 0.890273,
-    0.890329, 0.890623, 0.890679, 0.890971, 0.891029, 0.891319,
-    0.891379, 0.891666, 0.891729, 0.892012, 0.892079, 0.892357,
-    0.892428, 0.892701, 0.892777, 0.893044, 0.893126, 0.893386,
-    0.893475, 0.893727, 0.893824, 0.894068, 0.894172, 0.894408,
-    0.89452, 0.894747, 0.894867, 0.895085, 0.895215, 0.895422,
-    0.895561, 0.895759, 0.895908, 0.896096, 0.896253, 0.896431,
-    0.896599, 0.896766, 0.896944, 0.897101, 0.897288, 0.897435,
-    0.897631, 0.897769, 0.897974, 0.898102, 0.898316, 0.898435,
-    0.898658, 0.898768, 0.898999, 0.8991, 0.899339, 0.899432,
-    0.899678, 0.899764, 0.900016, 0.900096, 0.900354, 0.900427,
-    0.900691, 0.900759, 0.901027, 0.90109, 0.901362, 0.901421,
-    0.901696, 0.901751, 0.902029, 0.902082, 0.902361, 0.902413,
-    0.902693, 0.902743, 0.903023, 0.903074, 0.903353, 0.903404,
-    0.903681, 0.903734, 0.904009, 0.904064, 0.904336, 0.904394,
-    0.904662, 0.904724, 0.904987, 0.905054, 0.905311, 0.905383,
-    0.905635, 0.905713, 0.905957, 0.906042, 0.906279, 0.906371,
-    0.9066, 0.906699, 0.906921, 0.907028, 0.90724, 0.907356,
-    0.907559, 0.907683, 0.907878, 0.908011, 0.908196, 0.908338,
-    0.908513, 0.908664, 0.90883, 0.90899, 0.909146, 0.909316,
-    0.909462, 0.909641, 0.909778, 0.909966, 0.910093, 0.910289,
-    0.910407, 0.910613, 0.910722, 0.910935, 0.911036, 0.911257,
-    0.91135, 0.911579, 0.911664, 0.911899, 0.911977, 0.912219,
-    0.91229, 0.912538, 0.912604, 0.912856, 0.912917, 0.913173,
-    0.91323, 0.91349, 0.913543, 0.913806, 0.913855, 0.914121,
-    0.914168, 0.914435, 0.914481, 0.914748, 0.914793, 0.91506,
-    0.915106, 0.915372, 0.915418, 0.915682, 0.915731, 0.915992,
-    0.916043, 0.916301, 0.916355, 0.91661, 0.916667, 0.916917,
-    0.916979, 0.917224, 0.917291, 0.917529, 0.917603, 0.917835,
-    0.917915, 0.918139, 0.918226, 0.918443, 0.918537, 0.918746,
-    0.918848, 0.919049, 0.919159, 0.91935, 0.919469, 0.919652,
-    0.91978, 0.919953, 0.920089, 0.920253, 0.920399, 0.920553,
-    0.920707, 0.920852, 0.921016, 0.921152, 0.921324, 0.92145,
-    0.921631, 0.921749, 0.921938, 0.922047, 0.922244, 0.922345,
-    0.92255, 0.922642, 0.922855, 0.92294, 0.92316, 0.923237,
-    0.923463, 0.923534, 0.923767, 0.923831, 0.924069, 0.924128,
-    0.92437, 0.924425, 0.924671, 0.924722, 0.924971, 0.925018,
-    0.925271, 0.925315, 0.925569, 0.925611, 0.925867, 0.925908,
-    0.926164, 0.926204, 0.92646, 0.926501, 0.926755, 0.926797,
-    0.92705, 0.927094, 0.927344, 0.92739, 0.927637, 0.927687,
-    0.927929, 0.927983, 0.928221, 0.928279, 0.928511, 0.928575,
-    0.928802, 0.928871, 0.929091, 0.929167, 0.92938, 0.929463,
-    0.929668, 0.929758, 0.929956, 0.930054, 0.930243, 0.930349,
-    0.930529, 0.930644, 0.930815, 0.930938, 0.931101, 0.931232,
-    0.931386, 0.931526, 0.931671, 0.93182, 0.931955, 0.932113,
-    0.932239, 0.932405, 0.932522, 0.932697, 0.932806, 0.932989,
-    0.933089, 0.93328, 0.933372, 0.93357, 0.933655, 0.93386,
-    0.933937, 0.93415, 0.93422, 0.934438, 0.934502, 0.934726,
-    0.934784, 0.935014, 0.935067, 0.9353, 0.935349, 0.935586,
-    0.935631, 0.935871, 0.935913, 0.936156, 0.936195, 0.93644,
-    0.936477, 0.936723, 0.936759, 0.937005, 0.937041, 0.937286,
-    0.937323, 0.937567, 0.937605, 0.937847, 0.937887, 0.938126,
-    0.938169, 0.938405, 0.938451, 0.938683, 0.938733, 0.93896,
-    0.939015, 0.939237, 0.939297, 0.939513, 0.939579, 0.939788,
-    0.939861, 0.940063, 0.940142, 0.940337, 0.940423, 0.94061,
-    0.940705, 0.940883, 0.940986, 0.941156, 0.941266, 0.941428,
-    0.941547, 0.9417, 0.941827, 0.941971, 0.942107, 0.942242,
-    0.942386, 0.942513, 0.942665, 0.942783, 0.942944, 0.943053,
-    0.943222, 0.943323, 0.9435, 0.943592, 0.943777, 0.943862,
-    0.944054, 0.944131, 0.94433, 0.9444, 0.944606, 0.944669,
-    0.944881, 0.944938, 0.945155, 0.945207, 0.945429, 0.945476,
-    0.945702, 0.945745, 0.945974, 0.946014, 0.946246, 0.946282,
-    0.946517, 0.946551, 0.946788, 0.94682, 0.947057, 0.947089,
-    0.947326, 0.947358, 0.947594, 0.947627, 0.947862, 0.947896,
-    0.948129, 0.948165, 0.948395, 0.948434, 0.94866, 0.948703,
-    0.948925, 0.948972, 0.949189, 0.949241, 0.949453, 0.94951,
-    0.949716, 0.949779, 0.949978, 0.950048, 0.95024, 0.950316,
-    0.950502, 0.950585, 0.950762, 0.950853, 0.951023, 0.951122,
-    0.951283, 0.95139, 0.951542, 0.951657, 0.951801, 0.951925,
-    0.95206, 0.952192, 0.952318, 0.952459, 0.952577, 0.952725,
-    0.952834, 0.952991, 0.953092, 0.953257, 0.95335, 0.953522,
-    0.953607, 0.953787, 0.953864, 0.954051, 0.954121, 0.954315,
-    0.954378, 0.954578, 0.954635, 0.95484, 0.954892, 0.955102,
-    0.955148, 0.955364, 0.955405, 0.955624, 0.955662, 0.955884,
-    0.955919, 0.956144, 0.956175, 0.956403, 0.956432, 0.956661,
-    0.956689, 0.956918, 0.956946, 0.957175, 0.957203, 0.957431,
-    0.95746, 0.957687, 0.957717, 0.957942, 0.957975, 0.958196,
-    0.958232, 0.958449, 0.958489, 0.958702, 0.958746, 0.958955,
-    0.959003, 0.959206, 0.959261, 0.959458, 0.959518, 0.959708,
-    0.959775, 0.959958, 0.960032, 0.960208, 0.960288, 0.960457,
-    0.960545, 0.960706, 0.960802, 0.960954, 0.961058, 0.961202,
-    0.961314, 0.96145, 0.96157, 0.961697, 0.961826, 0.961944,
-    0.962081, 0.962191, 0.962336, 0.962438, 0.96259, 0.962684,
-    0.962844, 0.96293, 0.963098, 0.963176, 0.963351, 0.963422,
-    0.963604, 0.963668, 0.963856, 0.963913, 0.964108, 0.964159,
-    0.964359, 0.964405, 0.96461, 0.964651, 0.96486, 0.964896,
-    0.96511, 0.965142, 0.965358, 0.965388, 0.965607, 0.965634,
-    0.965854, 0.96588, 0.966101, 0.966126, 0.966348, 0.966372,
-    0.966593, 0.966618, 0.966838, 0.966864, 0.967083, 0.96711,
-    0.967327, 0.967356, 0.96757, 0.967603, 0.967813, 0.967849,
-    0.968055, 0.968096, 0.968296, 0.968342, 0.968537, 0.968588,
-    0.968778, 0.968835, 0.969017, 0.969081, 0.969257, 0.969327,
-    0.969496, 0.969573, 0.969734, 0.969819, 0.969972, 0.970065,
-    0.97021, 0.970311, 0.970448, 0.970556, 0.970685, 0.970802,
-    0.970921, 0.971047, 0.971158, 0.971291, 0.971394, 0.971536,
-    0.97163, 0.97178, 0.971866, 0.972023, 0.972102, 0.972266,
-    0.972338, 0.972509, 0.972573, 0.972752, 0.972809, 0.972993,
-    0.973044, 0.973235, 0.97328, 0.973475, 0.973515, 0.973716,
-    0.973751, 0.973955, 0.973987, 0.974195, 0.974222, 0.974433,
-    0.974458, 0.974671, 0.974694, 0.974908, 0.974929, 0.975145,
-    0.975165, 0.975381, 0.975401, 0.975617, 0.975637, 0.975852,
-    0.975874, 0.976086, 0.97611, 0.97632, 0.976346, 0.976553,
-    0.976583, 0.976786, 0.976819, 0.977018, 0.977056, 0.977249,
-    0.977292, 0.97748, 0.977529, 0.977711, 0.977765, 0.977941,
-    0.978002, 0.97817, 0.978238, 0.978399, 0.978474, 0.978628,
-    0.978711, 0.978856, 0.978947, 0.979084, 0.979183, 0.979312,
-    0.979418, 0.979539, 0.979654, 0.979766, 0.979889, 0.979993,
-    0.980124, 0.98022, 0.980359, 0.980447, 0.980593, 0.980673,
-    0.980827, 0.980899, 0.98106, 0.981125, 0.981293, 0.981352,
-    0.981526, 0.981578, 0.981758, 0.981804, 0.98199, 0.98203,
-    0.982221, 0.982256, 0.982452, 0.982482, 0.982682, 0.982708,
-    0.982912, 0.982935, 0.983141, 0.983161, 0.983369, 0.983388,
-    0.983597, 0.983614, 0.983825, 0.983841, 0.984051, 0.984068,
-    0.984277, 0.984294, 0.984503, 0.984521, 0.984728, 0.984749,
-    0.984952, 0.984976, 0.985176, 0.985203, 0.9854, 0.98543,
-    0.985622, 0.985658, 0.985845, 0.985885, 0.986066, 0.986113,
-    0.986288, 0.98634, 0.986509, 0.986567, 0.986729, 0.986795,
-    0.986949, 0.987022, 0.987169, 0.987249, 0.987388, 0.987476,
-    0.987607, 0.987703, 0.987826, 0.98793, 0.988044, 0.988156,
-    0.988262, 0.988383, 0.98848, 0.988609, 0.988698, 0.988834,
-    0.988916, 0.98906, 0.989133, 0.989285, 0.989351, 0.989509,
-    0.989568, 0.989733, 0.989786, 0.989957, 0.990003, 0.990181,
-    0.99022, 0.990403, 0.990438, 0.990626, 0.990655, 0.990848,
-    0.990873, 0.991069, 0.99109, 0.99129, 0.991308, 0.99151,
-    0.991526, 0.99173, 0.991744, 0.991949, 0.991962, 0.992168,
-    0.99218, 0.992386, 0.992398, 0.992603, 0.992617, 0.99282,
-    0.992835, 0.993036, 0.993054, 0.993252, 0.993273, 0.993467,
-    0.993491, 0.993682, 0.99371, 0.993896, 0.993929, 0.99411,
-    0.994148, 0.994323, 0.994367, 0.994536, 0.994586, 0.994749,
-    0.994805, 0.994961, 0.995024, 0.995172, 0.995243, 0.995383,
-    0.995462, 0.995594, 0.995681, 0.995805, 0.995899, 0.996015,
-    0.996118, 0.996226, 0.996336, 0.996435, 0.996554, 0.996645,
-    0.996772, 0.996855, 0.996989, 0.997064, 0.997206, 0.997274,
-    0.997423, 0.997483, 0.997639, 0.997692, 0.997855, 0.997901,
-    0.998071, 0.998111, 0.998286, 0.99832, 0.998501, 0.998529,
-    0.998715, 0.998739, 0.998928, 0.998948, 0.999142, 0.999158,
-    0.999354, 0.999368, 0.999566, 0.999578, 0.999778, 0.999788,
-    0.999988, 1
-};
-
-static const float WAVE_LOGARITHMIC_018[DEFAULT_WAVELEN] = {
-    -1, -0.870898, -0.620127, -0.467833, -0.443078, -0.421195,
-    -0.350966, -0.295888, -0.28627, -0.272882, -0.231073, -0.198446,
-    -0.193078, -0.182788, -0.152685, -0.130102, -0.126675, -0.117961,
-    -0.0942935, -0.0774275, -0.0750708, -0.0672973, -0.0477344, -0.0345702,
-    -0.0328602, -0.0257033, -0.00901073, 0.00155559, 0.00285714, 0.00958212,
-    0.0241363, 0.0327771, 0.0338178, 0.0402246, 0.0531098, 0.0602662,
-    0.0611441, 0.067306, 0.0788412, 0.0848197, 0.0856029, 0.091569,
-    0.101981, 0.107004, 0.107742, 0.113546, 0.123001, 0.127236,
-    0.127966, 0.13363, 0.142256, 0.145833, 0.146581, 0.152121,
-    0.160017, 0.163038, 0.163827, 0.169253, 0.176497, 0.179048,
-    0.179893, 0.185212, 0.191868, 0.194017, 0.194931, 0.200146,
-    0.206269, 0.208074, 0.209067, 0.21418, 0.219812, 0.221324,
-    0.222403, 0.227414, 0.232595, 0.233856, 0.235026, 0.239933,
-    0.244697, 0.245745, 0.247009, 0.251811, 0.256186, 0.257055,
-    0.258414, 0.263108, 0.267121, 0.267839, 0.269295, 0.273878,
-    0.277552, 0.278147, 0.279698, 0.284167, 0.287525, 0.288018,
-    0.289663, 0.294014, 0.297076, 0.29749, 0.299227, 0.303457,
-    0.306241, 0.306594, 0.30842, 0.312525, 0.315049, 0.315359,
-    0.317269, 0.321246, 0.323528, 0.323809, 0.3258, 0.329646,
-    0.3317, 0.331968, 0.334034, 0.337746, 0.339589, 0.339855,
-    0.341991, 0.345567, 0.347212, 0.347488, 0.349688, 0.353126,
-    0.354589, 0.354885, 0.357142, 0.360439, 0.361734, 0.362059,
-    0.364368, 0.367523, 0.368662, 0.369023, 0.371378, 0.37439,
-    0.375386, 0.375792, 0.378184, 0.381052, 0.381919, 0.382374,
-    0.384797, 0.387522, 0.388271, 0.388782, 0.391229, 0.39381,
-    0.394453, 0.395023, 0.397487, 0.399925, 0.400474, 0.401107,
-    0.40358, 0.405877, 0.406343, 0.407041, 0.409517, 0.411674,
-    0.412068, 0.412833, 0.415305, 0.417323, 0.417656, 0.418489,
-    0.42095, 0.422833, 0.423114, 0.424016, 0.426459, 0.428209,
-    0.428448, 0.429419, 0.431838, 0.433458, 0.433665, 0.434704,
-    0.437093, 0.438587, 0.438769, 0.439876, 0.442228, 0.4436,
-    0.443767, 0.444939, 0.447248, 0.448503, 0.448662, 0.449897,
-    0.452159, 0.453301, 0.45346, 0.454755, 0.456964, 0.457998,
-    0.458164, 0.459516, 0.461667, 0.462599, 0.462778, 0.464184,
-    0.466273, 0.467108, 0.467307, 0.468762, 0.470785, 0.471529,
-    0.471752, 0.473254, 0.475207, 0.475865, 0.476118, 0.477661,
-    0.479542, 0.480121, 0.480408, 0.481988, 0.483793, 0.484298,
-    0.484624, 0.486236, 0.487963, 0.488401, 0.488769, 0.490408,
-    0.492055, 0.492433, 0.492845, 0.494506, 0.496072, 0.496395,
-    0.496855, 0.498533, 0.500016, 0.500291, 0.500801, 0.50249,
-    0.50389, 0.504124, 0.504685, 0.50638, 0.507697, 0.507895,
-    0.508508, 0.510205, 0.511438, 0.511608, 0.512273, 0.513966,
-    0.515117, 0.515263, 0.515981, 0.517665, 0.518735, 0.518864,
-    0.519634, 0.521304, 0.522294, 0.522411, 0.523233, 0.524885,
-    0.525796, 0.525908, 0.52678, 0.528408, 0.529243, 0.529355,
-    0.530276, 0.531877, 0.532638, 0.532754, 0.533723, 0.535291,
-    0.535981, 0.536106, 0.537121, 0.538653, 0.539275, 0.539414,
-    0.540471, 0.541964, 0.542521, 0.542679, 0.543776, 0.545225,
-    0.545721, 0.545901, 0.547035, 0.548438, 0.548877, 0.549082,
-    0.550249, 0.551604, 0.551989, 0.552223, 0.553421, 0.554723,
-    0.555059, 0.555325, 0.55655, 0.557798, 0.558089, 0.55839,
-    0.559637, 0.56083, 0.56108, 0.561418, 0.562684, 0.56382,
-    0.564033, 0.564409, 0.565691, 0.566768, 0.566949, 0.567366,
-    0.568658, 0.569676, 0.56983, 0.570288, 0.571588, 0.572545,
-    0.572677, 0.573177, 0.574479, 0.575377, 0.57549, 0.576033,
-    0.577334, 0.578172, 0.578271, 0.578857, 0.580152, 0.580931,
-    0.58102, 0.581649, 0.582935, 0.583655, 0.583739, 0.584409,
-    0.585683, 0.586345, 0.586429, 0.58714, 0.588397, 0.589003,
-    0.58909, 0.58984, 0.591077, 0.591629, 0.591722, 0.592511,
-    0.593724, 0.594223, 0.594328, 0.595154, 0.596339, 0.596788,
-    0.596906, 0.597767, 0.598922, 0.599324, 0.599459, 0.600352,
-    0.601475, 0.601831, 0.601987, 0.60291, 0.603997, 0.60431,
-    0.60449, 0.60544, 0.606489, 0.606763, 0.606968, 0.607944,
-    0.608953, 0.60919, 0.609423, 0.61042, 0.611387, 0.611592,
-    0.611855, 0.612871, 0.613794, 0.61397, 0.614264, 0.615295,
-    0.616174, 0.616323, 0.616651, 0.617694, 0.618527, 0.618654,
-    0.619016, 0.620068, 0.620854, 0.620962, 0.621359, 0.622417,
-    0.623156, 0.623248, 0.623681, 0.624741, 0.625433, 0.625513,
-    0.625982, 0.627041, 0.627686, 0.627757, 0.628262, 0.629317,
-    0.629915, 0.629982, 0.630522, 0.631569, 0.632121, 0.632186,
-    0.632762, 0.633798, 0.634304, 0.634372, 0.634982, 0.636004,
-    0.636466, 0.636539, 0.637182, 0.638187, 0.638607, 0.638688,
-    0.639363, 0.640348, 0.640726, 0.640819, 0.641525, 0.642487,
-    0.642826, 0.642932, 0.643667, 0.644605, 0.644906, 0.645029,
-    0.645791, 0.646701, 0.646967, 0.647109, 0.647895, 0.648776,
-    0.649009, 0.649173, 0.649982, 0.650831, 0.651033, 0.65122,
-    0.652049, 0.652865, 0.65304, 0.653252, 0.654099, 0.65488,
-    0.655029, 0.655268, 0.65613, 0.656875, 0.657002, 0.657269,
-    0.658143, 0.658851, 0.658958, 0.659255, 0.660139, 0.660808,
-    0.660899, 0.661225, 0.662116, 0.662748, 0.662825, 0.663182,
-    0.664076, 0.664669, 0.664735, 0.665123, 0.666019, 0.666572,
-    0.666631, 0.66705, 0.667945, 0.668458, 0.668513, 0.668963,
-    0.669853, 0.670328, 0.670381, 0.670862, 0.671744, 0.672181,
-    0.672235, 0.672746, 0.673619, 0.674018, 0.674076, 0.674617,
-    0.675477, 0.67584, 0.675904, 0.676474, 0.677318, 0.677646,
-    0.67772, 0.678317, 0.679143, 0.679438, 0.679523, 0.680146,
-    0.680953, 0.681215, 0.681314, 0.681961, 0.682746, 0.682978,
-    0.683094, 0.683763, 0.684524, 0.684727, 0.684861, 0.685551,
-    0.686287, 0.686463, 0.686617, 0.687326, 0.688034, 0.688186,
-    0.688361, 0.689087, 0.689766, 0.689896, 0.690095, 0.690835,
-    0.691484, 0.691594, 0.691817, 0.69257, 0.693187, 0.69328,
-    0.693529, 0.694291, 0.694876, 0.694955, 0.695229, 0.695999,
-    0.696551, 0.696618, 0.696919, 0.697694, 0.698213, 0.698269,
-    0.698598, 0.699375, 0.699861, 0.69991, 0.700267, 0.701044,
-    0.701496, 0.701541, 0.701925, 0.702699, 0.703118, 0.703161,
-    0.703572, 0.704342, 0.704728, 0.704771, 0.70521, 0.705972,
-    0.706325, 0.706372, 0.706837, 0.707589, 0.707911, 0.707962,
-    0.708453, 0.709193, 0.709484, 0.709544, 0.710059, 0.710785,
-    0.711047, 0.711116, 0.711655, 0.712365, 0.712598, 0.712679,
-    0.71324, 0.713932, 0.714138, 0.714233, 0.714816, 0.715487,
-    0.715668, 0.715779, 0.71638, 0.71703, 0.717188, 0.717316,
-    0.717935, 0.718561, 0.718697, 0.718844, 0.719479, 0.720081,
-    0.720197, 0.720364, 0.721013, 0.721589, 0.721687, 0.721876,
-    0.722537, 0.723086, 0.723168, 0.72338, 0.72405, 0.724571,
-    0.72464, 0.724875, 0.725553, 0.726046, 0.726103, 0.726362,
-    0.727046, 0.72751, 0.727558, 0.727842, 0.728528, 0.728963,
-    0.729005, 0.729313, 0.730001, 0.730406, 0.730443, 0.730776,
-    0.731463, 0.731838, 0.731873, 0.732231, 0.732914, 0.733261,
-    0.733296, 0.733678, 0.734356, 0.734674, 0.734711, 0.735118,
-    0.735788, 0.736077, 0.736119, 0.736549, 0.737209, 0.737472,
-    0.73752, 0.737972, 0.738621, 0.738857, 0.738913, 0.739388,
-    0.740022, 0.740233, 0.7403, 0.740795, 0.741414, 0.7416,
-    0.74168, 0.742194, 0.742796, 0.74296, 0.743053, 0.743585,
-    0.744169, 0.744311, 0.744419, 0.744968, 0.745531, 0.745654,
-    0.745779, 0.746343, 0.746885, 0.746989, 0.747132, 0.74771,
-    0.748229, 0.748317, 0.748479, 0.749068, 0.749564, 0.749637,
-    0.74982, 0.750418, 0.75089, 0.750951, 0.751154, 0.75176,
-    0.752207, 0.752257, 0.752482, 0.753094, 0.753515, 0.753557,
-    0.753804, 0.75442, 0.754814, 0.75485, 0.75512, 0.755737,
-    0.756105, 0.756136, 0.756429, 0.757046, 0.757388, 0.757417,
-    0.757732, 0.758347, 0.758663, 0.758691, 0.759029, 0.75964,
-    0.75993, 0.759959, 0.760319, 0.760924, 0.761188, 0.761222,
-    0.761603, 0.7622, 0.76244, 0.762479, 0.762881, 0.763468,
-    0.763684, 0.76373, 0.764153, 0.764728, 0.764921, 0.764976,
-    0.765418, 0.76598, 0.76615, 0.766216, 0.766676, 0.767224,
-    0.767373, 0.767451, 0.767928, 0.768459, 0.768589, 0.768681,
-    0.769174, 0.769687, 0.769799, 0.769906, 0.770413, 0.770907,
-    0.771002, 0.771126, 0.771645, 0.77212, 0.772199, 0.77234,
-    0.772871, 0.773324, 0.773391, 0.77355, 0.77409, 0.774521,
-    0.774576, 0.774754, 0.775303, 0.775711, 0.775756, 0.775954,
-    0.776508, 0.776894, 0.77693, 0.777149, 0.777707, 0.778069,
-    0.778099, 0.778338, 0.778899, 0.779237, 0.779263, 0.779523,
-    0.780084, 0.780399, 0.780422, 0.780702, 0.781263, 0.781553,
-    0.781576, 0.781877, 0.782434, 0.782701, 0.782725, 0.783047,
-    0.783599, 0.783843, 0.783869, 0.784211, 0.784756, 0.784978,
-    0.785009, 0.78537, 0.785907, 0.786107, 0.786144, 0.786525,
-    0.787052, 0.787229, 0.787275, 0.787674, 0.788189, 0.788346,
-    0.788401, 0.788817, 0.78932, 0.789458, 0.789524, 0.789956,
-    0.790444, 0.790563, 0.790642, 0.791089, 0.791561, 0.791664,
-    0.791756, 0.792216, 0.792672, 0.792759, 0.792866, 0.793339,
-    0.793776, 0.793849, 0.793972, 0.794455, 0.794873, 0.794934,
-    0.795073, 0.795566, 0.795965, 0.796014, 0.796171, 0.796672,
-    0.79705, 0.797089, 0.797265, 0.797772, 0.798129, 0.79816,
-    0.798355, 0.798866, 0.799201, 0.799227, 0.79944, 0.799955,
-    0.800268, 0.800289, 0.800522, 0.801037, 0.801329, 0.801347,
-    0.8016, 0.802114, 0.802384, 0.802402, 0.802673, 0.803186,
-    0.803434, 0.803452, 0.803742, 0.804251, 0.804478, 0.804498,
-    0.804808, 0.805311, 0.805516, 0.805541, 0.805869, 0.806364,
-    0.80655, 0.80658, 0.806925, 0.807412, 0.807578, 0.807615,
-    0.807978, 0.808455, 0.808601, 0.808647, 0.809026, 0.809491,
-    0.809619, 0.809675, 0.810069, 0.810522, 0.810633, 0.8107,
-    0.811109, 0.811547, 0.811642, 0.811722, 0.812143, 0.812566,
-    0.812647, 0.81274, 0.813173, 0.81358, 0.813647, 0.813755,
-    0.814199, 0.814588, 0.814643, 0.814766, 0.81522, 0.815591,
-    0.815635, 0.815775, 0.816236, 0.816588, 0.816623, 0.81678,
-    0.817247, 0.81758, 0.817608, 0.817781, 0.818254, 0.818567,
-    0.818588, 0.81878, 0.819255, 0.819548, 0.819565, 0.819775,
-    0.820252, 0.820525, 0.820539, 0.820767, 0.821244, 0.821496,
-    0.821509, 0.821755, 0.82223, 0.822463, 0.822476, 0.82274,
-    0.823212, 0.823425, 0.82344, 0.823722, 0.824189, 0.824382,
-    0.8244, 0.8247, 0.825161, 0.825335, 0.825358, 0.825674,
-    0.826128, 0.826283, 0.826313, 0.826645, 0.82709, 0.827227,
-    0.827264, 0.827612, 0.828046, 0.828167, 0.828213, 0.828576,
-    0.828998, 0.829102, 0.829159, 0.829535, 0.829945, 0.830034,
-    0.830102, 0.830491, 0.830887, 0.830962, 0.831043, 0.831443,
-    0.831824, 0.831886, 0.831981, 0.832391, 0.832756, 0.832807,
-    0.832916, 0.833336, 0.833684, 0.833724, 0.833848, 0.834276,
-    0.834607, 0.834638, 0.834777, 0.835212, 0.835525, 0.835548,
-    0.835704, 0.836143, 0.836438, 0.836456, 0.836629, 0.837071,
-    0.837347, 0.83736, 0.83755, 0.837994, 0.838251, 0.838262,
-    0.838469, 0.838913, 0.839152, 0.83916, 0.839384, 0.839828,
-    0.840047, 0.840056, 0.840297, 0.840739, 0.840939, 0.840949,
-    0.841207, 0.841645, 0.841827, 0.84184, 0.842114, 0.842547,
-    0.84271, 0.842728, 0.843019, 0.843444, 0.84359, 0.843613,
-    0.84392, 0.844337, 0.844466, 0.844496, 0.844818, 0.845225,
-    0.845339, 0.845377, 0.845712, 0.84611, 0.846207, 0.846255,
-    0.846604, 0.84699, 0.847073, 0.847131, 0.847492, 0.847865,
-    0.847935, 0.848005, 0.848377, 0.848736, 0.848794, 0.848877,
-    0.849259, 0.849603, 0.849649, 0.849746, 0.850137, 0.850466,
-    0.850502, 0.850613, 0.851012, 0.851324, 0.851352, 0.851477,
-    0.851883, 0.852179, 0.852199, 0.85234, 0.85275, 0.853029,
-    0.853044, 0.8532, 0.853614, 0.853876, 0.853885, 0.854058,
-    0.854474, 0.854718, 0.854724, 0.854913, 0.855331, 0.855556,
-    0.855561, 0.855766, 0.856183, 0.856391, 0.856396, 0.856617,
-    0.857032, 0.857222, 0.857228, 0.857465, 0.857877, 0.85805,
-    0.858058, 0.858311, 0.858718, 0.858874, 0.858886, 0.859155,
-    0.859556, 0.859694, 0.859711, 0.859995, 0.860389, 0.860511,
-    0.860535, 0.860833, 0.861218, 0.861325, 0.861357, 0.861668,
-    0.862044, 0.862136, 0.862176, 0.862501, 0.862866, 0.862944,
-    0.862994, 0.863331, 0.863684, 0.863749, 0.86381, 0.864158,
-    0.864498, 0.864551, 0.864624, 0.864981, 0.865308, 0.865351,
-    0.865436, 0.865802, 0.866114, 0.866147, 0.866246, 0.86662,
-    0.866917, 0.866941, 0.867054, 0.867435, 0.867716, 0.867733,
-    0.86786, 0.868246, 0.868512, 0.868523, 0.868665, 0.869055,
-    0.869303, 0.86931, 0.869467, 0.86986, 0.870092, 0.870095,
-    0.870268, 0.870662, 0.870876, 0.870878, 0.871066, 0.87146,
-    0.871658, 0.871659, 0.871863, 0.872255, 0.872436, 0.872438,
-    0.872657, 0.873047, 0.873211, 0.873215, 0.873449, 0.873835,
-    0.873983, 0.87399, 0.874239, 0.87462, 0.874752, 0.874763,
-    0.875027, 0.875401, 0.875517, 0.875535, 0.875813, 0.876179,
-    0.87628, 0.876305, 0.876596, 0.876953, 0.87704, 0.877073,
-    0.877377, 0.877724, 0.877798, 0.87784, 0.878155, 0.878491,
-    0.878553, 0.878605, 0.878931, 0.879255, 0.879305, 0.879368,
-    0.879704, 0.880016, 0.880055, 0.88013, 0.880475, 0.880773,
-    0.880802, 0.88089, 0.881243, 0.881526, 0.881548, 0.881649,
-    0.882008, 0.882277, 0.882291, 0.882406, 0.882771, 0.883024,
-    0.883032, 0.883162, 0.88353, 0.883768, 0.883771, 0.883915,
-    0.884287, 0.884509, 0.884509, 0.884667, 0.885041, 0.885246,
-    0.885244, 0.885418, 0.885791, 0.885981, 0.885978, 0.886167,
-    0.886539, 0.886712, 0.88671, 0.886914, 0.887284, 0.887441,
-    0.88744, 0.887659, 0.888025, 0.888167, 0.888169, 0.888402,
-    0.888764, 0.88889, 0.888896, 0.889143, 0.889499, 0.88961,
-    0.889622, 0.889882, 0.890231, 0.890328, 0.890347, 0.89062,
-    0.89096, 0.891044, 0.89107, 0.891355, 0.891686, 0.891756,
-    0.891791, 0.892088, 0.892409, 0.892467, 0.892511, 0.892819,
-    0.893129, 0.893175, 0.89323, 0.893547, 0.893845, 0.893882,
-    0.893948, 0.894274, 0.894559, 0.894586, 0.894664, 0.894998,
-    0.895269, 0.895288, 0.895379, 0.895719, 0.895977, 0.895988,
-    0.896092, 0.896438, 0.896681, 0.896686, 0.896804, 0.897154,
-    0.897383, 0.897383, 0.897515, 0.897868, 0.898081, 0.898078,
-    0.898224, 0.898579, 0.898777, 0.898772, 0.898932, 0.899288,
-    0.89947, 0.899463, 0.899638, 0.899994, 0.90016, 0.900154,
-    0.900343, 0.900697, 0.900848, 0.900843, 0.901046, 0.901397,
-    0.901533, 0.90153, 0.901748, 0.902094, 0.902215, 0.902217,
-    0.902448, 0.902789, 0.902895, 0.902902, 0.903146, 0.903481,
-    0.903573, 0.903586, 0.903843, 0.904169, 0.904249, 0.904268,
-    0.904537, 0.904855, 0.904922, 0.90495, 0.90523, 0.905539,
-    0.905593, 0.90563, 0.905921, 0.906219, 0.906262, 0.906309,
-    0.90661, 0.906896, 0.906929, 0.906987, 0.907297, 0.907571,
-    0.907595, 0.907664, 0.907981, 0.908243, 0.908258, 0.90834,
-    0.908664, 0.908912, 0.90892, 0.909014, 0.909344, 0.909578,
-    0.909581, 0.909688, 0.910022, 0.910242, 0.910239, 0.91036,
-    0.910697, 0.910903, 0.910897, 0.911031, 0.911371, 0.911561,
-    0.911553, 0.911701, 0.912041, 0.912217, 0.912207, 0.91237,
-    0.91271, 0.91287, 0.91286, 0.913037, 0.913375, 0.913521,
-    0.913512, 0.913703, 0.914039, 0.91417, 0.914163, 0.914367,
-    0.914699, 0.914816, 0.914813, 0.91503, 0.915358, 0.91546,
-    0.915461, 0.915692, 0.916013, 0.916102, 0.916109, 0.916352,
-    0.916666, 0.916742, 0.916755, 0.91701, 0.917316, 0.917379,
-    0.917401, 0.917667, 0.917964, 0.918015, 0.918046, 0.918322,
-    0.918609, 0.918649, 0.918689, 0.918975, 0.919251, 0.919282,
-    0.919332, 0.919626, 0.919891, 0.919912, 0.919973, 0.920276,
-    0.920528, 0.920541, 0.920614, 0.920923, 0.921163, 0.921169,
-    0.921254, 0.921569, 0.921795, 0.921795, 0.921893, 0.922212,
-    0.922425, 0.92242, 0.92253, 0.922853, 0.923052, 0.923043,
-    0.923167, 0.923492, 0.923677, 0.923665, 0.923803, 0.924129,
-    0.924299, 0.924286, 0.924437, 0.924764, 0.924919, 0.924906,
-    0.925071, 0.925396, 0.925537, 0.925525, 0.925703, 0.926026,
-    0.926153, 0.926142, 0.926334, 0.926654, 0.926767, 0.926759,
-    0.926964, 0.92728, 0.927378, 0.927375, 0.927592, 0.927902,
-    0.927988, 0.92799, 0.92822, 0.928523, 0.928595, 0.928604,
-    0.928845, 0.929141, 0.929201, 0.929217, 0.92947, 0.929757,
-    0.929805, 0.929829, 0.930092, 0.93037, 0.930408, 0.930441,
-    0.930713, 0.930981, 0.931009, 0.931052, 0.931333, 0.931589,
-    0.931608, 0.931661, 0.93195, 0.932195, 0.932206, 0.932271,
-    0.932566, 0.932799, 0.932802, 0.932879, 0.933181, 0.9334,
-    0.933398, 0.933486, 0.933793, 0.933999, 0.933992, 0.934093,
-    0.934403, 0.934596, 0.934584, 0.934699, 0.935012, 0.93519,
-    0.935176, 0.935303, 0.935618, 0.935783, 0.935767, 0.935907,
-    0.936222, 0.936373, 0.936356, 0.93651, 0.936824, 0.936961,
-    0.936945, 0.937112, 0.937425, 0.937547, 0.937533, 0.937713,
-    0.938022, 0.938131, 0.938119, 0.938313, 0.938618, 0.938713,
-    0.938706, 0.938912, 0.939212, 0.939294, 0.939291, 0.939509,
-    0.939803, 0.939872, 0.939875, 0.940105, 0.940392, 0.940449,
-    0.940459, 0.9407, 0.940979, 0.941025, 0.941042, 0.941293,
-    0.941563, 0.941599, 0.941625, 0.941886, 0.942145, 0.942171,
-    0.942207, 0.942476, 0.942725, 0.942742, 0.942788, 0.943065,
-    0.943303, 0.943311, 0.943368, 0.943653, 0.943879, 0.94388,
-    0.943948, 0.944238, 0.944452, 0.944447, 0.944527, 0.944822,
-    0.945023, 0.945013, 0.945106, 0.945405, 0.945592, 0.945578,
-    0.945683, 0.945985, 0.946159, 0.946142, 0.94626, 0.946564,
-    0.946724, 0.946705, 0.946836, 0.947141, 0.947287, 0.947267,
-    0.947411, 0.947715, 0.947848, 0.947828, 0.947986, 0.948288,
-    0.948407, 0.948389, 0.948559, 0.948859, 0.948965, 0.948949,
-    0.949132, 0.949428, 0.94952, 0.949508, 0.949703, 0.949995,
-    0.950074, 0.950066, 0.950274, 0.950559, 0.950626, 0.950624,
-    0.950843, 0.951122, 0.951177, 0.951181, 0.951411, 0.951682,
-    0.951726, 0.951738, 0.951978, 0.95224, 0.952274, 0.952294,
-    0.952544, 0.952797, 0.95282, 0.952849, 0.953108, 0.953351,
-    0.953365, 0.953404, 0.953671, 0.953903, 0.953909, 0.953959,
-    0.954232, 0.954453, 0.954452, 0.954512, 0.954792, 0.955001,
-    0.954993, 0.955066, 0.955351, 0.955547, 0.955534, 0.955618,
-    0.955907, 0.95609, 0.956073, 0.95617, 0.956463, 0.956632,
-    0.956612, 0.956722, 0.957016, 0.957172, 0.95715, 0.957272,
-    0.957568, 0.957711, 0.957687, 0.957822, 0.958117, 0.958247,
-    0.958223, 0.958372, 0.958665, 0.958781, 0.958759, 0.95892,
-    0.959212, 0.959314, 0.959294, 0.959468, 0.959756, 0.959845,
-    0.959828, 0.960014, 0.960298, 0.960375, 0.960362, 0.96056,
-    0.960838, 0.960903, 0.960896, 0.961105, 0.961377, 0.96143,
-    0.961429, 0.961649, 0.961913, 0.961955, 0.961961, 0.962191,
-    0.962448, 0.962479, 0.962493, 0.962733, 0.96298, 0.963001,
-    0.963024, 0.963273, 0.963511, 0.963523, 0.963555, 0.963812,
-    0.964039, 0.964043, 0.964086, 0.96435, 0.964566, 0.964562,
-    0.964616, 0.964886, 0.96509, 0.96508, 0.965145, 0.965421,
-    0.965613, 0.965597, 0.965674, 0.965955, 0.966134, 0.966114,
-    0.966203, 0.966487, 0.966653, 0.966629, 0.966731, 0.967017,
-    0.96717, 0.967144, 0.967258, 0.967546, 0.967685, 0.967658,
-    0.967785, 0.968073, 0.968199, 0.968172, 0.968311, 0.968598,
-    0.968711, 0.968685, 0.968837, 0.969121, 0.969221, 0.969197,
-    0.969362, 0.969643, 0.96973, 0.969709, 0.969886, 0.970163,
-    0.970238, 0.97022, 0.970409, 0.970681, 0.970743, 0.970731,
-    0.970931, 0.971197, 0.971248, 0.971242, 0.971453, 0.971712,
-    0.971751, 0.971752, 0.971973, 0.972224, 0.972253, 0.972261,
-    0.972493, 0.972735, 0.972754, 0.972771, 0.973011, 0.973244,
-    0.973253, 0.97328, 0.973528, 0.973751, 0.973752, 0.973788,
-    0.974044, 0.974256, 0.97425, 0.974297, 0.974559, 0.974759,
-    0.974746, 0.974804, 0.975072, 0.975261, 0.975242, 0.975312,
-    0.975584, 0.97576, 0.975737, 0.975819, 0.976095, 0.976258,
-    0.976232, 0.976325, 0.976604, 0.976754, 0.976725, 0.976832,
-    0.977112, 0.977249, 0.977218, 0.977337, 0.977618, 0.977742,
-    0.977711, 0.977842, 0.978122, 0.978233, 0.978203, 0.978347,
-    0.978625, 0.978723, 0.978694, 0.978851, 0.979126, 0.979211,
-    0.979185, 0.979354, 0.979625, 0.979698, 0.979676, 0.979856,
-    0.980123, 0.980183, 0.980166, 0.980358, 0.980619, 0.980667,
-    0.980656, 0.980859, 0.981113, 0.98115, 0.981145, 0.981359,
-    0.981605, 0.981632, 0.981635, 0.981858, 0.982096, 0.982113,
-    0.982124, 0.982356, 0.982585, 0.982592, 0.982612, 0.982853,
-    0.983072, 0.983071, 0.983101, 0.983349, 0.983557, 0.983549,
-    0.983589, 0.983844, 0.984041, 0.984025, 0.984077, 0.984337,
-    0.984523, 0.984501, 0.984564, 0.98483, 0.985003, 0.984977,
-    0.985051, 0.985321, 0.985481, 0.985451, 0.985538, 0.98581,
-    0.985958, 0.985926, 0.986025, 0.986298, 0.986433, 0.986399,
-    0.986511, 0.986785, 0.986907, 0.986872, 0.986996, 0.98727,
-    0.987379, 0.987345, 0.987481, 0.987754, 0.98785, 0.987817,
-    0.987966, 0.988236, 0.988319, 0.988289, 0.98845, 0.988716,
-    0.988787, 0.98876, 0.988933, 0.989195, 0.989253, 0.989231,
-    0.989416, 0.989672, 0.989719, 0.989702, 0.989898, 0.990148,
-    0.990183, 0.990173, 0.990379, 0.990622, 0.990646, 0.990643,
-    0.990859, 0.991094, 0.991108, 0.991113, 0.991339, 0.991564,
-    0.991569, 0.991583, 0.991817, 0.992033, 0.992029, 0.992053,
-    0.992295, 0.9925, 0.992489, 0.992523, 0.992771, 0.992965,
-    0.992947, 0.992992, 0.993246, 0.993429, 0.993405, 0.993461,
-    0.993721, 0.993891, 0.993862, 0.99393, 0.994193, 0.994351,
-    0.994318, 0.994398, 0.994665, 0.99481, 0.994774, 0.994867,
-    0.995135, 0.995268, 0.99523, 0.995335, 0.995604, 0.995723,
-    0.995685, 0.995802, 0.996072, 0.996178, 0.996139, 0.99627,
-    0.996537, 0.996631, 0.996594, 0.996736, 0.997002, 0.997082,
-    0.997047, 0.997203, 0.997465, 0.997532, 0.997501, 0.997669,
-    0.997926, 0.997981, 0.997955, 0.998134, 0.998386, 0.998429,
-    0.998408, 0.998599, 0.998844, 0.998875, 0.998861, 0.999064,
-    0.9993, 0.999319, 0.999315, 0.999529, 0.999754, 0.99976,
-    0.999772, 1
-};
-
-static const float WAVE_LOGARITHMIC_030[DEFAULT_WAVELEN] = {
-    -1, -0.961715, -0.858423, -0.72017, -0.583654, -0.478479,
-    -0.417429, -0.394598, -0.391423, -0.387116, -0.368296, -0.333563,
-    -0.291601, -0.25467, -0.231373, -0.222436, -0.221279, -0.218459,
-    -0.207134, -0.186495, -0.16151, -0.139506, -0.125779, -0.120757,
-    -0.120164, -0.117818, -0.109292, -0.0942823, -0.0764527, -0.0610312,
-    -0.0516805, -0.0484827, -0.048115, -0.0459746, -0.0389095, -0.0269485,
-    -0.0130927, -0.00139872, 0.005442, 0.00760217, 0.00787484, 0.00991877,
-    0.0160871, 0.0261214, 0.0374296, 0.046712, 0.0519259, 0.0534295,
-    0.0536717, 0.0556727, 0.0612328, 0.0699282, 0.0794505, 0.0870371,
-    0.091113, 0.0921743, 0.0924225, 0.0944099, 0.099528, 0.10723,
-    0.115421, 0.121745, 0.124983, 0.125735, 0.126012, 0.128002,
-    0.132782, 0.139711, 0.146864, 0.152208, 0.154805, 0.155337,
-    0.155656, 0.157661, 0.16217, 0.168474, 0.174789, 0.179349,
-    0.181444, 0.181818, 0.18219, 0.184213, 0.188499, 0.194282,
-    0.199903, 0.20382, 0.205513, 0.205774, 0.206205, 0.208251,
-    0.212347, 0.217684, 0.222718, 0.226097, 0.227465, 0.227648,
-    0.228142, 0.230211, 0.23414, 0.23909, 0.243617, 0.24654,
-    0.247642, 0.247774, 0.248334, 0.250425, 0.254205, 0.258812,
-    0.262895, 0.265428, 0.26631, 0.266411, 0.267039, 0.269152,
-    0.272795, 0.277094, 0.280785, 0.282979, 0.283679, 0.283768,
-    0.284464, 0.286596, 0.290112, 0.29413, 0.297471, 0.29937,
-    0.29992, 0.300009, 0.300774, 0.302922, 0.306319, 0.310078,
-    0.313104, 0.314743, 0.315171, 0.315272, 0.316104, 0.318265,
-    0.321548, 0.325068, 0.327807, 0.329219, 0.329546, 0.329668,
-    0.330566, 0.332738, 0.335909, 0.339206, 0.341685, 0.342895,
-    0.343142, 0.343292, 0.344254, 0.346433, 0.349497, 0.352584,
-    0.354824, 0.355856, 0.356038, 0.356224, 0.357248, 0.35943,
-    0.362388, 0.365277, 0.367298, 0.368173, 0.368306, 0.368532,
-    0.369615, 0.371796, 0.374649, 0.377351, 0.379171, 0.379908,
-    0.380004, 0.380274, 0.381414, 0.383589, 0.38634, 0.388863,
-    0.390497, 0.391112, 0.391183, 0.3915, 0.392694, 0.39486,
-    0.397509, 0.399862, 0.401325, 0.401833, 0.401889, 0.402256,
-    0.4035, 0.405653, 0.4082, 0.410392, 0.411696, 0.41211,
-    0.41216, 0.41258, 0.41387, 0.416006, 0.418451, 0.420488,
-    0.421647, 0.42198, 0.422032, 0.422505, 0.423838, 0.425952,
-    0.428297, 0.430186, 0.43121, 0.431475, 0.431536, 0.432062,
-    0.433434, 0.435523, 0.437767, 0.439515, 0.440416, 0.440621,
-    0.440697, 0.441277, 0.442685, 0.444745, 0.446889, 0.448502,
-    0.449289, 0.449446, 0.449542, 0.450176, 0.451614, 0.453641,
-    0.455686, 0.45717, 0.457853, 0.45797, 0.458092, 0.458778,
-    0.460244, 0.462234, 0.46418, 0.465541, 0.466129, 0.466215,
-    0.466366, 0.467104, 0.468592, 0.470542, 0.47239, 0.473634,
-    0.474136, 0.474198, 0.474383, 0.475171, 0.476677, 0.478584,
-    0.480335, 0.481467, 0.481891, 0.481937, 0.482158, 0.482994,
-    0.484514, 0.486375, 0.48803, 0.489057, 0.489411, 0.489447,
-    0.489706, 0.490588, 0.492119, 0.49393, 0.49549, 0.496417,
-    0.496708, 0.496741, 0.49704, 0.497967, 0.499503, 0.501262,
-    0.502729, 0.503561, 0.503798, 0.503832, 0.504173, 0.505141,
-    0.506678, 0.508384, 0.509758, 0.510501, 0.51069, 0.510732,
-    0.511116, 0.512123, 0.513657, 0.515306, 0.51659, 0.517249,
-    0.517397, 0.517451, 0.517878, 0.518921, 0.520448, 0.522039,
-    0.523235, 0.523816, 0.523929, 0.523998, 0.52447, 0.525546,
-    0.527062, 0.528592, 0.529702, 0.53021, 0.530295, 0.530384,
-    0.5309, 0.532005, 0.533507, 0.534975, 0.536001, 0.536442,
-    0.536503, 0.536616, 0.537175, 0.538306, 0.53979, 0.541195,
-    0.54214, 0.542519, 0.542563, 0.542701, 0.543304, 0.544458,
-    0.545919, 0.547261, 0.548127, 0.548449, 0.54848, 0.548648,
-    0.549292, 0.550465, 0.551901, 0.553178, 0.553969, 0.554239,
-    0.554263, 0.554462, 0.555147, 0.556335, 0.557743, 0.558955,
-    0.559673, 0.559896, 0.559918, 0.56015, 0.560873, 0.562074,
-    0.563451, 0.564597, 0.565245, 0.565427, 0.56545, 0.565717,
-    0.566478, 0.567687, 0.569029, 0.570109, 0.570691, 0.570837,
-    0.570866, 0.571168, 0.571964, 0.573178, 0.574484, 0.575499,
-    0.576018, 0.576131, 0.57617, 0.576509, 0.577338, 0.578554,
-    0.579819, 0.58077, 0.58123, 0.581316, 0.581368, 0.581744,
-    0.582604, 0.583817, 0.585041, 0.585928, 0.586331, 0.586395,
-    0.586464, 0.586877, 0.587765, 0.588973, 0.590153, 0.590977,
-    0.591328, 0.591374, 0.591462, 0.591912, 0.592826, 0.594025,
-    0.59516, 0.595922, 0.596225, 0.596256, 0.596366, 0.596854,
-    0.59779, 0.598977, 0.600065, 0.600767, 0.601024, 0.601047,
-    0.601181, 0.601705, 0.602661, 0.603832, 0.604873, 0.605515,
-    0.605732, 0.605748, 0.605909, 0.606468, 0.607441, 0.608594,
-    0.609586, 0.610171, 0.610351, 0.610365, 0.610553, 0.611147,
-    0.612135, 0.613267, 0.614208, 0.614738, 0.614884, 0.6149,
-    0.615118, 0.615745, 0.616744, 0.617852, 0.618742, 0.61922,
-    0.619336, 0.619357, 0.619606, 0.620265, 0.621271, 0.622352,
-    0.623192, 0.623619, 0.62371, 0.623739, 0.624019, 0.624708,
-    0.625719, 0.626771, 0.62756, 0.62794, 0.628007, 0.628048,
-    0.62836, 0.629077, 0.63009, 0.631112, 0.63185, 0.632183,
-    0.632233, 0.632287, 0.632632, 0.633375, 0.634387, 0.635375,
-    0.636063, 0.636354, 0.636388, 0.636459, 0.636836, 0.637604,
-    0.638611, 0.639565, 0.640203, 0.640454, 0.640476, 0.640566,
-    0.640976, 0.641765, 0.642765, 0.643682, 0.644271, 0.644485,
-    0.6445, 0.644611, 0.645052, 0.645861, 0.646851, 0.64773,
-    0.648271, 0.648451, 0.648461, 0.648594, 0.649068, 0.649893,
-    0.650871, 0.65171, 0.652205, 0.652353, 0.652362, 0.652519,
-    0.653024, 0.653863, 0.654826, 0.655625, 0.656074, 0.656194,
-    0.656204, 0.656388, 0.656922, 0.657773, 0.658718, 0.659476,
-    0.659881, 0.659976, 0.659991, 0.660201, 0.660764, 0.661624,
-    0.662549, 0.663266, 0.663628, 0.663701, 0.663723, 0.663961,
-    0.664551, 0.665418, 0.66632, 0.666995, 0.667317, 0.667371,
-    0.667403, 0.667669, 0.668285, 0.669156, 0.670033, 0.670666,
-    0.67095, 0.670988, 0.671032, 0.671327, 0.671967, 0.672839,
-    0.67369, 0.674281, 0.674528, 0.674554, 0.674612, 0.674936,
-    0.675599, 0.676469, 0.677292, 0.677841, 0.678054, 0.67807,
-    0.678145, 0.678498, 0.679181, 0.680047, 0.68084, 0.681347,
-    0.681529, 0.681538, 0.681631, 0.682013, 0.682715, 0.683574,
-    0.684336, 0.684802, 0.684955, 0.68496, 0.685073, 0.685484,
-    0.686201, 0.687051, 0.68778, 0.688207, 0.688333, 0.688337,
-    0.688471, 0.68891, 0.689641, 0.69048, 0.691175, 0.691564,
-    0.691665, 0.69167, 0.691828, 0.692293, 0.693037, 0.693861,
-    0.694522, 0.694873, 0.694952, 0.694961, 0.695143, 0.695634,
-    0.696387, 0.697196, 0.697822, 0.698136, 0.698196, 0.698212,
-    0.698418, 0.698935, 0.699695, 0.700485, 0.701075, 0.701354,
-    0.701398, 0.701423, 0.701655, 0.702195, 0.70296, 0.70373,
-    0.704284, 0.70453, 0.70456, 0.704595, 0.704853, 0.705416,
-    0.706183, 0.706931, 0.707449, 0.707663, 0.707682, 0.70773,
-    0.708014, 0.708598, 0.709365, 0.71009, 0.710572, 0.710756,
-    0.710766, 0.71083, 0.71114, 0.711743, 0.712507, 0.713207,
-    0.713653, 0.713809, 0.713814, 0.713893, 0.71423, 0.71485,
-    0.71561, 0.716283, 0.716694, 0.716824, 0.716825, 0.716923,
-    0.717285, 0.717921, 0.718674, 0.719319, 0.719695, 0.719802,
-    0.719802, 0.719919, 0.720307, 0.720956, 0.721701, 0.722317,
-    0.722658, 0.722744, 0.722745, 0.722883, 0.723296, 0.723957,
-    0.72469, 0.725276, 0.725584, 0.725651, 0.725656, 0.725815,
-    0.726252, 0.726922, 0.727642, 0.728198, 0.728474, 0.728524,
-    0.728535, 0.728716, 0.729176, 0.729854, 0.730559, 0.731083,
-    0.731329, 0.731364, 0.731383, 0.731588, 0.732069, 0.732752,
-    0.73344, 0.733933, 0.734149, 0.734172, 0.7342, 0.734429,
-    0.734932, 0.735618, 0.736287, 0.736748, 0.736936, 0.736949,
-    0.736989, 0.737242, 0.737764, 0.738451, 0.739099, 0.739529,
-    0.73969, 0.739696, 0.739749, 0.740026, 0.740566, 0.741252,
-    0.741879, 0.742276, 0.742413, 0.742413, 0.742482, 0.742783,
-    0.743339, 0.744022, 0.744625, 0.744992, 0.745105, 0.745102,
-    0.745187, 0.745512, 0.746084, 0.746761, 0.74734, 0.747675,
-    0.747768, 0.747764, 0.747867, 0.748215, 0.748799, 0.749469,
-    0.750023, 0.750328, 0.750401, 0.750399, 0.75052, 0.750891,
-    0.751487, 0.752148, 0.752675, 0.75295, 0.753007, 0.753007,
-    0.753149, 0.753542, 0.754147, 0.754797, 0.755297, 0.755543,
-    0.755584, 0.75559, 0.755753, 0.756167, 0.75678, 0.757416,
-    0.757889, 0.758108, 0.758136, 0.758149, 0.758332, 0.758768,
-    0.759386, 0.760008, 0.760452, 0.760644, 0.760661, 0.760683,
-    0.760889, 0.761344, 0.761965, 0.762571, 0.762986, 0.763153,
-    0.763161, 0.763194, 0.763422, 0.763895, 0.764518, 0.765106,
-    0.765493, 0.765636, 0.765637, 0.765683, 0.765932, 0.766422,
-    0.767045, 0.767613, 0.767972, 0.768093, 0.768089, 0.768148,
-    0.76842, 0.768926, 0.769547, 0.770094, 0.770425, 0.770525,
-    0.770518, 0.770593, 0.770887, 0.771406, 0.772023, 0.772549,
-    0.772851, 0.772932, 0.772925, 0.773015, 0.773331, 0.773864,
-    0.774474, 0.774977, 0.775252, 0.775315, 0.775309, 0.775417,
-    0.775755, 0.776298, 0.7769, 0.77738, 0.777628, 0.777676,
-    0.777673, 0.777799, 0.778157, 0.77871, 0.779303, 0.779758,
-    0.77998, 0.780013, 0.780015, 0.780161, 0.780539, 0.781099,
-    0.78168, 0.782111, 0.782307, 0.782329, 0.782338, 0.782503,
-    0.782901, 0.783466, 0.784035, 0.784439, 0.784612, 0.784623,
-    0.78464, 0.784826, 0.785242, 0.785811, 0.786365, 0.786744,
-    0.786894, 0.786897, 0.786924, 0.78713, 0.787564, 0.788135,
-    0.788673, 0.789026, 0.789153, 0.78915, 0.789189, 0.789416,
-    0.789865, 0.790437, 0.790957, 0.791284, 0.791391, 0.791384,
-    0.791435, 0.791683, 0.792148, 0.792717, 0.793219, 0.793521,
-    0.793609, 0.793599, 0.793664, 0.793933, 0.79441, 0.794977,
-    0.795459, 0.795735, 0.795805, 0.795794, 0.795875, 0.796165,
-    0.796654, 0.797216, 0.797677, 0.797928, 0.797982, 0.797972,
-    0.798069, 0.798379, 0.798879, 0.799433, 0.799874, 0.800099,
-    0.800139, 0.800132, 0.800247, 0.800576, 0.801085, 0.801631,
-    0.802049, 0.80225, 0.802277, 0.802275, 0.802407, 0.802755,
-    0.803272, 0.803808, 0.804203, 0.804381, 0.804397, 0.804402,
-    0.804552, 0.804918, 0.80544, 0.805965, 0.806337, 0.806493,
-    0.806499, 0.806511, 0.806681, 0.807065, 0.807591, 0.808102,
-    0.80845, 0.808585, 0.808584, 0.808605, 0.808794, 0.809194,
-    0.809723, 0.810219, 0.810544, 0.810658, 0.810651, 0.810683,
-    0.810892, 0.811307, 0.811836, 0.812317, 0.812618, 0.812713,
-    0.812702, 0.812746, 0.812975, 0.813404, 0.813932, 0.814396,
-    0.814673, 0.81475, 0.814737, 0.814795, 0.815042, 0.815485,
-    0.81601, 0.816456, 0.816709, 0.81677, 0.816756, 0.816828,
-    0.817095, 0.817549, 0.81807, 0.818497, 0.818726, 0.818773,
-    0.81876, 0.818847, 0.819133, 0.819598, 0.820112, 0.82052,
-    0.820726, 0.820759, 0.820749, 0.820852, 0.821157, 0.82163,
-    0.822137, 0.822524, 0.822708, 0.822729, 0.822724, 0.822844,
-    0.823167, 0.823647, 0.824145, 0.82451, 0.824673, 0.824684,
-    0.824684, 0.824822, 0.825162, 0.825648, 0.826135, 0.826479,
-    0.826621, 0.826623, 0.826631, 0.826786, 0.827143, 0.827633,
-    0.828108, 0.82843, 0.828552, 0.828547, 0.828564, 0.828738,
-    0.82911, 0.829602, 0.830065, 0.830365, 0.830468, 0.830457,
-    0.830484, 0.830676, 0.831063, 0.831556, 0.832004, 0.832282,
-    0.832367, 0.832353, 0.832391, 0.832602, 0.833003, 0.833495,
-    0.833927, 0.834183, 0.834251, 0.834235, 0.834286, 0.834515,
-    0.834928, 0.835418, 0.835834, 0.836067, 0.836121, 0.836104,
-    0.836168, 0.836416, 0.83684, 0.837326, 0.837724, 0.837936,
-    0.837975, 0.837959, 0.838038, 0.838304, 0.838738, 0.839219,
-    0.839598, 0.839789, 0.839815, 0.839802, 0.839896, 0.84018,
-    0.840622, 0.841097, 0.841457, 0.841626, 0.841642, 0.841633,
-    0.841743, 0.842044, 0.842493, 0.842959, 0.8433, 0.843449,
-    0.843455, 0.843451, 0.843578, 0.843896, 0.844351, 0.844807,
-    0.845127, 0.845257, 0.845255, 0.845258, 0.845402, 0.845735,
-    0.846194, 0.84664, 0.84694, 0.847051, 0.847042, 0.847054,
-    0.847215, 0.847563, 0.848025, 0.848458, 0.848737, 0.84883,
-    0.848816, 0.848838, 0.849016, 0.849379, 0.849842, 0.850261,
-    0.85052, 0.850596, 0.850578, 0.850611, 0.850807, 0.851183,
-    0.851645, 0.85205, 0.852288, 0.852348, 0.852329, 0.852373,
-    0.852587, 0.852975, 0.853435, 0.853825, 0.854042, 0.854088,
-    0.854068, 0.854125, 0.854357, 0.854755, 0.855212, 0.855585,
-    0.855782, 0.855815, 0.855795, 0.855867, 0.856116, 0.856524,
-    0.856976, 0.857332, 0.857508, 0.857529, 0.857512, 0.857598,
-    0.857864, 0.85828, 0.858726, 0.859064, 0.859221, 0.859231,
-    0.859218, 0.859319, 0.859602, 0.860025, 0.860464, 0.860783,
-    0.86092, 0.860921, 0.860914, 0.861031, 0.86133, 0.861758,
-    0.862188, 0.862488, 0.862607, 0.8626, 0.8626, 0.862733,
-    0.863047, 0.86348, 0.863899, 0.86418, 0.864281, 0.864268,
-    0.864276, 0.864425, 0.864754, 0.865189, 0.865597, 0.865858,
-    0.865943, 0.865925, 0.865942, 0.866108, 0.86645, 0.866887,
-    0.867282, 0.867524, 0.867592, 0.867571, 0.867598, 0.867782,
-    0.868136, 0.868573, 0.868955, 0.869177, 0.86923, 0.869207,
-    0.869246, 0.869447, 0.869812, 0.870248, 0.870615, 0.870817,
-    0.870856, 0.870833, 0.870884, 0.871102, 0.871478, 0.87191,
-    0.872262, 0.872445, 0.872472, 0.87245, 0.872514, 0.872748,
-    0.873134, 0.873561, 0.873897, 0.87406, 0.874076, 0.874056,
-    0.874134, 0.874385, 0.874779, 0.875201, 0.875519, 0.875664,
-    0.87567, 0.875654, 0.875747, 0.876013, 0.876414, 0.876829,
-    0.877129, 0.877256, 0.877253, 0.877242, 0.87735, 0.877632,
-    0.878038, 0.878445, 0.878727, 0.878836, 0.878826, 0.878822,
-    0.878946, 0.879242, 0.879652, 0.880049, 0.880314, 0.880406,
-    0.880389, 0.880393, 0.880533, 0.880843, 0.881256, 0.881642,
-    0.881888, 0.881964, 0.881943, 0.881956, 0.882112, 0.882435,
-    0.88285, 0.883224, 0.883451, 0.883512, 0.883488, 0.88351,
-    0.883683, 0.884018, 0.884433, 0.884794, 0.885003, 0.885049,
-    0.885023, 0.885057, 0.885245, 0.885593, 0.886006, 0.886353,
-    0.886543, 0.886576, 0.88655, 0.886595, 0.8868, 0.887158,
-    0.887568, 0.887901, 0.888072, 0.888094, 0.888068, 0.888126,
-    0.888347, 0.888714, 0.88912, 0.889438, 0.88959, 0.889601,
-    0.889578, 0.88965, 0.889887, 0.890261, 0.890662, 0.890963,
-    0.891098, 0.891099, 0.89108, 0.891165, 0.891418, 0.891799,
-    0.892193, 0.892478, 0.892595, 0.892588, 0.892574, 0.892674,
-    0.892941, 0.893328, 0.893714, 0.893982, 0.894082, 0.894068,
-    0.89406, 0.894175, 0.894457, 0.894848, 0.895225, 0.895475,
-    0.895559, 0.895539, 0.895539, 0.895669, 0.895965, 0.896358,
-    0.896725, 0.896957, 0.897026, 0.897002, 0.89701, 0.897156,
-    0.897464, 0.89786, 0.898216, 0.89843, 0.898484, 0.898456,
-    0.898474, 0.898637, 0.898956, 0.899352, 0.899695, 0.899891,
-    0.899932, 0.899903, 0.899931, 0.90011, 0.90044, 0.900835,
-    0.901165, 0.901343, 0.901371, 0.901342, 0.901382, 0.901576,
-    0.901917, 0.902308, 0.902625, 0.902785, 0.902801, 0.902773,
-    0.902825, 0.903035, 0.903385, 0.903773, 0.904074, 0.904217,
-    0.904223, 0.904197, 0.904262, 0.904487, 0.904845, 0.905228,
-    0.905514, 0.905639, 0.905636, 0.905614, 0.905693, 0.905933,
-    0.906297, 0.906674, 0.906944, 0.907052, 0.907041, 0.907023,
-    0.907117, 0.907371, 0.907741, 0.90811, 0.908364, 0.908456,
-    0.908438, 0.908426, 0.908534, 0.908803, 0.909177, 0.909537,
-    0.909774, 0.909851, 0.909827, 0.909823, 0.909946, 0.910227,
-    0.910604, 0.910955, 0.911175, 0.911237, 0.911209, 0.911213,
-    0.911351, 0.911645, 0.912024, 0.912364, 0.912566, 0.912614,
-    0.912583, 0.912597, 0.91275, 0.913056, 0.913435, 0.913763,
-    0.913948, 0.913983, 0.913951, 0.913974, 0.914143, 0.91446,
-    0.914838, 0.915153, 0.915321, 0.915344, 0.915311, 0.915346,
-    0.91553, 0.915857, 0.916232, 0.916534, 0.916685, 0.916696,
-    0.916665, 0.916711, 0.916911, 0.917246, 0.917618, 0.917906,
-    0.91804, 0.918041, 0.918012, 0.918071, 0.918286, 0.918629,
-    0.918996, 0.919269, 0.919386, 0.919379, 0.919353, 0.919425,
-    0.919655, 0.920004, 0.920365, 0.920623, 0.920724, 0.920708,
-    0.920687, 0.920774, 0.921017, 0.921372, 0.921726, 0.921968,
-    0.922053, 0.922031, 0.922016, 0.922117, 0.922374, 0.922733,
-    0.923079, 0.923304, 0.923374, 0.923347, 0.923339, 0.923454,
-    0.923724, 0.924086, 0.924423, 0.924632, 0.924687, 0.924656,
-    0.924656, 0.924786, 0.925068, 0.925432, 0.925758, 0.925951,
-    0.925993, 0.925958, 0.925967, 0.926113, 0.926407, 0.926771,
-    0.927086, 0.927261, 0.92729, 0.927255, 0.927274, 0.927434,
-    0.927738, 0.928102, 0.928404, 0.928563, 0.928581, 0.928545,
-    0.928574, 0.92875, 0.929064, 0.929425, 0.929715, 0.929857,
-    0.929864, 0.929828, 0.92987, 0.930061, 0.930383, 0.930741,
-    0.931017, 0.931143, 0.931139, 0.931107, 0.931161, 0.931366,
-    0.931696, 0.932049, 0.932311, 0.93242, 0.932409, 0.932379,
-    0.932446, 0.932666, 0.933002, 0.93335, 0.933597, 0.93369,
-    0.933671, 0.933646, 0.933727, 0.93396, 0.934302, 0.934643,
-    0.934874, 0.934953, 0.934927, 0.934908, 0.935002, 0.935249,
-    0.935595, 0.935928, 0.936144, 0.936208, 0.936176, 0.936164,
-    0.936273, 0.936533, 0.936882, 0.937206, 0.937405, 0.937455,
-    0.93742, 0.937416, 0.937539, 0.937811, 0.938162, 0.938476,
-    0.938659, 0.938695, 0.938658, 0.938662, 0.938801, 0.939083,
-    0.939435, 0.939738, 0.939905, 0.939929, 0.93989, 0.939904,
-    0.940057, 0.94035, 0.940701, 0.940993, 0.941143, 0.941155,
-    0.941116, 0.941141, 0.941309, 0.941612, 0.941961, 0.942239,
-    0.942374, 0.942376, 0.942337, 0.942374, 0.942556, 0.942867,
-    0.943213, 0.943479, 0.943597, 0.943589, 0.943553, 0.943602,
-    0.943799, 0.944117, 0.944459, 0.94471, 0.944813, 0.944796,
-    0.944763, 0.944825, 0.945036, 0.945361, 0.945698, 0.945934,
-    0.946021, 0.945998, 0.945969, 0.946044, 0.946269, 0.9466,
-    0.946929, 0.947151, 0.947223, 0.947193, 0.94717, 0.947259,
-    0.947497, 0.947832, 0.948154, 0.94836, 0.948418, 0.948383,
-    0.948367, 0.94847, 0.94872, 0.949058, 0.949371, 0.949562,
-    0.949606, 0.949567, 0.949559, 0.949676, 0.949938, 0.950278,
-    0.950581, 0.950756, 0.950787, 0.950746, 0.950746, 0.950878,
-    0.951152, 0.951492, 0.951785, 0.951944, 0.951963, 0.95192,
-    0.95193, 0.952076, 0.95236, 0.9527, 0.952981, 0.953124,
-    0.953131, 0.953088, 0.953109, 0.95327, 0.953563, 0.953901,
-    0.95417, 0.954297, 0.954294, 0.954252, 0.954284, 0.954459,
-    0.954761, 0.955096, 0.955352, 0.955463, 0.955451, 0.955411,
-    0.955455, 0.955645, 0.955954, 0.956285, 0.956527, 0.956623,
-    0.956603, 0.956566, 0.956622, 0.956826, 0.957141, 0.957467,
-    0.957695, 0.957776, 0.957748, 0.957716, 0.957786, 0.958003,
-    0.958324, 0.958643, 0.958856, 0.958923, 0.958889, 0.958862,
-    0.958945, 0.959175, 0.9595, 0.959812, 0.960011, 0.960063,
-    0.960024, 0.960004, 0.960101, 0.960343, 0.960672, 0.960975,
-    0.961158, 0.961197, 0.961154, 0.961142, 0.961253, 0.961507,
-    0.961837, 0.962131, 0.962299, 0.962325, 0.962279, 0.962276,
-    0.962401, 0.962666, 0.962997, 0.963281, 0.963433, 0.963447,
-    0.9634, 0.963406, 0.963546, 0.963821, 0.964152, 0.964424,
-    0.96456, 0.964563, 0.964516, 0.964532, 0.964687, 0.964971,
-    0.9653, 0.965561, 0.965681, 0.965674, 0.965628, 0.965655,
-    0.965824, 0.966117, 0.966443, 0.966691, 0.966796, 0.966779,
-    0.966735, 0.966775, 0.966957, 0.967258, 0.96758, 0.967814,
-    0.967904, 0.967879, 0.967839, 0.96789, 0.968087, 0.968394,
-    0.968711, 0.968931, 0.969006, 0.968974, 0.968938, 0.969003,
-    0.969213, 0.969525, 0.969836, 0.970042, 0.970102, 0.970064,
-    0.970034, 0.970112, 0.970335, 0.970651, 0.970955, 0.971146,
-    0.971193, 0.97115, 0.971126, 0.971217, 0.971453, 0.971772,
-    0.972068, 0.972244, 0.972277, 0.97223, 0.972214, 0.97232,
-    0.972567, 0.972889, 0.973174, 0.973335, 0.973356, 0.973307,
-    0.973299, 0.973419, 0.973677, 0.973999, 0.974275, 0.97442,
-    0.974429, 0.974379, 0.97438, 0.974515, 0.974783, 0.975105,
-    0.97537, 0.975499, 0.975498, 0.975447, 0.975459, 0.975607,
-    0.975884, 0.976205, 0.976458, 0.976573, 0.976561, 0.976511,
-    0.976534, 0.976696, 0.976982, 0.9773, 0.977541, 0.97764,
-    0.977619, 0.977571, 0.977605, 0.977782, 0.978075, 0.97839,
-    0.978617, 0.978701, 0.978672, 0.978627, 0.978674, 0.978864,
-    0.979164, 0.979474, 0.979687, 0.979757, 0.97972, 0.97968,
-    0.97974, 0.979943, 0.980249, 0.980552, 0.980751, 0.980807,
-    0.980764, 0.98073, 0.980803, 0.981019, 0.981329, 0.981625,
-    0.981809, 0.981851, 0.981804, 0.981776, 0.981862, 0.982091,
-    0.982404, 0.982692, 0.982862, 0.98289, 0.982839, 0.982819,
-    0.982919, 0.98316, 0.983474, 0.983753, 0.983908, 0.983924,
-    0.983871, 0.983858, 0.983973, 0.984224, 0.98454, 0.984809,
-    0.984949, 0.984953, 0.984898, 0.984895, 0.985024, 0.985286,
-    0.985601, 0.985859, 0.985983, 0.985977, 0.985922, 0.985929,
-    0.986072, 0.986343, 0.986657, 0.986904, 0.987012, 0.986996,
-    0.986942, 0.98696, 0.987117, 0.987396, 0.987708, 0.987942,
-    0.988036, 0.988011, 0.987958, 0.987988, 0.988159, 0.988446,
-    0.988754, 0.988975, 0.989054, 0.989021, 0.988972, 0.989014,
-    0.989198, 0.989492, 0.989795, 0.990002, 0.990067, 0.990026,
-    0.989982, 0.990036, 0.990234, 0.990533, 0.99083, 0.991024,
-    0.991075, 0.991028, 0.990989, 0.991056, 0.991267, 0.99157,
-    0.99186, 0.99204, 0.992077, 0.992026, 0.991993, 0.992074,
-    0.992297, 0.992603, 0.992886, 0.99305, 0.993075, 0.993019,
-    0.992994, 0.993089, 0.993323, 0.993632, 0.993905, 0.994055,
-    0.994067, 0.994009, 0.993992, 0.994101, 0.994346, 0.994656,
-    0.99492, 0.995055, 0.995055, 0.994996, 0.994988, 0.99511,
-    0.995365, 0.995675, 0.995929, 0.996049, 0.996039, 0.995979,
-    0.99598, 0.996117, 0.996381, 0.99669, 0.996932, 0.997039,
-    0.997019, 0.99696, 0.996971, 0.99712, 0.997393, 0.997699,
-    0.997931, 0.998023, 0.997995, 0.997937, 0.997958, 0.99812,
-    0.998399, 0.998703, 0.998925, 0.999005, 0.99897, 0.998913,
-    0.998941, 0.999111, 0.999396, 0.999702, 0.999922, 1,
-    0.999956, 0.99987
-};
-
-static const float WAVE_LOGARITHMIC_042[DEFAULT_WAVELEN] = {
-    -1, -0.98924, -0.957804, -0.908128, -0.843996, -0.770144,
-    -0.691782, -0.614082, -0.541681, -0.478275, -0.426317, -0.386883,
-    -0.359682, -0.343223, -0.335109, -0.332398, -0.33201, -0.331111,
-    -0.327431, -0.319489, -0.306694, -0.289325, -0.268398, -0.245444,
-    -0.222244, -0.200544, -0.181799, -0.166986, -0.156486, -0.150072,
-    -0.146979, -0.146045, -0.14591, -0.145221, -0.142831, -0.137956,
-    -0.130265, -0.119904, -0.107445, -0.0937777, -0.0799587, -0.0670411,
-    -0.0559167, -0.0471881, -0.04109, -0.0374702, -0.035828, -0.0354049,
-    -0.0353088, -0.0346542, -0.0326951, -0.0289318, -0.0231763, -0.0155683,
-    -0.00654069, 0.0032576, 0.013069, 0.0221469, 0.0298698, 0.0358321,
-    0.0398988, 0.042218, 0.0431891, 0.0433936, 0.0435017, 0.0441664,
-    0.0459249, 0.0491202, 0.0538546, 0.0599815, 0.0671351, 0.0747936,
-    0.0823633, 0.0892725, 0.0950584, 0.0994356, 0.102336, 0.103912,
-    0.104509, 0.104609, 0.104749, 0.105441, 0.107092, 0.109945,
-    0.114045, 0.119239, 0.125201, 0.131489, 0.137615, 0.14312,
-    0.14765, 0.150998, 0.153144, 0.154246, 0.154617, 0.154668,
-    0.15485, 0.155576, 0.157165, 0.15979, 0.163456, 0.168002,
-    0.173131, 0.178456, 0.183566, 0.188083, 0.191728, 0.194355,
-    0.195977, 0.196756, 0.196982, 0.197016, 0.197245, 0.19801,
-    0.199562, 0.202024, 0.205369, 0.209434, 0.213941, 0.218548,
-    0.222898, 0.226677, 0.229663, 0.231757, 0.232996, 0.233548,
-    0.23368, 0.233718, 0.233996, 0.2348, 0.236331, 0.238669,
-    0.241766, 0.245455, 0.249476, 0.25352, 0.257276, 0.26048,
-    0.262957, 0.264641, 0.265592, 0.265978, 0.266051, 0.266106,
-    0.266434, 0.267278, 0.268796, 0.271036, 0.273932, 0.277315,
-    0.280941, 0.284529, 0.287805, 0.290548, 0.292617, 0.293979,
-    0.294708, 0.294972, 0.29501, 0.295091, 0.29547, 0.296353,
-    0.297863, 0.300022, 0.30275, 0.305877, 0.309172, 0.31238,
-    0.315258, 0.31762, 0.319358, 0.32046, 0.321015, 0.32119,
-    0.321211, 0.321324, 0.321754, 0.322674, 0.324179, 0.326269,
-    0.328851, 0.331758, 0.33477, 0.337653, 0.340196, 0.342238,
-    0.3437, 0.344591, 0.345007, 0.345118, 0.345136, 0.345285,
-    0.345765, 0.346721, 0.348222, 0.35025, 0.352704, 0.355417,
-    0.358182, 0.360784, 0.363037, 0.364806, 0.366036, 0.366753,
-    0.367061, 0.367126, 0.367151, 0.36734, 0.367868, 0.368858,
-    0.370355, 0.372327, 0.374665, 0.377205, 0.37975, 0.382104,
-    0.384104, 0.385639, 0.386672, 0.387244, 0.387466, 0.387501,
-    0.387541, 0.387771, 0.388347, 0.389368, 0.390861, 0.39278,
-    0.395011, 0.397393, 0.39974, 0.401875, 0.403651, 0.404982,
-    0.405846, 0.406298, 0.406453, 0.40647, 0.406531, 0.406804,
-    0.407426, 0.408475, 0.409963, 0.411831, 0.413963, 0.4162,
-    0.418367, 0.420303, 0.421882, 0.423032, 0.423752, 0.424104,
-    0.424207, 0.424217, 0.424303, 0.42462, 0.425285, 0.42636,
-    0.427841, 0.42966, 0.431698, 0.4338, 0.435802, 0.437558,
-    0.438959, 0.439952, 0.440547, 0.440816, 0.440879, 0.44089,
-    0.441006, 0.441367, 0.442074, 0.443172, 0.444643, 0.446414,
-    0.448362, 0.450337, 0.452187, 0.453779, 0.45502, 0.455873,
-    0.45636, 0.45656, 0.456596, 0.456615, 0.456763, 0.457168,
-    0.457914, 0.459031, 0.460492, 0.462215, 0.464076, 0.465932,
-    0.46764, 0.469081, 0.470177, 0.470906, 0.4713, 0.471445,
-    0.471462, 0.471494, 0.471677, 0.472125, 0.472908, 0.474042,
-    0.47549, 0.477163, 0.47894, 0.480683, 0.482258, 0.48356,
-    0.484526, 0.485145, 0.485459, 0.485559, 0.485566, 0.485616,
-    0.485836, 0.486326, 0.487142, 0.48829, 0.489722, 0.491346,
-    0.493042, 0.494676, 0.496127, 0.497301, 0.498148, 0.498669,
-    0.498915, 0.498979, 0.498983, 0.499055, 0.499313, 0.499844,
-    0.500691, 0.501849, 0.503263, 0.504838, 0.506453, 0.507984,
-    0.509317, 0.510373, 0.511112, 0.511546, 0.511734, 0.511772,
-    0.511779, 0.511876, 0.512172, 0.512742, 0.513618, 0.514783,
-    0.516177, 0.517701, 0.519238, 0.520669, 0.521892, 0.522837,
-    0.523478, 0.523836, 0.523976, 0.523995, 0.524009, 0.524135,
-    0.52447, 0.525077, 0.525978, 0.527147, 0.528517, 0.52999,
-    0.53145, 0.532786, 0.533904, 0.534747, 0.5353, 0.53559,
-    0.535689, 0.535696, 0.535723, 0.53588, 0.536252, 0.536895,
-    0.537819, 0.538989, 0.540333, 0.541753, 0.543138, 0.544381,
-    0.545402, 0.54615, 0.546622, 0.546854, 0.54692, 0.546921,
-    0.546964, 0.547153, 0.547563, 0.548239, 0.549182, 0.55035,
-    0.551667, 0.553033, 0.554343, 0.555498, 0.556425, 0.557086,
-    0.557485, 0.557666, 0.557707, 0.557707, 0.55777, 0.557992,
-    0.558439, 0.559146, 0.560105, 0.561267, 0.562554, 0.563867,
-    0.565103, 0.566173, 0.567012, 0.567592, 0.567926, 0.568063,
-    0.568084, 0.568088, 0.568174, 0.56843, 0.568913, 0.569649,
-    0.57062, 0.571774, 0.573028, 0.574287, 0.575451, 0.576439,
-    0.577195, 0.5777, 0.577975, 0.578075, 0.578083, 0.578095,
-    0.578207, 0.578496, 0.579014, 0.579776, 0.580757, 0.581899,
-    0.583119, 0.584323, 0.585416, 0.586325, 0.587003, 0.58744,
-    0.587662, 0.587732, 0.587731, 0.587755, 0.587893, 0.588217,
-    0.588768, 0.589553, 0.590541, 0.591669, 0.592853, 0.594,
-    0.595025, 0.595858, 0.596462, 0.596836, 0.597012, 0.597057,
-    0.597053, 0.597092, 0.597259, 0.597617, 0.598199, 0.599004,
-    0.599995, 0.601106, 0.602252, 0.603344, 0.6043, 0.605061,
-    0.605596, 0.605912, 0.606049, 0.606073, 0.60607, 0.606128,
-    0.606324, 0.606716, 0.607328, 0.60815, 0.609142, 0.610233,
-    0.611339, 0.612375, 0.613264, 0.613955, 0.614426, 0.61469,
-    0.614792, 0.614802, 0.614804, 0.614882, 0.615109, 0.615534,
-    0.616173, 0.61701, 0.617999, 0.619067, 0.620133, 0.621112,
-    0.621937, 0.622561, 0.622972, 0.623189, 0.623262, 0.623262,
-    0.623272, 0.623373, 0.623631, 0.624087, 0.624751, 0.6256,
-    0.626583, 0.627627, 0.628651, 0.629574, 0.630335, 0.630897,
-    0.631252, 0.631427, 0.631475, 0.631469, 0.631491, 0.631616,
-    0.631905, 0.632392, 0.633079, 0.633937, 0.634912, 0.635929,
-    0.636908, 0.637776, 0.638476, 0.638977, 0.639281, 0.639418,
-    0.639446, 0.639439, 0.639475, 0.639627, 0.639947, 0.640463,
-    0.64117, 0.642034, 0.642997, 0.643985, 0.64492, 0.645733,
-    0.646373, 0.646818, 0.647075, 0.647179, 0.647192, 0.647186,
-    0.64724, 0.647418, 0.647769, 0.648312, 0.649037, 0.649905,
-    0.650854, 0.651811, 0.652701, 0.653459, 0.654042, 0.654433,
-    0.654646, 0.654722, 0.654724, 0.654724, 0.654796, 0.655003,
-    0.655384, 0.655952, 0.656692, 0.65756, 0.658493, 0.659417,
-    0.660261, 0.660965, 0.661493, 0.661834, 0.662008, 0.66206,
-    0.662054, 0.662063, 0.662156, 0.662391, 0.662802, 0.663394,
-    0.664147, 0.665012, 0.665926, 0.666815, 0.667613, 0.668265,
-    0.66874, 0.669034, 0.669173, 0.669205, 0.669195, 0.669215,
-    0.669331, 0.669595, 0.670033, 0.670647, 0.67141, 0.67227,
-    0.673162, 0.674016, 0.674767, 0.675367, 0.675792, 0.676043,
-    0.67615, 0.676166, 0.676156, 0.67619, 0.67633, 0.676622,
-    0.677088, 0.677721, 0.678491, 0.679343, 0.680212, 0.681029,
-    0.681734, 0.682283, 0.682659, 0.68287, 0.68295, 0.682953,
-    0.682946, 0.682996, 0.683162, 0.683482, 0.683973, 0.684624,
-    0.685398, 0.68624, 0.687083, 0.687862, 0.688521, 0.689022,
-    0.689352, 0.689526, 0.689582, 0.689577, 0.689576, 0.689644,
-    0.689835, 0.690183, 0.690698, 0.691364, 0.69214, 0.692969,
-    0.693785, 0.694525, 0.695138, 0.695591, 0.695878, 0.696019,
-    0.696055, 0.696044, 0.696052, 0.69614, 0.696357, 0.696732,
-    0.69727, 0.697948, 0.698723, 0.699537, 0.700324, 0.701025,
-    0.701592, 0.701999, 0.702247, 0.702357, 0.702377, 0.702364,
-    0.702382, 0.702491, 0.702735, 0.703137, 0.703695, 0.704383,
-    0.705155, 0.705951, 0.706708, 0.707368, 0.707891, 0.708254,
-    0.708464, 0.708548, 0.708554, 0.708542, 0.708574, 0.708705,
-    0.708976, 0.709403, 0.709979, 0.710675, 0.711441, 0.712217,
-    0.712942, 0.713563, 0.714041, 0.714363, 0.714538, 0.714599,
-    0.714595, 0.714586, 0.714634, 0.714788, 0.715085, 0.715536,
-    0.716129, 0.71683, 0.717588, 0.718342, 0.719034, 0.719614,
-    0.72005, 0.720333, 0.720476, 0.720516, 0.720505, 0.720503,
-    0.720567, 0.720746, 0.721069, 0.721542, 0.72215, 0.722853,
-    0.7236, 0.724331, 0.72499, 0.725529, 0.725924, 0.726168,
-    0.726283, 0.726306, 0.726291, 0.726297, 0.726381, 0.726584,
-    0.726932, 0.727427, 0.728046, 0.72875, 0.729484, 0.73019,
-    0.730813, 0.731313, 0.731667, 0.731877, 0.731965, 0.731974,
-    0.731958, 0.731975, 0.732079, 0.732307, 0.73268, 0.733194,
-    0.733823, 0.734525, 0.735244, 0.735923, 0.736511, 0.736971,
-    0.737287, 0.737463, 0.737528, 0.737526, 0.737512, 0.737542,
-    0.737667, 0.73792, 0.738316, 0.738848, 0.739485, 0.740182,
-    0.740884, 0.741535, 0.742087, 0.742509, 0.742787, 0.742933,
-    0.742978, 0.742967, 0.742958, 0.743003, 0.743149, 0.743427,
-    0.743846, 0.744393, 0.745036, 0.745726, 0.746409, 0.747031,
-    0.747547, 0.74793, 0.748174, 0.748292, 0.748319, 0.748303,
-    0.7483, 0.748361, 0.748531, 0.748833, 0.749273, 0.749834,
-    0.750479, 0.75116, 0.751822, 0.752414, 0.752894, 0.753241,
-    0.753451, 0.753543, 0.753555, 0.753537, 0.753543, 0.753622,
-    0.753815, 0.754141, 0.754601, 0.755173, 0.755819, 0.756489,
-    0.757129, 0.757689, 0.758134, 0.758444, 0.758623, 0.758692,
-    0.758692, 0.758674, 0.75869, 0.758789, 0.759005, 0.759355,
-    0.759832, 0.760414, 0.761059, 0.761715, 0.762331, 0.76286,
-    0.763269, 0.763545, 0.763694, 0.763743, 0.763734, 0.763718,
-    0.763747, 0.763866, 0.764106, 0.764477, 0.764972, 0.765561,
-    0.766202, 0.766843, 0.767433, 0.76793, 0.768304, 0.768547,
-    0.768668, 0.7687, 0.768684, 0.768673, 0.768717, 0.768857,
-    0.769119, 0.769512, 0.770021, 0.770616, 0.77125, 0.771875,
-    0.772439, 0.772903, 0.773243, 0.773453, 0.77355, 0.773566,
-    0.773546, 0.773542, 0.773602, 0.773763, 0.774049, 0.774462,
-    0.774984, 0.775581, 0.776208, 0.776814, 0.77735, 0.777782,
-    0.778088, 0.778269, 0.778343, 0.778346, 0.778325, 0.778329,
-    0.778406, 0.77859, 0.778898, 0.779329, 0.779863, 0.780461,
-    0.781078, 0.781663, 0.782171, 0.78257, 0.782844, 0.782996,
-    0.78305, 0.783042, 0.783022, 0.783038, 0.783133, 0.783339,
-    0.783669, 0.784117, 0.78466, 0.785257, 0.785861, 0.786425,
-    0.786904, 0.787271, 0.787513, 0.787639, 0.787674, 0.787659,
-    0.787642, 0.78767, 0.787785, 0.788013, 0.788364, 0.788828,
-    0.789377, 0.789971, 0.790562, 0.791102, 0.791552, 0.791886,
-    0.792099, 0.7922, 0.792219, 0.792199, 0.792187, 0.792229,
-    0.792364, 0.792614, 0.792985, 0.793463, 0.794018, 0.794607,
-    0.795182, 0.795697, 0.796117, 0.796421, 0.796604, 0.796682,
-    0.796689, 0.796665, 0.79666, 0.796718, 0.796873, 0.797146,
-    0.797535, 0.798026, 0.798583, 0.799165, 0.799722, 0.800213,
-    0.800603, 0.800875, 0.801031, 0.80109, 0.801085, 0.801061,
-    0.801065, 0.801139, 0.801316, 0.801609, 0.802017, 0.802517,
-    0.803076, 0.803648, 0.804187, 0.804651, 0.805011, 0.805254,
-    0.805384, 0.805424, 0.80541, 0.805388, 0.805403, 0.805495,
-    0.805692, 0.806006, 0.80643, 0.80694, 0.807498, 0.808058,
-    0.808577, 0.809014, 0.809345, 0.809558, 0.809664, 0.809688,
-    0.809668, 0.809649, 0.809676, 0.809787, 0.810006, 0.81034,
-    0.810779, 0.811295, 0.81185, 0.812398, 0.812895, 0.813305,
-    0.813606, 0.813792, 0.813875, 0.813885, 0.81386, 0.813847,
-    0.813888, 0.814018, 0.814258, 0.814611, 0.815063, 0.815584,
-    0.816134, 0.816667, 0.817142, 0.817524, 0.817796, 0.817956,
-    0.818019, 0.818016, 0.81799, 0.817984, 0.81804, 0.81819,
-    0.818451, 0.818822, 0.819286, 0.81981, 0.820353, 0.82087,
-    0.821321, 0.821675, 0.821918, 0.822053, 0.822097, 0.822085,
-    0.822059, 0.822062, 0.822135, 0.822305, 0.822586, 0.822974,
-    0.823447, 0.823972, 0.824506, 0.825006, 0.825432, 0.825759,
-    0.825975, 0.826085, 0.826113, 0.826094, 0.82607, 0.826084,
-    0.826174, 0.826364, 0.826665, 0.827068, 0.82755, 0.828074,
-    0.828597, 0.829078, 0.829479, 0.829778, 0.829967, 0.830056,
-    0.830069, 0.830044, 0.830024, 0.830051, 0.830158, 0.830369,
-    0.830689, 0.831106, 0.831594, 0.832116, 0.832627, 0.833087,
-    0.833463, 0.833735, 0.833898, 0.833966, 0.833967, 0.833938,
-    0.833924, 0.833964, 0.834091, 0.834322, 0.83466, 0.83509,
-    0.835582, 0.836099, 0.836596, 0.837035, 0.837385, 0.83763,
-    0.837768, 0.837818, 0.837808, 0.837778, 0.837772, 0.837827,
-    0.837973, 0.838224, 0.838579, 0.83902, 0.839515, 0.840025,
-    0.840507, 0.840924, 0.841248, 0.841465, 0.841581, 0.841613,
-    0.841595, 0.841566, 0.841569, 0.84164, 0.841805, 0.842076,
-    0.842447, 0.842897, 0.843393, 0.843894, 0.84436, 0.844754,
-    0.845051, 0.845243, 0.845337, 0.845354, 0.845329, 0.845303,
-    0.845317, 0.845405, 0.84559, 0.845879, 0.846265, 0.846723,
-    0.847218, 0.847709, 0.848157, 0.848527, 0.848799, 0.848966,
-    0.849039, 0.849043, 0.849014, 0.848992, 0.849018, 0.849123,
-    0.849328, 0.849636, 0.850035, 0.850499, 0.850991, 0.851471,
-    0.851899, 0.852245, 0.852491, 0.852634, 0.852688, 0.85268,
-    0.852649, 0.852634, 0.852673, 0.852797, 0.853021, 0.853346,
-    0.853757, 0.854225, 0.854712, 0.855179, 0.855587, 0.855909,
-    0.856129, 0.856249, 0.856286, 0.856269, 0.856237, 0.85623,
-    0.856284, 0.856426, 0.856669, 0.857011, 0.857432, 0.857903,
-    0.858384, 0.858836, 0.859223, 0.859519, 0.859715, 0.859813,
-    0.859835, 0.859811, 0.85978, 0.859782, 0.859852, 0.860013,
-    0.860275, 0.860632, 0.861062, 0.861533, 0.862006, 0.862442,
-    0.862807, 0.863079, 0.86325, 0.863328, 0.863336, 0.863306,
-    0.863279, 0.863292, 0.863378, 0.863558, 0.863838, 0.864209,
-    0.864646, 0.865116, 0.86558, 0.865998, 0.866341, 0.866588,
-    0.866736, 0.866795, 0.866791, 0.866757, 0.866735, 0.86676,
-    0.866864, 0.867063, 0.86736, 0.867744, 0.868187, 0.868654,
-    0.869106, 0.869506, 0.869826, 0.870049, 0.870174, 0.870216,
-    0.870201, 0.870166, 0.87015, 0.870189, 0.87031, 0.870528,
-    0.870842, 0.871237, 0.871684, 0.872146, 0.872586, 0.872967,
-    0.873263, 0.873462, 0.873565, 0.873591, 0.873568, 0.873533,
-    0.873525, 0.873579, 0.873718, 0.873955, 0.874285, 0.874689,
-    0.875138, 0.875595, 0.87602, 0.87638, 0.876653, 0.876828,
-    0.876912, 0.876923, 0.876894, 0.876861, 0.876862, 0.876931,
-    0.877089, 0.877344, 0.877688, 0.878101, 0.878551, 0.878999,
-    0.879409, 0.879748, 0.879998, 0.88015, 0.880214, 0.880213,
-    0.880179, 0.880149, 0.880162, 0.880247, 0.880423, 0.880696,
-    0.881054, 0.881473, 0.881922, 0.88236, 0.882754, 0.883072,
-    0.883297, 0.883427, 0.883474, 0.883462, 0.883425, 0.883401,
-    0.883426, 0.883528, 0.883722, 0.884012, 0.884382, 0.884806,
-    0.885252, 0.88568, 0.886055, 0.886351, 0.886554, 0.886662,
-    0.886693, 0.886671, 0.886633, 0.886616, 0.886654, 0.886774,
-    0.886987, 0.887292, 0.887673, 0.888101, 0.888542, 0.888957,
-    0.889314, 0.889588, 0.889767, 0.889856, 0.889871, 0.889842,
-    0.889805, 0.889796, 0.889849, 0.889986, 0.890217, 0.890537,
-    0.890927, 0.891358, 0.891792, 0.892194, 0.892531, 0.892782,
-    0.892939, 0.893009, 0.893011, 0.892976, 0.892941, 0.892943,
-    0.893011, 0.893166, 0.893414, 0.893748, 0.894147, 0.894577,
-    0.895004, 0.89539, 0.895707, 0.895936, 0.896071, 0.896123,
-    0.896113, 0.896075, 0.896044, 0.896056, 0.89614, 0.896313,
-    0.896579, 0.896926, 0.89733, 0.897759, 0.898177, 0.898547,
-    0.898843, 0.899049, 0.899164, 0.899199, 0.899179, 0.899138,
-    0.899113, 0.899138, 0.899239, 0.89943, 0.899712, 0.90007,
-    0.900479, 0.900905, 0.901312, 0.901665, 0.90194, 0.902124,
-    0.902218, 0.902237, 0.902209, 0.902168, 0.902151, 0.902189,
-    0.902306, 0.902515, 0.902813, 0.903181, 0.903594, 0.904015,
-    0.904409, 0.904745, 0.904998, 0.90516, 0.905235, 0.90524,
-    0.905206, 0.905166, 0.905157, 0.905209, 0.905345, 0.905571,
-    0.905883, 0.906261, 0.906675, 0.90709, 0.90747, 0.907787,
-    0.908018, 0.908159, 0.908215, 0.908209, 0.908169, 0.908133,
-    0.908133, 0.908201, 0.908354, 0.908597, 0.908923, 0.909308,
-    0.909722, 0.910129, 0.910495, 0.910792, 0.911001, 0.911121,
-    0.911161, 0.911143, 0.911101, 0.911068, 0.911081, 0.911164,
-    0.911335, 0.911595, 0.911932, 0.912323, 0.912736, 0.913134,
-    0.913484, 0.91376, 0.913948, 0.914048, 0.914072, 0.914045,
-    0.914001, 0.913975, 0.914, 0.914099, 0.914288, 0.914563,
-    0.914912, 0.915308, 0.915717, 0.916104, 0.916437, 0.916693,
-    0.91686, 0.91694, 0.91695, 0.916916, 0.916872, 0.916853,
-    0.916891, 0.917008, 0.917213, 0.917504, 0.917863, 0.918261,
-    0.918665, 0.919041, 0.919356, 0.919591, 0.919737, 0.919799,
-    0.919796, 0.919756, 0.919713, 0.919704, 0.919756, 0.91989,
-    0.920113, 0.920417, 0.920784, 0.921184, 0.921582, 0.921944,
-    0.922241, 0.922455, 0.92258, 0.922625, 0.92261, 0.922566,
-    0.922527, 0.922527, 0.922595, 0.922746, 0.922985, 0.923303,
-    0.923677, 0.924077, 0.924467, 0.924814, 0.925092, 0.925285,
-    0.92539, 0.925419, 0.925394, 0.925347, 0.925313, 0.925325,
-    0.925408, 0.925577, 0.925832, 0.926162, 0.926542, 0.926939,
-    0.92732, 0.927652, 0.92791, 0.928082, 0.928168, 0.928182,
-    0.928149, 0.928101, 0.928074, 0.928098, 0.928197, 0.928383,
-    0.928654, 0.928994, 0.929378, 0.929772, 0.930142, 0.930457,
-    0.930696, 0.930847, 0.930914, 0.930915, 0.930875, 0.930828,
-    0.930808, 0.930846, 0.930962, 0.931165, 0.931451, 0.9318,
-    0.932186, 0.932575, 0.932934, 0.933231, 0.933449, 0.93358,
-    0.93363, 0.933618, 0.933573, 0.933529, 0.933518, 0.93357,
-    0.933703, 0.933923, 0.934222, 0.93458, 0.934967, 0.93535,
-    0.935695, 0.935974, 0.936172, 0.936283, 0.936316, 0.936294,
-    0.936245, 0.936204, 0.936204, 0.936272, 0.936422, 0.936658,
-    0.936969, 0.937334, 0.93772, 0.938095, 0.938425, 0.938686,
-    0.938864, 0.938955, 0.938973, 0.938942, 0.938891, 0.938855,
-    0.938867, 0.93895, 0.939117, 0.939369, 0.939692, 0.940062,
-    0.940446, 0.940811, 0.941127, 0.941368, 0.941525, 0.941598,
-    0.941602, 0.941563, 0.941512, 0.941483, 0.941507, 0.941607,
-    0.941791, 0.942058, 0.942391, 0.942764, 0.943145, 0.9435,
-    0.943798, 0.944021, 0.944157, 0.944212, 0.944204, 0.944158,
-    0.944108, 0.944088, 0.944126, 0.944242, 0.944443, 0.944724,
-    0.945066, 0.945441, 0.945817, 0.94616, 0.946441, 0.946644,
-    0.94676, 0.946799, 0.946779, 0.946728, 0.946681, 0.946671,
-    0.946723, 0.946855, 0.947073, 0.947367, 0.947717, 0.948093,
-    0.948462, 0.948792, 0.949055, 0.949238, 0.949335, 0.949358,
-    0.949328, 0.949275, 0.949232, 0.949232, 0.949299, 0.949449,
-    0.949682, 0.949989, 0.950345, 0.95072, 0.951081, 0.951396,
-    0.951641, 0.951804, 0.951883, 0.951891, 0.951852, 0.951797,
-    0.95176, 0.951772, 0.951855, 0.952022, 0.952271, 0.952588,
-    0.952949, 0.953322, 0.953673, 0.953973, 0.9542, 0.954342,
-    0.954403, 0.954398, 0.954352, 0.954297, 0.954268, 0.954292,
-    0.954391, 0.954575, 0.954838, 0.955166, 0.95553, 0.955899,
-    0.956239, 0.956523, 0.95673, 0.956853, 0.956897, 0.95688,
-    0.956828, 0.956776, 0.956754, 0.956792, 0.956908, 0.957108,
-    0.957386, 0.957721, 0.958088, 0.958451, 0.95878, 0.959047,
-    0.959234, 0.959338, 0.959365, 0.959337, 0.959282, 0.959232,
-    0.959221, 0.959274, 0.959406, 0.959623, 0.959913, 0.960256,
-    0.960622, 0.960979, 0.961295, 0.961544, 0.961712, 0.961796,
-    0.961809, 0.961771, 0.961713, 0.961669, 0.961668, 0.961736,
-    0.961886, 0.962118, 0.96242, 0.962769, 0.963134, 0.963482,
-    0.963784, 0.964015, 0.964163, 0.964229, 0.964228, 0.964182,
-    0.964124, 0.964085, 0.964097, 0.964181, 0.964347, 0.964594,
-    0.964907, 0.96526, 0.965623, 0.965962, 0.966248, 0.96646,
-    0.966589, 0.966638, 0.966623, 0.966571, 0.966514, 0.966483,
-    0.966507, 0.966607, 0.96679, 0.967052, 0.967374, 0.96773,
-    0.968089, 0.968417, 0.968687, 0.96888, 0.968989, 0.969022,
-    0.968996, 0.968939, 0.968883, 0.968861, 0.9689, 0.969016,
-    0.969216, 0.969491, 0.969821, 0.970179, 0.970532, 0.970848,
-    0.971101, 0.971274, 0.971365, 0.971382, 0.971346, 0.971286,
-    0.971234, 0.971222, 0.971275, 0.971409, 0.971624, 0.971911,
-    0.972249, 0.972607, 0.972953, 0.973255, 0.97349, 0.973645,
-    0.973717, 0.97372, 0.973675, 0.973612, 0.973566, 0.973565,
-    0.973634, 0.973784, 0.974015, 0.974314, 0.974657, 0.975013,
-    0.975351, 0.975639, 0.975856, 0.975991, 0.976046, 0.976034,
-    0.975982, 0.97592, 0.97588, 0.975892, 0.975976, 0.976143,
-    0.976389, 0.976698, 0.977045, 0.977399, 0.977726, 0.977999,
-    0.978198, 0.978313, 0.978351, 0.978328, 0.978269, 0.978208,
-    0.978176, 0.978201, 0.978302, 0.978486, 0.978746, 0.979064,
-    0.979414, 0.979763, 0.98008, 0.980336, 0.980516, 0.980612,
-    0.980634, 0.980599, 0.980537, 0.980478, 0.980456, 0.980495,
-    0.980613, 0.980813, 0.981086, 0.981413, 0.981764, 0.982107,
-    0.982411, 0.98265, 0.98281, 0.982888, 0.982895, 0.982851,
-    0.982785, 0.982731, 0.982719, 0.982774, 0.982908, 0.983124,
-    0.98341, 0.983743, 0.984093, 0.984429, 0.984719, 0.984941,
-    0.985082, 0.985142, 0.985134, 0.985082, 0.985015, 0.984967,
-    0.984967, 0.985037, 0.985188, 0.98542, 0.985717, 0.986055,
-    0.986404, 0.98673, 0.987006, 0.98721, 0.987331, 0.987374,
-    0.987353, 0.987293, 0.987227, 0.987186, 0.987199, 0.987285,
-    0.987454, 0.9877, 0.988007, 0.988349, 0.988695, 0.989011,
-    0.989271, 0.989456, 0.989558, 0.989584, 0.989551, 0.989486,
-    0.989422, 0.98939, 0.989416, 0.98952, 0.989705, 0.989965,
-    0.990282, 0.990626, 0.990966, 0.991271, 0.991514, 0.991679,
-    0.991763, 0.991772, 0.991729, 0.99166, 0.9916, 0.991578,
-    0.991619, 0.99174, 0.991942, 0.992216, 0.99254, 0.992885,
-    0.993219, 0.99351, 0.993736, 0.993881, 0.993945, 0.993939,
-    0.993886, 0.993816, 0.99376, 0.99375, 0.993809, 0.993948,
-    0.994167, 0.994454, 0.994784, 0.995128, 0.995453, 0.995729,
-    0.995935, 0.996059, 0.996103, 0.996083, 0.996022, 0.995952,
-    0.995904, 0.995909, 0.995986, 0.996146, 0.996383, 0.996682,
-    0.997018, 0.997358, 0.99767, 0.997927, 0.998108, 0.998207,
-    0.99823, 0.998194, 0.998127, 0.998062, 0.998031, 0.998061,
-    0.998169, 0.998359, 0.998623, 0.998936, 0.999267, 0.999578,
-    0.999833, 1
-};
-
-static const float WAVE_LOGARITHMIC_054[DEFAULT_WAVELEN] = {
-    -1, -0.997016, -0.988125, -0.973499, -0.953425, -0.928292,
-    -0.898584, -0.864864, -0.827763, -0.787964, -0.746179, -0.703139,
-    -0.659571, -0.616182, -0.573641, -0.532568, -0.493513, -0.456951,
-    -0.423272, -0.392771, -0.365647, -0.342003, -0.321847, -0.305094,
-    -0.291577, -0.281055, -0.273221, -0.267717, -0.264149, -0.262096,
-    -0.261127, -0.260818, -0.260758, -0.260567, -0.259902, -0.25847,
-    -0.256033, -0.252411, -0.247487, -0.241207, -0.233579, -0.224666,
-    -0.214584, -0.203494, -0.191595, -0.179111, -0.166287, -0.153372,
-    -0.140618, -0.128261, -0.116522, -0.105591, -0.0956264, -0.0867489,
-    -0.079037, -0.0725263, -0.0672097, -0.063039, -0.0599277, -0.0577555,
-    -0.0563742, -0.0556134, -0.0552881, -0.0552059, -0.0551739, -0.0550067,
-    -0.0545324, -0.0535988, -0.0520788, -0.0498738, -0.0469172, -0.0431753,
-    -0.0386482, -0.0333682, -0.0273981, -0.0208277, -0.0137697, -0.00635444,
-    0.001275, 0.00896916, 0.0165779, 0.0239561, 0.0309695, 0.0374993,
-    0.0434462, 0.0487344, 0.0533134, 0.0571598, 0.0602772, 0.0626959,
-    0.0644709, 0.0656794, 0.0664174, 0.0667954, 0.0669344, 0.0669603,
-    0.0669996, 0.0671745, 0.0675978, 0.0683693, 0.0695721, 0.0712698,
-    0.0735041, 0.0762943, 0.0796363, 0.0835037, 0.0878493, 0.0926068,
-    0.0976945, 0.103018, 0.108475, 0.113958, 0.119361, 0.124579,
-    0.129519, 0.134097, 0.138244, 0.141909, 0.145058, 0.147678,
-    0.149775, 0.151377, 0.152525, 0.153282, 0.15372, 0.153924,
-    0.153984, 0.153994, 0.15405, 0.15424, 0.154648, 0.155346,
-    0.156393, 0.157834, 0.159696, 0.161988, 0.164703, 0.167816,
-    0.171287, 0.175062, 0.179074, 0.183249, 0.187505, 0.191759,
-    0.195928, 0.199934, 0.203703, 0.207174, 0.210296, 0.213032,
-    0.215361, 0.217275, 0.218786, 0.219916, 0.220706, 0.221205,
-    0.221475, 0.221584, 0.221607, 0.221618, 0.221693, 0.221902,
-    0.222309, 0.22297, 0.223928, 0.225215, 0.22685, 0.228835,
-    0.231161, 0.233803, 0.236725, 0.23988, 0.24321, 0.246653,
-    0.250143, 0.253609, 0.256986, 0.26021, 0.263224, 0.265978,
-    0.268436, 0.27057, 0.272366, 0.273822, 0.274952, 0.275779,
-    0.276338, 0.276674, 0.276841, 0.276896, 0.276902, 0.276923,
-    0.277018, 0.277247, 0.27766, 0.278301, 0.279203, 0.28039,
-    0.281872, 0.283649, 0.285709, 0.288027, 0.290569, 0.293293,
-    0.296149, 0.299083, 0.302036, 0.304952, 0.307774, 0.310449,
-    0.312932, 0.315183, 0.317174, 0.318884, 0.320307, 0.321443,
-    0.322308, 0.322924, 0.323325, 0.323551, 0.323651, 0.323675,
-    0.323677, 0.32371, 0.323828, 0.324076, 0.324499, 0.32513,
-    0.325995, 0.327112, 0.328485, 0.33011, 0.331975, 0.334054,
-    0.336316, 0.338722, 0.341227, 0.343782, 0.346338, 0.348844,
-    0.351253, 0.35352, 0.355607, 0.357485, 0.359128, 0.360525,
-    0.361671, 0.362571, 0.363241, 0.363704, 0.363992, 0.364142,
-    0.364198, 0.364204, 0.364209, 0.364259, 0.364398, 0.364667,
-    0.365102, 0.365729, 0.366568, 0.367633, 0.368923, 0.370433,
-    0.372148, 0.374043, 0.376088, 0.378247, 0.380479, 0.382741,
-    0.384987, 0.387175, 0.389262, 0.391212, 0.392993, 0.39458,
-    0.395955, 0.39711, 0.398043, 0.398763, 0.399285, 0.399634,
-    0.399838, 0.399934, 0.399961, 0.399959, 0.399972, 0.400039,
-    0.400201, 0.400491, 0.400937, 0.401564, 0.402386, 0.40341,
-    0.404636, 0.406054, 0.407649, 0.409396, 0.411267, 0.413228,
-    0.41524, 0.417265, 0.419262, 0.421194, 0.423023, 0.424719,
-    0.426254, 0.427609, 0.42877, 0.429732, 0.430498, 0.431075,
-    0.431483, 0.431743, 0.431886, 0.431943, 0.431951, 0.431948,
-    0.431972, 0.432059, 0.432242, 0.432552, 0.433012, 0.433641,
-    0.434449, 0.435441, 0.436614, 0.437957, 0.439453, 0.441078,
-    0.442805, 0.444601, 0.446432, 0.448261, 0.450052, 0.451772,
-    0.453389, 0.454875, 0.456208, 0.457373, 0.458359, 0.459165,
-    0.459794, 0.460259, 0.460575, 0.460767, 0.460862, 0.460892,
-    0.46089, 0.460891, 0.460928, 0.461035, 0.46124, 0.461569,
-    0.462043, 0.462675, 0.463473, 0.464439, 0.465568, 0.466847,
-    0.468259, 0.469781, 0.471385, 0.473042, 0.474719, 0.476382,
-    0.477999, 0.47954, 0.480977, 0.482287, 0.483451, 0.484457,
-    0.485298, 0.485975, 0.486493, 0.486864, 0.487108, 0.487246,
-    0.487306, 0.487317, 0.487311, 0.487318, 0.487371, 0.487498,
-    0.487725, 0.488073, 0.48856, 0.489196, 0.489987, 0.490931,
-    0.492021, 0.493245, 0.494585, 0.496017, 0.497515, 0.499051,
-    0.500594, 0.502114, 0.503582, 0.504969, 0.506253, 0.507412,
-    0.508432, 0.509303, 0.510022, 0.51059, 0.511015, 0.51131,
-    0.511495, 0.511591, 0.511625, 0.511624, 0.511617, 0.511635,
-    0.511704, 0.511852, 0.512099, 0.512466, 0.512966, 0.513606,
-    0.514391, 0.515316, 0.516373, 0.517548, 0.518823, 0.520176,
-    0.521581, 0.52301, 0.524437, 0.525831, 0.527168, 0.528421,
-    0.529571, 0.5306, 0.531496, 0.532251, 0.532865, 0.533341,
-    0.533688, 0.533921, 0.534058, 0.534121, 0.534135, 0.534127,
-    0.534124, 0.534154, 0.534241, 0.534409, 0.534677, 0.535062,
-    0.535574, 0.536219, 0.536998, 0.537906, 0.538932, 0.540064,
-    0.541281, 0.542563, 0.543884, 0.545219, 0.546541, 0.547824,
-    0.549044, 0.55018, 0.551212, 0.552127, 0.552914, 0.553569,
-    0.554093, 0.55449, 0.554771, 0.554952, 0.55505, 0.555087,
-    0.555088, 0.555077, 0.555081, 0.555125, 0.55523, 0.555418,
-    0.555707, 0.556109, 0.556633, 0.557282, 0.558056, 0.558947,
-    0.559947, 0.561038, 0.562203, 0.56342, 0.564665, 0.565914,
-    0.567142, 0.568325, 0.569442, 0.570472, 0.571399, 0.572213,
-    0.572905, 0.573472, 0.573917, 0.574247, 0.574473, 0.574609,
-    0.574676, 0.574694, 0.574686, 0.574677, 0.574689, 0.574748,
-    0.574872, 0.57508, 0.575388, 0.575807, 0.576342, 0.576995,
-    0.577764, 0.578641, 0.579614, 0.580668, 0.581784, 0.582941,
-    0.584117, 0.585288, 0.58643, 0.587523, 0.588545, 0.58948,
-    0.590315, 0.591038, 0.591646, 0.592136, 0.592512, 0.592784,
-    0.592962, 0.593062, 0.593104, 0.593107, 0.593095, 0.593089,
-    0.593113, 0.593187, 0.59333, 0.593559, 0.593886, 0.59432,
-    0.594865, 0.595522, 0.596285, 0.597148, 0.598097, 0.599116,
-    0.600186, 0.601288, 0.602399, 0.603498, 0.604562, 0.605571,
-    0.606508, 0.607358, 0.608108, 0.60875, 0.609282, 0.609704,
-    0.610021, 0.610242, 0.61038, 0.61045, 0.610472, 0.610465,
-    0.610451, 0.610452, 0.610488, 0.610579, 0.610741, 0.610989,
-    0.611334, 0.611783, 0.612338, 0.612997, 0.613756, 0.614604,
-    0.615529, 0.616515, 0.617543, 0.618593, 0.619644, 0.620675,
-    0.621666, 0.6226, 0.623458, 0.624229, 0.624903, 0.625473,
-    0.625937, 0.626298, 0.626563, 0.62674, 0.626843, 0.626889,
-    0.626895, 0.626882, 0.62687, 0.626879, 0.626929, 0.627036,
-    0.627218, 0.627485, 0.627848, 0.62831, 0.628874, 0.629535,
-    0.630289, 0.631123, 0.632025, 0.632979, 0.633966, 0.634966,
-    0.635961, 0.636929, 0.637853, 0.638716, 0.639502, 0.640201,
-    0.640805, 0.641309, 0.641713, 0.64202, 0.642238, 0.642377,
-    0.642452, 0.642477, 0.642473, 0.642456, 0.642448, 0.642467,
-    0.642531, 0.642657, 0.642857, 0.643143, 0.643522, 0.643998,
-    0.644569, 0.645232, 0.645979, 0.6468, 0.647679, 0.648602,
-    0.649549, 0.650503, 0.651444, 0.652354, 0.653214, 0.654011,
-    0.654731, 0.655364, 0.655904, 0.656348, 0.656697, 0.656956,
-    0.657134, 0.65724, 0.65729, 0.6573, 0.657287, 0.65727,
-    0.657268, 0.657299, 0.657378, 0.657522, 0.657741, 0.658045,
-    0.65844, 0.658927, 0.659505, 0.660169, 0.66091, 0.661716,
-    0.662573, 0.663465, 0.664375, 0.665284, 0.666174, 0.667028,
-    0.667829, 0.668564, 0.669222, 0.669794, 0.670275, 0.670665,
-    0.670965, 0.671181, 0.671323, 0.671401, 0.671431, 0.671429,
-    0.671411, 0.671396, 0.671402, 0.671445, 0.671541, 0.671702,
-    0.67194, 0.672261, 0.672671, 0.673169, 0.673753, 0.674417,
-    0.67515, 0.675942, 0.676777, 0.67764, 0.678513, 0.679378,
-    0.68022, 0.68102, 0.681766, 0.682443, 0.683043, 0.683559,
-    0.683986, 0.684326, 0.684582, 0.68476, 0.68487, 0.684924,
-    0.684938, 0.684926, 0.684906, 0.684895, 0.68491, 0.684967,
-    0.685079, 0.685259, 0.685515, 0.685853, 0.686277, 0.686785,
-    0.687374, 0.688036, 0.688762, 0.689538, 0.690351, 0.691185,
-    0.692022, 0.692846, 0.693641, 0.694391, 0.695083, 0.695706,
-    0.696252, 0.696715, 0.697094, 0.697388, 0.697604, 0.697748,
-    0.69783, 0.697865, 0.697865, 0.697847, 0.697827, 0.697822,
-    0.697848, 0.697919, 0.698048, 0.698245, 0.698519, 0.698873,
-    0.69931, 0.699827, 0.70042, 0.70108, 0.701797, 0.702558,
-    0.703349, 0.704154, 0.704956, 0.70574, 0.70649, 0.707192,
-    0.707834, 0.708406, 0.708901, 0.709315, 0.709648, 0.709901,
-    0.710081, 0.710194, 0.710253, 0.710271, 0.71026, 0.710239,
-    0.710221, 0.710224, 0.710262, 0.710348, 0.710494, 0.710709,
-    0.711, 0.711369, 0.711818, 0.712343, 0.712938, 0.713595,
-    0.714303, 0.715049, 0.715817, 0.716593, 0.717361, 0.718106,
-    0.718812, 0.719468, 0.720062, 0.720586, 0.721034, 0.721403,
-    0.721694, 0.721909, 0.722056, 0.722143, 0.722182, 0.722185,
-    0.722167, 0.722144, 0.722131, 0.722142, 0.722193, 0.722294,
-    0.722458, 0.72269, 0.722997, 0.723381, 0.723841, 0.724373,
-    0.72497, 0.725624, 0.726321, 0.72705, 0.727796, 0.728544,
-    0.729278, 0.729985, 0.73065, 0.731261, 0.73181, 0.732288,
-    0.732691, 0.733018, 0.73327, 0.733451, 0.733569, 0.733632,
-    0.733653, 0.733645, 0.733623, 0.7336, 0.733593, 0.733614,
-    0.733678, 0.733796, 0.733976, 0.734226, 0.734549, 0.734947,
-    0.735417, 0.735954, 0.736552, 0.737201, 0.737887, 0.7386,
-    0.739323, 0.740042, 0.740743, 0.741413, 0.742037, 0.742606,
-    0.743111, 0.743546, 0.743908, 0.744195, 0.744412, 0.744562,
-    0.744653, 0.744696, 0.744703, 0.744686, 0.74466, 0.74464,
-    0.74464, 0.744673, 0.744751, 0.744885, 0.745083, 0.745349,
-    0.745687, 0.746098, 0.746577, 0.747119, 0.747716, 0.748359,
-    0.749034, 0.749729, 0.750429, 0.75112, 0.751789, 0.752422,
-    0.753007, 0.753535, 0.753999, 0.754393, 0.754716, 0.754967,
-    0.75515, 0.755272, 0.75534, 0.755365, 0.75536, 0.755337,
-    0.75531, 0.755295, 0.755303, 0.755348, 0.755441, 0.755591,
-    0.755805, 0.756088, 0.756441, 0.756863, 0.75735, 0.757896,
-    0.758492, 0.759128, 0.75979, 0.760467, 0.761144, 0.761807,
-    0.762444, 0.763041, 0.763589, 0.764078, 0.764502, 0.764857,
-    0.765143, 0.76536, 0.765513, 0.765609, 0.765657, 0.765667,
-    0.765652, 0.765625, 0.765599, 0.765589, 0.765607, 0.765666,
-    0.765774, 0.76594, 0.766171, 0.76647, 0.766836, 0.767269,
-    0.767763, 0.768311, 0.768905, 0.769533, 0.770182, 0.770841,
-    0.771494, 0.772129, 0.772734, 0.773297, 0.773807, 0.774258,
-    0.774645, 0.774964, 0.775215, 0.775401, 0.775526, 0.775599,
-    0.775629, 0.775626, 0.775604, 0.775575, 0.775552, 0.775549,
-    0.775578, 0.775649, 0.775773, 0.775956, 0.776203, 0.776517,
-    0.776896, 0.777338, 0.777838, 0.778388, 0.778978, 0.779597,
-    0.780233, 0.780872, 0.781502, 0.78211, 0.782683, 0.783212,
-    0.783687, 0.784102, 0.784452, 0.784736, 0.784955, 0.785112,
-    0.785212, 0.785265, 0.785278, 0.785265, 0.785238, 0.785208,
-    0.78519, 0.785195, 0.785236, 0.785321, 0.785461, 0.78566,
-    0.785923, 0.786251, 0.786642, 0.787093, 0.787598, 0.788148,
-    0.788734, 0.789343, 0.789964, 0.790584, 0.79119, 0.79177,
-    0.792312, 0.792807, 0.793248, 0.793628, 0.793944, 0.794195,
-    0.794384, 0.794514, 0.794592, 0.794626, 0.794626, 0.794605,
-    0.794573, 0.794545, 0.794533, 0.794547, 0.7946, 0.794701,
-    0.794856, 0.795072, 0.79535, 0.795691, 0.796094, 0.796552,
-    0.797061, 0.79761, 0.79819, 0.798789, 0.799395, 0.799995,
-    0.800577, 0.801129, 0.80164, 0.802103, 0.80251, 0.802857,
-    0.80314, 0.803361, 0.803521, 0.803626, 0.803683, 0.803701,
-    0.80369, 0.803663, 0.80363, 0.803604, 0.803599, 0.803624,
-    0.80369, 0.803806, 0.803977, 0.804208, 0.804501, 0.804855,
-    0.805268, 0.805733, 0.806245, 0.806792, 0.807366, 0.807953,
-    0.808543, 0.809122, 0.80968, 0.810204, 0.810686, 0.811117,
-    0.811491, 0.811805, 0.812058, 0.812249, 0.812384, 0.812466,
-    0.812505, 0.812509, 0.812488, 0.812456, 0.812423, 0.812402,
-    0.812405, 0.812441, 0.812521, 0.812652, 0.812839, 0.813085,
-    0.813393, 0.813759, 0.814181, 0.814652, 0.815165, 0.815709,
-    0.816275, 0.816851, 0.817423, 0.817982, 0.818515, 0.819012,
-    0.819464, 0.819864, 0.820207, 0.82049, 0.820713, 0.820877,
-    0.820987, 0.821049, 0.821071, 0.821063, 0.821036, 0.821,
-    0.820969, 0.820954, 0.820966, 0.821014, 0.821108, 0.821254,
-    0.821457, 0.821719, 0.822039, 0.822417, 0.822847, 0.823323,
-    0.823836, 0.824377, 0.824934, 0.825496, 0.826052, 0.826589,
-    0.827097, 0.827567, 0.82799, 0.82836, 0.828673, 0.828926,
-    0.829121, 0.82926, 0.829347, 0.82939, 0.829398, 0.829379,
-    0.829346, 0.82931, 0.829282, 0.829274, 0.829295, 0.829357,
-    0.829465, 0.829626, 0.829845, 0.830121, 0.830455, 0.830843,
-    0.83128, 0.831759, 0.832272, 0.832807, 0.833355, 0.833904,
-    0.834441, 0.834957, 0.83544, 0.835883, 0.836277, 0.836618,
-    0.836901, 0.837126, 0.837295, 0.837409, 0.837476, 0.837503,
-    0.837497, 0.837471, 0.837434, 0.837398, 0.837374, 0.837374,
-    0.837407, 0.837481, 0.837604, 0.837781, 0.838014, 0.838305,
-    0.838651, 0.839048, 0.839492, 0.839973, 0.840484, 0.841014,
-    0.841551, 0.842085, 0.842604, 0.843098, 0.843557, 0.843972,
-    0.844338, 0.84465, 0.844905, 0.845103, 0.845247, 0.845339,
-    0.845387, 0.845398, 0.845382, 0.845349, 0.84531, 0.845276,
-    0.845258, 0.845267, 0.845311, 0.845399, 0.845537, 0.845729,
-    0.845977, 0.846281, 0.846639, 0.847045, 0.847493, 0.847976,
-    0.848484, 0.849007, 0.849533, 0.850052, 0.850552, 0.851023,
-    0.851457, 0.851846, 0.852185, 0.852468, 0.852696, 0.852869,
-    0.852989, 0.85306, 0.853091, 0.853089, 0.853064, 0.853026,
-    0.852986, 0.852955, 0.852944, 0.852963, 0.853019, 0.853122,
-    0.853275, 0.853482, 0.853745, 0.854061, 0.854429, 0.854843,
-    0.855296, 0.855779, 0.856283, 0.856798, 0.857311, 0.857814,
-    0.858294, 0.858744, 0.859153, 0.859516, 0.859827, 0.860084,
-    0.860285, 0.860433, 0.860531, 0.860584, 0.860599, 0.860586,
-    0.860553, 0.860511, 0.860472, 0.860446, 0.860443, 0.860472,
-    0.860542, 0.860659, 0.860827, 0.861049, 0.861325, 0.861654,
-    0.862032, 0.862452, 0.862908, 0.86339, 0.86389, 0.864395,
-    0.864896, 0.865382, 0.865842, 0.866269, 0.866653, 0.86699,
-    0.867275, 0.867506, 0.867682, 0.867807, 0.867884, 0.86792,
-    0.867921, 0.867897, 0.867859, 0.867815, 0.867778, 0.867758,
-    0.867763, 0.867804, 0.867888, 0.868019, 0.868202, 0.868439,
-    0.868729, 0.869069, 0.869455, 0.869881, 0.870339, 0.87082,
-    0.871313, 0.871809, 0.872296, 0.872764, 0.873204, 0.873608,
-    0.873968, 0.874279, 0.874538, 0.874744, 0.874896, 0.874999,
-    0.875057, 0.875077, 0.875066, 0.875034, 0.874991, 0.874947,
-    0.874913, 0.8749, 0.874915, 0.874968, 0.875065, 0.875211,
-    0.875409, 0.87566, 0.875963, 0.876314, 0.876708, 0.877138,
-    0.877597, 0.878075, 0.878561, 0.879046, 0.879519, 0.879969,
-    0.880389, 0.88077, 0.881105, 0.881391, 0.881625, 0.881806,
-    0.881936, 0.882018, 0.882059, 0.882064, 0.882042, 0.882003,
-    0.881957, 0.881914, 0.881885, 0.88188, 0.881906, 0.881972,
-    0.882083, 0.882244, 0.882456, 0.882721, 0.883036, 0.883396,
-    0.883797, 0.884232, 0.88469, 0.885164, 0.885643, 0.886116,
-    0.886573, 0.887005, 0.887404, 0.887762, 0.888073, 0.888334,
-    0.888544, 0.888701, 0.888809, 0.888873, 0.888896, 0.888888,
-    0.888858, 0.888813, 0.888766, 0.888726, 0.888702, 0.888705,
-    0.888743, 0.888822, 0.888948, 0.889123, 0.88935, 0.889628,
-    0.889954, 0.890324, 0.890731, 0.891168, 0.891625, 0.892094,
-    0.892564, 0.893024, 0.893466, 0.893879, 0.894256, 0.894591,
-    0.894879, 0.895116, 0.895301, 0.895437, 0.895524, 0.895569,
-    0.895578, 0.895559, 0.89552, 0.895472, 0.895425, 0.895388,
-    0.895372, 0.895384, 0.895434, 0.895527, 0.895667, 0.895857,
-    0.896098, 0.896389, 0.896726, 0.897103, 0.897515, 0.897954,
-    0.898409, 0.898872, 0.899331, 0.899779, 0.900203, 0.900598,
-    0.900954, 0.901266, 0.901529, 0.901743, 0.901905, 0.902019,
-    0.902087, 0.902116, 0.902111, 0.902082, 0.902037, 0.901986,
-    0.90194, 0.901908, 0.9019, 0.901923, 0.901985, 0.902092,
-    0.902246, 0.902451, 0.902706, 0.903009, 0.903356, 0.90374,
-    0.904156, 0.904595, 0.905047, 0.905503, 0.905952, 0.906385,
-    0.906793, 0.907167, 0.907502, 0.907791, 0.908031, 0.908221,
-    0.908362, 0.908455, 0.908505, 0.908518, 0.908501, 0.908464,
-    0.908414, 0.908362, 0.908319, 0.908293, 0.908293, 0.908328,
-    0.908403, 0.908523, 0.908693, 0.908912, 0.90918, 0.909494,
-    0.90985, 0.910241, 0.91066, 0.911098, 0.911546, 0.911994,
-    0.912431, 0.912849, 0.913239, 0.913594, 0.913907, 0.914173,
-    0.914391, 0.914558, 0.914678, 0.914751, 0.914784, 0.914783,
-    0.914756, 0.914711, 0.914658, 0.914606, 0.914567, 0.914547,
-    0.914557, 0.914604, 0.914693, 0.914828, 0.915012, 0.915245,
-    0.915525, 0.91585, 0.916214, 0.916611, 0.917032, 0.917468,
-    0.917911, 0.918349, 0.918774, 0.919177, 0.919549, 0.919883,
-    0.920174, 0.920418, 0.920613, 0.920759, 0.920858, 0.920913,
-    0.920931, 0.920917, 0.92088, 0.920829, 0.920774, 0.920724,
-    0.920689, 0.920678, 0.920699, 0.920757, 0.92086, 0.92101,
-    0.921208, 0.921455, 0.921748, 0.922083, 0.922454, 0.922855,
-    0.923277, 0.92371, 0.924146, 0.924575, 0.924987, 0.925374,
-    0.925727, 0.926041, 0.92631, 0.926532, 0.926705, 0.92683,
-    0.926909, 0.926947, 0.92695, 0.926924, 0.926879, 0.926824,
-    0.926768, 0.926721, 0.926692, 0.92669, 0.926722, 0.926793,
-    0.92691, 0.927074, 0.927287, 0.927547, 0.927851, 0.928195,
-    0.928573, 0.928977, 0.929399, 0.929829, 0.930258, 0.930676,
-    0.931074, 0.931443, 0.931778, 0.932071, 0.932319, 0.932519,
-    0.93267, 0.932775, 0.932835, 0.932857, 0.932846, 0.932811,
-    0.932759, 0.932701, 0.932646, 0.932603, 0.932581, 0.932588,
-    0.932631, 0.932717, 0.932848, 0.933026, 0.933253, 0.933526,
-    0.933841, 0.934194, 0.934577, 0.934983, 0.935404, 0.935829,
-    0.936249, 0.936656, 0.937039, 0.937392, 0.937707, 0.937979,
-    0.938205, 0.938384, 0.938514, 0.938599, 0.938642, 0.938649,
-    0.938626, 0.938582, 0.938525, 0.938465, 0.938411, 0.938373,
-    0.938359, 0.938377, 0.938433, 0.938532, 0.938677, 0.93887,
-    0.93911, 0.939395, 0.939721, 0.940081, 0.940469, 0.940877,
-    0.941295, 0.941714, 0.942125, 0.942519, 0.942887, 0.943222,
-    0.943517, 0.943769, 0.943974, 0.944131, 0.944241, 0.944307,
-    0.944334, 0.944326, 0.944293, 0.944241, 0.94418, 0.94412,
-    0.944069, 0.944037, 0.944032, 0.944061, 0.94413, 0.944243,
-    0.944403, 0.94461, 0.944864, 0.94516, 0.945495, 0.945862,
-    0.946254, 0.946662, 0.947076, 0.947489, 0.94789, 0.94827,
-    0.948622, 0.948939, 0.949215, 0.949445, 0.949629, 0.949765,
-    0.949856, 0.949904, 0.949915, 0.949895, 0.949852, 0.949793,
-    0.94973, 0.94967, 0.949624, 0.949599, 0.949604, 0.949645,
-    0.949727, 0.949855, 0.950029, 0.95025, 0.950516, 0.950824,
-    0.951167, 0.95154, 0.951935, 0.952342, 0.952752, 0.953157,
-    0.953547, 0.953913, 0.954248, 0.954546, 0.954802, 0.955012,
-    0.955175, 0.955291, 0.955362, 0.955394, 0.95539, 0.955358,
-    0.955306, 0.955243, 0.955178, 0.955121, 0.955079, 0.955063,
-    0.955078, 0.955132, 0.955228, 0.95537, 0.955559, 0.955794,
-    0.956072, 0.95639, 0.956742, 0.957119, 0.957515, 0.95792,
-    0.958325, 0.958721, 0.959099, 0.959451, 0.959769, 0.960048,
-    0.960283, 0.960472, 0.960615, 0.960711, 0.960765, 0.96078,
-    0.960762, 0.96072, 0.960661, 0.960594, 0.960529, 0.960475,
-    0.96044, 0.960432, 0.960459, 0.960526, 0.960636, 0.960793,
-    0.960996, 0.961245, 0.961535, 0.961862, 0.962221, 0.962602,
-    0.962998, 0.963401, 0.963799, 0.964186, 0.964551, 0.964887,
-    0.965187, 0.965447, 0.965662, 0.96583, 0.965952, 0.96603,
-    0.966066, 0.966066, 0.966036, 0.965985, 0.96592, 0.965851,
-    0.965786, 0.965736, 0.965709, 0.965711, 0.96575, 0.96583,
-    0.965956, 0.966127, 0.966344, 0.966606, 0.966907, 0.967244,
-    0.967608, 0.967992, 0.968388, 0.968786, 0.969178, 0.969553,
-    0.969904, 0.970224, 0.970506, 0.970746, 0.970941, 0.971089,
-    0.971191, 0.97125, 0.97127, 0.971255, 0.971214, 0.971155,
-    0.971085, 0.971015, 0.970953, 0.970909, 0.97089, 0.970903,
-    0.970955, 0.971049, 0.971189, 0.971375, 0.971607, 0.971881,
-    0.972193, 0.972537, 0.972907, 0.973293, 0.973687, 0.97408,
-    0.974463, 0.974827, 0.975164, 0.975467, 0.97573, 0.97595,
-    0.976124, 0.976252, 0.976335, 0.976376, 0.976379, 0.976352,
-    0.976301, 0.976234, 0.976162, 0.976091, 0.976033, 0.975995,
-    0.975986, 0.976011, 0.976076, 0.976185, 0.97634, 0.976541,
-    0.976787, 0.977073, 0.977395, 0.977747, 0.97812, 0.978507,
-    0.978899, 0.979286, 0.979659, 0.98001, 0.980331, 0.980616,
-    0.980861, 0.98106, 0.981214, 0.981321, 0.981385, 0.981409,
-    0.981397, 0.981358, 0.981298, 0.981226, 0.981151, 0.981082,
-    0.981029, 0.980999, 0.981, 0.981038, 0.981118, 0.981242,
-    0.981413, 0.981629, 0.981888, 0.982186, 0.982517, 0.982875,
-    0.983252, 0.983639, 0.984026, 0.984406, 0.984768, 0.985105,
-    0.98541, 0.985677, 0.985901, 0.986079, 0.986212, 0.986299,
-    0.986344, 0.986351, 0.986325, 0.986275, 0.986207, 0.98613,
-    0.986055, 0.98599, 0.985943, 0.985922, 0.985936, 0.985988,
-    0.986083, 0.986224, 0.98641, 0.986641, 0.986914, 0.987224,
-    0.987564, 0.987928, 0.988307, 0.988692, 0.989074, 0.989445,
-    0.989794, 0.990116, 0.990402, 0.990649, 0.990851, 0.991008,
-    0.991119, 0.991186, 0.991211, 0.991201, 0.991162, 0.991101,
-    0.991026, 0.990948, 0.990874, 0.990814, 0.990776, 0.990767,
-    0.990795, 0.990864, 0.990978, 0.991137, 0.991341, 0.991589,
-    0.991877, 0.992199, 0.992548, 0.992917, 0.993297, 0.993678,
-    0.994052, 0.99441, 0.994743, 0.995045, 0.995309, 0.99553,
-    0.995707, 0.995837, 0.995922, 0.995964, 0.995968, 0.99594,
-    0.995887, 0.995817, 0.995738, 0.995661, 0.995595, 0.995548,
-    0.995528, 0.995543, 0.995598, 0.995696, 0.995841, 0.996031,
-    0.996266, 0.996541, 0.996851, 0.997189, 0.997546, 0.997914,
-    0.99828, 0.998636, 0.99897, 0.999273, 0.999535, 0.999747,
-    0.999904, 1
-};
-
-static const float WAVE_LOGARITHMIC_066[DEFAULT_WAVELEN] = {
-    -1, -0.999169, -0.996681, -0.992548, -0.98679, -0.979435,
-    -0.970519, -0.960085, -0.948183, -0.934872, -0.920214, -0.904279,
-    -0.887143, -0.868887, -0.849596, -0.829358, -0.808268, -0.786421,
-    -0.763915, -0.74085, -0.717327, -0.693447, -0.669311, -0.645021,
-    -0.620676, -0.596372, -0.572205, -0.548266, -0.524643, -0.501421,
-    -0.478679, -0.456492, -0.434928, -0.414053, -0.393923, -0.374591,
-    -0.3561, -0.338491, -0.321795, -0.306037, -0.291236, -0.277403,
-    -0.264544, -0.252658, -0.241736, -0.231766, -0.222728, -0.214597,
-    -0.207341, -0.200927, -0.195314, -0.190459, -0.186314, -0.182829,
-    -0.179949, -0.17762, -0.175785, -0.174383, -0.173357, -0.172646,
-    -0.17219, -0.171931, -0.17181, -0.171771, -0.171759, -0.171723,
-    -0.171612, -0.171379, -0.170982, -0.17038, -0.169537, -0.168421,
-    -0.167003, -0.165261, -0.163174, -0.160726, -0.157908, -0.154712,
-    -0.151136, -0.147183, -0.142857, -0.138168, -0.133131, -0.127761,
-    -0.122078, -0.116107, -0.109871, -0.1034, -0.0967228, -0.0898713,
-    -0.0828784, -0.0757783, -0.0686054, -0.061395, -0.054182, -0.047001,
-    -0.039886, -0.0328701, -0.025985, -0.0192611, -0.0127266, -0.00640814,
-    -0.000329773, 0.00548673, 0.0110222, 0.0162603, 0.0211873, 0.0257926,
-    0.0300684, 0.0340102, 0.037616, 0.0408872, 0.0438279, 0.0464449,
-    0.0487479, 0.0507491, 0.0524632, 0.0539068, 0.0550991, 0.0560606,
-    0.0568137, 0.0573823, 0.0577911, 0.0580661, 0.0582335, 0.0583203,
-    0.0583533, 0.0583594, 0.0583651, 0.0583962, 0.0584776, 0.0586333,
-    0.058886, 0.0592568, 0.0597653, 0.0604293, 0.0612646, 0.0622849,
-    0.0635018, 0.0649248, 0.0665608, 0.0684147, 0.0704889, 0.0727835,
-    0.0752963, 0.078023, 0.080957, 0.0840896, 0.0874104, 0.0909069,
-    0.0945651, 0.0983693, 0.102303, 0.106347, 0.110484, 0.114692,
-    0.118953, 0.123244, 0.127545, 0.131835, 0.136094, 0.1403,
-    0.144435, 0.148479, 0.152415, 0.156226, 0.159896, 0.163412,
-    0.16676, 0.169931, 0.172915, 0.175704, 0.178294, 0.18068,
-    0.182861, 0.184837, 0.186611, 0.188185, 0.189566, 0.190761,
-    0.191779, 0.19263, 0.193327, 0.193882, 0.19431, 0.194626,
-    0.194846, 0.194987, 0.195066, 0.1951, 0.195107, 0.195106,
-    0.195112, 0.195144, 0.195218, 0.19535, 0.195556, 0.195848,
-    0.196241, 0.196747, 0.197375, 0.198136, 0.199037, 0.200084,
-    0.201283, 0.202635, 0.204144, 0.205808, 0.207626, 0.209595,
-    0.21171, 0.213965, 0.216353, 0.218864, 0.221488, 0.224215,
-    0.227033, 0.229928, 0.232887, 0.235896, 0.23894, 0.242004,
-    0.245074, 0.248134, 0.251169, 0.254165, 0.257109, 0.259985,
-    0.262783, 0.265488, 0.268092, 0.270582, 0.272952, 0.275192,
-    0.277296, 0.27926, 0.281079, 0.282751, 0.284274, 0.28565,
-    0.28688, 0.287967, 0.288915, 0.28973, 0.290418, 0.290989,
-    0.291449, 0.291811, 0.292083, 0.292279, 0.292408, 0.292485,
-    0.292523, 0.292533, 0.29253, 0.292526, 0.292535, 0.29257,
-    0.292642, 0.292764, 0.292948, 0.293202, 0.293538, 0.293964,
-    0.294488, 0.295116, 0.295854, 0.296708, 0.297679, 0.29877,
-    0.299981, 0.301314, 0.302765, 0.304332, 0.306011, 0.307797,
-    0.309684, 0.311665, 0.313732, 0.315876, 0.318087, 0.320356,
-    0.322671, 0.325022, 0.327397, 0.329785, 0.332173, 0.33455,
-    0.336905, 0.339227, 0.341503, 0.343725, 0.345882, 0.347964,
-    0.349965, 0.351874, 0.353687, 0.355397, 0.356999, 0.35849,
-    0.359867, 0.361128, 0.362273, 0.363303, 0.364218, 0.365022,
-    0.365719, 0.366313, 0.36681, 0.367217, 0.36754, 0.367789,
-    0.367971, 0.368096, 0.368174, 0.368215, 0.368229, 0.368227,
-    0.368219, 0.368216, 0.368228, 0.368266, 0.368339, 0.368457,
-    0.368628, 0.368862, 0.369164, 0.369543, 0.370004, 0.370553,
-    0.371193, 0.371928, 0.37276, 0.37369, 0.37472, 0.375847,
-    0.377071, 0.378389, 0.379798, 0.381292, 0.382867, 0.384516,
-    0.386233, 0.388011, 0.389841, 0.391715, 0.393624, 0.395558,
-    0.397509, 0.399467, 0.401422, 0.403365, 0.405286, 0.407176,
-    0.409026, 0.410827, 0.412573, 0.414255, 0.415866, 0.417401,
-    0.418854, 0.420222, 0.421499, 0.422683, 0.423773, 0.424767,
-    0.425666, 0.426469, 0.42718, 0.4278, 0.428333, 0.428782,
-    0.429154, 0.429454, 0.429688, 0.429863, 0.429987, 0.430067,
-    0.430111, 0.430129, 0.430129, 0.43012, 0.430111, 0.430109,
-    0.430125, 0.430167, 0.430242, 0.430358, 0.430523, 0.430743,
-    0.431025, 0.431373, 0.431793, 0.432289, 0.432863, 0.433519,
-    0.434258, 0.43508, 0.435987, 0.436975, 0.438045, 0.439194,
-    0.440417, 0.441712, 0.443073, 0.444495, 0.445972, 0.447498,
-    0.449066, 0.450668, 0.452296, 0.453943, 0.455601, 0.457261,
-    0.458916, 0.460556, 0.462175, 0.463765, 0.465318, 0.466827,
-    0.468285, 0.469687, 0.471027, 0.4723, 0.473501, 0.474628,
-    0.475677, 0.476646, 0.477534, 0.478341, 0.479066, 0.479711,
-    0.480277, 0.480768, 0.481185, 0.481533, 0.481818, 0.482042,
-    0.482214, 0.482337, 0.48242, 0.482469, 0.482491, 0.482494,
-    0.482485, 0.482472, 0.482463, 0.482464, 0.482484, 0.482529,
-    0.482607, 0.482723, 0.482885, 0.483097, 0.483364, 0.483692,
-    0.484083, 0.484541, 0.48507, 0.485669, 0.486341, 0.487086,
-    0.487903, 0.488792, 0.48975, 0.490775, 0.491865, 0.493014,
-    0.49422, 0.495476, 0.496778, 0.49812, 0.499496, 0.500898,
-    0.502321, 0.503757, 0.5052, 0.506641, 0.508075, 0.509493,
-    0.51089, 0.512258, 0.513591, 0.514884, 0.51613, 0.517325,
-    0.518464, 0.519542, 0.520557, 0.521506, 0.522386, 0.523195,
-    0.523934, 0.524601, 0.525198, 0.525725, 0.526184, 0.526578,
-    0.52691, 0.527184, 0.527403, 0.527572, 0.527697, 0.527784,
-    0.527837, 0.527863, 0.52787, 0.527862, 0.527848, 0.527833,
-    0.527825, 0.527829, 0.527853, 0.527902, 0.527983, 0.5281,
-    0.52826, 0.528467, 0.528725, 0.529037, 0.529408, 0.529839,
-    0.530332, 0.53089, 0.531512, 0.532198, 0.532948, 0.533761,
-    0.534635, 0.535568, 0.536555, 0.537594, 0.538682, 0.539812,
-    0.54098, 0.542182, 0.54341, 0.54466, 0.545925, 0.5472,
-    0.548477, 0.54975, 0.551014, 0.552262, 0.553487, 0.554685,
-    0.55585, 0.556976, 0.558058, 0.559094, 0.560077, 0.561006,
-    0.561877, 0.562688, 0.563437, 0.564123, 0.564746, 0.565306,
-    0.565803, 0.566239, 0.566616, 0.566936, 0.567202, 0.567418,
-    0.567587, 0.567714, 0.567804, 0.567862, 0.567893, 0.567903,
-    0.567898, 0.567883, 0.567865, 0.56785, 0.567843, 0.567851,
-    0.567879, 0.567932, 0.568016, 0.568136, 0.568295, 0.568499,
-    0.56875, 0.569052, 0.569407, 0.569817, 0.570284, 0.570809,
-    0.571392, 0.572034, 0.572732, 0.573486, 0.574293, 0.575152,
-    0.57606, 0.577013, 0.578006, 0.579037, 0.5801, 0.58119,
-    0.582303, 0.583432, 0.584572, 0.585719, 0.586865, 0.588005,
-    0.589134, 0.590246, 0.591335, 0.592397, 0.593428, 0.594421,
-    0.595374, 0.596282, 0.597142, 0.597951, 0.598707, 0.599408,
-    0.600054, 0.600642, 0.601173, 0.601647, 0.602065, 0.602428,
-    0.602739, 0.603, 0.603214, 0.603384, 0.603514, 0.603608,
-    0.60367, 0.603706, 0.60372, 0.603717, 0.603704, 0.603684,
-    0.603664, 0.603649, 0.603645, 0.603656, 0.603688, 0.603746,
-    0.603834, 0.603955, 0.604115, 0.604317, 0.604564, 0.604858,
-    0.605201, 0.605595, 0.606042, 0.606541, 0.607094, 0.607699,
-    0.608355, 0.609062, 0.609816, 0.610617, 0.611459, 0.612342,
-    0.61326, 0.61421, 0.615187, 0.616188, 0.617206, 0.618237,
-    0.619276, 0.620318, 0.621357, 0.622389, 0.623408, 0.624409,
-    0.625387, 0.626339, 0.62726, 0.628145, 0.628991, 0.629795,
-    0.630554, 0.631266, 0.631928, 0.63254, 0.6331, 0.633608,
-    0.634064, 0.634468, 0.634821, 0.635126, 0.635383, 0.635596,
-    0.635768, 0.635901, 0.635999, 0.636066, 0.636106, 0.636124,
-    0.636125, 0.636113, 0.636093, 0.63607, 0.636049, 0.636036,
-    0.636034, 0.636049, 0.636085, 0.636147, 0.636239, 0.636363,
-    0.636525, 0.636726, 0.636969, 0.637257, 0.637591, 0.637973,
-    0.638403, 0.638882, 0.63941, 0.639986, 0.640608, 0.641276,
-    0.641986, 0.642738, 0.643528, 0.644352, 0.645208, 0.646091,
-    0.646998, 0.647923, 0.648863, 0.649813, 0.650767, 0.651722,
-    0.652673, 0.653614, 0.654542, 0.655451, 0.656337, 0.657196,
-    0.658025, 0.65882, 0.659578, 0.660295, 0.66097, 0.6616,
-    0.662185, 0.662722, 0.663211, 0.663651, 0.664044, 0.66439,
-    0.66469, 0.664946, 0.665159, 0.665332, 0.665468, 0.665571,
-    0.665642, 0.665688, 0.66571, 0.665714, 0.665704, 0.665685,
-    0.66566, 0.665635, 0.665615, 0.665603, 0.665604, 0.665623,
-    0.665664, 0.66573, 0.665825, 0.665953, 0.666116, 0.666317,
-    0.666559, 0.666843, 0.66717, 0.667542, 0.667959, 0.668421,
-    0.668928, 0.669479, 0.670073, 0.670709, 0.671383, 0.672094,
-    0.672839, 0.673615, 0.674418, 0.675245, 0.676092, 0.676954,
-    0.677828, 0.678709, 0.679592, 0.680474, 0.681349, 0.682214,
-    0.683063, 0.683894, 0.684702, 0.685484, 0.686235, 0.686953,
-    0.687635, 0.688279, 0.688883, 0.689444, 0.689962, 0.690435,
-    0.690864, 0.691248, 0.691588, 0.691885, 0.692139, 0.692353,
-    0.692529, 0.692668, 0.692775, 0.692852, 0.692902, 0.692929,
-    0.692937, 0.692929, 0.692911, 0.692886, 0.692858, 0.692832,
-    0.692812, 0.692802, 0.692807, 0.69283, 0.692875, 0.692946,
-    0.693045, 0.693176, 0.693341, 0.693543, 0.693784, 0.694065,
-    0.694387, 0.69475, 0.695157, 0.695605, 0.696095, 0.696626,
-    0.697196, 0.697804, 0.698448, 0.699124, 0.699831, 0.700565,
-    0.701324, 0.702103, 0.702898, 0.703706, 0.704523, 0.705345,
-    0.706167, 0.706985, 0.707796, 0.708595, 0.709378, 0.710141,
-    0.710882, 0.711596, 0.71228, 0.712933, 0.71355, 0.71413,
-    0.714672, 0.715174, 0.715635, 0.716054, 0.716431, 0.716766,
-    0.71706, 0.717314, 0.71753, 0.717708, 0.717852, 0.717963,
-    0.718045, 0.7181, 0.718131, 0.718143, 0.718138, 0.718122,
-    0.718097, 0.718067, 0.718037, 0.718011, 0.717992, 0.717985,
-    0.717993, 0.71802, 0.71807, 0.718145, 0.718248, 0.718383,
-    0.718551, 0.718754, 0.718994, 0.719273, 0.719591, 0.719949,
-    0.720346, 0.720783, 0.721259, 0.721772, 0.722322, 0.722906,
-    0.723523, 0.72417, 0.724844, 0.725543, 0.726262, 0.726999,
-    0.72775, 0.728512, 0.729279, 0.73005, 0.730818, 0.731582,
-    0.732336, 0.733078, 0.733803, 0.734507, 0.735189, 0.735844,
-    0.73647, 0.737065, 0.737626, 0.738151, 0.738639, 0.739089,
-    0.7395, 0.739871, 0.740203, 0.740496, 0.74075, 0.740968,
-    0.741149, 0.741297, 0.741413, 0.741499, 0.741559, 0.741595,
-    0.741611, 0.74161, 0.741596, 0.741571, 0.741541, 0.741508,
-    0.741476, 0.74145, 0.741433, 0.741429, 0.741441, 0.741472,
-    0.741526, 0.741606, 0.741714, 0.741852, 0.742023, 0.742228,
-    0.742469, 0.742746, 0.743061, 0.743413, 0.743804, 0.744231,
-    0.744694, 0.745193, 0.745726, 0.74629, 0.746884, 0.747505,
-    0.74815, 0.748817, 0.749503, 0.750203, 0.750915, 0.751635,
-    0.75236, 0.753085, 0.753807, 0.754522, 0.755226, 0.755917,
-    0.756591, 0.757244, 0.757873, 0.758477, 0.759052, 0.759595,
-    0.760106, 0.760583, 0.761023, 0.761427, 0.761794, 0.762124,
-    0.762416, 0.762671, 0.762891, 0.763076, 0.763228, 0.763348,
-    0.76344, 0.763505, 0.763546, 0.763566, 0.763569, 0.763557,
-    0.763533, 0.763502, 0.763468, 0.763432, 0.7634, 0.763375,
-    0.76336, 0.763359, 0.763375, 0.763411, 0.763469, 0.763554,
-    0.763666, 0.763808, 0.763982, 0.764189, 0.764431, 0.764707,
-    0.76502, 0.765369, 0.765753, 0.766172, 0.766625, 0.767111,
-    0.767628, 0.768175, 0.768748, 0.769347, 0.769967, 0.770607,
-    0.771262, 0.77193, 0.772608, 0.773291, 0.773977, 0.774662,
-    0.775342, 0.776014, 0.776675, 0.77732, 0.777948, 0.778555,
-    0.779139, 0.779696, 0.780225, 0.780723, 0.78119, 0.781623,
-    0.782021, 0.782384, 0.782712, 0.783004, 0.783261, 0.783483,
-    0.783672, 0.783828, 0.783953, 0.78405, 0.78412, 0.784167,
-    0.784191, 0.784197, 0.784188, 0.784167, 0.784136, 0.7841,
-    0.784062, 0.784025, 0.783993, 0.783969, 0.783957, 0.783959,
-    0.783978, 0.784019, 0.784082, 0.784171, 0.784288, 0.784434,
-    0.784611, 0.784821, 0.785064, 0.785341, 0.785652, 0.785997,
-    0.786376, 0.786789, 0.787233, 0.787708, 0.788212, 0.788743,
-    0.789299, 0.789877, 0.790475, 0.79109, 0.791718, 0.792358,
-    0.793004, 0.793655, 0.794307, 0.794955, 0.795598, 0.796232,
-    0.796852, 0.797458, 0.798044, 0.79861, 0.799152, 0.799668,
-    0.800155, 0.800613, 0.801039, 0.801433, 0.801794, 0.80212,
-    0.802413, 0.802671, 0.802896, 0.803089, 0.80325, 0.80338,
-    0.803482, 0.803558, 0.803609, 0.803638, 0.803649, 0.803643,
-    0.803623, 0.803593, 0.803557, 0.803516, 0.803476, 0.803438,
-    0.803406, 0.803384, 0.803374, 0.80338, 0.803404, 0.803449,
-    0.803517, 0.80361, 0.803732, 0.803882, 0.804063, 0.804275,
-    0.80452, 0.804797, 0.805107, 0.805451, 0.805826, 0.806232,
-    0.806669, 0.807134, 0.807626, 0.808144, 0.808684, 0.809244,
-    0.809822, 0.810415, 0.811019, 0.811633, 0.812252, 0.812873,
-    0.813493, 0.814109, 0.814718, 0.815317, 0.815902, 0.81647,
-    0.81702, 0.817548, 0.818052, 0.81853, 0.81898, 0.819401,
-    0.819791, 0.82015, 0.820476, 0.820769, 0.82103, 0.821258,
-    0.821455, 0.82162, 0.821756, 0.821863, 0.821944, 0.822001,
-    0.822035, 0.822049, 0.822047, 0.82203, 0.822002, 0.821965,
-    0.821923, 0.821879, 0.821837, 0.821798, 0.821768, 0.821747,
-    0.82174, 0.82175, 0.821778, 0.821828, 0.821901, 0.821999,
-    0.822125, 0.82228, 0.822464, 0.822679, 0.822926, 0.823205,
-    0.823515, 0.823856, 0.824228, 0.824629, 0.825059, 0.825516,
-    0.825998, 0.826503, 0.827029, 0.827574, 0.828134, 0.828706,
-    0.829289, 0.829879, 0.830473, 0.831067, 0.831659, 0.832246,
-    0.832824, 0.83339, 0.833943, 0.834478, 0.834994, 0.835487,
-    0.835957, 0.836401, 0.836817, 0.837204, 0.837561, 0.837887,
-    0.838182, 0.838445, 0.838676, 0.838877, 0.839047, 0.839188,
-    0.839301, 0.839388, 0.83945, 0.839489, 0.839508, 0.839509,
-    0.839495, 0.839468, 0.839432, 0.839389, 0.839343, 0.839297,
-    0.839253, 0.839215, 0.839185, 0.839167, 0.839163, 0.839177,
-    0.839209, 0.839263, 0.839342, 0.839445, 0.839576, 0.839735,
-    0.839923, 0.840142, 0.840391, 0.840671, 0.840981, 0.841321,
-    0.84169, 0.842088, 0.842512, 0.842962, 0.843434, 0.843929,
-    0.844442, 0.844971, 0.845515, 0.84607, 0.846633, 0.847201,
-    0.847772, 0.848342, 0.848908, 0.849467, 0.850017, 0.850554,
-    0.851077, 0.851581, 0.852066, 0.852528, 0.852966, 0.853378,
-    0.853763, 0.854119, 0.854445, 0.854742, 0.855008, 0.855243,
-    0.855448, 0.855623, 0.85577, 0.855888, 0.85598, 0.856048,
-    0.856092, 0.856116, 0.856121, 0.85611, 0.856085, 0.85605,
-    0.856007, 0.85596, 0.85591, 0.855861, 0.855816, 0.855778,
-    0.85575, 0.855735, 0.855735, 0.855752, 0.855789, 0.855848,
-    0.855932, 0.85604, 0.856176, 0.856339, 0.856532, 0.856754,
-    0.857006, 0.857287, 0.857598, 0.857937, 0.858305, 0.858699,
-    0.859118, 0.859561, 0.860026, 0.86051, 0.861012, 0.861528,
-    0.862057, 0.862595, 0.86314, 0.863689, 0.864238, 0.864785,
-    0.865328, 0.865862, 0.866386, 0.866896, 0.867391, 0.867867,
-    0.868323, 0.868756, 0.869164, 0.869547, 0.869903, 0.87023,
-    0.870529, 0.870798, 0.871037, 0.871247, 0.871427, 0.871579,
-    0.871703, 0.871801, 0.871874, 0.871924, 0.871952, 0.871962,
-    0.871954, 0.871932, 0.871899, 0.871856, 0.871807, 0.871755,
-    0.871702, 0.871651, 0.871606, 0.871569, 0.871543, 0.871531,
-    0.871534, 0.871555, 0.871597, 0.871662, 0.87175, 0.871864,
-    0.872004, 0.872173, 0.872369, 0.872595, 0.87285, 0.873133,
-    0.873445, 0.873784, 0.87415, 0.874541, 0.874956, 0.875393,
-    0.875851, 0.876326, 0.876818, 0.877322, 0.877837, 0.87836,
-    0.878888, 0.879419, 0.879949, 0.880475, 0.880995, 0.881507,
-    0.882006, 0.882491, 0.88296, 0.88341, 0.883839, 0.884245,
-    0.884626, 0.884982, 0.88531, 0.885611, 0.885883, 0.886127,
-    0.886341, 0.886527, 0.886685, 0.886815, 0.886919, 0.886998,
-    0.887053, 0.887087, 0.8871, 0.887097, 0.887077, 0.887046,
-    0.887003, 0.886954, 0.8869, 0.886843, 0.886788, 0.886737,
-    0.886692, 0.886656, 0.886632, 0.886622, 0.886629, 0.886655,
-    0.886702, 0.886771, 0.886865, 0.886984, 0.88713, 0.887303,
-    0.887504, 0.887734, 0.887991, 0.888277, 0.88859, 0.888929,
-    0.889294, 0.889683, 0.890095, 0.890527, 0.890978, 0.891445,
-    0.891927, 0.892421, 0.892923, 0.893432, 0.893945, 0.894458,
-    0.89497, 0.895477, 0.895977, 0.896466, 0.896943, 0.897405,
-    0.89785, 0.898275, 0.898679, 0.899059, 0.899415, 0.899746,
-    0.900049, 0.900325, 0.900573, 0.900792, 0.900983, 0.901147,
-    0.901283, 0.901393, 0.901478, 0.901539, 0.901578, 0.901597,
-    0.901597, 0.901581, 0.901551, 0.90151, 0.901461, 0.901405,
-    0.901346, 0.901286, 0.901229, 0.901177, 0.901132, 0.901098,
-    0.901077, 0.90107, 0.901081, 0.901112, 0.901163, 0.901238,
-    0.901337, 0.901462, 0.901613, 0.901791, 0.901996, 0.90223,
-    0.902491, 0.902779, 0.903093, 0.903433, 0.903797, 0.904185,
-    0.904593, 0.905021, 0.905466, 0.905926, 0.906399, 0.906883,
-    0.907374, 0.90787, 0.908368, 0.908866, 0.909361, 0.909849,
-    0.91033, 0.910799, 0.911255, 0.911695, 0.912117, 0.912519,
-    0.912899, 0.913256, 0.913588, 0.913894, 0.914174, 0.914426,
-    0.914651, 0.914848, 0.915018, 0.915161, 0.915277, 0.915368,
-    0.915435, 0.915479, 0.915503, 0.915508, 0.915495, 0.915468,
-    0.915429, 0.915379, 0.915323, 0.915262, 0.915198, 0.915136,
-    0.915077, 0.915025, 0.914981, 0.914948, 0.91493, 0.914927,
-    0.914942, 0.914977, 0.915034, 0.915114, 0.915218, 0.915348,
-    0.915504, 0.915688, 0.915898, 0.916136, 0.9164, 0.916691,
-    0.917007, 0.917348, 0.917712, 0.918098, 0.918503, 0.918927,
-    0.919367, 0.919821, 0.920286, 0.92076, 0.92124, 0.921724,
-    0.922209, 0.922692, 0.923171, 0.923643, 0.924105, 0.924556,
-    0.924991, 0.925411, 0.925811, 0.926192, 0.92655, 0.926884,
-    0.927194, 0.927478, 0.927735, 0.927965, 0.928168, 0.928344,
-    0.928493, 0.928616, 0.928714, 0.928787, 0.928837, 0.928866,
-    0.928875, 0.928867, 0.928843, 0.928805, 0.928757, 0.9287,
-    0.928637, 0.928571, 0.928504, 0.928439, 0.928379, 0.928327,
-    0.928284, 0.928253, 0.928237, 0.928238, 0.928257, 0.928297,
-    0.928359, 0.928445, 0.928555, 0.92869, 0.928852, 0.92904,
-    0.929256, 0.929497, 0.929765, 0.930059, 0.930377, 0.930719,
-    0.931083, 0.931468, 0.931872, 0.932292, 0.932727, 0.933175,
-    0.933633, 0.934098, 0.934568, 0.935041, 0.935513, 0.935983,
-    0.936447, 0.936903, 0.937348, 0.93778, 0.938197, 0.938597,
-    0.938978, 0.939337, 0.939674, 0.939988, 0.940276, 0.940538,
-    0.940775, 0.940984, 0.941167, 0.941323, 0.941452, 0.941557,
-    0.941637, 0.941693, 0.941728, 0.941742, 0.941738, 0.941717,
-    0.941681, 0.941634, 0.941577, 0.941513, 0.941445, 0.941374,
-    0.941304, 0.941237, 0.941177, 0.941124, 0.941083, 0.941054,
-    0.941041, 0.941046, 0.941069, 0.941114, 0.941181, 0.941272,
-    0.941388, 0.941529, 0.941696, 0.94189, 0.94211, 0.942356,
-    0.942628, 0.942924, 0.943245, 0.943588, 0.943953, 0.944337,
-    0.944738, 0.945156, 0.945587, 0.946029, 0.94648, 0.946937,
-    0.947398, 0.94786, 0.948321, 0.948778, 0.949227, 0.949668,
-    0.950097, 0.950513, 0.950912, 0.951294, 0.951655, 0.951995,
-    0.952313, 0.952606, 0.952874, 0.953116, 0.953332, 0.953522,
-    0.953685, 0.953822, 0.953934, 0.954021, 0.954084, 0.954124,
-    0.954144, 0.954144, 0.954127, 0.954095, 0.95405, 0.953993,
-    0.953928, 0.953858, 0.953784, 0.953709, 0.953636, 0.953568,
-    0.953506, 0.953454, 0.953414, 0.953388, 0.953378, 0.953386,
-    0.953414, 0.953464, 0.953536, 0.953632, 0.953753, 0.9539,
-    0.954073, 0.954272, 0.954496, 0.954747, 0.955022, 0.955322,
-    0.955645, 0.95599, 0.956355, 0.956738, 0.957139, 0.957553,
-    0.957981, 0.958418, 0.958862, 0.959312, 0.959765, 0.960217,
-    0.960667, 0.961111, 0.961548, 0.961975, 0.962389, 0.962788,
-    0.963171, 0.963535, 0.963879, 0.964201, 0.964499, 0.964773,
-    0.965023, 0.965246, 0.965443, 0.965614, 0.965759, 0.965879,
-    0.965973, 0.966043, 0.966091, 0.966116, 0.966122, 0.966109,
-    0.96608, 0.966037, 0.965982, 0.965917, 0.965845, 0.965768,
-    0.965689, 0.965611, 0.965535, 0.965465, 0.965403, 0.965351,
-    0.965312, 0.965288, 0.965281, 0.965293, 0.965325, 0.965379,
-    0.965456, 0.965557, 0.965684, 0.965836, 0.966014, 0.966217,
-    0.966447, 0.966701, 0.96698, 0.967283, 0.967608, 0.967954,
-    0.96832, 0.968703, 0.969102, 0.969514, 0.969938, 0.97037,
-    0.97081, 0.971253, 0.971697, 0.97214, 0.97258, 0.973013,
-    0.973438, 0.973851, 0.974252, 0.974637, 0.975004, 0.975352,
-    0.97568, 0.975984, 0.976266, 0.976523, 0.976755, 0.97696,
-    0.97714, 0.977294, 0.977423, 0.977526, 0.977604, 0.977659,
-    0.977692, 0.977704, 0.977696, 0.977672, 0.977632, 0.977578,
-    0.977514, 0.977441, 0.977362, 0.977279, 0.977195, 0.977113,
-    0.977035, 0.976963, 0.9769, 0.976848, 0.97681, 0.976787,
-    0.976782, 0.976796, 0.976831, 0.976889, 0.97697, 0.977075,
-    0.977206, 0.977362, 0.977543, 0.977751, 0.977984, 0.978242,
-    0.978523, 0.978828, 0.979155, 0.979502, 0.979868, 0.98025,
-    0.980648, 0.981058, 0.981478, 0.981906, 0.98234, 0.982778,
-    0.983215, 0.983651, 0.984082, 0.984505, 0.98492, 0.985323,
-    0.985711, 0.986084, 0.986438, 0.986773, 0.987087, 0.987378,
-    0.987645, 0.987887, 0.988105, 0.988296, 0.988462, 0.988601,
-    0.988716, 0.988805, 0.98887, 0.988912, 0.988933, 0.988933,
-    0.988914, 0.988879, 0.988829, 0.988766, 0.988694, 0.988613,
-    0.988526, 0.988437, 0.988347, 0.98826, 0.988177, 0.988101,
-    0.988034, 0.987979, 0.987939, 0.987914, 0.987907, 0.98792,
-    0.987954, 0.98801, 0.98809, 0.988195, 0.988325, 0.98848,
-    0.988661, 0.988868, 0.9891, 0.989357, 0.989637, 0.989941,
-    0.990266, 0.990611, 0.990975, 0.991356, 0.991751, 0.992159,
-    0.992577, 0.993003, 0.993434, 0.993869, 0.994304, 0.994737,
-    0.995166, 0.995587, 0.996, 0.996401, 0.996788, 0.99716,
-    0.997513, 0.997848, 0.998161, 0.998452, 0.998719, 0.998962,
-    0.99918, 0.999372, 0.999537, 0.999677, 0.999791, 0.99988,
-    0.999943, 0.999983, 1, 0.999995, 0.99997, 0.999926,
-    0.999866, 0.99979, 0.999701, 0.9996, 0.999491, 0.999375,
-    0.999253, 0.999129, 0.999005, 0.998882, 0.998762, 0.998647,
-    0.998539, 0.99844, 0.998351, 0.998273, 0.998208, 0.998156,
-    0.998119, 0.998096
-};
-
-static const float WAVE_LOGARITHMIC_078[DEFAULT_WAVELEN] = {
-    -1, -0.999761, -0.999044, -0.99785, -0.99618, -0.994037,
-    -0.991423, -0.988341, -0.984796, -0.980791, -0.976332, -0.971424,
-    -0.966073, -0.960286, -0.954069, -0.947431, -0.940379, -0.932923,
-    -0.925071, -0.916832, -0.908217, -0.899237, -0.889901, -0.880222,
-    -0.87021, -0.859878, -0.849238, -0.838302, -0.827084, -0.815597,
-    -0.803853, -0.791867, -0.779653, -0.767224, -0.754595, -0.74178,
-    -0.728793, -0.715649, -0.702363, -0.68895, -0.675424, -0.661799,
-    -0.648091, -0.634314, -0.620483, -0.606613, -0.592717, -0.57881,
-    -0.564906, -0.55102, -0.537164, -0.523353, -0.5096, -0.495918,
-    -0.482319, -0.468816, -0.455422, -0.442149, -0.429007, -0.416009,
-    -0.403165, -0.390485, -0.377979, -0.365659, -0.353531, -0.341606,
-    -0.329891, -0.318396, -0.307126, -0.29609, -0.285293, -0.274742,
-    -0.264443, -0.254399, -0.244617, -0.235101, -0.225853, -0.216877,
-    -0.208176, -0.199751, -0.191605, -0.183739, -0.176153, -0.168847,
-    -0.161822, -0.155077, -0.148609, -0.142419, -0.136504, -0.130861,
-    -0.125487, -0.120379, -0.115534, -0.110947, -0.106614, -0.102529,
-    -0.0986888, -0.0950864, -0.0917164, -0.0885726, -0.0856487, -0.0829378,
-    -0.0804332, -0.0781275, -0.0760133, -0.0740831, -0.072329, -0.0707431,
-    -0.0693173, -0.0680432, -0.0669125, -0.0659168, -0.0650475, -0.064296,
-    -0.0636536, -0.0631116, -0.0626615, -0.0622944, -0.0620018, -0.061775,
-    -0.0616054, -0.0614847, -0.0614044, -0.0613562, -0.0613321, -0.0613239,
-    -0.0613239, -0.0613243, -0.0613176, -0.0612965, -0.0612539, -0.0611828,
-    -0.0610767, -0.060929, -0.0607336, -0.0604846, -0.0601763, -0.0598032,
-    -0.0593604, -0.058843, -0.0582465, -0.0575666, -0.0567994, -0.0559414,
-    -0.0549892, -0.0539399, -0.0527908, -0.0515396, -0.0501842, -0.048723,
-    -0.0471545, -0.0454777, -0.0436918, -0.0417964, -0.0397913, -0.0376768,
-    -0.0354532, -0.0331214, -0.0306823, -0.0281374, -0.0254882, -0.0227365,
-    -0.0198846, -0.0169347, -0.0138896, -0.010752, -0.00752506, -0.00421205,
-    -0.000816447, 0.00265806, 0.00620762, 0.0098282, 0.0135156, 0.0172655,
-    0.0210735, 0.0249349, 0.0288452, 0.0327994, 0.0367927, 0.0408202,
-    0.0448769, 0.0489578, 0.0530577, 0.0571716, 0.0612945, 0.0654211,
-    0.0695464, 0.0736654, 0.0777731, 0.0818644, 0.0859346, 0.0899789,
-    0.0939924, 0.0979705, 0.101909, 0.105803, 0.109648, 0.113441,
-    0.117177, 0.120853, 0.124464, 0.128008, 0.13148, 0.134879,
-    0.1382, 0.141441, 0.144599, 0.147673, 0.150659, 0.153557,
-    0.156363, 0.159077, 0.161698, 0.164224, 0.166654, 0.168987,
-    0.171224, 0.173364, 0.175407, 0.177353, 0.179203, 0.180956,
-    0.182615, 0.184181, 0.185653, 0.187034, 0.188326, 0.18953,
-    0.190649, 0.191683, 0.192637, 0.193512, 0.19431, 0.195036,
-    0.19569, 0.196278, 0.196801, 0.197264, 0.197669, 0.19802,
-    0.198321, 0.198575, 0.198785, 0.198957, 0.199093, 0.199198,
-    0.199274, 0.199327, 0.199361, 0.199378, 0.199383, 0.19938,
-    0.199373, 0.199366, 0.199362, 0.199365, 0.199379, 0.199407,
-    0.199454, 0.199522, 0.199614, 0.199735, 0.199887, 0.200073,
-    0.200296, 0.20056, 0.200865, 0.201216, 0.201615, 0.202063,
-    0.202563, 0.203117, 0.203726, 0.204392, 0.205117, 0.205902,
-    0.206747, 0.207655, 0.208625, 0.209658, 0.210755, 0.211916,
-    0.21314, 0.214429, 0.215781, 0.217196, 0.218674, 0.220214,
-    0.221815, 0.223476, 0.225195, 0.226971, 0.228804, 0.23069,
-    0.232629, 0.234619, 0.236657, 0.238741, 0.24087, 0.24304,
-    0.245249, 0.247496, 0.249776, 0.252088, 0.254428, 0.256794,
-    0.259183, 0.261592, 0.264018, 0.266458, 0.268909, 0.271368,
-    0.273832, 0.276298, 0.278762, 0.281222, 0.283674, 0.286116,
-    0.288545, 0.290957, 0.29335, 0.295722, 0.298068, 0.300387,
-    0.302676, 0.304933, 0.307154, 0.309338, 0.311482, 0.313585,
-    0.315643, 0.317656, 0.319621, 0.321537, 0.323402, 0.325214,
-    0.326973, 0.328677, 0.330325, 0.331916, 0.333449, 0.334923,
-    0.336339, 0.337696, 0.338993, 0.34023, 0.341408, 0.342527,
-    0.343586, 0.344587, 0.34553, 0.346416, 0.347245, 0.348018,
-    0.348738, 0.349404, 0.350018, 0.350582, 0.351097, 0.351565,
-    0.351987, 0.352366, 0.352703, 0.353001, 0.353261, 0.353486,
-    0.353678, 0.353839, 0.353972, 0.354079, 0.354162, 0.354224,
-    0.354268, 0.354296, 0.354311, 0.354315, 0.354311, 0.354301,
-    0.354289, 0.354275, 0.354265, 0.354258, 0.354259, 0.35427,
-    0.354293, 0.35433, 0.354384, 0.354457, 0.354552, 0.354669,
-    0.354813, 0.354983, 0.355183, 0.355413, 0.355677, 0.355975,
-    0.356309, 0.35668, 0.35709, 0.357539, 0.35803, 0.358562,
-    0.359137, 0.359756, 0.360418, 0.361126, 0.361878, 0.362676,
-    0.363519, 0.364407, 0.365341, 0.366321, 0.367345, 0.368413,
-    0.369526, 0.370682, 0.37188, 0.37312, 0.374401, 0.375721,
-    0.37708, 0.378476, 0.379908, 0.381374, 0.382873, 0.384403,
-    0.385962, 0.38755, 0.389163, 0.390801, 0.39246, 0.39414,
-    0.395838, 0.397552, 0.39928, 0.40102, 0.402769, 0.404526,
-    0.406288, 0.408053, 0.409819, 0.411583, 0.413344, 0.415099,
-    0.416846, 0.418583, 0.420308, 0.422019, 0.423713, 0.425389,
-    0.427045, 0.428679, 0.430288, 0.431872, 0.433429, 0.434956,
-    0.436453, 0.437917, 0.439348, 0.440745, 0.442105, 0.443427,
-    0.444712, 0.445957, 0.447162, 0.448327, 0.449449, 0.45053,
-    0.451568, 0.452564, 0.453516, 0.454424, 0.45529, 0.456112,
-    0.456891, 0.457627, 0.458321, 0.458972, 0.459582, 0.460152,
-    0.460681, 0.46117, 0.461622, 0.462036, 0.462414, 0.462757,
-    0.463066, 0.463343, 0.463588, 0.463805, 0.463993, 0.464154,
-    0.464291, 0.464405, 0.464497, 0.46457, 0.464625, 0.464665,
-    0.46469, 0.464703, 0.464706, 0.464701, 0.46469, 0.464674,
-    0.464656, 0.464638, 0.464621, 0.464607, 0.464599, 0.464599,
-    0.464607, 0.464627, 0.464659, 0.464705, 0.464768, 0.464849,
-    0.464949, 0.46507, 0.465213, 0.46538, 0.465572, 0.465791,
-    0.466037, 0.466312, 0.466617, 0.466953, 0.46732, 0.46772,
-    0.468152, 0.468619, 0.46912, 0.469655, 0.470226, 0.470832,
-    0.471473, 0.47215, 0.472863, 0.473611, 0.474394, 0.475212,
-    0.476065, 0.476952, 0.477872, 0.478826, 0.479811, 0.480829,
-    0.481876, 0.482953, 0.484059, 0.485192, 0.486352, 0.487536,
-    0.488745, 0.489976, 0.491228, 0.492499, 0.493789, 0.495095,
-    0.496416, 0.497751, 0.499097, 0.500453, 0.501818, 0.503189,
-    0.504566, 0.505945, 0.507326, 0.508707, 0.510086, 0.511461,
-    0.51283, 0.514193, 0.515546, 0.516889, 0.51822, 0.519537,
-    0.520839, 0.522124, 0.523391, 0.524638, 0.525864, 0.527068,
-    0.528248, 0.529403, 0.530533, 0.531635, 0.532709, 0.533753,
-    0.534768, 0.535753, 0.536706, 0.537626, 0.538514, 0.539369,
-    0.540191, 0.540978, 0.541732, 0.542451, 0.543136, 0.543787,
-    0.544403, 0.544986, 0.545534, 0.546049, 0.546531, 0.546981,
-    0.547398, 0.547784, 0.548139, 0.548465, 0.548761, 0.54903,
-    0.549271, 0.549486, 0.549677, 0.549843, 0.549987, 0.55011,
-    0.550212, 0.550296, 0.550363, 0.550414, 0.55045, 0.550474,
-    0.550486, 0.550488, 0.550482, 0.55047, 0.550452, 0.550431,
-    0.550407, 0.550384, 0.550361, 0.550341, 0.550326, 0.550316,
-    0.550314, 0.550321, 0.550338, 0.550366, 0.550408, 0.550464,
-    0.550536, 0.550625, 0.550732, 0.550859, 0.551006, 0.551175,
-    0.551367, 0.551582, 0.551821, 0.552086, 0.552376, 0.552694,
-    0.553038, 0.55341, 0.553811, 0.55424, 0.554698, 0.555185,
-    0.555702, 0.556248, 0.556823, 0.557428, 0.558062, 0.558725,
-    0.559416, 0.560136, 0.560884, 0.56166, 0.562462, 0.563291,
-    0.564145, 0.565023, 0.565926, 0.566852, 0.5678, 0.568769,
-    0.569758, 0.570766, 0.571792, 0.572835, 0.573893, 0.574965,
-    0.57605, 0.577147, 0.578254, 0.579369, 0.580492, 0.581621,
-    0.582755, 0.583892, 0.58503, 0.586169, 0.587306, 0.588441,
-    0.589571, 0.590696, 0.591815, 0.592925, 0.594025, 0.595114,
-    0.596191, 0.597255, 0.598303, 0.599336, 0.600351, 0.601348,
-    0.602326, 0.603283, 0.604219, 0.605133, 0.606023, 0.60689,
-    0.607732, 0.608548, 0.609338, 0.610102, 0.610839, 0.611548,
-    0.612229, 0.612882, 0.613507, 0.614103, 0.61467, 0.615209,
-    0.615719, 0.616201, 0.616655, 0.61708, 0.617478, 0.617848,
-    0.618192, 0.618509, 0.618801, 0.619067, 0.61931, 0.619528,
-    0.619724, 0.619897, 0.62005, 0.620182, 0.620296, 0.620391,
-    0.62047, 0.620532, 0.62058, 0.620615, 0.620637, 0.620649,
-    0.62065, 0.620644, 0.62063, 0.620611, 0.620587, 0.62056,
-    0.620531, 0.620502, 0.620474, 0.620448, 0.620426, 0.620408,
-    0.620397, 0.620393, 0.620398, 0.620413, 0.620439, 0.620477,
-    0.620529, 0.620595, 0.620676, 0.620774, 0.62089, 0.621024,
-    0.621177, 0.62135, 0.621545, 0.62176, 0.621998, 0.622259,
-    0.622543, 0.62285, 0.623182, 0.623539, 0.62392, 0.624326,
-    0.624757, 0.625214, 0.625696, 0.626203, 0.626736, 0.627293,
-    0.627875, 0.628482, 0.629112, 0.629767, 0.630445, 0.631145,
-    0.631867, 0.632611, 0.633376, 0.634161, 0.634965, 0.635787,
-    0.636627, 0.637484, 0.638356, 0.639242, 0.640143, 0.641055,
-    0.641979, 0.642913, 0.643857, 0.644808, 0.645766, 0.646729,
-    0.647697, 0.648667, 0.649639, 0.650612, 0.651584, 0.652554,
-    0.653521, 0.654483, 0.65544, 0.65639, 0.657332, 0.658264,
-    0.659187, 0.660097, 0.660996, 0.66188, 0.66275, 0.663605,
-    0.664443, 0.665263, 0.666065, 0.666849, 0.667612, 0.668355,
-    0.669076, 0.669776, 0.670453, 0.671107, 0.671739, 0.672346,
-    0.672929, 0.673488, 0.674023, 0.674533, 0.675018, 0.675478,
-    0.675914, 0.676325, 0.676711, 0.677073, 0.677411, 0.677726,
-    0.678017, 0.678285, 0.678531, 0.678755, 0.678957, 0.67914,
-    0.679302, 0.679445, 0.67957, 0.679677, 0.679768, 0.679842,
-    0.679902, 0.679949, 0.679982, 0.680003, 0.680014, 0.680016,
-    0.680008, 0.679994, 0.679973, 0.679947, 0.679917, 0.679884,
-    0.67985, 0.679815, 0.679782, 0.67975, 0.679721, 0.679696,
-    0.679677, 0.679664, 0.679658, 0.679662, 0.679675, 0.679699,
-    0.679734, 0.679782, 0.679844, 0.67992, 0.680011, 0.680119,
-    0.680243, 0.680386, 0.680546, 0.680725, 0.680924, 0.681143,
-    0.681383, 0.681643, 0.681925, 0.682228, 0.682553, 0.682901,
-    0.68327, 0.683662, 0.684076, 0.684513, 0.684971, 0.685452,
-    0.685955, 0.68648, 0.687026, 0.687593, 0.688181, 0.688788,
-    0.689416, 0.690062, 0.690728, 0.691411, 0.692111, 0.692827,
-    0.693559, 0.694306, 0.695067, 0.695842, 0.696628, 0.697425,
-    0.698233, 0.69905, 0.699875, 0.700708, 0.701546, 0.70239,
-    0.703237, 0.704088, 0.70494, 0.705793, 0.706645, 0.707496,
-    0.708345, 0.709189, 0.710029, 0.710863, 0.711689, 0.712508,
-    0.713318, 0.714118, 0.714907, 0.715684, 0.716449, 0.7172,
-    0.717936, 0.718657, 0.719361, 0.720049, 0.72072, 0.721372,
-    0.722006, 0.72262, 0.723215, 0.723789, 0.724343, 0.724875,
-    0.725387, 0.725876, 0.726345, 0.726791, 0.727215, 0.727617,
-    0.727997, 0.728356, 0.728692, 0.729007, 0.7293, 0.729573,
-    0.729824, 0.730055, 0.730267, 0.730458, 0.730631, 0.730785,
-    0.730922, 0.731041, 0.731144, 0.731231, 0.731304, 0.731362,
-    0.731407, 0.73144, 0.731461, 0.731471, 0.731472, 0.731464,
-    0.731449, 0.731427, 0.731399, 0.731366, 0.73133, 0.731292,
-    0.731252, 0.731211, 0.731171, 0.731133, 0.731098, 0.731066,
-    0.731039, 0.731018, 0.731003, 0.730996, 0.730998, 0.73101,
-    0.731031, 0.731065, 0.73111, 0.731168, 0.73124, 0.731327,
-    0.731429, 0.731546, 0.73168, 0.731831, 0.732, 0.732186,
-    0.732391, 0.732615, 0.732858, 0.733121, 0.733403, 0.733706,
-    0.734028, 0.734371, 0.734733, 0.735116, 0.735519, 0.735942,
-    0.736385, 0.736848, 0.73733, 0.737831, 0.738351, 0.738889,
-    0.739445, 0.740018, 0.740608, 0.741215, 0.741837, 0.742474,
-    0.743125, 0.74379, 0.744467, 0.745157, 0.745858, 0.746569,
-    0.747289, 0.748018, 0.748755, 0.749498, 0.750247, 0.751001,
-    0.751758, 0.752518, 0.75328, 0.754043, 0.754806, 0.755567,
-    0.756326, 0.757082, 0.757834, 0.75858, 0.759321, 0.760054,
-    0.760779, 0.761496, 0.762202, 0.762899, 0.763583, 0.764256,
-    0.764915, 0.765561, 0.766192, 0.766808, 0.767408, 0.767992,
-    0.768559, 0.769108, 0.76964, 0.770153, 0.770648, 0.771124,
-    0.77158, 0.772017, 0.772435, 0.772832, 0.773209, 0.773567,
-    0.773905, 0.774222, 0.77452, 0.774798, 0.775057, 0.775296,
-    0.775517, 0.775719, 0.775903, 0.776069, 0.776218, 0.77635,
-    0.776466, 0.776566, 0.776651, 0.776722, 0.776779, 0.776823,
-    0.776855, 0.776876, 0.776886, 0.776887, 0.776879, 0.776862,
-    0.776839, 0.776809, 0.776775, 0.776736, 0.776693, 0.776649,
-    0.776603, 0.776556, 0.77651, 0.776465, 0.776423, 0.776384,
-    0.77635, 0.77632, 0.776297, 0.776281, 0.776272, 0.776273,
-    0.776283, 0.776303, 0.776334, 0.776377, 0.776433, 0.776502,
-    0.776584, 0.776682, 0.776794, 0.776922, 0.777066, 0.777226,
-    0.777404, 0.777598, 0.777811, 0.778041, 0.778289, 0.778556,
-    0.778841, 0.779145, 0.779467, 0.779808, 0.780167, 0.780545,
-    0.780941, 0.781355, 0.781787, 0.782237, 0.782704, 0.783188,
-    0.783688, 0.784204, 0.784736, 0.785283, 0.785845, 0.78642,
-    0.787009, 0.78761, 0.788223, 0.788847, 0.789482, 0.790126,
-    0.790779, 0.79144, 0.792108, 0.792782, 0.793462, 0.794146,
-    0.794834, 0.795525, 0.796217, 0.79691, 0.797604, 0.798296,
-    0.798986, 0.799674, 0.800357, 0.801036, 0.80171, 0.802377,
-    0.803037, 0.803689, 0.804332, 0.804965, 0.805588, 0.8062,
-    0.8068, 0.807387, 0.807961, 0.808521, 0.809067, 0.809598,
-    0.810113, 0.810612, 0.811095, 0.81156, 0.812009, 0.81244,
-    0.812854, 0.813249, 0.813627, 0.813986, 0.814326, 0.814648,
-    0.814952, 0.815237, 0.815504, 0.815753, 0.815984, 0.816197,
-    0.816393, 0.816571, 0.816733, 0.816878, 0.817007, 0.817121,
-    0.817219, 0.817303, 0.817373, 0.81743, 0.817474, 0.817506,
-    0.817527, 0.817537, 0.817537, 0.817529, 0.817512, 0.817487,
-    0.817456, 0.817419, 0.817378, 0.817332, 0.817283, 0.817232,
-    0.817179, 0.817126, 0.817074, 0.817022, 0.816973, 0.816927,
-    0.816885, 0.816847, 0.816816, 0.81679, 0.816772, 0.816762,
-    0.816761, 0.816769, 0.816788, 0.816817, 0.816858, 0.816912,
-    0.816978, 0.817058, 0.817152, 0.81726, 0.817383, 0.817522,
-    0.817676, 0.817847, 0.818034, 0.818237, 0.818458, 0.818695,
-    0.81895, 0.819222, 0.819511, 0.819818, 0.820142, 0.820483,
-    0.820842, 0.821217, 0.821609, 0.822018, 0.822442, 0.822883,
-    0.823339, 0.82381, 0.824296, 0.824796, 0.825309, 0.825836,
-    0.826375, 0.826926, 0.827488, 0.82806, 0.828642, 0.829234,
-    0.829834, 0.830441, 0.831055, 0.831675, 0.832301, 0.83293,
-    0.833563, 0.834199, 0.834837, 0.835475, 0.836114, 0.836752,
-    0.837388, 0.838021, 0.838652, 0.839278, 0.839899, 0.840514,
-    0.841123, 0.841724, 0.842317, 0.8429, 0.843475, 0.844039,
-    0.844592, 0.845133, 0.845662, 0.846177, 0.84668, 0.847168,
-    0.847643, 0.848102, 0.848545, 0.848974, 0.849386, 0.849781,
-    0.85016, 0.850523, 0.850868, 0.851196, 0.851507, 0.851801,
-    0.852077, 0.852337, 0.852579, 0.852804, 0.853012, 0.853203,
-    0.853378, 0.853537, 0.85368, 0.853807, 0.85392, 0.854017,
-    0.854101, 0.854171, 0.854228, 0.854272, 0.854304, 0.854325,
-    0.854336, 0.854336, 0.854327, 0.854309, 0.854284, 0.854251,
-    0.854213, 0.854168, 0.854119, 0.854067, 0.854011, 0.853953,
-    0.853893, 0.853833, 0.853774, 0.853715, 0.853659, 0.853605,
-    0.853555, 0.853509, 0.853469, 0.853435, 0.853407, 0.853387,
-    0.853375, 0.853372, 0.853379, 0.853396, 0.853424, 0.853463,
-    0.853515, 0.853579, 0.853657, 0.853748, 0.853853, 0.853973,
-    0.854107, 0.854257, 0.854422, 0.854603, 0.8548, 0.855013,
-    0.855242, 0.855488, 0.85575, 0.856029, 0.856323, 0.856635,
-    0.856962, 0.857305, 0.857665, 0.85804, 0.85843, 0.858835,
-    0.859256, 0.85969, 0.860138, 0.8606, 0.861075, 0.861562,
-    0.862061, 0.862571, 0.863092, 0.863623, 0.864164, 0.864713,
-    0.86527, 0.865834, 0.866405, 0.866982, 0.867564, 0.86815,
-    0.86874, 0.869332, 0.869926, 0.870521, 0.871116, 0.87171,
-    0.872303, 0.872894, 0.873482, 0.874066, 0.874645, 0.875219,
-    0.875787, 0.876347, 0.8769, 0.877445, 0.87798, 0.878506,
-    0.879022, 0.879526, 0.880019, 0.8805, 0.880968, 0.881423,
-    0.881864, 0.882291, 0.882704, 0.883101, 0.883484, 0.883851,
-    0.884203, 0.884538, 0.884857, 0.885161, 0.885447, 0.885718,
-    0.885972, 0.88621, 0.886431, 0.886636, 0.886825, 0.886998,
-    0.887156, 0.887298, 0.887425, 0.887538, 0.887636, 0.88772,
-    0.887791, 0.887848, 0.887893, 0.887926, 0.887948, 0.887958,
-    0.887959, 0.88795, 0.887932, 0.887905, 0.887871, 0.887831,
-    0.887784, 0.887732, 0.887676, 0.887616, 0.887552, 0.887487,
-    0.88742, 0.887353, 0.887286, 0.887219, 0.887155, 0.887093,
-    0.887035, 0.886981, 0.886931, 0.886888, 0.88685, 0.88682,
-    0.886798, 0.886784, 0.886779, 0.886784, 0.8868, 0.886826,
-    0.886864, 0.886914, 0.886976, 0.887052, 0.887141, 0.887243,
-    0.88736, 0.887492, 0.887638, 0.887799, 0.887975, 0.888167,
-    0.888375, 0.888598, 0.888836, 0.889091, 0.889361, 0.889647,
-    0.889948, 0.890265, 0.890597, 0.890944, 0.891305, 0.891682,
-    0.892072, 0.892476, 0.892893, 0.893324, 0.893767, 0.894222,
-    0.894688, 0.895165, 0.895653, 0.89615, 0.896657, 0.897172,
-    0.897695, 0.898224, 0.898761, 0.899303, 0.899849, 0.9004,
-    0.900955, 0.901512, 0.902071, 0.902631, 0.903191, 0.903751,
-    0.90431, 0.904867, 0.905421, 0.905971, 0.906517, 0.907058,
-    0.907593, 0.908121, 0.908642, 0.909156, 0.90966, 0.910156,
-    0.910642, 0.911117, 0.911581, 0.912034, 0.912474, 0.912902,
-    0.913317, 0.913719, 0.914106, 0.91448, 0.914839, 0.915183,
-    0.915512, 0.915826, 0.916124, 0.916407, 0.916674, 0.916926,
-    0.917161, 0.917381, 0.917586, 0.917774, 0.917948, 0.918106,
-    0.918249, 0.918377, 0.91849, 0.91859, 0.918675, 0.918747,
-    0.918806, 0.918853, 0.918887, 0.91891, 0.918921, 0.918922,
-    0.918913, 0.918895, 0.918868, 0.918833, 0.918791, 0.918742,
-    0.918688, 0.918628, 0.918563, 0.918495, 0.918424, 0.91835,
-    0.918275, 0.9182, 0.918125, 0.91805, 0.917977, 0.917907,
-    0.917839, 0.917776, 0.917717, 0.917664, 0.917616, 0.917576,
-    0.917542, 0.917517, 0.917501, 0.917494, 0.917497, 0.91751,
-    0.917535, 0.917571, 0.917619, 0.91768, 0.917753, 0.91784,
-    0.91794, 0.918055, 0.918183, 0.918326, 0.918484, 0.918657,
-    0.918845, 0.919048, 0.919266, 0.919499, 0.919747, 0.920011,
-    0.92029, 0.920584, 0.920892, 0.921215, 0.921552, 0.921904,
-    0.922269, 0.922647, 0.923039, 0.923443, 0.923859, 0.924288,
-    0.924727, 0.925177, 0.925637, 0.926107, 0.926585, 0.927072,
-    0.927567, 0.928069, 0.928577, 0.929091, 0.929609, 0.930132,
-    0.930658, 0.931187, 0.931718, 0.932251, 0.932783, 0.933316,
-    0.933847, 0.934377, 0.934904, 0.935427, 0.935947, 0.936462,
-    0.936971, 0.937474, 0.937971, 0.93846, 0.93894, 0.939412,
-    0.939875, 0.940327, 0.940769, 0.9412, 0.941619, 0.942026,
-    0.94242, 0.942802, 0.94317, 0.943524, 0.943865, 0.944191,
-    0.944503, 0.9448, 0.945082, 0.945348, 0.9456, 0.945836,
-    0.946058, 0.946263, 0.946454, 0.94663, 0.94679, 0.946936,
-    0.947067, 0.947183, 0.947285, 0.947374, 0.947449, 0.94751,
-    0.947559, 0.947596, 0.947621, 0.947634, 0.947636, 0.947628,
-    0.94761, 0.947584, 0.947548, 0.947505, 0.947454, 0.947397,
-    0.947333, 0.947265, 0.947192, 0.947115, 0.947035, 0.946953,
-    0.946869, 0.946785, 0.9467, 0.946616, 0.946534, 0.946454,
-    0.946376, 0.946302, 0.946233, 0.946169, 0.94611, 0.946058,
-    0.946013, 0.945975, 0.945947, 0.945927, 0.945916, 0.945916,
-    0.945926, 0.945948, 0.945981, 0.946026, 0.946084, 0.946155,
-    0.946238, 0.946336, 0.946447, 0.946573, 0.946712, 0.946867,
-    0.947036, 0.947219, 0.947418, 0.947631, 0.947859, 0.948103,
-    0.94836, 0.948633, 0.94892, 0.949221, 0.949537, 0.949866,
-    0.950209, 0.950565, 0.950933, 0.951315, 0.951708, 0.952113,
-    0.952529, 0.952956, 0.953393, 0.95384, 0.954295, 0.954759,
-    0.95523, 0.955709, 0.956194, 0.956685, 0.957181, 0.957681,
-    0.958185, 0.958691, 0.9592, 0.959711, 0.960222, 0.960733,
-    0.961244, 0.961753, 0.962259, 0.962763, 0.963263, 0.963758,
-    0.964249, 0.964734, 0.965212, 0.965683, 0.966146, 0.966601,
-    0.967047, 0.967483, 0.967909, 0.968325, 0.968729, 0.969122,
-    0.969502, 0.96987, 0.970225, 0.970567, 0.970895, 0.971209,
-    0.971509, 0.971795, 0.972066, 0.972322, 0.972564, 0.97279,
-    0.973002, 0.973198, 0.97338, 0.973547, 0.973699, 0.973836,
-    0.973959, 0.974067, 0.974162, 0.974242, 0.97431, 0.974364,
-    0.974405, 0.974434, 0.974451, 0.974457, 0.974452, 0.974437,
-    0.974411, 0.974376, 0.974333, 0.974282, 0.974223, 0.974157,
-    0.974085, 0.974008, 0.973925, 0.973839, 0.97375, 0.973657,
-    0.973563, 0.973468, 0.973372, 0.973277, 0.973182, 0.973089,
-    0.972999, 0.972912, 0.972829, 0.97275, 0.972677, 0.97261,
-    0.972549, 0.972496, 0.972451, 0.972414, 0.972386, 0.972368,
-    0.97236, 0.972363, 0.972376, 0.972402, 0.97244, 0.97249,
-    0.972553, 0.972629, 0.972719, 0.972822, 0.97294, 0.973072,
-    0.973218, 0.973379, 0.973554, 0.973744, 0.973948, 0.974168,
-    0.974402, 0.97465, 0.974913, 0.975191, 0.975482, 0.975787,
-    0.976106, 0.976438, 0.976784, 0.977142, 0.977512, 0.977894,
-    0.978288, 0.978692, 0.979107, 0.979532, 0.979966, 0.980409,
-    0.980861, 0.98132, 0.981786, 0.982258, 0.982736, 0.983219,
-    0.983707, 0.984198, 0.984692, 0.985188, 0.985685, 0.986184,
-    0.986682, 0.98718, 0.987676, 0.988171, 0.988662, 0.98915,
-    0.989634, 0.990112, 0.990586, 0.991052, 0.991512, 0.991965,
-    0.992409, 0.992845, 0.993271, 0.993687, 0.994093, 0.994488,
-    0.994872, 0.995243, 0.995603, 0.99595, 0.996284, 0.996604,
-    0.996911, 0.997204, 0.997482, 0.997746, 0.997996, 0.998231,
-    0.998451, 0.998656, 0.998846, 0.999022, 0.999182, 0.999328,
-    0.999458, 0.999574, 0.999676, 0.999763, 0.999836, 0.999896,
-    0.999941, 0.999974, 0.999993, 1, 0.999995, 0.999978,
-    0.999949, 0.99991, 0.99986, 0.999801, 0.999732, 0.999654,
-    0.999568, 0.999474, 0.999372, 0.999265, 0.999151, 0.999032,
-    0.998908, 0.99878, 0.998648, 0.998513, 0.998376, 0.998238,
-    0.998098, 0.997957, 0.997817, 0.997677, 0.997538, 0.997402,
-    0.997267, 0.997136, 0.997008, 0.996883, 0.996763, 0.996648,
-    0.996539, 0.996434, 0.996336, 0.996245, 0.99616, 0.996082,
-    0.996012, 0.995949, 0.995894, 0.995848, 0.995809, 0.995779,
-    0.995758, 0.995745
-};
-
-static const float WAVE_LOGARITHMIC_090[DEFAULT_WAVELEN] = {
-    -1, -0.999929, -0.999716, -0.999361, -0.998864, -0.998225,
-    -0.997445, -0.996524, -0.995462, -0.994259, -0.992916, -0.991433,
-    -0.989811, -0.98805, -0.986151, -0.984114, -0.98194, -0.97963,
-    -0.977185, -0.974604, -0.97189, -0.969042, -0.966063, -0.962952,
-    -0.95971, -0.95634, -0.952841, -0.949216, -0.945464, -0.941587,
-    -0.937588, -0.933465, -0.929222, -0.924859, -0.920378, -0.91578,
-    -0.911067, -0.90624, -0.9013, -0.896249, -0.891089, -0.885821,
-    -0.880447, -0.874969, -0.869388, -0.863706, -0.857924, -0.852045,
-    -0.846071, -0.840002, -0.833842, -0.827591, -0.821252, -0.814827,
-    -0.808317, -0.801725, -0.795052, -0.788302, -0.781474, -0.774573,
-    -0.767599, -0.760555, -0.753443, -0.746265, -0.739023, -0.731719,
-    -0.724355, -0.716935, -0.709459, -0.701929, -0.694349, -0.686721,
-    -0.679045, -0.671326, -0.663564, -0.655762, -0.647923, -0.640048,
-    -0.63214, -0.624201, -0.616233, -0.608239, -0.60022, -0.592179,
-    -0.584118, -0.57604, -0.567946, -0.559838, -0.551719, -0.543592,
-    -0.535457, -0.527318, -0.519176, -0.511034, -0.502893, -0.494757,
-    -0.486626, -0.478503, -0.470391, -0.46229, -0.454204, -0.446133,
-    -0.438081, -0.430049, -0.422039, -0.414054, -0.406094, -0.398161,
-    -0.390259, -0.382388, -0.37455, -0.366748, -0.358982, -0.351255,
-    -0.343569, -0.335924, -0.328323, -0.320768, -0.313259, -0.305799,
-    -0.298389, -0.29103, -0.283725, -0.276474, -0.269279, -0.262141,
-    -0.255062, -0.248043, -0.241085, -0.23419, -0.227359, -0.220592,
-    -0.213891, -0.207258, -0.200693, -0.194197, -0.187772, -0.181418,
-    -0.175136, -0.168927, -0.162792, -0.156732, -0.150747, -0.144839,
-    -0.139008, -0.133255, -0.12758, -0.121984, -0.116467, -0.111031,
-    -0.105675, -0.1004, -0.0952061, -0.0900943, -0.0850646, -0.0801173,
-    -0.0752527, -0.0704709, -0.0657723, -0.0611568, -0.0566247, -0.052176,
-    -0.0478107, -0.0435289, -0.0393306, -0.0352156, -0.0311838, -0.0272351,
-    -0.0233694, -0.0195865, -0.015886, -0.0122677, -0.00873133, -0.00527652,
-    -0.0019029, 0.00138995, 0.00460246, 0.00773511, 0.0107884, 0.0137629,
-    0.0166591, 0.0194776, 0.0222191, 0.0248842, 0.0274736, 0.029988,
-    0.0324281, 0.0347947, 0.0370886, 0.0393106, 0.0414616, 0.0435423,
-    0.0455537, 0.0474968, 0.0493724, 0.0511815, 0.052925, 0.0546041,
-    0.0562196, 0.0577726, 0.0592643, 0.0606956, 0.0620676, 0.0633816,
-    0.0646385, 0.0658396, 0.066986, 0.0680788, 0.0691193, 0.0701086,
-    0.071048, 0.0719387, 0.072782, 0.0735789, 0.0743309, 0.0750392,
-    0.0757051, 0.0763297, 0.0769145, 0.0774607, 0.0779695, 0.0784424,
-    0.0788806, 0.0792853, 0.079658, 0.08, 0.0803124, 0.0805968,
-    0.0808543, 0.0810863, 0.081294, 0.0814789, 0.0816422, 0.0817852,
-    0.0819092, 0.0820155, 0.0821054, 0.0821801, 0.082241, 0.0822894,
-    0.0823264, 0.0823533, 0.0823714, 0.0823819, 0.082386, 0.0823849,
-    0.0823799, 0.0823721, 0.0823627, 0.0823528, 0.0823437, 0.0823364,
-    0.0823321, 0.0823318, 0.0823367, 0.0823478, 0.0823663, 0.082393,
-    0.0824291, 0.0824756, 0.0825334, 0.0826035, 0.0826868, 0.0827844,
-    0.0828971, 0.0830257, 0.0831713, 0.0833345, 0.0835162, 0.0837174,
-    0.0839386, 0.0841807, 0.0844445, 0.0847306, 0.0850398, 0.0853727,
-    0.0857299, 0.0861122, 0.0865201, 0.0869541, 0.0874149, 0.0879029,
-    0.0884187, 0.0889628, 0.0895356, 0.0901375, 0.090769, 0.0914305,
-    0.0921223, 0.0928447, 0.0935981, 0.0943828, 0.0951989, 0.0960468,
-    0.0969267, 0.0978388, 0.0987831, 0.09976, 0.100769, 0.101812,
-    0.102886, 0.103994, 0.105135, 0.106308, 0.107514, 0.108753,
-    0.110024, 0.111329, 0.112665, 0.114034, 0.115435, 0.116868,
-    0.118333, 0.11983, 0.121358, 0.122916, 0.124506, 0.126126,
-    0.127776, 0.129456, 0.131166, 0.132904, 0.134672, 0.136467,
-    0.13829, 0.140141, 0.142018, 0.143922, 0.145851, 0.147806,
-    0.149786, 0.15179, 0.153818, 0.155869, 0.157942, 0.160038,
-    0.162154, 0.164292, 0.166449, 0.168626, 0.170821, 0.173035,
-    0.175266, 0.177514, 0.179777, 0.182056, 0.18435, 0.186657,
-    0.188977, 0.19131, 0.193654, 0.19601, 0.198375, 0.20075,
-    0.203133, 0.205524, 0.207922, 0.210327, 0.212737, 0.215152,
-    0.217571, 0.219993, 0.222417, 0.224843, 0.22727, 0.229697,
-    0.232123, 0.234548, 0.23697, 0.23939, 0.241806, 0.244218,
-    0.246624, 0.249024, 0.251418, 0.253804, 0.256182, 0.258551,
-    0.26091, 0.263259, 0.265597, 0.267923, 0.270237, 0.272538,
-    0.274826, 0.277099, 0.279356, 0.281599, 0.283825, 0.286034,
-    0.288226, 0.290399, 0.292554, 0.29469, 0.296807, 0.298902,
-    0.300978, 0.303032, 0.305064, 0.307074, 0.309061, 0.311025,
-    0.312966, 0.314882, 0.316774, 0.318642, 0.320484, 0.3223,
-    0.324091, 0.325856, 0.327594, 0.329305, 0.330989, 0.332646,
-    0.334276, 0.335877, 0.337451, 0.338996, 0.340514, 0.342002,
-    0.343462, 0.344893, 0.346295, 0.347669, 0.349013, 0.350328,
-    0.351614, 0.352871, 0.354098, 0.355297, 0.356466, 0.357606,
-    0.358717, 0.359799, 0.360853, 0.361877, 0.362873, 0.363841,
-    0.36478, 0.365691, 0.366574, 0.36743, 0.368257, 0.369058,
-    0.369831, 0.370578, 0.371298, 0.371992, 0.37266, 0.373302,
-    0.373919, 0.374511, 0.375079, 0.375622, 0.376142, 0.376638,
-    0.377111, 0.377562, 0.37799, 0.378397, 0.378782, 0.379146,
-    0.379491, 0.379815, 0.38012, 0.380406, 0.380673, 0.380923,
-    0.381156, 0.381371, 0.381571, 0.381754, 0.381923, 0.382076,
-    0.382216, 0.382342, 0.382455, 0.382556, 0.382646, 0.382723,
-    0.382791, 0.382848, 0.382896, 0.382935, 0.382966, 0.382989,
-    0.383005, 0.383015, 0.383019, 0.383018, 0.383012, 0.383002,
-    0.382988, 0.382972, 0.382954, 0.382934, 0.382913, 0.382891,
-    0.38287, 0.382849, 0.38283, 0.382812, 0.382797, 0.382785,
-    0.382777, 0.382773, 0.382773, 0.382779, 0.38279, 0.382808,
-    0.382832, 0.382864, 0.382903, 0.382951, 0.383008, 0.383074,
-    0.38315, 0.383236, 0.383333, 0.383441, 0.383561, 0.383692,
-    0.383837, 0.383993, 0.384164, 0.384347, 0.384545, 0.384757,
-    0.384984, 0.385226, 0.385483, 0.385756, 0.386046, 0.386351,
-    0.386673, 0.387012, 0.387367, 0.387741, 0.388131, 0.38854,
-    0.388967, 0.389411, 0.389874, 0.390356, 0.390856, 0.391376,
-    0.391914, 0.392471, 0.393047, 0.393643, 0.394258, 0.394892,
-    0.395545, 0.396219, 0.396911, 0.397623, 0.398355, 0.399105,
-    0.399876, 0.400665, 0.401474, 0.402302, 0.40315, 0.404016,
-    0.404901, 0.405805, 0.406728, 0.407669, 0.408628, 0.409606,
-    0.410602, 0.411615, 0.412646, 0.413695, 0.41476, 0.415843,
-    0.416942, 0.418057, 0.419189, 0.420336, 0.421499, 0.422677,
-    0.42387, 0.425078, 0.4263, 0.427536, 0.428785, 0.430048,
-    0.431323, 0.432611, 0.433911, 0.435223, 0.436546, 0.43788,
-    0.439225, 0.440579, 0.441943, 0.443317, 0.444699, 0.44609,
-    0.447489, 0.448895, 0.450308, 0.451728, 0.453154, 0.454586,
-    0.456023, 0.457465, 0.458911, 0.460361, 0.461814, 0.46327,
-    0.464729, 0.466189, 0.467651, 0.469114, 0.470577, 0.472041,
-    0.473504, 0.474966, 0.476427, 0.477885, 0.479342, 0.480796,
-    0.482246, 0.483693, 0.485136, 0.486574, 0.488007, 0.489434,
-    0.490855, 0.49227, 0.493678, 0.495079, 0.496472, 0.497857,
-    0.499234, 0.500602, 0.50196, 0.503308, 0.504647, 0.505974,
-    0.507291, 0.508597, 0.509891, 0.511173, 0.512443, 0.5137,
-    0.514945, 0.516176, 0.517393, 0.518596, 0.519786, 0.52096,
-    0.52212, 0.523265, 0.524395, 0.525509, 0.526608, 0.52769,
-    0.528756, 0.529806, 0.530839, 0.531856, 0.532855, 0.533838,
-    0.534803, 0.53575, 0.53668, 0.537593, 0.538487, 0.539364,
-    0.540223, 0.541064, 0.541886, 0.542691, 0.543477, 0.544245,
-    0.544995, 0.545726, 0.546439, 0.547134, 0.547811, 0.548469,
-    0.54911, 0.549732, 0.550336, 0.550922, 0.55149, 0.552041,
-    0.552573, 0.553089, 0.553586, 0.554067, 0.55453, 0.554976,
-    0.555406, 0.555819, 0.556215, 0.556595, 0.556959, 0.557307,
-    0.55764, 0.557957, 0.558259, 0.558546, 0.558819, 0.559077,
-    0.559321, 0.559551, 0.559768, 0.559971, 0.560162, 0.56034,
-    0.560505, 0.560659, 0.560801, 0.560931, 0.561051, 0.56116,
-    0.561259, 0.561347, 0.561427, 0.561497, 0.561558, 0.56161,
-    0.561655, 0.561692, 0.561722, 0.561744, 0.561761, 0.561771,
-    0.561775, 0.561774, 0.561768, 0.561758, 0.561743, 0.561725,
-    0.561704, 0.561679, 0.561652, 0.561623, 0.561592, 0.56156,
-    0.561527, 0.561494, 0.56146, 0.561427, 0.561395, 0.561364,
-    0.561334, 0.561306, 0.561281, 0.561258, 0.561238, 0.561222,
-    0.56121, 0.561202, 0.561198, 0.561199, 0.561206, 0.561219,
-    0.561237, 0.561262, 0.561294, 0.561332, 0.561378, 0.561432,
-    0.561494, 0.561564, 0.561643, 0.56173, 0.561827, 0.561934,
-    0.56205, 0.562176, 0.562313, 0.56246, 0.562618, 0.562787,
-    0.562968, 0.56316, 0.563364, 0.563579, 0.563807, 0.564047,
-    0.5643, 0.564566, 0.564844, 0.565135, 0.56544, 0.565757,
-    0.566088, 0.566433, 0.566791, 0.567164, 0.567549, 0.567949,
-    0.568363, 0.568791, 0.569233, 0.569689, 0.570159, 0.570644,
-    0.571142, 0.571655, 0.572182, 0.572723, 0.573279, 0.573848,
-    0.574432, 0.57503, 0.575641, 0.576267, 0.576906, 0.57756,
-    0.578226, 0.578907, 0.5796, 0.580307, 0.581027, 0.581761,
-    0.582507, 0.583265, 0.584037, 0.58482, 0.585616, 0.586424,
-    0.587244, 0.588075, 0.588918, 0.589771, 0.590636, 0.591512,
-    0.592398, 0.593294, 0.5942, 0.595116, 0.596041, 0.596975,
-    0.597918, 0.59887, 0.59983, 0.600799, 0.601775, 0.602758,
-    0.603749, 0.604746, 0.60575, 0.60676, 0.607775, 0.608797,
-    0.609823, 0.610855, 0.611891, 0.612931, 0.613975, 0.615022,
-    0.616073, 0.617126, 0.618182, 0.61924, 0.6203, 0.621361,
-    0.622424, 0.623487, 0.62455, 0.625613, 0.626676, 0.627739,
-    0.6288, 0.62986, 0.630918, 0.631974, 0.633028, 0.634079,
-    0.635126, 0.636171, 0.637211, 0.638248, 0.639279, 0.640307,
-    0.641329, 0.642345, 0.643356, 0.644361, 0.645359, 0.646351,
-    0.647336, 0.648313, 0.649283, 0.650245, 0.651199, 0.652145,
-    0.653081, 0.654009, 0.654928, 0.655837, 0.656737, 0.657627,
-    0.658506, 0.659375, 0.660233, 0.661081, 0.661918, 0.662743,
-    0.663557, 0.664359, 0.66515, 0.665928, 0.666695, 0.667449,
-    0.66819, 0.668919, 0.669636, 0.670339, 0.67103, 0.671708,
-    0.672372, 0.673023, 0.673661, 0.674285, 0.674896, 0.675494,
-    0.676078, 0.676648, 0.677205, 0.677748, 0.678277, 0.678793,
-    0.679294, 0.679783, 0.680257, 0.680718, 0.681165, 0.681599,
-    0.682019, 0.682426, 0.682819, 0.683199, 0.683566, 0.68392,
-    0.684261, 0.684588, 0.684903, 0.685205, 0.685495, 0.685772,
-    0.686037, 0.68629, 0.68653, 0.686759, 0.686977, 0.687183,
-    0.687377, 0.687561, 0.687733, 0.687895, 0.688047, 0.688188,
-    0.688319, 0.68844, 0.688552, 0.688655, 0.688748, 0.688833,
-    0.688909, 0.688976, 0.689036, 0.689088, 0.689132, 0.68917,
-    0.6892, 0.689223, 0.68924, 0.689252, 0.689257, 0.689257,
-    0.689251, 0.689241, 0.689226, 0.689207, 0.689184, 0.689157,
-    0.689127, 0.689094, 0.689058, 0.689019, 0.688979, 0.688937,
-    0.688893, 0.688848, 0.688803, 0.688757, 0.68871, 0.688664,
-    0.688618, 0.688574, 0.68853, 0.688487, 0.688446, 0.688407,
-    0.688371, 0.688337, 0.688306, 0.688278, 0.688254, 0.688233,
-    0.688217, 0.688204, 0.688197, 0.688194, 0.688197, 0.688205,
-    0.688219, 0.688239, 0.688265, 0.688297, 0.688337, 0.688383,
-    0.688437, 0.688498, 0.688567, 0.688643, 0.688728, 0.688821,
-    0.688923, 0.689033, 0.689153, 0.689281, 0.689419, 0.689567,
-    0.689724, 0.68989, 0.690067, 0.690254, 0.690451, 0.690659,
-    0.690877, 0.691105, 0.691345, 0.691595, 0.691856, 0.692128,
-    0.692412, 0.692706, 0.693012, 0.693329, 0.693657, 0.693997,
-    0.694349, 0.694711, 0.695086, 0.695471, 0.695869, 0.696277,
-    0.696698, 0.69713, 0.697573, 0.698027, 0.698494, 0.698971,
-    0.69946, 0.69996, 0.700471, 0.700993, 0.701526, 0.702071,
-    0.702626, 0.703191, 0.703768, 0.704354, 0.704951, 0.705559,
-    0.706176, 0.706804, 0.707441, 0.708088, 0.708744, 0.70941,
-    0.710085, 0.710769, 0.711461, 0.712162, 0.712872, 0.713589,
-    0.714315, 0.715048, 0.715789, 0.716538, 0.717293, 0.718055,
-    0.718824, 0.719599, 0.72038, 0.721168, 0.72196, 0.722759,
-    0.723562, 0.72437, 0.725183, 0.726, 0.726821, 0.727646,
-    0.728475, 0.729307, 0.730141, 0.730979, 0.731818, 0.73266,
-    0.733504, 0.734349, 0.735196, 0.736043, 0.736891, 0.73774,
-    0.738589, 0.739437, 0.740285, 0.741132, 0.741979, 0.742824,
-    0.743667, 0.744508, 0.745347, 0.746184, 0.747018, 0.747849,
-    0.748677, 0.749501, 0.750322, 0.751138, 0.75195, 0.752757,
-    0.753559, 0.754357, 0.755148, 0.755935, 0.756715, 0.757489,
-    0.758257, 0.759018, 0.759773, 0.76052, 0.76126, 0.761993,
-    0.762718, 0.763435, 0.764144, 0.764844, 0.765536, 0.76622,
-    0.766895, 0.76756, 0.768217, 0.768864, 0.769501, 0.770129,
-    0.770747, 0.771355, 0.771953, 0.772541, 0.773119, 0.773686,
-    0.774243, 0.774789, 0.775324, 0.775849, 0.776362, 0.776865,
-    0.777357, 0.777837, 0.778307, 0.778765, 0.779212, 0.779648,
-    0.780072, 0.780486, 0.780888, 0.781279, 0.781658, 0.782026,
-    0.782383, 0.782729, 0.783063, 0.783387, 0.783699, 0.784,
-    0.78429, 0.78457, 0.784838, 0.785096, 0.785343, 0.785579,
-    0.785805, 0.78602, 0.786226, 0.786421, 0.786606, 0.786781,
-    0.786946, 0.787102, 0.787248, 0.787385, 0.787513, 0.787631,
-    0.787741, 0.787843, 0.787935, 0.78802, 0.788096, 0.788165,
-    0.788226, 0.788279, 0.788325, 0.788364, 0.788396, 0.788421,
-    0.78844, 0.788453, 0.78846, 0.788461, 0.788457, 0.788447,
-    0.788433, 0.788414, 0.78839, 0.788362, 0.78833, 0.788294,
-    0.788255, 0.788212, 0.788167, 0.788118, 0.788068, 0.788015,
-    0.78796, 0.787904, 0.787846, 0.787788, 0.787728, 0.787668,
-    0.787607, 0.787547, 0.787486, 0.787427, 0.787368, 0.78731,
-    0.787253, 0.787198, 0.787145, 0.787093, 0.787044, 0.786998,
-    0.786955, 0.786914, 0.786877, 0.786844, 0.786814, 0.786789,
-    0.786767, 0.786751, 0.786739, 0.786732, 0.78673, 0.786734,
-    0.786743, 0.786759, 0.78678, 0.786808, 0.786842, 0.786883,
-    0.78693, 0.786985, 0.787047, 0.787117, 0.787194, 0.787278,
-    0.787371, 0.787472, 0.787581, 0.787698, 0.787824, 0.787958,
-    0.788101, 0.788253, 0.788414, 0.788584, 0.788764, 0.788952,
-    0.78915, 0.789358, 0.789575, 0.789801, 0.790038, 0.790284,
-    0.79054, 0.790805, 0.791081, 0.791366, 0.791662, 0.791967,
-    0.792283, 0.792608, 0.792943, 0.793289, 0.793644, 0.794009,
-    0.794384, 0.794769, 0.795164, 0.795569, 0.795983, 0.796407,
-    0.796841, 0.797284, 0.797737, 0.798199, 0.798671, 0.799152,
-    0.799641, 0.80014, 0.800648, 0.801165, 0.80169, 0.802224,
-    0.802766, 0.803316, 0.803874, 0.804441, 0.805015, 0.805597,
-    0.806186, 0.806783, 0.807387, 0.807998, 0.808615, 0.809239,
-    0.80987, 0.810506, 0.811149, 0.811797, 0.812452, 0.813111,
-    0.813776, 0.814445, 0.815119, 0.815798, 0.816481, 0.817168,
-    0.817859, 0.818553, 0.819251, 0.819952, 0.820656, 0.821362,
-    0.822071, 0.822781, 0.823494, 0.824208, 0.824924, 0.825641,
-    0.826359, 0.827077, 0.827796, 0.828515, 0.829233, 0.829952,
-    0.83067, 0.831387, 0.832102, 0.832817, 0.83353, 0.834241,
-    0.834949, 0.835656, 0.83636, 0.837061, 0.837759, 0.838454,
-    0.839145, 0.839832, 0.840516, 0.841195, 0.841869, 0.842539,
-    0.843205, 0.843865, 0.844519, 0.845168, 0.845812, 0.846449,
-    0.847081, 0.847706, 0.848324, 0.848936, 0.849541, 0.850139,
-    0.850729, 0.851312, 0.851888, 0.852456, 0.853016, 0.853568,
-    0.854112, 0.854647, 0.855174, 0.855693, 0.856202, 0.856703,
-    0.857195, 0.857678, 0.858152, 0.858617, 0.859072, 0.859518,
-    0.859955, 0.860382, 0.860799, 0.861207, 0.861605, 0.861993,
-    0.862372, 0.86274, 0.863099, 0.863448, 0.863787, 0.864116,
-    0.864435, 0.864744, 0.865044, 0.865333, 0.865613, 0.865882,
-    0.866142, 0.866393, 0.866633, 0.866864, 0.867085, 0.867297,
-    0.867499, 0.867692, 0.867875, 0.868049, 0.868214, 0.86837,
-    0.868517, 0.868656, 0.868785, 0.868906, 0.869019, 0.869123,
-    0.869219, 0.869306, 0.869386, 0.869459, 0.869523, 0.86958,
-    0.86963, 0.869673, 0.869708, 0.869737, 0.86976, 0.869775,
-    0.869785, 0.869789, 0.869787, 0.869779, 0.869766, 0.869747,
-    0.869724, 0.869695, 0.869662, 0.869625, 0.869584, 0.869538,
-    0.869489, 0.869436, 0.869381, 0.869322, 0.86926, 0.869196,
-    0.869129, 0.86906, 0.86899, 0.868918, 0.868844, 0.868769,
-    0.868694, 0.868617, 0.868541, 0.868464, 0.868387, 0.86831,
-    0.868234, 0.868159, 0.868084, 0.868011, 0.86794, 0.86787,
-    0.867802, 0.867736, 0.867673, 0.867612, 0.867554, 0.867499,
-    0.867447, 0.867399, 0.867355, 0.867314, 0.867278, 0.867246,
-    0.867219, 0.867196, 0.867179, 0.867166, 0.867159, 0.867158,
-    0.867162, 0.867172, 0.867188, 0.86721, 0.867239, 0.867274,
-    0.867316, 0.867365, 0.867421, 0.867485, 0.867555, 0.867633,
-    0.867719, 0.867812, 0.867914, 0.868023, 0.86814, 0.868265,
-    0.868399, 0.868541, 0.868692, 0.868851, 0.869018, 0.869195,
-    0.86938, 0.869574, 0.869776, 0.869988, 0.870209, 0.870438,
-    0.870677, 0.870925, 0.871182, 0.871447, 0.871722, 0.872006,
-    0.8723, 0.872602, 0.872913, 0.873234, 0.873563, 0.873901,
-    0.874249, 0.874605, 0.87497, 0.875344, 0.875726, 0.876118,
-    0.876518, 0.876926, 0.877343, 0.877768, 0.878201, 0.878643,
-    0.879092, 0.87955, 0.880015, 0.880488, 0.880969, 0.881457,
-    0.881952, 0.882454, 0.882964, 0.88348, 0.884003, 0.884533,
-    0.885069, 0.885611, 0.886159, 0.886713, 0.887273, 0.887838,
-    0.888409, 0.888985, 0.889566, 0.890151, 0.890741, 0.891336,
-    0.891935, 0.892537, 0.893144, 0.893754, 0.894367, 0.894983,
-    0.895602, 0.896224, 0.896849, 0.897475, 0.898104, 0.898734,
-    0.899366, 0.9, 0.900634, 0.901269, 0.901905, 0.902542,
-    0.903178, 0.903815, 0.904451, 0.905087, 0.905722, 0.906356,
-    0.906989, 0.90762, 0.90825, 0.908878, 0.909504, 0.910127,
-    0.910748, 0.911367, 0.911982, 0.912594, 0.913203, 0.913808,
-    0.914409, 0.915007, 0.9156, 0.916188, 0.916772, 0.917351,
-    0.917926, 0.918494, 0.919058, 0.919616, 0.920168, 0.920714,
-    0.921254, 0.921788, 0.922316, 0.922837, 0.923351, 0.923858,
-    0.924358, 0.924851, 0.925336, 0.925814, 0.926285, 0.926748,
-    0.927203, 0.927649, 0.928088, 0.928519, 0.928941, 0.929356,
-    0.929761, 0.930158, 0.930547, 0.930926, 0.931297, 0.931659,
-    0.932013, 0.932357, 0.932692, 0.933019, 0.933336, 0.933644,
-    0.933943, 0.934233, 0.934514, 0.934786, 0.935048, 0.935302,
-    0.935546, 0.935781, 0.936007, 0.936224, 0.936432, 0.936631,
-    0.936822, 0.937003, 0.937175, 0.937339, 0.937494, 0.93764,
-    0.937778, 0.937907, 0.938028, 0.93814, 0.938245, 0.938341,
-    0.938429, 0.93851, 0.938582, 0.938647, 0.938705, 0.938755,
-    0.938798, 0.938834, 0.938863, 0.938885, 0.9389, 0.938909,
-    0.938912, 0.938908, 0.938899, 0.938883, 0.938862, 0.938836,
-    0.938804, 0.938767, 0.938725, 0.938679, 0.938628, 0.938573,
-    0.938513, 0.93845, 0.938383, 0.938312, 0.938238, 0.938161,
-    0.938081, 0.937999, 0.937914, 0.937827, 0.937737, 0.937646,
-    0.937554, 0.93746, 0.937365, 0.937269, 0.937172, 0.937075,
-    0.936978, 0.93688, 0.936783, 0.936686, 0.93659, 0.936495,
-    0.936401, 0.936308, 0.936217, 0.936127, 0.93604, 0.935954,
-    0.935871, 0.935791, 0.935713, 0.935639, 0.935567, 0.935499,
-    0.935435, 0.935375, 0.935318, 0.935266, 0.935218, 0.935175,
-    0.935137, 0.935103, 0.935075, 0.935052, 0.935035, 0.935023,
-    0.935017, 0.935017, 0.935023, 0.935036, 0.935055, 0.93508,
-    0.935112, 0.935152, 0.935198, 0.935251, 0.935311, 0.935379,
-    0.935455, 0.935537, 0.935628, 0.935726, 0.935833, 0.935947,
-    0.936069, 0.936199, 0.936338, 0.936485, 0.93664, 0.936803,
-    0.936975, 0.937156, 0.937345, 0.937542, 0.937748, 0.937963,
-    0.938187, 0.938419, 0.938659, 0.938908, 0.939166, 0.939433,
-    0.939708, 0.939992, 0.940284, 0.940585, 0.940895, 0.941213,
-    0.941539, 0.941874, 0.942217, 0.942568, 0.942927, 0.943295,
-    0.943671, 0.944054, 0.944445, 0.944845, 0.945251, 0.945666,
-    0.946088, 0.946517, 0.946953, 0.947397, 0.947847, 0.948305,
-    0.948769, 0.94924, 0.949717, 0.9502, 0.95069, 0.951185,
-    0.951687, 0.952194, 0.952706, 0.953224, 0.953747, 0.954275,
-    0.954808, 0.955345, 0.955887, 0.956433, 0.956983, 0.957537,
-    0.958094, 0.958656, 0.95922, 0.959787, 0.960358, 0.960931,
-    0.961506, 0.962084, 0.962663, 0.963245, 0.963828, 0.964413,
-    0.964998, 0.965585, 0.966172, 0.96676, 0.967349, 0.967937,
-    0.968525, 0.969113, 0.969701, 0.970287, 0.970873, 0.971458,
-    0.972041, 0.972622, 0.973202, 0.973779, 0.974355, 0.974928,
-    0.975498, 0.976065, 0.97663, 0.977191, 0.977748, 0.978302,
-    0.978852, 0.979398, 0.97994, 0.980477, 0.981009, 0.981537,
-    0.98206, 0.982578, 0.98309, 0.983597, 0.984098, 0.984593,
-    0.985082, 0.985566, 0.986042, 0.986513, 0.986976, 0.987433,
-    0.987884, 0.988327, 0.988763, 0.989191, 0.989613, 0.990026,
-    0.990433, 0.990831, 0.991222, 0.991604, 0.991979, 0.992346,
-    0.992704, 0.993054, 0.993396, 0.993729, 0.994054, 0.994371,
-    0.994678, 0.994978, 0.995268, 0.99555, 0.995823, 0.996087,
-    0.996343, 0.996589, 0.996827, 0.997056, 0.997276, 0.997487,
-    0.99769, 0.997883, 0.998068, 0.998244, 0.998411, 0.99857,
-    0.99872, 0.998861, 0.998993, 0.999117, 0.999233, 0.99934,
-    0.999439, 0.999529, 0.999611, 0.999685, 0.999751, 0.999809,
-    0.999859, 0.999902, 0.999936, 0.999963, 0.999983, 0.999995,
-    1, 0.999998, 0.999989, 0.999973, 0.99995, 0.99992,
-    0.999884, 0.999842, 0.999794, 0.999739, 0.999679, 0.999613,
-    0.999541, 0.999464, 0.999381, 0.999294, 0.999201, 0.999104,
-    0.999002, 0.998895, 0.998785, 0.99867, 0.998551, 0.998429,
-    0.998303, 0.998173, 0.998041, 0.997905, 0.997767, 0.997625,
-    0.997482, 0.997336, 0.997187, 0.997037, 0.996885, 0.996732,
-    0.996577, 0.996421, 0.996264, 0.996106, 0.995947, 0.995788,
-    0.995629, 0.995469, 0.995309, 0.99515, 0.994991, 0.994833,
-    0.994675, 0.994518, 0.994362, 0.994208, 0.994054, 0.993903,
-    0.993753, 0.993605, 0.993458, 0.993315, 0.993173, 0.993034,
-    0.992897, 0.992763, 0.992632, 0.992504, 0.992379, 0.992257,
-    0.992138, 0.992023, 0.991912, 0.991804, 0.9917, 0.9916,
-    0.991504, 0.991412, 0.991325, 0.991241, 0.991162, 0.991087,
-    0.991017, 0.990951, 0.99089, 0.990833, 0.990782, 0.990735,
-    0.990693, 0.990655, 0.990623, 0.990595, 0.990573, 0.990555,
-    0.990543, 0.990535
-};
-
-static const float WAVE_LOGARITHMIC_102[DEFAULT_WAVELEN] = {
-    -1, -0.999978, -0.999911, -0.9998, -0.999645, -0.999446,
-    -0.999202, -0.998914, -0.998582, -0.998205, -0.997784, -0.99732,
-    -0.996811, -0.996257, -0.99566, -0.995019, -0.994334, -0.993605,
-    -0.992833, -0.992016, -0.991156, -0.990253, -0.989306, -0.988315,
-    -0.987281, -0.986204, -0.985083, -0.98392, -0.982713, -0.981464,
-    -0.980172, -0.978837, -0.977459, -0.976039, -0.974577, -0.973073,
-    -0.971526, -0.969938, -0.968308, -0.966636, -0.964922, -0.963167,
-    -0.961371, -0.959534, -0.957656, -0.955737, -0.953777, -0.951777,
-    -0.949737, -0.947656, -0.945536, -0.943376, -0.941176, -0.938937,
-    -0.936658, -0.934341, -0.931984, -0.929589, -0.927156, -0.924684,
-    -0.922174, -0.919627, -0.917042, -0.914419, -0.911759, -0.909062,
-    -0.906329, -0.903559, -0.900752, -0.89791, -0.895032, -0.892118,
-    -0.889169, -0.886184, -0.883165, -0.880111, -0.877023, -0.873901,
-    -0.870744, -0.867555, -0.864332, -0.861075, -0.857786, -0.854465,
-    -0.851111, -0.847725, -0.844307, -0.840858, -0.837378, -0.833867,
-    -0.830326, -0.826754, -0.823152, -0.81952, -0.815859, -0.812168,
-    -0.808449, -0.804701, -0.800925, -0.797122, -0.79329, -0.789431,
-    -0.785545, -0.781633, -0.777694, -0.773729, -0.769738, -0.765722,
-    -0.76168, -0.757614, -0.753523, -0.749408, -0.74527, -0.741108,
-    -0.736922, -0.732714, -0.728483, -0.72423, -0.719956, -0.715659,
-    -0.711342, -0.707004, -0.702645, -0.698266, -0.693867, -0.689449,
-    -0.685011, -0.680555, -0.676081, -0.671588, -0.667078, -0.66255,
-    -0.658005, -0.653443, -0.648865, -0.644271, -0.639662, -0.635037,
-    -0.630397, -0.625742, -0.621074, -0.616391, -0.611695, -0.606986,
-    -0.602263, -0.597529, -0.592782, -0.588024, -0.583254, -0.578473,
-    -0.573681, -0.568879, -0.564067, -0.559246, -0.554415, -0.549575,
-    -0.544727, -0.539871, -0.535006, -0.530134, -0.525256, -0.52037,
-    -0.515478, -0.51058, -0.505676, -0.500766, -0.495852, -0.490933,
-    -0.48601, -0.481083, -0.476152, -0.471218, -0.466281, -0.461342,
-    -0.4564, -0.451456, -0.446511, -0.441565, -0.436618, -0.431671,
-    -0.426723, -0.421775, -0.416828, -0.411882, -0.406938, -0.401994,
-    -0.397053, -0.392114, -0.387177, -0.382244, -0.377313, -0.372386,
-    -0.367463, -0.362545, -0.35763, -0.352721, -0.347817, -0.342918,
-    -0.338025, -0.333139, -0.328258, -0.323385, -0.318518, -0.313659,
-    -0.308808, -0.303965, -0.299129, -0.294303, -0.289486, -0.284677,
-    -0.279879, -0.27509, -0.270311, -0.265542, -0.260784, -0.256038,
-    -0.251302, -0.246578, -0.241866, -0.237166, -0.232478, -0.227803,
-    -0.223141, -0.218492, -0.213857, -0.209235, -0.204627, -0.200034,
-    -0.195455, -0.190891, -0.186342, -0.181808, -0.17729, -0.172787,
-    -0.168301, -0.16383, -0.159377, -0.15494, -0.15052, -0.146117,
-    -0.141731, -0.137363, -0.133013, -0.128682, -0.124368, -0.120073,
-    -0.115797, -0.11154, -0.107302, -0.103083, -0.0988835, -0.0947041,
-    -0.0905446, -0.0864052, -0.0822862, -0.0781877, -0.0741099, -0.070053,
-    -0.0660172, -0.0620026, -0.0580094, -0.0540379, -0.050088, -0.0461601,
-    -0.0422542, -0.0383706, -0.0345094, -0.0306707, -0.0268547, -0.0230615,
-    -0.0192913, -0.0155442, -0.0118204, -0.00811989, -0.00444293, -0.000789614,
-    0.00283994, 0.00644561, 0.0100273, 0.0135848, 0.0171182, 0.0206272,
-    0.0241117, 0.0275717, 0.0310071, 0.0344177, 0.0378035, 0.0411644,
-    0.0445002, 0.047811, 0.0510966, 0.054357, 0.057592, 0.0608016,
-    0.0639858, 0.0671444, 0.0702775, 0.0733849, 0.0764666, 0.0795225,
-    0.0825527, 0.0855569, 0.0885353, 0.0914878, 0.0944143, 0.0973147,
-    0.100189, 0.103038, 0.10586, 0.108656, 0.111426, 0.11417,
-    0.116888, 0.119579, 0.122245, 0.124884, 0.127497, 0.130084,
-    0.132644, 0.135179, 0.137687, 0.140169, 0.142626, 0.145056,
-    0.14746, 0.149837, 0.152189, 0.154515, 0.156815, 0.159089,
-    0.161337, 0.163559, 0.165756, 0.167927, 0.170072, 0.172191,
-    0.174285, 0.176353, 0.178396, 0.180414, 0.182406, 0.184373,
-    0.186314, 0.188231, 0.190122, 0.191989, 0.193831, 0.195648,
-    0.19744, 0.199208, 0.200951, 0.20267, 0.204364, 0.206034,
-    0.207681, 0.209303, 0.210901, 0.212475, 0.214026, 0.215554,
-    0.217057, 0.218538, 0.219995, 0.221429, 0.222841, 0.224229,
-    0.225595, 0.226938, 0.228259, 0.229557, 0.230834, 0.232088,
-    0.23332, 0.234531, 0.23572, 0.236888, 0.238035, 0.23916,
-    0.240264, 0.241348, 0.242411, 0.243453, 0.244475, 0.245477,
-    0.246459, 0.247421, 0.248364, 0.249287, 0.25019, 0.251075,
-    0.25194, 0.252787, 0.253615, 0.254424, 0.255216, 0.255989,
-    0.256744, 0.257482, 0.258202, 0.258904, 0.25959, 0.260258,
-    0.26091, 0.261545, 0.262164, 0.262766, 0.263353, 0.263924,
-    0.264479, 0.265018, 0.265543, 0.266052, 0.266547, 0.267027,
-    0.267492, 0.267943, 0.268381, 0.268804, 0.269214, 0.269611,
-    0.269994, 0.270364, 0.270722, 0.271066, 0.271399, 0.271719,
-    0.272028, 0.272325, 0.27261, 0.272884, 0.273146, 0.273398,
-    0.273639, 0.27387, 0.274091, 0.274301, 0.274502, 0.274693,
-    0.274874, 0.275046, 0.27521, 0.275364, 0.27551, 0.275648,
-    0.275778, 0.275899, 0.276013, 0.27612, 0.276219, 0.276311,
-    0.276396, 0.276475, 0.276547, 0.276613, 0.276673, 0.276727,
-    0.276776, 0.276819, 0.276857, 0.27689, 0.276919, 0.276942,
-    0.276962, 0.276977, 0.276989, 0.276996, 0.277, 0.277001,
-    0.276999, 0.276994, 0.276986, 0.276975, 0.276963, 0.276948,
-    0.276931, 0.276913, 0.276893, 0.276871, 0.276849, 0.276826,
-    0.276802, 0.276777, 0.276752, 0.276727, 0.276702, 0.276677,
-    0.276652, 0.276628, 0.276605, 0.276583, 0.276562, 0.276542,
-    0.276524, 0.276507, 0.276492, 0.27648, 0.276469, 0.276461,
-    0.276455, 0.276452, 0.276452, 0.276455, 0.276461, 0.27647,
-    0.276483, 0.2765, 0.276521, 0.276545, 0.276574, 0.276607,
-    0.276644, 0.276686, 0.276733, 0.276785, 0.276841, 0.276903,
-    0.276971, 0.277044, 0.277122, 0.277206, 0.277296, 0.277392,
-    0.277495, 0.277603, 0.277718, 0.27784, 0.277968, 0.278103,
-    0.278245, 0.278393, 0.278549, 0.278713, 0.278884, 0.279062,
-    0.279248, 0.279441, 0.279642, 0.279852, 0.280069, 0.280294,
-    0.280528, 0.28077, 0.28102, 0.281279, 0.281546, 0.281822,
-    0.282107, 0.282401, 0.282703, 0.283015, 0.283336, 0.283666,
-    0.284005, 0.284353, 0.284711, 0.285078, 0.285455, 0.285841,
-    0.286237, 0.286643, 0.287059, 0.287484, 0.287919, 0.288364,
-    0.288819, 0.289284, 0.289759, 0.290244, 0.290739, 0.291245,
-    0.291761, 0.292287, 0.292823, 0.293369, 0.293926, 0.294494,
-    0.295071, 0.295659, 0.296258, 0.296867, 0.297486, 0.298116,
-    0.298757, 0.299408, 0.300069, 0.300742, 0.301424, 0.302117,
-    0.302821, 0.303535, 0.30426, 0.304995, 0.305741, 0.306497,
-    0.307264, 0.308041, 0.308829, 0.309627, 0.310436, 0.311255,
-    0.312084, 0.312924, 0.313774, 0.314635, 0.315505, 0.316386,
-    0.317278, 0.318179, 0.319091, 0.320012, 0.320944, 0.321886,
-    0.322838, 0.323799, 0.324771, 0.325752, 0.326743, 0.327744,
-    0.328755, 0.329775, 0.330805, 0.331844, 0.332893, 0.333951,
-    0.335019, 0.336096, 0.337181, 0.338277, 0.339381, 0.340494,
-    0.341616, 0.342747, 0.343886, 0.345034, 0.346191, 0.347357,
-    0.34853, 0.349713, 0.350903, 0.352102, 0.353308, 0.354523,
-    0.355746, 0.356976, 0.358214, 0.35946, 0.360714, 0.361974,
-    0.363243, 0.364518, 0.365801, 0.36709, 0.368387, 0.369691,
-    0.371001, 0.372318, 0.373641, 0.374971, 0.376307, 0.37765,
-    0.378998, 0.380353, 0.381713, 0.383079, 0.384451, 0.385829,
-    0.387212, 0.3886, 0.389993, 0.391392, 0.392795, 0.394204,
-    0.395617, 0.397034, 0.398457, 0.399883, 0.401314, 0.402749,
-    0.404188, 0.405631, 0.407078, 0.408528, 0.409982, 0.411439,
-    0.4129, 0.414363, 0.41583, 0.417299, 0.418772, 0.420247,
-    0.421724, 0.423204, 0.424686, 0.42617, 0.427657, 0.429145,
-    0.430635, 0.432126, 0.433619, 0.435114, 0.436609, 0.438106,
-    0.439604, 0.441102, 0.442601, 0.444101, 0.445602, 0.447102,
-    0.448603, 0.450104, 0.451605, 0.453105, 0.454606, 0.456106,
-    0.457605, 0.459104, 0.460602, 0.462099, 0.463594, 0.465089,
-    0.466582, 0.468074, 0.469565, 0.471053, 0.47254, 0.474025,
-    0.475507, 0.476988, 0.478466, 0.479942, 0.481415, 0.482886,
-    0.484354, 0.485819, 0.48728, 0.488739, 0.490194, 0.491646,
-    0.493095, 0.49454, 0.495981, 0.497418, 0.498851, 0.500281,
-    0.501706, 0.503126, 0.504543, 0.505955, 0.507362, 0.508764,
-    0.510162, 0.511554, 0.512942, 0.514325, 0.515702, 0.517073,
-    0.51844, 0.519801, 0.521156, 0.522505, 0.523848, 0.525186,
-    0.526517, 0.527843, 0.529162, 0.530475, 0.531781, 0.533081,
-    0.534374, 0.53566, 0.53694, 0.538213, 0.539479, 0.540738,
-    0.54199, 0.543234, 0.544471, 0.545701, 0.546924, 0.548139,
-    0.549347, 0.550546, 0.551738, 0.552923, 0.554099, 0.555268,
-    0.556428, 0.557581, 0.558725, 0.559861, 0.560989, 0.562109,
-    0.56322, 0.564323, 0.565417, 0.566503, 0.56758, 0.568649,
-    0.569709, 0.57076, 0.571803, 0.572836, 0.573861, 0.574877,
-    0.575884, 0.576881, 0.57787, 0.57885, 0.579821, 0.580782,
-    0.581734, 0.582677, 0.583611, 0.584536, 0.585451, 0.586357,
-    0.587254, 0.588141, 0.589019, 0.589888, 0.590747, 0.591596,
-    0.592436, 0.593267, 0.594088, 0.5949, 0.595702, 0.596495,
-    0.597278, 0.598052, 0.598816, 0.59957, 0.600315, 0.601051,
-    0.601777, 0.602493, 0.6032, 0.603898, 0.604586, 0.605264,
-    0.605933, 0.606592, 0.607242, 0.607883, 0.608514, 0.609136,
-    0.609748, 0.610351, 0.610945, 0.611529, 0.612104, 0.612669,
-    0.613226, 0.613773, 0.614311, 0.61484, 0.61536, 0.61587,
-    0.616372, 0.616864, 0.617348, 0.617822, 0.618288, 0.618745,
-    0.619193, 0.619632, 0.620063, 0.620484, 0.620898, 0.621302,
-    0.621698, 0.622086, 0.622465, 0.622836, 0.623198, 0.623552,
-    0.623898, 0.624236, 0.624566, 0.624887, 0.625201, 0.625507,
-    0.625805, 0.626095, 0.626378, 0.626652, 0.62692, 0.627179,
-    0.627432, 0.627677, 0.627914, 0.628145, 0.628368, 0.628584,
-    0.628794, 0.628996, 0.629191, 0.62938, 0.629562, 0.629738,
-    0.629907, 0.630069, 0.630225, 0.630375, 0.630519, 0.630656,
-    0.630788, 0.630913, 0.631033, 0.631147, 0.631256, 0.631358,
-    0.631456, 0.631548, 0.631634, 0.631716, 0.631792, 0.631863,
-    0.631929, 0.631991, 0.632048, 0.6321, 0.632147, 0.63219,
-    0.632229, 0.632263, 0.632294, 0.63232, 0.632342, 0.63236,
-    0.632375, 0.632386, 0.632393, 0.632397, 0.632398, 0.632395,
-    0.632389, 0.63238, 0.632368, 0.632353, 0.632335, 0.632315,
-    0.632292, 0.632267, 0.632239, 0.632209, 0.632177, 0.632143,
-    0.632107, 0.632069, 0.632029, 0.631988, 0.631945, 0.631901,
-    0.631855, 0.631808, 0.631761, 0.631712, 0.631662, 0.631611,
-    0.63156, 0.631507, 0.631455, 0.631402, 0.631349, 0.631295,
-    0.631242, 0.631188, 0.631135, 0.631081, 0.631028, 0.630976,
-    0.630923, 0.630872, 0.630821, 0.630771, 0.630722, 0.630674,
-    0.630627, 0.630581, 0.630536, 0.630493, 0.630451, 0.630411,
-    0.630372, 0.630335, 0.6303, 0.630267, 0.630236, 0.630207,
-    0.630181, 0.630156, 0.630134, 0.630115, 0.630098, 0.630084,
-    0.630072, 0.630063, 0.630057, 0.630055, 0.630055, 0.630058,
-    0.630065, 0.630075, 0.630088, 0.630105, 0.630126, 0.63015,
-    0.630178, 0.630209, 0.630245, 0.630284, 0.630328, 0.630376,
-    0.630427, 0.630484, 0.630544, 0.630609, 0.630678, 0.630752,
-    0.63083, 0.630913, 0.631001, 0.631094, 0.631191, 0.631293,
-    0.631401, 0.631513, 0.631631, 0.631753, 0.631881, 0.632014,
-    0.632153, 0.632296, 0.632446, 0.632601, 0.632761, 0.632927,
-    0.633098, 0.633276, 0.633459, 0.633647, 0.633842, 0.634042,
-    0.634249, 0.634461, 0.634679, 0.634904, 0.635134, 0.635371,
-    0.635613, 0.635862, 0.636117, 0.636378, 0.636646, 0.63692,
-    0.6372, 0.637486, 0.637779, 0.638079, 0.638384, 0.638697,
-    0.639015, 0.639341, 0.639672, 0.64001, 0.640355, 0.640707,
-    0.641065, 0.641429, 0.6418, 0.642178, 0.642562, 0.642953,
-    0.643351, 0.643755, 0.644166, 0.644584, 0.645008, 0.645439,
-    0.645877, 0.646321, 0.646772, 0.647229, 0.647694, 0.648164,
-    0.648642, 0.649126, 0.649617, 0.650114, 0.650618, 0.651128,
-    0.651645, 0.652169, 0.652699, 0.653236, 0.653779, 0.654329,
-    0.654885, 0.655448, 0.656017, 0.656592, 0.657174, 0.657762,
-    0.658356, 0.658957, 0.659564, 0.660177, 0.660796, 0.661422,
-    0.662054, 0.662691, 0.663335, 0.663985, 0.664641, 0.665302,
-    0.66597, 0.666644, 0.667323, 0.668008, 0.668699, 0.669395,
-    0.670098, 0.670805, 0.671519, 0.672237, 0.672962, 0.673691,
-    0.674426, 0.675167, 0.675912, 0.676663, 0.677419, 0.67818,
-    0.678946, 0.679717, 0.680492, 0.681273, 0.682059, 0.682849,
-    0.683644, 0.684443, 0.685247, 0.686056, 0.686868, 0.687686,
-    0.688507, 0.689333, 0.690163, 0.690997, 0.691835, 0.692677,
-    0.693522, 0.694372, 0.695225, 0.696082, 0.696943, 0.697807,
-    0.698674, 0.699545, 0.70042, 0.701297, 0.702177, 0.703061,
-    0.703948, 0.704837, 0.70573, 0.706625, 0.707522, 0.708423,
-    0.709326, 0.710231, 0.711139, 0.712049, 0.712961, 0.713875,
-    0.714792, 0.71571, 0.71663, 0.717552, 0.718476, 0.719401,
-    0.720328, 0.721257, 0.722186, 0.723117, 0.72405, 0.724983,
-    0.725918, 0.726853, 0.727789, 0.728726, 0.729664, 0.730603,
-    0.731542, 0.732481, 0.733421, 0.734361, 0.735301, 0.736242,
-    0.737182, 0.738122, 0.739063, 0.740003, 0.740943, 0.741882,
-    0.742821, 0.743759, 0.744697, 0.745634, 0.74657, 0.747505,
-    0.74844, 0.749373, 0.750305, 0.751236, 0.752165, 0.753094,
-    0.75402, 0.754946, 0.755869, 0.756791, 0.757711, 0.758629,
-    0.759545, 0.76046, 0.761372, 0.762282, 0.763189, 0.764095,
-    0.764997, 0.765898, 0.766796, 0.767691, 0.768583, 0.769473,
-    0.770359, 0.771243, 0.772124, 0.773001, 0.773876, 0.774747,
-    0.775615, 0.77648, 0.777341, 0.778198, 0.779052, 0.779902,
-    0.780749, 0.781591, 0.78243, 0.783265, 0.784096, 0.784923,
-    0.785745, 0.786564, 0.787378, 0.788188, 0.788994, 0.789795,
-    0.790591, 0.791383, 0.792171, 0.792953, 0.793731, 0.794505,
-    0.795273, 0.796036, 0.796795, 0.797548, 0.798297, 0.79904,
-    0.799778, 0.800511, 0.801239, 0.801962, 0.802679, 0.80339,
-    0.804096, 0.804797, 0.805492, 0.806182, 0.806866, 0.807545,
-    0.808217, 0.808884, 0.809545, 0.810201, 0.81085, 0.811494,
-    0.812132, 0.812764, 0.81339, 0.814009, 0.814623, 0.815231,
-    0.815833, 0.816428, 0.817018, 0.817601, 0.818178, 0.818749,
-    0.819313, 0.819872, 0.820424, 0.82097, 0.821509, 0.822042,
-    0.822569, 0.82309, 0.823604, 0.824111, 0.824612, 0.825107,
-    0.825596, 0.826078, 0.826553, 0.827022, 0.827485, 0.827941,
-    0.828391, 0.828834, 0.829271, 0.829702, 0.830126, 0.830543,
-    0.830954, 0.831358, 0.831757, 0.832148, 0.832533, 0.832912,
-    0.833285, 0.83365, 0.83401, 0.834363, 0.83471, 0.83505,
-    0.835384, 0.835712, 0.836034, 0.836349, 0.836657, 0.83696,
-    0.837256, 0.837546, 0.83783, 0.838108, 0.83838, 0.838645,
-    0.838905, 0.839158, 0.839405, 0.839646, 0.839882, 0.840111,
-    0.840334, 0.840552, 0.840763, 0.840969, 0.841169, 0.841364,
-    0.841552, 0.841735, 0.841912, 0.842084, 0.84225, 0.842411,
-    0.842566, 0.842716, 0.84286, 0.842999, 0.843133, 0.843261,
-    0.843384, 0.843503, 0.843616, 0.843724, 0.843827, 0.843925,
-    0.844018, 0.844106, 0.844189, 0.844268, 0.844342, 0.844411,
-    0.844476, 0.844537, 0.844592, 0.844644, 0.844691, 0.844734,
-    0.844772, 0.844807, 0.844837, 0.844863, 0.844885, 0.844904,
-    0.844918, 0.844929, 0.844936, 0.844939, 0.844939, 0.844935,
-    0.844928, 0.844917, 0.844903, 0.844885, 0.844865, 0.844841,
-    0.844815, 0.844785, 0.844752, 0.844717, 0.844678, 0.844637,
-    0.844594, 0.844548, 0.844499, 0.844448, 0.844394, 0.844338,
-    0.84428, 0.84422, 0.844158, 0.844094, 0.844028, 0.84396,
-    0.84389, 0.843819, 0.843746, 0.843671, 0.843595, 0.843518,
-    0.843439, 0.843359, 0.843278, 0.843196, 0.843113, 0.843029,
-    0.842944, 0.842858, 0.842771, 0.842684, 0.842596, 0.842508,
-    0.84242, 0.842331, 0.842242, 0.842152, 0.842063, 0.841973,
-    0.841884, 0.841794, 0.841705, 0.841616, 0.841528, 0.84144,
-    0.841352, 0.841265, 0.841179, 0.841093, 0.841008, 0.840924,
-    0.840841, 0.840759, 0.840678, 0.840598, 0.840519, 0.840442,
-    0.840366, 0.840292, 0.840219, 0.840148, 0.840078, 0.84001,
-    0.839944, 0.839879, 0.839817, 0.839757, 0.839698, 0.839642,
-    0.839588, 0.839536, 0.839487, 0.83944, 0.839396, 0.839354,
-    0.839314, 0.839278, 0.839244, 0.839213, 0.839184, 0.839159,
-    0.839136, 0.839117, 0.839101, 0.839088, 0.839078, 0.839071,
-    0.839068, 0.839068, 0.839071, 0.839078, 0.839089, 0.839103,
-    0.83912, 0.839142, 0.839167, 0.839196, 0.839229, 0.839266,
-    0.839307, 0.839352, 0.839401, 0.839454, 0.839511, 0.839572,
-    0.839638, 0.839708, 0.839782, 0.83986, 0.839943, 0.840031,
-    0.840123, 0.840219, 0.84032, 0.840426, 0.840536, 0.840651,
-    0.840771, 0.840895, 0.841025, 0.841159, 0.841298, 0.841442,
-    0.84159, 0.841744, 0.841903, 0.842066, 0.842235, 0.842409,
-    0.842587, 0.842771, 0.84296, 0.843155, 0.843354, 0.843558,
-    0.843768, 0.843983, 0.844203, 0.844429, 0.844659, 0.844896,
-    0.845137, 0.845383, 0.845635, 0.845893, 0.846155, 0.846423,
-    0.846697, 0.846976, 0.84726, 0.847549, 0.847844, 0.848145,
-    0.84845, 0.848761, 0.849078, 0.8494, 0.849727, 0.85006,
-    0.850398, 0.850742, 0.851091, 0.851445, 0.851805, 0.85217,
-    0.85254, 0.852916, 0.853297, 0.853683, 0.854075, 0.854472,
-    0.854875, 0.855282, 0.855695, 0.856114, 0.856537, 0.856966,
-    0.857399, 0.857838, 0.858283, 0.858732, 0.859186, 0.859646,
-    0.86011, 0.86058, 0.861054, 0.861534, 0.862019, 0.862508,
-    0.863002, 0.863502, 0.864006, 0.864515, 0.865028, 0.865547,
-    0.86607, 0.866598, 0.86713, 0.867667, 0.868209, 0.868755,
-    0.869306, 0.869861, 0.87042, 0.870984, 0.871553, 0.872125,
-    0.872702, 0.873283, 0.873868, 0.874457, 0.87505, 0.875648,
-    0.876249, 0.876854, 0.877463, 0.878076, 0.878693, 0.879313,
-    0.879937, 0.880565, 0.881196, 0.881831, 0.882469, 0.883111,
-    0.883756, 0.884404, 0.885056, 0.885711, 0.886369, 0.88703,
-    0.887694, 0.888361, 0.88903, 0.889703, 0.890379, 0.891057,
-    0.891738, 0.892421, 0.893108, 0.893796, 0.894487, 0.89518,
-    0.895876, 0.896574, 0.897274, 0.897976, 0.89868, 0.899386,
-    0.900095, 0.900804, 0.901516, 0.90223, 0.902945, 0.903661,
-    0.90438, 0.905099, 0.90582, 0.906542, 0.907266, 0.907991,
-    0.908717, 0.909444, 0.910172, 0.9109, 0.91163, 0.91236,
-    0.913092, 0.913823, 0.914556, 0.915288, 0.916022, 0.916755,
-    0.917489, 0.918223, 0.918958, 0.919692, 0.920426, 0.921161,
-    0.921895, 0.922629, 0.923363, 0.924096, 0.924829, 0.925562,
-    0.926293, 0.927025, 0.927756, 0.928486, 0.929215, 0.929943,
-    0.93067, 0.931396, 0.932122, 0.932846, 0.933569, 0.93429,
-    0.93501, 0.935729, 0.936446, 0.937162, 0.937876, 0.938588,
-    0.939299, 0.940008, 0.940715, 0.94142, 0.942123, 0.942824,
-    0.943522, 0.944219, 0.944913, 0.945605, 0.946294, 0.946982,
-    0.947666, 0.948348, 0.949027, 0.949704, 0.950378, 0.951049,
-    0.951717, 0.952382, 0.953045, 0.953704, 0.95436, 0.955013,
-    0.955663, 0.956309, 0.956952, 0.957592, 0.958228, 0.958861,
-    0.95949, 0.960116, 0.960738, 0.961356, 0.96197, 0.962581,
-    0.963188, 0.963791, 0.96439, 0.964985, 0.965576, 0.966163,
-    0.966745, 0.967324, 0.967898, 0.968468, 0.969034, 0.969595,
-    0.970152, 0.970705, 0.971253, 0.971796, 0.972335, 0.97287,
-    0.9734, 0.973925, 0.974445, 0.974961, 0.975472, 0.975978,
-    0.976479, 0.976975, 0.977467, 0.977953, 0.978435, 0.978911,
-    0.979383, 0.979849, 0.98031, 0.980767, 0.981218, 0.981664,
-    0.982105, 0.98254, 0.982971, 0.983396, 0.983816, 0.98423,
-    0.984639, 0.985043, 0.985442, 0.985835, 0.986223, 0.986605,
-    0.986983, 0.987354, 0.98772, 0.988081, 0.988437, 0.988786,
-    0.989131, 0.98947, 0.989803, 0.990131, 0.990454, 0.990771,
-    0.991082, 0.991388, 0.991688, 0.991983, 0.992273, 0.992556,
-    0.992835, 0.993108, 0.993375, 0.993637, 0.993893, 0.994144,
-    0.994389, 0.994629, 0.994863, 0.995092, 0.995315, 0.995533,
-    0.995746, 0.995953, 0.996154, 0.99635, 0.996541, 0.996727,
-    0.996907, 0.997081, 0.997251, 0.997415, 0.997574, 0.997727,
-    0.997875, 0.998018, 0.998156, 0.998288, 0.998416, 0.998538,
-    0.998655, 0.998767, 0.998874, 0.998976, 0.999072, 0.999164,
-    0.999251, 0.999333, 0.99941, 0.999482, 0.999549, 0.999612,
-    0.999669, 0.999722, 0.99977, 0.999814, 0.999853, 0.999887,
-    0.999916, 0.999941, 0.999962, 0.999978, 0.99999, 0.999997,
-    1, 0.999999, 0.999993, 0.999983, 0.999969, 0.999951,
-    0.999928, 0.999902, 0.999872, 0.999837, 0.999799, 0.999757,
-    0.999711, 0.999661, 0.999607, 0.99955, 0.999489, 0.999425,
-    0.999357, 0.999285, 0.99921, 0.999132, 0.99905, 0.998965,
-    0.998877, 0.998785, 0.99869, 0.998593, 0.998492, 0.998388,
-    0.998281, 0.998172, 0.998059, 0.997944, 0.997826, 0.997705,
-    0.997582, 0.997456, 0.997328, 0.997197, 0.997064, 0.996928,
-    0.99679, 0.99665, 0.996508, 0.996364, 0.996217, 0.996069,
-    0.995919, 0.995766, 0.995612, 0.995456, 0.995299, 0.995139,
-    0.994979, 0.994816, 0.994652, 0.994487, 0.99432, 0.994152,
-    0.993983, 0.993812, 0.99364, 0.993468, 0.993294, 0.993119,
-    0.992943, 0.992767, 0.992589, 0.992411, 0.992232, 0.992053,
-    0.991873, 0.991692, 0.991511, 0.99133, 0.991148, 0.990966,
-    0.990783, 0.990601, 0.990418, 0.990235, 0.990053, 0.98987,
-    0.989687, 0.989505, 0.989322, 0.98914, 0.988958, 0.988777,
-    0.988596, 0.988415, 0.988235, 0.988056, 0.987877, 0.987698,
-    0.987521, 0.987344, 0.987168, 0.986993, 0.986819, 0.986646,
-    0.986474, 0.986302, 0.986132, 0.985963, 0.985796, 0.985629,
-    0.985464, 0.9853, 0.985138, 0.984977, 0.984817, 0.984659,
-    0.984503, 0.984348, 0.984195, 0.984043, 0.983893, 0.983745,
-    0.983599, 0.983455, 0.983312, 0.983172, 0.983033, 0.982896,
-    0.982762, 0.982629, 0.982498, 0.98237, 0.982244, 0.98212,
-    0.981998, 0.981879, 0.981762, 0.981647, 0.981534, 0.981424,
-    0.981316, 0.981211, 0.981108, 0.981008, 0.98091, 0.980815,
-    0.980723, 0.980633, 0.980545, 0.98046, 0.980378, 0.980299,
-    0.980222, 0.980148, 0.980077, 0.980008, 0.979943, 0.97988,
-    0.97982, 0.979763, 0.979708, 0.979657, 0.979608, 0.979562,
-    0.979519, 0.979479, 0.979442, 0.979408, 0.979377, 0.979349,
-    0.979324, 0.979301, 0.979282, 0.979266, 0.979252, 0.979242,
-    0.979234, 0.97923
-};
-
-static const float WAVE_LOGARITHMIC_114[DEFAULT_WAVELEN] = {
-    -1, -0.999993, -0.99997, -0.999933, -0.99988, -0.999813,
-    -0.999731, -0.999633, -0.999521, -0.999394, -0.999252, -0.999094,
-    -0.998922, -0.998735, -0.998533, -0.998316, -0.998085, -0.997838,
-    -0.997576, -0.9973, -0.997008, -0.996702, -0.99638, -0.996044,
-    -0.995693, -0.995327, -0.994946, -0.994551, -0.99414, -0.993715,
-    -0.993275, -0.99282, -0.99235, -0.991865, -0.991366, -0.990852,
-    -0.990323, -0.989779, -0.989221, -0.988648, -0.98806, -0.987457,
-    -0.98684, -0.986208, -0.985562, -0.984901, -0.984225, -0.983535,
-    -0.98283, -0.98211, -0.981376, -0.980627, -0.979864, -0.979086,
-    -0.978294, -0.977488, -0.976667, -0.975831, -0.974981, -0.974117,
-    -0.973238, -0.972345, -0.971438, -0.970516, -0.96958, -0.96863,
-    -0.967665, -0.966686, -0.965693, -0.964686, -0.963665, -0.96263,
-    -0.96158, -0.960516, -0.959439, -0.958347, -0.957241, -0.956122,
-    -0.954988, -0.95384, -0.952679, -0.951503, -0.950314, -0.949111,
-    -0.947894, -0.946663, -0.945419, -0.944161, -0.942889, -0.941604,
-    -0.940305, -0.938992, -0.937666, -0.936326, -0.934972, -0.933606,
-    -0.932225, -0.930832, -0.929425, -0.928004, -0.926571, -0.925124,
-    -0.923663, -0.92219, -0.920703, -0.919204, -0.917691, -0.916165,
-    -0.914626, -0.913074, -0.911508, -0.909931, -0.90834, -0.906736,
-    -0.905119, -0.90349, -0.901848, -0.900193, -0.898525, -0.896845,
-    -0.895152, -0.893447, -0.891729, -0.889999, -0.888256, -0.886501,
-    -0.884733, -0.882953, -0.881161, -0.879356, -0.877539, -0.87571,
-    -0.873869, -0.872016, -0.870151, -0.868274, -0.866385, -0.864484,
-    -0.862571, -0.860646, -0.858709, -0.856761, -0.854801, -0.852829,
-    -0.850846, -0.848851, -0.846845, -0.844827, -0.842798, -0.840757,
-    -0.838705, -0.836642, -0.834567, -0.832481, -0.830384, -0.828276,
-    -0.826157, -0.824027, -0.821886, -0.819734, -0.817571, -0.815397,
-    -0.813213, -0.811018, -0.808812, -0.806595, -0.804368, -0.802131,
-    -0.799882, -0.797624, -0.795355, -0.793076, -0.790786, -0.788487,
-    -0.786177, -0.783857, -0.781526, -0.779186, -0.776836, -0.774476,
-    -0.772106, -0.769727, -0.767337, -0.764938, -0.762529, -0.760111,
-    -0.757683, -0.755245, -0.752799, -0.750342, -0.747877, -0.745402,
-    -0.742918, -0.740424, -0.737922, -0.735411, -0.73289, -0.730361,
-    -0.727823, -0.725275, -0.72272, -0.720155, -0.717582, -0.715,
-    -0.712409, -0.70981, -0.707203, -0.704587, -0.701963, -0.699331,
-    -0.69669, -0.694041, -0.691385, -0.68872, -0.686047, -0.683366,
-    -0.680677, -0.677981, -0.675277, -0.672565, -0.669845, -0.667118,
-    -0.664384, -0.661642, -0.658892, -0.656135, -0.653371, -0.6506,
-    -0.647821, -0.645036, -0.642243, -0.639444, -0.636637, -0.633824,
-    -0.631004, -0.628177, -0.625343, -0.622503, -0.619657, -0.616803,
-    -0.613944, -0.611078, -0.608205, -0.605327, -0.602442, -0.599551,
-    -0.596654, -0.593751, -0.590842, -0.587928, -0.585007, -0.582081,
-    -0.579149, -0.576211, -0.573268, -0.570319, -0.567365, -0.564405,
-    -0.56144, -0.55847, -0.555495, -0.552514, -0.549529, -0.546538,
-    -0.543543, -0.540542, -0.537537, -0.534527, -0.531512, -0.528493,
-    -0.525469, -0.522441, -0.519408, -0.516371, -0.513329, -0.510283,
-    -0.507233, -0.504179, -0.501121, -0.498059, -0.494993, -0.491923,
-    -0.488849, -0.485771, -0.48269, -0.479605, -0.476517, -0.473425,
-    -0.47033, -0.467231, -0.464129, -0.461023, -0.457915, -0.454803,
-    -0.451689, -0.448571, -0.445451, -0.442327, -0.439201, -0.436072,
-    -0.43294, -0.429806, -0.426669, -0.42353, -0.420388, -0.417244,
-    -0.414098, -0.410949, -0.407799, -0.404646, -0.401491, -0.398334,
-    -0.395175, -0.392015, -0.388852, -0.385688, -0.382522, -0.379355,
-    -0.376186, -0.373015, -0.369843, -0.36667, -0.363496, -0.36032,
-    -0.357143, -0.353965, -0.350786, -0.347606, -0.344425, -0.341243,
-    -0.33806, -0.334877, -0.331693, -0.328509, -0.325323, -0.322138,
-    -0.318952, -0.315765, -0.312578, -0.309391, -0.306204, -0.303017,
-    -0.29983, -0.296642, -0.293455, -0.290268, -0.287081, -0.283894,
-    -0.280708, -0.277522, -0.274336, -0.271151, -0.267967, -0.264783,
-    -0.261599, -0.258417, -0.255235, -0.252054, -0.248874, -0.245695,
-    -0.242517, -0.23934, -0.236164, -0.23299, -0.229816, -0.226644,
-    -0.223474, -0.220304, -0.217137, -0.21397, -0.210806, -0.207643,
-    -0.204482, -0.201322, -0.198165, -0.195009, -0.191856, -0.188704,
-    -0.185554, -0.182407, -0.179261, -0.176118, -0.172977, -0.169839,
-    -0.166703, -0.163569, -0.160438, -0.15731, -0.154184, -0.151061,
-    -0.14794, -0.144822, -0.141708, -0.138596, -0.135487, -0.132381,
-    -0.129278, -0.126178, -0.123081, -0.119988, -0.116898, -0.113811,
-    -0.110727, -0.107647, -0.104571, -0.101498, -0.0984283, -0.0953626,
-    -0.0923005, -0.0892421, -0.0861876, -0.0831369, -0.0800901, -0.0770472,
-    -0.0740084, -0.0709736, -0.0679428, -0.0649163, -0.0618939, -0.0588758,
-    -0.055862, -0.0528525, -0.0498474, -0.0468467, -0.0438506, -0.040859,
-    -0.0378719, -0.0348895, -0.0319118, -0.0289388, -0.0259706, -0.0230073,
-    -0.0200487, -0.0170951, -0.0141465, -0.0112029, -0.00826433, -0.00533087,
-    -0.00240255, 0.000520572, 0.00343846, 0.00635107, 0.00925835, 0.0121603,
-    0.0150568, 0.0179478, 0.0208333, 0.0237133, 0.0265877, 0.0294565,
-    0.0323196, 0.035177, 0.0380286, 0.0408745, 0.0437145, 0.0465486,
-    0.0493768, 0.052199, 0.0550152, 0.0578254, 0.0606295, 0.0634274,
-    0.0662192, 0.0690048, 0.0717841, 0.0745572, 0.0773239, 0.0800843,
-    0.0828383, 0.0855858, 0.0883269, 0.0910615, 0.0937895, 0.0965109,
-    0.0992257, 0.101934, 0.104635, 0.10733, 0.110018, 0.112699,
-    0.115373, 0.118041, 0.120701, 0.123355, 0.126002, 0.128641,
-    0.131274, 0.133899, 0.136518, 0.139129, 0.141733, 0.14433,
-    0.14692, 0.149502, 0.152077, 0.154645, 0.157205, 0.159758,
-    0.162304, 0.164842, 0.167373, 0.169896, 0.172412, 0.17492,
-    0.17742, 0.179913, 0.182398, 0.184876, 0.187345, 0.189807,
-    0.192262, 0.194708, 0.197147, 0.199578, 0.202001, 0.204416,
-    0.206823, 0.209222, 0.211614, 0.213997, 0.216372, 0.218739,
-    0.221099, 0.22345, 0.225793, 0.228128, 0.230454, 0.232773,
-    0.235083, 0.237385, 0.239679, 0.241965, 0.244242, 0.246511,
-    0.248772, 0.251024, 0.253268, 0.255504, 0.257731, 0.25995,
-    0.26216, 0.264362, 0.266556, 0.268741, 0.270917, 0.273085,
-    0.275245, 0.277396, 0.279538, 0.281672, 0.283797, 0.285913,
-    0.288021, 0.290121, 0.292211, 0.294293, 0.296366, 0.298431,
-    0.300487, 0.302534, 0.304572, 0.306602, 0.308623, 0.310635,
-    0.312638, 0.314633, 0.316618, 0.318595, 0.320563, 0.322523,
-    0.324473, 0.326415, 0.328347, 0.330271, 0.332186, 0.334092,
-    0.335989, 0.337877, 0.339757, 0.341627, 0.343489, 0.345341,
-    0.347185, 0.34902, 0.350846, 0.352662, 0.35447, 0.356269,
-    0.358059, 0.35984, 0.361612, 0.363375, 0.365129, 0.366874,
-    0.36861, 0.370337, 0.372055, 0.373765, 0.375465, 0.377156,
-    0.378838, 0.380511, 0.382175, 0.38383, 0.385477, 0.387114,
-    0.388742, 0.390361, 0.391971, 0.393573, 0.395165, 0.396748,
-    0.398322, 0.399888, 0.401444, 0.402991, 0.40453, 0.406059,
-    0.40758, 0.409091, 0.410594, 0.412087, 0.413572, 0.415048,
-    0.416515, 0.417973, 0.419422, 0.420862, 0.422293, 0.423715,
-    0.425128, 0.426533, 0.427929, 0.429315, 0.430693, 0.432062,
-    0.433423, 0.434774, 0.436117, 0.43745, 0.438775, 0.440091,
-    0.441399, 0.442698, 0.443987, 0.445269, 0.446541, 0.447805,
-    0.44906, 0.450306, 0.451544, 0.452773, 0.453993, 0.455205,
-    0.456408, 0.457602, 0.458788, 0.459965, 0.461134, 0.462294,
-    0.463445, 0.464588, 0.465723, 0.466849, 0.467966, 0.469075,
-    0.470176, 0.471268, 0.472352, 0.473427, 0.474494, 0.475553,
-    0.476603, 0.477645, 0.478679, 0.479704, 0.480721, 0.48173,
-    0.482731, 0.483723, 0.484707, 0.485683, 0.486651, 0.487611,
-    0.488563, 0.489506, 0.490442, 0.491369, 0.492289, 0.4932,
-    0.494104, 0.494999, 0.495887, 0.496766, 0.497638, 0.498502,
-    0.499358, 0.500206, 0.501047, 0.501879, 0.502704, 0.503521,
-    0.504331, 0.505133, 0.505927, 0.506714, 0.507492, 0.508264,
-    0.509028, 0.509784, 0.510533, 0.511274, 0.512008, 0.512734,
-    0.513453, 0.514165, 0.51487, 0.515567, 0.516256, 0.516939,
-    0.517614, 0.518282, 0.518943, 0.519597, 0.520244, 0.520883,
-    0.521516, 0.522141, 0.52276, 0.523371, 0.523976, 0.524574,
-    0.525165, 0.525749, 0.526326, 0.526896, 0.52746, 0.528017,
-    0.528567, 0.52911, 0.529647, 0.530177, 0.530701, 0.531218,
-    0.531729, 0.532233, 0.532731, 0.533222, 0.533707, 0.534186,
-    0.534658, 0.535124, 0.535584, 0.536038, 0.536485, 0.536926,
-    0.537361, 0.53779, 0.538213, 0.53863, 0.539041, 0.539446,
-    0.539845, 0.540239, 0.540626, 0.541008, 0.541383, 0.541753,
-    0.542118, 0.542477, 0.54283, 0.543177, 0.543519, 0.543855,
-    0.544186, 0.544512, 0.544832, 0.545146, 0.545456, 0.54576,
-    0.546058, 0.546352, 0.54664, 0.546923, 0.547201, 0.547474,
-    0.547742, 0.548004, 0.548262, 0.548515, 0.548763, 0.549006,
-    0.549244, 0.549477, 0.549706, 0.54993, 0.550149, 0.550364,
-    0.550574, 0.550779, 0.55098, 0.551176, 0.551368, 0.551555,
-    0.551738, 0.551917, 0.552092, 0.552262, 0.552428, 0.552589,
-    0.552747, 0.5529, 0.55305, 0.553195, 0.553336, 0.553474,
-    0.553607, 0.553736, 0.553862, 0.553984, 0.554102, 0.554216,
-    0.554327, 0.554434, 0.554537, 0.554637, 0.554734, 0.554826,
-    0.554916, 0.555001, 0.555084, 0.555163, 0.555239, 0.555312,
-    0.555381, 0.555447, 0.55551, 0.55557, 0.555627, 0.555681,
-    0.555731, 0.555779, 0.555824, 0.555866, 0.555906, 0.555942,
-    0.555976, 0.556007, 0.556035, 0.556061, 0.556084, 0.556104,
-    0.556122, 0.556138, 0.556151, 0.556161, 0.55617, 0.556176,
-    0.556179, 0.556181, 0.55618, 0.556177, 0.556172, 0.556165,
-    0.556156, 0.556144, 0.556131, 0.556116, 0.556099, 0.55608,
-    0.556059, 0.556037, 0.556012, 0.555986, 0.555959, 0.55593,
-    0.555899, 0.555866, 0.555832, 0.555797, 0.55576, 0.555722,
-    0.555682, 0.555642, 0.555599, 0.555556, 0.555511, 0.555465,
-    0.555419, 0.555371, 0.555321, 0.555271, 0.55522, 0.555168,
-    0.555115, 0.555062, 0.555007, 0.554952, 0.554895, 0.554839,
-    0.554781, 0.554723, 0.554664, 0.554605, 0.554545, 0.554484,
-    0.554423, 0.554362, 0.5543, 0.554238, 0.554176, 0.554113,
-    0.55405, 0.553987, 0.553924, 0.553861, 0.553797, 0.553734,
-    0.55367, 0.553607, 0.553543, 0.55348, 0.553416, 0.553353,
-    0.55329, 0.553227, 0.553165, 0.553102, 0.55304, 0.552979,
-    0.552918, 0.552857, 0.552797, 0.552737, 0.552678, 0.552619,
-    0.552561, 0.552503, 0.552446, 0.55239, 0.552335, 0.55228,
-    0.552226, 0.552173, 0.552121, 0.552069, 0.552019, 0.55197,
-    0.551921, 0.551874, 0.551827, 0.551782, 0.551738, 0.551695,
-    0.551653, 0.551612, 0.551573, 0.551534, 0.551498, 0.551462,
-    0.551428, 0.551395, 0.551364, 0.551334, 0.551305, 0.551278,
-    0.551253, 0.551229, 0.551207, 0.551186, 0.551167, 0.55115,
-    0.551134, 0.551121, 0.551109, 0.551098, 0.55109, 0.551083,
-    0.551079, 0.551076, 0.551075, 0.551076, 0.551079, 0.551084,
-    0.551091, 0.551101, 0.551112, 0.551125, 0.551141, 0.551159,
-    0.551179, 0.551201, 0.551225, 0.551252, 0.551281, 0.551312,
-    0.551346, 0.551382, 0.551421, 0.551462, 0.551505, 0.551551,
-    0.551599, 0.55165, 0.551703, 0.551759, 0.551818, 0.551879,
-    0.551943, 0.552009, 0.552078, 0.55215, 0.552225, 0.552302,
-    0.552382, 0.552465, 0.552551, 0.552639, 0.55273, 0.552825,
-    0.552922, 0.553022, 0.553125, 0.55323, 0.553339, 0.553451,
-    0.553566, 0.553684, 0.553805, 0.553929, 0.554056, 0.554186,
-    0.554319, 0.554456, 0.554595, 0.554738, 0.554884, 0.555033,
-    0.555186, 0.555341, 0.5555, 0.555663, 0.555828, 0.555997,
-    0.556169, 0.556344, 0.556523, 0.556705, 0.556891, 0.55708,
-    0.557272, 0.557468, 0.557667, 0.55787, 0.558076, 0.558286,
-    0.558499, 0.558715, 0.558936, 0.559159, 0.559387, 0.559617,
-    0.559852, 0.56009, 0.560331, 0.560577, 0.560825, 0.561078,
-    0.561334, 0.561594, 0.561857, 0.562124, 0.562395, 0.562669,
-    0.562948, 0.563229, 0.563515, 0.563804, 0.564097, 0.564394,
-    0.564695, 0.564999, 0.565307, 0.565619, 0.565935, 0.566254,
-    0.566578, 0.566905, 0.567236, 0.567571, 0.567909, 0.568252,
-    0.568598, 0.568948, 0.569302, 0.56966, 0.570022, 0.570387,
-    0.570757, 0.57113, 0.571508, 0.571889, 0.572274, 0.572663,
-    0.573056, 0.573452, 0.573853, 0.574258, 0.574666, 0.575079,
-    0.575495, 0.575915, 0.57634, 0.576768, 0.5772, 0.577636,
-    0.578076, 0.57852, 0.578967, 0.579419, 0.579875, 0.580334,
-    0.580798, 0.581266, 0.581737, 0.582212, 0.582692, 0.583175,
-    0.583662, 0.584153, 0.584648, 0.585147, 0.58565, 0.586157,
-    0.586668, 0.587182, 0.587701, 0.588224, 0.58875, 0.58928,
-    0.589815, 0.590353, 0.590895, 0.591441, 0.591991, 0.592544,
-    0.593102, 0.593664, 0.594229, 0.594798, 0.595371, 0.595948,
-    0.596529, 0.597114, 0.597702, 0.598295, 0.598891, 0.599491,
-    0.600095, 0.600702, 0.601314, 0.601929, 0.602548, 0.603171,
-    0.603797, 0.604427, 0.605062, 0.605699, 0.606341, 0.606986,
-    0.607635, 0.608288, 0.608944, 0.609605, 0.610268, 0.610936,
-    0.611607, 0.612282, 0.61296, 0.613642, 0.614328, 0.615017,
-    0.61571, 0.616407, 0.617107, 0.617811, 0.618518, 0.619229,
-    0.619943, 0.620661, 0.621382, 0.622107, 0.622835, 0.623567,
-    0.624302, 0.625041, 0.625783, 0.626529, 0.627278, 0.62803,
-    0.628786, 0.629545, 0.630307, 0.631073, 0.631842, 0.632615,
-    0.63339, 0.634169, 0.634952, 0.635737, 0.636526, 0.637318,
-    0.638113, 0.638911, 0.639713, 0.640518, 0.641325, 0.642136,
-    0.64295, 0.643768, 0.644588, 0.645411, 0.646237, 0.647067,
-    0.647899, 0.648734, 0.649573, 0.650414, 0.651258, 0.652105,
-    0.652955, 0.653808, 0.654664, 0.655523, 0.656384, 0.657248,
-    0.658115, 0.658985, 0.659858, 0.660733, 0.661611, 0.662492,
-    0.663375, 0.664261, 0.66515, 0.666041, 0.666935, 0.667832,
-    0.668731, 0.669632, 0.670536, 0.671443, 0.672352, 0.673263,
-    0.674177, 0.675094, 0.676012, 0.676934, 0.677857, 0.678783,
-    0.679711, 0.680641, 0.681574, 0.682509, 0.683446, 0.684385,
-    0.685327, 0.686271, 0.687216, 0.688164, 0.689114, 0.690066,
-    0.69102, 0.691977, 0.692935, 0.693895, 0.694857, 0.695821,
-    0.696787, 0.697755, 0.698724, 0.699696, 0.700669, 0.701644,
-    0.702621, 0.7036, 0.70458, 0.705562, 0.706546, 0.707531,
-    0.708518, 0.709507, 0.710497, 0.711489, 0.712482, 0.713477,
-    0.714473, 0.715471, 0.71647, 0.717471, 0.718473, 0.719476,
-    0.720481, 0.721487, 0.722494, 0.723503, 0.724512, 0.725523,
-    0.726536, 0.727549, 0.728563, 0.729579, 0.730596, 0.731614,
-    0.732632, 0.733652, 0.734673, 0.735695, 0.736718, 0.737741,
-    0.738766, 0.739791, 0.740818, 0.741845, 0.742873, 0.743901,
-    0.744931, 0.745961, 0.746991, 0.748023, 0.749055, 0.750088,
-    0.751121, 0.752155, 0.753189, 0.754224, 0.75526, 0.756295,
-    0.757332, 0.758368, 0.759405, 0.760443, 0.761481, 0.762519,
-    0.763557, 0.764596, 0.765634, 0.766674, 0.767713, 0.768752,
-    0.769792, 0.770831, 0.771871, 0.772911, 0.77395, 0.77499,
-    0.77603, 0.777069, 0.778109, 0.779149, 0.780188, 0.781227,
-    0.782266, 0.783305, 0.784344, 0.785382, 0.78642, 0.787458,
-    0.788495, 0.789532, 0.790569, 0.791605, 0.792641, 0.793676,
-    0.794711, 0.795746, 0.796779, 0.797813, 0.798845, 0.799877,
-    0.800909, 0.80194, 0.80297, 0.803999, 0.805028, 0.806056,
-    0.807083, 0.808109, 0.809135, 0.810159, 0.811183, 0.812206,
-    0.813228, 0.814248, 0.815268, 0.816287, 0.817305, 0.818322,
-    0.819338, 0.820352, 0.821366, 0.822378, 0.82339, 0.8244,
-    0.825408, 0.826416, 0.827422, 0.828427, 0.829431, 0.830433,
-    0.831434, 0.832433, 0.833432, 0.834428, 0.835424, 0.836417,
-    0.83741, 0.8384, 0.839389, 0.840377, 0.841363, 0.842347,
-    0.84333, 0.844311, 0.84529, 0.846268, 0.847244, 0.848218,
-    0.84919, 0.850161, 0.85113, 0.852097, 0.853062, 0.854025,
-    0.854986, 0.855945, 0.856903, 0.857858, 0.858812, 0.859763,
-    0.860712, 0.861659, 0.862605, 0.863548, 0.864489, 0.865428,
-    0.866364, 0.867299, 0.868231, 0.869161, 0.870089, 0.871014,
-    0.871937, 0.872858, 0.873777, 0.874693, 0.875607, 0.876518,
-    0.877428, 0.878334, 0.879238, 0.88014, 0.881039, 0.881936,
-    0.88283, 0.883722, 0.884611, 0.885498, 0.886382, 0.887263,
-    0.888142, 0.889018, 0.889892, 0.890762, 0.89163, 0.892496,
-    0.893358, 0.894218, 0.895075, 0.895929, 0.896781, 0.89763,
-    0.898475, 0.899318, 0.900158, 0.900996, 0.90183, 0.902661,
-    0.90349, 0.904315, 0.905138, 0.905957, 0.906774, 0.907587,
-    0.908398, 0.909205, 0.910009, 0.910811, 0.911609, 0.912404,
-    0.913196, 0.913985, 0.914771, 0.915553, 0.916333, 0.917109,
-    0.917882, 0.918652, 0.919418, 0.920181, 0.920941, 0.921698,
-    0.922452, 0.923202, 0.923949, 0.924692, 0.925433, 0.926169,
-    0.926903, 0.927633, 0.92836, 0.929083, 0.929803, 0.93052,
-    0.931233, 0.931943, 0.932649, 0.933352, 0.934051, 0.934747,
-    0.93544, 0.936128, 0.936814, 0.937496, 0.938174, 0.938849,
-    0.93952, 0.940188, 0.940852, 0.941512, 0.942169, 0.942823,
-    0.943473, 0.944119, 0.944761, 0.9454, 0.946035, 0.946667,
-    0.947295, 0.947919, 0.94854, 0.949157, 0.94977, 0.95038,
-    0.950986, 0.951588, 0.952187, 0.952782, 0.953373, 0.95396,
-    0.954544, 0.955124, 0.9557, 0.956272, 0.956841, 0.957406,
-    0.957967, 0.958525, 0.959078, 0.959628, 0.960174, 0.960717,
-    0.961255, 0.96179, 0.962321, 0.962848, 0.963371, 0.963891,
-    0.964406, 0.964918, 0.965426, 0.96593, 0.966431, 0.966927,
-    0.96742, 0.967909, 0.968394, 0.968876, 0.969353, 0.969827,
-    0.970296, 0.970762, 0.971225, 0.971683, 0.972137, 0.972588,
-    0.973035, 0.973477, 0.973916, 0.974352, 0.974783, 0.975211,
-    0.975634, 0.976054, 0.97647, 0.976882, 0.977291, 0.977695,
-    0.978096, 0.978493, 0.978886, 0.979275, 0.97966, 0.980042,
-    0.980419, 0.980793, 0.981163, 0.981529, 0.981892, 0.98225,
-    0.982605, 0.982956, 0.983303, 0.983647, 0.983986, 0.984322,
-    0.984654, 0.984982, 0.985307, 0.985627, 0.985944, 0.986258,
-    0.986567, 0.986873, 0.987174, 0.987472, 0.987767, 0.988058,
-    0.988344, 0.988628, 0.988907, 0.989183, 0.989455, 0.989723,
-    0.989988, 0.990249, 0.990506, 0.99076, 0.99101, 0.991256,
-    0.991499, 0.991738, 0.991973, 0.992205, 0.992433, 0.992657,
-    0.992878, 0.993096, 0.993309, 0.99352, 0.993726, 0.993929,
-    0.994129, 0.994324, 0.994517, 0.994706, 0.994891, 0.995073,
-    0.995251, 0.995426, 0.995597, 0.995765, 0.995929, 0.99609,
-    0.996248, 0.996402, 0.996553, 0.9967, 0.996844, 0.996984,
-    0.997121, 0.997255, 0.997386, 0.997513, 0.997636, 0.997757,
-    0.997874, 0.997988, 0.998098, 0.998205, 0.998309, 0.99841,
-    0.998508, 0.998602, 0.998693, 0.998781, 0.998866, 0.998947,
-    0.999026, 0.999101, 0.999173, 0.999242, 0.999308, 0.999371,
-    0.99943, 0.999487, 0.99954, 0.999591, 0.999639, 0.999683,
-    0.999725, 0.999763, 0.999799, 0.999831, 0.999861, 0.999888,
-    0.999912, 0.999933, 0.999951, 0.999966, 0.999979, 0.999988,
-    0.999995, 0.999999, 1, 0.999998, 0.999994, 0.999987,
-    0.999977, 0.999965, 0.999949, 0.999932, 0.999911, 0.999888,
-    0.999862, 0.999834, 0.999803, 0.999769, 0.999733, 0.999694,
-    0.999653, 0.999609, 0.999563, 0.999514, 0.999463, 0.99941,
-    0.999354, 0.999295, 0.999235, 0.999171, 0.999106, 0.999038,
-    0.998968, 0.998895, 0.998821, 0.998744, 0.998664, 0.998583,
-    0.998499, 0.998413, 0.998325, 0.998235, 0.998143, 0.998048,
-    0.997951, 0.997853, 0.997752, 0.997649, 0.997544, 0.997438,
-    0.997329, 0.997218, 0.997105, 0.99699, 0.996874, 0.996755,
-    0.996635, 0.996513, 0.996389, 0.996263, 0.996135, 0.996005,
-    0.995874, 0.995741, 0.995606, 0.99547, 0.995332, 0.995192,
-    0.99505, 0.994907, 0.994763, 0.994616, 0.994468, 0.994319,
-    0.994168, 0.994015, 0.993861, 0.993706, 0.993549, 0.993391,
-    0.993231, 0.99307, 0.992907, 0.992743, 0.992578, 0.992411,
-    0.992244, 0.992074, 0.991904, 0.991732, 0.991559, 0.991385,
-    0.99121, 0.991034, 0.990856, 0.990677, 0.990498, 0.990317,
-    0.990135, 0.989952, 0.989768, 0.989583, 0.989397, 0.98921,
-    0.989022, 0.988833, 0.988643, 0.988453, 0.988261, 0.988069,
-    0.987876, 0.987682, 0.987487, 0.987291, 0.987095, 0.986898,
-    0.9867, 0.986502, 0.986303, 0.986103, 0.985903, 0.985702,
-    0.9855, 0.985298, 0.985095, 0.984892, 0.984688, 0.984484,
-    0.984279, 0.984074, 0.983869, 0.983663, 0.983456, 0.983249,
-    0.983042, 0.982835, 0.982627, 0.982419, 0.98221, 0.982002,
-    0.981793, 0.981584, 0.981374, 0.981165, 0.980955, 0.980745,
-    0.980535, 0.980325, 0.980115, 0.979904, 0.979694, 0.979484,
-    0.979273, 0.979063, 0.978852, 0.978642, 0.978432, 0.978221,
-    0.978011, 0.977801, 0.977591, 0.977381, 0.977172, 0.976962,
-    0.976753, 0.976544, 0.976335, 0.976127, 0.975918, 0.97571,
-    0.975503, 0.975295, 0.975088, 0.974882, 0.974675, 0.974469,
-    0.974264, 0.974059, 0.973854, 0.97365, 0.973446, 0.973243,
-    0.97304, 0.972838, 0.972636, 0.972435, 0.972235, 0.972035,
-    0.971835, 0.971637, 0.971438, 0.971241, 0.971044, 0.970848,
-    0.970653, 0.970458, 0.970264, 0.970071, 0.969879, 0.969687,
-    0.969496, 0.969306, 0.969117, 0.968928, 0.968741, 0.968554,
-    0.968368, 0.968183, 0.967999, 0.967816, 0.967634, 0.967453,
-    0.967273, 0.967094, 0.966916, 0.966738, 0.966562, 0.966387,
-    0.966213, 0.96604, 0.965868, 0.965697, 0.965527, 0.965359,
-    0.965191, 0.965025, 0.96486, 0.964696, 0.964533, 0.964371,
-    0.964211, 0.964052, 0.963894, 0.963737, 0.963582, 0.963427,
-    0.963274, 0.963123, 0.962972, 0.962823, 0.962676, 0.962529,
-    0.962384, 0.962241, 0.962098, 0.961957, 0.961818, 0.96168,
-    0.961543, 0.961408, 0.961274, 0.961142, 0.961011, 0.960881,
-    0.960753, 0.960627, 0.960501, 0.960378, 0.960256, 0.960135,
-    0.960016, 0.959899, 0.959783, 0.959669, 0.959556, 0.959445,
-    0.959335, 0.959227, 0.95912, 0.959016, 0.958912, 0.958811,
-    0.958711, 0.958612, 0.958516, 0.95842, 0.958327, 0.958235,
-    0.958145, 0.958057, 0.95797, 0.957885, 0.957801, 0.95772,
-    0.95764, 0.957562, 0.957485, 0.95741, 0.957337, 0.957266,
-    0.957196, 0.957128, 0.957062, 0.956998, 0.956935, 0.956874,
-    0.956815, 0.956758, 0.956703, 0.956649, 0.956597, 0.956547,
-    0.956498, 0.956452, 0.956407, 0.956364, 0.956323, 0.956283,
-    0.956246, 0.95621, 0.956176, 0.956144, 0.956114, 0.956085,
-    0.956059, 0.956034, 0.956011, 0.95599, 0.955971, 0.955953,
-    0.955937, 0.955924, 0.955912, 0.955902, 0.955893, 0.955887,
-    0.955882, 0.95588
-};
-
-static const float WAVE_LOGARITHMIC_126[DEFAULT_WAVELEN] = {
-    -1, -0.999997, -0.999989, -0.999974, -0.999954, -0.999929,
-    -0.999898, -0.99986, -0.999818, -0.999769, -0.999715, -0.999656,
-    -0.99959, -0.999519, -0.999442, -0.999359, -0.999271, -0.999177,
-    -0.999078, -0.998972, -0.998861, -0.998745, -0.998622, -0.998494,
-    -0.998361, -0.998221, -0.998076, -0.997925, -0.997769, -0.997607,
-    -0.997439, -0.997265, -0.997086, -0.996901, -0.996711, -0.996515,
-    -0.996313, -0.996105, -0.995892, -0.995673, -0.995449, -0.995218,
-    -0.994983, -0.994741, -0.994494, -0.994241, -0.993983, -0.993718,
-    -0.993449, -0.993173, -0.992892, -0.992605, -0.992313, -0.992015,
-    -0.991711, -0.991402, -0.991087, -0.990766, -0.99044, -0.990108,
-    -0.989771, -0.989428, -0.989079, -0.988725, -0.988365, -0.987999,
-    -0.987628, -0.987251, -0.986869, -0.98648, -0.986087, -0.985688,
-    -0.985283, -0.984872, -0.984456, -0.984035, -0.983607, -0.983175,
-    -0.982736, -0.982292, -0.981843, -0.981388, -0.980927, -0.980461,
-    -0.979989, -0.979511, -0.979029, -0.97854, -0.978046, -0.977546,
-    -0.977041, -0.976531, -0.976014, -0.975493, -0.974965, -0.974432,
-    -0.973894, -0.97335, -0.972801, -0.972246, -0.971686, -0.97112,
-    -0.970548, -0.969971, -0.969389, -0.968801, -0.968208, -0.967609,
-    -0.967004, -0.966395, -0.965779, -0.965158, -0.964532, -0.963901,
-    -0.963263, -0.962621, -0.961973, -0.961319, -0.96066, -0.959996,
-    -0.959326, -0.958651, -0.95797, -0.957284, -0.956593, -0.955896,
-    -0.955194, -0.954486, -0.953773, -0.953054, -0.952331, -0.951601,
-    -0.950867, -0.950127, -0.949381, -0.948631, -0.947875, -0.947113,
-    -0.946346, -0.945574, -0.944797, -0.944014, -0.943226, -0.942433,
-    -0.941634, -0.94083, -0.940021, -0.939206, -0.938386, -0.937561,
-    -0.936731, -0.935895, -0.935054, -0.934207, -0.933356, -0.932499,
-    -0.931637, -0.93077, -0.929897, -0.929019, -0.928136, -0.927248,
-    -0.926355, -0.925456, -0.924552, -0.923643, -0.922729, -0.92181,
-    -0.920885, -0.919955, -0.91902, -0.91808, -0.917135, -0.916185,
-    -0.915229, -0.914268, -0.913303, -0.912332, -0.911356, -0.910375,
-    -0.909388, -0.908397, -0.907401, -0.906399, -0.905392, -0.904381,
-    -0.903364, -0.902342, -0.901315, -0.900284, -0.899247, -0.898205,
-    -0.897158, -0.896106, -0.895049, -0.893987, -0.89292, -0.891848,
-    -0.890771, -0.889689, -0.888602, -0.88751, -0.886413, -0.885311,
-    -0.884205, -0.883093, -0.881976, -0.880855, -0.879729, -0.878597,
-    -0.877461, -0.87632, -0.875174, -0.874023, -0.872867, -0.871707,
-    -0.870542, -0.869371, -0.868196, -0.867016, -0.865832, -0.864642,
-    -0.863448, -0.862248, -0.861045, -0.859836, -0.858622, -0.857404,
-    -0.856181, -0.854953, -0.853721, -0.852484, -0.851242, -0.849995,
-    -0.848744, -0.847487, -0.846227, -0.844961, -0.843691, -0.842416,
-    -0.841137, -0.839853, -0.838564, -0.83727, -0.835972, -0.83467,
-    -0.833363, -0.832051, -0.830734, -0.829413, -0.828088, -0.826757,
-    -0.825423, -0.824083, -0.82274, -0.821391, -0.820038, -0.818681,
-    -0.817319, -0.815953, -0.814582, -0.813207, -0.811827, -0.810442,
-    -0.809054, -0.807661, -0.806263, -0.804861, -0.803454, -0.802044,
-    -0.800628, -0.799209, -0.797785, -0.796356, -0.794924, -0.793486,
-    -0.792045, -0.790599, -0.789149, -0.787695, -0.786236, -0.784773,
-    -0.783306, -0.781834, -0.780358, -0.778878, -0.777394, -0.775905,
-    -0.774412, -0.772915, -0.771414, -0.769909, -0.768399, -0.766885,
-    -0.765367, -0.763845, -0.762319, -0.760788, -0.759254, -0.757715,
-    -0.756172, -0.754625, -0.753075, -0.751519, -0.74996, -0.748397,
-    -0.74683, -0.745259, -0.743683, -0.742104, -0.740521, -0.738933,
-    -0.737342, -0.735746, -0.734147, -0.732544, -0.730937, -0.729326,
-    -0.72771, -0.726091, -0.724469, -0.722842, -0.721211, -0.719577,
-    -0.717938, -0.716296, -0.71465, -0.713, -0.711346, -0.709688,
-    -0.708027, -0.706362, -0.704693, -0.70302, -0.701343, -0.699663,
-    -0.697979, -0.696291, -0.6946, -0.692905, -0.691206, -0.689504,
-    -0.687797, -0.686087, -0.684374, -0.682657, -0.680936, -0.679212,
-    -0.677484, -0.675752, -0.674017, -0.672278, -0.670536, -0.66879,
-    -0.66704, -0.665287, -0.663531, -0.661771, -0.660007, -0.65824,
-    -0.65647, -0.654696, -0.652918, -0.651138, -0.649353, -0.647566,
-    -0.645775, -0.64398, -0.642182, -0.640381, -0.638577, -0.636769,
-    -0.634957, -0.633143, -0.631325, -0.629504, -0.627679, -0.625851,
-    -0.62402, -0.622186, -0.620348, -0.618507, -0.616663, -0.614816,
-    -0.612966, -0.611112, -0.609255, -0.607395, -0.605532, -0.603666,
-    -0.601796, -0.599924, -0.598048, -0.59617, -0.594288, -0.592403,
-    -0.590515, -0.588624, -0.58673, -0.584833, -0.582933, -0.58103,
-    -0.579124, -0.577215, -0.575303, -0.573388, -0.57147, -0.569549,
-    -0.567625, -0.565699, -0.563769, -0.561837, -0.559902, -0.557964,
-    -0.556023, -0.554079, -0.552132, -0.550183, -0.548231, -0.546276,
-    -0.544318, -0.542357, -0.540394, -0.538428, -0.536459, -0.534488,
-    -0.532514, -0.530537, -0.528558, -0.526575, -0.524591, -0.522603,
-    -0.520613, -0.51862, -0.516625, -0.514627, -0.512627, -0.510624,
-    -0.508618, -0.50661, -0.5046, -0.502587, -0.500571, -0.498553,
-    -0.496533, -0.49451, -0.492484, -0.490456, -0.488426, -0.486393,
-    -0.484358, -0.482321, -0.480281, -0.478238, -0.476194, -0.474147,
-    -0.472098, -0.470046, -0.467992, -0.465936, -0.463878, -0.461817,
-    -0.459754, -0.457689, -0.455621, -0.453552, -0.45148, -0.449406,
-    -0.44733, -0.445252, -0.443171, -0.441089, -0.439004, -0.436917,
-    -0.434828, -0.432737, -0.430644, -0.428549, -0.426452, -0.424353,
-    -0.422252, -0.420149, -0.418043, -0.415936, -0.413827, -0.411716,
-    -0.409603, -0.407488, -0.405371, -0.403252, -0.401132, -0.399009,
-    -0.396885, -0.394759, -0.392631, -0.390501, -0.388369, -0.386235,
-    -0.3841, -0.381963, -0.379824, -0.377684, -0.375541, -0.373397,
-    -0.371252, -0.369104, -0.366955, -0.364804, -0.362652, -0.360498,
-    -0.358342, -0.356185, -0.354026, -0.351865, -0.349703, -0.347539,
-    -0.345374, -0.343208, -0.341039, -0.338869, -0.336698, -0.334525,
-    -0.332351, -0.330175, -0.327998, -0.32582, -0.32364, -0.321458,
-    -0.319275, -0.317091, -0.314906, -0.312719, -0.310531, -0.308341,
-    -0.30615, -0.303958, -0.301764, -0.29957, -0.297373, -0.295176,
-    -0.292978, -0.290778, -0.288577, -0.286375, -0.284171, -0.281967,
-    -0.279761, -0.277554, -0.275346, -0.273137, -0.270927, -0.268716,
-    -0.266503, -0.26429, -0.262075, -0.25986, -0.257643, -0.255426,
-    -0.253207, -0.250988, -0.248767, -0.246546, -0.244323, -0.2421,
-    -0.239875, -0.23765, -0.235424, -0.233197, -0.230969, -0.22874,
-    -0.226511, -0.22428, -0.222049, -0.219817, -0.217584, -0.21535,
-    -0.213116, -0.210881, -0.208645, -0.206408, -0.204171, -0.201933,
-    -0.199694, -0.197455, -0.195215, -0.192974, -0.190732, -0.188491,
-    -0.186248, -0.184005, -0.181761, -0.179517, -0.177272, -0.175026,
-    -0.17278, -0.170534, -0.168287, -0.166039, -0.163791, -0.161543,
-    -0.159294, -0.157044, -0.154794, -0.152544, -0.150294, -0.148043,
-    -0.145791, -0.143539, -0.141287, -0.139035, -0.136782, -0.134529,
-    -0.132275, -0.130022, -0.127768, -0.125514, -0.123259, -0.121004,
-    -0.118749, -0.116494, -0.114239, -0.111983, -0.109728, -0.107472,
-    -0.105216, -0.10296, -0.100703, -0.098447, -0.0961905, -0.0939339,
-    -0.0916773, -0.0894206, -0.0871638, -0.0849071, -0.0826503, -0.0803935,
-    -0.0781367, -0.0758799, -0.0736232, -0.0713665, -0.0691098, -0.0668532,
-    -0.0645967, -0.0623403, -0.060084, -0.0578279, -0.0555718, -0.0533159,
-    -0.0510602, -0.0488046, -0.0465492, -0.044294, -0.042039, -0.0397842,
-    -0.0375297, -0.0352754, -0.0330213, -0.0307676, -0.0285141, -0.0262609,
-    -0.024008, -0.0217554, -0.0195032, -0.0172513, -0.0149998, -0.0127486,
-    -0.0104978, -0.00824743, -0.00599744, -0.00374787, -0.00149874, 0.000749957,
-    0.0029982, 0.00524597, 0.00749326, 0.00974006, 0.0119864, 0.0142321,
-    0.0164774, 0.0187221, 0.0209663, 0.0232098, 0.0254529, 0.0276953,
-    0.0299371, 0.0321783, 0.0344189, 0.0366588, 0.0388981, 0.0411368,
-    0.0433747, 0.045612, 0.0478486, 0.0500844, 0.0523196, 0.054554,
-    0.0567876, 0.0590205, 0.0612527, 0.063484, 0.0657146, 0.0679443,
-    0.0701732, 0.0724013, 0.0746286, 0.076855, 0.0790805, 0.0813052,
-    0.083529, 0.0857519, 0.0879738, 0.0901948, 0.0924149, 0.0946341,
-    0.0968523, 0.0990695, 0.101286, 0.103501, 0.105715, 0.107928,
-    0.110141, 0.112352, 0.114562, 0.116771, 0.118979, 0.121186,
-    0.123392, 0.125596, 0.1278, 0.130002, 0.132203, 0.134404,
-    0.136602, 0.1388, 0.140997, 0.143192, 0.145386, 0.147579,
-    0.149771, 0.151961, 0.154151, 0.156339, 0.158525, 0.160711,
-    0.162895, 0.165077, 0.167259, 0.169439, 0.171618, 0.173795,
-    0.175971, 0.178146, 0.180319, 0.182491, 0.184661, 0.18683,
-    0.188998, 0.191164, 0.193329, 0.195492, 0.197653, 0.199814,
-    0.201972, 0.20413, 0.206285, 0.20844, 0.210592, 0.212743,
-    0.214893, 0.217041, 0.219187, 0.221332, 0.223475, 0.225616,
-    0.227756, 0.229895, 0.232031, 0.234166, 0.236299, 0.238431,
-    0.240561, 0.242689, 0.244816, 0.24694, 0.249063, 0.251185,
-    0.253304, 0.255422, 0.257538, 0.259652, 0.261765, 0.263875,
-    0.265984, 0.268091, 0.270196, 0.2723, 0.274401, 0.276501,
-    0.278598, 0.280694, 0.282788, 0.28488, 0.28697, 0.289058,
-    0.291145, 0.293229, 0.295311, 0.297392, 0.29947, 0.301546,
-    0.303621, 0.305693, 0.307764, 0.309832, 0.311898, 0.313963,
-    0.316025, 0.318085, 0.320143, 0.322199, 0.324253, 0.326305,
-    0.328355, 0.330403, 0.332448, 0.334492, 0.336533, 0.338572,
-    0.340609, 0.342643, 0.344676, 0.346706, 0.348735, 0.35076,
-    0.352784, 0.354806, 0.356825, 0.358842, 0.360857, 0.362869,
-    0.364879, 0.366887, 0.368893, 0.370896, 0.372897, 0.374896,
-    0.376892, 0.378886, 0.380878, 0.382867, 0.384854, 0.386839,
-    0.388821, 0.390801, 0.392778, 0.394753, 0.396726, 0.398696,
-    0.400664, 0.402629, 0.404592, 0.406552, 0.40851, 0.410466,
-    0.412419, 0.414369, 0.416317, 0.418263, 0.420206, 0.422146,
-    0.424084, 0.426019, 0.427952, 0.429883, 0.43181, 0.433735,
-    0.435658, 0.437578, 0.439495, 0.44141, 0.443322, 0.445232,
-    0.447138, 0.449043, 0.450944, 0.452843, 0.454739, 0.456633,
-    0.458524, 0.460412, 0.462298, 0.464181, 0.466061, 0.467938,
-    0.469813, 0.471685, 0.473554, 0.475421, 0.477285, 0.479146,
-    0.481004, 0.482859, 0.484712, 0.486562, 0.488409, 0.490253,
-    0.492095, 0.493933, 0.495769, 0.497602, 0.499432, 0.50126,
-    0.503084, 0.504906, 0.506725, 0.508541, 0.510354, 0.512164,
-    0.513971, 0.515775, 0.517577, 0.519375, 0.521171, 0.522963,
-    0.524753, 0.52654, 0.528324, 0.530105, 0.531883, 0.533657,
-    0.535429, 0.537198, 0.538964, 0.540728, 0.542488, 0.544245,
-    0.545999, 0.54775, 0.549498, 0.551243, 0.552984, 0.554723,
-    0.556459, 0.558192, 0.559922, 0.561648, 0.563372, 0.565092,
-    0.56681, 0.568524, 0.570235, 0.571943, 0.573648, 0.57535,
-    0.577049, 0.578745, 0.580437, 0.582127, 0.583813, 0.585496,
-    0.587176, 0.588853, 0.590526, 0.592197, 0.593864, 0.595528,
-    0.597189, 0.598847, 0.600501, 0.602153, 0.603801, 0.605446,
-    0.607087, 0.608726, 0.610361, 0.611993, 0.613622, 0.615247,
-    0.61687, 0.618489, 0.620104, 0.621717, 0.623326, 0.624932,
-    0.626535, 0.628134, 0.62973, 0.631323, 0.632913, 0.634499,
-    0.636082, 0.637661, 0.639238, 0.640811, 0.64238, 0.643947,
-    0.64551, 0.64707, 0.648626, 0.650179, 0.651729, 0.653275,
-    0.654818, 0.656357, 0.657894, 0.659426, 0.660956, 0.662482,
-    0.664005, 0.665524, 0.66704, 0.668553, 0.670062, 0.671567,
-    0.67307, 0.674569, 0.676064, 0.677556, 0.679045, 0.68053,
-    0.682012, 0.683491, 0.684966, 0.686437, 0.687905, 0.68937,
-    0.690831, 0.692289, 0.693743, 0.695194, 0.696641, 0.698085,
-    0.699526, 0.700963, 0.702396, 0.703826, 0.705253, 0.706676,
-    0.708095, 0.709511, 0.710924, 0.712333, 0.713738, 0.715141,
-    0.716539, 0.717934, 0.719326, 0.720714, 0.722098, 0.723479,
-    0.724857, 0.726231, 0.727601, 0.728968, 0.730332, 0.731691,
-    0.733048, 0.734401, 0.73575, 0.737095, 0.738438, 0.739776,
-    0.741111, 0.742443, 0.743771, 0.745095, 0.746416, 0.747733,
-    0.749047, 0.750357, 0.751664, 0.752967, 0.754266, 0.755562,
-    0.756854, 0.758143, 0.759428, 0.760709, 0.761987, 0.763262,
-    0.764533, 0.7658, 0.767063, 0.768323, 0.76958, 0.770833,
-    0.772082, 0.773328, 0.77457, 0.775808, 0.777043, 0.778274,
-    0.779502, 0.780726, 0.781946, 0.783163, 0.784376, 0.785586,
-    0.786792, 0.787994, 0.789193, 0.790388, 0.79158, 0.792768,
-    0.793952, 0.795133, 0.79631, 0.797483, 0.798653, 0.799819,
-    0.800982, 0.802141, 0.803296, 0.804448, 0.805596, 0.806741,
-    0.807882, 0.809019, 0.810152, 0.811282, 0.812409, 0.813532,
-    0.814651, 0.815766, 0.816878, 0.817986, 0.819091, 0.820192,
-    0.821289, 0.822383, 0.823473, 0.824559, 0.825642, 0.826722,
-    0.827797, 0.828869, 0.829937, 0.831002, 0.832063, 0.833121,
-    0.834174, 0.835225, 0.836271, 0.837314, 0.838353, 0.839389,
-    0.840421, 0.841449, 0.842474, 0.843495, 0.844513, 0.845527,
-    0.846537, 0.847544, 0.848547, 0.849546, 0.850542, 0.851534,
-    0.852523, 0.853508, 0.854489, 0.855467, 0.856441, 0.857412,
-    0.858379, 0.859342, 0.860302, 0.861258, 0.86221, 0.863159,
-    0.864104, 0.865046, 0.865984, 0.866918, 0.867849, 0.868777,
-    0.8697, 0.87062, 0.871537, 0.87245, 0.873359, 0.874264,
-    0.875167, 0.876065, 0.87696, 0.877851, 0.878739, 0.879623,
-    0.880504, 0.881381, 0.882254, 0.883124, 0.88399, 0.884853,
-    0.885712, 0.886568, 0.88742, 0.888268, 0.889113, 0.889954,
-    0.890792, 0.891626, 0.892457, 0.893284, 0.894108, 0.894928,
-    0.895744, 0.896557, 0.897367, 0.898172, 0.898975, 0.899774,
-    0.900569, 0.901361, 0.902149, 0.902933, 0.903715, 0.904492,
-    0.905266, 0.906037, 0.906804, 0.907568, 0.908328, 0.909084,
-    0.909838, 0.910587, 0.911333, 0.912076, 0.912815, 0.913551,
-    0.914283, 0.915012, 0.915737, 0.916459, 0.917177, 0.917892,
-    0.918603, 0.919311, 0.920015, 0.920716, 0.921414, 0.922108,
-    0.922798, 0.923486, 0.924169, 0.92485, 0.925527, 0.9262,
-    0.92687, 0.927537, 0.9282, 0.92886, 0.929516, 0.930169,
-    0.930819, 0.931465, 0.932108, 0.932747, 0.933383, 0.934016,
-    0.934645, 0.935271, 0.935893, 0.936512, 0.937128, 0.93774,
-    0.938349, 0.938955, 0.939557, 0.940156, 0.940752, 0.941344,
-    0.941933, 0.942519, 0.943101, 0.94368, 0.944256, 0.944828,
-    0.945397, 0.945963, 0.946525, 0.947084, 0.94764, 0.948193,
-    0.948742, 0.949288, 0.949831, 0.95037, 0.950906, 0.951439,
-    0.951969, 0.952495, 0.953018, 0.953538, 0.954055, 0.954568,
-    0.955079, 0.955586, 0.956089, 0.95659, 0.957087, 0.957581,
-    0.958072, 0.95856, 0.959045, 0.959526, 0.960004, 0.960479,
-    0.960951, 0.96142, 0.961885, 0.962347, 0.962807, 0.963263,
-    0.963716, 0.964165, 0.964612, 0.965055, 0.965496, 0.965933,
-    0.966367, 0.966798, 0.967226, 0.967651, 0.968073, 0.968492,
-    0.968907, 0.96932, 0.969729, 0.970135, 0.970539, 0.970939,
-    0.971336, 0.97173, 0.972122, 0.97251, 0.972895, 0.973277,
-    0.973656, 0.974032, 0.974405, 0.974775, 0.975142, 0.975506,
-    0.975867, 0.976226, 0.976581, 0.976933, 0.977282, 0.977628,
-    0.977972, 0.978312, 0.97865, 0.978984, 0.979316, 0.979644,
-    0.97997, 0.980293, 0.980613, 0.98093, 0.981244, 0.981556,
-    0.981864, 0.98217, 0.982473, 0.982772, 0.983069, 0.983364,
-    0.983655, 0.983944, 0.984229, 0.984512, 0.984792, 0.985069,
-    0.985344, 0.985616, 0.985884, 0.98615, 0.986414, 0.986674,
-    0.986932, 0.987187, 0.987439, 0.987689, 0.987936, 0.98818,
-    0.988421, 0.98866, 0.988896, 0.989129, 0.98936, 0.989587,
-    0.989813, 0.990035, 0.990255, 0.990472, 0.990687, 0.990898,
-    0.991108, 0.991314, 0.991518, 0.99172, 0.991918, 0.992114,
-    0.992308, 0.992499, 0.992687, 0.992873, 0.993056, 0.993236,
-    0.993415, 0.99359, 0.993763, 0.993933, 0.994101, 0.994266,
-    0.994429, 0.99459, 0.994747, 0.994903, 0.995055, 0.995206,
-    0.995354, 0.995499, 0.995642, 0.995782, 0.99592, 0.996056,
-    0.996189, 0.99632, 0.996448, 0.996574, 0.996697, 0.996818,
-    0.996937, 0.997053, 0.997167, 0.997279, 0.997388, 0.997495,
-    0.997599, 0.997701, 0.997801, 0.997899, 0.997994, 0.998087,
-    0.998177, 0.998265, 0.998351, 0.998435, 0.998516, 0.998596,
-    0.998672, 0.998747, 0.998819, 0.99889, 0.998958, 0.999023,
-    0.999087, 0.999148, 0.999207, 0.999264, 0.999319, 0.999371,
-    0.999422, 0.99947, 0.999516, 0.99956, 0.999602, 0.999641,
-    0.999679, 0.999714, 0.999747, 0.999779, 0.999808, 0.999835,
-    0.99986, 0.999883, 0.999903, 0.999922, 0.999939, 0.999954,
-    0.999966, 0.999977, 0.999985, 0.999992, 0.999997, 0.999999,
-    1, 0.999999, 0.999995, 0.99999, 0.999983, 0.999974,
-    0.999963, 0.99995, 0.999935, 0.999918, 0.999899, 0.999878,
-    0.999856, 0.999832, 0.999805, 0.999777, 0.999747, 0.999715,
-    0.999682, 0.999646, 0.999609, 0.99957, 0.999529, 0.999486,
-    0.999441, 0.999395, 0.999347, 0.999297, 0.999245, 0.999192,
-    0.999137, 0.99908, 0.999021, 0.998961, 0.998899, 0.998835,
-    0.998769, 0.998702, 0.998634, 0.998563, 0.998491, 0.998417,
-    0.998342, 0.998265, 0.998186, 0.998105, 0.998024, 0.99794,
-    0.997855, 0.997768, 0.99768, 0.99759, 0.997498, 0.997405,
-    0.997311, 0.997214, 0.997117, 0.997018, 0.996917, 0.996815,
-    0.996711, 0.996606, 0.996499, 0.996391, 0.996281, 0.99617,
-    0.996058, 0.995944, 0.995828, 0.995711, 0.995593, 0.995473,
-    0.995352, 0.99523, 0.995106, 0.994981, 0.994854, 0.994726,
-    0.994597, 0.994466, 0.994334, 0.994201, 0.994066, 0.99393,
-    0.993793, 0.993654, 0.993514, 0.993373, 0.993231, 0.993087,
-    0.992942, 0.992796, 0.992648, 0.9925, 0.99235, 0.992199,
-    0.992047, 0.991893, 0.991738, 0.991582, 0.991425, 0.991267,
-    0.991108, 0.990947, 0.990786, 0.990623, 0.990459, 0.990294,
-    0.990128, 0.989961, 0.989792, 0.989623, 0.989452, 0.989281,
-    0.989108, 0.988935, 0.98876, 0.988584, 0.988407, 0.98823,
-    0.988051, 0.987871, 0.98769, 0.987509, 0.987326, 0.987142,
-    0.986957, 0.986772, 0.986585, 0.986398, 0.986209, 0.98602,
-    0.98583, 0.985638, 0.985446, 0.985253, 0.98506, 0.984865,
-    0.984669, 0.984473, 0.984276, 0.984078, 0.983879, 0.983679,
-    0.983478, 0.983277, 0.983075, 0.982872, 0.982668, 0.982463,
-    0.982258, 0.982052, 0.981845, 0.981638, 0.981429, 0.98122,
-    0.981011, 0.9808, 0.980589, 0.980377, 0.980165, 0.979952,
-    0.979738, 0.979523, 0.979308, 0.979092, 0.978876, 0.978659,
-    0.978441, 0.978223, 0.978004, 0.977784, 0.977564, 0.977343,
-    0.977122, 0.9769, 0.976678, 0.976455, 0.976231, 0.976007,
-    0.975782, 0.975557, 0.975332, 0.975106, 0.974879, 0.974652,
-    0.974424, 0.974196, 0.973968, 0.973739, 0.973509, 0.973279,
-    0.973049, 0.972818, 0.972587, 0.972356, 0.972124, 0.971891,
-    0.971658, 0.971425, 0.971192, 0.970958, 0.970724, 0.970489,
-    0.970254, 0.970019, 0.969783, 0.969547, 0.969311, 0.969074,
-    0.968838, 0.9686, 0.968363, 0.968125, 0.967887, 0.967649,
-    0.967411, 0.967172, 0.966933, 0.966694, 0.966454, 0.966215,
-    0.965975, 0.965735, 0.965495, 0.965254, 0.965014, 0.964773,
-    0.964532, 0.964291, 0.96405, 0.963808, 0.963567, 0.963325,
-    0.963083, 0.962841, 0.962599, 0.962357, 0.962115, 0.961873,
-    0.961631, 0.961388, 0.961146, 0.960903, 0.960661, 0.960418,
-    0.960175, 0.959933, 0.95969, 0.959447, 0.959205, 0.958962,
-    0.958719, 0.958476, 0.958234, 0.957991, 0.957749, 0.957506,
-    0.957264, 0.957021, 0.956779, 0.956536, 0.956294, 0.956052,
-    0.95581, 0.955568, 0.955326, 0.955084, 0.954843, 0.954601,
-    0.95436, 0.954119, 0.953877, 0.953637, 0.953396, 0.953155,
-    0.952915, 0.952674, 0.952434, 0.952194, 0.951955, 0.951715,
-    0.951476, 0.951237, 0.950998, 0.95076, 0.950521, 0.950283,
-    0.950045, 0.949808, 0.94957, 0.949333, 0.949096, 0.94886,
-    0.948624, 0.948388, 0.948152, 0.947917, 0.947682, 0.947447,
-    0.947213, 0.946979, 0.946745, 0.946512, 0.946279, 0.946046,
-    0.945814, 0.945582, 0.94535, 0.945119, 0.944888, 0.944658,
-    0.944428, 0.944198, 0.943969, 0.943741, 0.943512, 0.943284,
-    0.943057, 0.94283, 0.942603, 0.942377, 0.942152, 0.941927,
-    0.941702, 0.941478, 0.941254, 0.941031, 0.940808, 0.940586,
-    0.940364, 0.940143, 0.939922, 0.939702, 0.939482, 0.939263,
-    0.939044, 0.938826, 0.938609, 0.938392, 0.938176, 0.93796,
-    0.937744, 0.93753, 0.937316, 0.937102, 0.936889, 0.936677,
-    0.936465, 0.936254, 0.936044, 0.935834, 0.935625, 0.935416,
-    0.935208, 0.935001, 0.934794, 0.934588, 0.934383, 0.934178,
-    0.933974, 0.933771, 0.933568, 0.933366, 0.933165, 0.932964,
-    0.932764, 0.932565, 0.932367, 0.932169, 0.931972, 0.931775,
-    0.93158, 0.931385, 0.931191, 0.930997, 0.930804, 0.930613,
-    0.930421, 0.930231, 0.930041, 0.929852, 0.929664, 0.929477,
-    0.92929, 0.929105, 0.92892, 0.928736, 0.928552, 0.92837,
-    0.928188, 0.928007, 0.927827, 0.927647, 0.927469, 0.927291,
-    0.927114, 0.926938, 0.926763, 0.926589, 0.926416, 0.926243,
-    0.926071, 0.9259, 0.92573, 0.925561, 0.925393, 0.925226,
-    0.925059, 0.924894, 0.924729, 0.924565, 0.924402, 0.92424,
-    0.924079, 0.923919, 0.92376, 0.923602, 0.923444, 0.923288,
-    0.923132, 0.922977, 0.922824, 0.922671, 0.922519, 0.922368,
-    0.922219, 0.92207, 0.921922, 0.921775, 0.921629, 0.921483,
-    0.921339, 0.921196, 0.921054, 0.920913, 0.920773, 0.920634,
-    0.920495, 0.920358, 0.920222, 0.920087, 0.919953, 0.919819,
-    0.919687, 0.919556, 0.919426, 0.919297, 0.919169, 0.919042,
-    0.918916, 0.918791, 0.918667, 0.918544, 0.918422, 0.918301,
-    0.918181, 0.918062, 0.917945, 0.917828, 0.917712, 0.917598,
-    0.917484, 0.917372, 0.917261, 0.917151, 0.917041, 0.916933,
-    0.916826, 0.91672, 0.916615, 0.916512, 0.916409, 0.916307,
-    0.916207, 0.916108, 0.916009, 0.915912, 0.915816, 0.915721,
-    0.915627, 0.915534, 0.915443, 0.915352, 0.915263, 0.915174,
-    0.915087, 0.915001, 0.914916, 0.914832, 0.91475, 0.914668,
-    0.914588, 0.914508, 0.91443, 0.914353, 0.914277, 0.914202,
-    0.914129, 0.914056, 0.913985, 0.913915, 0.913846, 0.913778,
-    0.913711, 0.913646, 0.913581, 0.913518, 0.913456, 0.913395,
-    0.913335, 0.913276, 0.913219, 0.913163, 0.913108, 0.913054,
-    0.913001, 0.912949, 0.912899, 0.912849, 0.912801, 0.912754,
-    0.912709, 0.912664, 0.912621, 0.912578, 0.912537, 0.912497,
-    0.912459, 0.912421, 0.912385, 0.91235, 0.912316, 0.912283,
-    0.912251, 0.912221, 0.912192, 0.912164, 0.912137, 0.912111,
-    0.912087, 0.912063, 0.912041, 0.91202, 0.912001, 0.911982,
-    0.911965, 0.911949, 0.911934, 0.91192, 0.911908, 0.911896,
-    0.911886, 0.911877, 0.911869, 0.911863, 0.911857, 0.911853,
-    0.91185, 0.911848
-};
-
-static const float *WAVE_LOGARITHMICS[DEFAULT_OCTAVES] = {
-    WAVE_LOGARITHMIC_000, WAVE_LOGARITHMIC_006, WAVE_LOGARITHMIC_018,
-    WAVE_LOGARITHMIC_030, WAVE_LOGARITHMIC_042, WAVE_LOGARITHMIC_054,
-    WAVE_LOGARITHMIC_066, WAVE_LOGARITHMIC_078, WAVE_LOGARITHMIC_090,
-    WAVE_LOGARITHMIC_102, WAVE_LOGARITHMIC_114, WAVE_LOGARITHMIC_126
-};
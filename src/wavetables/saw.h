@@ -1,4152 +0,0 @@
-/* A basic saw wave, intended for both playback and linear scaling. */
-
-#pragma once
-
-#include "../constants/defaults.h"
-
-static const float WAVE_SAW_000[DEFAULT_WAVELEN] = {
-    -1, -0.921422, -0.947433, -0.942619, -0.932586, -0.947691,
-    -0.928308, -0.944872, -0.929868, -0.938172, -0.933392, -0.931289,
-    -0.93559, -0.926838, -0.934733, -0.92556, -0.931053, -0.926387,
-    -0.926215, -0.927353, -0.922175, -0.926799, -0.920071, -0.924232,
-    -0.919733, -0.920406, -0.919987, -0.916701, -0.91948, -0.914229,
-    -0.917499, -0.913214, -0.914313, -0.912971, -0.910891, -0.912422,
-    -0.908235, -0.910797, -0.90677, -0.908071, -0.906139, -0.904901,
-    -0.905505, -0.902161, -0.904108, -0.900374, -0.901734, -0.899425,
-    -0.898797, -0.898679, -0.896035, -0.897426, -0.894014, -0.89533,
-    -0.892793, -0.892612, -0.891918, -0.889871, -0.890749, -0.887681,
-    -0.888875, -0.886225, -0.886361, -0.885211, -0.883675, -0.884079,
-    -0.881366, -0.882381, -0.879709, -0.880057, -0.878549, -0.877449,
-    -0.877418, -0.875063, -0.875856, -0.873236, -0.873706, -0.871928,
-    -0.871194, -0.870768, -0.868768, -0.869308, -0.866799, -0.867315,
-    -0.865346, -0.86491, -0.864133, -0.862474, -0.862742, -0.860391,
-    -0.860887, -0.858799, -0.858597, -0.857515, -0.856178, -0.856164,
-    -0.854007, -0.854429, -0.852286, -0.852255, -0.850918, -0.849874,
-    -0.84958, -0.847641, -0.847943, -0.845803, -0.845885, -0.844341,
-    -0.843559, -0.842994, -0.841288, -0.841436, -0.839347, -0.839487,
-    -0.837788, -0.83723, -0.836412, -0.834943, -0.83491, -0.832916,
-    -0.833063, -0.831258, -0.830884, -0.829838, -0.828602, -0.828371,
-    -0.826505, -0.826614, -0.824752, -0.824519, -0.823273, -0.82226,
-    -0.821823, -0.820112, -0.820143, -0.818269, -0.818135, -0.816723,
-    -0.815913, -0.81527, -0.813731, -0.813654, -0.811808, -0.811729,
-    -0.810188, -0.809558, -0.808717, -0.80736, -0.807148, -0.805367,
-    -0.805304, -0.80367, -0.803192, -0.802167, -0.800994, -0.800629,
-    -0.798943, -0.798858, -0.797171, -0.796812, -0.795623, -0.79463,
-    -0.794102, -0.792535, -0.792395, -0.79069, -0.790417, -0.789089,
-    -0.788263, -0.787569, -0.786139, -0.785915, -0.784227, -0.784006,
-    -0.782567, -0.781891, -0.781034, -0.779751, -0.77942, -0.777781,
-    -0.777578, -0.776059, -0.775511, -0.7745, -0.773369, -0.772914,
-    -0.77135, -0.771134, -0.769565, -0.76912, -0.767971, -0.76699,
-    -0.7664, -0.764932, -0.764674, -0.763086, -0.762717, -0.761448,
-    -0.760609, -0.75988, -0.758525, -0.758199, -0.756622, -0.756301,
-    -0.754935, -0.754226, -0.753357, -0.752127, -0.751712, -0.750173,
-    -0.749871, -0.748433, -0.747836, -0.746835, -0.745734, -0.745215,
-    -0.743738, -0.743427, -0.741943, -0.741437, -0.740316, -0.739344,
-    -0.73871, -0.737314, -0.736969, -0.735467, -0.735029, -0.733802,
-    -0.732954, -0.732199, -0.7309, -0.730499, -0.729003, -0.728609,
-    -0.727296, -0.726562, -0.725685, -0.724494, -0.724017, -0.722553,
-    -0.722177, -0.720799, -0.720164, -0.719171, -0.718094, -0.717526,
-    -0.716114, -0.715732, -0.714313, -0.71376, -0.71266, -0.711696,
-    -0.711027, -0.709686, -0.709276, -0.707838, -0.707347, -0.706153,
-    -0.705298, -0.704523, -0.703267, -0.702808, -0.701375, -0.700923,
-    -0.699652, -0.698899, -0.698016, -0.696855, -0.69633, -0.694923,
-    -0.69449, -0.693159, -0.692496, -0.691509, -0.690448, -0.689843,
-    -0.688482, -0.688045, -0.686676, -0.686086, -0.685003, -0.684045,
-    -0.683349, -0.682051, -0.681589, -0.680203, -0.679669, -0.678501,
-    -0.677642, -0.676851, -0.675628, -0.675123, -0.67374, -0.673244,
-    -0.672005, -0.671237, -0.670349, -0.669212, -0.668648, -0.667287,
-    -0.666808, -0.665515, -0.664829, -0.663847, -0.6628, -0.662165,
-    -0.660845, -0.660363, -0.659034, -0.658416, -0.657346, -0.656392,
-    -0.655675, -0.654411, -0.653908, -0.652563, -0.651996, -0.650848,
-    -0.649984, -0.649181, -0.647985, -0.647444, -0.6461, -0.645568,
-    -0.644355, -0.643575, -0.642683, -0.641565, -0.640971, -0.639647,
-    -0.639131, -0.637869, -0.637164, -0.636185, -0.63515, -0.63449,
-    -0.633203, -0.632686, -0.63139, -0.630747, -0.629688, -0.628738,
-    -0.628003, -0.626768, -0.626231, -0.624919, -0.624325, -0.623194,
-    -0.622327, -0.621512, -0.620339, -0.619768, -0.618457, -0.617895,
-    -0.616704, -0.615914, -0.615019, -0.613917, -0.613296, -0.612004,
-    -0.611457, -0.61022, -0.609499, -0.608524, -0.607499, -0.606818,
-    -0.605559, -0.605011, -0.603742, -0.60308, -0.60203, -0.601083,
-    -0.600334, -0.599122, -0.598557, -0.597273, -0.596655, -0.595538,
-    -0.594669, -0.593846, -0.592691, -0.592094, -0.590811, -0.590224,
-    -0.589051, -0.588253, -0.587355, -0.586266, -0.585624, -0.584357,
-    -0.583786, -0.582569, -0.581836, -0.580863, -0.579846, -0.579148,
-    -0.577912, -0.577339, -0.576093, -0.575414, -0.574371, -0.573427,
-    -0.572666, -0.571473, -0.570885, -0.569624, -0.568988, -0.567882,
-    -0.56701, -0.56618, -0.565041, -0.564423, -0.563163, -0.562555,
-    -0.561397, -0.560593, -0.559691, -0.558614, -0.557954, -0.556709,
-    -0.556116, -0.554917, -0.554173, -0.553202, -0.552192, -0.551479,
-    -0.550263, -0.549669, -0.548442, -0.547749, -0.546713, -0.545771,
-    -0.544999, -0.543823, -0.543215, -0.541974, -0.541321, -0.540226,
-    -0.539352, -0.538515, -0.53739, -0.536754, -0.535513, -0.534888,
-    -0.533742, -0.532932, -0.532029, -0.530961, -0.530286, -0.529059,
-    -0.528447, -0.527263, -0.52651, -0.525541, -0.524537, -0.523812,
-    -0.522612, -0.522, -0.52079, -0.520085, -0.519054, -0.518115,
-    -0.517334, -0.516172, -0.515546, -0.514323, -0.513656, -0.512569,
-    -0.511693, -0.510851, -0.509737, -0.509086, -0.507862, -0.507221,
-    -0.506087, -0.505272, -0.504366, -0.503308, -0.502619, -0.501408,
-    -0.50078, -0.499609, -0.498848, -0.497881, -0.496881, -0.496146,
-    -0.494961, -0.494333, -0.493137, -0.492422, -0.491395, -0.490457,
-    -0.489669, -0.48852, -0.487879, -0.48667, -0.485991, -0.484912,
-    -0.484035, -0.483188, -0.482084, -0.481419, -0.48021, -0.479556,
-    -0.478431, -0.477611, -0.476705, -0.475653, -0.474952, -0.473756,
-    -0.473114, -0.471954, -0.471187, -0.47022, -0.469225, -0.468481,
-    -0.467308, -0.466667, -0.465483, -0.464759, -0.463736, -0.4628,
-    -0.462004, -0.460866, -0.460213, -0.459017, -0.458327, -0.457254,
-    -0.456376, -0.455525, -0.45443, -0.453753, -0.452556, -0.451891,
-    -0.450775, -0.449951, -0.449043, -0.447998, -0.447287, -0.446102,
-    -0.445449, -0.444299, -0.443525, -0.44256, -0.441569, -0.440816,
-    -0.439654, -0.439001, -0.437828, -0.437096, -0.436077, -0.435142,
-    -0.434341, -0.433212, -0.432547, -0.431362, -0.430664, -0.429596,
-    -0.428717, -0.427862, -0.426775, -0.426088, -0.424902, -0.424227,
-    -0.423118, -0.422291, -0.421382, -0.420342, -0.419622, -0.418448,
-    -0.417784, -0.416643, -0.415864, -0.4149, -0.413912, -0.413152,
-    -0.412, -0.411336, -0.410173, -0.409434, -0.408418, -0.407485,
-    -0.406678, -0.405557, -0.404883, -0.403707, -0.403001, -0.401938,
-    -0.401058, -0.4002, -0.39912, -0.398423, -0.397248, -0.396563,
-    -0.395461, -0.394631, -0.39372, -0.392686, -0.391958, -0.390794,
-    -0.39012, -0.388986, -0.388203, -0.38724, -0.386255, -0.385489,
-    -0.384345, -0.383672, -0.382517, -0.381772, -0.380759, -0.379827,
-    -0.379015, -0.377902, -0.377218, -0.376052, -0.375338, -0.37428,
-    -0.373399, -0.372538, -0.371464, -0.370759, -0.369592, -0.3689,
-    -0.367803, -0.366971, -0.366059, -0.365029, -0.364295, -0.363138,
-    -0.362457, -0.36133, -0.360542, -0.359579, -0.358598, -0.357826,
-    -0.35669, -0.356009, -0.35486, -0.354111, -0.3531, -0.352168,
-    -0.351353, -0.350246, -0.349555, -0.348396, -0.347676, -0.346621,
-    -0.34574, -0.344877, -0.343807, -0.343096, -0.341936, -0.341238,
-    -0.340145, -0.339312, -0.338398, -0.337372, -0.336632, -0.335482,
-    -0.334794, -0.333672, -0.332882, -0.331919, -0.33094, -0.330163,
-    -0.329034, -0.328346, -0.327204, -0.32645, -0.32544, -0.32451,
-    -0.323691, -0.32259, -0.321892, -0.320739, -0.320015, -0.318963,
-    -0.318081, -0.317215, -0.31615, -0.315433, -0.31428, -0.313575,
-    -0.312487, -0.311652, -0.310738, -0.309715, -0.308969, -0.307826,
-    -0.307132, -0.306015, -0.305221, -0.304259, -0.303282, -0.302501,
-    -0.301377, -0.300683, -0.299546, -0.298789, -0.297781, -0.296852,
-    -0.296029, -0.294933, -0.294229, -0.293083, -0.292353, -0.291304,
-    -0.290422, -0.289554, -0.288493, -0.28777, -0.286623, -0.285913,
-    -0.284829, -0.283992, -0.283077, -0.282057, -0.281307, -0.280169,
-    -0.279469, -0.278357, -0.277561, -0.276599, -0.275624, -0.274839,
-    -0.27372, -0.273021, -0.271889, -0.271128, -0.270122, -0.269193,
-    -0.268367, -0.267276, -0.266567, -0.265425, -0.264692, -0.263645,
-    -0.262763, -0.261893, -0.260836, -0.260108, -0.258966, -0.258252,
-    -0.257171, -0.256332, -0.255417, -0.2544, -0.253645, -0.252512,
-    -0.251808, -0.250699, -0.249901, -0.248939, -0.247966, -0.247177,
-    -0.246063, -0.245359, -0.244231, -0.243467, -0.242462, -0.241534,
-    -0.240706, -0.239619, -0.238905, -0.237768, -0.237031, -0.235986,
-    -0.235104, -0.234232, -0.233178, -0.232446, -0.231309, -0.230591,
-    -0.229512, -0.228673, -0.227756, -0.226742, -0.225983, -0.224855,
-    -0.224146, -0.223041, -0.222241, -0.221279, -0.220308, -0.219516,
-    -0.218406, -0.217697, -0.216573, -0.215807, -0.214803, -0.213875,
-    -0.213045, -0.211961, -0.211243, -0.21011, -0.20937, -0.208327,
-    -0.207444, -0.206571, -0.20552, -0.204785, -0.203651, -0.20293,
-    -0.201853, -0.201013, -0.200096, -0.199083, -0.198322, -0.197197,
-    -0.196485, -0.195382, -0.194581, -0.193619, -0.192649, -0.191855,
-    -0.190748, -0.190036, -0.188915, -0.188147, -0.187143, -0.186217,
-    -0.185384, -0.184303, -0.183582, -0.182452, -0.181709, -0.180668,
-    -0.179785, -0.178911, -0.177862, -0.177124, -0.175993, -0.175269,
-    -0.174194, -0.173354, -0.172436, -0.171425, -0.170661, -0.169539,
-    -0.168824, -0.167724, -0.166921, -0.165959, -0.16499, -0.164194,
-    -0.16309, -0.162375, -0.161257, -0.160486, -0.159483, -0.158558,
-    -0.157723, -0.156645, -0.155921, -0.154794, -0.154049, -0.153008,
-    -0.152126, -0.15125, -0.150204, -0.149463, -0.148335, -0.147608,
-    -0.146535, -0.145694, -0.144775, -0.143767, -0.143, -0.141881,
-    -0.141163, -0.140065, -0.139261, -0.1383, -0.137332, -0.136533,
-    -0.135432, -0.134714, -0.133598, -0.132826, -0.131824, -0.130899,
-    -0.130063, -0.128987, -0.12826, -0.127135, -0.126389, -0.125349,
-    -0.124467, -0.12359, -0.122545, -0.121802, -0.120676, -0.119948,
-    -0.118876, -0.118035, -0.117115, -0.116108, -0.115339, -0.114222,
-    -0.113503, -0.112406, -0.111601, -0.11064, -0.109673, -0.108873,
-    -0.107773, -0.107054, -0.105939, -0.105167, -0.104164, -0.10324,
-    -0.102402, -0.101328, -0.1006, -0.0994761, -0.0987288, -0.0976893,
-    -0.0968074, -0.0959297, -0.0948868, -0.0941415, -0.0930176, -0.0922878,
-    -0.0912166, -0.0903751, -0.0894552, -0.088449, -0.0876788, -0.0865637,
-    -0.0858427, -0.0847465, -0.0839419, -0.0829797, -0.0820139, -0.0812122,
-    -0.0801143, -0.0793934, -0.0782798, -0.0775068, -0.0765042, -0.0755805,
-    -0.0747422, -0.0736691, -0.0729395, -0.0718171, -0.071069, -0.0700297,
-    -0.0691481, -0.0682696, -0.0672279, -0.0664812, -0.0653587, -0.0646278,
-    -0.0635571, -0.0627157, -0.0617951, -0.06079, -0.0600185, -0.0589047,
-    -0.0581827, -0.0570871, -0.0562824, -0.0553198, -0.0543548, -0.053552,
-    -0.0524553, -0.0517333, -0.0506205, -0.0498472, -0.0488444, -0.0479214,
-    -0.0470821, -0.0460101, -0.0452795, -0.0441579, -0.0434093, -0.0423701,
-    -0.0414889, -0.0406095, -0.0395688, -0.0388211, -0.0376995, -0.0369681,
-    -0.0358975, -0.0350564, -0.0341352, -0.0331309, -0.0323585, -0.0312455,
-    -0.0305229, -0.0294276, -0.028623, -0.0276599, -0.0266956, -0.025892,
-    -0.0247961, -0.0240735, -0.0229611, -0.0221877, -0.0211846, -0.0202622,
-    -0.0194221, -0.0183509, -0.0176196, -0.0164984, -0.0157497, -0.0147103,
-    -0.0138296, -0.0129496, -0.0119096, -0.0111613, -0.01004, -0.00930848,
-    -0.00823777, -0.00739709, -0.00647526, -0.00547169, -0.00469862, -0.00358612,
-    -0.00286331, -0.00176791, -0.000963616, 8.21565e-15, 0.000963616, 0.00176791,
-    0.00286331, 0.00358612, 0.00469862, 0.00547169, 0.00647526, 0.00739709,
-    0.00823777, 0.00930848, 0.01004, 0.0111613, 0.0119096, 0.0129496,
-    0.0138296, 0.0147103, 0.0157497, 0.0164984, 0.0176196, 0.0183509,
-    0.0194221, 0.0202622, 0.0211846, 0.0221877, 0.0229611, 0.0240735,
-    0.0247961, 0.025892, 0.0266956, 0.0276599, 0.028623, 0.0294276,
-    0.0305229, 0.0312455, 0.0323585, 0.0331309, 0.0341352, 0.0350564,
-    0.0358975, 0.0369681, 0.0376995, 0.0388211, 0.0395688, 0.0406095,
-    0.0414889, 0.0423701, 0.0434093, 0.0441579, 0.0452795, 0.0460101,
-    0.0470821, 0.0479214, 0.0488444, 0.0498472, 0.0506205, 0.0517333,
-    0.0524553, 0.053552, 0.0543548, 0.0553198, 0.0562824, 0.0570871,
-    0.0581827, 0.0589047, 0.0600185, 0.06079, 0.0617951, 0.0627157,
-    0.0635571, 0.0646278, 0.0653587, 0.0664812, 0.0672279, 0.0682696,
-    0.0691481, 0.0700297, 0.071069, 0.0718171, 0.0729395, 0.0736691,
-    0.0747422, 0.0755805, 0.0765042, 0.0775068, 0.0782798, 0.0793934,
-    0.0801143, 0.0812122, 0.0820139, 0.0829797, 0.0839419, 0.0847465,
-    0.0858427, 0.0865637, 0.0876788, 0.088449, 0.0894552, 0.0903751,
-    0.0912166, 0.0922878, 0.0930176, 0.0941415, 0.0948868, 0.0959297,
-    0.0968074, 0.0976893, 0.0987288, 0.0994761, 0.1006, 0.101328,
-    0.102402, 0.10324, 0.104164, 0.105167, 0.105939, 0.107054,
-    0.107773, 0.108873, 0.109673, 0.11064, 0.111601, 0.112406,
-    0.113503, 0.114222, 0.115339, 0.116108, 0.117115, 0.118035,
-    0.118876, 0.119948, 0.120676, 0.121802, 0.122545, 0.12359,
-    0.124467, 0.125349, 0.126389, 0.127135, 0.12826, 0.128987,
-    0.130063, 0.130899, 0.131824, 0.132826, 0.133598, 0.134714,
-    0.135432, 0.136533, 0.137332, 0.1383, 0.139261, 0.140065,
-    0.141163, 0.141881, 0.143, 0.143767, 0.144775, 0.145694,
-    0.146535, 0.147608, 0.148335, 0.149463, 0.150204, 0.15125,
-    0.152126, 0.153008, 0.154049, 0.154794, 0.155921, 0.156645,
-    0.157723, 0.158558, 0.159483, 0.160486, 0.161257, 0.162375,
-    0.16309, 0.164194, 0.16499, 0.165959, 0.166921, 0.167724,
-    0.168824, 0.169539, 0.170661, 0.171425, 0.172436, 0.173354,
-    0.174194, 0.175269, 0.175993, 0.177124, 0.177862, 0.178911,
-    0.179785, 0.180668, 0.181709, 0.182452, 0.183582, 0.184303,
-    0.185384, 0.186217, 0.187143, 0.188147, 0.188915, 0.190036,
-    0.190748, 0.191855, 0.192649, 0.193619, 0.194581, 0.195382,
-    0.196485, 0.197197, 0.198322, 0.199083, 0.200096, 0.201013,
-    0.201853, 0.20293, 0.203651, 0.204785, 0.20552, 0.206571,
-    0.207444, 0.208327, 0.20937, 0.21011, 0.211243, 0.211961,
-    0.213045, 0.213875, 0.214803, 0.215807, 0.216573, 0.217697,
-    0.218406, 0.219516, 0.220308, 0.221279, 0.222241, 0.223041,
-    0.224146, 0.224855, 0.225983, 0.226742, 0.227756, 0.228673,
-    0.229512, 0.230591, 0.231309, 0.232446, 0.233178, 0.234232,
-    0.235104, 0.235986, 0.237031, 0.237768, 0.238905, 0.239619,
-    0.240706, 0.241534, 0.242462, 0.243467, 0.244231, 0.245359,
-    0.246063, 0.247177, 0.247966, 0.248939, 0.249901, 0.250699,
-    0.251808, 0.252512, 0.253645, 0.2544, 0.255417, 0.256332,
-    0.257171, 0.258252, 0.258966, 0.260108, 0.260836, 0.261893,
-    0.262763, 0.263645, 0.264692, 0.265425, 0.266567, 0.267276,
-    0.268367, 0.269193, 0.270122, 0.271128, 0.271889, 0.273021,
-    0.27372, 0.274839, 0.275624, 0.276599, 0.277561, 0.278357,
-    0.279469, 0.280169, 0.281307, 0.282057, 0.283077, 0.283992,
-    0.284829, 0.285913, 0.286623, 0.28777, 0.288493, 0.289554,
-    0.290422, 0.291304, 0.292353, 0.293083, 0.294229, 0.294933,
-    0.296029, 0.296852, 0.297781, 0.298789, 0.299546, 0.300683,
-    0.301377, 0.302501, 0.303282, 0.304259, 0.305221, 0.306015,
-    0.307132, 0.307826, 0.308969, 0.309715, 0.310738, 0.311652,
-    0.312487, 0.313575, 0.31428, 0.315433, 0.31615, 0.317215,
-    0.318081, 0.318963, 0.320015, 0.320739, 0.321892, 0.32259,
-    0.323691, 0.32451, 0.32544, 0.32645, 0.327204, 0.328346,
-    0.329034, 0.330163, 0.33094, 0.331919, 0.332882, 0.333672,
-    0.334794, 0.335482, 0.336632, 0.337372, 0.338398, 0.339312,
-    0.340145, 0.341238, 0.341936, 0.343096, 0.343807, 0.344877,
-    0.34574, 0.346621, 0.347676, 0.348396, 0.349555, 0.350246,
-    0.351353, 0.352168, 0.3531, 0.354111, 0.35486, 0.356009,
-    0.35669, 0.357826, 0.358598, 0.359579, 0.360542, 0.36133,
-    0.362457, 0.363138, 0.364295, 0.365029, 0.366059, 0.366971,
-    0.367803, 0.3689, 0.369592, 0.370759, 0.371464, 0.372538,
-    0.373399, 0.37428, 0.375338, 0.376052, 0.377218, 0.377902,
-    0.379015, 0.379827, 0.380759, 0.381772, 0.382517, 0.383672,
-    0.384345, 0.385489, 0.386255, 0.38724, 0.388203, 0.388986,
-    0.39012, 0.390794, 0.391958, 0.392686, 0.39372, 0.394631,
-    0.395461, 0.396563, 0.397248, 0.398423, 0.39912, 0.4002,
-    0.401058, 0.401938, 0.403001, 0.403707, 0.404883, 0.405557,
-    0.406678, 0.407485, 0.408418, 0.409434, 0.410173, 0.411336,
-    0.412, 0.413152, 0.413912, 0.4149, 0.415864, 0.416643,
-    0.417784, 0.418448, 0.419622, 0.420342, 0.421382, 0.422291,
-    0.423118, 0.424227, 0.424902, 0.426088, 0.426775, 0.427862,
-    0.428717, 0.429596, 0.430664, 0.431362, 0.432547, 0.433212,
-    0.434341, 0.435142, 0.436077, 0.437096, 0.437828, 0.439001,
-    0.439654, 0.440816, 0.441569, 0.44256, 0.443525, 0.444299,
-    0.445449, 0.446102, 0.447287, 0.447998, 0.449043, 0.449951,
-    0.450775, 0.451891, 0.452556, 0.453753, 0.45443, 0.455525,
-    0.456376, 0.457254, 0.458327, 0.459017, 0.460213, 0.460866,
-    0.462004, 0.4628, 0.463736, 0.464759, 0.465483, 0.466667,
-    0.467308, 0.468481, 0.469225, 0.47022, 0.471187, 0.471954,
-    0.473114, 0.473756, 0.474952, 0.475653, 0.476705, 0.477611,
-    0.478431, 0.479556, 0.48021, 0.481419, 0.482084, 0.483188,
-    0.484035, 0.484912, 0.485991, 0.48667, 0.487879, 0.48852,
-    0.489669, 0.490457, 0.491395, 0.492422, 0.493137, 0.494333,
-    0.494961, 0.496146, 0.496881, 0.497881, 0.498848, 0.499609,
-    0.50078, 0.501408, 0.502619, 0.503308, 0.504366, 0.505272,
-    0.506087, 0.507221, 0.507862, 0.509086, 0.509737, 0.510851,
-    0.511693, 0.512569, 0.513656, 0.514323, 0.515546, 0.516172,
-    0.517334, 0.518115, 0.519054, 0.520085, 0.52079, 0.522,
-    0.522612, 0.523812, 0.524537, 0.525541, 0.52651, 0.527263,
-    0.528447, 0.529059, 0.530286, 0.530961, 0.532029, 0.532932,
-    0.533742, 0.534888, 0.535513, 0.536754, 0.53739, 0.538515,
-    0.539352, 0.540226, 0.541321, 0.541974, 0.543215, 0.543823,
-    0.544999, 0.545771, 0.546713, 0.547749, 0.548442, 0.549669,
-    0.550263, 0.551479, 0.552192, 0.553202, 0.554173, 0.554917,
-    0.556116, 0.556709, 0.557954, 0.558614, 0.559691, 0.560593,
-    0.561397, 0.562555, 0.563163, 0.564423, 0.565041, 0.56618,
-    0.56701, 0.567882, 0.568988, 0.569624, 0.570885, 0.571473,
-    0.572666, 0.573427, 0.574371, 0.575414, 0.576093, 0.577339,
-    0.577912, 0.579148, 0.579846, 0.580863, 0.581836, 0.582569,
-    0.583786, 0.584357, 0.585624, 0.586266, 0.587355, 0.588253,
-    0.589051, 0.590224, 0.590811, 0.592094, 0.592691, 0.593846,
-    0.594669, 0.595538, 0.596655, 0.597273, 0.598557, 0.599122,
-    0.600334, 0.601083, 0.60203, 0.60308, 0.603742, 0.605011,
-    0.605559, 0.606818, 0.607499, 0.608524, 0.609499, 0.61022,
-    0.611457, 0.612004, 0.613296, 0.613917, 0.615019, 0.615914,
-    0.616704, 0.617895, 0.618457, 0.619768, 0.620339, 0.621512,
-    0.622327, 0.623194, 0.624325, 0.624919, 0.626231, 0.626768,
-    0.628003, 0.628738, 0.629688, 0.630747, 0.63139, 0.632686,
-    0.633203, 0.63449, 0.63515, 0.636185, 0.637164, 0.637869,
-    0.639131, 0.639647, 0.640971, 0.641565, 0.642683, 0.643575,
-    0.644355, 0.645568, 0.6461, 0.647444, 0.647985, 0.649181,
-    0.649984, 0.650848, 0.651996, 0.652563, 0.653908, 0.654411,
-    0.655675, 0.656392, 0.657346, 0.658416, 0.659034, 0.660363,
-    0.660845, 0.662165, 0.6628, 0.663847, 0.664829, 0.665515,
-    0.666808, 0.667287, 0.668648, 0.669212, 0.670349, 0.671237,
-    0.672005, 0.673244, 0.67374, 0.675123, 0.675628, 0.676851,
-    0.677642, 0.678501, 0.679669, 0.680203, 0.681589, 0.682051,
-    0.683349, 0.684045, 0.685003, 0.686086, 0.686676, 0.688045,
-    0.688482, 0.689843, 0.690448, 0.691509, 0.692496, 0.693159,
-    0.69449, 0.694923, 0.69633, 0.696855, 0.698016, 0.698899,
-    0.699652, 0.700923, 0.701375, 0.702808, 0.703267, 0.704523,
-    0.705298, 0.706153, 0.707347, 0.707838, 0.709276, 0.709686,
-    0.711027, 0.711696, 0.71266, 0.71376, 0.714313, 0.715732,
-    0.716114, 0.717526, 0.718094, 0.719171, 0.720164, 0.720799,
-    0.722177, 0.722553, 0.724017, 0.724494, 0.725685, 0.726562,
-    0.727296, 0.728609, 0.729003, 0.730499, 0.7309, 0.732199,
-    0.732954, 0.733802, 0.735029, 0.735467, 0.736969, 0.737314,
-    0.73871, 0.739344, 0.740316, 0.741437, 0.741943, 0.743427,
-    0.743738, 0.745215, 0.745734, 0.746835, 0.747836, 0.748433,
-    0.749871, 0.750173, 0.751712, 0.752127, 0.753357, 0.754226,
-    0.754935, 0.756301, 0.756622, 0.758199, 0.758525, 0.75988,
-    0.760609, 0.761448, 0.762717, 0.763086, 0.764674, 0.764932,
-    0.7664, 0.76699, 0.767971, 0.76912, 0.769565, 0.771134,
-    0.77135, 0.772914, 0.773369, 0.7745, 0.775511, 0.776059,
-    0.777578, 0.777781, 0.77942, 0.779751, 0.781034, 0.781891,
-    0.782567, 0.784006, 0.784227, 0.785915, 0.786139, 0.787569,
-    0.788263, 0.789089, 0.790417, 0.79069, 0.792395, 0.792535,
-    0.794102, 0.79463, 0.795623, 0.796812, 0.797171, 0.798858,
-    0.798943, 0.800629, 0.800994, 0.802167, 0.803192, 0.80367,
-    0.805304, 0.805367, 0.807148, 0.80736, 0.808717, 0.809558,
-    0.810188, 0.811729, 0.811808, 0.813654, 0.813731, 0.81527,
-    0.815913, 0.816723, 0.818135, 0.818269, 0.820143, 0.820112,
-    0.821823, 0.82226, 0.823273, 0.824519, 0.824752, 0.826614,
-    0.826505, 0.828371, 0.828602, 0.829838, 0.830884, 0.831258,
-    0.833063, 0.832916, 0.83491, 0.834943, 0.836412, 0.83723,
-    0.837788, 0.839487, 0.839347, 0.841436, 0.841288, 0.842994,
-    0.843559, 0.844341, 0.845885, 0.845803, 0.847943, 0.847641,
-    0.84958, 0.849874, 0.850918, 0.852255, 0.852286, 0.854429,
-    0.854007, 0.856164, 0.856178, 0.857515, 0.858597, 0.858799,
-    0.860887, 0.860391, 0.862742, 0.862474, 0.864133, 0.86491,
-    0.865346, 0.867315, 0.866799, 0.869308, 0.868768, 0.870768,
-    0.871194, 0.871928, 0.873706, 0.873236, 0.875856, 0.875063,
-    0.877418, 0.877449, 0.878549, 0.880057, 0.879709, 0.882381,
-    0.881366, 0.884079, 0.883675, 0.885211, 0.886361, 0.886225,
-    0.888875, 0.887681, 0.890749, 0.889871, 0.891918, 0.892612,
-    0.892793, 0.89533, 0.894014, 0.897426, 0.896035, 0.898679,
-    0.898797, 0.899425, 0.901734, 0.900374, 0.904108, 0.902161,
-    0.905505, 0.904901, 0.906139, 0.908071, 0.90677, 0.910797,
-    0.908235, 0.912422, 0.910891, 0.912971, 0.914313, 0.913214,
-    0.917499, 0.914229, 0.91948, 0.916701, 0.919987, 0.920406,
-    0.919733, 0.924232, 0.920071, 0.926799, 0.922175, 0.927353,
-    0.926215, 0.926387, 0.931053, 0.92556, 0.934733, 0.926838,
-    0.93559, 0.931289, 0.933392, 0.938172, 0.929868, 0.944872,
-    0.928308, 0.947691, 0.932586, 0.942619, 0.947433, 0.921422,
-    1, 9.99201e-15
-};
-
-static const float WAVE_SAW_006[DEFAULT_WAVELEN] = {
-    -0.917083, -0.964345, -0.980454, -0.988292, -0.992761, -0.995528,
-    -0.997315, -0.998484, -0.999237, -0.999694, -0.999931, -1,
-    -0.999935, -0.999762, -0.999498, -0.999157, -0.998748, -0.99828,
-    -0.997759, -0.99719, -0.996576, -0.995922, -0.995229, -0.9945,
-    -0.993738, -0.992943, -0.992119, -0.991265, -0.990385, -0.989478,
-    -0.988546, -0.987591, -0.986614, -0.985617, -0.984599, -0.983563,
-    -0.98251, -0.981441, -0.980358, -0.979261, -0.978151, -0.977031,
-    -0.975902, -0.974764, -0.973619, -0.972468, -0.971312, -0.970153,
-    -0.968991, -0.967828, -0.966665, -0.965503, -0.964343, -0.963186,
-    -0.962033, -0.960885, -0.959742, -0.958606, -0.957476, -0.956354,
-    -0.955241, -0.954136, -0.953041, -0.951955, -0.950879, -0.949813,
-    -0.948758, -0.947712, -0.946678, -0.945654, -0.94464, -0.943636,
-    -0.942643, -0.941659, -0.940685, -0.939719, -0.938763, -0.937814,
-    -0.936873, -0.935939, -0.935012, -0.934091, -0.933175, -0.932264,
-    -0.931357, -0.930453, -0.929552, -0.928653, -0.927755, -0.926857,
-    -0.92596, -0.925062, -0.924163, -0.923262, -0.922359, -0.921452,
-    -0.920542, -0.919627, -0.918709, -0.917785, -0.916856, -0.915921,
-    -0.914981, -0.914034, -0.913081, -0.912122, -0.911155, -0.910182,
-    -0.909203, -0.908217, -0.907224, -0.906224, -0.905219, -0.904207,
-    -0.903189, -0.902166, -0.901138, -0.900104, -0.899066, -0.898024,
-    -0.896978, -0.895928, -0.894876, -0.893821, -0.892764, -0.891706,
-    -0.890647, -0.889587, -0.888527, -0.887467, -0.886409, -0.885351,
-    -0.884296, -0.883242, -0.882191, -0.881143, -0.880098, -0.879057,
-    -0.878019, -0.876986, -0.875957, -0.874932, -0.873912, -0.872897,
-    -0.871887, -0.870882, -0.869882, -0.868886, -0.867896, -0.866911,
-    -0.86593, -0.864953, -0.863982, -0.863014, -0.86205, -0.86109,
-    -0.860134, -0.859181, -0.85823, -0.857282, -0.856336, -0.855392,
-    -0.85445, -0.853508, -0.852567, -0.851627, -0.850686, -0.849745,
-    -0.848804, -0.847861, -0.846917, -0.845971, -0.845023, -0.844072,
-    -0.843119, -0.842163, -0.841204, -0.840242, -0.839276, -0.838307,
-    -0.837334, -0.836357, -0.835376, -0.834391, -0.833402, -0.832409,
-    -0.831412, -0.830412, -0.829407, -0.828399, -0.827388, -0.826373,
-    -0.825355, -0.824334, -0.823311, -0.822285, -0.821257, -0.820227,
-    -0.819195, -0.818162, -0.817128, -0.816093, -0.815057, -0.814022,
-    -0.812987, -0.811952, -0.810918, -0.809884, -0.808853, -0.807822,
-    -0.806794, -0.805768, -0.804744, -0.803722, -0.802703, -0.801687,
-    -0.800674, -0.799664, -0.798657, -0.797653, -0.796653, -0.795656,
-    -0.794662, -0.793672, -0.792685, -0.791701, -0.79072, -0.789742,
-    -0.788767, -0.787794, -0.786825, -0.785857, -0.784892, -0.783929,
-    -0.782967, -0.782007, -0.781048, -0.780091, -0.779134, -0.778177,
-    -0.777221, -0.776264, -0.775308, -0.774351, -0.773393, -0.772434,
-    -0.771474, -0.770512, -0.769549, -0.768584, -0.767617, -0.766647,
-    -0.765675, -0.764701, -0.763724, -0.762745, -0.761763, -0.760778,
-    -0.75979, -0.758799, -0.757805, -0.756809, -0.755809, -0.754807,
-    -0.753803, -0.752796, -0.751786, -0.750774, -0.74976, -0.748745,
-    -0.747727, -0.746708, -0.745687, -0.744665, -0.743642, -0.742619,
-    -0.741595, -0.740571, -0.739546, -0.738522, -0.737498, -0.736475,
-    -0.735452, -0.734431, -0.73341, -0.732391, -0.731374, -0.730359,
-    -0.729345, -0.728333, -0.727324, -0.726316, -0.725311, -0.724309,
-    -0.723309, -0.722311, -0.721316, -0.720323, -0.719333, -0.718346,
-    -0.717361, -0.716378, -0.715397, -0.714419, -0.713442, -0.712468,
-    -0.711495, -0.710524, -0.709555, -0.708587, -0.70762, -0.706653,
-    -0.705688, -0.704723, -0.703758, -0.702794, -0.70183, -0.700865,
-    -0.6999, -0.698934, -0.697967, -0.696999, -0.696031, -0.69506,
-    -0.694089, -0.693115, -0.69214, -0.691163, -0.690184, -0.689203,
-    -0.68822, -0.687235, -0.686247, -0.685257, -0.684265, -0.683271,
-    -0.682274, -0.681275, -0.680274, -0.679271, -0.678266, -0.67726,
-    -0.676251, -0.675241, -0.674229, -0.673216, -0.672202, -0.671186,
-    -0.67017, -0.669153, -0.668135, -0.667117, -0.666099, -0.665081,
-    -0.664063, -0.663045, -0.662028, -0.661012, -0.659996, -0.658982,
-    -0.657968, -0.656956, -0.655946, -0.654937, -0.653929, -0.652924,
-    -0.65192, -0.650918, -0.649918, -0.64892, -0.647925, -0.646931,
-    -0.645939, -0.644949, -0.643962, -0.642976, -0.641992, -0.64101,
-    -0.64003, -0.639051, -0.638074, -0.637099, -0.636124, -0.635151,
-    -0.634179, -0.633208, -0.632237, -0.631267, -0.630298, -0.629328,
-    -0.628359, -0.627389, -0.62642, -0.62545, -0.624479, -0.623507,
-    -0.622535, -0.621562, -0.620587, -0.619611, -0.618634, -0.617655,
-    -0.616675, -0.615693, -0.614709, -0.613724, -0.612736, -0.611747,
-    -0.610756, -0.609763, -0.608768, -0.607771, -0.606772, -0.605772,
-    -0.60477, -0.603766, -0.602761, -0.601754, -0.600746, -0.599737,
-    -0.598727, -0.597715, -0.596703, -0.59569, -0.594677, -0.593663,
-    -0.592649, -0.591635, -0.59062, -0.589606, -0.588593, -0.58758,
-    -0.586567, -0.585556, -0.584545, -0.583535, -0.582527, -0.581519,
-    -0.580513, -0.579509, -0.578506, -0.577504, -0.576505, -0.575507,
-    -0.57451, -0.573516, -0.572523, -0.571532, -0.570543, -0.569555,
-    -0.568569, -0.567585, -0.566602, -0.56562, -0.56464, -0.563662,
-    -0.562684, -0.561708, -0.560732, -0.559758, -0.558784, -0.55781,
-    -0.556837, -0.555865, -0.554892, -0.553919, -0.552947, -0.551974,
-    -0.551, -0.550026, -0.549051, -0.548076, -0.547099, -0.546122,
-    -0.545143, -0.544163, -0.543182, -0.542199, -0.541215, -0.54023,
-    -0.539242, -0.538254, -0.537263, -0.536271, -0.535277, -0.534282,
-    -0.533285, -0.532286, -0.531286, -0.530285, -0.529282, -0.528278,
-    -0.527272, -0.526266, -0.525258, -0.524249, -0.52324, -0.52223,
-    -0.521219, -0.520208, -0.519197, -0.518186, -0.517174, -0.516163,
-    -0.515151, -0.51414, -0.51313, -0.51212, -0.511111, -0.510103,
-    -0.509096, -0.50809, -0.507085, -0.506081, -0.505079, -0.504078,
-    -0.503078, -0.50208, -0.501083, -0.500088, -0.499094, -0.498102,
-    -0.497112, -0.496123, -0.495135, -0.494149, -0.493165, -0.492181,
-    -0.491199, -0.490218, -0.489238, -0.48826, -0.487282, -0.486305,
-    -0.485328, -0.484352, -0.483377, -0.482402, -0.481427, -0.480452,
-    -0.479477, -0.478502, -0.477527, -0.476551, -0.475575, -0.474598,
-    -0.47362, -0.472641, -0.471662, -0.470681, -0.469699, -0.468716,
-    -0.467732, -0.466746, -0.465759, -0.464771, -0.463781, -0.462789,
-    -0.461796, -0.460802, -0.459806, -0.458809, -0.45781, -0.456811,
-    -0.455809, -0.454807, -0.453803, -0.452799, -0.451793, -0.450787,
-    -0.449779, -0.448771, -0.447763, -0.446754, -0.445744, -0.444735,
-    -0.443725, -0.442716, -0.441706, -0.440697, -0.439688, -0.43868,
-    -0.437672, -0.436665, -0.435659, -0.434653, -0.433649, -0.432646,
-    -0.431644, -0.430643, -0.429643, -0.428645, -0.427648, -0.426652,
-    -0.425658, -0.424665, -0.423673, -0.422683, -0.421695, -0.420707,
-    -0.419721, -0.418737, -0.417753, -0.41677, -0.415789, -0.414808,
-    -0.413829, -0.41285, -0.411872, -0.410894, -0.409917, -0.40894,
-    -0.407964, -0.406987, -0.406011, -0.405034, -0.404057, -0.40308,
-    -0.402103, -0.401125, -0.400146, -0.399167, -0.398186, -0.397205,
-    -0.396223, -0.39524, -0.394255, -0.393269, -0.392283, -0.391294,
-    -0.390305, -0.389314, -0.388322, -0.387328, -0.386333, -0.385337,
-    -0.38434, -0.383341, -0.382341, -0.38134, -0.380338, -0.379335,
-    -0.378331, -0.377326, -0.37632, -0.375314, -0.374307, -0.373299,
-    -0.372291, -0.371283, -0.370275, -0.369267, -0.368258, -0.36725,
-    -0.366243, -0.365235, -0.364228, -0.363222, -0.362217, -0.361212,
-    -0.360208, -0.359205, -0.358203, -0.357202, -0.356202, -0.355204,
-    -0.354207, -0.35321, -0.352216, -0.351222, -0.35023, -0.349239,
-    -0.34825, -0.347261, -0.346274, -0.345288, -0.344303, -0.343319,
-    -0.342337, -0.341355, -0.340374, -0.339394, -0.338414, -0.337435,
-    -0.336457, -0.335479, -0.334501, -0.333523, -0.332546, -0.331568,
-    -0.33059, -0.329612, -0.328634, -0.327655, -0.326676, -0.325696,
-    -0.324715, -0.323733, -0.322751, -0.321767, -0.320783, -0.319797,
-    -0.318811, -0.317823, -0.316834, -0.315843, -0.314852, -0.313859,
-    -0.312865, -0.31187, -0.310873, -0.309875, -0.308876, -0.307877,
-    -0.306875, -0.305873, -0.304871, -0.303867, -0.302862, -0.301857,
-    -0.300851, -0.299845, -0.298838, -0.297831, -0.296824, -0.295817,
-    -0.294809, -0.293802, -0.292795, -0.291788, -0.290782, -0.289776,
-    -0.288771, -0.287767, -0.286763, -0.28576, -0.284759, -0.283758,
-    -0.282758, -0.281759, -0.280761, -0.279765, -0.27877, -0.277776,
-    -0.276783, -0.275791, -0.274801, -0.273812, -0.272824, -0.271837,
-    -0.270851, -0.269866, -0.268882, -0.267899, -0.266917, -0.265936,
-    -0.264956, -0.263976, -0.262996, -0.262017, -0.261038, -0.26006,
-    -0.259081, -0.258103, -0.257124, -0.256146, -0.255167, -0.254187,
-    -0.253208, -0.252227, -0.251246, -0.250264, -0.249282, -0.248298,
-    -0.247314, -0.246329, -0.245342, -0.244355, -0.243366, -0.242376,
-    -0.241385, -0.240393, -0.239399, -0.238405, -0.237409, -0.236412,
-    -0.235414, -0.234415, -0.233415, -0.232414, -0.231412, -0.230409,
-    -0.229405, -0.228401, -0.227396, -0.226391, -0.225385, -0.224379,
-    -0.223372, -0.222366, -0.221359, -0.220352, -0.219346, -0.21834,
-    -0.217334, -0.216329, -0.215324, -0.21432, -0.213316, -0.212313,
-    -0.211311, -0.21031, -0.20931, -0.208311, -0.207313, -0.206317,
-    -0.205321, -0.204326, -0.203333, -0.202341, -0.20135, -0.20036,
-    -0.199371, -0.198383, -0.197397, -0.196411, -0.195426, -0.194443,
-    -0.19346, -0.192478, -0.191496, -0.190515, -0.189535, -0.188555,
-    -0.187576, -0.186597, -0.185618, -0.184639, -0.18366, -0.182681,
-    -0.181701, -0.180722, -0.179741, -0.178761, -0.17778, -0.176798,
-    -0.175815, -0.174832, -0.173848, -0.172863, -0.171876, -0.170889,
-    -0.169901, -0.168911, -0.167921, -0.166929, -0.165936, -0.164942,
-    -0.163947, -0.162951, -0.161954, -0.160956, -0.159956, -0.158956,
-    -0.157955, -0.156953, -0.15595, -0.154946, -0.153942, -0.152937,
-    -0.151932, -0.150926, -0.14992, -0.148914, -0.147908, -0.146902,
-    -0.145896, -0.14489, -0.143885, -0.142879, -0.141875, -0.14087,
-    -0.139867, -0.138864, -0.137862, -0.136861, -0.135861, -0.134861,
-    -0.133863, -0.132866, -0.13187, -0.130875, -0.129881, -0.128888,
-    -0.127896, -0.126906, -0.125916, -0.124928, -0.12394, -0.122954,
-    -0.121969, -0.120984, -0.120001, -0.119018, -0.118036, -0.117055,
-    -0.116074, -0.115093, -0.114113, -0.113134, -0.112154, -0.111175,
-    -0.110196, -0.109216, -0.108237, -0.107257, -0.106277, -0.105296,
-    -0.104315, -0.103333, -0.102351, -0.101367, -0.100383, -0.0993984,
-    -0.0984126, -0.0974258, -0.0964379, -0.095449, -0.0944589, -0.0934678,
-    -0.0924756, -0.0914822, -0.0904877, -0.0894921, -0.0884955, -0.0874978,
-    -0.0864991, -0.0854994, -0.0844987, -0.0834973, -0.082495, -0.081492,
-    -0.0804883, -0.079484, -0.0784793, -0.0774741, -0.0764686, -0.0754629,
-    -0.074457, -0.0734511, -0.0724453, -0.0714396, -0.0704341, -0.069429,
-    -0.0684242, -0.06742, -0.0664163, -0.0654133, -0.0644111, -0.0634096,
-    -0.062409, -0.0614094, -0.0604107, -0.059413, -0.0584163, -0.0574208,
-    -0.0564263, -0.0554329, -0.0544407, -0.0534495, -0.0524595, -0.0514705,
-    -0.0504826, -0.0494957, -0.0485098, -0.0475248, -0.0465407, -0.0455574,
-    -0.0445748, -0.043593, -0.0426117, -0.0416309, -0.0406506, -0.0396706,
-    -0.0386909, -0.0377113, -0.0367318, -0.0357523, -0.0347726, -0.0337928,
-    -0.0328126, -0.0318321, -0.0308511, -0.0298695, -0.0288873, -0.0279043,
-    -0.0269206, -0.0259361, -0.0249506, -0.0239642, -0.0229768, -0.0219884,
-    -0.0209989, -0.0200083, -0.0190166, -0.0180238, -0.0170298, -0.0160348,
-    -0.0150387, -0.0140416, -0.0130434, -0.0120443, -0.0110441, -0.0100432,
-    -0.00904134, -0.00803876, -0.00703549, -0.0060316, -0.00502717, -0.00402229,
-    -0.00301704, -0.00201152, -0.0010058, 3.10862e-15, 0.0010058, 0.00201152,
-    0.00301704, 0.00402229, 0.00502717, 0.0060316, 0.00703549, 0.00803876,
-    0.00904134, 0.0100432, 0.0110441, 0.0120443, 0.0130434, 0.0140416,
-    0.0150387, 0.0160348, 0.0170298, 0.0180238, 0.0190166, 0.0200083,
-    0.0209989, 0.0219884, 0.0229768, 0.0239642, 0.0249506, 0.0259361,
-    0.0269206, 0.0279043, 0.0288873, 0.0298695, 0.0308511, 0.0318321,
-    0.0328126, 0.0337928, 0.0347726, 0.0357523, 0.0367318, 0.0377113,
-    0.0386909, 0.0396706, 0.0406506, 0.0416309, 0.0426117, 0.043593,
-    0.0445748, 0.0455574, 0.0465407, 0.0475248, 0.0485098, 0.0494957,
-    0.0504826, 0.0514705, 0.0524595, 0.0534495, 0.0544407, 0.0554329,
-    0.0564263, 0.0574208, 0.0584163, 0.059413, 0.0604107, 0.0614094,
-    0.062409, 0.0634096, 0.0644111, 0.0654133, 0.0664163, 0.06742,
-    0.0684242, 0.069429, 0.0704341, 0.0714396, 0.0724453, 0.0734511,
-    0.074457, 0.0754629, 0.0764686, 0.0774741, 0.0784793, 0.079484,
-    0.0804883, 0.081492, 0.082495, 0.0834973, 0.0844987, 0.0854994,
-    0.0864991, 0.0874978, 0.0884955, 0.0894921, 0.0904877, 0.0914822,
-    0.0924756, 0.0934678, 0.0944589, 0.095449, 0.0964379, 0.0974258,
-    0.0984126, 0.0993984, 0.100383, 0.101367, 0.102351, 0.103333,
-    0.104315, 0.105296, 0.106277, 0.107257, 0.108237, 0.109216,
-    0.110196, 0.111175, 0.112154, 0.113134, 0.114113, 0.115093,
-    0.116074, 0.117055, 0.118036, 0.119018, 0.120001, 0.120984,
-    0.121969, 0.122954, 0.12394, 0.124928, 0.125916, 0.126906,
-    0.127896, 0.128888, 0.129881, 0.130875, 0.13187, 0.132866,
-    0.133863, 0.134861, 0.135861, 0.136861, 0.137862, 0.138864,
-    0.139867, 0.14087, 0.141875, 0.142879, 0.143885, 0.14489,
-    0.145896, 0.146902, 0.147908, 0.148914, 0.14992, 0.150926,
-    0.151932, 0.152937, 0.153942, 0.154946, 0.15595, 0.156953,
-    0.157955, 0.158956, 0.159956, 0.160956, 0.161954, 0.162951,
-    0.163947, 0.164942, 0.165936, 0.166929, 0.167921, 0.168911,
-    0.169901, 0.170889, 0.171876, 0.172863, 0.173848, 0.174832,
-    0.175815, 0.176798, 0.17778, 0.178761, 0.179741, 0.180722,
-    0.181701, 0.182681, 0.18366, 0.184639, 0.185618, 0.186597,
-    0.187576, 0.188555, 0.189535, 0.190515, 0.191496, 0.192478,
-    0.19346, 0.194443, 0.195426, 0.196411, 0.197397, 0.198383,
-    0.199371, 0.20036, 0.20135, 0.202341, 0.203333, 0.204326,
-    0.205321, 0.206317, 0.207313, 0.208311, 0.20931, 0.21031,
-    0.211311, 0.212313, 0.213316, 0.21432, 0.215324, 0.216329,
-    0.217334, 0.21834, 0.219346, 0.220352, 0.221359, 0.222366,
-    0.223372, 0.224379, 0.225385, 0.226391, 0.227396, 0.228401,
-    0.229405, 0.230409, 0.231412, 0.232414, 0.233415, 0.234415,
-    0.235414, 0.236412, 0.237409, 0.238405, 0.239399, 0.240393,
-    0.241385, 0.242376, 0.243366, 0.244355, 0.245342, 0.246329,
-    0.247314, 0.248298, 0.249282, 0.250264, 0.251246, 0.252227,
-    0.253208, 0.254187, 0.255167, 0.256146, 0.257124, 0.258103,
-    0.259081, 0.26006, 0.261038, 0.262017, 0.262996, 0.263976,
-    0.264956, 0.265936, 0.266917, 0.267899, 0.268882, 0.269866,
-    0.270851, 0.271837, 0.272824, 0.273812, 0.274801, 0.275791,
-    0.276783, 0.277776, 0.27877, 0.279765, 0.280761, 0.281759,
-    0.282758, 0.283758, 0.284759, 0.28576, 0.286763, 0.287767,
-    0.288771, 0.289776, 0.290782, 0.291788, 0.292795, 0.293802,
-    0.294809, 0.295817, 0.296824, 0.297831, 0.298838, 0.299845,
-    0.300851, 0.301857, 0.302862, 0.303867, 0.304871, 0.305873,
-    0.306875, 0.307877, 0.308876, 0.309875, 0.310873, 0.31187,
-    0.312865, 0.313859, 0.314852, 0.315843, 0.316834, 0.317823,
-    0.318811, 0.319797, 0.320783, 0.321767, 0.322751, 0.323733,
-    0.324715, 0.325696, 0.326676, 0.327655, 0.328634, 0.329612,
-    0.33059, 0.331568, 0.332546, 0.333523, 0.334501, 0.335479,
-    0.336457, 0.337435, 0.338414, 0.339394, 0.340374, 0.341355,
-    0.342337, 0.343319, 0.344303, 0.345288, 0.346274, 0.347261,
-    0.34825, 0.349239, 0.35023, 0.351222, 0.352216, 0.35321,
-    0.354207, 0.355204, 0.356202, 0.357202, 0.358203, 0.359205,
-    0.360208, 0.361212, 0.362217, 0.363222, 0.364228, 0.365235,
-    0.366243, 0.36725, 0.368258, 0.369267, 0.370275, 0.371283,
-    0.372291, 0.373299, 0.374307, 0.375314, 0.37632, 0.377326,
-    0.378331, 0.379335, 0.380338, 0.38134, 0.382341, 0.383341,
-    0.38434, 0.385337, 0.386333, 0.387328, 0.388322, 0.389314,
-    0.390305, 0.391294, 0.392283, 0.393269, 0.394255, 0.39524,
-    0.396223, 0.397205, 0.398186, 0.399167, 0.400146, 0.401125,
-    0.402103, 0.40308, 0.404057, 0.405034, 0.406011, 0.406987,
-    0.407964, 0.40894, 0.409917, 0.410894, 0.411872, 0.41285,
-    0.413829, 0.414808, 0.415789, 0.41677, 0.417753, 0.418737,
-    0.419721, 0.420707, 0.421695, 0.422683, 0.423673, 0.424665,
-    0.425658, 0.426652, 0.427648, 0.428645, 0.429643, 0.430643,
-    0.431644, 0.432646, 0.433649, 0.434653, 0.435659, 0.436665,
-    0.437672, 0.43868, 0.439688, 0.440697, 0.441706, 0.442716,
-    0.443725, 0.444735, 0.445744, 0.446754, 0.447763, 0.448771,
-    0.449779, 0.450787, 0.451793, 0.452799, 0.453803, 0.454807,
-    0.455809, 0.456811, 0.45781, 0.458809, 0.459806, 0.460802,
-    0.461796, 0.462789, 0.463781, 0.464771, 0.465759, 0.466746,
-    0.467732, 0.468716, 0.469699, 0.470681, 0.471662, 0.472641,
-    0.47362, 0.474598, 0.475575, 0.476551, 0.477527, 0.478502,
-    0.479477, 0.480452, 0.481427, 0.482402, 0.483377, 0.484352,
-    0.485328, 0.486305, 0.487282, 0.48826, 0.489238, 0.490218,
-    0.491199, 0.492181, 0.493165, 0.494149, 0.495135, 0.496123,
-    0.497112, 0.498102, 0.499094, 0.500088, 0.501083, 0.50208,
-    0.503078, 0.504078, 0.505079, 0.506081, 0.507085, 0.50809,
-    0.509096, 0.510103, 0.511111, 0.51212, 0.51313, 0.51414,
-    0.515151, 0.516163, 0.517174, 0.518186, 0.519197, 0.520208,
-    0.521219, 0.52223, 0.52324, 0.524249, 0.525258, 0.526266,
-    0.527272, 0.528278, 0.529282, 0.530285, 0.531286, 0.532286,
-    0.533285, 0.534282, 0.535277, 0.536271, 0.537263, 0.538254,
-    0.539242, 0.54023, 0.541215, 0.542199, 0.543182, 0.544163,
-    0.545143, 0.546122, 0.547099, 0.548076, 0.549051, 0.550026,
-    0.551, 0.551974, 0.552947, 0.553919, 0.554892, 0.555865,
-    0.556837, 0.55781, 0.558784, 0.559758, 0.560732, 0.561708,
-    0.562684, 0.563662, 0.56464, 0.56562, 0.566602, 0.567585,
-    0.568569, 0.569555, 0.570543, 0.571532, 0.572523, 0.573516,
-    0.57451, 0.575507, 0.576505, 0.577504, 0.578506, 0.579509,
-    0.580513, 0.581519, 0.582527, 0.583535, 0.584545, 0.585556,
-    0.586567, 0.58758, 0.588593, 0.589606, 0.59062, 0.591635,
-    0.592649, 0.593663, 0.594677, 0.59569, 0.596703, 0.597715,
-    0.598727, 0.599737, 0.600746, 0.601754, 0.602761, 0.603766,
-    0.60477, 0.605772, 0.606772, 0.607771, 0.608768, 0.609763,
-    0.610756, 0.611747, 0.612736, 0.613724, 0.614709, 0.615693,
-    0.616675, 0.617655, 0.618634, 0.619611, 0.620587, 0.621562,
-    0.622535, 0.623507, 0.624479, 0.62545, 0.62642, 0.627389,
-    0.628359, 0.629328, 0.630298, 0.631267, 0.632237, 0.633208,
-    0.634179, 0.635151, 0.636124, 0.637099, 0.638074, 0.639051,
-    0.64003, 0.64101, 0.641992, 0.642976, 0.643962, 0.644949,
-    0.645939, 0.646931, 0.647925, 0.64892, 0.649918, 0.650918,
-    0.65192, 0.652924, 0.653929, 0.654937, 0.655946, 0.656956,
-    0.657968, 0.658982, 0.659996, 0.661012, 0.662028, 0.663045,
-    0.664063, 0.665081, 0.666099, 0.667117, 0.668135, 0.669153,
-    0.67017, 0.671186, 0.672202, 0.673216, 0.674229, 0.675241,
-    0.676251, 0.67726, 0.678266, 0.679271, 0.680274, 0.681275,
-    0.682274, 0.683271, 0.684265, 0.685257, 0.686247, 0.687235,
-    0.68822, 0.689203, 0.690184, 0.691163, 0.69214, 0.693115,
-    0.694089, 0.69506, 0.696031, 0.696999, 0.697967, 0.698934,
-    0.6999, 0.700865, 0.70183, 0.702794, 0.703758, 0.704723,
-    0.705688, 0.706653, 0.70762, 0.708587, 0.709555, 0.710524,
-    0.711495, 0.712468, 0.713442, 0.714419, 0.715397, 0.716378,
-    0.717361, 0.718346, 0.719333, 0.720323, 0.721316, 0.722311,
-    0.723309, 0.724309, 0.725311, 0.726316, 0.727324, 0.728333,
-    0.729345, 0.730359, 0.731374, 0.732391, 0.73341, 0.734431,
-    0.735452, 0.736475, 0.737498, 0.738522, 0.739546, 0.740571,
-    0.741595, 0.742619, 0.743642, 0.744665, 0.745687, 0.746708,
-    0.747727, 0.748745, 0.74976, 0.750774, 0.751786, 0.752796,
-    0.753803, 0.754807, 0.755809, 0.756809, 0.757805, 0.758799,
-    0.75979, 0.760778, 0.761763, 0.762745, 0.763724, 0.764701,
-    0.765675, 0.766647, 0.767617, 0.768584, 0.769549, 0.770512,
-    0.771474, 0.772434, 0.773393, 0.774351, 0.775308, 0.776264,
-    0.777221, 0.778177, 0.779134, 0.780091, 0.781048, 0.782007,
-    0.782967, 0.783929, 0.784892, 0.785857, 0.786825, 0.787794,
-    0.788767, 0.789742, 0.79072, 0.791701, 0.792685, 0.793672,
-    0.794662, 0.795656, 0.796653, 0.797653, 0.798657, 0.799664,
-    0.800674, 0.801687, 0.802703, 0.803722, 0.804744, 0.805768,
-    0.806794, 0.807822, 0.808853, 0.809884, 0.810918, 0.811952,
-    0.812987, 0.814022, 0.815057, 0.816093, 0.817128, 0.818162,
-    0.819195, 0.820227, 0.821257, 0.822285, 0.823311, 0.824334,
-    0.825355, 0.826373, 0.827388, 0.828399, 0.829407, 0.830412,
-    0.831412, 0.832409, 0.833402, 0.834391, 0.835376, 0.836357,
-    0.837334, 0.838307, 0.839276, 0.840242, 0.841204, 0.842163,
-    0.843119, 0.844072, 0.845023, 0.845971, 0.846917, 0.847861,
-    0.848804, 0.849745, 0.850686, 0.851627, 0.852567, 0.853508,
-    0.85445, 0.855392, 0.856336, 0.857282, 0.85823, 0.859181,
-    0.860134, 0.86109, 0.86205, 0.863014, 0.863982, 0.864953,
-    0.86593, 0.866911, 0.867896, 0.868886, 0.869882, 0.870882,
-    0.871887, 0.872897, 0.873912, 0.874932, 0.875957, 0.876986,
-    0.878019, 0.879057, 0.880098, 0.881143, 0.882191, 0.883242,
-    0.884296, 0.885351, 0.886409, 0.887467, 0.888527, 0.889587,
-    0.890647, 0.891706, 0.892764, 0.893821, 0.894876, 0.895928,
-    0.896978, 0.898024, 0.899066, 0.900104, 0.901138, 0.902166,
-    0.903189, 0.904207, 0.905219, 0.906224, 0.907224, 0.908217,
-    0.909203, 0.910182, 0.911155, 0.912122, 0.913081, 0.914034,
-    0.914981, 0.915921, 0.916856, 0.917785, 0.918709, 0.919627,
-    0.920542, 0.921452, 0.922359, 0.923262, 0.924163, 0.925062,
-    0.92596, 0.926857, 0.927755, 0.928653, 0.929552, 0.930453,
-    0.931357, 0.932264, 0.933175, 0.934091, 0.935012, 0.935939,
-    0.936873, 0.937814, 0.938763, 0.939719, 0.940685, 0.941659,
-    0.942643, 0.943636, 0.94464, 0.945654, 0.946678, 0.947712,
-    0.948758, 0.949813, 0.950879, 0.951955, 0.953041, 0.954136,
-    0.955241, 0.956354, 0.957476, 0.958606, 0.959742, 0.960885,
-    0.962033, 0.963186, 0.964343, 0.965503, 0.966665, 0.967828,
-    0.968991, 0.970153, 0.971312, 0.972468, 0.973619, 0.974764,
-    0.975902, 0.977031, 0.978151, 0.979261, 0.980358, 0.981441,
-    0.98251, 0.983563, 0.984599, 0.985617, 0.986614, 0.987591,
-    0.988546, 0.989478, 0.990385, 0.991265, 0.992119, 0.992943,
-    0.993738, 0.9945, 0.995229, 0.995922, 0.996576, 0.99719,
-    0.997759, 0.99828, 0.998748, 0.999157, 0.999498, 0.999762,
-    0.999935, 1, 0.999931, 0.999694, 0.999237, 0.998484,
-    0.997315, 0.995528, 0.992761, 0.988292, 0.980454, 0.964345,
-    0.917083, 4.66294e-15
-};
-
-static const float WAVE_SAW_018[DEFAULT_WAVELEN] = {
-    -1, -0.765148, -0.902286, -0.803783, -0.878287, -0.816398,
-    -0.866677, -0.822105, -0.859325, -0.824998, -0.853932, -0.82647,
-    -0.849603, -0.827125, -0.845917, -0.827263, -0.842652, -0.827055,
-    -0.839677, -0.826599, -0.836913, -0.825962, -0.834309, -0.825184,
-    -0.831828, -0.824295, -0.829448, -0.823317, -0.827149, -0.822263,
-    -0.824919, -0.821146, -0.822748, -0.819974, -0.820629, -0.818753,
-    -0.818556, -0.817489, -0.816524, -0.816185, -0.81453, -0.814845,
-    -0.81257, -0.813472, -0.810642, -0.812067, -0.808745, -0.810634,
-    -0.806876, -0.809173, -0.805033, -0.807687, -0.803216, -0.806176,
-    -0.801422, -0.804641, -0.799651, -0.803085, -0.797902, -0.801507,
-    -0.796174, -0.799909, -0.794465, -0.798292, -0.792774, -0.796657,
-    -0.791101, -0.795005, -0.789445, -0.793337, -0.787805, -0.791653,
-    -0.786179, -0.789955, -0.784567, -0.788245, -0.782968, -0.786521,
-    -0.78138, -0.784787, -0.779804, -0.783042, -0.778237, -0.781287,
-    -0.776679, -0.779525, -0.775129, -0.777755, -0.773586, -0.775978,
-    -0.772049, -0.774196, -0.770517, -0.772409, -0.768989, -0.770619,
-    -0.767464, -0.768826, -0.765942, -0.767032, -0.76442, -0.765236,
-    -0.7629, -0.76344, -0.761379, -0.761645, -0.759856, -0.759852,
-    -0.758332, -0.758061, -0.756805, -0.756273, -0.755275, -0.754489,
-    -0.753741, -0.752709, -0.752202, -0.750934, -0.750657, -0.749165,
-    -0.749107, -0.747401, -0.747551, -0.745645, -0.745988, -0.743895,
-    -0.744418, -0.742152, -0.74284, -0.740417, -0.741255, -0.738689,
-    -0.739662, -0.73697, -0.738061, -0.735259, -0.736451, -0.733556,
-    -0.734834, -0.731861, -0.733208, -0.730175, -0.731573, -0.728497,
-    -0.729931, -0.726827, -0.72828, -0.725165, -0.726622, -0.723511,
-    -0.724955, -0.721865, -0.723282, -0.720226, -0.721601, -0.718594,
-    -0.719913, -0.716968, -0.718219, -0.715349, -0.716518, -0.713736,
-    -0.714812, -0.712128, -0.713101, -0.710525, -0.711385, -0.708927,
-    -0.709665, -0.707333, -0.707941, -0.705742, -0.706213, -0.704155,
-    -0.704483, -0.702569, -0.702751, -0.700986, -0.701017, -0.699404,
-    -0.699282, -0.697823, -0.697546, -0.696243, -0.69581, -0.694662,
-    -0.694074, -0.693081, -0.69234, -0.691498, -0.690607, -0.689914,
-    -0.688875, -0.688328, -0.687146, -0.686739, -0.68542, -0.685147,
-    -0.683697, -0.683552, -0.681977, -0.681954, -0.680261, -0.680351,
-    -0.678549, -0.678744, -0.676842, -0.677133, -0.675139, -0.675517,
-    -0.673441, -0.673896, -0.671748, -0.67227, -0.67006, -0.670639,
-    -0.668378, -0.669002, -0.6667, -0.66736, -0.665029, -0.665713,
-    -0.663362, -0.66406, -0.661701, -0.662402, -0.660045, -0.660739,
-    -0.658394, -0.659071, -0.656748, -0.657398, -0.655108, -0.65572,
-    -0.653471, -0.654037, -0.651839, -0.652351, -0.650212, -0.65066,
-    -0.648588, -0.648965, -0.646968, -0.647267, -0.645351, -0.645566,
-    -0.643737, -0.643862, -0.642126, -0.642155, -0.640517, -0.640447,
-    -0.63891, -0.638737, -0.637305, -0.637025, -0.6357, -0.635312,
-    -0.634097, -0.633599, -0.632494, -0.631885, -0.630891, -0.630172,
-    -0.629288, -0.628459, -0.627684, -0.626747, -0.626079, -0.625036,
-    -0.624472, -0.623327, -0.622864, -0.62162, -0.621254, -0.619914,
-    -0.619642, -0.618212, -0.618027, -0.616511, -0.616409, -0.614814,
-    -0.614788, -0.61312, -0.613164, -0.61143, -0.611536, -0.609743,
-    -0.609905, -0.60806, -0.60827, -0.60638, -0.606631, -0.604705,
-    -0.604988, -0.603033, -0.603341, -0.601365, -0.60169, -0.599702,
-    -0.600035, -0.598042, -0.598376, -0.596387, -0.596713, -0.594735,
-    -0.595046, -0.593087, -0.593376, -0.591443, -0.591702, -0.589803,
-    -0.590024, -0.588166, -0.588343, -0.586532, -0.586659, -0.584901,
-    -0.584972, -0.583273, -0.583282, -0.581647, -0.58159, -0.580024,
-    -0.579896, -0.578403, -0.5782, -0.576783, -0.576502, -0.575165,
-    -0.574803, -0.573549, -0.573102, -0.571933, -0.571401, -0.570318,
-    -0.5697, -0.568703, -0.567998, -0.567088, -0.566296, -0.565473,
-    -0.564595, -0.563858, -0.562894, -0.562241, -0.561195, -0.560624,
-    -0.559497, -0.559005, -0.5578, -0.557384, -0.556105, -0.555762,
-    -0.554412, -0.554138, -0.552721, -0.552511, -0.551032, -0.550882,
-    -0.549346, -0.54925, -0.547663, -0.547615, -0.545983, -0.545978,
-    -0.544305, -0.544337, -0.542631, -0.542693, -0.54096, -0.541046,
-    -0.539292, -0.539396, -0.537627, -0.537743, -0.535966, -0.536086,
-    -0.534308, -0.534426, -0.532653, -0.532763, -0.531001, -0.531096,
-    -0.529353, -0.529427, -0.527707, -0.527755, -0.526064, -0.526079,
-    -0.524424, -0.524401, -0.522787, -0.522721, -0.521152, -0.521038,
-    -0.51952, -0.519353, -0.517889, -0.517666, -0.516261, -0.515977,
-    -0.514634, -0.514287, -0.513008, -0.512596, -0.511384, -0.510903,
-    -0.509761, -0.509209, -0.508138, -0.507515, -0.506516, -0.505821,
-    -0.504894, -0.504126, -0.503272, -0.502432, -0.50165, -0.500738,
-    -0.500027, -0.499045, -0.498403, -0.497352, -0.496779, -0.495661,
-    -0.495153, -0.493971, -0.493526, -0.492282, -0.491897, -0.490595,
-    -0.490267, -0.48891, -0.488634, -0.487227, -0.487, -0.485546,
-    -0.485363, -0.483868, -0.483723, -0.482192, -0.482082, -0.480519,
-    -0.480437, -0.478848, -0.47879, -0.47718, -0.47714, -0.475515,
-    -0.475488, -0.473852, -0.473832, -0.472192, -0.472174, -0.470535,
-    -0.470513, -0.468881, -0.46885, -0.46723, -0.467183, -0.465581,
-    -0.465514, -0.463935, -0.463843, -0.462291, -0.462169, -0.460649,
-    -0.460493, -0.45901, -0.458815, -0.457373, -0.457135, -0.455738,
-    -0.455453, -0.454104, -0.453769, -0.452472, -0.452084, -0.450841,
-    -0.450397, -0.449212, -0.44871, -0.447583, -0.447021, -0.445956,
-    -0.445332, -0.444329, -0.443643, -0.442702, -0.441953, -0.441075,
-    -0.440263, -0.439448, -0.438574, -0.437821, -0.436884, -0.436193,
-    -0.435196, -0.434565, -0.433508, -0.432936, -0.431822, -0.431306,
-    -0.430136, -0.429674, -0.428452, -0.428041, -0.426769, -0.426406,
-    -0.425089, -0.424769, -0.423409, -0.423131, -0.421732, -0.421491,
-    -0.420057, -0.419848, -0.418385, -0.418203, -0.416714, -0.416556,
-    -0.415046, -0.414906, -0.41338, -0.413255, -0.411717, -0.4116,
-    -0.410056, -0.409943, -0.408398, -0.408284, -0.406742, -0.406622,
-    -0.405088, -0.404958, -0.403437, -0.403292, -0.401788, -0.401623,
-    -0.400142, -0.399952, -0.398497, -0.398279, -0.396855, -0.396604,
-    -0.395214, -0.394927, -0.393575, -0.393248, -0.391938, -0.391568,
-    -0.390303, -0.389887, -0.388668, -0.388204, -0.387035, -0.38652,
-    -0.385403, -0.384835, -0.383772, -0.38315, -0.382141, -0.381464,
-    -0.380511, -0.379778, -0.378881, -0.378091, -0.377251, -0.376405,
-    -0.375621, -0.374719, -0.37399, -0.373033, -0.372359, -0.371348,
-    -0.370727, -0.369664, -0.369095, -0.36798, -0.367461, -0.366298,
-    -0.365826, -0.364617, -0.36419, -0.362938, -0.362552, -0.36126,
-    -0.360912, -0.359584, -0.359271, -0.35791, -0.357628, -0.356237,
-    -0.355983, -0.354567, -0.354336, -0.352898, -0.352686, -0.351232,
-    -0.351035, -0.349568, -0.349381, -0.347907, -0.347726, -0.346247,
-    -0.346067, -0.34459, -0.344407, -0.342935, -0.342745, -0.341282,
-    -0.34108, -0.339631, -0.339413, -0.337982, -0.337745, -0.336336,
-    -0.336074, -0.334691, -0.334401, -0.333048, -0.332727, -0.331406,
-    -0.331051, -0.329767, -0.329373, -0.328128, -0.327695, -0.326491,
-    -0.326014, -0.324856, -0.324333, -0.323221, -0.322651, -0.321587,
-    -0.320968, -0.319953, -0.319285, -0.318321, -0.317601, -0.316688,
-    -0.315917, -0.315056, -0.314233, -0.313423, -0.312549, -0.311791,
-    -0.310865, -0.310158, -0.309182, -0.308524, -0.3075, -0.30689,
-    -0.305818, -0.305254, -0.304137, -0.303618, -0.302457, -0.301981,
-    -0.300779, -0.300342, -0.299102, -0.298702, -0.297426, -0.29706,
-    -0.295753, -0.295417, -0.29408, -0.293772, -0.29241, -0.292125,
-    -0.290742, -0.290476, -0.289075, -0.288825, -0.28741, -0.287172,
-    -0.285748, -0.285517, -0.284087, -0.28386, -0.282429, -0.282201,
-    -0.280773, -0.280539, -0.279118, -0.278876, -0.277466, -0.277211,
-    -0.275816, -0.275544, -0.274167, -0.273875, -0.272521, -0.272204,
-    -0.270876, -0.270532, -0.269232, -0.268858, -0.267591, -0.267182,
-    -0.26595, -0.265506, -0.264311, -0.263828, -0.262674, -0.262148,
-    -0.261037, -0.260468, -0.259401, -0.258788, -0.257765, -0.257106,
-    -0.256131, -0.255424, -0.254496, -0.253742, -0.252862, -0.25206,
-    -0.251228, -0.250377, -0.249594, -0.248695, -0.247959, -0.247013,
-    -0.246324, -0.245332, -0.244689, -0.243651, -0.243053, -0.241971,
-    -0.241416, -0.240293, -0.239777, -0.238615, -0.238138, -0.236938,
-    -0.236498, -0.235263, -0.234856, -0.233589, -0.233212, -0.231917,
-    -0.231567, -0.230247, -0.22992, -0.228578, -0.228271, -0.226911,
-    -0.226621, -0.225246, -0.224969, -0.223583, -0.223314, -0.221921,
-    -0.221658, -0.220262, -0.22, -0.218605, -0.21834, -0.216949,
-    -0.216678, -0.215296, -0.215014, -0.213644, -0.213349, -0.211994,
-    -0.211681, -0.210346, -0.210012, -0.2087, -0.208341, -0.207055,
-    -0.206669, -0.205411, -0.204995, -0.203769, -0.203319, -0.202129,
-    -0.201643, -0.200489, -0.199965, -0.198851, -0.198287, -0.197213,
-    -0.196608, -0.195577, -0.194928, -0.193941, -0.193247, -0.192305,
-    -0.191566, -0.190669, -0.189885, -0.189034, -0.188204, -0.187399,
-    -0.186523, -0.185763, -0.184842, -0.184127, -0.183161, -0.182491,
-    -0.181481, -0.180854, -0.179802, -0.179217, -0.178124, -0.177578,
-    -0.176447, -0.175938, -0.17477, -0.174298, -0.173095, -0.172655,
-    -0.171422, -0.171012, -0.169749, -0.169367, -0.168079, -0.16772,
-    -0.166409, -0.166072, -0.164742, -0.164422, -0.163076, -0.162771,
-    -0.161412, -0.161117, -0.15975, -0.159462, -0.15809, -0.157805,
-    -0.156432, -0.156146, -0.154775, -0.154485, -0.153121, -0.152822,
-    -0.151468, -0.151157, -0.149817, -0.149491, -0.148168, -0.147823,
-    -0.14652, -0.146153, -0.144874, -0.144482, -0.143229, -0.14281,
-    -0.141586, -0.141136, -0.139944, -0.13946, -0.138304, -0.137784,
-    -0.136664, -0.136107, -0.135025, -0.134429, -0.133387, -0.13275,
-    -0.13175, -0.13107, -0.130113, -0.12939, -0.128477, -0.12771,
-    -0.126841, -0.126029, -0.125205, -0.124349, -0.123569, -0.122669,
-    -0.121932, -0.120989, -0.120295, -0.119309, -0.118658, -0.117631,
-    -0.11702, -0.115953, -0.115381, -0.114275, -0.113742, -0.112599,
-    -0.112101, -0.110924, -0.110459, -0.10925, -0.108816, -0.107578,
-    -0.107171, -0.105906, -0.105525, -0.104237, -0.103877, -0.102569,
-    -0.102228, -0.100903, -0.100577, -0.0992381, -0.0989239, -0.0975753,
-    -0.0972693, -0.0959143, -0.095613, -0.0942551, -0.0939548, -0.0925977,
-    -0.0922948, -0.0909421, -0.090633, -0.0892883, -0.0889695, -0.0876363,
-    -0.0873042, -0.0859859, -0.0856372, -0.0843372, -0.0839686, -0.0826901,
-    -0.0822985, -0.0810445, -0.0806269, -0.0794003, -0.0789539, -0.0777575,
-    -0.0772797, -0.0761158, -0.0756043, -0.0744753, -0.0739278, -0.0728357,
-    -0.0722505, -0.071197, -0.0705723, -0.069559, -0.0688935, -0.0679216,
-    -0.0672142, -0.0662847, -0.0655346, -0.064648, -0.0638547, -0.0630114,
-    -0.0621747, -0.0613749, -0.0604948, -0.0597382, -0.0588152, -0.0581012,
-    -0.0571359, -0.0564638, -0.0554571, -0.0548258, -0.053779, -0.053187,
-    -0.0521017, -0.0515474, -0.0504253, -0.0499068, -0.04875, -0.0482651,
-    -0.0470758, -0.0466222, -0.0454028, -0.044978, -0.0437313, -0.0433324,
-    -0.0420612, -0.0416852, -0.0403926, -0.0400365, -0.0387257, -0.0383862,
-    -0.0370604, -0.0367341, -0.0353968, -0.0350803, -0.033735, -0.0334248,
-    -0.032075, -0.0317675, -0.0304167, -0.0301083, -0.0287602, -0.0284475,
-    -0.0271055, -0.0267848, -0.0254526, -0.0251204, -0.0238013, -0.0234543,
-    -0.0221518, -0.0217866, -0.0205038, -0.0201174, -0.0188573, -0.0184466,
-    -0.0172123, -0.0167744, -0.0155687, -0.0151009, -0.0139263, -0.0134262,
-    -0.0122851, -0.0117504, -0.010645, -0.0100737, -0.00900568, -0.00839604,
-    -0.0073672, -0.0067177, -0.00572936, -0.00503879, -0.00409204, -0.00335944,
-    -0.00245507, -0.00167979, -0.000818334, -6.66134e-16, 0.000818334, 0.00167979,
-    0.00245507, 0.00335944, 0.00409204, 0.00503879, 0.00572936, 0.0067177,
-    0.0073672, 0.00839604, 0.00900568, 0.0100737, 0.010645, 0.0117504,
-    0.0122851, 0.0134262, 0.0139263, 0.0151009, 0.0155687, 0.0167744,
-    0.0172123, 0.0184466, 0.0188573, 0.0201174, 0.0205038, 0.0217866,
-    0.0221518, 0.0234543, 0.0238013, 0.0251204, 0.0254526, 0.0267848,
-    0.0271055, 0.0284475, 0.0287602, 0.0301083, 0.0304167, 0.0317675,
-    0.032075, 0.0334248, 0.033735, 0.0350803, 0.0353968, 0.0367341,
-    0.0370604, 0.0383862, 0.0387257, 0.0400365, 0.0403926, 0.0416852,
-    0.0420612, 0.0433324, 0.0437313, 0.044978, 0.0454028, 0.0466222,
-    0.0470758, 0.0482651, 0.04875, 0.0499068, 0.0504253, 0.0515474,
-    0.0521017, 0.053187, 0.053779, 0.0548258, 0.0554571, 0.0564638,
-    0.0571359, 0.0581012, 0.0588152, 0.0597382, 0.0604948, 0.0613749,
-    0.0621747, 0.0630114, 0.0638547, 0.064648, 0.0655346, 0.0662847,
-    0.0672142, 0.0679216, 0.0688935, 0.069559, 0.0705723, 0.071197,
-    0.0722505, 0.0728357, 0.0739278, 0.0744753, 0.0756043, 0.0761158,
-    0.0772797, 0.0777575, 0.0789539, 0.0794003, 0.0806269, 0.0810445,
-    0.0822985, 0.0826901, 0.0839686, 0.0843372, 0.0856372, 0.0859859,
-    0.0873042, 0.0876363, 0.0889695, 0.0892883, 0.090633, 0.0909421,
-    0.0922948, 0.0925977, 0.0939548, 0.0942551, 0.095613, 0.0959143,
-    0.0972693, 0.0975753, 0.0989239, 0.0992381, 0.100577, 0.100903,
-    0.102228, 0.102569, 0.103877, 0.104237, 0.105525, 0.105906,
-    0.107171, 0.107578, 0.108816, 0.10925, 0.110459, 0.110924,
-    0.112101, 0.112599, 0.113742, 0.114275, 0.115381, 0.115953,
-    0.11702, 0.117631, 0.118658, 0.119309, 0.120295, 0.120989,
-    0.121932, 0.122669, 0.123569, 0.124349, 0.125205, 0.126029,
-    0.126841, 0.12771, 0.128477, 0.12939, 0.130113, 0.13107,
-    0.13175, 0.13275, 0.133387, 0.134429, 0.135025, 0.136107,
-    0.136664, 0.137784, 0.138304, 0.13946, 0.139944, 0.141136,
-    0.141586, 0.14281, 0.143229, 0.144482, 0.144874, 0.146153,
-    0.14652, 0.147823, 0.148168, 0.149491, 0.149817, 0.151157,
-    0.151468, 0.152822, 0.153121, 0.154485, 0.154775, 0.156146,
-    0.156432, 0.157805, 0.15809, 0.159462, 0.15975, 0.161117,
-    0.161412, 0.162771, 0.163076, 0.164422, 0.164742, 0.166072,
-    0.166409, 0.16772, 0.168079, 0.169367, 0.169749, 0.171012,
-    0.171422, 0.172655, 0.173095, 0.174298, 0.17477, 0.175938,
-    0.176447, 0.177578, 0.178124, 0.179217, 0.179802, 0.180854,
-    0.181481, 0.182491, 0.183161, 0.184127, 0.184842, 0.185763,
-    0.186523, 0.187399, 0.188204, 0.189034, 0.189885, 0.190669,
-    0.191566, 0.192305, 0.193247, 0.193941, 0.194928, 0.195577,
-    0.196608, 0.197213, 0.198287, 0.198851, 0.199965, 0.200489,
-    0.201643, 0.202129, 0.203319, 0.203769, 0.204995, 0.205411,
-    0.206669, 0.207055, 0.208341, 0.2087, 0.210012, 0.210346,
-    0.211681, 0.211994, 0.213349, 0.213644, 0.215014, 0.215296,
-    0.216678, 0.216949, 0.21834, 0.218605, 0.22, 0.220262,
-    0.221658, 0.221921, 0.223314, 0.223583, 0.224969, 0.225246,
-    0.226621, 0.226911, 0.228271, 0.228578, 0.22992, 0.230247,
-    0.231567, 0.231917, 0.233212, 0.233589, 0.234856, 0.235263,
-    0.236498, 0.236938, 0.238138, 0.238615, 0.239777, 0.240293,
-    0.241416, 0.241971, 0.243053, 0.243651, 0.244689, 0.245332,
-    0.246324, 0.247013, 0.247959, 0.248695, 0.249594, 0.250377,
-    0.251228, 0.25206, 0.252862, 0.253742, 0.254496, 0.255424,
-    0.256131, 0.257106, 0.257765, 0.258788, 0.259401, 0.260468,
-    0.261037, 0.262148, 0.262674, 0.263828, 0.264311, 0.265506,
-    0.26595, 0.267182, 0.267591, 0.268858, 0.269232, 0.270532,
-    0.270876, 0.272204, 0.272521, 0.273875, 0.274167, 0.275544,
-    0.275816, 0.277211, 0.277466, 0.278876, 0.279118, 0.280539,
-    0.280773, 0.282201, 0.282429, 0.28386, 0.284087, 0.285517,
-    0.285748, 0.287172, 0.28741, 0.288825, 0.289075, 0.290476,
-    0.290742, 0.292125, 0.29241, 0.293772, 0.29408, 0.295417,
-    0.295753, 0.29706, 0.297426, 0.298702, 0.299102, 0.300342,
-    0.300779, 0.301981, 0.302457, 0.303618, 0.304137, 0.305254,
-    0.305818, 0.30689, 0.3075, 0.308524, 0.309182, 0.310158,
-    0.310865, 0.311791, 0.312549, 0.313423, 0.314233, 0.315056,
-    0.315917, 0.316688, 0.317601, 0.318321, 0.319285, 0.319953,
-    0.320968, 0.321587, 0.322651, 0.323221, 0.324333, 0.324856,
-    0.326014, 0.326491, 0.327695, 0.328128, 0.329373, 0.329767,
-    0.331051, 0.331406, 0.332727, 0.333048, 0.334401, 0.334691,
-    0.336074, 0.336336, 0.337745, 0.337982, 0.339413, 0.339631,
-    0.34108, 0.341282, 0.342745, 0.342935, 0.344407, 0.34459,
-    0.346067, 0.346247, 0.347726, 0.347907, 0.349381, 0.349568,
-    0.351035, 0.351232, 0.352686, 0.352898, 0.354336, 0.354567,
-    0.355983, 0.356237, 0.357628, 0.35791, 0.359271, 0.359584,
-    0.360912, 0.36126, 0.362552, 0.362938, 0.36419, 0.364617,
-    0.365826, 0.366298, 0.367461, 0.36798, 0.369095, 0.369664,
-    0.370727, 0.371348, 0.372359, 0.373033, 0.37399, 0.374719,
-    0.375621, 0.376405, 0.377251, 0.378091, 0.378881, 0.379778,
-    0.380511, 0.381464, 0.382141, 0.38315, 0.383772, 0.384835,
-    0.385403, 0.38652, 0.387035, 0.388204, 0.388668, 0.389887,
-    0.390303, 0.391568, 0.391938, 0.393248, 0.393575, 0.394927,
-    0.395214, 0.396604, 0.396855, 0.398279, 0.398497, 0.399952,
-    0.400142, 0.401623, 0.401788, 0.403292, 0.403437, 0.404958,
-    0.405088, 0.406622, 0.406742, 0.408284, 0.408398, 0.409943,
-    0.410056, 0.4116, 0.411717, 0.413255, 0.41338, 0.414906,
-    0.415046, 0.416556, 0.416714, 0.418203, 0.418385, 0.419848,
-    0.420057, 0.421491, 0.421732, 0.423131, 0.423409, 0.424769,
-    0.425089, 0.426406, 0.426769, 0.428041, 0.428452, 0.429674,
-    0.430136, 0.431306, 0.431822, 0.432936, 0.433508, 0.434565,
-    0.435196, 0.436193, 0.436884, 0.437821, 0.438574, 0.439448,
-    0.440263, 0.441075, 0.441953, 0.442702, 0.443643, 0.444329,
-    0.445332, 0.445956, 0.447021, 0.447583, 0.44871, 0.449212,
-    0.450397, 0.450841, 0.452084, 0.452472, 0.453769, 0.454104,
-    0.455453, 0.455738, 0.457135, 0.457373, 0.458815, 0.45901,
-    0.460493, 0.460649, 0.462169, 0.462291, 0.463843, 0.463935,
-    0.465514, 0.465581, 0.467183, 0.46723, 0.46885, 0.468881,
-    0.470513, 0.470535, 0.472174, 0.472192, 0.473832, 0.473852,
-    0.475488, 0.475515, 0.47714, 0.47718, 0.47879, 0.478848,
-    0.480437, 0.480519, 0.482082, 0.482192, 0.483723, 0.483868,
-    0.485363, 0.485546, 0.487, 0.487227, 0.488634, 0.48891,
-    0.490267, 0.490595, 0.491897, 0.492282, 0.493526, 0.493971,
-    0.495153, 0.495661, 0.496779, 0.497352, 0.498403, 0.499045,
-    0.500027, 0.500738, 0.50165, 0.502432, 0.503272, 0.504126,
-    0.504894, 0.505821, 0.506516, 0.507515, 0.508138, 0.509209,
-    0.509761, 0.510903, 0.511384, 0.512596, 0.513008, 0.514287,
-    0.514634, 0.515977, 0.516261, 0.517666, 0.517889, 0.519353,
-    0.51952, 0.521038, 0.521152, 0.522721, 0.522787, 0.524401,
-    0.524424, 0.526079, 0.526064, 0.527755, 0.527707, 0.529427,
-    0.529353, 0.531096, 0.531001, 0.532763, 0.532653, 0.534426,
-    0.534308, 0.536086, 0.535966, 0.537743, 0.537627, 0.539396,
-    0.539292, 0.541046, 0.54096, 0.542693, 0.542631, 0.544337,
-    0.544305, 0.545978, 0.545983, 0.547615, 0.547663, 0.54925,
-    0.549346, 0.550882, 0.551032, 0.552511, 0.552721, 0.554138,
-    0.554412, 0.555762, 0.556105, 0.557384, 0.5578, 0.559005,
-    0.559497, 0.560624, 0.561195, 0.562241, 0.562894, 0.563858,
-    0.564595, 0.565473, 0.566296, 0.567088, 0.567998, 0.568703,
-    0.5697, 0.570318, 0.571401, 0.571933, 0.573102, 0.573549,
-    0.574803, 0.575165, 0.576502, 0.576783, 0.5782, 0.578403,
-    0.579896, 0.580024, 0.58159, 0.581647, 0.583282, 0.583273,
-    0.584972, 0.584901, 0.586659, 0.586532, 0.588343, 0.588166,
-    0.590024, 0.589803, 0.591702, 0.591443, 0.593376, 0.593087,
-    0.595046, 0.594735, 0.596713, 0.596387, 0.598376, 0.598042,
-    0.600035, 0.599702, 0.60169, 0.601365, 0.603341, 0.603033,
-    0.604988, 0.604705, 0.606631, 0.60638, 0.60827, 0.60806,
-    0.609905, 0.609743, 0.611536, 0.61143, 0.613164, 0.61312,
-    0.614788, 0.614814, 0.616409, 0.616511, 0.618027, 0.618212,
-    0.619642, 0.619914, 0.621254, 0.62162, 0.622864, 0.623327,
-    0.624472, 0.625036, 0.626079, 0.626747, 0.627684, 0.628459,
-    0.629288, 0.630172, 0.630891, 0.631885, 0.632494, 0.633599,
-    0.634097, 0.635312, 0.6357, 0.637025, 0.637305, 0.638737,
-    0.63891, 0.640447, 0.640517, 0.642155, 0.642126, 0.643862,
-    0.643737, 0.645566, 0.645351, 0.647267, 0.646968, 0.648965,
-    0.648588, 0.65066, 0.650212, 0.652351, 0.651839, 0.654037,
-    0.653471, 0.65572, 0.655108, 0.657398, 0.656748, 0.659071,
-    0.658394, 0.660739, 0.660045, 0.662402, 0.661701, 0.66406,
-    0.663362, 0.665713, 0.665029, 0.66736, 0.6667, 0.669002,
-    0.668378, 0.670639, 0.67006, 0.67227, 0.671748, 0.673896,
-    0.673441, 0.675517, 0.675139, 0.677133, 0.676842, 0.678744,
-    0.678549, 0.680351, 0.680261, 0.681954, 0.681977, 0.683552,
-    0.683697, 0.685147, 0.68542, 0.686739, 0.687146, 0.688328,
-    0.688875, 0.689914, 0.690607, 0.691498, 0.69234, 0.693081,
-    0.694074, 0.694662, 0.69581, 0.696243, 0.697546, 0.697823,
-    0.699282, 0.699404, 0.701017, 0.700986, 0.702751, 0.702569,
-    0.704483, 0.704155, 0.706213, 0.705742, 0.707941, 0.707333,
-    0.709665, 0.708927, 0.711385, 0.710525, 0.713101, 0.712128,
-    0.714812, 0.713736, 0.716518, 0.715349, 0.718219, 0.716968,
-    0.719913, 0.718594, 0.721601, 0.720226, 0.723282, 0.721865,
-    0.724955, 0.723511, 0.726622, 0.725165, 0.72828, 0.726827,
-    0.729931, 0.728497, 0.731573, 0.730175, 0.733208, 0.731861,
-    0.734834, 0.733556, 0.736451, 0.735259, 0.738061, 0.73697,
-    0.739662, 0.738689, 0.741255, 0.740417, 0.74284, 0.742152,
-    0.744418, 0.743895, 0.745988, 0.745645, 0.747551, 0.747401,
-    0.749107, 0.749165, 0.750657, 0.750934, 0.752202, 0.752709,
-    0.753741, 0.754489, 0.755275, 0.756273, 0.756805, 0.758061,
-    0.758332, 0.759852, 0.759856, 0.761645, 0.761379, 0.76344,
-    0.7629, 0.765236, 0.76442, 0.767032, 0.765942, 0.768826,
-    0.767464, 0.770619, 0.768989, 0.772409, 0.770517, 0.774196,
-    0.772049, 0.775978, 0.773586, 0.777755, 0.775129, 0.779525,
-    0.776679, 0.781287, 0.778237, 0.783042, 0.779804, 0.784787,
-    0.78138, 0.786521, 0.782968, 0.788245, 0.784567, 0.789955,
-    0.786179, 0.791653, 0.787805, 0.793337, 0.789445, 0.795005,
-    0.791101, 0.796657, 0.792774, 0.798292, 0.794465, 0.799909,
-    0.796174, 0.801507, 0.797902, 0.803085, 0.799651, 0.804641,
-    0.801422, 0.806176, 0.803216, 0.807687, 0.805033, 0.809173,
-    0.806876, 0.810634, 0.808745, 0.812067, 0.810642, 0.813472,
-    0.81257, 0.814845, 0.81453, 0.816185, 0.816524, 0.817489,
-    0.818556, 0.818753, 0.820629, 0.819974, 0.822748, 0.821146,
-    0.824919, 0.822263, 0.827149, 0.823317, 0.829448, 0.824295,
-    0.831828, 0.825184, 0.834309, 0.825962, 0.836913, 0.826599,
-    0.839677, 0.827055, 0.842652, 0.827263, 0.845917, 0.827125,
-    0.849603, 0.82647, 0.853932, 0.824998, 0.859325, 0.822105,
-    0.866677, 0.816398, 0.878287, 0.803783, 0.902286, 0.765148,
-    1, 4.44089e-16
-};
-
-static const float WAVE_SAW_030[DEFAULT_WAVELEN] = {
-    -0.7475, -1, -0.860731, -0.764093, -0.844282, -0.900568,
-    -0.841383, -0.801079, -0.846401, -0.874911, -0.835593, -0.812024,
-    -0.844396, -0.861653, -0.831507, -0.816055, -0.84155, -0.852655,
-    -0.827887, -0.817271, -0.838422, -0.845618, -0.824451, -0.817065,
-    -0.835167, -0.839645, -0.821107, -0.816042, -0.831843, -0.834315,
-    -0.817816, -0.814504, -0.828476, -0.829404, -0.814561, -0.812619,
-    -0.825078, -0.824783, -0.811333, -0.810488, -0.821657, -0.820372,
-    -0.808126, -0.808176, -0.818217, -0.816119, -0.804936, -0.805726,
-    -0.81476, -0.811989, -0.801762, -0.803166, -0.811289, -0.807957,
-    -0.798601, -0.800518, -0.807806, -0.804005, -0.795451, -0.797796,
-    -0.804311, -0.800121, -0.792313, -0.795012, -0.800806, -0.796294,
-    -0.789184, -0.792175, -0.797292, -0.792517, -0.786064, -0.789291,
-    -0.79377, -0.788785, -0.782951, -0.786365, -0.790241, -0.785091,
-    -0.779845, -0.783401, -0.786706, -0.781434, -0.776745, -0.780403,
-    -0.783165, -0.77781, -0.773649, -0.777374, -0.77962, -0.774216,
-    -0.770558, -0.774315, -0.776071, -0.77065, -0.76747, -0.771229,
-    -0.77252, -0.767111, -0.764384, -0.768117, -0.768966, -0.763597,
-    -0.7613, -0.764981, -0.765412, -0.760106, -0.758216, -0.761821,
-    -0.761857, -0.756638, -0.755132, -0.75864, -0.758304, -0.753192,
-    -0.752047, -0.755438, -0.754751, -0.749766, -0.74896, -0.752216,
-    -0.751201, -0.746359, -0.74587, -0.748975, -0.747654, -0.742971,
-    -0.742777, -0.745715, -0.74411, -0.7396, -0.73968, -0.742439,
-    -0.740571, -0.736247, -0.736578, -0.739146, -0.737037, -0.732909,
-    -0.733471, -0.735838, -0.733509, -0.729587, -0.730357, -0.732514,
-    -0.729988, -0.726279, -0.727237, -0.729177, -0.726473, -0.722984,
-    -0.724109, -0.725827, -0.722966, -0.719702, -0.720974, -0.722464,
-    -0.719467, -0.716432, -0.71783, -0.71909, -0.715977, -0.713173,
-    -0.714678, -0.715706, -0.712496, -0.709924, -0.711516, -0.712311,
-    -0.709024, -0.706685, -0.708345, -0.708908, -0.705562, -0.703454,
-    -0.705163, -0.705496, -0.702109, -0.700231, -0.701972, -0.702077,
-    -0.698668, -0.697015, -0.69877, -0.698652, -0.695236, -0.693805,
-    -0.695558, -0.695221, -0.691815, -0.6906, -0.692335, -0.691785,
-    -0.688405, -0.6874, -0.689102, -0.688345, -0.685006, -0.684203,
-    -0.685857, -0.684902, -0.681617, -0.681009, -0.682602, -0.681456,
-    -0.67824, -0.677817, -0.679336, -0.678009, -0.674872, -0.674627,
-    -0.676059, -0.674561, -0.671516, -0.671436, -0.672773, -0.671113,
-    -0.668169, -0.668246, -0.669475, -0.667665, -0.664833, -0.665055,
-    -0.666168, -0.664219, -0.661507, -0.661862, -0.662851, -0.660775,
-    -0.65819, -0.658667, -0.659525, -0.657333, -0.654883, -0.655469,
-    -0.656189, -0.653894, -0.651585, -0.652267, -0.652845, -0.650459,
-    -0.648294, -0.649062, -0.649493, -0.647028, -0.645012, -0.645852,
-    -0.646132, -0.643602, -0.641738, -0.642637, -0.642765, -0.640182,
-    -0.638471, -0.639416, -0.63939, -0.636766, -0.63521, -0.63619,
-    -0.63601, -0.633357, -0.631955, -0.632958, -0.632623, -0.629955,
-    -0.628706, -0.629718, -0.629231, -0.626559, -0.625462, -0.626473,
-    -0.625835, -0.62317, -0.622222, -0.62322, -0.622434, -0.619788,
-    -0.618986, -0.61996, -0.61903, -0.616413, -0.615754, -0.616692,
-    -0.615623, -0.613046, -0.612523, -0.613417, -0.612214, -0.609686,
-    -0.609295, -0.610135, -0.608803, -0.606334, -0.606069, -0.606845,
-    -0.60539, -0.60299, -0.602843, -0.603547, -0.601977, -0.599653,
-    -0.599618, -0.600242, -0.598564, -0.596323, -0.596392, -0.596929,
-    -0.595152, -0.593001, -0.593166, -0.593609, -0.591741, -0.589686,
-    -0.589938, -0.590283, -0.588331, -0.586378, -0.586708, -0.586949,
-    -0.584923, -0.583077, -0.583476, -0.583609, -0.581518, -0.579782,
-    -0.580242, -0.580262, -0.578116, -0.576493, -0.577004, -0.576909,
-    -0.574717, -0.57321, -0.573762, -0.573551, -0.571322, -0.569933,
-    -0.570517, -0.570187, -0.567931, -0.566661, -0.567267, -0.566818,
-    -0.564545, -0.563394, -0.564012, -0.563445, -0.561164, -0.560131,
-    -0.560753, -0.560068, -0.557788, -0.556872, -0.557488, -0.556686,
-    -0.554417, -0.553616, -0.554218, -0.553302, -0.551051, -0.550364,
-    -0.550942, -0.549915, -0.547692, -0.547114, -0.54766, -0.546525,
-    -0.544338, -0.543866, -0.544373, -0.543134, -0.54099, -0.54062,
-    -0.54108, -0.539741, -0.537648, -0.537375, -0.53778, -0.536347,
-    -0.534312, -0.534131, -0.534475, -0.532953, -0.530982, -0.530886,
-    -0.531163, -0.529558, -0.527658, -0.527642, -0.527846, -0.526164,
-    -0.52434, -0.524397, -0.524523, -0.522771, -0.521027, -0.521151,
-    -0.521194, -0.51938, -0.517721, -0.517904, -0.517859, -0.51599,
-    -0.51442, -0.514654, -0.51452, -0.512602, -0.511123, -0.511403,
-    -0.511175, -0.509217, -0.507832, -0.508148, -0.507825, -0.505834,
-    -0.504546, -0.504891, -0.504471, -0.502455, -0.501264, -0.50163,
-    -0.501112, -0.499079, -0.497987, -0.498366, -0.497749, -0.495707,
-    -0.494713, -0.495097, -0.494383, -0.492339, -0.491443, -0.491825,
-    -0.491013, -0.488976, -0.488176, -0.488548, -0.48764, -0.485616,
-    -0.484912, -0.485266, -0.484264, -0.482262, -0.48165, -0.48198,
-    -0.480887, -0.478912, -0.47839, -0.478689, -0.477507, -0.475567,
-    -0.475132, -0.475393, -0.474126, -0.472228, -0.471875, -0.472091,
-    -0.470744, -0.468893, -0.468619, -0.468785, -0.467362, -0.465563,
-    -0.465364, -0.465474, -0.463979, -0.462239, -0.462108, -0.462157,
-    -0.460596, -0.458919, -0.458852, -0.458836, -0.457214, -0.455605,
-    -0.455596, -0.45551, -0.453832, -0.452295, -0.452338, -0.452179,
-    -0.450452, -0.44899, -0.449079, -0.448843, -0.447074, -0.44569,
-    -0.445818, -0.445503, -0.443697, -0.442394, -0.442555, -0.442158,
-    -0.440323, -0.439102, -0.43929, -0.43881, -0.436951, -0.435814,
-    -0.436022, -0.435457, -0.433583, -0.43253, -0.43275, -0.432101,
-    -0.430217, -0.42925, -0.429476, -0.428741, -0.426855, -0.425972,
-    -0.426198, -0.425379, -0.423496, -0.422698, -0.422916, -0.422014,
-    -0.420142, -0.419426, -0.419631, -0.418646, -0.416791, -0.416156,
-    -0.416341, -0.415276, -0.413444, -0.412889, -0.413047, -0.411904,
-    -0.410102, -0.409623, -0.409749, -0.408531, -0.406764, -0.406358,
-    -0.406447, -0.405157, -0.40343, -0.403094, -0.40314, -0.401782,
-    -0.400101, -0.399831, -0.399828, -0.398407, -0.396776, -0.396568,
-    -0.396512, -0.395032, -0.393456, -0.393305, -0.393192, -0.391657,
-    -0.39014, -0.390041, -0.389867, -0.388283, -0.386828, -0.386776,
-    -0.386538, -0.384909, -0.383521, -0.383511, -0.383205, -0.381537,
-    -0.380218, -0.380244, -0.379868, -0.378167, -0.376919, -0.376975,
-    -0.376527, -0.374798, -0.373623, -0.373704, -0.373182, -0.371432,
-    -0.370332, -0.37043, -0.369833, -0.368068, -0.367043, -0.367154,
-    -0.366482, -0.364707, -0.363758, -0.363876, -0.363127, -0.361349,
-    -0.360476, -0.360594, -0.359769, -0.357994, -0.357197, -0.357309,
-    -0.356409, -0.354642, -0.35392, -0.35402, -0.353047, -0.351294,
-    -0.350645, -0.350728, -0.349682, -0.34795, -0.347372, -0.347432,
-    -0.346316, -0.344609, -0.3441, -0.344133, -0.342948, -0.341273,
-    -0.34083, -0.340829, -0.33958, -0.33794, -0.337561, -0.337522,
-    -0.33621, -0.334611, -0.334292, -0.33421, -0.33284, -0.331286,
-    -0.331024, -0.330894, -0.32947, -0.327965, -0.327755, -0.327575,
-    -0.326101, -0.324649, -0.324487, -0.324251, -0.322731, -0.321336,
-    -0.321217, -0.320923, -0.319363, -0.318027, -0.317947, -0.317592,
-    -0.315995, -0.314722, -0.314675, -0.314257, -0.312629, -0.311421,
-    -0.311402, -0.310918, -0.309265, -0.308123, -0.308127, -0.307576,
-    -0.305902, -0.304828, -0.30485, -0.30423, -0.302542, -0.301537,
-    -0.301571, -0.300881, -0.299184, -0.298249, -0.298289, -0.29753,
-    -0.295829, -0.294963, -0.295005, -0.294176, -0.292476, -0.29168,
-    -0.291717, -0.290819, -0.289127, -0.2884, -0.288427, -0.28746,
-    -0.285781, -0.285121, -0.285133, -0.2841, -0.282438, -0.281844,
-    -0.281836, -0.280737, -0.279099, -0.278569, -0.278535, -0.277374,
-    -0.275763, -0.275295, -0.27523, -0.274009, -0.272431, -0.272022,
-    -0.271922, -0.270643, -0.269102, -0.268749, -0.26861, -0.267277,
-    -0.265777, -0.265477, -0.265295, -0.263911, -0.262457, -0.262205,
-    -0.261976, -0.260544, -0.259139, -0.258933, -0.258653, -0.257179,
-    -0.255826, -0.25566, -0.255326, -0.253813, -0.252516, -0.252386,
-    -0.251996, -0.250449, -0.249209, -0.249112, -0.248662, -0.247086,
-    -0.245906, -0.245836, -0.245325, -0.243724, -0.242607, -0.242558,
-    -0.241984, -0.240365, -0.23931, -0.239278, -0.238641, -0.237007,
-    -0.236017, -0.235997, -0.235294, -0.233651, -0.232727, -0.232713,
-    -0.231945, -0.230298, -0.229439, -0.229426, -0.228593, -0.226948,
-    -0.226153, -0.226137, -0.225239, -0.2236, -0.22287, -0.222845,
-    -0.221883, -0.220255, -0.219589, -0.21955, -0.218525, -0.216913,
-    -0.216309, -0.216252, -0.215165, -0.213575, -0.213031, -0.21295,
-    -0.211804, -0.21024, -0.209755, -0.209645, -0.208442, -0.206908,
-    -0.206479, -0.206337, -0.205079, -0.20358, -0.203204, -0.203025,
-    -0.201716, -0.200255, -0.199929, -0.199709, -0.198352, -0.196934,
-    -0.196654, -0.19639, -0.194988, -0.193616, -0.19338, -0.193068,
-    -0.191625, -0.190302, -0.190104, -0.189742, -0.188262, -0.186991,
-    -0.186828, -0.186412, -0.1849, -0.183684, -0.183552, -0.18308,
-    -0.181539, -0.18038, -0.180273, -0.179744, -0.17818, -0.177079,
-    -0.176994, -0.176404, -0.174822, -0.173782, -0.173712, -0.173062,
-    -0.171465, -0.170487, -0.170429, -0.169717, -0.168111, -0.167195,
-    -0.167144, -0.16637, -0.16476, -0.163905, -0.163856, -0.16302,
-    -0.16141, -0.160618, -0.160566, -0.159667, -0.158064, -0.157333,
-    -0.157273, -0.156313, -0.15472, -0.15405, -0.153977, -0.152957,
-    -0.151379, -0.150769, -0.150678, -0.149599, -0.148041, -0.147489,
-    -0.147375, -0.146239, -0.144706, -0.14421, -0.14407, -0.142879,
-    -0.141375, -0.140933, -0.140762, -0.139518, -0.138047, -0.137656,
-    -0.13745, -0.136156, -0.134722, -0.134379, -0.134134, -0.132794,
-    -0.131401, -0.131103, -0.130815, -0.129432, -0.128083, -0.127827,
-    -0.127493, -0.12607, -0.124768, -0.12455, -0.124168, -0.122709,
-    -0.121457, -0.121272, -0.120839, -0.119348, -0.118149, -0.117994,
-    -0.117507, -0.115989, -0.114844, -0.114715, -0.114172, -0.112631,
-    -0.111543, -0.111434, -0.110833, -0.109274, -0.108244, -0.108151,
-    -0.107492, -0.105919, -0.104948, -0.104867, -0.104148, -0.102566,
-    -0.101655, -0.101581, -0.100802, -0.0992147, -0.0983646, -0.0982923,
-    -0.0974526, -0.0958662, -0.0950764, -0.0950012, -0.0941014, -0.0925201,
-    -0.0917903, -0.0917076, -0.0907481, -0.0891767, -0.0885062, -0.0884112,
-    -0.0873929, -0.0858362, -0.0852237, -0.0851118, -0.0840362, -0.0824986,
-    -0.0819428, -0.0818095, -0.0806781, -0.0791642, -0.0786631, -0.078504,
-    -0.0773189, -0.0758328, -0.0753844, -0.0751953, -0.0739588, -0.0725047,
-    -0.0721064, -0.0718834, -0.0705981, -0.0691799, -0.0688289, -0.0685682,
-    -0.0672371, -0.0658584, -0.0655516, -0.0652496, -0.063876, -0.0625403,
-    -0.0622743, -0.0619277, -0.0605151, -0.0592254, -0.0589966, -0.0586026,
-    -0.0571546, -0.0559138, -0.0557184, -0.0552741, -0.0537948, -0.0526055,
-    -0.0524394, -0.0519425, -0.050436, -0.0493003, -0.0491593, -0.0486078,
-    -0.0470783, -0.0459982, -0.0458778, -0.04527, -0.0437221, -0.042699,
-    -0.0425949, -0.0419294, -0.0403675, -0.0394027, -0.0393101, -0.038586,
-    -0.0370149, -0.036109, -0.0360234, -0.0352399, -0.0336643, -0.0328179,
-    -0.0327345, -0.0318915, -0.030316, -0.0295291, -0.0294432, -0.0285408,
-    -0.0269701, -0.0262424, -0.0261493, -0.0251881, -0.0236269, -0.0229577,
-    -0.0228528, -0.0218335, -0.0202865, -0.0196747, -0.0195534, -0.0184773,
-    -0.016949, -0.0163933, -0.016251, -0.0151197, -0.0136145, -0.0131131,
-    -0.0129456, -0.011761, -0.0102831, -0.00983391, -0.009637, -0.00840134,
-    -0.00695487, -0.00655551, -0.00632519, -0.00504106, -0.00362993, -0.00327762,
-    -0.00301011, -0.0016804, -0.000308258, -1.11022e-15, 0.000308258, 0.0016804,
-    0.00301011, 0.00327762, 0.00362993, 0.00504106, 0.00632519, 0.00655551,
-    0.00695487, 0.00840134, 0.009637, 0.00983391, 0.0102831, 0.011761,
-    0.0129456, 0.0131131, 0.0136145, 0.0151197, 0.016251, 0.0163933,
-    0.016949, 0.0184773, 0.0195534, 0.0196747, 0.0202865, 0.0218335,
-    0.0228528, 0.0229577, 0.0236269, 0.0251881, 0.0261493, 0.0262424,
-    0.0269701, 0.0285408, 0.0294432, 0.0295291, 0.030316, 0.0318915,
-    0.0327345, 0.0328179, 0.0336643, 0.0352399, 0.0360234, 0.036109,
-    0.0370149, 0.038586, 0.0393101, 0.0394027, 0.0403675, 0.0419294,
-    0.0425949, 0.042699, 0.0437221, 0.04527, 0.0458778, 0.0459982,
-    0.0470783, 0.0486078, 0.0491593, 0.0493003, 0.050436, 0.0519425,
-    0.0524394, 0.0526055, 0.0537948, 0.0552741, 0.0557184, 0.0559138,
-    0.0571546, 0.0586026, 0.0589966, 0.0592254, 0.0605151, 0.0619277,
-    0.0622743, 0.0625403, 0.063876, 0.0652496, 0.0655516, 0.0658584,
-    0.0672371, 0.0685682, 0.0688289, 0.0691799, 0.0705981, 0.0718834,
-    0.0721064, 0.0725047, 0.0739588, 0.0751953, 0.0753844, 0.0758328,
-    0.0773189, 0.078504, 0.0786631, 0.0791642, 0.0806781, 0.0818095,
-    0.0819428, 0.0824986, 0.0840362, 0.0851118, 0.0852237, 0.0858362,
-    0.0873929, 0.0884112, 0.0885062, 0.0891767, 0.0907481, 0.0917076,
-    0.0917903, 0.0925201, 0.0941014, 0.0950012, 0.0950764, 0.0958662,
-    0.0974526, 0.0982923, 0.0983646, 0.0992147, 0.100802, 0.101581,
-    0.101655, 0.102566, 0.104148, 0.104867, 0.104948, 0.105919,
-    0.107492, 0.108151, 0.108244, 0.109274, 0.110833, 0.111434,
-    0.111543, 0.112631, 0.114172, 0.114715, 0.114844, 0.115989,
-    0.117507, 0.117994, 0.118149, 0.119348, 0.120839, 0.121272,
-    0.121457, 0.122709, 0.124168, 0.12455, 0.124768, 0.12607,
-    0.127493, 0.127827, 0.128083, 0.129432, 0.130815, 0.131103,
-    0.131401, 0.132794, 0.134134, 0.134379, 0.134722, 0.136156,
-    0.13745, 0.137656, 0.138047, 0.139518, 0.140762, 0.140933,
-    0.141375, 0.142879, 0.14407, 0.14421, 0.144706, 0.146239,
-    0.147375, 0.147489, 0.148041, 0.149599, 0.150678, 0.150769,
-    0.151379, 0.152957, 0.153977, 0.15405, 0.15472, 0.156313,
-    0.157273, 0.157333, 0.158064, 0.159667, 0.160566, 0.160618,
-    0.16141, 0.16302, 0.163856, 0.163905, 0.16476, 0.16637,
-    0.167144, 0.167195, 0.168111, 0.169717, 0.170429, 0.170487,
-    0.171465, 0.173062, 0.173712, 0.173782, 0.174822, 0.176404,
-    0.176994, 0.177079, 0.17818, 0.179744, 0.180273, 0.18038,
-    0.181539, 0.18308, 0.183552, 0.183684, 0.1849, 0.186412,
-    0.186828, 0.186991, 0.188262, 0.189742, 0.190104, 0.190302,
-    0.191625, 0.193068, 0.19338, 0.193616, 0.194988, 0.19639,
-    0.196654, 0.196934, 0.198352, 0.199709, 0.199929, 0.200255,
-    0.201716, 0.203025, 0.203204, 0.20358, 0.205079, 0.206337,
-    0.206479, 0.206908, 0.208442, 0.209645, 0.209755, 0.21024,
-    0.211804, 0.21295, 0.213031, 0.213575, 0.215165, 0.216252,
-    0.216309, 0.216913, 0.218525, 0.21955, 0.219589, 0.220255,
-    0.221883, 0.222845, 0.22287, 0.2236, 0.225239, 0.226137,
-    0.226153, 0.226948, 0.228593, 0.229426, 0.229439, 0.230298,
-    0.231945, 0.232713, 0.232727, 0.233651, 0.235294, 0.235997,
-    0.236017, 0.237007, 0.238641, 0.239278, 0.23931, 0.240365,
-    0.241984, 0.242558, 0.242607, 0.243724, 0.245325, 0.245836,
-    0.245906, 0.247086, 0.248662, 0.249112, 0.249209, 0.250449,
-    0.251996, 0.252386, 0.252516, 0.253813, 0.255326, 0.25566,
-    0.255826, 0.257179, 0.258653, 0.258933, 0.259139, 0.260544,
-    0.261976, 0.262205, 0.262457, 0.263911, 0.265295, 0.265477,
-    0.265777, 0.267277, 0.26861, 0.268749, 0.269102, 0.270643,
-    0.271922, 0.272022, 0.272431, 0.274009, 0.27523, 0.275295,
-    0.275763, 0.277374, 0.278535, 0.278569, 0.279099, 0.280737,
-    0.281836, 0.281844, 0.282438, 0.2841, 0.285133, 0.285121,
-    0.285781, 0.28746, 0.288427, 0.2884, 0.289127, 0.290819,
-    0.291717, 0.29168, 0.292476, 0.294176, 0.295005, 0.294963,
-    0.295829, 0.29753, 0.298289, 0.298249, 0.299184, 0.300881,
-    0.301571, 0.301537, 0.302542, 0.30423, 0.30485, 0.304828,
-    0.305902, 0.307576, 0.308127, 0.308123, 0.309265, 0.310918,
-    0.311402, 0.311421, 0.312629, 0.314257, 0.314675, 0.314722,
-    0.315995, 0.317592, 0.317947, 0.318027, 0.319363, 0.320923,
-    0.321217, 0.321336, 0.322731, 0.324251, 0.324487, 0.324649,
-    0.326101, 0.327575, 0.327755, 0.327965, 0.32947, 0.330894,
-    0.331024, 0.331286, 0.33284, 0.33421, 0.334292, 0.334611,
-    0.33621, 0.337522, 0.337561, 0.33794, 0.33958, 0.340829,
-    0.34083, 0.341273, 0.342948, 0.344133, 0.3441, 0.344609,
-    0.346316, 0.347432, 0.347372, 0.34795, 0.349682, 0.350728,
-    0.350645, 0.351294, 0.353047, 0.35402, 0.35392, 0.354642,
-    0.356409, 0.357309, 0.357197, 0.357994, 0.359769, 0.360594,
-    0.360476, 0.361349, 0.363127, 0.363876, 0.363758, 0.364707,
-    0.366482, 0.367154, 0.367043, 0.368068, 0.369833, 0.37043,
-    0.370332, 0.371432, 0.373182, 0.373704, 0.373623, 0.374798,
-    0.376527, 0.376975, 0.376919, 0.378167, 0.379868, 0.380244,
-    0.380218, 0.381537, 0.383205, 0.383511, 0.383521, 0.384909,
-    0.386538, 0.386776, 0.386828, 0.388283, 0.389867, 0.390041,
-    0.39014, 0.391657, 0.393192, 0.393305, 0.393456, 0.395032,
-    0.396512, 0.396568, 0.396776, 0.398407, 0.399828, 0.399831,
-    0.400101, 0.401782, 0.40314, 0.403094, 0.40343, 0.405157,
-    0.406447, 0.406358, 0.406764, 0.408531, 0.409749, 0.409623,
-    0.410102, 0.411904, 0.413047, 0.412889, 0.413444, 0.415276,
-    0.416341, 0.416156, 0.416791, 0.418646, 0.419631, 0.419426,
-    0.420142, 0.422014, 0.422916, 0.422698, 0.423496, 0.425379,
-    0.426198, 0.425972, 0.426855, 0.428741, 0.429476, 0.42925,
-    0.430217, 0.432101, 0.43275, 0.43253, 0.433583, 0.435457,
-    0.436022, 0.435814, 0.436951, 0.43881, 0.43929, 0.439102,
-    0.440323, 0.442158, 0.442555, 0.442394, 0.443697, 0.445503,
-    0.445818, 0.44569, 0.447074, 0.448843, 0.449079, 0.44899,
-    0.450452, 0.452179, 0.452338, 0.452295, 0.453832, 0.45551,
-    0.455596, 0.455605, 0.457214, 0.458836, 0.458852, 0.458919,
-    0.460596, 0.462157, 0.462108, 0.462239, 0.463979, 0.465474,
-    0.465364, 0.465563, 0.467362, 0.468785, 0.468619, 0.468893,
-    0.470744, 0.472091, 0.471875, 0.472228, 0.474126, 0.475393,
-    0.475132, 0.475567, 0.477507, 0.478689, 0.47839, 0.478912,
-    0.480887, 0.48198, 0.48165, 0.482262, 0.484264, 0.485266,
-    0.484912, 0.485616, 0.48764, 0.488548, 0.488176, 0.488976,
-    0.491013, 0.491825, 0.491443, 0.492339, 0.494383, 0.495097,
-    0.494713, 0.495707, 0.497749, 0.498366, 0.497987, 0.499079,
-    0.501112, 0.50163, 0.501264, 0.502455, 0.504471, 0.504891,
-    0.504546, 0.505834, 0.507825, 0.508148, 0.507832, 0.509217,
-    0.511175, 0.511403, 0.511123, 0.512602, 0.51452, 0.514654,
-    0.51442, 0.51599, 0.517859, 0.517904, 0.517721, 0.51938,
-    0.521194, 0.521151, 0.521027, 0.522771, 0.524523, 0.524397,
-    0.52434, 0.526164, 0.527846, 0.527642, 0.527658, 0.529558,
-    0.531163, 0.530886, 0.530982, 0.532953, 0.534475, 0.534131,
-    0.534312, 0.536347, 0.53778, 0.537375, 0.537648, 0.539741,
-    0.54108, 0.54062, 0.54099, 0.543134, 0.544373, 0.543866,
-    0.544338, 0.546525, 0.54766, 0.547114, 0.547692, 0.549915,
-    0.550942, 0.550364, 0.551051, 0.553302, 0.554218, 0.553616,
-    0.554417, 0.556686, 0.557488, 0.556872, 0.557788, 0.560068,
-    0.560753, 0.560131, 0.561164, 0.563445, 0.564012, 0.563394,
-    0.564545, 0.566818, 0.567267, 0.566661, 0.567931, 0.570187,
-    0.570517, 0.569933, 0.571322, 0.573551, 0.573762, 0.57321,
-    0.574717, 0.576909, 0.577004, 0.576493, 0.578116, 0.580262,
-    0.580242, 0.579782, 0.581518, 0.583609, 0.583476, 0.583077,
-    0.584923, 0.586949, 0.586708, 0.586378, 0.588331, 0.590283,
-    0.589938, 0.589686, 0.591741, 0.593609, 0.593166, 0.593001,
-    0.595152, 0.596929, 0.596392, 0.596323, 0.598564, 0.600242,
-    0.599618, 0.599653, 0.601977, 0.603547, 0.602843, 0.60299,
-    0.60539, 0.606845, 0.606069, 0.606334, 0.608803, 0.610135,
-    0.609295, 0.609686, 0.612214, 0.613417, 0.612523, 0.613046,
-    0.615623, 0.616692, 0.615754, 0.616413, 0.61903, 0.61996,
-    0.618986, 0.619788, 0.622434, 0.62322, 0.622222, 0.62317,
-    0.625835, 0.626473, 0.625462, 0.626559, 0.629231, 0.629718,
-    0.628706, 0.629955, 0.632623, 0.632958, 0.631955, 0.633357,
-    0.63601, 0.63619, 0.63521, 0.636766, 0.63939, 0.639416,
-    0.638471, 0.640182, 0.642765, 0.642637, 0.641738, 0.643602,
-    0.646132, 0.645852, 0.645012, 0.647028, 0.649493, 0.649062,
-    0.648294, 0.650459, 0.652845, 0.652267, 0.651585, 0.653894,
-    0.656189, 0.655469, 0.654883, 0.657333, 0.659525, 0.658667,
-    0.65819, 0.660775, 0.662851, 0.661862, 0.661507, 0.664219,
-    0.666168, 0.665055, 0.664833, 0.667665, 0.669475, 0.668246,
-    0.668169, 0.671113, 0.672773, 0.671436, 0.671516, 0.674561,
-    0.676059, 0.674627, 0.674872, 0.678009, 0.679336, 0.677817,
-    0.67824, 0.681456, 0.682602, 0.681009, 0.681617, 0.684902,
-    0.685857, 0.684203, 0.685006, 0.688345, 0.689102, 0.6874,
-    0.688405, 0.691785, 0.692335, 0.6906, 0.691815, 0.695221,
-    0.695558, 0.693805, 0.695236, 0.698652, 0.69877, 0.697015,
-    0.698668, 0.702077, 0.701972, 0.700231, 0.702109, 0.705496,
-    0.705163, 0.703454, 0.705562, 0.708908, 0.708345, 0.706685,
-    0.709024, 0.712311, 0.711516, 0.709924, 0.712496, 0.715706,
-    0.714678, 0.713173, 0.715977, 0.71909, 0.71783, 0.716432,
-    0.719467, 0.722464, 0.720974, 0.719702, 0.722966, 0.725827,
-    0.724109, 0.722984, 0.726473, 0.729177, 0.727237, 0.726279,
-    0.729988, 0.732514, 0.730357, 0.729587, 0.733509, 0.735838,
-    0.733471, 0.732909, 0.737037, 0.739146, 0.736578, 0.736247,
-    0.740571, 0.742439, 0.73968, 0.7396, 0.74411, 0.745715,
-    0.742777, 0.742971, 0.747654, 0.748975, 0.74587, 0.746359,
-    0.751201, 0.752216, 0.74896, 0.749766, 0.754751, 0.755438,
-    0.752047, 0.753192, 0.758304, 0.75864, 0.755132, 0.756638,
-    0.761857, 0.761821, 0.758216, 0.760106, 0.765412, 0.764981,
-    0.7613, 0.763597, 0.768966, 0.768117, 0.764384, 0.767111,
-    0.77252, 0.771229, 0.76747, 0.77065, 0.776071, 0.774315,
-    0.770558, 0.774216, 0.77962, 0.777374, 0.773649, 0.77781,
-    0.783165, 0.780403, 0.776745, 0.781434, 0.786706, 0.783401,
-    0.779845, 0.785091, 0.790241, 0.786365, 0.782951, 0.788785,
-    0.79377, 0.789291, 0.786064, 0.792517, 0.797292, 0.792175,
-    0.789184, 0.796294, 0.800806, 0.795012, 0.792313, 0.800121,
-    0.804311, 0.797796, 0.795451, 0.804005, 0.807806, 0.800518,
-    0.798601, 0.807957, 0.811289, 0.803166, 0.801762, 0.811989,
-    0.81476, 0.805726, 0.804936, 0.816119, 0.818217, 0.808176,
-    0.808126, 0.820372, 0.821657, 0.810488, 0.811333, 0.824783,
-    0.825078, 0.812619, 0.814561, 0.829404, 0.828476, 0.814504,
-    0.817816, 0.834315, 0.831843, 0.816042, 0.821107, 0.839645,
-    0.835167, 0.817065, 0.824451, 0.845618, 0.838422, 0.817271,
-    0.827887, 0.852655, 0.84155, 0.816055, 0.831507, 0.861653,
-    0.844396, 0.812024, 0.835593, 0.874911, 0.846401, 0.801079,
-    0.841383, 0.900568, 0.844282, 0.764093, 0.860731, 1,
-    0.7475, -5.55112e-16
-};
-
-static const float WAVE_SAW_042[DEFAULT_WAVELEN] = {
-    -0.415654, -0.74845, -0.945317, -1, -0.950505, -0.859164,
-    -0.785167, -0.762096, -0.789748, -0.842067, -0.885396, -0.897035,
-    -0.875159, -0.836463, -0.804476, -0.795861, -0.812181, -0.840859,
-    -0.863773, -0.867968, -0.852396, -0.827346, -0.807577, -0.80354,
-    -0.8158, -0.835517, -0.85024, -0.851322, -0.83861, -0.819939,
-    -0.806073, -0.804294, -0.814411, -0.829329, -0.839577, -0.838945,
-    -0.827912, -0.813002, -0.802659, -0.802226, -0.81098, -0.822855,
-    -0.830248, -0.828533, -0.818639, -0.806253, -0.798278, -0.798733,
-    -0.806513, -0.816252, -0.821643, -0.819188, -0.810142, -0.799597,
-    -0.79334, -0.794419, -0.801448, -0.809577, -0.813475, -0.810489,
-    -0.802119, -0.792999, -0.788054, -0.789588, -0.796, -0.802855,
-    -0.805588, -0.802211, -0.794409, -0.786439, -0.782536, -0.784408,
-    -0.790292, -0.7961, -0.797895, -0.794226, -0.786919, -0.779909,
-    -0.776856, -0.778979, -0.784397, -0.789319, -0.79034, -0.786454,
-    -0.77959, -0.773402, -0.771057, -0.773367, -0.778361, -0.782517,
-    -0.782888, -0.778842, -0.772386, -0.766915, -0.765168, -0.767613,
-    -0.772214, -0.775696, -0.775514, -0.771356, -0.76528, -0.760445,
-    -0.75921, -0.761747, -0.765979, -0.768859, -0.768203, -0.763971,
-    -0.758254, -0.75399, -0.753196, -0.75579, -0.75967, -0.762008,
-    -0.760941, -0.756669, -0.751296, -0.747548, -0.747136, -0.749755,
-    -0.753299, -0.755144, -0.753722, -0.749438, -0.744396, -0.741119,
-    -0.741038, -0.743656, -0.746875, -0.748269, -0.746539, -0.742267,
-    -0.737545, -0.7347, -0.734906, -0.7375, -0.740404, -0.741383,
-    -0.739386, -0.73515, -0.730738, -0.728291, -0.728745, -0.731294,
-    -0.733891, -0.734489, -0.732262, -0.72808, -0.723971, -0.72189,
-    -0.722557, -0.725043, -0.727342, -0.727588, -0.725163, -0.721053,
-    -0.717238, -0.715496, -0.716345, -0.71875, -0.720759, -0.72068,
-    -0.718088, -0.714066, -0.710537, -0.709107, -0.71011, -0.71242,
-    -0.714146, -0.713766, -0.711035, -0.707114, -0.703865, -0.702724,
-    -0.703853, -0.706055, -0.707506, -0.706849, -0.704003, -0.700197,
-    -0.697219, -0.696344, -0.697575, -0.699658, -0.70084, -0.699928,
-    -0.696992, -0.693311, -0.690597, -0.689966, -0.691277, -0.69323,
-    -0.694152, -0.693006, -0.690001, -0.686455, -0.683997, -0.68359,
-    -0.684959, -0.686772, -0.687442, -0.686083, -0.683029, -0.679627,
-    -0.677417, -0.677214, -0.678622, -0.680288, -0.680714, -0.67916,
-    -0.676077, -0.672826, -0.670856, -0.670837, -0.672266, -0.673777,
-    -0.673968, -0.672239, -0.669144, -0.66605, -0.664311, -0.664458,
-    -0.66589, -0.667241, -0.667206, -0.66532, -0.66223, -0.659298,
-    -0.657781, -0.658076, -0.659495, -0.660682, -0.66043, -0.658405,
-    -0.655335, -0.65257, -0.651264, -0.65169, -0.653081, -0.6541,
-    -0.653641, -0.651494, -0.648459, -0.645863, -0.644759, -0.645299,
-    -0.646649, -0.647497, -0.646841, -0.644589, -0.641602, -0.639178,
-    -0.638265, -0.638902, -0.640198, -0.640873, -0.640031, -0.637689,
-    -0.634763, -0.632512, -0.631781, -0.632499, -0.633728, -0.634231,
-    -0.633213, -0.630798, -0.627943, -0.625865, -0.625303, -0.626088,
-    -0.62724, -0.62757, -0.626388, -0.623914, -0.621141, -0.619235,
-    -0.618833, -0.619668, -0.620733, -0.620892, -0.619557, -0.617039,
-    -0.614358, -0.612622, -0.612367, -0.613239, -0.614209, -0.614198,
-    -0.612721, -0.610174, -0.607592, -0.606024, -0.605906, -0.6068,
-    -0.607667, -0.607489, -0.605882, -0.603319, -0.600844, -0.599441,
-    -0.599447, -0.60035, -0.601107, -0.600766, -0.599041, -0.596475,
-    -0.594113, -0.592872, -0.592989, -0.593889, -0.59453, -0.59403,
-    -0.592199, -0.589643, -0.5874, -0.586314, -0.586532, -0.587417,
-    -0.587936, -0.587283, -0.585357, -0.582822, -0.580702, -0.579768,
-    -0.580074, -0.580932, -0.581326, -0.580525, -0.578517, -0.576014,
-    -0.574021, -0.573232, -0.573614, -0.574435, -0.574701, -0.573757,
-    -0.571679, -0.569219, -0.567355, -0.566705, -0.567151, -0.567924,
-    -0.56806, -0.566981, -0.564844, -0.562437, -0.560705, -0.560185,
-    -0.560685, -0.561401, -0.561404, -0.560198, -0.558014, -0.555668,
-    -0.554068, -0.553673, -0.554214, -0.554864, -0.554734, -0.553409,
-    -0.551189, -0.548912, -0.547446, -0.547166, -0.547736, -0.548313,
-    -0.548051, -0.546614, -0.54437, -0.542171, -0.540836, -0.540664,
-    -0.541253, -0.541749, -0.541356, -0.539815, -0.537558, -0.535443,
-    -0.534238, -0.534165, -0.534762, -0.535171, -0.534648, -0.533013,
-    -0.530753, -0.528728, -0.527652, -0.527669, -0.528264, -0.52858,
-    -0.52793, -0.52621, -0.523957, -0.522027, -0.521077, -0.521174,
-    -0.521756, -0.521975, -0.521201, -0.519405, -0.51717, -0.51534,
-    -0.514511, -0.514679, -0.51524, -0.515357, -0.514463, -0.5126,
-    -0.510392, -0.508665, -0.507955, -0.508184, -0.508714, -0.508725,
-    -0.507716, -0.505797, -0.503624, -0.502003, -0.501406, -0.501688,
-    -0.502177, -0.502082, -0.500962, -0.498995, -0.496866, -0.495354,
-    -0.494865, -0.495189, -0.495631, -0.495425, -0.494201, -0.492197,
-    -0.49012, -0.488717, -0.48833, -0.488687, -0.489073, -0.488758,
-    -0.487434, -0.485401, -0.483384, -0.482092, -0.4818, -0.482181,
-    -0.482504, -0.482078, -0.480662, -0.478611, -0.476659, -0.475478,
-    -0.475275, -0.47567, -0.475924, -0.475388, -0.473886, -0.471826,
-    -0.469945, -0.468874, -0.468753, -0.469153, -0.469333, -0.468687,
-    -0.467108, -0.465046, -0.463243, -0.46228, -0.462234, -0.46263,
-    -0.46273, -0.461977, -0.460327, -0.458274, -0.456553, -0.455696,
-    -0.455716, -0.4561, -0.456116, -0.455258, -0.453545, -0.451508,
-    -0.449873, -0.44912, -0.4492, -0.449562, -0.449491, -0.448531,
-    -0.446762, -0.444751, -0.443205, -0.442552, -0.442683, -0.443016,
-    -0.442854, -0.441796, -0.439981, -0.438002, -0.436548, -0.435992,
-    -0.436165, -0.436462, -0.436206, -0.435054, -0.4332, -0.431261,
-    -0.429902, -0.429438, -0.429645, -0.429899, -0.429548, -0.428306,
-    -0.426422, -0.42453, -0.423267, -0.422889, -0.423123, -0.423327,
-    -0.422879, -0.421553, -0.419647, -0.417808, -0.416641, -0.416346,
-    -0.416597, -0.416745, -0.416201, -0.414795, -0.412875, -0.411096,
-    -0.410026, -0.409806, -0.410067, -0.410153, -0.409512, -0.408034,
-    -0.406108, -0.404393, -0.403419, -0.40327, -0.403533, -0.403551,
-    -0.402815, -0.40127, -0.399346, -0.397701, -0.396822, -0.396736,
-    -0.396993, -0.396939, -0.396109, -0.394504, -0.39259, -0.391019,
-    -0.390233, -0.390203, -0.390447, -0.390317, -0.389395, -0.387736,
-    -0.38584, -0.384346, -0.383651, -0.383672, -0.383894, -0.383686,
-    -0.382674, -0.380969, -0.379097, -0.377684, -0.377077, -0.37714,
-    -0.377334, -0.377044, -0.375945, -0.374202, -0.372362, -0.371032,
-    -0.370509, -0.370608, -0.370767, -0.370392, -0.369211, -0.367436,
-    -0.365634, -0.364389, -0.363947, -0.364074, -0.364192, -0.363731,
-    -0.362471, -0.360672, -0.358914, -0.357755, -0.35739, -0.357537,
-    -0.357608, -0.357061, -0.355727, -0.35391, -0.352203, -0.351131,
-    -0.350838, -0.350998, -0.351016, -0.350381, -0.348979, -0.347152,
-    -0.3455, -0.344516, -0.344289, -0.344455, -0.344415, -0.343693,
-    -0.342227, -0.340398, -0.338807, -0.337909, -0.337743, -0.337908,
-    -0.337805, -0.336997, -0.335473, -0.333649, -0.332122, -0.33131,
-    -0.331199, -0.331355, -0.331186, -0.330293, -0.328717, -0.326905,
-    -0.325447, -0.324718, -0.324657, -0.324798, -0.324557, -0.323582,
-    -0.32196, -0.320166, -0.31878, -0.318134, -0.318115, -0.318234,
-    -0.31792, -0.316864, -0.315202, -0.313434, -0.312123, -0.311556,
-    -0.311573, -0.311663, -0.311274, -0.31014, -0.308445, -0.306709,
-    -0.305475, -0.304984, -0.30503, -0.305086, -0.304618, -0.30341,
-    -0.301689, -0.299991, -0.298835, -0.298417, -0.298486, -0.298501,
-    -0.297954, -0.296676, -0.294936, -0.29328, -0.292205, -0.291854,
-    -0.291939, -0.291909, -0.291282, -0.289937, -0.288184, -0.286578,
-    -0.285582, -0.285296, -0.28539, -0.285308, -0.284601, -0.283195,
-    -0.281436, -0.279883, -0.278968, -0.278741, -0.278837, -0.2787,
-    -0.277912, -0.276449, -0.274692, -0.273196, -0.272361, -0.272188,
-    -0.272281, -0.272083, -0.271216, -0.269702, -0.267952, -0.266518,
-    -0.265762, -0.265638, -0.265719, -0.265458, -0.264512, -0.262953,
-    -0.261217, -0.259849, -0.25917, -0.259088, -0.259152, -0.258824,
-    -0.257802, -0.256203, -0.254487, -0.253187, -0.252584, -0.252539,
-    -0.25258, -0.252182, -0.251086, -0.249453, -0.247764, -0.246535,
-    -0.246004, -0.24599, -0.246001, -0.245531, -0.244364, -0.242703,
-    -0.241046, -0.23989, -0.239429, -0.23944, -0.239416, -0.238872,
-    -0.237637, -0.235955, -0.234336, -0.233254, -0.232859, -0.232888,
-    -0.232824, -0.232205, -0.230906, -0.229208, -0.227633, -0.226626,
-    -0.226294, -0.226334, -0.226224, -0.22553, -0.224171, -0.222464,
-    -0.220937, -0.220006, -0.219732, -0.219778, -0.219617, -0.218847,
-    -0.217432, -0.215723, -0.214248, -0.213394, -0.213172, -0.213218,
-    -0.213002, -0.212157, -0.210691, -0.208986, -0.207568, -0.206788,
-    -0.206615, -0.206653, -0.20638, -0.20546, -0.203948, -0.202254,
-    -0.200895, -0.20019, -0.20006, -0.200085, -0.199749, -0.198756,
-    -0.197204, -0.195526, -0.194231, -0.193597, -0.193506, -0.193511,
-    -0.193111, -0.192046, -0.190459, -0.188803, -0.187574, -0.187011,
-    -0.186952, -0.186932, -0.186464, -0.18533, -0.183714, -0.182086,
-    -0.180926, -0.180431, -0.180397, -0.180347, -0.179809, -0.178609,
-    -0.176969, -0.175375, -0.174285, -0.173855, -0.173842, -0.173755,
-    -0.173147, -0.171884, -0.170226, -0.168671, -0.167653, -0.167283,
-    -0.167285, -0.167157, -0.166476, -0.165154, -0.163485, -0.161974,
-    -0.161028, -0.160716, -0.160726, -0.160551, -0.159799, -0.158421,
-    -0.156747, -0.155283, -0.15441, -0.154152, -0.154163, -0.153939,
-    -0.153113, -0.151684, -0.150012, -0.148601, -0.1478, -0.14759,
-    -0.147598, -0.147319, -0.146421, -0.144946, -0.14328, -0.141925,
-    -0.141196, -0.14103, -0.141028, -0.140691, -0.139723, -0.138206,
-    -0.136553, -0.135258, -0.134599, -0.134472, -0.134454, -0.134056,
-    -0.133018, -0.131464, -0.12983, -0.128598, -0.128008, -0.127915,
-    -0.127875, -0.127413, -0.126307, -0.124723, -0.123113, -0.121946,
-    -0.121422, -0.121357, -0.12129, -0.120762, -0.11959, -0.117981,
-    -0.116401, -0.115301, -0.114842, -0.114799, -0.1147, -0.114103,
-    -0.112869, -0.11124, -0.109696, -0.108664, -0.108266, -0.10824,
-    -0.108103, -0.107437, -0.106144, -0.104501, -0.102997, -0.102035,
-    -0.101694, -0.101679, -0.1015, -0.100763, -0.0994145, -0.097764,
-    -0.0963044, -0.0954133, -0.0951264, -0.0951161, -0.0948892, -0.0940826,
-    -0.0926819, -0.0910295, -0.0896191, -0.0887986, -0.0885613, -0.0885499,
-    -0.0882718, -0.0873948, -0.0859466, -0.0842983, -0.082941, -0.0821907,
-    -0.0819985, -0.0819801, -0.0816471, -0.0807002, -0.0792092, -0.0775709,
-    -0.0762704, -0.0755894, -0.0754376, -0.0754063, -0.0750149, -0.0739992,
-    -0.0724704, -0.0708479, -0.0696072, -0.0689943, -0.0688777, -0.0688279,
-    -0.0683752, -0.0672923, -0.0657308, -0.0641296, -0.0629516, -0.0624049,
-    -0.0623184, -0.0622444, -0.0617279, -0.0605798, -0.0589909, -0.0574167,
-    -0.0563036, -0.0558209, -0.055759, -0.0556555, -0.0550729, -0.0538622,
-    -0.0522515, -0.0507094, -0.0496632, -0.0492418, -0.0491989, -0.0490606,
-    -0.0484105, -0.0471399, -0.0455131, -0.0440082, -0.0430302, -0.0426671,
-    -0.0426375, -0.0424595, -0.0417406, -0.0404135, -0.0387763, -0.0373135,
-    -0.0364046, -0.0360963, -0.036074, -0.0358517, -0.0350635, -0.0336835,
-    -0.0320418, -0.0306255, -0.0297862, -0.0295287, -0.0295081, -0.0292371,
-    -0.0283792, -0.0269505, -0.0253101, -0.0239445, -0.0231748, -0.0229639,
-    -0.022939, -0.0226155, -0.0216882, -0.020215, -0.0185819, -0.0172707,
-    -0.01657, -0.0164012, -0.0163663, -0.0159865, -0.0149906, -0.0134777,
-    -0.0118575, -0.0106042, -0.00997157, -0.00984013, -0.00978931, -0.00935009,
-    -0.00828688, -0.00673917, -0.00513762, -0.00394526, -0.00337915, -0.00327994,
-    -0.00320767, -0.00270619, -0.00157733, 6.66134e-16, 0.00157733, 0.00270619,
-    0.00320767, 0.00327994, 0.00337915, 0.00394526, 0.00513762, 0.00673917,
-    0.00828688, 0.00935009, 0.00978931, 0.00984013, 0.00997157, 0.0106042,
-    0.0118575, 0.0134777, 0.0149906, 0.0159865, 0.0163663, 0.0164012,
-    0.01657, 0.0172707, 0.0185819, 0.020215, 0.0216882, 0.0226155,
-    0.022939, 0.0229639, 0.0231748, 0.0239445, 0.0253101, 0.0269505,
-    0.0283792, 0.0292371, 0.0295081, 0.0295287, 0.0297862, 0.0306255,
-    0.0320418, 0.0336835, 0.0350635, 0.0358517, 0.036074, 0.0360963,
-    0.0364046, 0.0373135, 0.0387763, 0.0404135, 0.0417406, 0.0424595,
-    0.0426375, 0.0426671, 0.0430302, 0.0440082, 0.0455131, 0.0471399,
-    0.0484105, 0.0490606, 0.0491989, 0.0492418, 0.0496632, 0.0507094,
-    0.0522515, 0.0538622, 0.0550729, 0.0556555, 0.055759, 0.0558209,
-    0.0563036, 0.0574167, 0.0589909, 0.0605798, 0.0617279, 0.0622444,
-    0.0623184, 0.0624049, 0.0629516, 0.0641296, 0.0657308, 0.0672923,
-    0.0683752, 0.0688279, 0.0688777, 0.0689943, 0.0696072, 0.0708479,
-    0.0724704, 0.0739992, 0.0750149, 0.0754063, 0.0754376, 0.0755894,
-    0.0762704, 0.0775709, 0.0792092, 0.0807002, 0.0816471, 0.0819801,
-    0.0819985, 0.0821907, 0.082941, 0.0842983, 0.0859466, 0.0873948,
-    0.0882718, 0.0885499, 0.0885613, 0.0887986, 0.0896191, 0.0910295,
-    0.0926819, 0.0940826, 0.0948892, 0.0951161, 0.0951264, 0.0954133,
-    0.0963044, 0.097764, 0.0994145, 0.100763, 0.1015, 0.101679,
-    0.101694, 0.102035, 0.102997, 0.104501, 0.106144, 0.107437,
-    0.108103, 0.10824, 0.108266, 0.108664, 0.109696, 0.11124,
-    0.112869, 0.114103, 0.1147, 0.114799, 0.114842, 0.115301,
-    0.116401, 0.117981, 0.11959, 0.120762, 0.12129, 0.121357,
-    0.121422, 0.121946, 0.123113, 0.124723, 0.126307, 0.127413,
-    0.127875, 0.127915, 0.128008, 0.128598, 0.12983, 0.131464,
-    0.133018, 0.134056, 0.134454, 0.134472, 0.134599, 0.135258,
-    0.136553, 0.138206, 0.139723, 0.140691, 0.141028, 0.14103,
-    0.141196, 0.141925, 0.14328, 0.144946, 0.146421, 0.147319,
-    0.147598, 0.14759, 0.1478, 0.148601, 0.150012, 0.151684,
-    0.153113, 0.153939, 0.154163, 0.154152, 0.15441, 0.155283,
-    0.156747, 0.158421, 0.159799, 0.160551, 0.160726, 0.160716,
-    0.161028, 0.161974, 0.163485, 0.165154, 0.166476, 0.167157,
-    0.167285, 0.167283, 0.167653, 0.168671, 0.170226, 0.171884,
-    0.173147, 0.173755, 0.173842, 0.173855, 0.174285, 0.175375,
-    0.176969, 0.178609, 0.179809, 0.180347, 0.180397, 0.180431,
-    0.180926, 0.182086, 0.183714, 0.18533, 0.186464, 0.186932,
-    0.186952, 0.187011, 0.187574, 0.188803, 0.190459, 0.192046,
-    0.193111, 0.193511, 0.193506, 0.193597, 0.194231, 0.195526,
-    0.197204, 0.198756, 0.199749, 0.200085, 0.20006, 0.20019,
-    0.200895, 0.202254, 0.203948, 0.20546, 0.20638, 0.206653,
-    0.206615, 0.206788, 0.207568, 0.208986, 0.210691, 0.212157,
-    0.213002, 0.213218, 0.213172, 0.213394, 0.214248, 0.215723,
-    0.217432, 0.218847, 0.219617, 0.219778, 0.219732, 0.220006,
-    0.220937, 0.222464, 0.224171, 0.22553, 0.226224, 0.226334,
-    0.226294, 0.226626, 0.227633, 0.229208, 0.230906, 0.232205,
-    0.232824, 0.232888, 0.232859, 0.233254, 0.234336, 0.235955,
-    0.237637, 0.238872, 0.239416, 0.23944, 0.239429, 0.23989,
-    0.241046, 0.242703, 0.244364, 0.245531, 0.246001, 0.24599,
-    0.246004, 0.246535, 0.247764, 0.249453, 0.251086, 0.252182,
-    0.25258, 0.252539, 0.252584, 0.253187, 0.254487, 0.256203,
-    0.257802, 0.258824, 0.259152, 0.259088, 0.25917, 0.259849,
-    0.261217, 0.262953, 0.264512, 0.265458, 0.265719, 0.265638,
-    0.265762, 0.266518, 0.267952, 0.269702, 0.271216, 0.272083,
-    0.272281, 0.272188, 0.272361, 0.273196, 0.274692, 0.276449,
-    0.277912, 0.2787, 0.278837, 0.278741, 0.278968, 0.279883,
-    0.281436, 0.283195, 0.284601, 0.285308, 0.28539, 0.285296,
-    0.285582, 0.286578, 0.288184, 0.289937, 0.291282, 0.291909,
-    0.291939, 0.291854, 0.292205, 0.29328, 0.294936, 0.296676,
-    0.297954, 0.298501, 0.298486, 0.298417, 0.298835, 0.299991,
-    0.301689, 0.30341, 0.304618, 0.305086, 0.30503, 0.304984,
-    0.305475, 0.306709, 0.308445, 0.31014, 0.311274, 0.311663,
-    0.311573, 0.311556, 0.312123, 0.313434, 0.315202, 0.316864,
-    0.31792, 0.318234, 0.318115, 0.318134, 0.31878, 0.320166,
-    0.32196, 0.323582, 0.324557, 0.324798, 0.324657, 0.324718,
-    0.325447, 0.326905, 0.328717, 0.330293, 0.331186, 0.331355,
-    0.331199, 0.33131, 0.332122, 0.333649, 0.335473, 0.336997,
-    0.337805, 0.337908, 0.337743, 0.337909, 0.338807, 0.340398,
-    0.342227, 0.343693, 0.344415, 0.344455, 0.344289, 0.344516,
-    0.3455, 0.347152, 0.348979, 0.350381, 0.351016, 0.350998,
-    0.350838, 0.351131, 0.352203, 0.35391, 0.355727, 0.357061,
-    0.357608, 0.357537, 0.35739, 0.357755, 0.358914, 0.360672,
-    0.362471, 0.363731, 0.364192, 0.364074, 0.363947, 0.364389,
-    0.365634, 0.367436, 0.369211, 0.370392, 0.370767, 0.370608,
-    0.370509, 0.371032, 0.372362, 0.374202, 0.375945, 0.377044,
-    0.377334, 0.37714, 0.377077, 0.377684, 0.379097, 0.380969,
-    0.382674, 0.383686, 0.383894, 0.383672, 0.383651, 0.384346,
-    0.38584, 0.387736, 0.389395, 0.390317, 0.390447, 0.390203,
-    0.390233, 0.391019, 0.39259, 0.394504, 0.396109, 0.396939,
-    0.396993, 0.396736, 0.396822, 0.397701, 0.399346, 0.40127,
-    0.402815, 0.403551, 0.403533, 0.40327, 0.403419, 0.404393,
-    0.406108, 0.408034, 0.409512, 0.410153, 0.410067, 0.409806,
-    0.410026, 0.411096, 0.412875, 0.414795, 0.416201, 0.416745,
-    0.416597, 0.416346, 0.416641, 0.417808, 0.419647, 0.421553,
-    0.422879, 0.423327, 0.423123, 0.422889, 0.423267, 0.42453,
-    0.426422, 0.428306, 0.429548, 0.429899, 0.429645, 0.429438,
-    0.429902, 0.431261, 0.4332, 0.435054, 0.436206, 0.436462,
-    0.436165, 0.435992, 0.436548, 0.438002, 0.439981, 0.441796,
-    0.442854, 0.443016, 0.442683, 0.442552, 0.443205, 0.444751,
-    0.446762, 0.448531, 0.449491, 0.449562, 0.4492, 0.44912,
-    0.449873, 0.451508, 0.453545, 0.455258, 0.456116, 0.4561,
-    0.455716, 0.455696, 0.456553, 0.458274, 0.460327, 0.461977,
-    0.46273, 0.46263, 0.462234, 0.46228, 0.463243, 0.465046,
-    0.467108, 0.468687, 0.469333, 0.469153, 0.468753, 0.468874,
-    0.469945, 0.471826, 0.473886, 0.475388, 0.475924, 0.47567,
-    0.475275, 0.475478, 0.476659, 0.478611, 0.480662, 0.482078,
-    0.482504, 0.482181, 0.4818, 0.482092, 0.483384, 0.485401,
-    0.487434, 0.488758, 0.489073, 0.488687, 0.48833, 0.488717,
-    0.49012, 0.492197, 0.494201, 0.495425, 0.495631, 0.495189,
-    0.494865, 0.495354, 0.496866, 0.498995, 0.500962, 0.502082,
-    0.502177, 0.501688, 0.501406, 0.502003, 0.503624, 0.505797,
-    0.507716, 0.508725, 0.508714, 0.508184, 0.507955, 0.508665,
-    0.510392, 0.5126, 0.514463, 0.515357, 0.51524, 0.514679,
-    0.514511, 0.51534, 0.51717, 0.519405, 0.521201, 0.521975,
-    0.521756, 0.521174, 0.521077, 0.522027, 0.523957, 0.52621,
-    0.52793, 0.52858, 0.528264, 0.527669, 0.527652, 0.528728,
-    0.530753, 0.533013, 0.534648, 0.535171, 0.534762, 0.534165,
-    0.534238, 0.535443, 0.537558, 0.539815, 0.541356, 0.541749,
-    0.541253, 0.540664, 0.540836, 0.542171, 0.54437, 0.546614,
-    0.548051, 0.548313, 0.547736, 0.547166, 0.547446, 0.548912,
-    0.551189, 0.553409, 0.554734, 0.554864, 0.554214, 0.553673,
-    0.554068, 0.555668, 0.558014, 0.560198, 0.561404, 0.561401,
-    0.560685, 0.560185, 0.560705, 0.562437, 0.564844, 0.566981,
-    0.56806, 0.567924, 0.567151, 0.566705, 0.567355, 0.569219,
-    0.571679, 0.573757, 0.574701, 0.574435, 0.573614, 0.573232,
-    0.574021, 0.576014, 0.578517, 0.580525, 0.581326, 0.580932,
-    0.580074, 0.579768, 0.580702, 0.582822, 0.585357, 0.587283,
-    0.587936, 0.587417, 0.586532, 0.586314, 0.5874, 0.589643,
-    0.592199, 0.59403, 0.59453, 0.593889, 0.592989, 0.592872,
-    0.594113, 0.596475, 0.599041, 0.600766, 0.601107, 0.60035,
-    0.599447, 0.599441, 0.600844, 0.603319, 0.605882, 0.607489,
-    0.607667, 0.6068, 0.605906, 0.606024, 0.607592, 0.610174,
-    0.612721, 0.614198, 0.614209, 0.613239, 0.612367, 0.612622,
-    0.614358, 0.617039, 0.619557, 0.620892, 0.620733, 0.619668,
-    0.618833, 0.619235, 0.621141, 0.623914, 0.626388, 0.62757,
-    0.62724, 0.626088, 0.625303, 0.625865, 0.627943, 0.630798,
-    0.633213, 0.634231, 0.633728, 0.632499, 0.631781, 0.632512,
-    0.634763, 0.637689, 0.640031, 0.640873, 0.640198, 0.638902,
-    0.638265, 0.639178, 0.641602, 0.644589, 0.646841, 0.647497,
-    0.646649, 0.645299, 0.644759, 0.645863, 0.648459, 0.651494,
-    0.653641, 0.6541, 0.653081, 0.65169, 0.651264, 0.65257,
-    0.655335, 0.658405, 0.66043, 0.660682, 0.659495, 0.658076,
-    0.657781, 0.659298, 0.66223, 0.66532, 0.667206, 0.667241,
-    0.66589, 0.664458, 0.664311, 0.66605, 0.669144, 0.672239,
-    0.673968, 0.673777, 0.672266, 0.670837, 0.670856, 0.672826,
-    0.676077, 0.67916, 0.680714, 0.680288, 0.678622, 0.677214,
-    0.677417, 0.679627, 0.683029, 0.686083, 0.687442, 0.686772,
-    0.684959, 0.68359, 0.683997, 0.686455, 0.690001, 0.693006,
-    0.694152, 0.69323, 0.691277, 0.689966, 0.690597, 0.693311,
-    0.696992, 0.699928, 0.70084, 0.699658, 0.697575, 0.696344,
-    0.697219, 0.700197, 0.704003, 0.706849, 0.707506, 0.706055,
-    0.703853, 0.702724, 0.703865, 0.707114, 0.711035, 0.713766,
-    0.714146, 0.71242, 0.71011, 0.709107, 0.710537, 0.714066,
-    0.718088, 0.72068, 0.720759, 0.71875, 0.716345, 0.715496,
-    0.717238, 0.721053, 0.725163, 0.727588, 0.727342, 0.725043,
-    0.722557, 0.72189, 0.723971, 0.72808, 0.732262, 0.734489,
-    0.733891, 0.731294, 0.728745, 0.728291, 0.730738, 0.73515,
-    0.739386, 0.741383, 0.740404, 0.7375, 0.734906, 0.7347,
-    0.737545, 0.742267, 0.746539, 0.748269, 0.746875, 0.743656,
-    0.741038, 0.741119, 0.744396, 0.749438, 0.753722, 0.755144,
-    0.753299, 0.749755, 0.747136, 0.747548, 0.751296, 0.756669,
-    0.760941, 0.762008, 0.75967, 0.75579, 0.753196, 0.75399,
-    0.758254, 0.763971, 0.768203, 0.768859, 0.765979, 0.761747,
-    0.75921, 0.760445, 0.76528, 0.771356, 0.775514, 0.775696,
-    0.772214, 0.767613, 0.765168, 0.766915, 0.772386, 0.778842,
-    0.782888, 0.782517, 0.778361, 0.773367, 0.771057, 0.773402,
-    0.77959, 0.786454, 0.79034, 0.789319, 0.784397, 0.778979,
-    0.776856, 0.779909, 0.786919, 0.794226, 0.797895, 0.7961,
-    0.790292, 0.784408, 0.782536, 0.786439, 0.794409, 0.802211,
-    0.805588, 0.802855, 0.796, 0.789588, 0.788054, 0.792999,
-    0.802119, 0.810489, 0.813475, 0.809577, 0.801448, 0.794419,
-    0.79334, 0.799597, 0.810142, 0.819188, 0.821643, 0.816252,
-    0.806513, 0.798733, 0.798278, 0.806253, 0.818639, 0.828533,
-    0.830248, 0.822855, 0.81098, 0.802226, 0.802659, 0.813002,
-    0.827912, 0.838945, 0.839577, 0.829329, 0.814411, 0.804294,
-    0.806073, 0.819939, 0.83861, 0.851322, 0.85024, 0.835517,
-    0.8158, 0.80354, 0.807577, 0.827346, 0.852396, 0.867968,
-    0.863773, 0.840859, 0.812181, 0.795861, 0.804476, 0.836463,
-    0.875159, 0.897035, 0.885396, 0.842067, 0.789748, 0.762096,
-    0.785167, 0.859164, 0.950505, 1, 0.945317, 0.74845,
-    0.415654, 8.88178e-16
-};
-
-static const float WAVE_SAW_054[DEFAULT_WAVELEN] = {
-    -0.213269, -0.41544, -0.596451, -0.748198, -0.865239, -0.94521,
-    -0.988898, -1, -0.984567, -0.950242, -0.90536, -0.858033,
-    -0.815325, -0.782596, -0.763097, -0.757843, -0.765751, -0.784033,
-    -0.808748, -0.835458, -0.859885, -0.878488, -0.88889, -0.890114,
-    -0.8826, -0.868035, -0.849008, -0.828577, -0.809786, -0.795227,
-    -0.786691, -0.784958, -0.789745, -0.799814, -0.813208, -0.827587,
-    -0.840592, -0.850196, -0.854992, -0.854369, -0.848562, -0.838576,
-    -0.826001, -0.812742, -0.800722, -0.791592, -0.786492, -0.785903,
-    -0.789602, -0.796725, -0.80592, -0.815576, -0.824071, -0.830023,
-    -0.832487, -0.831084, -0.826038, -0.818119, -0.808511, -0.798614,
-    -0.789827, -0.783332, -0.779924, -0.779901, -0.783034, -0.788618,
-    -0.795595, -0.802725, -0.808781, -0.812735, -0.813912, -0.81208,
-    -0.807475, -0.800753, -0.792873, -0.784951, -0.778077, -0.773153,
-    -0.770759, -0.771071, -0.773847, -0.778469, -0.784056, -0.789594,
-    -0.794104, -0.796787, -0.797144, -0.795045, -0.790738, -0.784808,
-    -0.778077, -0.771469, -0.765873, -0.762001, -0.760284, -0.760815,
-    -0.763336, -0.767289, -0.771909, -0.776339, -0.779772, -0.781569,
-    -0.781356, -0.779076, -0.774991, -0.769636, -0.763734, -0.758076,
-    -0.753402, -0.750288, -0.749058, -0.749738, -0.752063, -0.755515,
-    -0.759413, -0.763019, -0.765651, -0.766791, -0.766158, -0.763752,
-    -0.759843, -0.754932, -0.749665, -0.744732, -0.740762, -0.738224,
-    -0.73736, -0.738147, -0.74031, -0.743365, -0.746697, -0.749658,
-    -0.751666, -0.752297, -0.751343, -0.748846, -0.745087, -0.740535,
-    -0.735776, -0.731422, -0.72801, -0.725927, -0.725346, -0.72621,
-    -0.728234, -0.730962, -0.733833, -0.73627, -0.737775, -0.737997,
-    -0.73679, -0.734229, -0.730601, -0.726349, -0.722013, -0.718135,
-    -0.71518, -0.713465, -0.713112, -0.714029, -0.71593, -0.718378,
-    -0.72086, -0.722862, -0.72395, -0.723837, -0.722425, -0.71982,
-    -0.71631, -0.712319, -0.708342, -0.704866, -0.702294, -0.700885,
-    -0.700716, -0.701669, -0.703456, -0.705661, -0.707808, -0.709437,
-    -0.710172, -0.709778, -0.708201, -0.705567, -0.702167, -0.698406,
-    -0.694742, -0.691612, -0.689367, -0.688216, -0.688198, -0.689173,
-    -0.690853, -0.69284, -0.694693, -0.695999, -0.696429, -0.695798,
-    -0.694083, -0.691433, -0.688137, -0.684584, -0.681197, -0.678371,
-    -0.67641, -0.675479, -0.675585, -0.676571, -0.678149, -0.679937,
-    -0.681528, -0.682548, -0.682713, -0.681878, -0.68005, -0.677394,
-    -0.674199, -0.670836, -0.667698, -0.665142, -0.663429, -0.662688,
-    -0.662896, -0.663884, -0.665363, -0.666968, -0.668322, -0.669086,
-    -0.669018, -0.668006, -0.666085, -0.663432, -0.660334, -0.657147,
-    -0.654237, -0.651923, -0.65043, -0.649853, -0.650147, -0.651128,
-    -0.652509, -0.653944, -0.655081, -0.655615, -0.655339, -0.654173,
-    -0.652176, -0.649533, -0.646531, -0.64351, -0.640808, -0.638713,
-    -0.637416, -0.636983, -0.637346, -0.638313, -0.639599, -0.640874,
-    -0.64181, -0.642135, -0.641673, -0.640373, -0.638313, -0.635688,
-    -0.632781, -0.629915, -0.627406, -0.625511, -0.624391, -0.624084,
-    -0.624503, -0.625448, -0.62664, -0.627763, -0.628513, -0.628646,
-    -0.628017, -0.6266, -0.624489, -0.621889, -0.619076, -0.616359,
-    -0.61403, -0.612318, -0.611356, -0.611159, -0.611623, -0.612541,
-    -0.61364, -0.614617, -0.615192, -0.61515, -0.61437, -0.61285,
-    -0.6107, -0.608129, -0.60541, -0.602835, -0.600675, -0.599132,
-    -0.598314, -0.598213, -0.59871, -0.599597, -0.600602, -0.60144,
-    -0.601852, -0.601646, -0.60073, -0.599121, -0.596941, -0.594405,
-    -0.591779, -0.589341, -0.587339, -0.585953, -0.585265, -0.585247,
-    -0.58577, -0.586619, -0.587531, -0.588235, -0.588492, -0.588137,
-    -0.587097, -0.585409, -0.58321, -0.580713, -0.578179, -0.575873,
-    -0.574022, -0.57278, -0.572209, -0.572264, -0.572803, -0.573611,
-    -0.57443, -0.575004, -0.575116, -0.574621, -0.573469, -0.571714,
-    -0.569502, -0.567049, -0.564608, -0.56243, -0.56072, -0.559613,
-    -0.559149, -0.559266, -0.559814, -0.560575, -0.561302, -0.561751,
-    -0.561724, -0.561099, -0.559846, -0.558034, -0.555817, -0.553412,
-    -0.551064, -0.549008, -0.547433, -0.546452, -0.546083, -0.546253,
-    -0.546803, -0.547515, -0.548148, -0.548476, -0.548318, -0.547573,
-    -0.546228, -0.544367, -0.542152, -0.539798, -0.537543, -0.535607,
-    -0.53416, -0.533295, -0.533013, -0.533228, -0.533772, -0.534431,
-    -0.534972, -0.535182, -0.534899, -0.534042, -0.532615, -0.530714,
-    -0.528506, -0.526207, -0.524045, -0.522225, -0.520899, -0.520142,
-    -0.519939, -0.520189, -0.520723, -0.521325, -0.521774, -0.521869,
-    -0.521469, -0.520507, -0.519006, -0.517072, -0.514879, -0.512637,
-    -0.510567, -0.50886, -0.50765, -0.506993, -0.50686, -0.507139,
-    -0.507656, -0.508199, -0.508556, -0.50854, -0.508027, -0.506968,
-    -0.505402, -0.503443, -0.501268, -0.499088, -0.49711, -0.495512,
-    -0.494411, -0.493847, -0.493776, -0.494077, -0.494572, -0.495054,
-    -0.495318, -0.495195, -0.494575, -0.493427, -0.491802, -0.489825,
-    -0.487675, -0.485557, -0.48367, -0.482179, -0.481182, -0.480704,
-    -0.480688, -0.481004, -0.481472, -0.48189, -0.482063, -0.481835,
-    -0.481113, -0.479883, -0.478207, -0.476218, -0.474097, -0.472044,
-    -0.470249, -0.46886, -0.467962, -0.467563, -0.467595, -0.467919,
-    -0.468356, -0.468708, -0.46879, -0.468461, -0.467643, -0.466337,
-    -0.464617, -0.462622, -0.460534, -0.458548, -0.456844, -0.455555,
-    -0.45475, -0.454424, -0.454496, -0.454824, -0.455226, -0.455509,
-    -0.455501, -0.455074, -0.454165, -0.452789, -0.451032, -0.449037,
-    -0.446986, -0.44507, -0.443455, -0.442262, -0.441546, -0.441287,
-    -0.441393, -0.441718, -0.44208, -0.442294, -0.442197, -0.441674,
-    -0.44068, -0.439241, -0.437452, -0.435462, -0.433453, -0.431607,
-    -0.430081, -0.428981, -0.428349, -0.42815, -0.428284, -0.428601,
-    -0.428921, -0.429063, -0.428877, -0.428264, -0.427189, -0.425692,
-    -0.423878, -0.421899, -0.419934, -0.41816, -0.416721, -0.415712,
-    -0.415157, -0.415013, -0.41517, -0.415474, -0.415747, -0.415817,
-    -0.415544, -0.414842, -0.413692, -0.412143, -0.410309, -0.408346,
-    -0.406429, -0.404728, -0.403376, -0.402453, -0.401971, -0.401876,
-    -0.402049, -0.402335, -0.402559, -0.402556, -0.402197, -0.401411,
-    -0.400189, -0.398595, -0.396747, -0.394804, -0.392938, -0.39131,
-    -0.390043, -0.389203, -0.38879, -0.388738, -0.388923, -0.389186,
-    -0.389358, -0.389281, -0.388838, -0.38797, -0.386682, -0.385048,
-    -0.383191, -0.381272, -0.37946, -0.377907, -0.376723, -0.375963,
-    -0.375613, -0.375598, -0.375789, -0.376027, -0.376143, -0.375991,
-    -0.375466, -0.37452, -0.373172, -0.371502, -0.369642, -0.367752,
-    -0.365996, -0.364517, -0.363415, -0.362731, -0.36244, -0.362457,
-    -0.362649, -0.362856, -0.362915, -0.362689, -0.362083, -0.361062,
-    -0.359658, -0.357959, -0.3561, -0.354242, -0.352545, -0.351141,
-    -0.350119, -0.349507, -0.34927, -0.349314, -0.349502, -0.349674,
-    -0.349674, -0.349373, -0.348688, -0.347597, -0.346141, -0.344417,
-    -0.342566, -0.340744, -0.339106, -0.337777, -0.336833, -0.33629,
-    -0.336102, -0.336168, -0.336347, -0.336481, -0.336421, -0.336045,
-    -0.335283, -0.334125, -0.332622, -0.330879, -0.329038, -0.327256,
-    -0.32568, -0.324426, -0.323557, -0.323079, -0.322936, -0.323018,
-    -0.323184, -0.323278, -0.323154, -0.322704, -0.321868, -0.320647,
-    -0.319102, -0.317345, -0.315519, -0.31378, -0.312267, -0.311087,
-    -0.310291, -0.309874, -0.309771, -0.309865, -0.310014, -0.310063,
-    -0.309875, -0.309351, -0.308443, -0.307163, -0.305581, -0.303814,
-    -0.302008, -0.300315, -0.298866, -0.297759, -0.297035, -0.296675,
-    -0.296606, -0.296708, -0.296835, -0.296837, -0.296584, -0.295987,
-    -0.29501, -0.293674, -0.29206, -0.290288, -0.288506, -0.28686,
-    -0.285478, -0.284443, -0.283787, -0.28348, -0.283442, -0.283546,
-    -0.283647, -0.2836, -0.283281, -0.282612, -0.281568, -0.280181,
-    -0.278539, -0.276767, -0.275012, -0.273417, -0.272101, -0.271138,
-    -0.270547, -0.27029, -0.270276, -0.270379, -0.270451, -0.270351,
-    -0.269966, -0.269227, -0.268118, -0.266684, -0.265018, -0.263251,
-    -0.261527, -0.259985, -0.258736, -0.257843, -0.257314, -0.257102,
-    -0.25711, -0.257206, -0.257245, -0.257092, -0.25664, -0.255831,
-    -0.254661, -0.253184, -0.2515, -0.249741, -0.248051, -0.246565,
-    -0.245382, -0.244558, -0.244089, -0.243918, -0.243942, -0.244028,
-    -0.24403, -0.243821, -0.243302, -0.242425, -0.241198, -0.239681,
-    -0.237983, -0.236236, -0.234585, -0.233155, -0.23204, -0.231282,
-    -0.23087, -0.230736, -0.230772, -0.230843, -0.230806, -0.230539,
-    -0.229953, -0.22901, -0.227728, -0.226177, -0.224468, -0.222739,
-    -0.221128, -0.219757, -0.218709, -0.218016, -0.217656, -0.217556,
-    -0.2176, -0.217651, -0.217573, -0.217246, -0.216593, -0.215587,
-    -0.214253, -0.212671, -0.210957, -0.209248, -0.207681, -0.20637,
-    -0.205388, -0.204758, -0.204448, -0.204376, -0.204424, -0.204453,
-    -0.204329, -0.203942, -0.203223, -0.202154, -0.200773, -0.199164,
-    -0.197449, -0.195765, -0.194244, -0.192993, -0.192077, -0.191509,
-    -0.191245, -0.191198, -0.191244, -0.191247, -0.191075, -0.190627,
-    -0.189843, -0.188714, -0.187288, -0.185657, -0.183945, -0.182289,
-    -0.180817, -0.179628, -0.178777, -0.178267, -0.178046, -0.178019,
-    -0.17806, -0.178033, -0.177812, -0.177301, -0.176452, -0.175266,
-    -0.173799, -0.17215, -0.170445, -0.168821, -0.1674, -0.166273,
-    -0.165487, -0.165032, -0.16485, -0.16484, -0.164871, -0.164811,
-    -0.164538, -0.163965, -0.163052, -0.161812, -0.160308, -0.158644,
-    -0.156951, -0.155361, -0.153993, -0.152929, -0.152206, -0.151804,
-    -0.151658, -0.151659, -0.151678, -0.151581, -0.151254, -0.150618,
-    -0.149643, -0.148351, -0.146813, -0.14514, -0.143461, -0.14191,
-    -0.140596, -0.139596, -0.138934, -0.138583, -0.138468, -0.138477,
-    -0.138478, -0.138342, -0.137959, -0.137261, -0.136225, -0.134884,
-    -0.133316, -0.131637, -0.129978, -0.128467, -0.12721, -0.126273,
-    -0.12567, -0.125367, -0.12528, -0.125292, -0.125273, -0.125094,
-    -0.124655, -0.123893, -0.122798, -0.121411, -0.119818, -0.118137,
-    -0.116501, -0.115034, -0.113834, -0.112959, -0.112415, -0.112156,
-    -0.112093, -0.112105, -0.112061, -0.111837, -0.111339, -0.110515,
-    -0.109363, -0.107933, -0.106318, -0.10464, -0.10303, -0.101609,
-    -0.100469, -0.0996563, -0.0991681, -0.0989503, -0.0989068, -0.0989144,
-    -0.098842, -0.0985711, -0.098014, -0.0971278, -0.0959209, -0.0944515,
-    -0.0928187, -0.0911469, -0.0895668, -0.0881945, -0.0871137, -0.0863627,
-    -0.0859284, -0.0857485, -0.0857209, -0.08572, -0.0856161, -0.0852954,
-    -0.0846782, -0.0837309, -0.0824712, -0.0809657, -0.0793189, -0.0776577,
-    -0.0761108, -0.0747892, -0.0737688, -0.0730786, -0.0726958, -0.0725503,
-    -0.0725346, -0.0725213, -0.0723825, -0.0720101, -0.0713322, -0.0703247,
-    -0.0690147, -0.0674765, -0.0658199, -0.064173, -0.0626625, -0.0613937,
-    -0.0604342, -0.0598035, -0.0594698, -0.0593551, -0.0593473, -0.0593177,
-    -0.059141, -0.0587149, -0.057976, -0.0569095, -0.0555518, -0.0539846,
-    -0.052322, -0.0506934, -0.0492223, -0.048008, -0.0471097, -0.0465373,
-    -0.0462499, -0.0461625, -0.0461586, -0.0461089, -0.0458913, -0.0454099,
-    -0.0446097, -0.0434857, -0.042083, -0.0404904, -0.038826, -0.0372192,
-    -0.0357905, -0.0346323, -0.0337952, -0.0332795, -0.0330357, -0.0329718,
-    -0.0329678, -0.0328943, -0.0326331, -0.0320948, -0.0312335, -0.0300535,
-    -0.0286088, -0.0269945, -0.0253323, -0.0237511, -0.0223673, -0.0212666,
-    -0.0204905, -0.0200299, -0.0198267, -0.0197825, -0.0197744, -0.0196736,
-    -0.019366, -0.0187696, -0.0178475, -0.0166134, -0.0151297, -0.0134975,
-    -0.0118414, -0.0102893, -0.0089531, -0.00791106, -0.00719556, -0.00678814,
-    -0.00662235, -0.00659408, -0.00657784, -0.00644624, -0.00608987, -0.00543436,
-    -0.00445191, -0.00316567, -0.00164609, -1.11022e-16, 0.00164609, 0.00316567,
-    0.00445191, 0.00543436, 0.00608987, 0.00644624, 0.00657784, 0.00659408,
-    0.00662235, 0.00678814, 0.00719556, 0.00791106, 0.0089531, 0.0102893,
-    0.0118414, 0.0134975, 0.0151297, 0.0166134, 0.0178475, 0.0187696,
-    0.019366, 0.0196736, 0.0197744, 0.0197825, 0.0198267, 0.0200299,
-    0.0204905, 0.0212666, 0.0223673, 0.0237511, 0.0253323, 0.0269945,
-    0.0286088, 0.0300535, 0.0312335, 0.0320948, 0.0326331, 0.0328943,
-    0.0329678, 0.0329718, 0.0330357, 0.0332795, 0.0337952, 0.0346323,
-    0.0357905, 0.0372192, 0.038826, 0.0404904, 0.042083, 0.0434857,
-    0.0446097, 0.0454099, 0.0458913, 0.0461089, 0.0461586, 0.0461625,
-    0.0462499, 0.0465373, 0.0471097, 0.048008, 0.0492223, 0.0506934,
-    0.052322, 0.0539846, 0.0555518, 0.0569095, 0.057976, 0.0587149,
-    0.059141, 0.0593177, 0.0593473, 0.0593551, 0.0594698, 0.0598035,
-    0.0604342, 0.0613937, 0.0626625, 0.064173, 0.0658199, 0.0674765,
-    0.0690147, 0.0703247, 0.0713322, 0.0720101, 0.0723825, 0.0725213,
-    0.0725346, 0.0725503, 0.0726958, 0.0730786, 0.0737688, 0.0747892,
-    0.0761108, 0.0776577, 0.0793189, 0.0809657, 0.0824712, 0.0837309,
-    0.0846782, 0.0852954, 0.0856161, 0.08572, 0.0857209, 0.0857485,
-    0.0859284, 0.0863627, 0.0871137, 0.0881945, 0.0895668, 0.0911469,
-    0.0928187, 0.0944515, 0.0959209, 0.0971278, 0.098014, 0.0985711,
-    0.098842, 0.0989144, 0.0989068, 0.0989503, 0.0991681, 0.0996563,
-    0.100469, 0.101609, 0.10303, 0.10464, 0.106318, 0.107933,
-    0.109363, 0.110515, 0.111339, 0.111837, 0.112061, 0.112105,
-    0.112093, 0.112156, 0.112415, 0.112959, 0.113834, 0.115034,
-    0.116501, 0.118137, 0.119818, 0.121411, 0.122798, 0.123893,
-    0.124655, 0.125094, 0.125273, 0.125292, 0.12528, 0.125367,
-    0.12567, 0.126273, 0.12721, 0.128467, 0.129978, 0.131637,
-    0.133316, 0.134884, 0.136225, 0.137261, 0.137959, 0.138342,
-    0.138478, 0.138477, 0.138468, 0.138583, 0.138934, 0.139596,
-    0.140596, 0.14191, 0.143461, 0.14514, 0.146813, 0.148351,
-    0.149643, 0.150618, 0.151254, 0.151581, 0.151678, 0.151659,
-    0.151658, 0.151804, 0.152206, 0.152929, 0.153993, 0.155361,
-    0.156951, 0.158644, 0.160308, 0.161812, 0.163052, 0.163965,
-    0.164538, 0.164811, 0.164871, 0.16484, 0.16485, 0.165032,
-    0.165487, 0.166273, 0.1674, 0.168821, 0.170445, 0.17215,
-    0.173799, 0.175266, 0.176452, 0.177301, 0.177812, 0.178033,
-    0.17806, 0.178019, 0.178046, 0.178267, 0.178777, 0.179628,
-    0.180817, 0.182289, 0.183945, 0.185657, 0.187288, 0.188714,
-    0.189843, 0.190627, 0.191075, 0.191247, 0.191244, 0.191198,
-    0.191245, 0.191509, 0.192077, 0.192993, 0.194244, 0.195765,
-    0.197449, 0.199164, 0.200773, 0.202154, 0.203223, 0.203942,
-    0.204329, 0.204453, 0.204424, 0.204376, 0.204448, 0.204758,
-    0.205388, 0.20637, 0.207681, 0.209248, 0.210957, 0.212671,
-    0.214253, 0.215587, 0.216593, 0.217246, 0.217573, 0.217651,
-    0.2176, 0.217556, 0.217656, 0.218016, 0.218709, 0.219757,
-    0.221128, 0.222739, 0.224468, 0.226177, 0.227728, 0.22901,
-    0.229953, 0.230539, 0.230806, 0.230843, 0.230772, 0.230736,
-    0.23087, 0.231282, 0.23204, 0.233155, 0.234585, 0.236236,
-    0.237983, 0.239681, 0.241198, 0.242425, 0.243302, 0.243821,
-    0.24403, 0.244028, 0.243942, 0.243918, 0.244089, 0.244558,
-    0.245382, 0.246565, 0.248051, 0.249741, 0.2515, 0.253184,
-    0.254661, 0.255831, 0.25664, 0.257092, 0.257245, 0.257206,
-    0.25711, 0.257102, 0.257314, 0.257843, 0.258736, 0.259985,
-    0.261527, 0.263251, 0.265018, 0.266684, 0.268118, 0.269227,
-    0.269966, 0.270351, 0.270451, 0.270379, 0.270276, 0.27029,
-    0.270547, 0.271138, 0.272101, 0.273417, 0.275012, 0.276767,
-    0.278539, 0.280181, 0.281568, 0.282612, 0.283281, 0.2836,
-    0.283647, 0.283546, 0.283442, 0.28348, 0.283787, 0.284443,
-    0.285478, 0.28686, 0.288506, 0.290288, 0.29206, 0.293674,
-    0.29501, 0.295987, 0.296584, 0.296837, 0.296835, 0.296708,
-    0.296606, 0.296675, 0.297035, 0.297759, 0.298866, 0.300315,
-    0.302008, 0.303814, 0.305581, 0.307163, 0.308443, 0.309351,
-    0.309875, 0.310063, 0.310014, 0.309865, 0.309771, 0.309874,
-    0.310291, 0.311087, 0.312267, 0.31378, 0.315519, 0.317345,
-    0.319102, 0.320647, 0.321868, 0.322704, 0.323154, 0.323278,
-    0.323184, 0.323018, 0.322936, 0.323079, 0.323557, 0.324426,
-    0.32568, 0.327256, 0.329038, 0.330879, 0.332622, 0.334125,
-    0.335283, 0.336045, 0.336421, 0.336481, 0.336347, 0.336168,
-    0.336102, 0.33629, 0.336833, 0.337777, 0.339106, 0.340744,
-    0.342566, 0.344417, 0.346141, 0.347597, 0.348688, 0.349373,
-    0.349674, 0.349674, 0.349502, 0.349314, 0.34927, 0.349507,
-    0.350119, 0.351141, 0.352545, 0.354242, 0.3561, 0.357959,
-    0.359658, 0.361062, 0.362083, 0.362689, 0.362915, 0.362856,
-    0.362649, 0.362457, 0.36244, 0.362731, 0.363415, 0.364517,
-    0.365996, 0.367752, 0.369642, 0.371502, 0.373172, 0.37452,
-    0.375466, 0.375991, 0.376143, 0.376027, 0.375789, 0.375598,
-    0.375613, 0.375963, 0.376723, 0.377907, 0.37946, 0.381272,
-    0.383191, 0.385048, 0.386682, 0.38797, 0.388838, 0.389281,
-    0.389358, 0.389186, 0.388923, 0.388738, 0.38879, 0.389203,
-    0.390043, 0.39131, 0.392938, 0.394804, 0.396747, 0.398595,
-    0.400189, 0.401411, 0.402197, 0.402556, 0.402559, 0.402335,
-    0.402049, 0.401876, 0.401971, 0.402453, 0.403376, 0.404728,
-    0.406429, 0.408346, 0.410309, 0.412143, 0.413692, 0.414842,
-    0.415544, 0.415817, 0.415747, 0.415474, 0.41517, 0.415013,
-    0.415157, 0.415712, 0.416721, 0.41816, 0.419934, 0.421899,
-    0.423878, 0.425692, 0.427189, 0.428264, 0.428877, 0.429063,
-    0.428921, 0.428601, 0.428284, 0.42815, 0.428349, 0.428981,
-    0.430081, 0.431607, 0.433453, 0.435462, 0.437452, 0.439241,
-    0.44068, 0.441674, 0.442197, 0.442294, 0.44208, 0.441718,
-    0.441393, 0.441287, 0.441546, 0.442262, 0.443455, 0.44507,
-    0.446986, 0.449037, 0.451032, 0.452789, 0.454165, 0.455074,
-    0.455501, 0.455509, 0.455226, 0.454824, 0.454496, 0.454424,
-    0.45475, 0.455555, 0.456844, 0.458548, 0.460534, 0.462622,
-    0.464617, 0.466337, 0.467643, 0.468461, 0.46879, 0.468708,
-    0.468356, 0.467919, 0.467595, 0.467563, 0.467962, 0.46886,
-    0.470249, 0.472044, 0.474097, 0.476218, 0.478207, 0.479883,
-    0.481113, 0.481835, 0.482063, 0.48189, 0.481472, 0.481004,
-    0.480688, 0.480704, 0.481182, 0.482179, 0.48367, 0.485557,
-    0.487675, 0.489825, 0.491802, 0.493427, 0.494575, 0.495195,
-    0.495318, 0.495054, 0.494572, 0.494077, 0.493776, 0.493847,
-    0.494411, 0.495512, 0.49711, 0.499088, 0.501268, 0.503443,
-    0.505402, 0.506968, 0.508027, 0.50854, 0.508556, 0.508199,
-    0.507656, 0.507139, 0.50686, 0.506993, 0.50765, 0.50886,
-    0.510567, 0.512637, 0.514879, 0.517072, 0.519006, 0.520507,
-    0.521469, 0.521869, 0.521774, 0.521325, 0.520723, 0.520189,
-    0.519939, 0.520142, 0.520899, 0.522225, 0.524045, 0.526207,
-    0.528506, 0.530714, 0.532615, 0.534042, 0.534899, 0.535182,
-    0.534972, 0.534431, 0.533772, 0.533228, 0.533013, 0.533295,
-    0.53416, 0.535607, 0.537543, 0.539798, 0.542152, 0.544367,
-    0.546228, 0.547573, 0.548318, 0.548476, 0.548148, 0.547515,
-    0.546803, 0.546253, 0.546083, 0.546452, 0.547433, 0.549008,
-    0.551064, 0.553412, 0.555817, 0.558034, 0.559846, 0.561099,
-    0.561724, 0.561751, 0.561302, 0.560575, 0.559814, 0.559266,
-    0.559149, 0.559613, 0.56072, 0.56243, 0.564608, 0.567049,
-    0.569502, 0.571714, 0.573469, 0.574621, 0.575116, 0.575004,
-    0.57443, 0.573611, 0.572803, 0.572264, 0.572209, 0.57278,
-    0.574022, 0.575873, 0.578179, 0.580713, 0.58321, 0.585409,
-    0.587097, 0.588137, 0.588492, 0.588235, 0.587531, 0.586619,
-    0.58577, 0.585247, 0.585265, 0.585953, 0.587339, 0.589341,
-    0.591779, 0.594405, 0.596941, 0.599121, 0.60073, 0.601646,
-    0.601852, 0.60144, 0.600602, 0.599597, 0.59871, 0.598213,
-    0.598314, 0.599132, 0.600675, 0.602835, 0.60541, 0.608129,
-    0.6107, 0.61285, 0.61437, 0.61515, 0.615192, 0.614617,
-    0.61364, 0.612541, 0.611623, 0.611159, 0.611356, 0.612318,
-    0.61403, 0.616359, 0.619076, 0.621889, 0.624489, 0.6266,
-    0.628017, 0.628646, 0.628513, 0.627763, 0.62664, 0.625448,
-    0.624503, 0.624084, 0.624391, 0.625511, 0.627406, 0.629915,
-    0.632781, 0.635688, 0.638313, 0.640373, 0.641673, 0.642135,
-    0.64181, 0.640874, 0.639599, 0.638313, 0.637346, 0.636983,
-    0.637416, 0.638713, 0.640808, 0.64351, 0.646531, 0.649533,
-    0.652176, 0.654173, 0.655339, 0.655615, 0.655081, 0.653944,
-    0.652509, 0.651128, 0.650147, 0.649853, 0.65043, 0.651923,
-    0.654237, 0.657147, 0.660334, 0.663432, 0.666085, 0.668006,
-    0.669018, 0.669086, 0.668322, 0.666968, 0.665363, 0.663884,
-    0.662896, 0.662688, 0.663429, 0.665142, 0.667698, 0.670836,
-    0.674199, 0.677394, 0.68005, 0.681878, 0.682713, 0.682548,
-    0.681528, 0.679937, 0.678149, 0.676571, 0.675585, 0.675479,
-    0.67641, 0.678371, 0.681197, 0.684584, 0.688137, 0.691433,
-    0.694083, 0.695798, 0.696429, 0.695999, 0.694693, 0.69284,
-    0.690853, 0.689173, 0.688198, 0.688216, 0.689367, 0.691612,
-    0.694742, 0.698406, 0.702167, 0.705567, 0.708201, 0.709778,
-    0.710172, 0.709437, 0.707808, 0.705661, 0.703456, 0.701669,
-    0.700716, 0.700885, 0.702294, 0.704866, 0.708342, 0.712319,
-    0.71631, 0.71982, 0.722425, 0.723837, 0.72395, 0.722862,
-    0.72086, 0.718378, 0.71593, 0.714029, 0.713112, 0.713465,
-    0.71518, 0.718135, 0.722013, 0.726349, 0.730601, 0.734229,
-    0.73679, 0.737997, 0.737775, 0.73627, 0.733833, 0.730962,
-    0.728234, 0.72621, 0.725346, 0.725927, 0.72801, 0.731422,
-    0.735776, 0.740535, 0.745087, 0.748846, 0.751343, 0.752297,
-    0.751666, 0.749658, 0.746697, 0.743365, 0.74031, 0.738147,
-    0.73736, 0.738224, 0.740762, 0.744732, 0.749665, 0.754932,
-    0.759843, 0.763752, 0.766158, 0.766791, 0.765651, 0.763019,
-    0.759413, 0.755515, 0.752063, 0.749738, 0.749058, 0.750288,
-    0.753402, 0.758076, 0.763734, 0.769636, 0.774991, 0.779076,
-    0.781356, 0.781569, 0.779772, 0.776339, 0.771909, 0.767289,
-    0.763336, 0.760815, 0.760284, 0.762001, 0.765873, 0.771469,
-    0.778077, 0.784808, 0.790738, 0.795045, 0.797144, 0.796787,
-    0.794104, 0.789594, 0.784056, 0.778469, 0.773847, 0.771071,
-    0.770759, 0.773153, 0.778077, 0.784951, 0.792873, 0.800753,
-    0.807475, 0.81208, 0.813912, 0.812735, 0.808781, 0.802725,
-    0.795595, 0.788618, 0.783034, 0.779901, 0.779924, 0.783332,
-    0.789827, 0.798614, 0.808511, 0.818119, 0.826038, 0.831084,
-    0.832487, 0.830023, 0.824071, 0.815576, 0.80592, 0.796725,
-    0.789602, 0.785903, 0.786492, 0.791592, 0.800722, 0.812742,
-    0.826001, 0.838576, 0.848562, 0.854369, 0.854992, 0.850196,
-    0.840592, 0.827587, 0.813208, 0.799814, 0.789745, 0.784958,
-    0.786691, 0.795227, 0.809786, 0.828577, 0.849008, 0.868035,
-    0.8826, 0.890114, 0.88889, 0.878488, 0.859885, 0.835458,
-    0.808748, 0.784033, 0.765751, 0.757843, 0.763097, 0.782596,
-    0.815325, 0.858033, 0.90536, 0.950242, 0.984567, 1,
-    0.988898, 0.94521, 0.865239, 0.748198, 0.596451, 0.41544,
-    0.213269, 0
-};
-
-static const float WAVE_SAW_066[DEFAULT_WAVELEN] = {
-    -0.107216, -0.213028, -0.316061, -0.415011, -0.508663, -0.595928,
-    -0.675864, -0.747694, -0.810823, -0.864852, -0.909578, -0.944995,
-    -0.971292, -0.988841, -0.998181, -1, -0.995113, -0.984436,
-    -0.968959, -0.949717, -0.927759, -0.904126, -0.879817, -0.855765,
-    -0.832821, -0.811725, -0.793099, -0.777433, -0.765077, -0.756243,
-    -0.750999, -0.749286, -0.750919, -0.755604, -0.762956, -0.772514,
-    -0.783761, -0.79615, -0.809117, -0.822109, -0.834597, -0.846098,
-    -0.856188, -0.864515, -0.870808, -0.874885, -0.876653, -0.876109,
-    -0.873337, -0.868501, -0.861835, -0.853634, -0.844237, -0.834017,
-    -0.823364, -0.812669, -0.802312, -0.792645, -0.783985, -0.776597,
-    -0.77069, -0.766412, -0.763843, -0.762994, -0.763815, -0.766188,
-    -0.769946, -0.77487, -0.780704, -0.787165, -0.793956, -0.800773,
-    -0.80732, -0.813322, -0.818528, -0.822726, -0.82575, -0.827481,
-    -0.827851, -0.82685, -0.824515, -0.820939, -0.816257, -0.810642,
-    -0.804301, -0.797464, -0.790373, -0.783274, -0.776411, -0.770009,
-    -0.764274, -0.75938, -0.755466, -0.752629, -0.750924, -0.750361,
-    -0.750905, -0.752481, -0.754975, -0.758239, -0.7621, -0.766364,
-    -0.770827, -0.775279, -0.779516, -0.783346, -0.786596, -0.789118,
-    -0.790796, -0.791548, -0.791329, -0.790132, -0.787988, -0.784964,
-    -0.78116, -0.776703, -0.771746, -0.766455, -0.761009, -0.755588,
-    -0.75037, -0.745521, -0.741189, -0.737502, -0.73456, -0.732432,
-    -0.731156, -0.730735, -0.731141, -0.732311, -0.734158, -0.736566,
-    -0.739401, -0.742516, -0.745751, -0.748949, -0.751952, -0.754616,
-    -0.756808, -0.758418, -0.75936, -0.759573, -0.759027, -0.757721,
-    -0.755684, -0.752971, -0.749664, -0.745867, -0.741702, -0.737301,
-    -0.732806, -0.728361, -0.724103, -0.720164, -0.716659, -0.713687,
-    -0.711323, -0.709619, -0.7086, -0.708265, -0.708586, -0.70951,
-    -0.710962, -0.712845, -0.71505, -0.717454, -0.71993, -0.722347,
-    -0.72458, -0.726512, -0.728039, -0.729074, -0.729549, -0.72942,
-    -0.728666, -0.72729, -0.725321, -0.722808, -0.719823, -0.716454,
-    -0.712803, -0.708983, -0.705111, -0.701305, -0.697679, -0.694341,
-    -0.691384, -0.688886, -0.686907, -0.685486, -0.684639, -0.684362,
-    -0.684626, -0.685384, -0.686568, -0.688096, -0.689872, -0.691792,
-    -0.693748, -0.69563, -0.697335, -0.698764, -0.699832, -0.700468,
-    -0.70062, -0.700253, -0.699354, -0.69793, -0.696009, -0.693636,
-    -0.690877, -0.687809, -0.684522, -0.681111, -0.67768, -0.674328,
-    -0.671152, -0.668242, -0.665675, -0.663516, -0.661813, -0.660595,
-    -0.659872, -0.659637, -0.65986, -0.660498, -0.661488, -0.662758,
-    -0.664222, -0.665789, -0.667366, -0.668858, -0.670175, -0.671235,
-    -0.671966, -0.672309, -0.672223, -0.671681, -0.670674, -0.669214,
-    -0.667328, -0.665061, -0.66247, -0.659626, -0.656609, -0.653506,
-    -0.650404, -0.647392, -0.644553, -0.641965, -0.639693, -0.63779,
-    -0.636295, -0.63523, -0.634601, -0.634397, -0.634589, -0.635135,
-    -0.635978, -0.637051, -0.638277, -0.639575, -0.640862, -0.642055,
-    -0.643075, -0.643851, -0.644323, -0.644441, -0.644171, -0.643493,
-    -0.642404, -0.640916, -0.639058, -0.636871, -0.63441, -0.631741,
-    -0.628935, -0.62607, -0.623226, -0.62048, -0.617905, -0.615568,
-    -0.613526, -0.611824, -0.610492, -0.609548, -0.608993, -0.608813,
-    -0.608981, -0.609455, -0.610182, -0.611099, -0.612137, -0.613222,
-    -0.614278, -0.615233, -0.616017, -0.616568, -0.616834, -0.616772,
-    -0.616355, -0.615569, -0.614414, -0.612904, -0.611068, -0.608946,
-    -0.60659, -0.60406, -0.601424, -0.598751, -0.596114, -0.593582,
-    -0.59122, -0.589086, -0.587231, -0.58569, -0.584491, -0.583644,
-    -0.583149, -0.58299, -0.583138, -0.583553, -0.584185, -0.584975,
-    -0.58586, -0.58677, -0.587639, -0.5884, -0.588991, -0.589358,
-    -0.589454, -0.589245, -0.588708, -0.587834, -0.586624, -0.585096,
-    -0.583278, -0.581209, -0.578939, -0.576525, -0.574028, -0.571514,
-    -0.569048, -0.566693, -0.564507, -0.562542, -0.56084, -0.559435,
-    -0.558345, -0.55758, -0.557134, -0.556991, -0.557123, -0.557489,
-    -0.558042, -0.558727, -0.559483, -0.560249, -0.560961, -0.561559,
-    -0.561989, -0.562201, -0.562156, -0.561824, -0.561186, -0.560237,
-    -0.558982, -0.557438, -0.555635, -0.553612, -0.551414, -0.549097,
-    -0.546719, -0.544338, -0.542017, -0.539811, -0.537774, -0.535951,
-    -0.53438, -0.533088, -0.532091, -0.531394, -0.530991, -0.530862,
-    -0.530979, -0.531304, -0.53179, -0.532385, -0.533033, -0.533675,
-    -0.534253, -0.534714, -0.535006, -0.535086, -0.53492, -0.534483,
-    -0.533759, -0.532746, -0.531452, -0.529895, -0.528105, -0.52612,
-    -0.523985, -0.521751, -0.519474, -0.517208, -0.51501, -0.512933,
-    -0.511023, -0.509323, -0.507864, -0.50667, -0.505753, -0.505116,
-    -0.504749, -0.504633, -0.504738, -0.505027, -0.505455, -0.505972,
-    -0.506525, -0.50706, -0.507523, -0.507864, -0.508037, -0.508003,
-    -0.507732, -0.507203, -0.506405, -0.505337, -0.504008, -0.50244,
-    -0.500662, -0.49871, -0.496629, -0.494468, -0.492279, -0.490113,
-    -0.488024, -0.486058, -0.48426, -0.482667, -0.481306, -0.480198,
-    -0.479351, -0.478765, -0.47843, -0.478324, -0.478419, -0.478676,
-    -0.479054, -0.479503, -0.479974, -0.480415, -0.480776, -0.481011,
-    -0.48108, -0.480946, -0.480583, -0.479973, -0.479109, -0.477992,
-    -0.476634, -0.475056, -0.473287, -0.471365, -0.469332, -0.467235,
-    -0.465123, -0.463046, -0.461052, -0.459186, -0.457487, -0.455988,
-    -0.454714, -0.453681, -0.452897, -0.452357, -0.45205, -0.451954,
-    -0.452039, -0.452268, -0.452601, -0.452989, -0.453386, -0.453744,
-    -0.454015, -0.454157, -0.454132, -0.453909, -0.453464, -0.452782,
-    -0.45186, -0.450699, -0.449314, -0.447727, -0.445968, -0.444072,
-    -0.442082, -0.440042, -0.437999, -0.436002, -0.434093, -0.432315,
-    -0.430705, -0.42929, -0.428094, -0.427129, -0.4264, -0.425902,
-    -0.42562, -0.425532, -0.425609, -0.425814, -0.426105, -0.42644,
-    -0.426771, -0.427053, -0.427243, -0.427301, -0.427192, -0.426888,
-    -0.426369, -0.425624, -0.424648, -0.423449, -0.42204, -0.420445,
-    -0.418693, -0.416821, -0.414869, -0.412881, -0.410902, -0.408975,
-    -0.407144, -0.405446, -0.403915, -0.402577, -0.401452, -0.400548,
-    -0.39987, -0.399409, -0.39915, -0.39907, -0.399138, -0.39932,
-    -0.399575, -0.399861, -0.400132, -0.400346, -0.400462, -0.400444,
-    -0.400259, -0.399882, -0.399296, -0.398491, -0.397468, -0.396233,
-    -0.394802, -0.393199, -0.391455, -0.389605, -0.387688, -0.385747,
-    -0.383825, -0.381963, -0.380203, -0.378578, -0.37712, -0.375852,
-    -0.374791, -0.373944, -0.373311, -0.372884, -0.372646, -0.372573,
-    -0.372635, -0.372796, -0.373017, -0.373257, -0.373474, -0.373626,
-    -0.373674, -0.373586, -0.37333, -0.372887, -0.372239, -0.371381,
-    -0.370313, -0.369045, -0.367594, -0.365985, -0.364248, -0.362417,
-    -0.360533, -0.358635, -0.356765, -0.354964, -0.353268, -0.351711,
-    -0.35032, -0.349116, -0.348114, -0.347319, -0.346729, -0.346333,
-    -0.346114, -0.346048, -0.346103, -0.346245, -0.346435, -0.346634,
-    -0.3468, -0.346894, -0.34688, -0.346727, -0.346407, -0.345901,
-    -0.345196, -0.344288, -0.34318, -0.341882, -0.340412, -0.338797,
-    -0.337066, -0.335254, -0.333399, -0.331542, -0.329721, -0.327975,
-    -0.326339, -0.324844, -0.323516, -0.322372, -0.321425, -0.320677,
-    -0.320126, -0.31976, -0.319559, -0.319499, -0.319548, -0.319672,
-    -0.319834, -0.319993, -0.320112, -0.320153, -0.320081, -0.319867,
-    -0.319487, -0.318924, -0.318166, -0.317211, -0.316065, -0.314738,
-    -0.313252, -0.31163, -0.309905, -0.30811, -0.306283, -0.304463,
-    -0.302688, -0.300994, -0.299415, -0.297978, -0.296708, -0.29562,
-    -0.294724, -0.294022, -0.293508, -0.293169, -0.292985, -0.29293,
-    -0.292974, -0.293081, -0.293216, -0.293339, -0.293413, -0.293404,
-    -0.293277, -0.293007, -0.292571, -0.291953, -0.291145, -0.290147,
-    -0.288965, -0.287612, -0.286109, -0.284482, -0.282762, -0.280984,
-    -0.279183, -0.277398, -0.275666, -0.274021, -0.272494, -0.271113,
-    -0.269897, -0.268862, -0.268015, -0.267355, -0.266875, -0.266562,
-    -0.266394, -0.266344, -0.266383, -0.266475, -0.266583, -0.266672,
-    -0.266705, -0.266648, -0.26647, -0.266146, -0.265657, -0.264988,
-    -0.264133, -0.263094, -0.261878, -0.2605, -0.258981, -0.257349,
-    -0.255635, -0.253871, -0.252096, -0.250344, -0.248653, -0.247054,
-    -0.245577, -0.244248, -0.243084, -0.242099, -0.241297, -0.240678,
-    -0.240231, -0.239942, -0.239789, -0.239744, -0.239778, -0.239855,
-    -0.239939, -0.239996, -0.239989, -0.239887, -0.23966, -0.239285,
-    -0.238745, -0.238027, -0.237128, -0.236049, -0.234801, -0.2334,
-    -0.231867, -0.23023, -0.22852, -0.226771, -0.225019, -0.2233,
-    -0.221647, -0.220092, -0.218663, -0.217383, -0.216269, -0.215331,
-    -0.214573, -0.213992, -0.213577, -0.213311, -0.213172, -0.213133,
-    -0.213161, -0.213224, -0.213285, -0.213311, -0.213266, -0.21312,
-    -0.212847, -0.212424, -0.211835, -0.211071, -0.210129, -0.209013,
-    -0.207734, -0.20631, -0.204763, -0.203121, -0.201416, -0.199681,
-    -0.197952, -0.196263, -0.194647, -0.193134, -0.191751, -0.190519,
-    -0.189452, -0.18856, -0.187844, -0.187299, -0.186914, -0.186671,
-    -0.186546, -0.186511, -0.186535, -0.186584, -0.186623, -0.186618,
-    -0.186537, -0.186351, -0.186032, -0.185563, -0.184927, -0.184118,
-    -0.183135, -0.181983, -0.180674, -0.179228, -0.177667, -0.176021,
-    -0.174321, -0.172599, -0.170892, -0.169232, -0.167652, -0.16618,
-    -0.164841, -0.163655, -0.162634, -0.161785, -0.16111, -0.160601,
-    -0.160245, -0.160023, -0.159911, -0.159881, -0.1599, -0.159936,
-    -0.159954, -0.15992, -0.159804, -0.159577, -0.159216, -0.158701,
-    -0.15802, -0.157168, -0.156145, -0.154958, -0.153621, -0.152153,
-    -0.15058, -0.148929, -0.147233, -0.145525, -0.143838, -0.142207,
-    -0.140661, -0.139229, -0.137933, -0.136791, -0.135814, -0.135009,
-    -0.134372, -0.133898, -0.13357, -0.133369, -0.13327, -0.133244,
-    -0.133259, -0.133282, -0.133279, -0.133217, -0.133067, -0.132801,
-    -0.132397, -0.131839, -0.131115, -0.13022, -0.129158, -0.127938,
-    -0.126573, -0.125084, -0.123498, -0.121843, -0.120151, -0.118456,
-    -0.11679, -0.115186, -0.113674, -0.11228, -0.111026, -0.109927,
-    -0.108994, -0.10823, -0.107632, -0.10719, -0.10689, -0.10671,
-    -0.106623, -0.106601, -0.106612, -0.106623, -0.106599, -0.10651,
-    -0.106327, -0.106023, -0.105578, -0.104977, -0.10421, -0.103274,
-    -0.102175, -0.10092, -0.0995283, -0.0980198, -0.0964211, -0.0947619,
-    -0.0930742, -0.0913911, -0.0897455, -0.0881689, -0.0866899, -0.0853335,
-    -0.0841198, -0.0830634, -0.0821725, -0.0814492, -0.0808887, -0.0804803,
-    -0.0802069, -0.0800464, -0.0799723, -0.0799546, -0.0799613, -0.0799594,
-    -0.0799161, -0.0798005, -0.0795842, -0.0792431, -0.0787577, -0.0781144,
-    -0.0773054, -0.0763297, -0.0751926, -0.0739059, -0.0724871, -0.0709588,
-    -0.0693479, -0.0676845, -0.0660009, -0.06433, -0.0627042, -0.0611542,
-    -0.0597077, -0.0583883, -0.0572147, -0.0562, -0.0553508, -0.0546676,
-    -0.0541441, -0.053768, -0.0535211, -0.0533803, -0.0533183, -0.0533048,
-    -0.0533074, -0.0532933, -0.0532304, -0.0530883, -0.0528398, -0.0524619,
-    -0.0519367, -0.0512518, -0.0504014, -0.0493858, -0.0482121, -0.0468932,
-    -0.045448, -0.0439001, -0.0422771, -0.0406097, -0.0389302, -0.0372713,
-    -0.0356651, -0.0341414, -0.032727, -0.0314442, -0.0303103, -0.0293368,
-    -0.0285289, -0.0278853, -0.0273983, -0.0270542, -0.0268336, -0.0267124,
-    -0.0266624, -0.0266529, -0.0266515, -0.0266254, -0.026543, -0.0263746,
-    -0.0260942, -0.0256799, -0.0251151, -0.0243891, -0.0234976, -0.0224425,
-    -0.0212324, -0.0198816, -0.0184102, -0.0168428, -0.0152078, -0.0135364,
-    -0.0118609, -0.010214, -0.00862724, -0.00712972, -0.00574714, -0.0045007,
-    -0.00340625, -0.00247376, -0.00170685, -0.00110267, -0.000652048, -0.000339793,
-    -0.00014533, -4.34845e-5, -5.46758e-6, -1.11022e-16, 5.46758e-6, 4.34845e-5,
-    0.00014533, 0.000339793, 0.000652048, 0.00110267, 0.00170685, 0.00247376,
-    0.00340625, 0.0045007, 0.00574714, 0.00712972, 0.00862724, 0.010214,
-    0.0118609, 0.0135364, 0.0152078, 0.0168428, 0.0184102, 0.0198816,
-    0.0212324, 0.0224425, 0.0234976, 0.0243891, 0.0251151, 0.0256799,
-    0.0260942, 0.0263746, 0.026543, 0.0266254, 0.0266515, 0.0266529,
-    0.0266624, 0.0267124, 0.0268336, 0.0270542, 0.0273983, 0.0278853,
-    0.0285289, 0.0293368, 0.0303103, 0.0314442, 0.032727, 0.0341414,
-    0.0356651, 0.0372713, 0.0389302, 0.0406097, 0.0422771, 0.0439001,
-    0.045448, 0.0468932, 0.0482121, 0.0493858, 0.0504014, 0.0512518,
-    0.0519367, 0.0524619, 0.0528398, 0.0530883, 0.0532304, 0.0532933,
-    0.0533074, 0.0533048, 0.0533183, 0.0533803, 0.0535211, 0.053768,
-    0.0541441, 0.0546676, 0.0553508, 0.0562, 0.0572147, 0.0583883,
-    0.0597077, 0.0611542, 0.0627042, 0.06433, 0.0660009, 0.0676845,
-    0.0693479, 0.0709588, 0.0724871, 0.0739059, 0.0751926, 0.0763297,
-    0.0773054, 0.0781144, 0.0787577, 0.0792431, 0.0795842, 0.0798005,
-    0.0799161, 0.0799594, 0.0799613, 0.0799546, 0.0799723, 0.0800464,
-    0.0802069, 0.0804803, 0.0808887, 0.0814492, 0.0821725, 0.0830634,
-    0.0841198, 0.0853335, 0.0866899, 0.0881689, 0.0897455, 0.0913911,
-    0.0930742, 0.0947619, 0.0964211, 0.0980198, 0.0995283, 0.10092,
-    0.102175, 0.103274, 0.10421, 0.104977, 0.105578, 0.106023,
-    0.106327, 0.10651, 0.106599, 0.106623, 0.106612, 0.106601,
-    0.106623, 0.10671, 0.10689, 0.10719, 0.107632, 0.10823,
-    0.108994, 0.109927, 0.111026, 0.11228, 0.113674, 0.115186,
-    0.11679, 0.118456, 0.120151, 0.121843, 0.123498, 0.125084,
-    0.126573, 0.127938, 0.129158, 0.13022, 0.131115, 0.131839,
-    0.132397, 0.132801, 0.133067, 0.133217, 0.133279, 0.133282,
-    0.133259, 0.133244, 0.13327, 0.133369, 0.13357, 0.133898,
-    0.134372, 0.135009, 0.135814, 0.136791, 0.137933, 0.139229,
-    0.140661, 0.142207, 0.143838, 0.145525, 0.147233, 0.148929,
-    0.15058, 0.152153, 0.153621, 0.154958, 0.156145, 0.157168,
-    0.15802, 0.158701, 0.159216, 0.159577, 0.159804, 0.15992,
-    0.159954, 0.159936, 0.1599, 0.159881, 0.159911, 0.160023,
-    0.160245, 0.160601, 0.16111, 0.161785, 0.162634, 0.163655,
-    0.164841, 0.16618, 0.167652, 0.169232, 0.170892, 0.172599,
-    0.174321, 0.176021, 0.177667, 0.179228, 0.180674, 0.181983,
-    0.183135, 0.184118, 0.184927, 0.185563, 0.186032, 0.186351,
-    0.186537, 0.186618, 0.186623, 0.186584, 0.186535, 0.186511,
-    0.186546, 0.186671, 0.186914, 0.187299, 0.187844, 0.18856,
-    0.189452, 0.190519, 0.191751, 0.193134, 0.194647, 0.196263,
-    0.197952, 0.199681, 0.201416, 0.203121, 0.204763, 0.20631,
-    0.207734, 0.209013, 0.210129, 0.211071, 0.211835, 0.212424,
-    0.212847, 0.21312, 0.213266, 0.213311, 0.213285, 0.213224,
-    0.213161, 0.213133, 0.213172, 0.213311, 0.213577, 0.213992,
-    0.214573, 0.215331, 0.216269, 0.217383, 0.218663, 0.220092,
-    0.221647, 0.2233, 0.225019, 0.226771, 0.22852, 0.23023,
-    0.231867, 0.2334, 0.234801, 0.236049, 0.237128, 0.238027,
-    0.238745, 0.239285, 0.23966, 0.239887, 0.239989, 0.239996,
-    0.239939, 0.239855, 0.239778, 0.239744, 0.239789, 0.239942,
-    0.240231, 0.240678, 0.241297, 0.242099, 0.243084, 0.244248,
-    0.245577, 0.247054, 0.248653, 0.250344, 0.252096, 0.253871,
-    0.255635, 0.257349, 0.258981, 0.2605, 0.261878, 0.263094,
-    0.264133, 0.264988, 0.265657, 0.266146, 0.26647, 0.266648,
-    0.266705, 0.266672, 0.266583, 0.266475, 0.266383, 0.266344,
-    0.266394, 0.266562, 0.266875, 0.267355, 0.268015, 0.268862,
-    0.269897, 0.271113, 0.272494, 0.274021, 0.275666, 0.277398,
-    0.279183, 0.280984, 0.282762, 0.284482, 0.286109, 0.287612,
-    0.288965, 0.290147, 0.291145, 0.291953, 0.292571, 0.293007,
-    0.293277, 0.293404, 0.293413, 0.293339, 0.293216, 0.293081,
-    0.292974, 0.29293, 0.292985, 0.293169, 0.293508, 0.294022,
-    0.294724, 0.29562, 0.296708, 0.297978, 0.299415, 0.300994,
-    0.302688, 0.304463, 0.306283, 0.30811, 0.309905, 0.31163,
-    0.313252, 0.314738, 0.316065, 0.317211, 0.318166, 0.318924,
-    0.319487, 0.319867, 0.320081, 0.320153, 0.320112, 0.319993,
-    0.319834, 0.319672, 0.319548, 0.319499, 0.319559, 0.31976,
-    0.320126, 0.320677, 0.321425, 0.322372, 0.323516, 0.324844,
-    0.326339, 0.327975, 0.329721, 0.331542, 0.333399, 0.335254,
-    0.337066, 0.338797, 0.340412, 0.341882, 0.34318, 0.344288,
-    0.345196, 0.345901, 0.346407, 0.346727, 0.34688, 0.346894,
-    0.3468, 0.346634, 0.346435, 0.346245, 0.346103, 0.346048,
-    0.346114, 0.346333, 0.346729, 0.347319, 0.348114, 0.349116,
-    0.35032, 0.351711, 0.353268, 0.354964, 0.356765, 0.358635,
-    0.360533, 0.362417, 0.364248, 0.365985, 0.367594, 0.369045,
-    0.370313, 0.371381, 0.372239, 0.372887, 0.37333, 0.373586,
-    0.373674, 0.373626, 0.373474, 0.373257, 0.373017, 0.372796,
-    0.372635, 0.372573, 0.372646, 0.372884, 0.373311, 0.373944,
-    0.374791, 0.375852, 0.37712, 0.378578, 0.380203, 0.381963,
-    0.383825, 0.385747, 0.387688, 0.389605, 0.391455, 0.393199,
-    0.394802, 0.396233, 0.397468, 0.398491, 0.399296, 0.399882,
-    0.400259, 0.400444, 0.400462, 0.400346, 0.400132, 0.399861,
-    0.399575, 0.39932, 0.399138, 0.39907, 0.39915, 0.399409,
-    0.39987, 0.400548, 0.401452, 0.402577, 0.403915, 0.405446,
-    0.407144, 0.408975, 0.410902, 0.412881, 0.414869, 0.416821,
-    0.418693, 0.420445, 0.42204, 0.423449, 0.424648, 0.425624,
-    0.426369, 0.426888, 0.427192, 0.427301, 0.427243, 0.427053,
-    0.426771, 0.42644, 0.426105, 0.425814, 0.425609, 0.425532,
-    0.42562, 0.425902, 0.4264, 0.427129, 0.428094, 0.42929,
-    0.430705, 0.432315, 0.434093, 0.436002, 0.437999, 0.440042,
-    0.442082, 0.444072, 0.445968, 0.447727, 0.449314, 0.450699,
-    0.45186, 0.452782, 0.453464, 0.453909, 0.454132, 0.454157,
-    0.454015, 0.453744, 0.453386, 0.452989, 0.452601, 0.452268,
-    0.452039, 0.451954, 0.45205, 0.452357, 0.452897, 0.453681,
-    0.454714, 0.455988, 0.457487, 0.459186, 0.461052, 0.463046,
-    0.465123, 0.467235, 0.469332, 0.471365, 0.473287, 0.475056,
-    0.476634, 0.477992, 0.479109, 0.479973, 0.480583, 0.480946,
-    0.48108, 0.481011, 0.480776, 0.480415, 0.479974, 0.479503,
-    0.479054, 0.478676, 0.478419, 0.478324, 0.47843, 0.478765,
-    0.479351, 0.480198, 0.481306, 0.482667, 0.48426, 0.486058,
-    0.488024, 0.490113, 0.492279, 0.494468, 0.496629, 0.49871,
-    0.500662, 0.50244, 0.504008, 0.505337, 0.506405, 0.507203,
-    0.507732, 0.508003, 0.508037, 0.507864, 0.507523, 0.50706,
-    0.506525, 0.505972, 0.505455, 0.505027, 0.504738, 0.504633,
-    0.504749, 0.505116, 0.505753, 0.50667, 0.507864, 0.509323,
-    0.511023, 0.512933, 0.51501, 0.517208, 0.519474, 0.521751,
-    0.523985, 0.52612, 0.528105, 0.529895, 0.531452, 0.532746,
-    0.533759, 0.534483, 0.53492, 0.535086, 0.535006, 0.534714,
-    0.534253, 0.533675, 0.533033, 0.532385, 0.53179, 0.531304,
-    0.530979, 0.530862, 0.530991, 0.531394, 0.532091, 0.533088,
-    0.53438, 0.535951, 0.537774, 0.539811, 0.542017, 0.544338,
-    0.546719, 0.549097, 0.551414, 0.553612, 0.555635, 0.557438,
-    0.558982, 0.560237, 0.561186, 0.561824, 0.562156, 0.562201,
-    0.561989, 0.561559, 0.560961, 0.560249, 0.559483, 0.558727,
-    0.558042, 0.557489, 0.557123, 0.556991, 0.557134, 0.55758,
-    0.558345, 0.559435, 0.56084, 0.562542, 0.564507, 0.566693,
-    0.569048, 0.571514, 0.574028, 0.576525, 0.578939, 0.581209,
-    0.583278, 0.585096, 0.586624, 0.587834, 0.588708, 0.589245,
-    0.589454, 0.589358, 0.588991, 0.5884, 0.587639, 0.58677,
-    0.58586, 0.584975, 0.584185, 0.583553, 0.583138, 0.58299,
-    0.583149, 0.583644, 0.584491, 0.58569, 0.587231, 0.589086,
-    0.59122, 0.593582, 0.596114, 0.598751, 0.601424, 0.60406,
-    0.60659, 0.608946, 0.611068, 0.612904, 0.614414, 0.615569,
-    0.616355, 0.616772, 0.616834, 0.616568, 0.616017, 0.615233,
-    0.614278, 0.613222, 0.612137, 0.611099, 0.610182, 0.609455,
-    0.608981, 0.608813, 0.608993, 0.609548, 0.610492, 0.611824,
-    0.613526, 0.615568, 0.617905, 0.62048, 0.623226, 0.62607,
-    0.628935, 0.631741, 0.63441, 0.636871, 0.639058, 0.640916,
-    0.642404, 0.643493, 0.644171, 0.644441, 0.644323, 0.643851,
-    0.643075, 0.642055, 0.640862, 0.639575, 0.638277, 0.637051,
-    0.635978, 0.635135, 0.634589, 0.634397, 0.634601, 0.63523,
-    0.636295, 0.63779, 0.639693, 0.641965, 0.644553, 0.647392,
-    0.650404, 0.653506, 0.656609, 0.659626, 0.66247, 0.665061,
-    0.667328, 0.669214, 0.670674, 0.671681, 0.672223, 0.672309,
-    0.671966, 0.671235, 0.670175, 0.668858, 0.667366, 0.665789,
-    0.664222, 0.662758, 0.661488, 0.660498, 0.65986, 0.659637,
-    0.659872, 0.660595, 0.661813, 0.663516, 0.665675, 0.668242,
-    0.671152, 0.674328, 0.67768, 0.681111, 0.684522, 0.687809,
-    0.690877, 0.693636, 0.696009, 0.69793, 0.699354, 0.700253,
-    0.70062, 0.700468, 0.699832, 0.698764, 0.697335, 0.69563,
-    0.693748, 0.691792, 0.689872, 0.688096, 0.686568, 0.685384,
-    0.684626, 0.684362, 0.684639, 0.685486, 0.686907, 0.688886,
-    0.691384, 0.694341, 0.697679, 0.701305, 0.705111, 0.708983,
-    0.712803, 0.716454, 0.719823, 0.722808, 0.725321, 0.72729,
-    0.728666, 0.72942, 0.729549, 0.729074, 0.728039, 0.726512,
-    0.72458, 0.722347, 0.71993, 0.717454, 0.71505, 0.712845,
-    0.710962, 0.70951, 0.708586, 0.708265, 0.7086, 0.709619,
-    0.711323, 0.713687, 0.716659, 0.720164, 0.724103, 0.728361,
-    0.732806, 0.737301, 0.741702, 0.745867, 0.749664, 0.752971,
-    0.755684, 0.757721, 0.759027, 0.759573, 0.75936, 0.758418,
-    0.756808, 0.754616, 0.751952, 0.748949, 0.745751, 0.742516,
-    0.739401, 0.736566, 0.734158, 0.732311, 0.731141, 0.730735,
-    0.731156, 0.732432, 0.73456, 0.737502, 0.741189, 0.745521,
-    0.75037, 0.755588, 0.761009, 0.766455, 0.771746, 0.776703,
-    0.78116, 0.784964, 0.787988, 0.790132, 0.791329, 0.791548,
-    0.790796, 0.789118, 0.786596, 0.783346, 0.779516, 0.775279,
-    0.770827, 0.766364, 0.7621, 0.758239, 0.754975, 0.752481,
-    0.750905, 0.750361, 0.750924, 0.752629, 0.755466, 0.75938,
-    0.764274, 0.770009, 0.776411, 0.783274, 0.790373, 0.797464,
-    0.804301, 0.810642, 0.816257, 0.820939, 0.824515, 0.82685,
-    0.827851, 0.827481, 0.82575, 0.822726, 0.818528, 0.813322,
-    0.80732, 0.800773, 0.793956, 0.787165, 0.780704, 0.77487,
-    0.769946, 0.766188, 0.763815, 0.762994, 0.763843, 0.766412,
-    0.77069, 0.776597, 0.783985, 0.792645, 0.802312, 0.812669,
-    0.823364, 0.834017, 0.844237, 0.853634, 0.861835, 0.868501,
-    0.873337, 0.876109, 0.876653, 0.874885, 0.870808, 0.864515,
-    0.856188, 0.846098, 0.834597, 0.822109, 0.809117, 0.79615,
-    0.783761, 0.772514, 0.762956, 0.755604, 0.750919, 0.749286,
-    0.750999, 0.756243, 0.765077, 0.777433, 0.793099, 0.811725,
-    0.832821, 0.855765, 0.879817, 0.904126, 0.927759, 0.949717,
-    0.968959, 0.984436, 0.995113, 1, 0.998181, 0.988841,
-    0.971292, 0.944995, 0.909578, 0.864852, 0.810823, 0.747694,
-    0.675864, 0.595928, 0.508663, 0.415011, 0.316061, 0.213028,
-    0.107216, 0
-};
-
-static const float WAVE_SAW_078[DEFAULT_WAVELEN] = {
-    -0.0543872, -0.108592, -0.162431, -0.215727, -0.268302, -0.319985,
-    -0.370608, -0.420011, -0.468041, -0.514553, -0.55941, -0.602486,
-    -0.643664, -0.682839, -0.719918, -0.754817, -0.787469, -0.817816,
-    -0.845814, -0.871432, -0.894652, -0.915471, -0.933894, -0.949943,
-    -0.963651, -0.975063, -0.984233, -0.99123, -0.996131, -0.999022,
-    -1, -0.999168, -0.996637, -0.992525, -0.986955, -0.980055,
-    -0.971955, -0.962791, -0.952697, -0.94181, -0.930266, -0.918202,
-    -0.905749, -0.893038, -0.880197, -0.867347, -0.854605, -0.842083,
-    -0.829885, -0.818108, -0.806841, -0.796168, -0.78616, -0.776883,
-    -0.768391, -0.760731, -0.75394, -0.748046, -0.743067, -0.739014,
-    -0.735886, -0.733676, -0.732369, -0.731939, -0.732357, -0.733584,
-    -0.735574, -0.738279, -0.741642, -0.745603, -0.750098, -0.75506,
-    -0.760419, -0.766104, -0.772042, -0.778159, -0.784383, -0.790641,
-    -0.796864, -0.802982, -0.80893, -0.814645, -0.820068, -0.825145,
-    -0.829826, -0.834066, -0.837824, -0.841067, -0.843766, -0.845899,
-    -0.847447, -0.848401, -0.848755, -0.848511, -0.847675, -0.846259,
-    -0.844281, -0.841762, -0.838732, -0.83522, -0.831263, -0.826901,
-    -0.822175, -0.81713, -0.811814, -0.806277, -0.800567, -0.794736,
-    -0.788836, -0.782917, -0.77703, -0.771223, -0.765544, -0.760039,
-    -0.754749, -0.749716, -0.744975, -0.740561, -0.736503, -0.732826,
-    -0.729553, -0.7267, -0.72428, -0.722303, -0.720772, -0.719686,
-    -0.719042, -0.718829, -0.719037, -0.719646, -0.720638, -0.721988,
-    -0.723669, -0.725651, -0.727903, -0.730388, -0.733072, -0.735917,
-    -0.738883, -0.741931, -0.745023, -0.748117, -0.751177, -0.754162,
-    -0.757037, -0.759766, -0.762316, -0.764656, -0.766757, -0.768592,
-    -0.77014, -0.77138, -0.772296, -0.772873, -0.773103, -0.772979,
-    -0.772498, -0.771662, -0.770474, -0.768942, -0.767077, -0.764893,
-    -0.762407, -0.759639, -0.756611, -0.753348, -0.749876, -0.746224,
-    -0.742421, -0.738499, -0.734488, -0.730421, -0.726332, -0.722251,
-    -0.71821, -0.714241, -0.710374, -0.706638, -0.703058, -0.699662,
-    -0.696471, -0.693508, -0.690789, -0.688332, -0.686148, -0.68425,
-    -0.682643, -0.681332, -0.68032, -0.679603, -0.679179, -0.67904,
-    -0.679175, -0.679573, -0.680219, -0.681095, -0.682182, -0.683458,
-    -0.684902, -0.686488, -0.688191, -0.689984, -0.691842, -0.693736,
-    -0.695639, -0.697523, -0.699362, -0.70113, -0.702801, -0.704351,
-    -0.705759, -0.707001, -0.708061, -0.708919, -0.709562, -0.709976,
-    -0.710152, -0.710079, -0.709755, -0.709174, -0.708338, -0.707247,
-    -0.705908, -0.704325, -0.70251, -0.700473, -0.698228, -0.695791,
-    -0.693178, -0.69041, -0.687505, -0.684486, -0.681375, -0.678194,
-    -0.674969, -0.671722, -0.668477, -0.665258, -0.662088, -0.658991,
-    -0.655986, -0.653096, -0.650339, -0.647733, -0.645295, -0.643038,
-    -0.640976, -0.639118, -0.637473, -0.636048, -0.634846, -0.633869,
-    -0.633117, -0.632587, -0.632274, -0.632172, -0.632271, -0.632561,
-    -0.633028, -0.633659, -0.634437, -0.635346, -0.636367, -0.637481,
-    -0.638667, -0.639906, -0.641175, -0.642455, -0.643722, -0.644958,
-    -0.646141, -0.647252, -0.648271, -0.649181, -0.649965, -0.650608,
-    -0.651096, -0.651416, -0.651559, -0.651516, -0.65128, -0.650845,
-    -0.650211, -0.649374, -0.648338, -0.647104, -0.645678, -0.644068,
-    -0.64228, -0.640327, -0.63822, -0.635973, -0.633599, -0.631116,
-    -0.62854, -0.625888, -0.623179, -0.620432, -0.617666, -0.614899,
-    -0.612151, -0.609441, -0.606786, -0.604204, -0.601712, -0.599326,
-    -0.59706, -0.594927, -0.592939, -0.591108, -0.58944, -0.587945,
-    -0.586626, -0.585488, -0.584533, -0.583759, -0.583167, -0.582751,
-    -0.582506, -0.582427, -0.582503, -0.582726, -0.583083, -0.583562,
-    -0.584148, -0.584828, -0.585585, -0.586404, -0.587266, -0.588156,
-    -0.589055, -0.589947, -0.590813, -0.591638, -0.592405, -0.593097,
-    -0.593701, -0.594202, -0.594588, -0.594846, -0.594968, -0.594942,
-    -0.594763, -0.594425, -0.593922, -0.593254, -0.592417, -0.591415,
-    -0.590248, -0.588921, -0.587439, -0.58581, -0.584041, -0.582143,
-    -0.580127, -0.578004, -0.575789, -0.573494, -0.571135, -0.568727,
-    -0.566286, -0.563827, -0.561367, -0.558921, -0.556506, -0.554136,
-    -0.551827, -0.549592, -0.547445, -0.545398, -0.543464, -0.541651,
-    -0.539969, -0.538426, -0.537027, -0.535778, -0.534681, -0.533739,
-    -0.532952, -0.532318, -0.531834, -0.531497, -0.5313, -0.531236,
-    -0.531297, -0.531473, -0.531754, -0.532127, -0.532581, -0.533102,
-    -0.533676, -0.534289, -0.534925, -0.535572, -0.536212, -0.536832,
-    -0.537418, -0.537954, -0.538428, -0.538827, -0.539138, -0.539351,
-    -0.539456, -0.539443, -0.539304, -0.539034, -0.538626, -0.538078,
-    -0.537386, -0.53655, -0.535571, -0.534449, -0.533189, -0.531795,
-    -0.530273, -0.52863, -0.526875, -0.525017, -0.523066, -0.521033,
-    -0.518932, -0.516774, -0.514572, -0.512341, -0.510093, -0.507844,
-    -0.505606, -0.503394, -0.50122, -0.499099, -0.497041, -0.49506,
-    -0.493165, -0.491367, -0.489675, -0.488097, -0.48664, -0.485308,
-    -0.484107, -0.48304, -0.482107, -0.48131, -0.480647, -0.480116,
-    -0.479713, -0.479434, -0.479271, -0.479219, -0.479268, -0.47941,
-    -0.479634, -0.479929, -0.480284, -0.480686, -0.481123, -0.481581,
-    -0.482049, -0.482513, -0.482959, -0.483376, -0.483749, -0.484069,
-    -0.484322, -0.4845, -0.48459, -0.484585, -0.484477, -0.484258,
-    -0.483923, -0.483466, -0.482885, -0.482178, -0.481342, -0.480379,
-    -0.47929, -0.478078, -0.476747, -0.475302, -0.473749, -0.472096,
-    -0.470351, -0.468523, -0.466622, -0.464659, -0.462645, -0.460592,
-    -0.458512, -0.456416, -0.454318, -0.45223, -0.450164, -0.448132,
-    -0.446146, -0.444217, -0.442354, -0.440569, -0.438871, -0.437266,
-    -0.435763, -0.434367, -0.433085, -0.431918, -0.430872, -0.429946,
-    -0.429141, -0.428457, -0.427891, -0.427441, -0.427101, -0.426867,
-    -0.426733, -0.426689, -0.42673, -0.426844, -0.427023, -0.427257,
-    -0.427533, -0.427841, -0.42817, -0.428507, -0.428841, -0.42916,
-    -0.429453, -0.429708, -0.429914, -0.430061, -0.43014, -0.430141,
-    -0.430056, -0.429878, -0.4296, -0.429217, -0.428725, -0.42812,
-    -0.4274, -0.426565, -0.425615, -0.42455, -0.423373, -0.422089,
-    -0.420701, -0.419215, -0.417637, -0.415976, -0.414239, -0.412435,
-    -0.410575, -0.408668, -0.406724, -0.404756, -0.402773, -0.400787,
-    -0.39881, -0.396853, -0.394926, -0.39304, -0.391206, -0.389432,
-    -0.387729, -0.386103, -0.384564, -0.383116, -0.381767, -0.38052,
-    -0.379379, -0.378348, -0.377427, -0.376617, -0.375917, -0.375325,
-    -0.374839, -0.374454, -0.374167, -0.37397, -0.373858, -0.373822,
-    -0.373855, -0.373947, -0.37409, -0.374272, -0.374484, -0.374715,
-    -0.374955, -0.375192, -0.375415, -0.375615, -0.375781, -0.375902,
-    -0.37597, -0.375974, -0.375908, -0.375763, -0.375533, -0.375211,
-    -0.374792, -0.374273, -0.373651, -0.372923, -0.372088, -0.371147,
-    -0.3701, -0.368951, -0.367701, -0.366356, -0.36492, -0.3634,
-    -0.361802, -0.360134, -0.358404, -0.356621, -0.354794, -0.352933,
-    -0.351049, -0.349152, -0.347251, -0.345358, -0.343482, -0.341635,
-    -0.339825, -0.338062, -0.336355, -0.334713, -0.333143, -0.331652,
-    -0.330247, -0.328932, -0.327712, -0.326591, -0.325571, -0.324653,
-    -0.323839, -0.323126, -0.322515, -0.322002, -0.321583, -0.321255,
-    -0.321011, -0.320846, -0.320753, -0.320723, -0.32075, -0.320823,
-    -0.320934, -0.321073, -0.321231, -0.321396, -0.321559, -0.321711,
-    -0.32184, -0.321938, -0.321995, -0.322002, -0.321951, -0.321834,
-    -0.321644, -0.321373, -0.321018, -0.320573, -0.320034, -0.319398,
-    -0.318663, -0.317829, -0.316895, -0.315863, -0.314734, -0.313512,
-    -0.312199, -0.310802, -0.309325, -0.307775, -0.306159, -0.304485,
-    -0.302761, -0.300996, -0.299198, -0.297378, -0.295545, -0.293709,
-    -0.291879, -0.290066, -0.288279, -0.286526, -0.284818, -0.283162,
-    -0.281566, -0.280038, -0.278585, -0.277211, -0.275922, -0.274723,
-    -0.273616, -0.272605, -0.271689, -0.270871, -0.270149, -0.269523,
-    -0.268989, -0.268544, -0.268184, -0.267905, -0.2677, -0.267563,
-    -0.267486, -0.267462, -0.267483, -0.26754, -0.267623, -0.267724,
-    -0.267833, -0.267941, -0.268038, -0.268114, -0.26816, -0.268169,
-    -0.26813, -0.268037, -0.267881, -0.267656, -0.267356, -0.266976,
-    -0.26651, -0.265956, -0.26531, -0.264571, -0.263737, -0.262809,
-    -0.261788, -0.260675, -0.259473, -0.258186, -0.256818, -0.255374,
-    -0.253861, -0.252285, -0.250653, -0.248974, -0.247255, -0.245505,
-    -0.243734, -0.24195, -0.240162, -0.238381, -0.236615, -0.234873,
-    -0.233164, -0.231496, -0.229878, -0.228318, -0.226821, -0.225395,
-    -0.224045, -0.222776, -0.221592, -0.220496, -0.219491, -0.218577,
-    -0.217756, -0.217027, -0.216389, -0.215838, -0.215374, -0.214991,
-    -0.214684, -0.214449, -0.214278, -0.214166, -0.214104, -0.214086,
-    -0.214101, -0.214143, -0.214202, -0.214269, -0.214334, -0.21439,
-    -0.214426, -0.214434, -0.214406, -0.214333, -0.214208, -0.214024,
-    -0.213773, -0.213451, -0.213052, -0.212572, -0.212007, -0.211354,
-    -0.210611, -0.209779, -0.208855, -0.207842, -0.206741, -0.205555,
-    -0.204286, -0.20294, -0.201522, -0.200036, -0.198489, -0.19689,
-    -0.195243, -0.193559, -0.191845, -0.19011, -0.188362, -0.186611,
-    -0.184865, -0.183134, -0.181425, -0.179748, -0.178111, -0.176521,
-    -0.174987, -0.173513, -0.172107, -0.170775, -0.16952, -0.168347,
-    -0.167258, -0.166257, -0.165345, -0.164521, -0.163786, -0.163139,
-    -0.162577, -0.162097, -0.161697, -0.16137, -0.161112, -0.160917,
-    -0.160778, -0.160689, -0.160641, -0.160627, -0.160639, -0.160667,
-    -0.160703, -0.160738, -0.160763, -0.16077, -0.160751, -0.160696,
-    -0.160599, -0.160451, -0.160246, -0.159978, -0.15964, -0.159228,
-    -0.158737, -0.158164, -0.157506, -0.156762, -0.15593, -0.15501,
-    -0.154003, -0.152911, -0.151736, -0.150482, -0.149152, -0.147751,
-    -0.146285, -0.14476, -0.143183, -0.141561, -0.139901, -0.138213,
-    -0.136503, -0.134781, -0.133055, -0.131335, -0.129628, -0.127943,
-    -0.126289, -0.124673, -0.123103, -0.121585, -0.120128, -0.118736,
-    -0.117415, -0.11617, -0.115004, -0.113921, -0.112923, -0.11201,
-    -0.111185, -0.110446, -0.109792, -0.109221, -0.108731, -0.108318,
-    -0.107977, -0.107703, -0.107491, -0.107334, -0.107226, -0.107158,
-    -0.107123, -0.107114, -0.10712, -0.107135, -0.10715, -0.107155,
-    -0.107143, -0.107105, -0.107033, -0.106919, -0.106756, -0.106538,
-    -0.106257, -0.105909, -0.105488, -0.104991, -0.104413, -0.103753,
-    -0.103007, -0.102176, -0.101259, -0.100257, -0.0991711, -0.0980041,
-    -0.096759, -0.0954397, -0.0940511, -0.0925984, -0.0910877, -0.0895256,
-    -0.0879191, -0.0862758, -0.0846036, -0.0829107, -0.0812053, -0.0794961,
-    -0.0777916, -0.0761002, -0.0744302, -0.0727899, -0.071187, -0.069629,
-    -0.0681229, -0.0666752, -0.0652918, -0.063978, -0.0627383, -0.0615766,
-    -0.060496, -0.0594986, -0.058586, -0.0577587, -0.0570165, -0.0563582,
-    -0.0557819, -0.0552849, -0.0548636, -0.0545138, -0.0542304, -0.0540078,
-    -0.0538398, -0.0537195, -0.0536397, -0.0535928, -0.0535706, -0.0535651,
-    -0.0535678, -0.0535703, -0.053564, -0.0535406, -0.0534919, -0.05341,
-    -0.0532871, -0.0531162, -0.0528904, -0.0526037, -0.0522503, -0.0518254,
-    -0.0513248, -0.0507451, -0.0500835, -0.0493382, -0.0485081, -0.0475932,
-    -0.0465941, -0.0455122, -0.0443499, -0.0431102, -0.0417972, -0.0404153,
-    -0.0389699, -0.0374669, -0.0359128, -0.0343145, -0.0326796, -0.0310158,
-    -0.0293312, -0.0276341, -0.0259329, -0.0242361, -0.022552, -0.020889,
-    -0.019255, -0.017658, -0.0161052, -0.0146037, -0.01316, -0.0117798,
-    -0.0104685, -0.00923071, -0.00807015, -0.00698996, -0.0059924, -0.00507892,
-    -0.00425016, -0.00350589, -0.00284505, -0.00226576, -0.00176532, -0.00134025,
-    -0.00098632, -0.000698606, -0.000471515, -0.000298855, -0.000173896, -8.94339e-5,
-    -3.78613e-5, -1.12461e-5, -1.40785e-6, 2.22045e-16, 1.40785e-6, 1.12461e-5,
-    3.78613e-5, 8.94339e-5, 0.000173896, 0.000298855, 0.000471515, 0.000698606,
-    0.00098632, 0.00134025, 0.00176532, 0.00226576, 0.00284505, 0.00350589,
-    0.00425016, 0.00507892, 0.0059924, 0.00698996, 0.00807015, 0.00923071,
-    0.0104685, 0.0117798, 0.01316, 0.0146037, 0.0161052, 0.017658,
-    0.019255, 0.020889, 0.022552, 0.0242361, 0.0259329, 0.0276341,
-    0.0293312, 0.0310158, 0.0326796, 0.0343145, 0.0359128, 0.0374669,
-    0.0389699, 0.0404153, 0.0417972, 0.0431102, 0.0443499, 0.0455122,
-    0.0465941, 0.0475932, 0.0485081, 0.0493382, 0.0500835, 0.0507451,
-    0.0513248, 0.0518254, 0.0522503, 0.0526037, 0.0528904, 0.0531162,
-    0.0532871, 0.05341, 0.0534919, 0.0535406, 0.053564, 0.0535703,
-    0.0535678, 0.0535651, 0.0535706, 0.0535928, 0.0536397, 0.0537195,
-    0.0538398, 0.0540078, 0.0542304, 0.0545138, 0.0548636, 0.0552849,
-    0.0557819, 0.0563582, 0.0570165, 0.0577587, 0.058586, 0.0594986,
-    0.060496, 0.0615766, 0.0627383, 0.063978, 0.0652918, 0.0666752,
-    0.0681229, 0.069629, 0.071187, 0.0727899, 0.0744302, 0.0761002,
-    0.0777916, 0.0794961, 0.0812053, 0.0829107, 0.0846036, 0.0862758,
-    0.0879191, 0.0895256, 0.0910877, 0.0925984, 0.0940511, 0.0954397,
-    0.096759, 0.0980041, 0.0991711, 0.100257, 0.101259, 0.102176,
-    0.103007, 0.103753, 0.104413, 0.104991, 0.105488, 0.105909,
-    0.106257, 0.106538, 0.106756, 0.106919, 0.107033, 0.107105,
-    0.107143, 0.107155, 0.10715, 0.107135, 0.10712, 0.107114,
-    0.107123, 0.107158, 0.107226, 0.107334, 0.107491, 0.107703,
-    0.107977, 0.108318, 0.108731, 0.109221, 0.109792, 0.110446,
-    0.111185, 0.11201, 0.112923, 0.113921, 0.115004, 0.11617,
-    0.117415, 0.118736, 0.120128, 0.121585, 0.123103, 0.124673,
-    0.126289, 0.127943, 0.129628, 0.131335, 0.133055, 0.134781,
-    0.136503, 0.138213, 0.139901, 0.141561, 0.143183, 0.14476,
-    0.146285, 0.147751, 0.149152, 0.150482, 0.151736, 0.152911,
-    0.154003, 0.15501, 0.15593, 0.156762, 0.157506, 0.158164,
-    0.158737, 0.159228, 0.15964, 0.159978, 0.160246, 0.160451,
-    0.160599, 0.160696, 0.160751, 0.16077, 0.160763, 0.160738,
-    0.160703, 0.160667, 0.160639, 0.160627, 0.160641, 0.160689,
-    0.160778, 0.160917, 0.161112, 0.16137, 0.161697, 0.162097,
-    0.162577, 0.163139, 0.163786, 0.164521, 0.165345, 0.166257,
-    0.167258, 0.168347, 0.16952, 0.170775, 0.172107, 0.173513,
-    0.174987, 0.176521, 0.178111, 0.179748, 0.181425, 0.183134,
-    0.184865, 0.186611, 0.188362, 0.19011, 0.191845, 0.193559,
-    0.195243, 0.19689, 0.198489, 0.200036, 0.201522, 0.20294,
-    0.204286, 0.205555, 0.206741, 0.207842, 0.208855, 0.209779,
-    0.210611, 0.211354, 0.212007, 0.212572, 0.213052, 0.213451,
-    0.213773, 0.214024, 0.214208, 0.214333, 0.214406, 0.214434,
-    0.214426, 0.21439, 0.214334, 0.214269, 0.214202, 0.214143,
-    0.214101, 0.214086, 0.214104, 0.214166, 0.214278, 0.214449,
-    0.214684, 0.214991, 0.215374, 0.215838, 0.216389, 0.217027,
-    0.217756, 0.218577, 0.219491, 0.220496, 0.221592, 0.222776,
-    0.224045, 0.225395, 0.226821, 0.228318, 0.229878, 0.231496,
-    0.233164, 0.234873, 0.236615, 0.238381, 0.240162, 0.24195,
-    0.243734, 0.245505, 0.247255, 0.248974, 0.250653, 0.252285,
-    0.253861, 0.255374, 0.256818, 0.258186, 0.259473, 0.260675,
-    0.261788, 0.262809, 0.263737, 0.264571, 0.26531, 0.265956,
-    0.26651, 0.266976, 0.267356, 0.267656, 0.267881, 0.268037,
-    0.26813, 0.268169, 0.26816, 0.268114, 0.268038, 0.267941,
-    0.267833, 0.267724, 0.267623, 0.26754, 0.267483, 0.267462,
-    0.267486, 0.267563, 0.2677, 0.267905, 0.268184, 0.268544,
-    0.268989, 0.269523, 0.270149, 0.270871, 0.271689, 0.272605,
-    0.273616, 0.274723, 0.275922, 0.277211, 0.278585, 0.280038,
-    0.281566, 0.283162, 0.284818, 0.286526, 0.288279, 0.290066,
-    0.291879, 0.293709, 0.295545, 0.297378, 0.299198, 0.300996,
-    0.302761, 0.304485, 0.306159, 0.307775, 0.309325, 0.310802,
-    0.312199, 0.313512, 0.314734, 0.315863, 0.316895, 0.317829,
-    0.318663, 0.319398, 0.320034, 0.320573, 0.321018, 0.321373,
-    0.321644, 0.321834, 0.321951, 0.322002, 0.321995, 0.321938,
-    0.32184, 0.321711, 0.321559, 0.321396, 0.321231, 0.321073,
-    0.320934, 0.320823, 0.32075, 0.320723, 0.320753, 0.320846,
-    0.321011, 0.321255, 0.321583, 0.322002, 0.322515, 0.323126,
-    0.323839, 0.324653, 0.325571, 0.326591, 0.327712, 0.328932,
-    0.330247, 0.331652, 0.333143, 0.334713, 0.336355, 0.338062,
-    0.339825, 0.341635, 0.343482, 0.345358, 0.347251, 0.349152,
-    0.351049, 0.352933, 0.354794, 0.356621, 0.358404, 0.360134,
-    0.361802, 0.3634, 0.36492, 0.366356, 0.367701, 0.368951,
-    0.3701, 0.371147, 0.372088, 0.372923, 0.373651, 0.374273,
-    0.374792, 0.375211, 0.375533, 0.375763, 0.375908, 0.375974,
-    0.37597, 0.375902, 0.375781, 0.375615, 0.375415, 0.375192,
-    0.374955, 0.374715, 0.374484, 0.374272, 0.37409, 0.373947,
-    0.373855, 0.373822, 0.373858, 0.37397, 0.374167, 0.374454,
-    0.374839, 0.375325, 0.375917, 0.376617, 0.377427, 0.378348,
-    0.379379, 0.38052, 0.381767, 0.383116, 0.384564, 0.386103,
-    0.387729, 0.389432, 0.391206, 0.39304, 0.394926, 0.396853,
-    0.39881, 0.400787, 0.402773, 0.404756, 0.406724, 0.408668,
-    0.410575, 0.412435, 0.414239, 0.415976, 0.417637, 0.419215,
-    0.420701, 0.422089, 0.423373, 0.42455, 0.425615, 0.426565,
-    0.4274, 0.42812, 0.428725, 0.429217, 0.4296, 0.429878,
-    0.430056, 0.430141, 0.43014, 0.430061, 0.429914, 0.429708,
-    0.429453, 0.42916, 0.428841, 0.428507, 0.42817, 0.427841,
-    0.427533, 0.427257, 0.427023, 0.426844, 0.42673, 0.426689,
-    0.426733, 0.426867, 0.427101, 0.427441, 0.427891, 0.428457,
-    0.429141, 0.429946, 0.430872, 0.431918, 0.433085, 0.434367,
-    0.435763, 0.437266, 0.438871, 0.440569, 0.442354, 0.444217,
-    0.446146, 0.448132, 0.450164, 0.45223, 0.454318, 0.456416,
-    0.458512, 0.460592, 0.462645, 0.464659, 0.466622, 0.468523,
-    0.470351, 0.472096, 0.473749, 0.475302, 0.476747, 0.478078,
-    0.47929, 0.480379, 0.481342, 0.482178, 0.482885, 0.483466,
-    0.483923, 0.484258, 0.484477, 0.484585, 0.48459, 0.4845,
-    0.484322, 0.484069, 0.483749, 0.483376, 0.482959, 0.482513,
-    0.482049, 0.481581, 0.481123, 0.480686, 0.480284, 0.479929,
-    0.479634, 0.47941, 0.479268, 0.479219, 0.479271, 0.479434,
-    0.479713, 0.480116, 0.480647, 0.48131, 0.482107, 0.48304,
-    0.484107, 0.485308, 0.48664, 0.488097, 0.489675, 0.491367,
-    0.493165, 0.49506, 0.497041, 0.499099, 0.50122, 0.503394,
-    0.505606, 0.507844, 0.510093, 0.512341, 0.514572, 0.516774,
-    0.518932, 0.521033, 0.523066, 0.525017, 0.526875, 0.52863,
-    0.530273, 0.531795, 0.533189, 0.534449, 0.535571, 0.53655,
-    0.537386, 0.538078, 0.538626, 0.539034, 0.539304, 0.539443,
-    0.539456, 0.539351, 0.539138, 0.538827, 0.538428, 0.537954,
-    0.537418, 0.536832, 0.536212, 0.535572, 0.534925, 0.534289,
-    0.533676, 0.533102, 0.532581, 0.532127, 0.531754, 0.531473,
-    0.531297, 0.531236, 0.5313, 0.531497, 0.531834, 0.532318,
-    0.532952, 0.533739, 0.534681, 0.535778, 0.537027, 0.538426,
-    0.539969, 0.541651, 0.543464, 0.545398, 0.547445, 0.549592,
-    0.551827, 0.554136, 0.556506, 0.558921, 0.561367, 0.563827,
-    0.566286, 0.568727, 0.571135, 0.573494, 0.575789, 0.578004,
-    0.580127, 0.582143, 0.584041, 0.58581, 0.587439, 0.588921,
-    0.590248, 0.591415, 0.592417, 0.593254, 0.593922, 0.594425,
-    0.594763, 0.594942, 0.594968, 0.594846, 0.594588, 0.594202,
-    0.593701, 0.593097, 0.592405, 0.591638, 0.590813, 0.589947,
-    0.589055, 0.588156, 0.587266, 0.586404, 0.585585, 0.584828,
-    0.584148, 0.583562, 0.583083, 0.582726, 0.582503, 0.582427,
-    0.582506, 0.582751, 0.583167, 0.583759, 0.584533, 0.585488,
-    0.586626, 0.587945, 0.58944, 0.591108, 0.592939, 0.594927,
-    0.59706, 0.599326, 0.601712, 0.604204, 0.606786, 0.609441,
-    0.612151, 0.614899, 0.617666, 0.620432, 0.623179, 0.625888,
-    0.62854, 0.631116, 0.633599, 0.635973, 0.63822, 0.640327,
-    0.64228, 0.644068, 0.645678, 0.647104, 0.648338, 0.649374,
-    0.650211, 0.650845, 0.65128, 0.651516, 0.651559, 0.651416,
-    0.651096, 0.650608, 0.649965, 0.649181, 0.648271, 0.647252,
-    0.646141, 0.644958, 0.643722, 0.642455, 0.641175, 0.639906,
-    0.638667, 0.637481, 0.636367, 0.635346, 0.634437, 0.633659,
-    0.633028, 0.632561, 0.632271, 0.632172, 0.632274, 0.632587,
-    0.633117, 0.633869, 0.634846, 0.636048, 0.637473, 0.639118,
-    0.640976, 0.643038, 0.645295, 0.647733, 0.650339, 0.653096,
-    0.655986, 0.658991, 0.662088, 0.665258, 0.668477, 0.671722,
-    0.674969, 0.678194, 0.681375, 0.684486, 0.687505, 0.69041,
-    0.693178, 0.695791, 0.698228, 0.700473, 0.70251, 0.704325,
-    0.705908, 0.707247, 0.708338, 0.709174, 0.709755, 0.710079,
-    0.710152, 0.709976, 0.709562, 0.708919, 0.708061, 0.707001,
-    0.705759, 0.704351, 0.702801, 0.70113, 0.699362, 0.697523,
-    0.695639, 0.693736, 0.691842, 0.689984, 0.688191, 0.686488,
-    0.684902, 0.683458, 0.682182, 0.681095, 0.680219, 0.679573,
-    0.679175, 0.67904, 0.679179, 0.679603, 0.68032, 0.681332,
-    0.682643, 0.68425, 0.686148, 0.688332, 0.690789, 0.693508,
-    0.696471, 0.699662, 0.703058, 0.706638, 0.710374, 0.714241,
-    0.71821, 0.722251, 0.726332, 0.730421, 0.734488, 0.738499,
-    0.742421, 0.746224, 0.749876, 0.753348, 0.756611, 0.759639,
-    0.762407, 0.764893, 0.767077, 0.768942, 0.770474, 0.771662,
-    0.772498, 0.772979, 0.773103, 0.772873, 0.772296, 0.77138,
-    0.77014, 0.768592, 0.766757, 0.764656, 0.762316, 0.759766,
-    0.757037, 0.754162, 0.751177, 0.748117, 0.745023, 0.741931,
-    0.738883, 0.735917, 0.733072, 0.730388, 0.727903, 0.725651,
-    0.723669, 0.721988, 0.720638, 0.719646, 0.719037, 0.718829,
-    0.719042, 0.719686, 0.720772, 0.722303, 0.72428, 0.7267,
-    0.729553, 0.732826, 0.736503, 0.740561, 0.744975, 0.749716,
-    0.754749, 0.760039, 0.765544, 0.771223, 0.77703, 0.782917,
-    0.788836, 0.794736, 0.800567, 0.806277, 0.811814, 0.81713,
-    0.822175, 0.826901, 0.831263, 0.83522, 0.838732, 0.841762,
-    0.844281, 0.846259, 0.847675, 0.848511, 0.848755, 0.848401,
-    0.847447, 0.845899, 0.843766, 0.841067, 0.837824, 0.834066,
-    0.829826, 0.825145, 0.820068, 0.814645, 0.80893, 0.802982,
-    0.796864, 0.790641, 0.784383, 0.778159, 0.772042, 0.766104,
-    0.760419, 0.75506, 0.750098, 0.745603, 0.741642, 0.738279,
-    0.735574, 0.733584, 0.732357, 0.731939, 0.732369, 0.733676,
-    0.735886, 0.739014, 0.743067, 0.748046, 0.75394, 0.760731,
-    0.768391, 0.776883, 0.78616, 0.796168, 0.806841, 0.818108,
-    0.829885, 0.842083, 0.854605, 0.867347, 0.880197, 0.893038,
-    0.905749, 0.918202, 0.930266, 0.94181, 0.952697, 0.962791,
-    0.971955, 0.980055, 0.986955, 0.992525, 0.996637, 0.999168,
-    1, 0.999022, 0.996131, 0.99123, 0.984233, 0.975063,
-    0.963651, 0.949943, 0.933894, 0.915471, 0.894652, 0.871432,
-    0.845814, 0.817816, 0.787469, 0.754817, 0.719918, 0.682839,
-    0.643664, 0.602486, 0.55941, 0.514553, 0.468041, 0.420011,
-    0.370608, 0.319985, 0.268302, 0.215727, 0.162431, 0.108592,
-    0.0543872, 2.22045e-16
-};
-
-static const float WAVE_SAW_090[DEFAULT_WAVELEN] = {
-    -0.0279086, -0.0557926, -0.0836275, -0.111389, -0.139052, -0.166594,
-    -0.19399, -0.221215, -0.248248, -0.275064, -0.30164, -0.327955,
-    -0.353985, -0.37971, -0.405108, -0.430159, -0.454841, -0.479136,
-    -0.503024, -0.526488, -0.549508, -0.572069, -0.594153, -0.615746,
-    -0.636831, -0.657394, -0.677423, -0.696905, -0.715827, -0.734179,
-    -0.75195, -0.769131, -0.785714, -0.80169, -0.817054, -0.831798,
-    -0.845919, -0.859412, -0.872274, -0.884503, -0.896096, -0.907054,
-    -0.917377, -0.927066, -0.936122, -0.94455, -0.952352, -0.959533,
-    -0.966099, -0.972055, -0.977409, -0.982169, -0.986342, -0.989938,
-    -0.992967, -0.99544, -0.997368, -0.998762, -0.999635, -1,
-    -0.999871, -0.999262, -0.998188, -0.996663, -0.994704, -0.992326,
-    -0.989546, -0.98638, -0.982845, -0.978959, -0.974739, -0.970203,
-    -0.965369, -0.960254, -0.954878, -0.949258, -0.943413, -0.937361,
-    -0.931121, -0.92471, -0.918147, -0.91145, -0.904638, -0.897727,
-    -0.890735, -0.88368, -0.876579, -0.869448, -0.862305, -0.855165,
-    -0.848044, -0.840958, -0.833921, -0.826948, -0.820053, -0.81325,
-    -0.806552, -0.799972, -0.793521, -0.787211, -0.781054, -0.775059,
-    -0.769236, -0.763596, -0.758145, -0.752893, -0.747847, -0.743013,
-    -0.738398, -0.734007, -0.729846, -0.725918, -0.722227, -0.718776,
-    -0.715567, -0.712603, -0.709884, -0.707412, -0.705185, -0.703203,
-    -0.701466, -0.699971, -0.698716, -0.697698, -0.696913, -0.696359,
-    -0.69603, -0.695921, -0.696028, -0.696344, -0.696863, -0.697579,
-    -0.698485, -0.699573, -0.700836, -0.702266, -0.703854, -0.705592,
-    -0.707472, -0.709484, -0.711618, -0.713867, -0.716219, -0.718666,
-    -0.721198, -0.723805, -0.726478, -0.729205, -0.731978, -0.734787,
-    -0.737621, -0.740471, -0.743327, -0.74618, -0.749021, -0.751839,
-    -0.754627, -0.757374, -0.760073, -0.762714, -0.76529, -0.767793,
-    -0.770214, -0.772547, -0.774784, -0.776919, -0.778945, -0.780856,
-    -0.782646, -0.78431, -0.785843, -0.78724, -0.788497, -0.78961,
-    -0.790577, -0.791392, -0.792055, -0.792563, -0.792914, -0.793106,
-    -0.793139, -0.793012, -0.792724, -0.792277, -0.79167, -0.790905,
-    -0.789984, -0.788906, -0.787676, -0.786295, -0.784766, -0.783093,
-    -0.781278, -0.779327, -0.777242, -0.775028, -0.77269, -0.770233,
-    -0.767662, -0.764983, -0.7622, -0.759321, -0.756351, -0.753296,
-    -0.750162, -0.746957, -0.743687, -0.740358, -0.736977, -0.733551,
-    -0.730087, -0.726593, -0.723074, -0.719538, -0.715992, -0.712443,
-    -0.708897, -0.705362, -0.701844, -0.698349, -0.694885, -0.691457,
-    -0.688072, -0.684735, -0.681454, -0.678232, -0.675076, -0.671991,
-    -0.668983, -0.666055, -0.663212, -0.66046, -0.657801, -0.655239,
-    -0.652779, -0.650423, -0.648174, -0.646036, -0.644009, -0.642097,
-    -0.640301, -0.638622, -0.637062, -0.635621, -0.634301, -0.6331,
-    -0.63202, -0.631059, -0.630217, -0.629494, -0.628887, -0.628395,
-    -0.628016, -0.627749, -0.627591, -0.627539, -0.62759, -0.627741,
-    -0.627989, -0.628331, -0.628762, -0.629279, -0.629877, -0.630552,
-    -0.6313, -0.632116, -0.632995, -0.633932, -0.634922, -0.635961,
-    -0.637042, -0.638161, -0.639312, -0.64049, -0.64169, -0.642906,
-    -0.644132, -0.645363, -0.646594, -0.64782, -0.649034, -0.650233,
-    -0.65141, -0.652561, -0.65368, -0.654763, -0.655805, -0.656801,
-    -0.657747, -0.658639, -0.659472, -0.660243, -0.660947, -0.661581,
-    -0.662142, -0.662627, -0.663032, -0.663354, -0.663592, -0.663742,
-    -0.663804, -0.663774, -0.663652, -0.663435, -0.663124, -0.662716,
-    -0.662213, -0.661612, -0.660914, -0.660119, -0.659228, -0.658241,
-    -0.657159, -0.655983, -0.654714, -0.653354, -0.651905, -0.650369,
-    -0.648748, -0.647044, -0.64526, -0.643398, -0.641462, -0.639455,
-    -0.637381, -0.635241, -0.633041, -0.630784, -0.628473, -0.626113,
-    -0.623708, -0.621262, -0.618779, -0.616263, -0.613719, -0.611152,
-    -0.608565, -0.605964, -0.603352, -0.600734, -0.598115, -0.595499,
-    -0.592891, -0.590295, -0.587715, -0.585156, -0.582621, -0.580116,
-    -0.577643, -0.575207, -0.572812, -0.570461, -0.568158, -0.565906,
-    -0.563709, -0.561569, -0.55949, -0.557475, -0.555525, -0.553644,
-    -0.551833, -0.550095, -0.548432, -0.546844, -0.545335, -0.543904,
-    -0.542553, -0.541283, -0.540094, -0.538987, -0.537962, -0.537019,
-    -0.536158, -0.535378, -0.534679, -0.53406, -0.53352, -0.533057,
-    -0.532671, -0.53236, -0.532121, -0.531953, -0.531854, -0.531822,
-    -0.531853, -0.531946, -0.532098, -0.532306, -0.532566, -0.532876,
-    -0.533233, -0.533633, -0.534072, -0.534548, -0.535056, -0.535593,
-    -0.536155, -0.536738, -0.537339, -0.537954, -0.538579, -0.539209,
-    -0.539842, -0.540473, -0.541098, -0.541714, -0.542317, -0.542903,
-    -0.543469, -0.54401, -0.544524, -0.545007, -0.545456, -0.545867,
-    -0.546237, -0.546564, -0.546844, -0.547075, -0.547254, -0.547378,
-    -0.547446, -0.547455, -0.547402, -0.547287, -0.547108, -0.546863,
-    -0.54655, -0.546169, -0.545718, -0.545198, -0.544606, -0.543943,
-    -0.543208, -0.542402, -0.541525, -0.540576, -0.539556, -0.538466,
-    -0.537307, -0.53608, -0.534786, -0.533425, -0.532001, -0.530514,
-    -0.528966, -0.527359, -0.525696, -0.523978, -0.522207, -0.520387,
-    -0.518521, -0.516609, -0.514656, -0.512665, -0.510638, -0.508578,
-    -0.506489, -0.504374, -0.502236, -0.500078, -0.497904, -0.495718,
-    -0.493521, -0.491319, -0.489114, -0.48691, -0.48471, -0.482518,
-    -0.480337, -0.47817, -0.47602, -0.473892, -0.471787, -0.469708,
-    -0.46766, -0.465645, -0.463665, -0.461724, -0.459823, -0.457966,
-    -0.456154, -0.454391, -0.452678, -0.451017, -0.449409, -0.447858,
-    -0.446364, -0.444928, -0.443552, -0.442237, -0.440984, -0.439794,
-    -0.438667, -0.437603, -0.436604, -0.435668, -0.434797, -0.43399,
-    -0.433246, -0.432564, -0.431946, -0.431388, -0.430891, -0.430454,
-    -0.430074, -0.429751, -0.429482, -0.429267, -0.429104, -0.428989,
-    -0.428923, -0.428901, -0.428922, -0.428983, -0.429082, -0.429217,
-    -0.429384, -0.429581, -0.429805, -0.430054, -0.430323, -0.430611,
-    -0.430913, -0.431228, -0.431553, -0.431883, -0.432216, -0.432549,
-    -0.432878, -0.433202, -0.433515, -0.433817, -0.434103, -0.434371,
-    -0.434618, -0.434841, -0.435038, -0.435205, -0.43534, -0.435441,
-    -0.435505, -0.43553, -0.435514, -0.435455, -0.43535, -0.435198,
-    -0.434998, -0.434747, -0.434444, -0.434088, -0.433678, -0.433213,
-    -0.432691, -0.432112, -0.431476, -0.430782, -0.430029, -0.429218,
-    -0.428348, -0.42742, -0.426434, -0.425391, -0.42429, -0.423133,
-    -0.421921, -0.420655, -0.419335, -0.417963, -0.416541, -0.415069,
-    -0.413551, -0.411987, -0.410379, -0.408729, -0.40704, -0.405313,
-    -0.403552, -0.401757, -0.399932, -0.39808, -0.396202, -0.394301,
-    -0.392381, -0.390443, -0.388491, -0.386528, -0.384555, -0.382577,
-    -0.380595, -0.378613, -0.376634, -0.37466, -0.372694, -0.370739,
-    -0.368798, -0.366873, -0.364967, -0.363083, -0.361223, -0.359389,
-    -0.357585, -0.355812, -0.354073, -0.352369, -0.350703, -0.349077,
-    -0.347492, -0.345951, -0.344455, -0.343004, -0.341602, -0.340249,
-    -0.338945, -0.337693, -0.336493, -0.335346, -0.334251, -0.333211,
-    -0.332224, -0.331292, -0.330414, -0.32959, -0.32882, -0.328104,
-    -0.32744, -0.326829, -0.32627, -0.325761, -0.325302, -0.324891,
-    -0.324527, -0.324209, -0.323936, -0.323705, -0.323515, -0.323364,
-    -0.32325, -0.323172, -0.323126, -0.323112, -0.323125, -0.323166,
-    -0.32323, -0.323315, -0.32342, -0.323541, -0.323675, -0.323821,
-    -0.323976, -0.324137, -0.324301, -0.324465, -0.324628, -0.324786,
-    -0.324937, -0.325078, -0.325206, -0.325319, -0.325416, -0.325492,
-    -0.325546, -0.325575, -0.325577, -0.32555, -0.325493, -0.325402,
-    -0.325276, -0.325112, -0.324911, -0.324668, -0.324384, -0.324057,
-    -0.323685, -0.323267, -0.322803, -0.32229, -0.321729, -0.321118,
-    -0.320458, -0.319746, -0.318985, -0.318172, -0.317308, -0.316393,
-    -0.315428, -0.314412, -0.313346, -0.312231, -0.311067, -0.309856,
-    -0.308597, -0.307293, -0.305944, -0.304551, -0.303117, -0.301642,
-    -0.300129, -0.298578, -0.296992, -0.295373, -0.293722, -0.292041,
-    -0.290334, -0.288601, -0.286845, -0.285069, -0.283275, -0.281465,
-    -0.279641, -0.277806, -0.275963, -0.274114, -0.272261, -0.270407,
-    -0.268555, -0.266707, -0.264866, -0.263033, -0.261212, -0.259405,
-    -0.257614, -0.255841, -0.25409, -0.252361, -0.250658, -0.248982,
-    -0.247335, -0.245719, -0.244137, -0.242589, -0.241078, -0.239605,
-    -0.238171, -0.236779, -0.235428, -0.234121, -0.232859, -0.231642,
-    -0.230471, -0.229347, -0.228271, -0.227242, -0.226262, -0.22533,
-    -0.224447, -0.223612, -0.222825, -0.222087, -0.221396, -0.220753,
-    -0.220155, -0.219604, -0.219097, -0.218634, -0.218214, -0.217836,
-    -0.217497, -0.217198, -0.216935, -0.216709, -0.216516, -0.216355,
-    -0.216225, -0.216123, -0.216047, -0.215996, -0.215967, -0.215957,
-    -0.215966, -0.21599, -0.216027, -0.216075, -0.216131, -0.216194,
-    -0.21626, -0.216327, -0.216393, -0.216455, -0.216512, -0.21656,
-    -0.216598, -0.216623, -0.216632, -0.216624, -0.216596, -0.216547,
-    -0.216473, -0.216374, -0.216247, -0.21609, -0.215901, -0.215679,
-    -0.215423, -0.21513, -0.214799, -0.214429, -0.214018, -0.213566,
-    -0.213072, -0.212534, -0.211951, -0.211324, -0.210651, -0.209932,
-    -0.209166, -0.208354, -0.207495, -0.20659, -0.205637, -0.204639,
-    -0.203595, -0.202505, -0.20137, -0.200192, -0.198969, -0.197705,
-    -0.196399, -0.195053, -0.193668, -0.192246, -0.190787, -0.189294,
-    -0.187768, -0.186211, -0.184624, -0.18301, -0.181369, -0.179706,
-    -0.17802, -0.176315, -0.174593, -0.172855, -0.171104, -0.169343,
-    -0.167573, -0.165797, -0.164017, -0.162236, -0.160456, -0.158678,
-    -0.156906, -0.155142, -0.153388, -0.151647, -0.149919, -0.148209,
-    -0.146517, -0.144846, -0.143198, -0.141575, -0.139979, -0.138411,
-    -0.136874, -0.135368, -0.133897, -0.13246, -0.13106, -0.129698,
-    -0.128375, -0.127092, -0.125851, -0.124652, -0.123495, -0.122382,
-    -0.121314, -0.12029, -0.119311, -0.118378, -0.117489, -0.116647,
-    -0.115849, -0.115097, -0.11439, -0.113726, -0.113107, -0.11253,
-    -0.111996, -0.111503, -0.111051, -0.110638, -0.110262, -0.109924,
-    -0.109621, -0.109352, -0.109115, -0.108909, -0.108732, -0.108582,
-    -0.108457, -0.108356, -0.108276, -0.108215, -0.108171, -0.108143,
-    -0.108128, -0.108123, -0.108127, -0.108137, -0.108151, -0.108167,
-    -0.108183, -0.108195, -0.108203, -0.108203, -0.108193, -0.108172,
-    -0.108137, -0.108086, -0.108017, -0.107927, -0.107816, -0.10768,
-    -0.107518, -0.107329, -0.107109, -0.106859, -0.106576, -0.106259,
-    -0.105906, -0.105516, -0.105088, -0.104621, -0.104113, -0.103564,
-    -0.102973, -0.102339, -0.101662, -0.100941, -0.100176, -0.0993669,
-    -0.0985128, -0.0976142, -0.0966711, -0.0956837, -0.0946522, -0.0935772,
-    -0.0924592, -0.0912987, -0.0900967, -0.0888538, -0.0875712, -0.0862498,
-    -0.0848909, -0.0834956, -0.0820654, -0.0806016, -0.0791059, -0.0775797,
-    -0.0760249, -0.0744431, -0.0728362, -0.071206, -0.0695546, -0.0678838,
-    -0.0661959, -0.0644928, -0.0627767, -0.0610497, -0.0593141, -0.057572,
-    -0.0558258, -0.0540775, -0.0523295, -0.050584, -0.0488433, -0.0471095,
-    -0.0453849, -0.0436716, -0.0419718, -0.0402876, -0.0386211, -0.0369743,
-    -0.0353492, -0.0337477, -0.0321717, -0.0306229, -0.0291032, -0.027614,
-    -0.0261571, -0.0247339, -0.0233457, -0.021994, -0.0206799, -0.0194046,
-    -0.0181691, -0.0169743, -0.015821, -0.0147099, -0.0136417, -0.0126168,
-    -0.0116356, -0.0106985, -0.00980543, -0.0089566, -0.00815189, -0.00739114,
-    -0.00667404, -0.00600021, -0.00536911, -0.00478013, -0.00423255, -0.00372552,
-    -0.00325811, -0.00282927, -0.00243787, -0.00208267, -0.00176235, -0.00147549,
-    -0.00122059, -0.000996069, -0.000800263, -0.000631441, -0.0004878, -0.000367475,
-    -0.00026854, -0.000189014, -0.000126867, -8.00254e-5, -4.6376e-5, -2.37718e-5,
-    -1.00377e-5, -2.97603e-6, -3.72146e-7, 2.22045e-16, 3.72146e-7, 2.97603e-6,
-    1.00377e-5, 2.37718e-5, 4.6376e-5, 8.00254e-5, 0.000126867, 0.000189014,
-    0.00026854, 0.000367475, 0.0004878, 0.000631441, 0.000800263, 0.000996069,
-    0.00122059, 0.00147549, 0.00176235, 0.00208267, 0.00243787, 0.00282927,
-    0.00325811, 0.00372552, 0.00423255, 0.00478013, 0.00536911, 0.00600021,
-    0.00667404, 0.00739114, 0.00815189, 0.0089566, 0.00980543, 0.0106985,
-    0.0116356, 0.0126168, 0.0136417, 0.0147099, 0.015821, 0.0169743,
-    0.0181691, 0.0194046, 0.0206799, 0.021994, 0.0233457, 0.0247339,
-    0.0261571, 0.027614, 0.0291032, 0.0306229, 0.0321717, 0.0337477,
-    0.0353492, 0.0369743, 0.0386211, 0.0402876, 0.0419718, 0.0436716,
-    0.0453849, 0.0471095, 0.0488433, 0.050584, 0.0523295, 0.0540775,
-    0.0558258, 0.057572, 0.0593141, 0.0610497, 0.0627767, 0.0644928,
-    0.0661959, 0.0678838, 0.0695546, 0.071206, 0.0728362, 0.0744431,
-    0.0760249, 0.0775797, 0.0791059, 0.0806016, 0.0820654, 0.0834956,
-    0.0848909, 0.0862498, 0.0875712, 0.0888538, 0.0900967, 0.0912987,
-    0.0924592, 0.0935772, 0.0946522, 0.0956837, 0.0966711, 0.0976142,
-    0.0985128, 0.0993669, 0.100176, 0.100941, 0.101662, 0.102339,
-    0.102973, 0.103564, 0.104113, 0.104621, 0.105088, 0.105516,
-    0.105906, 0.106259, 0.106576, 0.106859, 0.107109, 0.107329,
-    0.107518, 0.10768, 0.107816, 0.107927, 0.108017, 0.108086,
-    0.108137, 0.108172, 0.108193, 0.108203, 0.108203, 0.108195,
-    0.108183, 0.108167, 0.108151, 0.108137, 0.108127, 0.108123,
-    0.108128, 0.108143, 0.108171, 0.108215, 0.108276, 0.108356,
-    0.108457, 0.108582, 0.108732, 0.108909, 0.109115, 0.109352,
-    0.109621, 0.109924, 0.110262, 0.110638, 0.111051, 0.111503,
-    0.111996, 0.11253, 0.113107, 0.113726, 0.11439, 0.115097,
-    0.115849, 0.116647, 0.117489, 0.118378, 0.119311, 0.12029,
-    0.121314, 0.122382, 0.123495, 0.124652, 0.125851, 0.127092,
-    0.128375, 0.129698, 0.13106, 0.13246, 0.133897, 0.135368,
-    0.136874, 0.138411, 0.139979, 0.141575, 0.143198, 0.144846,
-    0.146517, 0.148209, 0.149919, 0.151647, 0.153388, 0.155142,
-    0.156906, 0.158678, 0.160456, 0.162236, 0.164017, 0.165797,
-    0.167573, 0.169343, 0.171104, 0.172855, 0.174593, 0.176315,
-    0.17802, 0.179706, 0.181369, 0.18301, 0.184624, 0.186211,
-    0.187768, 0.189294, 0.190787, 0.192246, 0.193668, 0.195053,
-    0.196399, 0.197705, 0.198969, 0.200192, 0.20137, 0.202505,
-    0.203595, 0.204639, 0.205637, 0.20659, 0.207495, 0.208354,
-    0.209166, 0.209932, 0.210651, 0.211324, 0.211951, 0.212534,
-    0.213072, 0.213566, 0.214018, 0.214429, 0.214799, 0.21513,
-    0.215423, 0.215679, 0.215901, 0.21609, 0.216247, 0.216374,
-    0.216473, 0.216547, 0.216596, 0.216624, 0.216632, 0.216623,
-    0.216598, 0.21656, 0.216512, 0.216455, 0.216393, 0.216327,
-    0.21626, 0.216194, 0.216131, 0.216075, 0.216027, 0.21599,
-    0.215966, 0.215957, 0.215967, 0.215996, 0.216047, 0.216123,
-    0.216225, 0.216355, 0.216516, 0.216709, 0.216935, 0.217198,
-    0.217497, 0.217836, 0.218214, 0.218634, 0.219097, 0.219604,
-    0.220155, 0.220753, 0.221396, 0.222087, 0.222825, 0.223612,
-    0.224447, 0.22533, 0.226262, 0.227242, 0.228271, 0.229347,
-    0.230471, 0.231642, 0.232859, 0.234121, 0.235428, 0.236779,
-    0.238171, 0.239605, 0.241078, 0.242589, 0.244137, 0.245719,
-    0.247335, 0.248982, 0.250658, 0.252361, 0.25409, 0.255841,
-    0.257614, 0.259405, 0.261212, 0.263033, 0.264866, 0.266707,
-    0.268555, 0.270407, 0.272261, 0.274114, 0.275963, 0.277806,
-    0.279641, 0.281465, 0.283275, 0.285069, 0.286845, 0.288601,
-    0.290334, 0.292041, 0.293722, 0.295373, 0.296992, 0.298578,
-    0.300129, 0.301642, 0.303117, 0.304551, 0.305944, 0.307293,
-    0.308597, 0.309856, 0.311067, 0.312231, 0.313346, 0.314412,
-    0.315428, 0.316393, 0.317308, 0.318172, 0.318985, 0.319746,
-    0.320458, 0.321118, 0.321729, 0.32229, 0.322803, 0.323267,
-    0.323685, 0.324057, 0.324384, 0.324668, 0.324911, 0.325112,
-    0.325276, 0.325402, 0.325493, 0.32555, 0.325577, 0.325575,
-    0.325546, 0.325492, 0.325416, 0.325319, 0.325206, 0.325078,
-    0.324937, 0.324786, 0.324628, 0.324465, 0.324301, 0.324137,
-    0.323976, 0.323821, 0.323675, 0.323541, 0.32342, 0.323315,
-    0.32323, 0.323166, 0.323125, 0.323112, 0.323126, 0.323172,
-    0.32325, 0.323364, 0.323515, 0.323705, 0.323936, 0.324209,
-    0.324527, 0.324891, 0.325302, 0.325761, 0.32627, 0.326829,
-    0.32744, 0.328104, 0.32882, 0.32959, 0.330414, 0.331292,
-    0.332224, 0.333211, 0.334251, 0.335346, 0.336493, 0.337693,
-    0.338945, 0.340249, 0.341602, 0.343004, 0.344455, 0.345951,
-    0.347492, 0.349077, 0.350703, 0.352369, 0.354073, 0.355812,
-    0.357585, 0.359389, 0.361223, 0.363083, 0.364967, 0.366873,
-    0.368798, 0.370739, 0.372694, 0.37466, 0.376634, 0.378613,
-    0.380595, 0.382577, 0.384555, 0.386528, 0.388491, 0.390443,
-    0.392381, 0.394301, 0.396202, 0.39808, 0.399932, 0.401757,
-    0.403552, 0.405313, 0.40704, 0.408729, 0.410379, 0.411987,
-    0.413551, 0.415069, 0.416541, 0.417963, 0.419335, 0.420655,
-    0.421921, 0.423133, 0.42429, 0.425391, 0.426434, 0.42742,
-    0.428348, 0.429218, 0.430029, 0.430782, 0.431476, 0.432112,
-    0.432691, 0.433213, 0.433678, 0.434088, 0.434444, 0.434747,
-    0.434998, 0.435198, 0.43535, 0.435455, 0.435514, 0.43553,
-    0.435505, 0.435441, 0.43534, 0.435205, 0.435038, 0.434841,
-    0.434618, 0.434371, 0.434103, 0.433817, 0.433515, 0.433202,
-    0.432878, 0.432549, 0.432216, 0.431883, 0.431553, 0.431228,
-    0.430913, 0.430611, 0.430323, 0.430054, 0.429805, 0.429581,
-    0.429384, 0.429217, 0.429082, 0.428983, 0.428922, 0.428901,
-    0.428923, 0.428989, 0.429104, 0.429267, 0.429482, 0.429751,
-    0.430074, 0.430454, 0.430891, 0.431388, 0.431946, 0.432564,
-    0.433246, 0.43399, 0.434797, 0.435668, 0.436604, 0.437603,
-    0.438667, 0.439794, 0.440984, 0.442237, 0.443552, 0.444928,
-    0.446364, 0.447858, 0.449409, 0.451017, 0.452678, 0.454391,
-    0.456154, 0.457966, 0.459823, 0.461724, 0.463665, 0.465645,
-    0.46766, 0.469708, 0.471787, 0.473892, 0.47602, 0.47817,
-    0.480337, 0.482518, 0.48471, 0.48691, 0.489114, 0.491319,
-    0.493521, 0.495718, 0.497904, 0.500078, 0.502236, 0.504374,
-    0.506489, 0.508578, 0.510638, 0.512665, 0.514656, 0.516609,
-    0.518521, 0.520387, 0.522207, 0.523978, 0.525696, 0.527359,
-    0.528966, 0.530514, 0.532001, 0.533425, 0.534786, 0.53608,
-    0.537307, 0.538466, 0.539556, 0.540576, 0.541525, 0.542402,
-    0.543208, 0.543943, 0.544606, 0.545198, 0.545718, 0.546169,
-    0.54655, 0.546863, 0.547108, 0.547287, 0.547402, 0.547455,
-    0.547446, 0.547378, 0.547254, 0.547075, 0.546844, 0.546564,
-    0.546237, 0.545867, 0.545456, 0.545007, 0.544524, 0.54401,
-    0.543469, 0.542903, 0.542317, 0.541714, 0.541098, 0.540473,
-    0.539842, 0.539209, 0.538579, 0.537954, 0.537339, 0.536738,
-    0.536155, 0.535593, 0.535056, 0.534548, 0.534072, 0.533633,
-    0.533233, 0.532876, 0.532566, 0.532306, 0.532098, 0.531946,
-    0.531853, 0.531822, 0.531854, 0.531953, 0.532121, 0.53236,
-    0.532671, 0.533057, 0.53352, 0.53406, 0.534679, 0.535378,
-    0.536158, 0.537019, 0.537962, 0.538987, 0.540094, 0.541283,
-    0.542553, 0.543904, 0.545335, 0.546844, 0.548432, 0.550095,
-    0.551833, 0.553644, 0.555525, 0.557475, 0.55949, 0.561569,
-    0.563709, 0.565906, 0.568158, 0.570461, 0.572812, 0.575207,
-    0.577643, 0.580116, 0.582621, 0.585156, 0.587715, 0.590295,
-    0.592891, 0.595499, 0.598115, 0.600734, 0.603352, 0.605964,
-    0.608565, 0.611152, 0.613719, 0.616263, 0.618779, 0.621262,
-    0.623708, 0.626113, 0.628473, 0.630784, 0.633041, 0.635241,
-    0.637381, 0.639455, 0.641462, 0.643398, 0.64526, 0.647044,
-    0.648748, 0.650369, 0.651905, 0.653354, 0.654714, 0.655983,
-    0.657159, 0.658241, 0.659228, 0.660119, 0.660914, 0.661612,
-    0.662213, 0.662716, 0.663124, 0.663435, 0.663652, 0.663774,
-    0.663804, 0.663742, 0.663592, 0.663354, 0.663032, 0.662627,
-    0.662142, 0.661581, 0.660947, 0.660243, 0.659472, 0.658639,
-    0.657747, 0.656801, 0.655805, 0.654763, 0.65368, 0.652561,
-    0.65141, 0.650233, 0.649034, 0.64782, 0.646594, 0.645363,
-    0.644132, 0.642906, 0.64169, 0.64049, 0.639312, 0.638161,
-    0.637042, 0.635961, 0.634922, 0.633932, 0.632995, 0.632116,
-    0.6313, 0.630552, 0.629877, 0.629279, 0.628762, 0.628331,
-    0.627989, 0.627741, 0.62759, 0.627539, 0.627591, 0.627749,
-    0.628016, 0.628395, 0.628887, 0.629494, 0.630217, 0.631059,
-    0.63202, 0.6331, 0.634301, 0.635621, 0.637062, 0.638622,
-    0.640301, 0.642097, 0.644009, 0.646036, 0.648174, 0.650423,
-    0.652779, 0.655239, 0.657801, 0.66046, 0.663212, 0.666055,
-    0.668983, 0.671991, 0.675076, 0.678232, 0.681454, 0.684735,
-    0.688072, 0.691457, 0.694885, 0.698349, 0.701844, 0.705362,
-    0.708897, 0.712443, 0.715992, 0.719538, 0.723074, 0.726593,
-    0.730087, 0.733551, 0.736977, 0.740358, 0.743687, 0.746957,
-    0.750162, 0.753296, 0.756351, 0.759321, 0.7622, 0.764983,
-    0.767662, 0.770233, 0.77269, 0.775028, 0.777242, 0.779327,
-    0.781278, 0.783093, 0.784766, 0.786295, 0.787676, 0.788906,
-    0.789984, 0.790905, 0.79167, 0.792277, 0.792724, 0.793012,
-    0.793139, 0.793106, 0.792914, 0.792563, 0.792055, 0.791392,
-    0.790577, 0.78961, 0.788497, 0.78724, 0.785843, 0.78431,
-    0.782646, 0.780856, 0.778945, 0.776919, 0.774784, 0.772547,
-    0.770214, 0.767793, 0.76529, 0.762714, 0.760073, 0.757374,
-    0.754627, 0.751839, 0.749021, 0.74618, 0.743327, 0.740471,
-    0.737621, 0.734787, 0.731978, 0.729205, 0.726478, 0.723805,
-    0.721198, 0.718666, 0.716219, 0.713867, 0.711618, 0.709484,
-    0.707472, 0.705592, 0.703854, 0.702266, 0.700836, 0.699573,
-    0.698485, 0.697579, 0.696863, 0.696344, 0.696028, 0.695921,
-    0.69603, 0.696359, 0.696913, 0.697698, 0.698716, 0.699971,
-    0.701466, 0.703203, 0.705185, 0.707412, 0.709884, 0.712603,
-    0.715567, 0.718776, 0.722227, 0.725918, 0.729846, 0.734007,
-    0.738398, 0.743013, 0.747847, 0.752893, 0.758145, 0.763596,
-    0.769236, 0.775059, 0.781054, 0.787211, 0.793521, 0.799972,
-    0.806552, 0.81325, 0.820053, 0.826948, 0.833921, 0.840958,
-    0.848044, 0.855165, 0.862305, 0.869448, 0.876579, 0.88368,
-    0.890735, 0.897727, 0.904638, 0.91145, 0.918147, 0.92471,
-    0.931121, 0.937361, 0.943413, 0.949258, 0.954878, 0.960254,
-    0.965369, 0.970203, 0.974739, 0.978959, 0.982845, 0.98638,
-    0.989546, 0.992326, 0.994704, 0.996663, 0.998188, 0.999262,
-    0.999871, 1, 0.999635, 0.998762, 0.997368, 0.99544,
-    0.992967, 0.989938, 0.986342, 0.982169, 0.977409, 0.972055,
-    0.966099, 0.959533, 0.952352, 0.94455, 0.936122, 0.927066,
-    0.917377, 0.907054, 0.896096, 0.884503, 0.872274, 0.859412,
-    0.845919, 0.831798, 0.817054, 0.80169, 0.785714, 0.769131,
-    0.75195, 0.734179, 0.715827, 0.696905, 0.677423, 0.657394,
-    0.636831, 0.615746, 0.594153, 0.572069, 0.549508, 0.526488,
-    0.503024, 0.479136, 0.454841, 0.430159, 0.405108, 0.37971,
-    0.353985, 0.327955, 0.30164, 0.275064, 0.248248, 0.221215,
-    0.19399, 0.166594, 0.139052, 0.111389, 0.0836275, 0.0557926,
-    0.0279086, 0
-};
-
-static const float WAVE_SAW_102[DEFAULT_WAVELEN] = {
-    -0.0146597, -0.0293159, -0.043965, -0.0586036, -0.0732281, -0.0878351,
-    -0.102421, -0.116982, -0.131516, -0.146017, -0.160484, -0.174913,
-    -0.1893, -0.203641, -0.217934, -0.232175, -0.24636, -0.260487,
-    -0.274552, -0.288552, -0.302483, -0.316342, -0.330127, -0.343833,
-    -0.357459, -0.371, -0.384453, -0.397816, -0.411086, -0.424259,
-    -0.437334, -0.450306, -0.463172, -0.475932, -0.48858, -0.501115,
-    -0.513535, -0.525836, -0.538015, -0.550071, -0.562001, -0.573803,
-    -0.585473, -0.59701, -0.608412, -0.619676, -0.6308, -0.641782,
-    -0.65262, -0.663312, -0.673856, -0.68425, -0.694493, -0.704582,
-    -0.714515, -0.724292, -0.733911, -0.74337, -0.752667, -0.761802,
-    -0.770772, -0.779578, -0.788216, -0.796687, -0.804989, -0.813122,
-    -0.821084, -0.828874, -0.836491, -0.843935, -0.851206, -0.858302,
-    -0.865223, -0.871968, -0.878537, -0.88493, -0.891146, -0.897186,
-    -0.903048, -0.908733, -0.914241, -0.919572, -0.924725, -0.929702,
-    -0.934502, -0.939125, -0.943573, -0.947845, -0.951941, -0.955863,
-    -0.959611, -0.963185, -0.966587, -0.969817, -0.972875, -0.975764,
-    -0.978483, -0.981034, -0.983417, -0.985635, -0.987688, -0.989577,
-    -0.991304, -0.992869, -0.994275, -0.995523, -0.996614, -0.99755,
-    -0.998333, -0.998963, -0.999443, -0.999775, -0.99996, -1,
-    -0.999897, -0.999653, -0.999269, -0.998749, -0.998093, -0.997304,
-    -0.996384, -0.995335, -0.994159, -0.992859, -0.991437, -0.989894,
-    -0.988234, -0.986458, -0.98457, -0.98257, -0.980463, -0.978249,
-    -0.975932, -0.973515, -0.970998, -0.968386, -0.965681, -0.962884,
-    -0.959999, -0.957029, -0.953975, -0.950841, -0.947629, -0.944342,
-    -0.940981, -0.937551, -0.934053, -0.930491, -0.926866, -0.923182,
-    -0.919441, -0.915645, -0.911798, -0.907903, -0.90396, -0.899974,
-    -0.895947, -0.891881, -0.88778, -0.883645, -0.879479, -0.875285,
-    -0.871066, -0.866823, -0.86256, -0.858279, -0.853982, -0.849672,
-    -0.845351, -0.841022, -0.836687, -0.832348, -0.828009, -0.82367,
-    -0.819335, -0.815006, -0.810684, -0.806373, -0.802074, -0.797789,
-    -0.793521, -0.789272, -0.785043, -0.780837, -0.776656, -0.772501,
-    -0.768375, -0.76428, -0.760216, -0.756187, -0.752193, -0.748237,
-    -0.74432, -0.740444, -0.73661, -0.73282, -0.729076, -0.725379,
-    -0.721729, -0.71813, -0.714581, -0.711085, -0.707643, -0.704255,
-    -0.700923, -0.697648, -0.694431, -0.691273, -0.688175, -0.685138,
-    -0.682163, -0.67925, -0.676401, -0.673616, -0.670896, -0.668241,
-    -0.665653, -0.663131, -0.660676, -0.658288, -0.655969, -0.653718,
-    -0.651535, -0.649421, -0.647377, -0.645402, -0.643496, -0.641659,
-    -0.639893, -0.638195, -0.636567, -0.635009, -0.633519, -0.632099,
-    -0.630748, -0.629465, -0.62825, -0.627103, -0.626024, -0.625012,
-    -0.624067, -0.623187, -0.622373, -0.621624, -0.62094, -0.620319,
-    -0.619761, -0.619266, -0.618832, -0.618459, -0.618145, -0.617891,
-    -0.617695, -0.617556, -0.617473, -0.617446, -0.617473, -0.617553,
-    -0.617686, -0.617869, -0.618103, -0.618385, -0.618715, -0.619092,
-    -0.619514, -0.619979, -0.620488, -0.621039, -0.621629, -0.622259,
-    -0.622926, -0.623629, -0.624368, -0.62514, -0.625945, -0.62678,
-    -0.627645, -0.628538, -0.629457, -0.630402, -0.631371, -0.632362,
-    -0.633374, -0.634405, -0.635455, -0.636521, -0.637602, -0.638697,
-    -0.639805, -0.640923, -0.642051, -0.643186, -0.644328, -0.645476,
-    -0.646626, -0.64778, -0.648933, -0.650087, -0.651238, -0.652386,
-    -0.653529, -0.654667, -0.655796, -0.656917, -0.658028, -0.659128,
-    -0.660214, -0.661287, -0.662345, -0.663386, -0.664409, -0.665413,
-    -0.666398, -0.667361, -0.668301, -0.669218, -0.670111, -0.670978,
-    -0.671818, -0.67263, -0.673413, -0.674167, -0.67489, -0.675581,
-    -0.676239, -0.676864, -0.677455, -0.678011, -0.67853, -0.679013,
-    -0.679459, -0.679866, -0.680234, -0.680563, -0.680852, -0.6811,
-    -0.681307, -0.681471, -0.681594, -0.681673, -0.68171, -0.681702,
-    -0.681651, -0.681555, -0.681415, -0.681229, -0.680998, -0.680722,
-    -0.6804, -0.680032, -0.679618, -0.679158, -0.678651, -0.678099,
-    -0.6775, -0.676855, -0.676164, -0.675426, -0.674643, -0.673814,
-    -0.672939, -0.672019, -0.671054, -0.670043, -0.668988, -0.667888,
-    -0.666745, -0.665557, -0.664327, -0.663053, -0.661737, -0.660379,
-    -0.65898, -0.65754, -0.656059, -0.654538, -0.652979, -0.651381,
-    -0.649744, -0.648071, -0.646361, -0.644615, -0.642834, -0.641018,
-    -0.639169, -0.637287, -0.635373, -0.633427, -0.631451, -0.629446,
-    -0.627412, -0.62535, -0.623261, -0.621146, -0.619007, -0.616843,
-    -0.614655, -0.612446, -0.610216, -0.607965, -0.605695, -0.603406,
-    -0.6011, -0.598779, -0.596441, -0.59409, -0.591726, -0.589349,
-    -0.586961, -0.584563, -0.582156, -0.579742, -0.57732, -0.574892,
-    -0.57246, -0.570024, -0.567585, -0.565144, -0.562703, -0.560262,
-    -0.557822, -0.555385, -0.552952, -0.550522, -0.548099, -0.545681,
-    -0.543272, -0.54087, -0.538478, -0.536097, -0.533726, -0.531368,
-    -0.529023, -0.526692, -0.524377, -0.522077, -0.519794, -0.517528,
-    -0.515281, -0.513053, -0.510846, -0.508659, -0.506494, -0.504351,
-    -0.502232, -0.500136, -0.498065, -0.496019, -0.494, -0.492007,
-    -0.490041, -0.488103, -0.486194, -0.484313, -0.482462, -0.480642,
-    -0.478852, -0.477092, -0.475365, -0.473669, -0.472006, -0.470376,
-    -0.468778, -0.467215, -0.465685, -0.464189, -0.462727, -0.4613,
-    -0.459908, -0.458551, -0.457229, -0.455942, -0.454691, -0.453476,
-    -0.452296, -0.451152, -0.450044, -0.448971, -0.447935, -0.446934,
-    -0.445968, -0.445038, -0.444144, -0.443285, -0.442461, -0.441672,
-    -0.440918, -0.440198, -0.439513, -0.438862, -0.438244, -0.43766,
-    -0.437109, -0.436591, -0.436105, -0.435651, -0.435229, -0.434838,
-    -0.434477, -0.434147, -0.433846, -0.433575, -0.433332, -0.433117,
-    -0.43293, -0.43277, -0.432636, -0.432528, -0.432445, -0.432387,
-    -0.432352, -0.432341, -0.432352, -0.432385, -0.432439, -0.432513,
-    -0.432607, -0.43272, -0.432851, -0.433, -0.433165, -0.433345,
-    -0.433541, -0.433751, -0.433975, -0.434211, -0.434459, -0.434718,
-    -0.434987, -0.435265, -0.435552, -0.435846, -0.436148, -0.436455,
-    -0.436767, -0.437084, -0.437404, -0.437727, -0.438051, -0.438376,
-    -0.438701, -0.439026, -0.439349, -0.439669, -0.439986, -0.440299,
-    -0.440607, -0.440909, -0.441205, -0.441493, -0.441773, -0.442045,
-    -0.442306, -0.442557, -0.442797, -0.443024, -0.443239, -0.443441,
-    -0.443628, -0.4438, -0.443957, -0.444097, -0.44422, -0.444326,
-    -0.444414, -0.444482, -0.444531, -0.44456, -0.444568, -0.444555,
-    -0.44452, -0.444463, -0.444383, -0.444279, -0.444151, -0.444,
-    -0.443823, -0.443621, -0.443393, -0.443139, -0.442859, -0.442551,
-    -0.442217, -0.441855, -0.441465, -0.441048, -0.440601, -0.440126,
-    -0.439623, -0.43909, -0.438528, -0.437936, -0.437315, -0.436664,
-    -0.435984, -0.435273, -0.434533, -0.433762, -0.432962, -0.432131,
-    -0.43127, -0.43038, -0.429459, -0.428508, -0.427528, -0.426518,
-    -0.425478, -0.424409, -0.423311, -0.422184, -0.421028, -0.419843,
-    -0.41863, -0.417389, -0.41612, -0.414823, -0.413499, -0.412149,
-    -0.410772, -0.409369, -0.40794, -0.406485, -0.405006, -0.403502,
-    -0.401974, -0.400423, -0.398849, -0.397252, -0.395632, -0.393992,
-    -0.39233, -0.390648, -0.388946, -0.387224, -0.385484, -0.383725,
-    -0.381949, -0.380156, -0.378347, -0.376522, -0.374682, -0.372828,
-    -0.37096, -0.369079, -0.367186, -0.365281, -0.363365, -0.361438,
-    -0.359502, -0.357558, -0.355605, -0.353644, -0.351677, -0.349704,
-    -0.347726, -0.345743, -0.343757, -0.341767, -0.339775, -0.337781,
-    -0.335787, -0.333792, -0.331798, -0.329806, -0.327815, -0.325827,
-    -0.323843, -0.321863, -0.319887, -0.317918, -0.315954, -0.313998,
-    -0.31205, -0.310109, -0.308178, -0.306257, -0.304346, -0.302447,
-    -0.300558, -0.298683, -0.29682, -0.294971, -0.293136, -0.291316,
-    -0.289511, -0.287722, -0.28595, -0.284195, -0.282457, -0.280738,
-    -0.279037, -0.277355, -0.275693, -0.274052, -0.27243, -0.27083,
-    -0.269251, -0.267694, -0.266159, -0.264647, -0.263158, -0.261692,
-    -0.26025, -0.258832, -0.257438, -0.256069, -0.254725, -0.253405,
-    -0.252111, -0.250843, -0.2496, -0.248383, -0.247193, -0.246028,
-    -0.24489, -0.243778, -0.242693, -0.241635, -0.240603, -0.239598,
-    -0.23862, -0.237668, -0.236743, -0.235845, -0.234973, -0.234128,
-    -0.23331, -0.232517, -0.231752, -0.231012, -0.230298, -0.22961,
-    -0.228947, -0.22831, -0.227698, -0.227111, -0.226548, -0.22601,
-    -0.225496, -0.225006, -0.224539, -0.224095, -0.223674, -0.223275,
-    -0.222899, -0.222543, -0.22221, -0.221897, -0.221604, -0.221331,
-    -0.221078, -0.220843, -0.220627, -0.220429, -0.220248, -0.220085,
-    -0.219937, -0.219806, -0.21969, -0.219588, -0.219501, -0.219427,
-    -0.219367, -0.219319, -0.219282, -0.219257, -0.219242, -0.219237,
-    -0.219242, -0.219255, -0.219276, -0.219305, -0.21934, -0.219382,
-    -0.219429, -0.219481, -0.219536, -0.219596, -0.219658, -0.219722,
-    -0.219788, -0.219854, -0.219921, -0.219987, -0.220051, -0.220114,
-    -0.220175, -0.220232, -0.220285, -0.220334, -0.220378, -0.220416,
-    -0.220447, -0.220472, -0.220488, -0.220497, -0.220496, -0.220486,
-    -0.220466, -0.220435, -0.220393, -0.220338, -0.220272, -0.220192,
-    -0.220099, -0.219991, -0.219869, -0.219732, -0.219578, -0.219409,
-    -0.219223, -0.21902, -0.218799, -0.21856, -0.218303, -0.218027,
-    -0.217731, -0.217415, -0.21708, -0.216724, -0.216347, -0.215948,
-    -0.215528, -0.215087, -0.214623, -0.214136, -0.213627, -0.213095,
-    -0.212539, -0.211961, -0.211358, -0.210732, -0.210081, -0.209407,
-    -0.208708, -0.207985, -0.207237, -0.206464, -0.205667, -0.204845,
-    -0.203998, -0.203127, -0.20223, -0.201309, -0.200362, -0.199392,
-    -0.198396, -0.197375, -0.196331, -0.195261, -0.194168, -0.19305,
-    -0.191908, -0.190742, -0.189553, -0.18834, -0.187104, -0.185845,
-    -0.184563, -0.183258, -0.181932, -0.180583, -0.179213, -0.177822,
-    -0.17641, -0.174977, -0.173524, -0.172051, -0.170558, -0.169047,
-    -0.167517, -0.165969, -0.164403, -0.162819, -0.161219, -0.159602,
-    -0.15797, -0.156322, -0.15466, -0.152983, -0.151292, -0.149587,
-    -0.147871, -0.146141, -0.144401, -0.142649, -0.140886, -0.139114,
-    -0.137332, -0.135542, -0.133743, -0.131937, -0.130124, -0.128305,
-    -0.12648, -0.12465, -0.122815, -0.120976, -0.119135, -0.11729,
-    -0.115444, -0.113596, -0.111748, -0.1099, -0.108052, -0.106205,
-    -0.10436, -0.102518, -0.100679, -0.0988432, -0.097012, -0.0951857,
-    -0.0933649, -0.0915504, -0.0897425, -0.0879421, -0.0861496, -0.0843657,
-    -0.0825909, -0.0808258, -0.0790711, -0.0773271, -0.0755946, -0.073874,
-    -0.0721659, -0.0704708, -0.0687893, -0.0671219, -0.0654689, -0.0638311,
-    -0.0622088, -0.0606024, -0.0590126, -0.0574396, -0.055884, -0.0543462,
-    -0.0528266, -0.0513256, -0.0498435, -0.0483808, -0.0469378, -0.0455149,
-    -0.0441124, -0.0427306, -0.0413699, -0.0400305, -0.0387126, -0.0374167,
-    -0.0361429, -0.0348914, -0.0336625, -0.0324563, -0.0312732, -0.0301131,
-    -0.0289764, -0.0278631, -0.0267734, -0.0257073, -0.024665, -0.0236465,
-    -0.022652, -0.0216814, -0.0207348, -0.0198122, -0.0189135, -0.0180389,
-    -0.0171882, -0.0163613, -0.0155583, -0.0147791, -0.0140235, -0.0132914,
-    -0.0125827, -0.0118972, -0.0112348, -0.0105954, -0.00997862, -0.00938438,
-    -0.00881243, -0.00826252, -0.00773441, -0.00722783, -0.00674248, -0.00627809,
-    -0.00583433, -0.00541089, -0.00500743, -0.00462359, -0.00425901, -0.00391332,
-    -0.00358612, -0.00327701, -0.00298558, -0.00271141, -0.00245405, -0.00221305,
-    -0.00198796, -0.00177831, -0.00158361, -0.00140337, -0.0012371, -0.00108429,
-    -0.000944406, -0.000816932, -0.000701332, -0.000597059, -0.000503564, -0.000420288,
-    -0.000346666, -0.000282126, -0.000226089, -0.000177974, -0.000137191, -0.000103146,
-    -7.52411e-5, -5.28743e-5, -3.54394e-5, -2.23272e-5, -1.29256e-5, -6.61989e-6,
-    -2.79342e-6, -8.27818e-7, -1.03488e-7, 2.22045e-16, 1.03488e-7, 8.27818e-7,
-    2.79342e-6, 6.61989e-6, 1.29256e-5, 2.23272e-5, 3.54394e-5, 5.28743e-5,
-    7.52411e-5, 0.000103146, 0.000137191, 0.000177974, 0.000226089, 0.000282126,
-    0.000346666, 0.000420288, 0.000503564, 0.000597059, 0.000701332, 0.000816932,
-    0.000944406, 0.00108429, 0.0012371, 0.00140337, 0.00158361, 0.00177831,
-    0.00198796, 0.00221305, 0.00245405, 0.00271141, 0.00298558, 0.00327701,
-    0.00358612, 0.00391332, 0.00425901, 0.00462359, 0.00500743, 0.00541089,
-    0.00583433, 0.00627809, 0.00674248, 0.00722783, 0.00773441, 0.00826252,
-    0.00881243, 0.00938438, 0.00997862, 0.0105954, 0.0112348, 0.0118972,
-    0.0125827, 0.0132914, 0.0140235, 0.0147791, 0.0155583, 0.0163613,
-    0.0171882, 0.0180389, 0.0189135, 0.0198122, 0.0207348, 0.0216814,
-    0.022652, 0.0236465, 0.024665, 0.0257073, 0.0267734, 0.0278631,
-    0.0289764, 0.0301131, 0.0312732, 0.0324563, 0.0336625, 0.0348914,
-    0.0361429, 0.0374167, 0.0387126, 0.0400305, 0.0413699, 0.0427306,
-    0.0441124, 0.0455149, 0.0469378, 0.0483808, 0.0498435, 0.0513256,
-    0.0528266, 0.0543462, 0.055884, 0.0574396, 0.0590126, 0.0606024,
-    0.0622088, 0.0638311, 0.0654689, 0.0671219, 0.0687893, 0.0704708,
-    0.0721659, 0.073874, 0.0755946, 0.0773271, 0.0790711, 0.0808258,
-    0.0825909, 0.0843657, 0.0861496, 0.0879421, 0.0897425, 0.0915504,
-    0.0933649, 0.0951857, 0.097012, 0.0988432, 0.100679, 0.102518,
-    0.10436, 0.106205, 0.108052, 0.1099, 0.111748, 0.113596,
-    0.115444, 0.11729, 0.119135, 0.120976, 0.122815, 0.12465,
-    0.12648, 0.128305, 0.130124, 0.131937, 0.133743, 0.135542,
-    0.137332, 0.139114, 0.140886, 0.142649, 0.144401, 0.146141,
-    0.147871, 0.149587, 0.151292, 0.152983, 0.15466, 0.156322,
-    0.15797, 0.159602, 0.161219, 0.162819, 0.164403, 0.165969,
-    0.167517, 0.169047, 0.170558, 0.172051, 0.173524, 0.174977,
-    0.17641, 0.177822, 0.179213, 0.180583, 0.181932, 0.183258,
-    0.184563, 0.185845, 0.187104, 0.18834, 0.189553, 0.190742,
-    0.191908, 0.19305, 0.194168, 0.195261, 0.196331, 0.197375,
-    0.198396, 0.199392, 0.200362, 0.201309, 0.20223, 0.203127,
-    0.203998, 0.204845, 0.205667, 0.206464, 0.207237, 0.207985,
-    0.208708, 0.209407, 0.210081, 0.210732, 0.211358, 0.211961,
-    0.212539, 0.213095, 0.213627, 0.214136, 0.214623, 0.215087,
-    0.215528, 0.215948, 0.216347, 0.216724, 0.21708, 0.217415,
-    0.217731, 0.218027, 0.218303, 0.21856, 0.218799, 0.21902,
-    0.219223, 0.219409, 0.219578, 0.219732, 0.219869, 0.219991,
-    0.220099, 0.220192, 0.220272, 0.220338, 0.220393, 0.220435,
-    0.220466, 0.220486, 0.220496, 0.220497, 0.220488, 0.220472,
-    0.220447, 0.220416, 0.220378, 0.220334, 0.220285, 0.220232,
-    0.220175, 0.220114, 0.220051, 0.219987, 0.219921, 0.219854,
-    0.219788, 0.219722, 0.219658, 0.219596, 0.219536, 0.219481,
-    0.219429, 0.219382, 0.21934, 0.219305, 0.219276, 0.219255,
-    0.219242, 0.219237, 0.219242, 0.219257, 0.219282, 0.219319,
-    0.219367, 0.219427, 0.219501, 0.219588, 0.21969, 0.219806,
-    0.219937, 0.220085, 0.220248, 0.220429, 0.220627, 0.220843,
-    0.221078, 0.221331, 0.221604, 0.221897, 0.22221, 0.222543,
-    0.222899, 0.223275, 0.223674, 0.224095, 0.224539, 0.225006,
-    0.225496, 0.22601, 0.226548, 0.227111, 0.227698, 0.22831,
-    0.228947, 0.22961, 0.230298, 0.231012, 0.231752, 0.232517,
-    0.23331, 0.234128, 0.234973, 0.235845, 0.236743, 0.237668,
-    0.23862, 0.239598, 0.240603, 0.241635, 0.242693, 0.243778,
-    0.24489, 0.246028, 0.247193, 0.248383, 0.2496, 0.250843,
-    0.252111, 0.253405, 0.254725, 0.256069, 0.257438, 0.258832,
-    0.26025, 0.261692, 0.263158, 0.264647, 0.266159, 0.267694,
-    0.269251, 0.27083, 0.27243, 0.274052, 0.275693, 0.277355,
-    0.279037, 0.280738, 0.282457, 0.284195, 0.28595, 0.287722,
-    0.289511, 0.291316, 0.293136, 0.294971, 0.29682, 0.298683,
-    0.300558, 0.302447, 0.304346, 0.306257, 0.308178, 0.310109,
-    0.31205, 0.313998, 0.315954, 0.317918, 0.319887, 0.321863,
-    0.323843, 0.325827, 0.327815, 0.329806, 0.331798, 0.333792,
-    0.335787, 0.337781, 0.339775, 0.341767, 0.343757, 0.345743,
-    0.347726, 0.349704, 0.351677, 0.353644, 0.355605, 0.357558,
-    0.359502, 0.361438, 0.363365, 0.365281, 0.367186, 0.369079,
-    0.37096, 0.372828, 0.374682, 0.376522, 0.378347, 0.380156,
-    0.381949, 0.383725, 0.385484, 0.387224, 0.388946, 0.390648,
-    0.39233, 0.393992, 0.395632, 0.397252, 0.398849, 0.400423,
-    0.401974, 0.403502, 0.405006, 0.406485, 0.40794, 0.409369,
-    0.410772, 0.412149, 0.413499, 0.414823, 0.41612, 0.417389,
-    0.41863, 0.419843, 0.421028, 0.422184, 0.423311, 0.424409,
-    0.425478, 0.426518, 0.427528, 0.428508, 0.429459, 0.43038,
-    0.43127, 0.432131, 0.432962, 0.433762, 0.434533, 0.435273,
-    0.435984, 0.436664, 0.437315, 0.437936, 0.438528, 0.43909,
-    0.439623, 0.440126, 0.440601, 0.441048, 0.441465, 0.441855,
-    0.442217, 0.442551, 0.442859, 0.443139, 0.443393, 0.443621,
-    0.443823, 0.444, 0.444151, 0.444279, 0.444383, 0.444463,
-    0.44452, 0.444555, 0.444568, 0.44456, 0.444531, 0.444482,
-    0.444414, 0.444326, 0.44422, 0.444097, 0.443957, 0.4438,
-    0.443628, 0.443441, 0.443239, 0.443024, 0.442797, 0.442557,
-    0.442306, 0.442045, 0.441773, 0.441493, 0.441205, 0.440909,
-    0.440607, 0.440299, 0.439986, 0.439669, 0.439349, 0.439026,
-    0.438701, 0.438376, 0.438051, 0.437727, 0.437404, 0.437084,
-    0.436767, 0.436455, 0.436148, 0.435846, 0.435552, 0.435265,
-    0.434987, 0.434718, 0.434459, 0.434211, 0.433975, 0.433751,
-    0.433541, 0.433345, 0.433165, 0.433, 0.432851, 0.43272,
-    0.432607, 0.432513, 0.432439, 0.432385, 0.432352, 0.432341,
-    0.432352, 0.432387, 0.432445, 0.432528, 0.432636, 0.43277,
-    0.43293, 0.433117, 0.433332, 0.433575, 0.433846, 0.434147,
-    0.434477, 0.434838, 0.435229, 0.435651, 0.436105, 0.436591,
-    0.437109, 0.43766, 0.438244, 0.438862, 0.439513, 0.440198,
-    0.440918, 0.441672, 0.442461, 0.443285, 0.444144, 0.445038,
-    0.445968, 0.446934, 0.447935, 0.448971, 0.450044, 0.451152,
-    0.452296, 0.453476, 0.454691, 0.455942, 0.457229, 0.458551,
-    0.459908, 0.4613, 0.462727, 0.464189, 0.465685, 0.467215,
-    0.468778, 0.470376, 0.472006, 0.473669, 0.475365, 0.477092,
-    0.478852, 0.480642, 0.482462, 0.484313, 0.486194, 0.488103,
-    0.490041, 0.492007, 0.494, 0.496019, 0.498065, 0.500136,
-    0.502232, 0.504351, 0.506494, 0.508659, 0.510846, 0.513053,
-    0.515281, 0.517528, 0.519794, 0.522077, 0.524377, 0.526692,
-    0.529023, 0.531368, 0.533726, 0.536097, 0.538478, 0.54087,
-    0.543272, 0.545681, 0.548099, 0.550522, 0.552952, 0.555385,
-    0.557822, 0.560262, 0.562703, 0.565144, 0.567585, 0.570024,
-    0.57246, 0.574892, 0.57732, 0.579742, 0.582156, 0.584563,
-    0.586961, 0.589349, 0.591726, 0.59409, 0.596441, 0.598779,
-    0.6011, 0.603406, 0.605695, 0.607965, 0.610216, 0.612446,
-    0.614655, 0.616843, 0.619007, 0.621146, 0.623261, 0.62535,
-    0.627412, 0.629446, 0.631451, 0.633427, 0.635373, 0.637287,
-    0.639169, 0.641018, 0.642834, 0.644615, 0.646361, 0.648071,
-    0.649744, 0.651381, 0.652979, 0.654538, 0.656059, 0.65754,
-    0.65898, 0.660379, 0.661737, 0.663053, 0.664327, 0.665557,
-    0.666745, 0.667888, 0.668988, 0.670043, 0.671054, 0.672019,
-    0.672939, 0.673814, 0.674643, 0.675426, 0.676164, 0.676855,
-    0.6775, 0.678099, 0.678651, 0.679158, 0.679618, 0.680032,
-    0.6804, 0.680722, 0.680998, 0.681229, 0.681415, 0.681555,
-    0.681651, 0.681702, 0.68171, 0.681673, 0.681594, 0.681471,
-    0.681307, 0.6811, 0.680852, 0.680563, 0.680234, 0.679866,
-    0.679459, 0.679013, 0.67853, 0.678011, 0.677455, 0.676864,
-    0.676239, 0.675581, 0.67489, 0.674167, 0.673413, 0.67263,
-    0.671818, 0.670978, 0.670111, 0.669218, 0.668301, 0.667361,
-    0.666398, 0.665413, 0.664409, 0.663386, 0.662345, 0.661287,
-    0.660214, 0.659128, 0.658028, 0.656917, 0.655796, 0.654667,
-    0.653529, 0.652386, 0.651238, 0.650087, 0.648933, 0.64778,
-    0.646626, 0.645476, 0.644328, 0.643186, 0.642051, 0.640923,
-    0.639805, 0.638697, 0.637602, 0.636521, 0.635455, 0.634405,
-    0.633374, 0.632362, 0.631371, 0.630402, 0.629457, 0.628538,
-    0.627645, 0.62678, 0.625945, 0.62514, 0.624368, 0.623629,
-    0.622926, 0.622259, 0.621629, 0.621039, 0.620488, 0.619979,
-    0.619514, 0.619092, 0.618715, 0.618385, 0.618103, 0.617869,
-    0.617686, 0.617553, 0.617473, 0.617446, 0.617473, 0.617556,
-    0.617695, 0.617891, 0.618145, 0.618459, 0.618832, 0.619266,
-    0.619761, 0.620319, 0.62094, 0.621624, 0.622373, 0.623187,
-    0.624067, 0.625012, 0.626024, 0.627103, 0.62825, 0.629465,
-    0.630748, 0.632099, 0.633519, 0.635009, 0.636567, 0.638195,
-    0.639893, 0.641659, 0.643496, 0.645402, 0.647377, 0.649421,
-    0.651535, 0.653718, 0.655969, 0.658288, 0.660676, 0.663131,
-    0.665653, 0.668241, 0.670896, 0.673616, 0.676401, 0.67925,
-    0.682163, 0.685138, 0.688175, 0.691273, 0.694431, 0.697648,
-    0.700923, 0.704255, 0.707643, 0.711085, 0.714581, 0.71813,
-    0.721729, 0.725379, 0.729076, 0.73282, 0.73661, 0.740444,
-    0.74432, 0.748237, 0.752193, 0.756187, 0.760216, 0.76428,
-    0.768375, 0.772501, 0.776656, 0.780837, 0.785043, 0.789272,
-    0.793521, 0.797789, 0.802074, 0.806373, 0.810684, 0.815006,
-    0.819335, 0.82367, 0.828009, 0.832348, 0.836687, 0.841022,
-    0.845351, 0.849672, 0.853982, 0.858279, 0.86256, 0.866823,
-    0.871066, 0.875285, 0.879479, 0.883645, 0.88778, 0.891881,
-    0.895947, 0.899974, 0.90396, 0.907903, 0.911798, 0.915645,
-    0.919441, 0.923182, 0.926866, 0.930491, 0.934053, 0.937551,
-    0.940981, 0.944342, 0.947629, 0.950841, 0.953975, 0.957029,
-    0.959999, 0.962884, 0.965681, 0.968386, 0.970998, 0.973515,
-    0.975932, 0.978249, 0.980463, 0.98257, 0.98457, 0.986458,
-    0.988234, 0.989894, 0.991437, 0.992859, 0.994159, 0.995335,
-    0.996384, 0.997304, 0.998093, 0.998749, 0.999269, 0.999653,
-    0.999897, 1, 0.99996, 0.999775, 0.999443, 0.998963,
-    0.998333, 0.99755, 0.996614, 0.995523, 0.994275, 0.992869,
-    0.991304, 0.989577, 0.987688, 0.985635, 0.983417, 0.981034,
-    0.978483, 0.975764, 0.972875, 0.969817, 0.966587, 0.963185,
-    0.959611, 0.955863, 0.951941, 0.947845, 0.943573, 0.939125,
-    0.934502, 0.929702, 0.924725, 0.919572, 0.914241, 0.908733,
-    0.903048, 0.897186, 0.891146, 0.88493, 0.878537, 0.871968,
-    0.865223, 0.858302, 0.851206, 0.843935, 0.836491, 0.828874,
-    0.821084, 0.813122, 0.804989, 0.796687, 0.788216, 0.779578,
-    0.770772, 0.761802, 0.752667, 0.74337, 0.733911, 0.724292,
-    0.714515, 0.704582, 0.694493, 0.68425, 0.673856, 0.663312,
-    0.65262, 0.641782, 0.6308, 0.619676, 0.608412, 0.59701,
-    0.585473, 0.573803, 0.562001, 0.550071, 0.538015, 0.525836,
-    0.513535, 0.501115, 0.48858, 0.475932, 0.463172, 0.450306,
-    0.437334, 0.424259, 0.411086, 0.397816, 0.384453, 0.371,
-    0.357459, 0.343833, 0.330127, 0.316342, 0.302483, 0.288552,
-    0.274552, 0.260487, 0.24636, 0.232175, 0.217934, 0.203641,
-    0.1893, 0.174913, 0.160484, 0.146017, 0.131516, 0.116982,
-    0.102421, 0.0878351, 0.0732281, 0.0586036, 0.043965, 0.0293159,
-    0.0146597, 2.22045e-16
-};
-
-static const float WAVE_SAW_114[DEFAULT_WAVELEN] = {
-    -0.00803502, -0.0160695, -0.0241028, -0.0321344, -0.0401638, -0.0481903,
-    -0.0562134, -0.0642325, -0.0722471, -0.0802567, -0.0882605, -0.0962581,
-    -0.104249, -0.112232, -0.120208, -0.128175, -0.136133, -0.144082,
-    -0.15202, -0.159948, -0.167864, -0.175769, -0.183661, -0.19154,
-    -0.199406, -0.207258, -0.215095, -0.222917, -0.230723, -0.238514,
-    -0.246287, -0.254043, -0.261782, -0.269502, -0.277203, -0.284885,
-    -0.292547, -0.300188, -0.307809, -0.315408, -0.322985, -0.330539,
-    -0.33807, -0.345578, -0.353062, -0.360521, -0.367955, -0.375363,
-    -0.382746, -0.390101, -0.39743, -0.404731, -0.412004, -0.419249,
-    -0.426464, -0.433651, -0.440807, -0.447932, -0.455027, -0.462091,
-    -0.469122, -0.476122, -0.483088, -0.490022, -0.496921, -0.503787,
-    -0.510618, -0.517415, -0.524176, -0.530901, -0.53759, -0.544242,
-    -0.550857, -0.557435, -0.563975, -0.570477, -0.57694, -0.583364,
-    -0.589748, -0.596093, -0.602397, -0.608661, -0.614884, -0.621065,
-    -0.627205, -0.633303, -0.639358, -0.645371, -0.65134, -0.657266,
-    -0.663148, -0.668987, -0.67478, -0.680529, -0.686233, -0.691891,
-    -0.697504, -0.703071, -0.708591, -0.714065, -0.719492, -0.724872,
-    -0.730204, -0.735488, -0.740725, -0.745913, -0.751053, -0.756144,
-    -0.761187, -0.766179, -0.771123, -0.776017, -0.78086, -0.785654,
-    -0.790397, -0.79509, -0.799732, -0.804323, -0.808862, -0.813351,
-    -0.817788, -0.822173, -0.826506, -0.830787, -0.835016, -0.839193,
-    -0.843317, -0.847388, -0.851407, -0.855372, -0.859285, -0.863144,
-    -0.86695, -0.870703, -0.874402, -0.878048, -0.88164, -0.885178,
-    -0.888662, -0.892092, -0.895468, -0.89879, -0.902058, -0.905271,
-    -0.908431, -0.911536, -0.914586, -0.917583, -0.920524, -0.923412,
-    -0.926245, -0.929023, -0.931747, -0.934417, -0.937032, -0.939592,
-    -0.942098, -0.94455, -0.946948, -0.94929, -0.951579, -0.953813,
-    -0.955993, -0.958119, -0.960191, -0.962209, -0.964173, -0.966082,
-    -0.967938, -0.969741, -0.971489, -0.973184, -0.974826, -0.976414,
-    -0.977949, -0.979431, -0.98086, -0.982236, -0.983559, -0.98483,
-    -0.986048, -0.987214, -0.988327, -0.989389, -0.990399, -0.991357,
-    -0.992264, -0.993119, -0.993923, -0.994676, -0.995379, -0.996031,
-    -0.996632, -0.997184, -0.997685, -0.998137, -0.998539, -0.998891,
-    -0.999195, -0.99945, -0.999656, -0.999814, -0.999924, -0.999986,
-    -1, -0.999967, -0.999887, -0.99976, -0.999586, -0.999366,
-    -0.9991, -0.998788, -0.998431, -0.998029, -0.997582, -0.99709,
-    -0.996554, -0.995974, -0.99535, -0.994684, -0.993974, -0.993221,
-    -0.992426, -0.991589, -0.99071, -0.989789, -0.988828, -0.987826,
-    -0.986783, -0.985701, -0.984578, -0.983417, -0.982216, -0.980977,
-    -0.979699, -0.978384, -0.977031, -0.975641, -0.974214, -0.972751,
-    -0.971251, -0.969716, -0.968145, -0.96654, -0.9649, -0.963226,
-    -0.961518, -0.959777, -0.958003, -0.956196, -0.954357, -0.952486,
-    -0.950584, -0.948651, -0.946687, -0.944694, -0.94267, -0.940617,
-    -0.938535, -0.936425, -0.934286, -0.93212, -0.929927, -0.927706,
-    -0.92546, -0.923187, -0.920889, -0.918565, -0.916217, -0.913844,
-    -0.911448, -0.909028, -0.906585, -0.904119, -0.901631, -0.899122,
-    -0.896591, -0.894039, -0.891467, -0.888875, -0.886263, -0.883632,
-    -0.880983, -0.878315, -0.875629, -0.872925, -0.870205, -0.867468,
-    -0.864715, -0.861947, -0.859163, -0.856364, -0.853551, -0.850723,
-    -0.847883, -0.845029, -0.842162, -0.839284, -0.836393, -0.833491,
-    -0.830578, -0.827654, -0.824721, -0.821777, -0.818825, -0.815863,
-    -0.812893, -0.809915, -0.80693, -0.803937, -0.800937, -0.797932,
-    -0.79492, -0.791903, -0.78888, -0.785853, -0.782822, -0.779786,
-    -0.776747, -0.773706, -0.770661, -0.767614, -0.764565, -0.761515,
-    -0.758464, -0.755412, -0.752359, -0.749307, -0.746255, -0.743204,
-    -0.740154, -0.737106, -0.734059, -0.731015, -0.727974, -0.724936,
-    -0.721901, -0.71887, -0.715843, -0.712821, -0.709803, -0.706791,
-    -0.703784, -0.700783, -0.697789, -0.694801, -0.69182, -0.688846,
-    -0.68588, -0.682922, -0.679972, -0.677031, -0.674098, -0.671175,
-    -0.668262, -0.665358, -0.662464, -0.659581, -0.656708, -0.653847,
-    -0.650997, -0.648159, -0.645332, -0.642518, -0.639716, -0.636927,
-    -0.634151, -0.631388, -0.628639, -0.625904, -0.623183, -0.620476,
-    -0.617783, -0.615106, -0.612444, -0.609797, -0.607165, -0.60455,
-    -0.60195, -0.599367, -0.5968, -0.59425, -0.591716, -0.5892,
-    -0.586701, -0.58422, -0.581756, -0.57931, -0.576883, -0.574473,
-    -0.572083, -0.56971, -0.567357, -0.565023, -0.562707, -0.560411,
-    -0.558135, -0.555878, -0.553641, -0.551424, -0.549227, -0.54705,
-    -0.544893, -0.542757, -0.540641, -0.538547, -0.536473, -0.534419,
-    -0.532387, -0.530377, -0.528387, -0.526419, -0.524472, -0.522546,
-    -0.520643, -0.518761, -0.5169, -0.515062, -0.513245, -0.511451,
-    -0.509678, -0.507927, -0.506199, -0.504493, -0.502809, -0.501147,
-    -0.499507, -0.49789, -0.496295, -0.494723, -0.493173, -0.491645,
-    -0.49014, -0.488657, -0.487197, -0.485759, -0.484343, -0.48295,
-    -0.481579, -0.48023, -0.478904, -0.4776, -0.476319, -0.47506,
-    -0.473823, -0.472608, -0.471415, -0.470245, -0.469096, -0.467969,
-    -0.466865, -0.465782, -0.464721, -0.463682, -0.462664, -0.461668,
-    -0.460694, -0.459741, -0.458809, -0.457898, -0.457009, -0.456141,
-    -0.455293, -0.454467, -0.453661, -0.452876, -0.452111, -0.451367,
-    -0.450643, -0.449939, -0.449255, -0.448591, -0.447947, -0.447322,
-    -0.446717, -0.446131, -0.445565, -0.445017, -0.444489, -0.443979,
-    -0.443488, -0.443015, -0.44256, -0.442124, -0.441705, -0.441304,
-    -0.440921, -0.440556, -0.440207, -0.439876, -0.439561, -0.439263,
-    -0.438982, -0.438717, -0.438468, -0.438235, -0.438017, -0.437816,
-    -0.437629, -0.437458, -0.437302, -0.43716, -0.437033, -0.43692,
-    -0.436821, -0.436737, -0.436665, -0.436608, -0.436563, -0.436532,
-    -0.436513, -0.436507, -0.436513, -0.436531, -0.436561, -0.436603,
-    -0.436656, -0.43672, -0.436796, -0.436881, -0.436978, -0.437085,
-    -0.437201, -0.437328, -0.437463, -0.437609, -0.437763, -0.437926,
-    -0.438097, -0.438277, -0.438465, -0.43866, -0.438864, -0.439074,
-    -0.439291, -0.439516, -0.439747, -0.439984, -0.440227, -0.440476,
-    -0.44073, -0.44099, -0.441255, -0.441525, -0.441799, -0.442077,
-    -0.442359, -0.442646, -0.442935, -0.443228, -0.443524, -0.443823,
-    -0.444124, -0.444428, -0.444734, -0.445041, -0.44535, -0.44566,
-    -0.445971, -0.446282, -0.446595, -0.446907, -0.44722, -0.447532,
-    -0.447844, -0.448155, -0.448465, -0.448774, -0.449081, -0.449387,
-    -0.449691, -0.449992, -0.450291, -0.450588, -0.450881, -0.451171,
-    -0.451458, -0.451742, -0.452021, -0.452296, -0.452568, -0.452834,
-    -0.453096, -0.453353, -0.453604, -0.45385, -0.454091, -0.454325,
-    -0.454554, -0.454776, -0.454991, -0.4552, -0.455402, -0.455596,
-    -0.455784, -0.455963, -0.456135, -0.456299, -0.456455, -0.456602,
-    -0.456741, -0.456871, -0.456992, -0.457104, -0.457206, -0.457299,
-    -0.457382, -0.457455, -0.457518, -0.457571, -0.457613, -0.457645,
-    -0.457666, -0.457676, -0.457675, -0.457663, -0.457639, -0.457603,
-    -0.457556, -0.457497, -0.457425, -0.457342, -0.457246, -0.457138,
-    -0.457017, -0.456883, -0.456736, -0.456576, -0.456403, -0.456217,
-    -0.456017, -0.455804, -0.455577, -0.455336, -0.455081, -0.454813,
-    -0.45453, -0.454232, -0.453921, -0.453595, -0.453254, -0.452899,
-    -0.452529, -0.452144, -0.451745, -0.45133, -0.4509, -0.450455,
-    -0.449995, -0.449519, -0.449029, -0.448522, -0.448, -0.447463,
-    -0.44691, -0.446341, -0.445757, -0.445157, -0.444541, -0.443909,
-    -0.443261, -0.442597, -0.441918, -0.441222, -0.44051, -0.439782,
-    -0.439039, -0.438279, -0.437503, -0.43671, -0.435902, -0.435078,
-    -0.434237, -0.43338, -0.432507, -0.431618, -0.430713, -0.429791,
-    -0.428854, -0.4279, -0.426931, -0.425945, -0.424943, -0.423926,
-    -0.422892, -0.421842, -0.420777, -0.419695, -0.418598, -0.417485,
-    -0.416357, -0.415212, -0.414052, -0.412877, -0.411685, -0.410479,
-    -0.409257, -0.40802, -0.406767, -0.4055, -0.404217, -0.402919,
-    -0.401606, -0.400279, -0.398936, -0.397579, -0.396208, -0.394822,
-    -0.393421, -0.392006, -0.390577, -0.389134, -0.387677, -0.386206,
-    -0.384721, -0.383222, -0.38171, -0.380185, -0.378646, -0.377094,
-    -0.375529, -0.37395, -0.372359, -0.370756, -0.36914, -0.367511,
-    -0.36587, -0.364217, -0.362552, -0.360875, -0.359186, -0.357486,
-    -0.355774, -0.354051, -0.352317, -0.350572, -0.348816, -0.34705,
-    -0.345273, -0.343485, -0.341688, -0.33988, -0.338062, -0.336235,
-    -0.334398, -0.332552, -0.330697, -0.328833, -0.32696, -0.325078,
-    -0.323188, -0.321289, -0.319383, -0.317468, -0.315546, -0.313616,
-    -0.311678, -0.309734, -0.307782, -0.305824, -0.303859, -0.301887,
-    -0.29991, -0.297926, -0.295936, -0.293941, -0.29194, -0.289934,
-    -0.287922, -0.285906, -0.283885, -0.28186, -0.27983, -0.277796,
-    -0.275758, -0.273717, -0.271672, -0.269623, -0.267572, -0.265518,
-    -0.26346, -0.261401, -0.259339, -0.257275, -0.255209, -0.253141,
-    -0.251072, -0.249001, -0.24693, -0.244857, -0.242784, -0.24071,
-    -0.238636, -0.236562, -0.234488, -0.232414, -0.230341, -0.228269,
-    -0.226197, -0.224127, -0.222057, -0.21999, -0.217924, -0.21586,
-    -0.213798, -0.211738, -0.209681, -0.207627, -0.205575, -0.203526,
-    -0.201481, -0.199439, -0.197401, -0.195367, -0.193337, -0.191311,
-    -0.189289, -0.187272, -0.18526, -0.183253, -0.181251, -0.179254,
-    -0.177263, -0.175277, -0.173297, -0.171324, -0.169356, -0.167395,
-    -0.165441, -0.163493, -0.161552, -0.159619, -0.157692, -0.155773,
-    -0.153862, -0.151959, -0.150063, -0.148175, -0.146296, -0.144425,
-    -0.142562, -0.140709, -0.138864, -0.137028, -0.135201, -0.133384,
-    -0.131576, -0.129778, -0.127989, -0.12621, -0.124442, -0.122683,
-    -0.120935, -0.119197, -0.117469, -0.115753, -0.114047, -0.112352,
-    -0.110668, -0.108995, -0.107334, -0.105683, -0.104045, -0.102418,
-    -0.100802, -0.0991989, -0.0976074, -0.0960279, -0.0944605, -0.0929053,
-    -0.0913624, -0.089832, -0.0883141, -0.0868087, -0.085316, -0.0838361,
-    -0.082369, -0.0809149, -0.0794737, -0.0780456, -0.0766307, -0.0752289,
-    -0.0738404, -0.0724652, -0.0711035, -0.0697552, -0.0684204, -0.0670991,
-    -0.0657915, -0.0644975, -0.0632173, -0.0619508, -0.060698, -0.0594591,
-    -0.0582341, -0.057023, -0.0558258, -0.0546425, -0.0534732, -0.052318,
-    -0.0511767, -0.0500495, -0.0489364, -0.0478373, -0.0467523, -0.0456814,
-    -0.0446245, -0.0435818, -0.0425532, -0.0415386, -0.0405381, -0.0395517,
-    -0.0385794, -0.0376211, -0.0366768, -0.0357466, -0.0348303, -0.033928,
-    -0.0330397, -0.0321653, -0.0313047, -0.030458, -0.0296251, -0.028806,
-    -0.0280007, -0.027209, -0.0264309, -0.0256665, -0.0249156, -0.0241781,
-    -0.0234542, -0.0227435, -0.0220462, -0.0213622, -0.0206913, -0.0200335,
-    -0.0193888, -0.0187571, -0.0181382, -0.0175322, -0.0169389, -0.0163582,
-    -0.0157902, -0.0152346, -0.0146914, -0.0141605, -0.0136418, -0.0131352,
-    -0.0126406, -0.012158, -0.0116871, -0.011228, -0.0107805, -0.0103444,
-    -0.00991978, -0.00950639, -0.00910415, -0.00871295, -0.00833267, -0.00796318,
-    -0.00760437, -0.00725611, -0.00691827, -0.00659072, -0.00627334, -0.00596599,
-    -0.00566853, -0.00538084, -0.00510278, -0.00483419, -0.00457496, -0.00432492,
-    -0.00408394, -0.00385187, -0.00362857, -0.00341388, -0.00320766, -0.00300974,
-    -0.00281999, -0.00263824, -0.00246434, -0.00229812, -0.00213944, -0.00198812,
-    -0.00184401, -0.00170695, -0.00157676, -0.00145329, -0.00133637, -0.00122582,
-    -0.00112148, -0.00102318, -0.000930748, -0.000844011, -0.000762794, -0.000686925,
-    -0.000616226, -0.000550522, -0.000489636, -0.000433388, -0.000381601, -0.000334094,
-    -0.000290687, -0.000251198, -0.000215446, -0.000183248, -0.000154421, -0.000128779,
-    -0.00010614, -8.63184e-5, -6.91281e-5, -5.43832e-5, -4.18976e-5, -3.14842e-5,
-    -2.29559e-5, -1.61251e-5, -1.0804e-5, -6.80447e-6, -3.93816e-6, -2.0165e-6,
-    -8.50765e-7, -2.5209e-7, -3.15121e-8, 0, 3.15121e-8, 2.5209e-7,
-    8.50765e-7, 2.0165e-6, 3.93816e-6, 6.80447e-6, 1.0804e-5, 1.61251e-5,
-    2.29559e-5, 3.14842e-5, 4.18976e-5, 5.43832e-5, 6.91281e-5, 8.63184e-5,
-    0.00010614, 0.000128779, 0.000154421, 0.000183248, 0.000215446, 0.000251198,
-    0.000290687, 0.000334094, 0.000381601, 0.000433388, 0.000489636, 0.000550522,
-    0.000616226, 0.000686925, 0.000762794, 0.000844011, 0.000930748, 0.00102318,
-    0.00112148, 0.00122582, 0.00133637, 0.00145329, 0.00157676, 0.00170695,
-    0.00184401, 0.00198812, 0.00213944, 0.00229812, 0.00246434, 0.00263824,
-    0.00281999, 0.00300974, 0.00320766, 0.00341388, 0.00362857, 0.00385187,
-    0.00408394, 0.00432492, 0.00457496, 0.00483419, 0.00510278, 0.00538084,
-    0.00566853, 0.00596599, 0.00627334, 0.00659072, 0.00691827, 0.00725611,
-    0.00760437, 0.00796318, 0.00833267, 0.00871295, 0.00910415, 0.00950639,
-    0.00991978, 0.0103444, 0.0107805, 0.011228, 0.0116871, 0.012158,
-    0.0126406, 0.0131352, 0.0136418, 0.0141605, 0.0146914, 0.0152346,
-    0.0157902, 0.0163582, 0.0169389, 0.0175322, 0.0181382, 0.0187571,
-    0.0193888, 0.0200335, 0.0206913, 0.0213622, 0.0220462, 0.0227435,
-    0.0234542, 0.0241781, 0.0249156, 0.0256665, 0.0264309, 0.027209,
-    0.0280007, 0.028806, 0.0296251, 0.030458, 0.0313047, 0.0321653,
-    0.0330397, 0.033928, 0.0348303, 0.0357466, 0.0366768, 0.0376211,
-    0.0385794, 0.0395517, 0.0405381, 0.0415386, 0.0425532, 0.0435818,
-    0.0446245, 0.0456814, 0.0467523, 0.0478373, 0.0489364, 0.0500495,
-    0.0511767, 0.052318, 0.0534732, 0.0546425, 0.0558258, 0.057023,
-    0.0582341, 0.0594591, 0.060698, 0.0619508, 0.0632173, 0.0644975,
-    0.0657915, 0.0670991, 0.0684204, 0.0697552, 0.0711035, 0.0724652,
-    0.0738404, 0.0752289, 0.0766307, 0.0780456, 0.0794737, 0.0809149,
-    0.082369, 0.0838361, 0.085316, 0.0868087, 0.0883141, 0.089832,
-    0.0913624, 0.0929053, 0.0944605, 0.0960279, 0.0976074, 0.0991989,
-    0.100802, 0.102418, 0.104045, 0.105683, 0.107334, 0.108995,
-    0.110668, 0.112352, 0.114047, 0.115753, 0.117469, 0.119197,
-    0.120935, 0.122683, 0.124442, 0.12621, 0.127989, 0.129778,
-    0.131576, 0.133384, 0.135201, 0.137028, 0.138864, 0.140709,
-    0.142562, 0.144425, 0.146296, 0.148175, 0.150063, 0.151959,
-    0.153862, 0.155773, 0.157692, 0.159619, 0.161552, 0.163493,
-    0.165441, 0.167395, 0.169356, 0.171324, 0.173297, 0.175277,
-    0.177263, 0.179254, 0.181251, 0.183253, 0.18526, 0.187272,
-    0.189289, 0.191311, 0.193337, 0.195367, 0.197401, 0.199439,
-    0.201481, 0.203526, 0.205575, 0.207627, 0.209681, 0.211738,
-    0.213798, 0.21586, 0.217924, 0.21999, 0.222057, 0.224127,
-    0.226197, 0.228269, 0.230341, 0.232414, 0.234488, 0.236562,
-    0.238636, 0.24071, 0.242784, 0.244857, 0.24693, 0.249001,
-    0.251072, 0.253141, 0.255209, 0.257275, 0.259339, 0.261401,
-    0.26346, 0.265518, 0.267572, 0.269623, 0.271672, 0.273717,
-    0.275758, 0.277796, 0.27983, 0.28186, 0.283885, 0.285906,
-    0.287922, 0.289934, 0.29194, 0.293941, 0.295936, 0.297926,
-    0.29991, 0.301887, 0.303859, 0.305824, 0.307782, 0.309734,
-    0.311678, 0.313616, 0.315546, 0.317468, 0.319383, 0.321289,
-    0.323188, 0.325078, 0.32696, 0.328833, 0.330697, 0.332552,
-    0.334398, 0.336235, 0.338062, 0.33988, 0.341688, 0.343485,
-    0.345273, 0.34705, 0.348816, 0.350572, 0.352317, 0.354051,
-    0.355774, 0.357486, 0.359186, 0.360875, 0.362552, 0.364217,
-    0.36587, 0.367511, 0.36914, 0.370756, 0.372359, 0.37395,
-    0.375529, 0.377094, 0.378646, 0.380185, 0.38171, 0.383222,
-    0.384721, 0.386206, 0.387677, 0.389134, 0.390577, 0.392006,
-    0.393421, 0.394822, 0.396208, 0.397579, 0.398936, 0.400279,
-    0.401606, 0.402919, 0.404217, 0.4055, 0.406767, 0.40802,
-    0.409257, 0.410479, 0.411685, 0.412877, 0.414052, 0.415212,
-    0.416357, 0.417485, 0.418598, 0.419695, 0.420777, 0.421842,
-    0.422892, 0.423926, 0.424943, 0.425945, 0.426931, 0.4279,
-    0.428854, 0.429791, 0.430713, 0.431618, 0.432507, 0.43338,
-    0.434237, 0.435078, 0.435902, 0.43671, 0.437503, 0.438279,
-    0.439039, 0.439782, 0.44051, 0.441222, 0.441918, 0.442597,
-    0.443261, 0.443909, 0.444541, 0.445157, 0.445757, 0.446341,
-    0.44691, 0.447463, 0.448, 0.448522, 0.449029, 0.449519,
-    0.449995, 0.450455, 0.4509, 0.45133, 0.451745, 0.452144,
-    0.452529, 0.452899, 0.453254, 0.453595, 0.453921, 0.454232,
-    0.45453, 0.454813, 0.455081, 0.455336, 0.455577, 0.455804,
-    0.456017, 0.456217, 0.456403, 0.456576, 0.456736, 0.456883,
-    0.457017, 0.457138, 0.457246, 0.457342, 0.457425, 0.457497,
-    0.457556, 0.457603, 0.457639, 0.457663, 0.457675, 0.457676,
-    0.457666, 0.457645, 0.457613, 0.457571, 0.457518, 0.457455,
-    0.457382, 0.457299, 0.457206, 0.457104, 0.456992, 0.456871,
-    0.456741, 0.456602, 0.456455, 0.456299, 0.456135, 0.455963,
-    0.455784, 0.455596, 0.455402, 0.4552, 0.454991, 0.454776,
-    0.454554, 0.454325, 0.454091, 0.45385, 0.453604, 0.453353,
-    0.453096, 0.452834, 0.452568, 0.452296, 0.452021, 0.451742,
-    0.451458, 0.451171, 0.450881, 0.450588, 0.450291, 0.449992,
-    0.449691, 0.449387, 0.449081, 0.448774, 0.448465, 0.448155,
-    0.447844, 0.447532, 0.44722, 0.446907, 0.446595, 0.446282,
-    0.445971, 0.44566, 0.44535, 0.445041, 0.444734, 0.444428,
-    0.444124, 0.443823, 0.443524, 0.443228, 0.442935, 0.442646,
-    0.442359, 0.442077, 0.441799, 0.441525, 0.441255, 0.44099,
-    0.44073, 0.440476, 0.440227, 0.439984, 0.439747, 0.439516,
-    0.439291, 0.439074, 0.438864, 0.43866, 0.438465, 0.438277,
-    0.438097, 0.437926, 0.437763, 0.437609, 0.437463, 0.437328,
-    0.437201, 0.437085, 0.436978, 0.436881, 0.436796, 0.43672,
-    0.436656, 0.436603, 0.436561, 0.436531, 0.436513, 0.436507,
-    0.436513, 0.436532, 0.436563, 0.436608, 0.436665, 0.436737,
-    0.436821, 0.43692, 0.437033, 0.43716, 0.437302, 0.437458,
-    0.437629, 0.437816, 0.438017, 0.438235, 0.438468, 0.438717,
-    0.438982, 0.439263, 0.439561, 0.439876, 0.440207, 0.440556,
-    0.440921, 0.441304, 0.441705, 0.442124, 0.44256, 0.443015,
-    0.443488, 0.443979, 0.444489, 0.445017, 0.445565, 0.446131,
-    0.446717, 0.447322, 0.447947, 0.448591, 0.449255, 0.449939,
-    0.450643, 0.451367, 0.452111, 0.452876, 0.453661, 0.454467,
-    0.455293, 0.456141, 0.457009, 0.457898, 0.458809, 0.459741,
-    0.460694, 0.461668, 0.462664, 0.463682, 0.464721, 0.465782,
-    0.466865, 0.467969, 0.469096, 0.470245, 0.471415, 0.472608,
-    0.473823, 0.47506, 0.476319, 0.4776, 0.478904, 0.48023,
-    0.481579, 0.48295, 0.484343, 0.485759, 0.487197, 0.488657,
-    0.49014, 0.491645, 0.493173, 0.494723, 0.496295, 0.49789,
-    0.499507, 0.501147, 0.502809, 0.504493, 0.506199, 0.507927,
-    0.509678, 0.511451, 0.513245, 0.515062, 0.5169, 0.518761,
-    0.520643, 0.522546, 0.524472, 0.526419, 0.528387, 0.530377,
-    0.532387, 0.534419, 0.536473, 0.538547, 0.540641, 0.542757,
-    0.544893, 0.54705, 0.549227, 0.551424, 0.553641, 0.555878,
-    0.558135, 0.560411, 0.562707, 0.565023, 0.567357, 0.56971,
-    0.572083, 0.574473, 0.576883, 0.57931, 0.581756, 0.58422,
-    0.586701, 0.5892, 0.591716, 0.59425, 0.5968, 0.599367,
-    0.60195, 0.60455, 0.607165, 0.609797, 0.612444, 0.615106,
-    0.617783, 0.620476, 0.623183, 0.625904, 0.628639, 0.631388,
-    0.634151, 0.636927, 0.639716, 0.642518, 0.645332, 0.648159,
-    0.650997, 0.653847, 0.656708, 0.659581, 0.662464, 0.665358,
-    0.668262, 0.671175, 0.674098, 0.677031, 0.679972, 0.682922,
-    0.68588, 0.688846, 0.69182, 0.694801, 0.697789, 0.700783,
-    0.703784, 0.706791, 0.709803, 0.712821, 0.715843, 0.71887,
-    0.721901, 0.724936, 0.727974, 0.731015, 0.734059, 0.737106,
-    0.740154, 0.743204, 0.746255, 0.749307, 0.752359, 0.755412,
-    0.758464, 0.761515, 0.764565, 0.767614, 0.770661, 0.773706,
-    0.776747, 0.779786, 0.782822, 0.785853, 0.78888, 0.791903,
-    0.79492, 0.797932, 0.800937, 0.803937, 0.80693, 0.809915,
-    0.812893, 0.815863, 0.818825, 0.821777, 0.824721, 0.827654,
-    0.830578, 0.833491, 0.836393, 0.839284, 0.842162, 0.845029,
-    0.847883, 0.850723, 0.853551, 0.856364, 0.859163, 0.861947,
-    0.864715, 0.867468, 0.870205, 0.872925, 0.875629, 0.878315,
-    0.880983, 0.883632, 0.886263, 0.888875, 0.891467, 0.894039,
-    0.896591, 0.899122, 0.901631, 0.904119, 0.906585, 0.909028,
-    0.911448, 0.913844, 0.916217, 0.918565, 0.920889, 0.923187,
-    0.92546, 0.927706, 0.929927, 0.93212, 0.934286, 0.936425,
-    0.938535, 0.940617, 0.94267, 0.944694, 0.946687, 0.948651,
-    0.950584, 0.952486, 0.954357, 0.956196, 0.958003, 0.959777,
-    0.961518, 0.963226, 0.9649, 0.96654, 0.968145, 0.969716,
-    0.971251, 0.972751, 0.974214, 0.975641, 0.977031, 0.978384,
-    0.979699, 0.980977, 0.982216, 0.983417, 0.984578, 0.985701,
-    0.986783, 0.987826, 0.988828, 0.989789, 0.99071, 0.991589,
-    0.992426, 0.993221, 0.993974, 0.994684, 0.99535, 0.995974,
-    0.996554, 0.99709, 0.997582, 0.998029, 0.998431, 0.998788,
-    0.9991, 0.999366, 0.999586, 0.99976, 0.999887, 0.999967,
-    1, 0.999986, 0.999924, 0.999814, 0.999656, 0.99945,
-    0.999195, 0.998891, 0.998539, 0.998137, 0.997685, 0.997184,
-    0.996632, 0.996031, 0.995379, 0.994676, 0.993923, 0.993119,
-    0.992264, 0.991357, 0.990399, 0.989389, 0.988327, 0.987214,
-    0.986048, 0.98483, 0.983559, 0.982236, 0.98086, 0.979431,
-    0.977949, 0.976414, 0.974826, 0.973184, 0.971489, 0.969741,
-    0.967938, 0.966082, 0.964173, 0.962209, 0.960191, 0.958119,
-    0.955993, 0.953813, 0.951579, 0.94929, 0.946948, 0.94455,
-    0.942098, 0.939592, 0.937032, 0.934417, 0.931747, 0.929023,
-    0.926245, 0.923412, 0.920524, 0.917583, 0.914586, 0.911536,
-    0.908431, 0.905271, 0.902058, 0.89879, 0.895468, 0.892092,
-    0.888662, 0.885178, 0.88164, 0.878048, 0.874402, 0.870703,
-    0.86695, 0.863144, 0.859285, 0.855372, 0.851407, 0.847388,
-    0.843317, 0.839193, 0.835016, 0.830787, 0.826506, 0.822173,
-    0.817788, 0.813351, 0.808862, 0.804323, 0.799732, 0.79509,
-    0.790397, 0.785654, 0.78086, 0.776017, 0.771123, 0.766179,
-    0.761187, 0.756144, 0.751053, 0.745913, 0.740725, 0.735488,
-    0.730204, 0.724872, 0.719492, 0.714065, 0.708591, 0.703071,
-    0.697504, 0.691891, 0.686233, 0.680529, 0.67478, 0.668987,
-    0.663148, 0.657266, 0.65134, 0.645371, 0.639358, 0.633303,
-    0.627205, 0.621065, 0.614884, 0.608661, 0.602397, 0.596093,
-    0.589748, 0.583364, 0.57694, 0.570477, 0.563975, 0.557435,
-    0.550857, 0.544242, 0.53759, 0.530901, 0.524176, 0.517415,
-    0.510618, 0.503787, 0.496921, 0.490022, 0.483088, 0.476122,
-    0.469122, 0.462091, 0.455027, 0.447932, 0.440807, 0.433651,
-    0.426464, 0.419249, 0.412004, 0.404731, 0.39743, 0.390101,
-    0.382746, 0.375363, 0.367955, 0.360521, 0.353062, 0.345578,
-    0.33807, 0.330539, 0.322985, 0.315408, 0.307809, 0.300188,
-    0.292547, 0.284885, 0.277203, 0.269502, 0.261782, 0.254043,
-    0.246287, 0.238514, 0.230723, 0.222917, 0.215095, 0.207258,
-    0.199406, 0.19154, 0.183661, 0.175769, 0.167864, 0.159948,
-    0.15202, 0.144082, 0.136133, 0.128175, 0.120208, 0.112232,
-    0.104249, 0.0962581, 0.0882605, 0.0802567, 0.0722471, 0.0642325,
-    0.0562134, 0.0481903, 0.0401638, 0.0321344, 0.0241028, 0.0160695,
-    0.00803502, 0
-};
-
-static const float WAVE_SAW_126[DEFAULT_WAVELEN] = {
-    -0.00472342, -0.00944673, -0.0141698, -0.0188926, -0.0236149, -0.0283366,
-    -0.0330577, -0.037778, -0.0424975, -0.0472159, -0.0519332, -0.0566493,
-    -0.061364, -0.0660774, -0.0707891, -0.0754992, -0.0802075, -0.084914,
-    -0.0896184, -0.0943207, -0.0990208, -0.103719, -0.108414, -0.113107,
-    -0.117797, -0.122484, -0.127169, -0.13185, -0.136529, -0.141204,
-    -0.145876, -0.150544, -0.155209, -0.15987, -0.164528, -0.169181,
-    -0.173831, -0.178477, -0.183118, -0.187755, -0.192388, -0.197016,
-    -0.201639, -0.206258, -0.210872, -0.215481, -0.220085, -0.224684,
-    -0.229278, -0.233866, -0.238448, -0.243025, -0.247597, -0.252162,
-    -0.256722, -0.261276, -0.265823, -0.270365, -0.2749, -0.279428,
-    -0.28395, -0.288465, -0.292974, -0.297476, -0.301971, -0.306458,
-    -0.310939, -0.315412, -0.319878, -0.324337, -0.328787, -0.333231,
-    -0.337666, -0.342094, -0.346513, -0.350924, -0.355328, -0.359723,
-    -0.364109, -0.368487, -0.372857, -0.377218, -0.38157, -0.385913,
-    -0.390247, -0.394572, -0.398888, -0.403194, -0.407491, -0.411779,
-    -0.416057, -0.420326, -0.424584, -0.428833, -0.433072, -0.437301,
-    -0.441519, -0.445728, -0.449926, -0.454113, -0.458291, -0.462457,
-    -0.466613, -0.470758, -0.474892, -0.479015, -0.483127, -0.487227,
-    -0.491317, -0.495395, -0.499461, -0.503517, -0.50756, -0.511592,
-    -0.515612, -0.51962, -0.523616, -0.5276, -0.531572, -0.535531,
-    -0.539478, -0.543413, -0.547335, -0.551245, -0.555142, -0.559026,
-    -0.562898, -0.566756, -0.570601, -0.574434, -0.578253, -0.582059,
-    -0.585851, -0.58963, -0.593396, -0.597148, -0.600886, -0.604611,
-    -0.608321, -0.612018, -0.615701, -0.61937, -0.623024, -0.626665,
-    -0.630291, -0.633902, -0.6375, -0.641082, -0.64465, -0.648204,
-    -0.651743, -0.655266, -0.658775, -0.662269, -0.665748, -0.669212,
-    -0.672661, -0.676094, -0.679512, -0.682915, -0.686302, -0.689674,
-    -0.69303, -0.69637, -0.699695, -0.703004, -0.706297, -0.709574,
-    -0.712835, -0.71608, -0.719309, -0.722521, -0.725718, -0.728898,
-    -0.732062, -0.735209, -0.73834, -0.741454, -0.744551, -0.747632,
-    -0.750696, -0.753744, -0.756774, -0.759788, -0.762784, -0.765764,
-    -0.768726, -0.771672, -0.7746, -0.777511, -0.780404, -0.78328,
-    -0.786139, -0.78898, -0.791804, -0.79461, -0.797399, -0.80017,
-    -0.802923, -0.805659, -0.808376, -0.811076, -0.813758, -0.816422,
-    -0.819068, -0.821696, -0.824305, -0.826897, -0.82947, -0.832026,
-    -0.834562, -0.837081, -0.839581, -0.842063, -0.844527, -0.846972,
-    -0.849398, -0.851806, -0.854195, -0.856566, -0.858918, -0.861251,
-    -0.863566, -0.865862, -0.868138, -0.870397, -0.872636, -0.874856,
-    -0.877058, -0.87924, -0.881403, -0.883548, -0.885673, -0.887779,
-    -0.889866, -0.891934, -0.893983, -0.896013, -0.898023, -0.900014,
-    -0.901986, -0.903938, -0.905871, -0.907785, -0.909679, -0.911554,
-    -0.91341, -0.915246, -0.917063, -0.91886, -0.920637, -0.922396,
-    -0.924134, -0.925853, -0.927552, -0.929232, -0.930892, -0.932533,
-    -0.934154, -0.935755, -0.937337, -0.938899, -0.940441, -0.941963,
-    -0.943466, -0.944949, -0.946412, -0.947856, -0.94928, -0.950684,
-    -0.952068, -0.953432, -0.954777, -0.956102, -0.957407, -0.958692,
-    -0.959957, -0.961203, -0.962429, -0.963635, -0.964821, -0.965987,
-    -0.967134, -0.968261, -0.969367, -0.970455, -0.971522, -0.972569,
-    -0.973597, -0.974605, -0.975593, -0.976561, -0.977509, -0.978438,
-    -0.979347, -0.980236, -0.981105, -0.981954, -0.982784, -0.983594,
-    -0.984384, -0.985155, -0.985906, -0.986637, -0.987348, -0.98804,
-    -0.988712, -0.989365, -0.989998, -0.990611, -0.991205, -0.991779,
-    -0.992333, -0.992868, -0.993383, -0.993879, -0.994356, -0.994813,
-    -0.99525, -0.995668, -0.996067, -0.996446, -0.996806, -0.997146,
-    -0.997467, -0.997769, -0.998052, -0.998315, -0.998559, -0.998784,
-    -0.99899, -0.999177, -0.999344, -0.999493, -0.999622, -0.999732,
-    -0.999824, -0.999896, -0.99995, -0.999984, -1, -0.999997,
-    -0.999975, -0.999934, -0.999875, -0.999797, -0.9997, -0.999584,
-    -0.99945, -0.999298, -0.999127, -0.998937, -0.998729, -0.998503,
-    -0.998258, -0.997995, -0.997714, -0.997414, -0.997096, -0.99676,
-    -0.996406, -0.996034, -0.995644, -0.995236, -0.99481, -0.994366,
-    -0.993904, -0.993424, -0.992927, -0.992412, -0.991879, -0.991329,
-    -0.990761, -0.990175, -0.989573, -0.988952, -0.988315, -0.98766,
-    -0.986987, -0.986298, -0.985591, -0.984868, -0.984127, -0.983369,
-    -0.982595, -0.981803, -0.980995, -0.98017, -0.979328, -0.978469,
-    -0.977594, -0.976702, -0.975794, -0.97487, -0.973929, -0.972971,
-    -0.971998, -0.971008, -0.970002, -0.96898, -0.967942, -0.966888,
-    -0.965818, -0.964733, -0.963631, -0.962514, -0.961381, -0.960233,
-    -0.959069, -0.95789, -0.956695, -0.955485, -0.95426, -0.953019,
-    -0.951764, -0.950493, -0.949207, -0.947907, -0.946592, -0.945261,
-    -0.943917, -0.942557, -0.941183, -0.939794, -0.938391, -0.936974,
-    -0.935542, -0.934096, -0.932636, -0.931162, -0.929674, -0.928172,
-    -0.926656, -0.925126, -0.923583, -0.922026, -0.920455, -0.918871,
-    -0.917274, -0.915663, -0.914039, -0.912401, -0.910751, -0.909087,
-    -0.907411, -0.905722, -0.90402, -0.902305, -0.900577, -0.898837,
-    -0.897085, -0.89532, -0.893542, -0.891753, -0.889951, -0.888137,
-    -0.886311, -0.884473, -0.882624, -0.880762, -0.878889, -0.877004,
-    -0.875108, -0.8732, -0.871281, -0.86935, -0.867409, -0.865456,
-    -0.863492, -0.861517, -0.859532, -0.857535, -0.855528, -0.85351,
-    -0.851482, -0.849443, -0.847394, -0.845334, -0.843265, -0.841185,
-    -0.839095, -0.836995, -0.834885, -0.832766, -0.830637, -0.828498,
-    -0.82635, -0.824192, -0.822025, -0.819849, -0.817663, -0.815468,
-    -0.813265, -0.811052, -0.808831, -0.806601, -0.804362, -0.802115,
-    -0.799859, -0.797595, -0.795322, -0.793041, -0.790752, -0.788455,
-    -0.786151, -0.783838, -0.781517, -0.779189, -0.776853, -0.77451,
-    -0.772159, -0.769801, -0.767436, -0.765063, -0.762684, -0.760297,
-    -0.757904, -0.755504, -0.753097, -0.750683, -0.748263, -0.745837,
-    -0.743404, -0.740964, -0.738519, -0.736068, -0.73361, -0.731147,
-    -0.728678, -0.726203, -0.723723, -0.721237, -0.718745, -0.716248,
-    -0.713746, -0.711239, -0.708726, -0.706209, -0.703686, -0.701159,
-    -0.698627, -0.696091, -0.69355, -0.691004, -0.688454, -0.6859,
-    -0.683341, -0.680779, -0.678212, -0.675641, -0.673067, -0.670489,
-    -0.667907, -0.665321, -0.662732, -0.66014, -0.657544, -0.654946,
-    -0.652344, -0.649738, -0.64713, -0.64452, -0.641906, -0.639289,
-    -0.636671, -0.634049, -0.631425, -0.628799, -0.62617, -0.62354,
-    -0.620907, -0.618272, -0.615635, -0.612997, -0.610356, -0.607715,
-    -0.605071, -0.602426, -0.59978, -0.597132, -0.594483, -0.591833,
-    -0.589182, -0.58653, -0.583878, -0.581224, -0.57857, -0.575915,
-    -0.573259, -0.570603, -0.567947, -0.56529, -0.562634, -0.559977,
-    -0.55732, -0.554663, -0.552006, -0.54935, -0.546693, -0.544037,
-    -0.541382, -0.538727, -0.536073, -0.53342, -0.530767, -0.528115,
-    -0.525464, -0.522814, -0.520166, -0.517518, -0.514872, -0.512227,
-    -0.509584, -0.506942, -0.504302, -0.501663, -0.499026, -0.496391,
-    -0.493758, -0.491127, -0.488498, -0.485871, -0.483246, -0.480623,
-    -0.478003, -0.475386, -0.472771, -0.470158, -0.467548, -0.464941,
-    -0.462337, -0.459736, -0.457137, -0.454542, -0.45195, -0.449361,
-    -0.446775, -0.444192, -0.441613, -0.439038, -0.436466, -0.433897,
-    -0.431333, -0.428772, -0.426215, -0.423662, -0.421112, -0.418567,
-    -0.416026, -0.413489, -0.410957, -0.408428, -0.405905, -0.403385,
-    -0.40087, -0.39836, -0.395854, -0.393353, -0.390857, -0.388366,
-    -0.385879, -0.383398, -0.380921, -0.37845, -0.375984, -0.373523,
-    -0.371067, -0.368617, -0.366172, -0.363733, -0.361299, -0.358871,
-    -0.356448, -0.354031, -0.35162, -0.349215, -0.346816, -0.344422,
-    -0.342035, -0.339654, -0.337279, -0.33491, -0.332547, -0.33019,
-    -0.32784, -0.325496, -0.323159, -0.320828, -0.318504, -0.316187,
-    -0.313876, -0.311572, -0.309274, -0.306984, -0.3047, -0.302423,
-    -0.300153, -0.297891, -0.295635, -0.293386, -0.291145, -0.288911,
-    -0.286684, -0.284465, -0.282252, -0.280048, -0.27785, -0.27566,
-    -0.273478, -0.271303, -0.269136, -0.266977, -0.264825, -0.262681,
-    -0.260545, -0.258417, -0.256297, -0.254184, -0.25208, -0.249983,
-    -0.247895, -0.245814, -0.243742, -0.241678, -0.239622, -0.237575,
-    -0.235535, -0.233504, -0.231482, -0.229467, -0.227462, -0.225464,
-    -0.223475, -0.221495, -0.219523, -0.21756, -0.215605, -0.213659,
-    -0.211721, -0.209793, -0.207873, -0.205962, -0.204059, -0.202166,
-    -0.200281, -0.198405, -0.196538, -0.19468, -0.192831, -0.190991,
-    -0.18916, -0.187338, -0.185525, -0.183721, -0.181926, -0.18014,
-    -0.178364, -0.176596, -0.174838, -0.173089, -0.17135, -0.169619,
-    -0.167898, -0.166186, -0.164483, -0.16279, -0.161106, -0.159431,
-    -0.157766, -0.15611, -0.154463, -0.152826, -0.151199, -0.14958,
-    -0.147971, -0.146372, -0.144782, -0.143202, -0.141631, -0.14007,
-    -0.138518, -0.136976, -0.135443, -0.13392, -0.132406, -0.130902,
-    -0.129407, -0.127922, -0.126447, -0.124981, -0.123525, -0.122079,
-    -0.120642, -0.119214, -0.117796, -0.116388, -0.11499, -0.113601,
-    -0.112222, -0.110852, -0.109492, -0.108141, -0.1068, -0.105469,
-    -0.104148, -0.102836, -0.101533, -0.10024, -0.0989572, -0.0976836,
-    -0.0964196, -0.0951651, -0.0939203, -0.092685, -0.0914593, -0.0902431,
-    -0.0890365, -0.0878395, -0.0866519, -0.0854739, -0.0843054, -0.0831465,
-    -0.081997, -0.080857, -0.0797264, -0.0786054, -0.0774937, -0.0763915,
-    -0.0752988, -0.0742154, -0.0731414, -0.0720768, -0.0710216, -0.0699757,
-    -0.0689392, -0.0679119, -0.066894, -0.0658853, -0.0648859, -0.0638958,
-    -0.0629149, -0.0619431, -0.0609806, -0.0600272, -0.059083, -0.0581478,
-    -0.0572218, -0.0563049, -0.055397, -0.0544981, -0.0536083, -0.0527274,
-    -0.0518555, -0.0509926, -0.0501385, -0.0492934, -0.0484571, -0.0476296,
-    -0.0468109, -0.046001, -0.0451999, -0.0444074, -0.0436237, -0.0428486,
-    -0.0420822, -0.0413243, -0.0405751, -0.0398344, -0.0391022, -0.0383784,
-    -0.0376631, -0.0369563, -0.0362578, -0.0355677, -0.0348858, -0.0342123,
-    -0.033547, -0.0328899, -0.032241, -0.0316002, -0.0309676, -0.030343,
-    -0.0297264, -0.0291178, -0.0285172, -0.0279245, -0.0273397, -0.0267627,
-    -0.0261935, -0.0256321, -0.0250784, -0.0245324, -0.023994, -0.0234633,
-    -0.02294, -0.0224243, -0.0219161, -0.0214153, -0.0209219, -0.0204359,
-    -0.0199571, -0.0194856, -0.0190213, -0.0185642, -0.0181142, -0.0176713,
-    -0.0172354, -0.0168065, -0.0163845, -0.0159695, -0.0155613, -0.0151599,
-    -0.0147652, -0.0143772, -0.0139959, -0.0136212, -0.0132531, -0.0128915,
-    -0.0125363, -0.0121876, -0.0118452, -0.0115091, -0.0111792, -0.0108556,
-    -0.0105382, -0.0102268, -0.00992149, -0.00962218, -0.00932881, -0.00904135,
-    -0.00875972, -0.00848389, -0.00821378, -0.00794936, -0.00769057, -0.00743735,
-    -0.00718964, -0.0069474, -0.00671056, -0.00647908, -0.00625289, -0.00603195,
-    -0.00581618, -0.00560555, -0.00539998, -0.00519943, -0.00500383, -0.00481314,
-    -0.00462728, -0.00444621, -0.00426987, -0.00409819, -0.00393111, -0.00376859,
-    -0.00361056, -0.00345696, -0.00330773, -0.00316282, -0.00302215, -0.00288568,
-    -0.00275334, -0.00262507, -0.00250082, -0.00238051, -0.00226409, -0.0021515,
-    -0.00204268, -0.00193756, -0.00183609, -0.00173819, -0.00164382, -0.0015529,
-    -0.00146538, -0.00138119, -0.00130026, -0.00122255, -0.00114798, -0.00107649,
-    -0.00100801, -0.00094249, -0.000879859, -0.000820055, -0.000763012, -0.000708668,
-    -0.000656957, -0.000607817, -0.000561182, -0.000516989, -0.000475171, -0.000435666,
-    -0.000398407, -0.00036333, -0.00033037, -0.000299462, -0.000270541, -0.00024354,
-    -0.000218396, -0.000195042, -0.000173412, -0.000153442, -0.000135064, -0.000118215,
-    -0.000102827, -8.88341e-5, -7.61711e-5, -6.47716e-5, -5.45695e-5, -4.54985e-5,
-    -3.74923e-5, -3.04847e-5, -2.44093e-5, -1.91997e-5, -1.47895e-5, -1.11121e-5,
-    -8.10108e-6, -5.68988e-6, -3.81191e-6, -2.40057e-6, -1.38926e-6, -7.11315e-7,
-    -3.00091e-7, -8.89169e-8, -1.11147e-8, 0, 1.11147e-8, 8.89169e-8,
-    3.00091e-7, 7.11315e-7, 1.38926e-6, 2.40057e-6, 3.81191e-6, 5.68988e-6,
-    8.10108e-6, 1.11121e-5, 1.47895e-5, 1.91997e-5, 2.44093e-5, 3.04847e-5,
-    3.74923e-5, 4.54985e-5, 5.45695e-5, 6.47716e-5, 7.61711e-5, 8.88341e-5,
-    0.000102827, 0.000118215, 0.000135064, 0.000153442, 0.000173412, 0.000195042,
-    0.000218396, 0.00024354, 0.000270541, 0.000299462, 0.00033037, 0.00036333,
-    0.000398407, 0.000435666, 0.000475171, 0.000516989, 0.000561182, 0.000607817,
-    0.000656957, 0.000708668, 0.000763012, 0.000820055, 0.000879859, 0.00094249,
-    0.00100801, 0.00107649, 0.00114798, 0.00122255, 0.00130026, 0.00138119,
-    0.00146538, 0.0015529, 0.00164382, 0.00173819, 0.00183609, 0.00193756,
-    0.00204268, 0.0021515, 0.00226409, 0.00238051, 0.00250082, 0.00262507,
-    0.00275334, 0.00288568, 0.00302215, 0.00316282, 0.00330773, 0.00345696,
-    0.00361056, 0.00376859, 0.00393111, 0.00409819, 0.00426987, 0.00444621,
-    0.00462728, 0.00481314, 0.00500383, 0.00519943, 0.00539998, 0.00560555,
-    0.00581618, 0.00603195, 0.00625289, 0.00647908, 0.00671056, 0.0069474,
-    0.00718964, 0.00743735, 0.00769057, 0.00794936, 0.00821378, 0.00848389,
-    0.00875972, 0.00904135, 0.00932881, 0.00962218, 0.00992149, 0.0102268,
-    0.0105382, 0.0108556, 0.0111792, 0.0115091, 0.0118452, 0.0121876,
-    0.0125363, 0.0128915, 0.0132531, 0.0136212, 0.0139959, 0.0143772,
-    0.0147652, 0.0151599, 0.0155613, 0.0159695, 0.0163845, 0.0168065,
-    0.0172354, 0.0176713, 0.0181142, 0.0185642, 0.0190213, 0.0194856,
-    0.0199571, 0.0204359, 0.0209219, 0.0214153, 0.0219161, 0.0224243,
-    0.02294, 0.0234633, 0.023994, 0.0245324, 0.0250784, 0.0256321,
-    0.0261935, 0.0267627, 0.0273397, 0.0279245, 0.0285172, 0.0291178,
-    0.0297264, 0.030343, 0.0309676, 0.0316002, 0.032241, 0.0328899,
-    0.033547, 0.0342123, 0.0348858, 0.0355677, 0.0362578, 0.0369563,
-    0.0376631, 0.0383784, 0.0391022, 0.0398344, 0.0405751, 0.0413243,
-    0.0420822, 0.0428486, 0.0436237, 0.0444074, 0.0451999, 0.046001,
-    0.0468109, 0.0476296, 0.0484571, 0.0492934, 0.0501385, 0.0509926,
-    0.0518555, 0.0527274, 0.0536083, 0.0544981, 0.055397, 0.0563049,
-    0.0572218, 0.0581478, 0.059083, 0.0600272, 0.0609806, 0.0619431,
-    0.0629149, 0.0638958, 0.0648859, 0.0658853, 0.066894, 0.0679119,
-    0.0689392, 0.0699757, 0.0710216, 0.0720768, 0.0731414, 0.0742154,
-    0.0752988, 0.0763915, 0.0774937, 0.0786054, 0.0797264, 0.080857,
-    0.081997, 0.0831465, 0.0843054, 0.0854739, 0.0866519, 0.0878395,
-    0.0890365, 0.0902431, 0.0914593, 0.092685, 0.0939203, 0.0951651,
-    0.0964196, 0.0976836, 0.0989572, 0.10024, 0.101533, 0.102836,
-    0.104148, 0.105469, 0.1068, 0.108141, 0.109492, 0.110852,
-    0.112222, 0.113601, 0.11499, 0.116388, 0.117796, 0.119214,
-    0.120642, 0.122079, 0.123525, 0.124981, 0.126447, 0.127922,
-    0.129407, 0.130902, 0.132406, 0.13392, 0.135443, 0.136976,
-    0.138518, 0.14007, 0.141631, 0.143202, 0.144782, 0.146372,
-    0.147971, 0.14958, 0.151199, 0.152826, 0.154463, 0.15611,
-    0.157766, 0.159431, 0.161106, 0.16279, 0.164483, 0.166186,
-    0.167898, 0.169619, 0.17135, 0.173089, 0.174838, 0.176596,
-    0.178364, 0.18014, 0.181926, 0.183721, 0.185525, 0.187338,
-    0.18916, 0.190991, 0.192831, 0.19468, 0.196538, 0.198405,
-    0.200281, 0.202166, 0.204059, 0.205962, 0.207873, 0.209793,
-    0.211721, 0.213659, 0.215605, 0.21756, 0.219523, 0.221495,
-    0.223475, 0.225464, 0.227462, 0.229467, 0.231482, 0.233504,
-    0.235535, 0.237575, 0.239622, 0.241678, 0.243742, 0.245814,
-    0.247895, 0.249983, 0.25208, 0.254184, 0.256297, 0.258417,
-    0.260545, 0.262681, 0.264825, 0.266977, 0.269136, 0.271303,
-    0.273478, 0.27566, 0.27785, 0.280048, 0.282252, 0.284465,
-    0.286684, 0.288911, 0.291145, 0.293386, 0.295635, 0.297891,
-    0.300153, 0.302423, 0.3047, 0.306984, 0.309274, 0.311572,
-    0.313876, 0.316187, 0.318504, 0.320828, 0.323159, 0.325496,
-    0.32784, 0.33019, 0.332547, 0.33491, 0.337279, 0.339654,
-    0.342035, 0.344422, 0.346816, 0.349215, 0.35162, 0.354031,
-    0.356448, 0.358871, 0.361299, 0.363733, 0.366172, 0.368617,
-    0.371067, 0.373523, 0.375984, 0.37845, 0.380921, 0.383398,
-    0.385879, 0.388366, 0.390857, 0.393353, 0.395854, 0.39836,
-    0.40087, 0.403385, 0.405905, 0.408428, 0.410957, 0.413489,
-    0.416026, 0.418567, 0.421112, 0.423662, 0.426215, 0.428772,
-    0.431333, 0.433897, 0.436466, 0.439038, 0.441613, 0.444192,
-    0.446775, 0.449361, 0.45195, 0.454542, 0.457137, 0.459736,
-    0.462337, 0.464941, 0.467548, 0.470158, 0.472771, 0.475386,
-    0.478003, 0.480623, 0.483246, 0.485871, 0.488498, 0.491127,
-    0.493758, 0.496391, 0.499026, 0.501663, 0.504302, 0.506942,
-    0.509584, 0.512227, 0.514872, 0.517518, 0.520166, 0.522814,
-    0.525464, 0.528115, 0.530767, 0.53342, 0.536073, 0.538727,
-    0.541382, 0.544037, 0.546693, 0.54935, 0.552006, 0.554663,
-    0.55732, 0.559977, 0.562634, 0.56529, 0.567947, 0.570603,
-    0.573259, 0.575915, 0.57857, 0.581224, 0.583878, 0.58653,
-    0.589182, 0.591833, 0.594483, 0.597132, 0.59978, 0.602426,
-    0.605071, 0.607715, 0.610356, 0.612997, 0.615635, 0.618272,
-    0.620907, 0.62354, 0.62617, 0.628799, 0.631425, 0.634049,
-    0.636671, 0.639289, 0.641906, 0.64452, 0.64713, 0.649738,
-    0.652344, 0.654946, 0.657544, 0.66014, 0.662732, 0.665321,
-    0.667907, 0.670489, 0.673067, 0.675641, 0.678212, 0.680779,
-    0.683341, 0.6859, 0.688454, 0.691004, 0.69355, 0.696091,
-    0.698627, 0.701159, 0.703686, 0.706209, 0.708726, 0.711239,
-    0.713746, 0.716248, 0.718745, 0.721237, 0.723723, 0.726203,
-    0.728678, 0.731147, 0.73361, 0.736068, 0.738519, 0.740964,
-    0.743404, 0.745837, 0.748263, 0.750683, 0.753097, 0.755504,
-    0.757904, 0.760297, 0.762684, 0.765063, 0.767436, 0.769801,
-    0.772159, 0.77451, 0.776853, 0.779189, 0.781517, 0.783838,
-    0.786151, 0.788455, 0.790752, 0.793041, 0.795322, 0.797595,
-    0.799859, 0.802115, 0.804362, 0.806601, 0.808831, 0.811052,
-    0.813265, 0.815468, 0.817663, 0.819849, 0.822025, 0.824192,
-    0.82635, 0.828498, 0.830637, 0.832766, 0.834885, 0.836995,
-    0.839095, 0.841185, 0.843265, 0.845334, 0.847394, 0.849443,
-    0.851482, 0.85351, 0.855528, 0.857535, 0.859532, 0.861517,
-    0.863492, 0.865456, 0.867409, 0.86935, 0.871281, 0.8732,
-    0.875108, 0.877004, 0.878889, 0.880762, 0.882624, 0.884473,
-    0.886311, 0.888137, 0.889951, 0.891753, 0.893542, 0.89532,
-    0.897085, 0.898837, 0.900577, 0.902305, 0.90402, 0.905722,
-    0.907411, 0.909087, 0.910751, 0.912401, 0.914039, 0.915663,
-    0.917274, 0.918871, 0.920455, 0.922026, 0.923583, 0.925126,
-    0.926656, 0.928172, 0.929674, 0.931162, 0.932636, 0.934096,
-    0.935542, 0.936974, 0.938391, 0.939794, 0.941183, 0.942557,
-    0.943917, 0.945261, 0.946592, 0.947907, 0.949207, 0.950493,
-    0.951764, 0.953019, 0.95426, 0.955485, 0.956695, 0.95789,
-    0.959069, 0.960233, 0.961381, 0.962514, 0.963631, 0.964733,
-    0.965818, 0.966888, 0.967942, 0.96898, 0.970002, 0.971008,
-    0.971998, 0.972971, 0.973929, 0.97487, 0.975794, 0.976702,
-    0.977594, 0.978469, 0.979328, 0.98017, 0.980995, 0.981803,
-    0.982595, 0.983369, 0.984127, 0.984868, 0.985591, 0.986298,
-    0.986987, 0.98766, 0.988315, 0.988952, 0.989573, 0.990175,
-    0.990761, 0.991329, 0.991879, 0.992412, 0.992927, 0.993424,
-    0.993904, 0.994366, 0.99481, 0.995236, 0.995644, 0.996034,
-    0.996406, 0.99676, 0.997096, 0.997414, 0.997714, 0.997995,
-    0.998258, 0.998503, 0.998729, 0.998937, 0.999127, 0.999298,
-    0.99945, 0.999584, 0.9997, 0.999797, 0.999875, 0.999934,
-    0.999975, 0.999997, 1, 0.999984, 0.99995, 0.999896,
-    0.999824, 0.999732, 0.999622, 0.999493, 0.999344, 0.999177,
-    0.99899, 0.998784, 0.998559, 0.998315, 0.998052, 0.997769,
-    0.997467, 0.997146, 0.996806, 0.996446, 0.996067, 0.995668,
-    0.99525, 0.994813, 0.994356, 0.993879, 0.993383, 0.992868,
-    0.992333, 0.991779, 0.991205, 0.990611, 0.989998, 0.989365,
-    0.988712, 0.98804, 0.987348, 0.986637, 0.985906, 0.985155,
-    0.984384, 0.983594, 0.982784, 0.981954, 0.981105, 0.980236,
-    0.979347, 0.978438, 0.977509, 0.976561, 0.975593, 0.974605,
-    0.973597, 0.972569, 0.971522, 0.970455, 0.969367, 0.968261,
-    0.967134, 0.965987, 0.964821, 0.963635, 0.962429, 0.961203,
-    0.959957, 0.958692, 0.957407, 0.956102, 0.954777, 0.953432,
-    0.952068, 0.950684, 0.94928, 0.947856, 0.946412, 0.944949,
-    0.943466, 0.941963, 0.940441, 0.938899, 0.937337, 0.935755,
-    0.934154, 0.932533, 0.930892, 0.929232, 0.927552, 0.925853,
-    0.924134, 0.922396, 0.920637, 0.91886, 0.917063, 0.915246,
-    0.91341, 0.911554, 0.909679, 0.907785, 0.905871, 0.903938,
-    0.901986, 0.900014, 0.898023, 0.896013, 0.893983, 0.891934,
-    0.889866, 0.887779, 0.885673, 0.883548, 0.881403, 0.87924,
-    0.877058, 0.874856, 0.872636, 0.870397, 0.868138, 0.865862,
-    0.863566, 0.861251, 0.858918, 0.856566, 0.854195, 0.851806,
-    0.849398, 0.846972, 0.844527, 0.842063, 0.839581, 0.837081,
-    0.834562, 0.832026, 0.82947, 0.826897, 0.824305, 0.821696,
-    0.819068, 0.816422, 0.813758, 0.811076, 0.808376, 0.805659,
-    0.802923, 0.80017, 0.797399, 0.79461, 0.791804, 0.78898,
-    0.786139, 0.78328, 0.780404, 0.777511, 0.7746, 0.771672,
-    0.768726, 0.765764, 0.762784, 0.759788, 0.756774, 0.753744,
-    0.750696, 0.747632, 0.744551, 0.741454, 0.73834, 0.735209,
-    0.732062, 0.728898, 0.725718, 0.722521, 0.719309, 0.71608,
-    0.712835, 0.709574, 0.706297, 0.703004, 0.699695, 0.69637,
-    0.69303, 0.689674, 0.686302, 0.682915, 0.679512, 0.676094,
-    0.672661, 0.669212, 0.665748, 0.662269, 0.658775, 0.655266,
-    0.651743, 0.648204, 0.64465, 0.641082, 0.6375, 0.633902,
-    0.630291, 0.626665, 0.623024, 0.61937, 0.615701, 0.612018,
-    0.608321, 0.604611, 0.600886, 0.597148, 0.593396, 0.58963,
-    0.585851, 0.582059, 0.578253, 0.574434, 0.570601, 0.566756,
-    0.562898, 0.559026, 0.555142, 0.551245, 0.547335, 0.543413,
-    0.539478, 0.535531, 0.531572, 0.5276, 0.523616, 0.51962,
-    0.515612, 0.511592, 0.50756, 0.503517, 0.499461, 0.495395,
-    0.491317, 0.487227, 0.483127, 0.479015, 0.474892, 0.470758,
-    0.466613, 0.462457, 0.458291, 0.454113, 0.449926, 0.445728,
-    0.441519, 0.437301, 0.433072, 0.428833, 0.424584, 0.420326,
-    0.416057, 0.411779, 0.407491, 0.403194, 0.398888, 0.394572,
-    0.390247, 0.385913, 0.38157, 0.377218, 0.372857, 0.368487,
-    0.364109, 0.359723, 0.355328, 0.350924, 0.346513, 0.342094,
-    0.337666, 0.333231, 0.328787, 0.324337, 0.319878, 0.315412,
-    0.310939, 0.306458, 0.301971, 0.297476, 0.292974, 0.288465,
-    0.28395, 0.279428, 0.2749, 0.270365, 0.265823, 0.261276,
-    0.256722, 0.252162, 0.247597, 0.243025, 0.238448, 0.233866,
-    0.229278, 0.224684, 0.220085, 0.215481, 0.210872, 0.206258,
-    0.201639, 0.197016, 0.192388, 0.187755, 0.183118, 0.178477,
-    0.173831, 0.169181, 0.164528, 0.15987, 0.155209, 0.150544,
-    0.145876, 0.141204, 0.136529, 0.13185, 0.127169, 0.122484,
-    0.117797, 0.113107, 0.108414, 0.103719, 0.0990208, 0.0943207,
-    0.0896184, 0.084914, 0.0802075, 0.0754992, 0.0707891, 0.0660774,
-    0.061364, 0.0566493, 0.0519332, 0.0472159, 0.0424975, 0.037778,
-    0.0330577, 0.0283366, 0.0236149, 0.0188926, 0.0141698, 0.00944673,
-    0.00472342, 0
-};
-
-static const float *WAVE_SAWS[DEFAULT_OCTAVES] = {
-    WAVE_SAW_000, WAVE_SAW_006, WAVE_SAW_018,
-    WAVE_SAW_030, WAVE_SAW_042, WAVE_SAW_054,
-    WAVE_SAW_066, WAVE_SAW_078, WAVE_SAW_090,
-    WAVE_SAW_102, WAVE_SAW_114, WAVE_SAW_126
-};
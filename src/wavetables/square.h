@@ -1,4152 +0,0 @@
-/* A series of tables representing a square wave. */
-
-#pragma once
-
-#include "../constants/defaults.h"
-
-static const float WAVE_SQUARE_000[DEFAULT_WAVELEN] = {
-    4.88498e-15, 1, 0.922301, 0.949382, 0.945294, 0.936383,
-    0.952245, 0.933884, 0.951352, 0.937203, 0.946568, 0.942523,
-    0.941543, 0.946588, 0.938883, 0.947649, 0.939365, 0.945891,
-    0.941978, 0.942926, 0.944793, 0.94069, 0.94615, 0.940349,
-    0.945509, 0.941787, 0.94357, 0.943874, 0.941685, 0.945265,
-    0.940982, 0.945211, 0.941734, 0.943927, 0.943307, 0.942341,
-    0.944643, 0.941463, 0.944943, 0.94176, 0.944129, 0.94293,
-    0.942814, 0.944164, 0.941863, 0.944687, 0.941837, 0.944233,
-    0.942674, 0.943168, 0.94378, 0.942209, 0.944437, 0.941951,
-    0.944267, 0.942505, 0.943436, 0.943464, 0.942515, 0.944194,
-    0.942093, 0.944248, 0.942404, 0.943634, 0.943206, 0.942785,
-    0.943959, 0.942253, 0.944187, 0.942359, 0.943775, 0.942999,
-    0.943021, 0.943736, 0.942425, 0.944095, 0.942358, 0.943866,
-    0.942837, 0.943224, 0.943528, 0.942602, 0.943979, 0.942395,
-    0.943912, 0.942717, 0.943394, 0.943338, 0.942778, 0.943846,
-    0.942462, 0.94392, 0.942638, 0.943531, 0.94317, 0.942948,
-    0.943703, 0.942554, 0.943894, 0.942594, 0.943634, 0.943026,
-    0.943106, 0.943557, 0.942662, 0.943841, 0.942584, 0.943704,
-    0.942909, 0.94325, 0.943413, 0.942782, 0.943766, 0.942603,
-    0.943744, 0.942818, 0.943375, 0.943276, 0.942907, 0.943673,
-    0.942647, 0.943755, 0.942756, 0.943478, 0.943151, 0.943033,
-    0.943569, 0.942712, 0.943739, 0.94272, 0.943558, 0.943041,
-    0.943153, 0.943459, 0.942793, 0.943701, 0.94271, 0.943614,
-    0.942949, 0.943265, 0.943348, 0.942886, 0.943643, 0.942723,
-    0.943646, 0.942877, 0.943363, 0.94324, 0.942985, 0.94357,
-    0.942758, 0.943656, 0.942827, 0.943446, 0.943139, 0.943085,
-    0.943487, 0.94281, 0.943643, 0.942798, 0.943511, 0.94305,
-    0.943183, 0.943397, 0.942877, 0.943611, 0.94279, 0.943557,
-    0.942974, 0.943275, 0.943305, 0.942953, 0.943563, 0.942802,
-    0.943583, 0.942915, 0.943357, 0.943215, 0.943036, 0.943501,
-    0.942832, 0.94359, 0.942874, 0.943426, 0.94313, 0.943121,
-    0.94343, 0.942877, 0.943578, 0.94285, 0.94348, 0.943055,
-    0.943204, 0.943353, 0.942934, 0.94355, 0.942845, 0.943518,
-    0.942991, 0.943283, 0.943274, 0.943001, 0.943507, 0.942857,
-    0.943539, 0.942942, 0.943353, 0.943196, 0.943073, 0.943452,
-    0.942884, 0.943543, 0.942907, 0.943412, 0.943123, 0.943147,
-    0.943389, 0.942925, 0.943531, 0.942888, 0.943458, 0.943058,
-    0.94322, 0.943321, 0.942977, 0.943504, 0.942885, 0.943489,
-    0.943003, 0.943289, 0.943251, 0.943036, 0.943465, 0.942897,
-    0.943506, 0.94296, 0.94335, 0.943182, 0.943101, 0.943415,
-    0.942923, 0.943508, 0.942931, 0.943402, 0.943118, 0.943168,
-    0.943358, 0.942961, 0.943496, 0.942916, 0.943441, 0.94306,
-    0.943233, 0.943296, 0.943009, 0.94347, 0.942915, 0.943468,
-    0.943012, 0.943294, 0.943233, 0.943064, 0.943433, 0.942928,
-    0.943482, 0.942975, 0.943349, 0.94317, 0.943124, 0.943387,
-    0.942954, 0.943481, 0.94295, 0.943394, 0.943112, 0.943184,
-    0.943333, 0.94299, 0.943468, 0.942938, 0.943429, 0.943061,
-    0.943244, 0.943276, 0.943035, 0.943443, 0.942939, 0.943452,
-    0.943018, 0.9433, 0.943218, 0.943087, 0.943407, 0.942953,
-    0.943463, 0.942985, 0.943349, 0.94316, 0.943142, 0.943363,
-    0.942978, 0.94346, 0.942964, 0.943389, 0.943107, 0.943198,
-    0.943313, 0.943013, 0.943446, 0.942955, 0.94342, 0.94306,
-    0.943253, 0.943259, 0.943056, 0.943421, 0.942958, 0.94344,
-    0.943022, 0.943304, 0.943205, 0.943105, 0.943386, 0.942973,
-    0.943447, 0.942993, 0.943349, 0.943152, 0.943157, 0.943344,
-    0.942998, 0.943444, 0.942975, 0.943386, 0.943102, 0.94321,
-    0.943296, 0.943032, 0.943428, 0.942968, 0.943413, 0.943059,
-    0.943262, 0.943245, 0.943074, 0.943403, 0.942973, 0.94343,
-    0.943024, 0.943309, 0.943193, 0.943121, 0.943369, 0.942989,
-    0.943436, 0.942999, 0.943351, 0.943143, 0.943171, 0.943327,
-    0.943014, 0.94343, 0.942983, 0.943384, 0.943097, 0.943221,
-    0.943281, 0.943048, 0.943414, 0.942979, 0.943409, 0.943058,
-    0.94327, 0.943232, 0.943089, 0.943388, 0.942985, 0.943423,
-    0.943025, 0.943314, 0.943183, 0.943135, 0.943354, 0.943002,
-    0.943426, 0.943003, 0.943353, 0.943136, 0.943183, 0.943313,
-    0.943028, 0.943419, 0.94299, 0.943384, 0.943092, 0.943231,
-    0.943268, 0.943062, 0.943401, 0.942987, 0.943405, 0.943055,
-    0.943278, 0.943221, 0.943103, 0.943375, 0.942995, 0.943417,
-    0.943026, 0.94332, 0.943173, 0.943147, 0.943341, 0.943013,
-    0.943419, 0.943005, 0.943356, 0.943128, 0.943194, 0.943301,
-    0.94304, 0.94341, 0.942994, 0.943384, 0.943087, 0.943241,
-    0.943256, 0.943074, 0.943391, 0.942994, 0.943403, 0.943052,
-    0.943285, 0.94321, 0.943115, 0.943364, 0.943004, 0.943413,
-    0.943025, 0.943325, 0.943164, 0.943159, 0.943329, 0.943023,
-    0.943413, 0.943006, 0.943359, 0.94312, 0.943205, 0.943289,
-    0.94305, 0.943402, 0.942998, 0.943386, 0.943081, 0.94325,
-    0.943245, 0.943085, 0.943383, 0.942999, 0.943403, 0.943048,
-    0.943293, 0.9432, 0.943126, 0.943354, 0.94301, 0.943411,
-    0.943023, 0.943332, 0.943155, 0.943169, 0.943319, 0.943031,
-    0.943408, 0.943006, 0.943364, 0.943112, 0.943215, 0.943279,
-    0.943059, 0.943396, 0.943, 0.943388, 0.943074, 0.943259,
-    0.943235, 0.943095, 0.943375, 0.943003, 0.943404, 0.943043,
-    0.943301, 0.94319, 0.943136, 0.943346, 0.943015, 0.943409,
-    0.94302, 0.943338, 0.943145, 0.94318, 0.94331, 0.943037,
-    0.943405, 0.943005, 0.943369, 0.943104, 0.943225, 0.943269,
-    0.943067, 0.943392, 0.943, 0.943392, 0.943067, 0.943269,
-    0.943225, 0.943104, 0.943369, 0.943005, 0.943405, 0.943037,
-    0.94331, 0.94318, 0.943145, 0.943338, 0.94302, 0.943409,
-    0.943015, 0.943346, 0.943136, 0.94319, 0.943301, 0.943043,
-    0.943404, 0.943003, 0.943375, 0.943095, 0.943235, 0.943259,
-    0.943074, 0.943388, 0.943, 0.943396, 0.943059, 0.943279,
-    0.943215, 0.943112, 0.943364, 0.943006, 0.943408, 0.943031,
-    0.943319, 0.943169, 0.943155, 0.943332, 0.943023, 0.943411,
-    0.94301, 0.943354, 0.943126, 0.9432, 0.943293, 0.943048,
-    0.943403, 0.942999, 0.943383, 0.943085, 0.943245, 0.94325,
-    0.943081, 0.943386, 0.942998, 0.943402, 0.94305, 0.943289,
-    0.943205, 0.94312, 0.943359, 0.943006, 0.943413, 0.943023,
-    0.943329, 0.943159, 0.943164, 0.943325, 0.943025, 0.943413,
-    0.943004, 0.943364, 0.943115, 0.94321, 0.943285, 0.943052,
-    0.943403, 0.942994, 0.943391, 0.943074, 0.943256, 0.943241,
-    0.943087, 0.943384, 0.942994, 0.94341, 0.94304, 0.943301,
-    0.943194, 0.943128, 0.943356, 0.943005, 0.943419, 0.943013,
-    0.943341, 0.943147, 0.943173, 0.94332, 0.943026, 0.943417,
-    0.942995, 0.943375, 0.943103, 0.943221, 0.943278, 0.943055,
-    0.943405, 0.942987, 0.943401, 0.943062, 0.943268, 0.943231,
-    0.943092, 0.943384, 0.94299, 0.943419, 0.943028, 0.943313,
-    0.943183, 0.943136, 0.943353, 0.943003, 0.943426, 0.943002,
-    0.943354, 0.943135, 0.943183, 0.943314, 0.943025, 0.943423,
-    0.942985, 0.943388, 0.943089, 0.943232, 0.94327, 0.943058,
-    0.943409, 0.942979, 0.943414, 0.943048, 0.943281, 0.943221,
-    0.943097, 0.943384, 0.942983, 0.94343, 0.943014, 0.943327,
-    0.943171, 0.943143, 0.943351, 0.942999, 0.943436, 0.942989,
-    0.943369, 0.943121, 0.943193, 0.943309, 0.943024, 0.94343,
-    0.942973, 0.943403, 0.943074, 0.943245, 0.943262, 0.943059,
-    0.943413, 0.942968, 0.943428, 0.943032, 0.943296, 0.94321,
-    0.943102, 0.943386, 0.942975, 0.943444, 0.942998, 0.943344,
-    0.943157, 0.943152, 0.943349, 0.942993, 0.943447, 0.942973,
-    0.943386, 0.943105, 0.943205, 0.943304, 0.943022, 0.94344,
-    0.942958, 0.943421, 0.943056, 0.943259, 0.943253, 0.94306,
-    0.94342, 0.942955, 0.943446, 0.943013, 0.943313, 0.943198,
-    0.943107, 0.943389, 0.942964, 0.94346, 0.942978, 0.943363,
-    0.943142, 0.94316, 0.943349, 0.942985, 0.943463, 0.942953,
-    0.943407, 0.943087, 0.943218, 0.9433, 0.943018, 0.943452,
-    0.942939, 0.943443, 0.943035, 0.943276, 0.943244, 0.943061,
-    0.943429, 0.942938, 0.943468, 0.94299, 0.943333, 0.943184,
-    0.943112, 0.943394, 0.94295, 0.943481, 0.942954, 0.943387,
-    0.943124, 0.94317, 0.943349, 0.942975, 0.943482, 0.942928,
-    0.943433, 0.943064, 0.943233, 0.943294, 0.943012, 0.943468,
-    0.942915, 0.94347, 0.943009, 0.943296, 0.943233, 0.94306,
-    0.943441, 0.942916, 0.943496, 0.942961, 0.943358, 0.943168,
-    0.943118, 0.943402, 0.942931, 0.943508, 0.942923, 0.943415,
-    0.943101, 0.943182, 0.94335, 0.94296, 0.943506, 0.942897,
-    0.943465, 0.943036, 0.943251, 0.943289, 0.943003, 0.943489,
-    0.942885, 0.943504, 0.942977, 0.943321, 0.94322, 0.943058,
-    0.943458, 0.942888, 0.943531, 0.942925, 0.943389, 0.943147,
-    0.943123, 0.943412, 0.942907, 0.943543, 0.942884, 0.943452,
-    0.943073, 0.943196, 0.943353, 0.942942, 0.943539, 0.942857,
-    0.943507, 0.943001, 0.943274, 0.943283, 0.942991, 0.943518,
-    0.942845, 0.94355, 0.942934, 0.943353, 0.943204, 0.943055,
-    0.94348, 0.94285, 0.943578, 0.942877, 0.94343, 0.943121,
-    0.94313, 0.943426, 0.942874, 0.94359, 0.942832, 0.943501,
-    0.943036, 0.943215, 0.943357, 0.942915, 0.943583, 0.942802,
-    0.943563, 0.942953, 0.943305, 0.943275, 0.942974, 0.943557,
-    0.94279, 0.943611, 0.942877, 0.943397, 0.943183, 0.94305,
-    0.943511, 0.942798, 0.943643, 0.94281, 0.943487, 0.943085,
-    0.943139, 0.943446, 0.942827, 0.943656, 0.942758, 0.94357,
-    0.942985, 0.94324, 0.943363, 0.942877, 0.943646, 0.942723,
-    0.943643, 0.942886, 0.943348, 0.943265, 0.942949, 0.943614,
-    0.94271, 0.943701, 0.942793, 0.943459, 0.943153, 0.943041,
-    0.943558, 0.94272, 0.943739, 0.942712, 0.943569, 0.943033,
-    0.943151, 0.943478, 0.942756, 0.943755, 0.942647, 0.943673,
-    0.942907, 0.943276, 0.943375, 0.942818, 0.943744, 0.942603,
-    0.943766, 0.942782, 0.943413, 0.94325, 0.942909, 0.943704,
-    0.942584, 0.943841, 0.942662, 0.943557, 0.943106, 0.943026,
-    0.943634, 0.942594, 0.943894, 0.942554, 0.943703, 0.942948,
-    0.94317, 0.943531, 0.942638, 0.94392, 0.942462, 0.943846,
-    0.942778, 0.943338, 0.943394, 0.942717, 0.943912, 0.942395,
-    0.943979, 0.942602, 0.943528, 0.943224, 0.942837, 0.943866,
-    0.942358, 0.944095, 0.942425, 0.943736, 0.943021, 0.942999,
-    0.943775, 0.942359, 0.944187, 0.942253, 0.943959, 0.942785,
-    0.943206, 0.943634, 0.942404, 0.944248, 0.942093, 0.944194,
-    0.942515, 0.943464, 0.943436, 0.942505, 0.944267, 0.941951,
-    0.944437, 0.942209, 0.94378, 0.943168, 0.942674, 0.944233,
-    0.941837, 0.944687, 0.941863, 0.944164, 0.942814, 0.94293,
-    0.944129, 0.94176, 0.944943, 0.941463, 0.944643, 0.942341,
-    0.943307, 0.943927, 0.941734, 0.945211, 0.940982, 0.945265,
-    0.941685, 0.943874, 0.94357, 0.941787, 0.945509, 0.940349,
-    0.94615, 0.94069, 0.944793, 0.942926, 0.941978, 0.945891,
-    0.939365, 0.947649, 0.938883, 0.946588, 0.941543, 0.942523,
-    0.946568, 0.937203, 0.951352, 0.933884, 0.952245, 0.936383,
-    0.945294, 0.949382, 0.922301, 1, 2.22267e-13, -1,
-    -0.922301, -0.949382, -0.945294, -0.936383, -0.952245, -0.933884,
-    -0.951352, -0.937203, -0.946568, -0.942523, -0.941543, -0.946588,
-    -0.938883, -0.947649, -0.939365, -0.945891, -0.941978, -0.942926,
-    -0.944793, -0.94069, -0.94615, -0.940349, -0.945509, -0.941787,
-    -0.94357, -0.943874, -0.941685, -0.945265, -0.940982, -0.945211,
-    -0.941734, -0.943927, -0.943307, -0.942341, -0.944643, -0.941463,
-    -0.944943, -0.94176, -0.944129, -0.94293, -0.942814, -0.944164,
-    -0.941863, -0.944687, -0.941837, -0.944233, -0.942674, -0.943168,
-    -0.94378, -0.942209, -0.944437, -0.941951, -0.944267, -0.942505,
-    -0.943436, -0.943464, -0.942515, -0.944194, -0.942093, -0.944248,
-    -0.942404, -0.943634, -0.943206, -0.942785, -0.943959, -0.942253,
-    -0.944187, -0.942359, -0.943775, -0.942999, -0.943021, -0.943736,
-    -0.942425, -0.944095, -0.942358, -0.943866, -0.942837, -0.943224,
-    -0.943528, -0.942602, -0.943979, -0.942395, -0.943912, -0.942717,
-    -0.943394, -0.943338, -0.942778, -0.943846, -0.942462, -0.94392,
-    -0.942638, -0.943531, -0.94317, -0.942948, -0.943703, -0.942554,
-    -0.943894, -0.942594, -0.943634, -0.943026, -0.943106, -0.943557,
-    -0.942662, -0.943841, -0.942584, -0.943704, -0.942909, -0.94325,
-    -0.943413, -0.942782, -0.943766, -0.942603, -0.943744, -0.942818,
-    -0.943375, -0.943276, -0.942907, -0.943673, -0.942647, -0.943755,
-    -0.942756, -0.943478, -0.943151, -0.943033, -0.943569, -0.942712,
-    -0.943739, -0.94272, -0.943558, -0.943041, -0.943153, -0.943459,
-    -0.942793, -0.943701, -0.94271, -0.943614, -0.942949, -0.943265,
-    -0.943348, -0.942886, -0.943643, -0.942723, -0.943646, -0.942877,
-    -0.943363, -0.94324, -0.942985, -0.94357, -0.942758, -0.943656,
-    -0.942827, -0.943446, -0.943139, -0.943085, -0.943487, -0.94281,
-    -0.943643, -0.942798, -0.943511, -0.94305, -0.943183, -0.943397,
-    -0.942877, -0.943611, -0.94279, -0.943557, -0.942974, -0.943275,
-    -0.943305, -0.942953, -0.943563, -0.942802, -0.943583, -0.942915,
-    -0.943357, -0.943215, -0.943036, -0.943501, -0.942832, -0.94359,
-    -0.942874, -0.943426, -0.94313, -0.943121, -0.94343, -0.942877,
-    -0.943578, -0.94285, -0.94348, -0.943055, -0.943204, -0.943353,
-    -0.942934, -0.94355, -0.942845, -0.943518, -0.942991, -0.943283,
-    -0.943274, -0.943001, -0.943507, -0.942857, -0.943539, -0.942942,
-    -0.943353, -0.943196, -0.943073, -0.943452, -0.942884, -0.943543,
-    -0.942907, -0.943412, -0.943123, -0.943147, -0.943389, -0.942925,
-    -0.943531, -0.942888, -0.943458, -0.943058, -0.94322, -0.943321,
-    -0.942977, -0.943504, -0.942885, -0.943489, -0.943003, -0.943289,
-    -0.943251, -0.943036, -0.943465, -0.942897, -0.943506, -0.94296,
-    -0.94335, -0.943182, -0.943101, -0.943415, -0.942923, -0.943508,
-    -0.942931, -0.943402, -0.943118, -0.943168, -0.943358, -0.942961,
-    -0.943496, -0.942916, -0.943441, -0.94306, -0.943233, -0.943296,
-    -0.943009, -0.94347, -0.942915, -0.943468, -0.943012, -0.943294,
-    -0.943233, -0.943064, -0.943433, -0.942928, -0.943482, -0.942975,
-    -0.943349, -0.94317, -0.943124, -0.943387, -0.942954, -0.943481,
-    -0.94295, -0.943394, -0.943112, -0.943184, -0.943333, -0.94299,
-    -0.943468, -0.942938, -0.943429, -0.943061, -0.943244, -0.943276,
-    -0.943035, -0.943443, -0.942939, -0.943452, -0.943018, -0.9433,
-    -0.943218, -0.943087, -0.943407, -0.942953, -0.943463, -0.942985,
-    -0.943349, -0.94316, -0.943142, -0.943363, -0.942978, -0.94346,
-    -0.942964, -0.943389, -0.943107, -0.943198, -0.943313, -0.943013,
-    -0.943446, -0.942955, -0.94342, -0.94306, -0.943253, -0.943259,
-    -0.943056, -0.943421, -0.942958, -0.94344, -0.943022, -0.943304,
-    -0.943205, -0.943105, -0.943386, -0.942973, -0.943447, -0.942993,
-    -0.943349, -0.943152, -0.943157, -0.943344, -0.942998, -0.943444,
-    -0.942975, -0.943386, -0.943102, -0.94321, -0.943296, -0.943032,
-    -0.943428, -0.942968, -0.943413, -0.943059, -0.943262, -0.943245,
-    -0.943074, -0.943403, -0.942973, -0.94343, -0.943024, -0.943309,
-    -0.943193, -0.943121, -0.943369, -0.942989, -0.943436, -0.942999,
-    -0.943351, -0.943143, -0.943171, -0.943327, -0.943014, -0.94343,
-    -0.942983, -0.943384, -0.943097, -0.943221, -0.943281, -0.943048,
-    -0.943414, -0.942979, -0.943409, -0.943058, -0.94327, -0.943232,
-    -0.943089, -0.943388, -0.942985, -0.943423, -0.943025, -0.943314,
-    -0.943183, -0.943135, -0.943354, -0.943002, -0.943426, -0.943003,
-    -0.943353, -0.943136, -0.943183, -0.943313, -0.943028, -0.943419,
-    -0.94299, -0.943384, -0.943092, -0.943231, -0.943268, -0.943062,
-    -0.943401, -0.942987, -0.943405, -0.943055, -0.943278, -0.943221,
-    -0.943103, -0.943375, -0.942995, -0.943417, -0.943026, -0.94332,
-    -0.943173, -0.943147, -0.943341, -0.943013, -0.943419, -0.943005,
-    -0.943356, -0.943128, -0.943194, -0.943301, -0.94304, -0.94341,
-    -0.942994, -0.943384, -0.943087, -0.943241, -0.943256, -0.943074,
-    -0.943391, -0.942994, -0.943403, -0.943052, -0.943285, -0.94321,
-    -0.943115, -0.943364, -0.943004, -0.943413, -0.943025, -0.943325,
-    -0.943164, -0.943159, -0.943329, -0.943023, -0.943413, -0.943006,
-    -0.943359, -0.94312, -0.943205, -0.943289, -0.94305, -0.943402,
-    -0.942998, -0.943386, -0.943081, -0.94325, -0.943245, -0.943085,
-    -0.943383, -0.942999, -0.943403, -0.943048, -0.943293, -0.9432,
-    -0.943126, -0.943354, -0.94301, -0.943411, -0.943023, -0.943332,
-    -0.943155, -0.943169, -0.943319, -0.943031, -0.943408, -0.943006,
-    -0.943364, -0.943112, -0.943215, -0.943279, -0.943059, -0.943396,
-    -0.943, -0.943388, -0.943074, -0.943259, -0.943235, -0.943095,
-    -0.943375, -0.943003, -0.943404, -0.943043, -0.943301, -0.94319,
-    -0.943136, -0.943346, -0.943015, -0.943409, -0.94302, -0.943338,
-    -0.943145, -0.94318, -0.94331, -0.943037, -0.943405, -0.943005,
-    -0.943369, -0.943104, -0.943225, -0.943269, -0.943067, -0.943392,
-    -0.943, -0.943392, -0.943067, -0.943269, -0.943225, -0.943104,
-    -0.943369, -0.943005, -0.943405, -0.943037, -0.94331, -0.94318,
-    -0.943145, -0.943338, -0.94302, -0.943409, -0.943015, -0.943346,
-    -0.943136, -0.94319, -0.943301, -0.943043, -0.943404, -0.943003,
-    -0.943375, -0.943095, -0.943235, -0.943259, -0.943074, -0.943388,
-    -0.943, -0.943396, -0.943059, -0.943279, -0.943215, -0.943112,
-    -0.943364, -0.943006, -0.943408, -0.943031, -0.943319, -0.943169,
-    -0.943155, -0.943332, -0.943023, -0.943411, -0.94301, -0.943354,
-    -0.943126, -0.9432, -0.943293, -0.943048, -0.943403, -0.942999,
-    -0.943383, -0.943085, -0.943245, -0.94325, -0.943081, -0.943386,
-    -0.942998, -0.943402, -0.94305, -0.943289, -0.943205, -0.94312,
-    -0.943359, -0.943006, -0.943413, -0.943023, -0.943329, -0.943159,
-    -0.943164, -0.943325, -0.943025, -0.943413, -0.943004, -0.943364,
-    -0.943115, -0.94321, -0.943285, -0.943052, -0.943403, -0.942994,
-    -0.943391, -0.943074, -0.943256, -0.943241, -0.943087, -0.943384,
-    -0.942994, -0.94341, -0.94304, -0.943301, -0.943194, -0.943128,
-    -0.943356, -0.943005, -0.943419, -0.943013, -0.943341, -0.943147,
-    -0.943173, -0.94332, -0.943026, -0.943417, -0.942995, -0.943375,
-    -0.943103, -0.943221, -0.943278, -0.943055, -0.943405, -0.942987,
-    -0.943401, -0.943062, -0.943268, -0.943231, -0.943092, -0.943384,
-    -0.94299, -0.943419, -0.943028, -0.943313, -0.943183, -0.943136,
-    -0.943353, -0.943003, -0.943426, -0.943002, -0.943354, -0.943135,
-    -0.943183, -0.943314, -0.943025, -0.943423, -0.942985, -0.943388,
-    -0.943089, -0.943232, -0.94327, -0.943058, -0.943409, -0.942979,
-    -0.943414, -0.943048, -0.943281, -0.943221, -0.943097, -0.943384,
-    -0.942983, -0.94343, -0.943014, -0.943327, -0.943171, -0.943143,
-    -0.943351, -0.942999, -0.943436, -0.942989, -0.943369, -0.943121,
-    -0.943193, -0.943309, -0.943024, -0.94343, -0.942973, -0.943403,
-    -0.943074, -0.943245, -0.943262, -0.943059, -0.943413, -0.942968,
-    -0.943428, -0.943032, -0.943296, -0.94321, -0.943102, -0.943386,
-    -0.942975, -0.943444, -0.942998, -0.943344, -0.943157, -0.943152,
-    -0.943349, -0.942993, -0.943447, -0.942973, -0.943386, -0.943105,
-    -0.943205, -0.943304, -0.943022, -0.94344, -0.942958, -0.943421,
-    -0.943056, -0.943259, -0.943253, -0.94306, -0.94342, -0.942955,
-    -0.943446, -0.943013, -0.943313, -0.943198, -0.943107, -0.943389,
-    -0.942964, -0.94346, -0.942978, -0.943363, -0.943142, -0.94316,
-    -0.943349, -0.942985, -0.943463, -0.942953, -0.943407, -0.943087,
-    -0.943218, -0.9433, -0.943018, -0.943452, -0.942939, -0.943443,
-    -0.943035, -0.943276, -0.943244, -0.943061, -0.943429, -0.942938,
-    -0.943468, -0.94299, -0.943333, -0.943184, -0.943112, -0.943394,
-    -0.94295, -0.943481, -0.942954, -0.943387, -0.943124, -0.94317,
-    -0.943349, -0.942975, -0.943482, -0.942928, -0.943433, -0.943064,
-    -0.943233, -0.943294, -0.943012, -0.943468, -0.942915, -0.94347,
-    -0.943009, -0.943296, -0.943233, -0.94306, -0.943441, -0.942916,
-    -0.943496, -0.942961, -0.943358, -0.943168, -0.943118, -0.943402,
-    -0.942931, -0.943508, -0.942923, -0.943415, -0.943101, -0.943182,
-    -0.94335, -0.94296, -0.943506, -0.942897, -0.943465, -0.943036,
-    -0.943251, -0.943289, -0.943003, -0.943489, -0.942885, -0.943504,
-    -0.942977, -0.943321, -0.94322, -0.943058, -0.943458, -0.942888,
-    -0.943531, -0.942925, -0.943389, -0.943147, -0.943123, -0.943412,
-    -0.942907, -0.943543, -0.942884, -0.943452, -0.943073, -0.943196,
-    -0.943353, -0.942942, -0.943539, -0.942857, -0.943507, -0.943001,
-    -0.943274, -0.943283, -0.942991, -0.943518, -0.942845, -0.94355,
-    -0.942934, -0.943353, -0.943204, -0.943055, -0.94348, -0.94285,
-    -0.943578, -0.942877, -0.94343, -0.943121, -0.94313, -0.943426,
-    -0.942874, -0.94359, -0.942832, -0.943501, -0.943036, -0.943215,
-    -0.943357, -0.942915, -0.943583, -0.942802, -0.943563, -0.942953,
-    -0.943305, -0.943275, -0.942974, -0.943557, -0.94279, -0.943611,
-    -0.942877, -0.943397, -0.943183, -0.94305, -0.943511, -0.942798,
-    -0.943643, -0.94281, -0.943487, -0.943085, -0.943139, -0.943446,
-    -0.942827, -0.943656, -0.942758, -0.94357, -0.942985, -0.94324,
-    -0.943363, -0.942877, -0.943646, -0.942723, -0.943643, -0.942886,
-    -0.943348, -0.943265, -0.942949, -0.943614, -0.94271, -0.943701,
-    -0.942793, -0.943459, -0.943153, -0.943041, -0.943558, -0.94272,
-    -0.943739, -0.942712, -0.943569, -0.943033, -0.943151, -0.943478,
-    -0.942756, -0.943755, -0.942647, -0.943673, -0.942907, -0.943276,
-    -0.943375, -0.942818, -0.943744, -0.942603, -0.943766, -0.942782,
-    -0.943413, -0.94325, -0.942909, -0.943704, -0.942584, -0.943841,
-    -0.942662, -0.943557, -0.943106, -0.943026, -0.943634, -0.942594,
-    -0.943894, -0.942554, -0.943703, -0.942948, -0.94317, -0.943531,
-    -0.942638, -0.94392, -0.942462, -0.943846, -0.942778, -0.943338,
-    -0.943394, -0.942717, -0.943912, -0.942395, -0.943979, -0.942602,
-    -0.943528, -0.943224, -0.942837, -0.943866, -0.942358, -0.944095,
-    -0.942425, -0.943736, -0.943021, -0.942999, -0.943775, -0.942359,
-    -0.944187, -0.942253, -0.943959, -0.942785, -0.943206, -0.943634,
-    -0.942404, -0.944248, -0.942093, -0.944194, -0.942515, -0.943464,
-    -0.943436, -0.942505, -0.944267, -0.941951, -0.944437, -0.942209,
-    -0.94378, -0.943168, -0.942674, -0.944233, -0.941837, -0.944687,
-    -0.941863, -0.944164, -0.942814, -0.94293, -0.944129, -0.94176,
-    -0.944943, -0.941463, -0.944643, -0.942341, -0.943307, -0.943927,
-    -0.941734, -0.945211, -0.940982, -0.945265, -0.941685, -0.943874,
-    -0.94357, -0.941787, -0.945509, -0.940349, -0.94615, -0.94069,
-    -0.944793, -0.942926, -0.941978, -0.945891, -0.939365, -0.947649,
-    -0.938883, -0.946588, -0.941543, -0.942523, -0.946568, -0.937203,
-    -0.951352, -0.933884, -0.952245, -0.936383, -0.945294, -0.949382,
-    -0.922301, -1
-};
-
-static const float WAVE_SQUARE_006[DEFAULT_WAVELEN] = {
-    8.88178e-16, 0.900593, 0.947941, 0.964729, 0.973404, 0.978773,
-    0.982473, 0.98521, 0.987342, 0.989063, 0.990494, 0.991709,
-    0.992758, 0.993675, 0.994484, 0.995203, 0.995845, 0.99642,
-    0.996936, 0.997399, 0.997813, 0.998183, 0.998512, 0.998802,
-    0.999056, 0.999275, 0.999463, 0.99962, 0.999747, 0.999848,
-    0.999922, 0.999971, 0.999997, 1, 0.999983, 0.999946,
-    0.99989, 0.999818, 0.999731, 0.999629, 0.999513, 0.999387,
-    0.99925, 0.999104, 0.99895, 0.99879, 0.998625, 0.998455,
-    0.998284, 0.99811, 0.997937, 0.997764, 0.997594, 0.997426,
-    0.997262, 0.997103, 0.99695, 0.996803, 0.996664, 0.996533,
-    0.99641, 0.996296, 0.996192, 0.996098, 0.996015, 0.995942,
-    0.995879, 0.995828, 0.995787, 0.995757, 0.995738, 0.99573,
-    0.995732, 0.995744, 0.995765, 0.995796, 0.995836, 0.995884,
-    0.99594, 0.996003, 0.996073, 0.996148, 0.996229, 0.996315,
-    0.996404, 0.996496, 0.996591, 0.996688, 0.996786, 0.996884,
-    0.996981, 0.997078, 0.997172, 0.997265, 0.997354, 0.99744,
-    0.997522, 0.997599, 0.997671, 0.997738, 0.997799, 0.997854,
-    0.997902, 0.997944, 0.997979, 0.998008, 0.998029, 0.998043,
-    0.99805, 0.99805, 0.998044, 0.99803, 0.998011, 0.997985,
-    0.997953, 0.997916, 0.997874, 0.997826, 0.997775, 0.997719,
-    0.99766, 0.997598, 0.997533, 0.997467, 0.997399, 0.99733,
-    0.99726, 0.99719, 0.997121, 0.997053, 0.996987, 0.996922,
-    0.99686, 0.9968, 0.996744, 0.996691, 0.996642, 0.996598,
-    0.996557, 0.996522, 0.996491, 0.996465, 0.996445, 0.996429,
-    0.996419, 0.996414, 0.996415, 0.99642, 0.996431, 0.996446,
-    0.996466, 0.996491, 0.99652, 0.996553, 0.99659, 0.996631,
-    0.996674, 0.99672, 0.996769, 0.996819, 0.996872, 0.996925,
-    0.996979, 0.997034, 0.997089, 0.997143, 0.997197, 0.997249,
-    0.9973, 0.997349, 0.997396, 0.99744, 0.997482, 0.99752,
-    0.997555, 0.997587, 0.997615, 0.997639, 0.997658, 0.997674,
-    0.997686, 0.997693, 0.997696, 0.997695, 0.997689, 0.99768,
-    0.997666, 0.997649, 0.997627, 0.997603, 0.997575, 0.997544,
-    0.99751, 0.997473, 0.997435, 0.997394, 0.997352, 0.997308,
-    0.997264, 0.997218, 0.997173, 0.997127, 0.997082, 0.997037,
-    0.996994, 0.996952, 0.996911, 0.996872, 0.996835, 0.996801,
-    0.99677, 0.996741, 0.996715, 0.996692, 0.996673, 0.996657,
-    0.996645, 0.996636, 0.996631, 0.996629, 0.996632, 0.996637,
-    0.996646, 0.996659, 0.996675, 0.996694, 0.996716, 0.996741,
-    0.996768, 0.996798, 0.99683, 0.996864, 0.996899, 0.996936,
-    0.996974, 0.997013, 0.997052, 0.997092, 0.997131, 0.99717,
-    0.997209, 0.997247, 0.997283, 0.997318, 0.997351, 0.997382,
-    0.997412, 0.997439, 0.997463, 0.997485, 0.997504, 0.99752,
-    0.997533, 0.997542, 0.997549, 0.997553, 0.997553, 0.99755,
-    0.997544, 0.997535, 0.997523, 0.997508, 0.99749, 0.99747,
-    0.997447, 0.997422, 0.997395, 0.997366, 0.997335, 0.997303,
-    0.99727, 0.997236, 0.997201, 0.997166, 0.997131, 0.997095,
-    0.997061, 0.997026, 0.996993, 0.996961, 0.99693, 0.996901,
-    0.996873, 0.996848, 0.996824, 0.996803, 0.996785, 0.996768,
-    0.996755, 0.996744, 0.996736, 0.996731, 0.996729, 0.99673,
-    0.996734, 0.99674, 0.996749, 0.996761, 0.996775, 0.996792,
-    0.996812, 0.996833, 0.996857, 0.996882, 0.996909, 0.996937,
-    0.996967, 0.996997, 0.997029, 0.99706, 0.997093, 0.997125,
-    0.997157, 0.997189, 0.99722, 0.99725, 0.997279, 0.997307,
-    0.997333, 0.997358, 0.99738, 0.997401, 0.99742, 0.997436,
-    0.99745, 0.997462, 0.997471, 0.997477, 0.997481, 0.997482,
-    0.99748, 0.997476, 0.997469, 0.997459, 0.997448, 0.997433,
-    0.997417, 0.997398, 0.997378, 0.997355, 0.997331, 0.997306,
-    0.997279, 0.997251, 0.997222, 0.997193, 0.997163, 0.997133,
-    0.997103, 0.997074, 0.997044, 0.997016, 0.996988, 0.996961,
-    0.996936, 0.996912, 0.996889, 0.996868, 0.99685, 0.996833,
-    0.996818, 0.996806, 0.996796, 0.996789, 0.996784, 0.996781,
-    0.996781, 0.996784, 0.996789, 0.996796, 0.996806, 0.996818,
-    0.996832, 0.996848, 0.996866, 0.996886, 0.996908, 0.996931,
-    0.996956, 0.996982, 0.997008, 0.997036, 0.997064, 0.997092,
-    0.99712, 0.997149, 0.997177, 0.997204, 0.997231, 0.997257,
-    0.997282, 0.997306, 0.997328, 0.997349, 0.997368, 0.997385,
-    0.9974, 0.997413, 0.997424, 0.997433, 0.997439, 0.997443,
-    0.997444, 0.997443, 0.99744, 0.997435, 0.997427, 0.997417,
-    0.997404, 0.99739, 0.997374, 0.997356, 0.997336, 0.997314,
-    0.997292, 0.997268, 0.997243, 0.997217, 0.99719, 0.997163,
-    0.997136, 0.997109, 0.997081, 0.997055, 0.997028, 0.997003,
-    0.996978, 0.996954, 0.996932, 0.996911, 0.996892, 0.996874,
-    0.996858, 0.996844, 0.996833, 0.996823, 0.996816, 0.99681,
-    0.996807, 0.996807, 0.996808, 0.996812, 0.996819, 0.996827,
-    0.996838, 0.99685, 0.996865, 0.996882, 0.9969, 0.99692,
-    0.996941, 0.996964, 0.996987, 0.997012, 0.997037, 0.997063,
-    0.99709, 0.997117, 0.997143, 0.99717, 0.997196, 0.997221,
-    0.997246, 0.997269, 0.997292, 0.997313, 0.997333, 0.997352,
-    0.997368, 0.997383, 0.997396, 0.997407, 0.997415, 0.997422,
-    0.997426, 0.997428, 0.997428, 0.997425, 0.99742, 0.997413,
-    0.997404, 0.997393, 0.99738, 0.997365, 0.997348, 0.997329,
-    0.997309, 0.997288, 0.997265, 0.997241, 0.997217, 0.997191,
-    0.997165, 0.997139, 0.997113, 0.997087, 0.997061, 0.997035,
-    0.99701, 0.996986, 0.996963, 0.996941, 0.996921, 0.996901,
-    0.996884, 0.996868, 0.996854, 0.996842, 0.996832, 0.996825,
-    0.996819, 0.996816, 0.996815, 0.996816, 0.996819, 0.996825,
-    0.996832, 0.996842, 0.996854, 0.996868, 0.996884, 0.996901,
-    0.996921, 0.996941, 0.996963, 0.996986, 0.99701, 0.997035,
-    0.997061, 0.997087, 0.997113, 0.997139, 0.997165, 0.997191,
-    0.997217, 0.997241, 0.997265, 0.997288, 0.997309, 0.997329,
-    0.997348, 0.997365, 0.99738, 0.997393, 0.997404, 0.997413,
-    0.99742, 0.997425, 0.997428, 0.997428, 0.997426, 0.997422,
-    0.997415, 0.997407, 0.997396, 0.997383, 0.997368, 0.997352,
-    0.997333, 0.997313, 0.997292, 0.997269, 0.997246, 0.997221,
-    0.997196, 0.99717, 0.997143, 0.997117, 0.99709, 0.997063,
-    0.997037, 0.997012, 0.996987, 0.996964, 0.996941, 0.99692,
-    0.9969, 0.996882, 0.996865, 0.99685, 0.996838, 0.996827,
-    0.996819, 0.996812, 0.996808, 0.996807, 0.996807, 0.99681,
-    0.996816, 0.996823, 0.996833, 0.996844, 0.996858, 0.996874,
-    0.996892, 0.996911, 0.996932, 0.996954, 0.996978, 0.997003,
-    0.997028, 0.997055, 0.997081, 0.997109, 0.997136, 0.997163,
-    0.99719, 0.997217, 0.997243, 0.997268, 0.997292, 0.997314,
-    0.997336, 0.997356, 0.997374, 0.99739, 0.997404, 0.997417,
-    0.997427, 0.997435, 0.99744, 0.997443, 0.997444, 0.997443,
-    0.997439, 0.997433, 0.997424, 0.997413, 0.9974, 0.997385,
-    0.997368, 0.997349, 0.997328, 0.997306, 0.997282, 0.997257,
-    0.997231, 0.997204, 0.997177, 0.997149, 0.99712, 0.997092,
-    0.997064, 0.997036, 0.997008, 0.996982, 0.996956, 0.996931,
-    0.996908, 0.996886, 0.996866, 0.996848, 0.996832, 0.996818,
-    0.996806, 0.996796, 0.996789, 0.996784, 0.996781, 0.996781,
-    0.996784, 0.996789, 0.996796, 0.996806, 0.996818, 0.996833,
-    0.99685, 0.996868, 0.996889, 0.996912, 0.996936, 0.996961,
-    0.996988, 0.997016, 0.997044, 0.997074, 0.997103, 0.997133,
-    0.997163, 0.997193, 0.997222, 0.997251, 0.997279, 0.997306,
-    0.997331, 0.997355, 0.997378, 0.997398, 0.997417, 0.997433,
-    0.997448, 0.997459, 0.997469, 0.997476, 0.99748, 0.997482,
-    0.997481, 0.997477, 0.997471, 0.997462, 0.99745, 0.997436,
-    0.99742, 0.997401, 0.99738, 0.997358, 0.997333, 0.997307,
-    0.997279, 0.99725, 0.99722, 0.997189, 0.997157, 0.997125,
-    0.997093, 0.99706, 0.997029, 0.996997, 0.996967, 0.996937,
-    0.996909, 0.996882, 0.996857, 0.996833, 0.996812, 0.996792,
-    0.996775, 0.996761, 0.996749, 0.99674, 0.996734, 0.99673,
-    0.996729, 0.996731, 0.996736, 0.996744, 0.996755, 0.996768,
-    0.996785, 0.996803, 0.996824, 0.996848, 0.996873, 0.996901,
-    0.99693, 0.996961, 0.996993, 0.997026, 0.997061, 0.997095,
-    0.997131, 0.997166, 0.997201, 0.997236, 0.99727, 0.997303,
-    0.997335, 0.997366, 0.997395, 0.997422, 0.997447, 0.99747,
-    0.99749, 0.997508, 0.997523, 0.997535, 0.997544, 0.99755,
-    0.997553, 0.997553, 0.997549, 0.997542, 0.997533, 0.99752,
-    0.997504, 0.997485, 0.997463, 0.997439, 0.997412, 0.997382,
-    0.997351, 0.997318, 0.997283, 0.997247, 0.997209, 0.99717,
-    0.997131, 0.997092, 0.997052, 0.997013, 0.996974, 0.996936,
-    0.996899, 0.996864, 0.99683, 0.996798, 0.996768, 0.996741,
-    0.996716, 0.996694, 0.996675, 0.996659, 0.996646, 0.996637,
-    0.996632, 0.996629, 0.996631, 0.996636, 0.996645, 0.996657,
-    0.996673, 0.996692, 0.996715, 0.996741, 0.99677, 0.996801,
-    0.996835, 0.996872, 0.996911, 0.996952, 0.996994, 0.997037,
-    0.997082, 0.997127, 0.997173, 0.997218, 0.997264, 0.997308,
-    0.997352, 0.997394, 0.997435, 0.997473, 0.99751, 0.997544,
-    0.997575, 0.997603, 0.997627, 0.997649, 0.997666, 0.99768,
-    0.997689, 0.997695, 0.997696, 0.997693, 0.997686, 0.997674,
-    0.997658, 0.997639, 0.997615, 0.997587, 0.997555, 0.99752,
-    0.997482, 0.99744, 0.997396, 0.997349, 0.9973, 0.997249,
-    0.997197, 0.997143, 0.997089, 0.997034, 0.996979, 0.996925,
-    0.996872, 0.996819, 0.996769, 0.99672, 0.996674, 0.996631,
-    0.99659, 0.996553, 0.99652, 0.996491, 0.996466, 0.996446,
-    0.996431, 0.99642, 0.996415, 0.996414, 0.996419, 0.996429,
-    0.996445, 0.996465, 0.996491, 0.996522, 0.996557, 0.996598,
-    0.996642, 0.996691, 0.996744, 0.9968, 0.99686, 0.996922,
-    0.996987, 0.997053, 0.997121, 0.99719, 0.99726, 0.99733,
-    0.997399, 0.997467, 0.997533, 0.997598, 0.99766, 0.997719,
-    0.997775, 0.997826, 0.997874, 0.997916, 0.997953, 0.997985,
-    0.998011, 0.99803, 0.998044, 0.99805, 0.99805, 0.998043,
-    0.998029, 0.998008, 0.997979, 0.997944, 0.997902, 0.997854,
-    0.997799, 0.997738, 0.997671, 0.997599, 0.997522, 0.99744,
-    0.997354, 0.997265, 0.997172, 0.997078, 0.996981, 0.996884,
-    0.996786, 0.996688, 0.996591, 0.996496, 0.996404, 0.996315,
-    0.996229, 0.996148, 0.996073, 0.996003, 0.99594, 0.995884,
-    0.995836, 0.995796, 0.995765, 0.995744, 0.995732, 0.99573,
-    0.995738, 0.995757, 0.995787, 0.995828, 0.995879, 0.995942,
-    0.996015, 0.996098, 0.996192, 0.996296, 0.99641, 0.996533,
-    0.996664, 0.996803, 0.99695, 0.997103, 0.997262, 0.997426,
-    0.997594, 0.997764, 0.997937, 0.99811, 0.998284, 0.998455,
-    0.998625, 0.99879, 0.99895, 0.999104, 0.99925, 0.999387,
-    0.999513, 0.999629, 0.999731, 0.999818, 0.99989, 0.999946,
-    0.999983, 1, 0.999997, 0.999971, 0.999922, 0.999848,
-    0.999747, 0.99962, 0.999463, 0.999275, 0.999056, 0.998802,
-    0.998512, 0.998183, 0.997813, 0.997399, 0.996936, 0.99642,
-    0.995845, 0.995203, 0.994484, 0.993675, 0.992758, 0.991709,
-    0.990494, 0.989063, 0.987342, 0.98521, 0.982473, 0.978773,
-    0.973404, 0.964729, 0.947941, 0.900593, 1.63203e-13, -0.900593,
-    -0.947941, -0.964729, -0.973404, -0.978773, -0.982473, -0.98521,
-    -0.987342, -0.989063, -0.990494, -0.991709, -0.992758, -0.993675,
-    -0.994484, -0.995203, -0.995845, -0.99642, -0.996936, -0.997399,
-    -0.997813, -0.998183, -0.998512, -0.998802, -0.999056, -0.999275,
-    -0.999463, -0.99962, -0.999747, -0.999848, -0.999922, -0.999971,
-    -0.999997, -1, -0.999983, -0.999946, -0.99989, -0.999818,
-    -0.999731, -0.999629, -0.999513, -0.999387, -0.99925, -0.999104,
-    -0.99895, -0.99879, -0.998625, -0.998455, -0.998284, -0.99811,
-    -0.997937, -0.997764, -0.997594, -0.997426, -0.997262, -0.997103,
-    -0.99695, -0.996803, -0.996664, -0.996533, -0.99641, -0.996296,
-    -0.996192, -0.996098, -0.996015, -0.995942, -0.995879, -0.995828,
-    -0.995787, -0.995757, -0.995738, -0.99573, -0.995732, -0.995744,
-    -0.995765, -0.995796, -0.995836, -0.995884, -0.99594, -0.996003,
-    -0.996073, -0.996148, -0.996229, -0.996315, -0.996404, -0.996496,
-    -0.996591, -0.996688, -0.996786, -0.996884, -0.996981, -0.997078,
-    -0.997172, -0.997265, -0.997354, -0.99744, -0.997522, -0.997599,
-    -0.997671, -0.997738, -0.997799, -0.997854, -0.997902, -0.997944,
-    -0.997979, -0.998008, -0.998029, -0.998043, -0.99805, -0.99805,
-    -0.998044, -0.99803, -0.998011, -0.997985, -0.997953, -0.997916,
-    -0.997874, -0.997826, -0.997775, -0.997719, -0.99766, -0.997598,
-    -0.997533, -0.997467, -0.997399, -0.99733, -0.99726, -0.99719,
-    -0.997121, -0.997053, -0.996987, -0.996922, -0.99686, -0.9968,
-    -0.996744, -0.996691, -0.996642, -0.996598, -0.996557, -0.996522,
-    -0.996491, -0.996465, -0.996445, -0.996429, -0.996419, -0.996414,
-    -0.996415, -0.99642, -0.996431, -0.996446, -0.996466, -0.996491,
-    -0.99652, -0.996553, -0.99659, -0.996631, -0.996674, -0.99672,
-    -0.996769, -0.996819, -0.996872, -0.996925, -0.996979, -0.997034,
-    -0.997089, -0.997143, -0.997197, -0.997249, -0.9973, -0.997349,
-    -0.997396, -0.99744, -0.997482, -0.99752, -0.997555, -0.997587,
-    -0.997615, -0.997639, -0.997658, -0.997674, -0.997686, -0.997693,
-    -0.997696, -0.997695, -0.997689, -0.99768, -0.997666, -0.997649,
-    -0.997627, -0.997603, -0.997575, -0.997544, -0.99751, -0.997473,
-    -0.997435, -0.997394, -0.997352, -0.997308, -0.997264, -0.997218,
-    -0.997173, -0.997127, -0.997082, -0.997037, -0.996994, -0.996952,
-    -0.996911, -0.996872, -0.996835, -0.996801, -0.99677, -0.996741,
-    -0.996715, -0.996692, -0.996673, -0.996657, -0.996645, -0.996636,
-    -0.996631, -0.996629, -0.996632, -0.996637, -0.996646, -0.996659,
-    -0.996675, -0.996694, -0.996716, -0.996741, -0.996768, -0.996798,
-    -0.99683, -0.996864, -0.996899, -0.996936, -0.996974, -0.997013,
-    -0.997052, -0.997092, -0.997131, -0.99717, -0.997209, -0.997247,
-    -0.997283, -0.997318, -0.997351, -0.997382, -0.997412, -0.997439,
-    -0.997463, -0.997485, -0.997504, -0.99752, -0.997533, -0.997542,
-    -0.997549, -0.997553, -0.997553, -0.99755, -0.997544, -0.997535,
-    -0.997523, -0.997508, -0.99749, -0.99747, -0.997447, -0.997422,
-    -0.997395, -0.997366, -0.997335, -0.997303, -0.99727, -0.997236,
-    -0.997201, -0.997166, -0.997131, -0.997095, -0.997061, -0.997026,
-    -0.996993, -0.996961, -0.99693, -0.996901, -0.996873, -0.996848,
-    -0.996824, -0.996803, -0.996785, -0.996768, -0.996755, -0.996744,
-    -0.996736, -0.996731, -0.996729, -0.99673, -0.996734, -0.99674,
-    -0.996749, -0.996761, -0.996775, -0.996792, -0.996812, -0.996833,
-    -0.996857, -0.996882, -0.996909, -0.996937, -0.996967, -0.996997,
-    -0.997029, -0.99706, -0.997093, -0.997125, -0.997157, -0.997189,
-    -0.99722, -0.99725, -0.997279, -0.997307, -0.997333, -0.997358,
-    -0.99738, -0.997401, -0.99742, -0.997436, -0.99745, -0.997462,
-    -0.997471, -0.997477, -0.997481, -0.997482, -0.99748, -0.997476,
-    -0.997469, -0.997459, -0.997448, -0.997433, -0.997417, -0.997398,
-    -0.997378, -0.997355, -0.997331, -0.997306, -0.997279, -0.997251,
-    -0.997222, -0.997193, -0.997163, -0.997133, -0.997103, -0.997074,
-    -0.997044, -0.997016, -0.996988, -0.996961, -0.996936, -0.996912,
-    -0.996889, -0.996868, -0.99685, -0.996833, -0.996818, -0.996806,
-    -0.996796, -0.996789, -0.996784, -0.996781, -0.996781, -0.996784,
-    -0.996789, -0.996796, -0.996806, -0.996818, -0.996832, -0.996848,
-    -0.996866, -0.996886, -0.996908, -0.996931, -0.996956, -0.996982,
-    -0.997008, -0.997036, -0.997064, -0.997092, -0.99712, -0.997149,
-    -0.997177, -0.997204, -0.997231, -0.997257, -0.997282, -0.997306,
-    -0.997328, -0.997349, -0.997368, -0.997385, -0.9974, -0.997413,
-    -0.997424, -0.997433, -0.997439, -0.997443, -0.997444, -0.997443,
-    -0.99744, -0.997435, -0.997427, -0.997417, -0.997404, -0.99739,
-    -0.997374, -0.997356, -0.997336, -0.997314, -0.997292, -0.997268,
-    -0.997243, -0.997217, -0.99719, -0.997163, -0.997136, -0.997109,
-    -0.997081, -0.997055, -0.997028, -0.997003, -0.996978, -0.996954,
-    -0.996932, -0.996911, -0.996892, -0.996874, -0.996858, -0.996844,
-    -0.996833, -0.996823, -0.996816, -0.99681, -0.996807, -0.996807,
-    -0.996808, -0.996812, -0.996819, -0.996827, -0.996838, -0.99685,
-    -0.996865, -0.996882, -0.9969, -0.99692, -0.996941, -0.996964,
-    -0.996987, -0.997012, -0.997037, -0.997063, -0.99709, -0.997117,
-    -0.997143, -0.99717, -0.997196, -0.997221, -0.997246, -0.997269,
-    -0.997292, -0.997313, -0.997333, -0.997352, -0.997368, -0.997383,
-    -0.997396, -0.997407, -0.997415, -0.997422, -0.997426, -0.997428,
-    -0.997428, -0.997425, -0.99742, -0.997413, -0.997404, -0.997393,
-    -0.99738, -0.997365, -0.997348, -0.997329, -0.997309, -0.997288,
-    -0.997265, -0.997241, -0.997217, -0.997191, -0.997165, -0.997139,
-    -0.997113, -0.997087, -0.997061, -0.997035, -0.99701, -0.996986,
-    -0.996963, -0.996941, -0.996921, -0.996901, -0.996884, -0.996868,
-    -0.996854, -0.996842, -0.996832, -0.996825, -0.996819, -0.996816,
-    -0.996815, -0.996816, -0.996819, -0.996825, -0.996832, -0.996842,
-    -0.996854, -0.996868, -0.996884, -0.996901, -0.996921, -0.996941,
-    -0.996963, -0.996986, -0.99701, -0.997035, -0.997061, -0.997087,
-    -0.997113, -0.997139, -0.997165, -0.997191, -0.997217, -0.997241,
-    -0.997265, -0.997288, -0.997309, -0.997329, -0.997348, -0.997365,
-    -0.99738, -0.997393, -0.997404, -0.997413, -0.99742, -0.997425,
-    -0.997428, -0.997428, -0.997426, -0.997422, -0.997415, -0.997407,
-    -0.997396, -0.997383, -0.997368, -0.997352, -0.997333, -0.997313,
-    -0.997292, -0.997269, -0.997246, -0.997221, -0.997196, -0.99717,
-    -0.997143, -0.997117, -0.99709, -0.997063, -0.997037, -0.997012,
-    -0.996987, -0.996964, -0.996941, -0.99692, -0.9969, -0.996882,
-    -0.996865, -0.99685, -0.996838, -0.996827, -0.996819, -0.996812,
-    -0.996808, -0.996807, -0.996807, -0.99681, -0.996816, -0.996823,
-    -0.996833, -0.996844, -0.996858, -0.996874, -0.996892, -0.996911,
-    -0.996932, -0.996954, -0.996978, -0.997003, -0.997028, -0.997055,
-    -0.997081, -0.997109, -0.997136, -0.997163, -0.99719, -0.997217,
-    -0.997243, -0.997268, -0.997292, -0.997314, -0.997336, -0.997356,
-    -0.997374, -0.99739, -0.997404, -0.997417, -0.997427, -0.997435,
-    -0.99744, -0.997443, -0.997444, -0.997443, -0.997439, -0.997433,
-    -0.997424, -0.997413, -0.9974, -0.997385, -0.997368, -0.997349,
-    -0.997328, -0.997306, -0.997282, -0.997257, -0.997231, -0.997204,
-    -0.997177, -0.997149, -0.99712, -0.997092, -0.997064, -0.997036,
-    -0.997008, -0.996982, -0.996956, -0.996931, -0.996908, -0.996886,
-    -0.996866, -0.996848, -0.996832, -0.996818, -0.996806, -0.996796,
-    -0.996789, -0.996784, -0.996781, -0.996781, -0.996784, -0.996789,
-    -0.996796, -0.996806, -0.996818, -0.996833, -0.99685, -0.996868,
-    -0.996889, -0.996912, -0.996936, -0.996961, -0.996988, -0.997016,
-    -0.997044, -0.997074, -0.997103, -0.997133, -0.997163, -0.997193,
-    -0.997222, -0.997251, -0.997279, -0.997306, -0.997331, -0.997355,
-    -0.997378, -0.997398, -0.997417, -0.997433, -0.997448, -0.997459,
-    -0.997469, -0.997476, -0.99748, -0.997482, -0.997481, -0.997477,
-    -0.997471, -0.997462, -0.99745, -0.997436, -0.99742, -0.997401,
-    -0.99738, -0.997358, -0.997333, -0.997307, -0.997279, -0.99725,
-    -0.99722, -0.997189, -0.997157, -0.997125, -0.997093, -0.99706,
-    -0.997029, -0.996997, -0.996967, -0.996937, -0.996909, -0.996882,
-    -0.996857, -0.996833, -0.996812, -0.996792, -0.996775, -0.996761,
-    -0.996749, -0.99674, -0.996734, -0.99673, -0.996729, -0.996731,
-    -0.996736, -0.996744, -0.996755, -0.996768, -0.996785, -0.996803,
-    -0.996824, -0.996848, -0.996873, -0.996901, -0.99693, -0.996961,
-    -0.996993, -0.997026, -0.997061, -0.997095, -0.997131, -0.997166,
-    -0.997201, -0.997236, -0.99727, -0.997303, -0.997335, -0.997366,
-    -0.997395, -0.997422, -0.997447, -0.99747, -0.99749, -0.997508,
-    -0.997523, -0.997535, -0.997544, -0.99755, -0.997553, -0.997553,
-    -0.997549, -0.997542, -0.997533, -0.99752, -0.997504, -0.997485,
-    -0.997463, -0.997439, -0.997412, -0.997382, -0.997351, -0.997318,
-    -0.997283, -0.997247, -0.997209, -0.99717, -0.997131, -0.997092,
-    -0.997052, -0.997013, -0.996974, -0.996936, -0.996899, -0.996864,
-    -0.99683, -0.996798, -0.996768, -0.996741, -0.996716, -0.996694,
-    -0.996675, -0.996659, -0.996646, -0.996637, -0.996632, -0.996629,
-    -0.996631, -0.996636, -0.996645, -0.996657, -0.996673, -0.996692,
-    -0.996715, -0.996741, -0.99677, -0.996801, -0.996835, -0.996872,
-    -0.996911, -0.996952, -0.996994, -0.997037, -0.997082, -0.997127,
-    -0.997173, -0.997218, -0.997264, -0.997308, -0.997352, -0.997394,
-    -0.997435, -0.997473, -0.99751, -0.997544, -0.997575, -0.997603,
-    -0.997627, -0.997649, -0.997666, -0.99768, -0.997689, -0.997695,
-    -0.997696, -0.997693, -0.997686, -0.997674, -0.997658, -0.997639,
-    -0.997615, -0.997587, -0.997555, -0.99752, -0.997482, -0.99744,
-    -0.997396, -0.997349, -0.9973, -0.997249, -0.997197, -0.997143,
-    -0.997089, -0.997034, -0.996979, -0.996925, -0.996872, -0.996819,
-    -0.996769, -0.99672, -0.996674, -0.996631, -0.99659, -0.996553,
-    -0.99652, -0.996491, -0.996466, -0.996446, -0.996431, -0.99642,
-    -0.996415, -0.996414, -0.996419, -0.996429, -0.996445, -0.996465,
-    -0.996491, -0.996522, -0.996557, -0.996598, -0.996642, -0.996691,
-    -0.996744, -0.9968, -0.99686, -0.996922, -0.996987, -0.997053,
-    -0.997121, -0.99719, -0.99726, -0.99733, -0.997399, -0.997467,
-    -0.997533, -0.997598, -0.99766, -0.997719, -0.997775, -0.997826,
-    -0.997874, -0.997916, -0.997953, -0.997985, -0.998011, -0.99803,
-    -0.998044, -0.99805, -0.99805, -0.998043, -0.998029, -0.998008,
-    -0.997979, -0.997944, -0.997902, -0.997854, -0.997799, -0.997738,
-    -0.997671, -0.997599, -0.997522, -0.99744, -0.997354, -0.997265,
-    -0.997172, -0.997078, -0.996981, -0.996884, -0.996786, -0.996688,
-    -0.996591, -0.996496, -0.996404, -0.996315, -0.996229, -0.996148,
-    -0.996073, -0.996003, -0.99594, -0.995884, -0.995836, -0.995796,
-    -0.995765, -0.995744, -0.995732, -0.99573, -0.995738, -0.995757,
-    -0.995787, -0.995828, -0.995879, -0.995942, -0.996015, -0.996098,
-    -0.996192, -0.996296, -0.99641, -0.996533, -0.996664, -0.996803,
-    -0.99695, -0.997103, -0.997262, -0.997426, -0.997594, -0.997764,
-    -0.997937, -0.99811, -0.998284, -0.998455, -0.998625, -0.99879,
-    -0.99895, -0.999104, -0.99925, -0.999387, -0.999513, -0.999629,
-    -0.999731, -0.999818, -0.99989, -0.999946, -0.999983, -1,
-    -0.999997, -0.999971, -0.999922, -0.999848, -0.999747, -0.99962,
-    -0.999463, -0.999275, -0.999056, -0.998802, -0.998512, -0.998183,
-    -0.997813, -0.997399, -0.996936, -0.99642, -0.995845, -0.995203,
-    -0.994484, -0.993675, -0.992758, -0.991709, -0.990494, -0.989063,
-    -0.987342, -0.98521, -0.982473, -0.978773, -0.973404, -0.964729,
-    -0.947941, -0.900593
-};
-
-static const float WAVE_SQUARE_018[DEFAULT_WAVELEN] = {
-    6.66134e-16, 1, 0.7662, 0.904002, 0.806482, 0.881657,
-    0.820765, 0.871693, 0.828145, 0.865983, 0.832713, 0.862232,
-    0.83586, 0.859544, 0.838189, 0.857501, 0.840002, 0.855877,
-    0.841467, 0.854546, 0.842684, 0.853427, 0.843718, 0.852469,
-    0.84461, 0.851635, 0.84539, 0.850903, 0.846079, 0.850254,
-    0.846691, 0.849676, 0.847238, 0.849159, 0.847728, 0.848695,
-    0.848167, 0.848278, 0.848562, 0.847905, 0.848915, 0.847571,
-    0.84923, 0.847273, 0.849511, 0.84701, 0.849758, 0.846778,
-    0.849975, 0.846575, 0.850163, 0.846402, 0.850323, 0.846254,
-    0.850458, 0.846132, 0.850567, 0.846035, 0.850654, 0.84596,
-    0.850718, 0.845907, 0.85076, 0.845874, 0.850783, 0.845861,
-    0.850787, 0.845866, 0.850773, 0.845889, 0.850742, 0.845928,
-    0.850695, 0.845982, 0.850634, 0.846049, 0.85056, 0.84613,
-    0.850473, 0.846222, 0.850375, 0.846325, 0.850268, 0.846438,
-    0.850151, 0.846559, 0.850026, 0.846687, 0.849895, 0.846821,
-    0.849758, 0.84696, 0.849617, 0.847104, 0.849472, 0.84725,
-    0.849325, 0.847398, 0.849176, 0.847547, 0.849027, 0.847695,
-    0.848879, 0.847843, 0.848732, 0.847989, 0.848587, 0.848132,
-    0.848446, 0.848271, 0.848309, 0.848406, 0.848177, 0.848535,
-    0.84805, 0.848659, 0.847929, 0.848776, 0.847816, 0.848887,
-    0.847709, 0.848989, 0.84761, 0.849084, 0.84752, 0.84917,
-    0.847438, 0.849248, 0.847365, 0.849316, 0.847301, 0.849376,
-    0.847246, 0.849426, 0.847201, 0.849467, 0.847165, 0.849498,
-    0.847138, 0.84952, 0.847121, 0.849533, 0.847112, 0.849536,
-    0.847113, 0.849531, 0.847123, 0.849517, 0.847141, 0.849495,
-    0.847167, 0.849465, 0.847201, 0.849427, 0.847242, 0.849383,
-    0.84729, 0.849331, 0.847345, 0.849274, 0.847405, 0.849211,
-    0.847471, 0.849143, 0.847541, 0.84907, 0.847616, 0.848994,
-    0.847694, 0.848914, 0.847775, 0.848832, 0.847858, 0.848748,
-    0.847943, 0.848662, 0.848029, 0.848576, 0.848115, 0.84849,
-    0.848201, 0.848404, 0.848286, 0.84832, 0.84837, 0.848237,
-    0.848452, 0.848156, 0.848532, 0.848078, 0.848608, 0.848003,
-    0.848681, 0.847932, 0.84875, 0.847865, 0.848815, 0.847802,
-    0.848875, 0.847745, 0.84893, 0.847693, 0.84898, 0.847646,
-    0.849023, 0.847605, 0.849062, 0.84757, 0.849094, 0.847541,
-    0.84912, 0.847518, 0.84914, 0.847501, 0.849153, 0.847491,
-    0.84916, 0.847486, 0.849161, 0.847488, 0.849156, 0.847496,
-    0.849145, 0.84751, 0.849129, 0.84753, 0.849106, 0.847555,
-    0.849078, 0.847586, 0.849045, 0.847621, 0.849008, 0.847661,
-    0.848966, 0.847705, 0.848919, 0.847753, 0.848869, 0.847805,
-    0.848816, 0.84786, 0.84876, 0.847917, 0.848702, 0.847977,
-    0.848641, 0.848038, 0.848579, 0.848101, 0.848516, 0.848164,
-    0.848452, 0.848228, 0.848388, 0.848292, 0.848325, 0.848355,
-    0.848262, 0.848417, 0.8482, 0.848478, 0.848141, 0.848537,
-    0.848083, 0.848593, 0.848027, 0.848648, 0.847975, 0.848699,
-    0.847925, 0.848746, 0.847879, 0.848791, 0.847837, 0.848831,
-    0.847799, 0.848867, 0.847765, 0.848899, 0.847735, 0.848926,
-    0.84771, 0.848949, 0.84769, 0.848967, 0.847674, 0.848979,
-    0.847664, 0.848987, 0.847658, 0.848991, 0.847658, 0.848989,
-    0.847662, 0.848982, 0.847671, 0.848971, 0.847685, 0.848955,
-    0.847703, 0.848934, 0.847726, 0.848909, 0.847753, 0.848881,
-    0.847783, 0.848848, 0.847818, 0.848812, 0.847855, 0.848773,
-    0.847896, 0.84873, 0.84794, 0.848685, 0.847986, 0.848638,
-    0.848034, 0.848589, 0.848084, 0.848538, 0.848135, 0.848487,
-    0.848188, 0.848434, 0.84824, 0.848381, 0.848293, 0.848328,
-    0.848346, 0.848276, 0.848398, 0.848224, 0.84845, 0.848173,
-    0.8485, 0.848124, 0.848548, 0.848076, 0.848594, 0.848031,
-    0.848639, 0.847988, 0.84868, 0.847948, 0.848719, 0.847911,
-    0.848754, 0.847878, 0.848786, 0.847847, 0.848814, 0.847821,
-    0.848839, 0.847798, 0.84886, 0.847779, 0.848876, 0.847765,
-    0.848889, 0.847754, 0.848897, 0.847748, 0.848901, 0.847746,
-    0.848901, 0.847749, 0.848897, 0.847755, 0.848888, 0.847766,
-    0.848876, 0.84778, 0.848859, 0.847799, 0.848839, 0.847821,
-    0.848815, 0.847847, 0.848787, 0.847876, 0.848756, 0.847908,
-    0.848722, 0.847944, 0.848686, 0.847981, 0.848647, 0.848022,
-    0.848606, 0.848064, 0.848563, 0.848108, 0.848518, 0.848153,
-    0.848472, 0.848199, 0.848426, 0.848246, 0.848378, 0.848293,
-    0.848331, 0.848341, 0.848284, 0.848388, 0.848237, 0.848434,
-    0.848191, 0.84848, 0.848146, 0.848524, 0.848103, 0.848566,
-    0.848062, 0.848607, 0.848022, 0.848645, 0.847985, 0.848681,
-    0.847951, 0.848714, 0.847919, 0.848744, 0.847891, 0.848771,
-    0.847865, 0.848794, 0.847843, 0.848814, 0.847825, 0.84883,
-    0.847811, 0.848843, 0.8478, 0.848852, 0.847793, 0.848857,
-    0.84779, 0.848858, 0.847791, 0.848855, 0.847796, 0.848848,
-    0.847805, 0.848837, 0.847818, 0.848823, 0.847834, 0.848805,
-    0.847854, 0.848783, 0.847877, 0.848758, 0.847903, 0.84873,
-    0.847933, 0.8487, 0.847965, 0.848666, 0.848, 0.84863,
-    0.848037, 0.848592, 0.848076, 0.848552, 0.848117, 0.84851,
-    0.848159, 0.848467, 0.848203, 0.848423, 0.848247, 0.848379,
-    0.848292, 0.848334, 0.848337, 0.848289, 0.848382, 0.848244,
-    0.848426, 0.8482, 0.84847, 0.848157, 0.848512, 0.848115,
-    0.848553, 0.848075, 0.848592, 0.848037, 0.848629, 0.848001,
-    0.848664, 0.847967, 0.848697, 0.847936, 0.848727, 0.847908,
-    0.848753, 0.847882, 0.848777, 0.84786, 0.848797, 0.847842,
-    0.848814, 0.847827, 0.848827, 0.847816, 0.848837, 0.847808,
-    0.848842, 0.847804, 0.848844, 0.847804, 0.848842, 0.847808,
-    0.848837, 0.847816, 0.848827, 0.847827, 0.848814, 0.847842,
-    0.848797, 0.84786, 0.848777, 0.847882, 0.848753, 0.847908,
-    0.848727, 0.847936, 0.848697, 0.847967, 0.848664, 0.848001,
-    0.848629, 0.848037, 0.848592, 0.848075, 0.848553, 0.848115,
-    0.848512, 0.848157, 0.84847, 0.8482, 0.848426, 0.848244,
-    0.848382, 0.848289, 0.848337, 0.848334, 0.848292, 0.848379,
-    0.848247, 0.848423, 0.848203, 0.848467, 0.848159, 0.84851,
-    0.848117, 0.848552, 0.848076, 0.848592, 0.848037, 0.84863,
-    0.848, 0.848666, 0.847965, 0.8487, 0.847933, 0.84873,
-    0.847903, 0.848758, 0.847877, 0.848783, 0.847854, 0.848805,
-    0.847834, 0.848823, 0.847818, 0.848837, 0.847805, 0.848848,
-    0.847796, 0.848855, 0.847791, 0.848858, 0.84779, 0.848857,
-    0.847793, 0.848852, 0.8478, 0.848843, 0.847811, 0.84883,
-    0.847825, 0.848814, 0.847843, 0.848794, 0.847865, 0.848771,
-    0.847891, 0.848744, 0.847919, 0.848714, 0.847951, 0.848681,
-    0.847985, 0.848645, 0.848022, 0.848607, 0.848062, 0.848566,
-    0.848103, 0.848524, 0.848146, 0.84848, 0.848191, 0.848434,
-    0.848237, 0.848388, 0.848284, 0.848341, 0.848331, 0.848293,
-    0.848378, 0.848246, 0.848426, 0.848199, 0.848472, 0.848153,
-    0.848518, 0.848108, 0.848563, 0.848064, 0.848606, 0.848022,
-    0.848647, 0.847981, 0.848686, 0.847944, 0.848722, 0.847908,
-    0.848756, 0.847876, 0.848787, 0.847847, 0.848815, 0.847821,
-    0.848839, 0.847799, 0.848859, 0.84778, 0.848876, 0.847766,
-    0.848888, 0.847755, 0.848897, 0.847749, 0.848901, 0.847746,
-    0.848901, 0.847748, 0.848897, 0.847754, 0.848889, 0.847765,
-    0.848876, 0.847779, 0.84886, 0.847798, 0.848839, 0.847821,
-    0.848814, 0.847847, 0.848786, 0.847878, 0.848754, 0.847911,
-    0.848719, 0.847948, 0.84868, 0.847988, 0.848639, 0.848031,
-    0.848594, 0.848076, 0.848548, 0.848124, 0.8485, 0.848173,
-    0.84845, 0.848224, 0.848398, 0.848276, 0.848346, 0.848328,
-    0.848293, 0.848381, 0.84824, 0.848434, 0.848188, 0.848487,
-    0.848135, 0.848538, 0.848084, 0.848589, 0.848034, 0.848638,
-    0.847986, 0.848685, 0.84794, 0.84873, 0.847896, 0.848773,
-    0.847855, 0.848812, 0.847818, 0.848848, 0.847783, 0.848881,
-    0.847753, 0.848909, 0.847726, 0.848934, 0.847703, 0.848955,
-    0.847685, 0.848971, 0.847671, 0.848982, 0.847662, 0.848989,
-    0.847658, 0.848991, 0.847658, 0.848987, 0.847664, 0.848979,
-    0.847674, 0.848967, 0.84769, 0.848949, 0.84771, 0.848926,
-    0.847735, 0.848899, 0.847765, 0.848867, 0.847799, 0.848831,
-    0.847837, 0.848791, 0.847879, 0.848746, 0.847925, 0.848699,
-    0.847975, 0.848648, 0.848027, 0.848593, 0.848083, 0.848537,
-    0.848141, 0.848478, 0.8482, 0.848417, 0.848262, 0.848355,
-    0.848325, 0.848292, 0.848388, 0.848228, 0.848452, 0.848164,
-    0.848516, 0.848101, 0.848579, 0.848038, 0.848641, 0.847977,
-    0.848702, 0.847917, 0.84876, 0.84786, 0.848816, 0.847805,
-    0.848869, 0.847753, 0.848919, 0.847705, 0.848966, 0.847661,
-    0.849008, 0.847621, 0.849045, 0.847586, 0.849078, 0.847555,
-    0.849106, 0.84753, 0.849129, 0.84751, 0.849145, 0.847496,
-    0.849156, 0.847488, 0.849161, 0.847486, 0.84916, 0.847491,
-    0.849153, 0.847501, 0.84914, 0.847518, 0.84912, 0.847541,
-    0.849094, 0.84757, 0.849062, 0.847605, 0.849023, 0.847646,
-    0.84898, 0.847693, 0.84893, 0.847745, 0.848875, 0.847802,
-    0.848815, 0.847865, 0.84875, 0.847932, 0.848681, 0.848003,
-    0.848608, 0.848078, 0.848532, 0.848156, 0.848452, 0.848237,
-    0.84837, 0.84832, 0.848286, 0.848404, 0.848201, 0.84849,
-    0.848115, 0.848576, 0.848029, 0.848662, 0.847943, 0.848748,
-    0.847858, 0.848832, 0.847775, 0.848914, 0.847694, 0.848994,
-    0.847616, 0.84907, 0.847541, 0.849143, 0.847471, 0.849211,
-    0.847405, 0.849274, 0.847345, 0.849331, 0.84729, 0.849383,
-    0.847242, 0.849427, 0.847201, 0.849465, 0.847167, 0.849495,
-    0.847141, 0.849517, 0.847123, 0.849531, 0.847113, 0.849536,
-    0.847112, 0.849533, 0.847121, 0.84952, 0.847138, 0.849498,
-    0.847165, 0.849467, 0.847201, 0.849426, 0.847246, 0.849376,
-    0.847301, 0.849316, 0.847365, 0.849248, 0.847438, 0.84917,
-    0.84752, 0.849084, 0.84761, 0.848989, 0.847709, 0.848887,
-    0.847816, 0.848776, 0.847929, 0.848659, 0.84805, 0.848535,
-    0.848177, 0.848406, 0.848309, 0.848271, 0.848446, 0.848132,
-    0.848587, 0.847989, 0.848732, 0.847843, 0.848879, 0.847695,
-    0.849027, 0.847547, 0.849176, 0.847398, 0.849325, 0.84725,
-    0.849472, 0.847104, 0.849617, 0.84696, 0.849758, 0.846821,
-    0.849895, 0.846687, 0.850026, 0.846559, 0.850151, 0.846438,
-    0.850268, 0.846325, 0.850375, 0.846222, 0.850473, 0.84613,
-    0.85056, 0.846049, 0.850634, 0.845982, 0.850695, 0.845928,
-    0.850742, 0.845889, 0.850773, 0.845866, 0.850787, 0.845861,
-    0.850783, 0.845874, 0.85076, 0.845907, 0.850718, 0.84596,
-    0.850654, 0.846035, 0.850567, 0.846132, 0.850458, 0.846254,
-    0.850323, 0.846402, 0.850163, 0.846575, 0.849975, 0.846778,
-    0.849758, 0.84701, 0.849511, 0.847273, 0.84923, 0.847571,
-    0.848915, 0.847905, 0.848562, 0.848278, 0.848167, 0.848695,
-    0.847728, 0.849159, 0.847238, 0.849676, 0.846691, 0.850254,
-    0.846079, 0.850903, 0.84539, 0.851635, 0.84461, 0.852469,
-    0.843718, 0.853427, 0.842684, 0.854546, 0.841467, 0.855877,
-    0.840002, 0.857501, 0.838189, 0.859544, 0.83586, 0.862232,
-    0.832713, 0.865983, 0.828145, 0.871693, 0.820765, 0.881657,
-    0.806482, 0.904002, 0.7662, 1, 6.99441e-14, -1,
-    -0.7662, -0.904002, -0.806482, -0.881657, -0.820765, -0.871693,
-    -0.828145, -0.865983, -0.832713, -0.862232, -0.83586, -0.859544,
-    -0.838189, -0.857501, -0.840002, -0.855877, -0.841467, -0.854546,
-    -0.842684, -0.853427, -0.843718, -0.852469, -0.84461, -0.851635,
-    -0.84539, -0.850903, -0.846079, -0.850254, -0.846691, -0.849676,
-    -0.847238, -0.849159, -0.847728, -0.848695, -0.848167, -0.848278,
-    -0.848562, -0.847905, -0.848915, -0.847571, -0.84923, -0.847273,
-    -0.849511, -0.84701, -0.849758, -0.846778, -0.849975, -0.846575,
-    -0.850163, -0.846402, -0.850323, -0.846254, -0.850458, -0.846132,
-    -0.850567, -0.846035, -0.850654, -0.84596, -0.850718, -0.845907,
-    -0.85076, -0.845874, -0.850783, -0.845861, -0.850787, -0.845866,
-    -0.850773, -0.845889, -0.850742, -0.845928, -0.850695, -0.845982,
-    -0.850634, -0.846049, -0.85056, -0.84613, -0.850473, -0.846222,
-    -0.850375, -0.846325, -0.850268, -0.846438, -0.850151, -0.846559,
-    -0.850026, -0.846687, -0.849895, -0.846821, -0.849758, -0.84696,
-    -0.849617, -0.847104, -0.849472, -0.84725, -0.849325, -0.847398,
-    -0.849176, -0.847547, -0.849027, -0.847695, -0.848879, -0.847843,
-    -0.848732, -0.847989, -0.848587, -0.848132, -0.848446, -0.848271,
-    -0.848309, -0.848406, -0.848177, -0.848535, -0.84805, -0.848659,
-    -0.847929, -0.848776, -0.847816, -0.848887, -0.847709, -0.848989,
-    -0.84761, -0.849084, -0.84752, -0.84917, -0.847438, -0.849248,
-    -0.847365, -0.849316, -0.847301, -0.849376, -0.847246, -0.849426,
-    -0.847201, -0.849467, -0.847165, -0.849498, -0.847138, -0.84952,
-    -0.847121, -0.849533, -0.847112, -0.849536, -0.847113, -0.849531,
-    -0.847123, -0.849517, -0.847141, -0.849495, -0.847167, -0.849465,
-    -0.847201, -0.849427, -0.847242, -0.849383, -0.84729, -0.849331,
-    -0.847345, -0.849274, -0.847405, -0.849211, -0.847471, -0.849143,
-    -0.847541, -0.84907, -0.847616, -0.848994, -0.847694, -0.848914,
-    -0.847775, -0.848832, -0.847858, -0.848748, -0.847943, -0.848662,
-    -0.848029, -0.848576, -0.848115, -0.84849, -0.848201, -0.848404,
-    -0.848286, -0.84832, -0.84837, -0.848237, -0.848452, -0.848156,
-    -0.848532, -0.848078, -0.848608, -0.848003, -0.848681, -0.847932,
-    -0.84875, -0.847865, -0.848815, -0.847802, -0.848875, -0.847745,
-    -0.84893, -0.847693, -0.84898, -0.847646, -0.849023, -0.847605,
-    -0.849062, -0.84757, -0.849094, -0.847541, -0.84912, -0.847518,
-    -0.84914, -0.847501, -0.849153, -0.847491, -0.84916, -0.847486,
-    -0.849161, -0.847488, -0.849156, -0.847496, -0.849145, -0.84751,
-    -0.849129, -0.84753, -0.849106, -0.847555, -0.849078, -0.847586,
-    -0.849045, -0.847621, -0.849008, -0.847661, -0.848966, -0.847705,
-    -0.848919, -0.847753, -0.848869, -0.847805, -0.848816, -0.84786,
-    -0.84876, -0.847917, -0.848702, -0.847977, -0.848641, -0.848038,
-    -0.848579, -0.848101, -0.848516, -0.848164, -0.848452, -0.848228,
-    -0.848388, -0.848292, -0.848325, -0.848355, -0.848262, -0.848417,
-    -0.8482, -0.848478, -0.848141, -0.848537, -0.848083, -0.848593,
-    -0.848027, -0.848648, -0.847975, -0.848699, -0.847925, -0.848746,
-    -0.847879, -0.848791, -0.847837, -0.848831, -0.847799, -0.848867,
-    -0.847765, -0.848899, -0.847735, -0.848926, -0.84771, -0.848949,
-    -0.84769, -0.848967, -0.847674, -0.848979, -0.847664, -0.848987,
-    -0.847658, -0.848991, -0.847658, -0.848989, -0.847662, -0.848982,
-    -0.847671, -0.848971, -0.847685, -0.848955, -0.847703, -0.848934,
-    -0.847726, -0.848909, -0.847753, -0.848881, -0.847783, -0.848848,
-    -0.847818, -0.848812, -0.847855, -0.848773, -0.847896, -0.84873,
-    -0.84794, -0.848685, -0.847986, -0.848638, -0.848034, -0.848589,
-    -0.848084, -0.848538, -0.848135, -0.848487, -0.848188, -0.848434,
-    -0.84824, -0.848381, -0.848293, -0.848328, -0.848346, -0.848276,
-    -0.848398, -0.848224, -0.84845, -0.848173, -0.8485, -0.848124,
-    -0.848548, -0.848076, -0.848594, -0.848031, -0.848639, -0.847988,
-    -0.84868, -0.847948, -0.848719, -0.847911, -0.848754, -0.847878,
-    -0.848786, -0.847847, -0.848814, -0.847821, -0.848839, -0.847798,
-    -0.84886, -0.847779, -0.848876, -0.847765, -0.848889, -0.847754,
-    -0.848897, -0.847748, -0.848901, -0.847746, -0.848901, -0.847749,
-    -0.848897, -0.847755, -0.848888, -0.847766, -0.848876, -0.84778,
-    -0.848859, -0.847799, -0.848839, -0.847821, -0.848815, -0.847847,
-    -0.848787, -0.847876, -0.848756, -0.847908, -0.848722, -0.847944,
-    -0.848686, -0.847981, -0.848647, -0.848022, -0.848606, -0.848064,
-    -0.848563, -0.848108, -0.848518, -0.848153, -0.848472, -0.848199,
-    -0.848426, -0.848246, -0.848378, -0.848293, -0.848331, -0.848341,
-    -0.848284, -0.848388, -0.848237, -0.848434, -0.848191, -0.84848,
-    -0.848146, -0.848524, -0.848103, -0.848566, -0.848062, -0.848607,
-    -0.848022, -0.848645, -0.847985, -0.848681, -0.847951, -0.848714,
-    -0.847919, -0.848744, -0.847891, -0.848771, -0.847865, -0.848794,
-    -0.847843, -0.848814, -0.847825, -0.84883, -0.847811, -0.848843,
-    -0.8478, -0.848852, -0.847793, -0.848857, -0.84779, -0.848858,
-    -0.847791, -0.848855, -0.847796, -0.848848, -0.847805, -0.848837,
-    -0.847818, -0.848823, -0.847834, -0.848805, -0.847854, -0.848783,
-    -0.847877, -0.848758, -0.847903, -0.84873, -0.847933, -0.8487,
-    -0.847965, -0.848666, -0.848, -0.84863, -0.848037, -0.848592,
-    -0.848076, -0.848552, -0.848117, -0.84851, -0.848159, -0.848467,
-    -0.848203, -0.848423, -0.848247, -0.848379, -0.848292, -0.848334,
-    -0.848337, -0.848289, -0.848382, -0.848244, -0.848426, -0.8482,
-    -0.84847, -0.848157, -0.848512, -0.848115, -0.848553, -0.848075,
-    -0.848592, -0.848037, -0.848629, -0.848001, -0.848664, -0.847967,
-    -0.848697, -0.847936, -0.848727, -0.847908, -0.848753, -0.847882,
-    -0.848777, -0.84786, -0.848797, -0.847842, -0.848814, -0.847827,
-    -0.848827, -0.847816, -0.848837, -0.847808, -0.848842, -0.847804,
-    -0.848844, -0.847804, -0.848842, -0.847808, -0.848837, -0.847816,
-    -0.848827, -0.847827, -0.848814, -0.847842, -0.848797, -0.84786,
-    -0.848777, -0.847882, -0.848753, -0.847908, -0.848727, -0.847936,
-    -0.848697, -0.847967, -0.848664, -0.848001, -0.848629, -0.848037,
-    -0.848592, -0.848075, -0.848553, -0.848115, -0.848512, -0.848157,
-    -0.84847, -0.8482, -0.848426, -0.848244, -0.848382, -0.848289,
-    -0.848337, -0.848334, -0.848292, -0.848379, -0.848247, -0.848423,
-    -0.848203, -0.848467, -0.848159, -0.84851, -0.848117, -0.848552,
-    -0.848076, -0.848592, -0.848037, -0.84863, -0.848, -0.848666,
-    -0.847965, -0.8487, -0.847933, -0.84873, -0.847903, -0.848758,
-    -0.847877, -0.848783, -0.847854, -0.848805, -0.847834, -0.848823,
-    -0.847818, -0.848837, -0.847805, -0.848848, -0.847796, -0.848855,
-    -0.847791, -0.848858, -0.84779, -0.848857, -0.847793, -0.848852,
-    -0.8478, -0.848843, -0.847811, -0.84883, -0.847825, -0.848814,
-    -0.847843, -0.848794, -0.847865, -0.848771, -0.847891, -0.848744,
-    -0.847919, -0.848714, -0.847951, -0.848681, -0.847985, -0.848645,
-    -0.848022, -0.848607, -0.848062, -0.848566, -0.848103, -0.848524,
-    -0.848146, -0.84848, -0.848191, -0.848434, -0.848237, -0.848388,
-    -0.848284, -0.848341, -0.848331, -0.848293, -0.848378, -0.848246,
-    -0.848426, -0.848199, -0.848472, -0.848153, -0.848518, -0.848108,
-    -0.848563, -0.848064, -0.848606, -0.848022, -0.848647, -0.847981,
-    -0.848686, -0.847944, -0.848722, -0.847908, -0.848756, -0.847876,
-    -0.848787, -0.847847, -0.848815, -0.847821, -0.848839, -0.847799,
-    -0.848859, -0.84778, -0.848876, -0.847766, -0.848888, -0.847755,
-    -0.848897, -0.847749, -0.848901, -0.847746, -0.848901, -0.847748,
-    -0.848897, -0.847754, -0.848889, -0.847765, -0.848876, -0.847779,
-    -0.84886, -0.847798, -0.848839, -0.847821, -0.848814, -0.847847,
-    -0.848786, -0.847878, -0.848754, -0.847911, -0.848719, -0.847948,
-    -0.84868, -0.847988, -0.848639, -0.848031, -0.848594, -0.848076,
-    -0.848548, -0.848124, -0.8485, -0.848173, -0.84845, -0.848224,
-    -0.848398, -0.848276, -0.848346, -0.848328, -0.848293, -0.848381,
-    -0.84824, -0.848434, -0.848188, -0.848487, -0.848135, -0.848538,
-    -0.848084, -0.848589, -0.848034, -0.848638, -0.847986, -0.848685,
-    -0.84794, -0.84873, -0.847896, -0.848773, -0.847855, -0.848812,
-    -0.847818, -0.848848, -0.847783, -0.848881, -0.847753, -0.848909,
-    -0.847726, -0.848934, -0.847703, -0.848955, -0.847685, -0.848971,
-    -0.847671, -0.848982, -0.847662, -0.848989, -0.847658, -0.848991,
-    -0.847658, -0.848987, -0.847664, -0.848979, -0.847674, -0.848967,
-    -0.84769, -0.848949, -0.84771, -0.848926, -0.847735, -0.848899,
-    -0.847765, -0.848867, -0.847799, -0.848831, -0.847837, -0.848791,
-    -0.847879, -0.848746, -0.847925, -0.848699, -0.847975, -0.848648,
-    -0.848027, -0.848593, -0.848083, -0.848537, -0.848141, -0.848478,
-    -0.8482, -0.848417, -0.848262, -0.848355, -0.848325, -0.848292,
-    -0.848388, -0.848228, -0.848452, -0.848164, -0.848516, -0.848101,
-    -0.848579, -0.848038, -0.848641, -0.847977, -0.848702, -0.847917,
-    -0.84876, -0.84786, -0.848816, -0.847805, -0.848869, -0.847753,
-    -0.848919, -0.847705, -0.848966, -0.847661, -0.849008, -0.847621,
-    -0.849045, -0.847586, -0.849078, -0.847555, -0.849106, -0.84753,
-    -0.849129, -0.84751, -0.849145, -0.847496, -0.849156, -0.847488,
-    -0.849161, -0.847486, -0.84916, -0.847491, -0.849153, -0.847501,
-    -0.84914, -0.847518, -0.84912, -0.847541, -0.849094, -0.84757,
-    -0.849062, -0.847605, -0.849023, -0.847646, -0.84898, -0.847693,
-    -0.84893, -0.847745, -0.848875, -0.847802, -0.848815, -0.847865,
-    -0.84875, -0.847932, -0.848681, -0.848003, -0.848608, -0.848078,
-    -0.848532, -0.848156, -0.848452, -0.848237, -0.84837, -0.84832,
-    -0.848286, -0.848404, -0.848201, -0.84849, -0.848115, -0.848576,
-    -0.848029, -0.848662, -0.847943, -0.848748, -0.847858, -0.848832,
-    -0.847775, -0.848914, -0.847694, -0.848994, -0.847616, -0.84907,
-    -0.847541, -0.849143, -0.847471, -0.849211, -0.847405, -0.849274,
-    -0.847345, -0.849331, -0.84729, -0.849383, -0.847242, -0.849427,
-    -0.847201, -0.849465, -0.847167, -0.849495, -0.847141, -0.849517,
-    -0.847123, -0.849531, -0.847113, -0.849536, -0.847112, -0.849533,
-    -0.847121, -0.84952, -0.847138, -0.849498, -0.847165, -0.849467,
-    -0.847201, -0.849426, -0.847246, -0.849376, -0.847301, -0.849316,
-    -0.847365, -0.849248, -0.847438, -0.84917, -0.84752, -0.849084,
-    -0.84761, -0.848989, -0.847709, -0.848887, -0.847816, -0.848776,
-    -0.847929, -0.848659, -0.84805, -0.848535, -0.848177, -0.848406,
-    -0.848309, -0.848271, -0.848446, -0.848132, -0.848587, -0.847989,
-    -0.848732, -0.847843, -0.848879, -0.847695, -0.849027, -0.847547,
-    -0.849176, -0.847398, -0.849325, -0.84725, -0.849472, -0.847104,
-    -0.849617, -0.84696, -0.849758, -0.846821, -0.849895, -0.846687,
-    -0.850026, -0.846559, -0.850151, -0.846438, -0.850268, -0.846325,
-    -0.850375, -0.846222, -0.850473, -0.84613, -0.85056, -0.846049,
-    -0.850634, -0.845982, -0.850695, -0.845928, -0.850742, -0.845889,
-    -0.850773, -0.845866, -0.850787, -0.845861, -0.850783, -0.845874,
-    -0.85076, -0.845907, -0.850718, -0.84596, -0.850654, -0.846035,
-    -0.850567, -0.846132, -0.850458, -0.846254, -0.850323, -0.846402,
-    -0.850163, -0.846575, -0.849975, -0.846778, -0.849758, -0.84701,
-    -0.849511, -0.847273, -0.84923, -0.847571, -0.848915, -0.847905,
-    -0.848562, -0.848278, -0.848167, -0.848695, -0.847728, -0.849159,
-    -0.847238, -0.849676, -0.846691, -0.850254, -0.846079, -0.850903,
-    -0.84539, -0.851635, -0.84461, -0.852469, -0.843718, -0.853427,
-    -0.842684, -0.854546, -0.841467, -0.855877, -0.840002, -0.857501,
-    -0.838189, -0.859544, -0.83586, -0.862232, -0.832713, -0.865983,
-    -0.828145, -0.871693, -0.820765, -0.881657, -0.806482, -0.904002,
-    -0.7662, -1
-};
-
-static const float WAVE_SQUARE_030[DEFAULT_WAVELEN] = {
-    -3.33067e-16, 0.746554, 1, 0.862292, 0.766083, 0.84649,
-    0.90409, 0.846286, 0.80628, 0.851925, 0.88183, 0.843812,
-    0.820479, 0.853245, 0.871948, 0.843036, 0.827778, 0.85373,
-    0.866319, 0.842722, 0.832266, 0.853936, 0.862646, 0.842589,
-    0.835336, 0.854018, 0.860033, 0.842544, 0.837592, 0.854035,
-    0.858061, 0.842549, 0.839336, 0.854011, 0.856505, 0.842588,
-    0.840735, 0.853959, 0.855237, 0.842651, 0.841891, 0.853886,
-    0.854177, 0.842733, 0.842869, 0.853797, 0.853271, 0.84283,
-    0.843711, 0.853693, 0.852486, 0.84294, 0.844446, 0.853577,
-    0.851796, 0.843062, 0.845096, 0.85345, 0.851183, 0.843194,
-    0.845675, 0.853313, 0.850634, 0.843335, 0.846196, 0.853167,
-    0.85014, 0.843485, 0.846666, 0.853013, 0.849692, 0.843643,
-    0.847092, 0.852852, 0.849285, 0.843807, 0.847481, 0.852684,
-    0.848914, 0.843978, 0.847835, 0.85251, 0.848576, 0.844155,
-    0.848158, 0.852331, 0.848268, 0.844337, 0.848453, 0.852147,
-    0.847986, 0.844523, 0.848722, 0.851958, 0.847729, 0.844713,
-    0.848966, 0.851766, 0.847496, 0.844907, 0.849189, 0.851572,
-    0.847285, 0.845103, 0.849389, 0.851374, 0.847094, 0.845301,
-    0.84957, 0.851175, 0.846923, 0.845501, 0.849732, 0.850975,
-    0.84677, 0.845702, 0.849876, 0.850774, 0.846635, 0.845903,
-    0.850002, 0.850573, 0.846517, 0.846103, 0.850112, 0.850373,
-    0.846416, 0.846303, 0.850205, 0.850174, 0.84633, 0.846502,
-    0.850284, 0.849976, 0.846259, 0.846698, 0.850348, 0.849781,
-    0.846202, 0.846892, 0.850398, 0.849589, 0.846159, 0.847083,
-    0.850434, 0.849399, 0.846129, 0.84727, 0.850457, 0.849214,
-    0.846112, 0.847453, 0.850468, 0.849033, 0.846107, 0.847632,
-    0.850468, 0.848856, 0.846113, 0.847806, 0.850456, 0.848685,
-    0.846131, 0.847975, 0.850433, 0.848519, 0.846158, 0.848137,
-    0.8504, 0.84836, 0.846196, 0.848294, 0.850358, 0.848206,
-    0.846243, 0.848444, 0.850307, 0.84806, 0.846298, 0.848587,
-    0.850247, 0.84792, 0.846362, 0.848723, 0.85018, 0.847788,
-    0.846433, 0.848852, 0.850105, 0.847663, 0.846511, 0.848972,
-    0.850024, 0.847547, 0.846595, 0.849085, 0.849936, 0.847438,
-    0.846686, 0.84919, 0.849844, 0.847337, 0.846781, 0.849286,
-    0.849746, 0.847245, 0.846881, 0.849374, 0.849644, 0.847161,
-    0.846985, 0.849454, 0.849538, 0.847086, 0.847092, 0.849525,
-    0.849429, 0.84702, 0.847202, 0.849587, 0.849318, 0.846962,
-    0.847315, 0.84964, 0.849204, 0.846912, 0.847429, 0.849685,
-    0.849089, 0.846872, 0.847545, 0.849722, 0.848974, 0.84684,
-    0.84766, 0.84975, 0.848858, 0.846816, 0.847776, 0.849769,
-    0.848742, 0.8468, 0.847892, 0.84978, 0.848627, 0.846793,
-    0.848007, 0.849784, 0.848513, 0.846794, 0.84812, 0.849779,
-    0.848401, 0.846802, 0.848231, 0.849767, 0.848291, 0.846818,
-    0.848339, 0.849747, 0.848184, 0.846842, 0.848445, 0.84972,
-    0.84808, 0.846872, 0.848548, 0.849687, 0.847979, 0.846909,
-    0.848646, 0.849646, 0.847882, 0.846952, 0.848741, 0.8496,
-    0.84779, 0.847002, 0.848831, 0.849548, 0.847702, 0.847057,
-    0.848917, 0.84949, 0.847618, 0.847117, 0.848997, 0.849427,
-    0.847541, 0.847182, 0.849073, 0.84936, 0.847468, 0.847252,
-    0.849142, 0.849288, 0.847402, 0.847326, 0.849206, 0.849212,
-    0.847341, 0.847403, 0.849264, 0.849133, 0.847286, 0.847484,
-    0.849315, 0.849051, 0.847237, 0.847567, 0.849361, 0.848967,
-    0.847195, 0.847653, 0.8494, 0.84888, 0.84716, 0.84774,
-    0.849432, 0.848792, 0.84713, 0.847829, 0.849458, 0.848702,
-    0.847108, 0.847919, 0.849478, 0.848612, 0.847091, 0.848009,
-    0.84949, 0.848522, 0.847082, 0.8481, 0.849497, 0.848431,
-    0.847079, 0.84819, 0.849497, 0.848341, 0.847082, 0.848279,
-    0.84949, 0.848253, 0.847091, 0.848368, 0.849478, 0.848165,
-    0.847107, 0.848454, 0.849459, 0.84808, 0.847128, 0.848538,
-    0.849435, 0.847996, 0.847156, 0.848621, 0.849405, 0.847916,
-    0.847189, 0.8487, 0.849369, 0.847838, 0.847227, 0.848776,
-    0.849328, 0.847763, 0.847271, 0.848849, 0.849282, 0.847693,
-    0.847319, 0.848918, 0.849232, 0.847626, 0.847372, 0.848982,
-    0.849177, 0.847563, 0.847429, 0.849043, 0.849118, 0.847505,
-    0.84749, 0.849099, 0.849055, 0.847451, 0.847554, 0.84915,
-    0.848989, 0.847402, 0.847622, 0.849196, 0.848919, 0.847359,
-    0.847692, 0.849237, 0.848848, 0.847321, 0.847765, 0.849273,
-    0.848773, 0.847288, 0.847841, 0.849303, 0.848697, 0.847261,
-    0.847918, 0.849327, 0.84862, 0.847239, 0.847996, 0.849346,
-    0.848541, 0.847223, 0.848075, 0.849359, 0.848461, 0.847213,
-    0.848155, 0.849367, 0.848382, 0.847208, 0.848234, 0.849368,
-    0.848302, 0.847209, 0.848314, 0.849364, 0.848223, 0.847216,
-    0.848393, 0.849355, 0.848144, 0.847228, 0.848471, 0.84934,
-    0.848067, 0.847246, 0.848547, 0.849319, 0.847991, 0.847269,
-    0.848622, 0.849293, 0.847918, 0.847298, 0.848695, 0.849262,
-    0.847846, 0.847332, 0.848765, 0.849226, 0.847778, 0.84737,
-    0.848832, 0.849185, 0.847712, 0.847413, 0.848896, 0.84914,
-    0.84765, 0.847461, 0.848957, 0.84909, 0.847591, 0.847512,
-    0.849013, 0.849037, 0.847536, 0.847568, 0.849066, 0.848979,
-    0.847485, 0.847627, 0.849115, 0.848918, 0.847439, 0.84769,
-    0.849159, 0.848854, 0.847397, 0.847755, 0.849199, 0.848787,
-    0.84736, 0.847824, 0.849233, 0.848718, 0.847328, 0.847894,
-    0.849263, 0.848646, 0.847301, 0.847967, 0.849287, 0.848573,
-    0.847279, 0.848041, 0.849306, 0.848498, 0.847263, 0.848116,
-    0.84932, 0.848422, 0.847252, 0.848192, 0.849328, 0.848346,
-    0.847246, 0.848269, 0.849331, 0.848269, 0.847246, 0.848346,
-    0.849328, 0.848192, 0.847252, 0.848422, 0.84932, 0.848116,
-    0.847263, 0.848498, 0.849306, 0.848041, 0.847279, 0.848573,
-    0.849287, 0.847967, 0.847301, 0.848646, 0.849263, 0.847894,
-    0.847328, 0.848718, 0.849233, 0.847824, 0.84736, 0.848787,
-    0.849199, 0.847755, 0.847397, 0.848854, 0.849159, 0.84769,
-    0.847439, 0.848918, 0.849115, 0.847627, 0.847485, 0.848979,
-    0.849066, 0.847568, 0.847536, 0.849037, 0.849013, 0.847512,
-    0.847591, 0.84909, 0.848957, 0.847461, 0.84765, 0.84914,
-    0.848896, 0.847413, 0.847712, 0.849185, 0.848832, 0.84737,
-    0.847778, 0.849226, 0.848765, 0.847332, 0.847846, 0.849262,
-    0.848695, 0.847298, 0.847918, 0.849293, 0.848622, 0.847269,
-    0.847991, 0.849319, 0.848547, 0.847246, 0.848067, 0.84934,
-    0.848471, 0.847228, 0.848144, 0.849355, 0.848393, 0.847216,
-    0.848223, 0.849364, 0.848314, 0.847209, 0.848302, 0.849368,
-    0.848234, 0.847208, 0.848382, 0.849367, 0.848155, 0.847213,
-    0.848461, 0.849359, 0.848075, 0.847223, 0.848541, 0.849346,
-    0.847996, 0.847239, 0.84862, 0.849327, 0.847918, 0.847261,
-    0.848697, 0.849303, 0.847841, 0.847288, 0.848773, 0.849273,
-    0.847765, 0.847321, 0.848848, 0.849237, 0.847692, 0.847359,
-    0.848919, 0.849196, 0.847622, 0.847402, 0.848989, 0.84915,
-    0.847554, 0.847451, 0.849055, 0.849099, 0.84749, 0.847505,
-    0.849118, 0.849043, 0.847429, 0.847563, 0.849177, 0.848982,
-    0.847372, 0.847626, 0.849232, 0.848918, 0.847319, 0.847693,
-    0.849282, 0.848849, 0.847271, 0.847763, 0.849328, 0.848776,
-    0.847227, 0.847838, 0.849369, 0.8487, 0.847189, 0.847916,
-    0.849405, 0.848621, 0.847156, 0.847996, 0.849435, 0.848538,
-    0.847128, 0.84808, 0.849459, 0.848454, 0.847107, 0.848165,
-    0.849478, 0.848368, 0.847091, 0.848253, 0.84949, 0.848279,
-    0.847082, 0.848341, 0.849497, 0.84819, 0.847079, 0.848431,
-    0.849497, 0.8481, 0.847082, 0.848522, 0.84949, 0.848009,
-    0.847091, 0.848612, 0.849478, 0.847919, 0.847108, 0.848702,
-    0.849458, 0.847829, 0.84713, 0.848792, 0.849432, 0.84774,
-    0.84716, 0.84888, 0.8494, 0.847653, 0.847195, 0.848967,
-    0.849361, 0.847567, 0.847237, 0.849051, 0.849315, 0.847484,
-    0.847286, 0.849133, 0.849264, 0.847403, 0.847341, 0.849212,
-    0.849206, 0.847326, 0.847402, 0.849288, 0.849142, 0.847252,
-    0.847468, 0.84936, 0.849073, 0.847182, 0.847541, 0.849427,
-    0.848997, 0.847117, 0.847618, 0.84949, 0.848917, 0.847057,
-    0.847702, 0.849548, 0.848831, 0.847002, 0.84779, 0.8496,
-    0.848741, 0.846952, 0.847882, 0.849646, 0.848646, 0.846909,
-    0.847979, 0.849687, 0.848548, 0.846872, 0.84808, 0.84972,
-    0.848445, 0.846842, 0.848184, 0.849747, 0.848339, 0.846818,
-    0.848291, 0.849767, 0.848231, 0.846802, 0.848401, 0.849779,
-    0.84812, 0.846794, 0.848513, 0.849784, 0.848007, 0.846793,
-    0.848627, 0.84978, 0.847892, 0.8468, 0.848742, 0.849769,
-    0.847776, 0.846816, 0.848858, 0.84975, 0.84766, 0.84684,
-    0.848974, 0.849722, 0.847545, 0.846872, 0.849089, 0.849685,
-    0.847429, 0.846912, 0.849204, 0.84964, 0.847315, 0.846962,
-    0.849318, 0.849587, 0.847202, 0.84702, 0.849429, 0.849525,
-    0.847092, 0.847086, 0.849538, 0.849454, 0.846985, 0.847161,
-    0.849644, 0.849374, 0.846881, 0.847245, 0.849746, 0.849286,
-    0.846781, 0.847337, 0.849844, 0.84919, 0.846686, 0.847438,
-    0.849936, 0.849085, 0.846595, 0.847547, 0.850024, 0.848972,
-    0.846511, 0.847663, 0.850105, 0.848852, 0.846433, 0.847788,
-    0.85018, 0.848723, 0.846362, 0.84792, 0.850247, 0.848587,
-    0.846298, 0.84806, 0.850307, 0.848444, 0.846243, 0.848206,
-    0.850358, 0.848294, 0.846196, 0.84836, 0.8504, 0.848137,
-    0.846158, 0.848519, 0.850433, 0.847975, 0.846131, 0.848685,
-    0.850456, 0.847806, 0.846113, 0.848856, 0.850468, 0.847632,
-    0.846107, 0.849033, 0.850468, 0.847453, 0.846112, 0.849214,
-    0.850457, 0.84727, 0.846129, 0.849399, 0.850434, 0.847083,
-    0.846159, 0.849589, 0.850398, 0.846892, 0.846202, 0.849781,
-    0.850348, 0.846698, 0.846259, 0.849976, 0.850284, 0.846502,
-    0.84633, 0.850174, 0.850205, 0.846303, 0.846416, 0.850373,
-    0.850112, 0.846103, 0.846517, 0.850573, 0.850002, 0.845903,
-    0.846635, 0.850774, 0.849876, 0.845702, 0.84677, 0.850975,
-    0.849732, 0.845501, 0.846923, 0.851175, 0.84957, 0.845301,
-    0.847094, 0.851374, 0.849389, 0.845103, 0.847285, 0.851572,
-    0.849189, 0.844907, 0.847496, 0.851766, 0.848966, 0.844713,
-    0.847729, 0.851958, 0.848722, 0.844523, 0.847986, 0.852147,
-    0.848453, 0.844337, 0.848268, 0.852331, 0.848158, 0.844155,
-    0.848576, 0.85251, 0.847835, 0.843978, 0.848914, 0.852684,
-    0.847481, 0.843807, 0.849285, 0.852852, 0.847092, 0.843643,
-    0.849692, 0.853013, 0.846666, 0.843485, 0.85014, 0.853167,
-    0.846196, 0.843335, 0.850634, 0.853313, 0.845675, 0.843194,
-    0.851183, 0.85345, 0.845096, 0.843062, 0.851796, 0.853577,
-    0.844446, 0.84294, 0.852486, 0.853693, 0.843711, 0.84283,
-    0.853271, 0.853797, 0.842869, 0.842733, 0.854177, 0.853886,
-    0.841891, 0.842651, 0.855237, 0.853959, 0.840735, 0.842588,
-    0.856505, 0.854011, 0.839336, 0.842549, 0.858061, 0.854035,
-    0.837592, 0.842544, 0.860033, 0.854018, 0.835336, 0.842589,
-    0.862646, 0.853936, 0.832266, 0.842722, 0.866319, 0.85373,
-    0.827778, 0.843036, 0.871948, 0.853245, 0.820479, 0.843812,
-    0.88183, 0.851925, 0.80628, 0.846286, 0.90409, 0.84649,
-    0.766083, 0.862292, 1, 0.746554, 3.4861e-14, -0.746554,
-    -1, -0.862292, -0.766083, -0.84649, -0.90409, -0.846286,
-    -0.80628, -0.851925, -0.88183, -0.843812, -0.820479, -0.853245,
-    -0.871948, -0.843036, -0.827778, -0.85373, -0.866319, -0.842722,
-    -0.832266, -0.853936, -0.862646, -0.842589, -0.835336, -0.854018,
-    -0.860033, -0.842544, -0.837592, -0.854035, -0.858061, -0.842549,
-    -0.839336, -0.854011, -0.856505, -0.842588, -0.840735, -0.853959,
-    -0.855237, -0.842651, -0.841891, -0.853886, -0.854177, -0.842733,
-    -0.842869, -0.853797, -0.853271, -0.84283, -0.843711, -0.853693,
-    -0.852486, -0.84294, -0.844446, -0.853577, -0.851796, -0.843062,
-    -0.845096, -0.85345, -0.851183, -0.843194, -0.845675, -0.853313,
-    -0.850634, -0.843335, -0.846196, -0.853167, -0.85014, -0.843485,
-    -0.846666, -0.853013, -0.849692, -0.843643, -0.847092, -0.852852,
-    -0.849285, -0.843807, -0.847481, -0.852684, -0.848914, -0.843978,
-    -0.847835, -0.85251, -0.848576, -0.844155, -0.848158, -0.852331,
-    -0.848268, -0.844337, -0.848453, -0.852147, -0.847986, -0.844523,
-    -0.848722, -0.851958, -0.847729, -0.844713, -0.848966, -0.851766,
-    -0.847496, -0.844907, -0.849189, -0.851572, -0.847285, -0.845103,
-    -0.849389, -0.851374, -0.847094, -0.845301, -0.84957, -0.851175,
-    -0.846923, -0.845501, -0.849732, -0.850975, -0.84677, -0.845702,
-    -0.849876, -0.850774, -0.846635, -0.845903, -0.850002, -0.850573,
-    -0.846517, -0.846103, -0.850112, -0.850373, -0.846416, -0.846303,
-    -0.850205, -0.850174, -0.84633, -0.846502, -0.850284, -0.849976,
-    -0.846259, -0.846698, -0.850348, -0.849781, -0.846202, -0.846892,
-    -0.850398, -0.849589, -0.846159, -0.847083, -0.850434, -0.849399,
-    -0.846129, -0.84727, -0.850457, -0.849214, -0.846112, -0.847453,
-    -0.850468, -0.849033, -0.846107, -0.847632, -0.850468, -0.848856,
-    -0.846113, -0.847806, -0.850456, -0.848685, -0.846131, -0.847975,
-    -0.850433, -0.848519, -0.846158, -0.848137, -0.8504, -0.84836,
-    -0.846196, -0.848294, -0.850358, -0.848206, -0.846243, -0.848444,
-    -0.850307, -0.84806, -0.846298, -0.848587, -0.850247, -0.84792,
-    -0.846362, -0.848723, -0.85018, -0.847788, -0.846433, -0.848852,
-    -0.850105, -0.847663, -0.846511, -0.848972, -0.850024, -0.847547,
-    -0.846595, -0.849085, -0.849936, -0.847438, -0.846686, -0.84919,
-    -0.849844, -0.847337, -0.846781, -0.849286, -0.849746, -0.847245,
-    -0.846881, -0.849374, -0.849644, -0.847161, -0.846985, -0.849454,
-    -0.849538, -0.847086, -0.847092, -0.849525, -0.849429, -0.84702,
-    -0.847202, -0.849587, -0.849318, -0.846962, -0.847315, -0.84964,
-    -0.849204, -0.846912, -0.847429, -0.849685, -0.849089, -0.846872,
-    -0.847545, -0.849722, -0.848974, -0.84684, -0.84766, -0.84975,
-    -0.848858, -0.846816, -0.847776, -0.849769, -0.848742, -0.8468,
-    -0.847892, -0.84978, -0.848627, -0.846793, -0.848007, -0.849784,
-    -0.848513, -0.846794, -0.84812, -0.849779, -0.848401, -0.846802,
-    -0.848231, -0.849767, -0.848291, -0.846818, -0.848339, -0.849747,
-    -0.848184, -0.846842, -0.848445, -0.84972, -0.84808, -0.846872,
-    -0.848548, -0.849687, -0.847979, -0.846909, -0.848646, -0.849646,
-    -0.847882, -0.846952, -0.848741, -0.8496, -0.84779, -0.847002,
-    -0.848831, -0.849548, -0.847702, -0.847057, -0.848917, -0.84949,
-    -0.847618, -0.847117, -0.848997, -0.849427, -0.847541, -0.847182,
-    -0.849073, -0.84936, -0.847468, -0.847252, -0.849142, -0.849288,
-    -0.847402, -0.847326, -0.849206, -0.849212, -0.847341, -0.847403,
-    -0.849264, -0.849133, -0.847286, -0.847484, -0.849315, -0.849051,
-    -0.847237, -0.847567, -0.849361, -0.848967, -0.847195, -0.847653,
-    -0.8494, -0.84888, -0.84716, -0.84774, -0.849432, -0.848792,
-    -0.84713, -0.847829, -0.849458, -0.848702, -0.847108, -0.847919,
-    -0.849478, -0.848612, -0.847091, -0.848009, -0.84949, -0.848522,
-    -0.847082, -0.8481, -0.849497, -0.848431, -0.847079, -0.84819,
-    -0.849497, -0.848341, -0.847082, -0.848279, -0.84949, -0.848253,
-    -0.847091, -0.848368, -0.849478, -0.848165, -0.847107, -0.848454,
-    -0.849459, -0.84808, -0.847128, -0.848538, -0.849435, -0.847996,
-    -0.847156, -0.848621, -0.849405, -0.847916, -0.847189, -0.8487,
-    -0.849369, -0.847838, -0.847227, -0.848776, -0.849328, -0.847763,
-    -0.847271, -0.848849, -0.849282, -0.847693, -0.847319, -0.848918,
-    -0.849232, -0.847626, -0.847372, -0.848982, -0.849177, -0.847563,
-    -0.847429, -0.849043, -0.849118, -0.847505, -0.84749, -0.849099,
-    -0.849055, -0.847451, -0.847554, -0.84915, -0.848989, -0.847402,
-    -0.847622, -0.849196, -0.848919, -0.847359, -0.847692, -0.849237,
-    -0.848848, -0.847321, -0.847765, -0.849273, -0.848773, -0.847288,
-    -0.847841, -0.849303, -0.848697, -0.847261, -0.847918, -0.849327,
-    -0.84862, -0.847239, -0.847996, -0.849346, -0.848541, -0.847223,
-    -0.848075, -0.849359, -0.848461, -0.847213, -0.848155, -0.849367,
-    -0.848382, -0.847208, -0.848234, -0.849368, -0.848302, -0.847209,
-    -0.848314, -0.849364, -0.848223, -0.847216, -0.848393, -0.849355,
-    -0.848144, -0.847228, -0.848471, -0.84934, -0.848067, -0.847246,
-    -0.848547, -0.849319, -0.847991, -0.847269, -0.848622, -0.849293,
-    -0.847918, -0.847298, -0.848695, -0.849262, -0.847846, -0.847332,
-    -0.848765, -0.849226, -0.847778, -0.84737, -0.848832, -0.849185,
-    -0.847712, -0.847413, -0.848896, -0.84914, -0.84765, -0.847461,
-    -0.848957, -0.84909, -0.847591, -0.847512, -0.849013, -0.849037,
-    -0.847536, -0.847568, -0.849066, -0.848979, -0.847485, -0.847627,
-    -0.849115, -0.848918, -0.847439, -0.84769, -0.849159, -0.848854,
-    -0.847397, -0.847755, -0.849199, -0.848787, -0.84736, -0.847824,
-    -0.849233, -0.848718, -0.847328, -0.847894, -0.849263, -0.848646,
-    -0.847301, -0.847967, -0.849287, -0.848573, -0.847279, -0.848041,
-    -0.849306, -0.848498, -0.847263, -0.848116, -0.84932, -0.848422,
-    -0.847252, -0.848192, -0.849328, -0.848346, -0.847246, -0.848269,
-    -0.849331, -0.848269, -0.847246, -0.848346, -0.849328, -0.848192,
-    -0.847252, -0.848422, -0.84932, -0.848116, -0.847263, -0.848498,
-    -0.849306, -0.848041, -0.847279, -0.848573, -0.849287, -0.847967,
-    -0.847301, -0.848646, -0.849263, -0.847894, -0.847328, -0.848718,
-    -0.849233, -0.847824, -0.84736, -0.848787, -0.849199, -0.847755,
-    -0.847397, -0.848854, -0.849159, -0.84769, -0.847439, -0.848918,
-    -0.849115, -0.847627, -0.847485, -0.848979, -0.849066, -0.847568,
-    -0.847536, -0.849037, -0.849013, -0.847512, -0.847591, -0.84909,
-    -0.848957, -0.847461, -0.84765, -0.84914, -0.848896, -0.847413,
-    -0.847712, -0.849185, -0.848832, -0.84737, -0.847778, -0.849226,
-    -0.848765, -0.847332, -0.847846, -0.849262, -0.848695, -0.847298,
-    -0.847918, -0.849293, -0.848622, -0.847269, -0.847991, -0.849319,
-    -0.848547, -0.847246, -0.848067, -0.84934, -0.848471, -0.847228,
-    -0.848144, -0.849355, -0.848393, -0.847216, -0.848223, -0.849364,
-    -0.848314, -0.847209, -0.848302, -0.849368, -0.848234, -0.847208,
-    -0.848382, -0.849367, -0.848155, -0.847213, -0.848461, -0.849359,
-    -0.848075, -0.847223, -0.848541, -0.849346, -0.847996, -0.847239,
-    -0.84862, -0.849327, -0.847918, -0.847261, -0.848697, -0.849303,
-    -0.847841, -0.847288, -0.848773, -0.849273, -0.847765, -0.847321,
-    -0.848848, -0.849237, -0.847692, -0.847359, -0.848919, -0.849196,
-    -0.847622, -0.847402, -0.848989, -0.84915, -0.847554, -0.847451,
-    -0.849055, -0.849099, -0.84749, -0.847505, -0.849118, -0.849043,
-    -0.847429, -0.847563, -0.849177, -0.848982, -0.847372, -0.847626,
-    -0.849232, -0.848918, -0.847319, -0.847693, -0.849282, -0.848849,
-    -0.847271, -0.847763, -0.849328, -0.848776, -0.847227, -0.847838,
-    -0.849369, -0.8487, -0.847189, -0.847916, -0.849405, -0.848621,
-    -0.847156, -0.847996, -0.849435, -0.848538, -0.847128, -0.84808,
-    -0.849459, -0.848454, -0.847107, -0.848165, -0.849478, -0.848368,
-    -0.847091, -0.848253, -0.84949, -0.848279, -0.847082, -0.848341,
-    -0.849497, -0.84819, -0.847079, -0.848431, -0.849497, -0.8481,
-    -0.847082, -0.848522, -0.84949, -0.848009, -0.847091, -0.848612,
-    -0.849478, -0.847919, -0.847108, -0.848702, -0.849458, -0.847829,
-    -0.84713, -0.848792, -0.849432, -0.84774, -0.84716, -0.84888,
-    -0.8494, -0.847653, -0.847195, -0.848967, -0.849361, -0.847567,
-    -0.847237, -0.849051, -0.849315, -0.847484, -0.847286, -0.849133,
-    -0.849264, -0.847403, -0.847341, -0.849212, -0.849206, -0.847326,
-    -0.847402, -0.849288, -0.849142, -0.847252, -0.847468, -0.84936,
-    -0.849073, -0.847182, -0.847541, -0.849427, -0.848997, -0.847117,
-    -0.847618, -0.84949, -0.848917, -0.847057, -0.847702, -0.849548,
-    -0.848831, -0.847002, -0.84779, -0.8496, -0.848741, -0.846952,
-    -0.847882, -0.849646, -0.848646, -0.846909, -0.847979, -0.849687,
-    -0.848548, -0.846872, -0.84808, -0.84972, -0.848445, -0.846842,
-    -0.848184, -0.849747, -0.848339, -0.846818, -0.848291, -0.849767,
-    -0.848231, -0.846802, -0.848401, -0.849779, -0.84812, -0.846794,
-    -0.848513, -0.849784, -0.848007, -0.846793, -0.848627, -0.84978,
-    -0.847892, -0.8468, -0.848742, -0.849769, -0.847776, -0.846816,
-    -0.848858, -0.84975, -0.84766, -0.84684, -0.848974, -0.849722,
-    -0.847545, -0.846872, -0.849089, -0.849685, -0.847429, -0.846912,
-    -0.849204, -0.84964, -0.847315, -0.846962, -0.849318, -0.849587,
-    -0.847202, -0.84702, -0.849429, -0.849525, -0.847092, -0.847086,
-    -0.849538, -0.849454, -0.846985, -0.847161, -0.849644, -0.849374,
-    -0.846881, -0.847245, -0.849746, -0.849286, -0.846781, -0.847337,
-    -0.849844, -0.84919, -0.846686, -0.847438, -0.849936, -0.849085,
-    -0.846595, -0.847547, -0.850024, -0.848972, -0.846511, -0.847663,
-    -0.850105, -0.848852, -0.846433, -0.847788, -0.85018, -0.848723,
-    -0.846362, -0.84792, -0.850247, -0.848587, -0.846298, -0.84806,
-    -0.850307, -0.848444, -0.846243, -0.848206, -0.850358, -0.848294,
-    -0.846196, -0.84836, -0.8504, -0.848137, -0.846158, -0.848519,
-    -0.850433, -0.847975, -0.846131, -0.848685, -0.850456, -0.847806,
-    -0.846113, -0.848856, -0.850468, -0.847632, -0.846107, -0.849033,
-    -0.850468, -0.847453, -0.846112, -0.849214, -0.850457, -0.84727,
-    -0.846129, -0.849399, -0.850434, -0.847083, -0.846159, -0.849589,
-    -0.850398, -0.846892, -0.846202, -0.849781, -0.850348, -0.846698,
-    -0.846259, -0.849976, -0.850284, -0.846502, -0.84633, -0.850174,
-    -0.850205, -0.846303, -0.846416, -0.850373, -0.850112, -0.846103,
-    -0.846517, -0.850573, -0.850002, -0.845903, -0.846635, -0.850774,
-    -0.849876, -0.845702, -0.84677, -0.850975, -0.849732, -0.845501,
-    -0.846923, -0.851175, -0.84957, -0.845301, -0.847094, -0.851374,
-    -0.849389, -0.845103, -0.847285, -0.851572, -0.849189, -0.844907,
-    -0.847496, -0.851766, -0.848966, -0.844713, -0.847729, -0.851958,
-    -0.848722, -0.844523, -0.847986, -0.852147, -0.848453, -0.844337,
-    -0.848268, -0.852331, -0.848158, -0.844155, -0.848576, -0.85251,
-    -0.847835, -0.843978, -0.848914, -0.852684, -0.847481, -0.843807,
-    -0.849285, -0.852852, -0.847092, -0.843643, -0.849692, -0.853013,
-    -0.846666, -0.843485, -0.85014, -0.853167, -0.846196, -0.843335,
-    -0.850634, -0.853313, -0.845675, -0.843194, -0.851183, -0.85345,
-    -0.845096, -0.843062, -0.851796, -0.853577, -0.844446, -0.84294,
-    -0.852486, -0.853693, -0.843711, -0.84283, -0.853271, -0.853797,
-    -0.842869, -0.842733, -0.854177, -0.853886, -0.841891, -0.842651,
-    -0.855237, -0.853959, -0.840735, -0.842588, -0.856505, -0.854011,
-    -0.839336, -0.842549, -0.858061, -0.854035, -0.837592, -0.842544,
-    -0.860033, -0.854018, -0.835336, -0.842589, -0.862646, -0.853936,
-    -0.832266, -0.842722, -0.866319, -0.85373, -0.827778, -0.843036,
-    -0.871948, -0.853245, -0.820479, -0.843812, -0.88183, -0.851925,
-    -0.80628, -0.846286, -0.90409, -0.84649, -0.766083, -0.862292,
-    -1, -0.746554
-};
-
-static const float WAVE_SQUARE_042[DEFAULT_WAVELEN] = {
-    -2.22045e-16, 0.415868, 0.7487, 0.945424, 1, 0.950765,
-    0.860288, 0.78772, 0.766322, 0.795426, 0.848634, 0.892258,
-    0.90391, 0.882237, 0.844298, 0.813665, 0.806693, 0.824467,
-    0.854045, 0.877262, 0.881478, 0.866125, 0.841856, 0.823458,
-    0.821062, 0.83475, 0.855327, 0.870324, 0.871428, 0.858968,
-    0.841125, 0.828665, 0.828527, 0.840035, 0.85576, 0.866244,
-    0.865635, 0.854895, 0.84087, 0.831972, 0.833177, 0.843277,
-    0.8559, 0.86349, 0.861803, 0.852248, 0.840808, 0.834318,
-    0.836403, 0.845481, 0.855904, 0.861455, 0.859038, 0.850383,
-    0.840848, 0.836111, 0.838808, 0.84708, 0.85583, 0.859853,
-    0.85692, 0.848998, 0.84095, 0.837559, 0.840693, 0.848291,
-    0.855704, 0.858531, 0.855227, 0.847932, 0.841097, 0.838776,
-    0.842225, 0.849235, 0.855538, 0.857401, 0.853831, 0.847092,
-    0.841279, 0.839832, 0.843505, 0.849985, 0.855341, 0.856409,
-    0.852651, 0.846421, 0.84149, 0.84077, 0.844596, 0.850586,
-    0.855118, 0.855519, 0.851638, 0.845881, 0.841725, 0.841617,
-    0.84554, 0.85107, 0.854872, 0.854709, 0.850756, 0.845448,
-    0.841981, 0.842394, 0.846366, 0.851458, 0.854606, 0.853963,
-    0.849982, 0.845102, 0.842257, 0.843113, 0.847094, 0.851765,
-    0.854322, 0.853269, 0.849297, 0.84483, 0.842549, 0.843783,
-    0.847738, 0.852004, 0.854022, 0.85262, 0.848689, 0.844622,
-    0.842855, 0.844412, 0.848311, 0.852182, 0.853709, 0.85201,
-    0.84815, 0.844471, 0.843175, 0.845004, 0.848819, 0.852308,
-    0.853384, 0.851435, 0.847671, 0.84437, 0.843505, 0.845562,
-    0.84927, 0.852386, 0.853049, 0.850893, 0.847247, 0.844314,
-    0.843844, 0.846089, 0.849668, 0.852421, 0.852706, 0.850382,
-    0.846873, 0.844299, 0.844191, 0.846586, 0.850018, 0.852417,
-    0.852356, 0.849899, 0.846547, 0.84432, 0.844543, 0.847054,
-    0.850322, 0.852379, 0.852002, 0.849445, 0.846264, 0.844375,
-    0.844898, 0.847495, 0.850584, 0.852308, 0.851646, 0.849018,
-    0.846023, 0.844461, 0.845256, 0.847908, 0.850806, 0.852209,
-    0.851288, 0.848619, 0.84582, 0.844574, 0.845613, 0.848293,
-    0.85099, 0.852083, 0.850931, 0.848246, 0.845655, 0.844712,
-    0.845969, 0.848652, 0.851137, 0.851933, 0.850577, 0.847901,
-    0.845525, 0.844872, 0.846322, 0.848984, 0.85125, 0.851762,
-    0.850226, 0.847583, 0.845428, 0.845053, 0.846669, 0.849289,
-    0.851331, 0.851572, 0.849882, 0.847291, 0.845363, 0.845252,
-    0.84701, 0.849567, 0.85138, 0.851365, 0.849545, 0.847026,
-    0.845329, 0.845466, 0.847343, 0.849818, 0.8514, 0.851144,
-    0.849217, 0.846789, 0.845323, 0.845694, 0.847666, 0.850043,
-    0.851392, 0.850911, 0.848899, 0.846578, 0.845344, 0.845933,
-    0.847978, 0.85024, 0.851358, 0.850667, 0.848593, 0.846394,
-    0.845391, 0.846181, 0.848277, 0.850411, 0.851299, 0.850415,
-    0.848301, 0.846236, 0.845462, 0.846436, 0.848563, 0.850555,
-    0.851217, 0.850156, 0.848022, 0.846105, 0.845555, 0.846697,
-    0.848833, 0.850674, 0.851113, 0.849894, 0.84776, 0.845999,
-    0.845669, 0.846961, 0.849088, 0.850766, 0.850989, 0.849629,
-    0.847514, 0.845919, 0.845802, 0.847226, 0.849325, 0.850834,
-    0.850847, 0.849364, 0.847285, 0.845864, 0.845953, 0.84749,
-    0.849544, 0.850877, 0.850689, 0.849101, 0.847075, 0.845833,
-    0.846119, 0.847752, 0.849745, 0.850896, 0.850516, 0.848841,
-    0.846885, 0.845826, 0.846298, 0.84801, 0.849926, 0.850891,
-    0.85033, 0.848586, 0.846714, 0.845842, 0.84649, 0.848262,
-    0.850086, 0.850864, 0.850132, 0.848337, 0.846564, 0.84588,
-    0.846693, 0.848507, 0.850226, 0.850816, 0.849926, 0.848097,
-    0.846434, 0.845938, 0.846903, 0.848742, 0.850345, 0.850748,
-    0.849711, 0.847866, 0.846326, 0.846017, 0.847121, 0.848968,
-    0.850443, 0.85066, 0.849491, 0.847646, 0.846238, 0.846114,
-    0.847343, 0.849181, 0.85052, 0.850554, 0.849267, 0.847439,
-    0.846173, 0.846228, 0.847569, 0.849382, 0.850575, 0.850431,
-    0.849041, 0.847246, 0.846128, 0.846359, 0.847795, 0.849568,
-    0.850609, 0.850292, 0.848814, 0.847067, 0.846105, 0.846505,
-    0.848022, 0.84974, 0.850622, 0.85014, 0.848588, 0.846903,
-    0.846102, 0.846664, 0.848247, 0.849895, 0.850615, 0.849975,
-    0.848365, 0.846757, 0.846119, 0.846834, 0.848468, 0.850033,
-    0.850587, 0.849799, 0.848146, 0.846627, 0.846156, 0.847015,
-    0.848683, 0.850153, 0.85054, 0.849613, 0.847934, 0.846516,
-    0.846213, 0.847205, 0.848892, 0.850256, 0.850475, 0.84942,
-    0.847729, 0.846423, 0.846287, 0.847402, 0.849093, 0.850339,
-    0.850391, 0.84922, 0.847533, 0.846349, 0.846379, 0.847605,
-    0.849284, 0.850404, 0.850291, 0.849015, 0.847347, 0.846294,
-    0.846488, 0.847811, 0.849464, 0.850449, 0.850174, 0.848807,
-    0.847173, 0.846258, 0.846612, 0.84802, 0.849632, 0.850475,
-    0.850043, 0.848598, 0.847012, 0.846242, 0.84675, 0.848229,
-    0.849786, 0.850482, 0.849898, 0.848389, 0.846865, 0.846245,
-    0.846902, 0.848438, 0.849926, 0.850469, 0.849741, 0.848182,
-    0.846732, 0.846267, 0.847065, 0.848643, 0.85005, 0.850438,
-    0.849573, 0.847978, 0.846616, 0.846308, 0.847238, 0.848845,
-    0.850159, 0.850388, 0.849395, 0.847779, 0.846516, 0.846367,
-    0.84742, 0.849041, 0.85025, 0.85032, 0.849208, 0.847587,
-    0.846433, 0.846443, 0.84761, 0.849229, 0.850324, 0.850235,
-    0.849016, 0.847402, 0.846368, 0.846537, 0.847805, 0.849409,
-    0.85038, 0.850133, 0.848818, 0.847227, 0.846322, 0.846646,
-    0.848005, 0.849579, 0.850417, 0.850016, 0.848616, 0.847063,
-    0.846293, 0.846771, 0.848208, 0.849737, 0.850436, 0.849883,
-    0.848412, 0.846911, 0.846284, 0.846911, 0.848412, 0.849883,
-    0.850436, 0.849737, 0.848208, 0.846771, 0.846293, 0.847063,
-    0.848616, 0.850016, 0.850417, 0.849579, 0.848005, 0.846646,
-    0.846322, 0.847227, 0.848818, 0.850133, 0.85038, 0.849409,
-    0.847805, 0.846537, 0.846368, 0.847402, 0.849016, 0.850235,
-    0.850324, 0.849229, 0.84761, 0.846443, 0.846433, 0.847587,
-    0.849208, 0.85032, 0.85025, 0.849041, 0.84742, 0.846367,
-    0.846516, 0.847779, 0.849395, 0.850388, 0.850159, 0.848845,
-    0.847238, 0.846308, 0.846616, 0.847978, 0.849573, 0.850438,
-    0.85005, 0.848643, 0.847065, 0.846267, 0.846732, 0.848182,
-    0.849741, 0.850469, 0.849926, 0.848438, 0.846902, 0.846245,
-    0.846865, 0.848389, 0.849898, 0.850482, 0.849786, 0.848229,
-    0.84675, 0.846242, 0.847012, 0.848598, 0.850043, 0.850475,
-    0.849632, 0.84802, 0.846612, 0.846258, 0.847173, 0.848807,
-    0.850174, 0.850449, 0.849464, 0.847811, 0.846488, 0.846294,
-    0.847347, 0.849015, 0.850291, 0.850404, 0.849284, 0.847605,
-    0.846379, 0.846349, 0.847533, 0.84922, 0.850391, 0.850339,
-    0.849093, 0.847402, 0.846287, 0.846423, 0.847729, 0.84942,
-    0.850475, 0.850256, 0.848892, 0.847205, 0.846213, 0.846516,
-    0.847934, 0.849613, 0.85054, 0.850153, 0.848683, 0.847015,
-    0.846156, 0.846627, 0.848146, 0.849799, 0.850587, 0.850033,
-    0.848468, 0.846834, 0.846119, 0.846757, 0.848365, 0.849975,
-    0.850615, 0.849895, 0.848247, 0.846664, 0.846102, 0.846903,
-    0.848588, 0.85014, 0.850622, 0.84974, 0.848022, 0.846505,
-    0.846105, 0.847067, 0.848814, 0.850292, 0.850609, 0.849568,
-    0.847795, 0.846359, 0.846128, 0.847246, 0.849041, 0.850431,
-    0.850575, 0.849382, 0.847569, 0.846228, 0.846173, 0.847439,
-    0.849267, 0.850554, 0.85052, 0.849181, 0.847343, 0.846114,
-    0.846238, 0.847646, 0.849491, 0.85066, 0.850443, 0.848968,
-    0.847121, 0.846017, 0.846326, 0.847866, 0.849711, 0.850748,
-    0.850345, 0.848742, 0.846903, 0.845938, 0.846434, 0.848097,
-    0.849926, 0.850816, 0.850226, 0.848507, 0.846693, 0.84588,
-    0.846564, 0.848337, 0.850132, 0.850864, 0.850086, 0.848262,
-    0.84649, 0.845842, 0.846714, 0.848586, 0.85033, 0.850891,
-    0.849926, 0.84801, 0.846298, 0.845826, 0.846885, 0.848841,
-    0.850516, 0.850896, 0.849745, 0.847752, 0.846119, 0.845833,
-    0.847075, 0.849101, 0.850689, 0.850877, 0.849544, 0.84749,
-    0.845953, 0.845864, 0.847285, 0.849364, 0.850847, 0.850834,
-    0.849325, 0.847226, 0.845802, 0.845919, 0.847514, 0.849629,
-    0.850989, 0.850766, 0.849088, 0.846961, 0.845669, 0.845999,
-    0.84776, 0.849894, 0.851113, 0.850674, 0.848833, 0.846697,
-    0.845555, 0.846105, 0.848022, 0.850156, 0.851217, 0.850555,
-    0.848563, 0.846436, 0.845462, 0.846236, 0.848301, 0.850415,
-    0.851299, 0.850411, 0.848277, 0.846181, 0.845391, 0.846394,
-    0.848593, 0.850667, 0.851358, 0.85024, 0.847978, 0.845933,
-    0.845344, 0.846578, 0.848899, 0.850911, 0.851392, 0.850043,
-    0.847666, 0.845694, 0.845323, 0.846789, 0.849217, 0.851144,
-    0.8514, 0.849818, 0.847343, 0.845466, 0.845329, 0.847026,
-    0.849545, 0.851365, 0.85138, 0.849567, 0.84701, 0.845252,
-    0.845363, 0.847291, 0.849882, 0.851572, 0.851331, 0.849289,
-    0.846669, 0.845053, 0.845428, 0.847583, 0.850226, 0.851762,
-    0.85125, 0.848984, 0.846322, 0.844872, 0.845525, 0.847901,
-    0.850577, 0.851933, 0.851137, 0.848652, 0.845969, 0.844712,
-    0.845655, 0.848246, 0.850931, 0.852083, 0.85099, 0.848293,
-    0.845613, 0.844574, 0.84582, 0.848619, 0.851288, 0.852209,
-    0.850806, 0.847908, 0.845256, 0.844461, 0.846023, 0.849018,
-    0.851646, 0.852308, 0.850584, 0.847495, 0.844898, 0.844375,
-    0.846264, 0.849445, 0.852002, 0.852379, 0.850322, 0.847054,
-    0.844543, 0.84432, 0.846547, 0.849899, 0.852356, 0.852417,
-    0.850018, 0.846586, 0.844191, 0.844299, 0.846873, 0.850382,
-    0.852706, 0.852421, 0.849668, 0.846089, 0.843844, 0.844314,
-    0.847247, 0.850893, 0.853049, 0.852386, 0.84927, 0.845562,
-    0.843505, 0.84437, 0.847671, 0.851435, 0.853384, 0.852308,
-    0.848819, 0.845004, 0.843175, 0.844471, 0.84815, 0.85201,
-    0.853709, 0.852182, 0.848311, 0.844412, 0.842855, 0.844622,
-    0.848689, 0.85262, 0.854022, 0.852004, 0.847738, 0.843783,
-    0.842549, 0.84483, 0.849297, 0.853269, 0.854322, 0.851765,
-    0.847094, 0.843113, 0.842257, 0.845102, 0.849982, 0.853963,
-    0.854606, 0.851458, 0.846366, 0.842394, 0.841981, 0.845448,
-    0.850756, 0.854709, 0.854872, 0.85107, 0.84554, 0.841617,
-    0.841725, 0.845881, 0.851638, 0.855519, 0.855118, 0.850586,
-    0.844596, 0.84077, 0.84149, 0.846421, 0.852651, 0.856409,
-    0.855341, 0.849985, 0.843505, 0.839832, 0.841279, 0.847092,
-    0.853831, 0.857401, 0.855538, 0.849235, 0.842225, 0.838776,
-    0.841097, 0.847932, 0.855227, 0.858531, 0.855704, 0.848291,
-    0.840693, 0.837559, 0.84095, 0.848998, 0.85692, 0.859853,
-    0.85583, 0.84708, 0.838808, 0.836111, 0.840848, 0.850383,
-    0.859038, 0.861455, 0.855904, 0.845481, 0.836403, 0.834318,
-    0.840808, 0.852248, 0.861803, 0.86349, 0.8559, 0.843277,
-    0.833177, 0.831972, 0.84087, 0.854895, 0.865635, 0.866244,
-    0.85576, 0.840035, 0.828527, 0.828665, 0.841125, 0.858968,
-    0.871428, 0.870324, 0.855327, 0.83475, 0.821062, 0.823458,
-    0.841856, 0.866125, 0.881478, 0.877262, 0.854045, 0.824467,
-    0.806693, 0.813665, 0.844298, 0.882237, 0.90391, 0.892258,
-    0.848634, 0.795426, 0.766322, 0.78772, 0.860288, 0.950765,
-    1, 0.945424, 0.7487, 0.415868, 1.75415e-14, -0.415868,
-    -0.7487, -0.945424, -1, -0.950765, -0.860288, -0.78772,
-    -0.766322, -0.795426, -0.848634, -0.892258, -0.90391, -0.882237,
-    -0.844298, -0.813665, -0.806693, -0.824467, -0.854045, -0.877262,
-    -0.881478, -0.866125, -0.841856, -0.823458, -0.821062, -0.83475,
-    -0.855327, -0.870324, -0.871428, -0.858968, -0.841125, -0.828665,
-    -0.828527, -0.840035, -0.85576, -0.866244, -0.865635, -0.854895,
-    -0.84087, -0.831972, -0.833177, -0.843277, -0.8559, -0.86349,
-    -0.861803, -0.852248, -0.840808, -0.834318, -0.836403, -0.845481,
-    -0.855904, -0.861455, -0.859038, -0.850383, -0.840848, -0.836111,
-    -0.838808, -0.84708, -0.85583, -0.859853, -0.85692, -0.848998,
-    -0.84095, -0.837559, -0.840693, -0.848291, -0.855704, -0.858531,
-    -0.855227, -0.847932, -0.841097, -0.838776, -0.842225, -0.849235,
-    -0.855538, -0.857401, -0.853831, -0.847092, -0.841279, -0.839832,
-    -0.843505, -0.849985, -0.855341, -0.856409, -0.852651, -0.846421,
-    -0.84149, -0.84077, -0.844596, -0.850586, -0.855118, -0.855519,
-    -0.851638, -0.845881, -0.841725, -0.841617, -0.84554, -0.85107,
-    -0.854872, -0.854709, -0.850756, -0.845448, -0.841981, -0.842394,
-    -0.846366, -0.851458, -0.854606, -0.853963, -0.849982, -0.845102,
-    -0.842257, -0.843113, -0.847094, -0.851765, -0.854322, -0.853269,
-    -0.849297, -0.84483, -0.842549, -0.843783, -0.847738, -0.852004,
-    -0.854022, -0.85262, -0.848689, -0.844622, -0.842855, -0.844412,
-    -0.848311, -0.852182, -0.853709, -0.85201, -0.84815, -0.844471,
-    -0.843175, -0.845004, -0.848819, -0.852308, -0.853384, -0.851435,
-    -0.847671, -0.84437, -0.843505, -0.845562, -0.84927, -0.852386,
-    -0.853049, -0.850893, -0.847247, -0.844314, -0.843844, -0.846089,
-    -0.849668, -0.852421, -0.852706, -0.850382, -0.846873, -0.844299,
-    -0.844191, -0.846586, -0.850018, -0.852417, -0.852356, -0.849899,
-    -0.846547, -0.84432, -0.844543, -0.847054, -0.850322, -0.852379,
-    -0.852002, -0.849445, -0.846264, -0.844375, -0.844898, -0.847495,
-    -0.850584, -0.852308, -0.851646, -0.849018, -0.846023, -0.844461,
-    -0.845256, -0.847908, -0.850806, -0.852209, -0.851288, -0.848619,
-    -0.84582, -0.844574, -0.845613, -0.848293, -0.85099, -0.852083,
-    -0.850931, -0.848246, -0.845655, -0.844712, -0.845969, -0.848652,
-    -0.851137, -0.851933, -0.850577, -0.847901, -0.845525, -0.844872,
-    -0.846322, -0.848984, -0.85125, -0.851762, -0.850226, -0.847583,
-    -0.845428, -0.845053, -0.846669, -0.849289, -0.851331, -0.851572,
-    -0.849882, -0.847291, -0.845363, -0.845252, -0.84701, -0.849567,
-    -0.85138, -0.851365, -0.849545, -0.847026, -0.845329, -0.845466,
-    -0.847343, -0.849818, -0.8514, -0.851144, -0.849217, -0.846789,
-    -0.845323, -0.845694, -0.847666, -0.850043, -0.851392, -0.850911,
-    -0.848899, -0.846578, -0.845344, -0.845933, -0.847978, -0.85024,
-    -0.851358, -0.850667, -0.848593, -0.846394, -0.845391, -0.846181,
-    -0.848277, -0.850411, -0.851299, -0.850415, -0.848301, -0.846236,
-    -0.845462, -0.846436, -0.848563, -0.850555, -0.851217, -0.850156,
-    -0.848022, -0.846105, -0.845555, -0.846697, -0.848833, -0.850674,
-    -0.851113, -0.849894, -0.84776, -0.845999, -0.845669, -0.846961,
-    -0.849088, -0.850766, -0.850989, -0.849629, -0.847514, -0.845919,
-    -0.845802, -0.847226, -0.849325, -0.850834, -0.850847, -0.849364,
-    -0.847285, -0.845864, -0.845953, -0.84749, -0.849544, -0.850877,
-    -0.850689, -0.849101, -0.847075, -0.845833, -0.846119, -0.847752,
-    -0.849745, -0.850896, -0.850516, -0.848841, -0.846885, -0.845826,
-    -0.846298, -0.84801, -0.849926, -0.850891, -0.85033, -0.848586,
-    -0.846714, -0.845842, -0.84649, -0.848262, -0.850086, -0.850864,
-    -0.850132, -0.848337, -0.846564, -0.84588, -0.846693, -0.848507,
-    -0.850226, -0.850816, -0.849926, -0.848097, -0.846434, -0.845938,
-    -0.846903, -0.848742, -0.850345, -0.850748, -0.849711, -0.847866,
-    -0.846326, -0.846017, -0.847121, -0.848968, -0.850443, -0.85066,
-    -0.849491, -0.847646, -0.846238, -0.846114, -0.847343, -0.849181,
-    -0.85052, -0.850554, -0.849267, -0.847439, -0.846173, -0.846228,
-    -0.847569, -0.849382, -0.850575, -0.850431, -0.849041, -0.847246,
-    -0.846128, -0.846359, -0.847795, -0.849568, -0.850609, -0.850292,
-    -0.848814, -0.847067, -0.846105, -0.846505, -0.848022, -0.84974,
-    -0.850622, -0.85014, -0.848588, -0.846903, -0.846102, -0.846664,
-    -0.848247, -0.849895, -0.850615, -0.849975, -0.848365, -0.846757,
-    -0.846119, -0.846834, -0.848468, -0.850033, -0.850587, -0.849799,
-    -0.848146, -0.846627, -0.846156, -0.847015, -0.848683, -0.850153,
-    -0.85054, -0.849613, -0.847934, -0.846516, -0.846213, -0.847205,
-    -0.848892, -0.850256, -0.850475, -0.84942, -0.847729, -0.846423,
-    -0.846287, -0.847402, -0.849093, -0.850339, -0.850391, -0.84922,
-    -0.847533, -0.846349, -0.846379, -0.847605, -0.849284, -0.850404,
-    -0.850291, -0.849015, -0.847347, -0.846294, -0.846488, -0.847811,
-    -0.849464, -0.850449, -0.850174, -0.848807, -0.847173, -0.846258,
-    -0.846612, -0.84802, -0.849632, -0.850475, -0.850043, -0.848598,
-    -0.847012, -0.846242, -0.84675, -0.848229, -0.849786, -0.850482,
-    -0.849898, -0.848389, -0.846865, -0.846245, -0.846902, -0.848438,
-    -0.849926, -0.850469, -0.849741, -0.848182, -0.846732, -0.846267,
-    -0.847065, -0.848643, -0.85005, -0.850438, -0.849573, -0.847978,
-    -0.846616, -0.846308, -0.847238, -0.848845, -0.850159, -0.850388,
-    -0.849395, -0.847779, -0.846516, -0.846367, -0.84742, -0.849041,
-    -0.85025, -0.85032, -0.849208, -0.847587, -0.846433, -0.846443,
-    -0.84761, -0.849229, -0.850324, -0.850235, -0.849016, -0.847402,
-    -0.846368, -0.846537, -0.847805, -0.849409, -0.85038, -0.850133,
-    -0.848818, -0.847227, -0.846322, -0.846646, -0.848005, -0.849579,
-    -0.850417, -0.850016, -0.848616, -0.847063, -0.846293, -0.846771,
-    -0.848208, -0.849737, -0.850436, -0.849883, -0.848412, -0.846911,
-    -0.846284, -0.846911, -0.848412, -0.849883, -0.850436, -0.849737,
-    -0.848208, -0.846771, -0.846293, -0.847063, -0.848616, -0.850016,
-    -0.850417, -0.849579, -0.848005, -0.846646, -0.846322, -0.847227,
-    -0.848818, -0.850133, -0.85038, -0.849409, -0.847805, -0.846537,
-    -0.846368, -0.847402, -0.849016, -0.850235, -0.850324, -0.849229,
-    -0.84761, -0.846443, -0.846433, -0.847587, -0.849208, -0.85032,
-    -0.85025, -0.849041, -0.84742, -0.846367, -0.846516, -0.847779,
-    -0.849395, -0.850388, -0.850159, -0.848845, -0.847238, -0.846308,
-    -0.846616, -0.847978, -0.849573, -0.850438, -0.85005, -0.848643,
-    -0.847065, -0.846267, -0.846732, -0.848182, -0.849741, -0.850469,
-    -0.849926, -0.848438, -0.846902, -0.846245, -0.846865, -0.848389,
-    -0.849898, -0.850482, -0.849786, -0.848229, -0.84675, -0.846242,
-    -0.847012, -0.848598, -0.850043, -0.850475, -0.849632, -0.84802,
-    -0.846612, -0.846258, -0.847173, -0.848807, -0.850174, -0.850449,
-    -0.849464, -0.847811, -0.846488, -0.846294, -0.847347, -0.849015,
-    -0.850291, -0.850404, -0.849284, -0.847605, -0.846379, -0.846349,
-    -0.847533, -0.84922, -0.850391, -0.850339, -0.849093, -0.847402,
-    -0.846287, -0.846423, -0.847729, -0.84942, -0.850475, -0.850256,
-    -0.848892, -0.847205, -0.846213, -0.846516, -0.847934, -0.849613,
-    -0.85054, -0.850153, -0.848683, -0.847015, -0.846156, -0.846627,
-    -0.848146, -0.849799, -0.850587, -0.850033, -0.848468, -0.846834,
-    -0.846119, -0.846757, -0.848365, -0.849975, -0.850615, -0.849895,
-    -0.848247, -0.846664, -0.846102, -0.846903, -0.848588, -0.85014,
-    -0.850622, -0.84974, -0.848022, -0.846505, -0.846105, -0.847067,
-    -0.848814, -0.850292, -0.850609, -0.849568, -0.847795, -0.846359,
-    -0.846128, -0.847246, -0.849041, -0.850431, -0.850575, -0.849382,
-    -0.847569, -0.846228, -0.846173, -0.847439, -0.849267, -0.850554,
-    -0.85052, -0.849181, -0.847343, -0.846114, -0.846238, -0.847646,
-    -0.849491, -0.85066, -0.850443, -0.848968, -0.847121, -0.846017,
-    -0.846326, -0.847866, -0.849711, -0.850748, -0.850345, -0.848742,
-    -0.846903, -0.845938, -0.846434, -0.848097, -0.849926, -0.850816,
-    -0.850226, -0.848507, -0.846693, -0.84588, -0.846564, -0.848337,
-    -0.850132, -0.850864, -0.850086, -0.848262, -0.84649, -0.845842,
-    -0.846714, -0.848586, -0.85033, -0.850891, -0.849926, -0.84801,
-    -0.846298, -0.845826, -0.846885, -0.848841, -0.850516, -0.850896,
-    -0.849745, -0.847752, -0.846119, -0.845833, -0.847075, -0.849101,
-    -0.850689, -0.850877, -0.849544, -0.84749, -0.845953, -0.845864,
-    -0.847285, -0.849364, -0.850847, -0.850834, -0.849325, -0.847226,
-    -0.845802, -0.845919, -0.847514, -0.849629, -0.850989, -0.850766,
-    -0.849088, -0.846961, -0.845669, -0.845999, -0.84776, -0.849894,
-    -0.851113, -0.850674, -0.848833, -0.846697, -0.845555, -0.846105,
-    -0.848022, -0.850156, -0.851217, -0.850555, -0.848563, -0.846436,
-    -0.845462, -0.846236, -0.848301, -0.850415, -0.851299, -0.850411,
-    -0.848277, -0.846181, -0.845391, -0.846394, -0.848593, -0.850667,
-    -0.851358, -0.85024, -0.847978, -0.845933, -0.845344, -0.846578,
-    -0.848899, -0.850911, -0.851392, -0.850043, -0.847666, -0.845694,
-    -0.845323, -0.846789, -0.849217, -0.851144, -0.8514, -0.849818,
-    -0.847343, -0.845466, -0.845329, -0.847026, -0.849545, -0.851365,
-    -0.85138, -0.849567, -0.84701, -0.845252, -0.845363, -0.847291,
-    -0.849882, -0.851572, -0.851331, -0.849289, -0.846669, -0.845053,
-    -0.845428, -0.847583, -0.850226, -0.851762, -0.85125, -0.848984,
-    -0.846322, -0.844872, -0.845525, -0.847901, -0.850577, -0.851933,
-    -0.851137, -0.848652, -0.845969, -0.844712, -0.845655, -0.848246,
-    -0.850931, -0.852083, -0.85099, -0.848293, -0.845613, -0.844574,
-    -0.84582, -0.848619, -0.851288, -0.852209, -0.850806, -0.847908,
-    -0.845256, -0.844461, -0.846023, -0.849018, -0.851646, -0.852308,
-    -0.850584, -0.847495, -0.844898, -0.844375, -0.846264, -0.849445,
-    -0.852002, -0.852379, -0.850322, -0.847054, -0.844543, -0.84432,
-    -0.846547, -0.849899, -0.852356, -0.852417, -0.850018, -0.846586,
-    -0.844191, -0.844299, -0.846873, -0.850382, -0.852706, -0.852421,
-    -0.849668, -0.846089, -0.843844, -0.844314, -0.847247, -0.850893,
-    -0.853049, -0.852386, -0.84927, -0.845562, -0.843505, -0.84437,
-    -0.847671, -0.851435, -0.853384, -0.852308, -0.848819, -0.845004,
-    -0.843175, -0.844471, -0.84815, -0.85201, -0.853709, -0.852182,
-    -0.848311, -0.844412, -0.842855, -0.844622, -0.848689, -0.85262,
-    -0.854022, -0.852004, -0.847738, -0.843783, -0.842549, -0.84483,
-    -0.849297, -0.853269, -0.854322, -0.851765, -0.847094, -0.843113,
-    -0.842257, -0.845102, -0.849982, -0.853963, -0.854606, -0.851458,
-    -0.846366, -0.842394, -0.841981, -0.845448, -0.850756, -0.854709,
-    -0.854872, -0.85107, -0.84554, -0.841617, -0.841725, -0.845881,
-    -0.851638, -0.855519, -0.855118, -0.850586, -0.844596, -0.84077,
-    -0.84149, -0.846421, -0.852651, -0.856409, -0.855341, -0.849985,
-    -0.843505, -0.839832, -0.841279, -0.847092, -0.853831, -0.857401,
-    -0.855538, -0.849235, -0.842225, -0.838776, -0.841097, -0.847932,
-    -0.855227, -0.858531, -0.855704, -0.848291, -0.840693, -0.837559,
-    -0.84095, -0.848998, -0.85692, -0.859853, -0.85583, -0.84708,
-    -0.838808, -0.836111, -0.840848, -0.850383, -0.859038, -0.861455,
-    -0.855904, -0.845481, -0.836403, -0.834318, -0.840808, -0.852248,
-    -0.861803, -0.86349, -0.8559, -0.843277, -0.833177, -0.831972,
-    -0.84087, -0.854895, -0.865635, -0.866244, -0.85576, -0.840035,
-    -0.828527, -0.828665, -0.841125, -0.858968, -0.871428, -0.870324,
-    -0.855327, -0.83475, -0.821062, -0.823458, -0.841856, -0.866125,
-    -0.881478, -0.877262, -0.854045, -0.824467, -0.806693, -0.813665,
-    -0.844298, -0.882237, -0.90391, -0.892258, -0.848634, -0.795426,
-    -0.766322, -0.78772, -0.860288, -0.950765, -1, -0.945424,
-    -0.7487, -0.415868
-};
-
-static const float WAVE_SQUARE_054[DEFAULT_WAVELEN] = {
-    2.22045e-16, 0.213507, 0.415863, 0.596966, 0.748695, 0.865621,
-    0.945422, 0.988955, 1, 0.984696, 0.950761, 0.906577,
-    0.860272, 0.818878, 0.787691, 0.769862, 0.766287, 0.775765,
-    0.795402, 0.82118, 0.848631, 0.873491, 0.892278, 0.902712,
-    0.903936, 0.896515, 0.882247, 0.863803, 0.844276, 0.826702,
-    0.813613, 0.806704, 0.806633, 0.812993, 0.824431, 0.83891,
-    0.85405, 0.867504, 0.877305, 0.882143, 0.881528, 0.875822,
-    0.866144, 0.854163, 0.841823, 0.831033, 0.823382, 0.819911,
-    0.82098, 0.826237, 0.834707, 0.844958, 0.855346, 0.864264,
-    0.870393, 0.87289, 0.8715, 0.866573, 0.858992, 0.850015,
-    0.841076, 0.833553, 0.828562, 0.826794, 0.828423, 0.833093,
-    0.839989, 0.84798, 0.855797, 0.862236, 0.86634, 0.867539,
-    0.865726, 0.861266, 0.854919, 0.847718, 0.840801, 0.835232,
-    0.831841, 0.831099, 0.833055, 0.83734, 0.843234, 0.849784,
-    0.855959, 0.86081, 0.863614, 0.863982, 0.861911, 0.857777,
-    0.852267, 0.846265, 0.840715, 0.836468, 0.834158, 0.834103,
-    0.836266, 0.840266, 0.845445, 0.850975, 0.85599, 0.859719,
-    0.861608, 0.861397, 0.859159, 0.85528, 0.850392, 0.845274,
-    0.840726, 0.837447, 0.835923, 0.836361, 0.83866, 0.842429,
-    0.847057, 0.85181, 0.855945, 0.85883, 0.860034, 0.859398,
-    0.857051, 0.853384, 0.84899, 0.844565, 0.840797, 0.838265,
-    0.837343, 0.838151, 0.840538, 0.844108, 0.848287, 0.852416,
-    0.855852, 0.858069, 0.858739, 0.857779, 0.855362, 0.851885,
-    0.847903, 0.844045, 0.84091, 0.838978, 0.838534, 0.839628,
-    0.842068, 0.845457, 0.849255, 0.852863, 0.855722, 0.857394,
-    0.857634, 0.856422, 0.853965, 0.850661, 0.847037, 0.84366,
-    0.841056, 0.839621, 0.839566, 0.840883, 0.843351, 0.846572,
-    0.850034, 0.853194, 0.855562, 0.856778, 0.856665, 0.855254,
-    0.85278, 0.849641, 0.846334, 0.843377, 0.841229, 0.840215,
-    0.840483, 0.841977, 0.844451, 0.84751, 0.850669, 0.853434,
-    0.855377, 0.856203, 0.855794, 0.854226, 0.851755, 0.848775,
-    0.845758, 0.843175, 0.841425, 0.840774, 0.841313, 0.842947,
-    0.845411, 0.848311, 0.851192, 0.853602, 0.85517, 0.855658,
-    0.855, 0.853307, 0.850855, 0.848032, 0.845283, 0.843038,
-    0.841642, 0.841307, 0.842076, 0.84382, 0.846258, 0.849002,
-    0.851623, 0.85371, 0.854943, 0.855135, 0.854264, 0.852475,
-    0.850055, 0.847388, 0.844892, 0.842956, 0.841879, 0.841822,
-    0.842787, 0.844615, 0.847013, 0.849603, 0.851978, 0.853767,
-    0.854697, 0.854627, 0.853575, 0.851714, 0.84934, 0.846828,
-    0.844572, 0.842922, 0.842134, 0.842324, 0.843455, 0.845345,
-    0.847692, 0.850127, 0.852267, 0.85378, 0.854433, 0.854131,
-    0.852925, 0.851012, 0.848695, 0.846338, 0.844312, 0.84293,
-    0.842406, 0.842815, 0.844088, 0.84602, 0.848305, 0.850584,
-    0.852498, 0.853753, 0.854153, 0.853644, 0.852308, 0.850361,
-    0.848111, 0.845911, 0.844106, 0.842976, 0.842694, 0.843298,
-    0.844691, 0.846648, 0.848861, 0.850982, 0.852679, 0.85369,
-    0.853858, 0.853164, 0.85172, 0.849755, 0.847582, 0.84554,
-    0.843949, 0.843056, 0.842996, 0.843775, 0.845267, 0.847234,
-    0.849366, 0.851328, 0.852814, 0.853594, 0.853549, 0.85269,
-    0.851156, 0.849189, 0.847101, 0.845219, 0.843836, 0.843166,
-    0.843312, 0.844246, 0.845819, 0.847781, 0.849824, 0.851626,
-    0.852907, 0.853469, 0.853226, 0.852221, 0.850614, 0.848659,
-    0.846665, 0.844943, 0.843762, 0.843306, 0.843641, 0.844713,
-    0.84635, 0.848294, 0.850239, 0.85188, 0.852961, 0.853316,
-    0.852891, 0.851757, 0.850093, 0.848163, 0.84627, 0.84471,
-    0.843727, 0.843472, 0.843982, 0.845175, 0.846861, 0.848774,
-    0.850614, 0.852092, 0.852979, 0.853137, 0.852545, 0.851297,
-    0.849592, 0.847699, 0.845914, 0.844517, 0.843726, 0.843663,
-    0.844334, 0.845632, 0.847353, 0.849223, 0.850951, 0.852266,
-    0.852963, 0.852934, 0.852188, 0.850842, 0.84911, 0.847264,
-    0.845595, 0.844362, 0.843759, 0.843877, 0.844696, 0.846085,
-    0.847826, 0.849643, 0.851253, 0.852403, 0.852914, 0.852709,
-    0.851821, 0.850391, 0.848646, 0.846859, 0.845311, 0.844243,
-    0.843823, 0.844113, 0.845067, 0.846533, 0.848281, 0.850035,
-    0.85152, 0.852505, 0.852836, 0.852462, 0.851446, 0.849946,
-    0.8482, 0.846482, 0.84506, 0.844159, 0.843916, 0.84437,
-    0.845446, 0.846976, 0.848718, 0.850398, 0.851753, 0.852572,
-    0.852728, 0.852196, 0.851063, 0.849506, 0.847772, 0.846132,
-    0.844843, 0.844107, 0.844038, 0.844646, 0.845833, 0.847413,
-    0.849137, 0.850734, 0.851954, 0.852608, 0.852592, 0.851911,
-    0.850673, 0.849073, 0.847362, 0.84581, 0.844658, 0.844088,
-    0.844187, 0.84494, 0.846226, 0.847843, 0.849537, 0.851043,
-    0.852124, 0.852611, 0.852429, 0.851608, 0.850277, 0.848646,
-    0.846971, 0.845514, 0.844505, 0.8441, 0.844363, 0.845251,
-    0.846624, 0.848266, 0.849919, 0.851324, 0.852261, 0.852584,
-    0.852241, 0.851289, 0.849877, 0.848227, 0.846598, 0.845246,
-    0.844383, 0.844143, 0.844563, 0.845577, 0.847026, 0.848681,
-    0.850282, 0.851579, 0.852368, 0.852526, 0.852029, 0.850955,
-    0.849473, 0.847816, 0.846245, 0.845005, 0.844291, 0.844215,
-    0.844788, 0.845919, 0.847431, 0.849087, 0.850626, 0.851806,
-    0.852444, 0.852439, 0.851792, 0.850606, 0.849066, 0.847415,
-    0.845911, 0.844791, 0.844231, 0.844317, 0.845036, 0.846275,
-    0.847839, 0.849483, 0.850949, 0.852006, 0.85249, 0.852323,
-    0.851533, 0.850244, 0.848658, 0.847024, 0.845598, 0.844605,
-    0.8442, 0.844447, 0.845306, 0.846643, 0.848248, 0.849869,
-    0.851252, 0.852179, 0.852505, 0.852179, 0.851252, 0.849869,
-    0.848248, 0.846643, 0.845306, 0.844447, 0.8442, 0.844605,
-    0.845598, 0.847024, 0.848658, 0.850244, 0.851533, 0.852323,
-    0.85249, 0.852006, 0.850949, 0.849483, 0.847839, 0.846275,
-    0.845036, 0.844317, 0.844231, 0.844791, 0.845911, 0.847415,
-    0.849066, 0.850606, 0.851792, 0.852439, 0.852444, 0.851806,
-    0.850626, 0.849087, 0.847431, 0.845919, 0.844788, 0.844215,
-    0.844291, 0.845005, 0.846245, 0.847816, 0.849473, 0.850955,
-    0.852029, 0.852526, 0.852368, 0.851579, 0.850282, 0.848681,
-    0.847026, 0.845577, 0.844563, 0.844143, 0.844383, 0.845246,
-    0.846598, 0.848227, 0.849877, 0.851289, 0.852241, 0.852584,
-    0.852261, 0.851324, 0.849919, 0.848266, 0.846624, 0.845251,
-    0.844363, 0.8441, 0.844505, 0.845514, 0.846971, 0.848646,
-    0.850277, 0.851608, 0.852429, 0.852611, 0.852124, 0.851043,
-    0.849537, 0.847843, 0.846226, 0.84494, 0.844187, 0.844088,
-    0.844658, 0.84581, 0.847362, 0.849073, 0.850673, 0.851911,
-    0.852592, 0.852608, 0.851954, 0.850734, 0.849137, 0.847413,
-    0.845833, 0.844646, 0.844038, 0.844107, 0.844843, 0.846132,
-    0.847772, 0.849506, 0.851063, 0.852196, 0.852728, 0.852572,
-    0.851753, 0.850398, 0.848718, 0.846976, 0.845446, 0.84437,
-    0.843916, 0.844159, 0.84506, 0.846482, 0.8482, 0.849946,
-    0.851446, 0.852462, 0.852836, 0.852505, 0.85152, 0.850035,
-    0.848281, 0.846533, 0.845067, 0.844113, 0.843823, 0.844243,
-    0.845311, 0.846859, 0.848646, 0.850391, 0.851821, 0.852709,
-    0.852914, 0.852403, 0.851253, 0.849643, 0.847826, 0.846085,
-    0.844696, 0.843877, 0.843759, 0.844362, 0.845595, 0.847264,
-    0.84911, 0.850842, 0.852188, 0.852934, 0.852963, 0.852266,
-    0.850951, 0.849223, 0.847353, 0.845632, 0.844334, 0.843663,
-    0.843726, 0.844517, 0.845914, 0.847699, 0.849592, 0.851297,
-    0.852545, 0.853137, 0.852979, 0.852092, 0.850614, 0.848774,
-    0.846861, 0.845175, 0.843982, 0.843472, 0.843727, 0.84471,
-    0.84627, 0.848163, 0.850093, 0.851757, 0.852891, 0.853316,
-    0.852961, 0.85188, 0.850239, 0.848294, 0.84635, 0.844713,
-    0.843641, 0.843306, 0.843762, 0.844943, 0.846665, 0.848659,
-    0.850614, 0.852221, 0.853226, 0.853469, 0.852907, 0.851626,
-    0.849824, 0.847781, 0.845819, 0.844246, 0.843312, 0.843166,
-    0.843836, 0.845219, 0.847101, 0.849189, 0.851156, 0.85269,
-    0.853549, 0.853594, 0.852814, 0.851328, 0.849366, 0.847234,
-    0.845267, 0.843775, 0.842996, 0.843056, 0.843949, 0.84554,
-    0.847582, 0.849755, 0.85172, 0.853164, 0.853858, 0.85369,
-    0.852679, 0.850982, 0.848861, 0.846648, 0.844691, 0.843298,
-    0.842694, 0.842976, 0.844106, 0.845911, 0.848111, 0.850361,
-    0.852308, 0.853644, 0.854153, 0.853753, 0.852498, 0.850584,
-    0.848305, 0.84602, 0.844088, 0.842815, 0.842406, 0.84293,
-    0.844312, 0.846338, 0.848695, 0.851012, 0.852925, 0.854131,
-    0.854433, 0.85378, 0.852267, 0.850127, 0.847692, 0.845345,
-    0.843455, 0.842324, 0.842134, 0.842922, 0.844572, 0.846828,
-    0.84934, 0.851714, 0.853575, 0.854627, 0.854697, 0.853767,
-    0.851978, 0.849603, 0.847013, 0.844615, 0.842787, 0.841822,
-    0.841879, 0.842956, 0.844892, 0.847388, 0.850055, 0.852475,
-    0.854264, 0.855135, 0.854943, 0.85371, 0.851623, 0.849002,
-    0.846258, 0.84382, 0.842076, 0.841307, 0.841642, 0.843038,
-    0.845283, 0.848032, 0.850855, 0.853307, 0.855, 0.855658,
-    0.85517, 0.853602, 0.851192, 0.848311, 0.845411, 0.842947,
-    0.841313, 0.840774, 0.841425, 0.843175, 0.845758, 0.848775,
-    0.851755, 0.854226, 0.855794, 0.856203, 0.855377, 0.853434,
-    0.850669, 0.84751, 0.844451, 0.841977, 0.840483, 0.840215,
-    0.841229, 0.843377, 0.846334, 0.849641, 0.85278, 0.855254,
-    0.856665, 0.856778, 0.855562, 0.853194, 0.850034, 0.846572,
-    0.843351, 0.840883, 0.839566, 0.839621, 0.841056, 0.84366,
-    0.847037, 0.850661, 0.853965, 0.856422, 0.857634, 0.857394,
-    0.855722, 0.852863, 0.849255, 0.845457, 0.842068, 0.839628,
-    0.838534, 0.838978, 0.84091, 0.844045, 0.847903, 0.851885,
-    0.855362, 0.857779, 0.858739, 0.858069, 0.855852, 0.852416,
-    0.848287, 0.844108, 0.840538, 0.838151, 0.837343, 0.838265,
-    0.840797, 0.844565, 0.84899, 0.853384, 0.857051, 0.859398,
-    0.860034, 0.85883, 0.855945, 0.85181, 0.847057, 0.842429,
-    0.83866, 0.836361, 0.835923, 0.837447, 0.840726, 0.845274,
-    0.850392, 0.85528, 0.859159, 0.861397, 0.861608, 0.859719,
-    0.85599, 0.850975, 0.845445, 0.840266, 0.836266, 0.834103,
-    0.834158, 0.836468, 0.840715, 0.846265, 0.852267, 0.857777,
-    0.861911, 0.863982, 0.863614, 0.86081, 0.855959, 0.849784,
-    0.843234, 0.83734, 0.833055, 0.831099, 0.831841, 0.835232,
-    0.840801, 0.847718, 0.854919, 0.861266, 0.865726, 0.867539,
-    0.86634, 0.862236, 0.855797, 0.84798, 0.839989, 0.833093,
-    0.828423, 0.826794, 0.828562, 0.833553, 0.841076, 0.850015,
-    0.858992, 0.866573, 0.8715, 0.87289, 0.870393, 0.864264,
-    0.855346, 0.844958, 0.834707, 0.826237, 0.82098, 0.819911,
-    0.823382, 0.831033, 0.841823, 0.854163, 0.866144, 0.875822,
-    0.881528, 0.882143, 0.877305, 0.867504, 0.85405, 0.83891,
-    0.824431, 0.812993, 0.806633, 0.806704, 0.813613, 0.826702,
-    0.844276, 0.863803, 0.882247, 0.896515, 0.903936, 0.902712,
-    0.892278, 0.873491, 0.848631, 0.82118, 0.795402, 0.775765,
-    0.766287, 0.769862, 0.787691, 0.818878, 0.860272, 0.906577,
-    0.950761, 0.984696, 1, 0.988955, 0.945422, 0.865621,
-    0.748695, 0.596966, 0.415863, 0.213507, 9.10383e-15, -0.213507,
-    -0.415863, -0.596966, -0.748695, -0.865621, -0.945422, -0.988955,
-    -1, -0.984696, -0.950761, -0.906577, -0.860272, -0.818878,
-    -0.787691, -0.769862, -0.766287, -0.775765, -0.795402, -0.82118,
-    -0.848631, -0.873491, -0.892278, -0.902712, -0.903936, -0.896515,
-    -0.882247, -0.863803, -0.844276, -0.826702, -0.813613, -0.806704,
-    -0.806633, -0.812993, -0.824431, -0.83891, -0.85405, -0.867504,
-    -0.877305, -0.882143, -0.881528, -0.875822, -0.866144, -0.854163,
-    -0.841823, -0.831033, -0.823382, -0.819911, -0.82098, -0.826237,
-    -0.834707, -0.844958, -0.855346, -0.864264, -0.870393, -0.87289,
-    -0.8715, -0.866573, -0.858992, -0.850015, -0.841076, -0.833553,
-    -0.828562, -0.826794, -0.828423, -0.833093, -0.839989, -0.84798,
-    -0.855797, -0.862236, -0.86634, -0.867539, -0.865726, -0.861266,
-    -0.854919, -0.847718, -0.840801, -0.835232, -0.831841, -0.831099,
-    -0.833055, -0.83734, -0.843234, -0.849784, -0.855959, -0.86081,
-    -0.863614, -0.863982, -0.861911, -0.857777, -0.852267, -0.846265,
-    -0.840715, -0.836468, -0.834158, -0.834103, -0.836266, -0.840266,
-    -0.845445, -0.850975, -0.85599, -0.859719, -0.861608, -0.861397,
-    -0.859159, -0.85528, -0.850392, -0.845274, -0.840726, -0.837447,
-    -0.835923, -0.836361, -0.83866, -0.842429, -0.847057, -0.85181,
-    -0.855945, -0.85883, -0.860034, -0.859398, -0.857051, -0.853384,
-    -0.84899, -0.844565, -0.840797, -0.838265, -0.837343, -0.838151,
-    -0.840538, -0.844108, -0.848287, -0.852416, -0.855852, -0.858069,
-    -0.858739, -0.857779, -0.855362, -0.851885, -0.847903, -0.844045,
-    -0.84091, -0.838978, -0.838534, -0.839628, -0.842068, -0.845457,
-    -0.849255, -0.852863, -0.855722, -0.857394, -0.857634, -0.856422,
-    -0.853965, -0.850661, -0.847037, -0.84366, -0.841056, -0.839621,
-    -0.839566, -0.840883, -0.843351, -0.846572, -0.850034, -0.853194,
-    -0.855562, -0.856778, -0.856665, -0.855254, -0.85278, -0.849641,
-    -0.846334, -0.843377, -0.841229, -0.840215, -0.840483, -0.841977,
-    -0.844451, -0.84751, -0.850669, -0.853434, -0.855377, -0.856203,
-    -0.855794, -0.854226, -0.851755, -0.848775, -0.845758, -0.843175,
-    -0.841425, -0.840774, -0.841313, -0.842947, -0.845411, -0.848311,
-    -0.851192, -0.853602, -0.85517, -0.855658, -0.855, -0.853307,
-    -0.850855, -0.848032, -0.845283, -0.843038, -0.841642, -0.841307,
-    -0.842076, -0.84382, -0.846258, -0.849002, -0.851623, -0.85371,
-    -0.854943, -0.855135, -0.854264, -0.852475, -0.850055, -0.847388,
-    -0.844892, -0.842956, -0.841879, -0.841822, -0.842787, -0.844615,
-    -0.847013, -0.849603, -0.851978, -0.853767, -0.854697, -0.854627,
-    -0.853575, -0.851714, -0.84934, -0.846828, -0.844572, -0.842922,
-    -0.842134, -0.842324, -0.843455, -0.845345, -0.847692, -0.850127,
-    -0.852267, -0.85378, -0.854433, -0.854131, -0.852925, -0.851012,
-    -0.848695, -0.846338, -0.844312, -0.84293, -0.842406, -0.842815,
-    -0.844088, -0.84602, -0.848305, -0.850584, -0.852498, -0.853753,
-    -0.854153, -0.853644, -0.852308, -0.850361, -0.848111, -0.845911,
-    -0.844106, -0.842976, -0.842694, -0.843298, -0.844691, -0.846648,
-    -0.848861, -0.850982, -0.852679, -0.85369, -0.853858, -0.853164,
-    -0.85172, -0.849755, -0.847582, -0.84554, -0.843949, -0.843056,
-    -0.842996, -0.843775, -0.845267, -0.847234, -0.849366, -0.851328,
-    -0.852814, -0.853594, -0.853549, -0.85269, -0.851156, -0.849189,
-    -0.847101, -0.845219, -0.843836, -0.843166, -0.843312, -0.844246,
-    -0.845819, -0.847781, -0.849824, -0.851626, -0.852907, -0.853469,
-    -0.853226, -0.852221, -0.850614, -0.848659, -0.846665, -0.844943,
-    -0.843762, -0.843306, -0.843641, -0.844713, -0.84635, -0.848294,
-    -0.850239, -0.85188, -0.852961, -0.853316, -0.852891, -0.851757,
-    -0.850093, -0.848163, -0.84627, -0.84471, -0.843727, -0.843472,
-    -0.843982, -0.845175, -0.846861, -0.848774, -0.850614, -0.852092,
-    -0.852979, -0.853137, -0.852545, -0.851297, -0.849592, -0.847699,
-    -0.845914, -0.844517, -0.843726, -0.843663, -0.844334, -0.845632,
-    -0.847353, -0.849223, -0.850951, -0.852266, -0.852963, -0.852934,
-    -0.852188, -0.850842, -0.84911, -0.847264, -0.845595, -0.844362,
-    -0.843759, -0.843877, -0.844696, -0.846085, -0.847826, -0.849643,
-    -0.851253, -0.852403, -0.852914, -0.852709, -0.851821, -0.850391,
-    -0.848646, -0.846859, -0.845311, -0.844243, -0.843823, -0.844113,
-    -0.845067, -0.846533, -0.848281, -0.850035, -0.85152, -0.852505,
-    -0.852836, -0.852462, -0.851446, -0.849946, -0.8482, -0.846482,
-    -0.84506, -0.844159, -0.843916, -0.84437, -0.845446, -0.846976,
-    -0.848718, -0.850398, -0.851753, -0.852572, -0.852728, -0.852196,
-    -0.851063, -0.849506, -0.847772, -0.846132, -0.844843, -0.844107,
-    -0.844038, -0.844646, -0.845833, -0.847413, -0.849137, -0.850734,
-    -0.851954, -0.852608, -0.852592, -0.851911, -0.850673, -0.849073,
-    -0.847362, -0.84581, -0.844658, -0.844088, -0.844187, -0.84494,
-    -0.846226, -0.847843, -0.849537, -0.851043, -0.852124, -0.852611,
-    -0.852429, -0.851608, -0.850277, -0.848646, -0.846971, -0.845514,
-    -0.844505, -0.8441, -0.844363, -0.845251, -0.846624, -0.848266,
-    -0.849919, -0.851324, -0.852261, -0.852584, -0.852241, -0.851289,
-    -0.849877, -0.848227, -0.846598, -0.845246, -0.844383, -0.844143,
-    -0.844563, -0.845577, -0.847026, -0.848681, -0.850282, -0.851579,
-    -0.852368, -0.852526, -0.852029, -0.850955, -0.849473, -0.847816,
-    -0.846245, -0.845005, -0.844291, -0.844215, -0.844788, -0.845919,
-    -0.847431, -0.849087, -0.850626, -0.851806, -0.852444, -0.852439,
-    -0.851792, -0.850606, -0.849066, -0.847415, -0.845911, -0.844791,
-    -0.844231, -0.844317, -0.845036, -0.846275, -0.847839, -0.849483,
-    -0.850949, -0.852006, -0.85249, -0.852323, -0.851533, -0.850244,
-    -0.848658, -0.847024, -0.845598, -0.844605, -0.8442, -0.844447,
-    -0.845306, -0.846643, -0.848248, -0.849869, -0.851252, -0.852179,
-    -0.852505, -0.852179, -0.851252, -0.849869, -0.848248, -0.846643,
-    -0.845306, -0.844447, -0.8442, -0.844605, -0.845598, -0.847024,
-    -0.848658, -0.850244, -0.851533, -0.852323, -0.85249, -0.852006,
-    -0.850949, -0.849483, -0.847839, -0.846275, -0.845036, -0.844317,
-    -0.844231, -0.844791, -0.845911, -0.847415, -0.849066, -0.850606,
-    -0.851792, -0.852439, -0.852444, -0.851806, -0.850626, -0.849087,
-    -0.847431, -0.845919, -0.844788, -0.844215, -0.844291, -0.845005,
-    -0.846245, -0.847816, -0.849473, -0.850955, -0.852029, -0.852526,
-    -0.852368, -0.851579, -0.850282, -0.848681, -0.847026, -0.845577,
-    -0.844563, -0.844143, -0.844383, -0.845246, -0.846598, -0.848227,
-    -0.849877, -0.851289, -0.852241, -0.852584, -0.852261, -0.851324,
-    -0.849919, -0.848266, -0.846624, -0.845251, -0.844363, -0.8441,
-    -0.844505, -0.845514, -0.846971, -0.848646, -0.850277, -0.851608,
-    -0.852429, -0.852611, -0.852124, -0.851043, -0.849537, -0.847843,
-    -0.846226, -0.84494, -0.844187, -0.844088, -0.844658, -0.84581,
-    -0.847362, -0.849073, -0.850673, -0.851911, -0.852592, -0.852608,
-    -0.851954, -0.850734, -0.849137, -0.847413, -0.845833, -0.844646,
-    -0.844038, -0.844107, -0.844843, -0.846132, -0.847772, -0.849506,
-    -0.851063, -0.852196, -0.852728, -0.852572, -0.851753, -0.850398,
-    -0.848718, -0.846976, -0.845446, -0.84437, -0.843916, -0.844159,
-    -0.84506, -0.846482, -0.8482, -0.849946, -0.851446, -0.852462,
-    -0.852836, -0.852505, -0.85152, -0.850035, -0.848281, -0.846533,
-    -0.845067, -0.844113, -0.843823, -0.844243, -0.845311, -0.846859,
-    -0.848646, -0.850391, -0.851821, -0.852709, -0.852914, -0.852403,
-    -0.851253, -0.849643, -0.847826, -0.846085, -0.844696, -0.843877,
-    -0.843759, -0.844362, -0.845595, -0.847264, -0.84911, -0.850842,
-    -0.852188, -0.852934, -0.852963, -0.852266, -0.850951, -0.849223,
-    -0.847353, -0.845632, -0.844334, -0.843663, -0.843726, -0.844517,
-    -0.845914, -0.847699, -0.849592, -0.851297, -0.852545, -0.853137,
-    -0.852979, -0.852092, -0.850614, -0.848774, -0.846861, -0.845175,
-    -0.843982, -0.843472, -0.843727, -0.84471, -0.84627, -0.848163,
-    -0.850093, -0.851757, -0.852891, -0.853316, -0.852961, -0.85188,
-    -0.850239, -0.848294, -0.84635, -0.844713, -0.843641, -0.843306,
-    -0.843762, -0.844943, -0.846665, -0.848659, -0.850614, -0.852221,
-    -0.853226, -0.853469, -0.852907, -0.851626, -0.849824, -0.847781,
-    -0.845819, -0.844246, -0.843312, -0.843166, -0.843836, -0.845219,
-    -0.847101, -0.849189, -0.851156, -0.85269, -0.853549, -0.853594,
-    -0.852814, -0.851328, -0.849366, -0.847234, -0.845267, -0.843775,
-    -0.842996, -0.843056, -0.843949, -0.84554, -0.847582, -0.849755,
-    -0.85172, -0.853164, -0.853858, -0.85369, -0.852679, -0.850982,
-    -0.848861, -0.846648, -0.844691, -0.843298, -0.842694, -0.842976,
-    -0.844106, -0.845911, -0.848111, -0.850361, -0.852308, -0.853644,
-    -0.854153, -0.853753, -0.852498, -0.850584, -0.848305, -0.84602,
-    -0.844088, -0.842815, -0.842406, -0.84293, -0.844312, -0.846338,
-    -0.848695, -0.851012, -0.852925, -0.854131, -0.854433, -0.85378,
-    -0.852267, -0.850127, -0.847692, -0.845345, -0.843455, -0.842324,
-    -0.842134, -0.842922, -0.844572, -0.846828, -0.84934, -0.851714,
-    -0.853575, -0.854627, -0.854697, -0.853767, -0.851978, -0.849603,
-    -0.847013, -0.844615, -0.842787, -0.841822, -0.841879, -0.842956,
-    -0.844892, -0.847388, -0.850055, -0.852475, -0.854264, -0.855135,
-    -0.854943, -0.85371, -0.851623, -0.849002, -0.846258, -0.84382,
-    -0.842076, -0.841307, -0.841642, -0.843038, -0.845283, -0.848032,
-    -0.850855, -0.853307, -0.855, -0.855658, -0.85517, -0.853602,
-    -0.851192, -0.848311, -0.845411, -0.842947, -0.841313, -0.840774,
-    -0.841425, -0.843175, -0.845758, -0.848775, -0.851755, -0.854226,
-    -0.855794, -0.856203, -0.855377, -0.853434, -0.850669, -0.84751,
-    -0.844451, -0.841977, -0.840483, -0.840215, -0.841229, -0.843377,
-    -0.846334, -0.849641, -0.85278, -0.855254, -0.856665, -0.856778,
-    -0.855562, -0.853194, -0.850034, -0.846572, -0.843351, -0.840883,
-    -0.839566, -0.839621, -0.841056, -0.84366, -0.847037, -0.850661,
-    -0.853965, -0.856422, -0.857634, -0.857394, -0.855722, -0.852863,
-    -0.849255, -0.845457, -0.842068, -0.839628, -0.838534, -0.838978,
-    -0.84091, -0.844045, -0.847903, -0.851885, -0.855362, -0.857779,
-    -0.858739, -0.858069, -0.855852, -0.852416, -0.848287, -0.844108,
-    -0.840538, -0.838151, -0.837343, -0.838265, -0.840797, -0.844565,
-    -0.84899, -0.853384, -0.857051, -0.859398, -0.860034, -0.85883,
-    -0.855945, -0.85181, -0.847057, -0.842429, -0.83866, -0.836361,
-    -0.835923, -0.837447, -0.840726, -0.845274, -0.850392, -0.85528,
-    -0.859159, -0.861397, -0.861608, -0.859719, -0.85599, -0.850975,
-    -0.845445, -0.840266, -0.836266, -0.834103, -0.834158, -0.836468,
-    -0.840715, -0.846265, -0.852267, -0.857777, -0.861911, -0.863982,
-    -0.863614, -0.86081, -0.855959, -0.849784, -0.843234, -0.83734,
-    -0.833055, -0.831099, -0.831841, -0.835232, -0.840801, -0.847718,
-    -0.854919, -0.861266, -0.865726, -0.867539, -0.86634, -0.862236,
-    -0.855797, -0.84798, -0.839989, -0.833093, -0.828423, -0.826794,
-    -0.828562, -0.833553, -0.841076, -0.850015, -0.858992, -0.866573,
-    -0.8715, -0.87289, -0.870393, -0.864264, -0.855346, -0.844958,
-    -0.834707, -0.826237, -0.82098, -0.819911, -0.823382, -0.831033,
-    -0.841823, -0.854163, -0.866144, -0.875822, -0.881528, -0.882143,
-    -0.877305, -0.867504, -0.85405, -0.83891, -0.824431, -0.812993,
-    -0.806633, -0.806704, -0.813613, -0.826702, -0.844276, -0.863803,
-    -0.882247, -0.896515, -0.903936, -0.902712, -0.892278, -0.873491,
-    -0.848631, -0.82118, -0.795402, -0.775765, -0.766287, -0.769862,
-    -0.787691, -0.818878, -0.860272, -0.906577, -0.950761, -0.984696,
-    -1, -0.988955, -0.945422, -0.865621, -0.748695, -0.596966,
-    -0.415863, -0.213507
-};
-
-static const float WAVE_SQUARE_066[DEFAULT_WAVELEN] = {
-    -1.11022e-16, 0.10579, 0.210225, 0.311984, 0.409803, 0.502513,
-    0.589057, 0.668521, 0.740148, 0.803355, 0.857742, 0.9031,
-    0.939408, 0.966832, 0.985712, 0.996552, 1, 0.996828,
-    0.987907, 0.974183, 0.956649, 0.936317, 0.914194, 0.89125,
-    0.868399, 0.846477, 0.82622, 0.808252, 0.793072, 0.781048,
-    0.772412, 0.767265, 0.765576, 0.767196, 0.771868, 0.779242,
-    0.788889, 0.800326, 0.81303, 0.826459, 0.840074, 0.853356,
-    0.865822, 0.877043, 0.886654, 0.894367, 0.899974, 0.903355,
-    0.904475, 0.903385, 0.900215, 0.895166, 0.8885, 0.88053,
-    0.871605, 0.862096, 0.852383, 0.842839, 0.83382, 0.825648,
-    0.818604, 0.812917, 0.808758, 0.806237, 0.805397, 0.80622,
-    0.808623, 0.812469, 0.817571, 0.823698, 0.83059, 0.837964,
-    0.845527, 0.852989, 0.860068, 0.866506, 0.872076, 0.876589,
-    0.8799, 0.881914, 0.882587, 0.881925, 0.879986, 0.876874,
-    0.872734, 0.867748, 0.862124, 0.85609, 0.849884, 0.843747,
-    0.83791, 0.832588, 0.827973, 0.824225, 0.821468, 0.819788,
-    0.819226, 0.81978, 0.821409, 0.824028, 0.827518, 0.83173,
-    0.83649, 0.841607, 0.846878, 0.852101, 0.857077, 0.861622,
-    0.86557, 0.868782, 0.871147, 0.872592, 0.873076, 0.872597,
-    0.871191, 0.868926, 0.865902, 0.862249, 0.858114, 0.853663,
-    0.849072, 0.844517, 0.840171, 0.836197, 0.83274, 0.829925,
-    0.827848, 0.826579, 0.826154, 0.826575, 0.827815, 0.829815,
-    0.832487, 0.83572, 0.839383, 0.843329, 0.847405, 0.851452,
-    0.855318, 0.858856, 0.861937, 0.864448, 0.866302, 0.867436,
-    0.867817, 0.86744, 0.866328, 0.864534, 0.862135, 0.859229,
-    0.855935, 0.852383, 0.848711, 0.845061, 0.841573, 0.838377,
-    0.835593, 0.833321, 0.831643, 0.830615, 0.83027, 0.830613,
-    0.831622, 0.833252, 0.835434, 0.838078, 0.841078, 0.844315,
-    0.847663, 0.850993, 0.854178, 0.857098, 0.859644, 0.861722,
-    0.863259, 0.8642, 0.864517, 0.864202, 0.863276, 0.861779,
-    0.859774, 0.857343, 0.854583, 0.851604, 0.84852, 0.845451,
-    0.842514, 0.83982, 0.83747, 0.83555, 0.83413, 0.83326,
-    0.832967, 0.833258, 0.834116, 0.835503, 0.837362, 0.839617,
-    0.842178, 0.844944, 0.847809, 0.850661, 0.853392, 0.855898,
-    0.858085, 0.859872, 0.861195, 0.862006, 0.862279, 0.862008,
-    0.861207, 0.859912, 0.858175, 0.856068, 0.853674, 0.851086,
-    0.848406, 0.845736, 0.843179, 0.840831, 0.838781, 0.837105,
-    0.835864, 0.835103, 0.834847, 0.835102, 0.835854, 0.837071,
-    0.838704, 0.840686, 0.842939, 0.845375, 0.847899, 0.850415,
-    0.852825, 0.855038, 0.856972, 0.858553, 0.859724, 0.860443,
-    0.860685, 0.860444, 0.859733, 0.858581, 0.857037, 0.855162,
-    0.85303, 0.850723, 0.848333, 0.84595, 0.843665, 0.841567,
-    0.839733, 0.838233, 0.837122, 0.83644, 0.83621, 0.836439,
-    0.837115, 0.838209, 0.839677, 0.84146, 0.843489, 0.845684,
-    0.84796, 0.850229, 0.852405, 0.854404, 0.856152, 0.857582,
-    0.858641, 0.859292, 0.859511, 0.859293, 0.858648, 0.857603,
-    0.8562, 0.854496, 0.852557, 0.850459, 0.848282, 0.846112,
-    0.84403, 0.842116, 0.840443, 0.839073, 0.838058, 0.837435,
-    0.837225, 0.837434, 0.838053, 0.839055, 0.8404, 0.842036,
-    0.843897, 0.845912, 0.848002, 0.850088, 0.852088, 0.853927,
-    0.855535, 0.856852, 0.857829, 0.858428, 0.858631, 0.858429,
-    0.857833, 0.856868, 0.855572, 0.853997, 0.852203, 0.850261,
-    0.848246, 0.846235, 0.844305, 0.842531, 0.840979, 0.839708,
-    0.838765, 0.838186, 0.837991, 0.838185, 0.838761, 0.839694,
-    0.840947, 0.84247, 0.844205, 0.846084, 0.848034, 0.84998,
-    0.851848, 0.853566, 0.855069, 0.8563, 0.857214, 0.857775,
-    0.857964, 0.857775, 0.857217, 0.856313, 0.855097, 0.853619,
-    0.851935, 0.850111, 0.848218, 0.846328, 0.844514, 0.842845,
-    0.841384, 0.840188, 0.8393, 0.838754, 0.83857, 0.838754,
-    0.839297, 0.840177, 0.84136, 0.842799, 0.844438, 0.846214,
-    0.848058, 0.849899, 0.851667, 0.853294, 0.854718, 0.855884,
-    0.85675, 0.857282, 0.857462, 0.857283, 0.856753, 0.855893,
-    0.854739, 0.853333, 0.851733, 0.849998, 0.848196, 0.846397,
-    0.844669, 0.843079, 0.841687, 0.840547, 0.8397, 0.839179,
-    0.839004, 0.839179, 0.839698, 0.840539, 0.84167, 0.843046,
-    0.844614, 0.846313, 0.848078, 0.849841, 0.851534, 0.853093,
-    0.854458, 0.855577, 0.856407, 0.856918, 0.85709, 0.856918,
-    0.856409, 0.855583, 0.854473, 0.853122, 0.851582, 0.849912,
-    0.848178, 0.846446, 0.844781, 0.843249, 0.841907, 0.840807,
-    0.839991, 0.839488, 0.839319, 0.839488, 0.839989, 0.840802,
-    0.841895, 0.843225, 0.844742, 0.846386, 0.848095, 0.849802,
-    0.851442, 0.852952, 0.854275, 0.855359, 0.856165, 0.85666,
-    0.856827, 0.85666, 0.856166, 0.855364, 0.854285, 0.852971,
-    0.851474, 0.84985, 0.848163, 0.846476, 0.844856, 0.843364,
-    0.842056, 0.840984, 0.840188, 0.839698, 0.839533, 0.839698,
-    0.840187, 0.840981, 0.842048, 0.843348, 0.844831, 0.846438,
-    0.848109, 0.849779, 0.851384, 0.852863, 0.854158, 0.85522,
-    0.856009, 0.856495, 0.856659, 0.856495, 0.85601, 0.855223,
-    0.854164, 0.852874, 0.851403, 0.849807, 0.848149, 0.846491,
-    0.844897, 0.843429, 0.842142, 0.841087, 0.840303, 0.83982,
-    0.839657, 0.83982, 0.840302, 0.841085, 0.842138, 0.843421,
-    0.844885, 0.846472, 0.848123, 0.849773, 0.851359, 0.852821,
-    0.854102, 0.855153, 0.855934, 0.856415, 0.856577, 0.856415,
-    0.855934, 0.855154, 0.854104, 0.852825, 0.851365, 0.849782,
-    0.848136, 0.846489, 0.844906, 0.843448, 0.842169, 0.84112,
-    0.84034, 0.83986, 0.839698, 0.83986, 0.84034, 0.84112,
-    0.842169, 0.843448, 0.844906, 0.846489, 0.848136, 0.849782,
-    0.851365, 0.852825, 0.854104, 0.855154, 0.855934, 0.856415,
-    0.856577, 0.856415, 0.855934, 0.855153, 0.854102, 0.852821,
-    0.851359, 0.849773, 0.848123, 0.846472, 0.844885, 0.843421,
-    0.842138, 0.841085, 0.840302, 0.83982, 0.839657, 0.83982,
-    0.840303, 0.841087, 0.842142, 0.843429, 0.844897, 0.846491,
-    0.848149, 0.849807, 0.851403, 0.852874, 0.854164, 0.855223,
-    0.85601, 0.856495, 0.856659, 0.856495, 0.856009, 0.85522,
-    0.854158, 0.852863, 0.851384, 0.849779, 0.848109, 0.846438,
-    0.844831, 0.843348, 0.842048, 0.840981, 0.840187, 0.839698,
-    0.839533, 0.839698, 0.840188, 0.840984, 0.842056, 0.843364,
-    0.844856, 0.846476, 0.848163, 0.84985, 0.851474, 0.852971,
-    0.854285, 0.855364, 0.856166, 0.85666, 0.856827, 0.85666,
-    0.856165, 0.855359, 0.854275, 0.852952, 0.851442, 0.849802,
-    0.848095, 0.846386, 0.844742, 0.843225, 0.841895, 0.840802,
-    0.839989, 0.839488, 0.839319, 0.839488, 0.839991, 0.840807,
-    0.841907, 0.843249, 0.844781, 0.846446, 0.848178, 0.849912,
-    0.851582, 0.853122, 0.854473, 0.855583, 0.856409, 0.856918,
-    0.85709, 0.856918, 0.856407, 0.855577, 0.854458, 0.853093,
-    0.851534, 0.849841, 0.848078, 0.846313, 0.844614, 0.843046,
-    0.84167, 0.840539, 0.839698, 0.839179, 0.839004, 0.839179,
-    0.8397, 0.840547, 0.841687, 0.843079, 0.844669, 0.846397,
-    0.848196, 0.849998, 0.851733, 0.853333, 0.854739, 0.855893,
-    0.856753, 0.857283, 0.857462, 0.857282, 0.85675, 0.855884,
-    0.854718, 0.853294, 0.851667, 0.849899, 0.848058, 0.846214,
-    0.844438, 0.842799, 0.84136, 0.840177, 0.839297, 0.838754,
-    0.83857, 0.838754, 0.8393, 0.840188, 0.841384, 0.842845,
-    0.844514, 0.846328, 0.848218, 0.850111, 0.851935, 0.853619,
-    0.855097, 0.856313, 0.857217, 0.857775, 0.857964, 0.857775,
-    0.857214, 0.8563, 0.855069, 0.853566, 0.851848, 0.84998,
-    0.848034, 0.846084, 0.844205, 0.84247, 0.840947, 0.839694,
-    0.838761, 0.838185, 0.837991, 0.838186, 0.838765, 0.839708,
-    0.840979, 0.842531, 0.844305, 0.846235, 0.848246, 0.850261,
-    0.852203, 0.853997, 0.855572, 0.856868, 0.857833, 0.858429,
-    0.858631, 0.858428, 0.857829, 0.856852, 0.855535, 0.853927,
-    0.852088, 0.850088, 0.848002, 0.845912, 0.843897, 0.842036,
-    0.8404, 0.839055, 0.838053, 0.837434, 0.837225, 0.837435,
-    0.838058, 0.839073, 0.840443, 0.842116, 0.84403, 0.846112,
-    0.848282, 0.850459, 0.852557, 0.854496, 0.8562, 0.857603,
-    0.858648, 0.859293, 0.859511, 0.859292, 0.858641, 0.857582,
-    0.856152, 0.854404, 0.852405, 0.850229, 0.84796, 0.845684,
-    0.843489, 0.84146, 0.839677, 0.838209, 0.837115, 0.836439,
-    0.83621, 0.83644, 0.837122, 0.838233, 0.839733, 0.841567,
-    0.843665, 0.84595, 0.848333, 0.850723, 0.85303, 0.855162,
-    0.857037, 0.858581, 0.859733, 0.860444, 0.860685, 0.860443,
-    0.859724, 0.858553, 0.856972, 0.855038, 0.852825, 0.850415,
-    0.847899, 0.845375, 0.842939, 0.840686, 0.838704, 0.837071,
-    0.835854, 0.835102, 0.834847, 0.835103, 0.835864, 0.837105,
-    0.838781, 0.840831, 0.843179, 0.845736, 0.848406, 0.851086,
-    0.853674, 0.856068, 0.858175, 0.859912, 0.861207, 0.862008,
-    0.862279, 0.862006, 0.861195, 0.859872, 0.858085, 0.855898,
-    0.853392, 0.850661, 0.847809, 0.844944, 0.842178, 0.839617,
-    0.837362, 0.835503, 0.834116, 0.833258, 0.832967, 0.83326,
-    0.83413, 0.83555, 0.83747, 0.83982, 0.842514, 0.845451,
-    0.84852, 0.851604, 0.854583, 0.857343, 0.859774, 0.861779,
-    0.863276, 0.864202, 0.864517, 0.8642, 0.863259, 0.861722,
-    0.859644, 0.857098, 0.854178, 0.850993, 0.847663, 0.844315,
-    0.841078, 0.838078, 0.835434, 0.833252, 0.831622, 0.830613,
-    0.83027, 0.830615, 0.831643, 0.833321, 0.835593, 0.838377,
-    0.841573, 0.845061, 0.848711, 0.852383, 0.855935, 0.859229,
-    0.862135, 0.864534, 0.866328, 0.86744, 0.867817, 0.867436,
-    0.866302, 0.864448, 0.861937, 0.858856, 0.855318, 0.851452,
-    0.847405, 0.843329, 0.839383, 0.83572, 0.832487, 0.829815,
-    0.827815, 0.826575, 0.826154, 0.826579, 0.827848, 0.829925,
-    0.83274, 0.836197, 0.840171, 0.844517, 0.849072, 0.853663,
-    0.858114, 0.862249, 0.865902, 0.868926, 0.871191, 0.872597,
-    0.873076, 0.872592, 0.871147, 0.868782, 0.86557, 0.861622,
-    0.857077, 0.852101, 0.846878, 0.841607, 0.83649, 0.83173,
-    0.827518, 0.824028, 0.821409, 0.81978, 0.819226, 0.819788,
-    0.821468, 0.824225, 0.827973, 0.832588, 0.83791, 0.843747,
-    0.849884, 0.85609, 0.862124, 0.867748, 0.872734, 0.876874,
-    0.879986, 0.881925, 0.882587, 0.881914, 0.8799, 0.876589,
-    0.872076, 0.866506, 0.860068, 0.852989, 0.845527, 0.837964,
-    0.83059, 0.823698, 0.817571, 0.812469, 0.808623, 0.80622,
-    0.805397, 0.806237, 0.808758, 0.812917, 0.818604, 0.825648,
-    0.83382, 0.842839, 0.852383, 0.862096, 0.871605, 0.88053,
-    0.8885, 0.895166, 0.900215, 0.903385, 0.904475, 0.903355,
-    0.899974, 0.894367, 0.886654, 0.877043, 0.865822, 0.853356,
-    0.840074, 0.826459, 0.81303, 0.800326, 0.788889, 0.779242,
-    0.771868, 0.767196, 0.765576, 0.767265, 0.772412, 0.781048,
-    0.793072, 0.808252, 0.82622, 0.846477, 0.868399, 0.89125,
-    0.914194, 0.936317, 0.956649, 0.974183, 0.987907, 0.996828,
-    1, 0.996552, 0.985712, 0.966832, 0.939408, 0.9031,
-    0.857742, 0.803355, 0.740148, 0.668521, 0.589057, 0.502513,
-    0.409803, 0.311984, 0.210225, 0.10579, 4.44089e-15, -0.10579,
-    -0.210225, -0.311984, -0.409803, -0.502513, -0.589057, -0.668521,
-    -0.740148, -0.803355, -0.857742, -0.9031, -0.939408, -0.966832,
-    -0.985712, -0.996552, -1, -0.996828, -0.987907, -0.974183,
-    -0.956649, -0.936317, -0.914194, -0.89125, -0.868399, -0.846477,
-    -0.82622, -0.808252, -0.793072, -0.781048, -0.772412, -0.767265,
-    -0.765576, -0.767196, -0.771868, -0.779242, -0.788889, -0.800326,
-    -0.81303, -0.826459, -0.840074, -0.853356, -0.865822, -0.877043,
-    -0.886654, -0.894367, -0.899974, -0.903355, -0.904475, -0.903385,
-    -0.900215, -0.895166, -0.8885, -0.88053, -0.871605, -0.862096,
-    -0.852383, -0.842839, -0.83382, -0.825648, -0.818604, -0.812917,
-    -0.808758, -0.806237, -0.805397, -0.80622, -0.808623, -0.812469,
-    -0.817571, -0.823698, -0.83059, -0.837964, -0.845527, -0.852989,
-    -0.860068, -0.866506, -0.872076, -0.876589, -0.8799, -0.881914,
-    -0.882587, -0.881925, -0.879986, -0.876874, -0.872734, -0.867748,
-    -0.862124, -0.85609, -0.849884, -0.843747, -0.83791, -0.832588,
-    -0.827973, -0.824225, -0.821468, -0.819788, -0.819226, -0.81978,
-    -0.821409, -0.824028, -0.827518, -0.83173, -0.83649, -0.841607,
-    -0.846878, -0.852101, -0.857077, -0.861622, -0.86557, -0.868782,
-    -0.871147, -0.872592, -0.873076, -0.872597, -0.871191, -0.868926,
-    -0.865902, -0.862249, -0.858114, -0.853663, -0.849072, -0.844517,
-    -0.840171, -0.836197, -0.83274, -0.829925, -0.827848, -0.826579,
-    -0.826154, -0.826575, -0.827815, -0.829815, -0.832487, -0.83572,
-    -0.839383, -0.843329, -0.847405, -0.851452, -0.855318, -0.858856,
-    -0.861937, -0.864448, -0.866302, -0.867436, -0.867817, -0.86744,
-    -0.866328, -0.864534, -0.862135, -0.859229, -0.855935, -0.852383,
-    -0.848711, -0.845061, -0.841573, -0.838377, -0.835593, -0.833321,
-    -0.831643, -0.830615, -0.83027, -0.830613, -0.831622, -0.833252,
-    -0.835434, -0.838078, -0.841078, -0.844315, -0.847663, -0.850993,
-    -0.854178, -0.857098, -0.859644, -0.861722, -0.863259, -0.8642,
-    -0.864517, -0.864202, -0.863276, -0.861779, -0.859774, -0.857343,
-    -0.854583, -0.851604, -0.84852, -0.845451, -0.842514, -0.83982,
-    -0.83747, -0.83555, -0.83413, -0.83326, -0.832967, -0.833258,
-    -0.834116, -0.835503, -0.837362, -0.839617, -0.842178, -0.844944,
-    -0.847809, -0.850661, -0.853392, -0.855898, -0.858085, -0.859872,
-    -0.861195, -0.862006, -0.862279, -0.862008, -0.861207, -0.859912,
-    -0.858175, -0.856068, -0.853674, -0.851086, -0.848406, -0.845736,
-    -0.843179, -0.840831, -0.838781, -0.837105, -0.835864, -0.835103,
-    -0.834847, -0.835102, -0.835854, -0.837071, -0.838704, -0.840686,
-    -0.842939, -0.845375, -0.847899, -0.850415, -0.852825, -0.855038,
-    -0.856972, -0.858553, -0.859724, -0.860443, -0.860685, -0.860444,
-    -0.859733, -0.858581, -0.857037, -0.855162, -0.85303, -0.850723,
-    -0.848333, -0.84595, -0.843665, -0.841567, -0.839733, -0.838233,
-    -0.837122, -0.83644, -0.83621, -0.836439, -0.837115, -0.838209,
-    -0.839677, -0.84146, -0.843489, -0.845684, -0.84796, -0.850229,
-    -0.852405, -0.854404, -0.856152, -0.857582, -0.858641, -0.859292,
-    -0.859511, -0.859293, -0.858648, -0.857603, -0.8562, -0.854496,
-    -0.852557, -0.850459, -0.848282, -0.846112, -0.84403, -0.842116,
-    -0.840443, -0.839073, -0.838058, -0.837435, -0.837225, -0.837434,
-    -0.838053, -0.839055, -0.8404, -0.842036, -0.843897, -0.845912,
-    -0.848002, -0.850088, -0.852088, -0.853927, -0.855535, -0.856852,
-    -0.857829, -0.858428, -0.858631, -0.858429, -0.857833, -0.856868,
-    -0.855572, -0.853997, -0.852203, -0.850261, -0.848246, -0.846235,
-    -0.844305, -0.842531, -0.840979, -0.839708, -0.838765, -0.838186,
-    -0.837991, -0.838185, -0.838761, -0.839694, -0.840947, -0.84247,
-    -0.844205, -0.846084, -0.848034, -0.84998, -0.851848, -0.853566,
-    -0.855069, -0.8563, -0.857214, -0.857775, -0.857964, -0.857775,
-    -0.857217, -0.856313, -0.855097, -0.853619, -0.851935, -0.850111,
-    -0.848218, -0.846328, -0.844514, -0.842845, -0.841384, -0.840188,
-    -0.8393, -0.838754, -0.83857, -0.838754, -0.839297, -0.840177,
-    -0.84136, -0.842799, -0.844438, -0.846214, -0.848058, -0.849899,
-    -0.851667, -0.853294, -0.854718, -0.855884, -0.85675, -0.857282,
-    -0.857462, -0.857283, -0.856753, -0.855893, -0.854739, -0.853333,
-    -0.851733, -0.849998, -0.848196, -0.846397, -0.844669, -0.843079,
-    -0.841687, -0.840547, -0.8397, -0.839179, -0.839004, -0.839179,
-    -0.839698, -0.840539, -0.84167, -0.843046, -0.844614, -0.846313,
-    -0.848078, -0.849841, -0.851534, -0.853093, -0.854458, -0.855577,
-    -0.856407, -0.856918, -0.85709, -0.856918, -0.856409, -0.855583,
-    -0.854473, -0.853122, -0.851582, -0.849912, -0.848178, -0.846446,
-    -0.844781, -0.843249, -0.841907, -0.840807, -0.839991, -0.839488,
-    -0.839319, -0.839488, -0.839989, -0.840802, -0.841895, -0.843225,
-    -0.844742, -0.846386, -0.848095, -0.849802, -0.851442, -0.852952,
-    -0.854275, -0.855359, -0.856165, -0.85666, -0.856827, -0.85666,
-    -0.856166, -0.855364, -0.854285, -0.852971, -0.851474, -0.84985,
-    -0.848163, -0.846476, -0.844856, -0.843364, -0.842056, -0.840984,
-    -0.840188, -0.839698, -0.839533, -0.839698, -0.840187, -0.840981,
-    -0.842048, -0.843348, -0.844831, -0.846438, -0.848109, -0.849779,
-    -0.851384, -0.852863, -0.854158, -0.85522, -0.856009, -0.856495,
-    -0.856659, -0.856495, -0.85601, -0.855223, -0.854164, -0.852874,
-    -0.851403, -0.849807, -0.848149, -0.846491, -0.844897, -0.843429,
-    -0.842142, -0.841087, -0.840303, -0.83982, -0.839657, -0.83982,
-    -0.840302, -0.841085, -0.842138, -0.843421, -0.844885, -0.846472,
-    -0.848123, -0.849773, -0.851359, -0.852821, -0.854102, -0.855153,
-    -0.855934, -0.856415, -0.856577, -0.856415, -0.855934, -0.855154,
-    -0.854104, -0.852825, -0.851365, -0.849782, -0.848136, -0.846489,
-    -0.844906, -0.843448, -0.842169, -0.84112, -0.84034, -0.83986,
-    -0.839698, -0.83986, -0.84034, -0.84112, -0.842169, -0.843448,
-    -0.844906, -0.846489, -0.848136, -0.849782, -0.851365, -0.852825,
-    -0.854104, -0.855154, -0.855934, -0.856415, -0.856577, -0.856415,
-    -0.855934, -0.855153, -0.854102, -0.852821, -0.851359, -0.849773,
-    -0.848123, -0.846472, -0.844885, -0.843421, -0.842138, -0.841085,
-    -0.840302, -0.83982, -0.839657, -0.83982, -0.840303, -0.841087,
-    -0.842142, -0.843429, -0.844897, -0.846491, -0.848149, -0.849807,
-    -0.851403, -0.852874, -0.854164, -0.855223, -0.85601, -0.856495,
-    -0.856659, -0.856495, -0.856009, -0.85522, -0.854158, -0.852863,
-    -0.851384, -0.849779, -0.848109, -0.846438, -0.844831, -0.843348,
-    -0.842048, -0.840981, -0.840187, -0.839698, -0.839533, -0.839698,
-    -0.840188, -0.840984, -0.842056, -0.843364, -0.844856, -0.846476,
-    -0.848163, -0.84985, -0.851474, -0.852971, -0.854285, -0.855364,
-    -0.856166, -0.85666, -0.856827, -0.85666, -0.856165, -0.855359,
-    -0.854275, -0.852952, -0.851442, -0.849802, -0.848095, -0.846386,
-    -0.844742, -0.843225, -0.841895, -0.840802, -0.839989, -0.839488,
-    -0.839319, -0.839488, -0.839991, -0.840807, -0.841907, -0.843249,
-    -0.844781, -0.846446, -0.848178, -0.849912, -0.851582, -0.853122,
-    -0.854473, -0.855583, -0.856409, -0.856918, -0.85709, -0.856918,
-    -0.856407, -0.855577, -0.854458, -0.853093, -0.851534, -0.849841,
-    -0.848078, -0.846313, -0.844614, -0.843046, -0.84167, -0.840539,
-    -0.839698, -0.839179, -0.839004, -0.839179, -0.8397, -0.840547,
-    -0.841687, -0.843079, -0.844669, -0.846397, -0.848196, -0.849998,
-    -0.851733, -0.853333, -0.854739, -0.855893, -0.856753, -0.857283,
-    -0.857462, -0.857282, -0.85675, -0.855884, -0.854718, -0.853294,
-    -0.851667, -0.849899, -0.848058, -0.846214, -0.844438, -0.842799,
-    -0.84136, -0.840177, -0.839297, -0.838754, -0.83857, -0.838754,
-    -0.8393, -0.840188, -0.841384, -0.842845, -0.844514, -0.846328,
-    -0.848218, -0.850111, -0.851935, -0.853619, -0.855097, -0.856313,
-    -0.857217, -0.857775, -0.857964, -0.857775, -0.857214, -0.8563,
-    -0.855069, -0.853566, -0.851848, -0.84998, -0.848034, -0.846084,
-    -0.844205, -0.84247, -0.840947, -0.839694, -0.838761, -0.838185,
-    -0.837991, -0.838186, -0.838765, -0.839708, -0.840979, -0.842531,
-    -0.844305, -0.846235, -0.848246, -0.850261, -0.852203, -0.853997,
-    -0.855572, -0.856868, -0.857833, -0.858429, -0.858631, -0.858428,
-    -0.857829, -0.856852, -0.855535, -0.853927, -0.852088, -0.850088,
-    -0.848002, -0.845912, -0.843897, -0.842036, -0.8404, -0.839055,
-    -0.838053, -0.837434, -0.837225, -0.837435, -0.838058, -0.839073,
-    -0.840443, -0.842116, -0.84403, -0.846112, -0.848282, -0.850459,
-    -0.852557, -0.854496, -0.8562, -0.857603, -0.858648, -0.859293,
-    -0.859511, -0.859292, -0.858641, -0.857582, -0.856152, -0.854404,
-    -0.852405, -0.850229, -0.84796, -0.845684, -0.843489, -0.84146,
-    -0.839677, -0.838209, -0.837115, -0.836439, -0.83621, -0.83644,
-    -0.837122, -0.838233, -0.839733, -0.841567, -0.843665, -0.84595,
-    -0.848333, -0.850723, -0.85303, -0.855162, -0.857037, -0.858581,
-    -0.859733, -0.860444, -0.860685, -0.860443, -0.859724, -0.858553,
-    -0.856972, -0.855038, -0.852825, -0.850415, -0.847899, -0.845375,
-    -0.842939, -0.840686, -0.838704, -0.837071, -0.835854, -0.835102,
-    -0.834847, -0.835103, -0.835864, -0.837105, -0.838781, -0.840831,
-    -0.843179, -0.845736, -0.848406, -0.851086, -0.853674, -0.856068,
-    -0.858175, -0.859912, -0.861207, -0.862008, -0.862279, -0.862006,
-    -0.861195, -0.859872, -0.858085, -0.855898, -0.853392, -0.850661,
-    -0.847809, -0.844944, -0.842178, -0.839617, -0.837362, -0.835503,
-    -0.834116, -0.833258, -0.832967, -0.83326, -0.83413, -0.83555,
-    -0.83747, -0.83982, -0.842514, -0.845451, -0.84852, -0.851604,
-    -0.854583, -0.857343, -0.859774, -0.861779, -0.863276, -0.864202,
-    -0.864517, -0.8642, -0.863259, -0.861722, -0.859644, -0.857098,
-    -0.854178, -0.850993, -0.847663, -0.844315, -0.841078, -0.838078,
-    -0.835434, -0.833252, -0.831622, -0.830613, -0.83027, -0.830615,
-    -0.831643, -0.833321, -0.835593, -0.838377, -0.841573, -0.845061,
-    -0.848711, -0.852383, -0.855935, -0.859229, -0.862135, -0.864534,
-    -0.866328, -0.86744, -0.867817, -0.867436, -0.866302, -0.864448,
-    -0.861937, -0.858856, -0.855318, -0.851452, -0.847405, -0.843329,
-    -0.839383, -0.83572, -0.832487, -0.829815, -0.827815, -0.826575,
-    -0.826154, -0.826579, -0.827848, -0.829925, -0.83274, -0.836197,
-    -0.840171, -0.844517, -0.849072, -0.853663, -0.858114, -0.862249,
-    -0.865902, -0.868926, -0.871191, -0.872597, -0.873076, -0.872592,
-    -0.871147, -0.868782, -0.86557, -0.861622, -0.857077, -0.852101,
-    -0.846878, -0.841607, -0.83649, -0.83173, -0.827518, -0.824028,
-    -0.821409, -0.81978, -0.819226, -0.819788, -0.821468, -0.824225,
-    -0.827973, -0.832588, -0.83791, -0.843747, -0.849884, -0.85609,
-    -0.862124, -0.867748, -0.872734, -0.876874, -0.879986, -0.881925,
-    -0.882587, -0.881914, -0.8799, -0.876589, -0.872076, -0.866506,
-    -0.860068, -0.852989, -0.845527, -0.837964, -0.83059, -0.823698,
-    -0.817571, -0.812469, -0.808623, -0.80622, -0.805397, -0.806237,
-    -0.808758, -0.812917, -0.818604, -0.825648, -0.83382, -0.842839,
-    -0.852383, -0.862096, -0.871605, -0.88053, -0.8885, -0.895166,
-    -0.900215, -0.903385, -0.904475, -0.903355, -0.899974, -0.894367,
-    -0.886654, -0.877043, -0.865822, -0.853356, -0.840074, -0.826459,
-    -0.81303, -0.800326, -0.788889, -0.779242, -0.771868, -0.767196,
-    -0.765576, -0.767265, -0.772412, -0.781048, -0.793072, -0.808252,
-    -0.82622, -0.846477, -0.868399, -0.89125, -0.914194, -0.936317,
-    -0.956649, -0.974183, -0.987907, -0.996828, -1, -0.996552,
-    -0.985712, -0.966832, -0.939408, -0.9031, -0.857742, -0.803355,
-    -0.740148, -0.668521, -0.589057, -0.502513, -0.409803, -0.311984,
-    -0.210225, -0.10579
-};
-
-static const float WAVE_SQUARE_078[DEFAULT_WAVELEN] = {
-    -2.22045e-16, 0.052969, 0.105768, 0.158228, 0.210183, 0.261468,
-    0.311923, 0.361393, 0.409728, 0.456785, 0.502427, 0.546528,
-    0.588966, 0.629634, 0.66843, 0.705265, 0.740061, 0.77275,
-    0.803276, 0.831595, 0.857675, 0.881495, 0.903047, 0.922334,
-    0.93937, 0.954183, 0.966808, 0.977295, 0.985701, 0.992093,
-    0.996549, 0.999154, 1, 0.999188, 0.996824, 0.99302,
-    0.987892, 0.98156, 0.974149, 0.965782, 0.956587, 0.94669,
-    0.936219, 0.925299, 0.914052, 0.9026, 0.891058, 0.87954,
-    0.868153, 0.856999, 0.846173, 0.835766, 0.825859, 0.816526,
-    0.807835, 0.799844, 0.792604, 0.786156, 0.780536, 0.775767,
-    0.771867, 0.768843, 0.766697, 0.765422, 0.765001, 0.765413,
-    0.766629, 0.768614, 0.771325, 0.774717, 0.778739, 0.783333,
-    0.788442, 0.794002, 0.799949, 0.806215, 0.812734, 0.819437,
-    0.826255, 0.833121, 0.839968, 0.846732, 0.85335, 0.859763,
-    0.865915, 0.871753, 0.87723, 0.8823, 0.886925, 0.891071,
-    0.894708, 0.897814, 0.900369, 0.902362, 0.903784, 0.904634,
-    0.904916, 0.904638, 0.903814, 0.902463, 0.900608, 0.898276,
-    0.895498, 0.89231, 0.88875, 0.884857, 0.880677, 0.876253,
-    0.871632, 0.866862, 0.86199, 0.857066, 0.852137, 0.84725,
-    0.84245, 0.837783, 0.833291, 0.829013, 0.824987, 0.821248,
-    0.817826, 0.814748, 0.81204, 0.809721, 0.807807, 0.806311,
-    0.805239, 0.804597, 0.804384, 0.804595, 0.805223, 0.806255,
-    0.807675, 0.809465, 0.811602, 0.814061, 0.816814, 0.81983,
-    0.823078, 0.826522, 0.830128, 0.833858, 0.837676, 0.841544,
-    0.845424, 0.849279, 0.853072, 0.856768, 0.860333, 0.863735,
-    0.866942, 0.869927, 0.872664, 0.875129, 0.877303, 0.879168,
-    0.880709, 0.881917, 0.882783, 0.883303, 0.883476, 0.883304,
-    0.882793, 0.881952, 0.880792, 0.879329, 0.877578, 0.875561,
-    0.8733, 0.870818, 0.868142, 0.8653, 0.86232, 0.859232,
-    0.856068, 0.852858, 0.849633, 0.846425, 0.843264, 0.84018,
-    0.837201, 0.834355, 0.831668, 0.829165, 0.826866, 0.824793,
-    0.822963, 0.821391, 0.82009, 0.819069, 0.818337, 0.817896,
-    0.81775, 0.817896, 0.81833, 0.819045, 0.820033, 0.821282,
-    0.822776, 0.8245, 0.826435, 0.82856, 0.830855, 0.833294,
-    0.835854, 0.83851, 0.841234, 0.844, 0.846781, 0.849551,
-    0.852283, 0.854952, 0.857531, 0.859998, 0.862329, 0.864503,
-    0.866501, 0.868304, 0.869898, 0.871268, 0.872403, 0.873294,
-    0.873934, 0.874319, 0.874448, 0.87432, 0.873939, 0.873311,
-    0.872443, 0.871346, 0.870031, 0.868513, 0.866808, 0.864934,
-    0.862909, 0.860754, 0.858491, 0.856142, 0.85373, 0.851279,
-    0.848813, 0.846355, 0.843929, 0.841557, 0.839263, 0.837068,
-    0.834992, 0.833054, 0.831272, 0.829662, 0.828239, 0.827014,
-    0.825999, 0.825202, 0.824629, 0.824283, 0.824168, 0.824283,
-    0.824625, 0.825189, 0.82597, 0.826957, 0.828141, 0.829508,
-    0.831046, 0.832737, 0.834565, 0.836511, 0.838557, 0.840681,
-    0.842864, 0.845083, 0.847318, 0.849547, 0.851747, 0.8539,
-    0.855983, 0.857978, 0.859866, 0.861629, 0.863252, 0.864718,
-    0.866015, 0.867132, 0.868058, 0.868786, 0.86931, 0.869625,
-    0.869731, 0.869626, 0.869313, 0.868796, 0.86808, 0.867175,
-    0.866089, 0.864833, 0.863422, 0.861867, 0.860187, 0.858396,
-    0.856514, 0.854557, 0.852546, 0.850501, 0.84844, 0.846383,
-    0.844351, 0.842363, 0.840438, 0.838593, 0.836847, 0.835215,
-    0.833713, 0.832355, 0.831153, 0.830117, 0.829258, 0.828582,
-    0.828096, 0.827803, 0.827705, 0.827803, 0.828094, 0.828575,
-    0.829241, 0.830085, 0.831097, 0.832268, 0.833585, 0.835035,
-    0.836605, 0.838277, 0.840037, 0.841866, 0.843747, 0.845661,
-    0.847591, 0.849517, 0.851421, 0.853285, 0.85509, 0.856821,
-    0.85846, 0.859993, 0.861404, 0.86268, 0.863811, 0.864785,
-    0.865593, 0.866229, 0.866688, 0.866964, 0.867056, 0.866964,
-    0.866689, 0.866235, 0.865606, 0.864809, 0.863853, 0.862746,
-    0.861501, 0.860128, 0.858643, 0.857059, 0.855393, 0.85366,
-    0.851877, 0.850061, 0.848231, 0.846403, 0.844596, 0.842825,
-    0.84111, 0.839465, 0.837906, 0.836449, 0.835106, 0.833891,
-    0.832814, 0.831886, 0.831116, 0.830509, 0.830073, 0.829809,
-    0.829721, 0.829809, 0.830071, 0.830505, 0.831106, 0.831868,
-    0.832783, 0.833842, 0.835034, 0.836348, 0.837771, 0.839288,
-    0.840886, 0.842548, 0.844258, 0.846, 0.847758, 0.849513,
-    0.851249, 0.85295, 0.854599, 0.856181, 0.857681, 0.859083,
-    0.860376, 0.861546, 0.862583, 0.863477, 0.86422, 0.864805,
-    0.865226, 0.86548, 0.865565, 0.86548, 0.865227, 0.864807,
-    0.864227, 0.86349, 0.862605, 0.86158, 0.860426, 0.859154,
-    0.857776, 0.856306, 0.854758, 0.853146, 0.851488, 0.849797,
-    0.848092, 0.846388, 0.844702, 0.84305, 0.841447, 0.839909,
-    0.838451, 0.837087, 0.83583, 0.83469, 0.833681, 0.83281,
-    0.832086, 0.831516, 0.831106, 0.830858, 0.830775, 0.830858,
-    0.831105, 0.831514, 0.832082, 0.832802, 0.833667, 0.834668,
-    0.835797, 0.837042, 0.83839, 0.83983, 0.841346, 0.842924,
-    0.844549, 0.846206, 0.847878, 0.849549, 0.851204, 0.852825,
-    0.854399, 0.855909, 0.857341, 0.858681, 0.859918, 0.861038,
-    0.862031, 0.862887, 0.8636, 0.864161, 0.864565, 0.86481,
-    0.864891, 0.86481, 0.864566, 0.864162, 0.863602, 0.862891,
-    0.862038, 0.861048, 0.859933, 0.858704, 0.857371, 0.855948,
-    0.854448, 0.852887, 0.851278, 0.849638, 0.847983, 0.846327,
-    0.844688, 0.843081, 0.841521, 0.840023, 0.838603, 0.837272,
-    0.836045, 0.834933, 0.833947, 0.833096, 0.832388, 0.83183,
-    0.831428, 0.831185, 0.831104, 0.831185, 0.831428, 0.83183,
-    0.832388, 0.833096, 0.833947, 0.834933, 0.836045, 0.837272,
-    0.838603, 0.840023, 0.841521, 0.843081, 0.844688, 0.846327,
-    0.847983, 0.849638, 0.851278, 0.852887, 0.854448, 0.855948,
-    0.857371, 0.858704, 0.859933, 0.861048, 0.862038, 0.862891,
-    0.863602, 0.864162, 0.864566, 0.86481, 0.864891, 0.86481,
-    0.864565, 0.864161, 0.8636, 0.862887, 0.862031, 0.861038,
-    0.859918, 0.858681, 0.857341, 0.855909, 0.854399, 0.852825,
-    0.851204, 0.849549, 0.847878, 0.846206, 0.844549, 0.842924,
-    0.841346, 0.83983, 0.83839, 0.837042, 0.835797, 0.834668,
-    0.833667, 0.832802, 0.832082, 0.831514, 0.831105, 0.830858,
-    0.830775, 0.830858, 0.831106, 0.831516, 0.832086, 0.83281,
-    0.833681, 0.83469, 0.83583, 0.837087, 0.838451, 0.839909,
-    0.841447, 0.84305, 0.844702, 0.846388, 0.848092, 0.849797,
-    0.851488, 0.853146, 0.854758, 0.856306, 0.857776, 0.859154,
-    0.860426, 0.86158, 0.862605, 0.86349, 0.864227, 0.864807,
-    0.865227, 0.86548, 0.865565, 0.86548, 0.865226, 0.864805,
-    0.86422, 0.863477, 0.862583, 0.861546, 0.860376, 0.859083,
-    0.857681, 0.856181, 0.854599, 0.85295, 0.851249, 0.849513,
-    0.847758, 0.846, 0.844258, 0.842548, 0.840886, 0.839288,
-    0.837771, 0.836348, 0.835034, 0.833842, 0.832783, 0.831868,
-    0.831106, 0.830505, 0.830071, 0.829809, 0.829721, 0.829809,
-    0.830073, 0.830509, 0.831116, 0.831886, 0.832814, 0.833891,
-    0.835106, 0.836449, 0.837906, 0.839465, 0.84111, 0.842825,
-    0.844596, 0.846403, 0.848231, 0.850061, 0.851877, 0.85366,
-    0.855393, 0.857059, 0.858643, 0.860128, 0.861501, 0.862746,
-    0.863853, 0.864809, 0.865606, 0.866235, 0.866689, 0.866964,
-    0.867056, 0.866964, 0.866688, 0.866229, 0.865593, 0.864785,
-    0.863811, 0.86268, 0.861404, 0.859993, 0.85846, 0.856821,
-    0.85509, 0.853285, 0.851421, 0.849517, 0.847591, 0.845661,
-    0.843747, 0.841866, 0.840037, 0.838277, 0.836605, 0.835035,
-    0.833585, 0.832268, 0.831097, 0.830085, 0.829241, 0.828575,
-    0.828094, 0.827803, 0.827705, 0.827803, 0.828096, 0.828582,
-    0.829258, 0.830117, 0.831153, 0.832355, 0.833713, 0.835215,
-    0.836847, 0.838593, 0.840438, 0.842363, 0.844351, 0.846383,
-    0.84844, 0.850501, 0.852546, 0.854557, 0.856514, 0.858396,
-    0.860187, 0.861867, 0.863422, 0.864833, 0.866089, 0.867175,
-    0.86808, 0.868796, 0.869313, 0.869626, 0.869731, 0.869625,
-    0.86931, 0.868786, 0.868058, 0.867132, 0.866015, 0.864718,
-    0.863252, 0.861629, 0.859866, 0.857978, 0.855983, 0.8539,
-    0.851747, 0.849547, 0.847318, 0.845083, 0.842864, 0.840681,
-    0.838557, 0.836511, 0.834565, 0.832737, 0.831046, 0.829508,
-    0.828141, 0.826957, 0.82597, 0.825189, 0.824625, 0.824283,
-    0.824168, 0.824283, 0.824629, 0.825202, 0.825999, 0.827014,
-    0.828239, 0.829662, 0.831272, 0.833054, 0.834992, 0.837068,
-    0.839263, 0.841557, 0.843929, 0.846355, 0.848813, 0.851279,
-    0.85373, 0.856142, 0.858491, 0.860754, 0.862909, 0.864934,
-    0.866808, 0.868513, 0.870031, 0.871346, 0.872443, 0.873311,
-    0.873939, 0.87432, 0.874448, 0.874319, 0.873934, 0.873294,
-    0.872403, 0.871268, 0.869898, 0.868304, 0.866501, 0.864503,
-    0.862329, 0.859998, 0.857531, 0.854952, 0.852283, 0.849551,
-    0.846781, 0.844, 0.841234, 0.83851, 0.835854, 0.833294,
-    0.830855, 0.82856, 0.826435, 0.8245, 0.822776, 0.821282,
-    0.820033, 0.819045, 0.81833, 0.817896, 0.81775, 0.817896,
-    0.818337, 0.819069, 0.82009, 0.821391, 0.822963, 0.824793,
-    0.826866, 0.829165, 0.831668, 0.834355, 0.837201, 0.84018,
-    0.843264, 0.846425, 0.849633, 0.852858, 0.856068, 0.859232,
-    0.86232, 0.8653, 0.868142, 0.870818, 0.8733, 0.875561,
-    0.877578, 0.879329, 0.880792, 0.881952, 0.882793, 0.883304,
-    0.883476, 0.883303, 0.882783, 0.881917, 0.880709, 0.879168,
-    0.877303, 0.875129, 0.872664, 0.869927, 0.866942, 0.863735,
-    0.860333, 0.856768, 0.853072, 0.849279, 0.845424, 0.841544,
-    0.837676, 0.833858, 0.830128, 0.826522, 0.823078, 0.81983,
-    0.816814, 0.814061, 0.811602, 0.809465, 0.807675, 0.806255,
-    0.805223, 0.804595, 0.804384, 0.804597, 0.805239, 0.806311,
-    0.807807, 0.809721, 0.81204, 0.814748, 0.817826, 0.821248,
-    0.824987, 0.829013, 0.833291, 0.837783, 0.84245, 0.84725,
-    0.852137, 0.857066, 0.86199, 0.866862, 0.871632, 0.876253,
-    0.880677, 0.884857, 0.88875, 0.89231, 0.895498, 0.898276,
-    0.900608, 0.902463, 0.903814, 0.904638, 0.904916, 0.904634,
-    0.903784, 0.902362, 0.900369, 0.897814, 0.894708, 0.891071,
-    0.886925, 0.8823, 0.87723, 0.871753, 0.865915, 0.859763,
-    0.85335, 0.846732, 0.839968, 0.833121, 0.826255, 0.819437,
-    0.812734, 0.806215, 0.799949, 0.794002, 0.788442, 0.783333,
-    0.778739, 0.774717, 0.771325, 0.768614, 0.766629, 0.765413,
-    0.765001, 0.765422, 0.766697, 0.768843, 0.771867, 0.775767,
-    0.780536, 0.786156, 0.792604, 0.799844, 0.807835, 0.816526,
-    0.825859, 0.835766, 0.846173, 0.856999, 0.868153, 0.87954,
-    0.891058, 0.9026, 0.914052, 0.925299, 0.936219, 0.94669,
-    0.956587, 0.965782, 0.974149, 0.98156, 0.987892, 0.99302,
-    0.996824, 0.999188, 1, 0.999154, 0.996549, 0.992093,
-    0.985701, 0.977295, 0.966808, 0.954183, 0.93937, 0.922334,
-    0.903047, 0.881495, 0.857675, 0.831595, 0.803276, 0.77275,
-    0.740061, 0.705265, 0.66843, 0.629634, 0.588966, 0.546528,
-    0.502427, 0.456785, 0.409728, 0.361393, 0.311923, 0.261468,
-    0.210183, 0.158228, 0.105768, 0.052969, 2.22045e-15, -0.052969,
-    -0.105768, -0.158228, -0.210183, -0.261468, -0.311923, -0.361393,
-    -0.409728, -0.456785, -0.502427, -0.546528, -0.588966, -0.629634,
-    -0.66843, -0.705265, -0.740061, -0.77275, -0.803276, -0.831595,
-    -0.857675, -0.881495, -0.903047, -0.922334, -0.93937, -0.954183,
-    -0.966808, -0.977295, -0.985701, -0.992093, -0.996549, -0.999154,
-    -1, -0.999188, -0.996824, -0.99302, -0.987892, -0.98156,
-    -0.974149, -0.965782, -0.956587, -0.94669, -0.936219, -0.925299,
-    -0.914052, -0.9026, -0.891058, -0.87954, -0.868153, -0.856999,
-    -0.846173, -0.835766, -0.825859, -0.816526, -0.807835, -0.799844,
-    -0.792604, -0.786156, -0.780536, -0.775767, -0.771867, -0.768843,
-    -0.766697, -0.765422, -0.765001, -0.765413, -0.766629, -0.768614,
-    -0.771325, -0.774717, -0.778739, -0.783333, -0.788442, -0.794002,
-    -0.799949, -0.806215, -0.812734, -0.819437, -0.826255, -0.833121,
-    -0.839968, -0.846732, -0.85335, -0.859763, -0.865915, -0.871753,
-    -0.87723, -0.8823, -0.886925, -0.891071, -0.894708, -0.897814,
-    -0.900369, -0.902362, -0.903784, -0.904634, -0.904916, -0.904638,
-    -0.903814, -0.902463, -0.900608, -0.898276, -0.895498, -0.89231,
-    -0.88875, -0.884857, -0.880677, -0.876253, -0.871632, -0.866862,
-    -0.86199, -0.857066, -0.852137, -0.84725, -0.84245, -0.837783,
-    -0.833291, -0.829013, -0.824987, -0.821248, -0.817826, -0.814748,
-    -0.81204, -0.809721, -0.807807, -0.806311, -0.805239, -0.804597,
-    -0.804384, -0.804595, -0.805223, -0.806255, -0.807675, -0.809465,
-    -0.811602, -0.814061, -0.816814, -0.81983, -0.823078, -0.826522,
-    -0.830128, -0.833858, -0.837676, -0.841544, -0.845424, -0.849279,
-    -0.853072, -0.856768, -0.860333, -0.863735, -0.866942, -0.869927,
-    -0.872664, -0.875129, -0.877303, -0.879168, -0.880709, -0.881917,
-    -0.882783, -0.883303, -0.883476, -0.883304, -0.882793, -0.881952,
-    -0.880792, -0.879329, -0.877578, -0.875561, -0.8733, -0.870818,
-    -0.868142, -0.8653, -0.86232, -0.859232, -0.856068, -0.852858,
-    -0.849633, -0.846425, -0.843264, -0.84018, -0.837201, -0.834355,
-    -0.831668, -0.829165, -0.826866, -0.824793, -0.822963, -0.821391,
-    -0.82009, -0.819069, -0.818337, -0.817896, -0.81775, -0.817896,
-    -0.81833, -0.819045, -0.820033, -0.821282, -0.822776, -0.8245,
-    -0.826435, -0.82856, -0.830855, -0.833294, -0.835854, -0.83851,
-    -0.841234, -0.844, -0.846781, -0.849551, -0.852283, -0.854952,
-    -0.857531, -0.859998, -0.862329, -0.864503, -0.866501, -0.868304,
-    -0.869898, -0.871268, -0.872403, -0.873294, -0.873934, -0.874319,
-    -0.874448, -0.87432, -0.873939, -0.873311, -0.872443, -0.871346,
-    -0.870031, -0.868513, -0.866808, -0.864934, -0.862909, -0.860754,
-    -0.858491, -0.856142, -0.85373, -0.851279, -0.848813, -0.846355,
-    -0.843929, -0.841557, -0.839263, -0.837068, -0.834992, -0.833054,
-    -0.831272, -0.829662, -0.828239, -0.827014, -0.825999, -0.825202,
-    -0.824629, -0.824283, -0.824168, -0.824283, -0.824625, -0.825189,
-    -0.82597, -0.826957, -0.828141, -0.829508, -0.831046, -0.832737,
-    -0.834565, -0.836511, -0.838557, -0.840681, -0.842864, -0.845083,
-    -0.847318, -0.849547, -0.851747, -0.8539, -0.855983, -0.857978,
-    -0.859866, -0.861629, -0.863252, -0.864718, -0.866015, -0.867132,
-    -0.868058, -0.868786, -0.86931, -0.869625, -0.869731, -0.869626,
-    -0.869313, -0.868796, -0.86808, -0.867175, -0.866089, -0.864833,
-    -0.863422, -0.861867, -0.860187, -0.858396, -0.856514, -0.854557,
-    -0.852546, -0.850501, -0.84844, -0.846383, -0.844351, -0.842363,
-    -0.840438, -0.838593, -0.836847, -0.835215, -0.833713, -0.832355,
-    -0.831153, -0.830117, -0.829258, -0.828582, -0.828096, -0.827803,
-    -0.827705, -0.827803, -0.828094, -0.828575, -0.829241, -0.830085,
-    -0.831097, -0.832268, -0.833585, -0.835035, -0.836605, -0.838277,
-    -0.840037, -0.841866, -0.843747, -0.845661, -0.847591, -0.849517,
-    -0.851421, -0.853285, -0.85509, -0.856821, -0.85846, -0.859993,
-    -0.861404, -0.86268, -0.863811, -0.864785, -0.865593, -0.866229,
-    -0.866688, -0.866964, -0.867056, -0.866964, -0.866689, -0.866235,
-    -0.865606, -0.864809, -0.863853, -0.862746, -0.861501, -0.860128,
-    -0.858643, -0.857059, -0.855393, -0.85366, -0.851877, -0.850061,
-    -0.848231, -0.846403, -0.844596, -0.842825, -0.84111, -0.839465,
-    -0.837906, -0.836449, -0.835106, -0.833891, -0.832814, -0.831886,
-    -0.831116, -0.830509, -0.830073, -0.829809, -0.829721, -0.829809,
-    -0.830071, -0.830505, -0.831106, -0.831868, -0.832783, -0.833842,
-    -0.835034, -0.836348, -0.837771, -0.839288, -0.840886, -0.842548,
-    -0.844258, -0.846, -0.847758, -0.849513, -0.851249, -0.85295,
-    -0.854599, -0.856181, -0.857681, -0.859083, -0.860376, -0.861546,
-    -0.862583, -0.863477, -0.86422, -0.864805, -0.865226, -0.86548,
-    -0.865565, -0.86548, -0.865227, -0.864807, -0.864227, -0.86349,
-    -0.862605, -0.86158, -0.860426, -0.859154, -0.857776, -0.856306,
-    -0.854758, -0.853146, -0.851488, -0.849797, -0.848092, -0.846388,
-    -0.844702, -0.84305, -0.841447, -0.839909, -0.838451, -0.837087,
-    -0.83583, -0.83469, -0.833681, -0.83281, -0.832086, -0.831516,
-    -0.831106, -0.830858, -0.830775, -0.830858, -0.831105, -0.831514,
-    -0.832082, -0.832802, -0.833667, -0.834668, -0.835797, -0.837042,
-    -0.83839, -0.83983, -0.841346, -0.842924, -0.844549, -0.846206,
-    -0.847878, -0.849549, -0.851204, -0.852825, -0.854399, -0.855909,
-    -0.857341, -0.858681, -0.859918, -0.861038, -0.862031, -0.862887,
-    -0.8636, -0.864161, -0.864565, -0.86481, -0.864891, -0.86481,
-    -0.864566, -0.864162, -0.863602, -0.862891, -0.862038, -0.861048,
-    -0.859933, -0.858704, -0.857371, -0.855948, -0.854448, -0.852887,
-    -0.851278, -0.849638, -0.847983, -0.846327, -0.844688, -0.843081,
-    -0.841521, -0.840023, -0.838603, -0.837272, -0.836045, -0.834933,
-    -0.833947, -0.833096, -0.832388, -0.83183, -0.831428, -0.831185,
-    -0.831104, -0.831185, -0.831428, -0.83183, -0.832388, -0.833096,
-    -0.833947, -0.834933, -0.836045, -0.837272, -0.838603, -0.840023,
-    -0.841521, -0.843081, -0.844688, -0.846327, -0.847983, -0.849638,
-    -0.851278, -0.852887, -0.854448, -0.855948, -0.857371, -0.858704,
-    -0.859933, -0.861048, -0.862038, -0.862891, -0.863602, -0.864162,
-    -0.864566, -0.86481, -0.864891, -0.86481, -0.864565, -0.864161,
-    -0.8636, -0.862887, -0.862031, -0.861038, -0.859918, -0.858681,
-    -0.857341, -0.855909, -0.854399, -0.852825, -0.851204, -0.849549,
-    -0.847878, -0.846206, -0.844549, -0.842924, -0.841346, -0.83983,
-    -0.83839, -0.837042, -0.835797, -0.834668, -0.833667, -0.832802,
-    -0.832082, -0.831514, -0.831105, -0.830858, -0.830775, -0.830858,
-    -0.831106, -0.831516, -0.832086, -0.83281, -0.833681, -0.83469,
-    -0.83583, -0.837087, -0.838451, -0.839909, -0.841447, -0.84305,
-    -0.844702, -0.846388, -0.848092, -0.849797, -0.851488, -0.853146,
-    -0.854758, -0.856306, -0.857776, -0.859154, -0.860426, -0.86158,
-    -0.862605, -0.86349, -0.864227, -0.864807, -0.865227, -0.86548,
-    -0.865565, -0.86548, -0.865226, -0.864805, -0.86422, -0.863477,
-    -0.862583, -0.861546, -0.860376, -0.859083, -0.857681, -0.856181,
-    -0.854599, -0.85295, -0.851249, -0.849513, -0.847758, -0.846,
-    -0.844258, -0.842548, -0.840886, -0.839288, -0.837771, -0.836348,
-    -0.835034, -0.833842, -0.832783, -0.831868, -0.831106, -0.830505,
-    -0.830071, -0.829809, -0.829721, -0.829809, -0.830073, -0.830509,
-    -0.831116, -0.831886, -0.832814, -0.833891, -0.835106, -0.836449,
-    -0.837906, -0.839465, -0.84111, -0.842825, -0.844596, -0.846403,
-    -0.848231, -0.850061, -0.851877, -0.85366, -0.855393, -0.857059,
-    -0.858643, -0.860128, -0.861501, -0.862746, -0.863853, -0.864809,
-    -0.865606, -0.866235, -0.866689, -0.866964, -0.867056, -0.866964,
-    -0.866688, -0.866229, -0.865593, -0.864785, -0.863811, -0.86268,
-    -0.861404, -0.859993, -0.85846, -0.856821, -0.85509, -0.853285,
-    -0.851421, -0.849517, -0.847591, -0.845661, -0.843747, -0.841866,
-    -0.840037, -0.838277, -0.836605, -0.835035, -0.833585, -0.832268,
-    -0.831097, -0.830085, -0.829241, -0.828575, -0.828094, -0.827803,
-    -0.827705, -0.827803, -0.828096, -0.828582, -0.829258, -0.830117,
-    -0.831153, -0.832355, -0.833713, -0.835215, -0.836847, -0.838593,
-    -0.840438, -0.842363, -0.844351, -0.846383, -0.84844, -0.850501,
-    -0.852546, -0.854557, -0.856514, -0.858396, -0.860187, -0.861867,
-    -0.863422, -0.864833, -0.866089, -0.867175, -0.86808, -0.868796,
-    -0.869313, -0.869626, -0.869731, -0.869625, -0.86931, -0.868786,
-    -0.868058, -0.867132, -0.866015, -0.864718, -0.863252, -0.861629,
-    -0.859866, -0.857978, -0.855983, -0.8539, -0.851747, -0.849547,
-    -0.847318, -0.845083, -0.842864, -0.840681, -0.838557, -0.836511,
-    -0.834565, -0.832737, -0.831046, -0.829508, -0.828141, -0.826957,
-    -0.82597, -0.825189, -0.824625, -0.824283, -0.824168, -0.824283,
-    -0.824629, -0.825202, -0.825999, -0.827014, -0.828239, -0.829662,
-    -0.831272, -0.833054, -0.834992, -0.837068, -0.839263, -0.841557,
-    -0.843929, -0.846355, -0.848813, -0.851279, -0.85373, -0.856142,
-    -0.858491, -0.860754, -0.862909, -0.864934, -0.866808, -0.868513,
-    -0.870031, -0.871346, -0.872443, -0.873311, -0.873939, -0.87432,
-    -0.874448, -0.874319, -0.873934, -0.873294, -0.872403, -0.871268,
-    -0.869898, -0.868304, -0.866501, -0.864503, -0.862329, -0.859998,
-    -0.857531, -0.854952, -0.852283, -0.849551, -0.846781, -0.844,
-    -0.841234, -0.83851, -0.835854, -0.833294, -0.830855, -0.82856,
-    -0.826435, -0.8245, -0.822776, -0.821282, -0.820033, -0.819045,
-    -0.81833, -0.817896, -0.81775, -0.817896, -0.818337, -0.819069,
-    -0.82009, -0.821391, -0.822963, -0.824793, -0.826866, -0.829165,
-    -0.831668, -0.834355, -0.837201, -0.84018, -0.843264, -0.846425,
-    -0.849633, -0.852858, -0.856068, -0.859232, -0.86232, -0.8653,
-    -0.868142, -0.870818, -0.8733, -0.875561, -0.877578, -0.879329,
-    -0.880792, -0.881952, -0.882793, -0.883304, -0.883476, -0.883303,
-    -0.882783, -0.881917, -0.880709, -0.879168, -0.877303, -0.875129,
-    -0.872664, -0.869927, -0.866942, -0.863735, -0.860333, -0.856768,
-    -0.853072, -0.849279, -0.845424, -0.841544, -0.837676, -0.833858,
-    -0.830128, -0.826522, -0.823078, -0.81983, -0.816814, -0.814061,
-    -0.811602, -0.809465, -0.807675, -0.806255, -0.805223, -0.804595,
-    -0.804384, -0.804597, -0.805239, -0.806311, -0.807807, -0.809721,
-    -0.81204, -0.814748, -0.817826, -0.821248, -0.824987, -0.829013,
-    -0.833291, -0.837783, -0.84245, -0.84725, -0.852137, -0.857066,
-    -0.86199, -0.866862, -0.871632, -0.876253, -0.880677, -0.884857,
-    -0.88875, -0.89231, -0.895498, -0.898276, -0.900608, -0.902463,
-    -0.903814, -0.904638, -0.904916, -0.904634, -0.903784, -0.902362,
-    -0.900369, -0.897814, -0.894708, -0.891071, -0.886925, -0.8823,
-    -0.87723, -0.871753, -0.865915, -0.859763, -0.85335, -0.846732,
-    -0.839968, -0.833121, -0.826255, -0.819437, -0.812734, -0.806215,
-    -0.799949, -0.794002, -0.788442, -0.783333, -0.778739, -0.774717,
-    -0.771325, -0.768614, -0.766629, -0.765413, -0.765001, -0.765422,
-    -0.766697, -0.768843, -0.771867, -0.775767, -0.780536, -0.786156,
-    -0.792604, -0.799844, -0.807835, -0.816526, -0.825859, -0.835766,
-    -0.846173, -0.856999, -0.868153, -0.87954, -0.891058, -0.9026,
-    -0.914052, -0.925299, -0.936219, -0.94669, -0.956587, -0.965782,
-    -0.974149, -0.98156, -0.987892, -0.99302, -0.996824, -0.999188,
-    -1, -0.999154, -0.996549, -0.992093, -0.985701, -0.977295,
-    -0.966808, -0.954183, -0.93937, -0.922334, -0.903047, -0.881495,
-    -0.857675, -0.831595, -0.803276, -0.77275, -0.740061, -0.705265,
-    -0.66843, -0.629634, -0.588966, -0.546528, -0.502427, -0.456785,
-    -0.409728, -0.361393, -0.311923, -0.261468, -0.210183, -0.158228,
-    -0.105768, -0.052969
-};
-
-static const float WAVE_SQUARE_090[DEFAULT_WAVELEN] = {
-    2.22045e-16, 0.0264731, 0.0529251, 0.0793348, 0.105681, 0.131943,
-    0.158099, 0.18413, 0.210014, 0.235731, 0.261261, 0.286585,
-    0.311682, 0.336534, 0.361121, 0.385425, 0.409428, 0.433113,
-    0.456462, 0.479459, 0.502086, 0.524329, 0.546173, 0.567602,
-    0.588603, 0.609162, 0.629266, 0.648904, 0.668063, 0.686734,
-    0.704905, 0.722567, 0.739711, 0.756329, 0.772415, 0.78796,
-    0.802959, 0.817408, 0.831301, 0.844634, 0.857406, 0.869612,
-    0.881253, 0.892327, 0.902834, 0.912775, 0.922151, 0.930964,
-    0.939217, 0.946914, 0.954059, 0.960657, 0.966713, 0.972234,
-    0.977226, 0.981697, 0.985654, 0.989108, 0.992066, 0.994539,
-    0.996536, 0.99807, 0.99915, 0.99979, 1, 0.999794,
-    0.999185, 0.998185, 0.99681, 0.995073, 0.992988, 0.99057,
-    0.987833, 0.984794, 0.981467, 0.977868, 0.974012, 0.969915,
-    0.965594, 0.961063, 0.956338, 0.951437, 0.946373, 0.941164,
-    0.935826, 0.930372, 0.924821, 0.919186, 0.913482, 0.907726,
-    0.901932, 0.896114, 0.890287, 0.884464, 0.87866, 0.872888,
-    0.867161, 0.861491, 0.855891, 0.850373, 0.844949, 0.839629,
-    0.834424, 0.829344, 0.8244, 0.8196, 0.814953, 0.810467,
-    0.80615, 0.80201, 0.798053, 0.794286, 0.790713, 0.787341,
-    0.784173, 0.781215, 0.778469, 0.775938, 0.773626, 0.771534,
-    0.769663, 0.768015, 0.76659, 0.765387, 0.764407, 0.763648,
-    0.763108, 0.762787, 0.76268, 0.762786, 0.7631, 0.76362,
-    0.76434, 0.765257, 0.766365, 0.767659, 0.769133, 0.770782,
-    0.772599, 0.774577, 0.77671, 0.77899, 0.781411, 0.783963,
-    0.78664, 0.789434, 0.792336, 0.795338, 0.798432, 0.801609,
-    0.804861, 0.808178, 0.811553, 0.814976, 0.818439, 0.821933,
-    0.825448, 0.828978, 0.832512, 0.836043, 0.839562, 0.843061,
-    0.846532, 0.849967, 0.853357, 0.856696, 0.859976, 0.86319,
-    0.86633, 0.869391, 0.872365, 0.875247, 0.878031, 0.88071,
-    0.883281, 0.885737, 0.888074, 0.890287, 0.892373, 0.894329,
-    0.896149, 0.897833, 0.899376, 0.900777, 0.902033, 0.903144,
-    0.904107, 0.904922, 0.905588, 0.906106, 0.906475, 0.906696,
-    0.906769, 0.906696, 0.906478, 0.906118, 0.905617, 0.904978,
-    0.904203, 0.903296, 0.902259, 0.901097, 0.899814, 0.898413,
-    0.896898, 0.895275, 0.893549, 0.891723, 0.889804, 0.887796,
-    0.885706, 0.883539, 0.8813, 0.878996, 0.876633, 0.874216,
-    0.871753, 0.869248, 0.86671, 0.864143, 0.861554, 0.85895,
-    0.856337, 0.853721, 0.851109, 0.848506, 0.84592, 0.843355,
-    0.840818, 0.838315, 0.835852, 0.833433, 0.831066, 0.828754,
-    0.826503, 0.824318, 0.822204, 0.820166, 0.818207, 0.816331,
-    0.814544, 0.812848, 0.811247, 0.809743, 0.808341, 0.807043,
-    0.80585, 0.804766, 0.803792, 0.80293, 0.802181, 0.801546,
-    0.801026, 0.800621, 0.800333, 0.80016, 0.800102, 0.800159,
-    0.800331, 0.800615, 0.801011, 0.801516, 0.80213, 0.80285,
-    0.803673, 0.804598, 0.805621, 0.806739, 0.807948, 0.809247,
-    0.810631, 0.812095, 0.813637, 0.815252, 0.816936, 0.818685,
-    0.820493, 0.822356, 0.82427, 0.82623, 0.82823, 0.830266,
-    0.832333, 0.834425, 0.836538, 0.838666, 0.840804, 0.842946,
-    0.845089, 0.847226, 0.849353, 0.851464, 0.853555, 0.85562,
-    0.857655, 0.859655, 0.861616, 0.863532, 0.8654, 0.867216,
-    0.868974, 0.870672, 0.872306, 0.873871, 0.875364, 0.876783,
-    0.878124, 0.879385, 0.880562, 0.881653, 0.882656, 0.883568,
-    0.88439, 0.885117, 0.88575, 0.886287, 0.886727, 0.88707,
-    0.887315, 0.887461, 0.88751, 0.887462, 0.887316, 0.887073,
-    0.886735, 0.886303, 0.885779, 0.885162, 0.884457, 0.883664,
-    0.882786, 0.881825, 0.880785, 0.879667, 0.878474, 0.877211,
-    0.875879, 0.874483, 0.873027, 0.871513, 0.869946, 0.868329,
-    0.866667, 0.864964, 0.863224, 0.861451, 0.85965, 0.857825,
-    0.855981, 0.854122, 0.852252, 0.850376, 0.848499, 0.846625,
-    0.844759, 0.842904, 0.841066, 0.839249, 0.837456, 0.835693,
-    0.833964, 0.832272, 0.830621, 0.829015, 0.827458, 0.825954,
-    0.824506, 0.823117, 0.82179, 0.820529, 0.819336, 0.818214,
-    0.817165, 0.816192, 0.815297, 0.814482, 0.813748, 0.813097,
-    0.81253, 0.812049, 0.811654, 0.811347, 0.811127, 0.810995,
-    0.810951, 0.810995, 0.811126, 0.811345, 0.81165, 0.81204,
-    0.812514, 0.813072, 0.81371, 0.814428, 0.815224, 0.816096,
-    0.817041, 0.818057, 0.819141, 0.820291, 0.821503, 0.822775,
-    0.824104, 0.825485, 0.826917, 0.828394, 0.829914, 0.831473,
-    0.833067, 0.834692, 0.836344, 0.83802, 0.839714, 0.841423,
-    0.843143, 0.84487, 0.846599, 0.848327, 0.850049, 0.851761,
-    0.85346, 0.85514, 0.856798, 0.85843, 0.860033, 0.861602,
-    0.863133, 0.864624, 0.86607, 0.867468, 0.868816, 0.870109,
-    0.871345, 0.872521, 0.873633, 0.874681, 0.87566, 0.87657,
-    0.877407, 0.878171, 0.878858, 0.879468, 0.88, 0.880451,
-    0.880822, 0.881111, 0.881318, 0.881442, 0.881483, 0.881442,
-    0.881318, 0.881112, 0.880824, 0.880455, 0.880007, 0.87948,
-    0.878875, 0.878195, 0.87744, 0.876614, 0.875717, 0.874752,
-    0.873722, 0.872628, 0.871475, 0.870263, 0.868998, 0.86768,
-    0.866315, 0.864905, 0.863453, 0.861963, 0.860438, 0.858883,
-    0.857301, 0.855695, 0.854071, 0.852431, 0.850779, 0.849121,
-    0.847458, 0.845796, 0.844139, 0.84249, 0.840853, 0.839233,
-    0.837633, 0.836057, 0.834509, 0.832993, 0.831511, 0.830068,
-    0.828668, 0.827312, 0.826006, 0.824751, 0.823551, 0.822409,
-    0.821327, 0.820308, 0.819355, 0.818469, 0.817653, 0.816909,
-    0.816238, 0.815643, 0.815123, 0.814682, 0.814319, 0.814037,
-    0.813834, 0.813712, 0.813672, 0.813712, 0.813834, 0.814037,
-    0.814319, 0.814682, 0.815123, 0.815643, 0.816238, 0.816909,
-    0.817653, 0.818469, 0.819355, 0.820308, 0.821327, 0.822409,
-    0.823551, 0.824751, 0.826006, 0.827312, 0.828668, 0.830068,
-    0.831511, 0.832993, 0.834509, 0.836057, 0.837633, 0.839233,
-    0.840853, 0.84249, 0.844139, 0.845796, 0.847458, 0.849121,
-    0.850779, 0.852431, 0.854071, 0.855695, 0.857301, 0.858883,
-    0.860438, 0.861963, 0.863453, 0.864905, 0.866315, 0.86768,
-    0.868998, 0.870263, 0.871475, 0.872628, 0.873722, 0.874752,
-    0.875717, 0.876614, 0.87744, 0.878195, 0.878875, 0.87948,
-    0.880007, 0.880455, 0.880824, 0.881112, 0.881318, 0.881442,
-    0.881483, 0.881442, 0.881318, 0.881111, 0.880822, 0.880451,
-    0.88, 0.879468, 0.878858, 0.878171, 0.877407, 0.87657,
-    0.87566, 0.874681, 0.873633, 0.872521, 0.871345, 0.870109,
-    0.868816, 0.867468, 0.86607, 0.864624, 0.863133, 0.861602,
-    0.860033, 0.85843, 0.856798, 0.85514, 0.85346, 0.851761,
-    0.850049, 0.848327, 0.846599, 0.84487, 0.843143, 0.841423,
-    0.839714, 0.83802, 0.836344, 0.834692, 0.833067, 0.831473,
-    0.829914, 0.828394, 0.826917, 0.825485, 0.824104, 0.822775,
-    0.821503, 0.820291, 0.819141, 0.818057, 0.817041, 0.816096,
-    0.815224, 0.814428, 0.81371, 0.813072, 0.812514, 0.81204,
-    0.81165, 0.811345, 0.811126, 0.810995, 0.810951, 0.810995,
-    0.811127, 0.811347, 0.811654, 0.812049, 0.81253, 0.813097,
-    0.813748, 0.814482, 0.815297, 0.816192, 0.817165, 0.818214,
-    0.819336, 0.820529, 0.82179, 0.823117, 0.824506, 0.825954,
-    0.827458, 0.829015, 0.830621, 0.832272, 0.833964, 0.835693,
-    0.837456, 0.839249, 0.841066, 0.842904, 0.844759, 0.846625,
-    0.848499, 0.850376, 0.852252, 0.854122, 0.855981, 0.857825,
-    0.85965, 0.861451, 0.863224, 0.864964, 0.866667, 0.868329,
-    0.869946, 0.871513, 0.873027, 0.874483, 0.875879, 0.877211,
-    0.878474, 0.879667, 0.880785, 0.881825, 0.882786, 0.883664,
-    0.884457, 0.885162, 0.885779, 0.886303, 0.886735, 0.887073,
-    0.887316, 0.887462, 0.88751, 0.887461, 0.887315, 0.88707,
-    0.886727, 0.886287, 0.88575, 0.885117, 0.88439, 0.883568,
-    0.882656, 0.881653, 0.880562, 0.879385, 0.878124, 0.876783,
-    0.875364, 0.873871, 0.872306, 0.870672, 0.868974, 0.867216,
-    0.8654, 0.863532, 0.861616, 0.859655, 0.857655, 0.85562,
-    0.853555, 0.851464, 0.849353, 0.847226, 0.845089, 0.842946,
-    0.840804, 0.838666, 0.836538, 0.834425, 0.832333, 0.830266,
-    0.82823, 0.82623, 0.82427, 0.822356, 0.820493, 0.818685,
-    0.816936, 0.815252, 0.813637, 0.812095, 0.810631, 0.809247,
-    0.807948, 0.806739, 0.805621, 0.804598, 0.803673, 0.80285,
-    0.80213, 0.801516, 0.801011, 0.800615, 0.800331, 0.800159,
-    0.800102, 0.80016, 0.800333, 0.800621, 0.801026, 0.801546,
-    0.802181, 0.80293, 0.803792, 0.804766, 0.80585, 0.807043,
-    0.808341, 0.809743, 0.811247, 0.812848, 0.814544, 0.816331,
-    0.818207, 0.820166, 0.822204, 0.824318, 0.826503, 0.828754,
-    0.831066, 0.833433, 0.835852, 0.838315, 0.840818, 0.843355,
-    0.84592, 0.848506, 0.851109, 0.853721, 0.856337, 0.85895,
-    0.861554, 0.864143, 0.86671, 0.869248, 0.871753, 0.874216,
-    0.876633, 0.878996, 0.8813, 0.883539, 0.885706, 0.887796,
-    0.889804, 0.891723, 0.893549, 0.895275, 0.896898, 0.898413,
-    0.899814, 0.901097, 0.902259, 0.903296, 0.904203, 0.904978,
-    0.905617, 0.906118, 0.906478, 0.906696, 0.906769, 0.906696,
-    0.906475, 0.906106, 0.905588, 0.904922, 0.904107, 0.903144,
-    0.902033, 0.900777, 0.899376, 0.897833, 0.896149, 0.894329,
-    0.892373, 0.890287, 0.888074, 0.885737, 0.883281, 0.88071,
-    0.878031, 0.875247, 0.872365, 0.869391, 0.86633, 0.86319,
-    0.859976, 0.856696, 0.853357, 0.849967, 0.846532, 0.843061,
-    0.839562, 0.836043, 0.832512, 0.828978, 0.825448, 0.821933,
-    0.818439, 0.814976, 0.811553, 0.808178, 0.804861, 0.801609,
-    0.798432, 0.795338, 0.792336, 0.789434, 0.78664, 0.783963,
-    0.781411, 0.77899, 0.77671, 0.774577, 0.772599, 0.770782,
-    0.769133, 0.767659, 0.766365, 0.765257, 0.76434, 0.76362,
-    0.7631, 0.762786, 0.76268, 0.762787, 0.763108, 0.763648,
-    0.764407, 0.765387, 0.76659, 0.768015, 0.769663, 0.771534,
-    0.773626, 0.775938, 0.778469, 0.781215, 0.784173, 0.787341,
-    0.790713, 0.794286, 0.798053, 0.80201, 0.80615, 0.810467,
-    0.814953, 0.8196, 0.8244, 0.829344, 0.834424, 0.839629,
-    0.844949, 0.850373, 0.855891, 0.861491, 0.867161, 0.872888,
-    0.87866, 0.884464, 0.890287, 0.896114, 0.901932, 0.907726,
-    0.913482, 0.919186, 0.924821, 0.930372, 0.935826, 0.941164,
-    0.946373, 0.951437, 0.956338, 0.961063, 0.965594, 0.969915,
-    0.974012, 0.977868, 0.981467, 0.984794, 0.987833, 0.99057,
-    0.992988, 0.995073, 0.99681, 0.998185, 0.999185, 0.999794,
-    1, 0.99979, 0.99915, 0.99807, 0.996536, 0.994539,
-    0.992066, 0.989108, 0.985654, 0.981697, 0.977226, 0.972234,
-    0.966713, 0.960657, 0.954059, 0.946914, 0.939217, 0.930964,
-    0.922151, 0.912775, 0.902834, 0.892327, 0.881253, 0.869612,
-    0.857406, 0.844634, 0.831301, 0.817408, 0.802959, 0.78796,
-    0.772415, 0.756329, 0.739711, 0.722567, 0.704905, 0.686734,
-    0.668063, 0.648904, 0.629266, 0.609162, 0.588603, 0.567602,
-    0.546173, 0.524329, 0.502086, 0.479459, 0.456462, 0.433113,
-    0.409428, 0.385425, 0.361121, 0.336534, 0.311682, 0.286585,
-    0.261261, 0.235731, 0.210014, 0.18413, 0.158099, 0.131943,
-    0.105681, 0.0793348, 0.0529251, 0.0264731, 1.55431e-15, -0.0264731,
-    -0.0529251, -0.0793348, -0.105681, -0.131943, -0.158099, -0.18413,
-    -0.210014, -0.235731, -0.261261, -0.286585, -0.311682, -0.336534,
-    -0.361121, -0.385425, -0.409428, -0.433113, -0.456462, -0.479459,
-    -0.502086, -0.524329, -0.546173, -0.567602, -0.588603, -0.609162,
-    -0.629266, -0.648904, -0.668063, -0.686734, -0.704905, -0.722567,
-    -0.739711, -0.756329, -0.772415, -0.78796, -0.802959, -0.817408,
-    -0.831301, -0.844634, -0.857406, -0.869612, -0.881253, -0.892327,
-    -0.902834, -0.912775, -0.922151, -0.930964, -0.939217, -0.946914,
-    -0.954059, -0.960657, -0.966713, -0.972234, -0.977226, -0.981697,
-    -0.985654, -0.989108, -0.992066, -0.994539, -0.996536, -0.99807,
-    -0.99915, -0.99979, -1, -0.999794, -0.999185, -0.998185,
-    -0.99681, -0.995073, -0.992988, -0.99057, -0.987833, -0.984794,
-    -0.981467, -0.977868, -0.974012, -0.969915, -0.965594, -0.961063,
-    -0.956338, -0.951437, -0.946373, -0.941164, -0.935826, -0.930372,
-    -0.924821, -0.919186, -0.913482, -0.907726, -0.901932, -0.896114,
-    -0.890287, -0.884464, -0.87866, -0.872888, -0.867161, -0.861491,
-    -0.855891, -0.850373, -0.844949, -0.839629, -0.834424, -0.829344,
-    -0.8244, -0.8196, -0.814953, -0.810467, -0.80615, -0.80201,
-    -0.798053, -0.794286, -0.790713, -0.787341, -0.784173, -0.781215,
-    -0.778469, -0.775938, -0.773626, -0.771534, -0.769663, -0.768015,
-    -0.76659, -0.765387, -0.764407, -0.763648, -0.763108, -0.762787,
-    -0.76268, -0.762786, -0.7631, -0.76362, -0.76434, -0.765257,
-    -0.766365, -0.767659, -0.769133, -0.770782, -0.772599, -0.774577,
-    -0.77671, -0.77899, -0.781411, -0.783963, -0.78664, -0.789434,
-    -0.792336, -0.795338, -0.798432, -0.801609, -0.804861, -0.808178,
-    -0.811553, -0.814976, -0.818439, -0.821933, -0.825448, -0.828978,
-    -0.832512, -0.836043, -0.839562, -0.843061, -0.846532, -0.849967,
-    -0.853357, -0.856696, -0.859976, -0.86319, -0.86633, -0.869391,
-    -0.872365, -0.875247, -0.878031, -0.88071, -0.883281, -0.885737,
-    -0.888074, -0.890287, -0.892373, -0.894329, -0.896149, -0.897833,
-    -0.899376, -0.900777, -0.902033, -0.903144, -0.904107, -0.904922,
-    -0.905588, -0.906106, -0.906475, -0.906696, -0.906769, -0.906696,
-    -0.906478, -0.906118, -0.905617, -0.904978, -0.904203, -0.903296,
-    -0.902259, -0.901097, -0.899814, -0.898413, -0.896898, -0.895275,
-    -0.893549, -0.891723, -0.889804, -0.887796, -0.885706, -0.883539,
-    -0.8813, -0.878996, -0.876633, -0.874216, -0.871753, -0.869248,
-    -0.86671, -0.864143, -0.861554, -0.85895, -0.856337, -0.853721,
-    -0.851109, -0.848506, -0.84592, -0.843355, -0.840818, -0.838315,
-    -0.835852, -0.833433, -0.831066, -0.828754, -0.826503, -0.824318,
-    -0.822204, -0.820166, -0.818207, -0.816331, -0.814544, -0.812848,
-    -0.811247, -0.809743, -0.808341, -0.807043, -0.80585, -0.804766,
-    -0.803792, -0.80293, -0.802181, -0.801546, -0.801026, -0.800621,
-    -0.800333, -0.80016, -0.800102, -0.800159, -0.800331, -0.800615,
-    -0.801011, -0.801516, -0.80213, -0.80285, -0.803673, -0.804598,
-    -0.805621, -0.806739, -0.807948, -0.809247, -0.810631, -0.812095,
-    -0.813637, -0.815252, -0.816936, -0.818685, -0.820493, -0.822356,
-    -0.82427, -0.82623, -0.82823, -0.830266, -0.832333, -0.834425,
-    -0.836538, -0.838666, -0.840804, -0.842946, -0.845089, -0.847226,
-    -0.849353, -0.851464, -0.853555, -0.85562, -0.857655, -0.859655,
-    -0.861616, -0.863532, -0.8654, -0.867216, -0.868974, -0.870672,
-    -0.872306, -0.873871, -0.875364, -0.876783, -0.878124, -0.879385,
-    -0.880562, -0.881653, -0.882656, -0.883568, -0.88439, -0.885117,
-    -0.88575, -0.886287, -0.886727, -0.88707, -0.887315, -0.887461,
-    -0.88751, -0.887462, -0.887316, -0.887073, -0.886735, -0.886303,
-    -0.885779, -0.885162, -0.884457, -0.883664, -0.882786, -0.881825,
-    -0.880785, -0.879667, -0.878474, -0.877211, -0.875879, -0.874483,
-    -0.873027, -0.871513, -0.869946, -0.868329, -0.866667, -0.864964,
-    -0.863224, -0.861451, -0.85965, -0.857825, -0.855981, -0.854122,
-    -0.852252, -0.850376, -0.848499, -0.846625, -0.844759, -0.842904,
-    -0.841066, -0.839249, -0.837456, -0.835693, -0.833964, -0.832272,
-    -0.830621, -0.829015, -0.827458, -0.825954, -0.824506, -0.823117,
-    -0.82179, -0.820529, -0.819336, -0.818214, -0.817165, -0.816192,
-    -0.815297, -0.814482, -0.813748, -0.813097, -0.81253, -0.812049,
-    -0.811654, -0.811347, -0.811127, -0.810995, -0.810951, -0.810995,
-    -0.811126, -0.811345, -0.81165, -0.81204, -0.812514, -0.813072,
-    -0.81371, -0.814428, -0.815224, -0.816096, -0.817041, -0.818057,
-    -0.819141, -0.820291, -0.821503, -0.822775, -0.824104, -0.825485,
-    -0.826917, -0.828394, -0.829914, -0.831473, -0.833067, -0.834692,
-    -0.836344, -0.83802, -0.839714, -0.841423, -0.843143, -0.84487,
-    -0.846599, -0.848327, -0.850049, -0.851761, -0.85346, -0.85514,
-    -0.856798, -0.85843, -0.860033, -0.861602, -0.863133, -0.864624,
-    -0.86607, -0.867468, -0.868816, -0.870109, -0.871345, -0.872521,
-    -0.873633, -0.874681, -0.87566, -0.87657, -0.877407, -0.878171,
-    -0.878858, -0.879468, -0.88, -0.880451, -0.880822, -0.881111,
-    -0.881318, -0.881442, -0.881483, -0.881442, -0.881318, -0.881112,
-    -0.880824, -0.880455, -0.880007, -0.87948, -0.878875, -0.878195,
-    -0.87744, -0.876614, -0.875717, -0.874752, -0.873722, -0.872628,
-    -0.871475, -0.870263, -0.868998, -0.86768, -0.866315, -0.864905,
-    -0.863453, -0.861963, -0.860438, -0.858883, -0.857301, -0.855695,
-    -0.854071, -0.852431, -0.850779, -0.849121, -0.847458, -0.845796,
-    -0.844139, -0.84249, -0.840853, -0.839233, -0.837633, -0.836057,
-    -0.834509, -0.832993, -0.831511, -0.830068, -0.828668, -0.827312,
-    -0.826006, -0.824751, -0.823551, -0.822409, -0.821327, -0.820308,
-    -0.819355, -0.818469, -0.817653, -0.816909, -0.816238, -0.815643,
-    -0.815123, -0.814682, -0.814319, -0.814037, -0.813834, -0.813712,
-    -0.813672, -0.813712, -0.813834, -0.814037, -0.814319, -0.814682,
-    -0.815123, -0.815643, -0.816238, -0.816909, -0.817653, -0.818469,
-    -0.819355, -0.820308, -0.821327, -0.822409, -0.823551, -0.824751,
-    -0.826006, -0.827312, -0.828668, -0.830068, -0.831511, -0.832993,
-    -0.834509, -0.836057, -0.837633, -0.839233, -0.840853, -0.84249,
-    -0.844139, -0.845796, -0.847458, -0.849121, -0.850779, -0.852431,
-    -0.854071, -0.855695, -0.857301, -0.858883, -0.860438, -0.861963,
-    -0.863453, -0.864905, -0.866315, -0.86768, -0.868998, -0.870263,
-    -0.871475, -0.872628, -0.873722, -0.874752, -0.875717, -0.876614,
-    -0.87744, -0.878195, -0.878875, -0.87948, -0.880007, -0.880455,
-    -0.880824, -0.881112, -0.881318, -0.881442, -0.881483, -0.881442,
-    -0.881318, -0.881111, -0.880822, -0.880451, -0.88, -0.879468,
-    -0.878858, -0.878171, -0.877407, -0.87657, -0.87566, -0.874681,
-    -0.873633, -0.872521, -0.871345, -0.870109, -0.868816, -0.867468,
-    -0.86607, -0.864624, -0.863133, -0.861602, -0.860033, -0.85843,
-    -0.856798, -0.85514, -0.85346, -0.851761, -0.850049, -0.848327,
-    -0.846599, -0.84487, -0.843143, -0.841423, -0.839714, -0.83802,
-    -0.836344, -0.834692, -0.833067, -0.831473, -0.829914, -0.828394,
-    -0.826917, -0.825485, -0.824104, -0.822775, -0.821503, -0.820291,
-    -0.819141, -0.818057, -0.817041, -0.816096, -0.815224, -0.814428,
-    -0.81371, -0.813072, -0.812514, -0.81204, -0.81165, -0.811345,
-    -0.811126, -0.810995, -0.810951, -0.810995, -0.811127, -0.811347,
-    -0.811654, -0.812049, -0.81253, -0.813097, -0.813748, -0.814482,
-    -0.815297, -0.816192, -0.817165, -0.818214, -0.819336, -0.820529,
-    -0.82179, -0.823117, -0.824506, -0.825954, -0.827458, -0.829015,
-    -0.830621, -0.832272, -0.833964, -0.835693, -0.837456, -0.839249,
-    -0.841066, -0.842904, -0.844759, -0.846625, -0.848499, -0.850376,
-    -0.852252, -0.854122, -0.855981, -0.857825, -0.85965, -0.861451,
-    -0.863224, -0.864964, -0.866667, -0.868329, -0.869946, -0.871513,
-    -0.873027, -0.874483, -0.875879, -0.877211, -0.878474, -0.879667,
-    -0.880785, -0.881825, -0.882786, -0.883664, -0.884457, -0.885162,
-    -0.885779, -0.886303, -0.886735, -0.887073, -0.887316, -0.887462,
-    -0.88751, -0.887461, -0.887315, -0.88707, -0.886727, -0.886287,
-    -0.88575, -0.885117, -0.88439, -0.883568, -0.882656, -0.881653,
-    -0.880562, -0.879385, -0.878124, -0.876783, -0.875364, -0.873871,
-    -0.872306, -0.870672, -0.868974, -0.867216, -0.8654, -0.863532,
-    -0.861616, -0.859655, -0.857655, -0.85562, -0.853555, -0.851464,
-    -0.849353, -0.847226, -0.845089, -0.842946, -0.840804, -0.838666,
-    -0.836538, -0.834425, -0.832333, -0.830266, -0.82823, -0.82623,
-    -0.82427, -0.822356, -0.820493, -0.818685, -0.816936, -0.815252,
-    -0.813637, -0.812095, -0.810631, -0.809247, -0.807948, -0.806739,
-    -0.805621, -0.804598, -0.803673, -0.80285, -0.80213, -0.801516,
-    -0.801011, -0.800615, -0.800331, -0.800159, -0.800102, -0.80016,
-    -0.800333, -0.800621, -0.801026, -0.801546, -0.802181, -0.80293,
-    -0.803792, -0.804766, -0.80585, -0.807043, -0.808341, -0.809743,
-    -0.811247, -0.812848, -0.814544, -0.816331, -0.818207, -0.820166,
-    -0.822204, -0.824318, -0.826503, -0.828754, -0.831066, -0.833433,
-    -0.835852, -0.838315, -0.840818, -0.843355, -0.84592, -0.848506,
-    -0.851109, -0.853721, -0.856337, -0.85895, -0.861554, -0.864143,
-    -0.86671, -0.869248, -0.871753, -0.874216, -0.876633, -0.878996,
-    -0.8813, -0.883539, -0.885706, -0.887796, -0.889804, -0.891723,
-    -0.893549, -0.895275, -0.896898, -0.898413, -0.899814, -0.901097,
-    -0.902259, -0.903296, -0.904203, -0.904978, -0.905617, -0.906118,
-    -0.906478, -0.906696, -0.906769, -0.906696, -0.906475, -0.906106,
-    -0.905588, -0.904922, -0.904107, -0.903144, -0.902033, -0.900777,
-    -0.899376, -0.897833, -0.896149, -0.894329, -0.892373, -0.890287,
-    -0.888074, -0.885737, -0.883281, -0.88071, -0.878031, -0.875247,
-    -0.872365, -0.869391, -0.86633, -0.86319, -0.859976, -0.856696,
-    -0.853357, -0.849967, -0.846532, -0.843061, -0.839562, -0.836043,
-    -0.832512, -0.828978, -0.825448, -0.821933, -0.818439, -0.814976,
-    -0.811553, -0.808178, -0.804861, -0.801609, -0.798432, -0.795338,
-    -0.792336, -0.789434, -0.78664, -0.783963, -0.781411, -0.77899,
-    -0.77671, -0.774577, -0.772599, -0.770782, -0.769133, -0.767659,
-    -0.766365, -0.765257, -0.76434, -0.76362, -0.7631, -0.762786,
-    -0.76268, -0.762787, -0.763108, -0.763648, -0.764407, -0.765387,
-    -0.76659, -0.768015, -0.769663, -0.771534, -0.773626, -0.775938,
-    -0.778469, -0.781215, -0.784173, -0.787341, -0.790713, -0.794286,
-    -0.798053, -0.80201, -0.80615, -0.810467, -0.814953, -0.8196,
-    -0.8244, -0.829344, -0.834424, -0.839629, -0.844949, -0.850373,
-    -0.855891, -0.861491, -0.867161, -0.872888, -0.87866, -0.884464,
-    -0.890287, -0.896114, -0.901932, -0.907726, -0.913482, -0.919186,
-    -0.924821, -0.930372, -0.935826, -0.941164, -0.946373, -0.951437,
-    -0.956338, -0.961063, -0.965594, -0.969915, -0.974012, -0.977868,
-    -0.981467, -0.984794, -0.987833, -0.99057, -0.992988, -0.995073,
-    -0.99681, -0.998185, -0.999185, -0.999794, -1, -0.99979,
-    -0.99915, -0.99807, -0.996536, -0.994539, -0.992066, -0.989108,
-    -0.985654, -0.981697, -0.977226, -0.972234, -0.966713, -0.960657,
-    -0.954059, -0.946914, -0.939217, -0.930964, -0.922151, -0.912775,
-    -0.902834, -0.892327, -0.881253, -0.869612, -0.857406, -0.844634,
-    -0.831301, -0.817408, -0.802959, -0.78796, -0.772415, -0.756329,
-    -0.739711, -0.722567, -0.704905, -0.686734, -0.668063, -0.648904,
-    -0.629266, -0.609162, -0.588603, -0.567602, -0.546173, -0.524329,
-    -0.502086, -0.479459, -0.456462, -0.433113, -0.409428, -0.385425,
-    -0.361121, -0.336534, -0.311682, -0.286585, -0.261261, -0.235731,
-    -0.210014, -0.18413, -0.158099, -0.131943, -0.105681, -0.0793348,
-    -0.0529251, -0.0264731
-};
-
-static const float WAVE_SQUARE_102[DEFAULT_WAVELEN] = {
-    4.44089e-16, 0.0131938, 0.0263851, 0.0395711, 0.0527493, 0.0659171,
-    0.0790719, 0.092211, 0.105332, 0.118432, 0.131509, 0.14456,
-    0.157582, 0.170574, 0.183531, 0.196453, 0.209336, 0.222178,
-    0.234976, 0.247729, 0.260432, 0.273085, 0.285685, 0.298228,
-    0.310714, 0.323139, 0.335501, 0.347798, 0.360027, 0.372187,
-    0.384275, 0.396288, 0.408225, 0.420084, 0.431862, 0.443556,
-    0.455166, 0.466689, 0.478123, 0.489466, 0.500716, 0.511871,
-    0.522929, 0.533888, 0.544747, 0.555504, 0.566156, 0.576702,
-    0.587141, 0.597471, 0.60769, 0.617797, 0.627789, 0.637666,
-    0.647426, 0.657068, 0.66659, 0.675991, 0.68527, 0.694425,
-    0.703455, 0.712359, 0.721135, 0.729784, 0.738303, 0.746691,
-    0.754948, 0.763073, 0.771065, 0.778923, 0.786646, 0.794233,
-    0.801685, 0.808999, 0.816176, 0.823214, 0.830114, 0.836875,
-    0.843497, 0.849978, 0.85632, 0.86252, 0.86858, 0.874499,
-    0.880277, 0.885913, 0.891408, 0.896762, 0.901974, 0.907045,
-    0.911975, 0.916764, 0.921412, 0.925919, 0.930286, 0.934512,
-    0.9386, 0.942548, 0.946357, 0.950028, 0.953561, 0.956957,
-    0.960216, 0.96334, 0.966328, 0.969182, 0.971903, 0.97449,
-    0.976946, 0.979271, 0.981465, 0.98353, 0.985467, 0.987278,
-    0.988962, 0.990521, 0.991957, 0.99327, 0.994461, 0.995533,
-    0.996486, 0.997322, 0.998041, 0.998646, 0.999137, 0.999517,
-    0.999786, 0.999947, 1, 0.999947, 0.999791, 0.999531,
-    0.999171, 0.998711, 0.998154, 0.997501, 0.996753, 0.995913,
-    0.994982, 0.993963, 0.992856, 0.991664, 0.990389, 0.989031,
-    0.987594, 0.98608, 0.984489, 0.982824, 0.981087, 0.979279,
-    0.977404, 0.975462, 0.973455, 0.971387, 0.969257, 0.967069,
-    0.964825, 0.962526, 0.960175, 0.957773, 0.955323, 0.952826,
-    0.950284, 0.9477, 0.945076, 0.942413, 0.939714, 0.936979,
-    0.934213, 0.931416, 0.92859, 0.925738, 0.922861, 0.919961,
-    0.917041, 0.914102, 0.911145, 0.908174, 0.90519, 0.902195,
-    0.89919, 0.896179, 0.893161, 0.89014, 0.887116, 0.884093,
-    0.881072, 0.878053, 0.87504, 0.872034, 0.869037, 0.86605,
-    0.863074, 0.860113, 0.857167, 0.854237, 0.851326, 0.848435,
-    0.845566, 0.842719, 0.839897, 0.837101, 0.834332, 0.831592,
-    0.828883, 0.826204, 0.823559, 0.820948, 0.818372, 0.815832,
-    0.813331, 0.810868, 0.808445, 0.806064, 0.803725, 0.801429,
-    0.799178, 0.796971, 0.794812, 0.792699, 0.790634, 0.788619,
-    0.786653, 0.784737, 0.782873, 0.781061, 0.779301, 0.777595,
-    0.775943, 0.774345, 0.772802, 0.771315, 0.769884, 0.76851,
-    0.767192, 0.765932, 0.764729, 0.763584, 0.762498, 0.76147,
-    0.760501, 0.75959, 0.758739, 0.757947, 0.757214, 0.75654,
-    0.755925, 0.75537, 0.754874, 0.754437, 0.754059, 0.753739,
-    0.753479, 0.753276, 0.753132, 0.753046, 0.753017, 0.753046,
-    0.753131, 0.753273, 0.753471, 0.753725, 0.754033, 0.754397,
-    0.754814, 0.755285, 0.755809, 0.756385, 0.757013, 0.757692,
-    0.758421, 0.7592, 0.760027, 0.760903, 0.761826, 0.762796,
-    0.763811, 0.764871, 0.765975, 0.767122, 0.768312, 0.769542,
-    0.770813, 0.772123, 0.773472, 0.774858, 0.77628, 0.777738,
-    0.779229, 0.780755, 0.782312, 0.7839, 0.785519, 0.787166,
-    0.788841, 0.790542, 0.79227, 0.794021, 0.795796, 0.797592,
-    0.79941, 0.801247, 0.803103, 0.804977, 0.806866, 0.80877,
-    0.810688, 0.812619, 0.814561, 0.816513, 0.818475, 0.820444,
-    0.822419, 0.8244, 0.826386, 0.828374, 0.830364, 0.832354,
-    0.834344, 0.836333, 0.838318, 0.840299, 0.842276, 0.844245,
-    0.846208, 0.848161, 0.850105, 0.852038, 0.853959, 0.855867,
-    0.857761, 0.859639, 0.861502, 0.863347, 0.865173, 0.866981,
-    0.868768, 0.870533, 0.872277, 0.873997, 0.875693, 0.877364,
-    0.879008, 0.880626, 0.882217, 0.883778, 0.885311, 0.886813,
-    0.888284, 0.889723, 0.89113, 0.892503, 0.893843, 0.895148,
-    0.896417, 0.897651, 0.898848, 0.900008, 0.901131, 0.902215,
-    0.90326, 0.904266, 0.905233, 0.906159, 0.907044, 0.907889,
-    0.908692, 0.909454, 0.910173, 0.91085, 0.911484, 0.912076,
-    0.912624, 0.913129, 0.91359, 0.914008, 0.914382, 0.914712,
-    0.914998, 0.91524, 0.915437, 0.915591, 0.915701, 0.915767,
-    0.915789, 0.915767, 0.915701, 0.915592, 0.91544, 0.915244,
-    0.915006, 0.914724, 0.914401, 0.914035, 0.913627, 0.913178,
-    0.912687, 0.912156, 0.911585, 0.910974, 0.910323, 0.909633,
-    0.908905, 0.908139, 0.907335, 0.906494, 0.905618, 0.904705,
-    0.903757, 0.902775, 0.901759, 0.90071, 0.899629, 0.898515,
-    0.897371, 0.896196, 0.894992, 0.893759, 0.892498, 0.89121,
-    0.889896, 0.888556, 0.887191, 0.885802, 0.88439, 0.882957,
-    0.881502, 0.880026, 0.878531, 0.877018, 0.875487, 0.87394,
-    0.872376, 0.870798, 0.869206, 0.867602, 0.865985, 0.864358,
-    0.86272, 0.861074, 0.85942, 0.857759, 0.856092, 0.854419,
-    0.852743, 0.851064, 0.849383, 0.847701, 0.846019, 0.844339,
-    0.84266, 0.840984, 0.839312, 0.837645, 0.835984, 0.83433,
-    0.832684, 0.831047, 0.82942, 0.827803, 0.826198, 0.824606,
-    0.823028, 0.821464, 0.819915, 0.818383, 0.816869, 0.815372,
-    0.813894, 0.812436, 0.810999, 0.809584, 0.808191, 0.806821,
-    0.805474, 0.804153, 0.802857, 0.801588, 0.800346, 0.799131,
-    0.797945, 0.796787, 0.79566, 0.794563, 0.793497, 0.792463,
-    0.791461, 0.790492, 0.789556, 0.788654, 0.787787, 0.786955,
-    0.786158, 0.785397, 0.784673, 0.783985, 0.783334, 0.782721,
-    0.782146, 0.781609, 0.78111, 0.780651, 0.78023, 0.779849,
-    0.779507, 0.779205, 0.778943, 0.778721, 0.77854, 0.778398,
-    0.778297, 0.778236, 0.778216, 0.778236, 0.778297, 0.778398,
-    0.77854, 0.778721, 0.778943, 0.779205, 0.779507, 0.779849,
-    0.78023, 0.780651, 0.78111, 0.781609, 0.782146, 0.782721,
-    0.783334, 0.783985, 0.784673, 0.785397, 0.786158, 0.786955,
-    0.787787, 0.788654, 0.789556, 0.790492, 0.791461, 0.792463,
-    0.793497, 0.794563, 0.79566, 0.796787, 0.797945, 0.799131,
-    0.800346, 0.801588, 0.802857, 0.804153, 0.805474, 0.806821,
-    0.808191, 0.809584, 0.810999, 0.812436, 0.813894, 0.815372,
-    0.816869, 0.818383, 0.819915, 0.821464, 0.823028, 0.824606,
-    0.826198, 0.827803, 0.82942, 0.831047, 0.832684, 0.83433,
-    0.835984, 0.837645, 0.839312, 0.840984, 0.84266, 0.844339,
-    0.846019, 0.847701, 0.849383, 0.851064, 0.852743, 0.854419,
-    0.856092, 0.857759, 0.85942, 0.861074, 0.86272, 0.864358,
-    0.865985, 0.867602, 0.869206, 0.870798, 0.872376, 0.87394,
-    0.875487, 0.877018, 0.878531, 0.880026, 0.881502, 0.882957,
-    0.88439, 0.885802, 0.887191, 0.888556, 0.889896, 0.89121,
-    0.892498, 0.893759, 0.894992, 0.896196, 0.897371, 0.898515,
-    0.899629, 0.90071, 0.901759, 0.902775, 0.903757, 0.904705,
-    0.905618, 0.906494, 0.907335, 0.908139, 0.908905, 0.909633,
-    0.910323, 0.910974, 0.911585, 0.912156, 0.912687, 0.913178,
-    0.913627, 0.914035, 0.914401, 0.914724, 0.915006, 0.915244,
-    0.91544, 0.915592, 0.915701, 0.915767, 0.915789, 0.915767,
-    0.915701, 0.915591, 0.915437, 0.91524, 0.914998, 0.914712,
-    0.914382, 0.914008, 0.91359, 0.913129, 0.912624, 0.912076,
-    0.911484, 0.91085, 0.910173, 0.909454, 0.908692, 0.907889,
-    0.907044, 0.906159, 0.905233, 0.904266, 0.90326, 0.902215,
-    0.901131, 0.900008, 0.898848, 0.897651, 0.896417, 0.895148,
-    0.893843, 0.892503, 0.89113, 0.889723, 0.888284, 0.886813,
-    0.885311, 0.883778, 0.882217, 0.880626, 0.879008, 0.877364,
-    0.875693, 0.873997, 0.872277, 0.870533, 0.868768, 0.866981,
-    0.865173, 0.863347, 0.861502, 0.859639, 0.857761, 0.855867,
-    0.853959, 0.852038, 0.850105, 0.848161, 0.846208, 0.844245,
-    0.842276, 0.840299, 0.838318, 0.836333, 0.834344, 0.832354,
-    0.830364, 0.828374, 0.826386, 0.8244, 0.822419, 0.820444,
-    0.818475, 0.816513, 0.814561, 0.812619, 0.810688, 0.80877,
-    0.806866, 0.804977, 0.803103, 0.801247, 0.79941, 0.797592,
-    0.795796, 0.794021, 0.79227, 0.790542, 0.788841, 0.787166,
-    0.785519, 0.7839, 0.782312, 0.780755, 0.779229, 0.777738,
-    0.77628, 0.774858, 0.773472, 0.772123, 0.770813, 0.769542,
-    0.768312, 0.767122, 0.765975, 0.764871, 0.763811, 0.762796,
-    0.761826, 0.760903, 0.760027, 0.7592, 0.758421, 0.757692,
-    0.757013, 0.756385, 0.755809, 0.755285, 0.754814, 0.754397,
-    0.754033, 0.753725, 0.753471, 0.753273, 0.753131, 0.753046,
-    0.753017, 0.753046, 0.753132, 0.753276, 0.753479, 0.753739,
-    0.754059, 0.754437, 0.754874, 0.75537, 0.755925, 0.75654,
-    0.757214, 0.757947, 0.758739, 0.75959, 0.760501, 0.76147,
-    0.762498, 0.763584, 0.764729, 0.765932, 0.767192, 0.76851,
-    0.769884, 0.771315, 0.772802, 0.774345, 0.775943, 0.777595,
-    0.779301, 0.781061, 0.782873, 0.784737, 0.786653, 0.788619,
-    0.790634, 0.792699, 0.794812, 0.796971, 0.799178, 0.801429,
-    0.803725, 0.806064, 0.808445, 0.810868, 0.813331, 0.815832,
-    0.818372, 0.820948, 0.823559, 0.826204, 0.828883, 0.831592,
-    0.834332, 0.837101, 0.839897, 0.842719, 0.845566, 0.848435,
-    0.851326, 0.854237, 0.857167, 0.860113, 0.863074, 0.86605,
-    0.869037, 0.872034, 0.87504, 0.878053, 0.881072, 0.884093,
-    0.887116, 0.89014, 0.893161, 0.896179, 0.89919, 0.902195,
-    0.90519, 0.908174, 0.911145, 0.914102, 0.917041, 0.919961,
-    0.922861, 0.925738, 0.92859, 0.931416, 0.934213, 0.936979,
-    0.939714, 0.942413, 0.945076, 0.9477, 0.950284, 0.952826,
-    0.955323, 0.957773, 0.960175, 0.962526, 0.964825, 0.967069,
-    0.969257, 0.971387, 0.973455, 0.975462, 0.977404, 0.979279,
-    0.981087, 0.982824, 0.984489, 0.98608, 0.987594, 0.989031,
-    0.990389, 0.991664, 0.992856, 0.993963, 0.994982, 0.995913,
-    0.996753, 0.997501, 0.998154, 0.998711, 0.999171, 0.999531,
-    0.999791, 0.999947, 1, 0.999947, 0.999786, 0.999517,
-    0.999137, 0.998646, 0.998041, 0.997322, 0.996486, 0.995533,
-    0.994461, 0.99327, 0.991957, 0.990521, 0.988962, 0.987278,
-    0.985467, 0.98353, 0.981465, 0.979271, 0.976946, 0.97449,
-    0.971903, 0.969182, 0.966328, 0.96334, 0.960216, 0.956957,
-    0.953561, 0.950028, 0.946357, 0.942548, 0.9386, 0.934512,
-    0.930286, 0.925919, 0.921412, 0.916764, 0.911975, 0.907045,
-    0.901974, 0.896762, 0.891408, 0.885913, 0.880277, 0.874499,
-    0.86858, 0.86252, 0.85632, 0.849978, 0.843497, 0.836875,
-    0.830114, 0.823214, 0.816176, 0.808999, 0.801685, 0.794233,
-    0.786646, 0.778923, 0.771065, 0.763073, 0.754948, 0.746691,
-    0.738303, 0.729784, 0.721135, 0.712359, 0.703455, 0.694425,
-    0.68527, 0.675991, 0.66659, 0.657068, 0.647426, 0.637666,
-    0.627789, 0.617797, 0.60769, 0.597471, 0.587141, 0.576702,
-    0.566156, 0.555504, 0.544747, 0.533888, 0.522929, 0.511871,
-    0.500716, 0.489466, 0.478123, 0.466689, 0.455166, 0.443556,
-    0.431862, 0.420084, 0.408225, 0.396288, 0.384275, 0.372187,
-    0.360027, 0.347798, 0.335501, 0.323139, 0.310714, 0.298228,
-    0.285685, 0.273085, 0.260432, 0.247729, 0.234976, 0.222178,
-    0.209336, 0.196453, 0.183531, 0.170574, 0.157582, 0.14456,
-    0.131509, 0.118432, 0.105332, 0.092211, 0.0790719, 0.0659171,
-    0.0527493, 0.0395711, 0.0263851, 0.0131938, 8.88178e-16, -0.0131938,
-    -0.0263851, -0.0395711, -0.0527493, -0.0659171, -0.0790719, -0.092211,
-    -0.105332, -0.118432, -0.131509, -0.14456, -0.157582, -0.170574,
-    -0.183531, -0.196453, -0.209336, -0.222178, -0.234976, -0.247729,
-    -0.260432, -0.273085, -0.285685, -0.298228, -0.310714, -0.323139,
-    -0.335501, -0.347798, -0.360027, -0.372187, -0.384275, -0.396288,
-    -0.408225, -0.420084, -0.431862, -0.443556, -0.455166, -0.466689,
-    -0.478123, -0.489466, -0.500716, -0.511871, -0.522929, -0.533888,
-    -0.544747, -0.555504, -0.566156, -0.576702, -0.587141, -0.597471,
-    -0.60769, -0.617797, -0.627789, -0.637666, -0.647426, -0.657068,
-    -0.66659, -0.675991, -0.68527, -0.694425, -0.703455, -0.712359,
-    -0.721135, -0.729784, -0.738303, -0.746691, -0.754948, -0.763073,
-    -0.771065, -0.778923, -0.786646, -0.794233, -0.801685, -0.808999,
-    -0.816176, -0.823214, -0.830114, -0.836875, -0.843497, -0.849978,
-    -0.85632, -0.86252, -0.86858, -0.874499, -0.880277, -0.885913,
-    -0.891408, -0.896762, -0.901974, -0.907045, -0.911975, -0.916764,
-    -0.921412, -0.925919, -0.930286, -0.934512, -0.9386, -0.942548,
-    -0.946357, -0.950028, -0.953561, -0.956957, -0.960216, -0.96334,
-    -0.966328, -0.969182, -0.971903, -0.97449, -0.976946, -0.979271,
-    -0.981465, -0.98353, -0.985467, -0.987278, -0.988962, -0.990521,
-    -0.991957, -0.99327, -0.994461, -0.995533, -0.996486, -0.997322,
-    -0.998041, -0.998646, -0.999137, -0.999517, -0.999786, -0.999947,
-    -1, -0.999947, -0.999791, -0.999531, -0.999171, -0.998711,
-    -0.998154, -0.997501, -0.996753, -0.995913, -0.994982, -0.993963,
-    -0.992856, -0.991664, -0.990389, -0.989031, -0.987594, -0.98608,
-    -0.984489, -0.982824, -0.981087, -0.979279, -0.977404, -0.975462,
-    -0.973455, -0.971387, -0.969257, -0.967069, -0.964825, -0.962526,
-    -0.960175, -0.957773, -0.955323, -0.952826, -0.950284, -0.9477,
-    -0.945076, -0.942413, -0.939714, -0.936979, -0.934213, -0.931416,
-    -0.92859, -0.925738, -0.922861, -0.919961, -0.917041, -0.914102,
-    -0.911145, -0.908174, -0.90519, -0.902195, -0.89919, -0.896179,
-    -0.893161, -0.89014, -0.887116, -0.884093, -0.881072, -0.878053,
-    -0.87504, -0.872034, -0.869037, -0.86605, -0.863074, -0.860113,
-    -0.857167, -0.854237, -0.851326, -0.848435, -0.845566, -0.842719,
-    -0.839897, -0.837101, -0.834332, -0.831592, -0.828883, -0.826204,
-    -0.823559, -0.820948, -0.818372, -0.815832, -0.813331, -0.810868,
-    -0.808445, -0.806064, -0.803725, -0.801429, -0.799178, -0.796971,
-    -0.794812, -0.792699, -0.790634, -0.788619, -0.786653, -0.784737,
-    -0.782873, -0.781061, -0.779301, -0.777595, -0.775943, -0.774345,
-    -0.772802, -0.771315, -0.769884, -0.76851, -0.767192, -0.765932,
-    -0.764729, -0.763584, -0.762498, -0.76147, -0.760501, -0.75959,
-    -0.758739, -0.757947, -0.757214, -0.75654, -0.755925, -0.75537,
-    -0.754874, -0.754437, -0.754059, -0.753739, -0.753479, -0.753276,
-    -0.753132, -0.753046, -0.753017, -0.753046, -0.753131, -0.753273,
-    -0.753471, -0.753725, -0.754033, -0.754397, -0.754814, -0.755285,
-    -0.755809, -0.756385, -0.757013, -0.757692, -0.758421, -0.7592,
-    -0.760027, -0.760903, -0.761826, -0.762796, -0.763811, -0.764871,
-    -0.765975, -0.767122, -0.768312, -0.769542, -0.770813, -0.772123,
-    -0.773472, -0.774858, -0.77628, -0.777738, -0.779229, -0.780755,
-    -0.782312, -0.7839, -0.785519, -0.787166, -0.788841, -0.790542,
-    -0.79227, -0.794021, -0.795796, -0.797592, -0.79941, -0.801247,
-    -0.803103, -0.804977, -0.806866, -0.80877, -0.810688, -0.812619,
-    -0.814561, -0.816513, -0.818475, -0.820444, -0.822419, -0.8244,
-    -0.826386, -0.828374, -0.830364, -0.832354, -0.834344, -0.836333,
-    -0.838318, -0.840299, -0.842276, -0.844245, -0.846208, -0.848161,
-    -0.850105, -0.852038, -0.853959, -0.855867, -0.857761, -0.859639,
-    -0.861502, -0.863347, -0.865173, -0.866981, -0.868768, -0.870533,
-    -0.872277, -0.873997, -0.875693, -0.877364, -0.879008, -0.880626,
-    -0.882217, -0.883778, -0.885311, -0.886813, -0.888284, -0.889723,
-    -0.89113, -0.892503, -0.893843, -0.895148, -0.896417, -0.897651,
-    -0.898848, -0.900008, -0.901131, -0.902215, -0.90326, -0.904266,
-    -0.905233, -0.906159, -0.907044, -0.907889, -0.908692, -0.909454,
-    -0.910173, -0.91085, -0.911484, -0.912076, -0.912624, -0.913129,
-    -0.91359, -0.914008, -0.914382, -0.914712, -0.914998, -0.91524,
-    -0.915437, -0.915591, -0.915701, -0.915767, -0.915789, -0.915767,
-    -0.915701, -0.915592, -0.91544, -0.915244, -0.915006, -0.914724,
-    -0.914401, -0.914035, -0.913627, -0.913178, -0.912687, -0.912156,
-    -0.911585, -0.910974, -0.910323, -0.909633, -0.908905, -0.908139,
-    -0.907335, -0.906494, -0.905618, -0.904705, -0.903757, -0.902775,
-    -0.901759, -0.90071, -0.899629, -0.898515, -0.897371, -0.896196,
-    -0.894992, -0.893759, -0.892498, -0.89121, -0.889896, -0.888556,
-    -0.887191, -0.885802, -0.88439, -0.882957, -0.881502, -0.880026,
-    -0.878531, -0.877018, -0.875487, -0.87394, -0.872376, -0.870798,
-    -0.869206, -0.867602, -0.865985, -0.864358, -0.86272, -0.861074,
-    -0.85942, -0.857759, -0.856092, -0.854419, -0.852743, -0.851064,
-    -0.849383, -0.847701, -0.846019, -0.844339, -0.84266, -0.840984,
-    -0.839312, -0.837645, -0.835984, -0.83433, -0.832684, -0.831047,
-    -0.82942, -0.827803, -0.826198, -0.824606, -0.823028, -0.821464,
-    -0.819915, -0.818383, -0.816869, -0.815372, -0.813894, -0.812436,
-    -0.810999, -0.809584, -0.808191, -0.806821, -0.805474, -0.804153,
-    -0.802857, -0.801588, -0.800346, -0.799131, -0.797945, -0.796787,
-    -0.79566, -0.794563, -0.793497, -0.792463, -0.791461, -0.790492,
-    -0.789556, -0.788654, -0.787787, -0.786955, -0.786158, -0.785397,
-    -0.784673, -0.783985, -0.783334, -0.782721, -0.782146, -0.781609,
-    -0.78111, -0.780651, -0.78023, -0.779849, -0.779507, -0.779205,
-    -0.778943, -0.778721, -0.77854, -0.778398, -0.778297, -0.778236,
-    -0.778216, -0.778236, -0.778297, -0.778398, -0.77854, -0.778721,
-    -0.778943, -0.779205, -0.779507, -0.779849, -0.78023, -0.780651,
-    -0.78111, -0.781609, -0.782146, -0.782721, -0.783334, -0.783985,
-    -0.784673, -0.785397, -0.786158, -0.786955, -0.787787, -0.788654,
-    -0.789556, -0.790492, -0.791461, -0.792463, -0.793497, -0.794563,
-    -0.79566, -0.796787, -0.797945, -0.799131, -0.800346, -0.801588,
-    -0.802857, -0.804153, -0.805474, -0.806821, -0.808191, -0.809584,
-    -0.810999, -0.812436, -0.813894, -0.815372, -0.816869, -0.818383,
-    -0.819915, -0.821464, -0.823028, -0.824606, -0.826198, -0.827803,
-    -0.82942, -0.831047, -0.832684, -0.83433, -0.835984, -0.837645,
-    -0.839312, -0.840984, -0.84266, -0.844339, -0.846019, -0.847701,
-    -0.849383, -0.851064, -0.852743, -0.854419, -0.856092, -0.857759,
-    -0.85942, -0.861074, -0.86272, -0.864358, -0.865985, -0.867602,
-    -0.869206, -0.870798, -0.872376, -0.87394, -0.875487, -0.877018,
-    -0.878531, -0.880026, -0.881502, -0.882957, -0.88439, -0.885802,
-    -0.887191, -0.888556, -0.889896, -0.89121, -0.892498, -0.893759,
-    -0.894992, -0.896196, -0.897371, -0.898515, -0.899629, -0.90071,
-    -0.901759, -0.902775, -0.903757, -0.904705, -0.905618, -0.906494,
-    -0.907335, -0.908139, -0.908905, -0.909633, -0.910323, -0.910974,
-    -0.911585, -0.912156, -0.912687, -0.913178, -0.913627, -0.914035,
-    -0.914401, -0.914724, -0.915006, -0.915244, -0.91544, -0.915592,
-    -0.915701, -0.915767, -0.915789, -0.915767, -0.915701, -0.915591,
-    -0.915437, -0.91524, -0.914998, -0.914712, -0.914382, -0.914008,
-    -0.91359, -0.913129, -0.912624, -0.912076, -0.911484, -0.91085,
-    -0.910173, -0.909454, -0.908692, -0.907889, -0.907044, -0.906159,
-    -0.905233, -0.904266, -0.90326, -0.902215, -0.901131, -0.900008,
-    -0.898848, -0.897651, -0.896417, -0.895148, -0.893843, -0.892503,
-    -0.89113, -0.889723, -0.888284, -0.886813, -0.885311, -0.883778,
-    -0.882217, -0.880626, -0.879008, -0.877364, -0.875693, -0.873997,
-    -0.872277, -0.870533, -0.868768, -0.866981, -0.865173, -0.863347,
-    -0.861502, -0.859639, -0.857761, -0.855867, -0.853959, -0.852038,
-    -0.850105, -0.848161, -0.846208, -0.844245, -0.842276, -0.840299,
-    -0.838318, -0.836333, -0.834344, -0.832354, -0.830364, -0.828374,
-    -0.826386, -0.8244, -0.822419, -0.820444, -0.818475, -0.816513,
-    -0.814561, -0.812619, -0.810688, -0.80877, -0.806866, -0.804977,
-    -0.803103, -0.801247, -0.79941, -0.797592, -0.795796, -0.794021,
-    -0.79227, -0.790542, -0.788841, -0.787166, -0.785519, -0.7839,
-    -0.782312, -0.780755, -0.779229, -0.777738, -0.77628, -0.774858,
-    -0.773472, -0.772123, -0.770813, -0.769542, -0.768312, -0.767122,
-    -0.765975, -0.764871, -0.763811, -0.762796, -0.761826, -0.760903,
-    -0.760027, -0.7592, -0.758421, -0.757692, -0.757013, -0.756385,
-    -0.755809, -0.755285, -0.754814, -0.754397, -0.754033, -0.753725,
-    -0.753471, -0.753273, -0.753131, -0.753046, -0.753017, -0.753046,
-    -0.753132, -0.753276, -0.753479, -0.753739, -0.754059, -0.754437,
-    -0.754874, -0.75537, -0.755925, -0.75654, -0.757214, -0.757947,
-    -0.758739, -0.75959, -0.760501, -0.76147, -0.762498, -0.763584,
-    -0.764729, -0.765932, -0.767192, -0.76851, -0.769884, -0.771315,
-    -0.772802, -0.774345, -0.775943, -0.777595, -0.779301, -0.781061,
-    -0.782873, -0.784737, -0.786653, -0.788619, -0.790634, -0.792699,
-    -0.794812, -0.796971, -0.799178, -0.801429, -0.803725, -0.806064,
-    -0.808445, -0.810868, -0.813331, -0.815832, -0.818372, -0.820948,
-    -0.823559, -0.826204, -0.828883, -0.831592, -0.834332, -0.837101,
-    -0.839897, -0.842719, -0.845566, -0.848435, -0.851326, -0.854237,
-    -0.857167, -0.860113, -0.863074, -0.86605, -0.869037, -0.872034,
-    -0.87504, -0.878053, -0.881072, -0.884093, -0.887116, -0.89014,
-    -0.893161, -0.896179, -0.89919, -0.902195, -0.90519, -0.908174,
-    -0.911145, -0.914102, -0.917041, -0.919961, -0.922861, -0.925738,
-    -0.92859, -0.931416, -0.934213, -0.936979, -0.939714, -0.942413,
-    -0.945076, -0.9477, -0.950284, -0.952826, -0.955323, -0.957773,
-    -0.960175, -0.962526, -0.964825, -0.967069, -0.969257, -0.971387,
-    -0.973455, -0.975462, -0.977404, -0.979279, -0.981087, -0.982824,
-    -0.984489, -0.98608, -0.987594, -0.989031, -0.990389, -0.991664,
-    -0.992856, -0.993963, -0.994982, -0.995913, -0.996753, -0.997501,
-    -0.998154, -0.998711, -0.999171, -0.999531, -0.999791, -0.999947,
-    -1, -0.999947, -0.999786, -0.999517, -0.999137, -0.998646,
-    -0.998041, -0.997322, -0.996486, -0.995533, -0.994461, -0.99327,
-    -0.991957, -0.990521, -0.988962, -0.987278, -0.985467, -0.98353,
-    -0.981465, -0.979271, -0.976946, -0.97449, -0.971903, -0.969182,
-    -0.966328, -0.96334, -0.960216, -0.956957, -0.953561, -0.950028,
-    -0.946357, -0.942548, -0.9386, -0.934512, -0.930286, -0.925919,
-    -0.921412, -0.916764, -0.911975, -0.907045, -0.901974, -0.896762,
-    -0.891408, -0.885913, -0.880277, -0.874499, -0.86858, -0.86252,
-    -0.85632, -0.849978, -0.843497, -0.836875, -0.830114, -0.823214,
-    -0.816176, -0.808999, -0.801685, -0.794233, -0.786646, -0.778923,
-    -0.771065, -0.763073, -0.754948, -0.746691, -0.738303, -0.729784,
-    -0.721135, -0.712359, -0.703455, -0.694425, -0.68527, -0.675991,
-    -0.66659, -0.657068, -0.647426, -0.637666, -0.627789, -0.617797,
-    -0.60769, -0.597471, -0.587141, -0.576702, -0.566156, -0.555504,
-    -0.544747, -0.533888, -0.522929, -0.511871, -0.500716, -0.489466,
-    -0.478123, -0.466689, -0.455166, -0.443556, -0.431862, -0.420084,
-    -0.408225, -0.396288, -0.384275, -0.372187, -0.360027, -0.347798,
-    -0.335501, -0.323139, -0.310714, -0.298228, -0.285685, -0.273085,
-    -0.260432, -0.247729, -0.234976, -0.222178, -0.209336, -0.196453,
-    -0.183531, -0.170574, -0.157582, -0.14456, -0.131509, -0.118432,
-    -0.105332, -0.092211, -0.0790719, -0.0659171, -0.0527493, -0.0395711,
-    -0.0263851, -0.0131938
-};
-
-static const float WAVE_SQUARE_114[DEFAULT_WAVELEN] = {
-    2.22045e-16, 0.00650808, 0.0130159, 0.019523, 0.0260293, 0.0325343,
-    0.0390378, 0.0455394, 0.0520389, 0.058536, 0.0650303, 0.0715215,
-    0.0780094, 0.0844936, 0.0909738, 0.0974498, 0.103921, 0.110388,
-    0.116849, 0.123305, 0.129755, 0.136199, 0.142636, 0.149067,
-    0.155491, 0.161908, 0.168316, 0.174718, 0.18111, 0.187495,
-    0.19387, 0.200237, 0.206594, 0.212941, 0.219279, 0.225606,
-    0.231923, 0.238229, 0.244523, 0.250807, 0.257078, 0.263338,
-    0.269585, 0.27582, 0.282042, 0.28825, 0.294446, 0.300627,
-    0.306795, 0.312948, 0.319087, 0.325211, 0.33132, 0.337413,
-    0.343491, 0.349553, 0.355598, 0.361627, 0.36764, 0.373635,
-    0.379614, 0.385574, 0.391517, 0.397442, 0.403348, 0.409236,
-    0.415105, 0.420955, 0.426786, 0.432597, 0.438388, 0.444159,
-    0.449909, 0.455639, 0.461348, 0.467036, 0.472703, 0.478348,
-    0.483971, 0.489572, 0.495151, 0.500708, 0.506241, 0.511752,
-    0.517239, 0.522703, 0.528143, 0.533559, 0.538952, 0.544319,
-    0.549663, 0.554981, 0.560274, 0.565543, 0.570785, 0.576003,
-    0.581194, 0.586359, 0.591498, 0.596611, 0.601697, 0.606756,
-    0.611788, 0.616792, 0.62177, 0.626719, 0.631641, 0.636535,
-    0.641401, 0.646238, 0.651047, 0.655827, 0.660579, 0.665301,
-    0.669994, 0.674657, 0.679291, 0.683896, 0.68847, 0.693015,
-    0.697529, 0.702013, 0.706466, 0.710889, 0.715281, 0.719642,
-    0.723972, 0.72827, 0.732538, 0.736774, 0.740978, 0.74515,
-    0.749291, 0.7534, 0.757476, 0.76152, 0.765532, 0.769512,
-    0.773458, 0.777372, 0.781254, 0.785102, 0.788917, 0.7927,
-    0.796448, 0.800164, 0.803846, 0.807495, 0.81111, 0.814692,
-    0.818239, 0.821753, 0.825233, 0.828679, 0.832091, 0.835469,
-    0.838812, 0.842121, 0.845396, 0.848637, 0.851843, 0.855014,
-    0.858151, 0.861253, 0.864321, 0.867354, 0.870352, 0.873316,
-    0.876244, 0.879138, 0.881997, 0.884821, 0.88761, 0.890364,
-    0.893083, 0.895767, 0.898416, 0.90103, 0.903609, 0.906152,
-    0.908661, 0.911135, 0.913573, 0.915977, 0.918345, 0.920679,
-    0.922977, 0.92524, 0.927468, 0.929661, 0.93182, 0.933943,
-    0.936031, 0.938085, 0.940103, 0.942087, 0.944035, 0.945949,
-    0.947829, 0.949673, 0.951483, 0.953258, 0.954999, 0.956705,
-    0.958377, 0.960014, 0.961617, 0.963186, 0.964721, 0.966221,
-    0.967687, 0.96912, 0.970518, 0.971882, 0.973213, 0.97451,
-    0.975774, 0.977004, 0.9782, 0.979363, 0.980493, 0.98159,
-    0.982653, 0.983684, 0.984682, 0.985647, 0.98658, 0.987479,
-    0.988347, 0.989182, 0.989985, 0.990756, 0.991495, 0.992202,
-    0.992878, 0.993522, 0.994134, 0.994716, 0.995266, 0.995785,
-    0.996273, 0.99673, 0.997157, 0.997553, 0.997919, 0.998254,
-    0.99856, 0.998836, 0.999082, 0.999298, 0.999486, 0.999643,
-    0.999772, 0.999872, 0.999943, 0.999986, 1, 0.999986,
-    0.999944, 0.999874, 0.999776, 0.999651, 0.999498, 0.999318,
-    0.999112, 0.998878, 0.998618, 0.998331, 0.998018, 0.99768,
-    0.997315, 0.996925, 0.996509, 0.996068, 0.995602, 0.995111,
-    0.994596, 0.994056, 0.993492, 0.992903, 0.992291, 0.991656,
-    0.990997, 0.990315, 0.98961, 0.988882, 0.988132, 0.98736,
-    0.986565, 0.985749, 0.984911, 0.984052, 0.983171, 0.98227,
-    0.981348, 0.980405, 0.979442, 0.978459, 0.977457, 0.976434,
-    0.975393, 0.974332, 0.973253, 0.972155, 0.971039, 0.969904,
-    0.968752, 0.967582, 0.966395, 0.96519, 0.963969, 0.962731,
-    0.961477, 0.960206, 0.95892, 0.957618, 0.9563, 0.954968,
-    0.95362, 0.952258, 0.950882, 0.949491, 0.948086, 0.946668,
-    0.945236, 0.943792, 0.942334, 0.940864, 0.939381, 0.937887,
-    0.93638, 0.934862, 0.933332, 0.931792, 0.930241, 0.928679,
-    0.927107, 0.925524, 0.923932, 0.922331, 0.92072, 0.919101,
-    0.917472, 0.915835, 0.91419, 0.912537, 0.910876, 0.909208,
-    0.907533, 0.90585, 0.904161, 0.902466, 0.900764, 0.899057,
-    0.897344, 0.895626, 0.893903, 0.892174, 0.890442, 0.888704,
-    0.886963, 0.885218, 0.88347, 0.881718, 0.879963, 0.878206,
-    0.876446, 0.874683, 0.872919, 0.871153, 0.869385, 0.867616,
-    0.865847, 0.864076, 0.862305, 0.860534, 0.858763, 0.856992,
-    0.855221, 0.853452, 0.851683, 0.849915, 0.84815, 0.846385,
-    0.844623, 0.842863, 0.841106, 0.839351, 0.837599, 0.835851,
-    0.834106, 0.832364, 0.830627, 0.828893, 0.827164, 0.82544,
-    0.82372, 0.822006, 0.820297, 0.818593, 0.816896, 0.815204,
-    0.813518, 0.811839, 0.810167, 0.808501, 0.806842, 0.805191,
-    0.803548, 0.801912, 0.800284, 0.798664, 0.797053, 0.795451,
-    0.793857, 0.792272, 0.790697, 0.789131, 0.787574, 0.786028,
-    0.784491, 0.782965, 0.781449, 0.779944, 0.778449, 0.776966,
-    0.775494, 0.774033, 0.772584, 0.771147, 0.769722, 0.768309,
-    0.766908, 0.765519, 0.764144, 0.762781, 0.761431, 0.760095,
-    0.758771, 0.757462, 0.756166, 0.754884, 0.753616, 0.752362,
-    0.751122, 0.749897, 0.748687, 0.747492, 0.746311, 0.745146,
-    0.743995, 0.742861, 0.741741, 0.740638, 0.73955, 0.738478,
-    0.737423, 0.736383, 0.73536, 0.734353, 0.733363, 0.73239,
-    0.731434, 0.730494, 0.729572, 0.728666, 0.727779, 0.726908,
-    0.726055, 0.72522, 0.724402, 0.723603, 0.722821, 0.722057,
-    0.721311, 0.720584, 0.719875, 0.719184, 0.718512, 0.717858,
-    0.717223, 0.716607, 0.71601, 0.715431, 0.714871, 0.714331,
-    0.713809, 0.713307, 0.712823, 0.71236, 0.711915, 0.71149,
-    0.711084, 0.710698, 0.710331, 0.709983, 0.709656, 0.709348,
-    0.70906, 0.708791, 0.708542, 0.708313, 0.708104, 0.707915,
-    0.707745, 0.707596, 0.707466, 0.707356, 0.707266, 0.707197,
-    0.707147, 0.707117, 0.707107, 0.707117, 0.707147, 0.707197,
-    0.707266, 0.707356, 0.707466, 0.707596, 0.707745, 0.707915,
-    0.708104, 0.708313, 0.708542, 0.708791, 0.70906, 0.709348,
-    0.709656, 0.709983, 0.710331, 0.710698, 0.711084, 0.71149,
-    0.711915, 0.71236, 0.712823, 0.713307, 0.713809, 0.714331,
-    0.714871, 0.715431, 0.71601, 0.716607, 0.717223, 0.717858,
-    0.718512, 0.719184, 0.719875, 0.720584, 0.721311, 0.722057,
-    0.722821, 0.723603, 0.724402, 0.72522, 0.726055, 0.726908,
-    0.727779, 0.728666, 0.729572, 0.730494, 0.731434, 0.73239,
-    0.733363, 0.734353, 0.73536, 0.736383, 0.737423, 0.738478,
-    0.73955, 0.740638, 0.741741, 0.742861, 0.743995, 0.745146,
-    0.746311, 0.747492, 0.748687, 0.749897, 0.751122, 0.752362,
-    0.753616, 0.754884, 0.756166, 0.757462, 0.758771, 0.760095,
-    0.761431, 0.762781, 0.764144, 0.765519, 0.766908, 0.768309,
-    0.769722, 0.771147, 0.772584, 0.774033, 0.775494, 0.776966,
-    0.778449, 0.779944, 0.781449, 0.782965, 0.784491, 0.786028,
-    0.787574, 0.789131, 0.790697, 0.792272, 0.793857, 0.795451,
-    0.797053, 0.798664, 0.800284, 0.801912, 0.803548, 0.805191,
-    0.806842, 0.808501, 0.810167, 0.811839, 0.813518, 0.815204,
-    0.816896, 0.818593, 0.820297, 0.822006, 0.82372, 0.82544,
-    0.827164, 0.828893, 0.830627, 0.832364, 0.834106, 0.835851,
-    0.837599, 0.839351, 0.841106, 0.842863, 0.844623, 0.846385,
-    0.84815, 0.849915, 0.851683, 0.853452, 0.855221, 0.856992,
-    0.858763, 0.860534, 0.862305, 0.864076, 0.865847, 0.867616,
-    0.869385, 0.871153, 0.872919, 0.874683, 0.876446, 0.878206,
-    0.879963, 0.881718, 0.88347, 0.885218, 0.886963, 0.888704,
-    0.890442, 0.892174, 0.893903, 0.895626, 0.897344, 0.899057,
-    0.900764, 0.902466, 0.904161, 0.90585, 0.907533, 0.909208,
-    0.910876, 0.912537, 0.91419, 0.915835, 0.917472, 0.919101,
-    0.92072, 0.922331, 0.923932, 0.925524, 0.927107, 0.928679,
-    0.930241, 0.931792, 0.933332, 0.934862, 0.93638, 0.937887,
-    0.939381, 0.940864, 0.942334, 0.943792, 0.945236, 0.946668,
-    0.948086, 0.949491, 0.950882, 0.952258, 0.95362, 0.954968,
-    0.9563, 0.957618, 0.95892, 0.960206, 0.961477, 0.962731,
-    0.963969, 0.96519, 0.966395, 0.967582, 0.968752, 0.969904,
-    0.971039, 0.972155, 0.973253, 0.974332, 0.975393, 0.976434,
-    0.977457, 0.978459, 0.979442, 0.980405, 0.981348, 0.98227,
-    0.983171, 0.984052, 0.984911, 0.985749, 0.986565, 0.98736,
-    0.988132, 0.988882, 0.98961, 0.990315, 0.990997, 0.991656,
-    0.992291, 0.992903, 0.993492, 0.994056, 0.994596, 0.995111,
-    0.995602, 0.996068, 0.996509, 0.996925, 0.997315, 0.99768,
-    0.998018, 0.998331, 0.998618, 0.998878, 0.999112, 0.999318,
-    0.999498, 0.999651, 0.999776, 0.999874, 0.999944, 0.999986,
-    1, 0.999986, 0.999943, 0.999872, 0.999772, 0.999643,
-    0.999486, 0.999298, 0.999082, 0.998836, 0.99856, 0.998254,
-    0.997919, 0.997553, 0.997157, 0.99673, 0.996273, 0.995785,
-    0.995266, 0.994716, 0.994134, 0.993522, 0.992878, 0.992202,
-    0.991495, 0.990756, 0.989985, 0.989182, 0.988347, 0.987479,
-    0.98658, 0.985647, 0.984682, 0.983684, 0.982653, 0.98159,
-    0.980493, 0.979363, 0.9782, 0.977004, 0.975774, 0.97451,
-    0.973213, 0.971882, 0.970518, 0.96912, 0.967687, 0.966221,
-    0.964721, 0.963186, 0.961617, 0.960014, 0.958377, 0.956705,
-    0.954999, 0.953258, 0.951483, 0.949673, 0.947829, 0.945949,
-    0.944035, 0.942087, 0.940103, 0.938085, 0.936031, 0.933943,
-    0.93182, 0.929661, 0.927468, 0.92524, 0.922977, 0.920679,
-    0.918345, 0.915977, 0.913573, 0.911135, 0.908661, 0.906152,
-    0.903609, 0.90103, 0.898416, 0.895767, 0.893083, 0.890364,
-    0.88761, 0.884821, 0.881997, 0.879138, 0.876244, 0.873316,
-    0.870352, 0.867354, 0.864321, 0.861253, 0.858151, 0.855014,
-    0.851843, 0.848637, 0.845396, 0.842121, 0.838812, 0.835469,
-    0.832091, 0.828679, 0.825233, 0.821753, 0.818239, 0.814692,
-    0.81111, 0.807495, 0.803846, 0.800164, 0.796448, 0.7927,
-    0.788917, 0.785102, 0.781254, 0.777372, 0.773458, 0.769512,
-    0.765532, 0.76152, 0.757476, 0.7534, 0.749291, 0.74515,
-    0.740978, 0.736774, 0.732538, 0.72827, 0.723972, 0.719642,
-    0.715281, 0.710889, 0.706466, 0.702013, 0.697529, 0.693015,
-    0.68847, 0.683896, 0.679291, 0.674657, 0.669994, 0.665301,
-    0.660579, 0.655827, 0.651047, 0.646238, 0.641401, 0.636535,
-    0.631641, 0.626719, 0.62177, 0.616792, 0.611788, 0.606756,
-    0.601697, 0.596611, 0.591498, 0.586359, 0.581194, 0.576003,
-    0.570785, 0.565543, 0.560274, 0.554981, 0.549663, 0.544319,
-    0.538952, 0.533559, 0.528143, 0.522703, 0.517239, 0.511752,
-    0.506241, 0.500708, 0.495151, 0.489572, 0.483971, 0.478348,
-    0.472703, 0.467036, 0.461348, 0.455639, 0.449909, 0.444159,
-    0.438388, 0.432597, 0.426786, 0.420955, 0.415105, 0.409236,
-    0.403348, 0.397442, 0.391517, 0.385574, 0.379614, 0.373635,
-    0.36764, 0.361627, 0.355598, 0.349553, 0.343491, 0.337413,
-    0.33132, 0.325211, 0.319087, 0.312948, 0.306795, 0.300627,
-    0.294446, 0.28825, 0.282042, 0.27582, 0.269585, 0.263338,
-    0.257078, 0.250807, 0.244523, 0.238229, 0.231923, 0.225606,
-    0.219279, 0.212941, 0.206594, 0.200237, 0.19387, 0.187495,
-    0.18111, 0.174718, 0.168316, 0.161908, 0.155491, 0.149067,
-    0.142636, 0.136199, 0.129755, 0.123305, 0.116849, 0.110388,
-    0.103921, 0.0974498, 0.0909738, 0.0844936, 0.0780094, 0.0715215,
-    0.0650303, 0.058536, 0.0520389, 0.0455394, 0.0390378, 0.0325343,
-    0.0260293, 0.019523, 0.0130159, 0.00650808, 4.44089e-16, -0.00650808,
-    -0.0130159, -0.019523, -0.0260293, -0.0325343, -0.0390378, -0.0455394,
-    -0.0520389, -0.058536, -0.0650303, -0.0715215, -0.0780094, -0.0844936,
-    -0.0909738, -0.0974498, -0.103921, -0.110388, -0.116849, -0.123305,
-    -0.129755, -0.136199, -0.142636, -0.149067, -0.155491, -0.161908,
-    -0.168316, -0.174718, -0.18111, -0.187495, -0.19387, -0.200237,
-    -0.206594, -0.212941, -0.219279, -0.225606, -0.231923, -0.238229,
-    -0.244523, -0.250807, -0.257078, -0.263338, -0.269585, -0.27582,
-    -0.282042, -0.28825, -0.294446, -0.300627, -0.306795, -0.312948,
-    -0.319087, -0.325211, -0.33132, -0.337413, -0.343491, -0.349553,
-    -0.355598, -0.361627, -0.36764, -0.373635, -0.379614, -0.385574,
-    -0.391517, -0.397442, -0.403348, -0.409236, -0.415105, -0.420955,
-    -0.426786, -0.432597, -0.438388, -0.444159, -0.449909, -0.455639,
-    -0.461348, -0.467036, -0.472703, -0.478348, -0.483971, -0.489572,
-    -0.495151, -0.500708, -0.506241, -0.511752, -0.517239, -0.522703,
-    -0.528143, -0.533559, -0.538952, -0.544319, -0.549663, -0.554981,
-    -0.560274, -0.565543, -0.570785, -0.576003, -0.581194, -0.586359,
-    -0.591498, -0.596611, -0.601697, -0.606756, -0.611788, -0.616792,
-    -0.62177, -0.626719, -0.631641, -0.636535, -0.641401, -0.646238,
-    -0.651047, -0.655827, -0.660579, -0.665301, -0.669994, -0.674657,
-    -0.679291, -0.683896, -0.68847, -0.693015, -0.697529, -0.702013,
-    -0.706466, -0.710889, -0.715281, -0.719642, -0.723972, -0.72827,
-    -0.732538, -0.736774, -0.740978, -0.74515, -0.749291, -0.7534,
-    -0.757476, -0.76152, -0.765532, -0.769512, -0.773458, -0.777372,
-    -0.781254, -0.785102, -0.788917, -0.7927, -0.796448, -0.800164,
-    -0.803846, -0.807495, -0.81111, -0.814692, -0.818239, -0.821753,
-    -0.825233, -0.828679, -0.832091, -0.835469, -0.838812, -0.842121,
-    -0.845396, -0.848637, -0.851843, -0.855014, -0.858151, -0.861253,
-    -0.864321, -0.867354, -0.870352, -0.873316, -0.876244, -0.879138,
-    -0.881997, -0.884821, -0.88761, -0.890364, -0.893083, -0.895767,
-    -0.898416, -0.90103, -0.903609, -0.906152, -0.908661, -0.911135,
-    -0.913573, -0.915977, -0.918345, -0.920679, -0.922977, -0.92524,
-    -0.927468, -0.929661, -0.93182, -0.933943, -0.936031, -0.938085,
-    -0.940103, -0.942087, -0.944035, -0.945949, -0.947829, -0.949673,
-    -0.951483, -0.953258, -0.954999, -0.956705, -0.958377, -0.960014,
-    -0.961617, -0.963186, -0.964721, -0.966221, -0.967687, -0.96912,
-    -0.970518, -0.971882, -0.973213, -0.97451, -0.975774, -0.977004,
-    -0.9782, -0.979363, -0.980493, -0.98159, -0.982653, -0.983684,
-    -0.984682, -0.985647, -0.98658, -0.987479, -0.988347, -0.989182,
-    -0.989985, -0.990756, -0.991495, -0.992202, -0.992878, -0.993522,
-    -0.994134, -0.994716, -0.995266, -0.995785, -0.996273, -0.99673,
-    -0.997157, -0.997553, -0.997919, -0.998254, -0.99856, -0.998836,
-    -0.999082, -0.999298, -0.999486, -0.999643, -0.999772, -0.999872,
-    -0.999943, -0.999986, -1, -0.999986, -0.999944, -0.999874,
-    -0.999776, -0.999651, -0.999498, -0.999318, -0.999112, -0.998878,
-    -0.998618, -0.998331, -0.998018, -0.99768, -0.997315, -0.996925,
-    -0.996509, -0.996068, -0.995602, -0.995111, -0.994596, -0.994056,
-    -0.993492, -0.992903, -0.992291, -0.991656, -0.990997, -0.990315,
-    -0.98961, -0.988882, -0.988132, -0.98736, -0.986565, -0.985749,
-    -0.984911, -0.984052, -0.983171, -0.98227, -0.981348, -0.980405,
-    -0.979442, -0.978459, -0.977457, -0.976434, -0.975393, -0.974332,
-    -0.973253, -0.972155, -0.971039, -0.969904, -0.968752, -0.967582,
-    -0.966395, -0.96519, -0.963969, -0.962731, -0.961477, -0.960206,
-    -0.95892, -0.957618, -0.9563, -0.954968, -0.95362, -0.952258,
-    -0.950882, -0.949491, -0.948086, -0.946668, -0.945236, -0.943792,
-    -0.942334, -0.940864, -0.939381, -0.937887, -0.93638, -0.934862,
-    -0.933332, -0.931792, -0.930241, -0.928679, -0.927107, -0.925524,
-    -0.923932, -0.922331, -0.92072, -0.919101, -0.917472, -0.915835,
-    -0.91419, -0.912537, -0.910876, -0.909208, -0.907533, -0.90585,
-    -0.904161, -0.902466, -0.900764, -0.899057, -0.897344, -0.895626,
-    -0.893903, -0.892174, -0.890442, -0.888704, -0.886963, -0.885218,
-    -0.88347, -0.881718, -0.879963, -0.878206, -0.876446, -0.874683,
-    -0.872919, -0.871153, -0.869385, -0.867616, -0.865847, -0.864076,
-    -0.862305, -0.860534, -0.858763, -0.856992, -0.855221, -0.853452,
-    -0.851683, -0.849915, -0.84815, -0.846385, -0.844623, -0.842863,
-    -0.841106, -0.839351, -0.837599, -0.835851, -0.834106, -0.832364,
-    -0.830627, -0.828893, -0.827164, -0.82544, -0.82372, -0.822006,
-    -0.820297, -0.818593, -0.816896, -0.815204, -0.813518, -0.811839,
-    -0.810167, -0.808501, -0.806842, -0.805191, -0.803548, -0.801912,
-    -0.800284, -0.798664, -0.797053, -0.795451, -0.793857, -0.792272,
-    -0.790697, -0.789131, -0.787574, -0.786028, -0.784491, -0.782965,
-    -0.781449, -0.779944, -0.778449, -0.776966, -0.775494, -0.774033,
-    -0.772584, -0.771147, -0.769722, -0.768309, -0.766908, -0.765519,
-    -0.764144, -0.762781, -0.761431, -0.760095, -0.758771, -0.757462,
-    -0.756166, -0.754884, -0.753616, -0.752362, -0.751122, -0.749897,
-    -0.748687, -0.747492, -0.746311, -0.745146, -0.743995, -0.742861,
-    -0.741741, -0.740638, -0.73955, -0.738478, -0.737423, -0.736383,
-    -0.73536, -0.734353, -0.733363, -0.73239, -0.731434, -0.730494,
-    -0.729572, -0.728666, -0.727779, -0.726908, -0.726055, -0.72522,
-    -0.724402, -0.723603, -0.722821, -0.722057, -0.721311, -0.720584,
-    -0.719875, -0.719184, -0.718512, -0.717858, -0.717223, -0.716607,
-    -0.71601, -0.715431, -0.714871, -0.714331, -0.713809, -0.713307,
-    -0.712823, -0.71236, -0.711915, -0.71149, -0.711084, -0.710698,
-    -0.710331, -0.709983, -0.709656, -0.709348, -0.70906, -0.708791,
-    -0.708542, -0.708313, -0.708104, -0.707915, -0.707745, -0.707596,
-    -0.707466, -0.707356, -0.707266, -0.707197, -0.707147, -0.707117,
-    -0.707107, -0.707117, -0.707147, -0.707197, -0.707266, -0.707356,
-    -0.707466, -0.707596, -0.707745, -0.707915, -0.708104, -0.708313,
-    -0.708542, -0.708791, -0.70906, -0.709348, -0.709656, -0.709983,
-    -0.710331, -0.710698, -0.711084, -0.71149, -0.711915, -0.71236,
-    -0.712823, -0.713307, -0.713809, -0.714331, -0.714871, -0.715431,
-    -0.71601, -0.716607, -0.717223, -0.717858, -0.718512, -0.719184,
-    -0.719875, -0.720584, -0.721311, -0.722057, -0.722821, -0.723603,
-    -0.724402, -0.72522, -0.726055, -0.726908, -0.727779, -0.728666,
-    -0.729572, -0.730494, -0.731434, -0.73239, -0.733363, -0.734353,
-    -0.73536, -0.736383, -0.737423, -0.738478, -0.73955, -0.740638,
-    -0.741741, -0.742861, -0.743995, -0.745146, -0.746311, -0.747492,
-    -0.748687, -0.749897, -0.751122, -0.752362, -0.753616, -0.754884,
-    -0.756166, -0.757462, -0.758771, -0.760095, -0.761431, -0.762781,
-    -0.764144, -0.765519, -0.766908, -0.768309, -0.769722, -0.771147,
-    -0.772584, -0.774033, -0.775494, -0.776966, -0.778449, -0.779944,
-    -0.781449, -0.782965, -0.784491, -0.786028, -0.787574, -0.789131,
-    -0.790697, -0.792272, -0.793857, -0.795451, -0.797053, -0.798664,
-    -0.800284, -0.801912, -0.803548, -0.805191, -0.806842, -0.808501,
-    -0.810167, -0.811839, -0.813518, -0.815204, -0.816896, -0.818593,
-    -0.820297, -0.822006, -0.82372, -0.82544, -0.827164, -0.828893,
-    -0.830627, -0.832364, -0.834106, -0.835851, -0.837599, -0.839351,
-    -0.841106, -0.842863, -0.844623, -0.846385, -0.84815, -0.849915,
-    -0.851683, -0.853452, -0.855221, -0.856992, -0.858763, -0.860534,
-    -0.862305, -0.864076, -0.865847, -0.867616, -0.869385, -0.871153,
-    -0.872919, -0.874683, -0.876446, -0.878206, -0.879963, -0.881718,
-    -0.88347, -0.885218, -0.886963, -0.888704, -0.890442, -0.892174,
-    -0.893903, -0.895626, -0.897344, -0.899057, -0.900764, -0.902466,
-    -0.904161, -0.90585, -0.907533, -0.909208, -0.910876, -0.912537,
-    -0.91419, -0.915835, -0.917472, -0.919101, -0.92072, -0.922331,
-    -0.923932, -0.925524, -0.927107, -0.928679, -0.930241, -0.931792,
-    -0.933332, -0.934862, -0.93638, -0.937887, -0.939381, -0.940864,
-    -0.942334, -0.943792, -0.945236, -0.946668, -0.948086, -0.949491,
-    -0.950882, -0.952258, -0.95362, -0.954968, -0.9563, -0.957618,
-    -0.95892, -0.960206, -0.961477, -0.962731, -0.963969, -0.96519,
-    -0.966395, -0.967582, -0.968752, -0.969904, -0.971039, -0.972155,
-    -0.973253, -0.974332, -0.975393, -0.976434, -0.977457, -0.978459,
-    -0.979442, -0.980405, -0.981348, -0.98227, -0.983171, -0.984052,
-    -0.984911, -0.985749, -0.986565, -0.98736, -0.988132, -0.988882,
-    -0.98961, -0.990315, -0.990997, -0.991656, -0.992291, -0.992903,
-    -0.993492, -0.994056, -0.994596, -0.995111, -0.995602, -0.996068,
-    -0.996509, -0.996925, -0.997315, -0.99768, -0.998018, -0.998331,
-    -0.998618, -0.998878, -0.999112, -0.999318, -0.999498, -0.999651,
-    -0.999776, -0.999874, -0.999944, -0.999986, -1, -0.999986,
-    -0.999943, -0.999872, -0.999772, -0.999643, -0.999486, -0.999298,
-    -0.999082, -0.998836, -0.99856, -0.998254, -0.997919, -0.997553,
-    -0.997157, -0.99673, -0.996273, -0.995785, -0.995266, -0.994716,
-    -0.994134, -0.993522, -0.992878, -0.992202, -0.991495, -0.990756,
-    -0.989985, -0.989182, -0.988347, -0.987479, -0.98658, -0.985647,
-    -0.984682, -0.983684, -0.982653, -0.98159, -0.980493, -0.979363,
-    -0.9782, -0.977004, -0.975774, -0.97451, -0.973213, -0.971882,
-    -0.970518, -0.96912, -0.967687, -0.966221, -0.964721, -0.963186,
-    -0.961617, -0.960014, -0.958377, -0.956705, -0.954999, -0.953258,
-    -0.951483, -0.949673, -0.947829, -0.945949, -0.944035, -0.942087,
-    -0.940103, -0.938085, -0.936031, -0.933943, -0.93182, -0.929661,
-    -0.927468, -0.92524, -0.922977, -0.920679, -0.918345, -0.915977,
-    -0.913573, -0.911135, -0.908661, -0.906152, -0.903609, -0.90103,
-    -0.898416, -0.895767, -0.893083, -0.890364, -0.88761, -0.884821,
-    -0.881997, -0.879138, -0.876244, -0.873316, -0.870352, -0.867354,
-    -0.864321, -0.861253, -0.858151, -0.855014, -0.851843, -0.848637,
-    -0.845396, -0.842121, -0.838812, -0.835469, -0.832091, -0.828679,
-    -0.825233, -0.821753, -0.818239, -0.814692, -0.81111, -0.807495,
-    -0.803846, -0.800164, -0.796448, -0.7927, -0.788917, -0.785102,
-    -0.781254, -0.777372, -0.773458, -0.769512, -0.765532, -0.76152,
-    -0.757476, -0.7534, -0.749291, -0.74515, -0.740978, -0.736774,
-    -0.732538, -0.72827, -0.723972, -0.719642, -0.715281, -0.710889,
-    -0.706466, -0.702013, -0.697529, -0.693015, -0.68847, -0.683896,
-    -0.679291, -0.674657, -0.669994, -0.665301, -0.660579, -0.655827,
-    -0.651047, -0.646238, -0.641401, -0.636535, -0.631641, -0.626719,
-    -0.62177, -0.616792, -0.611788, -0.606756, -0.601697, -0.596611,
-    -0.591498, -0.586359, -0.581194, -0.576003, -0.570785, -0.565543,
-    -0.560274, -0.554981, -0.549663, -0.544319, -0.538952, -0.533559,
-    -0.528143, -0.522703, -0.517239, -0.511752, -0.506241, -0.500708,
-    -0.495151, -0.489572, -0.483971, -0.478348, -0.472703, -0.467036,
-    -0.461348, -0.455639, -0.449909, -0.444159, -0.438388, -0.432597,
-    -0.426786, -0.420955, -0.415105, -0.409236, -0.403348, -0.397442,
-    -0.391517, -0.385574, -0.379614, -0.373635, -0.36764, -0.361627,
-    -0.355598, -0.349553, -0.343491, -0.337413, -0.33132, -0.325211,
-    -0.319087, -0.312948, -0.306795, -0.300627, -0.294446, -0.28825,
-    -0.282042, -0.27582, -0.269585, -0.263338, -0.257078, -0.250807,
-    -0.244523, -0.238229, -0.231923, -0.225606, -0.219279, -0.212941,
-    -0.206594, -0.200237, -0.19387, -0.187495, -0.18111, -0.174718,
-    -0.168316, -0.161908, -0.155491, -0.149067, -0.142636, -0.136199,
-    -0.129755, -0.123305, -0.116849, -0.110388, -0.103921, -0.0974498,
-    -0.0909738, -0.0844936, -0.0780094, -0.0715215, -0.0650303, -0.058536,
-    -0.0520389, -0.0455394, -0.0390378, -0.0325343, -0.0260293, -0.019523,
-    -0.0130159, -0.00650808
-};
-
-static const float WAVE_SQUARE_126[DEFAULT_WAVELEN] = {
-    0, 0.00306796, 0.00613588, 0.00920375, 0.0122715, 0.0153392,
-    0.0184067, 0.0214741, 0.0245412, 0.0276081, 0.0306748, 0.0337412,
-    0.0368072, 0.0398729, 0.0429383, 0.0460032, 0.0490677, 0.0521317,
-    0.0551952, 0.0582583, 0.0613207, 0.0643826, 0.0674439, 0.0705046,
-    0.0735646, 0.0766239, 0.0796824, 0.0827403, 0.0857973, 0.0888536,
-    0.091909, 0.0949635, 0.0980171, 0.10107, 0.104122, 0.107172,
-    0.110222, 0.113271, 0.116319, 0.119365, 0.122411, 0.125455,
-    0.128498, 0.13154, 0.134581, 0.13762, 0.140658, 0.143695,
-    0.14673, 0.149765, 0.152797, 0.155828, 0.158858, 0.161886,
-    0.164913, 0.167938, 0.170962, 0.173984, 0.177004, 0.180023,
-    0.18304, 0.186055, 0.189069, 0.19208, 0.19509, 0.198098,
-    0.201105, 0.204109, 0.207111, 0.210112, 0.21311, 0.216107,
-    0.219101, 0.222094, 0.225084, 0.228072, 0.231058, 0.234042,
-    0.237024, 0.240003, 0.24298, 0.245955, 0.248928, 0.251898,
-    0.254866, 0.257831, 0.260794, 0.263755, 0.266713, 0.269668,
-    0.272621, 0.275572, 0.27852, 0.281465, 0.284408, 0.287347,
-    0.290285, 0.293219, 0.296151, 0.29908, 0.302006, 0.304929,
-    0.30785, 0.310767, 0.313682, 0.316593, 0.319502, 0.322408,
-    0.32531, 0.32821, 0.331106, 0.334, 0.33689, 0.339777,
-    0.342661, 0.345541, 0.348419, 0.351293, 0.354164, 0.357031,
-    0.359895, 0.362756, 0.365613, 0.368467, 0.371317, 0.374164,
-    0.377007, 0.379847, 0.382683, 0.385516, 0.388345, 0.39117,
-    0.393992, 0.39681, 0.399624, 0.402435, 0.405241, 0.408044,
-    0.410843, 0.413638, 0.41643, 0.419217, 0.422, 0.42478,
-    0.427555, 0.430326, 0.433094, 0.435857, 0.438616, 0.441371,
-    0.444122, 0.446869, 0.449611, 0.45235, 0.455084, 0.457813,
-    0.460539, 0.46326, 0.465976, 0.468689, 0.471397, 0.4741,
-    0.476799, 0.479494, 0.482184, 0.484869, 0.48755, 0.490226,
-    0.492898, 0.495565, 0.498228, 0.500885, 0.503538, 0.506187,
-    0.50883, 0.511469, 0.514103, 0.516732, 0.519356, 0.521975,
-    0.52459, 0.527199, 0.529804, 0.532403, 0.534998, 0.537587,
-    0.540171, 0.542751, 0.545325, 0.547894, 0.550458, 0.553017,
-    0.55557, 0.558119, 0.560662, 0.563199, 0.565732, 0.568259,
-    0.570781, 0.573297, 0.575808, 0.578314, 0.580814, 0.583309,
-    0.585798, 0.588282, 0.59076, 0.593232, 0.595699, 0.598161,
-    0.600616, 0.603067, 0.605511, 0.60795, 0.610383, 0.61281,
-    0.615232, 0.617647, 0.620057, 0.622461, 0.624859, 0.627252,
-    0.629638, 0.632019, 0.634393, 0.636762, 0.639124, 0.641481,
-    0.643832, 0.646176, 0.648514, 0.650847, 0.653173, 0.655493,
-    0.657807, 0.660114, 0.662416, 0.664711, 0.667, 0.669283,
-    0.671559, 0.673829, 0.676093, 0.67835, 0.680601, 0.682846,
-    0.685084, 0.687315, 0.689541, 0.691759, 0.693971, 0.696177,
-    0.698376, 0.700569, 0.702755, 0.704934, 0.707107, 0.709273,
-    0.711432, 0.713585, 0.715731, 0.71787, 0.720003, 0.722128,
-    0.724247, 0.726359, 0.728464, 0.730563, 0.732654, 0.734739,
-    0.736817, 0.738887, 0.740951, 0.743008, 0.745058, 0.747101,
-    0.749136, 0.751165, 0.753187, 0.755201, 0.757209, 0.759209,
-    0.761202, 0.763188, 0.765167, 0.767139, 0.769103, 0.771061,
-    0.77301, 0.774953, 0.776888, 0.778817, 0.780737, 0.782651,
-    0.784557, 0.786455, 0.788346, 0.79023, 0.792107, 0.793975,
-    0.795837, 0.797691, 0.799537, 0.801376, 0.803208, 0.805031,
-    0.806848, 0.808656, 0.810457, 0.812251, 0.814036, 0.815814,
-    0.817585, 0.819348, 0.821103, 0.82285, 0.824589, 0.826321,
-    0.828045, 0.829761, 0.83147, 0.83317, 0.834863, 0.836548,
-    0.838225, 0.839894, 0.841555, 0.843208, 0.844854, 0.846491,
-    0.84812, 0.849742, 0.851355, 0.852961, 0.854558, 0.856147,
-    0.857729, 0.859302, 0.860867, 0.862424, 0.863973, 0.865514,
-    0.867046, 0.868571, 0.870087, 0.871595, 0.873095, 0.874587,
-    0.87607, 0.877545, 0.879012, 0.880471, 0.881921, 0.883363,
-    0.884797, 0.886223, 0.88764, 0.889048, 0.890449, 0.891841,
-    0.893224, 0.894599, 0.895966, 0.897325, 0.898674, 0.900016,
-    0.901349, 0.902673, 0.903989, 0.905297, 0.906596, 0.907886,
-    0.909168, 0.910441, 0.911706, 0.912962, 0.91421, 0.915449,
-    0.916679, 0.917901, 0.919114, 0.920318, 0.921514, 0.922701,
-    0.92388, 0.925049, 0.92621, 0.927363, 0.928506, 0.929641,
-    0.930767, 0.931884, 0.932993, 0.934093, 0.935184, 0.936266,
-    0.937339, 0.938404, 0.939459, 0.940506, 0.941544, 0.942573,
-    0.943593, 0.944605, 0.945607, 0.946601, 0.947586, 0.948561,
-    0.949528, 0.950486, 0.951435, 0.952375, 0.953306, 0.954228,
-    0.955141, 0.956045, 0.95694, 0.957826, 0.958703, 0.959572,
-    0.960431, 0.96128, 0.962121, 0.962953, 0.963776, 0.96459,
-    0.965394, 0.96619, 0.966976, 0.967754, 0.968522, 0.969281,
-    0.970031, 0.970772, 0.971504, 0.972226, 0.97294, 0.973644,
-    0.974339, 0.975025, 0.975702, 0.97637, 0.977028, 0.977677,
-    0.978317, 0.978948, 0.97957, 0.980182, 0.980785, 0.981379,
-    0.981964, 0.982539, 0.983105, 0.983662, 0.98421, 0.984749,
-    0.985278, 0.985798, 0.986308, 0.986809, 0.987301, 0.987784,
-    0.988258, 0.988722, 0.989177, 0.989622, 0.990058, 0.990485,
-    0.990903, 0.991311, 0.99171, 0.992099, 0.99248, 0.99285,
-    0.993212, 0.993564, 0.993907, 0.99424, 0.994565, 0.994879,
-    0.995185, 0.995481, 0.995767, 0.996045, 0.996313, 0.996571,
-    0.99682, 0.99706, 0.99729, 0.997511, 0.997723, 0.997925,
-    0.998118, 0.998302, 0.998476, 0.99864, 0.998795, 0.998941,
-    0.999078, 0.999205, 0.999322, 0.999431, 0.999529, 0.999619,
-    0.999699, 0.999769, 0.999831, 0.999882, 0.999925, 0.999958,
-    0.999981, 0.999995, 1, 0.999995, 0.999981, 0.999958,
-    0.999925, 0.999882, 0.999831, 0.999769, 0.999699, 0.999619,
-    0.999529, 0.999431, 0.999322, 0.999205, 0.999078, 0.998941,
-    0.998795, 0.99864, 0.998476, 0.998302, 0.998118, 0.997925,
-    0.997723, 0.997511, 0.99729, 0.99706, 0.99682, 0.996571,
-    0.996313, 0.996045, 0.995767, 0.995481, 0.995185, 0.994879,
-    0.994565, 0.99424, 0.993907, 0.993564, 0.993212, 0.99285,
-    0.99248, 0.992099, 0.99171, 0.991311, 0.990903, 0.990485,
-    0.990058, 0.989622, 0.989177, 0.988722, 0.988258, 0.987784,
-    0.987301, 0.986809, 0.986308, 0.985798, 0.985278, 0.984749,
-    0.98421, 0.983662, 0.983105, 0.982539, 0.981964, 0.981379,
-    0.980785, 0.980182, 0.97957, 0.978948, 0.978317, 0.977677,
-    0.977028, 0.97637, 0.975702, 0.975025, 0.974339, 0.973644,
-    0.97294, 0.972226, 0.971504, 0.970772, 0.970031, 0.969281,
-    0.968522, 0.967754, 0.966976, 0.96619, 0.965394, 0.96459,
-    0.963776, 0.962953, 0.962121, 0.96128, 0.960431, 0.959572,
-    0.958703, 0.957826, 0.95694, 0.956045, 0.955141, 0.954228,
-    0.953306, 0.952375, 0.951435, 0.950486, 0.949528, 0.948561,
-    0.947586, 0.946601, 0.945607, 0.944605, 0.943593, 0.942573,
-    0.941544, 0.940506, 0.939459, 0.938404, 0.937339, 0.936266,
-    0.935184, 0.934093, 0.932993, 0.931884, 0.930767, 0.929641,
-    0.928506, 0.927363, 0.92621, 0.925049, 0.92388, 0.922701,
-    0.921514, 0.920318, 0.919114, 0.917901, 0.916679, 0.915449,
-    0.91421, 0.912962, 0.911706, 0.910441, 0.909168, 0.907886,
-    0.906596, 0.905297, 0.903989, 0.902673, 0.901349, 0.900016,
-    0.898674, 0.897325, 0.895966, 0.894599, 0.893224, 0.891841,
-    0.890449, 0.889048, 0.88764, 0.886223, 0.884797, 0.883363,
-    0.881921, 0.880471, 0.879012, 0.877545, 0.87607, 0.874587,
-    0.873095, 0.871595, 0.870087, 0.868571, 0.867046, 0.865514,
-    0.863973, 0.862424, 0.860867, 0.859302, 0.857729, 0.856147,
-    0.854558, 0.852961, 0.851355, 0.849742, 0.84812, 0.846491,
-    0.844854, 0.843208, 0.841555, 0.839894, 0.838225, 0.836548,
-    0.834863, 0.83317, 0.83147, 0.829761, 0.828045, 0.826321,
-    0.824589, 0.82285, 0.821103, 0.819348, 0.817585, 0.815814,
-    0.814036, 0.812251, 0.810457, 0.808656, 0.806848, 0.805031,
-    0.803208, 0.801376, 0.799537, 0.797691, 0.795837, 0.793975,
-    0.792107, 0.79023, 0.788346, 0.786455, 0.784557, 0.782651,
-    0.780737, 0.778817, 0.776888, 0.774953, 0.77301, 0.771061,
-    0.769103, 0.767139, 0.765167, 0.763188, 0.761202, 0.759209,
-    0.757209, 0.755201, 0.753187, 0.751165, 0.749136, 0.747101,
-    0.745058, 0.743008, 0.740951, 0.738887, 0.736817, 0.734739,
-    0.732654, 0.730563, 0.728464, 0.726359, 0.724247, 0.722128,
-    0.720003, 0.71787, 0.715731, 0.713585, 0.711432, 0.709273,
-    0.707107, 0.704934, 0.702755, 0.700569, 0.698376, 0.696177,
-    0.693971, 0.691759, 0.689541, 0.687315, 0.685084, 0.682846,
-    0.680601, 0.67835, 0.676093, 0.673829, 0.671559, 0.669283,
-    0.667, 0.664711, 0.662416, 0.660114, 0.657807, 0.655493,
-    0.653173, 0.650847, 0.648514, 0.646176, 0.643832, 0.641481,
-    0.639124, 0.636762, 0.634393, 0.632019, 0.629638, 0.627252,
-    0.624859, 0.622461, 0.620057, 0.617647, 0.615232, 0.61281,
-    0.610383, 0.60795, 0.605511, 0.603067, 0.600616, 0.598161,
-    0.595699, 0.593232, 0.59076, 0.588282, 0.585798, 0.583309,
-    0.580814, 0.578314, 0.575808, 0.573297, 0.570781, 0.568259,
-    0.565732, 0.563199, 0.560662, 0.558119, 0.55557, 0.553017,
-    0.550458, 0.547894, 0.545325, 0.542751, 0.540171, 0.537587,
-    0.534998, 0.532403, 0.529804, 0.527199, 0.52459, 0.521975,
-    0.519356, 0.516732, 0.514103, 0.511469, 0.50883, 0.506187,
-    0.503538, 0.500885, 0.498228, 0.495565, 0.492898, 0.490226,
-    0.48755, 0.484869, 0.482184, 0.479494, 0.476799, 0.4741,
-    0.471397, 0.468689, 0.465976, 0.46326, 0.460539, 0.457813,
-    0.455084, 0.45235, 0.449611, 0.446869, 0.444122, 0.441371,
-    0.438616, 0.435857, 0.433094, 0.430326, 0.427555, 0.42478,
-    0.422, 0.419217, 0.41643, 0.413638, 0.410843, 0.408044,
-    0.405241, 0.402435, 0.399624, 0.39681, 0.393992, 0.39117,
-    0.388345, 0.385516, 0.382683, 0.379847, 0.377007, 0.374164,
-    0.371317, 0.368467, 0.365613, 0.362756, 0.359895, 0.357031,
-    0.354164, 0.351293, 0.348419, 0.345541, 0.342661, 0.339777,
-    0.33689, 0.334, 0.331106, 0.32821, 0.32531, 0.322408,
-    0.319502, 0.316593, 0.313682, 0.310767, 0.30785, 0.304929,
-    0.302006, 0.29908, 0.296151, 0.293219, 0.290285, 0.287347,
-    0.284408, 0.281465, 0.27852, 0.275572, 0.272621, 0.269668,
-    0.266713, 0.263755, 0.260794, 0.257831, 0.254866, 0.251898,
-    0.248928, 0.245955, 0.24298, 0.240003, 0.237024, 0.234042,
-    0.231058, 0.228072, 0.225084, 0.222094, 0.219101, 0.216107,
-    0.21311, 0.210112, 0.207111, 0.204109, 0.201105, 0.198098,
-    0.19509, 0.19208, 0.189069, 0.186055, 0.18304, 0.180023,
-    0.177004, 0.173984, 0.170962, 0.167938, 0.164913, 0.161886,
-    0.158858, 0.155828, 0.152797, 0.149765, 0.14673, 0.143695,
-    0.140658, 0.13762, 0.134581, 0.13154, 0.128498, 0.125455,
-    0.122411, 0.119365, 0.116319, 0.113271, 0.110222, 0.107172,
-    0.104122, 0.10107, 0.0980171, 0.0949635, 0.091909, 0.0888536,
-    0.0857973, 0.0827403, 0.0796824, 0.0766239, 0.0735646, 0.0705046,
-    0.0674439, 0.0643826, 0.0613207, 0.0582583, 0.0551952, 0.0521317,
-    0.0490677, 0.0460032, 0.0429383, 0.0398729, 0.0368072, 0.0337412,
-    0.0306748, 0.0276081, 0.0245412, 0.0214741, 0.0184067, 0.0153392,
-    0.0122715, 0.00920375, 0.00613588, 0.00306796, 2.22045e-16, -0.00306796,
-    -0.00613588, -0.00920375, -0.0122715, -0.0153392, -0.0184067, -0.0214741,
-    -0.0245412, -0.0276081, -0.0306748, -0.0337412, -0.0368072, -0.0398729,
-    -0.0429383, -0.0460032, -0.0490677, -0.0521317, -0.0551952, -0.0582583,
-    -0.0613207, -0.0643826, -0.0674439, -0.0705046, -0.0735646, -0.0766239,
-    -0.0796824, -0.0827403, -0.0857973, -0.0888536, -0.091909, -0.0949635,
-    -0.0980171, -0.10107, -0.104122, -0.107172, -0.110222, -0.113271,
-    -0.116319, -0.119365, -0.122411, -0.125455, -0.128498, -0.13154,
-    -0.134581, -0.13762, -0.140658, -0.143695, -0.14673, -0.149765,
-    -0.152797, -0.155828, -0.158858, -0.161886, -0.164913, -0.167938,
-    -0.170962, -0.173984, -0.177004, -0.180023, -0.18304, -0.186055,
-    -0.189069, -0.19208, -0.19509, -0.198098, -0.201105, -0.204109,
-    -0.207111, -0.210112, -0.21311, -0.216107, -0.219101, -0.222094,
-    -0.225084, -0.228072, -0.231058, -0.234042, -0.237024, -0.240003,
-    -0.24298, -0.245955, -0.248928, -0.251898, -0.254866, -0.257831,
-    -0.260794, -0.263755, -0.266713, -0.269668, -0.272621, -0.275572,
-    -0.27852, -0.281465, -0.284408, -0.287347, -0.290285, -0.293219,
-    -0.296151, -0.29908, -0.302006, -0.304929, -0.30785, -0.310767,
-    -0.313682, -0.316593, -0.319502, -0.322408, -0.32531, -0.32821,
-    -0.331106, -0.334, -0.33689, -0.339777, -0.342661, -0.345541,
-    -0.348419, -0.351293, -0.354164, -0.357031, -0.359895, -0.362756,
-    -0.365613, -0.368467, -0.371317, -0.374164, -0.377007, -0.379847,
-    -0.382683, -0.385516, -0.388345, -0.39117, -0.393992, -0.39681,
-    -0.399624, -0.402435, -0.405241, -0.408044, -0.410843, -0.413638,
-    -0.41643, -0.419217, -0.422, -0.42478, -0.427555, -0.430326,
-    -0.433094, -0.435857, -0.438616, -0.441371, -0.444122, -0.446869,
-    -0.449611, -0.45235, -0.455084, -0.457813, -0.460539, -0.46326,
-    -0.465976, -0.468689, -0.471397, -0.4741, -0.476799, -0.479494,
-    -0.482184, -0.484869, -0.48755, -0.490226, -0.492898, -0.495565,
-    -0.498228, -0.500885, -0.503538, -0.506187, -0.50883, -0.511469,
-    -0.514103, -0.516732, -0.519356, -0.521975, -0.52459, -0.527199,
-    -0.529804, -0.532403, -0.534998, -0.537587, -0.540171, -0.542751,
-    -0.545325, -0.547894, -0.550458, -0.553017, -0.55557, -0.558119,
-    -0.560662, -0.563199, -0.565732, -0.568259, -0.570781, -0.573297,
-    -0.575808, -0.578314, -0.580814, -0.583309, -0.585798, -0.588282,
-    -0.59076, -0.593232, -0.595699, -0.598161, -0.600616, -0.603067,
-    -0.605511, -0.60795, -0.610383, -0.61281, -0.615232, -0.617647,
-    -0.620057, -0.622461, -0.624859, -0.627252, -0.629638, -0.632019,
-    -0.634393, -0.636762, -0.639124, -0.641481, -0.643832, -0.646176,
-    -0.648514, -0.650847, -0.653173, -0.655493, -0.657807, -0.660114,
-    -0.662416, -0.664711, -0.667, -0.669283, -0.671559, -0.673829,
-    -0.676093, -0.67835, -0.680601, -0.682846, -0.685084, -0.687315,
-    -0.689541, -0.691759, -0.693971, -0.696177, -0.698376, -0.700569,
-    -0.702755, -0.704934, -0.707107, -0.709273, -0.711432, -0.713585,
-    -0.715731, -0.71787, -0.720003, -0.722128, -0.724247, -0.726359,
-    -0.728464, -0.730563, -0.732654, -0.734739, -0.736817, -0.738887,
-    -0.740951, -0.743008, -0.745058, -0.747101, -0.749136, -0.751165,
-    -0.753187, -0.755201, -0.757209, -0.759209, -0.761202, -0.763188,
-    -0.765167, -0.767139, -0.769103, -0.771061, -0.77301, -0.774953,
-    -0.776888, -0.778817, -0.780737, -0.782651, -0.784557, -0.786455,
-    -0.788346, -0.79023, -0.792107, -0.793975, -0.795837, -0.797691,
-    -0.799537, -0.801376, -0.803208, -0.805031, -0.806848, -0.808656,
-    -0.810457, -0.812251, -0.814036, -0.815814, -0.817585, -0.819348,
-    -0.821103, -0.82285, -0.824589, -0.826321, -0.828045, -0.829761,
-    -0.83147, -0.83317, -0.834863, -0.836548, -0.838225, -0.839894,
-    -0.841555, -0.843208, -0.844854, -0.846491, -0.84812, -0.849742,
-    -0.851355, -0.852961, -0.854558, -0.856147, -0.857729, -0.859302,
-    -0.860867, -0.862424, -0.863973, -0.865514, -0.867046, -0.868571,
-    -0.870087, -0.871595, -0.873095, -0.874587, -0.87607, -0.877545,
-    -0.879012, -0.880471, -0.881921, -0.883363, -0.884797, -0.886223,
-    -0.88764, -0.889048, -0.890449, -0.891841, -0.893224, -0.894599,
-    -0.895966, -0.897325, -0.898674, -0.900016, -0.901349, -0.902673,
-    -0.903989, -0.905297, -0.906596, -0.907886, -0.909168, -0.910441,
-    -0.911706, -0.912962, -0.91421, -0.915449, -0.916679, -0.917901,
-    -0.919114, -0.920318, -0.921514, -0.922701, -0.92388, -0.925049,
-    -0.92621, -0.927363, -0.928506, -0.929641, -0.930767, -0.931884,
-    -0.932993, -0.934093, -0.935184, -0.936266, -0.937339, -0.938404,
-    -0.939459, -0.940506, -0.941544, -0.942573, -0.943593, -0.944605,
-    -0.945607, -0.946601, -0.947586, -0.948561, -0.949528, -0.950486,
-    -0.951435, -0.952375, -0.953306, -0.954228, -0.955141, -0.956045,
-    -0.95694, -0.957826, -0.958703, -0.959572, -0.960431, -0.96128,
-    -0.962121, -0.962953, -0.963776, -0.96459, -0.965394, -0.96619,
-    -0.966976, -0.967754, -0.968522, -0.969281, -0.970031, -0.970772,
-    -0.971504, -0.972226, -0.97294, -0.973644, -0.974339, -0.975025,
-    -0.975702, -0.97637, -0.977028, -0.977677, -0.978317, -0.978948,
-    -0.97957, -0.980182, -0.980785, -0.981379, -0.981964, -0.982539,
-    -0.983105, -0.983662, -0.98421, -0.984749, -0.985278, -0.985798,
-    -0.986308, -0.986809, -0.987301, -0.987784, -0.988258, -0.988722,
-    -0.989177, -0.989622, -0.990058, -0.990485, -0.990903, -0.991311,
-    -0.99171, -0.992099, -0.99248, -0.99285, -0.993212, -0.993564,
-    -0.993907, -0.99424, -0.994565, -0.994879, -0.995185, -0.995481,
-    -0.995767, -0.996045, -0.996313, -0.996571, -0.99682, -0.99706,
-    -0.99729, -0.997511, -0.997723, -0.997925, -0.998118, -0.998302,
-    -0.998476, -0.99864, -0.998795, -0.998941, -0.999078, -0.999205,
-    -0.999322, -0.999431, -0.999529, -0.999619, -0.999699, -0.999769,
-    -0.999831, -0.999882, -0.999925, -0.999958, -0.999981, -0.999995,
-    -1, -0.999995, -0.999981, -0.999958, -0.999925, -0.999882,
-    -0.999831, -0.999769, -0.999699, -0.999619, -0.999529, -0.999431,
-    -0.999322, -0.999205, -0.999078, -0.998941, -0.998795, -0.99864,
-    -0.998476, -0.998302, -0.998118, -0.997925, -0.997723, -0.997511,
-    -0.99729, -0.99706, -0.99682, -0.996571, -0.996313, -0.996045,
-    -0.995767, -0.995481, -0.995185, -0.994879, -0.994565, -0.99424,
-    -0.993907, -0.993564, -0.993212, -0.99285, -0.99248, -0.992099,
-    -0.99171, -0.991311, -0.990903, -0.990485, -0.990058, -0.989622,
-    -0.989177, -0.988722, -0.988258, -0.987784, -0.987301, -0.986809,
-    -0.986308, -0.985798, -0.985278, -0.984749, -0.98421, -0.983662,
-    -0.983105, -0.982539, -0.981964, -0.981379, -0.980785, -0.980182,
-    -0.97957, -0.978948, -0.978317, -0.977677, -0.977028, -0.97637,
-    -0.975702, -0.975025, -0.974339, -0.973644, -0.97294, -0.972226,
-    -0.971504, -0.970772, -0.970031, -0.969281, -0.968522, -0.967754,
-    -0.966976, -0.96619, -0.965394, -0.96459, -0.963776, -0.962953,
-    -0.962121, -0.96128, -0.960431, -0.959572, -0.958703, -0.957826,
-    -0.95694, -0.956045, -0.955141, -0.954228, -0.953306, -0.952375,
-    -0.951435, -0.950486, -0.949528, -0.948561, -0.947586, -0.946601,
-    -0.945607, -0.944605, -0.943593, -0.942573, -0.941544, -0.940506,
-    -0.939459, -0.938404, -0.937339, -0.936266, -0.935184, -0.934093,
-    -0.932993, -0.931884, -0.930767, -0.929641, -0.928506, -0.927363,
-    -0.92621, -0.925049, -0.92388, -0.922701, -0.921514, -0.920318,
-    -0.919114, -0.917901, -0.916679, -0.915449, -0.91421, -0.912962,
-    -0.911706, -0.910441, -0.909168, -0.907886, -0.906596, -0.905297,
-    -0.903989, -0.902673, -0.901349, -0.900016, -0.898674, -0.897325,
-    -0.895966, -0.894599, -0.893224, -0.891841, -0.890449, -0.889048,
-    -0.88764, -0.886223, -0.884797, -0.883363, -0.881921, -0.880471,
-    -0.879012, -0.877545, -0.87607, -0.874587, -0.873095, -0.871595,
-    -0.870087, -0.868571, -0.867046, -0.865514, -0.863973, -0.862424,
-    -0.860867, -0.859302, -0.857729, -0.856147, -0.854558, -0.852961,
-    -0.851355, -0.849742, -0.84812, -0.846491, -0.844854, -0.843208,
-    -0.841555, -0.839894, -0.838225, -0.836548, -0.834863, -0.83317,
-    -0.83147, -0.829761, -0.828045, -0.826321, -0.824589, -0.82285,
-    -0.821103, -0.819348, -0.817585, -0.815814, -0.814036, -0.812251,
-    -0.810457, -0.808656, -0.806848, -0.805031, -0.803208, -0.801376,
-    -0.799537, -0.797691, -0.795837, -0.793975, -0.792107, -0.79023,
-    -0.788346, -0.786455, -0.784557, -0.782651, -0.780737, -0.778817,
-    -0.776888, -0.774953, -0.77301, -0.771061, -0.769103, -0.767139,
-    -0.765167, -0.763188, -0.761202, -0.759209, -0.757209, -0.755201,
-    -0.753187, -0.751165, -0.749136, -0.747101, -0.745058, -0.743008,
-    -0.740951, -0.738887, -0.736817, -0.734739, -0.732654, -0.730563,
-    -0.728464, -0.726359, -0.724247, -0.722128, -0.720003, -0.71787,
-    -0.715731, -0.713585, -0.711432, -0.709273, -0.707107, -0.704934,
-    -0.702755, -0.700569, -0.698376, -0.696177, -0.693971, -0.691759,
-    -0.689541, -0.687315, -0.685084, -0.682846, -0.680601, -0.67835,
-    -0.676093, -0.673829, -0.671559, -0.669283, -0.667, -0.664711,
-    -0.662416, -0.660114, -0.657807, -0.655493, -0.653173, -0.650847,
-    -0.648514, -0.646176, -0.643832, -0.641481, -0.639124, -0.636762,
-    -0.634393, -0.632019, -0.629638, -0.627252, -0.624859, -0.622461,
-    -0.620057, -0.617647, -0.615232, -0.61281, -0.610383, -0.60795,
-    -0.605511, -0.603067, -0.600616, -0.598161, -0.595699, -0.593232,
-    -0.59076, -0.588282, -0.585798, -0.583309, -0.580814, -0.578314,
-    -0.575808, -0.573297, -0.570781, -0.568259, -0.565732, -0.563199,
-    -0.560662, -0.558119, -0.55557, -0.553017, -0.550458, -0.547894,
-    -0.545325, -0.542751, -0.540171, -0.537587, -0.534998, -0.532403,
-    -0.529804, -0.527199, -0.52459, -0.521975, -0.519356, -0.516732,
-    -0.514103, -0.511469, -0.50883, -0.506187, -0.503538, -0.500885,
-    -0.498228, -0.495565, -0.492898, -0.490226, -0.48755, -0.484869,
-    -0.482184, -0.479494, -0.476799, -0.4741, -0.471397, -0.468689,
-    -0.465976, -0.46326, -0.460539, -0.457813, -0.455084, -0.45235,
-    -0.449611, -0.446869, -0.444122, -0.441371, -0.438616, -0.435857,
-    -0.433094, -0.430326, -0.427555, -0.42478, -0.422, -0.419217,
-    -0.41643, -0.413638, -0.410843, -0.408044, -0.405241, -0.402435,
-    -0.399624, -0.39681, -0.393992, -0.39117, -0.388345, -0.385516,
-    -0.382683, -0.379847, -0.377007, -0.374164, -0.371317, -0.368467,
-    -0.365613, -0.362756, -0.359895, -0.357031, -0.354164, -0.351293,
-    -0.348419, -0.345541, -0.342661, -0.339777, -0.33689, -0.334,
-    -0.331106, -0.32821, -0.32531, -0.322408, -0.319502, -0.316593,
-    -0.313682, -0.310767, -0.30785, -0.304929, -0.302006, -0.29908,
-    -0.296151, -0.293219, -0.290285, -0.287347, -0.284408, -0.281465,
-    -0.27852, -0.275572, -0.272621, -0.269668, -0.266713, -0.263755,
-    -0.260794, -0.257831, -0.254866, -0.251898, -0.248928, -0.245955,
-    -0.24298, -0.240003, -0.237024, -0.234042, -0.231058, -0.228072,
-    -0.225084, -0.222094, -0.219101, -0.216107, -0.21311, -0.210112,
-    -0.207111, -0.204109, -0.201105, -0.198098, -0.19509, -0.19208,
-    -0.189069, -0.186055, -0.18304, -0.180023, -0.177004, -0.173984,
-    -0.170962, -0.167938, -0.164913, -0.161886, -0.158858, -0.155828,
-    -0.152797, -0.149765, -0.14673, -0.143695, -0.140658, -0.13762,
-    -0.134581, -0.13154, -0.128498, -0.125455, -0.122411, -0.119365,
-    -0.116319, -0.113271, -0.110222, -0.107172, -0.104122, -0.10107,
-    -0.0980171, -0.0949635, -0.091909, -0.0888536, -0.0857973, -0.0827403,
-    -0.0796824, -0.0766239, -0.0735646, -0.0705046, -0.0674439, -0.0643826,
-    -0.0613207, -0.0582583, -0.0551952, -0.0521317, -0.0490677, -0.0460032,
-    -0.0429383, -0.0398729, -0.0368072, -0.0337412, -0.0306748, -0.0276081,
-    -0.0245412, -0.0214741, -0.0184067, -0.0153392, -0.0122715, -0.00920375,
-    -0.00613588, -0.00306796
-};
-
-static const float *WAVE_SQUARES[DEFAULT_OCTAVES] = {
-    WAVE_SQUARE_000, WAVE_SQUARE_006, WAVE_SQUARE_018,
-    WAVE_SQUARE_030, WAVE_SQUARE_042, WAVE_SQUARE_054,
-    WAVE_SQUARE_066, WAVE_SQUARE_078, WAVE_SQUARE_090,
-    WAVE_SQUARE_102, WAVE_SQUARE_114, WAVE_SQUARE_126
-};
@@ -1,4152 +0,0 @@
-/* A triangle wave. */
-
-#pragma once
-
-#include "../constants/defaults.h"
-
-static const float WAVE_TRIANGLE_000[DEFAULT_WAVELEN] = {
-    0, 0.00195338, 0.00390682, 0.00586014, 0.00781363, 0.00976693,
-    0.0117204, 0.0136738, 0.0156271, 0.0175806, 0.0195339, 0.0214874,
-    0.0234407, 0.0253942, 0.0273475, 0.0293009, 0.0312543, 0.0332077,
-    0.0351611, 0.0371145, 0.0390679, 0.0410213, 0.0429747, 0.0449281,
-    0.0468814, 0.0488349, 0.0507882, 0.0527417, 0.054695, 0.0566485,
-    0.0586018, 0.0605552, 0.0625087, 0.064462, 0.0664155, 0.0683688,
-    0.0703222, 0.0722756, 0.074229, 0.0761824, 0.0781357, 0.0800892,
-    0.0820425, 0.083996, 0.0859493, 0.0879028, 0.0898562, 0.0918095,
-    0.093763, 0.0957163, 0.0976698, 0.0996231, 0.101577, 0.10353,
-    0.105483, 0.107437, 0.10939, 0.111344, 0.113297, 0.11525,
-    0.117204, 0.119157, 0.121111, 0.123064, 0.125017, 0.126971,
-    0.128924, 0.130877, 0.132831, 0.134784, 0.136738, 0.138691,
-    0.140644, 0.142598, 0.144551, 0.146505, 0.148458, 0.150411,
-    0.152365, 0.154318, 0.156272, 0.158225, 0.160178, 0.162132,
-    0.164085, 0.166039, 0.167992, 0.169945, 0.171899, 0.173852,
-    0.175806, 0.177759, 0.179712, 0.181666, 0.183619, 0.185572,
-    0.187526, 0.189479, 0.191433, 0.193386, 0.195339, 0.197293,
-    0.199246, 0.2012, 0.203153, 0.205106, 0.20706, 0.209013,
-    0.210967, 0.21292, 0.214873, 0.216827, 0.21878, 0.220734,
-    0.222687, 0.22464, 0.226594, 0.228547, 0.230501, 0.232454,
-    0.234407, 0.236361, 0.238314, 0.240267, 0.242221, 0.244174,
-    0.246128, 0.248081, 0.250035, 0.251988, 0.253941, 0.255895,
-    0.257848, 0.259802, 0.261755, 0.263708, 0.265662, 0.267615,
-    0.269569, 0.271522, 0.273475, 0.275429, 0.277382, 0.279335,
-    0.281289, 0.283242, 0.285196, 0.287149, 0.289102, 0.291056,
-    0.293009, 0.294963, 0.296916, 0.298869, 0.300823, 0.302776,
-    0.30473, 0.306683, 0.308636, 0.31059, 0.312543, 0.314497,
-    0.31645, 0.318403, 0.320357, 0.32231, 0.324264, 0.326217,
-    0.32817, 0.330124, 0.332077, 0.33403, 0.335984, 0.337937,
-    0.339891, 0.341844, 0.343797, 0.345751, 0.347704, 0.349658,
-    0.351611, 0.353564, 0.355518, 0.357471, 0.359425, 0.361378,
-    0.363331, 0.365285, 0.367238, 0.369192, 0.371145, 0.373098,
-    0.375052, 0.377005, 0.378959, 0.380912, 0.382865, 0.384819,
-    0.386772, 0.388725, 0.390679, 0.392632, 0.394586, 0.396539,
-    0.398492, 0.400446, 0.402399, 0.404353, 0.406306, 0.40826,
-    0.410213, 0.412166, 0.41412, 0.416073, 0.418027, 0.41998,
-    0.421933, 0.423887, 0.42584, 0.427793, 0.429747, 0.4317,
-    0.433654, 0.435607, 0.43756, 0.439514, 0.441467, 0.443421,
-    0.445374, 0.447327, 0.449281, 0.451234, 0.453188, 0.455141,
-    0.457094, 0.459048, 0.461001, 0.462955, 0.464908, 0.466861,
-    0.468815, 0.470768, 0.472722, 0.474675, 0.476628, 0.478582,
-    0.480535, 0.482488, 0.484442, 0.486395, 0.488349, 0.490302,
-    0.492255, 0.494209, 0.496162, 0.498116, 0.500069, 0.502022,
-    0.503976, 0.505929, 0.507883, 0.509836, 0.511789, 0.513743,
-    0.515696, 0.51765, 0.519603, 0.521556, 0.52351, 0.525463,
-    0.527417, 0.52937, 0.531323, 0.533277, 0.53523, 0.537183,
-    0.539137, 0.54109, 0.543044, 0.544997, 0.54695, 0.548904,
-    0.550857, 0.552811, 0.554764, 0.556718, 0.558671, 0.560624,
-    0.562578, 0.564531, 0.566485, 0.568438, 0.570391, 0.572345,
-    0.574298, 0.576251, 0.578205, 0.580158, 0.582112, 0.584065,
-    0.586018, 0.587972, 0.589925, 0.591879, 0.593832, 0.595785,
-    0.597739, 0.599692, 0.601646, 0.603599, 0.605552, 0.607506,
-    0.609459, 0.611413, 0.613366, 0.615319, 0.617273, 0.619226,
-    0.62118, 0.623133, 0.625086, 0.62704, 0.628993, 0.630946,
-    0.6329, 0.634853, 0.636807, 0.63876, 0.640713, 0.642667,
-    0.64462, 0.646574, 0.648527, 0.65048, 0.652434, 0.654387,
-    0.656341, 0.658294, 0.660247, 0.662201, 0.664154, 0.666108,
-    0.668061, 0.670014, 0.671968, 0.673921, 0.675875, 0.677828,
-    0.679781, 0.681735, 0.683688, 0.685641, 0.687595, 0.689548,
-    0.691502, 0.693455, 0.695408, 0.697362, 0.699315, 0.701269,
-    0.703222, 0.705175, 0.707129, 0.709082, 0.711036, 0.712989,
-    0.714943, 0.716896, 0.718849, 0.720803, 0.722756, 0.724709,
-    0.726663, 0.728616, 0.730569, 0.732523, 0.734476, 0.73643,
-    0.738383, 0.740336, 0.74229, 0.744243, 0.746197, 0.74815,
-    0.750104, 0.752057, 0.75401, 0.755964, 0.757917, 0.759871,
-    0.761824, 0.763777, 0.765731, 0.767684, 0.769638, 0.771591,
-    0.773544, 0.775498, 0.777451, 0.779404, 0.781358, 0.783311,
-    0.785265, 0.787218, 0.789171, 0.791125, 0.793078, 0.795032,
-    0.796985, 0.798938, 0.800892, 0.802845, 0.804799, 0.806752,
-    0.808705, 0.810659, 0.812612, 0.814566, 0.816519, 0.818473,
-    0.820426, 0.822379, 0.824333, 0.826286, 0.828239, 0.830193,
-    0.832146, 0.834099, 0.836053, 0.838006, 0.83996, 0.841913,
-    0.843866, 0.84582, 0.847773, 0.849727, 0.85168, 0.853633,
-    0.855587, 0.85754, 0.859494, 0.861447, 0.863401, 0.865354,
-    0.867307, 0.869261, 0.871214, 0.873168, 0.875121, 0.877074,
-    0.879027, 0.880981, 0.882934, 0.884888, 0.886841, 0.888794,
-    0.890748, 0.892701, 0.894655, 0.896608, 0.898561, 0.900515,
-    0.902468, 0.904422, 0.906375, 0.908329, 0.910282, 0.912235,
-    0.914189, 0.916142, 0.918096, 0.920049, 0.922003, 0.923955,
-    0.925909, 0.927863, 0.929816, 0.93177, 0.933722, 0.935676,
-    0.937629, 0.939583, 0.941536, 0.943489, 0.945443, 0.947396,
-    0.94935, 0.951303, 0.953257, 0.95521, 0.957163, 0.959117,
-    0.961069, 0.963024, 0.964976, 0.966931, 0.968883, 0.970837,
-    0.972791, 0.974743, 0.976699, 0.978649, 0.980605, 0.982556,
-    0.984511, 0.986465, 0.988416, 0.990374, 0.992321, 0.994283,
-    0.996225, 0.998193, 1, 0.998193, 0.996225, 0.994283,
-    0.992321, 0.990374, 0.988416, 0.986465, 0.984511, 0.982556,
-    0.980605, 0.978649, 0.976699, 0.974743, 0.972791, 0.970837,
-    0.968883, 0.966931, 0.964976, 0.963024, 0.961069, 0.959117,
-    0.957163, 0.95521, 0.953257, 0.951303, 0.94935, 0.947396,
-    0.945443, 0.943489, 0.941536, 0.939583, 0.937629, 0.935676,
-    0.933722, 0.93177, 0.929816, 0.927863, 0.925909, 0.923955,
-    0.922003, 0.920049, 0.918096, 0.916142, 0.914189, 0.912235,
-    0.910282, 0.908329, 0.906375, 0.904422, 0.902468, 0.900515,
-    0.898561, 0.896608, 0.894655, 0.892701, 0.890748, 0.888794,
-    0.886841, 0.884888, 0.882934, 0.880981, 0.879027, 0.877074,
-    0.875121, 0.873168, 0.871214, 0.869261, 0.867307, 0.865354,
-    0.863401, 0.861447, 0.859494, 0.85754, 0.855587, 0.853633,
-    0.85168, 0.849727, 0.847773, 0.84582, 0.843866, 0.841913,
-    0.83996, 0.838006, 0.836053, 0.834099, 0.832146, 0.830193,
-    0.828239, 0.826286, 0.824333, 0.822379, 0.820426, 0.818473,
-    0.816519, 0.814566, 0.812612, 0.810659, 0.808705, 0.806752,
-    0.804799, 0.802845, 0.800892, 0.798938, 0.796985, 0.795032,
-    0.793078, 0.791125, 0.789171, 0.787218, 0.785265, 0.783311,
-    0.781358, 0.779404, 0.777451, 0.775498, 0.773544, 0.771591,
-    0.769638, 0.767684, 0.765731, 0.763777, 0.761824, 0.759871,
-    0.757917, 0.755964, 0.75401, 0.752057, 0.750104, 0.74815,
-    0.746197, 0.744243, 0.74229, 0.740336, 0.738383, 0.73643,
-    0.734476, 0.732523, 0.730569, 0.728616, 0.726663, 0.724709,
-    0.722756, 0.720803, 0.718849, 0.716896, 0.714943, 0.712989,
-    0.711036, 0.709082, 0.707129, 0.705175, 0.703222, 0.701269,
-    0.699315, 0.697362, 0.695408, 0.693455, 0.691502, 0.689548,
-    0.687595, 0.685641, 0.683688, 0.681735, 0.679781, 0.677828,
-    0.675875, 0.673921, 0.671968, 0.670014, 0.668061, 0.666108,
-    0.664154, 0.662201, 0.660247, 0.658294, 0.656341, 0.654387,
-    0.652434, 0.65048, 0.648527, 0.646574, 0.64462, 0.642667,
-    0.640713, 0.63876, 0.636807, 0.634853, 0.6329, 0.630946,
-    0.628993, 0.62704, 0.625086, 0.623133, 0.62118, 0.619226,
-    0.617273, 0.615319, 0.613366, 0.611413, 0.609459, 0.607506,
-    0.605552, 0.603599, 0.601646, 0.599692, 0.597739, 0.595785,
-    0.593832, 0.591879, 0.589925, 0.587972, 0.586018, 0.584065,
-    0.582112, 0.580158, 0.578205, 0.576251, 0.574298, 0.572345,
-    0.570391, 0.568438, 0.566485, 0.564531, 0.562578, 0.560624,
-    0.558671, 0.556718, 0.554764, 0.552811, 0.550857, 0.548904,
-    0.54695, 0.544997, 0.543044, 0.54109, 0.539137, 0.537183,
-    0.53523, 0.533277, 0.531323, 0.52937, 0.527417, 0.525463,
-    0.52351, 0.521556, 0.519603, 0.51765, 0.515696, 0.513743,
-    0.511789, 0.509836, 0.507883, 0.505929, 0.503976, 0.502022,
-    0.500069, 0.498116, 0.496162, 0.494209, 0.492255, 0.490302,
-    0.488349, 0.486395, 0.484442, 0.482488, 0.480535, 0.478582,
-    0.476628, 0.474675, 0.472722, 0.470768, 0.468815, 0.466861,
-    0.464908, 0.462955, 0.461001, 0.459048, 0.457094, 0.455141,
-    0.453188, 0.451234, 0.449281, 0.447327, 0.445374, 0.443421,
-    0.441467, 0.439514, 0.43756, 0.435607, 0.433654, 0.4317,
-    0.429747, 0.427793, 0.42584, 0.423887, 0.421933, 0.41998,
-    0.418027, 0.416073, 0.41412, 0.412166, 0.410213, 0.40826,
-    0.406306, 0.404353, 0.402399, 0.400446, 0.398492, 0.396539,
-    0.394586, 0.392632, 0.390679, 0.388725, 0.386772, 0.384819,
-    0.382865, 0.380912, 0.378959, 0.377005, 0.375052, 0.373098,
-    0.371145, 0.369192, 0.367238, 0.365285, 0.363331, 0.361378,
-    0.359425, 0.357471, 0.355518, 0.353564, 0.351611, 0.349658,
-    0.347704, 0.345751, 0.343797, 0.341844, 0.339891, 0.337937,
-    0.335984, 0.33403, 0.332077, 0.330124, 0.32817, 0.326217,
-    0.324264, 0.32231, 0.320357, 0.318403, 0.31645, 0.314497,
-    0.312543, 0.31059, 0.308636, 0.306683, 0.30473, 0.302776,
-    0.300823, 0.298869, 0.296916, 0.294963, 0.293009, 0.291056,
-    0.289102, 0.287149, 0.285196, 0.283242, 0.281289, 0.279335,
-    0.277382, 0.275429, 0.273475, 0.271522, 0.269569, 0.267615,
-    0.265662, 0.263708, 0.261755, 0.259802, 0.257848, 0.255895,
-    0.253941, 0.251988, 0.250035, 0.248081, 0.246128, 0.244174,
-    0.242221, 0.240267, 0.238314, 0.236361, 0.234407, 0.232454,
-    0.230501, 0.228547, 0.226594, 0.22464, 0.222687, 0.220734,
-    0.21878, 0.216827, 0.214873, 0.21292, 0.210967, 0.209013,
-    0.20706, 0.205106, 0.203153, 0.2012, 0.199246, 0.197293,
-    0.195339, 0.193386, 0.191433, 0.189479, 0.187526, 0.185572,
-    0.183619, 0.181666, 0.179712, 0.177759, 0.175806, 0.173852,
-    0.171899, 0.169945, 0.167992, 0.166039, 0.164085, 0.162132,
-    0.160178, 0.158225, 0.156272, 0.154318, 0.152365, 0.150411,
-    0.148458, 0.146505, 0.144551, 0.142598, 0.140644, 0.138691,
-    0.136738, 0.134784, 0.132831, 0.130877, 0.128924, 0.126971,
-    0.125017, 0.123064, 0.121111, 0.119157, 0.117204, 0.11525,
-    0.113297, 0.111344, 0.10939, 0.107437, 0.105483, 0.10353,
-    0.101577, 0.0996231, 0.0976698, 0.0957163, 0.093763, 0.0918095,
-    0.0898562, 0.0879028, 0.0859493, 0.083996, 0.0820425, 0.0800892,
-    0.0781357, 0.0761824, 0.074229, 0.0722756, 0.0703222, 0.0683688,
-    0.0664155, 0.064462, 0.0625087, 0.0605552, 0.0586018, 0.0566485,
-    0.054695, 0.0527417, 0.0507882, 0.0488349, 0.0468814, 0.0449281,
-    0.0429747, 0.0410213, 0.0390679, 0.0371145, 0.0351611, 0.0332077,
-    0.0312543, 0.0293009, 0.0273475, 0.0253942, 0.0234407, 0.0214874,
-    0.0195339, 0.0175806, 0.0156271, 0.0136738, 0.0117204, 0.00976693,
-    0.00781363, 0.00586014, 0.00390682, 0.00195338, 0, -0.00195338,
-    -0.00390682, -0.00586014, -0.00781363, -0.00976693, -0.0117204, -0.0136738,
-    -0.0156271, -0.0175806, -0.0195339, -0.0214874, -0.0234407, -0.0253942,
-    -0.0273475, -0.0293009, -0.0312543, -0.0332077, -0.0351611, -0.0371145,
-    -0.0390679, -0.0410213, -0.0429747, -0.0449281, -0.0468814, -0.0488349,
-    -0.0507882, -0.0527417, -0.054695, -0.0566485, -0.0586018, -0.0605552,
-    -0.0625087, -0.064462, -0.0664155, -0.0683688, -0.0703222, -0.0722756,
-    -0.074229, -0.0761824, -0.0781357, -0.0800892, -0.0820425, -0.083996,
-    -0.0859493, -0.0879028, -0.0898562, -0.0918095, -0.093763, -0.0957163,
-    -0.0976698, -0.0996231, -0.101577, -0.10353, -0.105483, -0.107437,
-    -0.10939, -0.111344, -0.113297, -0.11525, -0.117204, -0.119157,
-    -0.121111, -0.123064, -0.125017, -0.126971, -0.128924, -0.130877,
-    -0.132831, -0.134784, -0.136738, -0.138691, -0.140644, -0.142598,
-    -0.144551, -0.146505, -0.148458, -0.150411, -0.152365, -0.154318,
-    -0.156272, -0.158225, -0.160178, -0.162132, -0.164085, -0.166039,
-    -0.167992, -0.169945, -0.171899, -0.173852, -0.175806, -0.177759,
-    -0.179712, -0.181666, -0.183619, -0.185572, -0.187526, -0.189479,
-    -0.191433, -0.193386, -0.195339, -0.197293, -0.199246, -0.2012,
-    -0.203153, -0.205106, -0.20706, -0.209013, -0.210967, -0.21292,
-    -0.214873, -0.216827, -0.21878, -0.220734, -0.222687, -0.22464,
-    -0.226594, -0.228547, -0.230501, -0.232454, -0.234407, -0.236361,
-    -0.238314, -0.240267, -0.242221, -0.244174, -0.246128, -0.248081,
-    -0.250035, -0.251988, -0.253941, -0.255895, -0.257848, -0.259802,
-    -0.261755, -0.263708, -0.265662, -0.267615, -0.269569, -0.271522,
-    -0.273475, -0.275429, -0.277382, -0.279335, -0.281289, -0.283242,
-    -0.285196, -0.287149, -0.289102, -0.291056, -0.293009, -0.294963,
-    -0.296916, -0.298869, -0.300823, -0.302776, -0.30473, -0.306683,
-    -0.308636, -0.31059, -0.312543, -0.314497, -0.31645, -0.318403,
-    -0.320357, -0.32231, -0.324264, -0.326217, -0.32817, -0.330124,
-    -0.332077, -0.33403, -0.335984, -0.337937, -0.339891, -0.341844,
-    -0.343797, -0.345751, -0.347704, -0.349658, -0.351611, -0.353564,
-    -0.355518, -0.357471, -0.359425, -0.361378, -0.363331, -0.365285,
-    -0.367238, -0.369192, -0.371145, -0.373098, -0.375052, -0.377005,
-    -0.378959, -0.380912, -0.382865, -0.384819, -0.386772, -0.388725,
-    -0.390679, -0.392632, -0.394586, -0.396539, -0.398492, -0.400446,
-    -0.402399, -0.404353, -0.406306, -0.40826, -0.410213, -0.412166,
-    -0.41412, -0.416073, -0.418027, -0.41998, -0.421933, -0.423887,
-    -0.42584, -0.427793, -0.429747, -0.4317, -0.433654, -0.435607,
-    -0.43756, -0.439514, -0.441467, -0.443421, -0.445374, -0.447327,
-    -0.449281, -0.451234, -0.453188, -0.455141, -0.457094, -0.459048,
-    -0.461001, -0.462955, -0.464908, -0.466861, -0.468815, -0.470768,
-    -0.472722, -0.474675, -0.476628, -0.478582, -0.480535, -0.482488,
-    -0.484442, -0.486395, -0.488349, -0.490302, -0.492255, -0.494209,
-    -0.496162, -0.498116, -0.500069, -0.502022, -0.503976, -0.505929,
-    -0.507883, -0.509836, -0.511789, -0.513743, -0.515696, -0.51765,
-    -0.519603, -0.521556, -0.52351, -0.525463, -0.527417, -0.52937,
-    -0.531323, -0.533277, -0.53523, -0.537183, -0.539137, -0.54109,
-    -0.543044, -0.544997, -0.54695, -0.548904, -0.550857, -0.552811,
-    -0.554764, -0.556718, -0.558671, -0.560624, -0.562578, -0.564531,
-    -0.566485, -0.568438, -0.570391, -0.572345, -0.574298, -0.576251,
-    -0.578205, -0.580158, -0.582112, -0.584065, -0.586018, -0.587972,
-    -0.589925, -0.591879, -0.593832, -0.595785, -0.597739, -0.599692,
-    -0.601646, -0.603599, -0.605552, -0.607506, -0.609459, -0.611413,
-    -0.613366, -0.615319, -0.617273, -0.619226, -0.62118, -0.623133,
-    -0.625086, -0.62704, -0.628993, -0.630946, -0.6329, -0.634853,
-    -0.636807, -0.63876, -0.640713, -0.642667, -0.64462, -0.646574,
-    -0.648527, -0.65048, -0.652434, -0.654387, -0.656341, -0.658294,
-    -0.660247, -0.662201, -0.664154, -0.666108, -0.668061, -0.670014,
-    -0.671968, -0.673921, -0.675875, -0.677828, -0.679781, -0.681735,
-    -0.683688, -0.685641, -0.687595, -0.689548, -0.691502, -0.693455,
-    -0.695408, -0.697362, -0.699315, -0.701269, -0.703222, -0.705175,
-    -0.707129, -0.709082, -0.711036, -0.712989, -0.714943, -0.716896,
-    -0.718849, -0.720803, -0.722756, -0.724709, -0.726663, -0.728616,
-    -0.730569, -0.732523, -0.734476, -0.73643, -0.738383, -0.740336,
-    -0.74229, -0.744243, -0.746197, -0.74815, -0.750104, -0.752057,
-    -0.75401, -0.755964, -0.757917, -0.759871, -0.761824, -0.763777,
-    -0.765731, -0.767684, -0.769638, -0.771591, -0.773544, -0.775498,
-    -0.777451, -0.779404, -0.781358, -0.783311, -0.785265, -0.787218,
-    -0.789171, -0.791125, -0.793078, -0.795032, -0.796985, -0.798938,
-    -0.800892, -0.802845, -0.804799, -0.806752, -0.808705, -0.810659,
-    -0.812612, -0.814566, -0.816519, -0.818473, -0.820426, -0.822379,
-    -0.824333, -0.826286, -0.828239, -0.830193, -0.832146, -0.834099,
-    -0.836053, -0.838006, -0.83996, -0.841913, -0.843866, -0.84582,
-    -0.847773, -0.849727, -0.85168, -0.853633, -0.855587, -0.85754,
-    -0.859494, -0.861447, -0.863401, -0.865354, -0.867307, -0.869261,
-    -0.871214, -0.873168, -0.875121, -0.877074, -0.879027, -0.880981,
-    -0.882934, -0.884888, -0.886841, -0.888794, -0.890748, -0.892701,
-    -0.894655, -0.896608, -0.898561, -0.900515, -0.902468, -0.904422,
-    -0.906375, -0.908329, -0.910282, -0.912235, -0.914189, -0.916142,
-    -0.918096, -0.920049, -0.922003, -0.923955, -0.925909, -0.927863,
-    -0.929816, -0.93177, -0.933722, -0.935676, -0.937629, -0.939583,
-    -0.941536, -0.943489, -0.945443, -0.947396, -0.94935, -0.951303,
-    -0.953257, -0.95521, -0.957163, -0.959117, -0.961069, -0.963024,
-    -0.964976, -0.966931, -0.968883, -0.970837, -0.972791, -0.974743,
-    -0.976699, -0.978649, -0.980605, -0.982556, -0.984511, -0.986465,
-    -0.988416, -0.990374, -0.992321, -0.994283, -0.996225, -0.998193,
-    -1, -0.998193, -0.996225, -0.994283, -0.992321, -0.990374,
-    -0.988416, -0.986465, -0.984511, -0.982556, -0.980605, -0.978649,
-    -0.976699, -0.974743, -0.972791, -0.970837, -0.968883, -0.966931,
-    -0.964976, -0.963024, -0.961069, -0.959117, -0.957163, -0.95521,
-    -0.953257, -0.951303, -0.94935, -0.947396, -0.945443, -0.943489,
-    -0.941536, -0.939583, -0.937629, -0.935676, -0.933722, -0.93177,
-    -0.929816, -0.927863, -0.925909, -0.923955, -0.922003, -0.920049,
-    -0.918096, -0.916142, -0.914189, -0.912235, -0.910282, -0.908329,
-    -0.906375, -0.904422, -0.902468, -0.900515, -0.898561, -0.896608,
-    -0.894655, -0.892701, -0.890748, -0.888794, -0.886841, -0.884888,
-    -0.882934, -0.880981, -0.879027, -0.877074, -0.875121, -0.873168,
-    -0.871214, -0.869261, -0.867307, -0.865354, -0.863401, -0.861447,
-    -0.859494, -0.85754, -0.855587, -0.853633, -0.85168, -0.849727,
-    -0.847773, -0.84582, -0.843866, -0.841913, -0.83996, -0.838006,
-    -0.836053, -0.834099, -0.832146, -0.830193, -0.828239, -0.826286,
-    -0.824333, -0.822379, -0.820426, -0.818473, -0.816519, -0.814566,
-    -0.812612, -0.810659, -0.808705, -0.806752, -0.804799, -0.802845,
-    -0.800892, -0.798938, -0.796985, -0.795032, -0.793078, -0.791125,
-    -0.789171, -0.787218, -0.785265, -0.783311, -0.781358, -0.779404,
-    -0.777451, -0.775498, -0.773544, -0.771591, -0.769638, -0.767684,
-    -0.765731, -0.763777, -0.761824, -0.759871, -0.757917, -0.755964,
-    -0.75401, -0.752057, -0.750104, -0.74815, -0.746197, -0.744243,
-    -0.74229, -0.740336, -0.738383, -0.73643, -0.734476, -0.732523,
-    -0.730569, -0.728616, -0.726663, -0.724709, -0.722756, -0.720803,
-    -0.718849, -0.716896, -0.714943, -0.712989, -0.711036, -0.709082,
-    -0.707129, -0.705175, -0.703222, -0.701269, -0.699315, -0.697362,
-    -0.695408, -0.693455, -0.691502, -0.689548, -0.687595, -0.685641,
-    -0.683688, -0.681735, -0.679781, -0.677828, -0.675875, -0.673921,
-    -0.671968, -0.670014, -0.668061, -0.666108, -0.664154, -0.662201,
-    -0.660247, -0.658294, -0.656341, -0.654387, -0.652434, -0.65048,
-    -0.648527, -0.646574, -0.64462, -0.642667, -0.640713, -0.63876,
-    -0.636807, -0.634853, -0.6329, -0.630946, -0.628993, -0.62704,
-    -0.625086, -0.623133, -0.62118, -0.619226, -0.617273, -0.615319,
-    -0.613366, -0.611413, -0.609459, -0.607506, -0.605552, -0.603599,
-    -0.601646, -0.599692, -0.597739, -0.595785, -0.593832, -0.591879,
-    -0.589925, -0.587972, -0.586018, -0.584065, -0.582112, -0.580158,
-    -0.578205, -0.576251, -0.574298, -0.572345, -0.570391, -0.568438,
-    -0.566485, -0.564531, -0.562578, -0.560624, -0.558671, -0.556718,
-    -0.554764, -0.552811, -0.550857, -0.548904, -0.54695, -0.544997,
-    -0.543044, -0.54109, -0.539137, -0.537183, -0.53523, -0.533277,
-    -0.531323, -0.52937, -0.527417, -0.525463, -0.52351, -0.521556,
-    -0.519603, -0.51765, -0.515696, -0.513743, -0.511789, -0.509836,
-    -0.507883, -0.505929, -0.503976, -0.502022, -0.500069, -0.498116,
-    -0.496162, -0.494209, -0.492255, -0.490302, -0.488349, -0.486395,
-    -0.484442, -0.482488, -0.480535, -0.478582, -0.476628, -0.474675,
-    -0.472722, -0.470768, -0.468815, -0.466861, -0.464908, -0.462955,
-    -0.461001, -0.459048, -0.457094, -0.455141, -0.453188, -0.451234,
-    -0.449281, -0.447327, -0.445374, -0.443421, -0.441467, -0.439514,
-    -0.43756, -0.435607, -0.433654, -0.4317, -0.429747, -0.427793,
-    -0.42584, -0.423887, -0.421933, -0.41998, -0.418027, -0.416073,
-    -0.41412, -0.412166, -0.410213, -0.40826, -0.406306, -0.404353,
-    -0.402399, -0.400446, -0.398492, -0.396539, -0.394586, -0.392632,
-    -0.390679, -0.388725, -0.386772, -0.384819, -0.382865, -0.380912,
-    -0.378959, -0.377005, -0.375052, -0.373098, -0.371145, -0.369192,
-    -0.367238, -0.365285, -0.363331, -0.361378, -0.359425, -0.357471,
-    -0.355518, -0.353564, -0.351611, -0.349658, -0.347704, -0.345751,
-    -0.343797, -0.341844, -0.339891, -0.337937, -0.335984, -0.33403,
-    -0.332077, -0.330124, -0.32817, -0.326217, -0.324264, -0.32231,
-    -0.320357, -0.318403, -0.31645, -0.314497, -0.312543, -0.31059,
-    -0.308636, -0.306683, -0.30473, -0.302776, -0.300823, -0.298869,
-    -0.296916, -0.294963, -0.293009, -0.291056, -0.289102, -0.287149,
-    -0.285196, -0.283242, -0.281289, -0.279335, -0.277382, -0.275429,
-    -0.273475, -0.271522, -0.269569, -0.267615, -0.265662, -0.263708,
-    -0.261755, -0.259802, -0.257848, -0.255895, -0.253941, -0.251988,
-    -0.250035, -0.248081, -0.246128, -0.244174, -0.242221, -0.240267,
-    -0.238314, -0.236361, -0.234407, -0.232454, -0.230501, -0.228547,
-    -0.226594, -0.22464, -0.222687, -0.220734, -0.21878, -0.216827,
-    -0.214873, -0.21292, -0.210967, -0.209013, -0.20706, -0.205106,
-    -0.203153, -0.2012, -0.199246, -0.197293, -0.195339, -0.193386,
-    -0.191433, -0.189479, -0.187526, -0.185572, -0.183619, -0.181666,
-    -0.179712, -0.177759, -0.175806, -0.173852, -0.171899, -0.169945,
-    -0.167992, -0.166039, -0.164085, -0.162132, -0.160178, -0.158225,
-    -0.156272, -0.154318, -0.152365, -0.150411, -0.148458, -0.146505,
-    -0.144551, -0.142598, -0.140644, -0.138691, -0.136738, -0.134784,
-    -0.132831, -0.130877, -0.128924, -0.126971, -0.125017, -0.123064,
-    -0.121111, -0.119157, -0.117204, -0.11525, -0.113297, -0.111344,
-    -0.10939, -0.107437, -0.105483, -0.10353, -0.101577, -0.0996231,
-    -0.0976698, -0.0957163, -0.093763, -0.0918095, -0.0898562, -0.0879028,
-    -0.0859493, -0.083996, -0.0820425, -0.0800892, -0.0781357, -0.0761824,
-    -0.074229, -0.0722756, -0.0703222, -0.0683688, -0.0664155, -0.064462,
-    -0.0625087, -0.0605552, -0.0586018, -0.0566485, -0.054695, -0.0527417,
-    -0.0507882, -0.0488349, -0.0468814, -0.0449281, -0.0429747, -0.0410213,
-    -0.0390679, -0.0371145, -0.0351611, -0.0332077, -0.0312543, -0.0293009,
-    -0.0273475, -0.0253942, -0.0234407, -0.0214874, -0.0195339, -0.0175806,
-    -0.0156271, -0.0136738, -0.0117204, -0.00976693, -0.00781363, -0.00586014,
-    -0.00390682, -0.00195338
-};
-
-static const float WAVE_TRIANGLE_006[DEFAULT_WAVELEN] = {
-    0, 0.0019535, 0.003907, 0.0058605, 0.00781399, 0.00976749,
-    0.011721, 0.0136745, 0.015628, 0.0175815, 0.019535, 0.0214885,
-    0.023442, 0.0253955, 0.027349, 0.0293025, 0.031256, 0.0332095,
-    0.035163, 0.0371165, 0.03907, 0.0410235, 0.0429771, 0.0449306,
-    0.0468841, 0.0488376, 0.0507911, 0.0527446, 0.0546981, 0.0566516,
-    0.0586051, 0.0605587, 0.0625122, 0.0644657, 0.0664192, 0.0683727,
-    0.0703262, 0.0722797, 0.0742333, 0.0761868, 0.0781403, 0.0800938,
-    0.0820473, 0.0840008, 0.0859543, 0.0879078, 0.0898614, 0.0918149,
-    0.0937684, 0.0957219, 0.0976754, 0.0996289, 0.101582, 0.103536,
-    0.105489, 0.107443, 0.109396, 0.11135, 0.113303, 0.115257,
-    0.11721, 0.119164, 0.121117, 0.123071, 0.125024, 0.126978,
-    0.128931, 0.130885, 0.132838, 0.134792, 0.136745, 0.138699,
-    0.140652, 0.142606, 0.144559, 0.146513, 0.148466, 0.15042,
-    0.152373, 0.154327, 0.15628, 0.158234, 0.160187, 0.162141,
-    0.164094, 0.166048, 0.168001, 0.169955, 0.171908, 0.173862,
-    0.175815, 0.177769, 0.179722, 0.181676, 0.18363, 0.185583,
-    0.187537, 0.18949, 0.191444, 0.193397, 0.195351, 0.197304,
-    0.199258, 0.201211, 0.203165, 0.205118, 0.207072, 0.209025,
-    0.210979, 0.212932, 0.214886, 0.216839, 0.218793, 0.220746,
-    0.2227, 0.224653, 0.226607, 0.22856, 0.230514, 0.232467,
-    0.234421, 0.236374, 0.238328, 0.240281, 0.242235, 0.244188,
-    0.246142, 0.248095, 0.250049, 0.252002, 0.253956, 0.255909,
-    0.257863, 0.259816, 0.26177, 0.263723, 0.265677, 0.26763,
-    0.269584, 0.271537, 0.273491, 0.275444, 0.277398, 0.279351,
-    0.281305, 0.283258, 0.285212, 0.287165, 0.289119, 0.291072,
-    0.293026, 0.294979, 0.296933, 0.298886, 0.30084, 0.302793,
-    0.304747, 0.3067, 0.308654, 0.310607, 0.312561, 0.314514,
-    0.316468, 0.318421, 0.320375, 0.322328, 0.324282, 0.326235,
-    0.328189, 0.330142, 0.332096, 0.334049, 0.336003, 0.337957,
-    0.33991, 0.341864, 0.343817, 0.345771, 0.347724, 0.349678,
-    0.351631, 0.353585, 0.355538, 0.357492, 0.359445, 0.361399,
-    0.363352, 0.365306, 0.367259, 0.369213, 0.371166, 0.37312,
-    0.375073, 0.377027, 0.37898, 0.380934, 0.382887, 0.384841,
-    0.386794, 0.388748, 0.390701, 0.392655, 0.394608, 0.396562,
-    0.398515, 0.400469, 0.402422, 0.404376, 0.406329, 0.408283,
-    0.410236, 0.41219, 0.414143, 0.416097, 0.41805, 0.420004,
-    0.421957, 0.423911, 0.425864, 0.427818, 0.429771, 0.431725,
-    0.433678, 0.435632, 0.437585, 0.439539, 0.441492, 0.443446,
-    0.445399, 0.447353, 0.449306, 0.45126, 0.453213, 0.455167,
-    0.45712, 0.459074, 0.461027, 0.462981, 0.464934, 0.466888,
-    0.468841, 0.470795, 0.472748, 0.474702, 0.476655, 0.478609,
-    0.480562, 0.482516, 0.484469, 0.486423, 0.488377, 0.49033,
-    0.492284, 0.494237, 0.496191, 0.498144, 0.500098, 0.502051,
-    0.504005, 0.505958, 0.507912, 0.509865, 0.511819, 0.513772,
-    0.515726, 0.517679, 0.519633, 0.521586, 0.52354, 0.525493,
-    0.527447, 0.5294, 0.531354, 0.533307, 0.535261, 0.537214,
-    0.539168, 0.541121, 0.543075, 0.545028, 0.546982, 0.548935,
-    0.550889, 0.552842, 0.554796, 0.556749, 0.558703, 0.560656,
-    0.56261, 0.564563, 0.566517, 0.56847, 0.570424, 0.572377,
-    0.574331, 0.576284, 0.578238, 0.580191, 0.582145, 0.584098,
-    0.586052, 0.588005, 0.589959, 0.591912, 0.593866, 0.595819,
-    0.597773, 0.599726, 0.60168, 0.603633, 0.605587, 0.60754,
-    0.609494, 0.611447, 0.613401, 0.615354, 0.617308, 0.619261,
-    0.621215, 0.623168, 0.625122, 0.627075, 0.629029, 0.630982,
-    0.632936, 0.63489, 0.636843, 0.638797, 0.64075, 0.642704,
-    0.644657, 0.646611, 0.648564, 0.650518, 0.652471, 0.654425,
-    0.656378, 0.658332, 0.660285, 0.662239, 0.664192, 0.666146,
-    0.668099, 0.670053, 0.672006, 0.67396, 0.675913, 0.677867,
-    0.67982, 0.681774, 0.683727, 0.685681, 0.687634, 0.689588,
-    0.691541, 0.693495, 0.695448, 0.697402, 0.699355, 0.701309,
-    0.703262, 0.705216, 0.707169, 0.709123, 0.711076, 0.71303,
-    0.714983, 0.716937, 0.71889, 0.720844, 0.722797, 0.724751,
-    0.726704, 0.728658, 0.730611, 0.732565, 0.734518, 0.736472,
-    0.738425, 0.740379, 0.742332, 0.744286, 0.746239, 0.748193,
-    0.750146, 0.7521, 0.754053, 0.756007, 0.75796, 0.759914,
-    0.761867, 0.763821, 0.765774, 0.767728, 0.769681, 0.771635,
-    0.773588, 0.775542, 0.777495, 0.779449, 0.781402, 0.783356,
-    0.78531, 0.787263, 0.789217, 0.79117, 0.793124, 0.795077,
-    0.797031, 0.798984, 0.800938, 0.802891, 0.804845, 0.806798,
-    0.808752, 0.810705, 0.812659, 0.814612, 0.816566, 0.81852,
-    0.820473, 0.822427, 0.82438, 0.826334, 0.828287, 0.830241,
-    0.832194, 0.834148, 0.836101, 0.838055, 0.840008, 0.841961,
-    0.843915, 0.845868, 0.847822, 0.849775, 0.851729, 0.853682,
-    0.855636, 0.857589, 0.859543, 0.861496, 0.86345, 0.865403,
-    0.867357, 0.86931, 0.871264, 0.873217, 0.875171, 0.877124,
-    0.879077, 0.881031, 0.882984, 0.884938, 0.886891, 0.888845,
-    0.890798, 0.892752, 0.894705, 0.896659, 0.898612, 0.900566,
-    0.902519, 0.904473, 0.906426, 0.90838, 0.910333, 0.912287,
-    0.914241, 0.916194, 0.918148, 0.920101, 0.922055, 0.924008,
-    0.925962, 0.927916, 0.929869, 0.931823, 0.933776, 0.93573,
-    0.937683, 0.939637, 0.941591, 0.943544, 0.945498, 0.947451,
-    0.949405, 0.951359, 0.953312, 0.955266, 0.957219, 0.959173,
-    0.961127, 0.96308, 0.965034, 0.966987, 0.968941, 0.970895,
-    0.972848, 0.974802, 0.976755, 0.978709, 0.980662, 0.982616,
-    0.98457, 0.986523, 0.988477, 0.99043, 0.992383, 0.994336,
-    0.996289, 0.998236, 1, 0.998236, 0.996289, 0.994336,
-    0.992383, 0.99043, 0.988477, 0.986523, 0.98457, 0.982616,
-    0.980662, 0.978709, 0.976755, 0.974802, 0.972848, 0.970895,
-    0.968941, 0.966987, 0.965034, 0.96308, 0.961127, 0.959173,
-    0.957219, 0.955266, 0.953312, 0.951359, 0.949405, 0.947451,
-    0.945498, 0.943544, 0.941591, 0.939637, 0.937683, 0.93573,
-    0.933776, 0.931823, 0.929869, 0.927916, 0.925962, 0.924008,
-    0.922055, 0.920101, 0.918148, 0.916194, 0.914241, 0.912287,
-    0.910333, 0.90838, 0.906426, 0.904473, 0.902519, 0.900566,
-    0.898612, 0.896659, 0.894705, 0.892752, 0.890798, 0.888845,
-    0.886891, 0.884938, 0.882984, 0.881031, 0.879077, 0.877124,
-    0.875171, 0.873217, 0.871264, 0.86931, 0.867357, 0.865403,
-    0.86345, 0.861496, 0.859543, 0.857589, 0.855636, 0.853682,
-    0.851729, 0.849775, 0.847822, 0.845868, 0.843915, 0.841961,
-    0.840008, 0.838055, 0.836101, 0.834148, 0.832194, 0.830241,
-    0.828287, 0.826334, 0.82438, 0.822427, 0.820473, 0.81852,
-    0.816566, 0.814612, 0.812659, 0.810705, 0.808752, 0.806798,
-    0.804845, 0.802891, 0.800938, 0.798984, 0.797031, 0.795077,
-    0.793124, 0.79117, 0.789217, 0.787263, 0.78531, 0.783356,
-    0.781402, 0.779449, 0.777495, 0.775542, 0.773588, 0.771635,
-    0.769681, 0.767728, 0.765774, 0.763821, 0.761867, 0.759914,
-    0.75796, 0.756007, 0.754053, 0.7521, 0.750146, 0.748193,
-    0.746239, 0.744286, 0.742332, 0.740379, 0.738425, 0.736472,
-    0.734518, 0.732565, 0.730611, 0.728658, 0.726704, 0.724751,
-    0.722797, 0.720844, 0.71889, 0.716937, 0.714983, 0.71303,
-    0.711076, 0.709123, 0.707169, 0.705216, 0.703262, 0.701309,
-    0.699355, 0.697402, 0.695448, 0.693495, 0.691541, 0.689588,
-    0.687634, 0.685681, 0.683727, 0.681774, 0.67982, 0.677867,
-    0.675913, 0.67396, 0.672006, 0.670053, 0.668099, 0.666146,
-    0.664192, 0.662239, 0.660285, 0.658332, 0.656378, 0.654425,
-    0.652471, 0.650518, 0.648564, 0.646611, 0.644657, 0.642704,
-    0.64075, 0.638797, 0.636843, 0.63489, 0.632936, 0.630982,
-    0.629029, 0.627075, 0.625122, 0.623168, 0.621215, 0.619261,
-    0.617308, 0.615354, 0.613401, 0.611447, 0.609494, 0.60754,
-    0.605587, 0.603633, 0.60168, 0.599726, 0.597773, 0.595819,
-    0.593866, 0.591912, 0.589959, 0.588005, 0.586052, 0.584098,
-    0.582145, 0.580191, 0.578238, 0.576284, 0.574331, 0.572377,
-    0.570424, 0.56847, 0.566517, 0.564563, 0.56261, 0.560656,
-    0.558703, 0.556749, 0.554796, 0.552842, 0.550889, 0.548935,
-    0.546982, 0.545028, 0.543075, 0.541121, 0.539168, 0.537214,
-    0.535261, 0.533307, 0.531354, 0.5294, 0.527447, 0.525493,
-    0.52354, 0.521586, 0.519633, 0.517679, 0.515726, 0.513772,
-    0.511819, 0.509865, 0.507912, 0.505958, 0.504005, 0.502051,
-    0.500098, 0.498144, 0.496191, 0.494237, 0.492284, 0.49033,
-    0.488377, 0.486423, 0.484469, 0.482516, 0.480562, 0.478609,
-    0.476655, 0.474702, 0.472748, 0.470795, 0.468841, 0.466888,
-    0.464934, 0.462981, 0.461027, 0.459074, 0.45712, 0.455167,
-    0.453213, 0.45126, 0.449306, 0.447353, 0.445399, 0.443446,
-    0.441492, 0.439539, 0.437585, 0.435632, 0.433678, 0.431725,
-    0.429771, 0.427818, 0.425864, 0.423911, 0.421957, 0.420004,
-    0.41805, 0.416097, 0.414143, 0.41219, 0.410236, 0.408283,
-    0.406329, 0.404376, 0.402422, 0.400469, 0.398515, 0.396562,
-    0.394608, 0.392655, 0.390701, 0.388748, 0.386794, 0.384841,
-    0.382887, 0.380934, 0.37898, 0.377027, 0.375073, 0.37312,
-    0.371166, 0.369213, 0.367259, 0.365306, 0.363352, 0.361399,
-    0.359445, 0.357492, 0.355538, 0.353585, 0.351631, 0.349678,
-    0.347724, 0.345771, 0.343817, 0.341864, 0.33991, 0.337957,
-    0.336003, 0.334049, 0.332096, 0.330142, 0.328189, 0.326235,
-    0.324282, 0.322328, 0.320375, 0.318421, 0.316468, 0.314514,
-    0.312561, 0.310607, 0.308654, 0.3067, 0.304747, 0.302793,
-    0.30084, 0.298886, 0.296933, 0.294979, 0.293026, 0.291072,
-    0.289119, 0.287165, 0.285212, 0.283258, 0.281305, 0.279351,
-    0.277398, 0.275444, 0.273491, 0.271537, 0.269584, 0.26763,
-    0.265677, 0.263723, 0.26177, 0.259816, 0.257863, 0.255909,
-    0.253956, 0.252002, 0.250049, 0.248095, 0.246142, 0.244188,
-    0.242235, 0.240281, 0.238328, 0.236374, 0.234421, 0.232467,
-    0.230514, 0.22856, 0.226607, 0.224653, 0.2227, 0.220746,
-    0.218793, 0.216839, 0.214886, 0.212932, 0.210979, 0.209025,
-    0.207072, 0.205118, 0.203165, 0.201211, 0.199258, 0.197304,
-    0.195351, 0.193397, 0.191444, 0.18949, 0.187537, 0.185583,
-    0.18363, 0.181676, 0.179722, 0.177769, 0.175815, 0.173862,
-    0.171908, 0.169955, 0.168001, 0.166048, 0.164094, 0.162141,
-    0.160187, 0.158234, 0.15628, 0.154327, 0.152373, 0.15042,
-    0.148466, 0.146513, 0.144559, 0.142606, 0.140652, 0.138699,
-    0.136745, 0.134792, 0.132838, 0.130885, 0.128931, 0.126978,
-    0.125024, 0.123071, 0.121117, 0.119164, 0.11721, 0.115257,
-    0.113303, 0.11135, 0.109396, 0.107443, 0.105489, 0.103536,
-    0.101582, 0.0996289, 0.0976754, 0.0957219, 0.0937684, 0.0918149,
-    0.0898614, 0.0879078, 0.0859543, 0.0840008, 0.0820473, 0.0800938,
-    0.0781403, 0.0761868, 0.0742333, 0.0722797, 0.0703262, 0.0683727,
-    0.0664192, 0.0644657, 0.0625122, 0.0605587, 0.0586051, 0.0566516,
-    0.0546981, 0.0527446, 0.0507911, 0.0488376, 0.0468841, 0.0449306,
-    0.0429771, 0.0410235, 0.03907, 0.0371165, 0.035163, 0.0332095,
-    0.031256, 0.0293025, 0.027349, 0.0253955, 0.023442, 0.0214885,
-    0.019535, 0.0175815, 0.015628, 0.0136745, 0.011721, 0.00976749,
-    0.00781399, 0.0058605, 0.003907, 0.0019535, 0, -0.0019535,
-    -0.003907, -0.0058605, -0.00781399, -0.00976749, -0.011721, -0.0136745,
-    -0.015628, -0.0175815, -0.019535, -0.0214885, -0.023442, -0.0253955,
-    -0.027349, -0.0293025, -0.031256, -0.0332095, -0.035163, -0.0371165,
-    -0.03907, -0.0410235, -0.0429771, -0.0449306, -0.0468841, -0.0488376,
-    -0.0507911, -0.0527446, -0.0546981, -0.0566516, -0.0586051, -0.0605587,
-    -0.0625122, -0.0644657, -0.0664192, -0.0683727, -0.0703262, -0.0722797,
-    -0.0742333, -0.0761868, -0.0781403, -0.0800938, -0.0820473, -0.0840008,
-    -0.0859543, -0.0879078, -0.0898614, -0.0918149, -0.0937684, -0.0957219,
-    -0.0976754, -0.0996289, -0.101582, -0.103536, -0.105489, -0.107443,
-    -0.109396, -0.11135, -0.113303, -0.115257, -0.11721, -0.119164,
-    -0.121117, -0.123071, -0.125024, -0.126978, -0.128931, -0.130885,
-    -0.132838, -0.134792, -0.136745, -0.138699, -0.140652, -0.142606,
-    -0.144559, -0.146513, -0.148466, -0.15042, -0.152373, -0.154327,
-    -0.15628, -0.158234, -0.160187, -0.162141, -0.164094, -0.166048,
-    -0.168001, -0.169955, -0.171908, -0.173862, -0.175815, -0.177769,
-    -0.179722, -0.181676, -0.18363, -0.185583, -0.187537, -0.18949,
-    -0.191444, -0.193397, -0.195351, -0.197304, -0.199258, -0.201211,
-    -0.203165, -0.205118, -0.207072, -0.209025, -0.210979, -0.212932,
-    -0.214886, -0.216839, -0.218793, -0.220746, -0.2227, -0.224653,
-    -0.226607, -0.22856, -0.230514, -0.232467, -0.234421, -0.236374,
-    -0.238328, -0.240281, -0.242235, -0.244188, -0.246142, -0.248095,
-    -0.250049, -0.252002, -0.253956, -0.255909, -0.257863, -0.259816,
-    -0.26177, -0.263723, -0.265677, -0.26763, -0.269584, -0.271537,
-    -0.273491, -0.275444, -0.277398, -0.279351, -0.281305, -0.283258,
-    -0.285212, -0.287165, -0.289119, -0.291072, -0.293026, -0.294979,
-    -0.296933, -0.298886, -0.30084, -0.302793, -0.304747, -0.3067,
-    -0.308654, -0.310607, -0.312561, -0.314514, -0.316468, -0.318421,
-    -0.320375, -0.322328, -0.324282, -0.326235, -0.328189, -0.330142,
-    -0.332096, -0.334049, -0.336003, -0.337957, -0.33991, -0.341864,
-    -0.343817, -0.345771, -0.347724, -0.349678, -0.351631, -0.353585,
-    -0.355538, -0.357492, -0.359445, -0.361399, -0.363352, -0.365306,
-    -0.367259, -0.369213, -0.371166, -0.37312, -0.375073, -0.377027,
-    -0.37898, -0.380934, -0.382887, -0.384841, -0.386794, -0.388748,
-    -0.390701, -0.392655, -0.394608, -0.396562, -0.398515, -0.400469,
-    -0.402422, -0.404376, -0.406329, -0.408283, -0.410236, -0.41219,
-    -0.414143, -0.416097, -0.41805, -0.420004, -0.421957, -0.423911,
-    -0.425864, -0.427818, -0.429771, -0.431725, -0.433678, -0.435632,
-    -0.437585, -0.439539, -0.441492, -0.443446, -0.445399, -0.447353,
-    -0.449306, -0.45126, -0.453213, -0.455167, -0.45712, -0.459074,
-    -0.461027, -0.462981, -0.464934, -0.466888, -0.468841, -0.470795,
-    -0.472748, -0.474702, -0.476655, -0.478609, -0.480562, -0.482516,
-    -0.484469, -0.486423, -0.488377, -0.49033, -0.492284, -0.494237,
-    -0.496191, -0.498144, -0.500098, -0.502051, -0.504005, -0.505958,
-    -0.507912, -0.509865, -0.511819, -0.513772, -0.515726, -0.517679,
-    -0.519633, -0.521586, -0.52354, -0.525493, -0.527447, -0.5294,
-    -0.531354, -0.533307, -0.535261, -0.537214, -0.539168, -0.541121,
-    -0.543075, -0.545028, -0.546982, -0.548935, -0.550889, -0.552842,
-    -0.554796, -0.556749, -0.558703, -0.560656, -0.56261, -0.564563,
-    -0.566517, -0.56847, -0.570424, -0.572377, -0.574331, -0.576284,
-    -0.578238, -0.580191, -0.582145, -0.584098, -0.586052, -0.588005,
-    -0.589959, -0.591912, -0.593866, -0.595819, -0.597773, -0.599726,
-    -0.60168, -0.603633, -0.605587, -0.60754, -0.609494, -0.611447,
-    -0.613401, -0.615354, -0.617308, -0.619261, -0.621215, -0.623168,
-    -0.625122, -0.627075, -0.629029, -0.630982, -0.632936, -0.63489,
-    -0.636843, -0.638797, -0.64075, -0.642704, -0.644657, -0.646611,
-    -0.648564, -0.650518, -0.652471, -0.654425, -0.656378, -0.658332,
-    -0.660285, -0.662239, -0.664192, -0.666146, -0.668099, -0.670053,
-    -0.672006, -0.67396, -0.675913, -0.677867, -0.67982, -0.681774,
-    -0.683727, -0.685681, -0.687634, -0.689588, -0.691541, -0.693495,
-    -0.695448, -0.697402, -0.699355, -0.701309, -0.703262, -0.705216,
-    -0.707169, -0.709123, -0.711076, -0.71303, -0.714983, -0.716937,
-    -0.71889, -0.720844, -0.722797, -0.724751, -0.726704, -0.728658,
-    -0.730611, -0.732565, -0.734518, -0.736472, -0.738425, -0.740379,
-    -0.742332, -0.744286, -0.746239, -0.748193, -0.750146, -0.7521,
-    -0.754053, -0.756007, -0.75796, -0.759914, -0.761867, -0.763821,
-    -0.765774, -0.767728, -0.769681, -0.771635, -0.773588, -0.775542,
-    -0.777495, -0.779449, -0.781402, -0.783356, -0.78531, -0.787263,
-    -0.789217, -0.79117, -0.793124, -0.795077, -0.797031, -0.798984,
-    -0.800938, -0.802891, -0.804845, -0.806798, -0.808752, -0.810705,
-    -0.812659, -0.814612, -0.816566, -0.81852, -0.820473, -0.822427,
-    -0.82438, -0.826334, -0.828287, -0.830241, -0.832194, -0.834148,
-    -0.836101, -0.838055, -0.840008, -0.841961, -0.843915, -0.845868,
-    -0.847822, -0.849775, -0.851729, -0.853682, -0.855636, -0.857589,
-    -0.859543, -0.861496, -0.86345, -0.865403, -0.867357, -0.86931,
-    -0.871264, -0.873217, -0.875171, -0.877124, -0.879077, -0.881031,
-    -0.882984, -0.884938, -0.886891, -0.888845, -0.890798, -0.892752,
-    -0.894705, -0.896659, -0.898612, -0.900566, -0.902519, -0.904473,
-    -0.906426, -0.90838, -0.910333, -0.912287, -0.914241, -0.916194,
-    -0.918148, -0.920101, -0.922055, -0.924008, -0.925962, -0.927916,
-    -0.929869, -0.931823, -0.933776, -0.93573, -0.937683, -0.939637,
-    -0.941591, -0.943544, -0.945498, -0.947451, -0.949405, -0.951359,
-    -0.953312, -0.955266, -0.957219, -0.959173, -0.961127, -0.96308,
-    -0.965034, -0.966987, -0.968941, -0.970895, -0.972848, -0.974802,
-    -0.976755, -0.978709, -0.980662, -0.982616, -0.98457, -0.986523,
-    -0.988477, -0.99043, -0.992383, -0.994336, -0.996289, -0.998236,
-    -1, -0.998236, -0.996289, -0.994336, -0.992383, -0.99043,
-    -0.988477, -0.986523, -0.98457, -0.982616, -0.980662, -0.978709,
-    -0.976755, -0.974802, -0.972848, -0.970895, -0.968941, -0.966987,
-    -0.965034, -0.96308, -0.961127, -0.959173, -0.957219, -0.955266,
-    -0.953312, -0.951359, -0.949405, -0.947451, -0.945498, -0.943544,
-    -0.941591, -0.939637, -0.937683, -0.93573, -0.933776, -0.931823,
-    -0.929869, -0.927916, -0.925962, -0.924008, -0.922055, -0.920101,
-    -0.918148, -0.916194, -0.914241, -0.912287, -0.910333, -0.90838,
-    -0.906426, -0.904473, -0.902519, -0.900566, -0.898612, -0.896659,
-    -0.894705, -0.892752, -0.890798, -0.888845, -0.886891, -0.884938,
-    -0.882984, -0.881031, -0.879077, -0.877124, -0.875171, -0.873217,
-    -0.871264, -0.86931, -0.867357, -0.865403, -0.86345, -0.861496,
-    -0.859543, -0.857589, -0.855636, -0.853682, -0.851729, -0.849775,
-    -0.847822, -0.845868, -0.843915, -0.841961, -0.840008, -0.838055,
-    -0.836101, -0.834148, -0.832194, -0.830241, -0.828287, -0.826334,
-    -0.82438, -0.822427, -0.820473, -0.81852, -0.816566, -0.814612,
-    -0.812659, -0.810705, -0.808752, -0.806798, -0.804845, -0.802891,
-    -0.800938, -0.798984, -0.797031, -0.795077, -0.793124, -0.79117,
-    -0.789217, -0.787263, -0.78531, -0.783356, -0.781402, -0.779449,
-    -0.777495, -0.775542, -0.773588, -0.771635, -0.769681, -0.767728,
-    -0.765774, -0.763821, -0.761867, -0.759914, -0.75796, -0.756007,
-    -0.754053, -0.7521, -0.750146, -0.748193, -0.746239, -0.744286,
-    -0.742332, -0.740379, -0.738425, -0.736472, -0.734518, -0.732565,
-    -0.730611, -0.728658, -0.726704, -0.724751, -0.722797, -0.720844,
-    -0.71889, -0.716937, -0.714983, -0.71303, -0.711076, -0.709123,
-    -0.707169, -0.705216, -0.703262, -0.701309, -0.699355, -0.697402,
-    -0.695448, -0.693495, -0.691541, -0.689588, -0.687634, -0.685681,
-    -0.683727, -0.681774, -0.67982, -0.677867, -0.675913, -0.67396,
-    -0.672006, -0.670053, -0.668099, -0.666146, -0.664192, -0.662239,
-    -0.660285, -0.658332, -0.656378, -0.654425, -0.652471, -0.650518,
-    -0.648564, -0.646611, -0.644657, -0.642704, -0.64075, -0.638797,
-    -0.636843, -0.63489, -0.632936, -0.630982, -0.629029, -0.627075,
-    -0.625122, -0.623168, -0.621215, -0.619261, -0.617308, -0.615354,
-    -0.613401, -0.611447, -0.609494, -0.60754, -0.605587, -0.603633,
-    -0.60168, -0.599726, -0.597773, -0.595819, -0.593866, -0.591912,
-    -0.589959, -0.588005, -0.586052, -0.584098, -0.582145, -0.580191,
-    -0.578238, -0.576284, -0.574331, -0.572377, -0.570424, -0.56847,
-    -0.566517, -0.564563, -0.56261, -0.560656, -0.558703, -0.556749,
-    -0.554796, -0.552842, -0.550889, -0.548935, -0.546982, -0.545028,
-    -0.543075, -0.541121, -0.539168, -0.537214, -0.535261, -0.533307,
-    -0.531354, -0.5294, -0.527447, -0.525493, -0.52354, -0.521586,
-    -0.519633, -0.517679, -0.515726, -0.513772, -0.511819, -0.509865,
-    -0.507912, -0.505958, -0.504005, -0.502051, -0.500098, -0.498144,
-    -0.496191, -0.494237, -0.492284, -0.49033, -0.488377, -0.486423,
-    -0.484469, -0.482516, -0.480562, -0.478609, -0.476655, -0.474702,
-    -0.472748, -0.470795, -0.468841, -0.466888, -0.464934, -0.462981,
-    -0.461027, -0.459074, -0.45712, -0.455167, -0.453213, -0.45126,
-    -0.449306, -0.447353, -0.445399, -0.443446, -0.441492, -0.439539,
-    -0.437585, -0.435632, -0.433678, -0.431725, -0.429771, -0.427818,
-    -0.425864, -0.423911, -0.421957, -0.420004, -0.41805, -0.416097,
-    -0.414143, -0.41219, -0.410236, -0.408283, -0.406329, -0.404376,
-    -0.402422, -0.400469, -0.398515, -0.396562, -0.394608, -0.392655,
-    -0.390701, -0.388748, -0.386794, -0.384841, -0.382887, -0.380934,
-    -0.37898, -0.377027, -0.375073, -0.37312, -0.371166, -0.369213,
-    -0.367259, -0.365306, -0.363352, -0.361399, -0.359445, -0.357492,
-    -0.355538, -0.353585, -0.351631, -0.349678, -0.347724, -0.345771,
-    -0.343817, -0.341864, -0.33991, -0.337957, -0.336003, -0.334049,
-    -0.332096, -0.330142, -0.328189, -0.326235, -0.324282, -0.322328,
-    -0.320375, -0.318421, -0.316468, -0.314514, -0.312561, -0.310607,
-    -0.308654, -0.3067, -0.304747, -0.302793, -0.30084, -0.298886,
-    -0.296933, -0.294979, -0.293026, -0.291072, -0.289119, -0.287165,
-    -0.285212, -0.283258, -0.281305, -0.279351, -0.277398, -0.275444,
-    -0.273491, -0.271537, -0.269584, -0.26763, -0.265677, -0.263723,
-    -0.26177, -0.259816, -0.257863, -0.255909, -0.253956, -0.252002,
-    -0.250049, -0.248095, -0.246142, -0.244188, -0.242235, -0.240281,
-    -0.238328, -0.236374, -0.234421, -0.232467, -0.230514, -0.22856,
-    -0.226607, -0.224653, -0.2227, -0.220746, -0.218793, -0.216839,
-    -0.214886, -0.212932, -0.210979, -0.209025, -0.207072, -0.205118,
-    -0.203165, -0.201211, -0.199258, -0.197304, -0.195351, -0.193397,
-    -0.191444, -0.18949, -0.187537, -0.185583, -0.18363, -0.181676,
-    -0.179722, -0.177769, -0.175815, -0.173862, -0.171908, -0.169955,
-    -0.168001, -0.166048, -0.164094, -0.162141, -0.160187, -0.158234,
-    -0.15628, -0.154327, -0.152373, -0.15042, -0.148466, -0.146513,
-    -0.144559, -0.142606, -0.140652, -0.138699, -0.136745, -0.134792,
-    -0.132838, -0.130885, -0.128931, -0.126978, -0.125024, -0.123071,
-    -0.121117, -0.119164, -0.11721, -0.115257, -0.113303, -0.11135,
-    -0.109396, -0.107443, -0.105489, -0.103536, -0.101582, -0.0996289,
-    -0.0976754, -0.0957219, -0.0937684, -0.0918149, -0.0898614, -0.0879078,
-    -0.0859543, -0.0840008, -0.0820473, -0.0800938, -0.0781403, -0.0761868,
-    -0.0742333, -0.0722797, -0.0703262, -0.0683727, -0.0664192, -0.0644657,
-    -0.0625122, -0.0605587, -0.0586051, -0.0566516, -0.0546981, -0.0527446,
-    -0.0507911, -0.0488376, -0.0468841, -0.0449306, -0.0429771, -0.0410235,
-    -0.03907, -0.0371165, -0.035163, -0.0332095, -0.031256, -0.0293025,
-    -0.027349, -0.0253955, -0.023442, -0.0214885, -0.019535, -0.0175815,
-    -0.015628, -0.0136745, -0.011721, -0.00976749, -0.00781399, -0.0058605,
-    -0.003907, -0.0019535
-};
-
-static const float WAVE_TRIANGLE_018[DEFAULT_WAVELEN] = {
-    0, 0.00195387, 0.00390781, 0.00586162, 0.00781562, 0.00976936,
-    0.0117234, 0.0136771, 0.0156312, 0.0175848, 0.019539, 0.0214926,
-    0.0234468, 0.0254003, 0.0273546, 0.0293081, 0.0312624, 0.0332158,
-    0.0351702, 0.0371236, 0.039078, 0.0410313, 0.0429858, 0.0449391,
-    0.0468936, 0.0488469, 0.0508014, 0.0527546, 0.0547092, 0.0566624,
-    0.058617, 0.0605702, 0.0625248, 0.0644779, 0.0664326, 0.0683857,
-    0.0703403, 0.0722935, 0.0742481, 0.0762013, 0.0781559, 0.080109,
-    0.0820637, 0.0840168, 0.0859714, 0.0879246, 0.0898792, 0.0918324,
-    0.093787, 0.0957402, 0.0976947, 0.099648, 0.101602, 0.103556,
-    0.10551, 0.107464, 0.109418, 0.111371, 0.113326, 0.115279,
-    0.117233, 0.119187, 0.121141, 0.123095, 0.125049, 0.127003,
-    0.128957, 0.13091, 0.132864, 0.134818, 0.136772, 0.138726,
-    0.14068, 0.142634, 0.144588, 0.146542, 0.148495, 0.150449,
-    0.152403, 0.154357, 0.156311, 0.158265, 0.160219, 0.162173,
-    0.164126, 0.166081, 0.168034, 0.169988, 0.171942, 0.173896,
-    0.17585, 0.177804, 0.179757, 0.181712, 0.183665, 0.18562,
-    0.187573, 0.189527, 0.191481, 0.193435, 0.195388, 0.197343,
-    0.199296, 0.201251, 0.203204, 0.205159, 0.207112, 0.209066,
-    0.211019, 0.212974, 0.214927, 0.216882, 0.218835, 0.22079,
-    0.222743, 0.224697, 0.226651, 0.228605, 0.230558, 0.232513,
-    0.234466, 0.236421, 0.238374, 0.240329, 0.242282, 0.244236,
-    0.24619, 0.248144, 0.250097, 0.252052, 0.254005, 0.25596,
-    0.257913, 0.259867, 0.261821, 0.263775, 0.265729, 0.267683,
-    0.269636, 0.271591, 0.273544, 0.275498, 0.277452, 0.279406,
-    0.28136, 0.283314, 0.285268, 0.287222, 0.289175, 0.291129,
-    0.293083, 0.295037, 0.296991, 0.298945, 0.300899, 0.302852,
-    0.304807, 0.30676, 0.308714, 0.310668, 0.312622, 0.314576,
-    0.31653, 0.318483, 0.320438, 0.322391, 0.324346, 0.326299,
-    0.328254, 0.330207, 0.332161, 0.334114, 0.336069, 0.338022,
-    0.339977, 0.34193, 0.343885, 0.345838, 0.347792, 0.349745,
-    0.3517, 0.353653, 0.355608, 0.357561, 0.359516, 0.361469,
-    0.363424, 0.365377, 0.367331, 0.369284, 0.371239, 0.373192,
-    0.375147, 0.3771, 0.379055, 0.381008, 0.382962, 0.384916,
-    0.38687, 0.388823, 0.390778, 0.392731, 0.394686, 0.396639,
-    0.398593, 0.400547, 0.402501, 0.404455, 0.406409, 0.408362,
-    0.410317, 0.41227, 0.414224, 0.416178, 0.418132, 0.420086,
-    0.42204, 0.423994, 0.425948, 0.427901, 0.429855, 0.431809,
-    0.433763, 0.435717, 0.437671, 0.439625, 0.441579, 0.443533,
-    0.445486, 0.447441, 0.449394, 0.451348, 0.453302, 0.455256,
-    0.457209, 0.459164, 0.461117, 0.463072, 0.465025, 0.46698,
-    0.468933, 0.470887, 0.47284, 0.474795, 0.476748, 0.478703,
-    0.480656, 0.482611, 0.484564, 0.486519, 0.488471, 0.490426,
-    0.492379, 0.494334, 0.496287, 0.498242, 0.500195, 0.50215,
-    0.504103, 0.506057, 0.50801, 0.509965, 0.511918, 0.513873,
-    0.515826, 0.517781, 0.519734, 0.521689, 0.523641, 0.525596,
-    0.527549, 0.529504, 0.531457, 0.533412, 0.535365, 0.53732,
-    0.539273, 0.541227, 0.54318, 0.545135, 0.547088, 0.549043,
-    0.550996, 0.552951, 0.554904, 0.556858, 0.558812, 0.560766,
-    0.56272, 0.564674, 0.566627, 0.568581, 0.570535, 0.572489,
-    0.574443, 0.576397, 0.578351, 0.580305, 0.582259, 0.584212,
-    0.586167, 0.58812, 0.590074, 0.592028, 0.593982, 0.595935,
-    0.59789, 0.599843, 0.601798, 0.603751, 0.605706, 0.607659,
-    0.609614, 0.611566, 0.613521, 0.615474, 0.617429, 0.619382,
-    0.621337, 0.62329, 0.625245, 0.627197, 0.629153, 0.631105,
-    0.63306, 0.635013, 0.636968, 0.638921, 0.640876, 0.642828,
-    0.644784, 0.646736, 0.648691, 0.650644, 0.652599, 0.654552,
-    0.656507, 0.65846, 0.660415, 0.662367, 0.664323, 0.666275,
-    0.66823, 0.670183, 0.672138, 0.674091, 0.676046, 0.677999,
-    0.679954, 0.681906, 0.683861, 0.685814, 0.687769, 0.689722,
-    0.691677, 0.69363, 0.695584, 0.697538, 0.699492, 0.701446,
-    0.7034, 0.705353, 0.707308, 0.709261, 0.711215, 0.713169,
-    0.715123, 0.717077, 0.719031, 0.720985, 0.722938, 0.724893,
-    0.726846, 0.7288, 0.730754, 0.732708, 0.734661, 0.736616,
-    0.738569, 0.740524, 0.742477, 0.744432, 0.746385, 0.74834,
-    0.750292, 0.752248, 0.7542, 0.756155, 0.758108, 0.760063,
-    0.762015, 0.763971, 0.765923, 0.767879, 0.769831, 0.771787,
-    0.773739, 0.775695, 0.777646, 0.779602, 0.781554, 0.78351,
-    0.785462, 0.787418, 0.78937, 0.791326, 0.793277, 0.795234,
-    0.797185, 0.799141, 0.801093, 0.803049, 0.805001, 0.806957,
-    0.808908, 0.810865, 0.812816, 0.814772, 0.816724, 0.81868,
-    0.820632, 0.822588, 0.82454, 0.826495, 0.828448, 0.830403,
-    0.832355, 0.834311, 0.836263, 0.838219, 0.840171, 0.842126,
-    0.844079, 0.846034, 0.847987, 0.849941, 0.851895, 0.853849,
-    0.855803, 0.857757, 0.859711, 0.861664, 0.863619, 0.865572,
-    0.867527, 0.86948, 0.871435, 0.873387, 0.875343, 0.877295,
-    0.87925, 0.881202, 0.883158, 0.88511, 0.887066, 0.889018,
-    0.890974, 0.892925, 0.894882, 0.896833, 0.89879, 0.90074,
-    0.902698, 0.904648, 0.906606, 0.908555, 0.910514, 0.912463,
-    0.914422, 0.916371, 0.91833, 0.920278, 0.922238, 0.924186,
-    0.926146, 0.928093, 0.930054, 0.932001, 0.933962, 0.935909,
-    0.93787, 0.939816, 0.941778, 0.943724, 0.945686, 0.947632,
-    0.949594, 0.951539, 0.953502, 0.955447, 0.957409, 0.959354,
-    0.961317, 0.963262, 0.965225, 0.96717, 0.969133, 0.971078,
-    0.973041, 0.974985, 0.976949, 0.978893, 0.980856, 0.982801,
-    0.984764, 0.98671, 0.98867, 0.990619, 0.992576, 0.994532,
-    0.996472, 0.998478, 1, 0.998478, 0.996472, 0.994532,
-    0.992576, 0.990619, 0.98867, 0.98671, 0.984764, 0.982801,
-    0.980856, 0.978893, 0.976949, 0.974985, 0.973041, 0.971078,
-    0.969133, 0.96717, 0.965225, 0.963262, 0.961317, 0.959354,
-    0.957409, 0.955447, 0.953502, 0.951539, 0.949594, 0.947632,
-    0.945686, 0.943724, 0.941778, 0.939816, 0.93787, 0.935909,
-    0.933962, 0.932001, 0.930054, 0.928093, 0.926146, 0.924186,
-    0.922238, 0.920278, 0.91833, 0.916371, 0.914422, 0.912463,
-    0.910514, 0.908555, 0.906606, 0.904648, 0.902698, 0.90074,
-    0.89879, 0.896833, 0.894882, 0.892925, 0.890974, 0.889018,
-    0.887066, 0.88511, 0.883158, 0.881202, 0.87925, 0.877295,
-    0.875343, 0.873387, 0.871435, 0.86948, 0.867527, 0.865572,
-    0.863619, 0.861664, 0.859711, 0.857757, 0.855803, 0.853849,
-    0.851895, 0.849941, 0.847987, 0.846034, 0.844079, 0.842126,
-    0.840171, 0.838219, 0.836263, 0.834311, 0.832355, 0.830403,
-    0.828448, 0.826495, 0.82454, 0.822588, 0.820632, 0.81868,
-    0.816724, 0.814772, 0.812816, 0.810865, 0.808908, 0.806957,
-    0.805001, 0.803049, 0.801093, 0.799141, 0.797185, 0.795234,
-    0.793277, 0.791326, 0.78937, 0.787418, 0.785462, 0.78351,
-    0.781554, 0.779602, 0.777646, 0.775695, 0.773739, 0.771787,
-    0.769831, 0.767879, 0.765923, 0.763971, 0.762015, 0.760063,
-    0.758108, 0.756155, 0.7542, 0.752248, 0.750292, 0.74834,
-    0.746385, 0.744432, 0.742477, 0.740524, 0.738569, 0.736616,
-    0.734661, 0.732708, 0.730754, 0.7288, 0.726846, 0.724893,
-    0.722938, 0.720985, 0.719031, 0.717077, 0.715123, 0.713169,
-    0.711215, 0.709261, 0.707308, 0.705353, 0.7034, 0.701446,
-    0.699492, 0.697538, 0.695584, 0.69363, 0.691677, 0.689722,
-    0.687769, 0.685814, 0.683861, 0.681906, 0.679954, 0.677999,
-    0.676046, 0.674091, 0.672138, 0.670183, 0.66823, 0.666275,
-    0.664323, 0.662367, 0.660415, 0.65846, 0.656507, 0.654552,
-    0.652599, 0.650644, 0.648691, 0.646736, 0.644784, 0.642828,
-    0.640876, 0.638921, 0.636968, 0.635013, 0.63306, 0.631105,
-    0.629153, 0.627197, 0.625245, 0.62329, 0.621337, 0.619382,
-    0.617429, 0.615474, 0.613521, 0.611566, 0.609614, 0.607659,
-    0.605706, 0.603751, 0.601798, 0.599843, 0.59789, 0.595935,
-    0.593982, 0.592028, 0.590074, 0.58812, 0.586167, 0.584212,
-    0.582259, 0.580305, 0.578351, 0.576397, 0.574443, 0.572489,
-    0.570535, 0.568581, 0.566627, 0.564674, 0.56272, 0.560766,
-    0.558812, 0.556858, 0.554904, 0.552951, 0.550996, 0.549043,
-    0.547088, 0.545135, 0.54318, 0.541227, 0.539273, 0.53732,
-    0.535365, 0.533412, 0.531457, 0.529504, 0.527549, 0.525596,
-    0.523641, 0.521689, 0.519734, 0.517781, 0.515826, 0.513873,
-    0.511918, 0.509965, 0.50801, 0.506057, 0.504103, 0.50215,
-    0.500195, 0.498242, 0.496287, 0.494334, 0.492379, 0.490426,
-    0.488471, 0.486519, 0.484564, 0.482611, 0.480656, 0.478703,
-    0.476748, 0.474795, 0.47284, 0.470887, 0.468933, 0.46698,
-    0.465025, 0.463072, 0.461117, 0.459164, 0.457209, 0.455256,
-    0.453302, 0.451348, 0.449394, 0.447441, 0.445486, 0.443533,
-    0.441579, 0.439625, 0.437671, 0.435717, 0.433763, 0.431809,
-    0.429855, 0.427901, 0.425948, 0.423994, 0.42204, 0.420086,
-    0.418132, 0.416178, 0.414224, 0.41227, 0.410317, 0.408362,
-    0.406409, 0.404455, 0.402501, 0.400547, 0.398593, 0.396639,
-    0.394686, 0.392731, 0.390778, 0.388823, 0.38687, 0.384916,
-    0.382962, 0.381008, 0.379055, 0.3771, 0.375147, 0.373192,
-    0.371239, 0.369284, 0.367331, 0.365377, 0.363424, 0.361469,
-    0.359516, 0.357561, 0.355608, 0.353653, 0.3517, 0.349745,
-    0.347792, 0.345838, 0.343885, 0.34193, 0.339977, 0.338022,
-    0.336069, 0.334114, 0.332161, 0.330207, 0.328254, 0.326299,
-    0.324346, 0.322391, 0.320438, 0.318483, 0.31653, 0.314576,
-    0.312622, 0.310668, 0.308714, 0.30676, 0.304807, 0.302852,
-    0.300899, 0.298945, 0.296991, 0.295037, 0.293083, 0.291129,
-    0.289175, 0.287222, 0.285268, 0.283314, 0.28136, 0.279406,
-    0.277452, 0.275498, 0.273544, 0.271591, 0.269636, 0.267683,
-    0.265729, 0.263775, 0.261821, 0.259867, 0.257913, 0.25596,
-    0.254005, 0.252052, 0.250097, 0.248144, 0.24619, 0.244236,
-    0.242282, 0.240329, 0.238374, 0.236421, 0.234466, 0.232513,
-    0.230558, 0.228605, 0.226651, 0.224697, 0.222743, 0.22079,
-    0.218835, 0.216882, 0.214927, 0.212974, 0.211019, 0.209066,
-    0.207112, 0.205159, 0.203204, 0.201251, 0.199296, 0.197343,
-    0.195388, 0.193435, 0.191481, 0.189527, 0.187573, 0.18562,
-    0.183665, 0.181712, 0.179757, 0.177804, 0.17585, 0.173896,
-    0.171942, 0.169988, 0.168034, 0.166081, 0.164126, 0.162173,
-    0.160219, 0.158265, 0.156311, 0.154357, 0.152403, 0.150449,
-    0.148495, 0.146542, 0.144588, 0.142634, 0.14068, 0.138726,
-    0.136772, 0.134818, 0.132864, 0.13091, 0.128957, 0.127003,
-    0.125049, 0.123095, 0.121141, 0.119187, 0.117233, 0.115279,
-    0.113326, 0.111371, 0.109418, 0.107464, 0.10551, 0.103556,
-    0.101602, 0.099648, 0.0976947, 0.0957402, 0.093787, 0.0918324,
-    0.0898792, 0.0879246, 0.0859714, 0.0840168, 0.0820637, 0.080109,
-    0.0781559, 0.0762013, 0.0742481, 0.0722935, 0.0703403, 0.0683857,
-    0.0664326, 0.0644779, 0.0625248, 0.0605702, 0.058617, 0.0566624,
-    0.0547092, 0.0527546, 0.0508014, 0.0488469, 0.0468936, 0.0449391,
-    0.0429858, 0.0410313, 0.039078, 0.0371236, 0.0351702, 0.0332158,
-    0.0312624, 0.0293081, 0.0273546, 0.0254003, 0.0234468, 0.0214926,
-    0.019539, 0.0175848, 0.0156312, 0.0136771, 0.0117234, 0.00976936,
-    0.00781562, 0.00586162, 0.00390781, 0.00195387, 0, -0.00195387,
-    -0.00390781, -0.00586162, -0.00781562, -0.00976936, -0.0117234, -0.0136771,
-    -0.0156312, -0.0175848, -0.019539, -0.0214926, -0.0234468, -0.0254003,
-    -0.0273546, -0.0293081, -0.0312624, -0.0332158, -0.0351702, -0.0371236,
-    -0.039078, -0.0410313, -0.0429858, -0.0449391, -0.0468936, -0.0488469,
-    -0.0508014, -0.0527546, -0.0547092, -0.0566624, -0.058617, -0.0605702,
-    -0.0625248, -0.0644779, -0.0664326, -0.0683857, -0.0703403, -0.0722935,
-    -0.0742481, -0.0762013, -0.0781559, -0.080109, -0.0820637, -0.0840168,
-    -0.0859714, -0.0879246, -0.0898792, -0.0918324, -0.093787, -0.0957402,
-    -0.0976947, -0.099648, -0.101602, -0.103556, -0.10551, -0.107464,
-    -0.109418, -0.111371, -0.113326, -0.115279, -0.117233, -0.119187,
-    -0.121141, -0.123095, -0.125049, -0.127003, -0.128957, -0.13091,
-    -0.132864, -0.134818, -0.136772, -0.138726, -0.14068, -0.142634,
-    -0.144588, -0.146542, -0.148495, -0.150449, -0.152403, -0.154357,
-    -0.156311, -0.158265, -0.160219, -0.162173, -0.164126, -0.166081,
-    -0.168034, -0.169988, -0.171942, -0.173896, -0.17585, -0.177804,
-    -0.179757, -0.181712, -0.183665, -0.18562, -0.187573, -0.189527,
-    -0.191481, -0.193435, -0.195388, -0.197343, -0.199296, -0.201251,
-    -0.203204, -0.205159, -0.207112, -0.209066, -0.211019, -0.212974,
-    -0.214927, -0.216882, -0.218835, -0.22079, -0.222743, -0.224697,
-    -0.226651, -0.228605, -0.230558, -0.232513, -0.234466, -0.236421,
-    -0.238374, -0.240329, -0.242282, -0.244236, -0.24619, -0.248144,
-    -0.250097, -0.252052, -0.254005, -0.25596, -0.257913, -0.259867,
-    -0.261821, -0.263775, -0.265729, -0.267683, -0.269636, -0.271591,
-    -0.273544, -0.275498, -0.277452, -0.279406, -0.28136, -0.283314,
-    -0.285268, -0.287222, -0.289175, -0.291129, -0.293083, -0.295037,
-    -0.296991, -0.298945, -0.300899, -0.302852, -0.304807, -0.30676,
-    -0.308714, -0.310668, -0.312622, -0.314576, -0.31653, -0.318483,
-    -0.320438, -0.322391, -0.324346, -0.326299, -0.328254, -0.330207,
-    -0.332161, -0.334114, -0.336069, -0.338022, -0.339977, -0.34193,
-    -0.343885, -0.345838, -0.347792, -0.349745, -0.3517, -0.353653,
-    -0.355608, -0.357561, -0.359516, -0.361469, -0.363424, -0.365377,
-    -0.367331, -0.369284, -0.371239, -0.373192, -0.375147, -0.3771,
-    -0.379055, -0.381008, -0.382962, -0.384916, -0.38687, -0.388823,
-    -0.390778, -0.392731, -0.394686, -0.396639, -0.398593, -0.400547,
-    -0.402501, -0.404455, -0.406409, -0.408362, -0.410317, -0.41227,
-    -0.414224, -0.416178, -0.418132, -0.420086, -0.42204, -0.423994,
-    -0.425948, -0.427901, -0.429855, -0.431809, -0.433763, -0.435717,
-    -0.437671, -0.439625, -0.441579, -0.443533, -0.445486, -0.447441,
-    -0.449394, -0.451348, -0.453302, -0.455256, -0.457209, -0.459164,
-    -0.461117, -0.463072, -0.465025, -0.46698, -0.468933, -0.470887,
-    -0.47284, -0.474795, -0.476748, -0.478703, -0.480656, -0.482611,
-    -0.484564, -0.486519, -0.488471, -0.490426, -0.492379, -0.494334,
-    -0.496287, -0.498242, -0.500195, -0.50215, -0.504103, -0.506057,
-    -0.50801, -0.509965, -0.511918, -0.513873, -0.515826, -0.517781,
-    -0.519734, -0.521689, -0.523641, -0.525596, -0.527549, -0.529504,
-    -0.531457, -0.533412, -0.535365, -0.53732, -0.539273, -0.541227,
-    -0.54318, -0.545135, -0.547088, -0.549043, -0.550996, -0.552951,
-    -0.554904, -0.556858, -0.558812, -0.560766, -0.56272, -0.564674,
-    -0.566627, -0.568581, -0.570535, -0.572489, -0.574443, -0.576397,
-    -0.578351, -0.580305, -0.582259, -0.584212, -0.586167, -0.58812,
-    -0.590074, -0.592028, -0.593982, -0.595935, -0.59789, -0.599843,
-    -0.601798, -0.603751, -0.605706, -0.607659, -0.609614, -0.611566,
-    -0.613521, -0.615474, -0.617429, -0.619382, -0.621337, -0.62329,
-    -0.625245, -0.627197, -0.629153, -0.631105, -0.63306, -0.635013,
-    -0.636968, -0.638921, -0.640876, -0.642828, -0.644784, -0.646736,
-    -0.648691, -0.650644, -0.652599, -0.654552, -0.656507, -0.65846,
-    -0.660415, -0.662367, -0.664323, -0.666275, -0.66823, -0.670183,
-    -0.672138, -0.674091, -0.676046, -0.677999, -0.679954, -0.681906,
-    -0.683861, -0.685814, -0.687769, -0.689722, -0.691677, -0.69363,
-    -0.695584, -0.697538, -0.699492, -0.701446, -0.7034, -0.705353,
-    -0.707308, -0.709261, -0.711215, -0.713169, -0.715123, -0.717077,
-    -0.719031, -0.720985, -0.722938, -0.724893, -0.726846, -0.7288,
-    -0.730754, -0.732708, -0.734661, -0.736616, -0.738569, -0.740524,
-    -0.742477, -0.744432, -0.746385, -0.74834, -0.750292, -0.752248,
-    -0.7542, -0.756155, -0.758108, -0.760063, -0.762015, -0.763971,
-    -0.765923, -0.767879, -0.769831, -0.771787, -0.773739, -0.775695,
-    -0.777646, -0.779602, -0.781554, -0.78351, -0.785462, -0.787418,
-    -0.78937, -0.791326, -0.793277, -0.795234, -0.797185, -0.799141,
-    -0.801093, -0.803049, -0.805001, -0.806957, -0.808908, -0.810865,
-    -0.812816, -0.814772, -0.816724, -0.81868, -0.820632, -0.822588,
-    -0.82454, -0.826495, -0.828448, -0.830403, -0.832355, -0.834311,
-    -0.836263, -0.838219, -0.840171, -0.842126, -0.844079, -0.846034,
-    -0.847987, -0.849941, -0.851895, -0.853849, -0.855803, -0.857757,
-    -0.859711, -0.861664, -0.863619, -0.865572, -0.867527, -0.86948,
-    -0.871435, -0.873387, -0.875343, -0.877295, -0.87925, -0.881202,
-    -0.883158, -0.88511, -0.887066, -0.889018, -0.890974, -0.892925,
-    -0.894882, -0.896833, -0.89879, -0.90074, -0.902698, -0.904648,
-    -0.906606, -0.908555, -0.910514, -0.912463, -0.914422, -0.916371,
-    -0.91833, -0.920278, -0.922238, -0.924186, -0.926146, -0.928093,
-    -0.930054, -0.932001, -0.933962, -0.935909, -0.93787, -0.939816,
-    -0.941778, -0.943724, -0.945686, -0.947632, -0.949594, -0.951539,
-    -0.953502, -0.955447, -0.957409, -0.959354, -0.961317, -0.963262,
-    -0.965225, -0.96717, -0.969133, -0.971078, -0.973041, -0.974985,
-    -0.976949, -0.978893, -0.980856, -0.982801, -0.984764, -0.98671,
-    -0.98867, -0.990619, -0.992576, -0.994532, -0.996472, -0.998478,
-    -1, -0.998478, -0.996472, -0.994532, -0.992576, -0.990619,
-    -0.98867, -0.98671, -0.984764, -0.982801, -0.980856, -0.978893,
-    -0.976949, -0.974985, -0.973041, -0.971078, -0.969133, -0.96717,
-    -0.965225, -0.963262, -0.961317, -0.959354, -0.957409, -0.955447,
-    -0.953502, -0.951539, -0.949594, -0.947632, -0.945686, -0.943724,
-    -0.941778, -0.939816, -0.93787, -0.935909, -0.933962, -0.932001,
-    -0.930054, -0.928093, -0.926146, -0.924186, -0.922238, -0.920278,
-    -0.91833, -0.916371, -0.914422, -0.912463, -0.910514, -0.908555,
-    -0.906606, -0.904648, -0.902698, -0.90074, -0.89879, -0.896833,
-    -0.894882, -0.892925, -0.890974, -0.889018, -0.887066, -0.88511,
-    -0.883158, -0.881202, -0.87925, -0.877295, -0.875343, -0.873387,
-    -0.871435, -0.86948, -0.867527, -0.865572, -0.863619, -0.861664,
-    -0.859711, -0.857757, -0.855803, -0.853849, -0.851895, -0.849941,
-    -0.847987, -0.846034, -0.844079, -0.842126, -0.840171, -0.838219,
-    -0.836263, -0.834311, -0.832355, -0.830403, -0.828448, -0.826495,
-    -0.82454, -0.822588, -0.820632, -0.81868, -0.816724, -0.814772,
-    -0.812816, -0.810865, -0.808908, -0.806957, -0.805001, -0.803049,
-    -0.801093, -0.799141, -0.797185, -0.795234, -0.793277, -0.791326,
-    -0.78937, -0.787418, -0.785462, -0.78351, -0.781554, -0.779602,
-    -0.777646, -0.775695, -0.773739, -0.771787, -0.769831, -0.767879,
-    -0.765923, -0.763971, -0.762015, -0.760063, -0.758108, -0.756155,
-    -0.7542, -0.752248, -0.750292, -0.74834, -0.746385, -0.744432,
-    -0.742477, -0.740524, -0.738569, -0.736616, -0.734661, -0.732708,
-    -0.730754, -0.7288, -0.726846, -0.724893, -0.722938, -0.720985,
-    -0.719031, -0.717077, -0.715123, -0.713169, -0.711215, -0.709261,
-    -0.707308, -0.705353, -0.7034, -0.701446, -0.699492, -0.697538,
-    -0.695584, -0.69363, -0.691677, -0.689722, -0.687769, -0.685814,
-    -0.683861, -0.681906, -0.679954, -0.677999, -0.676046, -0.674091,
-    -0.672138, -0.670183, -0.66823, -0.666275, -0.664323, -0.662367,
-    -0.660415, -0.65846, -0.656507, -0.654552, -0.652599, -0.650644,
-    -0.648691, -0.646736, -0.644784, -0.642828, -0.640876, -0.638921,
-    -0.636968, -0.635013, -0.63306, -0.631105, -0.629153, -0.627197,
-    -0.625245, -0.62329, -0.621337, -0.619382, -0.617429, -0.615474,
-    -0.613521, -0.611566, -0.609614, -0.607659, -0.605706, -0.603751,
-    -0.601798, -0.599843, -0.59789, -0.595935, -0.593982, -0.592028,
-    -0.590074, -0.58812, -0.586167, -0.584212, -0.582259, -0.580305,
-    -0.578351, -0.576397, -0.574443, -0.572489, -0.570535, -0.568581,
-    -0.566627, -0.564674, -0.56272, -0.560766, -0.558812, -0.556858,
-    -0.554904, -0.552951, -0.550996, -0.549043, -0.547088, -0.545135,
-    -0.54318, -0.541227, -0.539273, -0.53732, -0.535365, -0.533412,
-    -0.531457, -0.529504, -0.527549, -0.525596, -0.523641, -0.521689,
-    -0.519734, -0.517781, -0.515826, -0.513873, -0.511918, -0.509965,
-    -0.50801, -0.506057, -0.504103, -0.50215, -0.500195, -0.498242,
-    -0.496287, -0.494334, -0.492379, -0.490426, -0.488471, -0.486519,
-    -0.484564, -0.482611, -0.480656, -0.478703, -0.476748, -0.474795,
-    -0.47284, -0.470887, -0.468933, -0.46698, -0.465025, -0.463072,
-    -0.461117, -0.459164, -0.457209, -0.455256, -0.453302, -0.451348,
-    -0.449394, -0.447441, -0.445486, -0.443533, -0.441579, -0.439625,
-    -0.437671, -0.435717, -0.433763, -0.431809, -0.429855, -0.427901,
-    -0.425948, -0.423994, -0.42204, -0.420086, -0.418132, -0.416178,
-    -0.414224, -0.41227, -0.410317, -0.408362, -0.406409, -0.404455,
-    -0.402501, -0.400547, -0.398593, -0.396639, -0.394686, -0.392731,
-    -0.390778, -0.388823, -0.38687, -0.384916, -0.382962, -0.381008,
-    -0.379055, -0.3771, -0.375147, -0.373192, -0.371239, -0.369284,
-    -0.367331, -0.365377, -0.363424, -0.361469, -0.359516, -0.357561,
-    -0.355608, -0.353653, -0.3517, -0.349745, -0.347792, -0.345838,
-    -0.343885, -0.34193, -0.339977, -0.338022, -0.336069, -0.334114,
-    -0.332161, -0.330207, -0.328254, -0.326299, -0.324346, -0.322391,
-    -0.320438, -0.318483, -0.31653, -0.314576, -0.312622, -0.310668,
-    -0.308714, -0.30676, -0.304807, -0.302852, -0.300899, -0.298945,
-    -0.296991, -0.295037, -0.293083, -0.291129, -0.289175, -0.287222,
-    -0.285268, -0.283314, -0.28136, -0.279406, -0.277452, -0.275498,
-    -0.273544, -0.271591, -0.269636, -0.267683, -0.265729, -0.263775,
-    -0.261821, -0.259867, -0.257913, -0.25596, -0.254005, -0.252052,
-    -0.250097, -0.248144, -0.24619, -0.244236, -0.242282, -0.240329,
-    -0.238374, -0.236421, -0.234466, -0.232513, -0.230558, -0.228605,
-    -0.226651, -0.224697, -0.222743, -0.22079, -0.218835, -0.216882,
-    -0.214927, -0.212974, -0.211019, -0.209066, -0.207112, -0.205159,
-    -0.203204, -0.201251, -0.199296, -0.197343, -0.195388, -0.193435,
-    -0.191481, -0.189527, -0.187573, -0.18562, -0.183665, -0.181712,
-    -0.179757, -0.177804, -0.17585, -0.173896, -0.171942, -0.169988,
-    -0.168034, -0.166081, -0.164126, -0.162173, -0.160219, -0.158265,
-    -0.156311, -0.154357, -0.152403, -0.150449, -0.148495, -0.146542,
-    -0.144588, -0.142634, -0.14068, -0.138726, -0.136772, -0.134818,
-    -0.132864, -0.13091, -0.128957, -0.127003, -0.125049, -0.123095,
-    -0.121141, -0.119187, -0.117233, -0.115279, -0.113326, -0.111371,
-    -0.109418, -0.107464, -0.10551, -0.103556, -0.101602, -0.099648,
-    -0.0976947, -0.0957402, -0.093787, -0.0918324, -0.0898792, -0.0879246,
-    -0.0859714, -0.0840168, -0.0820637, -0.080109, -0.0781559, -0.0762013,
-    -0.0742481, -0.0722935, -0.0703403, -0.0683857, -0.0664326, -0.0644779,
-    -0.0625248, -0.0605702, -0.058617, -0.0566624, -0.0547092, -0.0527546,
-    -0.0508014, -0.0488469, -0.0468936, -0.0449391, -0.0429858, -0.0410313,
-    -0.039078, -0.0371236, -0.0351702, -0.0332158, -0.0312624, -0.0293081,
-    -0.0273546, -0.0254003, -0.0234468, -0.0214926, -0.019539, -0.0175848,
-    -0.0156312, -0.0136771, -0.0117234, -0.00976936, -0.00781562, -0.00586162,
-    -0.00390781, -0.00195387
-};
-
-static const float WAVE_TRIANGLE_030[DEFAULT_WAVELEN] = {
-    0, 0.00195617, 0.00390925, 0.00586245, 0.00781873, 0.00977478,
-    0.0117278, 0.0136811, 0.0156375, 0.0175934, 0.0195463, 0.0214997,
-    0.0234562, 0.025412, 0.0273648, 0.0293184, 0.0312749, 0.0332306,
-    0.0351833, 0.037137, 0.0390936, 0.0410491, 0.0430018, 0.0449557,
-    0.0469124, 0.0488677, 0.0508203, 0.0527743, 0.0547311, 0.0566863,
-    0.0586388, 0.060593, 0.0625498, 0.0645048, 0.0664574, 0.0684117,
-    0.0703685, 0.0723234, 0.0742759, 0.0762304, 0.0781872, 0.0801419,
-    0.0820944, 0.0840491, 0.0860059, 0.0879605, 0.089913, 0.0918678,
-    0.0938246, 0.095779, 0.0977315, 0.0996865, 0.101643, 0.103598,
-    0.10555, 0.107505, 0.109462, 0.111416, 0.113369, 0.115324,
-    0.117281, 0.119235, 0.121187, 0.123143, 0.125099, 0.127053,
-    0.129006, 0.130961, 0.132918, 0.134872, 0.136824, 0.13878,
-    0.140737, 0.14269, 0.144643, 0.146599, 0.148555, 0.150509,
-    0.152461, 0.154418, 0.156374, 0.158327, 0.16028, 0.162236,
-    0.164193, 0.166146, 0.168099, 0.170055, 0.172011, 0.173964,
-    0.175917, 0.177874, 0.17983, 0.181783, 0.183736, 0.185692,
-    0.187648, 0.189601, 0.191555, 0.193511, 0.195467, 0.19742,
-    0.199373, 0.20133, 0.203286, 0.205238, 0.207192, 0.209149,
-    0.211104, 0.213057, 0.215011, 0.216967, 0.218923, 0.220875,
-    0.222829, 0.224786, 0.226741, 0.228694, 0.230648, 0.232605,
-    0.23456, 0.236512, 0.238467, 0.240424, 0.242378, 0.244331,
-    0.246285, 0.248242, 0.250197, 0.252149, 0.254104, 0.256061,
-    0.258015, 0.259968, 0.261923, 0.26388, 0.265834, 0.267786,
-    0.269741, 0.271698, 0.273652, 0.275605, 0.27756, 0.279517,
-    0.281471, 0.283423, 0.285379, 0.287336, 0.28929, 0.291242,
-    0.293198, 0.295154, 0.297108, 0.299061, 0.301016, 0.302973,
-    0.304927, 0.306879, 0.308835, 0.310792, 0.312745, 0.314698,
-    0.316654, 0.31861, 0.320564, 0.322516, 0.324472, 0.326429,
-    0.328382, 0.330335, 0.332291, 0.334248, 0.3362, 0.338153,
-    0.34011, 0.342066, 0.344019, 0.345972, 0.347929, 0.349885,
-    0.351837, 0.353791, 0.355747, 0.357703, 0.359656, 0.361609,
-    0.363566, 0.365522, 0.367474, 0.369428, 0.371385, 0.373341,
-    0.375293, 0.377247, 0.379204, 0.381159, 0.383111, 0.385065,
-    0.387022, 0.388978, 0.39093, 0.392884, 0.394841, 0.396796,
-    0.398748, 0.400703, 0.40266, 0.404615, 0.406567, 0.408521,
-    0.410479, 0.412433, 0.414385, 0.41634, 0.418297, 0.420252,
-    0.422204, 0.424159, 0.426116, 0.428071, 0.430022, 0.431977,
-    0.433935, 0.435889, 0.437841, 0.439796, 0.441754, 0.443708,
-    0.445659, 0.447615, 0.449572, 0.451526, 0.453478, 0.455434,
-    0.457391, 0.459345, 0.461297, 0.463252, 0.46521, 0.467163,
-    0.469115, 0.471071, 0.473028, 0.474981, 0.476934, 0.47889,
-    0.480847, 0.4828, 0.484752, 0.486709, 0.488666, 0.490618,
-    0.492571, 0.494527, 0.496484, 0.498437, 0.500389, 0.502346,
-    0.504303, 0.506255, 0.508208, 0.510165, 0.512122, 0.514074,
-    0.516027, 0.517984, 0.51994, 0.521892, 0.523845, 0.525803,
-    0.527759, 0.529711, 0.531664, 0.533621, 0.535577, 0.537529,
-    0.539482, 0.54144, 0.543396, 0.545348, 0.547301, 0.549259,
-    0.551215, 0.553166, 0.55512, 0.557078, 0.559033, 0.560984,
-    0.562938, 0.564896, 0.566852, 0.568803, 0.570757, 0.572715,
-    0.57467, 0.576621, 0.578576, 0.580534, 0.582489, 0.58444,
-    0.586395, 0.588353, 0.590307, 0.592258, 0.594213, 0.596172,
-    0.598126, 0.600077, 0.602032, 0.60399, 0.605944, 0.607895,
-    0.609851, 0.611809, 0.613763, 0.615714, 0.61767, 0.619628,
-    0.621581, 0.623532, 0.625488, 0.627447, 0.6294, 0.631351,
-    0.633307, 0.635265, 0.637218, 0.639169, 0.641126, 0.643084,
-    0.645037, 0.646988, 0.648945, 0.650903, 0.652855, 0.654806,
-    0.656764, 0.658721, 0.660673, 0.662625, 0.664582, 0.66654,
-    0.668492, 0.670443, 0.672401, 0.674359, 0.67631, 0.678262,
-    0.68022, 0.682177, 0.684128, 0.686081, 0.688039, 0.689996,
-    0.691947, 0.693899, 0.695858, 0.697815, 0.699765, 0.701718,
-    0.703677, 0.705633, 0.707584, 0.709536, 0.711496, 0.713452,
-    0.715402, 0.717355, 0.719314, 0.721271, 0.72322, 0.725174,
-    0.727133, 0.729089, 0.731039, 0.732992, 0.734952, 0.736908,
-    0.738857, 0.740811, 0.742771, 0.744726, 0.746675, 0.74863,
-    0.75059, 0.752545, 0.754494, 0.756449, 0.758409, 0.760363,
-    0.762312, 0.764267, 0.766228, 0.768182, 0.77013, 0.772086,
-    0.774047, 0.776, 0.777949, 0.779905, 0.781866, 0.783818,
-    0.785767, 0.787724, 0.789685, 0.791637, 0.793585, 0.795543,
-    0.797504, 0.799455, 0.801404, 0.803362, 0.805322, 0.807273,
-    0.809222, 0.811181, 0.813141, 0.815092, 0.81704, 0.818999,
-    0.82096, 0.82291, 0.824859, 0.826818, 0.828779, 0.830728,
-    0.832677, 0.834638, 0.836598, 0.838546, 0.840495, 0.842457,
-    0.844417, 0.846364, 0.848314, 0.850276, 0.852236, 0.854183,
-    0.856132, 0.858095, 0.860055, 0.862001, 0.86395, 0.865914,
-    0.867873, 0.869819, 0.871769, 0.873733, 0.875692, 0.877637,
-    0.879587, 0.881553, 0.883511, 0.885454, 0.887406, 0.889372,
-    0.89133, 0.893272, 0.895224, 0.897192, 0.899149, 0.90109,
-    0.903043, 0.905011, 0.906967, 0.908907, 0.910861, 0.912831,
-    0.914786, 0.916725, 0.91868, 0.920651, 0.922605, 0.924542,
-    0.926498, 0.928471, 0.930424, 0.932359, 0.934317, 0.936292,
-    0.938242, 0.940175, 0.942135, 0.944113, 0.946061, 0.947991,
-    0.949954, 0.951935, 0.953879, 0.955806, 0.957773, 0.959757,
-    0.961697, 0.96362, 0.965592, 0.967582, 0.969515, 0.971431,
-    0.973412, 0.97541, 0.977332, 0.979238, 0.981233, 0.983245,
-    0.985146, 0.987032, 0.989062, 0.991102, 0.992941, 0.994779,
-    0.996957, 0.999077, 1, 0.999077, 0.996957, 0.994779,
-    0.992941, 0.991102, 0.989062, 0.987032, 0.985146, 0.983245,
-    0.981233, 0.979238, 0.977332, 0.97541, 0.973412, 0.971431,
-    0.969515, 0.967582, 0.965592, 0.96362, 0.961697, 0.959757,
-    0.957773, 0.955806, 0.953879, 0.951935, 0.949954, 0.947991,
-    0.946061, 0.944113, 0.942135, 0.940175, 0.938242, 0.936292,
-    0.934317, 0.932359, 0.930424, 0.928471, 0.926498, 0.924542,
-    0.922605, 0.920651, 0.91868, 0.916725, 0.914786, 0.912831,
-    0.910861, 0.908907, 0.906967, 0.905011, 0.903043, 0.90109,
-    0.899149, 0.897192, 0.895224, 0.893272, 0.89133, 0.889372,
-    0.887406, 0.885454, 0.883511, 0.881553, 0.879587, 0.877637,
-    0.875692, 0.873733, 0.871769, 0.869819, 0.867873, 0.865914,
-    0.86395, 0.862001, 0.860055, 0.858095, 0.856132, 0.854183,
-    0.852236, 0.850276, 0.848314, 0.846364, 0.844417, 0.842457,
-    0.840495, 0.838546, 0.836598, 0.834638, 0.832677, 0.830728,
-    0.828779, 0.826818, 0.824859, 0.82291, 0.82096, 0.818999,
-    0.81704, 0.815092, 0.813141, 0.811181, 0.809222, 0.807273,
-    0.805322, 0.803362, 0.801404, 0.799455, 0.797504, 0.795543,
-    0.793585, 0.791637, 0.789685, 0.787724, 0.785767, 0.783818,
-    0.781866, 0.779905, 0.777949, 0.776, 0.774047, 0.772086,
-    0.77013, 0.768182, 0.766228, 0.764267, 0.762312, 0.760363,
-    0.758409, 0.756449, 0.754494, 0.752545, 0.75059, 0.74863,
-    0.746675, 0.744726, 0.742771, 0.740811, 0.738857, 0.736908,
-    0.734952, 0.732992, 0.731039, 0.729089, 0.727133, 0.725174,
-    0.72322, 0.721271, 0.719314, 0.717355, 0.715402, 0.713452,
-    0.711496, 0.709536, 0.707584, 0.705633, 0.703677, 0.701718,
-    0.699765, 0.697815, 0.695858, 0.693899, 0.691947, 0.689996,
-    0.688039, 0.686081, 0.684128, 0.682177, 0.68022, 0.678262,
-    0.67631, 0.674359, 0.672401, 0.670443, 0.668492, 0.66654,
-    0.664582, 0.662625, 0.660673, 0.658721, 0.656764, 0.654806,
-    0.652855, 0.650903, 0.648945, 0.646988, 0.645037, 0.643084,
-    0.641126, 0.639169, 0.637218, 0.635265, 0.633307, 0.631351,
-    0.6294, 0.627447, 0.625488, 0.623532, 0.621581, 0.619628,
-    0.61767, 0.615714, 0.613763, 0.611809, 0.609851, 0.607895,
-    0.605944, 0.60399, 0.602032, 0.600077, 0.598126, 0.596172,
-    0.594213, 0.592258, 0.590307, 0.588353, 0.586395, 0.58444,
-    0.582489, 0.580534, 0.578576, 0.576621, 0.57467, 0.572715,
-    0.570757, 0.568803, 0.566852, 0.564896, 0.562938, 0.560984,
-    0.559033, 0.557078, 0.55512, 0.553166, 0.551215, 0.549259,
-    0.547301, 0.545348, 0.543396, 0.54144, 0.539482, 0.537529,
-    0.535577, 0.533621, 0.531664, 0.529711, 0.527759, 0.525803,
-    0.523845, 0.521892, 0.51994, 0.517984, 0.516027, 0.514074,
-    0.512122, 0.510165, 0.508208, 0.506255, 0.504303, 0.502346,
-    0.500389, 0.498437, 0.496484, 0.494527, 0.492571, 0.490618,
-    0.488666, 0.486709, 0.484752, 0.4828, 0.480847, 0.47889,
-    0.476934, 0.474981, 0.473028, 0.471071, 0.469115, 0.467163,
-    0.46521, 0.463252, 0.461297, 0.459345, 0.457391, 0.455434,
-    0.453478, 0.451526, 0.449572, 0.447615, 0.445659, 0.443708,
-    0.441754, 0.439796, 0.437841, 0.435889, 0.433935, 0.431977,
-    0.430022, 0.428071, 0.426116, 0.424159, 0.422204, 0.420252,
-    0.418297, 0.41634, 0.414385, 0.412433, 0.410479, 0.408521,
-    0.406567, 0.404615, 0.40266, 0.400703, 0.398748, 0.396796,
-    0.394841, 0.392884, 0.39093, 0.388978, 0.387022, 0.385065,
-    0.383111, 0.381159, 0.379204, 0.377247, 0.375293, 0.373341,
-    0.371385, 0.369428, 0.367474, 0.365522, 0.363566, 0.361609,
-    0.359656, 0.357703, 0.355747, 0.353791, 0.351837, 0.349885,
-    0.347929, 0.345972, 0.344019, 0.342066, 0.34011, 0.338153,
-    0.3362, 0.334248, 0.332291, 0.330335, 0.328382, 0.326429,
-    0.324472, 0.322516, 0.320564, 0.31861, 0.316654, 0.314698,
-    0.312745, 0.310792, 0.308835, 0.306879, 0.304927, 0.302973,
-    0.301016, 0.299061, 0.297108, 0.295154, 0.293198, 0.291242,
-    0.28929, 0.287336, 0.285379, 0.283423, 0.281471, 0.279517,
-    0.27756, 0.275605, 0.273652, 0.271698, 0.269741, 0.267786,
-    0.265834, 0.26388, 0.261923, 0.259968, 0.258015, 0.256061,
-    0.254104, 0.252149, 0.250197, 0.248242, 0.246285, 0.244331,
-    0.242378, 0.240424, 0.238467, 0.236512, 0.23456, 0.232605,
-    0.230648, 0.228694, 0.226741, 0.224786, 0.222829, 0.220875,
-    0.218923, 0.216967, 0.215011, 0.213057, 0.211104, 0.209149,
-    0.207192, 0.205238, 0.203286, 0.20133, 0.199373, 0.19742,
-    0.195467, 0.193511, 0.191555, 0.189601, 0.187648, 0.185692,
-    0.183736, 0.181783, 0.17983, 0.177874, 0.175917, 0.173964,
-    0.172011, 0.170055, 0.168099, 0.166146, 0.164193, 0.162236,
-    0.16028, 0.158327, 0.156374, 0.154418, 0.152461, 0.150509,
-    0.148555, 0.146599, 0.144643, 0.14269, 0.140737, 0.13878,
-    0.136824, 0.134872, 0.132918, 0.130961, 0.129006, 0.127053,
-    0.125099, 0.123143, 0.121187, 0.119235, 0.117281, 0.115324,
-    0.113369, 0.111416, 0.109462, 0.107505, 0.10555, 0.103598,
-    0.101643, 0.0996865, 0.0977315, 0.095779, 0.0938246, 0.0918678,
-    0.089913, 0.0879605, 0.0860059, 0.0840491, 0.0820944, 0.0801419,
-    0.0781872, 0.0762304, 0.0742759, 0.0723234, 0.0703685, 0.0684117,
-    0.0664574, 0.0645048, 0.0625498, 0.060593, 0.0586388, 0.0566863,
-    0.0547311, 0.0527743, 0.0508203, 0.0488677, 0.0469124, 0.0449557,
-    0.0430018, 0.0410491, 0.0390936, 0.037137, 0.0351833, 0.0332306,
-    0.0312749, 0.0293184, 0.0273648, 0.025412, 0.0234562, 0.0214997,
-    0.0195463, 0.0175934, 0.0156375, 0.0136811, 0.0117278, 0.00977478,
-    0.00781873, 0.00586245, 0.00390925, 0.00195617, 0, -0.00195617,
-    -0.00390925, -0.00586245, -0.00781873, -0.00977478, -0.0117278, -0.0136811,
-    -0.0156375, -0.0175934, -0.0195463, -0.0214997, -0.0234562, -0.025412,
-    -0.0273648, -0.0293184, -0.0312749, -0.0332306, -0.0351833, -0.037137,
-    -0.0390936, -0.0410491, -0.0430018, -0.0449557, -0.0469124, -0.0488677,
-    -0.0508203, -0.0527743, -0.0547311, -0.0566863, -0.0586388, -0.060593,
-    -0.0625498, -0.0645048, -0.0664574, -0.0684117, -0.0703685, -0.0723234,
-    -0.0742759, -0.0762304, -0.0781872, -0.0801419, -0.0820944, -0.0840491,
-    -0.0860059, -0.0879605, -0.089913, -0.0918678, -0.0938246, -0.095779,
-    -0.0977315, -0.0996865, -0.101643, -0.103598, -0.10555, -0.107505,
-    -0.109462, -0.111416, -0.113369, -0.115324, -0.117281, -0.119235,
-    -0.121187, -0.123143, -0.125099, -0.127053, -0.129006, -0.130961,
-    -0.132918, -0.134872, -0.136824, -0.13878, -0.140737, -0.14269,
-    -0.144643, -0.146599, -0.148555, -0.150509, -0.152461, -0.154418,
-    -0.156374, -0.158327, -0.16028, -0.162236, -0.164193, -0.166146,
-    -0.168099, -0.170055, -0.172011, -0.173964, -0.175917, -0.177874,
-    -0.17983, -0.181783, -0.183736, -0.185692, -0.187648, -0.189601,
-    -0.191555, -0.193511, -0.195467, -0.19742, -0.199373, -0.20133,
-    -0.203286, -0.205238, -0.207192, -0.209149, -0.211104, -0.213057,
-    -0.215011, -0.216967, -0.218923, -0.220875, -0.222829, -0.224786,
-    -0.226741, -0.228694, -0.230648, -0.232605, -0.23456, -0.236512,
-    -0.238467, -0.240424, -0.242378, -0.244331, -0.246285, -0.248242,
-    -0.250197, -0.252149, -0.254104, -0.256061, -0.258015, -0.259968,
-    -0.261923, -0.26388, -0.265834, -0.267786, -0.269741, -0.271698,
-    -0.273652, -0.275605, -0.27756, -0.279517, -0.281471, -0.283423,
-    -0.285379, -0.287336, -0.28929, -0.291242, -0.293198, -0.295154,
-    -0.297108, -0.299061, -0.301016, -0.302973, -0.304927, -0.306879,
-    -0.308835, -0.310792, -0.312745, -0.314698, -0.316654, -0.31861,
-    -0.320564, -0.322516, -0.324472, -0.326429, -0.328382, -0.330335,
-    -0.332291, -0.334248, -0.3362, -0.338153, -0.34011, -0.342066,
-    -0.344019, -0.345972, -0.347929, -0.349885, -0.351837, -0.353791,
-    -0.355747, -0.357703, -0.359656, -0.361609, -0.363566, -0.365522,
-    -0.367474, -0.369428, -0.371385, -0.373341, -0.375293, -0.377247,
-    -0.379204, -0.381159, -0.383111, -0.385065, -0.387022, -0.388978,
-    -0.39093, -0.392884, -0.394841, -0.396796, -0.398748, -0.400703,
-    -0.40266, -0.404615, -0.406567, -0.408521, -0.410479, -0.412433,
-    -0.414385, -0.41634, -0.418297, -0.420252, -0.422204, -0.424159,
-    -0.426116, -0.428071, -0.430022, -0.431977, -0.433935, -0.435889,
-    -0.437841, -0.439796, -0.441754, -0.443708, -0.445659, -0.447615,
-    -0.449572, -0.451526, -0.453478, -0.455434, -0.457391, -0.459345,
-    -0.461297, -0.463252, -0.46521, -0.467163, -0.469115, -0.471071,
-    -0.473028, -0.474981, -0.476934, -0.47889, -0.480847, -0.4828,
-    -0.484752, -0.486709, -0.488666, -0.490618, -0.492571, -0.494527,
-    -0.496484, -0.498437, -0.500389, -0.502346, -0.504303, -0.506255,
-    -0.508208, -0.510165, -0.512122, -0.514074, -0.516027, -0.517984,
-    -0.51994, -0.521892, -0.523845, -0.525803, -0.527759, -0.529711,
-    -0.531664, -0.533621, -0.535577, -0.537529, -0.539482, -0.54144,
-    -0.543396, -0.545348, -0.547301, -0.549259, -0.551215, -0.553166,
-    -0.55512, -0.557078, -0.559033, -0.560984, -0.562938, -0.564896,
-    -0.566852, -0.568803, -0.570757, -0.572715, -0.57467, -0.576621,
-    -0.578576, -0.580534, -0.582489, -0.58444, -0.586395, -0.588353,
-    -0.590307, -0.592258, -0.594213, -0.596172, -0.598126, -0.600077,
-    -0.602032, -0.60399, -0.605944, -0.607895, -0.609851, -0.611809,
-    -0.613763, -0.615714, -0.61767, -0.619628, -0.621581, -0.623532,
-    -0.625488, -0.627447, -0.6294, -0.631351, -0.633307, -0.635265,
-    -0.637218, -0.639169, -0.641126, -0.643084, -0.645037, -0.646988,
-    -0.648945, -0.650903, -0.652855, -0.654806, -0.656764, -0.658721,
-    -0.660673, -0.662625, -0.664582, -0.66654, -0.668492, -0.670443,
-    -0.672401, -0.674359, -0.67631, -0.678262, -0.68022, -0.682177,
-    -0.684128, -0.686081, -0.688039, -0.689996, -0.691947, -0.693899,
-    -0.695858, -0.697815, -0.699765, -0.701718, -0.703677, -0.705633,
-    -0.707584, -0.709536, -0.711496, -0.713452, -0.715402, -0.717355,
-    -0.719314, -0.721271, -0.72322, -0.725174, -0.727133, -0.729089,
-    -0.731039, -0.732992, -0.734952, -0.736908, -0.738857, -0.740811,
-    -0.742771, -0.744726, -0.746675, -0.74863, -0.75059, -0.752545,
-    -0.754494, -0.756449, -0.758409, -0.760363, -0.762312, -0.764267,
-    -0.766228, -0.768182, -0.77013, -0.772086, -0.774047, -0.776,
-    -0.777949, -0.779905, -0.781866, -0.783818, -0.785767, -0.787724,
-    -0.789685, -0.791637, -0.793585, -0.795543, -0.797504, -0.799455,
-    -0.801404, -0.803362, -0.805322, -0.807273, -0.809222, -0.811181,
-    -0.813141, -0.815092, -0.81704, -0.818999, -0.82096, -0.82291,
-    -0.824859, -0.826818, -0.828779, -0.830728, -0.832677, -0.834638,
-    -0.836598, -0.838546, -0.840495, -0.842457, -0.844417, -0.846364,
-    -0.848314, -0.850276, -0.852236, -0.854183, -0.856132, -0.858095,
-    -0.860055, -0.862001, -0.86395, -0.865914, -0.867873, -0.869819,
-    -0.871769, -0.873733, -0.875692, -0.877637, -0.879587, -0.881553,
-    -0.883511, -0.885454, -0.887406, -0.889372, -0.89133, -0.893272,
-    -0.895224, -0.897192, -0.899149, -0.90109, -0.903043, -0.905011,
-    -0.906967, -0.908907, -0.910861, -0.912831, -0.914786, -0.916725,
-    -0.91868, -0.920651, -0.922605, -0.924542, -0.926498, -0.928471,
-    -0.930424, -0.932359, -0.934317, -0.936292, -0.938242, -0.940175,
-    -0.942135, -0.944113, -0.946061, -0.947991, -0.949954, -0.951935,
-    -0.953879, -0.955806, -0.957773, -0.959757, -0.961697, -0.96362,
-    -0.965592, -0.967582, -0.969515, -0.971431, -0.973412, -0.97541,
-    -0.977332, -0.979238, -0.981233, -0.983245, -0.985146, -0.987032,
-    -0.989062, -0.991102, -0.992941, -0.994779, -0.996957, -0.999077,
-    -1, -0.999077, -0.996957, -0.994779, -0.992941, -0.991102,
-    -0.989062, -0.987032, -0.985146, -0.983245, -0.981233, -0.979238,
-    -0.977332, -0.97541, -0.973412, -0.971431, -0.969515, -0.967582,
-    -0.965592, -0.96362, -0.961697, -0.959757, -0.957773, -0.955806,
-    -0.953879, -0.951935, -0.949954, -0.947991, -0.946061, -0.944113,
-    -0.942135, -0.940175, -0.938242, -0.936292, -0.934317, -0.932359,
-    -0.930424, -0.928471, -0.926498, -0.924542, -0.922605, -0.920651,
-    -0.91868, -0.916725, -0.914786, -0.912831, -0.910861, -0.908907,
-    -0.906967, -0.905011, -0.903043, -0.90109, -0.899149, -0.897192,
-    -0.895224, -0.893272, -0.89133, -0.889372, -0.887406, -0.885454,
-    -0.883511, -0.881553, -0.879587, -0.877637, -0.875692, -0.873733,
-    -0.871769, -0.869819, -0.867873, -0.865914, -0.86395, -0.862001,
-    -0.860055, -0.858095, -0.856132, -0.854183, -0.852236, -0.850276,
-    -0.848314, -0.846364, -0.844417, -0.842457, -0.840495, -0.838546,
-    -0.836598, -0.834638, -0.832677, -0.830728, -0.828779, -0.826818,
-    -0.824859, -0.82291, -0.82096, -0.818999, -0.81704, -0.815092,
-    -0.813141, -0.811181, -0.809222, -0.807273, -0.805322, -0.803362,
-    -0.801404, -0.799455, -0.797504, -0.795543, -0.793585, -0.791637,
-    -0.789685, -0.787724, -0.785767, -0.783818, -0.781866, -0.779905,
-    -0.777949, -0.776, -0.774047, -0.772086, -0.77013, -0.768182,
-    -0.766228, -0.764267, -0.762312, -0.760363, -0.758409, -0.756449,
-    -0.754494, -0.752545, -0.75059, -0.74863, -0.746675, -0.744726,
-    -0.742771, -0.740811, -0.738857, -0.736908, -0.734952, -0.732992,
-    -0.731039, -0.729089, -0.727133, -0.725174, -0.72322, -0.721271,
-    -0.719314, -0.717355, -0.715402, -0.713452, -0.711496, -0.709536,
-    -0.707584, -0.705633, -0.703677, -0.701718, -0.699765, -0.697815,
-    -0.695858, -0.693899, -0.691947, -0.689996, -0.688039, -0.686081,
-    -0.684128, -0.682177, -0.68022, -0.678262, -0.67631, -0.674359,
-    -0.672401, -0.670443, -0.668492, -0.66654, -0.664582, -0.662625,
-    -0.660673, -0.658721, -0.656764, -0.654806, -0.652855, -0.650903,
-    -0.648945, -0.646988, -0.645037, -0.643084, -0.641126, -0.639169,
-    -0.637218, -0.635265, -0.633307, -0.631351, -0.6294, -0.627447,
-    -0.625488, -0.623532, -0.621581, -0.619628, -0.61767, -0.615714,
-    -0.613763, -0.611809, -0.609851, -0.607895, -0.605944, -0.60399,
-    -0.602032, -0.600077, -0.598126, -0.596172, -0.594213, -0.592258,
-    -0.590307, -0.588353, -0.586395, -0.58444, -0.582489, -0.580534,
-    -0.578576, -0.576621, -0.57467, -0.572715, -0.570757, -0.568803,
-    -0.566852, -0.564896, -0.562938, -0.560984, -0.559033, -0.557078,
-    -0.55512, -0.553166, -0.551215, -0.549259, -0.547301, -0.545348,
-    -0.543396, -0.54144, -0.539482, -0.537529, -0.535577, -0.533621,
-    -0.531664, -0.529711, -0.527759, -0.525803, -0.523845, -0.521892,
-    -0.51994, -0.517984, -0.516027, -0.514074, -0.512122, -0.510165,
-    -0.508208, -0.506255, -0.504303, -0.502346, -0.500389, -0.498437,
-    -0.496484, -0.494527, -0.492571, -0.490618, -0.488666, -0.486709,
-    -0.484752, -0.4828, -0.480847, -0.47889, -0.476934, -0.474981,
-    -0.473028, -0.471071, -0.469115, -0.467163, -0.46521, -0.463252,
-    -0.461297, -0.459345, -0.457391, -0.455434, -0.453478, -0.451526,
-    -0.449572, -0.447615, -0.445659, -0.443708, -0.441754, -0.439796,
-    -0.437841, -0.435889, -0.433935, -0.431977, -0.430022, -0.428071,
-    -0.426116, -0.424159, -0.422204, -0.420252, -0.418297, -0.41634,
-    -0.414385, -0.412433, -0.410479, -0.408521, -0.406567, -0.404615,
-    -0.40266, -0.400703, -0.398748, -0.396796, -0.394841, -0.392884,
-    -0.39093, -0.388978, -0.387022, -0.385065, -0.383111, -0.381159,
-    -0.379204, -0.377247, -0.375293, -0.373341, -0.371385, -0.369428,
-    -0.367474, -0.365522, -0.363566, -0.361609, -0.359656, -0.357703,
-    -0.355747, -0.353791, -0.351837, -0.349885, -0.347929, -0.345972,
-    -0.344019, -0.342066, -0.34011, -0.338153, -0.3362, -0.334248,
-    -0.332291, -0.330335, -0.328382, -0.326429, -0.324472, -0.322516,
-    -0.320564, -0.31861, -0.316654, -0.314698, -0.312745, -0.310792,
-    -0.308835, -0.306879, -0.304927, -0.302973, -0.301016, -0.299061,
-    -0.297108, -0.295154, -0.293198, -0.291242, -0.28929, -0.287336,
-    -0.285379, -0.283423, -0.281471, -0.279517, -0.27756, -0.275605,
-    -0.273652, -0.271698, -0.269741, -0.267786, -0.265834, -0.26388,
-    -0.261923, -0.259968, -0.258015, -0.256061, -0.254104, -0.252149,
-    -0.250197, -0.248242, -0.246285, -0.244331, -0.242378, -0.240424,
-    -0.238467, -0.236512, -0.23456, -0.232605, -0.230648, -0.228694,
-    -0.226741, -0.224786, -0.222829, -0.220875, -0.218923, -0.216967,
-    -0.215011, -0.213057, -0.211104, -0.209149, -0.207192, -0.205238,
-    -0.203286, -0.20133, -0.199373, -0.19742, -0.195467, -0.193511,
-    -0.191555, -0.189601, -0.187648, -0.185692, -0.183736, -0.181783,
-    -0.17983, -0.177874, -0.175917, -0.173964, -0.172011, -0.170055,
-    -0.168099, -0.166146, -0.164193, -0.162236, -0.16028, -0.158327,
-    -0.156374, -0.154418, -0.152461, -0.150509, -0.148555, -0.146599,
-    -0.144643, -0.14269, -0.140737, -0.13878, -0.136824, -0.134872,
-    -0.132918, -0.130961, -0.129006, -0.127053, -0.125099, -0.123143,
-    -0.121187, -0.119235, -0.117281, -0.115324, -0.113369, -0.111416,
-    -0.109462, -0.107505, -0.10555, -0.103598, -0.101643, -0.0996865,
-    -0.0977315, -0.095779, -0.0938246, -0.0918678, -0.089913, -0.0879605,
-    -0.0860059, -0.0840491, -0.0820944, -0.0801419, -0.0781872, -0.0762304,
-    -0.0742759, -0.0723234, -0.0703685, -0.0684117, -0.0664574, -0.0645048,
-    -0.0625498, -0.060593, -0.0586388, -0.0566863, -0.0547311, -0.0527743,
-    -0.0508203, -0.0488677, -0.0469124, -0.0449557, -0.0430018, -0.0410491,
-    -0.0390936, -0.037137, -0.0351833, -0.0332306, -0.0312749, -0.0293184,
-    -0.0273648, -0.025412, -0.0234562, -0.0214997, -0.0195463, -0.0175934,
-    -0.0156375, -0.0136811, -0.0117278, -0.00977478, -0.00781873, -0.00586245,
-    -0.00390925, -0.00195617
-};
-
-static const float WAVE_TRIANGLE_042[DEFAULT_WAVELEN] = {
-    0, 0.00195188, 0.00390635, 0.00586444, 0.00782499, 0.00978537,
-    0.011743, 0.0136971, 0.0156488, 0.0176009, 0.0195558, 0.0215143,
-    0.023475, 0.0254351, 0.0273924, 0.029346, 0.0312976, 0.0332499,
-    0.0352053, 0.0371642, 0.0391249, 0.0410849, 0.0430416, 0.0449949,
-    0.0469464, 0.048899, 0.0508548, 0.0528141, 0.0547749, 0.0567345,
-    0.0586909, 0.0606438, 0.0625953, 0.0645481, 0.0665044, 0.068464,
-    0.0704249, 0.0723842, 0.07434, 0.0762926, 0.0782441, 0.0801973,
-    0.0821541, 0.084114, 0.0860748, 0.0880337, 0.0899891, 0.0919414,
-    0.093893, 0.0958466, 0.0978037, 0.0997639, 0.101725, 0.103683,
-    0.105638, 0.10759, 0.109542, 0.111496, 0.113453, 0.115414,
-    0.117375, 0.119333, 0.121287, 0.123239, 0.125191, 0.127145,
-    0.129103, 0.131064, 0.133024, 0.134982, 0.136936, 0.138888,
-    0.14084, 0.142795, 0.144753, 0.146714, 0.148674, 0.150632,
-    0.152585, 0.154537, 0.156489, 0.158444, 0.160403, 0.162364,
-    0.164324, 0.166281, 0.168234, 0.170185, 0.172138, 0.174094,
-    0.176053, 0.178014, 0.179974, 0.18193, 0.183883, 0.185834,
-    0.187787, 0.189743, 0.191703, 0.193664, 0.195623, 0.197579,
-    0.199532, 0.201483, 0.203436, 0.205393, 0.207353, 0.209314,
-    0.211273, 0.213228, 0.215181, 0.217132, 0.219085, 0.221042,
-    0.223003, 0.224964, 0.226923, 0.228877, 0.230829, 0.232781,
-    0.234735, 0.236692, 0.238653, 0.240614, 0.242572, 0.244527,
-    0.246478, 0.24843, 0.250384, 0.252342, 0.254303, 0.256264,
-    0.258222, 0.260175, 0.262127, 0.264078, 0.266033, 0.267992,
-    0.269953, 0.271913, 0.273871, 0.275824, 0.277776, 0.279727,
-    0.281683, 0.283642, 0.285603, 0.287563, 0.28952, 0.291473,
-    0.293424, 0.295376, 0.297332, 0.299292, 0.301253, 0.303213,
-    0.30517, 0.307122, 0.309073, 0.311025, 0.312982, 0.314942,
-    0.316903, 0.318863, 0.320819, 0.322771, 0.324722, 0.326675,
-    0.328631, 0.330592, 0.332553, 0.334513, 0.336468, 0.33842,
-    0.340371, 0.342324, 0.344281, 0.346242, 0.348203, 0.350162,
-    0.352117, 0.354068, 0.356019, 0.357973, 0.359931, 0.361892,
-    0.363853, 0.365812, 0.367766, 0.369717, 0.371668, 0.373622,
-    0.37558, 0.377542, 0.379503, 0.381461, 0.383415, 0.385366,
-    0.387317, 0.389271, 0.39123, 0.393192, 0.395153, 0.397111,
-    0.399064, 0.401014, 0.402966, 0.404921, 0.40688, 0.408842,
-    0.410803, 0.41276, 0.414713, 0.416663, 0.418615, 0.42057,
-    0.42253, 0.424492, 0.426453, 0.428409, 0.430362, 0.432312,
-    0.434264, 0.43622, 0.43818, 0.440142, 0.442103, 0.444059,
-    0.44601, 0.44796, 0.449913, 0.451869, 0.45383, 0.455792,
-    0.457752, 0.459708, 0.461659, 0.463609, 0.465562, 0.467519,
-    0.46948, 0.471443, 0.473402, 0.475357, 0.477308, 0.479258,
-    0.481211, 0.483169, 0.48513, 0.487093, 0.489052, 0.491006,
-    0.492956, 0.494906, 0.49686, 0.498818, 0.500781, 0.502743,
-    0.504701, 0.506655, 0.508605, 0.510555, 0.512509, 0.514468,
-    0.516431, 0.518393, 0.520351, 0.522304, 0.524253, 0.526204,
-    0.528158, 0.530118, 0.532081, 0.534043, 0.536001, 0.537953,
-    0.539902, 0.541852, 0.543808, 0.545768, 0.547732, 0.549693,
-    0.55165, 0.553601, 0.55555, 0.557501, 0.559457, 0.561418,
-    0.563382, 0.565343, 0.567299, 0.56925, 0.571199, 0.57315,
-    0.575107, 0.577069, 0.579032, 0.580993, 0.582948, 0.584899,
-    0.586847, 0.588799, 0.590756, 0.592719, 0.594683, 0.596643,
-    0.598598, 0.600547, 0.602495, 0.604448, 0.606406, 0.608369,
-    0.610333, 0.612293, 0.614247, 0.616195, 0.618144, 0.620097,
-    0.622056, 0.62402, 0.625983, 0.627943, 0.629896, 0.631844,
-    0.633792, 0.635746, 0.637706, 0.63967, 0.641634, 0.643593,
-    0.645544, 0.647492, 0.649441, 0.651395, 0.653356, 0.655321,
-    0.657284, 0.659242, 0.661193, 0.66314, 0.665089, 0.667044,
-    0.669006, 0.670971, 0.672935, 0.674892, 0.676842, 0.678788,
-    0.680737, 0.682693, 0.684656, 0.686622, 0.688585, 0.690541,
-    0.69249, 0.694436, 0.696386, 0.698343, 0.700306, 0.702273,
-    0.704236, 0.706191, 0.708138, 0.710084, 0.712034, 0.713992,
-    0.715957, 0.717924, 0.719886, 0.72184, 0.723787, 0.725732,
-    0.727683, 0.729642, 0.731608, 0.733575, 0.735536, 0.737489,
-    0.739435, 0.74138, 0.743331, 0.745291, 0.747258, 0.749226,
-    0.751187, 0.753138, 0.755083, 0.757027, 0.758979, 0.760941,
-    0.762909, 0.764877, 0.766837, 0.768787, 0.77073, 0.772675,
-    0.774628, 0.776591, 0.778561, 0.780528, 0.782487, 0.784435,
-    0.786378, 0.788322, 0.790277, 0.792242, 0.794212, 0.79618,
-    0.798137, 0.800084, 0.802025, 0.80397, 0.805925, 0.807892,
-    0.809864, 0.811831, 0.813787, 0.815732, 0.817672, 0.819617,
-    0.821574, 0.823543, 0.825516, 0.827483, 0.829437, 0.83138,
-    0.833318, 0.835264, 0.837223, 0.839194, 0.841168, 0.843135,
-    0.845087, 0.847027, 0.848964, 0.85091, 0.852872, 0.854845,
-    0.856821, 0.858787, 0.860737, 0.862674, 0.86461, 0.866557,
-    0.868521, 0.870498, 0.872475, 0.87444, 0.876387, 0.878321,
-    0.880255, 0.882202, 0.88417, 0.88615, 0.88813, 0.890093,
-    0.892036, 0.893966, 0.895898, 0.897848, 0.899819, 0.901804,
-    0.903786, 0.905748, 0.907686, 0.90961, 0.91154, 0.913492,
-    0.915469, 0.91746, 0.919444, 0.921403, 0.923335, 0.925252,
-    0.927179, 0.929134, 0.931119, 0.933118, 0.935105, 0.937061,
-    0.938983, 0.940891, 0.942814, 0.944774, 0.946771, 0.948782,
-    0.950773, 0.952722, 0.954628, 0.956521, 0.958439, 0.960408,
-    0.962426, 0.964458, 0.966457, 0.968391, 0.970268, 0.972131,
-    0.974039, 0.97603, 0.978095, 0.980173, 0.982184, 0.984079,
-    0.985871, 0.987652, 0.989544, 0.991634, 0.993897, 0.996165,
-    0.998147, 0.999512, 1, 0.999512, 0.998147, 0.996165,
-    0.993897, 0.991634, 0.989544, 0.987652, 0.985871, 0.984079,
-    0.982184, 0.980173, 0.978095, 0.97603, 0.974039, 0.972131,
-    0.970268, 0.968391, 0.966457, 0.964458, 0.962426, 0.960408,
-    0.958439, 0.956521, 0.954628, 0.952722, 0.950773, 0.948782,
-    0.946771, 0.944774, 0.942814, 0.940891, 0.938983, 0.937061,
-    0.935105, 0.933118, 0.931119, 0.929134, 0.927179, 0.925252,
-    0.923335, 0.921403, 0.919444, 0.91746, 0.915469, 0.913492,
-    0.91154, 0.90961, 0.907686, 0.905748, 0.903786, 0.901804,
-    0.899819, 0.897848, 0.895898, 0.893966, 0.892036, 0.890093,
-    0.88813, 0.88615, 0.88417, 0.882202, 0.880255, 0.878321,
-    0.876387, 0.87444, 0.872475, 0.870498, 0.868521, 0.866557,
-    0.86461, 0.862674, 0.860737, 0.858787, 0.856821, 0.854845,
-    0.852872, 0.85091, 0.848964, 0.847027, 0.845087, 0.843135,
-    0.841168, 0.839194, 0.837223, 0.835264, 0.833318, 0.83138,
-    0.829437, 0.827483, 0.825516, 0.823543, 0.821574, 0.819617,
-    0.817672, 0.815732, 0.813787, 0.811831, 0.809864, 0.807892,
-    0.805925, 0.80397, 0.802025, 0.800084, 0.798137, 0.79618,
-    0.794212, 0.792242, 0.790277, 0.788322, 0.786378, 0.784435,
-    0.782487, 0.780528, 0.778561, 0.776591, 0.774628, 0.772675,
-    0.77073, 0.768787, 0.766837, 0.764877, 0.762909, 0.760941,
-    0.758979, 0.757027, 0.755083, 0.753138, 0.751187, 0.749226,
-    0.747258, 0.745291, 0.743331, 0.74138, 0.739435, 0.737489,
-    0.735536, 0.733575, 0.731608, 0.729642, 0.727683, 0.725732,
-    0.723787, 0.72184, 0.719886, 0.717924, 0.715957, 0.713992,
-    0.712034, 0.710084, 0.708138, 0.706191, 0.704236, 0.702273,
-    0.700306, 0.698343, 0.696386, 0.694436, 0.69249, 0.690541,
-    0.688585, 0.686622, 0.684656, 0.682693, 0.680737, 0.678788,
-    0.676842, 0.674892, 0.672935, 0.670971, 0.669006, 0.667044,
-    0.665089, 0.66314, 0.661193, 0.659242, 0.657284, 0.655321,
-    0.653356, 0.651395, 0.649441, 0.647492, 0.645544, 0.643593,
-    0.641634, 0.63967, 0.637706, 0.635746, 0.633792, 0.631844,
-    0.629896, 0.627943, 0.625983, 0.62402, 0.622056, 0.620097,
-    0.618144, 0.616195, 0.614247, 0.612293, 0.610333, 0.608369,
-    0.606406, 0.604448, 0.602495, 0.600547, 0.598598, 0.596643,
-    0.594683, 0.592719, 0.590756, 0.588799, 0.586847, 0.584899,
-    0.582948, 0.580993, 0.579032, 0.577069, 0.575107, 0.57315,
-    0.571199, 0.56925, 0.567299, 0.565343, 0.563382, 0.561418,
-    0.559457, 0.557501, 0.55555, 0.553601, 0.55165, 0.549693,
-    0.547732, 0.545768, 0.543808, 0.541852, 0.539902, 0.537953,
-    0.536001, 0.534043, 0.532081, 0.530118, 0.528158, 0.526204,
-    0.524253, 0.522304, 0.520351, 0.518393, 0.516431, 0.514468,
-    0.512509, 0.510555, 0.508605, 0.506655, 0.504701, 0.502743,
-    0.500781, 0.498818, 0.49686, 0.494906, 0.492956, 0.491006,
-    0.489052, 0.487093, 0.48513, 0.483169, 0.481211, 0.479258,
-    0.477308, 0.475357, 0.473402, 0.471443, 0.46948, 0.467519,
-    0.465562, 0.463609, 0.461659, 0.459708, 0.457752, 0.455792,
-    0.45383, 0.451869, 0.449913, 0.44796, 0.44601, 0.444059,
-    0.442103, 0.440142, 0.43818, 0.43622, 0.434264, 0.432312,
-    0.430362, 0.428409, 0.426453, 0.424492, 0.42253, 0.42057,
-    0.418615, 0.416663, 0.414713, 0.41276, 0.410803, 0.408842,
-    0.40688, 0.404921, 0.402966, 0.401014, 0.399064, 0.397111,
-    0.395153, 0.393192, 0.39123, 0.389271, 0.387317, 0.385366,
-    0.383415, 0.381461, 0.379503, 0.377542, 0.37558, 0.373622,
-    0.371668, 0.369717, 0.367766, 0.365812, 0.363853, 0.361892,
-    0.359931, 0.357973, 0.356019, 0.354068, 0.352117, 0.350162,
-    0.348203, 0.346242, 0.344281, 0.342324, 0.340371, 0.33842,
-    0.336468, 0.334513, 0.332553, 0.330592, 0.328631, 0.326675,
-    0.324722, 0.322771, 0.320819, 0.318863, 0.316903, 0.314942,
-    0.312982, 0.311025, 0.309073, 0.307122, 0.30517, 0.303213,
-    0.301253, 0.299292, 0.297332, 0.295376, 0.293424, 0.291473,
-    0.28952, 0.287563, 0.285603, 0.283642, 0.281683, 0.279727,
-    0.277776, 0.275824, 0.273871, 0.271913, 0.269953, 0.267992,
-    0.266033, 0.264078, 0.262127, 0.260175, 0.258222, 0.256264,
-    0.254303, 0.252342, 0.250384, 0.24843, 0.246478, 0.244527,
-    0.242572, 0.240614, 0.238653, 0.236692, 0.234735, 0.232781,
-    0.230829, 0.228877, 0.226923, 0.224964, 0.223003, 0.221042,
-    0.219085, 0.217132, 0.215181, 0.213228, 0.211273, 0.209314,
-    0.207353, 0.205393, 0.203436, 0.201483, 0.199532, 0.197579,
-    0.195623, 0.193664, 0.191703, 0.189743, 0.187787, 0.185834,
-    0.183883, 0.18193, 0.179974, 0.178014, 0.176053, 0.174094,
-    0.172138, 0.170185, 0.168234, 0.166281, 0.164324, 0.162364,
-    0.160403, 0.158444, 0.156489, 0.154537, 0.152585, 0.150632,
-    0.148674, 0.146714, 0.144753, 0.142795, 0.14084, 0.138888,
-    0.136936, 0.134982, 0.133024, 0.131064, 0.129103, 0.127145,
-    0.125191, 0.123239, 0.121287, 0.119333, 0.117375, 0.115414,
-    0.113453, 0.111496, 0.109542, 0.10759, 0.105638, 0.103683,
-    0.101725, 0.0997639, 0.0978037, 0.0958466, 0.093893, 0.0919414,
-    0.0899891, 0.0880337, 0.0860748, 0.084114, 0.0821541, 0.0801973,
-    0.0782441, 0.0762926, 0.07434, 0.0723842, 0.0704249, 0.068464,
-    0.0665044, 0.0645481, 0.0625953, 0.0606438, 0.0586909, 0.0567345,
-    0.0547749, 0.0528141, 0.0508548, 0.048899, 0.0469464, 0.0449949,
-    0.0430416, 0.0410849, 0.0391249, 0.0371642, 0.0352053, 0.0332499,
-    0.0312976, 0.029346, 0.0273924, 0.0254351, 0.023475, 0.0215143,
-    0.0195558, 0.0176009, 0.0156488, 0.0136971, 0.011743, 0.00978537,
-    0.00782499, 0.00586444, 0.00390635, 0.00195188, 0, -0.00195188,
-    -0.00390635, -0.00586444, -0.00782499, -0.00978537, -0.011743, -0.0136971,
-    -0.0156488, -0.0176009, -0.0195558, -0.0215143, -0.023475, -0.0254351,
-    -0.0273924, -0.029346, -0.0312976, -0.0332499, -0.0352053, -0.0371642,
-    -0.0391249, -0.0410849, -0.0430416, -0.0449949, -0.0469464, -0.048899,
-    -0.0508548, -0.0528141, -0.0547749, -0.0567345, -0.0586909, -0.0606438,
-    -0.0625953, -0.0645481, -0.0665044, -0.068464, -0.0704249, -0.0723842,
-    -0.07434, -0.0762926, -0.0782441, -0.0801973, -0.0821541, -0.084114,
-    -0.0860748, -0.0880337, -0.0899891, -0.0919414, -0.093893, -0.0958466,
-    -0.0978037, -0.0997639, -0.101725, -0.103683, -0.105638, -0.10759,
-    -0.109542, -0.111496, -0.113453, -0.115414, -0.117375, -0.119333,
-    -0.121287, -0.123239, -0.125191, -0.127145, -0.129103, -0.131064,
-    -0.133024, -0.134982, -0.136936, -0.138888, -0.14084, -0.142795,
-    -0.144753, -0.146714, -0.148674, -0.150632, -0.152585, -0.154537,
-    -0.156489, -0.158444, -0.160403, -0.162364, -0.164324, -0.166281,
-    -0.168234, -0.170185, -0.172138, -0.174094, -0.176053, -0.178014,
-    -0.179974, -0.18193, -0.183883, -0.185834, -0.187787, -0.189743,
-    -0.191703, -0.193664, -0.195623, -0.197579, -0.199532, -0.201483,
-    -0.203436, -0.205393, -0.207353, -0.209314, -0.211273, -0.213228,
-    -0.215181, -0.217132, -0.219085, -0.221042, -0.223003, -0.224964,
-    -0.226923, -0.228877, -0.230829, -0.232781, -0.234735, -0.236692,
-    -0.238653, -0.240614, -0.242572, -0.244527, -0.246478, -0.24843,
-    -0.250384, -0.252342, -0.254303, -0.256264, -0.258222, -0.260175,
-    -0.262127, -0.264078, -0.266033, -0.267992, -0.269953, -0.271913,
-    -0.273871, -0.275824, -0.277776, -0.279727, -0.281683, -0.283642,
-    -0.285603, -0.287563, -0.28952, -0.291473, -0.293424, -0.295376,
-    -0.297332, -0.299292, -0.301253, -0.303213, -0.30517, -0.307122,
-    -0.309073, -0.311025, -0.312982, -0.314942, -0.316903, -0.318863,
-    -0.320819, -0.322771, -0.324722, -0.326675, -0.328631, -0.330592,
-    -0.332553, -0.334513, -0.336468, -0.33842, -0.340371, -0.342324,
-    -0.344281, -0.346242, -0.348203, -0.350162, -0.352117, -0.354068,
-    -0.356019, -0.357973, -0.359931, -0.361892, -0.363853, -0.365812,
-    -0.367766, -0.369717, -0.371668, -0.373622, -0.37558, -0.377542,
-    -0.379503, -0.381461, -0.383415, -0.385366, -0.387317, -0.389271,
-    -0.39123, -0.393192, -0.395153, -0.397111, -0.399064, -0.401014,
-    -0.402966, -0.404921, -0.40688, -0.408842, -0.410803, -0.41276,
-    -0.414713, -0.416663, -0.418615, -0.42057, -0.42253, -0.424492,
-    -0.426453, -0.428409, -0.430362, -0.432312, -0.434264, -0.43622,
-    -0.43818, -0.440142, -0.442103, -0.444059, -0.44601, -0.44796,
-    -0.449913, -0.451869, -0.45383, -0.455792, -0.457752, -0.459708,
-    -0.461659, -0.463609, -0.465562, -0.467519, -0.46948, -0.471443,
-    -0.473402, -0.475357, -0.477308, -0.479258, -0.481211, -0.483169,
-    -0.48513, -0.487093, -0.489052, -0.491006, -0.492956, -0.494906,
-    -0.49686, -0.498818, -0.500781, -0.502743, -0.504701, -0.506655,
-    -0.508605, -0.510555, -0.512509, -0.514468, -0.516431, -0.518393,
-    -0.520351, -0.522304, -0.524253, -0.526204, -0.528158, -0.530118,
-    -0.532081, -0.534043, -0.536001, -0.537953, -0.539902, -0.541852,
-    -0.543808, -0.545768, -0.547732, -0.549693, -0.55165, -0.553601,
-    -0.55555, -0.557501, -0.559457, -0.561418, -0.563382, -0.565343,
-    -0.567299, -0.56925, -0.571199, -0.57315, -0.575107, -0.577069,
-    -0.579032, -0.580993, -0.582948, -0.584899, -0.586847, -0.588799,
-    -0.590756, -0.592719, -0.594683, -0.596643, -0.598598, -0.600547,
-    -0.602495, -0.604448, -0.606406, -0.608369, -0.610333, -0.612293,
-    -0.614247, -0.616195, -0.618144, -0.620097, -0.622056, -0.62402,
-    -0.625983, -0.627943, -0.629896, -0.631844, -0.633792, -0.635746,
-    -0.637706, -0.63967, -0.641634, -0.643593, -0.645544, -0.647492,
-    -0.649441, -0.651395, -0.653356, -0.655321, -0.657284, -0.659242,
-    -0.661193, -0.66314, -0.665089, -0.667044, -0.669006, -0.670971,
-    -0.672935, -0.674892, -0.676842, -0.678788, -0.680737, -0.682693,
-    -0.684656, -0.686622, -0.688585, -0.690541, -0.69249, -0.694436,
-    -0.696386, -0.698343, -0.700306, -0.702273, -0.704236, -0.706191,
-    -0.708138, -0.710084, -0.712034, -0.713992, -0.715957, -0.717924,
-    -0.719886, -0.72184, -0.723787, -0.725732, -0.727683, -0.729642,
-    -0.731608, -0.733575, -0.735536, -0.737489, -0.739435, -0.74138,
-    -0.743331, -0.745291, -0.747258, -0.749226, -0.751187, -0.753138,
-    -0.755083, -0.757027, -0.758979, -0.760941, -0.762909, -0.764877,
-    -0.766837, -0.768787, -0.77073, -0.772675, -0.774628, -0.776591,
-    -0.778561, -0.780528, -0.782487, -0.784435, -0.786378, -0.788322,
-    -0.790277, -0.792242, -0.794212, -0.79618, -0.798137, -0.800084,
-    -0.802025, -0.80397, -0.805925, -0.807892, -0.809864, -0.811831,
-    -0.813787, -0.815732, -0.817672, -0.819617, -0.821574, -0.823543,
-    -0.825516, -0.827483, -0.829437, -0.83138, -0.833318, -0.835264,
-    -0.837223, -0.839194, -0.841168, -0.843135, -0.845087, -0.847027,
-    -0.848964, -0.85091, -0.852872, -0.854845, -0.856821, -0.858787,
-    -0.860737, -0.862674, -0.86461, -0.866557, -0.868521, -0.870498,
-    -0.872475, -0.87444, -0.876387, -0.878321, -0.880255, -0.882202,
-    -0.88417, -0.88615, -0.88813, -0.890093, -0.892036, -0.893966,
-    -0.895898, -0.897848, -0.899819, -0.901804, -0.903786, -0.905748,
-    -0.907686, -0.90961, -0.91154, -0.913492, -0.915469, -0.91746,
-    -0.919444, -0.921403, -0.923335, -0.925252, -0.927179, -0.929134,
-    -0.931119, -0.933118, -0.935105, -0.937061, -0.938983, -0.940891,
-    -0.942814, -0.944774, -0.946771, -0.948782, -0.950773, -0.952722,
-    -0.954628, -0.956521, -0.958439, -0.960408, -0.962426, -0.964458,
-    -0.966457, -0.968391, -0.970268, -0.972131, -0.974039, -0.97603,
-    -0.978095, -0.980173, -0.982184, -0.984079, -0.985871, -0.987652,
-    -0.989544, -0.991634, -0.993897, -0.996165, -0.998147, -0.999512,
-    -1, -0.999512, -0.998147, -0.996165, -0.993897, -0.991634,
-    -0.989544, -0.987652, -0.985871, -0.984079, -0.982184, -0.980173,
-    -0.978095, -0.97603, -0.974039, -0.972131, -0.970268, -0.968391,
-    -0.966457, -0.964458, -0.962426, -0.960408, -0.958439, -0.956521,
-    -0.954628, -0.952722, -0.950773, -0.948782, -0.946771, -0.944774,
-    -0.942814, -0.940891, -0.938983, -0.937061, -0.935105, -0.933118,
-    -0.931119, -0.929134, -0.927179, -0.925252, -0.923335, -0.921403,
-    -0.919444, -0.91746, -0.915469, -0.913492, -0.91154, -0.90961,
-    -0.907686, -0.905748, -0.903786, -0.901804, -0.899819, -0.897848,
-    -0.895898, -0.893966, -0.892036, -0.890093, -0.88813, -0.88615,
-    -0.88417, -0.882202, -0.880255, -0.878321, -0.876387, -0.87444,
-    -0.872475, -0.870498, -0.868521, -0.866557, -0.86461, -0.862674,
-    -0.860737, -0.858787, -0.856821, -0.854845, -0.852872, -0.85091,
-    -0.848964, -0.847027, -0.845087, -0.843135, -0.841168, -0.839194,
-    -0.837223, -0.835264, -0.833318, -0.83138, -0.829437, -0.827483,
-    -0.825516, -0.823543, -0.821574, -0.819617, -0.817672, -0.815732,
-    -0.813787, -0.811831, -0.809864, -0.807892, -0.805925, -0.80397,
-    -0.802025, -0.800084, -0.798137, -0.79618, -0.794212, -0.792242,
-    -0.790277, -0.788322, -0.786378, -0.784435, -0.782487, -0.780528,
-    -0.778561, -0.776591, -0.774628, -0.772675, -0.77073, -0.768787,
-    -0.766837, -0.764877, -0.762909, -0.760941, -0.758979, -0.757027,
-    -0.755083, -0.753138, -0.751187, -0.749226, -0.747258, -0.745291,
-    -0.743331, -0.74138, -0.739435, -0.737489, -0.735536, -0.733575,
-    -0.731608, -0.729642, -0.727683, -0.725732, -0.723787, -0.72184,
-    -0.719886, -0.717924, -0.715957, -0.713992, -0.712034, -0.710084,
-    -0.708138, -0.706191, -0.704236, -0.702273, -0.700306, -0.698343,
-    -0.696386, -0.694436, -0.69249, -0.690541, -0.688585, -0.686622,
-    -0.684656, -0.682693, -0.680737, -0.678788, -0.676842, -0.674892,
-    -0.672935, -0.670971, -0.669006, -0.667044, -0.665089, -0.66314,
-    -0.661193, -0.659242, -0.657284, -0.655321, -0.653356, -0.651395,
-    -0.649441, -0.647492, -0.645544, -0.643593, -0.641634, -0.63967,
-    -0.637706, -0.635746, -0.633792, -0.631844, -0.629896, -0.627943,
-    -0.625983, -0.62402, -0.622056, -0.620097, -0.618144, -0.616195,
-    -0.614247, -0.612293, -0.610333, -0.608369, -0.606406, -0.604448,
-    -0.602495, -0.600547, -0.598598, -0.596643, -0.594683, -0.592719,
-    -0.590756, -0.588799, -0.586847, -0.584899, -0.582948, -0.580993,
-    -0.579032, -0.577069, -0.575107, -0.57315, -0.571199, -0.56925,
-    -0.567299, -0.565343, -0.563382, -0.561418, -0.559457, -0.557501,
-    -0.55555, -0.553601, -0.55165, -0.549693, -0.547732, -0.545768,
-    -0.543808, -0.541852, -0.539902, -0.537953, -0.536001, -0.534043,
-    -0.532081, -0.530118, -0.528158, -0.526204, -0.524253, -0.522304,
-    -0.520351, -0.518393, -0.516431, -0.514468, -0.512509, -0.510555,
-    -0.508605, -0.506655, -0.504701, -0.502743, -0.500781, -0.498818,
-    -0.49686, -0.494906, -0.492956, -0.491006, -0.489052, -0.487093,
-    -0.48513, -0.483169, -0.481211, -0.479258, -0.477308, -0.475357,
-    -0.473402, -0.471443, -0.46948, -0.467519, -0.465562, -0.463609,
-    -0.461659, -0.459708, -0.457752, -0.455792, -0.45383, -0.451869,
-    -0.449913, -0.44796, -0.44601, -0.444059, -0.442103, -0.440142,
-    -0.43818, -0.43622, -0.434264, -0.432312, -0.430362, -0.428409,
-    -0.426453, -0.424492, -0.42253, -0.42057, -0.418615, -0.416663,
-    -0.414713, -0.41276, -0.410803, -0.408842, -0.40688, -0.404921,
-    -0.402966, -0.401014, -0.399064, -0.397111, -0.395153, -0.393192,
-    -0.39123, -0.389271, -0.387317, -0.385366, -0.383415, -0.381461,
-    -0.379503, -0.377542, -0.37558, -0.373622, -0.371668, -0.369717,
-    -0.367766, -0.365812, -0.363853, -0.361892, -0.359931, -0.357973,
-    -0.356019, -0.354068, -0.352117, -0.350162, -0.348203, -0.346242,
-    -0.344281, -0.342324, -0.340371, -0.33842, -0.336468, -0.334513,
-    -0.332553, -0.330592, -0.328631, -0.326675, -0.324722, -0.322771,
-    -0.320819, -0.318863, -0.316903, -0.314942, -0.312982, -0.311025,
-    -0.309073, -0.307122, -0.30517, -0.303213, -0.301253, -0.299292,
-    -0.297332, -0.295376, -0.293424, -0.291473, -0.28952, -0.287563,
-    -0.285603, -0.283642, -0.281683, -0.279727, -0.277776, -0.275824,
-    -0.273871, -0.271913, -0.269953, -0.267992, -0.266033, -0.264078,
-    -0.262127, -0.260175, -0.258222, -0.256264, -0.254303, -0.252342,
-    -0.250384, -0.24843, -0.246478, -0.244527, -0.242572, -0.240614,
-    -0.238653, -0.236692, -0.234735, -0.232781, -0.230829, -0.228877,
-    -0.226923, -0.224964, -0.223003, -0.221042, -0.219085, -0.217132,
-    -0.215181, -0.213228, -0.211273, -0.209314, -0.207353, -0.205393,
-    -0.203436, -0.201483, -0.199532, -0.197579, -0.195623, -0.193664,
-    -0.191703, -0.189743, -0.187787, -0.185834, -0.183883, -0.18193,
-    -0.179974, -0.178014, -0.176053, -0.174094, -0.172138, -0.170185,
-    -0.168234, -0.166281, -0.164324, -0.162364, -0.160403, -0.158444,
-    -0.156489, -0.154537, -0.152585, -0.150632, -0.148674, -0.146714,
-    -0.144753, -0.142795, -0.14084, -0.138888, -0.136936, -0.134982,
-    -0.133024, -0.131064, -0.129103, -0.127145, -0.125191, -0.123239,
-    -0.121287, -0.119333, -0.117375, -0.115414, -0.113453, -0.111496,
-    -0.109542, -0.10759, -0.105638, -0.103683, -0.101725, -0.0997639,
-    -0.0978037, -0.0958466, -0.093893, -0.0919414, -0.0899891, -0.0880337,
-    -0.0860748, -0.084114, -0.0821541, -0.0801973, -0.0782441, -0.0762926,
-    -0.07434, -0.0723842, -0.0704249, -0.068464, -0.0665044, -0.0645481,
-    -0.0625953, -0.0606438, -0.0586909, -0.0567345, -0.0547749, -0.0528141,
-    -0.0508548, -0.048899, -0.0469464, -0.0449949, -0.0430416, -0.0410849,
-    -0.0391249, -0.0371642, -0.0352053, -0.0332499, -0.0312976, -0.029346,
-    -0.0273924, -0.0254351, -0.023475, -0.0215143, -0.0195558, -0.0176009,
-    -0.0156488, -0.0136971, -0.011743, -0.00978537, -0.00782499, -0.00586444,
-    -0.00390635, -0.00195188
-};
-
-static const float WAVE_TRIANGLE_054[DEFAULT_WAVELEN] = {
-    0, 0.00196857, 0.00393568, 0.00590009, 0.00786098, 0.00981809,
-    0.0117718, 0.0137229, 0.0156727, 0.0176227, 0.0195743, 0.0215288,
-    0.0234868, 0.0254486, 0.0274138, 0.0293814, 0.0313501, 0.0333185,
-    0.035285, 0.0372486, 0.0392086, 0.0411648, 0.0431177, 0.0450683,
-    0.047018, 0.0489683, 0.0509205, 0.0528758, 0.0548347, 0.0567975,
-    0.0587634, 0.0607314, 0.0627002, 0.0646683, 0.0666342, 0.068597,
-    0.070556, 0.0725113, 0.0744635, 0.0764137, 0.0783634, 0.080314,
-    0.0822668, 0.0842229, 0.0861829, 0.0881465, 0.090113, 0.0920815,
-    0.0940503, 0.096018, 0.0979833, 0.0999452, 0.101903, 0.103858,
-    0.105809, 0.107759, 0.109709, 0.11166, 0.113613, 0.11557,
-    0.117531, 0.119496, 0.121463, 0.123432, 0.1254, 0.127368,
-    0.129332, 0.131293, 0.13325, 0.135204, 0.137155, 0.139104,
-    0.141054, 0.143006, 0.14496, 0.146918, 0.14888, 0.150845,
-    0.152813, 0.154782, 0.15675, 0.158717, 0.160681, 0.162641,
-    0.164597, 0.16655, 0.1685, 0.17045, 0.1724, 0.174352,
-    0.176307, 0.178266, 0.180228, 0.182194, 0.184163, 0.186132,
-    0.1881, 0.190067, 0.19203, 0.193989, 0.195944, 0.197896,
-    0.199846, 0.201795, 0.203745, 0.205698, 0.207654, 0.209613,
-    0.211577, 0.213544, 0.215513, 0.217482, 0.21945, 0.221416,
-    0.223378, 0.225336, 0.22729, 0.229242, 0.231191, 0.23314,
-    0.235091, 0.237044, 0.239001, 0.240962, 0.242926, 0.244894,
-    0.246863, 0.248833, 0.2508, 0.252765, 0.254726, 0.256683,
-    0.258637, 0.260587, 0.262536, 0.264485, 0.266436, 0.26839,
-    0.270348, 0.27231, 0.274275, 0.276244, 0.278214, 0.280183,
-    0.28215, 0.284114, 0.286075, 0.28803, 0.289983, 0.291933,
-    0.293881, 0.29583, 0.297782, 0.299736, 0.301695, 0.303658,
-    0.305625, 0.307594, 0.309564, 0.311533, 0.3135, 0.315463,
-    0.317422, 0.319377, 0.321329, 0.323278, 0.325226, 0.327175,
-    0.329127, 0.331083, 0.333043, 0.335007, 0.336975, 0.338944,
-    0.340915, 0.342884, 0.34485, 0.346812, 0.34877, 0.350724,
-    0.352674, 0.354623, 0.356571, 0.35852, 0.360473, 0.36243,
-    0.364391, 0.366356, 0.368324, 0.370295, 0.372265, 0.374234,
-    0.3762, 0.378161, 0.380118, 0.38207, 0.38402, 0.385968,
-    0.387916, 0.389866, 0.391819, 0.393776, 0.395739, 0.397705,
-    0.399675, 0.401645, 0.403616, 0.405584, 0.407549, 0.409509,
-    0.411465, 0.413417, 0.415365, 0.417312, 0.41926, 0.421211,
-    0.423165, 0.425123, 0.427087, 0.429054, 0.431025, 0.432996,
-    0.434967, 0.436935, 0.438899, 0.440858, 0.442812, 0.444762,
-    0.44671, 0.448657, 0.450605, 0.452556, 0.454511, 0.456471,
-    0.458435, 0.460404, 0.462375, 0.464347, 0.466318, 0.468285,
-    0.470248, 0.472206, 0.474159, 0.476108, 0.478055, 0.480001,
-    0.481949, 0.4839, 0.485857, 0.487818, 0.489784, 0.491754,
-    0.493726, 0.495699, 0.497669, 0.499636, 0.501598, 0.503554,
-    0.505506, 0.507453, 0.509399, 0.511345, 0.513293, 0.515245,
-    0.517203, 0.519165, 0.521133, 0.523104, 0.525078, 0.52705,
-    0.52902, 0.530986, 0.532947, 0.534902, 0.536852, 0.538798,
-    0.540743, 0.542689, 0.544637, 0.54659, 0.548549, 0.550513,
-    0.552483, 0.554455, 0.556429, 0.558402, 0.560372, 0.562337,
-    0.564296, 0.566249, 0.568198, 0.570143, 0.572087, 0.574032,
-    0.575981, 0.577935, 0.579895, 0.581861, 0.583832, 0.585806,
-    0.587781, 0.589754, 0.591724, 0.593688, 0.595645, 0.597597,
-    0.599543, 0.601487, 0.60343, 0.605375, 0.607325, 0.60928,
-    0.611242, 0.61321, 0.615182, 0.617158, 0.619134, 0.621107,
-    0.623076, 0.625038, 0.626994, 0.628944, 0.630888, 0.63283,
-    0.634773, 0.636718, 0.638668, 0.640625, 0.642588, 0.644558,
-    0.646533, 0.64851, 0.650487, 0.65246, 0.654428, 0.656389,
-    0.658343, 0.66029, 0.662233, 0.664173, 0.666115, 0.66806,
-    0.670011, 0.671969, 0.673935, 0.675907, 0.677885, 0.679863,
-    0.681841, 0.683814, 0.685781, 0.68774, 0.689692, 0.691636,
-    0.693576, 0.695515, 0.697456, 0.699401, 0.701353, 0.703313,
-    0.705282, 0.707257, 0.709237, 0.711217, 0.713196, 0.715169,
-    0.717135, 0.719091, 0.72104, 0.722982, 0.724919, 0.726856,
-    0.728796, 0.730741, 0.732695, 0.734657, 0.736629, 0.738608,
-    0.74059, 0.742573, 0.744552, 0.746525, 0.748489, 0.750443,
-    0.752388, 0.754326, 0.756261, 0.758195, 0.760134, 0.76208,
-    0.764035, 0.766001, 0.767977, 0.769959, 0.771945, 0.77393,
-    0.77591, 0.777882, 0.779844, 0.781795, 0.783736, 0.78567,
-    0.787601, 0.789532, 0.79147, 0.793417, 0.795375, 0.797344,
-    0.799324, 0.801311, 0.803302, 0.80529, 0.807271, 0.809242,
-    0.811201, 0.813148, 0.815083, 0.817012, 0.818938, 0.820866,
-    0.822803, 0.824751, 0.826712, 0.828687, 0.830673, 0.832666,
-    0.834662, 0.836653, 0.838636, 0.840606, 0.842561, 0.844501,
-    0.84643, 0.848351, 0.850271, 0.852195, 0.85413, 0.85608,
-    0.858046, 0.860028, 0.862023, 0.864025, 0.866027, 0.868024,
-    0.870008, 0.871976, 0.873925, 0.875856, 0.877774, 0.879685,
-    0.881596, 0.883515, 0.885448, 0.887401, 0.889374, 0.891367,
-    0.893375, 0.89539, 0.897404, 0.899407, 0.901393, 0.903357,
-    0.905296, 0.907214, 0.909115, 0.911009, 0.912906, 0.914815,
-    0.916747, 0.918705, 0.920692, 0.922704, 0.924734, 0.926772,
-    0.928804, 0.93082, 0.932808, 0.934763, 0.936684, 0.938574,
-    0.940443, 0.942305, 0.944174, 0.946067, 0.947996, 0.949969,
-    0.951985, 0.95404, 0.956121, 0.958209, 0.960283, 0.962324,
-    0.964313, 0.966241, 0.968107, 0.96992, 0.971698, 0.97347,
-    0.975265, 0.977118, 0.979056, 0.981096, 0.983241, 0.985479,
-    0.987775, 0.990078, 0.992318, 0.994417, 0.996288, 0.997848,
-    0.999022, 0.999752, 1, 0.999752, 0.999022, 0.997848,
-    0.996288, 0.994417, 0.992318, 0.990078, 0.987775, 0.985479,
-    0.983241, 0.981096, 0.979056, 0.977118, 0.975265, 0.97347,
-    0.971698, 0.96992, 0.968107, 0.966241, 0.964313, 0.962324,
-    0.960283, 0.958209, 0.956121, 0.95404, 0.951985, 0.949969,
-    0.947996, 0.946067, 0.944174, 0.942305, 0.940443, 0.938574,
-    0.936684, 0.934763, 0.932808, 0.93082, 0.928804, 0.926772,
-    0.924734, 0.922704, 0.920692, 0.918705, 0.916747, 0.914815,
-    0.912906, 0.911009, 0.909115, 0.907214, 0.905296, 0.903357,
-    0.901393, 0.899407, 0.897404, 0.89539, 0.893375, 0.891367,
-    0.889374, 0.887401, 0.885448, 0.883515, 0.881596, 0.879685,
-    0.877774, 0.875856, 0.873925, 0.871976, 0.870008, 0.868024,
-    0.866027, 0.864025, 0.862023, 0.860028, 0.858046, 0.85608,
-    0.85413, 0.852195, 0.850271, 0.848351, 0.84643, 0.844501,
-    0.842561, 0.840606, 0.838636, 0.836653, 0.834662, 0.832666,
-    0.830673, 0.828687, 0.826712, 0.824751, 0.822803, 0.820866,
-    0.818938, 0.817012, 0.815083, 0.813148, 0.811201, 0.809242,
-    0.807271, 0.80529, 0.803302, 0.801311, 0.799324, 0.797344,
-    0.795375, 0.793417, 0.79147, 0.789532, 0.787601, 0.78567,
-    0.783736, 0.781795, 0.779844, 0.777882, 0.77591, 0.77393,
-    0.771945, 0.769959, 0.767977, 0.766001, 0.764035, 0.76208,
-    0.760134, 0.758195, 0.756261, 0.754326, 0.752388, 0.750443,
-    0.748489, 0.746525, 0.744552, 0.742573, 0.74059, 0.738608,
-    0.736629, 0.734657, 0.732695, 0.730741, 0.728796, 0.726856,
-    0.724919, 0.722982, 0.72104, 0.719091, 0.717135, 0.715169,
-    0.713196, 0.711217, 0.709237, 0.707257, 0.705282, 0.703313,
-    0.701353, 0.699401, 0.697456, 0.695515, 0.693576, 0.691636,
-    0.689692, 0.68774, 0.685781, 0.683814, 0.681841, 0.679863,
-    0.677885, 0.675907, 0.673935, 0.671969, 0.670011, 0.66806,
-    0.666115, 0.664173, 0.662233, 0.66029, 0.658343, 0.656389,
-    0.654428, 0.65246, 0.650487, 0.64851, 0.646533, 0.644558,
-    0.642588, 0.640625, 0.638668, 0.636718, 0.634773, 0.63283,
-    0.630888, 0.628944, 0.626994, 0.625038, 0.623076, 0.621107,
-    0.619134, 0.617158, 0.615182, 0.61321, 0.611242, 0.60928,
-    0.607325, 0.605375, 0.60343, 0.601487, 0.599543, 0.597597,
-    0.595645, 0.593688, 0.591724, 0.589754, 0.587781, 0.585806,
-    0.583832, 0.581861, 0.579895, 0.577935, 0.575981, 0.574032,
-    0.572087, 0.570143, 0.568198, 0.566249, 0.564296, 0.562337,
-    0.560372, 0.558402, 0.556429, 0.554455, 0.552483, 0.550513,
-    0.548549, 0.54659, 0.544637, 0.542689, 0.540743, 0.538798,
-    0.536852, 0.534902, 0.532947, 0.530986, 0.52902, 0.52705,
-    0.525078, 0.523104, 0.521133, 0.519165, 0.517203, 0.515245,
-    0.513293, 0.511345, 0.509399, 0.507453, 0.505506, 0.503554,
-    0.501598, 0.499636, 0.497669, 0.495699, 0.493726, 0.491754,
-    0.489784, 0.487818, 0.485857, 0.4839, 0.481949, 0.480001,
-    0.478055, 0.476108, 0.474159, 0.472206, 0.470248, 0.468285,
-    0.466318, 0.464347, 0.462375, 0.460404, 0.458435, 0.456471,
-    0.454511, 0.452556, 0.450605, 0.448657, 0.44671, 0.444762,
-    0.442812, 0.440858, 0.438899, 0.436935, 0.434967, 0.432996,
-    0.431025, 0.429054, 0.427087, 0.425123, 0.423165, 0.421211,
-    0.41926, 0.417312, 0.415365, 0.413417, 0.411465, 0.409509,
-    0.407549, 0.405584, 0.403616, 0.401645, 0.399675, 0.397705,
-    0.395739, 0.393776, 0.391819, 0.389866, 0.387916, 0.385968,
-    0.38402, 0.38207, 0.380118, 0.378161, 0.3762, 0.374234,
-    0.372265, 0.370295, 0.368324, 0.366356, 0.364391, 0.36243,
-    0.360473, 0.35852, 0.356571, 0.354623, 0.352674, 0.350724,
-    0.34877, 0.346812, 0.34485, 0.342884, 0.340915, 0.338944,
-    0.336975, 0.335007, 0.333043, 0.331083, 0.329127, 0.327175,
-    0.325226, 0.323278, 0.321329, 0.319377, 0.317422, 0.315463,
-    0.3135, 0.311533, 0.309564, 0.307594, 0.305625, 0.303658,
-    0.301695, 0.299736, 0.297782, 0.29583, 0.293881, 0.291933,
-    0.289983, 0.28803, 0.286075, 0.284114, 0.28215, 0.280183,
-    0.278214, 0.276244, 0.274275, 0.27231, 0.270348, 0.26839,
-    0.266436, 0.264485, 0.262536, 0.260587, 0.258637, 0.256683,
-    0.254726, 0.252765, 0.2508, 0.248833, 0.246863, 0.244894,
-    0.242926, 0.240962, 0.239001, 0.237044, 0.235091, 0.23314,
-    0.231191, 0.229242, 0.22729, 0.225336, 0.223378, 0.221416,
-    0.21945, 0.217482, 0.215513, 0.213544, 0.211577, 0.209613,
-    0.207654, 0.205698, 0.203745, 0.201795, 0.199846, 0.197896,
-    0.195944, 0.193989, 0.19203, 0.190067, 0.1881, 0.186132,
-    0.184163, 0.182194, 0.180228, 0.178266, 0.176307, 0.174352,
-    0.1724, 0.17045, 0.1685, 0.16655, 0.164597, 0.162641,
-    0.160681, 0.158717, 0.15675, 0.154782, 0.152813, 0.150845,
-    0.14888, 0.146918, 0.14496, 0.143006, 0.141054, 0.139104,
-    0.137155, 0.135204, 0.13325, 0.131293, 0.129332, 0.127368,
-    0.1254, 0.123432, 0.121463, 0.119496, 0.117531, 0.11557,
-    0.113613, 0.11166, 0.109709, 0.107759, 0.105809, 0.103858,
-    0.101903, 0.0999452, 0.0979833, 0.096018, 0.0940503, 0.0920815,
-    0.090113, 0.0881465, 0.0861829, 0.0842229, 0.0822668, 0.080314,
-    0.0783634, 0.0764137, 0.0744635, 0.0725113, 0.070556, 0.068597,
-    0.0666342, 0.0646683, 0.0627002, 0.0607314, 0.0587634, 0.0567975,
-    0.0548347, 0.0528758, 0.0509205, 0.0489683, 0.047018, 0.0450683,
-    0.0431177, 0.0411648, 0.0392086, 0.0372486, 0.035285, 0.0333185,
-    0.0313501, 0.0293814, 0.0274138, 0.0254486, 0.0234868, 0.0215288,
-    0.0195743, 0.0176227, 0.0156727, 0.0137229, 0.0117718, 0.00981809,
-    0.00786098, 0.00590009, 0.00393568, 0.00196857, 0, -0.00196857,
-    -0.00393568, -0.00590009, -0.00786098, -0.00981809, -0.0117718, -0.0137229,
-    -0.0156727, -0.0176227, -0.0195743, -0.0215288, -0.0234868, -0.0254486,
-    -0.0274138, -0.0293814, -0.0313501, -0.0333185, -0.035285, -0.0372486,
-    -0.0392086, -0.0411648, -0.0431177, -0.0450683, -0.047018, -0.0489683,
-    -0.0509205, -0.0528758, -0.0548347, -0.0567975, -0.0587634, -0.0607314,
-    -0.0627002, -0.0646683, -0.0666342, -0.068597, -0.070556, -0.0725113,
-    -0.0744635, -0.0764137, -0.0783634, -0.080314, -0.0822668, -0.0842229,
-    -0.0861829, -0.0881465, -0.090113, -0.0920815, -0.0940503, -0.096018,
-    -0.0979833, -0.0999452, -0.101903, -0.103858, -0.105809, -0.107759,
-    -0.109709, -0.11166, -0.113613, -0.11557, -0.117531, -0.119496,
-    -0.121463, -0.123432, -0.1254, -0.127368, -0.129332, -0.131293,
-    -0.13325, -0.135204, -0.137155, -0.139104, -0.141054, -0.143006,
-    -0.14496, -0.146918, -0.14888, -0.150845, -0.152813, -0.154782,
-    -0.15675, -0.158717, -0.160681, -0.162641, -0.164597, -0.16655,
-    -0.1685, -0.17045, -0.1724, -0.174352, -0.176307, -0.178266,
-    -0.180228, -0.182194, -0.184163, -0.186132, -0.1881, -0.190067,
-    -0.19203, -0.193989, -0.195944, -0.197896, -0.199846, -0.201795,
-    -0.203745, -0.205698, -0.207654, -0.209613, -0.211577, -0.213544,
-    -0.215513, -0.217482, -0.21945, -0.221416, -0.223378, -0.225336,
-    -0.22729, -0.229242, -0.231191, -0.23314, -0.235091, -0.237044,
-    -0.239001, -0.240962, -0.242926, -0.244894, -0.246863, -0.248833,
-    -0.2508, -0.252765, -0.254726, -0.256683, -0.258637, -0.260587,
-    -0.262536, -0.264485, -0.266436, -0.26839, -0.270348, -0.27231,
-    -0.274275, -0.276244, -0.278214, -0.280183, -0.28215, -0.284114,
-    -0.286075, -0.28803, -0.289983, -0.291933, -0.293881, -0.29583,
-    -0.297782, -0.299736, -0.301695, -0.303658, -0.305625, -0.307594,
-    -0.309564, -0.311533, -0.3135, -0.315463, -0.317422, -0.319377,
-    -0.321329, -0.323278, -0.325226, -0.327175, -0.329127, -0.331083,
-    -0.333043, -0.335007, -0.336975, -0.338944, -0.340915, -0.342884,
-    -0.34485, -0.346812, -0.34877, -0.350724, -0.352674, -0.354623,
-    -0.356571, -0.35852, -0.360473, -0.36243, -0.364391, -0.366356,
-    -0.368324, -0.370295, -0.372265, -0.374234, -0.3762, -0.378161,
-    -0.380118, -0.38207, -0.38402, -0.385968, -0.387916, -0.389866,
-    -0.391819, -0.393776, -0.395739, -0.397705, -0.399675, -0.401645,
-    -0.403616, -0.405584, -0.407549, -0.409509, -0.411465, -0.413417,
-    -0.415365, -0.417312, -0.41926, -0.421211, -0.423165, -0.425123,
-    -0.427087, -0.429054, -0.431025, -0.432996, -0.434967, -0.436935,
-    -0.438899, -0.440858, -0.442812, -0.444762, -0.44671, -0.448657,
-    -0.450605, -0.452556, -0.454511, -0.456471, -0.458435, -0.460404,
-    -0.462375, -0.464347, -0.466318, -0.468285, -0.470248, -0.472206,
-    -0.474159, -0.476108, -0.478055, -0.480001, -0.481949, -0.4839,
-    -0.485857, -0.487818, -0.489784, -0.491754, -0.493726, -0.495699,
-    -0.497669, -0.499636, -0.501598, -0.503554, -0.505506, -0.507453,
-    -0.509399, -0.511345, -0.513293, -0.515245, -0.517203, -0.519165,
-    -0.521133, -0.523104, -0.525078, -0.52705, -0.52902, -0.530986,
-    -0.532947, -0.534902, -0.536852, -0.538798, -0.540743, -0.542689,
-    -0.544637, -0.54659, -0.548549, -0.550513, -0.552483, -0.554455,
-    -0.556429, -0.558402, -0.560372, -0.562337, -0.564296, -0.566249,
-    -0.568198, -0.570143, -0.572087, -0.574032, -0.575981, -0.577935,
-    -0.579895, -0.581861, -0.583832, -0.585806, -0.587781, -0.589754,
-    -0.591724, -0.593688, -0.595645, -0.597597, -0.599543, -0.601487,
-    -0.60343, -0.605375, -0.607325, -0.60928, -0.611242, -0.61321,
-    -0.615182, -0.617158, -0.619134, -0.621107, -0.623076, -0.625038,
-    -0.626994, -0.628944, -0.630888, -0.63283, -0.634773, -0.636718,
-    -0.638668, -0.640625, -0.642588, -0.644558, -0.646533, -0.64851,
-    -0.650487, -0.65246, -0.654428, -0.656389, -0.658343, -0.66029,
-    -0.662233, -0.664173, -0.666115, -0.66806, -0.670011, -0.671969,
-    -0.673935, -0.675907, -0.677885, -0.679863, -0.681841, -0.683814,
-    -0.685781, -0.68774, -0.689692, -0.691636, -0.693576, -0.695515,
-    -0.697456, -0.699401, -0.701353, -0.703313, -0.705282, -0.707257,
-    -0.709237, -0.711217, -0.713196, -0.715169, -0.717135, -0.719091,
-    -0.72104, -0.722982, -0.724919, -0.726856, -0.728796, -0.730741,
-    -0.732695, -0.734657, -0.736629, -0.738608, -0.74059, -0.742573,
-    -0.744552, -0.746525, -0.748489, -0.750443, -0.752388, -0.754326,
-    -0.756261, -0.758195, -0.760134, -0.76208, -0.764035, -0.766001,
-    -0.767977, -0.769959, -0.771945, -0.77393, -0.77591, -0.777882,
-    -0.779844, -0.781795, -0.783736, -0.78567, -0.787601, -0.789532,
-    -0.79147, -0.793417, -0.795375, -0.797344, -0.799324, -0.801311,
-    -0.803302, -0.80529, -0.807271, -0.809242, -0.811201, -0.813148,
-    -0.815083, -0.817012, -0.818938, -0.820866, -0.822803, -0.824751,
-    -0.826712, -0.828687, -0.830673, -0.832666, -0.834662, -0.836653,
-    -0.838636, -0.840606, -0.842561, -0.844501, -0.84643, -0.848351,
-    -0.850271, -0.852195, -0.85413, -0.85608, -0.858046, -0.860028,
-    -0.862023, -0.864025, -0.866027, -0.868024, -0.870008, -0.871976,
-    -0.873925, -0.875856, -0.877774, -0.879685, -0.881596, -0.883515,
-    -0.885448, -0.887401, -0.889374, -0.891367, -0.893375, -0.89539,
-    -0.897404, -0.899407, -0.901393, -0.903357, -0.905296, -0.907214,
-    -0.909115, -0.911009, -0.912906, -0.914815, -0.916747, -0.918705,
-    -0.920692, -0.922704, -0.924734, -0.926772, -0.928804, -0.93082,
-    -0.932808, -0.934763, -0.936684, -0.938574, -0.940443, -0.942305,
-    -0.944174, -0.946067, -0.947996, -0.949969, -0.951985, -0.95404,
-    -0.956121, -0.958209, -0.960283, -0.962324, -0.964313, -0.966241,
-    -0.968107, -0.96992, -0.971698, -0.97347, -0.975265, -0.977118,
-    -0.979056, -0.981096, -0.983241, -0.985479, -0.987775, -0.990078,
-    -0.992318, -0.994417, -0.996288, -0.997848, -0.999022, -0.999752,
-    -1, -0.999752, -0.999022, -0.997848, -0.996288, -0.994417,
-    -0.992318, -0.990078, -0.987775, -0.985479, -0.983241, -0.981096,
-    -0.979056, -0.977118, -0.975265, -0.97347, -0.971698, -0.96992,
-    -0.968107, -0.966241, -0.964313, -0.962324, -0.960283, -0.958209,
-    -0.956121, -0.95404, -0.951985, -0.949969, -0.947996, -0.946067,
-    -0.944174, -0.942305, -0.940443, -0.938574, -0.936684, -0.934763,
-    -0.932808, -0.93082, -0.928804, -0.926772, -0.924734, -0.922704,
-    -0.920692, -0.918705, -0.916747, -0.914815, -0.912906, -0.911009,
-    -0.909115, -0.907214, -0.905296, -0.903357, -0.901393, -0.899407,
-    -0.897404, -0.89539, -0.893375, -0.891367, -0.889374, -0.887401,
-    -0.885448, -0.883515, -0.881596, -0.879685, -0.877774, -0.875856,
-    -0.873925, -0.871976, -0.870008, -0.868024, -0.866027, -0.864025,
-    -0.862023, -0.860028, -0.858046, -0.85608, -0.85413, -0.852195,
-    -0.850271, -0.848351, -0.84643, -0.844501, -0.842561, -0.840606,
-    -0.838636, -0.836653, -0.834662, -0.832666, -0.830673, -0.828687,
-    -0.826712, -0.824751, -0.822803, -0.820866, -0.818938, -0.817012,
-    -0.815083, -0.813148, -0.811201, -0.809242, -0.807271, -0.80529,
-    -0.803302, -0.801311, -0.799324, -0.797344, -0.795375, -0.793417,
-    -0.79147, -0.789532, -0.787601, -0.78567, -0.783736, -0.781795,
-    -0.779844, -0.777882, -0.77591, -0.77393, -0.771945, -0.769959,
-    -0.767977, -0.766001, -0.764035, -0.76208, -0.760134, -0.758195,
-    -0.756261, -0.754326, -0.752388, -0.750443, -0.748489, -0.746525,
-    -0.744552, -0.742573, -0.74059, -0.738608, -0.736629, -0.734657,
-    -0.732695, -0.730741, -0.728796, -0.726856, -0.724919, -0.722982,
-    -0.72104, -0.719091, -0.717135, -0.715169, -0.713196, -0.711217,
-    -0.709237, -0.707257, -0.705282, -0.703313, -0.701353, -0.699401,
-    -0.697456, -0.695515, -0.693576, -0.691636, -0.689692, -0.68774,
-    -0.685781, -0.683814, -0.681841, -0.679863, -0.677885, -0.675907,
-    -0.673935, -0.671969, -0.670011, -0.66806, -0.666115, -0.664173,
-    -0.662233, -0.66029, -0.658343, -0.656389, -0.654428, -0.65246,
-    -0.650487, -0.64851, -0.646533, -0.644558, -0.642588, -0.640625,
-    -0.638668, -0.636718, -0.634773, -0.63283, -0.630888, -0.628944,
-    -0.626994, -0.625038, -0.623076, -0.621107, -0.619134, -0.617158,
-    -0.615182, -0.61321, -0.611242, -0.60928, -0.607325, -0.605375,
-    -0.60343, -0.601487, -0.599543, -0.597597, -0.595645, -0.593688,
-    -0.591724, -0.589754, -0.587781, -0.585806, -0.583832, -0.581861,
-    -0.579895, -0.577935, -0.575981, -0.574032, -0.572087, -0.570143,
-    -0.568198, -0.566249, -0.564296, -0.562337, -0.560372, -0.558402,
-    -0.556429, -0.554455, -0.552483, -0.550513, -0.548549, -0.54659,
-    -0.544637, -0.542689, -0.540743, -0.538798, -0.536852, -0.534902,
-    -0.532947, -0.530986, -0.52902, -0.52705, -0.525078, -0.523104,
-    -0.521133, -0.519165, -0.517203, -0.515245, -0.513293, -0.511345,
-    -0.509399, -0.507453, -0.505506, -0.503554, -0.501598, -0.499636,
-    -0.497669, -0.495699, -0.493726, -0.491754, -0.489784, -0.487818,
-    -0.485857, -0.4839, -0.481949, -0.480001, -0.478055, -0.476108,
-    -0.474159, -0.472206, -0.470248, -0.468285, -0.466318, -0.464347,
-    -0.462375, -0.460404, -0.458435, -0.456471, -0.454511, -0.452556,
-    -0.450605, -0.448657, -0.44671, -0.444762, -0.442812, -0.440858,
-    -0.438899, -0.436935, -0.434967, -0.432996, -0.431025, -0.429054,
-    -0.427087, -0.425123, -0.423165, -0.421211, -0.41926, -0.417312,
-    -0.415365, -0.413417, -0.411465, -0.409509, -0.407549, -0.405584,
-    -0.403616, -0.401645, -0.399675, -0.397705, -0.395739, -0.393776,
-    -0.391819, -0.389866, -0.387916, -0.385968, -0.38402, -0.38207,
-    -0.380118, -0.378161, -0.3762, -0.374234, -0.372265, -0.370295,
-    -0.368324, -0.366356, -0.364391, -0.36243, -0.360473, -0.35852,
-    -0.356571, -0.354623, -0.352674, -0.350724, -0.34877, -0.346812,
-    -0.34485, -0.342884, -0.340915, -0.338944, -0.336975, -0.335007,
-    -0.333043, -0.331083, -0.329127, -0.327175, -0.325226, -0.323278,
-    -0.321329, -0.319377, -0.317422, -0.315463, -0.3135, -0.311533,
-    -0.309564, -0.307594, -0.305625, -0.303658, -0.301695, -0.299736,
-    -0.297782, -0.29583, -0.293881, -0.291933, -0.289983, -0.28803,
-    -0.286075, -0.284114, -0.28215, -0.280183, -0.278214, -0.276244,
-    -0.274275, -0.27231, -0.270348, -0.26839, -0.266436, -0.264485,
-    -0.262536, -0.260587, -0.258637, -0.256683, -0.254726, -0.252765,
-    -0.2508, -0.248833, -0.246863, -0.244894, -0.242926, -0.240962,
-    -0.239001, -0.237044, -0.235091, -0.23314, -0.231191, -0.229242,
-    -0.22729, -0.225336, -0.223378, -0.221416, -0.21945, -0.217482,
-    -0.215513, -0.213544, -0.211577, -0.209613, -0.207654, -0.205698,
-    -0.203745, -0.201795, -0.199846, -0.197896, -0.195944, -0.193989,
-    -0.19203, -0.190067, -0.1881, -0.186132, -0.184163, -0.182194,
-    -0.180228, -0.178266, -0.176307, -0.174352, -0.1724, -0.17045,
-    -0.1685, -0.16655, -0.164597, -0.162641, -0.160681, -0.158717,
-    -0.15675, -0.154782, -0.152813, -0.150845, -0.14888, -0.146918,
-    -0.14496, -0.143006, -0.141054, -0.139104, -0.137155, -0.135204,
-    -0.13325, -0.131293, -0.129332, -0.127368, -0.1254, -0.123432,
-    -0.121463, -0.119496, -0.117531, -0.11557, -0.113613, -0.11166,
-    -0.109709, -0.107759, -0.105809, -0.103858, -0.101903, -0.0999452,
-    -0.0979833, -0.096018, -0.0940503, -0.0920815, -0.090113, -0.0881465,
-    -0.0861829, -0.0842229, -0.0822668, -0.080314, -0.0783634, -0.0764137,
-    -0.0744635, -0.0725113, -0.070556, -0.068597, -0.0666342, -0.0646683,
-    -0.0627002, -0.0607314, -0.0587634, -0.0567975, -0.0548347, -0.0528758,
-    -0.0509205, -0.0489683, -0.047018, -0.0450683, -0.0431177, -0.0411648,
-    -0.0392086, -0.0372486, -0.035285, -0.0333185, -0.0313501, -0.0293814,
-    -0.0274138, -0.0254486, -0.0234868, -0.0215288, -0.0195743, -0.0176227,
-    -0.0156727, -0.0137229, -0.0117718, -0.00981809, -0.00786098, -0.00590009,
-    -0.00393568, -0.00196857
-};
-
-static const float WAVE_TRIANGLE_066[DEFAULT_WAVELEN] = {
-    0, 0.00194615, 0.00389305, 0.00584141, 0.00779189, 0.00974508,
-    0.0117015, 0.0136614, 0.015625, 0.0175925, 0.0195638, 0.0215386,
-    0.0235165, 0.0254972, 0.02748, 0.0294643, 0.0314493, 0.0334343,
-    0.0354186, 0.0374014, 0.039382, 0.04136, 0.0433348, 0.045306,
-    0.0472735, 0.0492371, 0.051197, 0.0531533, 0.0551064, 0.0570568,
-    0.0590051, 0.0609519, 0.062898, 0.064844, 0.0667908, 0.0687391,
-    0.0706895, 0.0726427, 0.074599, 0.0765589, 0.0785226, 0.0804901,
-    0.0824614, 0.0844363, 0.0864144, 0.0883953, 0.0903782, 0.0923627,
-    0.0943479, 0.0963331, 0.0983175, 0.100301, 0.102281, 0.104259,
-    0.106234, 0.108206, 0.110173, 0.112137, 0.114096, 0.116052,
-    0.118005, 0.119956, 0.121904, 0.12385, 0.125796, 0.127742,
-    0.129688, 0.131636, 0.133586, 0.135539, 0.137496, 0.139455,
-    0.141419, 0.143387, 0.145358, 0.147333, 0.149312, 0.151293,
-    0.153276, 0.155261, 0.157246, 0.159232, 0.161217, 0.1632,
-    0.165181, 0.16716, 0.169135, 0.171106, 0.173073, 0.175037,
-    0.176997, 0.178953, 0.180905, 0.182855, 0.184803, 0.186749,
-    0.188694, 0.190639, 0.192585, 0.194533, 0.196483, 0.198435,
-    0.200391, 0.202351, 0.204315, 0.206282, 0.208254, 0.210229,
-    0.212208, 0.21419, 0.216174, 0.218159, 0.220145, 0.222131,
-    0.224117, 0.226101, 0.228082, 0.230061, 0.232036, 0.234008,
-    0.235975, 0.237939, 0.239898, 0.241853, 0.243806, 0.245755,
-    0.247702, 0.249647, 0.251592, 0.253536, 0.255482, 0.257429,
-    0.259378, 0.26133, 0.263286, 0.265245, 0.267209, 0.269177,
-    0.271149, 0.273124, 0.275104, 0.277086, 0.279071, 0.281057,
-    0.283044, 0.285031, 0.287017, 0.289002, 0.290984, 0.292963,
-    0.294939, 0.296911, 0.298878, 0.300841, 0.3028, 0.304756,
-    0.306707, 0.308655, 0.310602, 0.312546, 0.314489, 0.316433,
-    0.318377, 0.320324, 0.322272, 0.324224, 0.326179, 0.328138,
-    0.330102, 0.33207, 0.334042, 0.336018, 0.337998, 0.339981,
-    0.341967, 0.343954, 0.345943, 0.347931, 0.349918, 0.351904,
-    0.353887, 0.355867, 0.357843, 0.359815, 0.361783, 0.363746,
-    0.365704, 0.367659, 0.36961, 0.371557, 0.373502, 0.375445,
-    0.377387, 0.379329, 0.381272, 0.383217, 0.385165, 0.387116,
-    0.38907, 0.391029, 0.392993, 0.394961, 0.396934, 0.398911,
-    0.400892, 0.402876, 0.404863, 0.406852, 0.408842, 0.410831,
-    0.41282, 0.414807, 0.416792, 0.418772, 0.420749, 0.422722,
-    0.424689, 0.426652, 0.42861, 0.430564, 0.432513, 0.434459,
-    0.436403, 0.438344, 0.440285, 0.442225, 0.444167, 0.44611,
-    0.448056, 0.450006, 0.451959, 0.453918, 0.455881, 0.45785,
-    0.459823, 0.461801, 0.463784, 0.46577, 0.467758, 0.469749,
-    0.471741, 0.473733, 0.475723, 0.477712, 0.479698, 0.48168,
-    0.483658, 0.485631, 0.487599, 0.489561, 0.491519, 0.493471,
-    0.495419, 0.497363, 0.499305, 0.501244, 0.503182, 0.50512,
-    0.507059, 0.509, 0.510945, 0.512893, 0.514846, 0.516803,
-    0.518767, 0.520736, 0.52271, 0.524689, 0.526673, 0.528661,
-    0.530653, 0.532646, 0.53464, 0.536635, 0.538628, 0.540619,
-    0.542607, 0.544591, 0.54657, 0.548544, 0.550512, 0.552474,
-    0.55443, 0.556381, 0.558327, 0.560269, 0.562207, 0.564144,
-    0.566079, 0.568014, 0.56995, 0.571888, 0.57383, 0.575776,
-    0.577728, 0.579685, 0.581648, 0.583617, 0.585592, 0.587574,
-    0.58956, 0.591551, 0.593546, 0.595542, 0.597541, 0.599539,
-    0.601536, 0.60353, 0.605521, 0.607507, 0.609488, 0.611462,
-    0.61343, 0.615392, 0.617347, 0.619296, 0.621239, 0.623177,
-    0.625112, 0.627044, 0.628974, 0.630905, 0.632837, 0.634772,
-    0.63671, 0.638654, 0.640603, 0.642559, 0.644522, 0.646492,
-    0.648469, 0.650453, 0.652443, 0.654438, 0.656437, 0.658439,
-    0.660442, 0.662445, 0.664447, 0.666446, 0.668441, 0.67043,
-    0.672413, 0.674389, 0.676357, 0.678318, 0.680271, 0.682217,
-    0.684156, 0.686089, 0.688018, 0.689944, 0.691869, 0.693793,
-    0.695719, 0.697648, 0.699582, 0.701522, 0.703469, 0.705423,
-    0.707386, 0.709357, 0.711336, 0.713324, 0.715319, 0.717319,
-    0.719325, 0.721334, 0.723345, 0.725356, 0.727365, 0.729371,
-    0.731372, 0.733366, 0.735352, 0.73733, 0.739299, 0.741258,
-    0.743207, 0.745148, 0.747081, 0.749008, 0.750928, 0.752845,
-    0.75476, 0.756675, 0.758592, 0.760513, 0.762439, 0.764373,
-    0.766315, 0.768268, 0.77023, 0.772203, 0.774187, 0.77618,
-    0.778183, 0.780193, 0.78221, 0.784231, 0.786254, 0.788277,
-    0.790297, 0.792314, 0.794324, 0.796325, 0.798317, 0.800297,
-    0.802266, 0.804223, 0.806167, 0.8081, 0.810023, 0.811936,
-    0.813843, 0.815744, 0.817643, 0.819542, 0.821444, 0.823351,
-    0.825265, 0.827189, 0.829125, 0.831073, 0.833036, 0.835013,
-    0.837004, 0.839008, 0.841025, 0.843053, 0.845089, 0.847131,
-    0.849176, 0.85122, 0.853262, 0.855298, 0.857324, 0.859339,
-    0.86134, 0.863325, 0.865293, 0.867244, 0.869178, 0.871094,
-    0.872996, 0.874885, 0.876763, 0.878634, 0.880501, 0.882368,
-    0.884239, 0.886118, 0.888008, 0.889913, 0.891836, 0.893779,
-    0.895743, 0.89773, 0.899739, 0.901769, 0.903819, 0.905886,
-    0.907967, 0.910058, 0.912153, 0.914248, 0.916338, 0.918418,
-    0.920482, 0.922526, 0.924546, 0.926538, 0.928501, 0.930432,
-    0.932331, 0.934201, 0.936042, 0.937859, 0.939656, 0.941438,
-    0.943214, 0.94499, 0.946773, 0.948572, 0.950396, 0.952251,
-    0.954144, 0.956082, 0.958069, 0.960108, 0.9622, 0.964345,
-    0.966539, 0.968777, 0.971051, 0.973352, 0.975667, 0.977982,
-    0.98028, 0.982544, 0.984755, 0.986892, 0.988934, 0.99086,
-    0.992651, 0.994285, 0.995743, 0.997009, 0.998068, 0.998905,
-    0.999511, 0.999877, 1, 0.999877, 0.999511, 0.998905,
-    0.998068, 0.997009, 0.995743, 0.994285, 0.992651, 0.99086,
-    0.988934, 0.986892, 0.984755, 0.982544, 0.98028, 0.977982,
-    0.975667, 0.973352, 0.971051, 0.968777, 0.966539, 0.964345,
-    0.9622, 0.960108, 0.958069, 0.956082, 0.954144, 0.952251,
-    0.950396, 0.948572, 0.946773, 0.94499, 0.943214, 0.941438,
-    0.939656, 0.937859, 0.936042, 0.934201, 0.932331, 0.930432,
-    0.928501, 0.926538, 0.924546, 0.922526, 0.920482, 0.918418,
-    0.916338, 0.914248, 0.912153, 0.910058, 0.907967, 0.905886,
-    0.903819, 0.901769, 0.899739, 0.89773, 0.895743, 0.893779,
-    0.891836, 0.889913, 0.888008, 0.886118, 0.884239, 0.882368,
-    0.880501, 0.878634, 0.876763, 0.874885, 0.872996, 0.871094,
-    0.869178, 0.867244, 0.865293, 0.863325, 0.86134, 0.859339,
-    0.857324, 0.855298, 0.853262, 0.85122, 0.849176, 0.847131,
-    0.845089, 0.843053, 0.841025, 0.839008, 0.837004, 0.835013,
-    0.833036, 0.831073, 0.829125, 0.827189, 0.825265, 0.823351,
-    0.821444, 0.819542, 0.817643, 0.815744, 0.813843, 0.811936,
-    0.810023, 0.8081, 0.806167, 0.804223, 0.802266, 0.800297,
-    0.798317, 0.796325, 0.794324, 0.792314, 0.790297, 0.788277,
-    0.786254, 0.784231, 0.78221, 0.780193, 0.778183, 0.77618,
-    0.774187, 0.772203, 0.77023, 0.768268, 0.766315, 0.764373,
-    0.762439, 0.760513, 0.758592, 0.756675, 0.75476, 0.752845,
-    0.750928, 0.749008, 0.747081, 0.745148, 0.743207, 0.741258,
-    0.739299, 0.73733, 0.735352, 0.733366, 0.731372, 0.729371,
-    0.727365, 0.725356, 0.723345, 0.721334, 0.719325, 0.717319,
-    0.715319, 0.713324, 0.711336, 0.709357, 0.707386, 0.705423,
-    0.703469, 0.701522, 0.699582, 0.697648, 0.695719, 0.693793,
-    0.691869, 0.689944, 0.688018, 0.686089, 0.684156, 0.682217,
-    0.680271, 0.678318, 0.676357, 0.674389, 0.672413, 0.67043,
-    0.668441, 0.666446, 0.664447, 0.662445, 0.660442, 0.658439,
-    0.656437, 0.654438, 0.652443, 0.650453, 0.648469, 0.646492,
-    0.644522, 0.642559, 0.640603, 0.638654, 0.63671, 0.634772,
-    0.632837, 0.630905, 0.628974, 0.627044, 0.625112, 0.623177,
-    0.621239, 0.619296, 0.617347, 0.615392, 0.61343, 0.611462,
-    0.609488, 0.607507, 0.605521, 0.60353, 0.601536, 0.599539,
-    0.597541, 0.595542, 0.593546, 0.591551, 0.58956, 0.587574,
-    0.585592, 0.583617, 0.581648, 0.579685, 0.577728, 0.575776,
-    0.57383, 0.571888, 0.56995, 0.568014, 0.566079, 0.564144,
-    0.562207, 0.560269, 0.558327, 0.556381, 0.55443, 0.552474,
-    0.550512, 0.548544, 0.54657, 0.544591, 0.542607, 0.540619,
-    0.538628, 0.536635, 0.53464, 0.532646, 0.530653, 0.528661,
-    0.526673, 0.524689, 0.52271, 0.520736, 0.518767, 0.516803,
-    0.514846, 0.512893, 0.510945, 0.509, 0.507059, 0.50512,
-    0.503182, 0.501244, 0.499305, 0.497363, 0.495419, 0.493471,
-    0.491519, 0.489561, 0.487599, 0.485631, 0.483658, 0.48168,
-    0.479698, 0.477712, 0.475723, 0.473733, 0.471741, 0.469749,
-    0.467758, 0.46577, 0.463784, 0.461801, 0.459823, 0.45785,
-    0.455881, 0.453918, 0.451959, 0.450006, 0.448056, 0.44611,
-    0.444167, 0.442225, 0.440285, 0.438344, 0.436403, 0.434459,
-    0.432513, 0.430564, 0.42861, 0.426652, 0.424689, 0.422722,
-    0.420749, 0.418772, 0.416792, 0.414807, 0.41282, 0.410831,
-    0.408842, 0.406852, 0.404863, 0.402876, 0.400892, 0.398911,
-    0.396934, 0.394961, 0.392993, 0.391029, 0.38907, 0.387116,
-    0.385165, 0.383217, 0.381272, 0.379329, 0.377387, 0.375445,
-    0.373502, 0.371557, 0.36961, 0.367659, 0.365704, 0.363746,
-    0.361783, 0.359815, 0.357843, 0.355867, 0.353887, 0.351904,
-    0.349918, 0.347931, 0.345943, 0.343954, 0.341967, 0.339981,
-    0.337998, 0.336018, 0.334042, 0.33207, 0.330102, 0.328138,
-    0.326179, 0.324224, 0.322272, 0.320324, 0.318377, 0.316433,
-    0.314489, 0.312546, 0.310602, 0.308655, 0.306707, 0.304756,
-    0.3028, 0.300841, 0.298878, 0.296911, 0.294939, 0.292963,
-    0.290984, 0.289002, 0.287017, 0.285031, 0.283044, 0.281057,
-    0.279071, 0.277086, 0.275104, 0.273124, 0.271149, 0.269177,
-    0.267209, 0.265245, 0.263286, 0.26133, 0.259378, 0.257429,
-    0.255482, 0.253536, 0.251592, 0.249647, 0.247702, 0.245755,
-    0.243806, 0.241853, 0.239898, 0.237939, 0.235975, 0.234008,
-    0.232036, 0.230061, 0.228082, 0.226101, 0.224117, 0.222131,
-    0.220145, 0.218159, 0.216174, 0.21419, 0.212208, 0.210229,
-    0.208254, 0.206282, 0.204315, 0.202351, 0.200391, 0.198435,
-    0.196483, 0.194533, 0.192585, 0.190639, 0.188694, 0.186749,
-    0.184803, 0.182855, 0.180905, 0.178953, 0.176997, 0.175037,
-    0.173073, 0.171106, 0.169135, 0.16716, 0.165181, 0.1632,
-    0.161217, 0.159232, 0.157246, 0.155261, 0.153276, 0.151293,
-    0.149312, 0.147333, 0.145358, 0.143387, 0.141419, 0.139455,
-    0.137496, 0.135539, 0.133586, 0.131636, 0.129688, 0.127742,
-    0.125796, 0.12385, 0.121904, 0.119956, 0.118005, 0.116052,
-    0.114096, 0.112137, 0.110173, 0.108206, 0.106234, 0.104259,
-    0.102281, 0.100301, 0.0983175, 0.0963331, 0.0943479, 0.0923627,
-    0.0903782, 0.0883953, 0.0864144, 0.0844363, 0.0824614, 0.0804901,
-    0.0785226, 0.0765589, 0.074599, 0.0726427, 0.0706895, 0.0687391,
-    0.0667908, 0.064844, 0.062898, 0.0609519, 0.0590051, 0.0570568,
-    0.0551064, 0.0531533, 0.051197, 0.0492371, 0.0472735, 0.045306,
-    0.0433348, 0.04136, 0.039382, 0.0374014, 0.0354186, 0.0334343,
-    0.0314493, 0.0294643, 0.02748, 0.0254972, 0.0235165, 0.0215386,
-    0.0195638, 0.0175925, 0.015625, 0.0136614, 0.0117015, 0.00974508,
-    0.00779189, 0.00584141, 0.00389305, 0.00194615, 0, -0.00194615,
-    -0.00389305, -0.00584141, -0.00779189, -0.00974508, -0.0117015, -0.0136614,
-    -0.015625, -0.0175925, -0.0195638, -0.0215386, -0.0235165, -0.0254972,
-    -0.02748, -0.0294643, -0.0314493, -0.0334343, -0.0354186, -0.0374014,
-    -0.039382, -0.04136, -0.0433348, -0.045306, -0.0472735, -0.0492371,
-    -0.051197, -0.0531533, -0.0551064, -0.0570568, -0.0590051, -0.0609519,
-    -0.062898, -0.064844, -0.0667908, -0.0687391, -0.0706895, -0.0726427,
-    -0.074599, -0.0765589, -0.0785226, -0.0804901, -0.0824614, -0.0844363,
-    -0.0864144, -0.0883953, -0.0903782, -0.0923627, -0.0943479, -0.0963331,
-    -0.0983175, -0.100301, -0.102281, -0.104259, -0.106234, -0.108206,
-    -0.110173, -0.112137, -0.114096, -0.116052, -0.118005, -0.119956,
-    -0.121904, -0.12385, -0.125796, -0.127742, -0.129688, -0.131636,
-    -0.133586, -0.135539, -0.137496, -0.139455, -0.141419, -0.143387,
-    -0.145358, -0.147333, -0.149312, -0.151293, -0.153276, -0.155261,
-    -0.157246, -0.159232, -0.161217, -0.1632, -0.165181, -0.16716,
-    -0.169135, -0.171106, -0.173073, -0.175037, -0.176997, -0.178953,
-    -0.180905, -0.182855, -0.184803, -0.186749, -0.188694, -0.190639,
-    -0.192585, -0.194533, -0.196483, -0.198435, -0.200391, -0.202351,
-    -0.204315, -0.206282, -0.208254, -0.210229, -0.212208, -0.21419,
-    -0.216174, -0.218159, -0.220145, -0.222131, -0.224117, -0.226101,
-    -0.228082, -0.230061, -0.232036, -0.234008, -0.235975, -0.237939,
-    -0.239898, -0.241853, -0.243806, -0.245755, -0.247702, -0.249647,
-    -0.251592, -0.253536, -0.255482, -0.257429, -0.259378, -0.26133,
-    -0.263286, -0.265245, -0.267209, -0.269177, -0.271149, -0.273124,
-    -0.275104, -0.277086, -0.279071, -0.281057, -0.283044, -0.285031,
-    -0.287017, -0.289002, -0.290984, -0.292963, -0.294939, -0.296911,
-    -0.298878, -0.300841, -0.3028, -0.304756, -0.306707, -0.308655,
-    -0.310602, -0.312546, -0.314489, -0.316433, -0.318377, -0.320324,
-    -0.322272, -0.324224, -0.326179, -0.328138, -0.330102, -0.33207,
-    -0.334042, -0.336018, -0.337998, -0.339981, -0.341967, -0.343954,
-    -0.345943, -0.347931, -0.349918, -0.351904, -0.353887, -0.355867,
-    -0.357843, -0.359815, -0.361783, -0.363746, -0.365704, -0.367659,
-    -0.36961, -0.371557, -0.373502, -0.375445, -0.377387, -0.379329,
-    -0.381272, -0.383217, -0.385165, -0.387116, -0.38907, -0.391029,
-    -0.392993, -0.394961, -0.396934, -0.398911, -0.400892, -0.402876,
-    -0.404863, -0.406852, -0.408842, -0.410831, -0.41282, -0.414807,
-    -0.416792, -0.418772, -0.420749, -0.422722, -0.424689, -0.426652,
-    -0.42861, -0.430564, -0.432513, -0.434459, -0.436403, -0.438344,
-    -0.440285, -0.442225, -0.444167, -0.44611, -0.448056, -0.450006,
-    -0.451959, -0.453918, -0.455881, -0.45785, -0.459823, -0.461801,
-    -0.463784, -0.46577, -0.467758, -0.469749, -0.471741, -0.473733,
-    -0.475723, -0.477712, -0.479698, -0.48168, -0.483658, -0.485631,
-    -0.487599, -0.489561, -0.491519, -0.493471, -0.495419, -0.497363,
-    -0.499305, -0.501244, -0.503182, -0.50512, -0.507059, -0.509,
-    -0.510945, -0.512893, -0.514846, -0.516803, -0.518767, -0.520736,
-    -0.52271, -0.524689, -0.526673, -0.528661, -0.530653, -0.532646,
-    -0.53464, -0.536635, -0.538628, -0.540619, -0.542607, -0.544591,
-    -0.54657, -0.548544, -0.550512, -0.552474, -0.55443, -0.556381,
-    -0.558327, -0.560269, -0.562207, -0.564144, -0.566079, -0.568014,
-    -0.56995, -0.571888, -0.57383, -0.575776, -0.577728, -0.579685,
-    -0.581648, -0.583617, -0.585592, -0.587574, -0.58956, -0.591551,
-    -0.593546, -0.595542, -0.597541, -0.599539, -0.601536, -0.60353,
-    -0.605521, -0.607507, -0.609488, -0.611462, -0.61343, -0.615392,
-    -0.617347, -0.619296, -0.621239, -0.623177, -0.625112, -0.627044,
-    -0.628974, -0.630905, -0.632837, -0.634772, -0.63671, -0.638654,
-    -0.640603, -0.642559, -0.644522, -0.646492, -0.648469, -0.650453,
-    -0.652443, -0.654438, -0.656437, -0.658439, -0.660442, -0.662445,
-    -0.664447, -0.666446, -0.668441, -0.67043, -0.672413, -0.674389,
-    -0.676357, -0.678318, -0.680271, -0.682217, -0.684156, -0.686089,
-    -0.688018, -0.689944, -0.691869, -0.693793, -0.695719, -0.697648,
-    -0.699582, -0.701522, -0.703469, -0.705423, -0.707386, -0.709357,
-    -0.711336, -0.713324, -0.715319, -0.717319, -0.719325, -0.721334,
-    -0.723345, -0.725356, -0.727365, -0.729371, -0.731372, -0.733366,
-    -0.735352, -0.73733, -0.739299, -0.741258, -0.743207, -0.745148,
-    -0.747081, -0.749008, -0.750928, -0.752845, -0.75476, -0.756675,
-    -0.758592, -0.760513, -0.762439, -0.764373, -0.766315, -0.768268,
-    -0.77023, -0.772203, -0.774187, -0.77618, -0.778183, -0.780193,
-    -0.78221, -0.784231, -0.786254, -0.788277, -0.790297, -0.792314,
-    -0.794324, -0.796325, -0.798317, -0.800297, -0.802266, -0.804223,
-    -0.806167, -0.8081, -0.810023, -0.811936, -0.813843, -0.815744,
-    -0.817643, -0.819542, -0.821444, -0.823351, -0.825265, -0.827189,
-    -0.829125, -0.831073, -0.833036, -0.835013, -0.837004, -0.839008,
-    -0.841025, -0.843053, -0.845089, -0.847131, -0.849176, -0.85122,
-    -0.853262, -0.855298, -0.857324, -0.859339, -0.86134, -0.863325,
-    -0.865293, -0.867244, -0.869178, -0.871094, -0.872996, -0.874885,
-    -0.876763, -0.878634, -0.880501, -0.882368, -0.884239, -0.886118,
-    -0.888008, -0.889913, -0.891836, -0.893779, -0.895743, -0.89773,
-    -0.899739, -0.901769, -0.903819, -0.905886, -0.907967, -0.910058,
-    -0.912153, -0.914248, -0.916338, -0.918418, -0.920482, -0.922526,
-    -0.924546, -0.926538, -0.928501, -0.930432, -0.932331, -0.934201,
-    -0.936042, -0.937859, -0.939656, -0.941438, -0.943214, -0.94499,
-    -0.946773, -0.948572, -0.950396, -0.952251, -0.954144, -0.956082,
-    -0.958069, -0.960108, -0.9622, -0.964345, -0.966539, -0.968777,
-    -0.971051, -0.973352, -0.975667, -0.977982, -0.98028, -0.982544,
-    -0.984755, -0.986892, -0.988934, -0.99086, -0.992651, -0.994285,
-    -0.995743, -0.997009, -0.998068, -0.998905, -0.999511, -0.999877,
-    -1, -0.999877, -0.999511, -0.998905, -0.998068, -0.997009,
-    -0.995743, -0.994285, -0.992651, -0.99086, -0.988934, -0.986892,
-    -0.984755, -0.982544, -0.98028, -0.977982, -0.975667, -0.973352,
-    -0.971051, -0.968777, -0.966539, -0.964345, -0.9622, -0.960108,
-    -0.958069, -0.956082, -0.954144, -0.952251, -0.950396, -0.948572,
-    -0.946773, -0.94499, -0.943214, -0.941438, -0.939656, -0.937859,
-    -0.936042, -0.934201, -0.932331, -0.930432, -0.928501, -0.926538,
-    -0.924546, -0.922526, -0.920482, -0.918418, -0.916338, -0.914248,
-    -0.912153, -0.910058, -0.907967, -0.905886, -0.903819, -0.901769,
-    -0.899739, -0.89773, -0.895743, -0.893779, -0.891836, -0.889913,
-    -0.888008, -0.886118, -0.884239, -0.882368, -0.880501, -0.878634,
-    -0.876763, -0.874885, -0.872996, -0.871094, -0.869178, -0.867244,
-    -0.865293, -0.863325, -0.86134, -0.859339, -0.857324, -0.855298,
-    -0.853262, -0.85122, -0.849176, -0.847131, -0.845089, -0.843053,
-    -0.841025, -0.839008, -0.837004, -0.835013, -0.833036, -0.831073,
-    -0.829125, -0.827189, -0.825265, -0.823351, -0.821444, -0.819542,
-    -0.817643, -0.815744, -0.813843, -0.811936, -0.810023, -0.8081,
-    -0.806167, -0.804223, -0.802266, -0.800297, -0.798317, -0.796325,
-    -0.794324, -0.792314, -0.790297, -0.788277, -0.786254, -0.784231,
-    -0.78221, -0.780193, -0.778183, -0.77618, -0.774187, -0.772203,
-    -0.77023, -0.768268, -0.766315, -0.764373, -0.762439, -0.760513,
-    -0.758592, -0.756675, -0.75476, -0.752845, -0.750928, -0.749008,
-    -0.747081, -0.745148, -0.743207, -0.741258, -0.739299, -0.73733,
-    -0.735352, -0.733366, -0.731372, -0.729371, -0.727365, -0.725356,
-    -0.723345, -0.721334, -0.719325, -0.717319, -0.715319, -0.713324,
-    -0.711336, -0.709357, -0.707386, -0.705423, -0.703469, -0.701522,
-    -0.699582, -0.697648, -0.695719, -0.693793, -0.691869, -0.689944,
-    -0.688018, -0.686089, -0.684156, -0.682217, -0.680271, -0.678318,
-    -0.676357, -0.674389, -0.672413, -0.67043, -0.668441, -0.666446,
-    -0.664447, -0.662445, -0.660442, -0.658439, -0.656437, -0.654438,
-    -0.652443, -0.650453, -0.648469, -0.646492, -0.644522, -0.642559,
-    -0.640603, -0.638654, -0.63671, -0.634772, -0.632837, -0.630905,
-    -0.628974, -0.627044, -0.625112, -0.623177, -0.621239, -0.619296,
-    -0.617347, -0.615392, -0.61343, -0.611462, -0.609488, -0.607507,
-    -0.605521, -0.60353, -0.601536, -0.599539, -0.597541, -0.595542,
-    -0.593546, -0.591551, -0.58956, -0.587574, -0.585592, -0.583617,
-    -0.581648, -0.579685, -0.577728, -0.575776, -0.57383, -0.571888,
-    -0.56995, -0.568014, -0.566079, -0.564144, -0.562207, -0.560269,
-    -0.558327, -0.556381, -0.55443, -0.552474, -0.550512, -0.548544,
-    -0.54657, -0.544591, -0.542607, -0.540619, -0.538628, -0.536635,
-    -0.53464, -0.532646, -0.530653, -0.528661, -0.526673, -0.524689,
-    -0.52271, -0.520736, -0.518767, -0.516803, -0.514846, -0.512893,
-    -0.510945, -0.509, -0.507059, -0.50512, -0.503182, -0.501244,
-    -0.499305, -0.497363, -0.495419, -0.493471, -0.491519, -0.489561,
-    -0.487599, -0.485631, -0.483658, -0.48168, -0.479698, -0.477712,
-    -0.475723, -0.473733, -0.471741, -0.469749, -0.467758, -0.46577,
-    -0.463784, -0.461801, -0.459823, -0.45785, -0.455881, -0.453918,
-    -0.451959, -0.450006, -0.448056, -0.44611, -0.444167, -0.442225,
-    -0.440285, -0.438344, -0.436403, -0.434459, -0.432513, -0.430564,
-    -0.42861, -0.426652, -0.424689, -0.422722, -0.420749, -0.418772,
-    -0.416792, -0.414807, -0.41282, -0.410831, -0.408842, -0.406852,
-    -0.404863, -0.402876, -0.400892, -0.398911, -0.396934, -0.394961,
-    -0.392993, -0.391029, -0.38907, -0.387116, -0.385165, -0.383217,
-    -0.381272, -0.379329, -0.377387, -0.375445, -0.373502, -0.371557,
-    -0.36961, -0.367659, -0.365704, -0.363746, -0.361783, -0.359815,
-    -0.357843, -0.355867, -0.353887, -0.351904, -0.349918, -0.347931,
-    -0.345943, -0.343954, -0.341967, -0.339981, -0.337998, -0.336018,
-    -0.334042, -0.33207, -0.330102, -0.328138, -0.326179, -0.324224,
-    -0.322272, -0.320324, -0.318377, -0.316433, -0.314489, -0.312546,
-    -0.310602, -0.308655, -0.306707, -0.304756, -0.3028, -0.300841,
-    -0.298878, -0.296911, -0.294939, -0.292963, -0.290984, -0.289002,
-    -0.287017, -0.285031, -0.283044, -0.281057, -0.279071, -0.277086,
-    -0.275104, -0.273124, -0.271149, -0.269177, -0.267209, -0.265245,
-    -0.263286, -0.26133, -0.259378, -0.257429, -0.255482, -0.253536,
-    -0.251592, -0.249647, -0.247702, -0.245755, -0.243806, -0.241853,
-    -0.239898, -0.237939, -0.235975, -0.234008, -0.232036, -0.230061,
-    -0.228082, -0.226101, -0.224117, -0.222131, -0.220145, -0.218159,
-    -0.216174, -0.21419, -0.212208, -0.210229, -0.208254, -0.206282,
-    -0.204315, -0.202351, -0.200391, -0.198435, -0.196483, -0.194533,
-    -0.192585, -0.190639, -0.188694, -0.186749, -0.184803, -0.182855,
-    -0.180905, -0.178953, -0.176997, -0.175037, -0.173073, -0.171106,
-    -0.169135, -0.16716, -0.165181, -0.1632, -0.161217, -0.159232,
-    -0.157246, -0.155261, -0.153276, -0.151293, -0.149312, -0.147333,
-    -0.145358, -0.143387, -0.141419, -0.139455, -0.137496, -0.135539,
-    -0.133586, -0.131636, -0.129688, -0.127742, -0.125796, -0.12385,
-    -0.121904, -0.119956, -0.118005, -0.116052, -0.114096, -0.112137,
-    -0.110173, -0.108206, -0.106234, -0.104259, -0.102281, -0.100301,
-    -0.0983175, -0.0963331, -0.0943479, -0.0923627, -0.0903782, -0.0883953,
-    -0.0864144, -0.0844363, -0.0824614, -0.0804901, -0.0785226, -0.0765589,
-    -0.074599, -0.0726427, -0.0706895, -0.0687391, -0.0667908, -0.064844,
-    -0.062898, -0.0609519, -0.0590051, -0.0570568, -0.0551064, -0.0531533,
-    -0.051197, -0.0492371, -0.0472735, -0.045306, -0.0433348, -0.04136,
-    -0.039382, -0.0374014, -0.0354186, -0.0334343, -0.0314493, -0.0294643,
-    -0.02748, -0.0254972, -0.0235165, -0.0215386, -0.0195638, -0.0175925,
-    -0.015625, -0.0136614, -0.0117015, -0.00974508, -0.00779189, -0.00584141,
-    -0.00389305, -0.00194615
-};
-
-static const float WAVE_TRIANGLE_078[DEFAULT_WAVELEN] = {
-    0, 0.00193892, 0.00387821, 0.00581826, 0.00775943, 0.00970208,
-    0.0116465, 0.0135932, 0.0155422, 0.017494, 0.0194488, 0.0214068,
-    0.0233682, 0.0253331, 0.0273018, 0.0292743, 0.0312506, 0.0332307,
-    0.0352147, 0.0372025, 0.039194, 0.0411891, 0.0431876, 0.0451893,
-    0.047194, 0.0492014, 0.0512113, 0.0532234, 0.0552372, 0.0572526,
-    0.0592691, 0.0612863, 0.0633039, 0.0653215, 0.0673388, 0.0693552,
-    0.0713706, 0.0733844, 0.0753965, 0.0774063, 0.0794138, 0.0814184,
-    0.0834201, 0.0854185, 0.0874134, 0.0894048, 0.0913925, 0.0933763,
-    0.0953562, 0.0973322, 0.0993044, 0.101273, 0.103237, 0.105198,
-    0.107156, 0.10911, 0.111061, 0.11301, 0.114956, 0.1169,
-    0.118841, 0.120782, 0.122721, 0.12466, 0.126598, 0.128536,
-    0.130475, 0.132414, 0.134354, 0.136296, 0.13824, 0.140186,
-    0.142135, 0.144086, 0.14604, 0.147998, 0.149959, 0.151924,
-    0.153893, 0.155865, 0.157842, 0.159822, 0.161807, 0.163795,
-    0.165787, 0.167783, 0.169782, 0.171785, 0.173791, 0.1758,
-    0.177811, 0.179824, 0.181839, 0.183856, 0.185874, 0.187893,
-    0.189912, 0.191931, 0.19395, 0.195968, 0.197985, 0.2,
-    0.202014, 0.204025, 0.206033, 0.208039, 0.210041, 0.212041,
-    0.214036, 0.216028, 0.218016, 0.22, 0.221979, 0.223955,
-    0.225927, 0.227894, 0.229858, 0.231817, 0.233774, 0.235726,
-    0.237676, 0.239623, 0.241566, 0.243508, 0.245448, 0.247386,
-    0.249323, 0.251259, 0.253195, 0.25513, 0.257067, 0.259003,
-    0.260942, 0.262881, 0.264823, 0.266767, 0.268714, 0.270664,
-    0.272617, 0.274573, 0.276533, 0.278498, 0.280466, 0.282438,
-    0.284415, 0.286396, 0.288381, 0.290371, 0.292364, 0.294362,
-    0.296363, 0.298368, 0.300376, 0.302387, 0.304401, 0.306417,
-    0.308436, 0.310456, 0.312477, 0.3145, 0.316522, 0.318545,
-    0.320567, 0.322589, 0.324609, 0.326627, 0.328643, 0.330657,
-    0.332668, 0.334676, 0.336681, 0.338681, 0.340678, 0.342671,
-    0.344659, 0.346644, 0.348623, 0.350598, 0.352569, 0.354535,
-    0.356497, 0.358454, 0.360408, 0.362358, 0.364304, 0.366247,
-    0.368187, 0.370125, 0.37206, 0.373994, 0.375926, 0.377858,
-    0.379789, 0.38172, 0.383651, 0.385584, 0.387517, 0.389453,
-    0.391391, 0.393331, 0.395274, 0.397221, 0.399171, 0.401126,
-    0.403084, 0.405047, 0.407014, 0.408987, 0.410963, 0.412945,
-    0.414932, 0.416923, 0.418919, 0.420919, 0.422924, 0.424932,
-    0.426945, 0.428961, 0.43098, 0.433002, 0.435026, 0.437052,
-    0.439079, 0.441107, 0.443136, 0.445165, 0.447194, 0.449221,
-    0.451247, 0.453271, 0.455293, 0.457312, 0.459327, 0.461339,
-    0.463347, 0.465351, 0.46735, 0.469345, 0.471334, 0.473319,
-    0.475298, 0.477272, 0.479241, 0.481205, 0.483163, 0.485117,
-    0.487066, 0.489011, 0.490952, 0.492889, 0.494822, 0.496753,
-    0.498681, 0.500607, 0.502531, 0.504454, 0.506377, 0.5083,
-    0.510223, 0.512147, 0.514073, 0.516001, 0.517932, 0.519866,
-    0.521803, 0.523745, 0.52569, 0.527641, 0.529596, 0.531556,
-    0.533522, 0.535494, 0.537471, 0.539454, 0.541443, 0.543438,
-    0.545438, 0.547443, 0.549454, 0.551469, 0.553489, 0.555513,
-    0.557541, 0.559572, 0.561606, 0.563643, 0.565681, 0.56772,
-    0.56976, 0.5718, 0.573839, 0.575877, 0.577914, 0.579947,
-    0.581978, 0.584006, 0.58603, 0.588049, 0.590063, 0.592072,
-    0.594075, 0.596073, 0.598064, 0.600049, 0.602028, 0.604,
-    0.605966, 0.607925, 0.609878, 0.611825, 0.613766, 0.615702,
-    0.617632, 0.619558, 0.621479, 0.623397, 0.625311, 0.627223,
-    0.629133, 0.631042, 0.632949, 0.634857, 0.636766, 0.638676,
-    0.640587, 0.642502, 0.64442, 0.646342, 0.648269, 0.6502,
-    0.652137, 0.654081, 0.65603, 0.657987, 0.659951, 0.661921,
-    0.6639, 0.665886, 0.667879, 0.66988, 0.671888, 0.673903,
-    0.675925, 0.677953, 0.679988, 0.682028, 0.684073, 0.686122,
-    0.688175, 0.690231, 0.69229, 0.69435, 0.696411, 0.698472,
-    0.700532, 0.70259, 0.704646, 0.706699, 0.708748, 0.710792,
-    0.712831, 0.714864, 0.71689, 0.718909, 0.72092, 0.722922,
-    0.724917, 0.726903, 0.728879, 0.730847, 0.732806, 0.734756,
-    0.736696, 0.738629, 0.740553, 0.742469, 0.744378, 0.74628,
-    0.748177, 0.750067, 0.751954, 0.753836, 0.755716, 0.757593,
-    0.75947, 0.761347, 0.763224, 0.765104, 0.766987, 0.768873,
-    0.770765, 0.772662, 0.774567, 0.776479, 0.778399, 0.780328,
-    0.782267, 0.784216, 0.786176, 0.788147, 0.790129, 0.792123,
-    0.794128, 0.796144, 0.798172, 0.800211, 0.80226, 0.80432,
-    0.806389, 0.808466, 0.810552, 0.812644, 0.814743, 0.816846,
-    0.818953, 0.821062, 0.823173, 0.825284, 0.827394, 0.8295,
-    0.831603, 0.833701, 0.835792, 0.837875, 0.839949, 0.842013,
-    0.844065, 0.846105, 0.848132, 0.850145, 0.852143, 0.854126,
-    0.856094, 0.858045, 0.859981, 0.861901, 0.863804, 0.865693,
-    0.867566, 0.869425, 0.871271, 0.873104, 0.874926, 0.876738,
-    0.878541, 0.880338, 0.882128, 0.883915, 0.8857, 0.887485,
-    0.889272, 0.891063, 0.89286, 0.894665, 0.89648, 0.898307,
-    0.900149, 0.902006, 0.903881, 0.905776, 0.907691, 0.909629,
-    0.911591, 0.913578, 0.91559, 0.917628, 0.919694, 0.921786,
-    0.923905, 0.92605, 0.928222, 0.930418, 0.932638, 0.934881,
-    0.937144, 0.939425, 0.941723, 0.944034, 0.946355, 0.948683,
-    0.951016, 0.953348, 0.955676, 0.957996, 0.960303, 0.962593,
-    0.964862, 0.967103, 0.969312, 0.971484, 0.973613, 0.975695,
-    0.977724, 0.979695, 0.981603, 0.983442, 0.985207, 0.986893,
-    0.988496, 0.99001, 0.991432, 0.992757, 0.99398, 0.9951,
-    0.996111, 0.99701, 0.997796, 0.998465, 0.999015, 0.999445,
-    0.999753, 0.999938, 1, 0.999938, 0.999753, 0.999445,
-    0.999015, 0.998465, 0.997796, 0.99701, 0.996111, 0.9951,
-    0.99398, 0.992757, 0.991432, 0.99001, 0.988496, 0.986893,
-    0.985207, 0.983442, 0.981603, 0.979695, 0.977724, 0.975695,
-    0.973613, 0.971484, 0.969312, 0.967103, 0.964862, 0.962593,
-    0.960303, 0.957996, 0.955676, 0.953348, 0.951016, 0.948683,
-    0.946355, 0.944034, 0.941723, 0.939425, 0.937144, 0.934881,
-    0.932638, 0.930418, 0.928222, 0.92605, 0.923905, 0.921786,
-    0.919694, 0.917628, 0.91559, 0.913578, 0.911591, 0.909629,
-    0.907691, 0.905776, 0.903881, 0.902006, 0.900149, 0.898307,
-    0.89648, 0.894665, 0.89286, 0.891063, 0.889272, 0.887485,
-    0.8857, 0.883915, 0.882128, 0.880338, 0.878541, 0.876738,
-    0.874926, 0.873104, 0.871271, 0.869425, 0.867566, 0.865693,
-    0.863804, 0.861901, 0.859981, 0.858045, 0.856094, 0.854126,
-    0.852143, 0.850145, 0.848132, 0.846105, 0.844065, 0.842013,
-    0.839949, 0.837875, 0.835792, 0.833701, 0.831603, 0.8295,
-    0.827394, 0.825284, 0.823173, 0.821062, 0.818953, 0.816846,
-    0.814743, 0.812644, 0.810552, 0.808466, 0.806389, 0.80432,
-    0.80226, 0.800211, 0.798172, 0.796144, 0.794128, 0.792123,
-    0.790129, 0.788147, 0.786176, 0.784216, 0.782267, 0.780328,
-    0.778399, 0.776479, 0.774567, 0.772662, 0.770765, 0.768873,
-    0.766987, 0.765104, 0.763224, 0.761347, 0.75947, 0.757593,
-    0.755716, 0.753836, 0.751954, 0.750067, 0.748177, 0.74628,
-    0.744378, 0.742469, 0.740553, 0.738629, 0.736696, 0.734756,
-    0.732806, 0.730847, 0.728879, 0.726903, 0.724917, 0.722922,
-    0.72092, 0.718909, 0.71689, 0.714864, 0.712831, 0.710792,
-    0.708748, 0.706699, 0.704646, 0.70259, 0.700532, 0.698472,
-    0.696411, 0.69435, 0.69229, 0.690231, 0.688175, 0.686122,
-    0.684073, 0.682028, 0.679988, 0.677953, 0.675925, 0.673903,
-    0.671888, 0.66988, 0.667879, 0.665886, 0.6639, 0.661921,
-    0.659951, 0.657987, 0.65603, 0.654081, 0.652137, 0.6502,
-    0.648269, 0.646342, 0.64442, 0.642502, 0.640587, 0.638676,
-    0.636766, 0.634857, 0.632949, 0.631042, 0.629133, 0.627223,
-    0.625311, 0.623397, 0.621479, 0.619558, 0.617632, 0.615702,
-    0.613766, 0.611825, 0.609878, 0.607925, 0.605966, 0.604,
-    0.602028, 0.600049, 0.598064, 0.596073, 0.594075, 0.592072,
-    0.590063, 0.588049, 0.58603, 0.584006, 0.581978, 0.579947,
-    0.577914, 0.575877, 0.573839, 0.5718, 0.56976, 0.56772,
-    0.565681, 0.563643, 0.561606, 0.559572, 0.557541, 0.555513,
-    0.553489, 0.551469, 0.549454, 0.547443, 0.545438, 0.543438,
-    0.541443, 0.539454, 0.537471, 0.535494, 0.533522, 0.531556,
-    0.529596, 0.527641, 0.52569, 0.523745, 0.521803, 0.519866,
-    0.517932, 0.516001, 0.514073, 0.512147, 0.510223, 0.5083,
-    0.506377, 0.504454, 0.502531, 0.500607, 0.498681, 0.496753,
-    0.494822, 0.492889, 0.490952, 0.489011, 0.487066, 0.485117,
-    0.483163, 0.481205, 0.479241, 0.477272, 0.475298, 0.473319,
-    0.471334, 0.469345, 0.46735, 0.465351, 0.463347, 0.461339,
-    0.459327, 0.457312, 0.455293, 0.453271, 0.451247, 0.449221,
-    0.447194, 0.445165, 0.443136, 0.441107, 0.439079, 0.437052,
-    0.435026, 0.433002, 0.43098, 0.428961, 0.426945, 0.424932,
-    0.422924, 0.420919, 0.418919, 0.416923, 0.414932, 0.412945,
-    0.410963, 0.408987, 0.407014, 0.405047, 0.403084, 0.401126,
-    0.399171, 0.397221, 0.395274, 0.393331, 0.391391, 0.389453,
-    0.387517, 0.385584, 0.383651, 0.38172, 0.379789, 0.377858,
-    0.375926, 0.373994, 0.37206, 0.370125, 0.368187, 0.366247,
-    0.364304, 0.362358, 0.360408, 0.358454, 0.356497, 0.354535,
-    0.352569, 0.350598, 0.348623, 0.346644, 0.344659, 0.342671,
-    0.340678, 0.338681, 0.336681, 0.334676, 0.332668, 0.330657,
-    0.328643, 0.326627, 0.324609, 0.322589, 0.320567, 0.318545,
-    0.316522, 0.3145, 0.312477, 0.310456, 0.308436, 0.306417,
-    0.304401, 0.302387, 0.300376, 0.298368, 0.296363, 0.294362,
-    0.292364, 0.290371, 0.288381, 0.286396, 0.284415, 0.282438,
-    0.280466, 0.278498, 0.276533, 0.274573, 0.272617, 0.270664,
-    0.268714, 0.266767, 0.264823, 0.262881, 0.260942, 0.259003,
-    0.257067, 0.25513, 0.253195, 0.251259, 0.249323, 0.247386,
-    0.245448, 0.243508, 0.241566, 0.239623, 0.237676, 0.235726,
-    0.233774, 0.231817, 0.229858, 0.227894, 0.225927, 0.223955,
-    0.221979, 0.22, 0.218016, 0.216028, 0.214036, 0.212041,
-    0.210041, 0.208039, 0.206033, 0.204025, 0.202014, 0.2,
-    0.197985, 0.195968, 0.19395, 0.191931, 0.189912, 0.187893,
-    0.185874, 0.183856, 0.181839, 0.179824, 0.177811, 0.1758,
-    0.173791, 0.171785, 0.169782, 0.167783, 0.165787, 0.163795,
-    0.161807, 0.159822, 0.157842, 0.155865, 0.153893, 0.151924,
-    0.149959, 0.147998, 0.14604, 0.144086, 0.142135, 0.140186,
-    0.13824, 0.136296, 0.134354, 0.132414, 0.130475, 0.128536,
-    0.126598, 0.12466, 0.122721, 0.120782, 0.118841, 0.1169,
-    0.114956, 0.11301, 0.111061, 0.10911, 0.107156, 0.105198,
-    0.103237, 0.101273, 0.0993044, 0.0973322, 0.0953562, 0.0933763,
-    0.0913925, 0.0894048, 0.0874134, 0.0854185, 0.0834201, 0.0814184,
-    0.0794138, 0.0774063, 0.0753965, 0.0733844, 0.0713706, 0.0693552,
-    0.0673388, 0.0653215, 0.0633039, 0.0612863, 0.0592691, 0.0572526,
-    0.0552372, 0.0532234, 0.0512113, 0.0492014, 0.047194, 0.0451893,
-    0.0431876, 0.0411891, 0.039194, 0.0372025, 0.0352147, 0.0332307,
-    0.0312506, 0.0292743, 0.0273018, 0.0253331, 0.0233682, 0.0214068,
-    0.0194488, 0.017494, 0.0155422, 0.0135932, 0.0116465, 0.00970208,
-    0.00775943, 0.00581826, 0.00387821, 0.00193892, 0, -0.00193892,
-    -0.00387821, -0.00581826, -0.00775943, -0.00970208, -0.0116465, -0.0135932,
-    -0.0155422, -0.017494, -0.0194488, -0.0214068, -0.0233682, -0.0253331,
-    -0.0273018, -0.0292743, -0.0312506, -0.0332307, -0.0352147, -0.0372025,
-    -0.039194, -0.0411891, -0.0431876, -0.0451893, -0.047194, -0.0492014,
-    -0.0512113, -0.0532234, -0.0552372, -0.0572526, -0.0592691, -0.0612863,
-    -0.0633039, -0.0653215, -0.0673388, -0.0693552, -0.0713706, -0.0733844,
-    -0.0753965, -0.0774063, -0.0794138, -0.0814184, -0.0834201, -0.0854185,
-    -0.0874134, -0.0894048, -0.0913925, -0.0933763, -0.0953562, -0.0973322,
-    -0.0993044, -0.101273, -0.103237, -0.105198, -0.107156, -0.10911,
-    -0.111061, -0.11301, -0.114956, -0.1169, -0.118841, -0.120782,
-    -0.122721, -0.12466, -0.126598, -0.128536, -0.130475, -0.132414,
-    -0.134354, -0.136296, -0.13824, -0.140186, -0.142135, -0.144086,
-    -0.14604, -0.147998, -0.149959, -0.151924, -0.153893, -0.155865,
-    -0.157842, -0.159822, -0.161807, -0.163795, -0.165787, -0.167783,
-    -0.169782, -0.171785, -0.173791, -0.1758, -0.177811, -0.179824,
-    -0.181839, -0.183856, -0.185874, -0.187893, -0.189912, -0.191931,
-    -0.19395, -0.195968, -0.197985, -0.2, -0.202014, -0.204025,
-    -0.206033, -0.208039, -0.210041, -0.212041, -0.214036, -0.216028,
-    -0.218016, -0.22, -0.221979, -0.223955, -0.225927, -0.227894,
-    -0.229858, -0.231817, -0.233774, -0.235726, -0.237676, -0.239623,
-    -0.241566, -0.243508, -0.245448, -0.247386, -0.249323, -0.251259,
-    -0.253195, -0.25513, -0.257067, -0.259003, -0.260942, -0.262881,
-    -0.264823, -0.266767, -0.268714, -0.270664, -0.272617, -0.274573,
-    -0.276533, -0.278498, -0.280466, -0.282438, -0.284415, -0.286396,
-    -0.288381, -0.290371, -0.292364, -0.294362, -0.296363, -0.298368,
-    -0.300376, -0.302387, -0.304401, -0.306417, -0.308436, -0.310456,
-    -0.312477, -0.3145, -0.316522, -0.318545, -0.320567, -0.322589,
-    -0.324609, -0.326627, -0.328643, -0.330657, -0.332668, -0.334676,
-    -0.336681, -0.338681, -0.340678, -0.342671, -0.344659, -0.346644,
-    -0.348623, -0.350598, -0.352569, -0.354535, -0.356497, -0.358454,
-    -0.360408, -0.362358, -0.364304, -0.366247, -0.368187, -0.370125,
-    -0.37206, -0.373994, -0.375926, -0.377858, -0.379789, -0.38172,
-    -0.383651, -0.385584, -0.387517, -0.389453, -0.391391, -0.393331,
-    -0.395274, -0.397221, -0.399171, -0.401126, -0.403084, -0.405047,
-    -0.407014, -0.408987, -0.410963, -0.412945, -0.414932, -0.416923,
-    -0.418919, -0.420919, -0.422924, -0.424932, -0.426945, -0.428961,
-    -0.43098, -0.433002, -0.435026, -0.437052, -0.439079, -0.441107,
-    -0.443136, -0.445165, -0.447194, -0.449221, -0.451247, -0.453271,
-    -0.455293, -0.457312, -0.459327, -0.461339, -0.463347, -0.465351,
-    -0.46735, -0.469345, -0.471334, -0.473319, -0.475298, -0.477272,
-    -0.479241, -0.481205, -0.483163, -0.485117, -0.487066, -0.489011,
-    -0.490952, -0.492889, -0.494822, -0.496753, -0.498681, -0.500607,
-    -0.502531, -0.504454, -0.506377, -0.5083, -0.510223, -0.512147,
-    -0.514073, -0.516001, -0.517932, -0.519866, -0.521803, -0.523745,
-    -0.52569, -0.527641, -0.529596, -0.531556, -0.533522, -0.535494,
-    -0.537471, -0.539454, -0.541443, -0.543438, -0.545438, -0.547443,
-    -0.549454, -0.551469, -0.553489, -0.555513, -0.557541, -0.559572,
-    -0.561606, -0.563643, -0.565681, -0.56772, -0.56976, -0.5718,
-    -0.573839, -0.575877, -0.577914, -0.579947, -0.581978, -0.584006,
-    -0.58603, -0.588049, -0.590063, -0.592072, -0.594075, -0.596073,
-    -0.598064, -0.600049, -0.602028, -0.604, -0.605966, -0.607925,
-    -0.609878, -0.611825, -0.613766, -0.615702, -0.617632, -0.619558,
-    -0.621479, -0.623397, -0.625311, -0.627223, -0.629133, -0.631042,
-    -0.632949, -0.634857, -0.636766, -0.638676, -0.640587, -0.642502,
-    -0.64442, -0.646342, -0.648269, -0.6502, -0.652137, -0.654081,
-    -0.65603, -0.657987, -0.659951, -0.661921, -0.6639, -0.665886,
-    -0.667879, -0.66988, -0.671888, -0.673903, -0.675925, -0.677953,
-    -0.679988, -0.682028, -0.684073, -0.686122, -0.688175, -0.690231,
-    -0.69229, -0.69435, -0.696411, -0.698472, -0.700532, -0.70259,
-    -0.704646, -0.706699, -0.708748, -0.710792, -0.712831, -0.714864,
-    -0.71689, -0.718909, -0.72092, -0.722922, -0.724917, -0.726903,
-    -0.728879, -0.730847, -0.732806, -0.734756, -0.736696, -0.738629,
-    -0.740553, -0.742469, -0.744378, -0.74628, -0.748177, -0.750067,
-    -0.751954, -0.753836, -0.755716, -0.757593, -0.75947, -0.761347,
-    -0.763224, -0.765104, -0.766987, -0.768873, -0.770765, -0.772662,
-    -0.774567, -0.776479, -0.778399, -0.780328, -0.782267, -0.784216,
-    -0.786176, -0.788147, -0.790129, -0.792123, -0.794128, -0.796144,
-    -0.798172, -0.800211, -0.80226, -0.80432, -0.806389, -0.808466,
-    -0.810552, -0.812644, -0.814743, -0.816846, -0.818953, -0.821062,
-    -0.823173, -0.825284, -0.827394, -0.8295, -0.831603, -0.833701,
-    -0.835792, -0.837875, -0.839949, -0.842013, -0.844065, -0.846105,
-    -0.848132, -0.850145, -0.852143, -0.854126, -0.856094, -0.858045,
-    -0.859981, -0.861901, -0.863804, -0.865693, -0.867566, -0.869425,
-    -0.871271, -0.873104, -0.874926, -0.876738, -0.878541, -0.880338,
-    -0.882128, -0.883915, -0.8857, -0.887485, -0.889272, -0.891063,
-    -0.89286, -0.894665, -0.89648, -0.898307, -0.900149, -0.902006,
-    -0.903881, -0.905776, -0.907691, -0.909629, -0.911591, -0.913578,
-    -0.91559, -0.917628, -0.919694, -0.921786, -0.923905, -0.92605,
-    -0.928222, -0.930418, -0.932638, -0.934881, -0.937144, -0.939425,
-    -0.941723, -0.944034, -0.946355, -0.948683, -0.951016, -0.953348,
-    -0.955676, -0.957996, -0.960303, -0.962593, -0.964862, -0.967103,
-    -0.969312, -0.971484, -0.973613, -0.975695, -0.977724, -0.979695,
-    -0.981603, -0.983442, -0.985207, -0.986893, -0.988496, -0.99001,
-    -0.991432, -0.992757, -0.99398, -0.9951, -0.996111, -0.99701,
-    -0.997796, -0.998465, -0.999015, -0.999445, -0.999753, -0.999938,
-    -1, -0.999938, -0.999753, -0.999445, -0.999015, -0.998465,
-    -0.997796, -0.99701, -0.996111, -0.9951, -0.99398, -0.992757,
-    -0.991432, -0.99001, -0.988496, -0.986893, -0.985207, -0.983442,
-    -0.981603, -0.979695, -0.977724, -0.975695, -0.973613, -0.971484,
-    -0.969312, -0.967103, -0.964862, -0.962593, -0.960303, -0.957996,
-    -0.955676, -0.953348, -0.951016, -0.948683, -0.946355, -0.944034,
-    -0.941723, -0.939425, -0.937144, -0.934881, -0.932638, -0.930418,
-    -0.928222, -0.92605, -0.923905, -0.921786, -0.919694, -0.917628,
-    -0.91559, -0.913578, -0.911591, -0.909629, -0.907691, -0.905776,
-    -0.903881, -0.902006, -0.900149, -0.898307, -0.89648, -0.894665,
-    -0.89286, -0.891063, -0.889272, -0.887485, -0.8857, -0.883915,
-    -0.882128, -0.880338, -0.878541, -0.876738, -0.874926, -0.873104,
-    -0.871271, -0.869425, -0.867566, -0.865693, -0.863804, -0.861901,
-    -0.859981, -0.858045, -0.856094, -0.854126, -0.852143, -0.850145,
-    -0.848132, -0.846105, -0.844065, -0.842013, -0.839949, -0.837875,
-    -0.835792, -0.833701, -0.831603, -0.8295, -0.827394, -0.825284,
-    -0.823173, -0.821062, -0.818953, -0.816846, -0.814743, -0.812644,
-    -0.810552, -0.808466, -0.806389, -0.80432, -0.80226, -0.800211,
-    -0.798172, -0.796144, -0.794128, -0.792123, -0.790129, -0.788147,
-    -0.786176, -0.784216, -0.782267, -0.780328, -0.778399, -0.776479,
-    -0.774567, -0.772662, -0.770765, -0.768873, -0.766987, -0.765104,
-    -0.763224, -0.761347, -0.75947, -0.757593, -0.755716, -0.753836,
-    -0.751954, -0.750067, -0.748177, -0.74628, -0.744378, -0.742469,
-    -0.740553, -0.738629, -0.736696, -0.734756, -0.732806, -0.730847,
-    -0.728879, -0.726903, -0.724917, -0.722922, -0.72092, -0.718909,
-    -0.71689, -0.714864, -0.712831, -0.710792, -0.708748, -0.706699,
-    -0.704646, -0.70259, -0.700532, -0.698472, -0.696411, -0.69435,
-    -0.69229, -0.690231, -0.688175, -0.686122, -0.684073, -0.682028,
-    -0.679988, -0.677953, -0.675925, -0.673903, -0.671888, -0.66988,
-    -0.667879, -0.665886, -0.6639, -0.661921, -0.659951, -0.657987,
-    -0.65603, -0.654081, -0.652137, -0.6502, -0.648269, -0.646342,
-    -0.64442, -0.642502, -0.640587, -0.638676, -0.636766, -0.634857,
-    -0.632949, -0.631042, -0.629133, -0.627223, -0.625311, -0.623397,
-    -0.621479, -0.619558, -0.617632, -0.615702, -0.613766, -0.611825,
-    -0.609878, -0.607925, -0.605966, -0.604, -0.602028, -0.600049,
-    -0.598064, -0.596073, -0.594075, -0.592072, -0.590063, -0.588049,
-    -0.58603, -0.584006, -0.581978, -0.579947, -0.577914, -0.575877,
-    -0.573839, -0.5718, -0.56976, -0.56772, -0.565681, -0.563643,
-    -0.561606, -0.559572, -0.557541, -0.555513, -0.553489, -0.551469,
-    -0.549454, -0.547443, -0.545438, -0.543438, -0.541443, -0.539454,
-    -0.537471, -0.535494, -0.533522, -0.531556, -0.529596, -0.527641,
-    -0.52569, -0.523745, -0.521803, -0.519866, -0.517932, -0.516001,
-    -0.514073, -0.512147, -0.510223, -0.5083, -0.506377, -0.504454,
-    -0.502531, -0.500607, -0.498681, -0.496753, -0.494822, -0.492889,
-    -0.490952, -0.489011, -0.487066, -0.485117, -0.483163, -0.481205,
-    -0.479241, -0.477272, -0.475298, -0.473319, -0.471334, -0.469345,
-    -0.46735, -0.465351, -0.463347, -0.461339, -0.459327, -0.457312,
-    -0.455293, -0.453271, -0.451247, -0.449221, -0.447194, -0.445165,
-    -0.443136, -0.441107, -0.439079, -0.437052, -0.435026, -0.433002,
-    -0.43098, -0.428961, -0.426945, -0.424932, -0.422924, -0.420919,
-    -0.418919, -0.416923, -0.414932, -0.412945, -0.410963, -0.408987,
-    -0.407014, -0.405047, -0.403084, -0.401126, -0.399171, -0.397221,
-    -0.395274, -0.393331, -0.391391, -0.389453, -0.387517, -0.385584,
-    -0.383651, -0.38172, -0.379789, -0.377858, -0.375926, -0.373994,
-    -0.37206, -0.370125, -0.368187, -0.366247, -0.364304, -0.362358,
-    -0.360408, -0.358454, -0.356497, -0.354535, -0.352569, -0.350598,
-    -0.348623, -0.346644, -0.344659, -0.342671, -0.340678, -0.338681,
-    -0.336681, -0.334676, -0.332668, -0.330657, -0.328643, -0.326627,
-    -0.324609, -0.322589, -0.320567, -0.318545, -0.316522, -0.3145,
-    -0.312477, -0.310456, -0.308436, -0.306417, -0.304401, -0.302387,
-    -0.300376, -0.298368, -0.296363, -0.294362, -0.292364, -0.290371,
-    -0.288381, -0.286396, -0.284415, -0.282438, -0.280466, -0.278498,
-    -0.276533, -0.274573, -0.272617, -0.270664, -0.268714, -0.266767,
-    -0.264823, -0.262881, -0.260942, -0.259003, -0.257067, -0.25513,
-    -0.253195, -0.251259, -0.249323, -0.247386, -0.245448, -0.243508,
-    -0.241566, -0.239623, -0.237676, -0.235726, -0.233774, -0.231817,
-    -0.229858, -0.227894, -0.225927, -0.223955, -0.221979, -0.22,
-    -0.218016, -0.216028, -0.214036, -0.212041, -0.210041, -0.208039,
-    -0.206033, -0.204025, -0.202014, -0.2, -0.197985, -0.195968,
-    -0.19395, -0.191931, -0.189912, -0.187893, -0.185874, -0.183856,
-    -0.181839, -0.179824, -0.177811, -0.1758, -0.173791, -0.171785,
-    -0.169782, -0.167783, -0.165787, -0.163795, -0.161807, -0.159822,
-    -0.157842, -0.155865, -0.153893, -0.151924, -0.149959, -0.147998,
-    -0.14604, -0.144086, -0.142135, -0.140186, -0.13824, -0.136296,
-    -0.134354, -0.132414, -0.130475, -0.128536, -0.126598, -0.12466,
-    -0.122721, -0.120782, -0.118841, -0.1169, -0.114956, -0.11301,
-    -0.111061, -0.10911, -0.107156, -0.105198, -0.103237, -0.101273,
-    -0.0993044, -0.0973322, -0.0953562, -0.0933763, -0.0913925, -0.0894048,
-    -0.0874134, -0.0854185, -0.0834201, -0.0814184, -0.0794138, -0.0774063,
-    -0.0753965, -0.0733844, -0.0713706, -0.0693552, -0.0673388, -0.0653215,
-    -0.0633039, -0.0612863, -0.0592691, -0.0572526, -0.0552372, -0.0532234,
-    -0.0512113, -0.0492014, -0.047194, -0.0451893, -0.0431876, -0.0411891,
-    -0.039194, -0.0372025, -0.0352147, -0.0332307, -0.0312506, -0.0292743,
-    -0.0273018, -0.0253331, -0.0233682, -0.0214068, -0.0194488, -0.017494,
-    -0.0155422, -0.0135932, -0.0116465, -0.00970208, -0.00775943, -0.00581826,
-    -0.00387821, -0.00193892
-};
-
-static const float WAVE_TRIANGLE_090[DEFAULT_WAVELEN] = {
-    0, 0.00192442, 0.00384904, 0.00577404, 0.00769962, 0.00962595,
-    0.0115532, 0.0134817, 0.0154114, 0.0173427, 0.0192756, 0.0212103,
-    0.0231471, 0.0250861, 0.0270273, 0.0289711, 0.0309175, 0.0328667,
-    0.0348187, 0.0367738, 0.0387321, 0.0406936, 0.0426585, 0.0446268,
-    0.0465987, 0.0485742, 0.0505534, 0.0525363, 0.0545231, 0.0565137,
-    0.0585082, 0.0605066, 0.0625089, 0.0645152, 0.0665254, 0.0685395,
-    0.0705575, 0.0725794, 0.074605, 0.0766345, 0.0786677, 0.0807045,
-    0.0827448, 0.0847887, 0.0868359, 0.0888865, 0.0909402, 0.0929969,
-    0.0950566, 0.0971191, 0.0991842, 0.101252, 0.103322, 0.105394,
-    0.107468, 0.109544, 0.111622, 0.113702, 0.115782, 0.117864,
-    0.119947, 0.12203, 0.124115, 0.126199, 0.128284, 0.130369,
-    0.132453, 0.134537, 0.136621, 0.138704, 0.140785, 0.142866,
-    0.144945, 0.147023, 0.149099, 0.151173, 0.153245, 0.155315,
-    0.157383, 0.159448, 0.16151, 0.163569, 0.165626, 0.167679,
-    0.169729, 0.171775, 0.173819, 0.175858, 0.177894, 0.179926,
-    0.181955, 0.183979, 0.185999, 0.188016, 0.190028, 0.192037,
-    0.194041, 0.196041, 0.198037, 0.20003, 0.202018, 0.204001,
-    0.205981, 0.207958, 0.20993, 0.211898, 0.213863, 0.215824,
-    0.217781, 0.219735, 0.221686, 0.223633, 0.225578, 0.227519,
-    0.229458, 0.231394, 0.233328, 0.235259, 0.237188, 0.239115,
-    0.24104, 0.242964, 0.244886, 0.246807, 0.248727, 0.250647,
-    0.252565, 0.254483, 0.256401, 0.258319, 0.260238, 0.262156,
-    0.264075, 0.265996, 0.267917, 0.269839, 0.271763, 0.273688,
-    0.275615, 0.277545, 0.279476, 0.28141, 0.283347, 0.285286,
-    0.287228, 0.289173, 0.291121, 0.293073, 0.295028, 0.296987,
-    0.29895, 0.300916, 0.302886, 0.304861, 0.306839, 0.308822,
-    0.310809, 0.312801, 0.314796, 0.316796, 0.318801, 0.32081,
-    0.322823, 0.324841, 0.326864, 0.32889, 0.330921, 0.332956,
-    0.334996, 0.33704, 0.339087, 0.341139, 0.343195, 0.345254,
-    0.347317, 0.349383, 0.351453, 0.353526, 0.355603, 0.357682,
-    0.359763, 0.361848, 0.363935, 0.366023, 0.368114, 0.370207,
-    0.372301, 0.374397, 0.376494, 0.378591, 0.380689, 0.382788,
-    0.384887, 0.386986, 0.389085, 0.391183, 0.393281, 0.395377,
-    0.397473, 0.399567, 0.40166, 0.40375, 0.405839, 0.407925,
-    0.410009, 0.41209, 0.414169, 0.416244, 0.418316, 0.420385,
-    0.42245, 0.424511, 0.426568, 0.428621, 0.43067, 0.432714,
-    0.434755, 0.43679, 0.438821, 0.440847, 0.442868, 0.444884,
-    0.446895, 0.448902, 0.450903, 0.452899, 0.45489, 0.456876,
-    0.458857, 0.460833, 0.462804, 0.46477, 0.466732, 0.468688,
-    0.47064, 0.472587, 0.47453, 0.476468, 0.478402, 0.480332,
-    0.482259, 0.484181, 0.4861, 0.488015, 0.489928, 0.491837,
-    0.493744, 0.495648, 0.49755, 0.49945, 0.501348, 0.503244,
-    0.505139, 0.507033, 0.508926, 0.510819, 0.512711, 0.514603,
-    0.516496, 0.518389, 0.520283, 0.522178, 0.524075, 0.525973,
-    0.527873, 0.529775, 0.531679, 0.533587, 0.535497, 0.53741,
-    0.539327, 0.541248, 0.543172, 0.545101, 0.547034, 0.548971,
-    0.550913, 0.55286, 0.554812, 0.55677, 0.558733, 0.560701,
-    0.562675, 0.564655, 0.56664, 0.568632, 0.570629, 0.572633,
-    0.574643, 0.576659, 0.578681, 0.58071, 0.582744, 0.584785,
-    0.586832, 0.588885, 0.590943, 0.593008, 0.595078, 0.597155,
-    0.599236, 0.601323, 0.603415, 0.605513, 0.607615, 0.609721,
-    0.611833, 0.613948, 0.616067, 0.61819, 0.620317, 0.622447,
-    0.624579, 0.626714, 0.628852, 0.630991, 0.633132, 0.635275,
-    0.637418, 0.639562, 0.641707, 0.643851, 0.645996, 0.648139,
-    0.650282, 0.652423, 0.654562, 0.656699, 0.658834, 0.660966,
-    0.663094, 0.66522, 0.667341, 0.669459, 0.671571, 0.673679,
-    0.675782, 0.67788, 0.679972, 0.682058, 0.684138, 0.686211,
-    0.688278, 0.690338, 0.69239, 0.694435, 0.696473, 0.698503,
-    0.700525, 0.70254, 0.704546, 0.706544, 0.708533, 0.710515,
-    0.712488, 0.714453, 0.716409, 0.718357, 0.720297, 0.722229,
-    0.724152, 0.726068, 0.727975, 0.729875, 0.731767, 0.733651,
-    0.735529, 0.737399, 0.739263, 0.74112, 0.742972, 0.744817,
-    0.746656, 0.748491, 0.75032, 0.752145, 0.753966, 0.755784,
-    0.757598, 0.759409, 0.761218, 0.763024, 0.76483, 0.766634,
-    0.768438, 0.770242, 0.772046, 0.773852, 0.775659, 0.777468,
-    0.779279, 0.781094, 0.782912, 0.784735, 0.786562, 0.788394,
-    0.790232, 0.792077, 0.793928, 0.795786, 0.797652, 0.799526,
-    0.801409, 0.803301, 0.805203, 0.807115, 0.809037, 0.81097,
-    0.812914, 0.814869, 0.816837, 0.818816, 0.820809, 0.822813,
-    0.824831, 0.826862, 0.828906, 0.830964, 0.833035, 0.83512,
-    0.837219, 0.839331, 0.841457, 0.843597, 0.845751, 0.847918,
-    0.850099, 0.852293, 0.8545, 0.856719, 0.858951, 0.861196,
-    0.863452, 0.865719, 0.867997, 0.870286, 0.872585, 0.874893,
-    0.87721, 0.879536, 0.881868, 0.884208, 0.886554, 0.888905,
-    0.89126, 0.893619, 0.895981, 0.898345, 0.90071, 0.903075,
-    0.905439, 0.907801, 0.91016, 0.912514, 0.914864, 0.917207,
-    0.919542, 0.921869, 0.924185, 0.926491, 0.928783, 0.931063,
-    0.933327, 0.935575, 0.937806, 0.940017, 0.942209, 0.944379,
-    0.946526, 0.948649, 0.950746, 0.952817, 0.954859, 0.956872,
-    0.958854, 0.960804, 0.96272, 0.964602, 0.966447, 0.968255,
-    0.970024, 0.971753, 0.973441, 0.975087, 0.976689, 0.978247,
-    0.979758, 0.981223, 0.982639, 0.984007, 0.985324, 0.98659,
-    0.987804, 0.988965, 0.990071, 0.991123, 0.99212, 0.99306,
-    0.993943, 0.994768, 0.995534, 0.996242, 0.99689, 0.997478,
-    0.998005, 0.998471, 0.998876, 0.999219, 0.9995, 0.999718,
-    0.999875, 0.999969, 1, 0.999969, 0.999875, 0.999718,
-    0.9995, 0.999219, 0.998876, 0.998471, 0.998005, 0.997478,
-    0.99689, 0.996242, 0.995534, 0.994768, 0.993943, 0.99306,
-    0.99212, 0.991123, 0.990071, 0.988965, 0.987804, 0.98659,
-    0.985324, 0.984007, 0.982639, 0.981223, 0.979758, 0.978247,
-    0.976689, 0.975087, 0.973441, 0.971753, 0.970024, 0.968255,
-    0.966447, 0.964602, 0.96272, 0.960804, 0.958854, 0.956872,
-    0.954859, 0.952817, 0.950746, 0.948649, 0.946526, 0.944379,
-    0.942209, 0.940017, 0.937806, 0.935575, 0.933327, 0.931063,
-    0.928783, 0.926491, 0.924185, 0.921869, 0.919542, 0.917207,
-    0.914864, 0.912514, 0.91016, 0.907801, 0.905439, 0.903075,
-    0.90071, 0.898345, 0.895981, 0.893619, 0.89126, 0.888905,
-    0.886554, 0.884208, 0.881868, 0.879536, 0.87721, 0.874893,
-    0.872585, 0.870286, 0.867997, 0.865719, 0.863452, 0.861196,
-    0.858951, 0.856719, 0.8545, 0.852293, 0.850099, 0.847918,
-    0.845751, 0.843597, 0.841457, 0.839331, 0.837219, 0.83512,
-    0.833035, 0.830964, 0.828906, 0.826862, 0.824831, 0.822813,
-    0.820809, 0.818816, 0.816837, 0.814869, 0.812914, 0.81097,
-    0.809037, 0.807115, 0.805203, 0.803301, 0.801409, 0.799526,
-    0.797652, 0.795786, 0.793928, 0.792077, 0.790232, 0.788394,
-    0.786562, 0.784735, 0.782912, 0.781094, 0.779279, 0.777468,
-    0.775659, 0.773852, 0.772046, 0.770242, 0.768438, 0.766634,
-    0.76483, 0.763024, 0.761218, 0.759409, 0.757598, 0.755784,
-    0.753966, 0.752145, 0.75032, 0.748491, 0.746656, 0.744817,
-    0.742972, 0.74112, 0.739263, 0.737399, 0.735529, 0.733651,
-    0.731767, 0.729875, 0.727975, 0.726068, 0.724152, 0.722229,
-    0.720297, 0.718357, 0.716409, 0.714453, 0.712488, 0.710515,
-    0.708533, 0.706544, 0.704546, 0.70254, 0.700525, 0.698503,
-    0.696473, 0.694435, 0.69239, 0.690338, 0.688278, 0.686211,
-    0.684138, 0.682058, 0.679972, 0.67788, 0.675782, 0.673679,
-    0.671571, 0.669459, 0.667341, 0.66522, 0.663094, 0.660966,
-    0.658834, 0.656699, 0.654562, 0.652423, 0.650282, 0.648139,
-    0.645996, 0.643851, 0.641707, 0.639562, 0.637418, 0.635275,
-    0.633132, 0.630991, 0.628852, 0.626714, 0.624579, 0.622447,
-    0.620317, 0.61819, 0.616067, 0.613948, 0.611833, 0.609721,
-    0.607615, 0.605513, 0.603415, 0.601323, 0.599236, 0.597155,
-    0.595078, 0.593008, 0.590943, 0.588885, 0.586832, 0.584785,
-    0.582744, 0.58071, 0.578681, 0.576659, 0.574643, 0.572633,
-    0.570629, 0.568632, 0.56664, 0.564655, 0.562675, 0.560701,
-    0.558733, 0.55677, 0.554812, 0.55286, 0.550913, 0.548971,
-    0.547034, 0.545101, 0.543172, 0.541248, 0.539327, 0.53741,
-    0.535497, 0.533587, 0.531679, 0.529775, 0.527873, 0.525973,
-    0.524075, 0.522178, 0.520283, 0.518389, 0.516496, 0.514603,
-    0.512711, 0.510819, 0.508926, 0.507033, 0.505139, 0.503244,
-    0.501348, 0.49945, 0.49755, 0.495648, 0.493744, 0.491837,
-    0.489928, 0.488015, 0.4861, 0.484181, 0.482259, 0.480332,
-    0.478402, 0.476468, 0.47453, 0.472587, 0.47064, 0.468688,
-    0.466732, 0.46477, 0.462804, 0.460833, 0.458857, 0.456876,
-    0.45489, 0.452899, 0.450903, 0.448902, 0.446895, 0.444884,
-    0.442868, 0.440847, 0.438821, 0.43679, 0.434755, 0.432714,
-    0.43067, 0.428621, 0.426568, 0.424511, 0.42245, 0.420385,
-    0.418316, 0.416244, 0.414169, 0.41209, 0.410009, 0.407925,
-    0.405839, 0.40375, 0.40166, 0.399567, 0.397473, 0.395377,
-    0.393281, 0.391183, 0.389085, 0.386986, 0.384887, 0.382788,
-    0.380689, 0.378591, 0.376494, 0.374397, 0.372301, 0.370207,
-    0.368114, 0.366023, 0.363935, 0.361848, 0.359763, 0.357682,
-    0.355603, 0.353526, 0.351453, 0.349383, 0.347317, 0.345254,
-    0.343195, 0.341139, 0.339087, 0.33704, 0.334996, 0.332956,
-    0.330921, 0.32889, 0.326864, 0.324841, 0.322823, 0.32081,
-    0.318801, 0.316796, 0.314796, 0.312801, 0.310809, 0.308822,
-    0.306839, 0.304861, 0.302886, 0.300916, 0.29895, 0.296987,
-    0.295028, 0.293073, 0.291121, 0.289173, 0.287228, 0.285286,
-    0.283347, 0.28141, 0.279476, 0.277545, 0.275615, 0.273688,
-    0.271763, 0.269839, 0.267917, 0.265996, 0.264075, 0.262156,
-    0.260238, 0.258319, 0.256401, 0.254483, 0.252565, 0.250647,
-    0.248727, 0.246807, 0.244886, 0.242964, 0.24104, 0.239115,
-    0.237188, 0.235259, 0.233328, 0.231394, 0.229458, 0.227519,
-    0.225578, 0.223633, 0.221686, 0.219735, 0.217781, 0.215824,
-    0.213863, 0.211898, 0.20993, 0.207958, 0.205981, 0.204001,
-    0.202018, 0.20003, 0.198037, 0.196041, 0.194041, 0.192037,
-    0.190028, 0.188016, 0.185999, 0.183979, 0.181955, 0.179926,
-    0.177894, 0.175858, 0.173819, 0.171775, 0.169729, 0.167679,
-    0.165626, 0.163569, 0.16151, 0.159448, 0.157383, 0.155315,
-    0.153245, 0.151173, 0.149099, 0.147023, 0.144945, 0.142866,
-    0.140785, 0.138704, 0.136621, 0.134537, 0.132453, 0.130369,
-    0.128284, 0.126199, 0.124115, 0.12203, 0.119947, 0.117864,
-    0.115782, 0.113702, 0.111622, 0.109544, 0.107468, 0.105394,
-    0.103322, 0.101252, 0.0991842, 0.0971191, 0.0950566, 0.0929969,
-    0.0909402, 0.0888865, 0.0868359, 0.0847887, 0.0827448, 0.0807045,
-    0.0786677, 0.0766345, 0.074605, 0.0725794, 0.0705575, 0.0685395,
-    0.0665254, 0.0645152, 0.0625089, 0.0605066, 0.0585082, 0.0565137,
-    0.0545231, 0.0525363, 0.0505534, 0.0485742, 0.0465987, 0.0446268,
-    0.0426585, 0.0406936, 0.0387321, 0.0367738, 0.0348187, 0.0328667,
-    0.0309175, 0.0289711, 0.0270273, 0.0250861, 0.0231471, 0.0212103,
-    0.0192756, 0.0173427, 0.0154114, 0.0134817, 0.0115532, 0.00962595,
-    0.00769962, 0.00577404, 0.00384904, 0.00192442, 0, -0.00192442,
-    -0.00384904, -0.00577404, -0.00769962, -0.00962595, -0.0115532, -0.0134817,
-    -0.0154114, -0.0173427, -0.0192756, -0.0212103, -0.0231471, -0.0250861,
-    -0.0270273, -0.0289711, -0.0309175, -0.0328667, -0.0348187, -0.0367738,
-    -0.0387321, -0.0406936, -0.0426585, -0.0446268, -0.0465987, -0.0485742,
-    -0.0505534, -0.0525363, -0.0545231, -0.0565137, -0.0585082, -0.0605066,
-    -0.0625089, -0.0645152, -0.0665254, -0.0685395, -0.0705575, -0.0725794,
-    -0.074605, -0.0766345, -0.0786677, -0.0807045, -0.0827448, -0.0847887,
-    -0.0868359, -0.0888865, -0.0909402, -0.0929969, -0.0950566, -0.0971191,
-    -0.0991842, -0.101252, -0.103322, -0.105394, -0.107468, -0.109544,
-    -0.111622, -0.113702, -0.115782, -0.117864, -0.119947, -0.12203,
-    -0.124115, -0.126199, -0.128284, -0.130369, -0.132453, -0.134537,
-    -0.136621, -0.138704, -0.140785, -0.142866, -0.144945, -0.147023,
-    -0.149099, -0.151173, -0.153245, -0.155315, -0.157383, -0.159448,
-    -0.16151, -0.163569, -0.165626, -0.167679, -0.169729, -0.171775,
-    -0.173819, -0.175858, -0.177894, -0.179926, -0.181955, -0.183979,
-    -0.185999, -0.188016, -0.190028, -0.192037, -0.194041, -0.196041,
-    -0.198037, -0.20003, -0.202018, -0.204001, -0.205981, -0.207958,
-    -0.20993, -0.211898, -0.213863, -0.215824, -0.217781, -0.219735,
-    -0.221686, -0.223633, -0.225578, -0.227519, -0.229458, -0.231394,
-    -0.233328, -0.235259, -0.237188, -0.239115, -0.24104, -0.242964,
-    -0.244886, -0.246807, -0.248727, -0.250647, -0.252565, -0.254483,
-    -0.256401, -0.258319, -0.260238, -0.262156, -0.264075, -0.265996,
-    -0.267917, -0.269839, -0.271763, -0.273688, -0.275615, -0.277545,
-    -0.279476, -0.28141, -0.283347, -0.285286, -0.287228, -0.289173,
-    -0.291121, -0.293073, -0.295028, -0.296987, -0.29895, -0.300916,
-    -0.302886, -0.304861, -0.306839, -0.308822, -0.310809, -0.312801,
-    -0.314796, -0.316796, -0.318801, -0.32081, -0.322823, -0.324841,
-    -0.326864, -0.32889, -0.330921, -0.332956, -0.334996, -0.33704,
-    -0.339087, -0.341139, -0.343195, -0.345254, -0.347317, -0.349383,
-    -0.351453, -0.353526, -0.355603, -0.357682, -0.359763, -0.361848,
-    -0.363935, -0.366023, -0.368114, -0.370207, -0.372301, -0.374397,
-    -0.376494, -0.378591, -0.380689, -0.382788, -0.384887, -0.386986,
-    -0.389085, -0.391183, -0.393281, -0.395377, -0.397473, -0.399567,
-    -0.40166, -0.40375, -0.405839, -0.407925, -0.410009, -0.41209,
-    -0.414169, -0.416244, -0.418316, -0.420385, -0.42245, -0.424511,
-    -0.426568, -0.428621, -0.43067, -0.432714, -0.434755, -0.43679,
-    -0.438821, -0.440847, -0.442868, -0.444884, -0.446895, -0.448902,
-    -0.450903, -0.452899, -0.45489, -0.456876, -0.458857, -0.460833,
-    -0.462804, -0.46477, -0.466732, -0.468688, -0.47064, -0.472587,
-    -0.47453, -0.476468, -0.478402, -0.480332, -0.482259, -0.484181,
-    -0.4861, -0.488015, -0.489928, -0.491837, -0.493744, -0.495648,
-    -0.49755, -0.49945, -0.501348, -0.503244, -0.505139, -0.507033,
-    -0.508926, -0.510819, -0.512711, -0.514603, -0.516496, -0.518389,
-    -0.520283, -0.522178, -0.524075, -0.525973, -0.527873, -0.529775,
-    -0.531679, -0.533587, -0.535497, -0.53741, -0.539327, -0.541248,
-    -0.543172, -0.545101, -0.547034, -0.548971, -0.550913, -0.55286,
-    -0.554812, -0.55677, -0.558733, -0.560701, -0.562675, -0.564655,
-    -0.56664, -0.568632, -0.570629, -0.572633, -0.574643, -0.576659,
-    -0.578681, -0.58071, -0.582744, -0.584785, -0.586832, -0.588885,
-    -0.590943, -0.593008, -0.595078, -0.597155, -0.599236, -0.601323,
-    -0.603415, -0.605513, -0.607615, -0.609721, -0.611833, -0.613948,
-    -0.616067, -0.61819, -0.620317, -0.622447, -0.624579, -0.626714,
-    -0.628852, -0.630991, -0.633132, -0.635275, -0.637418, -0.639562,
-    -0.641707, -0.643851, -0.645996, -0.648139, -0.650282, -0.652423,
-    -0.654562, -0.656699, -0.658834, -0.660966, -0.663094, -0.66522,
-    -0.667341, -0.669459, -0.671571, -0.673679, -0.675782, -0.67788,
-    -0.679972, -0.682058, -0.684138, -0.686211, -0.688278, -0.690338,
-    -0.69239, -0.694435, -0.696473, -0.698503, -0.700525, -0.70254,
-    -0.704546, -0.706544, -0.708533, -0.710515, -0.712488, -0.714453,
-    -0.716409, -0.718357, -0.720297, -0.722229, -0.724152, -0.726068,
-    -0.727975, -0.729875, -0.731767, -0.733651, -0.735529, -0.737399,
-    -0.739263, -0.74112, -0.742972, -0.744817, -0.746656, -0.748491,
-    -0.75032, -0.752145, -0.753966, -0.755784, -0.757598, -0.759409,
-    -0.761218, -0.763024, -0.76483, -0.766634, -0.768438, -0.770242,
-    -0.772046, -0.773852, -0.775659, -0.777468, -0.779279, -0.781094,
-    -0.782912, -0.784735, -0.786562, -0.788394, -0.790232, -0.792077,
-    -0.793928, -0.795786, -0.797652, -0.799526, -0.801409, -0.803301,
-    -0.805203, -0.807115, -0.809037, -0.81097, -0.812914, -0.814869,
-    -0.816837, -0.818816, -0.820809, -0.822813, -0.824831, -0.826862,
-    -0.828906, -0.830964, -0.833035, -0.83512, -0.837219, -0.839331,
-    -0.841457, -0.843597, -0.845751, -0.847918, -0.850099, -0.852293,
-    -0.8545, -0.856719, -0.858951, -0.861196, -0.863452, -0.865719,
-    -0.867997, -0.870286, -0.872585, -0.874893, -0.87721, -0.879536,
-    -0.881868, -0.884208, -0.886554, -0.888905, -0.89126, -0.893619,
-    -0.895981, -0.898345, -0.90071, -0.903075, -0.905439, -0.907801,
-    -0.91016, -0.912514, -0.914864, -0.917207, -0.919542, -0.921869,
-    -0.924185, -0.926491, -0.928783, -0.931063, -0.933327, -0.935575,
-    -0.937806, -0.940017, -0.942209, -0.944379, -0.946526, -0.948649,
-    -0.950746, -0.952817, -0.954859, -0.956872, -0.958854, -0.960804,
-    -0.96272, -0.964602, -0.966447, -0.968255, -0.970024, -0.971753,
-    -0.973441, -0.975087, -0.976689, -0.978247, -0.979758, -0.981223,
-    -0.982639, -0.984007, -0.985324, -0.98659, -0.987804, -0.988965,
-    -0.990071, -0.991123, -0.99212, -0.99306, -0.993943, -0.994768,
-    -0.995534, -0.996242, -0.99689, -0.997478, -0.998005, -0.998471,
-    -0.998876, -0.999219, -0.9995, -0.999718, -0.999875, -0.999969,
-    -1, -0.999969, -0.999875, -0.999718, -0.9995, -0.999219,
-    -0.998876, -0.998471, -0.998005, -0.997478, -0.99689, -0.996242,
-    -0.995534, -0.994768, -0.993943, -0.99306, -0.99212, -0.991123,
-    -0.990071, -0.988965, -0.987804, -0.98659, -0.985324, -0.984007,
-    -0.982639, -0.981223, -0.979758, -0.978247, -0.976689, -0.975087,
-    -0.973441, -0.971753, -0.970024, -0.968255, -0.966447, -0.964602,
-    -0.96272, -0.960804, -0.958854, -0.956872, -0.954859, -0.952817,
-    -0.950746, -0.948649, -0.946526, -0.944379, -0.942209, -0.940017,
-    -0.937806, -0.935575, -0.933327, -0.931063, -0.928783, -0.926491,
-    -0.924185, -0.921869, -0.919542, -0.917207, -0.914864, -0.912514,
-    -0.91016, -0.907801, -0.905439, -0.903075, -0.90071, -0.898345,
-    -0.895981, -0.893619, -0.89126, -0.888905, -0.886554, -0.884208,
-    -0.881868, -0.879536, -0.87721, -0.874893, -0.872585, -0.870286,
-    -0.867997, -0.865719, -0.863452, -0.861196, -0.858951, -0.856719,
-    -0.8545, -0.852293, -0.850099, -0.847918, -0.845751, -0.843597,
-    -0.841457, -0.839331, -0.837219, -0.83512, -0.833035, -0.830964,
-    -0.828906, -0.826862, -0.824831, -0.822813, -0.820809, -0.818816,
-    -0.816837, -0.814869, -0.812914, -0.81097, -0.809037, -0.807115,
-    -0.805203, -0.803301, -0.801409, -0.799526, -0.797652, -0.795786,
-    -0.793928, -0.792077, -0.790232, -0.788394, -0.786562, -0.784735,
-    -0.782912, -0.781094, -0.779279, -0.777468, -0.775659, -0.773852,
-    -0.772046, -0.770242, -0.768438, -0.766634, -0.76483, -0.763024,
-    -0.761218, -0.759409, -0.757598, -0.755784, -0.753966, -0.752145,
-    -0.75032, -0.748491, -0.746656, -0.744817, -0.742972, -0.74112,
-    -0.739263, -0.737399, -0.735529, -0.733651, -0.731767, -0.729875,
-    -0.727975, -0.726068, -0.724152, -0.722229, -0.720297, -0.718357,
-    -0.716409, -0.714453, -0.712488, -0.710515, -0.708533, -0.706544,
-    -0.704546, -0.70254, -0.700525, -0.698503, -0.696473, -0.694435,
-    -0.69239, -0.690338, -0.688278, -0.686211, -0.684138, -0.682058,
-    -0.679972, -0.67788, -0.675782, -0.673679, -0.671571, -0.669459,
-    -0.667341, -0.66522, -0.663094, -0.660966, -0.658834, -0.656699,
-    -0.654562, -0.652423, -0.650282, -0.648139, -0.645996, -0.643851,
-    -0.641707, -0.639562, -0.637418, -0.635275, -0.633132, -0.630991,
-    -0.628852, -0.626714, -0.624579, -0.622447, -0.620317, -0.61819,
-    -0.616067, -0.613948, -0.611833, -0.609721, -0.607615, -0.605513,
-    -0.603415, -0.601323, -0.599236, -0.597155, -0.595078, -0.593008,
-    -0.590943, -0.588885, -0.586832, -0.584785, -0.582744, -0.58071,
-    -0.578681, -0.576659, -0.574643, -0.572633, -0.570629, -0.568632,
-    -0.56664, -0.564655, -0.562675, -0.560701, -0.558733, -0.55677,
-    -0.554812, -0.55286, -0.550913, -0.548971, -0.547034, -0.545101,
-    -0.543172, -0.541248, -0.539327, -0.53741, -0.535497, -0.533587,
-    -0.531679, -0.529775, -0.527873, -0.525973, -0.524075, -0.522178,
-    -0.520283, -0.518389, -0.516496, -0.514603, -0.512711, -0.510819,
-    -0.508926, -0.507033, -0.505139, -0.503244, -0.501348, -0.49945,
-    -0.49755, -0.495648, -0.493744, -0.491837, -0.489928, -0.488015,
-    -0.4861, -0.484181, -0.482259, -0.480332, -0.478402, -0.476468,
-    -0.47453, -0.472587, -0.47064, -0.468688, -0.466732, -0.46477,
-    -0.462804, -0.460833, -0.458857, -0.456876, -0.45489, -0.452899,
-    -0.450903, -0.448902, -0.446895, -0.444884, -0.442868, -0.440847,
-    -0.438821, -0.43679, -0.434755, -0.432714, -0.43067, -0.428621,
-    -0.426568, -0.424511, -0.42245, -0.420385, -0.418316, -0.416244,
-    -0.414169, -0.41209, -0.410009, -0.407925, -0.405839, -0.40375,
-    -0.40166, -0.399567, -0.397473, -0.395377, -0.393281, -0.391183,
-    -0.389085, -0.386986, -0.384887, -0.382788, -0.380689, -0.378591,
-    -0.376494, -0.374397, -0.372301, -0.370207, -0.368114, -0.366023,
-    -0.363935, -0.361848, -0.359763, -0.357682, -0.355603, -0.353526,
-    -0.351453, -0.349383, -0.347317, -0.345254, -0.343195, -0.341139,
-    -0.339087, -0.33704, -0.334996, -0.332956, -0.330921, -0.32889,
-    -0.326864, -0.324841, -0.322823, -0.32081, -0.318801, -0.316796,
-    -0.314796, -0.312801, -0.310809, -0.308822, -0.306839, -0.304861,
-    -0.302886, -0.300916, -0.29895, -0.296987, -0.295028, -0.293073,
-    -0.291121, -0.289173, -0.287228, -0.285286, -0.283347, -0.28141,
-    -0.279476, -0.277545, -0.275615, -0.273688, -0.271763, -0.269839,
-    -0.267917, -0.265996, -0.264075, -0.262156, -0.260238, -0.258319,
-    -0.256401, -0.254483, -0.252565, -0.250647, -0.248727, -0.246807,
-    -0.244886, -0.242964, -0.24104, -0.239115, -0.237188, -0.235259,
-    -0.233328, -0.231394, -0.229458, -0.227519, -0.225578, -0.223633,
-    -0.221686, -0.219735, -0.217781, -0.215824, -0.213863, -0.211898,
-    -0.20993, -0.207958, -0.205981, -0.204001, -0.202018, -0.20003,
-    -0.198037, -0.196041, -0.194041, -0.192037, -0.190028, -0.188016,
-    -0.185999, -0.183979, -0.181955, -0.179926, -0.177894, -0.175858,
-    -0.173819, -0.171775, -0.169729, -0.167679, -0.165626, -0.163569,
-    -0.16151, -0.159448, -0.157383, -0.155315, -0.153245, -0.151173,
-    -0.149099, -0.147023, -0.144945, -0.142866, -0.140785, -0.138704,
-    -0.136621, -0.134537, -0.132453, -0.130369, -0.128284, -0.126199,
-    -0.124115, -0.12203, -0.119947, -0.117864, -0.115782, -0.113702,
-    -0.111622, -0.109544, -0.107468, -0.105394, -0.103322, -0.101252,
-    -0.0991842, -0.0971191, -0.0950566, -0.0929969, -0.0909402, -0.0888865,
-    -0.0868359, -0.0847887, -0.0827448, -0.0807045, -0.0786677, -0.0766345,
-    -0.074605, -0.0725794, -0.0705575, -0.0685395, -0.0665254, -0.0645152,
-    -0.0625089, -0.0605066, -0.0585082, -0.0565137, -0.0545231, -0.0525363,
-    -0.0505534, -0.0485742, -0.0465987, -0.0446268, -0.0426585, -0.0406936,
-    -0.0387321, -0.0367738, -0.0348187, -0.0328667, -0.0309175, -0.0289711,
-    -0.0270273, -0.0250861, -0.0231471, -0.0212103, -0.0192756, -0.0173427,
-    -0.0154114, -0.0134817, -0.0115532, -0.00962595, -0.00769962, -0.00577404,
-    -0.00384904, -0.00192442
-};
-
-static const float WAVE_TRIANGLE_102[DEFAULT_WAVELEN] = {
-    0, 0.00189552, 0.00379114, 0.00568696, 0.00758307, 0.00947957,
-    0.0113766, 0.0132742, 0.0151724, 0.0170715, 0.0189714, 0.0208723,
-    0.0227743, 0.0246775, 0.0265819, 0.0284877, 0.0303949, 0.0323036,
-    0.034214, 0.0361261, 0.03804, 0.0399559, 0.0418737, 0.0437935,
-    0.0457155, 0.0476398, 0.0495664, 0.0514954, 0.0534268, 0.0553608,
-    0.0572975, 0.0592368, 0.061179, 0.063124, 0.0650719, 0.0670228,
-    0.0689768, 0.0709339, 0.0728942, 0.0748577, 0.0768245, 0.0787947,
-    0.0807684, 0.0827455, 0.0847261, 0.0867103, 0.0886981, 0.0906896,
-    0.0926848, 0.0946838, 0.0966865, 0.0986931, 0.100704, 0.102718,
-    0.104736, 0.106758, 0.108784, 0.110815, 0.112849, 0.114887,
-    0.116929, 0.118976, 0.121026, 0.123081, 0.125139, 0.127202,
-    0.129269, 0.13134, 0.133415, 0.135494, 0.137577, 0.139664,
-    0.141755, 0.143851, 0.14595, 0.148053, 0.150161, 0.152272,
-    0.154387, 0.156506, 0.158629, 0.160756, 0.162886, 0.165021,
-    0.167159, 0.1693, 0.171446, 0.173594, 0.175747, 0.177903,
-    0.180062, 0.182225, 0.18439, 0.18656, 0.188732, 0.190907,
-    0.193086, 0.195267, 0.197451, 0.199639, 0.201828, 0.204021,
-    0.206216, 0.208414, 0.210614, 0.212816, 0.215021, 0.217228,
-    0.219437, 0.221648, 0.223861, 0.226076, 0.228292, 0.23051,
-    0.23273, 0.234951, 0.237173, 0.239397, 0.241622, 0.243847,
-    0.246074, 0.248302, 0.25053, 0.252759, 0.254989, 0.257219,
-    0.259449, 0.261679, 0.26391, 0.26614, 0.268371, 0.270601,
-    0.272831, 0.275061, 0.27729, 0.279518, 0.281745, 0.283972,
-    0.286198, 0.288423, 0.290646, 0.292868, 0.295089, 0.297308,
-    0.299526, 0.301742, 0.303957, 0.306169, 0.308379, 0.310587,
-    0.312793, 0.314997, 0.317198, 0.319397, 0.321593, 0.323787,
-    0.325978, 0.328166, 0.330351, 0.332532, 0.334711, 0.336887,
-    0.339059, 0.341228, 0.343393, 0.345555, 0.347713, 0.349868,
-    0.352018, 0.354165, 0.356308, 0.358447, 0.360582, 0.362713,
-    0.36484, 0.366962, 0.36908, 0.371194, 0.373304, 0.375409,
-    0.37751, 0.379606, 0.381697, 0.383784, 0.385866, 0.387944,
-    0.390017, 0.392085, 0.394149, 0.396207, 0.398261, 0.400311,
-    0.402355, 0.404394, 0.406429, 0.408459, 0.410484, 0.412504,
-    0.414519, 0.416529, 0.418535, 0.420536, 0.422532, 0.424523,
-    0.426509, 0.428491, 0.430468, 0.43244, 0.434408, 0.436371,
-    0.438329, 0.440283, 0.442232, 0.444177, 0.446118, 0.448054,
-    0.449986, 0.451913, 0.453837, 0.455756, 0.457672, 0.459583,
-    0.46149, 0.463394, 0.465294, 0.46719, 0.469082, 0.470971,
-    0.472857, 0.474739, 0.476618, 0.478494, 0.480367, 0.482237,
-    0.484104, 0.485969, 0.48783, 0.489689, 0.491546, 0.493401,
-    0.495253, 0.497103, 0.498951, 0.500798, 0.502642, 0.504485,
-    0.506327, 0.508167, 0.510006, 0.511844, 0.513681, 0.515518,
-    0.517353, 0.519188, 0.521023, 0.522857, 0.524691, 0.526525,
-    0.52836, 0.530194, 0.532029, 0.533865, 0.535701, 0.537538,
-    0.539376, 0.541215, 0.543056, 0.544898, 0.546741, 0.548587,
-    0.550434, 0.552283, 0.554134, 0.555988, 0.557844, 0.559702,
-    0.561563, 0.563427, 0.565295, 0.567165, 0.569038, 0.570915,
-    0.572796, 0.57468, 0.576568, 0.57846, 0.580356, 0.582256,
-    0.584161, 0.58607, 0.587984, 0.589902, 0.591825, 0.593754,
-    0.595687, 0.597626, 0.599569, 0.601519, 0.603474, 0.605434,
-    0.6074, 0.609372, 0.61135, 0.613334, 0.615325, 0.617321,
-    0.619324, 0.621333, 0.623349, 0.625371, 0.6274, 0.629435,
-    0.631478, 0.633527, 0.635583, 0.637646, 0.639716, 0.641793,
-    0.643877, 0.645969, 0.648067, 0.650173, 0.652286, 0.654407,
-    0.656534, 0.658669, 0.660812, 0.662961, 0.665118, 0.667283,
-    0.669455, 0.671634, 0.67382, 0.676014, 0.678215, 0.680424,
-    0.682639, 0.684862, 0.687092, 0.689329, 0.691574, 0.693825,
-    0.696083, 0.698349, 0.700621, 0.702899, 0.705185, 0.707477,
-    0.709776, 0.712081, 0.714392, 0.71671, 0.719034, 0.721364,
-    0.7237, 0.726041, 0.728389, 0.730741, 0.733099, 0.735463,
-    0.737831, 0.740205, 0.742583, 0.744966, 0.747354, 0.749745,
-    0.752141, 0.754541, 0.756945, 0.759352, 0.761763, 0.764177,
-    0.766594, 0.769013, 0.771435, 0.77386, 0.776287, 0.778716,
-    0.781146, 0.783578, 0.786011, 0.788445, 0.79088, 0.793316,
-    0.795751, 0.798187, 0.800622, 0.803057, 0.805491, 0.807924,
-    0.810356, 0.812786, 0.815214, 0.81764, 0.820064, 0.822485,
-    0.824902, 0.827317, 0.829727, 0.832134, 0.834537, 0.836935,
-    0.839328, 0.841716, 0.844098, 0.846475, 0.848845, 0.851209,
-    0.853566, 0.855916, 0.858259, 0.860594, 0.862921, 0.865239,
-    0.867549, 0.869849, 0.87214, 0.874421, 0.876692, 0.878953,
-    0.881203, 0.883441, 0.885669, 0.887884, 0.890087, 0.892278,
-    0.894455, 0.89662, 0.898771, 0.900908, 0.903031, 0.905139,
-    0.907232, 0.90931, 0.911373, 0.913419, 0.91545, 0.917463,
-    0.91946, 0.921439, 0.9234, 0.925344, 0.927269, 0.929176,
-    0.931064, 0.932932, 0.934781, 0.93661, 0.938418, 0.940206,
-    0.941973, 0.943719, 0.945443, 0.947146, 0.948826, 0.950484,
-    0.952119, 0.953731, 0.95532, 0.956885, 0.958426, 0.959943,
-    0.961435, 0.962903, 0.964346, 0.965763, 0.967155, 0.968521,
-    0.969861, 0.971175, 0.972462, 0.973722, 0.974955, 0.976161,
-    0.97734, 0.97849, 0.979613, 0.980707, 0.981774, 0.982811,
-    0.98382, 0.9848, 0.98575, 0.986672, 0.987563, 0.988425,
-    0.989258, 0.99006, 0.990832, 0.991573, 0.992284, 0.992965,
-    0.993615, 0.994234, 0.994821, 0.995378, 0.995904, 0.996398,
-    0.996861, 0.997292, 0.997692, 0.99806, 0.998396, 0.9987,
-    0.998973, 0.999213, 0.999422, 0.999598, 0.999743, 0.999855,
-    0.999936, 0.999984, 1, 0.999984, 0.999936, 0.999855,
-    0.999743, 0.999598, 0.999422, 0.999213, 0.998973, 0.9987,
-    0.998396, 0.99806, 0.997692, 0.997292, 0.996861, 0.996398,
-    0.995904, 0.995378, 0.994821, 0.994234, 0.993615, 0.992965,
-    0.992284, 0.991573, 0.990832, 0.99006, 0.989258, 0.988425,
-    0.987563, 0.986672, 0.98575, 0.9848, 0.98382, 0.982811,
-    0.981774, 0.980707, 0.979613, 0.97849, 0.97734, 0.976161,
-    0.974955, 0.973722, 0.972462, 0.971175, 0.969861, 0.968521,
-    0.967155, 0.965763, 0.964346, 0.962903, 0.961435, 0.959943,
-    0.958426, 0.956885, 0.95532, 0.953731, 0.952119, 0.950484,
-    0.948826, 0.947146, 0.945443, 0.943719, 0.941973, 0.940206,
-    0.938418, 0.93661, 0.934781, 0.932932, 0.931064, 0.929176,
-    0.927269, 0.925344, 0.9234, 0.921439, 0.91946, 0.917463,
-    0.91545, 0.913419, 0.911373, 0.90931, 0.907232, 0.905139,
-    0.903031, 0.900908, 0.898771, 0.89662, 0.894455, 0.892278,
-    0.890087, 0.887884, 0.885669, 0.883441, 0.881203, 0.878953,
-    0.876692, 0.874421, 0.87214, 0.869849, 0.867549, 0.865239,
-    0.862921, 0.860594, 0.858259, 0.855916, 0.853566, 0.851209,
-    0.848845, 0.846475, 0.844098, 0.841716, 0.839328, 0.836935,
-    0.834537, 0.832134, 0.829727, 0.827317, 0.824902, 0.822485,
-    0.820064, 0.81764, 0.815214, 0.812786, 0.810356, 0.807924,
-    0.805491, 0.803057, 0.800622, 0.798187, 0.795751, 0.793316,
-    0.79088, 0.788445, 0.786011, 0.783578, 0.781146, 0.778716,
-    0.776287, 0.77386, 0.771435, 0.769013, 0.766594, 0.764177,
-    0.761763, 0.759352, 0.756945, 0.754541, 0.752141, 0.749745,
-    0.747354, 0.744966, 0.742583, 0.740205, 0.737831, 0.735463,
-    0.733099, 0.730741, 0.728389, 0.726041, 0.7237, 0.721364,
-    0.719034, 0.71671, 0.714392, 0.712081, 0.709776, 0.707477,
-    0.705185, 0.702899, 0.700621, 0.698349, 0.696083, 0.693825,
-    0.691574, 0.689329, 0.687092, 0.684862, 0.682639, 0.680424,
-    0.678215, 0.676014, 0.67382, 0.671634, 0.669455, 0.667283,
-    0.665118, 0.662961, 0.660812, 0.658669, 0.656534, 0.654407,
-    0.652286, 0.650173, 0.648067, 0.645969, 0.643877, 0.641793,
-    0.639716, 0.637646, 0.635583, 0.633527, 0.631478, 0.629435,
-    0.6274, 0.625371, 0.623349, 0.621333, 0.619324, 0.617321,
-    0.615325, 0.613334, 0.61135, 0.609372, 0.6074, 0.605434,
-    0.603474, 0.601519, 0.599569, 0.597626, 0.595687, 0.593754,
-    0.591825, 0.589902, 0.587984, 0.58607, 0.584161, 0.582256,
-    0.580356, 0.57846, 0.576568, 0.57468, 0.572796, 0.570915,
-    0.569038, 0.567165, 0.565295, 0.563427, 0.561563, 0.559702,
-    0.557844, 0.555988, 0.554134, 0.552283, 0.550434, 0.548587,
-    0.546741, 0.544898, 0.543056, 0.541215, 0.539376, 0.537538,
-    0.535701, 0.533865, 0.532029, 0.530194, 0.52836, 0.526525,
-    0.524691, 0.522857, 0.521023, 0.519188, 0.517353, 0.515518,
-    0.513681, 0.511844, 0.510006, 0.508167, 0.506327, 0.504485,
-    0.502642, 0.500798, 0.498951, 0.497103, 0.495253, 0.493401,
-    0.491546, 0.489689, 0.48783, 0.485969, 0.484104, 0.482237,
-    0.480367, 0.478494, 0.476618, 0.474739, 0.472857, 0.470971,
-    0.469082, 0.46719, 0.465294, 0.463394, 0.46149, 0.459583,
-    0.457672, 0.455756, 0.453837, 0.451913, 0.449986, 0.448054,
-    0.446118, 0.444177, 0.442232, 0.440283, 0.438329, 0.436371,
-    0.434408, 0.43244, 0.430468, 0.428491, 0.426509, 0.424523,
-    0.422532, 0.420536, 0.418535, 0.416529, 0.414519, 0.412504,
-    0.410484, 0.408459, 0.406429, 0.404394, 0.402355, 0.400311,
-    0.398261, 0.396207, 0.394149, 0.392085, 0.390017, 0.387944,
-    0.385866, 0.383784, 0.381697, 0.379606, 0.37751, 0.375409,
-    0.373304, 0.371194, 0.36908, 0.366962, 0.36484, 0.362713,
-    0.360582, 0.358447, 0.356308, 0.354165, 0.352018, 0.349868,
-    0.347713, 0.345555, 0.343393, 0.341228, 0.339059, 0.336887,
-    0.334711, 0.332532, 0.330351, 0.328166, 0.325978, 0.323787,
-    0.321593, 0.319397, 0.317198, 0.314997, 0.312793, 0.310587,
-    0.308379, 0.306169, 0.303957, 0.301742, 0.299526, 0.297308,
-    0.295089, 0.292868, 0.290646, 0.288423, 0.286198, 0.283972,
-    0.281745, 0.279518, 0.27729, 0.275061, 0.272831, 0.270601,
-    0.268371, 0.26614, 0.26391, 0.261679, 0.259449, 0.257219,
-    0.254989, 0.252759, 0.25053, 0.248302, 0.246074, 0.243847,
-    0.241622, 0.239397, 0.237173, 0.234951, 0.23273, 0.23051,
-    0.228292, 0.226076, 0.223861, 0.221648, 0.219437, 0.217228,
-    0.215021, 0.212816, 0.210614, 0.208414, 0.206216, 0.204021,
-    0.201828, 0.199639, 0.197451, 0.195267, 0.193086, 0.190907,
-    0.188732, 0.18656, 0.18439, 0.182225, 0.180062, 0.177903,
-    0.175747, 0.173594, 0.171446, 0.1693, 0.167159, 0.165021,
-    0.162886, 0.160756, 0.158629, 0.156506, 0.154387, 0.152272,
-    0.150161, 0.148053, 0.14595, 0.143851, 0.141755, 0.139664,
-    0.137577, 0.135494, 0.133415, 0.13134, 0.129269, 0.127202,
-    0.125139, 0.123081, 0.121026, 0.118976, 0.116929, 0.114887,
-    0.112849, 0.110815, 0.108784, 0.106758, 0.104736, 0.102718,
-    0.100704, 0.0986931, 0.0966865, 0.0946838, 0.0926848, 0.0906896,
-    0.0886981, 0.0867103, 0.0847261, 0.0827455, 0.0807684, 0.0787947,
-    0.0768245, 0.0748577, 0.0728942, 0.0709339, 0.0689768, 0.0670228,
-    0.0650719, 0.063124, 0.061179, 0.0592368, 0.0572975, 0.0553608,
-    0.0534268, 0.0514954, 0.0495664, 0.0476398, 0.0457155, 0.0437935,
-    0.0418737, 0.0399559, 0.03804, 0.0361261, 0.034214, 0.0323036,
-    0.0303949, 0.0284877, 0.0265819, 0.0246775, 0.0227743, 0.0208723,
-    0.0189714, 0.0170715, 0.0151724, 0.0132742, 0.0113766, 0.00947957,
-    0.00758307, 0.00568696, 0.00379114, 0.00189552, 0, -0.00189552,
-    -0.00379114, -0.00568696, -0.00758307, -0.00947957, -0.0113766, -0.0132742,
-    -0.0151724, -0.0170715, -0.0189714, -0.0208723, -0.0227743, -0.0246775,
-    -0.0265819, -0.0284877, -0.0303949, -0.0323036, -0.034214, -0.0361261,
-    -0.03804, -0.0399559, -0.0418737, -0.0437935, -0.0457155, -0.0476398,
-    -0.0495664, -0.0514954, -0.0534268, -0.0553608, -0.0572975, -0.0592368,
-    -0.061179, -0.063124, -0.0650719, -0.0670228, -0.0689768, -0.0709339,
-    -0.0728942, -0.0748577, -0.0768245, -0.0787947, -0.0807684, -0.0827455,
-    -0.0847261, -0.0867103, -0.0886981, -0.0906896, -0.0926848, -0.0946838,
-    -0.0966865, -0.0986931, -0.100704, -0.102718, -0.104736, -0.106758,
-    -0.108784, -0.110815, -0.112849, -0.114887, -0.116929, -0.118976,
-    -0.121026, -0.123081, -0.125139, -0.127202, -0.129269, -0.13134,
-    -0.133415, -0.135494, -0.137577, -0.139664, -0.141755, -0.143851,
-    -0.14595, -0.148053, -0.150161, -0.152272, -0.154387, -0.156506,
-    -0.158629, -0.160756, -0.162886, -0.165021, -0.167159, -0.1693,
-    -0.171446, -0.173594, -0.175747, -0.177903, -0.180062, -0.182225,
-    -0.18439, -0.18656, -0.188732, -0.190907, -0.193086, -0.195267,
-    -0.197451, -0.199639, -0.201828, -0.204021, -0.206216, -0.208414,
-    -0.210614, -0.212816, -0.215021, -0.217228, -0.219437, -0.221648,
-    -0.223861, -0.226076, -0.228292, -0.23051, -0.23273, -0.234951,
-    -0.237173, -0.239397, -0.241622, -0.243847, -0.246074, -0.248302,
-    -0.25053, -0.252759, -0.254989, -0.257219, -0.259449, -0.261679,
-    -0.26391, -0.26614, -0.268371, -0.270601, -0.272831, -0.275061,
-    -0.27729, -0.279518, -0.281745, -0.283972, -0.286198, -0.288423,
-    -0.290646, -0.292868, -0.295089, -0.297308, -0.299526, -0.301742,
-    -0.303957, -0.306169, -0.308379, -0.310587, -0.312793, -0.314997,
-    -0.317198, -0.319397, -0.321593, -0.323787, -0.325978, -0.328166,
-    -0.330351, -0.332532, -0.334711, -0.336887, -0.339059, -0.341228,
-    -0.343393, -0.345555, -0.347713, -0.349868, -0.352018, -0.354165,
-    -0.356308, -0.358447, -0.360582, -0.362713, -0.36484, -0.366962,
-    -0.36908, -0.371194, -0.373304, -0.375409, -0.37751, -0.379606,
-    -0.381697, -0.383784, -0.385866, -0.387944, -0.390017, -0.392085,
-    -0.394149, -0.396207, -0.398261, -0.400311, -0.402355, -0.404394,
-    -0.406429, -0.408459, -0.410484, -0.412504, -0.414519, -0.416529,
-    -0.418535, -0.420536, -0.422532, -0.424523, -0.426509, -0.428491,
-    -0.430468, -0.43244, -0.434408, -0.436371, -0.438329, -0.440283,
-    -0.442232, -0.444177, -0.446118, -0.448054, -0.449986, -0.451913,
-    -0.453837, -0.455756, -0.457672, -0.459583, -0.46149, -0.463394,
-    -0.465294, -0.46719, -0.469082, -0.470971, -0.472857, -0.474739,
-    -0.476618, -0.478494, -0.480367, -0.482237, -0.484104, -0.485969,
-    -0.48783, -0.489689, -0.491546, -0.493401, -0.495253, -0.497103,
-    -0.498951, -0.500798, -0.502642, -0.504485, -0.506327, -0.508167,
-    -0.510006, -0.511844, -0.513681, -0.515518, -0.517353, -0.519188,
-    -0.521023, -0.522857, -0.524691, -0.526525, -0.52836, -0.530194,
-    -0.532029, -0.533865, -0.535701, -0.537538, -0.539376, -0.541215,
-    -0.543056, -0.544898, -0.546741, -0.548587, -0.550434, -0.552283,
-    -0.554134, -0.555988, -0.557844, -0.559702, -0.561563, -0.563427,
-    -0.565295, -0.567165, -0.569038, -0.570915, -0.572796, -0.57468,
-    -0.576568, -0.57846, -0.580356, -0.582256, -0.584161, -0.58607,
-    -0.587984, -0.589902, -0.591825, -0.593754, -0.595687, -0.597626,
-    -0.599569, -0.601519, -0.603474, -0.605434, -0.6074, -0.609372,
-    -0.61135, -0.613334, -0.615325, -0.617321, -0.619324, -0.621333,
-    -0.623349, -0.625371, -0.6274, -0.629435, -0.631478, -0.633527,
-    -0.635583, -0.637646, -0.639716, -0.641793, -0.643877, -0.645969,
-    -0.648067, -0.650173, -0.652286, -0.654407, -0.656534, -0.658669,
-    -0.660812, -0.662961, -0.665118, -0.667283, -0.669455, -0.671634,
-    -0.67382, -0.676014, -0.678215, -0.680424, -0.682639, -0.684862,
-    -0.687092, -0.689329, -0.691574, -0.693825, -0.696083, -0.698349,
-    -0.700621, -0.702899, -0.705185, -0.707477, -0.709776, -0.712081,
-    -0.714392, -0.71671, -0.719034, -0.721364, -0.7237, -0.726041,
-    -0.728389, -0.730741, -0.733099, -0.735463, -0.737831, -0.740205,
-    -0.742583, -0.744966, -0.747354, -0.749745, -0.752141, -0.754541,
-    -0.756945, -0.759352, -0.761763, -0.764177, -0.766594, -0.769013,
-    -0.771435, -0.77386, -0.776287, -0.778716, -0.781146, -0.783578,
-    -0.786011, -0.788445, -0.79088, -0.793316, -0.795751, -0.798187,
-    -0.800622, -0.803057, -0.805491, -0.807924, -0.810356, -0.812786,
-    -0.815214, -0.81764, -0.820064, -0.822485, -0.824902, -0.827317,
-    -0.829727, -0.832134, -0.834537, -0.836935, -0.839328, -0.841716,
-    -0.844098, -0.846475, -0.848845, -0.851209, -0.853566, -0.855916,
-    -0.858259, -0.860594, -0.862921, -0.865239, -0.867549, -0.869849,
-    -0.87214, -0.874421, -0.876692, -0.878953, -0.881203, -0.883441,
-    -0.885669, -0.887884, -0.890087, -0.892278, -0.894455, -0.89662,
-    -0.898771, -0.900908, -0.903031, -0.905139, -0.907232, -0.90931,
-    -0.911373, -0.913419, -0.91545, -0.917463, -0.91946, -0.921439,
-    -0.9234, -0.925344, -0.927269, -0.929176, -0.931064, -0.932932,
-    -0.934781, -0.93661, -0.938418, -0.940206, -0.941973, -0.943719,
-    -0.945443, -0.947146, -0.948826, -0.950484, -0.952119, -0.953731,
-    -0.95532, -0.956885, -0.958426, -0.959943, -0.961435, -0.962903,
-    -0.964346, -0.965763, -0.967155, -0.968521, -0.969861, -0.971175,
-    -0.972462, -0.973722, -0.974955, -0.976161, -0.97734, -0.97849,
-    -0.979613, -0.980707, -0.981774, -0.982811, -0.98382, -0.9848,
-    -0.98575, -0.986672, -0.987563, -0.988425, -0.989258, -0.99006,
-    -0.990832, -0.991573, -0.992284, -0.992965, -0.993615, -0.994234,
-    -0.994821, -0.995378, -0.995904, -0.996398, -0.996861, -0.997292,
-    -0.997692, -0.99806, -0.998396, -0.9987, -0.998973, -0.999213,
-    -0.999422, -0.999598, -0.999743, -0.999855, -0.999936, -0.999984,
-    -1, -0.999984, -0.999936, -0.999855, -0.999743, -0.999598,
-    -0.999422, -0.999213, -0.998973, -0.9987, -0.998396, -0.99806,
-    -0.997692, -0.997292, -0.996861, -0.996398, -0.995904, -0.995378,
-    -0.994821, -0.994234, -0.993615, -0.992965, -0.992284, -0.991573,
-    -0.990832, -0.99006, -0.989258, -0.988425, -0.987563, -0.986672,
-    -0.98575, -0.9848, -0.98382, -0.982811, -0.981774, -0.980707,
-    -0.979613, -0.97849, -0.97734, -0.976161, -0.974955, -0.973722,
-    -0.972462, -0.971175, -0.969861, -0.968521, -0.967155, -0.965763,
-    -0.964346, -0.962903, -0.961435, -0.959943, -0.958426, -0.956885,
-    -0.95532, -0.953731, -0.952119, -0.950484, -0.948826, -0.947146,
-    -0.945443, -0.943719, -0.941973, -0.940206, -0.938418, -0.93661,
-    -0.934781, -0.932932, -0.931064, -0.929176, -0.927269, -0.925344,
-    -0.9234, -0.921439, -0.91946, -0.917463, -0.91545, -0.913419,
-    -0.911373, -0.90931, -0.907232, -0.905139, -0.903031, -0.900908,
-    -0.898771, -0.89662, -0.894455, -0.892278, -0.890087, -0.887884,
-    -0.885669, -0.883441, -0.881203, -0.878953, -0.876692, -0.874421,
-    -0.87214, -0.869849, -0.867549, -0.865239, -0.862921, -0.860594,
-    -0.858259, -0.855916, -0.853566, -0.851209, -0.848845, -0.846475,
-    -0.844098, -0.841716, -0.839328, -0.836935, -0.834537, -0.832134,
-    -0.829727, -0.827317, -0.824902, -0.822485, -0.820064, -0.81764,
-    -0.815214, -0.812786, -0.810356, -0.807924, -0.805491, -0.803057,
-    -0.800622, -0.798187, -0.795751, -0.793316, -0.79088, -0.788445,
-    -0.786011, -0.783578, -0.781146, -0.778716, -0.776287, -0.77386,
-    -0.771435, -0.769013, -0.766594, -0.764177, -0.761763, -0.759352,
-    -0.756945, -0.754541, -0.752141, -0.749745, -0.747354, -0.744966,
-    -0.742583, -0.740205, -0.737831, -0.735463, -0.733099, -0.730741,
-    -0.728389, -0.726041, -0.7237, -0.721364, -0.719034, -0.71671,
-    -0.714392, -0.712081, -0.709776, -0.707477, -0.705185, -0.702899,
-    -0.700621, -0.698349, -0.696083, -0.693825, -0.691574, -0.689329,
-    -0.687092, -0.684862, -0.682639, -0.680424, -0.678215, -0.676014,
-    -0.67382, -0.671634, -0.669455, -0.667283, -0.665118, -0.662961,
-    -0.660812, -0.658669, -0.656534, -0.654407, -0.652286, -0.650173,
-    -0.648067, -0.645969, -0.643877, -0.641793, -0.639716, -0.637646,
-    -0.635583, -0.633527, -0.631478, -0.629435, -0.6274, -0.625371,
-    -0.623349, -0.621333, -0.619324, -0.617321, -0.615325, -0.613334,
-    -0.61135, -0.609372, -0.6074, -0.605434, -0.603474, -0.601519,
-    -0.599569, -0.597626, -0.595687, -0.593754, -0.591825, -0.589902,
-    -0.587984, -0.58607, -0.584161, -0.582256, -0.580356, -0.57846,
-    -0.576568, -0.57468, -0.572796, -0.570915, -0.569038, -0.567165,
-    -0.565295, -0.563427, -0.561563, -0.559702, -0.557844, -0.555988,
-    -0.554134, -0.552283, -0.550434, -0.548587, -0.546741, -0.544898,
-    -0.543056, -0.541215, -0.539376, -0.537538, -0.535701, -0.533865,
-    -0.532029, -0.530194, -0.52836, -0.526525, -0.524691, -0.522857,
-    -0.521023, -0.519188, -0.517353, -0.515518, -0.513681, -0.511844,
-    -0.510006, -0.508167, -0.506327, -0.504485, -0.502642, -0.500798,
-    -0.498951, -0.497103, -0.495253, -0.493401, -0.491546, -0.489689,
-    -0.48783, -0.485969, -0.484104, -0.482237, -0.480367, -0.478494,
-    -0.476618, -0.474739, -0.472857, -0.470971, -0.469082, -0.46719,
-    -0.465294, -0.463394, -0.46149, -0.459583, -0.457672, -0.455756,
-    -0.453837, -0.451913, -0.449986, -0.448054, -0.446118, -0.444177,
-    -0.442232, -0.440283, -0.438329, -0.436371, -0.434408, -0.43244,
-    -0.430468, -0.428491, -0.426509, -0.424523, -0.422532, -0.420536,
-    -0.418535, -0.416529, -0.414519, -0.412504, -0.410484, -0.408459,
-    -0.406429, -0.404394, -0.402355, -0.400311, -0.398261, -0.396207,
-    -0.394149, -0.392085, -0.390017, -0.387944, -0.385866, -0.383784,
-    -0.381697, -0.379606, -0.37751, -0.375409, -0.373304, -0.371194,
-    -0.36908, -0.366962, -0.36484, -0.362713, -0.360582, -0.358447,
-    -0.356308, -0.354165, -0.352018, -0.349868, -0.347713, -0.345555,
-    -0.343393, -0.341228, -0.339059, -0.336887, -0.334711, -0.332532,
-    -0.330351, -0.328166, -0.325978, -0.323787, -0.321593, -0.319397,
-    -0.317198, -0.314997, -0.312793, -0.310587, -0.308379, -0.306169,
-    -0.303957, -0.301742, -0.299526, -0.297308, -0.295089, -0.292868,
-    -0.290646, -0.288423, -0.286198, -0.283972, -0.281745, -0.279518,
-    -0.27729, -0.275061, -0.272831, -0.270601, -0.268371, -0.26614,
-    -0.26391, -0.261679, -0.259449, -0.257219, -0.254989, -0.252759,
-    -0.25053, -0.248302, -0.246074, -0.243847, -0.241622, -0.239397,
-    -0.237173, -0.234951, -0.23273, -0.23051, -0.228292, -0.226076,
-    -0.223861, -0.221648, -0.219437, -0.217228, -0.215021, -0.212816,
-    -0.210614, -0.208414, -0.206216, -0.204021, -0.201828, -0.199639,
-    -0.197451, -0.195267, -0.193086, -0.190907, -0.188732, -0.18656,
-    -0.18439, -0.182225, -0.180062, -0.177903, -0.175747, -0.173594,
-    -0.171446, -0.1693, -0.167159, -0.165021, -0.162886, -0.160756,
-    -0.158629, -0.156506, -0.154387, -0.152272, -0.150161, -0.148053,
-    -0.14595, -0.143851, -0.141755, -0.139664, -0.137577, -0.135494,
-    -0.133415, -0.13134, -0.129269, -0.127202, -0.125139, -0.123081,
-    -0.121026, -0.118976, -0.116929, -0.114887, -0.112849, -0.110815,
-    -0.108784, -0.106758, -0.104736, -0.102718, -0.100704, -0.0986931,
-    -0.0966865, -0.0946838, -0.0926848, -0.0906896, -0.0886981, -0.0867103,
-    -0.0847261, -0.0827455, -0.0807684, -0.0787947, -0.0768245, -0.0748577,
-    -0.0728942, -0.0709339, -0.0689768, -0.0670228, -0.0650719, -0.063124,
-    -0.061179, -0.0592368, -0.0572975, -0.0553608, -0.0534268, -0.0514954,
-    -0.0495664, -0.0476398, -0.0457155, -0.0437935, -0.0418737, -0.0399559,
-    -0.03804, -0.0361261, -0.034214, -0.0323036, -0.0303949, -0.0284877,
-    -0.0265819, -0.0246775, -0.0227743, -0.0208723, -0.0189714, -0.0170715,
-    -0.0151724, -0.0132742, -0.0113766, -0.00947957, -0.00758307, -0.00568696,
-    -0.00379114, -0.00189552
-};
-
-static const float WAVE_TRIANGLE_114[DEFAULT_WAVELEN] = {
-    0, 0.00184079, 0.00368162, 0.00552256, 0.00736366, 0.00920497,
-    0.0110465, 0.0128884, 0.0147306, 0.0165733, 0.0184164, 0.0202601,
-    0.0221043, 0.0239491, 0.0257946, 0.0276409, 0.0294879, 0.0313357,
-    0.0331844, 0.0350341, 0.0368847, 0.0387363, 0.0405891, 0.0424429,
-    0.044298, 0.0461543, 0.0480118, 0.0498707, 0.051731, 0.0535927,
-    0.0554559, 0.0573207, 0.059187, 0.0610549, 0.0629245, 0.0647958,
-    0.066669, 0.0685439, 0.0704207, 0.0722994, 0.0741801, 0.0760628,
-    0.0779476, 0.0798344, 0.0817234, 0.0836146, 0.0855081, 0.0874038,
-    0.0893019, 0.0912024, 0.0931053, 0.0950106, 0.0969185, 0.0988289,
-    0.100742, 0.102658, 0.104576, 0.106497, 0.108421, 0.110347,
-    0.112277, 0.114209, 0.116145, 0.118083, 0.120024, 0.121969,
-    0.123916, 0.125867, 0.12782, 0.129777, 0.131738, 0.133701,
-    0.135668, 0.137638, 0.139612, 0.141589, 0.143569, 0.145553,
-    0.147541, 0.149532, 0.151526, 0.153525, 0.155526, 0.157532,
-    0.159541, 0.161555, 0.163571, 0.165592, 0.167617, 0.169645,
-    0.171678, 0.173714, 0.175754, 0.177798, 0.179847, 0.181899,
-    0.183955, 0.186016, 0.18808, 0.190149, 0.192222, 0.194299,
-    0.19638, 0.198465, 0.200555, 0.202649, 0.204747, 0.20685,
-    0.208957, 0.211068, 0.213184, 0.215304, 0.217428, 0.219557,
-    0.22169, 0.223828, 0.22597, 0.228116, 0.230267, 0.232423,
-    0.234583, 0.236748, 0.238917, 0.24109, 0.243269, 0.245451,
-    0.247639, 0.249831, 0.252027, 0.254228, 0.256434, 0.258644,
-    0.260859, 0.263078, 0.265302, 0.267531, 0.269764, 0.272002,
-    0.274245, 0.276492, 0.278744, 0.281, 0.283261, 0.285526,
-    0.287796, 0.290071, 0.29235, 0.294634, 0.296923, 0.299216,
-    0.301514, 0.303816, 0.306122, 0.308434, 0.310749, 0.31307,
-    0.315395, 0.317724, 0.320058, 0.322396, 0.324739, 0.327086,
-    0.329437, 0.331793, 0.334154, 0.336518, 0.338887, 0.341261,
-    0.343638, 0.346021, 0.348407, 0.350797, 0.353192, 0.355591,
-    0.357994, 0.360401, 0.362813, 0.365228, 0.367648, 0.370072,
-    0.372499, 0.374931, 0.377367, 0.379806, 0.38225, 0.384697,
-    0.387149, 0.389604, 0.392062, 0.394525, 0.396991, 0.399461,
-    0.401935, 0.404412, 0.406893, 0.409377, 0.411865, 0.414356,
-    0.41685, 0.419348, 0.42185, 0.424354, 0.426862, 0.429373,
-    0.431887, 0.434405, 0.436925, 0.439449, 0.441975, 0.444504,
-    0.447036, 0.449572, 0.452109, 0.45465, 0.457193, 0.459739,
-    0.462287, 0.464838, 0.467392, 0.469948, 0.472506, 0.475067,
-    0.47763, 0.480195, 0.482762, 0.485331, 0.487903, 0.490476,
-    0.493051, 0.495628, 0.498207, 0.500788, 0.50337, 0.505954,
-    0.50854, 0.511127, 0.513715, 0.516305, 0.518896, 0.521489,
-    0.524082, 0.526677, 0.529273, 0.53187, 0.534467, 0.537066,
-    0.539665, 0.542265, 0.544866, 0.547467, 0.550069, 0.552671,
-    0.555273, 0.557876, 0.560479, 0.563082, 0.565685, 0.568289,
-    0.570892, 0.573495, 0.576098, 0.5787, 0.581302, 0.583904,
-    0.586505, 0.589106, 0.591706, 0.594305, 0.596903, 0.5995,
-    0.602097, 0.604692, 0.607286, 0.609879, 0.612471, 0.615061,
-    0.61765, 0.620237, 0.622822, 0.625406, 0.627988, 0.630568,
-    0.633147, 0.635723, 0.638297, 0.640868, 0.643438, 0.646005,
-    0.64857, 0.651132, 0.653691, 0.656248, 0.658802, 0.661353,
-    0.663901, 0.666446, 0.668988, 0.671526, 0.674061, 0.676593,
-    0.679121, 0.681646, 0.684167, 0.686684, 0.689198, 0.691707,
-    0.694213, 0.696714, 0.699211, 0.701704, 0.704192, 0.706676,
-    0.709155, 0.71163, 0.7141, 0.716565, 0.719025, 0.72148,
-    0.72393, 0.726374, 0.728814, 0.731248, 0.733676, 0.736099,
-    0.738516, 0.740928, 0.743334, 0.745733, 0.748127, 0.750515,
-    0.752896, 0.755271, 0.75764, 0.760002, 0.762358, 0.764707,
-    0.767049, 0.769384, 0.771713, 0.774034, 0.776348, 0.778655,
-    0.780955, 0.783248, 0.785532, 0.78781, 0.790079, 0.792341,
-    0.794595, 0.796841, 0.799079, 0.801309, 0.803531, 0.805744,
-    0.807949, 0.810146, 0.812334, 0.814513, 0.816684, 0.818845,
-    0.820998, 0.823142, 0.825276, 0.827402, 0.829518, 0.831625,
-    0.833722, 0.83581, 0.837888, 0.839957, 0.842016, 0.844064,
-    0.846103, 0.848132, 0.850151, 0.852159, 0.854157, 0.856145,
-    0.858122, 0.860088, 0.862044, 0.86399, 0.865924, 0.867847,
-    0.86976, 0.871661, 0.873552, 0.875431, 0.877298, 0.879155,
-    0.881, 0.882833, 0.884655, 0.886465, 0.888263, 0.890049,
-    0.891823, 0.893586, 0.895336, 0.897074, 0.8988, 0.900513,
-    0.902214, 0.903903, 0.905579, 0.907242, 0.908893, 0.910531,
-    0.912156, 0.913768, 0.915367, 0.916954, 0.918527, 0.920086,
-    0.921633, 0.923166, 0.924686, 0.926192, 0.927685, 0.929164,
-    0.930629, 0.932081, 0.933519, 0.934942, 0.936353, 0.937749,
-    0.93913, 0.940498, 0.941852, 0.943191, 0.944516, 0.945827,
-    0.947123, 0.948405, 0.949672, 0.950925, 0.952163, 0.953386,
-    0.954594, 0.955788, 0.956967, 0.95813, 0.959279, 0.960413,
-    0.961531, 0.962635, 0.963723, 0.964796, 0.965854, 0.966896,
-    0.967923, 0.968934, 0.96993, 0.970911, 0.971876, 0.972825,
-    0.973759, 0.974676, 0.975579, 0.976465, 0.977335, 0.97819,
-    0.979028, 0.979851, 0.980658, 0.981448, 0.982223, 0.982981,
-    0.983724, 0.98445, 0.98516, 0.985853, 0.986531, 0.987192,
-    0.987837, 0.988465, 0.989077, 0.989673, 0.990252, 0.990814,
-    0.99136, 0.99189, 0.992403, 0.992899, 0.993379, 0.993842,
-    0.994289, 0.994718, 0.995132, 0.995528, 0.995908, 0.996271,
-    0.996617, 0.996946, 0.997259, 0.997555, 0.997834, 0.998096,
-    0.998341, 0.998569, 0.998781, 0.998975, 0.999153, 0.999314,
-    0.999458, 0.999585, 0.999695, 0.999788, 0.999864, 0.999924,
-    0.999966, 0.999992, 1, 0.999992, 0.999966, 0.999924,
-    0.999864, 0.999788, 0.999695, 0.999585, 0.999458, 0.999314,
-    0.999153, 0.998975, 0.998781, 0.998569, 0.998341, 0.998096,
-    0.997834, 0.997555, 0.997259, 0.996946, 0.996617, 0.996271,
-    0.995908, 0.995528, 0.995132, 0.994718, 0.994289, 0.993842,
-    0.993379, 0.992899, 0.992403, 0.99189, 0.99136, 0.990814,
-    0.990252, 0.989673, 0.989077, 0.988465, 0.987837, 0.987192,
-    0.986531, 0.985853, 0.98516, 0.98445, 0.983724, 0.982981,
-    0.982223, 0.981448, 0.980658, 0.979851, 0.979028, 0.97819,
-    0.977335, 0.976465, 0.975579, 0.974676, 0.973759, 0.972825,
-    0.971876, 0.970911, 0.96993, 0.968934, 0.967923, 0.966896,
-    0.965854, 0.964796, 0.963723, 0.962635, 0.961531, 0.960413,
-    0.959279, 0.95813, 0.956967, 0.955788, 0.954594, 0.953386,
-    0.952163, 0.950925, 0.949672, 0.948405, 0.947123, 0.945827,
-    0.944516, 0.943191, 0.941852, 0.940498, 0.93913, 0.937749,
-    0.936353, 0.934942, 0.933519, 0.932081, 0.930629, 0.929164,
-    0.927685, 0.926192, 0.924686, 0.923166, 0.921633, 0.920086,
-    0.918527, 0.916954, 0.915367, 0.913768, 0.912156, 0.910531,
-    0.908893, 0.907242, 0.905579, 0.903903, 0.902214, 0.900513,
-    0.8988, 0.897074, 0.895336, 0.893586, 0.891823, 0.890049,
-    0.888263, 0.886465, 0.884655, 0.882833, 0.881, 0.879155,
-    0.877298, 0.875431, 0.873552, 0.871661, 0.86976, 0.867847,
-    0.865924, 0.86399, 0.862044, 0.860088, 0.858122, 0.856145,
-    0.854157, 0.852159, 0.850151, 0.848132, 0.846103, 0.844064,
-    0.842016, 0.839957, 0.837888, 0.83581, 0.833722, 0.831625,
-    0.829518, 0.827402, 0.825276, 0.823142, 0.820998, 0.818845,
-    0.816684, 0.814513, 0.812334, 0.810146, 0.807949, 0.805744,
-    0.803531, 0.801309, 0.799079, 0.796841, 0.794595, 0.792341,
-    0.790079, 0.78781, 0.785532, 0.783248, 0.780955, 0.778655,
-    0.776348, 0.774034, 0.771713, 0.769384, 0.767049, 0.764707,
-    0.762358, 0.760002, 0.75764, 0.755271, 0.752896, 0.750515,
-    0.748127, 0.745733, 0.743334, 0.740928, 0.738516, 0.736099,
-    0.733676, 0.731248, 0.728814, 0.726374, 0.72393, 0.72148,
-    0.719025, 0.716565, 0.7141, 0.71163, 0.709155, 0.706676,
-    0.704192, 0.701704, 0.699211, 0.696714, 0.694213, 0.691707,
-    0.689198, 0.686684, 0.684167, 0.681646, 0.679121, 0.676593,
-    0.674061, 0.671526, 0.668988, 0.666446, 0.663901, 0.661353,
-    0.658802, 0.656248, 0.653691, 0.651132, 0.64857, 0.646005,
-    0.643438, 0.640868, 0.638297, 0.635723, 0.633147, 0.630568,
-    0.627988, 0.625406, 0.622822, 0.620237, 0.61765, 0.615061,
-    0.612471, 0.609879, 0.607286, 0.604692, 0.602097, 0.5995,
-    0.596903, 0.594305, 0.591706, 0.589106, 0.586505, 0.583904,
-    0.581302, 0.5787, 0.576098, 0.573495, 0.570892, 0.568289,
-    0.565685, 0.563082, 0.560479, 0.557876, 0.555273, 0.552671,
-    0.550069, 0.547467, 0.544866, 0.542265, 0.539665, 0.537066,
-    0.534467, 0.53187, 0.529273, 0.526677, 0.524082, 0.521489,
-    0.518896, 0.516305, 0.513715, 0.511127, 0.50854, 0.505954,
-    0.50337, 0.500788, 0.498207, 0.495628, 0.493051, 0.490476,
-    0.487903, 0.485331, 0.482762, 0.480195, 0.47763, 0.475067,
-    0.472506, 0.469948, 0.467392, 0.464838, 0.462287, 0.459739,
-    0.457193, 0.45465, 0.452109, 0.449572, 0.447036, 0.444504,
-    0.441975, 0.439449, 0.436925, 0.434405, 0.431887, 0.429373,
-    0.426862, 0.424354, 0.42185, 0.419348, 0.41685, 0.414356,
-    0.411865, 0.409377, 0.406893, 0.404412, 0.401935, 0.399461,
-    0.396991, 0.394525, 0.392062, 0.389604, 0.387149, 0.384697,
-    0.38225, 0.379806, 0.377367, 0.374931, 0.372499, 0.370072,
-    0.367648, 0.365228, 0.362813, 0.360401, 0.357994, 0.355591,
-    0.353192, 0.350797, 0.348407, 0.346021, 0.343638, 0.341261,
-    0.338887, 0.336518, 0.334154, 0.331793, 0.329437, 0.327086,
-    0.324739, 0.322396, 0.320058, 0.317724, 0.315395, 0.31307,
-    0.310749, 0.308434, 0.306122, 0.303816, 0.301514, 0.299216,
-    0.296923, 0.294634, 0.29235, 0.290071, 0.287796, 0.285526,
-    0.283261, 0.281, 0.278744, 0.276492, 0.274245, 0.272002,
-    0.269764, 0.267531, 0.265302, 0.263078, 0.260859, 0.258644,
-    0.256434, 0.254228, 0.252027, 0.249831, 0.247639, 0.245451,
-    0.243269, 0.24109, 0.238917, 0.236748, 0.234583, 0.232423,
-    0.230267, 0.228116, 0.22597, 0.223828, 0.22169, 0.219557,
-    0.217428, 0.215304, 0.213184, 0.211068, 0.208957, 0.20685,
-    0.204747, 0.202649, 0.200555, 0.198465, 0.19638, 0.194299,
-    0.192222, 0.190149, 0.18808, 0.186016, 0.183955, 0.181899,
-    0.179847, 0.177798, 0.175754, 0.173714, 0.171678, 0.169645,
-    0.167617, 0.165592, 0.163571, 0.161555, 0.159541, 0.157532,
-    0.155526, 0.153525, 0.151526, 0.149532, 0.147541, 0.145553,
-    0.143569, 0.141589, 0.139612, 0.137638, 0.135668, 0.133701,
-    0.131738, 0.129777, 0.12782, 0.125867, 0.123916, 0.121969,
-    0.120024, 0.118083, 0.116145, 0.114209, 0.112277, 0.110347,
-    0.108421, 0.106497, 0.104576, 0.102658, 0.100742, 0.0988289,
-    0.0969185, 0.0950106, 0.0931053, 0.0912024, 0.0893019, 0.0874038,
-    0.0855081, 0.0836146, 0.0817234, 0.0798344, 0.0779476, 0.0760628,
-    0.0741801, 0.0722994, 0.0704207, 0.0685439, 0.066669, 0.0647958,
-    0.0629245, 0.0610549, 0.059187, 0.0573207, 0.0554559, 0.0535927,
-    0.051731, 0.0498707, 0.0480118, 0.0461543, 0.044298, 0.0424429,
-    0.0405891, 0.0387363, 0.0368847, 0.0350341, 0.0331844, 0.0313357,
-    0.0294879, 0.0276409, 0.0257946, 0.0239491, 0.0221043, 0.0202601,
-    0.0184164, 0.0165733, 0.0147306, 0.0128884, 0.0110465, 0.00920497,
-    0.00736366, 0.00552256, 0.00368162, 0.00184079, 0, -0.00184079,
-    -0.00368162, -0.00552256, -0.00736366, -0.00920497, -0.0110465, -0.0128884,
-    -0.0147306, -0.0165733, -0.0184164, -0.0202601, -0.0221043, -0.0239491,
-    -0.0257946, -0.0276409, -0.0294879, -0.0313357, -0.0331844, -0.0350341,
-    -0.0368847, -0.0387363, -0.0405891, -0.0424429, -0.044298, -0.0461543,
-    -0.0480118, -0.0498707, -0.051731, -0.0535927, -0.0554559, -0.0573207,
-    -0.059187, -0.0610549, -0.0629245, -0.0647958, -0.066669, -0.0685439,
-    -0.0704207, -0.0722994, -0.0741801, -0.0760628, -0.0779476, -0.0798344,
-    -0.0817234, -0.0836146, -0.0855081, -0.0874038, -0.0893019, -0.0912024,
-    -0.0931053, -0.0950106, -0.0969185, -0.0988289, -0.100742, -0.102658,
-    -0.104576, -0.106497, -0.108421, -0.110347, -0.112277, -0.114209,
-    -0.116145, -0.118083, -0.120024, -0.121969, -0.123916, -0.125867,
-    -0.12782, -0.129777, -0.131738, -0.133701, -0.135668, -0.137638,
-    -0.139612, -0.141589, -0.143569, -0.145553, -0.147541, -0.149532,
-    -0.151526, -0.153525, -0.155526, -0.157532, -0.159541, -0.161555,
-    -0.163571, -0.165592, -0.167617, -0.169645, -0.171678, -0.173714,
-    -0.175754, -0.177798, -0.179847, -0.181899, -0.183955, -0.186016,
-    -0.18808, -0.190149, -0.192222, -0.194299, -0.19638, -0.198465,
-    -0.200555, -0.202649, -0.204747, -0.20685, -0.208957, -0.211068,
-    -0.213184, -0.215304, -0.217428, -0.219557, -0.22169, -0.223828,
-    -0.22597, -0.228116, -0.230267, -0.232423, -0.234583, -0.236748,
-    -0.238917, -0.24109, -0.243269, -0.245451, -0.247639, -0.249831,
-    -0.252027, -0.254228, -0.256434, -0.258644, -0.260859, -0.263078,
-    -0.265302, -0.267531, -0.269764, -0.272002, -0.274245, -0.276492,
-    -0.278744, -0.281, -0.283261, -0.285526, -0.287796, -0.290071,
-    -0.29235, -0.294634, -0.296923, -0.299216, -0.301514, -0.303816,
-    -0.306122, -0.308434, -0.310749, -0.31307, -0.315395, -0.317724,
-    -0.320058, -0.322396, -0.324739, -0.327086, -0.329437, -0.331793,
-    -0.334154, -0.336518, -0.338887, -0.341261, -0.343638, -0.346021,
-    -0.348407, -0.350797, -0.353192, -0.355591, -0.357994, -0.360401,
-    -0.362813, -0.365228, -0.367648, -0.370072, -0.372499, -0.374931,
-    -0.377367, -0.379806, -0.38225, -0.384697, -0.387149, -0.389604,
-    -0.392062, -0.394525, -0.396991, -0.399461, -0.401935, -0.404412,
-    -0.406893, -0.409377, -0.411865, -0.414356, -0.41685, -0.419348,
-    -0.42185, -0.424354, -0.426862, -0.429373, -0.431887, -0.434405,
-    -0.436925, -0.439449, -0.441975, -0.444504, -0.447036, -0.449572,
-    -0.452109, -0.45465, -0.457193, -0.459739, -0.462287, -0.464838,
-    -0.467392, -0.469948, -0.472506, -0.475067, -0.47763, -0.480195,
-    -0.482762, -0.485331, -0.487903, -0.490476, -0.493051, -0.495628,
-    -0.498207, -0.500788, -0.50337, -0.505954, -0.50854, -0.511127,
-    -0.513715, -0.516305, -0.518896, -0.521489, -0.524082, -0.526677,
-    -0.529273, -0.53187, -0.534467, -0.537066, -0.539665, -0.542265,
-    -0.544866, -0.547467, -0.550069, -0.552671, -0.555273, -0.557876,
-    -0.560479, -0.563082, -0.565685, -0.568289, -0.570892, -0.573495,
-    -0.576098, -0.5787, -0.581302, -0.583904, -0.586505, -0.589106,
-    -0.591706, -0.594305, -0.596903, -0.5995, -0.602097, -0.604692,
-    -0.607286, -0.609879, -0.612471, -0.615061, -0.61765, -0.620237,
-    -0.622822, -0.625406, -0.627988, -0.630568, -0.633147, -0.635723,
-    -0.638297, -0.640868, -0.643438, -0.646005, -0.64857, -0.651132,
-    -0.653691, -0.656248, -0.658802, -0.661353, -0.663901, -0.666446,
-    -0.668988, -0.671526, -0.674061, -0.676593, -0.679121, -0.681646,
-    -0.684167, -0.686684, -0.689198, -0.691707, -0.694213, -0.696714,
-    -0.699211, -0.701704, -0.704192, -0.706676, -0.709155, -0.71163,
-    -0.7141, -0.716565, -0.719025, -0.72148, -0.72393, -0.726374,
-    -0.728814, -0.731248, -0.733676, -0.736099, -0.738516, -0.740928,
-    -0.743334, -0.745733, -0.748127, -0.750515, -0.752896, -0.755271,
-    -0.75764, -0.760002, -0.762358, -0.764707, -0.767049, -0.769384,
-    -0.771713, -0.774034, -0.776348, -0.778655, -0.780955, -0.783248,
-    -0.785532, -0.78781, -0.790079, -0.792341, -0.794595, -0.796841,
-    -0.799079, -0.801309, -0.803531, -0.805744, -0.807949, -0.810146,
-    -0.812334, -0.814513, -0.816684, -0.818845, -0.820998, -0.823142,
-    -0.825276, -0.827402, -0.829518, -0.831625, -0.833722, -0.83581,
-    -0.837888, -0.839957, -0.842016, -0.844064, -0.846103, -0.848132,
-    -0.850151, -0.852159, -0.854157, -0.856145, -0.858122, -0.860088,
-    -0.862044, -0.86399, -0.865924, -0.867847, -0.86976, -0.871661,
-    -0.873552, -0.875431, -0.877298, -0.879155, -0.881, -0.882833,
-    -0.884655, -0.886465, -0.888263, -0.890049, -0.891823, -0.893586,
-    -0.895336, -0.897074, -0.8988, -0.900513, -0.902214, -0.903903,
-    -0.905579, -0.907242, -0.908893, -0.910531, -0.912156, -0.913768,
-    -0.915367, -0.916954, -0.918527, -0.920086, -0.921633, -0.923166,
-    -0.924686, -0.926192, -0.927685, -0.929164, -0.930629, -0.932081,
-    -0.933519, -0.934942, -0.936353, -0.937749, -0.93913, -0.940498,
-    -0.941852, -0.943191, -0.944516, -0.945827, -0.947123, -0.948405,
-    -0.949672, -0.950925, -0.952163, -0.953386, -0.954594, -0.955788,
-    -0.956967, -0.95813, -0.959279, -0.960413, -0.961531, -0.962635,
-    -0.963723, -0.964796, -0.965854, -0.966896, -0.967923, -0.968934,
-    -0.96993, -0.970911, -0.971876, -0.972825, -0.973759, -0.974676,
-    -0.975579, -0.976465, -0.977335, -0.97819, -0.979028, -0.979851,
-    -0.980658, -0.981448, -0.982223, -0.982981, -0.983724, -0.98445,
-    -0.98516, -0.985853, -0.986531, -0.987192, -0.987837, -0.988465,
-    -0.989077, -0.989673, -0.990252, -0.990814, -0.99136, -0.99189,
-    -0.992403, -0.992899, -0.993379, -0.993842, -0.994289, -0.994718,
-    -0.995132, -0.995528, -0.995908, -0.996271, -0.996617, -0.996946,
-    -0.997259, -0.997555, -0.997834, -0.998096, -0.998341, -0.998569,
-    -0.998781, -0.998975, -0.999153, -0.999314, -0.999458, -0.999585,
-    -0.999695, -0.999788, -0.999864, -0.999924, -0.999966, -0.999992,
-    -1, -0.999992, -0.999966, -0.999924, -0.999864, -0.999788,
-    -0.999695, -0.999585, -0.999458, -0.999314, -0.999153, -0.998975,
-    -0.998781, -0.998569, -0.998341, -0.998096, -0.997834, -0.997555,
-    -0.997259, -0.996946, -0.996617, -0.996271, -0.995908, -0.995528,
-    -0.995132, -0.994718, -0.994289, -0.993842, -0.993379, -0.992899,
-    -0.992403, -0.99189, -0.99136, -0.990814, -0.990252, -0.989673,
-    -0.989077, -0.988465, -0.987837, -0.987192, -0.986531, -0.985853,
-    -0.98516, -0.98445, -0.983724, -0.982981, -0.982223, -0.981448,
-    -0.980658, -0.979851, -0.979028, -0.97819, -0.977335, -0.976465,
-    -0.975579, -0.974676, -0.973759, -0.972825, -0.971876, -0.970911,
-    -0.96993, -0.968934, -0.967923, -0.966896, -0.965854, -0.964796,
-    -0.963723, -0.962635, -0.961531, -0.960413, -0.959279, -0.95813,
-    -0.956967, -0.955788, -0.954594, -0.953386, -0.952163, -0.950925,
-    -0.949672, -0.948405, -0.947123, -0.945827, -0.944516, -0.943191,
-    -0.941852, -0.940498, -0.93913, -0.937749, -0.936353, -0.934942,
-    -0.933519, -0.932081, -0.930629, -0.929164, -0.927685, -0.926192,
-    -0.924686, -0.923166, -0.921633, -0.920086, -0.918527, -0.916954,
-    -0.915367, -0.913768, -0.912156, -0.910531, -0.908893, -0.907242,
-    -0.905579, -0.903903, -0.902214, -0.900513, -0.8988, -0.897074,
-    -0.895336, -0.893586, -0.891823, -0.890049, -0.888263, -0.886465,
-    -0.884655, -0.882833, -0.881, -0.879155, -0.877298, -0.875431,
-    -0.873552, -0.871661, -0.86976, -0.867847, -0.865924, -0.86399,
-    -0.862044, -0.860088, -0.858122, -0.856145, -0.854157, -0.852159,
-    -0.850151, -0.848132, -0.846103, -0.844064, -0.842016, -0.839957,
-    -0.837888, -0.83581, -0.833722, -0.831625, -0.829518, -0.827402,
-    -0.825276, -0.823142, -0.820998, -0.818845, -0.816684, -0.814513,
-    -0.812334, -0.810146, -0.807949, -0.805744, -0.803531, -0.801309,
-    -0.799079, -0.796841, -0.794595, -0.792341, -0.790079, -0.78781,
-    -0.785532, -0.783248, -0.780955, -0.778655, -0.776348, -0.774034,
-    -0.771713, -0.769384, -0.767049, -0.764707, -0.762358, -0.760002,
-    -0.75764, -0.755271, -0.752896, -0.750515, -0.748127, -0.745733,
-    -0.743334, -0.740928, -0.738516, -0.736099, -0.733676, -0.731248,
-    -0.728814, -0.726374, -0.72393, -0.72148, -0.719025, -0.716565,
-    -0.7141, -0.71163, -0.709155, -0.706676, -0.704192, -0.701704,
-    -0.699211, -0.696714, -0.694213, -0.691707, -0.689198, -0.686684,
-    -0.684167, -0.681646, -0.679121, -0.676593, -0.674061, -0.671526,
-    -0.668988, -0.666446, -0.663901, -0.661353, -0.658802, -0.656248,
-    -0.653691, -0.651132, -0.64857, -0.646005, -0.643438, -0.640868,
-    -0.638297, -0.635723, -0.633147, -0.630568, -0.627988, -0.625406,
-    -0.622822, -0.620237, -0.61765, -0.615061, -0.612471, -0.609879,
-    -0.607286, -0.604692, -0.602097, -0.5995, -0.596903, -0.594305,
-    -0.591706, -0.589106, -0.586505, -0.583904, -0.581302, -0.5787,
-    -0.576098, -0.573495, -0.570892, -0.568289, -0.565685, -0.563082,
-    -0.560479, -0.557876, -0.555273, -0.552671, -0.550069, -0.547467,
-    -0.544866, -0.542265, -0.539665, -0.537066, -0.534467, -0.53187,
-    -0.529273, -0.526677, -0.524082, -0.521489, -0.518896, -0.516305,
-    -0.513715, -0.511127, -0.50854, -0.505954, -0.50337, -0.500788,
-    -0.498207, -0.495628, -0.493051, -0.490476, -0.487903, -0.485331,
-    -0.482762, -0.480195, -0.47763, -0.475067, -0.472506, -0.469948,
-    -0.467392, -0.464838, -0.462287, -0.459739, -0.457193, -0.45465,
-    -0.452109, -0.449572, -0.447036, -0.444504, -0.441975, -0.439449,
-    -0.436925, -0.434405, -0.431887, -0.429373, -0.426862, -0.424354,
-    -0.42185, -0.419348, -0.41685, -0.414356, -0.411865, -0.409377,
-    -0.406893, -0.404412, -0.401935, -0.399461, -0.396991, -0.394525,
-    -0.392062, -0.389604, -0.387149, -0.384697, -0.38225, -0.379806,
-    -0.377367, -0.374931, -0.372499, -0.370072, -0.367648, -0.365228,
-    -0.362813, -0.360401, -0.357994, -0.355591, -0.353192, -0.350797,
-    -0.348407, -0.346021, -0.343638, -0.341261, -0.338887, -0.336518,
-    -0.334154, -0.331793, -0.329437, -0.327086, -0.324739, -0.322396,
-    -0.320058, -0.317724, -0.315395, -0.31307, -0.310749, -0.308434,
-    -0.306122, -0.303816, -0.301514, -0.299216, -0.296923, -0.294634,
-    -0.29235, -0.290071, -0.287796, -0.285526, -0.283261, -0.281,
-    -0.278744, -0.276492, -0.274245, -0.272002, -0.269764, -0.267531,
-    -0.265302, -0.263078, -0.260859, -0.258644, -0.256434, -0.254228,
-    -0.252027, -0.249831, -0.247639, -0.245451, -0.243269, -0.24109,
-    -0.238917, -0.236748, -0.234583, -0.232423, -0.230267, -0.228116,
-    -0.22597, -0.223828, -0.22169, -0.219557, -0.217428, -0.215304,
-    -0.213184, -0.211068, -0.208957, -0.20685, -0.204747, -0.202649,
-    -0.200555, -0.198465, -0.19638, -0.194299, -0.192222, -0.190149,
-    -0.18808, -0.186016, -0.183955, -0.181899, -0.179847, -0.177798,
-    -0.175754, -0.173714, -0.171678, -0.169645, -0.167617, -0.165592,
-    -0.163571, -0.161555, -0.159541, -0.157532, -0.155526, -0.153525,
-    -0.151526, -0.149532, -0.147541, -0.145553, -0.143569, -0.141589,
-    -0.139612, -0.137638, -0.135668, -0.133701, -0.131738, -0.129777,
-    -0.12782, -0.125867, -0.123916, -0.121969, -0.120024, -0.118083,
-    -0.116145, -0.114209, -0.112277, -0.110347, -0.108421, -0.106497,
-    -0.104576, -0.102658, -0.100742, -0.0988289, -0.0969185, -0.0950106,
-    -0.0931053, -0.0912024, -0.0893019, -0.0874038, -0.0855081, -0.0836146,
-    -0.0817234, -0.0798344, -0.0779476, -0.0760628, -0.0741801, -0.0722994,
-    -0.0704207, -0.0685439, -0.066669, -0.0647958, -0.0629245, -0.0610549,
-    -0.059187, -0.0573207, -0.0554559, -0.0535927, -0.051731, -0.0498707,
-    -0.0480118, -0.0461543, -0.044298, -0.0424429, -0.0405891, -0.0387363,
-    -0.0368847, -0.0350341, -0.0331844, -0.0313357, -0.0294879, -0.0276409,
-    -0.0257946, -0.0239491, -0.0221043, -0.0202601, -0.0184164, -0.0165733,
-    -0.0147306, -0.0128884, -0.0110465, -0.00920497, -0.00736366, -0.00552256,
-    -0.00368162, -0.00184079
-};
-
-static const float WAVE_TRIANGLE_126[DEFAULT_WAVELEN] = {
-    0, 0.00306796, 0.00613588, 0.00920375, 0.0122715, 0.0153392,
-    0.0184067, 0.0214741, 0.0245412, 0.0276081, 0.0306748, 0.0337412,
-    0.0368072, 0.0398729, 0.0429383, 0.0460032, 0.0490677, 0.0521317,
-    0.0551952, 0.0582583, 0.0613207, 0.0643826, 0.0674439, 0.0705046,
-    0.0735646, 0.0766239, 0.0796824, 0.0827403, 0.0857973, 0.0888536,
-    0.091909, 0.0949635, 0.0980171, 0.10107, 0.104122, 0.107172,
-    0.110222, 0.113271, 0.116319, 0.119365, 0.122411, 0.125455,
-    0.128498, 0.13154, 0.134581, 0.13762, 0.140658, 0.143695,
-    0.14673, 0.149765, 0.152797, 0.155828, 0.158858, 0.161886,
-    0.164913, 0.167938, 0.170962, 0.173984, 0.177004, 0.180023,
-    0.18304, 0.186055, 0.189069, 0.19208, 0.19509, 0.198098,
-    0.201105, 0.204109, 0.207111, 0.210112, 0.21311, 0.216107,
-    0.219101, 0.222094, 0.225084, 0.228072, 0.231058, 0.234042,
-    0.237024, 0.240003, 0.24298, 0.245955, 0.248928, 0.251898,
-    0.254866, 0.257831, 0.260794, 0.263755, 0.266713, 0.269668,
-    0.272621, 0.275572, 0.27852, 0.281465, 0.284408, 0.287347,
-    0.290285, 0.293219, 0.296151, 0.29908, 0.302006, 0.304929,
-    0.30785, 0.310767, 0.313682, 0.316593, 0.319502, 0.322408,
-    0.32531, 0.32821, 0.331106, 0.334, 0.33689, 0.339777,
-    0.342661, 0.345541, 0.348419, 0.351293, 0.354164, 0.357031,
-    0.359895, 0.362756, 0.365613, 0.368467, 0.371317, 0.374164,
-    0.377007, 0.379847, 0.382683, 0.385516, 0.388345, 0.39117,
-    0.393992, 0.39681, 0.399624, 0.402435, 0.405241, 0.408044,
-    0.410843, 0.413638, 0.41643, 0.419217, 0.422, 0.42478,
-    0.427555, 0.430326, 0.433094, 0.435857, 0.438616, 0.441371,
-    0.444122, 0.446869, 0.449611, 0.45235, 0.455084, 0.457813,
-    0.460539, 0.46326, 0.465976, 0.468689, 0.471397, 0.4741,
-    0.476799, 0.479494, 0.482184, 0.484869, 0.48755, 0.490226,
-    0.492898, 0.495565, 0.498228, 0.500885, 0.503538, 0.506187,
-    0.50883, 0.511469, 0.514103, 0.516732, 0.519356, 0.521975,
-    0.52459, 0.527199, 0.529804, 0.532403, 0.534998, 0.537587,
-    0.540171, 0.542751, 0.545325, 0.547894, 0.550458, 0.553017,
-    0.55557, 0.558119, 0.560662, 0.563199, 0.565732, 0.568259,
-    0.570781, 0.573297, 0.575808, 0.578314, 0.580814, 0.583309,
-    0.585798, 0.588282, 0.59076, 0.593232, 0.595699, 0.598161,
-    0.600616, 0.603067, 0.605511, 0.60795, 0.610383, 0.61281,
-    0.615232, 0.617647, 0.620057, 0.622461, 0.624859, 0.627252,
-    0.629638, 0.632019, 0.634393, 0.636762, 0.639124, 0.641481,
-    0.643832, 0.646176, 0.648514, 0.650847, 0.653173, 0.655493,
-    0.657807, 0.660114, 0.662416, 0.664711, 0.667, 0.669283,
-    0.671559, 0.673829, 0.676093, 0.67835, 0.680601, 0.682846,
-    0.685084, 0.687315, 0.689541, 0.691759, 0.693971, 0.696177,
-    0.698376, 0.700569, 0.702755, 0.704934, 0.707107, 0.709273,
-    0.711432, 0.713585, 0.715731, 0.71787, 0.720003, 0.722128,
-    0.724247, 0.726359, 0.728464, 0.730563, 0.732654, 0.734739,
-    0.736817, 0.738887, 0.740951, 0.743008, 0.745058, 0.747101,
-    0.749136, 0.751165, 0.753187, 0.755201, 0.757209, 0.759209,
-    0.761202, 0.763188, 0.765167, 0.767139, 0.769103, 0.771061,
-    0.77301, 0.774953, 0.776888, 0.778817, 0.780737, 0.782651,
-    0.784557, 0.786455, 0.788346, 0.79023, 0.792107, 0.793975,
-    0.795837, 0.797691, 0.799537, 0.801376, 0.803208, 0.805031,
-    0.806848, 0.808656, 0.810457, 0.812251, 0.814036, 0.815814,
-    0.817585, 0.819348, 0.821103, 0.82285, 0.824589, 0.826321,
-    0.828045, 0.829761, 0.83147, 0.83317, 0.834863, 0.836548,
-    0.838225, 0.839894, 0.841555, 0.843208, 0.844854, 0.846491,
-    0.84812, 0.849742, 0.851355, 0.852961, 0.854558, 0.856147,
-    0.857729, 0.859302, 0.860867, 0.862424, 0.863973, 0.865514,
-    0.867046, 0.868571, 0.870087, 0.871595, 0.873095, 0.874587,
-    0.87607, 0.877545, 0.879012, 0.880471, 0.881921, 0.883363,
-    0.884797, 0.886223, 0.88764, 0.889048, 0.890449, 0.891841,
-    0.893224, 0.894599, 0.895966, 0.897325, 0.898674, 0.900016,
-    0.901349, 0.902673, 0.903989, 0.905297, 0.906596, 0.907886,
-    0.909168, 0.910441, 0.911706, 0.912962, 0.91421, 0.915449,
-    0.916679, 0.917901, 0.919114, 0.920318, 0.921514, 0.922701,
-    0.92388, 0.925049, 0.92621, 0.927363, 0.928506, 0.929641,
-    0.930767, 0.931884, 0.932993, 0.934093, 0.935184, 0.936266,
-    0.937339, 0.938404, 0.939459, 0.940506, 0.941544, 0.942573,
-    0.943593, 0.944605, 0.945607, 0.946601, 0.947586, 0.948561,
-    0.949528, 0.950486, 0.951435, 0.952375, 0.953306, 0.954228,
-    0.955141, 0.956045, 0.95694, 0.957826, 0.958703, 0.959572,
-    0.960431, 0.96128, 0.962121, 0.962953, 0.963776, 0.96459,
-    0.965394, 0.96619, 0.966976, 0.967754, 0.968522, 0.969281,
-    0.970031, 0.970772, 0.971504, 0.972226, 0.97294, 0.973644,
-    0.974339, 0.975025, 0.975702, 0.97637, 0.977028, 0.977677,
-    0.978317, 0.978948, 0.97957, 0.980182, 0.980785, 0.981379,
-    0.981964, 0.982539, 0.983105, 0.983662, 0.98421, 0.984749,
-    0.985278, 0.985798, 0.986308, 0.986809, 0.987301, 0.987784,
-    0.988258, 0.988722, 0.989177, 0.989622, 0.990058, 0.990485,
-    0.990903, 0.991311, 0.99171, 0.992099, 0.99248, 0.99285,
-    0.993212, 0.993564, 0.993907, 0.99424, 0.994565, 0.994879,
-    0.995185, 0.995481, 0.995767, 0.996045, 0.996313, 0.996571,
-    0.99682, 0.99706, 0.99729, 0.997511, 0.997723, 0.997925,
-    0.998118, 0.998302, 0.998476, 0.99864, 0.998795, 0.998941,
-    0.999078, 0.999205, 0.999322, 0.999431, 0.999529, 0.999619,
-    0.999699, 0.999769, 0.999831, 0.999882, 0.999925, 0.999958,
-    0.999981, 0.999995, 1, 0.999995, 0.999981, 0.999958,
-    0.999925, 0.999882, 0.999831, 0.999769, 0.999699, 0.999619,
-    0.999529, 0.999431, 0.999322, 0.999205, 0.999078, 0.998941,
-    0.998795, 0.99864, 0.998476, 0.998302, 0.998118, 0.997925,
-    0.997723, 0.997511, 0.99729, 0.99706, 0.99682, 0.996571,
-    0.996313, 0.996045, 0.995767, 0.995481, 0.995185, 0.994879,
-    0.994565, 0.99424, 0.993907, 0.993564, 0.993212, 0.99285,
-    0.99248, 0.992099, 0.99171, 0.991311, 0.990903, 0.990485,
-    0.990058, 0.989622, 0.989177, 0.988722, 0.988258, 0.987784,
-    0.987301, 0.986809, 0.986308, 0.985798, 0.985278, 0.984749,
-    0.98421, 0.983662, 0.983105, 0.982539, 0.981964, 0.981379,
-    0.980785, 0.980182, 0.97957, 0.978948, 0.978317, 0.977677,
-    0.977028, 0.97637, 0.975702, 0.975025, 0.974339, 0.973644,
-    0.97294, 0.972226, 0.971504, 0.970772, 0.970031, 0.969281,
-    0.968522, 0.967754, 0.966976, 0.96619, 0.965394, 0.96459,
-    0.963776, 0.962953, 0.962121, 0.96128, 0.960431, 0.959572,
-    0.958703, 0.957826, 0.95694, 0.956045, 0.955141, 0.954228,
-    0.953306, 0.952375, 0.951435, 0.950486, 0.949528, 0.948561,
-    0.947586, 0.946601, 0.945607, 0.944605, 0.943593, 0.942573,
-    0.941544, 0.940506, 0.939459, 0.938404, 0.937339, 0.936266,
-    0.935184, 0.934093, 0.932993, 0.931884, 0.930767, 0.929641,
-    0.928506, 0.927363, 0.92621, 0.925049, 0.92388, 0.922701,
-    0.921514, 0.920318, 0.919114, 0.917901, 0.916679, 0.915449,
-    0.91421, 0.912962, 0.911706, 0.910441, 0.909168, 0.907886,
-    0.906596, 0.905297, 0.903989, 0.902673, 0.901349, 0.900016,
-    0.898674, 0.897325, 0.895966, 0.894599, 0.893224, 0.891841,
-    0.890449, 0.889048, 0.88764, 0.886223, 0.884797, 0.883363,
-    0.881921, 0.880471, 0.879012, 0.877545, 0.87607, 0.874587,
-    0.873095, 0.871595, 0.870087, 0.868571, 0.867046, 0.865514,
-    0.863973, 0.862424, 0.860867, 0.859302, 0.857729, 0.856147,
-    0.854558, 0.852961, 0.851355, 0.849742, 0.84812, 0.846491,
-    0.844854, 0.843208, 0.841555, 0.839894, 0.838225, 0.836548,
-    0.834863, 0.83317, 0.83147, 0.829761, 0.828045, 0.826321,
-    0.824589, 0.82285, 0.821103, 0.819348, 0.817585, 0.815814,
-    0.814036, 0.812251, 0.810457, 0.808656, 0.806848, 0.805031,
-    0.803208, 0.801376, 0.799537, 0.797691, 0.795837, 0.793975,
-    0.792107, 0.79023, 0.788346, 0.786455, 0.784557, 0.782651,
-    0.780737, 0.778817, 0.776888, 0.774953, 0.77301, 0.771061,
-    0.769103, 0.767139, 0.765167, 0.763188, 0.761202, 0.759209,
-    0.757209, 0.755201, 0.753187, 0.751165, 0.749136, 0.747101,
-    0.745058, 0.743008, 0.740951, 0.738887, 0.736817, 0.734739,
-    0.732654, 0.730563, 0.728464, 0.726359, 0.724247, 0.722128,
-    0.720003, 0.71787, 0.715731, 0.713585, 0.711432, 0.709273,
-    0.707107, 0.704934, 0.702755, 0.700569, 0.698376, 0.696177,
-    0.693971, 0.691759, 0.689541, 0.687315, 0.685084, 0.682846,
-    0.680601, 0.67835, 0.676093, 0.673829, 0.671559, 0.669283,
-    0.667, 0.664711, 0.662416, 0.660114, 0.657807, 0.655493,
-    0.653173, 0.650847, 0.648514, 0.646176, 0.643832, 0.641481,
-    0.639124, 0.636762, 0.634393, 0.632019, 0.629638, 0.627252,
-    0.624859, 0.622461, 0.620057, 0.617647, 0.615232, 0.61281,
-    0.610383, 0.60795, 0.605511, 0.603067, 0.600616, 0.598161,
-    0.595699, 0.593232, 0.59076, 0.588282, 0.585798, 0.583309,
-    0.580814, 0.578314, 0.575808, 0.573297, 0.570781, 0.568259,
-    0.565732, 0.563199, 0.560662, 0.558119, 0.55557, 0.553017,
-    0.550458, 0.547894, 0.545325, 0.542751, 0.540171, 0.537587,
-    0.534998, 0.532403, 0.529804, 0.527199, 0.52459, 0.521975,
-    0.519356, 0.516732, 0.514103, 0.511469, 0.50883, 0.506187,
-    0.503538, 0.500885, 0.498228, 0.495565, 0.492898, 0.490226,
-    0.48755, 0.484869, 0.482184, 0.479494, 0.476799, 0.4741,
-    0.471397, 0.468689, 0.465976, 0.46326, 0.460539, 0.457813,
-    0.455084, 0.45235, 0.449611, 0.446869, 0.444122, 0.441371,
-    0.438616, 0.435857, 0.433094, 0.430326, 0.427555, 0.42478,
-    0.422, 0.419217, 0.41643, 0.413638, 0.410843, 0.408044,
-    0.405241, 0.402435, 0.399624, 0.39681, 0.393992, 0.39117,
-    0.388345, 0.385516, 0.382683, 0.379847, 0.377007, 0.374164,
-    0.371317, 0.368467, 0.365613, 0.362756, 0.359895, 0.357031,
-    0.354164, 0.351293, 0.348419, 0.345541, 0.342661, 0.339777,
-    0.33689, 0.334, 0.331106, 0.32821, 0.32531, 0.322408,
-    0.319502, 0.316593, 0.313682, 0.310767, 0.30785, 0.304929,
-    0.302006, 0.29908, 0.296151, 0.293219, 0.290285, 0.287347,
-    0.284408, 0.281465, 0.27852, 0.275572, 0.272621, 0.269668,
-    0.266713, 0.263755, 0.260794, 0.257831, 0.254866, 0.251898,
-    0.248928, 0.245955, 0.24298, 0.240003, 0.237024, 0.234042,
-    0.231058, 0.228072, 0.225084, 0.222094, 0.219101, 0.216107,
-    0.21311, 0.210112, 0.207111, 0.204109, 0.201105, 0.198098,
-    0.19509, 0.19208, 0.189069, 0.186055, 0.18304, 0.180023,
-    0.177004, 0.173984, 0.170962, 0.167938, 0.164913, 0.161886,
-    0.158858, 0.155828, 0.152797, 0.149765, 0.14673, 0.143695,
-    0.140658, 0.13762, 0.134581, 0.13154, 0.128498, 0.125455,
-    0.122411, 0.119365, 0.116319, 0.113271, 0.110222, 0.107172,
-    0.104122, 0.10107, 0.0980171, 0.0949635, 0.091909, 0.0888536,
-    0.0857973, 0.0827403, 0.0796824, 0.0766239, 0.0735646, 0.0705046,
-    0.0674439, 0.0643826, 0.0613207, 0.0582583, 0.0551952, 0.0521317,
-    0.0490677, 0.0460032, 0.0429383, 0.0398729, 0.0368072, 0.0337412,
-    0.0306748, 0.0276081, 0.0245412, 0.0214741, 0.0184067, 0.0153392,
-    0.0122715, 0.00920375, 0.00613588, 0.00306796, 2.22045e-16, -0.00306796,
-    -0.00613588, -0.00920375, -0.0122715, -0.0153392, -0.0184067, -0.0214741,
-    -0.0245412, -0.0276081, -0.0306748, -0.0337412, -0.0368072, -0.0398729,
-    -0.0429383, -0.0460032, -0.0490677, -0.0521317, -0.0551952, -0.0582583,
-    -0.0613207, -0.0643826, -0.0674439, -0.0705046, -0.0735646, -0.0766239,
-    -0.0796824, -0.0827403, -0.0857973, -0.0888536, -0.091909, -0.0949635,
-    -0.0980171, -0.10107, -0.104122, -0.107172, -0.110222, -0.113271,
-    -0.116319, -0.119365, -0.122411, -0.125455, -0.128498, -0.13154,
-    -0.134581, -0.13762, -0.140658, -0.143695, -0.14673, -0.149765,
-    -0.152797, -0.155828, -0.158858, -0.161886, -0.164913, -0.167938,
-    -0.170962, -0.173984, -0.177004, -0.180023, -0.18304, -0.186055,
-    -0.189069, -0.19208, -0.19509, -0.198098, -0.201105, -0.204109,
-    -0.207111, -0.210112, -0.21311, -0.216107, -0.219101, -0.222094,
-    -0.225084, -0.228072, -0.231058, -0.234042, -0.237024, -0.240003,
-    -0.24298, -0.245955, -0.248928, -0.251898, -0.254866, -0.257831,
-    -0.260794, -0.263755, -0.266713, -0.269668, -0.272621, -0.275572,
-    -0.27852, -0.281465, -0.284408, -0.287347, -0.290285, -0.293219,
-    -0.296151, -0.29908, -0.302006, -0.304929, -0.30785, -0.310767,
-    -0.313682, -0.316593, -0.319502, -0.322408, -0.32531, -0.32821,
-    -0.331106, -0.334, -0.33689, -0.339777, -0.342661, -0.345541,
-    -0.348419, -0.351293, -0.354164, -0.357031, -0.359895, -0.362756,
-    -0.365613, -0.368467, -0.371317, -0.374164, -0.377007, -0.379847,
-    -0.382683, -0.385516, -0.388345, -0.39117, -0.393992, -0.39681,
-    -0.399624, -0.402435, -0.405241, -0.408044, -0.410843, -0.413638,
-    -0.41643, -0.419217, -0.422, -0.42478, -0.427555, -0.430326,
-    -0.433094, -0.435857, -0.438616, -0.441371, -0.444122, -0.446869,
-    -0.449611, -0.45235, -0.455084, -0.457813, -0.460539, -0.46326,
-    -0.465976, -0.468689, -0.471397, -0.4741, -0.476799, -0.479494,
-    -0.482184, -0.484869, -0.48755, -0.490226, -0.492898, -0.495565,
-    -0.498228, -0.500885, -0.503538, -0.506187, -0.50883, -0.511469,
-    -0.514103, -0.516732, -0.519356, -0.521975, -0.52459, -0.527199,
-    -0.529804, -0.532403, -0.534998, -0.537587, -0.540171, -0.542751,
-    -0.545325, -0.547894, -0.550458, -0.553017, -0.55557, -0.558119,
-    -0.560662, -0.563199, -0.565732, -0.568259, -0.570781, -0.573297,
-    -0.575808, -0.578314, -0.580814, -0.583309, -0.585798, -0.588282,
-    -0.59076, -0.593232, -0.595699, -0.598161, -0.600616, -0.603067,
-    -0.605511, -0.60795, -0.610383, -0.61281, -0.615232, -0.617647,
-    -0.620057, -0.622461, -0.624859, -0.627252, -0.629638, -0.632019,
-    -0.634393, -0.636762, -0.639124, -0.641481, -0.643832, -0.646176,
-    -0.648514, -0.650847, -0.653173, -0.655493, -0.657807, -0.660114,
-    -0.662416, -0.664711, -0.667, -0.669283, -0.671559, -0.673829,
-    -0.676093, -0.67835, -0.680601, -0.682846, -0.685084, -0.687315,
-    -0.689541, -0.691759, -0.693971, -0.696177, -0.698376, -0.700569,
-    -0.702755, -0.704934, -0.707107, -0.709273, -0.711432, -0.713585,
-    -0.715731, -0.71787, -0.720003, -0.722128, -0.724247, -0.726359,
-    -0.728464, -0.730563, -0.732654, -0.734739, -0.736817, -0.738887,
-    -0.740951, -0.743008, -0.745058, -0.747101, -0.749136, -0.751165,
-    -0.753187, -0.755201, -0.757209, -0.759209, -0.761202, -0.763188,
-    -0.765167, -0.767139, -0.769103, -0.771061, -0.77301, -0.774953,
-    -0.776888, -0.778817, -0.780737, -0.782651, -0.784557, -0.786455,
-    -0.788346, -0.79023, -0.792107, -0.793975, -0.795837, -0.797691,
-    -0.799537, -0.801376, -0.803208, -0.805031, -0.806848, -0.808656,
-    -0.810457, -0.812251, -0.814036, -0.815814, -0.817585, -0.819348,
-    -0.821103, -0.82285, -0.824589, -0.826321, -0.828045, -0.829761,
-    -0.83147, -0.83317, -0.834863, -0.836548, -0.838225, -0.839894,
-    -0.841555, -0.843208, -0.844854, -0.846491, -0.84812, -0.849742,
-    -0.851355, -0.852961, -0.854558, -0.856147, -0.857729, -0.859302,
-    -0.860867, -0.862424, -0.863973, -0.865514, -0.867046, -0.868571,
-    -0.870087, -0.871595, -0.873095, -0.874587, -0.87607, -0.877545,
-    -0.879012, -0.880471, -0.881921, -0.883363, -0.884797, -0.886223,
-    -0.88764, -0.889048, -0.890449, -0.891841, -0.893224, -0.894599,
-    -0.895966, -0.897325, -0.898674, -0.900016, -0.901349, -0.902673,
-    -0.903989, -0.905297, -0.906596, -0.907886, -0.909168, -0.910441,
-    -0.911706, -0.912962, -0.91421, -0.915449, -0.916679, -0.917901,
-    -0.919114, -0.920318, -0.921514, -0.922701, -0.92388, -0.925049,
-    -0.92621, -0.927363, -0.928506, -0.929641, -0.930767, -0.931884,
-    -0.932993, -0.934093, -0.935184, -0.936266, -0.937339, -0.938404,
-    -0.939459, -0.940506, -0.941544, -0.942573, -0.943593, -0.944605,
-    -0.945607, -0.946601, -0.947586, -0.948561, -0.949528, -0.950486,
-    -0.951435, -0.952375, -0.953306, -0.954228, -0.955141, -0.956045,
-    -0.95694, -0.957826, -0.958703, -0.959572, -0.960431, -0.96128,
-    -0.962121, -0.962953, -0.963776, -0.96459, -0.965394, -0.96619,
-    -0.966976, -0.967754, -0.968522, -0.969281, -0.970031, -0.970772,
-    -0.971504, -0.972226, -0.97294, -0.973644, -0.974339, -0.975025,
-    -0.975702, -0.97637, -0.977028, -0.977677, -0.978317, -0.978948,
-    -0.97957, -0.980182, -0.980785, -0.981379, -0.981964, -0.982539,
-    -0.983105, -0.983662, -0.98421, -0.984749, -0.985278, -0.985798,
-    -0.986308, -0.986809, -0.987301, -0.987784, -0.988258, -0.988722,
-    -0.989177, -0.989622, -0.990058, -0.990485, -0.990903, -0.991311,
-    -0.99171, -0.992099, -0.99248, -0.99285, -0.993212, -0.993564,
-    -0.993907, -0.99424, -0.994565, -0.994879, -0.995185, -0.995481,
-    -0.995767, -0.996045, -0.996313, -0.996571, -0.99682, -0.99706,
-    -0.99729, -0.997511, -0.997723, -0.997925, -0.998118, -0.998302,
-    -0.998476, -0.99864, -0.998795, -0.998941, -0.999078, -0.999205,
-    -0.999322, -0.999431, -0.999529, -0.999619, -0.999699, -0.999769,
-    -0.999831, -0.999882, -0.999925, -0.999958, -0.999981, -0.999995,
-    -1, -0.999995, -0.999981, -0.999958, -0.999925, -0.999882,
-    -0.999831, -0.999769, -0.999699, -0.999619, -0.999529, -0.999431,
-    -0.999322, -0.999205, -0.999078, -0.998941, -0.998795, -0.99864,
-    -0.998476, -0.998302, -0.998118, -0.997925, -0.997723, -0.997511,
-    -0.99729, -0.99706, -0.99682, -0.996571, -0.996313, -0.996045,
-    -0.995767, -0.995481, -0.995185, -0.994879, -0.994565, -0.99424,
-    -0.993907, -0.993564, -0.993212, -0.99285, -0.99248, -0.992099,
-    -0.99171, -0.991311, -0.990903, -0.990485, -0.990058, -0.989622,
-    -0.989177, -0.988722, -0.988258, -0.987784, -0.987301, -0.986809,
-    -0.986308, -0.985798, -0.985278, -0.984749, -0.98421, -0.983662,
-    -0.983105, -0.982539, -0.981964, -0.981379, -0.980785, -0.980182,
-    -0.97957, -0.978948, -0.978317, -0.977677, -0.977028, -0.97637,
-    -0.975702, -0.975025, -0.974339, -0.973644, -0.97294, -0.972226,
-    -0.971504, -0.970772, -0.970031, -0.969281, -0.968522, -0.967754,
-    -0.966976, -0.96619, -0.965394, -0.96459, -0.963776, -0.962953,
-    -0.962121, -0.96128, -0.960431, -0.959572, -0.958703, -0.957826,
-    -0.95694, -0.956045, -0.955141, -0.954228, -0.953306, -0.952375,
-    -0.951435, -0.950486, -0.949528, -0.948561, -0.947586, -0.946601,
-    -0.945607, -0.944605, -0.943593, -0.942573, -0.941544, -0.940506,
-    -0.939459, -0.938404, -0.937339, -0.936266, -0.935184, -0.934093,
-    -0.932993, -0.931884, -0.930767, -0.929641, -0.928506, -0.927363,
-    -0.92621, -0.925049, -0.92388, -0.922701, -0.921514, -0.920318,
-    -0.919114, -0.917901, -0.916679, -0.915449, -0.91421, -0.912962,
-    -0.911706, -0.910441, -0.909168, -0.907886, -0.906596, -0.905297,
-    -0.903989, -0.902673, -0.901349, -0.900016, -0.898674, -0.897325,
-    -0.895966, -0.894599, -0.893224, -0.891841, -0.890449, -0.889048,
-    -0.88764, -0.886223, -0.884797, -0.883363, -0.881921, -0.880471,
-    -0.879012, -0.877545, -0.87607, -0.874587, -0.873095, -0.871595,
-    -0.870087, -0.868571, -0.867046, -0.865514, -0.863973, -0.862424,
-    -0.860867, -0.859302, -0.857729, -0.856147, -0.854558, -0.852961,
-    -0.851355, -0.849742, -0.84812, -0.846491, -0.844854, -0.843208,
-    -0.841555, -0.839894, -0.838225, -0.836548, -0.834863, -0.83317,
-    -0.83147, -0.829761, -0.828045, -0.826321, -0.824589, -0.82285,
-    -0.821103, -0.819348, -0.817585, -0.815814, -0.814036, -0.812251,
-    -0.810457, -0.808656, -0.806848, -0.805031, -0.803208, -0.801376,
-    -0.799537, -0.797691, -0.795837, -0.793975, -0.792107, -0.79023,
-    -0.788346, -0.786455, -0.784557, -0.782651, -0.780737, -0.778817,
-    -0.776888, -0.774953, -0.77301, -0.771061, -0.769103, -0.767139,
-    -0.765167, -0.763188, -0.761202, -0.759209, -0.757209, -0.755201,
-    -0.753187, -0.751165, -0.749136, -0.747101, -0.745058, -0.743008,
-    -0.740951, -0.738887, -0.736817, -0.734739, -0.732654, -0.730563,
-    -0.728464, -0.726359, -0.724247, -0.722128, -0.720003, -0.71787,
-    -0.715731, -0.713585, -0.711432, -0.709273, -0.707107, -0.704934,
-    -0.702755, -0.700569, -0.698376, -0.696177, -0.693971, -0.691759,
-    -0.689541, -0.687315, -0.685084, -0.682846, -0.680601, -0.67835,
-    -0.676093, -0.673829, -0.671559, -0.669283, -0.667, -0.664711,
-    -0.662416, -0.660114, -0.657807, -0.655493, -0.653173, -0.650847,
-    -0.648514, -0.646176, -0.643832, -0.641481, -0.639124, -0.636762,
-    -0.634393, -0.632019, -0.629638, -0.627252, -0.624859, -0.622461,
-    -0.620057, -0.617647, -0.615232, -0.61281, -0.610383, -0.60795,
-    -0.605511, -0.603067, -0.600616, -0.598161, -0.595699, -0.593232,
-    -0.59076, -0.588282, -0.585798, -0.583309, -0.580814, -0.578314,
-    -0.575808, -0.573297, -0.570781, -0.568259, -0.565732, -0.563199,
-    -0.560662, -0.558119, -0.55557, -0.553017, -0.550458, -0.547894,
-    -0.545325, -0.542751, -0.540171, -0.537587, -0.534998, -0.532403,
-    -0.529804, -0.527199, -0.52459, -0.521975, -0.519356, -0.516732,
-    -0.514103, -0.511469, -0.50883, -0.506187, -0.503538, -0.500885,
-    -0.498228, -0.495565, -0.492898, -0.490226, -0.48755, -0.484869,
-    -0.482184, -0.479494, -0.476799, -0.4741, -0.471397, -0.468689,
-    -0.465976, -0.46326, -0.460539, -0.457813, -0.455084, -0.45235,
-    -0.449611, -0.446869, -0.444122, -0.441371, -0.438616, -0.435857,
-    -0.433094, -0.430326, -0.427555, -0.42478, -0.422, -0.419217,
-    -0.41643, -0.413638, -0.410843, -0.408044, -0.405241, -0.402435,
-    -0.399624, -0.39681, -0.393992, -0.39117, -0.388345, -0.385516,
-    -0.382683, -0.379847, -0.377007, -0.374164, -0.371317, -0.368467,
-    -0.365613, -0.362756, -0.359895, -0.357031, -0.354164, -0.351293,
-    -0.348419, -0.345541, -0.342661, -0.339777, -0.33689, -0.334,
-    -0.331106, -0.32821, -0.32531, -0.322408, -0.319502, -0.316593,
-    -0.313682, -0.310767, -0.30785, -0.304929, -0.302006, -0.29908,
-    -0.296151, -0.293219, -0.290285, -0.287347, -0.284408, -0.281465,
-    -0.27852, -0.275572, -0.272621, -0.269668, -0.266713, -0.263755,
-    -0.260794, -0.257831, -0.254866, -0.251898, -0.248928, -0.245955,
-    -0.24298, -0.240003, -0.237024, -0.234042, -0.231058, -0.228072,
-    -0.225084, -0.222094, -0.219101, -0.216107, -0.21311, -0.210112,
-    -0.207111, -0.204109, -0.201105, -0.198098, -0.19509, -0.19208,
-    -0.189069, -0.186055, -0.18304, -0.180023, -0.177004, -0.173984,
-    -0.170962, -0.167938, -0.164913, -0.161886, -0.158858, -0.155828,
-    -0.152797, -0.149765, -0.14673, -0.143695, -0.140658, -0.13762,
-    -0.134581, -0.13154, -0.128498, -0.125455, -0.122411, -0.119365,
-    -0.116319, -0.113271, -0.110222, -0.107172, -0.104122, -0.10107,
-    -0.0980171, -0.0949635, -0.091909, -0.0888536, -0.0857973, -0.0827403,
-    -0.0796824, -0.0766239, -0.0735646, -0.0705046, -0.0674439, -0.0643826,
-    -0.0613207, -0.0582583, -0.0551952, -0.0521317, -0.0490677, -0.0460032,
-    -0.0429383, -0.0398729, -0.0368072, -0.0337412, -0.0306748, -0.0276081,
-    -0.0245412, -0.0214741, -0.0184067, -0.0153392, -0.0122715, -0.00920375,
-    -0.00613588, -0.00306796
-};
-
-static const float *WAVE_TRIANGLES[DEFAULT_OCTAVES] = {
-    WAVE_TRIANGLE_000, WAVE_TRIANGLE_006, WAVE_TRIANGLE_018,
-    WAVE_TRIANGLE_030, WAVE_TRIANGLE_042, WAVE_TRIANGLE_054,
-    WAVE_TRIANGLE_066, WAVE_TRIANGLE_078, WAVE_TRIANGLE_090,
-    WAVE_TRIANGLE_102, WAVE_TRIANGLE_114, WAVE_TRIANGLE_126
-};